@@ -24,7 +24,8 @@ ELSEIF(${CMAKE_SYSTEM_NAME} MATCHES "Windows")
     #hid required for HidD_SetOutputReport() in DualShock4 controller
     #setupapi required by hidapi
     #dinput8 required by libstem_gamepad
-    list(APPEND PLATFORM_LIBS bthprops setupapi hid dinput8)
+    #avrt required for the MMCSS thread priorities (ServerUtility::set_current_thread_priority)
+    list(APPEND PLATFORM_LIBS bthprops setupapi hid dinput8 avrt winusb)
     IF(MINGW)
         #list(APPEND PLATFORM_LIBS stdc++)
     ENDIF(MINGW)
@@ -166,6 +167,14 @@ set(PROTOBUF_ORIG_FIND_LIBRARY_SUFFIXES "${CMAKE_FIND_LIBRARY_SUFFIXES}") # Stor
 set(CMAKE_FIND_LIBRARY_SUFFIXES .a .lib .so .dylib .dll)  # Prefer static libs
 find_package(Protobuf REQUIRED)
 set(CMAKE_FIND_LIBRARY_SUFFIXES "${PROTOBUF_ORIG_FIND_LIBRARY_SUFFIXES}")  # Restore original
+# The service and client only serialize and parse PSMoveProtocol messages,
+# so they can do without the reflection of the full runtime (smaller binaries, faster parses)
+option(PSM_PROTOBUF_LITE "Build PSMoveProtocol against the protobuf lite runtime" OFF)
+IF(PSM_PROTOBUF_LITE)
+    set(PSM_PROTOBUF_LIBRARIES ${PROTOBUF_LITE_LIBRARIES})
+ELSE()
+    set(PSM_PROTOBUF_LIBRARIES ${PROTOBUF_LIBRARIES})
+ENDIF()
 include_directories(${CMAKE_BINARY_DIR}/psmoveprotocol)  # This is where the .proto files are compiled to.
 IF(${CMAKE_SYSTEM_NAME} MATCHES "Darwin")
     # protobuf current generates many warnings in MacOS:
@@ -0,0 +1,206 @@
+//-- includes -----
+#include "ClientDataFrameParser.h"
+#include "PSMoveProtocol.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+//-- constants -----
+// Field numbers of DeviceOutputDataFrame and of its device packets in PSMoveProtocol.proto
+static const int k_controller_data_packet_field= 2;
+static const int k_tracker_data_packet_field= 3;
+static const int k_hmd_data_packet_field= 4;
+static const int k_packet_device_id_field= 1;
+static const int k_packet_sequence_num_field= 3;
+
+//-- public methods -----
+ClientDataFrameParser::ClientDataFrameParser()
+    : m_arena(make_arena_options(m_initial_block))
+    , m_data_frame(nullptr)
+{
+    reset_sequence_numbers();
+}
+
+const PSMoveProtocol::DeviceOutputDataFrame *ClientDataFrameParser::parse(
+    const uint8_t *message_bytes,
+    unsigned int message_size)
+{
+    // Nothing can still be looking at the previous frame by now,
+    // so hand its memory back to the arena (keeping the initial block)
+    m_data_frame= nullptr;
+    m_arena.Reset();
+
+    PSMoveProtocol::DeviceOutputDataFrame *data_frame=
+        google::protobuf::Arena::CreateMessage<PSMoveProtocol::DeviceOutputDataFrame>(&m_arena);
+
+    // An empty body is a valid frame with every field at its default
+    if (message_size == 0 || data_frame->ParseFromArray(message_bytes, static_cast<int>(message_size)))
+    {
+        m_data_frame= data_frame;
+    }
+
+    return m_data_frame;
+}
+
+size_t ClientDataFrameParser::get_arena_space_used() const
+{
+    return static_cast<size_t>(m_arena.SpaceUsed());
+}
+
+bool ClientDataFrameParser::is_stale_frame(
+    const uint8_t *message_bytes,
+    unsigned int message_size)
+{
+    int device_category;
+    int device_id;
+    int sequence_num;
+    bool bIsStale= false;
+
+    if (peek_sequence_number(message_bytes, message_size, device_category, device_id, sequence_num))
+    {
+        int *last_sequence_num= get_last_sequence_num(device_category, device_id);
+
+        // Frames for an unknown device get left to the full parse to deal with
+        if (last_sequence_num != nullptr)
+        {
+            if (sequence_num <= *last_sequence_num)
+            {
+                bIsStale= true;
+            }
+            else
+            {
+                *last_sequence_num= sequence_num;
+            }
+        }
+    }
+
+    return bIsStale;
+}
+
+void ClientDataFrameParser::reset_sequence_numbers()
+{
+    std::fill(m_last_controller_sequence_num, m_last_controller_sequence_num + PSMOVESERVICE_MAX_CONTROLLER_COUNT, -1);
+    std::fill(m_last_tracker_sequence_num, m_last_tracker_sequence_num + PSMOVESERVICE_MAX_TRACKER_COUNT, -1);
+    std::fill(m_last_hmd_sequence_num, m_last_hmd_sequence_num + PSMOVESERVICE_MAX_HMD_COUNT, -1);
+}
+
+//-- private methods -----
+bool ClientDataFrameParser::peek_sequence_number(
+    const uint8_t *message_bytes,
+    unsigned int message_size,
+    int &out_device_category,
+    int &out_device_id,
+    int &out_sequence_num)
+{
+    using google::protobuf::internal::WireFormatLite;
+
+    google::protobuf::io::CodedInputStream input(message_bytes, static_cast<int>(message_size));
+    google::protobuf::uint32 tag;
+
+    // The service serializes fields in field number order, so the device packet
+    // comes right after the category, and its id and sequence number come first in it
+    while ((tag= input.ReadTag()) != 0)
+    {
+        const int field= WireFormatLite::GetTagFieldNumber(tag);
+
+        if ((field == k_controller_data_packet_field ||
+             field == k_tracker_data_packet_field ||
+             field == k_hmd_data_packet_field) &&
+            WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+        {
+            google::protobuf::uint32 packet_size;
+            if (!input.ReadVarint32(&packet_size))
+            {
+                return false;
+            }
+
+            const google::protobuf::io::CodedInputStream::Limit limit= input.PushLimit(static_cast<int>(packet_size));
+            google::protobuf::uint32 device_id= 0;
+            google::protobuf::uint32 sequence_num= 0;
+
+            while ((tag= input.ReadTag()) != 0)
+            {
+                const int packet_field= WireFormatLite::GetTagFieldNumber(tag);
+
+                if (packet_field == k_packet_device_id_field &&
+                    WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_VARINT)
+                {
+                    if (!input.ReadVarint32(&device_id))
+                        return false;
+                }
+                else if (packet_field == k_packet_sequence_num_field &&
+                         WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_VARINT)
+                {
+                    if (!input.ReadVarint32(&sequence_num))
+                        return false;
+
+                    // Nothing past the sequence number matters here
+                    break;
+                }
+                else if (packet_field > k_packet_sequence_num_field || !WireFormatLite::SkipField(&input, tag))
+                {
+                    break;
+                }
+            }
+            input.PopLimit(limit);
+
+            switch (field)
+            {
+            case k_controller_data_packet_field:
+                out_device_category= PSMoveProtocol::DeviceOutputDataFrame::CONTROLLER;
+                break;
+            case k_tracker_data_packet_field:
+                out_device_category= PSMoveProtocol::DeviceOutputDataFrame::TRACKER;
+                break;
+            default:
+                out_device_category= PSMoveProtocol::DeviceOutputDataFrame::HMD;
+                break;
+            }
+            out_device_id= static_cast<int>(device_id);
+            out_sequence_num= static_cast<int>(sequence_num);
+
+            return true;
+        }
+        else if (!WireFormatLite::SkipField(&input, tag))
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+int *ClientDataFrameParser::get_last_sequence_num(int device_category, int device_id)
+{
+    int *last_sequence_num= nullptr;
+
+    switch (device_category)
+    {
+    case PSMoveProtocol::DeviceOutputDataFrame::CONTROLLER:
+        if (device_id >= 0 && device_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT)
+            last_sequence_num= &m_last_controller_sequence_num[device_id];
+        break;
+    case PSMoveProtocol::DeviceOutputDataFrame::TRACKER:
+        if (device_id >= 0 && device_id < PSMOVESERVICE_MAX_TRACKER_COUNT)
+            last_sequence_num= &m_last_tracker_sequence_num[device_id];
+        break;
+    case PSMoveProtocol::DeviceOutputDataFrame::HMD:
+        if (device_id >= 0 && device_id < PSMOVESERVICE_MAX_HMD_COUNT)
+            last_sequence_num= &m_last_hmd_sequence_num[device_id];
+        break;
+    }
+
+    return last_sequence_num;
+}
+
+google::protobuf::ArenaOptions ClientDataFrameParser::make_arena_options(char *initial_block)
+{
+    google::protobuf::ArenaOptions options;
+
+    options.initial_block= initial_block;
+    options.initial_block_size= k_initial_block_size;
+
+    return options;
+}
@@ -0,0 +1,73 @@
+#ifndef CLIENT_DATA_FRAME_PARSER_H
+#define CLIENT_DATA_FRAME_PARSER_H
+
+//-- includes -----
+#include "SharedConstants.h"
+#include <google/protobuf/arena.h>
+#include <stdint.h>
+
+//-- pre-declarations -----
+namespace PSMoveProtocol
+{
+    class DeviceOutputDataFrame;
+};
+
+//-- definitions -----
+/// Parses the protobuf data frames the service streams to the client.
+/**
+ Clearing a plain DeviceOutputDataFrame for the next parse deletes every submessage
+ (controller packet, pose, physics, sensor data, ...) so parsing used to cost a dozen
+ or so heap allocations per frame. Instead every frame gets parsed into an arena whose
+ first block is owned by the parser and gets recycled before the next parse,
+ so a steady stream of frames that fit in it never touches the heap.
+
+ Datagrams can also arrive out of order, so the parser remembers the newest
+ sequence number it let through for every device and is_stale_frame() throws out
+ older ones after reading just the device id and sequence number off the wire,
+ instead of parsing the whole frame only for the device view to ignore it.
+ */
+class ClientDataFrameParser
+{
+public:
+    ClientDataFrameParser();
+
+    /// Parses the message body of a data frame (what follows the length header).
+    /// The returned frame stays valid until the next call, nullptr if the frame is malformed.
+    const PSMoveProtocol::DeviceOutputDataFrame *parse(const uint8_t *message_bytes, unsigned int message_size);
+
+    /// Bytes of the arena the last frame used, including what had to be allocated past the initial block
+    size_t get_arena_space_used() const;
+
+    /// True if the device already got a frame with the same or a newer sequence number.
+    /// Otherwise the frame's sequence number becomes the newest one for its device.
+    bool is_stale_frame(const uint8_t *message_bytes, unsigned int message_size);
+
+    /// Forgets the sequence numbers seen so far (a new connection may be to a restarted service)
+    void reset_sequence_numbers();
+
+private:
+    // Reads the device packet's category, id and sequence number without parsing the frame.
+    // Returns false if the frame doesn't hold a device packet.
+    static bool peek_sequence_number(
+        const uint8_t *message_bytes, unsigned int message_size,
+        int &out_device_category, int &out_device_id, int &out_sequence_num);
+
+    int *get_last_sequence_num(int device_category, int device_id);
+
+    // Comfortably fits a data frame with every optional section filled in
+    static const size_t k_initial_block_size= 16*1024;
+
+    static google::protobuf::ArenaOptions make_arena_options(char *initial_block);
+
+    // Must be declared ahead of the arena, which gets constructed on top of it
+    char m_initial_block[k_initial_block_size];
+    google::protobuf::Arena m_arena;
+    PSMoveProtocol::DeviceOutputDataFrame *m_data_frame;
+
+    // Newest sequence number let through per device, -1 before the first frame
+    int m_last_controller_sequence_num[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    int m_last_tracker_sequence_num[PSMOVESERVICE_MAX_TRACKER_COUNT];
+    int m_last_hmd_sequence_num[PSMOVESERVICE_MAX_HMD_COUNT];
+};
+
+#endif // CLIENT_DATA_FRAME_PARSER_H
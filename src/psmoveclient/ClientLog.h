@@ -53,7 +53,9 @@ PSM_CPP_PRIVATE_FUNCTION(void) log_init(e_log_severity_level level);
 PSM_CPP_PUBLIC_FUNCTION(bool) log_can_emit_level(e_log_severity_level level);
 
 //-- macros -----
-#define SELECT_LOG_STREAM(level) (log_can_emit_level(level) ? g_normal_logger : g_null_logger)
+// Disabled log lines skip the whole stream expression rather than formatting into the null stream,
+// which keeps the trace and debug lines on the per data frame path free
+#define SELECT_LOG_STREAM(level) if (!log_can_emit_level(level)) {} else g_normal_logger
 
 #define CLIENT_LOG_TRACE(function_name) SELECT_LOG_STREAM(_log_severity_level_trace) << "[TRACE] " << function_name << " - "
 #define CLIENT_LOG_DEBUG(function_name) SELECT_LOG_STREAM(_log_severity_level_debug) << "[DEBUG] " << function_name << " - "
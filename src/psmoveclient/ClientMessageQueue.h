@@ -0,0 +1,145 @@
+#ifndef CLIENT_MESSAGE_QUEUE_H
+#define CLIENT_MESSAGE_QUEUE_H
+
+//-- includes -----
+#include <assert.h>
+#include <vector>
+
+//-- definitions -----
+/// FIFO ring of messages used to hand responses and events to the client between updates.
+/**
+ The ring is allocated up front and slots get reused, so queueing and draining messages
+ every update never allocates. If a burst ever fills the ring it doubles in size rather
+ than dropping messages, after which it stays at that high water mark.
+ */
+template <typename t_message>
+class ClientMessageQueue
+{
+public:
+    explicit ClientMessageQueue(int initial_capacity)
+        : m_messages(initial_capacity > 0 ? initial_capacity : 1)
+        , m_head_index(0)
+        , m_size(0)
+    {
+    }
+
+    inline int size() const
+    {
+        return m_size;
+    }
+
+    inline bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    void clear()
+    {
+        m_head_index = 0;
+        m_size = 0;
+    }
+
+    void push_back(const t_message &message)
+    {
+        if (m_size == capacity())
+        {
+            grow();
+        }
+
+        m_messages[(m_head_index + m_size) % capacity()] = message;
+        ++m_size;
+    }
+
+    const t_message &front() const
+    {
+        assert(m_size > 0);
+        return m_messages[m_head_index];
+    }
+
+    void pop_front()
+    {
+        assert(m_size > 0);
+        m_head_index = (m_head_index + 1) % capacity();
+        --m_size;
+    }
+
+private:
+    inline int capacity() const
+    {
+        return static_cast<int>(m_messages.size());
+    }
+
+    void grow()
+    {
+        std::vector<t_message> grown_messages(m_messages.size() * 2);
+
+        for (int message_index = 0; message_index < m_size; ++message_index)
+        {
+            grown_messages[message_index] = m_messages[(m_head_index + message_index) % capacity()];
+        }
+
+        m_messages.swap(grown_messages);
+        m_head_index = 0;
+    }
+
+    std::vector<t_message> m_messages;
+    int m_head_index;
+    int m_size;
+};
+
+/// Pool of protocol messages whose raw pointers get handed out until the next update.
+/**
+ Copying into a pooled message reuses the submessages, repeated fields and strings
+ it allocated the last time around, so a steady stream of responses or events of the
+ same shape stops allocating once the pool has warmed up.
+ */
+template <typename t_protocol_message>
+class ClientProtocolMessagePool
+{
+public:
+    explicit ClientProtocolMessagePool(int initial_capacity)
+        : m_used_count(0)
+    {
+        m_messages.reserve(initial_capacity);
+
+        for (int message_index = 0; message_index < initial_capacity; ++message_index)
+        {
+            m_messages.push_back(new t_protocol_message);
+        }
+    }
+
+    ~ClientProtocolMessagePool()
+    {
+        for (t_protocol_message *message : m_messages)
+        {
+            delete message;
+        }
+    }
+
+    // The copy stays valid until the next release_all()
+    const t_protocol_message *acquire_copy(const t_protocol_message &source)
+    {
+        if (m_used_count == m_messages.size())
+        {
+            m_messages.push_back(new t_protocol_message);
+        }
+
+        t_protocol_message *message = m_messages[m_used_count];
+        ++m_used_count;
+
+        message->CopyFrom(source);
+
+        return message;
+    }
+
+    void release_all()
+    {
+        m_used_count = 0;
+    }
+
+private:
+    std::vector<t_protocol_message *> m_messages;
+    size_t m_used_count;
+};
+
+#endif // CLIENT_MESSAGE_QUEUE_H
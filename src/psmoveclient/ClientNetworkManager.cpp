@@ -1,12 +1,21 @@
 //-- includes -----
 #include "ClientNetworkManager.h"
+#include "ClientDataFrameParser.h"
 #include "ClientLog.h"
+#include "CompactDataFrame.h"
 #include "PackedMessage.h"
 #include "PSMoveProtocol.pb.h"
+#include "SharedConstants.h"
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
 #include <string>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <deque>
 #include <boost/asio.hpp>
@@ -14,6 +23,15 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/cstdint.hpp>
 
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+    #ifdef _WIN32
+        #include <process.h>
+        #define getpid _getpid
+    #else
+        #include <unistd.h>
+    #endif
+#endif
+
 //-- pre-declarations -----
 using namespace std;
 namespace asio = boost::asio;
@@ -21,6 +39,12 @@ using asio::ip::tcp;
 using asio::ip::udp;
 using boost::uint8_t;
 
+// The requests go over TCP or a unix domain socket (the data frames over UDP or a unix datagram socket),
+// see PSMOVESERVICE_LOCAL_ADDRESS_PREFIX
+typedef asio::generic::stream_protocol::socket t_request_socket;
+typedef asio::generic::datagram_protocol::socket t_data_frame_socket;
+typedef asio::generic::datagram_protocol::endpoint t_data_frame_endpoint;
+
 //-- implementation -----
 
 // -ClientNetworkManagerImpl-
@@ -39,11 +63,22 @@ public:
         , m_server_port(port)
 
         , m_io_service()
+        , m_udp_io_service()
+        , m_udp_io_service_work(new asio::io_service::work(m_udp_io_service))
+        , m_bUseNetworkThread(false)
+        , m_network_thread()
         , m_tcp_socket(m_io_service)
         , m_tcp_connection_id(-1)
-        , m_udp_socket(m_io_service, udp::endpoint(udp::v4(), 0))
+        , m_udp_socket(m_udp_io_service)
         , m_udp_server_endpoint()
         , m_udp_remote_endpoint()
+        , m_local_data_frame_socket_path()
+        , m_data_frame_wait_timer(m_udp_io_service)
+        , m_bDataFrameWaitTimedOut(false)
+        , m_data_frame_mutex()
+        , m_data_frame_received_cv()
+        , m_received_datagram_count(0)
+        , m_last_waited_datagram_count(0)
         , m_connection_stopped(false)
         , m_has_pending_tcp_read(false)
         , m_has_pending_tcp_write(false)
@@ -53,7 +88,8 @@ public:
         , m_response_read_buffer()
         , m_packed_response(std::shared_ptr<PSMoveProtocol::Response>(new PSMoveProtocol::Response()))
 
-        , m_packed_output_data_frame(std::shared_ptr<PSMoveProtocol::DeviceOutputDataFrame>(new PSMoveProtocol::DeviceOutputDataFrame()))
+        , m_packed_output_data_frame()
+        , m_data_frame_parser()
     
         , m_write_bufer()
         , m_packed_request()
@@ -67,13 +103,52 @@ public:
         memset(m_output_data_frame_buffer, 0, sizeof(m_output_data_frame_buffer));
     }
 
-    bool start()
+    ~ClientNetworkManagerImpl()
+    {
+        stop_network_thread();
+        remove_local_data_frame_socket_file();
+    }
+
+    bool start(bool bUseNetworkThread)
     {
-        tcp::resolver resolver(m_io_service);
-        tcp::resolver::iterator endpoint_iter= resolver.resolve(tcp::resolver::query(tcp::v4(), m_server_host, m_server_port));
+        // A previous connection attempt may have left its network thread running
+        stop_network_thread();
+        m_udp_io_service.reset();
 
+        m_bUseNetworkThread= bUseNetworkThread;
         m_connection_stopped= false;
-        bool success= start_tcp_connect(endpoint_iter);
+        m_data_frame_parser.reset_sequence_numbers();
+
+        const std::string local_prefix= PSMOVESERVICE_LOCAL_ADDRESS_PREFIX;
+        bool success;
+
+        if (m_server_host.compare(0, local_prefix.size(), local_prefix) == 0)
+        {
+            const std::string local_socket_path= m_server_host.substr(local_prefix.size());
+
+            success= start_local_connect(
+                local_socket_path.empty() ? std::string(PSMOVESERVICE_DEFAULT_LOCAL_SOCKET_PATH) : local_socket_path);
+        }
+        else
+        {
+            success= open_udp_socket();
+
+            if (success)
+            {
+                tcp::resolver resolver(m_io_service);
+                tcp::resolver::iterator endpoint_iter= resolver.resolve(tcp::resolver::query(tcp::v4(), m_server_host, m_server_port));
+
+                success= start_tcp_connect(endpoint_iter);
+            }
+        }
+
+        if (success && m_bUseNetworkThread)
+        {
+            CLIENT_LOG_INFO("ClientNetworkManager::start") << "Starting network thread" << std::endl;
+
+            // The io_service work keeps run() going until stop_network_thread()
+            m_network_thread= std::thread(&ClientNetworkManagerImpl::network_thread_func, this);
+        }
 
         return success;
     }
@@ -89,12 +164,19 @@ public:
         // Stamp the packet with the connection ID before it goes out
         data_frame->set_connection_id(m_tcp_connection_id);
 
-        m_pending_data_frames.push_back(data_frame);
-        start_udp_queued_data_frame_write();
+        dispatch_udp(boost::bind(&ClientNetworkManagerImpl::queue_device_data_frame, this, data_frame));
     }
 
     void poll()
     {
+        if (m_bUseNetworkThread)
+        {
+            // The network thread services the UDP socket on its own.
+            // This call executes the TCP callbacks and anything the network thread handed back.
+            m_io_service.poll();
+            return;
+        }
+
         bool keep_polling = true;
         int iteration_count = 0;
         const static int k_max_iteration_count = 32;
@@ -104,11 +186,13 @@ public:
             // Start any pending writes on the UDP socket that can be started
             start_udp_queued_data_frame_write();
 
-            // This call can execute any of the following callbacks:
+            // These calls can execute any of the following callbacks:
             // * TCP request has finished writing
             // * TCP response has finished receiving
             // * UDP data frame has finished writing
+            // * UDP data frame has finished receiving
             m_io_service.poll();
+            m_udp_io_service.poll();
 
             // In the event that a UDP data frame write completed immediately,
             // we should start another UDP data frame write.
@@ -120,8 +204,63 @@ public:
 
     }
 
+    bool get_is_network_thread() const
+    {
+        return m_bUseNetworkThread && std::this_thread::get_id() == m_network_thread.get_id();
+    }
+
+    bool wait_for_data_frame(int timeout_ms)
+    {
+        std::unique_lock<std::mutex> lock(m_data_frame_mutex);
+
+        if (m_received_datagram_count == m_last_waited_datagram_count && timeout_ms > 0)
+        {
+            if (m_bUseNetworkThread)
+            {
+                m_data_frame_received_cv.wait_for(
+                    lock, std::chrono::milliseconds(timeout_ms),
+                    [this]() { return m_received_datagram_count != m_last_waited_datagram_count; });
+            }
+            else
+            {
+                // Nobody else touches the counter without the network thread
+                lock.unlock();
+
+                m_bDataFrameWaitTimedOut= false;
+                m_data_frame_wait_timer.expires_from_now(boost::posix_time::milliseconds(timeout_ms));
+                m_data_frame_wait_timer.async_wait(
+                    boost::bind(&ClientNetworkManagerImpl::handle_data_frame_wait_timeout, this, asio::placeholders::error));
+
+                // Sleep on the UDP socket, one handler at a time, until a data frame read completes or the timer fires
+                while (m_received_datagram_count == m_last_waited_datagram_count && 
+                       !m_bDataFrameWaitTimedOut && 
+                       !m_connection_stopped)
+                {
+                    if (m_udp_io_service.run_one() == 0)
+                    {
+                        break;
+                    }
+                }
+
+                // The aborted timer handler just runs on some later poll
+                boost::system::error_code cancel_error;
+                m_data_frame_wait_timer.cancel(cancel_error);
+
+                lock.lock();
+            }
+        }
+
+        const bool bHasNewDataFrame= m_received_datagram_count != m_last_waited_datagram_count;
+        m_last_waited_datagram_count= m_received_datagram_count;
+
+        return bHasNewDataFrame;
+    }
+
     void stop()
     {
+        // Nothing may touch the UDP socket from the network thread once we start tearing down
+        stop_network_thread();
+
         // drain any pending requests
         while (m_pending_requests.size() > 0)
         {
@@ -165,6 +304,9 @@ public:
             }
         }
 
+        // The service can't send to a local client once its socket file is gone
+        remove_local_data_frame_socket_file();
+
         m_connection_stopped= true;
         m_has_pending_tcp_read= false;
         m_has_pending_tcp_write= false;
@@ -173,6 +315,207 @@ public:
     }
 
 private:
+    // (Re)opens the data frame socket on an ephemeral UDP port
+    bool open_udp_socket()
+    {
+        boost::system::error_code error;
+
+        if (m_udp_socket.is_open())
+        {
+            m_udp_socket.close(error);
+        }
+
+        m_udp_socket.open(udp::v4(), error);
+        if (!error)
+        {
+            m_udp_socket.bind(udp::endpoint(udp::v4(), 0), error);
+        }
+
+        if (error)
+        {
+            CLIENT_LOG_ERROR("ClientNetworkManager::open_udp_socket") << "Unable to open the UDP socket: " << error.message() << std::endl;
+
+            stop();
+
+            if (m_netEventListener)
+            {
+                m_netEventListener->handle_server_connection_open_failed(error);
+            }
+        }
+
+        return !error;
+    }
+
+    // Connects to the service's unix domain sockets instead of TCP/UDP.
+    // The UDP connection handshake still runs, but over a unix datagram socket bound next to the service's.
+    bool start_local_connect(const std::string &local_socket_path)
+    {
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+        static int s_next_local_socket_index= 0;
+        boost::system::error_code error;
+
+        // Both sockets of the connection live in the service's socket directory
+        const std::string server_data_frame_socket_path= local_socket_path + PSMOVESERVICE_LOCAL_DATA_FRAME_SOCKET_SUFFIX;
+        std::stringstream client_data_frame_socket_path;
+        client_data_frame_socket_path 
+            << server_data_frame_socket_path << "." << getpid() << "." << s_next_local_socket_index++;
+
+        if (m_udp_socket.is_open())
+        {
+            m_udp_socket.close(error);
+        }
+        remove_local_data_frame_socket_file();
+
+        m_udp_socket.open(asio::local::datagram_protocol(), error);
+        if (!error)
+        {
+            m_local_data_frame_socket_path= client_data_frame_socket_path.str();
+            std::remove(m_local_data_frame_socket_path.c_str());
+            m_udp_socket.bind(asio::local::datagram_protocol::endpoint(m_local_data_frame_socket_path), error);
+        }
+
+        if (error)
+        {
+            CLIENT_LOG_ERROR("ClientNetworkManager::start_local_connect") 
+                << "Unable to open local datagram socket " << client_data_frame_socket_path.str() << ": " << error.message() << std::endl;
+
+            stop();
+
+            if (m_netEventListener)
+            {
+                m_netEventListener->handle_server_connection_open_failed(error);
+            }
+
+            return false;
+        }
+
+        CLIENT_LOG_INFO("ClientNetworkManager::start_local_connect") << "Connecting to: " << local_socket_path << "..." << std::endl;
+
+        m_udp_server_endpoint= asio::local::datagram_protocol::endpoint(server_data_frame_socket_path);
+
+        m_tcp_socket.async_connect(
+            asio::local::stream_protocol::endpoint(local_socket_path),
+            boost::bind(&ClientNetworkManagerImpl::handle_local_connect, this, _1));
+
+        return true;
+#else
+        CLIENT_LOG_ERROR("ClientNetworkManager::start_local_connect") 
+            << "No unix domain sockets on this platform, connect over TCP instead" << std::endl;
+
+        stop();
+
+        if (m_netEventListener)
+        {
+            m_netEventListener->handle_server_connection_open_failed(boost::asio::error::operation_not_supported);
+        }
+
+        return false;
+#endif
+    }
+
+    void handle_local_connect(const boost::system::error_code& ec)
+    {
+        if (m_connection_stopped)
+            return;
+
+        if (ec)
+        {
+            CLIENT_LOG_ERROR("ClientNetworkManager::handle_local_connect") << "Local connect error: " << ec.message() << std::endl;
+
+            // Nothing else to try, the service isn't listening on that socket
+            stop();
+
+            if (m_netEventListener)
+            {
+                m_netEventListener->handle_server_connection_open_failed(ec);
+            }
+        }
+        else
+        {
+            CLIENT_LOG_INFO("ClientNetworkManager::handle_local_connect") << "Connected to local socket" << std::endl;
+
+            // Start listening for any incoming responses
+            // NOTE: Responses that come independent of a request are a "notification"
+            start_tcp_read_response_header();
+        }
+    }
+
+    void remove_local_data_frame_socket_file()
+    {
+        if (!m_local_data_frame_socket_path.empty())
+        {
+            std::remove(m_local_data_frame_socket_path.c_str());
+            m_local_data_frame_socket_path.clear();
+        }
+    }
+
+    void network_thread_func()
+    {
+        // Every UDP callback runs here until stop_network_thread() stops the io_service
+        m_udp_io_service.run();
+    }
+
+    void stop_network_thread()
+    {
+        if (m_network_thread.joinable())
+        {
+            CLIENT_LOG_INFO("ClientNetworkManager::stop_network_thread") << "Stopping network thread" << std::endl;
+
+            m_udp_io_service.stop();
+            m_network_thread.join();
+        }
+    }
+
+    void handle_data_frame_wait_timeout(const boost::system::error_code& error)
+    {
+        if (error != asio::error::operation_aborted)
+        {
+            m_bDataFrameWaitTimedOut= true;
+        }
+    }
+
+    // Called on the thread servicing the UDP socket once a datagram's data frames have been handed to the listener
+    void note_datagram_received()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_data_frame_mutex);
+            ++m_received_datagram_count;
+        }
+
+        if (m_bUseNetworkThread)
+        {
+            m_data_frame_received_cv.notify_all();
+        }
+    }
+
+    // Runs the handler on the thread servicing the UDP socket
+    template <typename t_handler>
+    void dispatch_udp(t_handler handler)
+    {
+        if (m_bUseNetworkThread)
+        {
+            m_udp_io_service.post(handler);
+        }
+        else
+        {
+            handler();
+        }
+    }
+
+    // Runs the handler on the client thread (from the next poll() when coming from the network thread)
+    template <typename t_handler>
+    void dispatch_client(t_handler handler)
+    {
+        if (m_bUseNetworkThread)
+        {
+            m_io_service.post(handler);
+        }
+        else
+        {
+            handler();
+        }
+    }
+
     bool start_tcp_connect(tcp::resolver::iterator endpoint_iter)
     {
         bool success= true;
@@ -247,6 +590,14 @@ private:
 
             CLIENT_LOG_INFO("ClientNetworkManager::handle_tcp_connect") << "Connected to " << tcp_endpoint << std::endl;
 
+            // Requests are small and latency sensitive, don't let Nagle hold them back
+            boost::system::error_code option_error;
+            m_tcp_socket.set_option(tcp::no_delay(true), option_error);
+            if (option_error)
+            {
+                CLIENT_LOG_WARNING("ClientNetworkManager::handle_tcp_connect") << "Unable to disable Nagle: " << option_error.message() << std::endl;
+            }
+
             // Create a corresponding endpoint udp data will be sent to
             m_udp_server_endpoint= udp::endpoint(tcp_endpoint.address(), tcp_endpoint.port());
 
@@ -268,7 +619,7 @@ private:
 
         // Send the connection id back to the server over UDP
         // to establish a UDP connected and associate it with the TCP connection
-        send_udp_connection_id();
+        dispatch_udp(boost::bind(&ClientNetworkManagerImpl::send_udp_connection_id, this));
     }
 
     void send_udp_connection_id()
@@ -280,6 +631,7 @@ private:
         DeviceInputDataFramePtr data_frame(new PSMoveProtocol::DeviceInputDataFrame);
         data_frame->set_connection_id(m_tcp_connection_id);
         data_frame->set_device_category(PSMoveProtocol::DeviceInputDataFrame_DeviceCategory_INVALID);
+        data_frame->set_supports_batched_data_frames(true);
 
         m_packed_input_data_frame.set_msg(data_frame);
         if (m_packed_input_data_frame.pack(m_input_data_frame_buffer, sizeof(m_input_data_frame_buffer)))
@@ -336,20 +688,14 @@ private:
             CLIENT_LOG_ERROR("ClientNetworkManager::handle_udp_read_connection_result") 
                 << "UDP Connect error: " << error.message() << std::endl;
 
-            if (m_netEventListener)
-            {
-                m_netEventListener->handle_server_connection_open_failed(error);
-            }
+            dispatch_client(boost::bind(&ClientNetworkManagerImpl::handle_udp_connection_failed, this, error));
         }
         else if (m_udp_connection_result_read_buffer == false)
         {
             CLIENT_LOG_ERROR("ClientNetworkManager::handle_udp_read_connection_result") 
                 << "UDP Connect error: Invalid connection id" << std::endl;
 
-            if (m_netEventListener)
-            {
-                m_netEventListener->handle_server_connection_open_failed(boost::system::error_code());
-            }
+            dispatch_client(boost::bind(&ClientNetworkManagerImpl::handle_udp_connection_failed, this, boost::system::error_code()));
         }
         else
         {
@@ -359,14 +705,37 @@ private:
             // Start listening for any incoming data frames (UDP messages)
             start_udp_read_data_frame();
 
-            // If there are any requests waiting, send them off
-            start_tcp_write_request();
+            dispatch_client(boost::bind(&ClientNetworkManagerImpl::handle_udp_connection_opened, this));
+        }
+    }
 
-            // Tell the network event listener that we are finally all connected
-            if (m_netEventListener)
-            {
-                m_netEventListener->handle_server_connection_opened();
-            }
+    void handle_udp_connection_opened()
+    {
+        // If there are any requests waiting, send them off
+        start_tcp_write_request();
+
+        // Tell the network event listener that we are finally all connected
+        if (m_netEventListener)
+        {
+            m_netEventListener->handle_server_connection_opened();
+        }
+    }
+
+    void handle_udp_connection_failed(const boost::system::error_code& error)
+    {
+        if (m_netEventListener)
+        {
+            m_netEventListener->handle_server_connection_open_failed(error);
+        }
+    }
+
+    void handle_udp_socket_error(const boost::system::error_code& error)
+    {
+        stop();
+
+        if (m_netEventListener)
+        {
+            m_netEventListener->handle_server_connection_socket_error(error);
         }
     }
 
@@ -574,6 +943,12 @@ private:
         }
     }
 
+    void queue_device_data_frame(DeviceInputDataFramePtr data_frame)
+    {
+        m_pending_data_frames.push_back(data_frame);
+        start_udp_queued_data_frame_write();
+    }
+
     void start_udp_queued_data_frame_write()
     {
         if (!m_connection_stopped)
@@ -629,6 +1004,9 @@ private:
 
             // Remove the dataframe from the pending send queue now that it's sent
             m_pending_data_frames.pop_front();
+
+            // If there are more data frames waiting to be sent, start sending the next one
+            start_udp_queued_data_frame_write();
         }
         else
         {
@@ -648,11 +1026,12 @@ private:
                 boost::bind(
                     &ClientNetworkManagerImpl::handle_udp_read_data_frame, 
                     this,
-                    asio::placeholders::error));
+                    asio::placeholders::error,
+                    asio::placeholders::bytes_transferred));
         }
     }
 
-    void handle_udp_read_data_frame(const boost::system::error_code& error)
+    void handle_udp_read_data_frame(const boost::system::error_code& error, std::size_t bytes_transferred)
     {
         if (m_connection_stopped)
             return;
@@ -661,57 +1040,164 @@ private:
         {
             CLIENT_LOG_DEBUG("ClientNetworkManager::handle_udp_read_data_frame") << "Received DataFrame" << std::endl;
 
-            // Process the data frame now that we have received all of it
-            handle_udp_data_frame_received();
+            // No longer is there a pending read
+            m_has_pending_udp_read= false;
+
+            // A datagram can hold several data frames back to back (all of the device updates from one service tick).
+            // Process each of them now that we have received all of it.
+            std::size_t offset= 0;
+            bool bValidFrame= true;
+
+            while (bValidFrame && offset < bytes_transferred)
+            {
+                const uint8_t *frame_bytes= &m_output_data_frame_buffer[offset];
+                const unsigned int remaining_bytes= static_cast<unsigned int>(bytes_transferred - offset);
+                unsigned int frame_size= 0;
+
+                if (frame_bytes[0] == COMPACT_DATA_FRAME_MARKER)
+                {
+                    bValidFrame= handle_udp_compact_pose_frame_received(frame_bytes, remaining_bytes, frame_size);
+                }
+                else if (frame_bytes[0] == COMPACT_ORIENTATION_FRAME_MARKER)
+                {
+                    bValidFrame= handle_udp_compact_orientation_frame_received(frame_bytes, remaining_bytes, frame_size);
+                }
+                else
+                {
+                    bValidFrame= handle_udp_data_frame_received(frame_bytes, remaining_bytes, frame_size);
+                }
+
+                offset+= frame_size;
+            }
+
+            // Wake up anyone waiting on new device data
+            note_datagram_received();
 
             // Start reading the next incoming data frame
             start_udp_read_data_frame();
         }
         else
         {
-            CLIENT_LOG_ERROR("ClientNetworkManager::handle_tcp_write_request_complete") 
+            CLIENT_LOG_ERROR("ClientNetworkManager::handle_udp_read_data_frame") 
                 << "Error on receive: "  << error.message() << std::endl;
-            stop();
 
-            if (m_netEventListener)
-            {
-                m_netEventListener->handle_server_connection_socket_error(error);
-            }
+            dispatch_client(boost::bind(&ClientNetworkManagerImpl::handle_udp_socket_error, this, error));
         }
     }
 
-    // Called when enough data was read into m_data_frame_read_buffer for a complete data frame message. 
-    // Parse the data_frame and forward it on to the response handler.
-    void handle_udp_data_frame_received()
+    // Called for a fixed layout pose frame at the start of frame_bytes.
+    // No parsing needed, just copy it out and forward it on to the data frame handler.
+    // Returns false if the rest of the datagram can't be processed.
+    bool handle_udp_compact_pose_frame_received(
+        const uint8_t *frame_bytes, 
+        unsigned int remaining_bytes,
+        unsigned int &out_frame_size)
     {
-        // No longer is there a pending read
-        m_has_pending_udp_read= false;
+        bool bValidFrame= false;
+
+        if (remaining_bytes >= sizeof(CompactControllerPoseFrame) &&
+            frame_bytes[1] == COMPACT_DATA_FRAME_VERSION)
+        {
+            CompactControllerPoseFrame pose_frame;
+
+            memcpy(&pose_frame, frame_bytes, sizeof(CompactControllerPoseFrame));
+            m_data_frame_listener->handle_compact_pose_frame(&pose_frame);
+
+            out_frame_size= sizeof(CompactControllerPoseFrame);
+            bValidFrame= true;
+        }
+        else
+        {
+            // Unlike a malformed protobuf frame this isn't fatal, a newer service may just use a newer layout.
+            // There's no way to know how big an unknown frame is though, so skip the rest of the datagram.
+            CLIENT_LOG_WARNING("ClientNetworkManager::handle_udp_compact_pose_frame_received") 
+                << "Ignoring compact pose frame (version " << static_cast<int>(frame_bytes[1]) 
+                << ", " << remaining_bytes << " bytes)" << std::endl;
+
+            out_frame_size= remaining_bytes;
+        }
+
+        return bValidFrame;
+    }
+
+    // Same as handle_udp_compact_pose_frame_received, for the orientation only frames of a dual rate stream
+    bool handle_udp_compact_orientation_frame_received(
+        const uint8_t *frame_bytes, 
+        unsigned int remaining_bytes,
+        unsigned int &out_frame_size)
+    {
+        bool bValidFrame= false;
+
+        if (remaining_bytes >= sizeof(CompactControllerOrientationFrame) &&
+            frame_bytes[1] == COMPACT_DATA_FRAME_VERSION)
+        {
+            CompactControllerOrientationFrame orientation_frame;
+
+            memcpy(&orientation_frame, frame_bytes, sizeof(CompactControllerOrientationFrame));
+            m_data_frame_listener->handle_compact_orientation_frame(&orientation_frame);
 
+            out_frame_size= sizeof(CompactControllerOrientationFrame);
+            bValidFrame= true;
+        }
+        else
+        {
+            CLIENT_LOG_WARNING("ClientNetworkManager::handle_udp_compact_orientation_frame_received") 
+                << "Ignoring compact orientation frame (version " << static_cast<int>(frame_bytes[1]) 
+                << ", " << remaining_bytes << " bytes)" << std::endl;
+
+            out_frame_size= remaining_bytes;
+        }
+
+        return bValidFrame;
+    }
+
+    // Called for a length-prefixed protobuf data frame at the start of frame_bytes. 
+    // Parse the data_frame and forward it on to the response handler.
+    // Returns false (and stops the connection) if the data frame is malformed.
+    bool handle_udp_data_frame_received(
+        const uint8_t *frame_bytes, 
+        unsigned int remaining_bytes,
+        unsigned int &out_frame_size)
+    {
         CLIENT_LOG_DEBUG("ClientNetworkManager::handle_udp_data_frame_received") << "Parsing DataFrame" << std::endl;
         
         // TODO: Switch on data frame type to choose which m_packed_data_frame_X to use.
-        unsigned msg_len = m_packed_output_data_frame.decode_header(m_output_data_frame_buffer, sizeof(m_output_data_frame_buffer));
+        unsigned msg_len = m_packed_output_data_frame.decode_header(frame_bytes, remaining_bytes);
         unsigned total_len= HEADER_SIZE+msg_len;
-        CLIENT_LOG_DEBUG("    ") << show_hex(m_output_data_frame_buffer, total_len) << std::endl;
+        CLIENT_LOG_DEBUG("    ") << show_hex(frame_bytes, std::min(total_len, remaining_bytes)) << std::endl;
         CLIENT_LOG_DEBUG("    ") << msg_len << " bytes" << std::endl;
 
-        // Parse the response buffer
-        if (m_packed_output_data_frame.unpack(m_output_data_frame_buffer, total_len))
+        out_frame_size= total_len;
+
+        // A datagram that got overtaken by a newer one isn't worth parsing
+        if (total_len <= remaining_bytes && m_data_frame_parser.is_stale_frame(frame_bytes + HEADER_SIZE, msg_len))
         {
-            const PSMoveProtocol::DeviceOutputDataFrame *data_frame = m_packed_output_data_frame.get_msg().get();
+            CLIENT_LOG_DEBUG("ClientNetworkManager::handle_udp_data_frame_received") << "Dropping stale DataFrame" << std::endl;
+
+            return true;
+        }
 
+        // Parse the response buffer
+        const PSMoveProtocol::DeviceOutputDataFrame *data_frame= 
+            (total_len <= remaining_bytes) ? m_data_frame_parser.parse(frame_bytes + HEADER_SIZE, msg_len) : nullptr;
+
+        if (data_frame != nullptr)
+        {
             m_data_frame_listener->handle_data_frame(data_frame);
+
+            return true;
         }
         else
         {
             CLIENT_LOG_ERROR("ClientNetworkManager::handle_udp_data_frame_received") << "Error malformed response" << std::endl;
-            stop();
 
-            if (m_netEventListener)
-            {
-                //###HipsterSloth $TODO pick a better error code that means "malformed data"
-                m_netEventListener->handle_server_connection_socket_error(boost::asio::error::message_size);
-            }
+            //###HipsterSloth $TODO pick a better error code that means "malformed data"
+            dispatch_client(
+                boost::bind(
+                    &ClientNetworkManagerImpl::handle_udp_socket_error, this, 
+                    boost::system::error_code(boost::asio::error::message_size)));
+
+            return false;
         }
     }
 
@@ -720,13 +1206,32 @@ private:
     std::string m_server_port;
 
     asio::io_service m_io_service;
-    tcp::socket m_tcp_socket;
+
+    // The UDP socket gets its own io_service so that it can be serviced by the network thread
+    asio::io_service m_udp_io_service;
+    std::unique_ptr<asio::io_service::work> m_udp_io_service_work;
+    bool m_bUseNetworkThread;
+    std::thread m_network_thread;
+
+    t_request_socket m_tcp_socket;
     int m_tcp_connection_id;
 
-    udp::socket m_udp_socket;
-    udp::endpoint m_udp_server_endpoint;
-    udp::endpoint m_udp_remote_endpoint;
+    t_data_frame_socket m_udp_socket;
+    t_data_frame_endpoint m_udp_server_endpoint;
+    t_data_frame_endpoint m_udp_remote_endpoint;
     bool m_udp_connection_result_read_buffer;
+    // Path the data frame socket is bound to on local connections (empty otherwise)
+    std::string m_local_data_frame_socket_path;
+
+    // Bounds a wait_for_data_frame() that services the UDP socket itself
+    asio::deadline_timer m_data_frame_wait_timer;
+    bool m_bDataFrameWaitTimedOut;
+
+    // Counts the received data frame datagrams for wait_for_data_frame()
+    std::mutex m_data_frame_mutex;
+    std::condition_variable m_data_frame_received_cv;
+    long long m_received_datagram_count;
+    long long m_last_waited_datagram_count;
 
     bool m_connection_stopped;
     bool m_has_pending_tcp_read;
@@ -737,8 +1242,10 @@ private:
     vector<uint8_t> m_response_read_buffer;
     PackedMessage<PSMoveProtocol::Response> m_packed_response;
 
-    uint8_t m_output_data_frame_buffer[HEADER_SIZE+MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE];
+    uint8_t m_output_data_frame_buffer[MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE];
+    // Only decodes the length header, the frame itself goes through the (allocation free) parser
     PackedMessage<PSMoveProtocol::DeviceOutputDataFrame> m_packed_output_data_frame;
+    ClientDataFrameParser m_data_frame_parser;
 
     uint8_t m_input_data_frame_buffer[HEADER_SIZE + MAX_INPUT_DATA_FRAME_MESSAGE_SIZE];
     PackedMessage<PSMoveProtocol::DeviceInputDataFrame> m_packed_input_data_frame;
@@ -783,11 +1290,11 @@ ClientNetworkManager::~ClientNetworkManager()
     delete m_implementation_ptr;
 }
 
-bool ClientNetworkManager::startup()
+bool ClientNetworkManager::startup(bool bUseNetworkThread)
 {
     m_instance= this;
 
-    return m_implementation_ptr->start();
+    return m_implementation_ptr->start(bUseNetworkThread);
 }
 
 void ClientNetworkManager::send_request(RequestPtr request)
@@ -805,6 +1312,16 @@ void ClientNetworkManager::update()
     m_implementation_ptr->poll();
 }
 
+bool ClientNetworkManager::get_is_network_thread() const
+{
+    return m_implementation_ptr->get_is_network_thread();
+}
+
+bool ClientNetworkManager::wait_for_data_frame(int timeout_ms)
+{
+    return m_implementation_ptr->wait_for_data_frame(timeout_ms);
+}
+
 void ClientNetworkManager::shutdown()
 {
     m_implementation_ptr->stop();
@@ -8,7 +8,7 @@
 
 //-- definitions ------
 // -Server Network Manager-
-// Maintains TCP/UDP connection state with PSMoveService.
+// Maintains TCP/UDP (or unix domain socket) connection state with PSMoveService.
 // Routes requests to the given request handler.
 class PSM_CPP_PRIVATE_CLASS ClientNetworkManager 
 {
@@ -23,12 +23,22 @@ public:
 
     static ClientNetworkManager *get_instance() { return m_instance; }
 
-    bool startup();
+    // With bUseNetworkThread a client owned thread services the UDP socket continuously.
+    // Data frame listener callbacks then come in on that thread, everything else still comes from update().
+    bool startup(bool bUseNetworkThread);
     void send_request(RequestPtr request);
     void send_device_data_frame(DeviceInputDataFramePtr data_frame);
     void update();
     void shutdown();
 
+    // True when called from the network thread started with startup(true)
+    bool get_is_network_thread() const;
+
+    // Blocks until a data frame datagram arrives that the last wait didn't already see, or the timeout runs out.
+    // Returns false on timeout. Without the network thread this services the UDP socket itself,
+    // so it must be called from the client thread. With it, any thread may wait.
+    bool wait_for_data_frame(int timeout_ms);
+
 private:
     // Must use the overloaded constructor
     ClientNetworkManager();
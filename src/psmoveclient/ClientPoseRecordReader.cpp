@@ -0,0 +1,238 @@
+//-- includes -----
+#include "ClientPoseRecordReader.h"
+#include "ClientLog.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <string.h>
+
+//-- private methods -----
+static bool pose_record_time_less(const PoseRecord &record, const int64_t time_us)
+{
+    return record.service_time_us < time_us;
+}
+
+//-- public interface -----
+ClientPoseRecordReader::ClientPoseRecordReader()
+    : m_chunks()
+    , m_record_count(0)
+{
+}
+
+ClientPoseRecordReader::~ClientPoseRecordReader()
+{
+    close();
+}
+
+bool ClientPoseRecordReader::open(const std::string &base_path)
+{
+    close();
+
+    // The index says which chunks are still on disk
+    const std::string index_path = pose_record_get_index_path(base_path);
+    std::ifstream index_file(index_path.c_str(), std::ios_base::in | std::ios_base::binary);
+
+    PoseRecordIndexHeader index_header;
+    memset(&index_header, 0, sizeof(PoseRecordIndexHeader));
+    index_file.read(reinterpret_cast<char *>(&index_header), sizeof(PoseRecordIndexHeader));
+
+    if (!index_file.good() ||
+        index_header.magic != POSE_RECORD_INDEX_MAGIC ||
+        index_header.version != POSE_RECORD_FORMAT_VERSION)
+    {
+        CLIENT_LOG_ERROR("ClientPoseRecordReader::open()") << "Not a pose record index (or a different version): " << index_path;
+        return false;
+    }
+
+    std::vector<PoseRecordIndexEntry> entries(index_header.chunk_count);
+    if (!entries.empty())
+    {
+        index_file.read(reinterpret_cast<char *>(entries.data()), entries.size()*sizeof(PoseRecordIndexEntry));
+    }
+
+    if (!index_file.good())
+    {
+        CLIENT_LOG_ERROR("ClientPoseRecordReader::open()") << "Truncated pose record index: " << index_path;
+        return false;
+    }
+
+    bool bSuccess = true;
+
+    for (const PoseRecordIndexEntry &entry : entries)
+    {
+        const std::string chunk_path = pose_record_get_chunk_path(base_path, entry.chunk_index);
+        t_chunk chunk;
+
+        memset(&chunk, 0, sizeof(t_chunk));
+
+        try
+        {
+            chunk.file_mapping = new boost::interprocess::file_mapping(chunk_path.c_str(), boost::interprocess::read_only);
+            chunk.region = new boost::interprocess::mapped_region(*chunk.file_mapping, boost::interprocess::read_only);
+        }
+        catch (boost::interprocess::interprocess_exception &ex)
+        {
+            CLIENT_LOG_WARNING("ClientPoseRecordReader::open()") << "Failed to map pose record chunk: " << chunk_path
+                << ", reason: " << ex.what();
+        }
+
+        const PoseRecordChunkHeader *header =
+            (chunk.region != nullptr && chunk.region->get_size() >= sizeof(PoseRecordChunkHeader))
+            ? reinterpret_cast<const PoseRecordChunkHeader *>(chunk.region->get_address())
+            : nullptr;
+
+        if (header != nullptr &&
+            header->magic == POSE_RECORD_CHUNK_MAGIC &&
+            header->version == POSE_RECORD_FORMAT_VERSION &&
+            header->record_size == sizeof(PoseRecord))
+        {
+            // The chunk still being written has a header more recent than the index,
+            // never trust either past the end of the file
+            const uint64_t mapped_record_count = (chunk.region->get_size() - sizeof(PoseRecordChunkHeader)) / sizeof(PoseRecord);
+
+            chunk.records = reinterpret_cast<const PoseRecord *>(header + 1);
+            chunk.record_count = std::min(header->record_count, mapped_record_count);
+            chunk.first_record_index = m_record_count;
+        }
+
+        if (chunk.record_count > 0)
+        {
+            m_record_count += chunk.record_count;
+            m_chunks.push_back(chunk);
+        }
+        else
+        {
+            if (chunk.region != nullptr && chunk.records == nullptr)
+            {
+                CLIENT_LOG_WARNING("ClientPoseRecordReader::open()") << "Skipping invalid pose record chunk: " << chunk_path;
+            }
+
+            delete chunk.region;
+            delete chunk.file_mapping;
+            bSuccess = bSuccess && chunk.records != nullptr;
+        }
+    }
+
+    // Missing chunks leave a gap in time, but what's left is still readable
+    return bSuccess || !m_chunks.empty();
+}
+
+void ClientPoseRecordReader::close()
+{
+    for (t_chunk &chunk : m_chunks)
+    {
+        delete chunk.region;
+        delete chunk.file_mapping;
+    }
+
+    m_chunks.clear();
+    m_record_count = 0;
+}
+
+int64_t ClientPoseRecordReader::getFirstTimeUs() const
+{
+    const PoseRecord *record = getRecord(0);
+
+    return (record != nullptr) ? record->service_time_us : 0;
+}
+
+int64_t ClientPoseRecordReader::getLastTimeUs() const
+{
+    const PoseRecord *record = (m_record_count > 0) ? getRecord(m_record_count - 1) : nullptr;
+
+    return (record != nullptr) ? record->service_time_us : 0;
+}
+
+uint64_t ClientPoseRecordReader::seek(int64_t time_us) const
+{
+    // First chunk whose last record isn't older than time_us
+    // (open() only keeps chunks holding records)
+    size_t low = 0;
+    size_t high = m_chunks.size();
+    while (low < high)
+    {
+        const size_t middle = (low + high) / 2;
+        const t_chunk &chunk = m_chunks[middle];
+
+        if (chunk.records[chunk.record_count - 1].service_time_us < time_us)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if (low >= m_chunks.size())
+    {
+        return m_record_count;
+    }
+
+    const t_chunk &chunk = m_chunks[low];
+    const PoseRecord *end = chunk.records + chunk.record_count;
+    const PoseRecord *found = std::lower_bound(chunk.records, end, time_us, pose_record_time_less);
+
+    return chunk.first_record_index + static_cast<uint64_t>(found - chunk.records);
+}
+
+const PoseRecord *ClientPoseRecordReader::getRecord(uint64_t record_index) const
+{
+    const size_t chunk_index = findChunk(record_index);
+
+    return (chunk_index < m_chunks.size())
+        ? &m_chunks[chunk_index].records[record_index - m_chunks[chunk_index].first_record_index]
+        : nullptr;
+}
+
+size_t ClientPoseRecordReader::readRecords(uint64_t first_index, PoseRecord *out_records, size_t max_count) const
+{
+    size_t copied_count = 0;
+
+    for (size_t chunk_index = findChunk(first_index);
+         chunk_index < m_chunks.size() && copied_count < max_count;
+         ++chunk_index)
+    {
+        const t_chunk &chunk = m_chunks[chunk_index];
+        const uint64_t record_index = first_index + copied_count;
+        const uint64_t chunk_offset = record_index - chunk.first_record_index;
+        const size_t count =
+            static_cast<size_t>(std::min(static_cast<uint64_t>(max_count - copied_count), chunk.record_count - chunk_offset));
+
+        memcpy(out_records + copied_count, chunk.records + chunk_offset, count*sizeof(PoseRecord));
+        copied_count += count;
+    }
+
+    return copied_count;
+}
+
+//-- private methods -----
+size_t ClientPoseRecordReader::findChunk(uint64_t record_index) const
+{
+    if (record_index >= m_record_count)
+    {
+        return m_chunks.size();
+    }
+
+    // Last chunk starting at or before the record
+    size_t low = 0;
+    size_t high = m_chunks.size();
+    while (high - low > 1)
+    {
+        const size_t middle = (low + high) / 2;
+
+        if (m_chunks[middle].first_record_index <= record_index)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
@@ -0,0 +1,71 @@
+#ifndef CLIENT_POSE_RECORD_READER_H
+#define CLIENT_POSE_RECORD_READER_H
+
+//-- includes -----
+#include "PoseRecordFormat.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//-- pre-declarations -----
+namespace boost {
+    namespace interprocess {
+        class file_mapping;
+        class mapped_region;
+    }
+}
+
+//-- definitions -----
+/// Offline reader of a pose recording made by the service (DeviceManagerConfig::record_poses).
+/**
+ Maps every chunk the index lists read-only and presents them as one array of records
+ in publish order. Seeking by time is a binary search over the index and then over the
+ fixed-size records of one chunk, so it doesn't depend on the size of the recording.
+ A recording that is still being written can be opened too, it then holds the records
+ written up to the open() call.
+ */
+class ClientPoseRecordReader
+{
+public:
+    ClientPoseRecordReader();
+    ~ClientPoseRecordReader();
+
+    /// Opens the recording at base_path (the path the service was given, without the file extensions)
+    bool open(const std::string &base_path);
+    void close();
+
+    inline uint64_t getRecordCount() const
+    { return m_record_count; }
+
+    /// service_time_us of the first and last record (0 when empty)
+    int64_t getFirstTimeUs() const;
+    int64_t getLastTimeUs() const;
+
+    /// Index of the first record published at or after time_us, getRecordCount() if there is none
+    uint64_t seek(int64_t time_us) const;
+
+    /// Returns nullptr past the end. The record points into the mapped chunk and stays valid until close().
+    const PoseRecord *getRecord(uint64_t record_index) const;
+
+    /// Copies up to max_count records starting at first_index, returns how many got copied
+    size_t readRecords(uint64_t first_index, PoseRecord *out_records, size_t max_count) const;
+
+private:
+    struct t_chunk
+    {
+        boost::interprocess::file_mapping *file_mapping;
+        boost::interprocess::mapped_region *region;
+        const PoseRecord *records;
+        uint64_t record_count;
+        uint64_t first_record_index; // Index of the chunk's first record in the whole recording
+    };
+
+    // Chunk holding the record, m_chunks.size() past the end
+    size_t findChunk(uint64_t record_index) const;
+
+    std::vector<t_chunk> m_chunks;
+    uint64_t m_record_count;
+};
+
+#endif // CLIENT_POSE_RECORD_READER_H
@@ -1,21 +1,28 @@
 //-- includes -----
 #include "ClientRequestManager.h"
+#include "ClientMessageQueue.h"
 #include "ClientNetworkManager.h"
 #include "PSMoveProtocolInterface.h"
 #include "PSMoveProtocol.pb.h"
+#include <algorithm>
 #include <cassert>
-#include <map>
-#include <utility>
+#include <vector>
+
+//-- constants -----
+// Starting capacities of the pending request list and the reference caches.
+// They only grow if more requests than this are ever in flight at once.
+static const int k_initial_pending_request_capacity= 32;
+static const int k_initial_response_pool_capacity= 16;
 
 //-- definitions -----
 struct RequestContext
 {
     RequestPtr request;  // std::shared_ptr<PSMoveProtocol::Request>
 };
-typedef std::map<int, RequestContext> t_request_context_map;
-typedef std::map<int, RequestContext>::iterator t_request_context_map_iterator;
-typedef std::pair<int, RequestContext> t_id_request_context_pair;
-typedef std::vector<ResponsePtr> t_response_reference_cache;
+// Only a handful of requests are ever in flight, so a flat (pre-reserved) list beats a map
+typedef std::vector<RequestContext> t_request_context_list;
+typedef std::vector<RequestContext>::iterator t_request_context_list_iterator;
+typedef ClientProtocolMessagePool<PSMoveProtocol::Response> t_response_pool;
 typedef std::vector<RequestPtr> t_request_reference_cache;
 
 class ClientRequestManagerImpl
@@ -30,16 +37,22 @@ public:
         , m_callback_userdata(userdata)
         , m_pending_requests()
         , m_next_request_id(0)
+        , m_request_reference_cache()
+        , m_response_pool(k_initial_response_pool_capacity)
     {
+        m_pending_requests.reserve(k_initial_pending_request_capacity);
+        m_request_reference_cache.reserve(k_initial_pending_request_capacity);
     }
 
     void flush_response_cache()
     {
-        // Drop all of the request/response references,
-        // NOTE: std::vector::clear() calls the destructor on each element in the vector
-        // This will decrement the last ref count to the parameter data, causing them to get cleaned up.
+        // Drop all of the request references,
+        // NOTE: std::vector::clear() calls the destructor on each element in the vector (but keeps the capacity).
+        // This will decrement the last ref count to the request, causing them to get cleaned up.
         m_request_reference_cache.clear();
-        m_response_reference_cache.clear();
+
+        // The pooled response copies get reused by the next responses
+        m_response_pool.release_all();
     }
 
     void send_request(RequestPtr request)
@@ -51,10 +64,10 @@ public:
         request->set_request_id(m_next_request_id);
         ++m_next_request_id;
 
-        // Add the request to the pending request map.
+        // Add the request to the pending request list.
         // Requests should never be double registered.
-        assert(m_pending_requests.find(request->request_id()) == m_pending_requests.end());
-        m_pending_requests.insert(t_id_request_context_pair(request->request_id(), context));
+        assert(find_pending_request(request->request_id()) == m_pending_requests.end());
+        m_pending_requests.push_back(context);
 
         // Send the request off to the network manager to get sent to the server
         ClientNetworkManager::get_instance()->send_request(request);
@@ -75,11 +88,15 @@ public:
     void handle_response(ResponsePtr response)
     {
         // Get the request awaiting completion
-        t_request_context_map_iterator pending_request_entry= m_pending_requests.find(response->request_id());
+        t_request_context_list_iterator pending_request_entry= find_pending_request(response->request_id());
         assert(pending_request_entry != m_pending_requests.end());
 
-        // The context holds everything a handler needs to evaluate a response
-        const RequestContext &context= pending_request_entry->second;
+        // The context holds everything a handler needs to evaluate a response.
+        // Move it out of the list since the callback is free to send new requests.
+        const RequestContext context= *pending_request_entry;
+
+        // Remove the pending request from the list
+        m_pending_requests.erase(pending_request_entry);
 
         // Notify the callback of the response
         if (m_callback != nullptr)
@@ -91,9 +108,13 @@ public:
 
             m_callback(&response_message, m_callback_userdata);
         }
+    }
 
-        // Remove the pending request from the map
-        m_pending_requests.erase(pending_request_entry);
+    t_request_context_list_iterator find_pending_request(int request_id)
+    {
+        return std::find_if(
+            m_pending_requests.begin(), m_pending_requests.end(),
+            [request_id](const RequestContext &context) { return context.request->request_id() == request_id; });
     }
 
     void build_response_message(
@@ -132,20 +153,18 @@ public:
         m_request_reference_cache.push_back(request);
 
         {
-            // Create a smart pointer to a new copy of the response.
-            // If we just add the given event smart pointer to the reference cache
+            // Copy the response into the pool.
+            // If we just kept a reference to the given response
             // we'll be storing a reference to the shared m_packed_response on the client network manager
             // which gets constantly overwritten with new incoming responses.
-            ResponsePtr responseCopy(new PSMoveProtocol::Response(*response.get()));
+            const PSMoveProtocol::Response *responseCopy= m_response_pool.acquire_copy(*response.get());
 
             // Attach an opaque pointer to the PSMoveProtocol response.
             // Client code that has linked against PSMoveProtocol library
             // can access this pointer via the GET_PSMOVEPROTOCOL_RESPONSE() macro.
-            out_response_message->opaque_response_handle = static_cast<const void*>(responseCopy.get());
-
             // The opaque response pointer will only remain valid until the next call to update()
-            // at which time the response reference cache gets cleared out.
-            m_response_reference_cache.push_back(responseCopy);
+            // at which time the response pool gets recycled.
+            out_response_message->opaque_response_handle = static_cast<const void*>(responseCopy);
         }
 
         // Write response specific data
@@ -178,6 +197,18 @@ public:
 				build_tracking_space_response_message(response, &out_response_message->payload.tracking_space);
 				out_response_message->payload_type = PSMResponseMessage::_responsePayloadType_TrackingSpace;
 				break;
+            case PSMoveProtocol::Response_ResponseType_CONNECTION_HANDSHAKE:
+                {
+                    // The handshake response carries every one of the individual results
+                    PSMConnectionHandshake *handshake= &out_response_message->payload.connection_handshake;
+
+                    build_service_version_response_message(response, &handshake->service_version);
+                    build_controller_list_response_message(response, &handshake->controller_list);
+                    build_tracker_list_response_message(response, &handshake->tracker_list);
+                    build_hmd_list_response_message(response, &handshake->hmd_list);
+                    build_tracking_space_response_message(response, &handshake->tracking_space);
+                    out_response_message->payload_type = PSMResponseMessage::_responsePayloadType_ConnectionHandshake;
+                } break;
             default:
                 out_response_message->payload_type = PSMResponseMessage::_responsePayloadType_Empty;
                 break;
@@ -398,14 +429,13 @@ private:
     IDataFrameListener *m_dataFrameListener;
     PSMResponseCallback m_callback;
     void *m_callback_userdata;
-    t_request_context_map m_pending_requests;
+    t_request_context_list m_pending_requests;
     int m_next_request_id;
 
-    // These vectors is used solely to keep the ref counted pointers to the 
-    // request/response parameter data valid until the next update call.
+    // These keep the request/response parameter data valid until the next update call.
     // The ClientAPI message queue contains raw void pointers to the request/response and event data.
     t_request_reference_cache m_request_reference_cache;
-    t_response_reference_cache m_response_reference_cache;
+    t_response_pool m_response_pool;
 };
 
 //-- public methods -----
@@ -3,12 +3,16 @@
 #include "ClientRequestManager.h"
 #include "ClientNetworkManager.h"
 #include "ClientLog.h"
+#include "CompactDataFrame.h"
+#include "PackedTrackerData.h"
 #include "PSMoveProtocol.pb.h"
+#include "SharedPoseState.h"
 #include "SharedTrackerState.h"
 #include <boost/interprocess/shared_memory_object.hpp>
 #include <boost/interprocess/mapped_region.hpp>
-#include <boost/interprocess/sync/scoped_lock.hpp>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <thread>
 #include <memory>
@@ -17,9 +21,21 @@
 	#pragma warning(disable:4996)  // ignore strncpy warning
 #endif
 
-//-- typedefs -----
-typedef std::deque<PSMMessage> t_message_queue;
-typedef std::vector<ResponsePtr> t_event_reference_cache;
+//-- constants -----
+// Starting capacities of the message queue, event pool and pending request list.
+// They only grow if a burst ever goes past them.
+static const int k_initial_message_queue_capacity= 32;
+static const int k_initial_event_pool_capacity= 16;
+static const int k_initial_pending_request_capacity= 32;
+
+// Stream options that the shared memory pose frames carry everything for
+static const unsigned int k_shared_pose_compatible_stream_flags=
+	PSMStreamFlags_includePositionData | 
+	PSMStreamFlags_includePhysicsData | 
+	PSMStreamFlags_disableROI | 
+	PSMStreamFlags_useCompactPoseStream |
+	PSMStreamFlags_onlySendChanges |
+	PSMStreamFlags_useDualRateStream;
 
 // -- macros -----
 #define IS_VALID_CONTROLLER_INDEX(x) ((x) >= 0 && (x) < PSMOVESERVICE_MAX_CONTROLLER_COUNT)
@@ -30,16 +46,27 @@ typedef std::vector<ResponsePtr> t_event_reference_cache;
 static void processPSMoveRecenterAction(PSMController *controller);
 static void processDualShock4RecenterAction(PSMController *controller);
 
-static void applyControllerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet, PSMController *controller);
+static void applyControllerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet, long long service_time_us, PSMController *controller);
+static void applyCompactControllerPoseFrame(const CompactControllerPoseFrame *pose_frame, PSMController *controller);
+static void applyCompactControllerOrientationFrame(const CompactControllerOrientationFrame *orientation_frame, PSMController *controller);
+static void updateControllerDataFrameStatistics(PSMController *controller);
 static void applyPSMoveDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet, PSMPSMove *psmove);
 static void applyPSNaviDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet, PSMPSNavi *psnavi);
 static void applyDualShock4DataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet, PSMDualShock4 *ds4);
 static void applyVirtualControllerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet, PSMVirtualController *virtual_controller);
 static void applyPSMButtonState(PSMButtonState &button, unsigned int button_bitmask, unsigned int button_bit);
-static void applyTrackerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_TrackerDataPacket& tracker_packet, PSMTracker *tracker);
-static void applyHmdDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket& hmd_packet, PSMHeadMountedDisplay *hmd);
+static void applyTrackerDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_TrackerDataPacket& tracker_packet, long long service_time_us, PSMTracker *tracker);
+static void applyHmdDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket& hmd_packet, long long service_time_us, PSMHeadMountedDisplay *hmd);
+static void applyCompactHMDPoseFrame(const CompactHMDPoseFrame *pose_frame, PSMHeadMountedDisplay *hmd);
+static void updateHmdDataFrameStatistics(PSMHeadMountedDisplay *hmd);
 static void applyMorpheusDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket& hmd_packet, PSMMorpheus *morpheus);
 static void applyVirtualHMDDataFrame(const PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket& hmd_packet, PSMVirtualHMD *virtualHMD);
+static void mergeNetworkControllerView(const PSMController &network_controller, PSMController *controller);
+static void mergeNetworkTrackerView(const PSMTracker &network_tracker, PSMTracker *tracker);
+static void mergeNetworkHMDView(const PSMHeadMountedDisplay &network_hmd, PSMHeadMountedDisplay *hmd);
+static void fillControllerStateRecord(const PSMController &controller, PSMDeviceStateRecord *record);
+static void fillHmdStateRecord(const PSMHeadMountedDisplay &hmd, PSMDeviceStateRecord *record);
+static void appendButtonDownBit(PSMButtonState button, int &bit_index, unsigned int &bitmask);
 
 // -- private definitions -----
 class SharedVideoFrameReadOnlyAccessor
@@ -49,10 +76,13 @@ public:
         : m_shared_memory_object(nullptr)
         , m_region(nullptr)
         , m_bgr_frame_buffer(nullptr)
+        , m_overlay_buffer(nullptr)
         , m_frame_width(0)
         , m_frame_height(0)
         , m_frame_stride(0)
         , m_last_frame_index(0)
+        , m_last_frame_timestamp_us(0)
+        , m_acquired_slot_index(-1)
     {}
 
     ~SharedVideoFrameReadOnlyAccessor()
@@ -104,6 +134,8 @@ public:
     {
         if (m_region != nullptr)
         {
+            releaseVideoFrame();
+
             delete m_region;
             m_region = nullptr;
         }
@@ -114,56 +146,237 @@ public:
             m_shared_memory_object = nullptr;
         }
 
-        if (m_bgr_frame_buffer != nullptr)
-        {
-            delete[] m_bgr_frame_buffer;
-            m_bgr_frame_buffer = nullptr;
-        }
+        freeVideoBuffer();
     }
 
-    bool readVideoFrame()
+    // Copies the newest video frame into our own frame buffer,
+    // or straight into the given buffer (which then has to hold a whole frame).
+    // A reduced preview frame (see eSharedVideoPixelFormat) gets expanded to BGR at the preview's size.
+    bool readVideoFrame(unsigned char *target_buffer = nullptr, size_t target_buffer_size = 0)
     {
         bool bNewFrame = false;
         SharedVideoFrameHeader *sharedFrameState = getFrameHeader();
-        boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex> lock(sharedFrameState->mutex);
 
-        // Make sure the target buffer is big enough to read the video frame into
-        size_t buffer_size =
-            SharedVideoFrameHeader::computeVideoBufferSize(sharedFrameState->stride, sharedFrameState->height);
+        // The service only stays out of one slot for us, which belongs to the acquired frame until it's released
+        if (m_acquired_slot_index != -1)
+        {
+            return false;
+        }
 
         // Make sure the shared memory is the size we expect
         size_t total_shared_mem_size =
-            SharedVideoFrameHeader::computeTotalSize(sharedFrameState->stride, sharedFrameState->height);
+            SharedVideoFrameHeader::computeTotalSize(sharedFrameState->width, sharedFrameState->height, sharedFrameState->stride);
         assert(m_region->get_size() >= total_shared_mem_size);
 
-        // Re-allocate the buffer if any of the video properties changed
-        if (m_frame_width != sharedFrameState->width ||
-            m_frame_height != sharedFrameState->height ||
-            m_frame_stride != sharedFrameState->stride)
+        // Copy over the video frame if the frame index changed
+        if (m_last_frame_index != sharedFrameState->frame_index.load() && total_shared_mem_size > sizeof(SharedVideoFrameHeader))
         {
-            freeVideoBuffer();
+            // The service never waits on us, so it can (rarely) lap us while we copy a slot.
+            // The slot's frame index acts as a sequence number: if it changed during the copy, try again.
+            static const int k_max_read_attempt_count = 4;
+
+            for (int attempt = 0; !bNewFrame && attempt < k_max_read_attempt_count; ++attempt)
+            {
+                const int slot_index = sharedFrameState->active_slot_index.load();
+
+                if (slot_index < 0 || slot_index >= SharedVideoFrameHeader::k_frame_slot_count)
+                {
+                    break;
+                }
+
+                // Tell the service to stay out of this slot while we copy it
+                sharedFrameState->reader_slot_index.store(slot_index);
+
+                const SharedVideoFrameSlot &slot = sharedFrameState->slots[slot_index];
+                const int frame_index = slot.frame_index.load();
+                const int slot_width = slot.width;
+                const int slot_height = slot.height;
+                const int slot_stride = slot.stride;
+                const int slot_pixel_format = slot.pixel_format;
+
+                if (frame_index != 0 &&
+                    sharedFrameState->getIsSlotLayoutValid(slot_width, slot_height, slot_stride, slot_pixel_format))
+                {
+                    // Re-allocate the buffer if any of the video properties changed
+                    const int frame_stride = (slot_pixel_format == SharedVideoPixelFormat_BGR) ? slot_stride : slot_width*3;
+
+                    if (m_frame_width != slot_width ||
+                        m_frame_height != slot_height ||
+                        m_frame_stride != frame_stride)
+                    {
+                        freeVideoBuffer();
+
+                        m_frame_width = slot_width;
+                        m_frame_height = slot_height;
+                        m_frame_stride = frame_stride;
+
+                        allocateVideoBuffer();
+                    }
+
+                    // Make sure the target buffer is big enough to read the video frame into
+                    const size_t buffer_size = SharedVideoFrameHeader::computeVideoBufferSize(m_frame_stride, m_frame_height);
+                    unsigned char *frame_buffer = (target_buffer != nullptr) ? target_buffer : m_bgr_frame_buffer;
+
+                    if (target_buffer != nullptr && target_buffer_size < buffer_size)
+                    {
+                        break;
+                    }
+
+                    copyVideoFrame(sharedFrameState->getBuffer(slot_index), slot_stride, slot_pixel_format, frame_buffer);
+                    std::memcpy(
+                        m_overlay_buffer, 
+                        sharedFrameState->getOverlayBuffer(slot_index), 
+                        SharedVideoFrameHeader::computeOverlayBufferSize(m_frame_width, m_frame_height));
+
+                    if (slot.frame_index.load() == frame_index)
+                    {
+                        compositeOverlay(m_overlay_buffer, frame_buffer);
+
+                        m_last_frame_index = frame_index;
+                        m_last_frame_timestamp_us = slot.timestamp_us.load();
+                        bNewFrame = true;
+                    }
+                }
+            }
 
-            m_frame_width = sharedFrameState->width;
-            m_frame_height = sharedFrameState->height;
-            m_frame_stride = sharedFrameState->stride;
+            sharedFrameState->reader_slot_index.store(-1);
 
-            allocateVideoBuffer();
+            if (bNewFrame)
+            {
+                // Let the service know it's worth writing the next frame
+                sharedFrameState->last_read_frame_index.store(m_last_frame_index);
+            }
         }
 
-        // Copy over the video frame if the frame index changed
-        if (m_last_frame_index != sharedFrameState->frame_index)
+        return bNewFrame;
+    }
+
+    // Copies the video of a slot into a BGR frame the size of our frame buffer, expanding the reduced formats
+    void copyVideoFrame(const unsigned char *slot_buffer, const int slot_stride, const int slot_pixel_format, unsigned char *bgr_frame_buffer)
+    {
+        switch (slot_pixel_format)
+        {
+        case SharedVideoPixelFormat_BGR:
+            {
+                std::memcpy(bgr_frame_buffer, slot_buffer, SharedVideoFrameHeader::computeVideoBufferSize(m_frame_stride, m_frame_height));
+            } break;
+        case SharedVideoPixelFormat_Gray:
+            {
+                for (int y = 0; y < m_frame_height; ++y)
+                {
+                    const unsigned char *gray_row = slot_buffer + y*slot_stride;
+                    unsigned char *bgr_row = bgr_frame_buffer + y*m_frame_stride;
+
+                    for (int x = 0; x < m_frame_width; ++x)
+                    {
+                        bgr_row[x*3] = gray_row[x];
+                        bgr_row[x*3 + 1] = gray_row[x];
+                        bgr_row[x*3 + 2] = gray_row[x];
+                    }
+                }
+            } break;
+        default:
+            {
+                // No video, the overlay gets drawn over black
+                std::memset(bgr_frame_buffer, 0, SharedVideoFrameHeader::computeVideoBufferSize(m_frame_stride, m_frame_height));
+            } break;
+        }
+    }
+
+    // Hands out the newest video frame in place, without copying it out of the shared memory.
+    // The service stays out of the frame's slot until releaseVideoFrame(), acquiring again releases the previous frame.
+    bool acquireVideoFrame(PSMTrackerVideoFrame &out_frame)
+    {
+        bool bAcquired = false;
+        SharedVideoFrameHeader *sharedFrameState = getFrameHeader();
+
+        releaseVideoFrame();
+
+        size_t total_shared_mem_size =
+            SharedVideoFrameHeader::computeTotalSize(sharedFrameState->width, sharedFrameState->height, sharedFrameState->stride);
+        assert(m_region->get_size() >= total_shared_mem_size);
+
+        static const int k_max_acquire_attempt_count = 4;
+
+        for (int attempt = 0; !bAcquired && attempt < k_max_acquire_attempt_count; ++attempt)
         {
-            if (buffer_size > 0)
+            const int slot_index = sharedFrameState->active_slot_index.load();
+
+            if (slot_index < 0 || slot_index >= SharedVideoFrameHeader::k_frame_slot_count)
             {
-                std::memcpy(m_bgr_frame_buffer, sharedFrameState->getBufferMutable(), buffer_size);
+                break;
             }
 
-            m_last_frame_index = sharedFrameState->frame_index;
+            sharedFrameState->reader_slot_index.store(slot_index);
+
+            // The service may have picked this slot to write into before it saw our claim.
+            // If the slot still holds the latest frame it got published since, and the service can't pick it again.
+            const SharedVideoFrameSlot &slot = sharedFrameState->slots[slot_index];
+            const int frame_index = slot.frame_index.load();
 
-            bNewFrame = true;
+            if (sharedFrameState->active_slot_index.load() == slot_index && frame_index != 0 &&
+                sharedFrameState->getIsSlotLayoutValid(slot.width, slot.height, slot.stride, slot.pixel_format))
+            {
+                m_acquired_slot_index = slot_index;
+                m_last_frame_index = frame_index;
+                m_last_frame_timestamp_us = slot.timestamp_us.load();
+
+                out_frame.bgr_buffer = sharedFrameState->getBuffer(slot_index);
+                out_frame.overlay_buffer = sharedFrameState->getOverlayBuffer(slot_index);
+                out_frame.width = slot.width;
+                out_frame.height = slot.height;
+                out_frame.stride = slot.stride;
+                out_frame.pixel_format = static_cast<PSMTrackerVideoPixelFormat>(slot.pixel_format);
+                out_frame.frame_index = frame_index;
+                out_frame.timestamp_us = m_last_frame_timestamp_us;
+                bAcquired = true;
+            }
         }
 
-        return bNewFrame;
+        if (bAcquired)
+        {
+            // Let the service know it's worth writing the next frame
+            sharedFrameState->last_read_frame_index.store(m_last_frame_index);
+        }
+        else
+        {
+            sharedFrameState->reader_slot_index.store(-1);
+        }
+
+        return bAcquired;
+    }
+
+    // Lets the service overwrite the slot of the acquired frame again
+    bool releaseVideoFrame()
+    {
+        if (m_acquired_slot_index == -1)
+        {
+            return false;
+        }
+
+        getFrameHeader()->reader_slot_index.store(-1);
+        m_acquired_slot_index = -1;
+
+        return true;
+    }
+
+    // Draw the service's debug overlay layer on top of the copy of the video frame
+    // Only writes the overlay pixels, so the frame buffer can be write-only memory
+    void compositeOverlay(const unsigned char *overlay_buffer, unsigned char *bgr_frame_buffer)
+    {
+        for (int y = 0; y < m_frame_height; ++y)
+        {
+            const unsigned char *overlay_row = overlay_buffer + y*m_frame_width;
+            unsigned char *bgr_row = bgr_frame_buffer + y*m_frame_stride;
+
+            for (int x = 0; x < m_frame_width; ++x)
+            {
+                if (overlay_row[x] != OverlayColor_None)
+                {
+                    SharedVideoFrameHeader::getOverlayColorBGR(overlay_row[x], &bgr_row[x*3]);
+                }
+            }
+        }
     }
 
     void allocateVideoBuffer()
@@ -172,8 +385,9 @@ public:
 
         if (buffer_size > 0)
         {
-            // Allocate the buffer to copy the video frame into
+            // Allocate the buffers to copy the video frame and its overlay into
             m_bgr_frame_buffer = new unsigned char[buffer_size];
+            m_overlay_buffer = new unsigned char[SharedVideoFrameHeader::computeOverlayBufferSize(m_frame_width, m_frame_height)];
         }
     }
 
@@ -185,6 +399,12 @@ public:
             delete[] m_bgr_frame_buffer;
             m_bgr_frame_buffer = 0;
         }
+
+        if (m_overlay_buffer != nullptr)
+        {
+            delete[] m_overlay_buffer;
+            m_overlay_buffer = 0;
+        }
     }
 
     inline const unsigned char *getVideoFrameBuffer() const { return m_bgr_frame_buffer; }
@@ -192,6 +412,7 @@ public:
     inline int getVideoFrameHeight() const { return m_frame_height; }
     inline int getVideoFrameStride() const { return m_frame_stride; }
     inline int getLastVideoFrameIndex() const { return m_last_frame_index; }
+    inline long long getLastVideoFrameTimestamp() const { return m_last_frame_timestamp_us; }
 
 protected:
     SharedVideoFrameHeader *getFrameHeader()
@@ -204,8 +425,555 @@ private:
     boost::interprocess::shared_memory_object *m_shared_memory_object;
     boost::interprocess::mapped_region *m_region;
     unsigned char *m_bgr_frame_buffer;
+    unsigned char *m_overlay_buffer;
     int m_frame_width, m_frame_height, m_frame_stride;
     int m_last_frame_index;
+    long long m_last_frame_timestamp_us;
+    int m_acquired_slot_index; // Slot of the frame acquireVideoFrame() handed out (-1 = none)
+};
+
+// Copies the per tracker samples that include_all_tracker_data streams add to the raw tracker data
+// (either as TrackerSample messages or packed, see PackedTrackerData.h)
+template <typename t_raw_tracker_data_packet>
+static void applyTrackerSamples(const t_raw_tracker_data_packet &raw_tracker_data, PSMRawTrackerData &out_tracker_data)
+{
+    out_tracker_data.TrackerSampleBitmask = 0;
+
+    const int packed_sample_count = packed_tracker_data_sample_count(raw_tracker_data.packed_tracker_samples());
+    for (int sample_index = 0; sample_index < packed_sample_count; ++sample_index)
+    {
+        int tracker_id;
+        float screen_location[2];
+        float position_cm[3];
+
+        packed_tracker_data_read_sample(raw_tracker_data.packed_tracker_samples(), sample_index, tracker_id, screen_location, position_cm);
+
+        if (IS_VALID_TRACKER_INDEX(tracker_id))
+        {
+            out_tracker_data.TrackerScreenLocations[tracker_id] = { screen_location[0], screen_location[1] };
+            out_tracker_data.TrackerRelativePositionsCm[tracker_id] = { position_cm[0], position_cm[1], position_cm[2] };
+            out_tracker_data.TrackerSampleBitmask |= (1 << tracker_id);
+        }
+    }
+
+    for (const PSMoveProtocol::TrackerSample &sample : raw_tracker_data.tracker_samples())
+    {
+        const int tracker_id = sample.tracker_id();
+
+        if (IS_VALID_TRACKER_INDEX(tracker_id))
+        {
+            out_tracker_data.TrackerScreenLocations[tracker_id] = 
+                { sample.screen_location().x(), sample.screen_location().y() };
+            out_tracker_data.TrackerRelativePositionsCm[tracker_id] = 
+                { sample.relative_position_cm().x(), sample.relative_position_cm().y(), sample.relative_position_cm().z() };
+            out_tracker_data.TrackerSampleBitmask |= (1 << tracker_id);
+        }
+    }
+}
+
+// Returns true if the seqlock slot holds a frame we haven't read yet
+template <typename t_frame>
+static bool readNewPoseSlotFrame(const SharedPoseSlot<t_frame> &slot, uint32_t &last_version, t_frame &out_frame)
+{
+    // A torn read only happens if the writer wrote the slot while we copied it.
+    // Try again a couple of times, otherwise just pick the frame up on the next read.
+    static const int k_max_read_attempts = 3;
+    bool bNewFrame = false;
+
+    if (slot.version.load(std::memory_order_acquire) != last_version)
+    {
+        for (int attempt = 0; attempt < k_max_read_attempts; ++attempt)
+        {
+            uint32_t version;
+
+            if (slot.tryRead(out_frame, version))
+            {
+                bNewFrame = (version != last_version);
+                last_version = version;
+                break;
+            }
+        }
+    }
+
+    return bNewFrame;
+}
+
+class SharedPoseStateReadOnlyAccessor
+{
+public:
+    SharedPoseStateReadOnlyAccessor()
+        : m_shared_memory_object(nullptr)
+        , m_region(nullptr)
+    {
+        memset(m_last_controller_slot_version, 0, sizeof(m_last_controller_slot_version));
+        memset(m_last_hmd_slot_version, 0, sizeof(m_last_hmd_slot_version));
+    }
+
+    ~SharedPoseStateReadOnlyAccessor()
+    {
+        dispose();
+    }
+
+    bool initialize()
+    {
+        bool bSuccess = false;
+
+        try
+        {
+            CLIENT_LOG_INFO("SharedPoseState::initialize()") << "Opening shared memory: " << PSMOVESERVICE_SHARED_POSE_STATE_NAME;
+
+            m_shared_memory_object =
+                new boost::interprocess::shared_memory_object(
+                boost::interprocess::open_only,
+                PSMOVESERVICE_SHARED_POSE_STATE_NAME,
+                boost::interprocess::read_only);
+            m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_only);
+
+            if (m_region->get_size() >= sizeof(SharedPoseStateHeader) &&
+                getPoseStateHeader()->layout_version == COMPACT_DATA_FRAME_VERSION)
+            {
+                bSuccess = true;
+            }
+            else
+            {
+                CLIENT_LOG_WARNING("SharedPoseState::initialize()") << "Shared pose state layout doesn't match this client";
+                dispose();
+            }
+        }
+        catch (boost::interprocess::interprocess_exception &ex)
+        {
+            dispose();
+            CLIENT_LOG_WARNING("SharedPoseState::initialize()") << "Failed to open shared memory: " << PSMOVESERVICE_SHARED_POSE_STATE_NAME
+                << ", reason: " << ex.what();
+        }
+
+        return bSuccess;
+    }
+
+    void dispose()
+    {
+        if (m_region != nullptr)
+        {
+            delete m_region;
+            m_region = nullptr;
+        }
+
+        if (m_shared_memory_object != nullptr)
+        {
+            delete m_shared_memory_object;
+            m_shared_memory_object = nullptr;
+        }
+    }
+
+    // Returns true if the slot holds a frame we haven't read yet
+    bool readControllerPose(PSMControllerID controller_id, CompactControllerPoseFrame &out_pose_frame)
+    {
+        return readNewPoseSlotFrame(getPoseStateHeader()->controller_slots[controller_id], m_last_controller_slot_version[controller_id], out_pose_frame);
+    }
+
+    bool readHMDPose(PSMHmdID hmd_id, CompactHMDPoseFrame &out_pose_frame)
+    {
+        return readNewPoseSlotFrame(getPoseStateHeader()->hmd_slots[hmd_id], m_last_hmd_slot_version[hmd_id], out_pose_frame);
+    }
+
+protected:
+    const SharedPoseStateHeader *getPoseStateHeader() const
+    {
+        return reinterpret_cast<const SharedPoseStateHeader *>(m_region->get_address());
+    }
+
+private:
+    boost::interprocess::shared_memory_object *m_shared_memory_object;
+    boost::interprocess::mapped_region *m_region;
+    uint32_t m_last_controller_slot_version[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    uint32_t m_last_hmd_slot_version[PSMOVESERVICE_MAX_HMD_COUNT];
+};
+
+/// Device state decoded by the network thread (PSMInitFlags_useNetworkThread).
+/**
+ The network thread applies incoming data frames to its own copy of each device view
+ and then publishes the whole view into a seqlock slot, the same kind the service uses
+ for the shared memory poses. The client thread copies a slot back into its device view
+ whenever it has been rewritten, so a state query never waits on the network thread
+ and the network thread never waits on the client.
+ */
+class NetworkThreadDeviceState
+{
+public:
+    NetworkThreadDeviceState()
+    {
+        memset(m_controllers, 0, sizeof(m_controllers));
+        for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)
+        {
+            m_controllers[controller_id].ControllerID= controller_id;
+            m_controllers[controller_id].ControllerType= PSMController_None;
+        }
+
+        memset(m_trackers, 0, sizeof(m_trackers));
+        for (PSMTrackerID tracker_id= 0; tracker_id < PSMOVESERVICE_MAX_TRACKER_COUNT; ++tracker_id)
+        {
+            m_trackers[tracker_id].tracker_info.tracker_id= tracker_id;
+            m_trackers[tracker_id].tracker_info.tracker_type= PSMTracker_None;
+        }
+
+        memset(m_HMDs, 0, sizeof(m_HMDs));
+        for (PSMHmdID hmd_id= 0; hmd_id < PSMOVESERVICE_MAX_HMD_COUNT; ++hmd_id)
+        {
+            m_HMDs[hmd_id].HmdID= hmd_id;
+            m_HMDs[hmd_id].HmdType= PSMHmd_None;
+        }
+
+        memset(m_last_controller_slot_version, 0, sizeof(m_last_controller_slot_version));
+        memset(m_last_tracker_slot_version, 0, sizeof(m_last_tracker_slot_version));
+        memset(m_last_hmd_slot_version, 0, sizeof(m_last_hmd_slot_version));
+    }
+
+    // -- Network thread --
+    PSMController *getNetworkControllerView(PSMControllerID controller_id) { return &m_controllers[controller_id]; }
+    PSMTracker *getNetworkTrackerView(PSMTrackerID tracker_id) { return &m_trackers[tracker_id]; }
+    PSMHeadMountedDisplay *getNetworkHMDView(PSMHmdID hmd_id) { return &m_HMDs[hmd_id]; }
+
+    void publishController(PSMControllerID controller_id) { m_controller_slots[controller_id].write(m_controllers[controller_id]); }
+    void publishTracker(PSMTrackerID tracker_id) { m_tracker_slots[tracker_id].write(m_trackers[tracker_id]); }
+    void publishHMD(PSMHmdID hmd_id) { m_hmd_slots[hmd_id].write(m_HMDs[hmd_id]); }
+
+    // -- Client thread --
+    // Returns true if the network thread published the device since the last fetch
+    bool fetchController(PSMControllerID controller_id, PSMController &out_controller)
+    {
+        return readNewPoseSlotFrame(m_controller_slots[controller_id], m_last_controller_slot_version[controller_id], out_controller);
+    }
+
+    bool fetchTracker(PSMTrackerID tracker_id, PSMTracker &out_tracker)
+    {
+        return readNewPoseSlotFrame(m_tracker_slots[tracker_id], m_last_tracker_slot_version[tracker_id], out_tracker);
+    }
+
+    bool fetchHMD(PSMHmdID hmd_id, PSMHeadMountedDisplay &out_hmd)
+    {
+        return readNewPoseSlotFrame(m_hmd_slots[hmd_id], m_last_hmd_slot_version[hmd_id], out_hmd);
+    }
+
+private:
+    // Only touched by the network thread
+    PSMController m_controllers[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    PSMTracker m_trackers[PSMOVESERVICE_MAX_TRACKER_COUNT];
+    PSMHeadMountedDisplay m_HMDs[PSMOVESERVICE_MAX_HMD_COUNT];
+
+    // Written by the network thread, read by the client thread
+    SharedPoseSlot<PSMController> m_controller_slots[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    SharedPoseSlot<PSMTracker> m_tracker_slots[PSMOVESERVICE_MAX_TRACKER_COUNT];
+    SharedPoseSlot<PSMHeadMountedDisplay> m_hmd_slots[PSMOVESERVICE_MAX_HMD_COUNT];
+
+    // Only touched by the client thread
+    uint32_t m_last_controller_slot_version[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    uint32_t m_last_tracker_slot_version[PSMOVESERVICE_MAX_TRACKER_COUNT];
+    uint32_t m_last_hmd_slot_version[PSMOVESERVICE_MAX_HMD_COUNT];
+};
+
+/// NTP style estimate of the offset between the client steady clock and the service clock.
+/**
+ Each ping gives one (offset, round trip time) sample. Samples with a short
+ round trip time have the least room for asymmetric delay, so the estimate
+ is the offset of the fastest of the last few round trips.
+ Pings go out quickly after connecting, then settle down to a slow rate.
+ */
+class ClientClockSync
+{
+public:
+    ClientClockSync()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        m_sample_count= 0;
+        m_next_sample_index= 0;
+        m_total_sample_count= 0;
+        m_last_ping_time_us= 0;
+        m_bIsPingPending= false;
+    }
+
+    bool getWantsPing(long long now_us) const
+    {
+        const long long ping_interval_us=
+            (m_total_sample_count < k_sample_window_size) ? k_fast_ping_interval_us : k_slow_ping_interval_us;
+
+        return !m_bIsPingPending && (m_last_ping_time_us == 0 || now_us - m_last_ping_time_us >= ping_interval_us);
+    }
+
+    void notePingSent(long long now_us)
+    {
+        m_last_ping_time_us= now_us;
+        m_bIsPingPending= true;
+    }
+
+    void notePingFailed()
+    {
+        m_bIsPingPending= false;
+    }
+
+    void addSample(
+        long long client_send_time_us, long long service_receive_time_us,
+        long long service_send_time_us, long long client_receive_time_us)
+    {
+        ClockSample &sample= m_samples[m_next_sample_index];
+
+        sample.offset_us=
+            ((service_receive_time_us - client_send_time_us) + (service_send_time_us - client_receive_time_us)) / 2;
+        sample.round_trip_time_us=
+            (client_receive_time_us - client_send_time_us) - (service_send_time_us - service_receive_time_us);
+
+        m_next_sample_index= (m_next_sample_index + 1) % k_sample_window_size;
+        m_sample_count= std::min(m_sample_count + 1, k_sample_window_size);
+        ++m_total_sample_count;
+        m_bIsPingPending= false;
+    }
+
+    bool getEstimate(long long &out_offset_us, int &out_round_trip_time_us) const
+    {
+        int best_index= -1;
+
+        for (int sample_index= 0; sample_index < m_sample_count; ++sample_index)
+        {
+            if (best_index == -1 || m_samples[sample_index].round_trip_time_us < m_samples[best_index].round_trip_time_us)
+            {
+                best_index= sample_index;
+            }
+        }
+
+        if (best_index != -1)
+        {
+            out_offset_us= m_samples[best_index].offset_us;
+            out_round_trip_time_us= static_cast<int>(m_samples[best_index].round_trip_time_us);
+        }
+
+        return best_index != -1;
+    }
+
+private:
+    static const int k_sample_window_size= 8;
+    static const long long k_fast_ping_interval_us= 100000;
+    static const long long k_slow_ping_interval_us= 2000000;
+
+    struct ClockSample
+    {
+        long long offset_us; // service time - client time
+        long long round_trip_time_us;
+    };
+
+    ClockSample m_samples[k_sample_window_size];
+    int m_sample_count;
+    int m_next_sample_index;
+    int m_total_sample_count;
+    long long m_last_ping_time_us;
+    bool m_bIsPingPending;
+};
+
+/// Short history of the poses a device streamed, stamped on the client clock.
+/**
+ Lets the client answer "where was (or will) the device be at time t" without a round trip.
+ A time between two samples gets their interpolated pose. A time past the newest sample
+ extrapolates from it with the streamed velocities, or with the difference of the two newest
+ samples when the stream doesn't include physics data, for at most k_max_extrapolation_us.
+ A time before the oldest sample gets the oldest pose.
+ */
+class ClientPoseHistory
+{
+public:
+    ClientPoseHistory()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        m_sample_count= 0;
+        m_next_sample_index= 0;
+        m_last_sequence_num= 0;
+    }
+
+    void addSample(int sequence_num, long long time_us, const PSMPosef &pose, const PSMPhysicsData &physics)
+    {
+        if (m_sample_count > 0)
+        {
+            // Already have this data frame
+            if (sequence_num == m_last_sequence_num)
+                return;
+
+            // The device view got reset (or the service restarted), so the old samples no longer apply
+            if (sequence_num < m_last_sequence_num)
+                reset();
+        }
+
+        // Keep the samples in order when the clock sync estimate moves the service time stamps back
+        if (m_sample_count > 0 && time_us <= getSample(0).time_us)
+        {
+            time_us= getSample(0).time_us + 1;
+        }
+
+        PoseSample &sample= m_samples[m_next_sample_index];
+        sample.time_us= time_us;
+        sample.pose= pose;
+        // Data frames without physics data zero it out, time stamp included
+        sample.bHasStreamedVelocity= physics.TimeInSeconds != 0.0;
+        sample.linear_velocity_cm_per_sec= physics.LinearVelocityCmPerSec;
+        sample.angular_velocity_rad_per_sec= physics.AngularVelocityRadPerSec;
+
+        m_next_sample_index= (m_next_sample_index + 1) % k_sample_window_size;
+        if (m_sample_count < k_sample_window_size)
+        {
+            ++m_sample_count;
+        }
+        m_last_sequence_num= sequence_num;
+    }
+
+    bool getPoseAtTime(long long time_us, PSMPosef &out_pose) const
+    {
+        if (m_sample_count == 0)
+            return false;
+
+        const PoseSample &newest= getSample(0);
+
+        if (time_us >= newest.time_us)
+        {
+            extrapolatePose(time_us, out_pose);
+            return true;
+        }
+
+        // Walk back to the pair of samples bracketing the requested time
+        for (int age= 1; age < m_sample_count; ++age)
+        {
+            const PoseSample &older= getSample(age);
+
+            if (time_us >= older.time_us)
+            {
+                const PoseSample &newer= getSample(age - 1);
+                const float u=
+                    static_cast<float>(time_us - older.time_us) / static_cast<float>(newer.time_us - older.time_us);
+
+                out_pose.Position= lerpVector(older.pose.Position, newer.pose.Position, u);
+                out_pose.Orientation= nlerpQuaternion(older.pose.Orientation, newer.pose.Orientation, u);
+                return true;
+            }
+        }
+
+        // Older than anything we still have
+        out_pose= getSample(m_sample_count - 1).pose;
+        return true;
+    }
+
+private:
+    static const int k_sample_window_size= 16;
+    static const long long k_max_extrapolation_us= 100000;
+
+    struct PoseSample
+    {
+        long long time_us;
+        PSMPosef pose;
+        PSMVector3f linear_velocity_cm_per_sec;
+        PSMVector3f angular_velocity_rad_per_sec;
+        bool bHasStreamedVelocity;
+    };
+
+    // age 0 is the newest sample
+    inline const PoseSample &getSample(int age) const
+    {
+        return m_samples[(m_next_sample_index - 1 - age + 2*k_sample_window_size) % k_sample_window_size];
+    }
+
+    void extrapolatePose(long long time_us, PSMPosef &out_pose) const
+    {
+        const PoseSample &newest= getSample(0);
+        const long long extrapolation_us= time_us - newest.time_us;
+        const long long dt_us= (extrapolation_us < k_max_extrapolation_us) ? extrapolation_us : k_max_extrapolation_us;
+        const float dt= static_cast<float>(dt_us) / 1000000.f;
+
+        PSMVector3f linear_velocity= *k_psm_float_vector3_zero;
+        PSMVector3f angular_velocity= *k_psm_float_vector3_zero;
+
+        if (newest.bHasStreamedVelocity)
+        {
+            linear_velocity= newest.linear_velocity_cm_per_sec;
+            angular_velocity= newest.angular_velocity_rad_per_sec;
+        }
+
+        // Compact pose frames only carry the linear velocity, and some streams no velocity at all,
+        // so fall back to differencing the two newest samples for whatever is missing
+        if (m_sample_count > 1 && (!newest.bHasStreamedVelocity || PSM_Vector3fLength(&angular_velocity) == 0.f))
+        {
+            const PoseSample &previous= getSample(1);
+            const float sample_dt= static_cast<float>(newest.time_us - previous.time_us) / 1000000.f;
+
+            if (!newest.bHasStreamedVelocity)
+            {
+                const PSMVector3f delta_position= PSM_Vector3fSubtract(&newest.pose.Position, &previous.pose.Position);
+
+                linear_velocity= PSM_Vector3fUnsafeScalarDivide(&delta_position, sample_dt);
+            }
+
+            angular_velocity= getWorldAngularVelocity(previous.pose.Orientation, newest.pose.Orientation, sample_dt);
+        }
+
+        out_pose.Position= PSM_Vector3fScaleAndAdd(&linear_velocity, dt, &newest.pose.Position);
+
+        // Rotate by the world space angular velocity: q' = dq*q
+        float angular_speed;
+        const PSMVector3f axis= 
+            PSM_Vector3fNormalizeWithDefaultGetLength(&angular_velocity, k_psm_float_vector3_zero, &angular_speed);
+        const float half_angle= 0.5f*angular_speed*dt;
+        const float sin_half_angle= sinf(half_angle);
+        const PSMQuatf delta_orientation= 
+            PSM_QuatfCreate(cosf(half_angle), axis.x*sin_half_angle, axis.y*sin_half_angle, axis.z*sin_half_angle);
+        const PSMQuatf orientation= PSM_QuatfMultiply(&delta_orientation, &newest.pose.Orientation);
+
+        out_pose.Orientation= PSM_QuatfNormalizeWithDefault(&orientation, k_psm_quaternion_identity);
+    }
+
+    static PSMVector3f getWorldAngularVelocity(const PSMQuatf &from, const PSMQuatf &to, float dt)
+    {
+        // dq = to*conjugate(from), taking the short way around
+        const PSMQuatf from_inverse= PSM_QuatfConjugate(&from);
+        PSMQuatf delta= PSM_QuatfMultiply(&to, &from_inverse);
+
+        if (delta.w < 0.f)
+        {
+            delta= PSM_QuatfScale(&delta, -1.f);
+        }
+
+        const PSMVector3f delta_axis= {delta.x, delta.y, delta.z};
+        float sin_half_angle;
+        const PSMVector3f axis=
+            PSM_Vector3fNormalizeWithDefaultGetLength(&delta_axis, k_psm_float_vector3_zero, &sin_half_angle);
+        const float angle= 2.f*atan2f(sin_half_angle, delta.w);
+
+        return PSM_Vector3fScale(&axis, angle / dt);
+    }
+
+    static PSMVector3f lerpVector(const PSMVector3f &a, const PSMVector3f &b, float u)
+    {
+        const PSMVector3f delta= PSM_Vector3fSubtract(&b, &a);
+
+        return PSM_Vector3fScaleAndAdd(&delta, u, &a);
+    }
+
+    static PSMQuatf nlerpQuaternion(const PSMQuatf &a, const PSMQuatf &b, float u)
+    {
+        // Samples are a frame apart, so a normalized lerp is as good as a slerp here
+        const float dot= a.w*b.w + a.x*b.x + a.y*b.y + a.z*b.z;
+        const float b_weight= (dot < 0.f) ? -u : u;
+        const PSMQuatf scaled_a= PSM_QuatfScale(&a, 1.f - u);
+        const PSMQuatf scaled_b= PSM_QuatfScale(&b, b_weight);
+        const PSMQuatf blended= PSM_QuatfAdd(&scaled_a, &scaled_b);
+
+        return PSM_QuatfNormalizeWithDefault(&blended, &a);
+    }
+
+    PoseSample m_samples[k_sample_window_size];
+    int m_sample_count;
+    int m_next_sample_index;
+    int m_last_sequence_num;
 };
 
 // -- methods -----
@@ -214,12 +982,26 @@ PSMoveClient::PSMoveClient(
     const std::string &port)
     : m_request_manager(nullptr)  // ClientPSMoveAPIImpl::handle_response_message userdata
     , m_network_manager(nullptr) // IClientNetworkEventListener
+	, m_init_flags(PSMInitFlags_defaultOptions)
+	, m_shared_pose_accessor(nullptr)
+	, m_network_thread_state(nullptr)
+	, m_device_data_callback_mutex()
+	, m_clock_sync(new ClientClockSync)
+	, m_bIsClockSyncActive(false)
+	, m_controller_pose_histories(new ClientPoseHistory[PSMOVESERVICE_MAX_CONTROLLER_COUNT])
+	, m_hmd_pose_histories(new ClientPoseHistory[PSMOVESERVICE_MAX_HMD_COUNT])
 	, m_bIsConnected(false)
 	, m_bHasConnectionStatusChanged(false)
 	, m_bHasControllerListChanged(false)
 	, m_bHasTrackerListChanged(false)
 	, m_bHasHMDListChanged(false)
+	, m_message_queue(k_initial_message_queue_capacity)
+	, m_event_pool(k_initial_event_pool_capacity)
 {
+	m_pending_requests.reserve(k_initial_pending_request_capacity);
+	memset(m_controller_data_callbacks, 0, sizeof(m_controller_data_callbacks));
+	memset(m_hmd_data_callbacks, 0, sizeof(m_hmd_data_callbacks));
+
 	m_request_manager=
 		new ClientRequestManager(
             this,  // IDataFrameListener
@@ -236,7 +1018,12 @@ PSMoveClient::PSMoveClient(
 
 PSMoveClient::~PSMoveClient()
 {
+	delete m_shared_pose_accessor;
+	delete m_clock_sync;
+	delete[] m_controller_pose_histories;
+	delete[] m_hmd_pose_histories;
 	delete m_network_manager;
+	delete m_network_thread_state;
 	delete m_request_manager;
 }
 
@@ -287,12 +1074,18 @@ bool PSMoveClient::pollWasSystemButtonPressed()
 }
 
 // -- ClientPSMoveAPI System -----
-bool PSMoveClient::startup(e_log_severity_level log_level)
+bool PSMoveClient::startup(e_log_severity_level log_level, unsigned int init_flags)
 {
     bool success = true;
 
     log_init(log_level);
 
+	m_init_flags= init_flags;
+	memset(m_bControllerUsesSharedPose, 0, sizeof(m_bControllerUsesSharedPose));
+	memset(m_bHMDUsesSharedPose, 0, sizeof(m_bHMDUsesSharedPose));
+	memset(m_bControllerHasPredictionTarget, 0, sizeof(m_bControllerHasPredictionTarget));
+	memset(m_bHMDHasPredictionTarget, 0, sizeof(m_bHMDHasPredictionTarget));
+
 	// Reset status flags
 	m_bIsConnected= false;
 	m_bHasConnectionStatusChanged= false;
@@ -301,65 +1094,193 @@ bool PSMoveClient::startup(e_log_severity_level log_level)
 	m_bHasHMDListChanged= false;
 	m_bWasSystemButtonPressed = false;
 
+	// The network thread decodes the data frames into its own copy of the device state.
+	// Kept across (re)connection attempts since an earlier network thread may still be running until startup.
+	if ((m_init_flags & PSMInitFlags_useNetworkThread) != 0 && m_network_thread_state == nullptr)
+	{
+		m_network_thread_state= new NetworkThreadDeviceState();
+	}
+
     // Attempt to connect to the server
     if (success)
     {
-        if (!m_network_manager->startup())
+        if (!m_network_manager->startup(m_network_thread_state != nullptr))
         {
             CLIENT_LOG_ERROR("ClientPSMoveAPI") << "Failed to initialize the client network manager" << std::endl;
             success = false;
         }
     }
 
-	if (success)
+	if (success)
+	{
+        CLIENT_LOG_INFO("ClientPSMoveAPI") << "Successfully initialized ClientPSMoveAPI" << std::endl;
+
+		memset(&m_controllers, 0, sizeof(PSMController)*PSMOVESERVICE_MAX_CONTROLLER_COUNT);
+		for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)    
+		{
+			m_controllers[controller_id].ControllerID= controller_id;
+			m_controllers[controller_id].ControllerType= PSMController_None;
+			m_controller_pose_histories[controller_id].reset();
+		}
+
+		memset(m_trackers, 0, sizeof(PSMTracker)*PSMOVESERVICE_MAX_TRACKER_COUNT);
+		for (PSMTrackerID tracker_id= 0; tracker_id < PSMOVESERVICE_MAX_TRACKER_COUNT; ++tracker_id)    
+		{
+			m_trackers[tracker_id].tracker_info.tracker_id= tracker_id;
+			m_trackers[tracker_id].tracker_info.tracker_type= PSMTracker_None;
+		}
+
+		memset(m_HMDs, 0, sizeof(PSMHeadMountedDisplay)*PSMOVESERVICE_MAX_HMD_COUNT);
+		for (PSMHmdID hmd_id= 0; hmd_id < PSMOVESERVICE_MAX_HMD_COUNT; ++hmd_id)    
+		{
+			m_HMDs[hmd_id].HmdID= hmd_id;
+			m_HMDs[hmd_id].HmdType= PSMHmd_None;
+			m_hmd_pose_histories[hmd_id].reset();
+		}
+	}
+
+    return success;
+}
+
+void PSMoveClient::update()
+{
+	// If this system button pressed flag wasn't checked last frame, 
+	// then drop it so we don't have a stale flag
+	m_bWasSystemButtonPressed = false;
+
+    // Drop an unread messages from the previous call to update
+    m_message_queue.clear();
+
+    // Drop all of the message parameters
+    // NOTE: The pooled copies are kept around to be reused by the next messages
+    m_request_manager->flush_response_cache();
+    m_event_pool.release_all();
+
+    // Publish modified device state back to the service
+    publish();
+
+    // Keep the client/service clock offset estimate fresh
+    send_clock_sync_ping_if_needed();
+
+    // Process incoming/outgoing networking requests
+    m_network_manager->update();
+
+    // Pick up whatever the network thread decoded since the last update
+    poll_network_thread_state();
+
+    // Pick up anything newer than the data frames we just received
+    poll_shared_memory_poses();
+
+    // Remember the newest poses for the pose at time queries.
+    // Data frames decoded during the network update already got recorded as they came in.
+    for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)
+    {
+        record_controller_pose_sample(controller_id);
+    }
+
+    for (PSMHmdID hmd_id= 0; hmd_id < PSMOVESERVICE_MAX_HMD_COUNT; ++hmd_id)
+    {
+        record_hmd_pose_sample(hmd_id);
+    }
+}
+
+bool PSMoveClient::wait_for_device_data(int timeout_ms)
+{
+	// Without the network thread the data frames that come in during the wait
+	// get applied to the device views right away.
+	// With it, the views pick up the network thread's state when they are next queried.
+	const bool bHasNewData= m_network_manager->wait_for_data_frame(timeout_ms);
+
+	if (bHasNewData)
+	{
+		poll_shared_memory_poses();
+	}
+
+	return bHasNewData;
+}
+
+void PSMoveClient::poll_network_thread_state()
+{
+	if (m_network_thread_state == nullptr)
+		return;
+
+	for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)
+	{
+		fetch_network_thread_controller_state(controller_id);
+	}
+
+	for (PSMTrackerID tracker_id= 0; tracker_id < PSMOVESERVICE_MAX_TRACKER_COUNT; ++tracker_id)
+	{
+		fetch_network_thread_tracker_state(tracker_id);
+	}
+
+	for (PSMHmdID hmd_id= 0; hmd_id < PSMOVESERVICE_MAX_HMD_COUNT; ++hmd_id)
+	{
+		fetch_network_thread_hmd_state(hmd_id);
+	}
+}
+
+void PSMoveClient::fetch_network_thread_controller_state(PSMControllerID controller_id)
+{
+	PSMController network_controller;
+
+	if (m_network_thread_state->fetchController(controller_id, network_controller))
+	{
+		mergeNetworkControllerView(network_controller, &m_controllers[controller_id]);
+	}
+}
+
+void PSMoveClient::fetch_network_thread_tracker_state(PSMTrackerID tracker_id)
+{
+	PSMTracker network_tracker;
+
+	if (m_network_thread_state->fetchTracker(tracker_id, network_tracker))
 	{
-        CLIENT_LOG_INFO("ClientPSMoveAPI") << "Successfully initialized ClientPSMoveAPI" << std::endl;
-
-		memset(&m_controllers, 0, sizeof(PSMController)*PSMOVESERVICE_MAX_CONTROLLER_COUNT);
-		for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)    
-		{
-			m_controllers[controller_id].ControllerID= controller_id;
-			m_controllers[controller_id].ControllerType= PSMController_None;
-		}
+		mergeNetworkTrackerView(network_tracker, &m_trackers[tracker_id]);
+	}
+}
 
-		memset(m_trackers, 0, sizeof(PSMTracker)*PSMOVESERVICE_MAX_TRACKER_COUNT);
-		for (PSMTrackerID tracker_id= 0; tracker_id < PSMOVESERVICE_MAX_TRACKER_COUNT; ++tracker_id)    
-		{
-			m_trackers[tracker_id].tracker_info.tracker_id= tracker_id;
-			m_trackers[tracker_id].tracker_info.tracker_type= PSMTracker_None;
-		}
+void PSMoveClient::fetch_network_thread_hmd_state(PSMHmdID hmd_id)
+{
+	PSMHeadMountedDisplay network_hmd;
 
-		memset(m_HMDs, 0, sizeof(PSMHeadMountedDisplay)*PSMOVESERVICE_MAX_HMD_COUNT);
-		for (PSMHmdID hmd_id= 0; hmd_id < PSMOVESERVICE_MAX_HMD_COUNT; ++hmd_id)    
-		{
-			m_HMDs[hmd_id].HmdID= hmd_id;
-			m_HMDs[hmd_id].HmdType= PSMHmd_None;
-		}
+	if (m_network_thread_state->fetchHMD(hmd_id, network_hmd))
+	{
+		mergeNetworkHMDView(network_hmd, &m_HMDs[hmd_id]);
 	}
-
-    return success;
 }
 
-void PSMoveClient::update()
+void PSMoveClient::poll_shared_memory_poses()
 {
-	// If this system button pressed flag wasn't checked last frame, 
-	// then drop it so we don't have a stale flag
-	m_bWasSystemButtonPressed = false;
+	if (m_shared_pose_accessor == nullptr)
+		return;
 
-    // Drop an unread messages from the previous call to update
-    m_message_queue.clear();
+	for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)
+	{
+		CompactControllerPoseFrame pose_frame;
 
-    // Drop all of the message parameters
-    // NOTE: std::vector::clear() calls the destructor on each element in the vector
-    // This will decrement the last ref count to the parameter data, causing them to get cleaned up.
-    m_request_manager->flush_response_cache();
-    m_event_reference_cache.clear();
+		if (m_bControllerUsesSharedPose[controller_id] &&
+			!m_bControllerHasPredictionTarget[controller_id] &&
+			m_shared_pose_accessor->readControllerPose(controller_id, pose_frame) &&
+			(pose_frame.flags & COMPACT_POSE_FLAG_IS_CONNECTED) != 0)
+		{
+			// Same sequence numbers as the data frames, so whichever arrives second gets dropped
+			applyCompactControllerPoseFrame(&pose_frame, &m_controllers[controller_id]);
+		}
+	}
 
-    // Publish modified device state back to the service
-    publish();
+	for (PSMHmdID hmd_id= 0; hmd_id < PSMOVESERVICE_MAX_HMD_COUNT; ++hmd_id)
+	{
+		CompactHMDPoseFrame pose_frame;
 
-    // Process incoming/outgoing networking requests
-    m_network_manager->update();
+		if (m_bHMDUsesSharedPose[hmd_id] &&
+			!m_bHMDHasPredictionTarget[hmd_id] &&
+			m_shared_pose_accessor->readHMDPose(hmd_id, pose_frame) &&
+			(pose_frame.flags & COMPACT_POSE_FLAG_IS_CONNECTED) != 0)
+		{
+			applyCompactHMDPoseFrame(&pose_frame, &m_HMDs[hmd_id]);
+		}
+	}
 }
 
 void PSMoveClient::process_messages()
@@ -384,91 +1305,102 @@ void PSMoveClient::process_messages()
     }
 }
 
-void PSMoveClient::publish()
+// Sends the controller's changed LED/rumble state to the service right away.
+// The service applies input frames as soon as they arrive, so this saves the wait for the next update().
+bool PSMoveClient::publish_controller_output(PSMControllerID controller_id)
 {
-    // Publish all of the modified controller state
-	for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)    
+	PSMController *Controller= &m_controllers[controller_id];
+	bool bPublished= false;
+		
+	if (Controller->bValid)
 	{
-		PSMController *Controller= &m_controllers[controller_id];
-			
-		if (Controller->bValid)
+		bool bHasUnpublishedState = false;
+
+		switch (Controller->ControllerType)
+		{
+		case PSMController_Move:
+			bHasUnpublishedState = Controller->ControllerState.PSMoveState.bHasUnpublishedState;
+			break;
+		case PSMController_Navi:
+			bHasUnpublishedState = false;
+			break;
+		case PSMController_DualShock4:
+			bHasUnpublishedState = Controller->ControllerState.PSDS4State.bHasUnpublishedState;
+			break;
+		case PSMController_Virtual:
+			bHasUnpublishedState = false;
+			break;
+		}
+
+		if (bHasUnpublishedState)
 		{
-			bool bHasUnpublishedState = false;
+			DeviceInputDataFramePtr data_frame(new PSMoveProtocol::DeviceInputDataFrame);
+			data_frame->set_device_category(PSMoveProtocol::DeviceInputDataFrame_DeviceCategory_CONTROLLER);
+
+			auto *controller_data_packet= data_frame->mutable_controller_data_packet();
+			controller_data_packet->set_controller_id(Controller->ControllerID);
+			controller_data_packet->set_sequence_num(++Controller->InputSequenceNum);
 
 			switch (Controller->ControllerType)
 			{
 			case PSMController_Move:
-				bHasUnpublishedState = Controller->ControllerState.PSMoveState.bHasUnpublishedState;
+				{
+					PSMPSMove *psmove_state= &Controller->ControllerState.PSMoveState;
+					auto *psmove_packet = controller_data_packet->mutable_psmove_state();
+
+					controller_data_packet->set_controller_type(PSMoveProtocol::PSMOVE);
+					psmove_packet->set_led_r(psmove_state->LED_r);
+					psmove_packet->set_led_g(psmove_state->LED_g);
+					psmove_packet->set_led_b(psmove_state->LED_b);
+					psmove_packet->set_rumble_value(psmove_state->Rumble);
+
+					psmove_state->bHasUnpublishedState = false;
+				}
 				break;
 			case PSMController_Navi:
-				bHasUnpublishedState = false;
+				{
+					controller_data_packet->set_controller_type(PSMoveProtocol::PSNAVI);
+				}
 				break;
 			case PSMController_DualShock4:
-				bHasUnpublishedState = Controller->ControllerState.PSDS4State.bHasUnpublishedState;
+				{
+					PSMDualShock4 *ds4_state= &Controller->ControllerState.PSDS4State;
+					auto *ds4_packet = controller_data_packet->mutable_psdualshock4_state();
+
+					controller_data_packet->set_controller_type(PSMoveProtocol::PSDUALSHOCK4);
+					ds4_packet->set_led_r(ds4_state->LED_r);
+					ds4_packet->set_led_g(ds4_state->LED_g);
+					ds4_packet->set_led_b(ds4_state->LED_b);
+					ds4_packet->set_big_rumble_value(ds4_state->BigRumble);
+					ds4_packet->set_small_rumble_value(ds4_state->SmallRumble);
+
+					ds4_state->bHasUnpublishedState= false;
+				}
 				break;
 			case PSMController_Virtual:
-				bHasUnpublishedState = false;
+				{
+					controller_data_packet->set_controller_type(PSMoveProtocol::VIRTUALCONTROLLER);
+				}
 				break;
+			default:
+				assert(0 && "Unhandled controller type");
 			}
 
-			if (bHasUnpublishedState)
-			{
-				DeviceInputDataFramePtr data_frame(new PSMoveProtocol::DeviceInputDataFrame);
-				data_frame->set_device_category(PSMoveProtocol::DeviceInputDataFrame_DeviceCategory_CONTROLLER);
-
-				auto *controller_data_packet= data_frame->mutable_controller_data_packet();
-				controller_data_packet->set_controller_id(Controller->ControllerID);
-				controller_data_packet->set_sequence_num(++Controller->InputSequenceNum);
-
-				switch (Controller->ControllerType)
-				{
-				case PSMController_Move:
-					{
-						PSMPSMove *psmove_state= &Controller->ControllerState.PSMoveState;
-						auto *psmove_packet = controller_data_packet->mutable_psmove_state();
-
-						controller_data_packet->set_controller_type(PSMoveProtocol::PSMOVE);
-						psmove_packet->set_led_r(psmove_state->LED_r);
-						psmove_packet->set_led_g(psmove_state->LED_g);
-						psmove_packet->set_led_b(psmove_state->LED_b);
-						psmove_packet->set_rumble_value(psmove_state->Rumble);
-
-						psmove_state->bHasUnpublishedState = false;
-					}
-					break;
-				case PSMController_Navi:
-					{
-						controller_data_packet->set_controller_type(PSMoveProtocol::PSNAVI);
-					}
-					break;
-				case PSMController_DualShock4:
-					{
-						PSMDualShock4 *ds4_state= &Controller->ControllerState.PSDS4State;
-						auto *ds4_packet = controller_data_packet->mutable_psdualshock4_state();
-
-						controller_data_packet->set_controller_type(PSMoveProtocol::PSDUALSHOCK4);
-						ds4_packet->set_led_r(ds4_state->LED_r);
-						ds4_packet->set_led_g(ds4_state->LED_g);
-						ds4_packet->set_led_b(ds4_state->LED_b);
-						ds4_packet->set_big_rumble_value(ds4_state->BigRumble);
-						ds4_packet->set_small_rumble_value(ds4_state->SmallRumble);
+			// Send the controller data frame over the network
+			m_network_manager->send_device_data_frame(data_frame);
+			bPublished= true;
+		}
+	}
 
-						ds4_state->bHasUnpublishedState= false;
-					}
-					break;
-				case PSMController_Virtual:
-					{
-						controller_data_packet->set_controller_type(PSMoveProtocol::VIRTUALCONTROLLER);
-					}
-					break;
-				default:
-					assert(0 && "Unhandled controller type");
-				}
+	return bPublished;
+}
 
-				// Send the controller data frame over the network
-				m_network_manager->send_device_data_frame(data_frame);
-			}
-		}
+void PSMoveClient::publish()
+{
+    // Publish all of the modified controller state
+	for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)    
+	{
+		publish_controller_output(controller_id);
 	}
 
     // Send any pending re-center controller actions
@@ -591,7 +1523,7 @@ bool PSMoveClient::poll_next_message(PSMMessage *message, size_t message_size)
 {
     bool bHasMessage = false;
 
-    if (m_message_queue.size() > 0)
+    if (!m_message_queue.empty())
     {
         const PSMMessage &first = m_message_queue.front();
 
@@ -602,7 +1534,7 @@ bool PSMoveClient::poll_next_message(PSMMessage *message, size_t message_size)
         m_message_queue.pop_front();
 
         // NOTE: We intentionally keep the message parameters around in the 
-        // m_response_reference_cache and m_event_reference_cache since the
+        // response pool and m_event_pool since the
         // messages contain raw void pointers to the parameters, which
         // become invalid after the next call to update.
 
@@ -614,20 +1546,33 @@ bool PSMoveClient::poll_next_message(PSMMessage *message, size_t message_size)
 
 void PSMoveClient::shutdown()
 {
-    // Close all active network connections
+    // Close all active network connections (this also stops the network thread)
     m_network_manager->shutdown();
 
+	if (m_network_thread_state != nullptr)
+	{
+		delete m_network_thread_state;
+		m_network_thread_state= nullptr;
+	}
+
+	if (m_shared_pose_accessor != nullptr)
+	{
+		delete m_shared_pose_accessor;
+		m_shared_pose_accessor= nullptr;
+	}
+
+    m_bIsClockSyncActive= false;
+    m_clock_sync->reset();
+
     // Drop an unread messages from the previous call to update
     m_message_queue.clear();
 
     // Drop all of the message parameters
-    // NOTE: std::vector::clear() calls the destructor on each element in the vector
-    // This will decrement the last ref count to the parameter data, causing them to get cleaned up.
     m_request_manager->flush_response_cache();
-    m_event_reference_cache.clear();
+    m_event_pool.release_all();
 
     // No more pending requests
-    m_pending_request_map.clear();
+    m_pending_requests.clear();
 }
 
 // -- System Requests ----
@@ -644,6 +1589,22 @@ PSMRequestID PSMoveClient::get_service_version()
     return request->request_id();
 }
 
+PSMRequestID PSMoveClient::get_connection_handshake()
+{
+    CLIENT_LOG_INFO("get_connection_handshake") << "requesting connection handshake" << std::endl;
+
+    // One request for the version, the device lists and the tracking space
+    RequestPtr request(new PSMoveProtocol::Request());
+    request->set_type(PSMoveProtocol::Request_RequestType_GET_CONNECTION_HANDSHAKE);
+
+    // Same filtering as get_controller_list()
+    request->mutable_request_get_connection_handshake()->set_include_usb_controllers(true);
+
+    m_request_manager->send_request(request);
+
+    return request->request_id();
+}
+
 // -- ClientPSMoveAPI Requests -----
 bool PSMoveClient::allocate_controller_listener(PSMControllerID ControllerID)
 {
@@ -681,13 +1642,23 @@ void PSMoveClient::free_controller_listener(PSMControllerID ControllerID)
 			memset(controller, 0, sizeof(PSMController));
 			controller->ControllerID= ControllerID;
 			controller->ControllerType= PSMController_None;
+			m_controller_pose_histories[ControllerID].reset();
 		}
 	}
 }
     
 PSMController* PSMoveClient::get_controller_view(PSMControllerID controller_id)
 {
-	return IS_VALID_CONTROLLER_INDEX(controller_id) ? &m_controllers[controller_id] : nullptr;
+	if (!IS_VALID_CONTROLLER_INDEX(controller_id))
+		return nullptr;
+
+	// Always hand out the newest state the network thread has decoded
+	if (m_network_thread_state != nullptr)
+	{
+		fetch_network_thread_controller_state(controller_id);
+	}
+
+	return &m_controllers[controller_id];
 }
 
 PSMRequestID PSMoveClient::get_controller_list()
@@ -707,7 +1678,7 @@ PSMRequestID PSMoveClient::get_controller_list()
     return request->request_id();
 }
 
-PSMRequestID PSMoveClient::start_controller_data_stream(PSMControllerID controller_id, unsigned int flags)
+PSMRequestID PSMoveClient::start_controller_data_stream(PSMControllerID controller_id, unsigned int flags, float max_update_rate_hz, float fixed_output_rate_hz)
 {
 	PSMRequestID requestID= PSM_INVALID_REQUEST_ID;
 
@@ -738,6 +1709,12 @@ PSMRequestID PSMoveClient::start_controller_data_stream(PSMControllerID controll
 		if ((flags & PSMStreamFlags_includeRawTrackerData) > 0)
 		{
 			request->mutable_request_start_psmove_data_stream()->set_include_raw_tracker_data(true);
+			request->mutable_request_start_psmove_data_stream()->set_use_packed_tracker_data(true);
+		}
+
+		if ((flags & PSMStreamFlags_includeAllTrackerData) > 0)
+		{
+			request->mutable_request_start_psmove_data_stream()->set_include_all_tracker_data(true);
 		}
 
 		if ((flags & PSMStreamFlags_includePhysicsData) > 0)
@@ -750,6 +1727,28 @@ PSMRequestID PSMoveClient::start_controller_data_stream(PSMControllerID controll
 			request->mutable_request_start_psmove_data_stream()->set_disable_roi(true);
 		}
 
+		if ((flags & PSMStreamFlags_useCompactPoseStream) > 0)
+		{
+			request->mutable_request_start_psmove_data_stream()->set_use_compact_pose_stream(true);
+		}
+
+		if ((flags & PSMStreamFlags_onlySendChanges) > 0)
+		{
+			request->mutable_request_start_psmove_data_stream()->set_only_send_changes(true);
+		}
+
+		if ((flags & PSMStreamFlags_useDualRateStream) > 0)
+		{
+			request->mutable_request_start_psmove_data_stream()->set_use_dual_rate_pose_stream(true);
+		}
+
+		request->mutable_request_start_psmove_data_stream()->set_max_update_rate_hz(max_update_rate_hz);
+		request->mutable_request_start_psmove_data_stream()->set_fixed_output_rate_hz(fixed_output_rate_hz);
+
+		// The shared memory poses change whenever the service ticks, only the network stream has the fixed rate
+		m_bControllerUsesSharedPose[controller_id]= 
+			(flags & ~k_shared_pose_compatible_stream_flags) == 0 && fixed_output_rate_hz <= 0.f;
+
 		m_request_manager->send_request(request);
 
 		requestID= request->request_id();
@@ -771,6 +1770,9 @@ PSMRequestID PSMoveClient::stop_controller_data_stream(PSMControllerID controlle
 		request->set_type(PSMoveProtocol::Request_RequestType_STOP_CONTROLLER_DATA_STREAM);
 		request->mutable_request_stop_psmove_data_stream()->set_controller_id(controller_id);
 
+		m_bControllerUsesSharedPose[controller_id]= false;
+		m_bControllerHasPredictionTarget[controller_id]= false;
+
 		m_request_manager->send_request(request);
 
 		requestID= request->request_id();
@@ -851,6 +1853,35 @@ PSMRequestID PSMoveClient::set_controller_data_stream_tracker_index(PSMControlle
 	return requestID;
 }
 
+PSMRequestID PSMoveClient::set_controller_data_stream_prediction_target(
+	PSMControllerID controller_id,
+	long long display_time_us,
+	int display_interval_us)
+{
+	PSMRequestID requestID= PSM_INVALID_REQUEST_ID;
+
+    CLIENT_LOG_INFO("set_controller_data_stream_prediction_target") << "set display time: " << display_time_us
+		<< "us (interval: " << display_interval_us << "us) for ControllerID: " << controller_id << std::endl;
+
+	if (IS_VALID_CONTROLLER_INDEX(controller_id))
+	{
+		RequestPtr request(new PSMoveProtocol::Request());
+		request->set_type(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_DATA_STREAM_PREDICTION_TARGET);
+		request->mutable_request_set_data_stream_prediction_target()->set_device_id(controller_id);
+		request->mutable_request_set_data_stream_prediction_target()->set_display_time_us(display_time_us);
+		request->mutable_request_set_data_stream_prediction_target()->set_display_interval_us(display_interval_us);
+		request->mutable_request_set_data_stream_prediction_target()->set_client_send_time_us(get_client_time_microseconds());
+
+		m_bControllerHasPredictionTarget[controller_id]= (display_time_us != 0);
+
+		m_request_manager->send_request(request);
+
+		requestID= request->request_id();
+	}
+
+	return requestID;
+}
+
 PSMRequestID PSMoveClient::set_controller_hand(PSMControllerID controller_id, PSMControllerHand controller_hand)
 {
 	PSMRequestID requestID= PSM_INVALID_REQUEST_ID;
@@ -914,7 +1945,15 @@ void PSMoveClient::free_tracker_listener(PSMTrackerID tracker_id)
 
 PSMTracker* PSMoveClient::get_tracker_view(PSMTrackerID tracker_id)
 {
-	return IS_VALID_TRACKER_INDEX(tracker_id) ? &m_trackers[tracker_id] : nullptr;
+	if (!IS_VALID_TRACKER_INDEX(tracker_id))
+		return nullptr;
+
+	if (m_network_thread_state != nullptr)
+	{
+		fetch_network_thread_tracker_state(tracker_id);
+	}
+
+	return &m_trackers[tracker_id];
 }
 
 PSMRequestID PSMoveClient::get_tracking_space_settings()
@@ -956,10 +1995,62 @@ PSMRequestID PSMoveClient::start_tracker_data_stream(PSMTrackerID tracker_id)
     return request->request_id();
 }
 
+PSMRequestID PSMoveClient::start_tracker_data_stream_with_preview(
+	PSMTrackerID tracker_id,
+	const PSMTrackerVideoPreviewSettings &settings)
+{
+    CLIENT_LOG_INFO("start_tracker_data_stream_with_preview") << "requesting tracker stream start for TrackerID: " << tracker_id 
+        << " (preview scale " << settings.scale << ", format " << settings.pixel_format << ")" << std::endl;
+
+    RequestPtr request(new PSMoveProtocol::Request());
+    request->set_type(PSMoveProtocol::Request_RequestType_START_TRACKER_DATA_STREAM);
+
+    PSMoveProtocol::Request_RequestStartTrackerDataStream *stream_request= request->mutable_request_start_tracker_data_stream();
+    stream_request->set_tracker_id(tracker_id);
+    stream_request->set_video_preview_scale(settings.scale);
+    stream_request->set_video_preview_format(
+        static_cast<PSMoveProtocol::Request_RequestStartTrackerDataStream_VideoPreviewFormat>(settings.pixel_format));
+
+    m_request_manager->send_request(request);
+
+    return request->request_id();
+}
+
+PSMRequestID PSMoveClient::start_tracker_network_video_stream(
+	PSMTrackerID tracker_id,
+	const PSMTrackerNetworkVideoSettings &settings)
+{
+    CLIENT_LOG_INFO("start_tracker_network_video_stream") << "requesting tracker network video stream start for TrackerID: " << tracker_id << std::endl;
+
+    // Same as a tracker data stream, but the video frames come back over the connection
+    RequestPtr request(new PSMoveProtocol::Request());
+    request->set_type(PSMoveProtocol::Request_RequestType_START_TRACKER_DATA_STREAM);
+
+    PSMoveProtocol::Request_RequestStartTrackerDataStream *stream_request= request->mutable_request_start_tracker_data_stream();
+    stream_request->set_tracker_id(tracker_id);
+    stream_request->set_stream_network_video(true);
+    stream_request->set_network_video_max_frame_rate(settings.max_frame_rate);
+    stream_request->set_network_video_quality(settings.quality);
+    stream_request->set_network_video_max_width(settings.max_width);
+    stream_request->set_network_video_roi_x(settings.roi_x);
+    stream_request->set_network_video_roi_y(settings.roi_y);
+    stream_request->set_network_video_roi_width(settings.roi_width);
+    stream_request->set_network_video_roi_height(settings.roi_height);
+
+    m_request_manager->send_request(request);
+
+    return request->request_id();
+}
+
 PSMRequestID PSMoveClient::stop_tracker_data_stream(PSMTrackerID tracker_id)
 {
     CLIENT_LOG_INFO("stop_tracker_data_stream") << "requesting tracker stream stop for TrackerID: " << tracker_id << std::endl;
 
+	if (IS_VALID_TRACKER_INDEX(tracker_id))
+	{
+		m_tracker_network_video_frames[tracker_id].reset();
+	}
+
     // Tell the psmove service that we want to stop streaming data from the tracker
     RequestPtr request(new PSMoveProtocol::Request());
     request->set_type(PSMoveProtocol::Request_RequestType_STOP_TRACKER_DATA_STREAM);
@@ -1037,26 +2128,133 @@ bool PSMoveClient::poll_video_stream(PSMTrackerID tracker_id)
     return bNewFrame;
 }
 
+bool PSMoveClient::poll_video_stream_into_buffer(PSMTrackerID tracker_id, unsigned char *buffer, size_t buffer_size)
+{
+    bool bNewFrame = false;
+
+	if (IS_VALID_TRACKER_INDEX(tracker_id) && buffer != nullptr)
+	{
+		PSMTracker *tracker= &m_trackers[tracker_id];
+
+		if (tracker->opaque_shared_memory_accesor != nullptr)
+		{
+			SharedVideoFrameReadOnlyAccessor *shared_memory_accesor = 
+				reinterpret_cast<SharedVideoFrameReadOnlyAccessor *>(tracker->opaque_shared_memory_accesor);
+
+			bNewFrame= shared_memory_accesor->readVideoFrame(buffer, buffer_size);
+		}
+	}
+
+    return bNewFrame;
+}
+
 void PSMoveClient::close_video_stream(PSMTrackerID tracker_id)
 {
 	if (IS_VALID_TRACKER_INDEX(tracker_id))
 	{
-		PSMTracker *tracker= &m_trackers[tracker_id];
+		PSMTracker *tracker= &m_trackers[tracker_id];
+
+		if (tracker->opaque_shared_memory_accesor != nullptr)
+		{
+			SharedVideoFrameReadOnlyAccessor *shared_memory_accesor = 
+				reinterpret_cast<SharedVideoFrameReadOnlyAccessor *>(tracker->opaque_shared_memory_accesor);
+
+			delete shared_memory_accesor;
+			tracker->opaque_shared_memory_accesor = nullptr;
+		}
+	}
+}
+
+bool PSMoveClient::get_network_video_frame(PSMTrackerID tracker_id, PSMTrackerNetworkVideoFrame &out_frame) const
+{
+	bool bHasFrame= false;
+
+	if (IS_VALID_TRACKER_INDEX(tracker_id) && m_tracker_network_video_frames[tracker_id])
+	{
+		const PSMoveProtocol::Response_ResultTrackerVideoFrame &video_frame=
+			m_tracker_network_video_frames[tracker_id]->result_tracker_video_frame();
+
+		out_frame.frame_index= video_frame.frame_index();
+		out_frame.timestamp_us= video_frame.timestamp_us();
+		out_frame.frame_width= video_frame.frame_width();
+		out_frame.frame_height= video_frame.frame_height();
+		out_frame.roi_x= video_frame.roi_x();
+		out_frame.roi_y= video_frame.roi_y();
+		out_frame.roi_width= video_frame.roi_width();
+		out_frame.roi_height= video_frame.roi_height();
+		out_frame.image_width= video_frame.image_width();
+		out_frame.image_height= video_frame.image_height();
+		out_frame.jpeg_data= reinterpret_cast<const unsigned char *>(video_frame.jpeg_data().data());
+		out_frame.jpeg_size= video_frame.jpeg_data().size();
+		bHasFrame= true;
+	}
+
+	return bHasFrame;
+}
+
+bool PSMoveClient::acquire_video_frame(PSMTrackerID tracker_id, PSMTrackerVideoFrame &out_frame)
+{
+    bool bAcquired = false;
+
+	if (IS_VALID_TRACKER_INDEX(tracker_id))
+	{
+		PSMTracker *tracker= &m_trackers[tracker_id];
+
+		if (tracker->opaque_shared_memory_accesor != nullptr)
+		{
+			SharedVideoFrameReadOnlyAccessor *shared_memory_accesor = 
+				reinterpret_cast<SharedVideoFrameReadOnlyAccessor *>(tracker->opaque_shared_memory_accesor);
+
+			bAcquired= shared_memory_accesor->acquireVideoFrame(out_frame);
+		}
+	}
+
+    return bAcquired;
+}
+
+bool PSMoveClient::release_video_frame(PSMTrackerID tracker_id)
+{
+    bool bReleased = false;
+
+	if (IS_VALID_TRACKER_INDEX(tracker_id))
+	{
+		PSMTracker *tracker= &m_trackers[tracker_id];
+
+		if (tracker->opaque_shared_memory_accesor != nullptr)
+		{
+			SharedVideoFrameReadOnlyAccessor *shared_memory_accesor = 
+				reinterpret_cast<SharedVideoFrameReadOnlyAccessor *>(tracker->opaque_shared_memory_accesor);
+
+			bReleased= shared_memory_accesor->releaseVideoFrame();
+		}
+	}
+
+    return bReleased;
+}
+
+const unsigned char *PSMoveClient::get_video_frame_buffer(PSMTrackerID tracker_id) const
+{
+	const unsigned char *buffer= nullptr;
+
+	if (IS_VALID_TRACKER_INDEX(tracker_id))
+	{
+		const PSMTracker *tracker= &m_trackers[tracker_id];
 
 		if (tracker->opaque_shared_memory_accesor != nullptr)
 		{
 			SharedVideoFrameReadOnlyAccessor *shared_memory_accesor = 
 				reinterpret_cast<SharedVideoFrameReadOnlyAccessor *>(tracker->opaque_shared_memory_accesor);
 
-			delete shared_memory_accesor;
-			tracker->opaque_shared_memory_accesor = nullptr;
+			buffer= shared_memory_accesor->getVideoFrameBuffer();
 		}
 	}
+
+	return buffer;
 }
 
-const unsigned char *PSMoveClient::get_video_frame_buffer(PSMTrackerID tracker_id) const
+bool PSMoveClient::get_video_frame_size(PSMTrackerID tracker_id, int &out_width, int &out_height, int &out_stride) const
 {
-	const unsigned char *buffer= nullptr;
+	bool bSuccess= false;
 
 	if (IS_VALID_TRACKER_INDEX(tracker_id))
 	{
@@ -1064,14 +2262,17 @@ const unsigned char *PSMoveClient::get_video_frame_buffer(PSMTrackerID tracker_i
 
 		if (tracker->opaque_shared_memory_accesor != nullptr)
 		{
-			SharedVideoFrameReadOnlyAccessor *shared_memory_accesor = 
-				reinterpret_cast<SharedVideoFrameReadOnlyAccessor *>(tracker->opaque_shared_memory_accesor);
+			const SharedVideoFrameReadOnlyAccessor *shared_memory_accesor = 
+				reinterpret_cast<const SharedVideoFrameReadOnlyAccessor *>(tracker->opaque_shared_memory_accesor);
 
-			buffer= shared_memory_accesor->getVideoFrameBuffer();
+			out_width= shared_memory_accesor->getVideoFrameWidth();
+			out_height= shared_memory_accesor->getVideoFrameHeight();
+			out_stride= shared_memory_accesor->getVideoFrameStride();
+			bSuccess= true;
 		}
 	}
 
-	return buffer;
+	return bSuccess;
 }
     
 bool PSMoveClient::allocate_hmd_listener(PSMHmdID hmd_id)
@@ -1110,13 +2311,22 @@ void PSMoveClient::free_hmd_listener(PSMHmdID hmd_id)
             memset(hmd, 0, sizeof(PSMHeadMountedDisplay));
             hmd->HmdID= hmd_id;
             hmd->HmdType= PSMHmd_None;
+            m_hmd_pose_histories[hmd_id].reset();
         }
     }
 }
 
 PSMHeadMountedDisplay* PSMoveClient::get_hmd_view(PSMHmdID hmd_id)
 {
-	return IS_VALID_HMD_INDEX(hmd_id) ? &m_HMDs[hmd_id] : nullptr;
+	if (!IS_VALID_HMD_INDEX(hmd_id))
+		return nullptr;
+
+	if (m_network_thread_state != nullptr)
+	{
+		fetch_network_thread_hmd_state(hmd_id);
+	}
+
+	return &m_HMDs[hmd_id];
 }
 
 PSMRequestID PSMoveClient::get_hmd_list()
@@ -1167,6 +2377,12 @@ PSMRequestID PSMoveClient::start_hmd_data_stream(
 	if ((flags & PSMStreamFlags_includeRawTrackerData) > 0)
 	{
 		request->mutable_request_start_hmd_data_stream()->set_include_raw_tracker_data(true);
+		request->mutable_request_start_hmd_data_stream()->set_use_packed_tracker_data(true);
+	}
+
+	if ((flags & PSMStreamFlags_includeAllTrackerData) > 0)
+	{
+		request->mutable_request_start_hmd_data_stream()->set_include_all_tracker_data(true);
 	}
 
 	if ((flags & PSMStreamFlags_disableROI) > 0)
@@ -1174,6 +2390,11 @@ PSMRequestID PSMoveClient::start_hmd_data_stream(
 		request->mutable_request_start_hmd_data_stream()->set_disable_roi(true);
 	}
 
+	if (IS_VALID_HMD_INDEX(hmd_id))
+	{
+		m_bHMDUsesSharedPose[hmd_id]= (flags & ~k_shared_pose_compatible_stream_flags) == 0;
+	}
+
     m_request_manager->send_request(request);
 
     return request->request_id();
@@ -1189,6 +2410,12 @@ PSMRequestID PSMoveClient::stop_hmd_data_stream(
     request->set_type(PSMoveProtocol::Request_RequestType_STOP_HMD_DATA_STREAM);
     request->mutable_request_stop_hmd_data_stream()->set_hmd_id(hmd_id);
 
+	if (IS_VALID_HMD_INDEX(hmd_id))
+	{
+		m_bHMDUsesSharedPose[hmd_id]= false;
+		m_bHMDHasPredictionTarget[hmd_id]= false;
+	}
+
     m_request_manager->send_request(request);
 
     return request->request_id();
@@ -1208,6 +2435,275 @@ PSMRequestID PSMoveClient::set_hmd_data_stream_tracker_index(PSMHmdID hmd_id, PS
     return request->request_id();
 }
     
+PSMRequestID PSMoveClient::set_hmd_data_stream_prediction_target(
+	PSMHmdID hmd_id,
+	long long display_time_us,
+	int display_interval_us)
+{
+	PSMRequestID requestID= PSM_INVALID_REQUEST_ID;
+
+    CLIENT_LOG_INFO("set_hmd_data_stream_prediction_target") << "set display time: " << display_time_us
+		<< "us (interval: " << display_interval_us << "us) for HmdID: " << hmd_id << std::endl;
+
+	if (IS_VALID_HMD_INDEX(hmd_id))
+	{
+		RequestPtr request(new PSMoveProtocol::Request());
+		request->set_type(PSMoveProtocol::Request_RequestType_SET_HMD_DATA_STREAM_PREDICTION_TARGET);
+		request->mutable_request_set_data_stream_prediction_target()->set_device_id(hmd_id);
+		request->mutable_request_set_data_stream_prediction_target()->set_display_time_us(display_time_us);
+		request->mutable_request_set_data_stream_prediction_target()->set_display_interval_us(display_interval_us);
+		request->mutable_request_set_data_stream_prediction_target()->set_client_send_time_us(get_client_time_microseconds());
+
+		m_bHMDHasPredictionTarget[hmd_id]= (display_time_us != 0);
+
+		m_request_manager->send_request(request);
+
+		requestID= request->request_id();
+	}
+
+	return requestID;
+}
+
+bool PSMoveClient::get_clock_sync_estimate(long long &out_clock_offset_us, int &out_round_trip_time_us) const
+{
+	return m_clock_sync->getEstimate(out_clock_offset_us, out_round_trip_time_us);
+}
+
+bool PSMoveClient::get_controller_pose_at_time(PSMControllerID controller_id, long long time_us, PSMPosef &out_pose)
+{
+	bool bSuccess= false;
+
+	if (IS_VALID_CONTROLLER_INDEX(controller_id))
+	{
+		// Make sure the history holds whatever the network thread decoded since the last update
+		get_controller_view(controller_id);
+		record_controller_pose_sample(controller_id);
+
+		bSuccess= m_controller_pose_histories[controller_id].getPoseAtTime(time_us, out_pose);
+	}
+
+	return bSuccess;
+}
+
+bool PSMoveClient::get_hmd_pose_at_time(PSMHmdID hmd_id, long long time_us, PSMPosef &out_pose)
+{
+	bool bSuccess= false;
+
+	if (IS_VALID_HMD_INDEX(hmd_id))
+	{
+		get_hmd_view(hmd_id);
+		record_hmd_pose_sample(hmd_id);
+
+		bSuccess= m_hmd_pose_histories[hmd_id].getPoseAtTime(time_us, out_pose);
+	}
+
+	return bSuccess;
+}
+
+void PSMoveClient::record_controller_pose_sample(PSMControllerID controller_id)
+{
+	const PSMController &controller= m_controllers[controller_id];
+
+	if (!controller.bValid || !controller.IsConnected)
+		return;
+
+	switch (controller.ControllerType)
+	{
+	case PSMController_Move:
+		{
+			const PSMPSMove &psmove= controller.ControllerState.PSMoveState;
+
+			if (psmove.bIsOrientationValid && psmove.bIsPositionValid)
+			{
+				m_controller_pose_histories[controller_id].addSample(
+					controller.OutputSequenceNum, get_pose_sample_time_us(controller.DataFrameServiceTime),
+					psmove.Pose, psmove.PhysicsData);
+			}
+		} break;
+	case PSMController_DualShock4:
+		{
+			const PSMDualShock4 &ds4= controller.ControllerState.PSDS4State;
+
+			if (ds4.bIsOrientationValid && ds4.bIsPositionValid)
+			{
+				m_controller_pose_histories[controller_id].addSample(
+					controller.OutputSequenceNum, get_pose_sample_time_us(controller.DataFrameServiceTime),
+					ds4.Pose, ds4.PhysicsData);
+			}
+		} break;
+	case PSMController_Virtual:
+		{
+			const PSMVirtualController &virtual_controller= controller.ControllerState.VirtualController;
+
+			if (virtual_controller.bIsPositionValid)
+			{
+				m_controller_pose_histories[controller_id].addSample(
+					controller.OutputSequenceNum, get_pose_sample_time_us(controller.DataFrameServiceTime),
+					virtual_controller.Pose, virtual_controller.PhysicsData);
+			}
+		} break;
+	default:
+		// No pose to remember (e.g. the navi)
+		break;
+	}
+}
+
+void PSMoveClient::record_hmd_pose_sample(PSMHmdID hmd_id)
+{
+	const PSMHeadMountedDisplay &hmd= m_HMDs[hmd_id];
+
+	if (!hmd.bValid || !hmd.IsConnected)
+		return;
+
+	switch (hmd.HmdType)
+	{
+	case PSMHmd_Morpheus:
+		{
+			const PSMMorpheus &morpheus= hmd.HmdState.MorpheusState;
+
+			if (morpheus.bIsOrientationValid && morpheus.bIsPositionValid)
+			{
+				m_hmd_pose_histories[hmd_id].addSample(
+					hmd.OutputSequenceNum, get_pose_sample_time_us(hmd.DataFrameServiceTime),
+					morpheus.Pose, morpheus.PhysicsData);
+			}
+		} break;
+	case PSMHmd_Virtual:
+		{
+			const PSMVirtualHMD &virtual_hmd= hmd.HmdState.VirtualHMDState;
+
+			if (virtual_hmd.bIsPositionValid)
+			{
+				m_hmd_pose_histories[hmd_id].addSample(
+					hmd.OutputSequenceNum, get_pose_sample_time_us(hmd.DataFrameServiceTime),
+					virtual_hmd.Pose, virtual_hmd.PhysicsData);
+			}
+		} break;
+	default:
+		break;
+	}
+}
+
+bool PSMoveClient::get_device_state_snapshot(PSMDeviceStateRecord *out_records, int max_record_count, int &out_record_count) const
+{
+	bool bAllDevicesFit= true;
+
+	// Read the views as the last update left them (rather than through get_*_view) 
+	// so a newer network thread frame can't sneak into only some of the records
+	out_record_count= 0;
+
+	for (PSMControllerID controller_id= 0; controller_id < PSMOVESERVICE_MAX_CONTROLLER_COUNT; ++controller_id)
+	{
+		const PSMController &controller= m_controllers[controller_id];
+
+		if (controller.ListenerCount > 0)
+		{
+			if (out_record_count < max_record_count)
+			{
+				fillControllerStateRecord(controller, &out_records[out_record_count]);
+				++out_record_count;
+			}
+			else
+			{
+				bAllDevicesFit= false;
+			}
+		}
+	}
+
+	for (PSMHmdID hmd_id= 0; hmd_id < PSMOVESERVICE_MAX_HMD_COUNT; ++hmd_id)
+	{
+		const PSMHeadMountedDisplay &hmd= m_HMDs[hmd_id];
+
+		if (hmd.ListenerCount > 0)
+		{
+			if (out_record_count < max_record_count)
+			{
+				fillHmdStateRecord(hmd, &out_records[out_record_count]);
+				++out_record_count;
+			}
+			else
+			{
+				bAllDevicesFit= false;
+			}
+		}
+	}
+
+	return bAllDevicesFit;
+}
+
+long long PSMoveClient::get_pose_sample_time_us(long long service_time_us) const
+{
+	long long clock_offset_us;
+	int round_trip_time_us;
+
+	// Move the service time stamp over to the client clock once we know the offset,
+	// until then the best we can do is when the pose showed up on this end
+	if (service_time_us != 0 && m_clock_sync->getEstimate(clock_offset_us, round_trip_time_us))
+	{
+		return service_time_us - clock_offset_us;
+	}
+	else
+	{
+		return get_client_time_microseconds();
+	}
+}
+
+void PSMoveClient::send_clock_sync_ping_if_needed()
+{
+	const long long now_us= get_client_time_microseconds();
+
+	if (m_bIsClockSyncActive && m_clock_sync->getWantsPing(now_us))
+	{
+		RequestPtr request(new PSMoveProtocol::Request());
+		long long clock_offset_us;
+		int round_trip_time_us;
+
+		request->set_type(PSMoveProtocol::Request_RequestType_CLOCK_SYNC_PING);
+		request->mutable_request_clock_sync_ping()->set_client_send_time_us(now_us);
+
+		// Let the service use our estimate to convert prediction target display times
+		if (m_clock_sync->getEstimate(clock_offset_us, round_trip_time_us))
+		{
+			request->mutable_request_clock_sync_ping()->set_has_clock_offset_estimate(true);
+			request->mutable_request_clock_sync_ping()->set_clock_offset_estimate_us(clock_offset_us);
+		}
+
+		m_request_manager->send_request(request);
+		register_callback(request->request_id(), PSMoveClient::handle_clock_sync_pong, this);
+
+		m_clock_sync->notePingSent(now_us);
+	}
+}
+
+void PSMoveClient::handle_clock_sync_pong(const PSMResponseMessage *response_message, void *userdata)
+{
+	const long long client_receive_time_us= get_client_time_microseconds();
+	PSMoveClient *this_ptr= reinterpret_cast<PSMoveClient *>(userdata);
+	const PSMoveProtocol::Response *response=
+		reinterpret_cast<const PSMoveProtocol::Response *>(response_message->opaque_response_handle);
+
+	if (response_message->result_code == PSMResult_Success &&
+		response != nullptr &&
+		response->type() == PSMoveProtocol::Response_ResponseType_CLOCK_SYNC_PONG)
+	{
+		const auto &pong= response->result_clock_sync_pong();
+
+		this_ptr->m_clock_sync->addSample(
+			pong.client_send_time_us(), pong.service_receive_time_us(),
+			pong.service_send_time_us(), client_receive_time_us);
+	}
+	else
+	{
+		this_ptr->m_clock_sync->notePingFailed();
+	}
+}
+
+long long PSMoveClient::get_client_time_microseconds()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 PSMRequestID PSMoveClient::send_opaque_request(
     PSMRequestHandle request_handle)
 {
@@ -1219,8 +2715,13 @@ PSMRequestID PSMoveClient::send_opaque_request(
 }    
     
 // IDataFrameListener
+// NOTE: Called on the network thread with PSMInitFlags_useNetworkThread,
+// in which case the data frame only goes to the network thread's copy of the device.
+// The initial data frame of a stream started response still comes in on the client thread.
 void PSMoveClient::handle_data_frame(const PSMoveProtocol::DeviceOutputDataFrame *data_frame)
 {
+	const bool bOnNetworkThread= m_network_thread_state != nullptr && m_network_manager->get_is_network_thread();
+
     switch (data_frame->device_category())
     {
     case PSMoveProtocol::DeviceOutputDataFrame::CONTROLLER:
@@ -1228,55 +2729,203 @@ void PSMoveClient::handle_data_frame(const PSMoveProtocol::DeviceOutputDataFrame
             const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet= data_frame->controller_data_packet();
 			const PSMControllerID controller_id= controller_packet.controller_id();
 
-            CLIENT_LOG_TRACE("handle_data_frame") 
-                << "received data frame for ControllerID: " 
-                << controller_id << std::endl;
+            CLIENT_LOG_TRACE("handle_data_frame") 
+                << "received data frame for ControllerID: " 
+                << controller_id << std::endl;
+
+			if (IS_VALID_CONTROLLER_INDEX(controller_id))
+			{
+				if (bOnNetworkThread)
+				{
+					PSMController *controller= m_network_thread_state->getNetworkControllerView(controller_id);
+
+					applyControllerDataFrame(controller_packet, data_frame->service_time_us(), controller);
+					m_network_thread_state->publishController(controller_id);
+					notify_controller_data_callback(*controller);
+				}
+				else
+				{
+					PSMController *controller= get_controller_view(controller_id);
+
+					applyControllerDataFrame(controller_packet, data_frame->service_time_us(), controller);
+					record_controller_pose_sample(controller_id);
+					notify_controller_data_callback(*controller);
+				}
+			}
+        } break;
+    case PSMoveProtocol::DeviceOutputDataFrame::TRACKER:
+        {
+            const PSMoveProtocol::DeviceOutputDataFrame_TrackerDataPacket& tracker_packet = data_frame->tracker_data_packet();
+			const PSMTrackerID tracker_id= tracker_packet.tracker_id();
+
+            CLIENT_LOG_TRACE("handle_data_frame")
+                << "received data frame for TrackerID: "
+                << tracker_id << std::endl;
+
+			if (IS_VALID_TRACKER_INDEX(tracker_id))
+			{
+				if (bOnNetworkThread)
+				{
+					PSMTracker *tracker= m_network_thread_state->getNetworkTrackerView(tracker_id);
+
+					applyTrackerDataFrame(tracker_packet, data_frame->service_time_us(), tracker);
+					m_network_thread_state->publishTracker(tracker_id);
+				}
+				else
+				{
+					PSMTracker *tracker= get_tracker_view(tracker_id);
+
+					applyTrackerDataFrame(tracker_packet, data_frame->service_time_us(), tracker);
+				}
+			}
+        } break;
+    case PSMoveProtocol::DeviceOutputDataFrame::HMD:
+        {
+            const PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket& hmd_packet = data_frame->hmd_data_packet();
+			const PSMHmdID hmd_id= hmd_packet.hmd_id();
+
+            CLIENT_LOG_TRACE("handle_data_frame")
+                << "received data frame for HmdID: "
+                << hmd_packet.hmd_id()
+                << ". Ignoring." << std::endl;
+
+			if (IS_VALID_HMD_INDEX(hmd_id))
+			{
+				if (bOnNetworkThread)
+				{
+					PSMHeadMountedDisplay *hmd= m_network_thread_state->getNetworkHMDView(hmd_id);
+
+					applyHmdDataFrame(hmd_packet, data_frame->service_time_us(), hmd);
+					m_network_thread_state->publishHMD(hmd_id);
+					notify_hmd_data_callback(*hmd);
+				}
+				else
+				{
+					PSMHeadMountedDisplay *hmd= get_hmd_view(hmd_id);
+
+					applyHmdDataFrame(hmd_packet, data_frame->service_time_us(), hmd);
+					record_hmd_pose_sample(hmd_id);
+					notify_hmd_data_callback(*hmd);
+				}
+			}
+        } break;            
+    }
+}
+
+void PSMoveClient::handle_compact_pose_frame(const CompactControllerPoseFrame *pose_frame)
+{
+	const bool bOnNetworkThread= m_network_thread_state != nullptr && m_network_manager->get_is_network_thread();
+	const PSMControllerID controller_id= pose_frame->controller_id;
+
+    CLIENT_LOG_TRACE("handle_compact_pose_frame") 
+        << "received compact pose frame for ControllerID: " 
+        << controller_id << std::endl;
+
+	if (IS_VALID_CONTROLLER_INDEX(controller_id))
+	{
+		if (bOnNetworkThread)
+		{
+			PSMController *controller= m_network_thread_state->getNetworkControllerView(controller_id);
+
+			applyCompactControllerPoseFrame(pose_frame, controller);
+			m_network_thread_state->publishController(controller_id);
+			notify_controller_data_callback(*controller);
+		}
+		else
+		{
+			PSMController *controller= get_controller_view(controller_id);
+
+			applyCompactControllerPoseFrame(pose_frame, controller);
+			record_controller_pose_sample(controller_id);
+			notify_controller_data_callback(*controller);
+		}
+	}
+}
+
+void PSMoveClient::handle_compact_orientation_frame(const CompactControllerOrientationFrame *orientation_frame)
+{
+	const bool bOnNetworkThread= m_network_thread_state != nullptr && m_network_manager->get_is_network_thread();
+	const PSMControllerID controller_id= orientation_frame->controller_id;
+
+    CLIENT_LOG_TRACE("handle_compact_orientation_frame") 
+        << "received compact orientation frame for ControllerID: " 
+        << controller_id << std::endl;
+
+	if (IS_VALID_CONTROLLER_INDEX(controller_id))
+	{
+		if (bOnNetworkThread)
+		{
+			PSMController *controller= m_network_thread_state->getNetworkControllerView(controller_id);
+
+			applyCompactControllerOrientationFrame(orientation_frame, controller);
+			m_network_thread_state->publishController(controller_id);
+			notify_controller_data_callback(*controller);
+		}
+		else
+		{
+			PSMController *controller= get_controller_view(controller_id);
+
+			applyCompactControllerOrientationFrame(orientation_frame, controller);
+			record_controller_pose_sample(controller_id);
+			notify_controller_data_callback(*controller);
+		}
+	}
+}
+
+void PSMoveClient::set_controller_data_callback(
+	PSMControllerID controller_id,
+	PSMDeviceDataCallback callback,
+	void *callback_userdata)
+{
+	std::lock_guard<std::mutex> lock(m_device_data_callback_mutex);
+
+	m_controller_data_callbacks[controller_id].callback= callback;
+	m_controller_data_callbacks[controller_id].callback_userdata= callback_userdata;
+}
 
-			if (IS_VALID_CONTROLLER_INDEX(controller_id))
-			{
-				PSMController *controller= get_controller_view(controller_id);
+void PSMoveClient::set_hmd_data_callback(
+	PSMHmdID hmd_id,
+	PSMDeviceDataCallback callback,
+	void *callback_userdata)
+{
+	std::lock_guard<std::mutex> lock(m_device_data_callback_mutex);
 
-				applyControllerDataFrame(controller_packet, controller);
-			}
-        } break;
-    case PSMoveProtocol::DeviceOutputDataFrame::TRACKER:
-        {
-            const PSMoveProtocol::DeviceOutputDataFrame_TrackerDataPacket& tracker_packet = data_frame->tracker_data_packet();
-			const PSMTrackerID tracker_id= tracker_packet.tracker_id();
+	m_hmd_data_callbacks[hmd_id].callback= callback;
+	m_hmd_data_callbacks[hmd_id].callback_userdata= callback_userdata;
+}
 
-            CLIENT_LOG_TRACE("handle_data_frame")
-                << "received data frame for TrackerID: "
-                << tracker_id << std::endl;
+// NOTE: Called on whichever thread decoded the data frame
+void PSMoveClient::notify_controller_data_callback(const PSMController &controller)
+{
+	std::lock_guard<std::mutex> lock(m_device_data_callback_mutex);
+	const DeviceDataCallback &data_callback= m_controller_data_callbacks[controller.ControllerID];
 
-			if (IS_VALID_TRACKER_INDEX(tracker_id))
-			{
-				PSMTracker *tracker= get_tracker_view(tracker_id);
+	if (data_callback.callback != nullptr)
+	{
+		PSMDeviceStateRecord record;
 
-				applyTrackerDataFrame(tracker_packet, tracker);
-			}
-        } break;
-    case PSMoveProtocol::DeviceOutputDataFrame::HMD:
-        {
-            const PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket& hmd_packet = data_frame->hmd_data_packet();
-			const PSMHmdID hmd_id= hmd_packet.hmd_id();
+		fillControllerStateRecord(controller, &record);
+		data_callback.callback(&record, data_callback.callback_userdata);
+	}
+}
 
-            CLIENT_LOG_TRACE("handle_data_frame")
-                << "received data frame for HmdID: "
-                << hmd_packet.hmd_id()
-                << ". Ignoring." << std::endl;
+void PSMoveClient::notify_hmd_data_callback(const PSMHeadMountedDisplay &hmd)
+{
+	std::lock_guard<std::mutex> lock(m_device_data_callback_mutex);
+	const DeviceDataCallback &data_callback= m_hmd_data_callbacks[hmd.HmdID];
 
-			if (IS_VALID_HMD_INDEX(hmd_id))
-			{
-				PSMHeadMountedDisplay *hmd= get_hmd_view(hmd_id);
+	if (data_callback.callback != nullptr)
+	{
+		PSMDeviceStateRecord record;
 
-				applyHmdDataFrame(hmd_packet, hmd);
-			}
-        } break;            
-    }
+		fillHmdStateRecord(hmd, &record);
+		data_callback.callback(&record, data_callback.callback_userdata);
+	}
 }
 
 static void applyControllerDataFrame(
 	const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet, 
+	long long service_time_us,
 	PSMController *controller)
 {    
 	// Ignore old packets
@@ -1288,24 +2937,10 @@ static void applyControllerDataFrame(
     controller->ControllerType = static_cast<PSMControllerType>(controller_packet.controller_type());
     controller->OutputSequenceNum = controller_packet.sequence_num();
     controller->IsConnected = controller_packet.isconnected();
+    controller->DataFrameServiceTime = service_time_us;
 
     // Compute the data frame receive window statistics if we have received enough samples
-    {
-        long long now = 
-            std::chrono::duration_cast< std::chrono::milliseconds >(
-                std::chrono::system_clock::now().time_since_epoch()).count();
-        long long diff= now - controller->DataFrameLastReceivedTime;
-
-        if (diff > 0)
-        {
-            float seconds= static_cast<float>(diff) / 1000.f;
-            float fps= 1.f / seconds;
-
-            controller->DataFrameAverageFPS= (0.9f)*controller->DataFrameAverageFPS + (0.1f)*fps;
-        }
-
-        controller->DataFrameLastReceivedTime= now;
-    }
+    updateControllerDataFrameStatistics(controller);
    
 	// Don't bother updating the rest of the controller state if it's not connected
 	if (!controller->IsConnected)
@@ -1333,6 +2968,148 @@ static void applyControllerDataFrame(
     }
 }
 
+static void applyCompactControllerPoseFrame(
+	const CompactControllerPoseFrame *pose_frame,
+	PSMController *controller)
+{
+	// Ignore old packets
+	if (pose_frame->sequence_num <= controller->OutputSequenceNum)
+		return;
+
+	// The service only sends compact frames for controller types it has a layout for
+	if (pose_frame->controller_type != PSMoveProtocol::PSMOVE)
+		return;
+
+    controller->bValid = true;
+    controller->ControllerType = PSMController_Move;
+    controller->OutputSequenceNum = pose_frame->sequence_num;
+    controller->IsConnected = (pose_frame->flags & COMPACT_POSE_FLAG_IS_CONNECTED) != 0;
+    controller->DataFrameServiceTime = pose_frame->service_time_us;
+
+    updateControllerDataFrameStatistics(controller);
+
+	// Don't bother updating the rest of the controller state if it's not connected
+	if (!controller->IsConnected)
+		return;
+
+	PSMPSMove *psmove= &controller->ControllerState.PSMoveState;
+
+    psmove->bHasValidHardwareCalibration = (pose_frame->flags & COMPACT_POSE_FLAG_VALID_HARDWARE_CALIBRATION) != 0;
+    psmove->bIsTrackingEnabled = (pose_frame->flags & COMPACT_POSE_FLAG_IS_TRACKING_ENABLED) != 0;
+    psmove->bIsCurrentlyTracking = (pose_frame->flags & COMPACT_POSE_FLAG_IS_CURRENTLY_TRACKING) != 0;
+	psmove->bIsOrientationValid = (pose_frame->flags & COMPACT_POSE_FLAG_IS_ORIENTATION_VALID) != 0;
+	psmove->bIsPositionValid = (pose_frame->flags & COMPACT_POSE_FLAG_IS_POSITION_VALID) != 0;
+
+    psmove->Pose.Orientation.w= pose_frame->orientation[0];
+    psmove->Pose.Orientation.x= pose_frame->orientation[1];
+    psmove->Pose.Orientation.y= pose_frame->orientation[2];
+    psmove->Pose.Orientation.z= pose_frame->orientation[3];
+
+    psmove->Pose.Position.x= pose_frame->position_cm[0];
+    psmove->Pose.Position.y= pose_frame->position_cm[1];
+    psmove->Pose.Position.z= pose_frame->position_cm[2];
+
+	// Only the linear velocity makes it into the compact frame
+    memset(&psmove->PhysicsData, 0, sizeof(PSMPhysicsData));
+    psmove->PhysicsData.LinearVelocityCmPerSec.x = pose_frame->velocity_cm_per_sec[0];
+    psmove->PhysicsData.LinearVelocityCmPerSec.y = pose_frame->velocity_cm_per_sec[1];
+    psmove->PhysicsData.LinearVelocityCmPerSec.z = pose_frame->velocity_cm_per_sec[2];
+	psmove->PhysicsData.TimeInSeconds= -1.0;
+
+	memset(&psmove->RawSensorData, 0, sizeof(PSMPSMoveRawSensorData));
+	memset(&psmove->CalibratedSensorData, 0, sizeof(PSMPSMoveCalibratedSensorData));
+	memset(&psmove->RawTrackerData, 0, sizeof(PSMRawTrackerData));
+
+	unsigned int button_bitmask = pose_frame->button_down_bitmask;
+	applyPSMButtonState(psmove->TriangleButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_TRIANGLE);
+	applyPSMButtonState(psmove->CircleButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_CIRCLE);
+	applyPSMButtonState(psmove->CrossButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_CROSS);
+	applyPSMButtonState(psmove->SquareButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_SQUARE);
+	applyPSMButtonState(psmove->SelectButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_SELECT);
+	applyPSMButtonState(psmove->StartButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_START);
+	applyPSMButtonState(psmove->PSButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_PS);
+	applyPSMButtonState(psmove->MoveButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_MOVE);
+	applyPSMButtonState(psmove->TriggerButton, button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket_ButtonType_TRIGGER);
+
+	psmove->TriggerValue = pose_frame->trigger_value;
+	psmove->BatteryValue = static_cast<PSMBatteryState>(pose_frame->battery_value);
+}
+
+static void applyCompactControllerOrientationFrame(
+	const CompactControllerOrientationFrame *orientation_frame,
+	PSMController *controller)
+{
+	// Ignore old packets
+	if (orientation_frame->sequence_num <= controller->OutputSequenceNum)
+		return;
+
+	// Everything but the orientation comes from the last full pose frame,
+	// so wait for one before showing anything
+	if (!controller->bValid || controller->ControllerType != PSMController_Move)
+		return;
+
+    controller->OutputSequenceNum = orientation_frame->sequence_num;
+    controller->IsConnected = (orientation_frame->flags & COMPACT_POSE_FLAG_IS_CONNECTED) != 0;
+    controller->DataFrameServiceTime = orientation_frame->service_time_us;
+
+    updateControllerDataFrameStatistics(controller);
+
+	if (!controller->IsConnected)
+		return;
+
+	PSMPSMove *psmove= &controller->ControllerState.PSMoveState;
+
+	psmove->bIsOrientationValid = (orientation_frame->flags & COMPACT_POSE_FLAG_IS_ORIENTATION_VALID) != 0;
+
+    psmove->Pose.Orientation.w= orientation_frame->orientation[0];
+    psmove->Pose.Orientation.x= orientation_frame->orientation[1];
+    psmove->Pose.Orientation.y= orientation_frame->orientation[2];
+    psmove->Pose.Orientation.z= orientation_frame->orientation[3];
+
+	// The buttons haven't changed since the last full frame (the service sends one when they do),
+	// but their pressed/released edges still have to settle like they would on a repeated full frame
+	unsigned int button_bitmask= 0;
+	int bit_index= 0;
+	appendButtonDownBit(psmove->TriangleButton, bit_index, button_bitmask);
+	appendButtonDownBit(psmove->CircleButton, bit_index, button_bitmask);
+	appendButtonDownBit(psmove->CrossButton, bit_index, button_bitmask);
+	appendButtonDownBit(psmove->SquareButton, bit_index, button_bitmask);
+	appendButtonDownBit(psmove->SelectButton, bit_index, button_bitmask);
+	appendButtonDownBit(psmove->StartButton, bit_index, button_bitmask);
+	appendButtonDownBit(psmove->PSButton, bit_index, button_bitmask);
+	appendButtonDownBit(psmove->MoveButton, bit_index, button_bitmask);
+	appendButtonDownBit(psmove->TriggerButton, bit_index, button_bitmask);
+
+	bit_index= 0;
+	applyPSMButtonState(psmove->TriangleButton, button_bitmask, bit_index++);
+	applyPSMButtonState(psmove->CircleButton, button_bitmask, bit_index++);
+	applyPSMButtonState(psmove->CrossButton, button_bitmask, bit_index++);
+	applyPSMButtonState(psmove->SquareButton, button_bitmask, bit_index++);
+	applyPSMButtonState(psmove->SelectButton, button_bitmask, bit_index++);
+	applyPSMButtonState(psmove->StartButton, button_bitmask, bit_index++);
+	applyPSMButtonState(psmove->PSButton, button_bitmask, bit_index++);
+	applyPSMButtonState(psmove->MoveButton, button_bitmask, bit_index++);
+	applyPSMButtonState(psmove->TriggerButton, button_bitmask, bit_index++);
+}
+
+static void updateControllerDataFrameStatistics(PSMController *controller)
+{
+    long long now = 
+        std::chrono::duration_cast< std::chrono::milliseconds >(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    long long diff= now - controller->DataFrameLastReceivedTime;
+
+    if (diff > 0)
+    {
+        float seconds= static_cast<float>(diff) / 1000.f;
+        float fps= 1.f / seconds;
+
+        controller->DataFrameAverageFPS= (0.9f)*controller->DataFrameAverageFPS + (0.1f)*fps;
+    }
+
+    controller->DataFrameLastReceivedTime= now;
+}
+
 static void applyPSMoveDataFrame(
 	const PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket& controller_packet,
 	PSMPSMove *psmove)
@@ -1427,7 +3204,7 @@ static void applyPSMoveDataFrame(
 	}
 	else
 	{
-		memset(&psmove->RawSensorData, 0, sizeof(PSMPSMoveCalibratedSensorData));
+		memset(&psmove->CalibratedSensorData, 0, sizeof(PSMPSMoveCalibratedSensorData));
 	}
 
 	if (psmove_packet.has_raw_tracker_data())
@@ -1476,6 +3253,8 @@ static void applyPSMoveDataFrame(
 		// No optical orientation from sphere projection
 		psmove->RawTrackerData.bMulticamOrientationValid = false;
 		psmove->RawTrackerData.MulticamOrientation = *k_psm_quaternion_identity;
+
+		applyTrackerSamples(raw_tracker_data, psmove->RawTrackerData);
 	}
 	else
 	{
@@ -1610,7 +3389,7 @@ static void applyDualShock4DataFrame(
 	}
 	else
 	{
-		memset(&ds4->RawSensorData, 0, sizeof(PSMPSMoveCalibratedSensorData));
+		memset(&ds4->CalibratedSensorData, 0, sizeof(PSMDS4CalibratedSensorData));
 	}
 
 	if (ds4_packet.has_raw_tracker_data())
@@ -1628,7 +3407,21 @@ static void applyDualShock4DataFrame(
 			PSM_QuatfCreate(orientationOnTracker.w(), orientationOnTracker.x(), orientationOnTracker.y(), orientationOnTracker.z());
         ds4->RawTrackerData.ValidTrackerBitmask = raw_tracker_data.valid_tracker_bitmask();
 
-		if (raw_tracker_data.has_projected_blob())
+		if (raw_tracker_data.packed_projected_blob_size() > 0)
+		{
+            PSMTrackingProjection &projection = ds4->RawTrackerData.TrackingProjection;
+            PSMVector2f blob_points[7];
+
+            // The triangle, then the quad (same as projected_blob)
+            const int point_count = packed_tracker_data_read_points(raw_tracker_data.packed_projected_blob(), blob_points, 7);
+            assert(point_count == 7);
+            std::fill(blob_points + point_count, blob_points + 7, PSMVector2f{0.f, 0.f});
+
+            projection.shape_type = PSMTrackingProjection::PSMShape_LightBar;
+            std::copy(blob_points, blob_points + 3, projection.shape.lightbar.triangle);
+            std::copy(blob_points + 3, blob_points + 7, projection.shape.lightbar.quad);
+		}
+		else if (raw_tracker_data.has_projected_blob())
 		{
             const PSMoveProtocol::Polygon &protocolPolygon = raw_tracker_data.projected_blob();
             PSMTrackingProjection &projection = ds4->RawTrackerData.TrackingProjection;
@@ -1678,6 +3471,8 @@ static void applyDualShock4DataFrame(
 			ds4->RawTrackerData.MulticamOrientation.z = multicam_orientation.z();
 			ds4->RawTrackerData.bMulticamOrientationValid = true;
 		}
+
+		applyTrackerSamples(raw_tracker_data, ds4->RawTrackerData);
 	}
 	else
 	{
@@ -1823,6 +3618,8 @@ static void applyVirtualControllerDataFrame(
 			virtual_controller->RawTrackerData.MulticamPositionCm.z = multicam_position.z();
 			virtual_controller->RawTrackerData.bMulticamPositionValid = true;
 		}
+
+		applyTrackerSamples(raw_tracker_data, virtual_controller->RawTrackerData);
 	}
 	else
 	{
@@ -1856,6 +3653,7 @@ static void applyPSMButtonState(
 
 static void applyTrackerDataFrame(
 	const PSMoveProtocol::DeviceOutputDataFrame_TrackerDataPacket& tracker_packet, 
+	long long service_time_us,
 	PSMTracker *tracker)
 {
 	assert(tracker_packet.tracker_id() == tracker->tracker_info.tracker_id);
@@ -1882,11 +3680,14 @@ static void applyTrackerDataFrame(
     {
         tracker->sequence_num = tracker_packet.sequence_num();
         tracker->is_connected = tracker_packet.isconnected();
+        tracker->data_frame_service_time = service_time_us;
+        tracker->dropped_frame_count = tracker_packet.dropped_frame_count();
     }
 }
 
 static void applyHmdDataFrame(
 	const PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket& hmd_packet, 
+	long long service_time_us,
 	PSMHeadMountedDisplay *hmd)
 {
 	// Ignore old packets
@@ -1898,24 +3699,10 @@ static void applyHmdDataFrame(
     hmd->HmdType = static_cast<PSMHmdType>(hmd_packet.hmd_type());
     hmd->OutputSequenceNum = hmd_packet.sequence_num();
     hmd->IsConnected = hmd_packet.isconnected();
+    hmd->DataFrameServiceTime = service_time_us;
 
     // Compute the data frame receive window statistics if we have received enough samples
-    {
-        long long now = 
-            std::chrono::duration_cast< std::chrono::milliseconds >(
-                std::chrono::system_clock::now().time_since_epoch()).count();
-        long long diff= now - hmd->DataFrameLastReceivedTime;
-
-        if (diff > 0)
-        {
-            float seconds= static_cast<float>(diff) / 1000.f;
-            float fps= 1.f / seconds;
-
-            hmd->DataFrameAverageFPS= (0.9f)*hmd->DataFrameAverageFPS + (0.1f)*fps;
-        }
-
-        hmd->DataFrameLastReceivedTime= now;
-    }
+    updateHmdDataFrameStatistics(hmd);
 
 	// Don't bother updating the rest of the hmd state if it's not connected
 	if (!hmd->IsConnected)
@@ -1934,6 +3721,99 @@ static void applyHmdDataFrame(
     }
 }
 
+static void applyCompactHMDPoseFrame(
+	const CompactHMDPoseFrame *pose_frame,
+	PSMHeadMountedDisplay *hmd)
+{
+	// Ignore old packets
+	if (pose_frame->sequence_num <= hmd->OutputSequenceNum)
+		return;
+
+    hmd->bValid = true;
+    hmd->HmdType = static_cast<PSMHmdType>(pose_frame->hmd_type);
+    hmd->OutputSequenceNum = pose_frame->sequence_num;
+    hmd->IsConnected = (pose_frame->flags & COMPACT_POSE_FLAG_IS_CONNECTED) != 0;
+    hmd->DataFrameServiceTime = pose_frame->service_time_us;
+
+    updateHmdDataFrameStatistics(hmd);
+
+	// Don't bother updating the rest of the hmd state if it's not connected
+	if (!hmd->IsConnected)
+		return;
+
+	const bool bIsTrackingEnabled = (pose_frame->flags & COMPACT_POSE_FLAG_IS_TRACKING_ENABLED) != 0;
+	const bool bIsCurrentlyTracking = (pose_frame->flags & COMPACT_POSE_FLAG_IS_CURRENTLY_TRACKING) != 0;
+	const bool bIsPositionValid = (pose_frame->flags & COMPACT_POSE_FLAG_IS_POSITION_VALID) != 0;
+
+	PSMPosef pose;
+	pose.Orientation.w= pose_frame->orientation[0];
+	pose.Orientation.x= pose_frame->orientation[1];
+	pose.Orientation.y= pose_frame->orientation[2];
+	pose.Orientation.z= pose_frame->orientation[3];
+	pose.Position.x= pose_frame->position_cm[0];
+	pose.Position.y= pose_frame->position_cm[1];
+	pose.Position.z= pose_frame->position_cm[2];
+
+	// Only the linear velocity makes it into the compact frame
+	PSMPhysicsData physics_data;
+	memset(&physics_data, 0, sizeof(PSMPhysicsData));
+	physics_data.LinearVelocityCmPerSec.x = pose_frame->velocity_cm_per_sec[0];
+	physics_data.LinearVelocityCmPerSec.y = pose_frame->velocity_cm_per_sec[1];
+	physics_data.LinearVelocityCmPerSec.z = pose_frame->velocity_cm_per_sec[2];
+	physics_data.TimeInSeconds= -1.0;
+
+    switch (hmd->HmdType) 
+	{
+        case PSMHmd_Morpheus:
+			{
+				PSMMorpheus *morpheus= &hmd->HmdState.MorpheusState;
+
+				morpheus->bIsTrackingEnabled = bIsTrackingEnabled;
+				morpheus->bIsCurrentlyTracking = bIsCurrentlyTracking;
+				morpheus->bIsOrientationValid = (pose_frame->flags & COMPACT_POSE_FLAG_IS_ORIENTATION_VALID) != 0;
+				morpheus->bIsPositionValid = bIsPositionValid;
+				morpheus->Pose = pose;
+				morpheus->PhysicsData = physics_data;
+
+				memset(&morpheus->RawSensorData, 0, sizeof(PSMMorpheusRawSensorData));
+				memset(&morpheus->CalibratedSensorData, 0, sizeof(PSMMorpheusCalibratedSensorData));
+				memset(&morpheus->RawTrackerData, 0, sizeof(PSMRawTrackerData));
+			} break;
+        case PSMHmd_Virtual:
+			{
+				PSMVirtualHMD *virtualHMD= &hmd->HmdState.VirtualHMDState;
+
+				virtualHMD->bIsTrackingEnabled = bIsTrackingEnabled;
+				virtualHMD->bIsCurrentlyTracking = bIsCurrentlyTracking;
+				virtualHMD->bIsPositionValid = bIsPositionValid;
+				virtualHMD->Pose = pose;
+				virtualHMD->PhysicsData = physics_data;
+
+				memset(&virtualHMD->RawTrackerData, 0, sizeof(PSMRawTrackerData));
+			} break;
+        default:
+            break;
+    }
+}
+
+static void updateHmdDataFrameStatistics(PSMHeadMountedDisplay *hmd)
+{
+    long long now = 
+        std::chrono::duration_cast< std::chrono::milliseconds >(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    long long diff= now - hmd->DataFrameLastReceivedTime;
+
+    if (diff > 0)
+    {
+        float seconds= static_cast<float>(diff) / 1000.f;
+        float fps= 1.f / seconds;
+
+        hmd->DataFrameAverageFPS= (0.9f)*hmd->DataFrameAverageFPS + (0.1f)*fps;
+    }
+
+    hmd->DataFrameLastReceivedTime= now;
+}
+
 static void applyMorpheusDataFrame(
 	const PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket& hmd_packet,
 	PSMMorpheus *morpheus)
@@ -2001,7 +3881,15 @@ static void applyMorpheusDataFrame(
 			{positionOnTrackerCm.x(), positionOnTrackerCm.y(), positionOnTrackerCm.z()};
         morpheus->RawTrackerData.ValidTrackerBitmask = raw_tracker_data.valid_tracker_bitmask();
 
-		if (raw_tracker_data.has_projected_point_cloud())
+		if (raw_tracker_data.packed_projected_point_cloud_size() > 0)
+		{
+			PSMTrackingProjection &projection = morpheus->RawTrackerData.TrackingProjection;
+
+			projection.shape.pointcloud.point_count =
+				packed_tracker_data_read_points(raw_tracker_data.packed_projected_point_cloud(), projection.shape.pointcloud.points, 7);
+			projection.shape_type = PSMTrackingProjection::PSMShape_PointCloud;
+		}
+		else if (raw_tracker_data.has_projected_point_cloud())
 		{
 			const PSMoveProtocol::Polygon &protocolPointCloud = raw_tracker_data.projected_point_cloud();
 			PSMTrackingProjection &projection = morpheus->RawTrackerData.TrackingProjection;
@@ -2022,6 +3910,8 @@ static void applyMorpheusDataFrame(
 
 			projection.shape_type = PSMTrackingProjection::PSMShape_INVALID_PROJECTION;
 		}
+
+		applyTrackerSamples(raw_tracker_data, morpheus->RawTrackerData);
 	}
 	else
 	{
@@ -2104,6 +3994,8 @@ static void applyVirtualHMDDataFrame(
 
 			projection.shape_type = PSMTrackingProjection::PSMShape_INVALID_PROJECTION;
 		}
+
+		applyTrackerSamples(raw_tracker_data, virtualHMD->RawTrackerData);
 	}
 	else
 	{
@@ -2136,11 +4028,304 @@ static void applyVirtualHMDDataFrame(
 	}
 }
 
+static void mergeNetworkControllerView(
+	const PSMController &network_controller,
+	PSMController *controller)
+{
+	// The shared memory poses may already have delivered a newer frame
+	if (network_controller.OutputSequenceNum <= controller->OutputSequenceNum)
+		return;
+
+	PSMController merged_controller= network_controller;
+
+	// Keep everything the client owns rather than the service
+	merged_controller.ControllerID= controller->ControllerID;
+	merged_controller.ControllerHand= controller->ControllerHand;
+	merged_controller.InputSequenceNum= controller->InputSequenceNum;
+	merged_controller.ListenerCount= controller->ListenerCount;
+
+	if (merged_controller.ControllerType == controller->ControllerType)
+	{
+		switch (merged_controller.ControllerType)
+		{
+		case PSMController_Move:
+			{
+				const PSMPSMove &client_state= controller->ControllerState.PSMoveState;
+				PSMPSMove &merged_state= merged_controller.ControllerState.PSMoveState;
+
+				merged_state.bHasUnpublishedState= client_state.bHasUnpublishedState;
+				merged_state.Rumble= client_state.Rumble;
+				merged_state.LED_r= client_state.LED_r;
+				merged_state.LED_g= client_state.LED_g;
+				merged_state.LED_b= client_state.LED_b;
+				merged_state.ResetPoseButtonPressTime= client_state.ResetPoseButtonPressTime;
+				merged_state.bResetPoseRequestSent= client_state.bResetPoseRequestSent;
+				merged_state.bPoseResetButtonEnabled= client_state.bPoseResetButtonEnabled;
+			} break;
+		case PSMController_DualShock4:
+			{
+				const PSMDualShock4 &client_state= controller->ControllerState.PSDS4State;
+				PSMDualShock4 &merged_state= merged_controller.ControllerState.PSDS4State;
+
+				merged_state.bHasUnpublishedState= client_state.bHasUnpublishedState;
+				merged_state.BigRumble= client_state.BigRumble;
+				merged_state.SmallRumble= client_state.SmallRumble;
+				merged_state.LED_r= client_state.LED_r;
+				merged_state.LED_g= client_state.LED_g;
+				merged_state.LED_b= client_state.LED_b;
+				merged_state.ResetPoseButtonPressTime= client_state.ResetPoseButtonPressTime;
+				merged_state.bResetPoseRequestSent= client_state.bResetPoseRequestSent;
+				merged_state.bPoseResetButtonEnabled= client_state.bPoseResetButtonEnabled;
+			} break;
+		default:
+			break;
+		}
+	}
+
+	*controller= merged_controller;
+}
+
+static void mergeNetworkTrackerView(
+	const PSMTracker &network_tracker,
+	PSMTracker *tracker)
+{
+	// Tracker data frames only carry the streaming state, the rest comes from the tracker list
+	tracker->is_connected= network_tracker.is_connected;
+	tracker->sequence_num= network_tracker.sequence_num;
+	tracker->data_frame_last_received_time= network_tracker.data_frame_last_received_time;
+	tracker->data_frame_service_time= network_tracker.data_frame_service_time;
+	tracker->data_frame_average_fps= network_tracker.data_frame_average_fps;
+	tracker->dropped_frame_count= network_tracker.dropped_frame_count;
+}
+
+static void mergeNetworkHMDView(
+	const PSMHeadMountedDisplay &network_hmd,
+	PSMHeadMountedDisplay *hmd)
+{
+	// The shared memory poses may already have delivered a newer frame
+	if (network_hmd.OutputSequenceNum <= hmd->OutputSequenceNum)
+		return;
+
+	const PSMHmdID hmd_id= hmd->HmdID;
+	const int listener_count= hmd->ListenerCount;
+
+	*hmd= network_hmd;
+	hmd->HmdID= hmd_id;
+	hmd->ListenerCount= listener_count;
+}
+
 // INotificationListener
+static void fillControllerStateRecord(
+	const PSMController &controller,
+	PSMDeviceStateRecord *record)
+{
+	memset(record, 0, sizeof(PSMDeviceStateRecord));
+	record->DeviceCategory= PSMDeviceCategory_Controller;
+	record->DeviceID= controller.ControllerID;
+	record->DeviceType= controller.ControllerType;
+	record->OutputSequenceNum= controller.OutputSequenceNum;
+	record->DataFrameServiceTime= controller.DataFrameServiceTime;
+	record->Pose.Orientation= *k_psm_quaternion_identity;
+	record->BatteryValue= PSMBattery_Charged;
+
+	if (!controller.bValid || !controller.IsConnected)
+		return;
+
+	record->Flags|= PSMDeviceStateFlags_isConnected;
+
+	int bit_index= 0;
+	switch (controller.ControllerType)
+	{
+	case PSMController_Move:
+		{
+			const PSMPSMove &psmove= controller.ControllerState.PSMoveState;
+
+			if (psmove.bIsTrackingEnabled) record->Flags|= PSMDeviceStateFlags_isTrackingEnabled;
+			if (psmove.bIsCurrentlyTracking) record->Flags|= PSMDeviceStateFlags_isCurrentlyTracking;
+			if (psmove.bIsOrientationValid) record->Flags|= PSMDeviceStateFlags_isOrientationValid;
+			if (psmove.bIsPositionValid) record->Flags|= PSMDeviceStateFlags_isPositionValid;
+
+			record->Pose= psmove.Pose;
+			record->LinearVelocityCmPerSec= psmove.PhysicsData.LinearVelocityCmPerSec;
+			record->AngularVelocityRadPerSec= psmove.PhysicsData.AngularVelocityRadPerSec;
+
+			appendButtonDownBit(psmove.TriangleButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psmove.CircleButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psmove.CrossButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psmove.SquareButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psmove.SelectButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psmove.StartButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psmove.PSButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psmove.MoveButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psmove.TriggerButton, bit_index, record->ButtonDownBitmask);
+
+			record->TriggerValue= static_cast<float>(psmove.TriggerValue) / 255.f;
+			record->RumbleFraction= static_cast<float>(psmove.Rumble) / 255.f;
+			record->BatteryValue= psmove.BatteryValue;
+		} break;
+	case PSMController_Navi:
+		{
+			const PSMPSNavi &psnavi= controller.ControllerState.PSNaviState;
+
+			appendButtonDownBit(psnavi.L1Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.L2Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.L3Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.CircleButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.CrossButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.PSButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.TriggerButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.DPadUpButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.DPadRightButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.DPadDownButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(psnavi.DPadLeftButton, bit_index, record->ButtonDownBitmask);
+
+			record->TriggerValue= static_cast<float>(psnavi.TriggerValue) / 255.f;
+		} break;
+	case PSMController_DualShock4:
+		{
+			const PSMDualShock4 &ds4= controller.ControllerState.PSDS4State;
+
+			if (ds4.bIsTrackingEnabled) record->Flags|= PSMDeviceStateFlags_isTrackingEnabled;
+			if (ds4.bIsCurrentlyTracking) record->Flags|= PSMDeviceStateFlags_isCurrentlyTracking;
+			if (ds4.bIsOrientationValid) record->Flags|= PSMDeviceStateFlags_isOrientationValid;
+			if (ds4.bIsPositionValid) record->Flags|= PSMDeviceStateFlags_isPositionValid;
+
+			record->Pose= ds4.Pose;
+			record->LinearVelocityCmPerSec= ds4.PhysicsData.LinearVelocityCmPerSec;
+			record->AngularVelocityRadPerSec= ds4.PhysicsData.AngularVelocityRadPerSec;
+
+			appendButtonDownBit(ds4.DPadUpButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.DPadDownButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.DPadLeftButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.DPadRightButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.SquareButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.CrossButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.CircleButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.TriangleButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.L1Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.R1Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.L2Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.R2Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.L3Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.R3Button, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.ShareButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.OptionsButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.PSButton, bit_index, record->ButtonDownBitmask);
+			appendButtonDownBit(ds4.TrackPadButton, bit_index, record->ButtonDownBitmask);
+
+			record->TriggerValue= ds4.RightTriggerValue;
+			record->RumbleFraction= static_cast<float>(std::max(ds4.BigRumble, ds4.SmallRumble)) / 255.f;
+		} break;
+	case PSMController_Virtual:
+		{
+			const PSMVirtualController &virtual_controller= controller.ControllerState.VirtualController;
+
+			if (virtual_controller.bIsTrackingEnabled) record->Flags|= PSMDeviceStateFlags_isTrackingEnabled;
+			if (virtual_controller.bIsCurrentlyTracking) record->Flags|= PSMDeviceStateFlags_isCurrentlyTracking;
+			if (virtual_controller.bIsPositionValid) record->Flags|= PSMDeviceStateFlags_isPositionValid;
+
+			record->Pose= virtual_controller.Pose;
+			record->LinearVelocityCmPerSec= virtual_controller.PhysicsData.LinearVelocityCmPerSec;
+			record->AngularVelocityRadPerSec= virtual_controller.PhysicsData.AngularVelocityRadPerSec;
+
+			for (int button_index= 0; button_index < virtual_controller.numButtons && button_index < PSM_MAX_VIRTUAL_CONTROLLER_BUTTONS; ++button_index)
+			{
+				appendButtonDownBit(virtual_controller.buttonStates[button_index], bit_index, record->ButtonDownBitmask);
+			}
+		} break;
+	default:
+		break;
+	}
+}
+
+static void fillHmdStateRecord(
+	const PSMHeadMountedDisplay &hmd,
+	PSMDeviceStateRecord *record)
+{
+	memset(record, 0, sizeof(PSMDeviceStateRecord));
+	record->DeviceCategory= PSMDeviceCategory_HMD;
+	record->DeviceID= hmd.HmdID;
+	record->DeviceType= hmd.HmdType;
+	record->OutputSequenceNum= hmd.OutputSequenceNum;
+	record->DataFrameServiceTime= hmd.DataFrameServiceTime;
+	record->Pose.Orientation= *k_psm_quaternion_identity;
+	record->BatteryValue= PSMBattery_Charged;
+
+	if (!hmd.bValid || !hmd.IsConnected)
+		return;
+
+	record->Flags|= PSMDeviceStateFlags_isConnected;
+
+	switch (hmd.HmdType)
+	{
+	case PSMHmd_Morpheus:
+		{
+			const PSMMorpheus &morpheus= hmd.HmdState.MorpheusState;
+
+			if (morpheus.bIsTrackingEnabled) record->Flags|= PSMDeviceStateFlags_isTrackingEnabled;
+			if (morpheus.bIsCurrentlyTracking) record->Flags|= PSMDeviceStateFlags_isCurrentlyTracking;
+			if (morpheus.bIsOrientationValid) record->Flags|= PSMDeviceStateFlags_isOrientationValid;
+			if (morpheus.bIsPositionValid) record->Flags|= PSMDeviceStateFlags_isPositionValid;
+
+			record->Pose= morpheus.Pose;
+			record->LinearVelocityCmPerSec= morpheus.PhysicsData.LinearVelocityCmPerSec;
+			record->AngularVelocityRadPerSec= morpheus.PhysicsData.AngularVelocityRadPerSec;
+		} break;
+	case PSMHmd_Virtual:
+		{
+			const PSMVirtualHMD &virtual_hmd= hmd.HmdState.VirtualHMDState;
+
+			if (virtual_hmd.bIsTrackingEnabled) record->Flags|= PSMDeviceStateFlags_isTrackingEnabled;
+			if (virtual_hmd.bIsCurrentlyTracking) record->Flags|= PSMDeviceStateFlags_isCurrentlyTracking;
+			if (virtual_hmd.bIsPositionValid) record->Flags|= PSMDeviceStateFlags_isPositionValid;
+
+			record->Pose= virtual_hmd.Pose;
+			record->LinearVelocityCmPerSec= virtual_hmd.PhysicsData.LinearVelocityCmPerSec;
+			record->AngularVelocityRadPerSec= virtual_hmd.PhysicsData.AngularVelocityRadPerSec;
+		} break;
+	default:
+		break;
+	}
+}
+
+static void appendButtonDownBit(
+	PSMButtonState button,
+	int &bit_index,
+	unsigned int &bitmask)
+{
+	// Both PRESSED and DOWN have the low bit set
+	if (bit_index < 32 && (button & PSMButtonState_PRESSED) != 0)
+	{
+		bitmask|= (1u << bit_index);
+	}
+
+	++bit_index;
+}
+
 void PSMoveClient::handle_notification(ResponsePtr notification)
 {
     assert(notification->request_id() == -1);
 
+    // Network video frames just replace the tracker's previous one rather than queueing up as events
+    if (notification->type() == PSMoveProtocol::Response_ResponseType_TRACKER_VIDEO_FRAME)
+    {
+        const PSMTrackerID tracker_id= notification->result_tracker_video_frame().tracker_id();
+
+        if (IS_VALID_TRACKER_INDEX(tracker_id))
+        {
+            ResponsePtr &video_frame= m_tracker_network_video_frames[tracker_id];
+
+            // The notification is the network manager's shared packed response, so it has to be copied
+            if (!video_frame)
+            {
+                video_frame= ResponsePtr(new PSMoveProtocol::Response());
+            }
+            video_frame->CopyFrom(*notification.get());
+        }
+
+        return;
+    }
+
     PSMEventMessage::eEventType specificEventType= PSMEventMessage::PSMEvent_opaqueServiceEvent;
 
     // See if we can translate this to an event type a client without protocol access can see
@@ -2168,6 +4353,23 @@ void PSMoveClient::handle_server_connection_opened()
 {
     CLIENT_LOG_INFO("handle_server_connection_opened") << "Connected to service" << std::endl;
 
+	// The service creates the shared pose state at startup, so it should be there by now.
+	// If it isn't (remote service or disabled in the config) all poses keep coming in as data frames.
+	if ((m_init_flags & PSMInitFlags_useSharedMemoryPoses) != 0 && m_shared_pose_accessor == nullptr)
+	{
+		m_shared_pose_accessor= new SharedPoseStateReadOnlyAccessor();
+
+		if (!m_shared_pose_accessor->initialize())
+		{
+			delete m_shared_pose_accessor;
+			m_shared_pose_accessor= nullptr;
+		}
+	}
+
+	// Start measuring the clock offset as soon as the TCP channel is up
+	m_clock_sync->reset();
+	m_bIsClockSyncActive= true;
+
     enqueue_event_message(PSMEventMessage::PSMEvent_connectedToService, ResponsePtr());
 }
 
@@ -2182,6 +4384,15 @@ void PSMoveClient::handle_server_connection_closed()
 {
     CLIENT_LOG_INFO("handle_server_connection_closed") << "Disconnected from service" << std::endl;
 
+	if (m_shared_pose_accessor != nullptr)
+	{
+		delete m_shared_pose_accessor;
+		m_shared_pose_accessor= nullptr;
+	}
+
+	m_bIsClockSyncActive= false;
+	m_clock_sync->reset();
+
     enqueue_event_message(PSMEventMessage::PSMEvent_disconnectedFromService, ResponsePtr());
 }
 
@@ -2269,19 +4480,17 @@ void PSMoveClient::enqueue_event_message(
     message.payload_type = PSMMessage::_messagePayloadType_Event;
     message.event_data.event_type= event_type;
 
-    // Maintain a reference to the event until the next update
+    // Maintain a copy of the event until the next update
     if (event)
     {
-        // Create a smart pointer to a new copy of the event.
-        // If we just add the given event smart pointer to the reference cache
+        // Copy the event into the pool.
+        // If we just kept the given event smart pointer around
         // we'll be storing a reference to the shared m_packed_response on the client network manager
         // which gets constantly overwritten with new incoming events.
-        ResponsePtr eventCopy(new PSMoveProtocol::Response(*event.get()));
+        const PSMoveProtocol::Response *eventCopy= m_event_pool.acquire_copy(*event.get());
 
         //NOTE: This pointer is only safe until the next update call to update is made
-        message.event_data.event_data_handle = static_cast<const void *>(eventCopy.get());
-
-        m_event_reference_cache.push_back(eventCopy);
+        message.event_data.event_data_handle = static_cast<const void *>(eventCopy);
     }
     else
     {
@@ -2303,13 +4512,13 @@ bool PSMoveClient::register_callback(
     {
         PendingRequest pendingRequest;
 
-        assert(m_pending_request_map.find(request_id) == m_pending_request_map.end());
+        assert(find_pending_request(request_id) == m_pending_requests.end());
         memset(&pendingRequest, 0, sizeof(PendingRequest));
         pendingRequest.request_id = request_id;
         pendingRequest.response_callback = callback;
         pendingRequest.response_userdata = callback_userdata;
 
-        m_pending_request_map.insert(t_pending_request_map_entry(request_id, pendingRequest));
+        m_pending_requests.push_back(pendingRequest);
         bSuccess = true;
     }
 
@@ -2324,11 +4533,14 @@ bool PSMoveClient::execute_callback(
 
     if (request_id != PSM_INVALID_REQUEST_ID)
     {
-        t_pending_request_map::iterator iter = m_pending_request_map.find(request_id);
+        t_pending_request_list::iterator iter = find_pending_request(request_id);
 
-        if (iter != m_pending_request_map.end())
+        if (iter != m_pending_requests.end())
         {
-            const PendingRequest &pendingRequest = iter->second;
+            // Copy the entry out, the callback is free to register new requests
+            const PendingRequest pendingRequest = *iter;
+
+            m_pending_requests.erase(iter);
 
             if (pendingRequest.response_callback != nullptr)
             {
@@ -2338,8 +4550,6 @@ bool PSMoveClient::execute_callback(
 
                 bExecutedCallback = true;
             }
-
-            m_pending_request_map.erase(iter);
         }
     }
 
@@ -2365,11 +4575,13 @@ bool PSMoveClient::cancel_callback(PSMRequestID request_id)
 
     if (request_id != PSM_INVALID_REQUEST_ID)
     {
-        t_pending_request_map::iterator iter= m_pending_request_map.find(request_id);
+        t_pending_request_list::iterator iter= find_pending_request(request_id);
 
-        if (iter != m_pending_request_map.end())
+        if (iter != m_pending_requests.end())
         {
-            const PendingRequest &pendingRequest = iter->second;
+            const PendingRequest pendingRequest = *iter;
+
+            m_pending_requests.erase(iter);
                 
             // Notify the response callback that the request was canceled
             if (pendingRequest.response_callback != nullptr)
@@ -2381,10 +4593,16 @@ bool PSMoveClient::cancel_callback(PSMRequestID request_id)
                 response.payload_type= PSMResponseMessage::_responsePayloadType_HmdList;
                 pendingRequest.response_callback(&response, pendingRequest.response_userdata);
             }
-            m_pending_request_map.erase(iter);
             bSuccess = true;
         }
     }
 
     return bSuccess;
 }
+
+PSMoveClient::t_pending_request_list::iterator PSMoveClient::find_pending_request(PSMRequestID request_id)
+{
+    return std::find_if(
+        m_pending_requests.begin(), m_pending_requests.end(),
+        [request_id](const PendingRequest &pendingRequest) { return pendingRequest.request_id == request_id; });
+}
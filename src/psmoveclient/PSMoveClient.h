@@ -6,13 +6,13 @@
 #include "PSMoveProtocolInterface.h"
 #include "ClientNetworkInterface.h"
 #include "ClientLog.h"
-#include <deque>
-#include <map>
+#include "ClientMessageQueue.h"
+#include <mutex>
 #include <vector>
 
 //-- typedefs -----
-typedef std::deque<PSMMessage> t_message_queue;
-typedef std::vector<ResponsePtr> t_event_reference_cache;
+typedef ClientMessageQueue<PSMMessage> t_message_queue;
+typedef ClientProtocolMessagePool<PSMoveProtocol::Response> t_event_pool;
 
 //-- definitions -----
 class PSMoveClient : 
@@ -35,26 +35,31 @@ public:
 	bool pollWasSystemButtonPressed();
 
     // -- ClientPSMoveAPI System -----
-    bool startup(e_log_severity_level log_level);
+    bool startup(e_log_severity_level log_level, unsigned int init_flags);
     void update();
+	bool wait_for_device_data(int timeout_ms);
 	void process_messages();
     bool poll_next_message(PSMMessage *message, size_t message_size);
     void shutdown();
 
 	// -- System Requests ----
     PSMRequestID get_service_version();
+    PSMRequestID get_connection_handshake();
 
     // -- ClientPSMoveAPI Requests -----
     bool allocate_controller_listener(PSMControllerID controller_id);
     void free_controller_listener(PSMControllerID controller_id);   
     PSMController* get_controller_view(PSMControllerID controller_id);
     PSMRequestID get_controller_list();
-    PSMRequestID start_controller_data_stream(PSMControllerID controller_id, unsigned int flags);
+    PSMRequestID start_controller_data_stream(PSMControllerID controller_id, unsigned int flags, float max_update_rate_hz, float fixed_output_rate_hz);
     PSMRequestID stop_controller_data_stream(PSMControllerID controller_id);
     PSMRequestID set_led_tracking_color(PSMControllerID controller_id, PSMTrackingColorType tracking_color);
     PSMRequestID reset_orientation(PSMControllerID controller_id, const PSMQuatf& q_pose);
     PSMRequestID set_controller_data_stream_tracker_index(PSMControllerID controller_id, PSMTrackerID tracker_id);
 	PSMRequestID set_controller_hand(PSMControllerID controller_id, PSMControllerHand controller_hand);
+    PSMRequestID set_controller_data_stream_prediction_target(PSMControllerID controller_id, long long display_time_us, int display_interval_us);
+    // Returns true if the controller had unpublished LED/rumble state to send
+    bool publish_controller_output(PSMControllerID controller_id);
 
     bool allocate_tracker_listener(const PSMClientTrackerInfo &trackerInfo);
     void free_tracker_listener(PSMTrackerID tracker_id);
@@ -63,10 +68,17 @@ public:
     PSMRequestID get_tracker_list();
     PSMRequestID start_tracker_data_stream(PSMTrackerID tracker_id);
     PSMRequestID stop_tracker_data_stream(PSMTrackerID tracker_id);
+    PSMRequestID start_tracker_network_video_stream(PSMTrackerID tracker_id, const PSMTrackerNetworkVideoSettings &settings);
+    PSMRequestID start_tracker_data_stream_with_preview(PSMTrackerID tracker_id, const PSMTrackerVideoPreviewSettings &settings);
+	bool get_network_video_frame(PSMTrackerID tracker_id, PSMTrackerNetworkVideoFrame &out_frame) const;
 	bool open_video_stream(PSMTrackerID tracker_id);
 	bool poll_video_stream(PSMTrackerID tracker_id);
+	bool poll_video_stream_into_buffer(PSMTrackerID tracker_id, unsigned char *buffer, size_t buffer_size);
 	void close_video_stream(PSMTrackerID tracker_id);
+	bool acquire_video_frame(PSMTrackerID tracker_id, PSMTrackerVideoFrame &out_frame);
+	bool release_video_frame(PSMTrackerID tracker_id);
 	const unsigned char *get_video_frame_buffer(PSMTrackerID tracker_id) const;
+	bool get_video_frame_size(PSMTrackerID tracker_id, int &out_width, int &out_height, int &out_stride) const;
 
     bool allocate_hmd_listener(PSMHmdID HmdID);
     void free_hmd_listener(PSMHmdID HmdID);   
@@ -75,18 +87,47 @@ public:
     PSMRequestID start_hmd_data_stream(PSMHmdID hmd_id, unsigned int flags);
     PSMRequestID stop_hmd_data_stream(PSMHmdID hmd_id);
     PSMRequestID set_hmd_data_stream_tracker_index(PSMHmdID hmd_id, PSMTrackerID tracker_id);
+    PSMRequestID set_hmd_data_stream_prediction_target(PSMHmdID hmd_id, long long display_time_us, int display_interval_us);
+
+    // Client clock that prediction target display times are measured against
+    static long long get_client_time_microseconds();
+    // Best estimate of (service time - client time), false until the first clock sync round trip
+    bool get_clock_sync_estimate(long long &out_clock_offset_us, int &out_round_trip_time_us) const;
+
+    // Pose at the given client time, from the history of poses streamed for the device
+    bool get_controller_pose_at_time(PSMControllerID controller_id, long long time_us, PSMPosef &out_pose);
+    bool get_hmd_pose_at_time(PSMHmdID hmd_id, long long time_us, PSMPosef &out_pose);
+
+    // Compact records of every allocated device, as of the last update
+    bool get_device_state_snapshot(PSMDeviceStateRecord *out_records, int max_record_count, int &out_record_count) const;
     
     PSMRequestID send_opaque_request(PSMRequestHandle request_handle);
 
     // -- Callback API --
     bool register_callback(PSMRequestID request_id, PSMResponseCallback callback, void *callback_userdata);
     bool cancel_callback(PSMRequestID request_id);
+    // A null callback clears the device's callback
+    void set_controller_data_callback(PSMControllerID controller_id, PSMDeviceDataCallback callback, void *callback_userdata);
+    void set_hmd_data_callback(PSMHmdID hmd_id, PSMDeviceDataCallback callback, void *callback_userdata);
     
 protected:
     void publish();
+    void poll_shared_memory_poses();
+    void poll_network_thread_state();
+    void fetch_network_thread_controller_state(PSMControllerID controller_id);
+    void fetch_network_thread_tracker_state(PSMTrackerID tracker_id);
+    void fetch_network_thread_hmd_state(PSMHmdID hmd_id);
+    void send_clock_sync_ping_if_needed();
+    void record_controller_pose_sample(PSMControllerID controller_id);
+    void record_hmd_pose_sample(PSMHmdID hmd_id);
+    long long get_pose_sample_time_us(long long service_time_us) const;
+    void notify_controller_data_callback(const PSMController &controller);
+    void notify_hmd_data_callback(const PSMHeadMountedDisplay &hmd);
 
     // IDataFrameListener
     virtual void handle_data_frame(const PSMoveProtocol::DeviceOutputDataFrame *data_frame) override;
+    virtual void handle_compact_pose_frame(const CompactControllerPoseFrame *pose_frame) override;
+    virtual void handle_compact_orientation_frame(const CompactControllerOrientationFrame *orientation_frame) override;
 
     // INotificationListener
     virtual void handle_notification(ResponsePtr notification) override;
@@ -100,6 +141,7 @@ protected:
 
     // Request Manager Callback
     static void handle_response_message(const PSMResponseMessage *response_message, void *userdata);
+    static void handle_clock_sync_pong(const PSMResponseMessage *response_message, void *userdata);
 
     // Message Helpers
     //-----------------
@@ -120,10 +162,45 @@ private:
 
     //-- Tracker Views -----
 	PSMTracker m_trackers[PSMOVESERVICE_MAX_TRACKER_COUNT];
+	// Copy of the latest TRACKER_VIDEO_FRAME notification of each tracker streaming network video
+	ResponsePtr m_tracker_network_video_frames[PSMOVESERVICE_MAX_TRACKER_COUNT];
     
     //-- HMD Views -----
 	PSMHeadMountedDisplay m_HMDs[PSMOVESERVICE_MAX_HMD_COUNT];
 
+    //-- Shared Memory Poses -----
+	unsigned int m_init_flags;
+	class SharedPoseStateReadOnlyAccessor *m_shared_pose_accessor;
+	// Set for devices streaming nothing the shared memory pose frames can't stand in for
+	bool m_bControllerUsesSharedPose[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+	bool m_bHMDUsesSharedPose[PSMOVESERVICE_MAX_HMD_COUNT];
+	// Set for devices with a display time prediction target, which the shared (configured prediction) poses ignore
+	bool m_bControllerHasPredictionTarget[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+	bool m_bHMDHasPredictionTarget[PSMOVESERVICE_MAX_HMD_COUNT];
+
+    //-- Network Thread -----
+	// Device state decoded on the network thread, only allocated with PSMInitFlags_useNetworkThread
+	class NetworkThreadDeviceState *m_network_thread_state;
+
+    //-- Device Data Callbacks -----
+    struct DeviceDataCallback
+    {
+        PSMDeviceDataCallback callback;
+        void *callback_userdata;
+    };
+	// Held while a callback runs, so that once a set_*_data_callback() returns the old callback won't be called again
+	std::mutex m_device_data_callback_mutex;
+	DeviceDataCallback m_controller_data_callbacks[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+	DeviceDataCallback m_hmd_data_callbacks[PSMOVESERVICE_MAX_HMD_COUNT];
+
+    //-- Clock Sync -----
+	class ClientClockSync *m_clock_sync;
+	bool m_bIsClockSyncActive;
+
+    //-- Pose History -----
+	class ClientPoseHistory *m_controller_pose_histories;
+	class ClientPoseHistory *m_hmd_pose_histories;
+
 	bool m_bIsConnected;
 	bool m_bHasConnectionStatusChanged;
 	bool m_bHasControllerListChanged;
@@ -137,20 +214,21 @@ private:
         PSMResponseCallback response_callback;
         void *response_userdata;
     };
-    typedef std::map<PSMRequestID, PendingRequest> t_pending_request_map;
-    typedef std::pair<PSMRequestID, PendingRequest> t_pending_request_map_entry;
+    // Only a handful of requests are ever in flight, so a flat (pre-reserved) list beats a map
+    typedef std::vector<PendingRequest> t_pending_request_list;
+
+    t_pending_request_list m_pending_requests;
 
-    t_pending_request_map m_pending_request_map;
+    t_pending_request_list::iterator find_pending_request(PSMRequestID request_id);
 
     //-- Messages -----
     // Queue of message received from the most recent call to update()
     // This queue will be emptied automatically at the next call to update().
     t_message_queue m_message_queue;
 
-    // These vectors are used solely to keep the ref counted pointers to the 
-    // response and event parameter data valid until the next update call.
-    // The message queue contains raw void pointers to the response and event data.
-    t_event_reference_cache m_event_reference_cache;
+    // Copies of the event parameter data, kept valid until the next update call
+    // since the message queue contains raw void pointers to them.
+    t_event_pool m_event_pool;
 };
 
 
@@ -143,6 +143,43 @@ bool PSM_HasConnectionStatusChanged()
 	return g_psm_client != nullptr && g_psm_client->pollHasConnectionStatusChanged();
 }
 
+PSMResult PSM_GetClientTimeMicroseconds(long long *out_time_us)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (out_time_us != nullptr)
+    {
+        *out_time_us= PSMoveClient::get_client_time_microseconds();
+        result= PSMResult_Success;
+    }
+
+    return result;
+}
+
+PSMResult PSM_GetClockSyncEstimate(long long *out_clock_offset_us, int *out_round_trip_time_us)
+{
+    PSMResult result= PSMResult_Error;
+    long long clock_offset_us;
+    int round_trip_time_us;
+
+    if (g_psm_client != nullptr && g_psm_client->get_clock_sync_estimate(clock_offset_us, round_trip_time_us))
+    {
+        if (out_clock_offset_us != nullptr)
+        {
+            *out_clock_offset_us= clock_offset_us;
+        }
+
+        if (out_round_trip_time_us != nullptr)
+        {
+            *out_round_trip_time_us= round_trip_time_us;
+        }
+
+        result= PSMResult_Success;
+    }
+
+    return result;
+}
+
 bool PSM_HasControllerListChanged()
 {
 	return g_psm_client != nullptr && g_psm_client->pollHasControllerListChanged();
@@ -164,10 +201,15 @@ bool PSM_WasSystemButtonPressed()
 }
 
 PSMResult PSM_Initialize(const char* host, const char* port, int timeout_ms)
+{
+    return PSM_InitializeWithFlags(host, port, PSMInitFlags_defaultOptions, timeout_ms);
+}
+
+PSMResult PSM_InitializeWithFlags(const char* host, const char* port, unsigned int init_flags, int timeout_ms)
 {
     PSMResult result = PSMResult_Error;
 
-    if (PSM_InitializeAsync(host, port) != PSMResult_Error)
+    if (PSM_InitializeAsyncWithFlags(host, port, init_flags) != PSMResult_Error)
     {
         PSMCallbackTimeout timeout(timeout_ms);
 
@@ -192,6 +234,11 @@ PSMResult PSM_Initialize(const char* host, const char* port, int timeout_ms)
 }
 
 PSMResult PSM_InitializeAsync(const char* host, const char* port)
+{
+	return PSM_InitializeAsyncWithFlags(host, port, PSMInitFlags_defaultOptions);
+}
+
+PSMResult PSM_InitializeAsyncWithFlags(const char* host, const char* port, unsigned int init_flags)
 {
 	PSMResult result= PSMResult_Error;
 
@@ -205,7 +252,7 @@ PSMResult PSM_InitializeAsync(const char* host, const char* port)
 			g_psm_client= new PSMoveClient(s_host, s_port);
 		}
 
-		if (g_psm_client->startup(_log_severity_level_info))
+		if (g_psm_client->startup(_log_severity_level_info, init_flags))
 		{
 			result= PSMResult_RequestSent;
 		}
@@ -264,6 +311,45 @@ PSMResult PSM_GetServiceVersionStringAsync(PSMRequestID *out_request_id)
     return result;
 }
 
+PSMResult PSM_GetConnectionHandshake(PSMConnectionHandshake *out_handshake, int timeout_ms)
+{
+    PSMResult result_code= PSMResult_Error;
+
+    if (g_psm_client != nullptr)
+    {
+	    PSMBlockingRequest request(g_psm_client->get_connection_handshake());
+        result_code= request.send(timeout_ms);
+
+        if (result_code == PSMResult_Success)
+        {
+            assert(request.get_response_payload_type() == PSMResponseMessage::_responsePayloadType_ConnectionHandshake);
+
+            *out_handshake= request.get_response_message().payload.connection_handshake;
+        }
+    }
+
+    return result_code;
+}
+
+PSMResult PSM_GetConnectionHandshakeAsync(PSMRequestID *out_request_id)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr)
+    {
+        PSMRequestID req_id = g_psm_client->get_connection_handshake();
+
+        if (out_request_id != nullptr)
+        {
+            *out_request_id= req_id;
+        }
+
+        result= (req_id != PSM_INVALID_REQUEST_ID) ? PSMResult_RequestSent : PSMResult_Error;
+    }
+
+    return result;
+}
+
 PSMResult PSM_Shutdown()
 {
 	PSMResult result= PSMResult_Error;
@@ -311,6 +397,18 @@ PSMResult PSM_UpdateNoPollMessages()
     return result;
 }
 
+PSMResult PSM_WaitForDeviceData(int timeout_ms)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr)
+    {
+        result= g_psm_client->wait_for_device_data(timeout_ms) ? PSMResult_Success : PSMResult_Timeout;
+    }
+
+    return result;
+}
+
 PSMController *PSM_GetController(PSMControllerID controller_id)
 {
     return (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id)) ? g_psm_client->get_controller_view(controller_id) : nullptr;
@@ -385,7 +483,7 @@ PSMResult PSM_StartControllerDataStreamAsync(PSMControllerID controller_id, unsi
 
     if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id))
     {
-        PSMRequestID req_id = g_psm_client->start_controller_data_stream(controller_id, data_stream_flags);
+        PSMRequestID req_id = g_psm_client->start_controller_data_stream(controller_id, data_stream_flags, 0.f, 0.f);
 
         if (out_request_id != nullptr)
         {
@@ -404,7 +502,71 @@ PSMResult PSM_StartControllerDataStream(PSMControllerID controller_id, unsigned
 
     if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id))
     {
-		PSMBlockingRequest request(g_psm_client->start_controller_data_stream(controller_id, data_stream_flags));
+		PSMBlockingRequest request(g_psm_client->start_controller_data_stream(controller_id, data_stream_flags, 0.f, 0.f));
+		result_code= request.send(timeout_ms);
+    }
+
+    return result_code;
+}
+
+PSMResult PSM_StartControllerDataStreamWithRateAsync(PSMControllerID controller_id, unsigned int data_stream_flags, float max_update_rate_hz, PSMRequestID *out_request_id)
+{
+    PSMResult result_code= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id))
+    {
+        PSMRequestID req_id = g_psm_client->start_controller_data_stream(controller_id, data_stream_flags, max_update_rate_hz, 0.f);
+
+        if (out_request_id != nullptr)
+        {
+            *out_request_id= req_id;
+        }
+
+        result_code= (req_id != PSM_INVALID_REQUEST_ID) ? PSMResult_RequestSent : PSMResult_Error;
+    }
+
+    return result_code;
+}
+
+PSMResult PSM_StartControllerDataStreamWithRate(PSMControllerID controller_id, unsigned int data_stream_flags, float max_update_rate_hz, int timeout_ms)
+{
+    PSMResult result_code= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id))
+    {
+		PSMBlockingRequest request(g_psm_client->start_controller_data_stream(controller_id, data_stream_flags, max_update_rate_hz, 0.f));
+		result_code= request.send(timeout_ms);
+    }
+
+    return result_code;
+}
+
+PSMResult PSM_StartControllerDataStreamAtFixedRateAsync(PSMControllerID controller_id, unsigned int data_stream_flags, float output_rate_hz, PSMRequestID *out_request_id)
+{
+    PSMResult result_code= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id) && output_rate_hz > 0.f)
+    {
+        PSMRequestID req_id = g_psm_client->start_controller_data_stream(controller_id, data_stream_flags, 0.f, output_rate_hz);
+
+        if (out_request_id != nullptr)
+        {
+            *out_request_id= req_id;
+        }
+
+        result_code= (req_id != PSM_INVALID_REQUEST_ID) ? PSMResult_RequestSent : PSMResult_Error;
+    }
+
+    return result_code;
+}
+
+PSMResult PSM_StartControllerDataStreamAtFixedRate(PSMControllerID controller_id, unsigned int data_stream_flags, float output_rate_hz, int timeout_ms)
+{
+    PSMResult result_code= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id) && output_rate_hz > 0.f)
+    {
+		PSMBlockingRequest request(g_psm_client->start_controller_data_stream(controller_id, data_stream_flags, 0.f, output_rate_hz));
 		result_code= request.send(timeout_ms);
     }
 
@@ -519,6 +681,9 @@ PSMResult PSM_SetControllerLEDOverrideColor(PSMControllerID controller_id, unsig
             break;
         }
 
+        // The new color goes out right away rather than with the next PSM_Update()
+        g_psm_client->publish_controller_output(controller_id);
+
         result= PSMResult_Success;
     }
 
@@ -609,6 +774,9 @@ PSMResult PSM_SetControllerRumble(PSMControllerID controller_id, PSMControllerRu
             break;
         }
 
+        // Haptics feel laggy if the rumble waits for the next PSM_Update()
+        g_psm_client->publish_controller_output(controller_id);
+
         result= PSMResult_Success;
     }
 
@@ -730,6 +898,19 @@ PSMResult PSM_GetControllerPose(PSMControllerID controller_id, PSMPosef *out_pos
     return result;
 }
 
+PSMResult PSM_GetControllerPoseAtTime(PSMControllerID controller_id, long long time_us, PSMPosef *out_pose)
+{
+    PSMResult result= PSMResult_Error;
+	assert(out_pose);
+
+    if (g_psm_client != nullptr && g_psm_client->get_controller_pose_at_time(controller_id, time_us, *out_pose))
+    {
+        result= PSMResult_Success;
+    }
+
+    return result;
+}
+
 PSMResult PSM_GetIsControllerStable(PSMControllerID controller_id, bool *out_is_stable)
 {
     PSMResult result= PSMResult_Error;
@@ -885,6 +1066,45 @@ PSMResult PSM_GetControllerPositionOnTracker(PSMControllerID controller_id, PSMT
     return PSMResult_Error;
 }
 
+PSMResult PSM_GetControllerTrackerSample(PSMControllerID controller_id, PSMTrackerID tracker_id, PSMVector2f *outLocation, PSMVector3f *outPosition)
+{
+	assert(outLocation);
+	assert(outPosition);
+
+    if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id) && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        PSMController *controller= g_psm_client->get_controller_view(controller_id);
+		PSMRawTrackerData *trackerData= nullptr;
+        
+        switch (controller->ControllerType)
+        {
+        case PSMController_Move:
+			trackerData= &controller->ControllerState.PSMoveState.RawTrackerData;
+            break;
+        case PSMController_DualShock4:
+			trackerData= &controller->ControllerState.PSDS4State.RawTrackerData;
+            break;
+        case PSMController_Virtual:
+			trackerData= &controller->ControllerState.VirtualController.RawTrackerData;
+            break;
+        }
+
+		if (trackerData != nullptr)
+		{
+			if ((trackerData->TrackerSampleBitmask & (1 << tracker_id)) == 0)
+			{
+				return PSMResult_NoData;
+			}
+
+			*outLocation = trackerData->TrackerScreenLocations[tracker_id];
+			*outPosition = trackerData->TrackerRelativePositionsCm[tracker_id];
+			return PSMResult_Success;
+		}
+	}
+
+    return PSMResult_Error;
+}
+
 PSMResult PSM_GetControllerOrientationOnTracker(PSMControllerID controller_id, PSMTrackerID *outTrackerId, PSMQuatf *outOrientation)
 {
     assert(outTrackerId);
@@ -1037,6 +1257,41 @@ PSMResult PSM_SetControllerDataStreamTrackerIndex(PSMControllerID controller_id,
     return result;
 }
 
+PSMResult PSM_SetControllerDataStreamPredictionTarget(PSMControllerID controller_id, long long display_time_us, int display_interval_us, int timeout_ms)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id))
+    {
+		PSMBlockingRequest request(
+            g_psm_client->set_controller_data_stream_prediction_target(controller_id, display_time_us, display_interval_us));
+
+		result= request.send(timeout_ms);
+    }
+
+    return result;
+}
+
+PSMResult PSM_SetControllerDataStreamPredictionTargetAsync(PSMControllerID controller_id, long long display_time_us, int display_interval_us, PSMRequestID *out_request_id)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id))
+    {
+        PSMRequestID req_id =
+            g_psm_client->set_controller_data_stream_prediction_target(controller_id, display_time_us, display_interval_us);
+
+        if (out_request_id != nullptr)
+        {
+            *out_request_id= req_id;
+        }
+
+        result= (req_id != PSM_INVALID_REQUEST_ID) ? PSMResult_RequestSent : PSMResult_Error;
+    }
+
+    return result;
+}
+
 PSMResult PSM_SetControllerHand(PSMControllerID controller_id, PSMControllerHand hand, int timeout_ms)
 {
     PSMResult result= PSMResult_Error;
@@ -1198,6 +1453,19 @@ PSMResult PSM_PollTrackerVideoStream(PSMTrackerID tracker_id)
     return result;
 }
 
+PSMResult PSM_PollTrackerVideoStreamIntoBuffer(PSMTrackerID tracker_id, unsigned char *out_buffer, size_t buffer_size)
+{
+    PSMResult result= PSMResult_Error;
+	assert(out_buffer != nullptr);
+
+    if (g_psm_client != nullptr && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        result= g_psm_client->poll_video_stream_into_buffer(tracker_id, out_buffer, buffer_size) ? PSMResult_Success : PSMResult_NoData;
+    }
+
+    return result;
+}
+
 PSMResult PSM_CloseTrackerVideoStream(PSMTrackerID tracker_id)
 {
     PSMResult result= PSMResult_Error;
@@ -1211,6 +1479,44 @@ PSMResult PSM_CloseTrackerVideoStream(PSMTrackerID tracker_id)
     return result;
 }
 
+PSMResult PSM_AcquireTrackerVideoFrame(PSMTrackerID tracker_id, PSMTrackerVideoFrame *out_frame)
+{
+    PSMResult result= PSMResult_Error;
+	assert(out_frame != nullptr);
+
+    if (g_psm_client != nullptr && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        result= g_psm_client->acquire_video_frame(tracker_id, *out_frame) ? PSMResult_Success : PSMResult_NoData;
+    }
+
+    return result;
+}
+
+PSMResult PSM_ReleaseTrackerVideoFrame(PSMTrackerID tracker_id)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        result= g_psm_client->release_video_frame(tracker_id) ? PSMResult_Success : PSMResult_NoData;
+    }
+
+    return result;
+}
+
+PSMResult PSM_GetTrackerNetworkVideoFrame(PSMTrackerID tracker_id, PSMTrackerNetworkVideoFrame *out_frame)
+{
+    PSMResult result= PSMResult_Error;
+	assert(out_frame != nullptr);
+
+    if (g_psm_client != nullptr && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        result= g_psm_client->get_network_video_frame(tracker_id, *out_frame) ? PSMResult_Success : PSMResult_NoData;
+    }
+
+    return result;
+}
+
 PSMResult PSM_GetTrackerVideoFrameBuffer(PSMTrackerID tracker_id, const unsigned char **out_buffer)
 {
     PSMResult result= PSMResult_Error;
@@ -1229,6 +1535,21 @@ PSMResult PSM_GetTrackerVideoFrameBuffer(PSMTrackerID tracker_id, const unsigned
     return result;
 }
 
+PSMResult PSM_GetTrackerVideoFrameSize(PSMTrackerID tracker_id, int *out_width, int *out_height, int *out_stride)
+{
+    PSMResult result= PSMResult_Error;
+	assert(out_width != nullptr);
+	assert(out_height != nullptr);
+	assert(out_stride != nullptr);
+
+    if (g_psm_client != nullptr && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        result= g_psm_client->get_video_frame_size(tracker_id, *out_width, *out_height, *out_stride) ? PSMResult_Success : PSMResult_Error;
+    }
+
+    return result;
+}
+
 PSMResult PSM_GetTrackerFrustum(PSMTrackerID tracker_id, PSMFrustum *out_frustum)
 {
     PSMResult result= PSMResult_Error;
@@ -1291,6 +1612,46 @@ PSMResult PSM_StartTrackerDataStreamAsync(PSMTrackerID tracker_id, PSMRequestID
     return result_code;
 }
 
+PSMResult PSM_StartTrackerDataStreamWithPreviewAsync(PSMTrackerID tracker_id, const PSMTrackerVideoPreviewSettings *settings, PSMRequestID *out_request_id)
+{
+    PSMResult result_code= PSMResult_Error;
+	assert(settings != nullptr);
+
+    if (g_psm_client != nullptr && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        PSMRequestID req_id = g_psm_client->start_tracker_data_stream_with_preview(tracker_id, *settings);
+
+        if (out_request_id != nullptr)
+        {
+            *out_request_id= req_id;
+        }
+
+        result_code= (req_id != PSM_INVALID_REQUEST_ID) ? PSMResult_RequestSent : PSMResult_Error;
+    }
+
+    return result_code;
+}
+
+PSMResult PSM_StartTrackerNetworkVideoStreamAsync(PSMTrackerID tracker_id, const PSMTrackerNetworkVideoSettings *settings, PSMRequestID *out_request_id)
+{
+    PSMResult result_code= PSMResult_Error;
+	assert(settings != nullptr);
+
+    if (g_psm_client != nullptr && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        PSMRequestID req_id = g_psm_client->start_tracker_network_video_stream(tracker_id, *settings);
+
+        if (out_request_id != nullptr)
+        {
+            *out_request_id= req_id;
+        }
+
+        result_code= (req_id != PSM_INVALID_REQUEST_ID) ? PSMResult_RequestSent : PSMResult_Error;
+    }
+
+    return result_code;
+}
+
 PSMResult PSM_StopTrackerDataStreamAsync(PSMTrackerID tracker_id, PSMRequestID *out_request_id)
 {
     PSMResult result_code= PSMResult_Error;
@@ -1448,6 +1809,61 @@ PSMResult PSM_GetHmdPose(PSMHmdID hmd_id, PSMPosef *out_pose)
     return result;
 }
 
+PSMResult PSM_GetHmdPoseAtTime(PSMHmdID hmd_id, long long time_us, PSMPosef *out_pose)
+{
+    PSMResult result= PSMResult_Error;
+	assert(out_pose);
+
+    if (g_psm_client != nullptr && g_psm_client->get_hmd_pose_at_time(hmd_id, time_us, *out_pose))
+    {
+        result= PSMResult_Success;
+    }
+
+    return result;
+}
+
+PSMResult PSM_GetDeviceStateSnapshot(PSMDeviceStateRecord *out_records, int max_record_count, int *out_record_count)
+{
+    PSMResult result= PSMResult_Error;
+	assert(out_records);
+	assert(out_record_count);
+
+	*out_record_count= 0;
+
+    if (g_psm_client != nullptr && g_psm_client->get_device_state_snapshot(out_records, max_record_count, *out_record_count))
+    {
+        result= PSMResult_Success;
+    }
+
+    return result;
+}
+
+PSMResult PSM_SetControllerDataCallback(PSMControllerID controller_id, PSMDeviceDataCallback callback, void *callback_userdata)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_CONTROLLER_INDEX(controller_id))
+    {
+        g_psm_client->set_controller_data_callback(controller_id, callback, callback_userdata);
+        result= PSMResult_Success;
+    }
+
+    return result;
+}
+
+PSMResult PSM_SetHmdDataCallback(PSMHmdID hmd_id, PSMDeviceDataCallback callback, void *callback_userdata)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_HMD_INDEX(hmd_id))
+    {
+        g_psm_client->set_hmd_data_callback(hmd_id, callback, callback_userdata);
+        result= PSMResult_Success;
+    }
+
+    return result;
+}
+
 PSMResult PSM_GetIsHmdStable(PSMHmdID hmd_id, bool *out_is_stable)
 {
     PSMResult result= PSMResult_Error;
@@ -1581,6 +1997,44 @@ PSMResult PSM_GetHmdPositionOnTracker(PSMHmdID hmd_id, PSMTrackerID *outTrackerI
     return PSMResult_Error;
 }
 
+PSMResult PSM_GetHmdTrackerSample(PSMHmdID hmd_id, PSMTrackerID tracker_id, PSMVector2f *outLocation, PSMVector3f *outPosition)
+{
+	assert(outLocation);
+	assert(outPosition);
+
+    if (g_psm_client != nullptr && IS_VALID_HMD_INDEX(hmd_id) && IS_VALID_TRACKER_INDEX(tracker_id))
+    {
+        PSMHeadMountedDisplay *hmd= g_psm_client->get_hmd_view(hmd_id);
+		PSMRawTrackerData *trackerData= nullptr;
+        
+        switch (hmd->HmdType)
+        {
+        case PSMHmd_Morpheus:
+            {
+				trackerData= &hmd->HmdState.MorpheusState.RawTrackerData;
+            } break;
+        case PSMHmd_Virtual:
+            {
+				trackerData= &hmd->HmdState.VirtualHMDState.RawTrackerData;
+            } break;
+        }
+
+		if (trackerData != nullptr)
+		{
+			if ((trackerData->TrackerSampleBitmask & (1 << tracker_id)) == 0)
+			{
+				return PSMResult_NoData;
+			}
+
+			*outLocation = trackerData->TrackerScreenLocations[tracker_id];
+			*outPosition = trackerData->TrackerRelativePositionsCm[tracker_id];
+			return PSMResult_Success;
+        }
+	}
+
+    return PSMResult_Error;
+}
+
 PSMResult PSM_GetHmdOrientationOnTracker(PSMHmdID hmd_id, PSMTrackerID *outTrackerId, PSMQuatf *outOrientation)
 {
 	assert(outOrientation);
@@ -1792,6 +2246,41 @@ PSMResult PSM_SetHmdDataStreamTrackerIndexAsync(PSMHmdID hmd_id, PSMTrackerID tr
     return result;
 }
 
+PSMResult PSM_SetHmdDataStreamPredictionTarget(PSMHmdID hmd_id, long long display_time_us, int display_interval_us, int timeout_ms)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_HMD_INDEX(hmd_id))
+    {
+		PSMBlockingRequest request(
+            g_psm_client->set_hmd_data_stream_prediction_target(hmd_id, display_time_us, display_interval_us));
+
+		result= request.send(timeout_ms);
+    }
+
+    return result;
+}
+
+PSMResult PSM_SetHmdDataStreamPredictionTargetAsync(PSMHmdID hmd_id, long long display_time_us, int display_interval_us, PSMRequestID *out_request_id)
+{
+    PSMResult result= PSMResult_Error;
+
+    if (g_psm_client != nullptr && IS_VALID_HMD_INDEX(hmd_id))
+    {
+        PSMRequestID req_id =
+            g_psm_client->set_hmd_data_stream_prediction_target(hmd_id, display_time_us, display_interval_us);
+
+        if (out_request_id != nullptr)
+        {
+            *out_request_id= req_id;
+        }
+
+        result= (req_id != PSM_INVALID_REQUEST_ID) ? PSMResult_RequestSent : PSMResult_Error;
+    }
+
+    return result;
+}
+
 PSMResult PSM_PollNextMessage(PSMMessage *message, size_t message_size)
 {
     // Poll events queued up by the call to g_psm_client->update()
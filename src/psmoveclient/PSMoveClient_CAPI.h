@@ -111,8 +111,20 @@ typedef enum
 	PSMStreamFlags_includeCalibratedSensorData = 0x08,	///< Add calibrated IMU sensor state
     PSMStreamFlags_includeRawTrackerData = 0x10,		///< Add raw optical tracking projection info
 	PSMStreamFlags_disableROI = 0x20,					///< Disable Region-of-Interest tracking optimization
+	PSMStreamFlags_useCompactPoseStream = 0x40,			///< Stream fixed layout pose frames instead of full data frames (PSMove only)
+	PSMStreamFlags_onlySendChanges = 0x80,				///< Skip updates where the pose and buttons haven't changed (1Hz keep-alive)
+	PSMStreamFlags_includeAllTrackerData = 0x100,		///< With includeRawTrackerData, add the location on every tracker, not just the selected one
+	PSMStreamFlags_useDualRateStream = 0x200,			///< Compact pose stream that only resends the position when a tracker saw the controller (PSMove only)
 } PSMControllerDataStreamFlags;
 
+/// Client connection options
+typedef enum
+{
+    PSMInitFlags_defaultOptions = 0x00,					///< Receive all device data over the network
+    PSMInitFlags_useSharedMemoryPoses = 0x01,			///< Read poses from the service's shared memory when running on the same machine
+    PSMInitFlags_useNetworkThread = 0x02,				///< Receive data frames on a background thread instead of in PSM_Update()
+} PSMInitFlags;
+
 /// The possible rumble channels available to the comtrollers
 typedef enum
 {
@@ -219,6 +231,14 @@ typedef struct
     bool                    bMulticamPositionValid;
 	/// Flag if the world space optical orientation is valid
     bool                    bMulticamOrientationValid;
+
+    // Per tracker samples, only filled in by streams with PSMStreamFlags_includeAllTrackerData
+	/// Projected device position on each tracker
+    PSMVector2f             TrackerScreenLocations[PSMOVESERVICE_MAX_TRACKER_COUNT];
+	/// Tracker relative device 3d position on each tracker
+    PSMVector3f             TrackerRelativePositionsCm[PSMOVESERVICE_MAX_TRACKER_COUNT];
+	/// A bitmask of the trackers with a sample
+    unsigned int            TrackerSampleBitmask;
 } PSMRawTrackerData;
 
 /// PSMove Controller State in Controller Pool Entry
@@ -404,6 +424,7 @@ typedef struct
     int             InputSequenceNum;
     bool            IsConnected;
     long long       DataFrameLastReceivedTime;
+    long long       DataFrameServiceTime;   ///< When the service generated the last data frame, see \ref PSM_GetClockSyncEstimate
     float           DataFrameAverageFPS;
     int             ListenerCount;
 } PSMController;
@@ -454,12 +475,73 @@ typedef struct
     bool is_connected;
     int sequence_num;
     long long data_frame_last_received_time;
-    float data_frame_average_fps;
+    long long data_frame_service_time; ///< When the service generated the last data frame, see \ref PSM_GetClockSyncEstimate
+    float data_frame_average_fps; ///< The service only sends tracker data frames on change, plus a heartbeat every second
+    long long dropped_frame_count; ///< Video frames the camera dropped since the tracker opened
 
     // SharedVideoFrameReadOnlyAccessor used by config tool
     void *opaque_shared_memory_accesor;
 } PSMTracker;
 
+/// Encoder settings of a network video stream, see \ref PSM_StartTrackerNetworkVideoStreamAsync
+typedef struct
+{
+    int max_frame_rate; ///< Most frames per second to send, 0 for as many as the connection keeps up with
+    int quality; ///< JPEG quality (1-100), 0 for the service default
+    int max_width; ///< Frames (or ROIs) wider than this get scaled down, 0 to send them at full size
+    // Only send this region of the video frame (in video frame pixels), an empty region sends the whole frame
+    int roi_x;
+    int roi_y;
+    int roi_width;
+    int roi_height;
+} PSMTrackerNetworkVideoSettings;
+
+/// Pixels of the shared memory video frames, see \ref PSMTrackerVideoPreviewSettings
+typedef enum
+{
+    PSMTrackerVideoPixelFormat_BGR,         ///< 3 bytes per pixel
+    PSMTrackerVideoPixelFormat_Gray,        ///< 1 byte per pixel
+    PSMTrackerVideoPixelFormat_OverlayOnly  ///< No video, only the debug overlay
+} PSMTrackerVideoPixelFormat;
+
+/// How the service writes a tracker's shared memory video, see \ref PSM_StartTrackerDataStreamWithPreviewAsync
+typedef struct
+{
+    int scale; ///< 1, 2 or 4: frames get shrunk by this factor in each direction
+    PSMTrackerVideoPixelFormat pixel_format;
+} PSMTrackerVideoPreviewSettings;
+
+/// A shared memory video frame handed out in place, see \ref PSM_AcquireTrackerVideoFrame
+typedef struct
+{
+    const unsigned char *bgr_buffer; ///< width x height pixels of the given pixel_format, rows stride bytes apart, without the debug overlay
+    const unsigned char *overlay_buffer; ///< width x height debug overlay colors, rows width bytes apart: 0 = transparent, 1 = blue, 2 = white, 3 = red
+    int width;
+    int height;
+    int stride;
+    PSMTrackerVideoPixelFormat pixel_format; ///< No bgr_buffer pixels for PSMTrackerVideoPixelFormat_OverlayOnly
+    int frame_index; ///< Counts the frames the service published, gaps are frames nobody read
+    long long timestamp_us; ///< When the service captured the frame (std::chrono::steady_clock)
+} PSMTrackerVideoFrame;
+
+/// The latest frame received from a network video stream, see \ref PSM_GetTrackerNetworkVideoFrame
+typedef struct
+{
+    int frame_index; ///< Counts the frames the service encoded, gaps are frames skipped to keep up
+    long long timestamp_us; ///< When the service captured the frame (std::chrono::steady_clock on the service machine)
+    int frame_width; ///< Size of the whole video frame
+    int frame_height;
+    // The region of the video frame the image shows, in video frame pixels
+    int roi_x;
+    int roi_y;
+    int roi_width;
+    int roi_height;
+    int image_width; ///< Size of the decoded image (smaller than the ROI if the service scaled it down)
+    int image_height;
+    const unsigned char *jpeg_data; ///< BGR video with the debug overlay drawn in, JPEG compressed
+    size_t jpeg_size;
+} PSMTrackerNetworkVideoFrame;
+
 // HMD State
 //----------
 
@@ -520,10 +602,55 @@ typedef struct
     int             OutputSequenceNum;
     bool            IsConnected;
     long long       DataFrameLastReceivedTime;
+    long long       DataFrameServiceTime;   ///< When the service generated the last data frame, see \ref PSM_GetClockSyncEstimate
     float           DataFrameAverageFPS;
     int             ListenerCount;
 } PSMHeadMountedDisplay;
 
+// Device State Snapshot
+//----------------------
+
+/// The kind of device a \ref PSMDeviceStateRecord describes
+typedef enum
+{
+    PSMDeviceCategory_Controller,
+    PSMDeviceCategory_HMD
+} PSMDeviceCategory;
+
+/// Bits of PSMDeviceStateRecord::Flags
+typedef enum
+{
+    PSMDeviceStateFlags_isConnected = 0x01,				///< The device is connected to the service
+    PSMDeviceStateFlags_isTrackingEnabled = 0x02,		///< The stream has position tracking turned on
+    PSMDeviceStateFlags_isCurrentlyTracking = 0x04,		///< A tracker can currently see the device
+    PSMDeviceStateFlags_isOrientationValid = 0x08,		///< Pose.Orientation is valid
+    PSMDeviceStateFlags_isPositionValid = 0x10,			///< Pose.Position is valid
+} PSMDeviceStateFlags;
+
+/// Compact state of a single controller or HMD, see \ref PSM_GetDeviceStateSnapshot
+typedef struct
+{
+    PSMDeviceCategory DeviceCategory;
+    int             DeviceID;                   ///< PSMControllerID or PSMHmdID
+    int             DeviceType;                 ///< PSMControllerType or PSMHmdType
+    unsigned int    Flags;                      ///< Bitmask of PSMDeviceStateFlags
+    int             OutputSequenceNum;          ///< Sequence number of the data frame the state came from
+    long long       DataFrameServiceTime;       ///< When the service generated that data frame
+    PSMPosef        Pose;
+    PSMVector3f     LinearVelocityCmPerSec;     ///< Zero unless streaming physics data
+    PSMVector3f     AngularVelocityRadPerSec;   ///< Zero unless streaming physics data
+    unsigned int    ButtonDownBitmask;          ///< Bit n set if the n-th button of the controller state struct is down
+    float           TriggerValue;               ///< 0-1 trigger (DualShock4: the right trigger)
+    float           RumbleFraction;             ///< 0-1 rumble (DualShock4: the stronger of the two channels)
+    PSMBatteryState BatteryValue;
+} PSMDeviceStateRecord;
+
+/// Called with the new state of a device as soon as one of its data frames has been decoded, see \ref PSM_SetControllerDataCallback
+typedef void(*PSMDeviceDataCallback)(const PSMDeviceStateRecord *record, void *userdata);
+
+/// Number of records that always fits every controller and HMD
+#define PSM_MAX_DEVICE_STATE_RECORD_COUNT (PSMOVESERVICE_MAX_CONTROLLER_COUNT + PSMOVESERVICE_MAX_HMD_COUNT)
+
 // Service Events
 //------------------
 
@@ -592,6 +719,16 @@ typedef struct
     float global_forward_degrees;
 } PSMTrackingSpace;
 
+/// Everything a client usually asks for right after connecting, see \ref PSM_GetConnectionHandshake
+typedef struct
+{
+    PSMServiceVersion service_version;
+    PSMControllerList controller_list;
+    PSMTrackerList tracker_list;
+    PSMHmdList hmd_list;
+    PSMTrackingSpace tracking_space;
+} PSMConnectionHandshake;
+
 /// A contrainer for all possible responses to requests sent from PSMoveService
 typedef struct
 {
@@ -617,6 +754,7 @@ typedef struct
         PSMTrackerList tracker_list;		///< Response to tracker list request
 		PSMHmdList hmd_list;				///< Response to hmd list request
         PSMTrackingSpace tracking_space;	///< Response to tracking space request
+        PSMConnectionHandshake connection_handshake; ///< Response to connection handshake request
     } payload;
 
 	/// Type of response sent from PSMoveService
@@ -628,6 +766,7 @@ typedef struct
         _responsePayloadType_TrackerList,
         _responsePayloadType_TrackingSpace,
 		_responsePayloadType_HmdList,
+        _responsePayloadType_ConnectionHandshake,
 
         _responsePayloadType_Count
     } payload_type;
@@ -666,13 +805,33 @@ typedef struct
  Calling this function again after a connection is already started will return PSMResult_Success.
 
  \remark Blocking - Returns after either a connection is successfully established OR the timeout period is reached. 
- \param host The address that PSMoveService is running at, usually PSMOVESERVICE_DEFAULT_ADDRESS
+ \param host The address that PSMoveService is running at, usually PSMOVESERVICE_DEFAULT_ADDRESS (or PSMOVESERVICE_DEFAULT_LOCAL_ADDRESS for its unix domain socket)
  \param port The port that PSMoveSerive is running at, usually PSMOVESERVICE_DEFAULT_PORT
  \param timeout The conection timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
  \returns PSMResult_Success on success, PSMResult_Timeout, or PSMResult_Error on a general connection error.
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_Initialize(const char* host, const char* port, int timeout_ms); 
 
+/** \brief Initializes a connection to PSMoveService with the given connection options.
+ Same as \ref PSM_Initialize() but takes a bitmask of \ref PSMInitFlags.
+ With PSMInitFlags_useSharedMemoryPoses the client reads controller and HMD poses straight out of
+ the service's shared memory instead of waiting on UDP data frames. This only works when the service
+ runs on the same machine, otherwise the client silently falls back to the data frames.
+ Shared memory poses are only used for data streams that don't ask for raw sensor or raw tracker data.
+ With PSMInitFlags_useNetworkThread the client starts a thread that receives and decodes the UDP data frames
+ as soon as they arrive. The controller, tracker and HMD state queries then always return the newest state
+ without waiting on the next \ref PSM_Update() (which still has to be called to process responses and events).
+ Button pressed/released transitions that happen between two queries of the same controller get merged.
+
+ \remark Blocking - Returns after either a connection is successfully established OR the timeout period is reached. 
+ \param host The address that PSMoveService is running at, usually PSMOVESERVICE_DEFAULT_ADDRESS (or PSMOVESERVICE_DEFAULT_LOCAL_ADDRESS for its unix domain socket)
+ \param port The port that PSMoveSerive is running at, usually PSMOVESERVICE_DEFAULT_PORT
+ \param init_flags A bitmask of \ref PSMInitFlags
+ \param timeout The conection timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
+ \returns PSMResult_Success on success, PSMResult_Timeout, or PSMResult_Error on a general connection error.
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_InitializeWithFlags(const char* host, const char* port, unsigned int init_flags, int timeout_ms); 
+
 /** \brief Shuts down connection to PSMoveService
  Closes an active connection to PSMoveService and cleans out any pending requests. 
  This function should be called when closing down the client OR to reset a client connection.
@@ -694,13 +853,24 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_Shutdown();
     - \ref PSMEvent_connectedToService
     - \ref PSMEvent_failedToConnectToService
 	.   
- \param host The address that PSMoveService is running at, usually PSMOVESERVICE_DEFAULT_ADDRESS
+ \param host The address that PSMoveService is running at, usually PSMOVESERVICE_DEFAULT_ADDRESS (or PSMOVESERVICE_DEFAULT_LOCAL_ADDRESS for its unix domain socket)
  \param port The port that PSMoveSerive is running at, usually PSMOVESERVICE_DEFAULT_PORT
  \param timeout The conection timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
  \returns PSMResult_RequestSent on success, PSMResult_Timeout, or PSMResult_Error on a general connection error.
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_InitializeAsync(const char* host, const char* port);
 
+/** \brief Initializes a connection to PSMoveService with the given connection options.
+ Same as \ref PSM_InitializeAsync() but takes a bitmask of \ref PSMInitFlags (see \ref PSM_InitializeWithFlags()).
+
+ \remark Async - Starts a request for login.
+ \param host The address that PSMoveService is running at, usually PSMOVESERVICE_DEFAULT_ADDRESS (or PSMOVESERVICE_DEFAULT_LOCAL_ADDRESS for its unix domain socket)
+ \param port The port that PSMoveSerive is running at, usually PSMOVESERVICE_DEFAULT_PORT
+ \param init_flags A bitmask of \ref PSMInitFlags
+ \returns PSMResult_RequestSent on success, PSMResult_Timeout, or PSMResult_Error on a general connection error.
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_InitializeAsyncWithFlags(const char* host, const char* port, unsigned int init_flags);
+
 // Update
 /** \brief Poll the connection and process messages.
 	This function will poll the connection for new messages from PSMoveService.
@@ -727,6 +897,21 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_Update();
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_UpdateNoPollMessages();
 
+/** \brief Block until new device data arrives from PSMoveService.
+	Sleeps on the data frame socket until a data frame for any of the started device data streams comes in,
+	so a latency sensitive consumer can react as soon as the service publishes instead of polling.
+	Returns right away if data frames arrived since the last wait.
+	The device state queries return the new data once this returns.
+	Responses and events still only get processed by \ref PSM_Update() or \ref PSM_UpdateNoPollMessages().
+	\remark Without PSMInitFlags_useNetworkThread this has to be called from the same thread as \ref PSM_Update().
+	With it, any thread may wait (the state queries themselves still belong to the client thread).
+	\remark With PSMInitFlags_useSharedMemoryPoses this still wakes on the data frames, 
+	then picks up anything newer from the shared memory poses.
+	\param timeout_ms The longest time to wait in milliseconds, 0 just checks for new data
+	\return PSMResult_Success if new data arrived, PSMResult_Timeout if it didn't or PSMResult_Error if there is no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_WaitForDeviceData(int timeout_ms);
+
 // System State Queries
 /** \brief Get the client API version string 
 	\return A zero-terminated version string of the format "Product.Major-Phase Minor.Release.Hotfix", ex: "0.9-alpha 8.1.0"
@@ -752,6 +937,24 @@ PSM_PUBLIC_FUNCTION(bool) PSM_GetIsConnected();
  */
 PSM_PUBLIC_FUNCTION(bool) PSM_HasConnectionStatusChanged();
 
+/** \brief Get the current time on the clock used for data stream prediction targets
+	Display times passed to \ref PSM_SetControllerDataStreamPredictionTarget and
+	\ref PSM_SetHmdDataStreamPredictionTarget are measured on this (monotonic) clock.
+	\param[out] out_time_us The current client time in microseconds
+	\return PSMResult_Success if a time was written to out_time_us
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetClientTimeMicroseconds(long long *out_time_us);
+
+/** \brief Get the estimated offset between the service clock and the client clock
+	The client pings the service over the TCP connection in the background to measure this.
+	Service time stamps on data frames (e.g. PSMController::DataFrameServiceTime) convert to
+	\ref PSM_GetClientTimeMicroseconds time as: client_time_us = service_time_us - clock_offset_us.
+	\param[out] out_clock_offset_us Estimated (service time - client time) in microseconds
+	\param[out] out_round_trip_time_us Round trip time of the ping the estimate came from, in microseconds
+	\return PSMResult_Success once at least one ping came back, PSMResult_Error otherwise
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetClockSyncEstimate(long long *out_clock_offset_us, int *out_round_trip_time_us);
+
 /** \brief Get the controller list change flag
 	This flag is only filled in when \ref PSM_Update() is called.
 	If you instead call PSM_UpdateNoPollMessages() you'll need to process the event queue yourself to get controller
@@ -816,6 +1019,27 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetServiceVersionString(char *out_version_str
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetServiceVersionStringAsync(PSMRequestID *out_request_id);
 
+/** \brief Get the service version, the device lists and the tracking space settings in one request
+	Same results as \ref PSM_GetServiceVersionString, \ref PSM_GetControllerList, \ref PSM_GetTrackerList,
+	\ref PSM_GetHmdList and \ref PSM_GetTrackingSpaceSettings, but in a single round trip to PSMoveService.
+	Meant for game startup and for reconnecting after the service restarted.
+	\remark Blocking - Returns after either the handshake is returned OR the timeout period is reached. 
+	\param[out] out_handshake The results of the handshake
+	\param timeout_ms The conection timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
+	\return PSMResult_Success upon receiving result, PSMResult_Timeoout, or PSMResult_Error on request error.
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetConnectionHandshake(PSMConnectionHandshake *out_handshake, int timeout_ms);
+
+/** \brief Get the service version, the device lists and the tracking space settings in one request
+	\remark Async - Starts a handshake request. Result obtained in one of two ways:
+	  - Register callback for request id with \ref PSM_RegisterCallback and the poll with \ref PSM_Update()
+	  - Poll with \ref PSM_UpdateNoPollMessages() and then call \ref PSM_PollNextMessage() to see if 
+	  \ref PSMConnectionHandshake result has been received.
+	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetConnectionHandshakeAsync(PSMRequestID *out_request_id);
+
 // Async Message Handling API
 /** \brief Retrieve the next message from the message queue.
 	A call to \ref PSM_UpdateNoPollMessages will queue messages received from PSMoveService.
@@ -922,12 +1146,44 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerList(PSMControllerList *out_cont
 		- PSMStreamFlags_includeRawSensorData = add raw IMU sensor data values
 		- PSMStreamFlags_includeCalibratedSensorData = add calibrated sensor data values
 		- PSMStreamFlags_includeRawTrackerData = add tracker projection info for each tacker
+		- PSMStreamFlags_includeAllTrackerData = with includeRawTrackerData, add the screen location and position on every tracker that sees the device
 		- PSMStreamFlags_disableROI = turns off RegionOfInterest optimization used to reduce CPU load when finding tracking bulb
+		- PSMStreamFlags_useCompactPoseStream = stream only pose, velocity, buttons and trigger in a fixed binary layout (PSMove only, sensor and tracker data are dropped)
+		- PSMStreamFlags_onlySendChanges = skip updates where the pose and digital buttons haven't changed, with a once a second keep-alive
+		- PSMStreamFlags_useDualRateStream = same as useCompactPoseStream, but updates in between optical measurements only carry the orientation
+		  (the position, velocity and buttons stay at what the last full frame sent, which goes out at least every 100ms)
 	\param timeout_ms The conection timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
 	\return PSMResult_Success upon receiving result, PSMResult_Timeoout, or PSMResult_Error on request error.
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartControllerDataStream(PSMControllerID controller_id, unsigned int data_stream_flags, int timeout_ms);
 
+/** \brief Same as \ref PSM_StartControllerDataStream, but caps how often the service sends updates
+	Useful for clients that don't need every controller update (dashboards, menus), 
+	since it cuts both network traffic and client side processing.
+	\remark Blocking - Returns after either stream start response comes back OR the timeout period is reached. 
+	\param controller_id The id of the controller to start the stream for.
+	\param data_stream_flags See \ref PSM_StartControllerDataStream
+	\param max_update_rate_hz The most updates per second to send, 0 to send every update
+	\param timeout_ms The conection timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
+	\return PSMResult_Success upon receiving result, PSMResult_Timeoout, or PSMResult_Error on request error.
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartControllerDataStreamWithRate(PSMControllerID controller_id, unsigned int data_stream_flags, float max_update_rate_hz, int timeout_ms);
+
+/** \brief Same as \ref PSM_StartControllerDataStream, but the service sends updates on a fixed timer
+	Rather than sending whenever the controller updates (with the jitter of the service loop),
+	the service sends output_rate_hz evenly spaced updates per second, each extrapolated to and stamped with
+	its output time (DataFrameServiceTime). Meant for displays and haptics that want evenly spaced samples.
+	The stream always goes over the network, PSMInitFlags_useSharedMemoryPoses doesn't apply to it.
+	PSMStreamFlags_onlySendChanges and PSMStreamFlags_useDualRateStream have no effect.
+	\remark Blocking - Returns after either stream start response comes back OR the timeout period is reached. 
+	\param controller_id The id of the controller to start the stream for.
+	\param data_stream_flags See \ref PSM_StartControllerDataStream
+	\param output_rate_hz Updates per second to send, must be > 0
+	\param timeout_ms The conection timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
+	\return PSMResult_Success upon receiving result, PSMResult_Timeoout, or PSMResult_Error on request error.
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartControllerDataStreamAtFixedRate(PSMControllerID controller_id, unsigned int data_stream_flags, float output_rate_hz, int timeout_ms);
+
 /** \brief Requests stop of an unreliable(udp) data stream for a given controller
 	Asks PSMoveService to start stream data for the given controller with the given set of stream properties.
 	The data in the associated \ref PSMController state will get updated automatically in calls to \ref PSM_Update or 
@@ -973,6 +1229,19 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_ResetControllerOrientation(PSMControllerID co
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetControllerDataStreamTrackerIndex(PSMControllerID controller_id, PSMTrackerID tracker_id, int timeout_ms);
 
+/** \brief Requests that a controller data stream predicts poses to the client's display time
+	Instead of the configured prediction time, the service extrapolates each pose frame
+	to the next display time at the moment the frame is sent.
+	Streams with a prediction target don't use shared memory poses.
+	\remark Blocking - Returns after either the result is returned OR the timeout period is reached. 
+	\param controller_id The ID of the controller whose data stream we want to modify
+    \param display_time_us Time of an upcoming display, see \ref PSM_GetClientTimeMicroseconds. 0 restores the configured prediction time.
+    \param display_interval_us Time between displays (i.e. the refresh period), or 0 if display_time_us is a one off
+	\param timeout_ms The request timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetControllerDataStreamPredictionTarget(PSMControllerID controller_id, long long display_time_us, int display_interval_us, int timeout_ms);
+
 /** \brief Requests setting the hand assigned to a controller
 	This request is used to set the suggested hand for a controller.
 	Hand information is used by external APIs and not by PSMoveService.
@@ -1007,6 +1276,20 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerPosition(PSMControllerID control
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerPose(PSMControllerID controller_id, PSMPosef *out_pose);
 
+/** \brief Get the pose (orienation and position) of a controller at the given time
+	The client remembers the last several poses streamed for the controller, stamped with the service time 
+	of their data frame converted to the client clock (see \ref PSM_GetClockSyncEstimate).
+	A time between two of them gets their interpolated pose. A time past the newest one gets extrapolated 
+	with the streamed velocities (with PSMStreamFlags_includePhysicsData) or the motion between the two newest poses, 
+	up to 100ms ahead. A time older than the history gets the oldest pose.
+	Handy for render threads that want the pose at their predicted display time.
+	\param controller_id The id of the controller
+	\param time_us The client time to get the pose at, see \ref PSM_GetClientTimeMicroseconds
+	\param[out] out_pose The pose of the controller at that time
+	\return PSMResult_Success if the controller streamed at least one valid pose
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerPoseAtTime(PSMControllerID controller_id, long long time_us, PSMPosef *out_pose);
+
 /** \brief Get the current rumble fraction of a controller
 	\param controller_id The id of the controller
 	\param channel The channel to get the rumble for. The PSMove has one channel. The DualShock4 has two.
@@ -1052,6 +1335,17 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerPixelLocationOnTracker(PSMContro
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerPositionOnTracker(PSMControllerID controller_id, PSMTrackerID *out_tracker_id, PSMVector3f *outPosition);
 
+/** \brief Helper function for getting where any tracker currently sees the controller.
+	Unlike \ref PSM_GetControllerPixelLocationOnTracker this isn't limited to the stream's selected tracker,
+	but the controller stream has to be started with PSMStreamFlags_includeAllTrackerData.
+	\param controller_id The controller id to get the tracker sample for.
+	\param tracker_id The tracker to get the sample from.
+	\param[out] out_location The projected controller position on the tracker in pixels.
+	\param[out] out_position Tracker relative position of controller in cm.
+	\return PSMResult_Success if the tracker currently sees the controller, PSMResult_NoData if it doesn't.
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerTrackerSample(PSMControllerID controller_id, PSMTrackerID tracker_id, PSMVector2f *out_location, PSMVector3f *out_position);
+
 /** \brief Helper function for getting the tracker relative 3d orientation of the controller.
 	Each tracking camera can compute a estimate of the controllers 3d position relative to the tracker.
 	This method gets the 3d centroid of the tracking light in tracker relative coordinates.
@@ -1078,6 +1372,7 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerProjectionOnTracker(PSMControlle
 	The light color override will be sent on the outbound controller UDP stream.
 	Tracking will not run when a light color override is set.
 	The override can be cleared by setting the override color to (0, 0, 0)
+	A changed color gets sent to the service immediately, not on the next PSM_Update().
 	\param controller_id The controller whose light override value we want to set.
 	\param r The red color override, range [0. 255]
 	\param g The green color override, range [0. 255]
@@ -1088,6 +1383,7 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetControllerLEDOverrideColor(PSMControllerID
 
 /** \brief Sets the controller rumble fraction
 	The controller rumble is set on the outbound UDP stream.
+	A changed rumble gets sent to the service immediately, not on the next PSM_Update().
 	The rumble for the controller stays on this setting until you change it.
 	\param controller_id The id of the controller to set the rumble for
 	\param channel The channel for the rumble (PSMove has one channel, DS4 has two channels)
@@ -1123,12 +1419,39 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetControllerListAsync(PSMRequestID *out_requ
 		- PSMStreamFlags_includeRawSensorData = add raw IMU sensor data values
 		- PSMStreamFlags_includeCalibratedSensorData = add calibrated sensor data values
 		- PSMStreamFlags_includeRawTrackerData = add tracker projection info for each tacker
+		- PSMStreamFlags_includeAllTrackerData = with includeRawTrackerData, add the screen location and position on every tracker that sees the device
 		- PSMStreamFlags_disableROI = turns off RegionOfInterest optimization used to reduce CPU load when finding tracking bulb
 	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
 	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartControllerDataStreamAsync(PSMControllerID controller_id, unsigned int data_stream_flags, PSMRequestID *out_request_id);
 
+/** \brief Same as \ref PSM_StartControllerDataStreamAsync, but caps how often the service sends updates
+	\remark Async - Starts an async request. Result obtained in one of two ways:
+	  - Register callback for request id with \ref PSM_RegisterCallback and the poll with \ref PSM_Update()
+	  - Poll with \ref PSM_UpdateNoPollMessages() and then call \ref PSM_PollNextMessage() to see if 
+	  generic \ref PSMResponseMessage result has been received.
+	\param controller_id The controller id we wish to start the stream for
+	\param data_stream_flags See \ref PSM_StartControllerDataStream
+	\param max_update_rate_hz The most updates per second to send, 0 to send every update
+	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartControllerDataStreamWithRateAsync(PSMControllerID controller_id, unsigned int data_stream_flags, float max_update_rate_hz, PSMRequestID *out_request_id);
+
+/** \brief Same as \ref PSM_StartControllerDataStreamAsync, but the service sends updates on a fixed timer (see \ref PSM_StartControllerDataStreamAtFixedRate)
+	\remark Async - Starts an async request. Result obtained in one of two ways:
+	  - Register callback for request id with \ref PSM_RegisterCallback and the poll with \ref PSM_Update()
+	  - Poll with \ref PSM_UpdateNoPollMessages() and then call \ref PSM_PollNextMessage() to see if 
+	  generic \ref PSMResponseMessage result has been received.
+	\param controller_id The controller id we wish to start the stream for
+	\param data_stream_flags See \ref PSM_StartControllerDataStream
+	\param output_rate_hz Updates per second to send, must be > 0
+	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartControllerDataStreamAtFixedRateAsync(PSMControllerID controller_id, unsigned int data_stream_flags, float output_rate_hz, PSMRequestID *out_request_id);
+
 /** \brief Requests stop of an unreliable(udp) data stream for a given controller
 	Asks PSMoveService to stop stream data for the given controller.
 	\remark Async - Starts a request for version string. Result obtained in one of two ways:
@@ -1187,6 +1510,20 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_ResetControllerOrientationAsync(PSMController
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetControllerDataStreamTrackerIndexAsync(PSMControllerID controller_id, PSMTrackerID tracker_id, PSMRequestID *out_request_id);
 
+/** \brief Requests that a controller data stream predicts poses to the client's display time
+	See \ref PSM_SetControllerDataStreamPredictionTarget.
+	\remark Async - Starts an async request. Result obtained in one of two ways:
+	  - Register callback for request id with \ref PSM_RegisterCallback and the poll with \ref PSM_Update()
+	  - Poll with \ref PSM_UpdateNoPollMessages() and then call \ref PSM_PollNextMessage() to see if 
+	  generic \ref PSMMessage result has been received.
+	\param controller_id The ID of the controller whose data stream we want to modify
+    \param display_time_us Time of an upcoming display, see \ref PSM_GetClientTimeMicroseconds. 0 restores the configured prediction time.
+    \param display_interval_us Time between displays (i.e. the refresh period), or 0 if display_time_us is a one off
+	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetControllerDataStreamPredictionTargetAsync(PSMControllerID controller_id, long long display_time_us, int display_interval_us, PSMRequestID *out_request_id);
+
 /** \brief Requests setting the assigned hand for a controller
 	This request is used to set the suggested hand for a controller.
 	Hand information is used by external APIs and not by PSMoveService.
@@ -1297,6 +1634,18 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_OpenTrackerVideoStream(PSMTrackerID tracker_i
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_PollTrackerVideoStream(PSMTrackerID tracker_id);
 
+/** \brief Poll the next video frame from an opened tracker video stream straight into a caller owned buffer
+	Same as \ref PSM_PollTrackerVideoStream, but the frame is copied from the shared memory buffer
+	directly into out_buffer (e.g. a mapped pixel buffer) instead of the client's own frame buffer,
+	which \ref PSM_GetTrackerVideoFrameBuffer keeps returning unchanged.
+	Only writes to out_buffer, so write-only memory is fine.
+	\param tracker_id The tracker to poll the next video frame from
+	\param[out] out_buffer The buffer to copy the video frame into
+	\param buffer_size The size of out_buffer in bytes, at least stride x height bytes (see \ref PSM_GetTrackerVideoFrameSize)
+	\return PSMResult_Success if a new video frame was copied into out_buffer
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_PollTrackerVideoStreamIntoBuffer(PSMTrackerID tracker_id, unsigned char *out_buffer, size_t buffer_size);
+
 /** \brief Closes the tracker video stream buffer on the client.
 	Stops reading tracker video stream from a shared memory buffer.
 	A call to \ref PSM_StopTrackerDataStream must be done after closing the video stream.
@@ -1313,6 +1662,46 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_CloseTrackerVideoStream(PSMTrackerID tracker_
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetTrackerVideoFrameBuffer(PSMTrackerID tracker_id, const unsigned char **out_buffer); 
 
+/** \brief Get the size of the video frames polled from an opened tracker video stream
+	Polled frames are always BGR, but a stream started with \ref PSM_StartTrackerDataStreamWithPreviewAsync
+	shrinks them below the tracker dimensions. The size follows the last frame polled.
+	\param tracker_id The tracker to get the video frame size of
+	\param[out] out_width Frame width in pixels
+	\param[out] out_height Frame height in pixels
+	\param[out] out_stride Bytes between the rows of the frame
+	\return PSMResult_Success if the video stream is open
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetTrackerVideoFrameSize(PSMTrackerID tracker_id, int *out_width, int *out_height, int *out_stride);
+
+/** \brief Get the newest video frame of an opened tracker video stream without copying it
+	Unlike \ref PSM_PollTrackerVideoStream the frame doesn't get copied out of the shared memory:
+	out_frame points straight into the slot of the shared memory ring holding it,
+	and the service stays out of that slot until the frame gets released.
+	The debug overlay comes as its own layer instead of being drawn into the video frame.
+	\remark Release the frame with \ref PSM_ReleaseTrackerVideoFrame as soon as you're done with it.
+	Acquiring again releases the previous frame, so it can also return the same frame again.
+	While a frame is acquired \ref PSM_PollTrackerVideoStream and \ref PSM_PollTrackerVideoStreamIntoBuffer find no new frames.
+	\param tracker_id The tracker to get the newest video frame of
+	\param[out] out_frame The frame description and buffer pointers, valid until the frame gets released
+	\return PSMResult_Success if a frame was acquired, PSMResult_NoData if the service hasn't published one
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_AcquireTrackerVideoFrame(PSMTrackerID tracker_id, PSMTrackerVideoFrame *out_frame);
+
+/** \brief Hand a frame from \ref PSM_AcquireTrackerVideoFrame back to the service
+	\param tracker_id The tracker the frame was acquired from
+	\return PSMResult_Success if a frame was acquired, PSMResult_NoData otherwise
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_ReleaseTrackerVideoFrame(PSMTrackerID tracker_id);
+
+/** \brief Fetch the latest frame of a network video stream
+	Network video frames get received in calls to \ref PSM_Update or \ref PSM_UpdateNoPollMessages.
+	\remark The jpeg_data pointer is only valid until the next update call.
+	\param tracker_id The tracker to get the latest network video frame of
+	\param[out] out_frame The frame description and JPEG data
+	\return PSMResult_Success if a frame has been received since the stream started, PSMResult_NoData otherwise
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetTrackerNetworkVideoFrame(PSMTrackerID tracker_id, PSMTrackerNetworkVideoFrame *out_frame);
+
 /** \brief Helper function to fetch tracking frustum properties from a tracker
 	\param The id of the tracker we wish to get the tracking frustum properties for
 	\param out_frustum The tracking frustum properties to write the result into
@@ -1347,6 +1736,22 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetTrackerFrustum(PSMTrackerID tracker_id, PS
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartTrackerDataStreamAsync(PSMTrackerID tracker_id, PSMRequestID *out_request_id);
 
+/** \brief Requests start of a reduced shared memory video stream for a given tracker
+	Same as \ref PSM_StartTrackerDataStreamAsync, but asks for downscaled and/or grayscale frames,
+	which cost the service far less to write each frame (e.g. for a thumbnail view).
+	\remark Every client of a tracker reads the same shared memory, which gets written at the
+	largest scale and richest pixel format any started stream asked for.
+	\remark Async - Result obtained in one of two ways:
+	  - Register callback for request id with \ref PSM_RegisterCallback and the poll with \ref PSM_Update()
+	  - Poll with \ref PSM_UpdateNoPollMessages() and then call \ref PSM_PollNextMessage() to see if 
+	  generic \ref PSMResponseMessage result has been received.
+	\param tracker_id The tracker id we wish to start the stream for
+	\param settings The scale and pixel format of the frames to write
+	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartTrackerDataStreamWithPreviewAsync(PSMTrackerID tracker_id, const PSMTrackerVideoPreviewSettings *settings, PSMRequestID *out_request_id);
+
 /** \brief Requests stop shared memory video stream for a given tracker
 	Asks PSMoveService to stop video data for the given tracker.
 	\remark Async - Result obtained in one of two ways:
@@ -1359,6 +1764,22 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartTrackerDataStreamAsync(PSMTrackerID trac
  */
  PSM_PUBLIC_FUNCTION(PSMResult) PSM_StopTrackerDataStreamAsync(PSMTrackerID tracker_id, PSMRequestID *out_request_id);
 
+/** \brief Requests start of a network video stream for a given tracker
+	Same as \ref PSM_StartTrackerDataStreamAsync, but the service sends the video frames over the connection
+	as JPEGs instead of writing them to shared memory, so this works for clients on another machine too.
+	Read the frames with \ref PSM_GetTrackerNetworkVideoFrame and stop the stream with \ref PSM_StopTrackerDataStreamAsync.
+	\remark All of the network video streams of a tracker share the settings of the last one started.
+	\remark Async - Result obtained in one of two ways:
+	  - Register callback for request id with \ref PSM_RegisterCallback and the poll with \ref PSM_Update()
+	  - Poll with \ref PSM_UpdateNoPollMessages() and then call \ref PSM_PollNextMessage() to see if 
+	  generic \ref PSMResponseMessage result has been received.
+	\param tracker_id The tracker id we wish to start the stream for
+	\param settings The frame rate, quality, size and region of the frames to send
+	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartTrackerNetworkVideoStreamAsync(PSMTrackerID tracker_id, const PSMTrackerNetworkVideoSettings *settings, PSMRequestID *out_request_id);
+
 /** \brief Request the tracking space settings
 	Sends a request to PSMoveService to get the tracking space settings for PSMoveService.
 	The settings contain the direction of global forward (usually the -Z axis)
@@ -1420,6 +1841,15 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetHmdPosition(PSMHmdID hmd_id, PSMVector3f *
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetHmdPose(PSMHmdID hmd_id, PSMPosef *out_pose);
 
+/** \brief Get the pose (orienation and position) of an HMD at the given time
+	Interpolates or extrapolates the recently streamed poses of the HMD, see \ref PSM_GetControllerPoseAtTime
+	\param hmd_id The id of the HMD
+	\param time_us The client time to get the pose at, see \ref PSM_GetClientTimeMicroseconds
+	\param[out] out_pose The pose of the HMD at that time
+	\return PSMResult_Success if the HMD streamed at least one valid pose
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetHmdPoseAtTime(PSMHmdID hmd_id, long long time_us, PSMPosef *out_pose);
+
 /** \brief Helper used to tell if the HMD is upright on a level surface.
 	This method is used as a calibration helper when you want to get a number of HMD samples. 
 	Often in this instance you want to make sure the HMD is sitting upright on a table.
@@ -1456,6 +1886,17 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetHmdPixelLocationOnTracker(PSMHmdID hmd_id,
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetHmdPositionOnTracker(PSMHmdID hmd_id, PSMTrackerID *out_tracker_id, PSMVector3f *out_position);
 
+/** \brief Helper function for getting where any tracker currently sees the HMD.
+	Unlike \ref PSM_GetHmdPixelLocationOnTracker this isn't limited to the stream's selected tracker,
+	but the HMD stream has to be started with PSMStreamFlags_includeAllTrackerData.
+	\param hmd_id The hmd id to get the tracker sample for.
+	\param tracker_id The tracker to get the sample from.
+	\param[out] out_location The projected HMD position on the tracker in pixels.
+	\param[out] out_position Tracker relative position of the HMD in cm.
+	\return PSMResult_Success if the tracker currently sees the HMD, PSMResult_NoData if it doesn't.
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetHmdTrackerSample(PSMHmdID hmd_id, PSMTrackerID tracker_id, PSMVector2f *out_location, PSMVector3f *out_position);
+
 /** \brief Helper function for getting the tracker relative 3d orientation of the HMD
 	Each tracking camera can compute a estimate of an HMDs 3d position relative to the tracker.
 	This method gets the 3d centroid of the tracking light in tracker relative coordinates.
@@ -1500,6 +1941,7 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetHmdList(PSMHmdList *out_hmd_list, int time
 		- PSMStreamFlags_includeRawSensorData = add raw IMU sensor data values
 		- PSMStreamFlags_includeCalibratedSensorData = add calibrated sensor data values
 		- PSMStreamFlags_includeRawTrackerData = add tracker projection info for each tacker
+		- PSMStreamFlags_includeAllTrackerData = with includeRawTrackerData, add the screen location and position on every tracker that sees the device
 		- PSMStreamFlags_disableROI = turns off RegionOfInterest optimization used to reduce CPU load when finding tracking bulb(s)
 	\param timeout_ms The conection timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
 	\return PSMResult_Success upon receiving result, PSMResult_Timeoout, or PSMResult_Error on request error.
@@ -1527,6 +1969,19 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_StopHmdDataStream(PSMHmdID hmd_id, int timeou
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetHmdDataStreamTrackerIndex(PSMHmdID hmd_id, PSMTrackerID tracker_id, int timeout_ms);
 
+/** \brief Requests that an HMD data stream predicts poses to the client's display time
+	Instead of the current (unpredicted) pose, the service extrapolates each pose frame
+	to the next display time at the moment the frame is sent.
+	Streams with a prediction target don't use shared memory poses.
+	\remark Blocking - Returns after either the result is returned OR the timeout period is reached. 
+	\param hmd_id The ID of the HMD whose data stream we want to modify
+    \param display_time_us Time of an upcoming display, see \ref PSM_GetClientTimeMicroseconds. 0 turns prediction back off.
+    \param display_interval_us Time between displays (i.e. the refresh period), or 0 if display_time_us is a one off
+	\param timeout_ms The request timeout period in milliseconds, usually PSM_DEFAULT_TIMEOUT
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetHmdDataStreamPredictionTarget(PSMHmdID hmd_id, long long display_time_us, int display_interval_us, int timeout_ms);
+
 // Async HMD Methods
 /** \brief Requests a list of the HMDs currently connected to PSMoveService.
 	Sends a request to PSMoveService to get the list of HMDs.
@@ -1556,6 +2011,7 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetHmdListAsync(PSMRequestID *out_request_id)
 		- PSMStreamFlags_includeRawSensorData = add raw IMU sensor data values
 		- PSMStreamFlags_includeCalibratedSensorData = add calibrated sensor data values
 		- PSMStreamFlags_includeRawTrackerData = add tracker projection info for each tacker
+		- PSMStreamFlags_includeAllTrackerData = with includeRawTrackerData, add the screen location and position on every tracker that sees the device
 		- PSMStreamFlags_disableROI = turns off RegionOfInterest optimization used to reduce CPU load when finding tracking bulb(s)
 	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
 	\return PSMResult_RequestSent if request successfully sent or PSMResult_Error if connection is invalid.
@@ -1589,6 +2045,60 @@ PSM_PUBLIC_FUNCTION(PSMResult) PSM_StartHmdDataStreamAsync(PSMHmdID hmd_id, unsi
  */
 PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetHmdDataStreamTrackerIndexAsync(PSMHmdID hmd_id, PSMTrackerID tracker_id, PSMRequestID *out_request_id);
 
+/** \brief Requests that an HMD data stream predicts poses to the client's display time
+	See \ref PSM_SetHmdDataStreamPredictionTarget.
+	\remark Async - Starts an async request. Result obtained in one of two ways:
+	  - Register callback for request id with \ref PSM_RegisterCallback and the poll with \ref PSM_Update()
+	  - Poll with \ref PSM_UpdateNoPollMessages() and then call \ref PSM_PollNextMessage() to see if 
+	  generic \ref PSMMessage result has been received.
+	\param hmd_id The ID of the hmd whose data stream we want to modify
+    \param display_time_us Time of an upcoming display, see \ref PSM_GetClientTimeMicroseconds. 0 turns prediction back off.
+    \param display_interval_us Time between displays (i.e. the refresh period), or 0 if display_time_us is a one off
+	\param[out] out_request_id The id of the request sent to PSMoveService. Can be used to register callback with \ref PSM_RegisterCallback.
+	\return PSMResult_RequestSent on success or PSMResult_Error if there was no valid connection
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetHmdDataStreamPredictionTargetAsync(PSMHmdID hmd_id, long long display_time_us, int display_interval_us, PSMRequestID *out_request_id);
+
+// Device State Snapshot
+/** \brief Gets the state of every allocated controller and HMD in a single call
+	Fills one compact record per controller and HMD that has a listener allocated, controllers first.
+	Saves the dozens of per device state calls (pose, tracking, buttons, rumble, ...) a frame would 
+	otherwise take, which adds up when every call has to cross a language boundary (e.g. C#).
+	All of the records come from the device state as of the last \ref PSM_Update, so they stay
+	consistent with each other even when the network thread (PSMInitFlags_useNetworkThread) 
+	already decoded newer data frames for some of the devices.
+	\param[out] out_records Caller provided array to write the records into
+	\param max_record_count Size of out_records. PSM_MAX_DEVICE_STATE_RECORD_COUNT always fits everything.
+	\param[out] out_record_count The number of records written
+	\return PSMResult_Success if every allocated device fit, PSMResult_Error if not connected or records got left out
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_GetDeviceStateSnapshot(PSMDeviceStateRecord *out_records, int max_record_count, int *out_record_count);
+
+// Device Data Callbacks
+/** \brief Sets a callback that gets the controller's new state as soon as each of its data frames is decoded
+	Lets middleware push poses into its own pipeline without polling after every \ref PSM_Update.
+	With PSMInitFlags_useNetworkThread the callback runs on the network thread the moment a data frame arrives,
+	otherwise it runs on the client thread from within \ref PSM_Update (or \ref PSM_WaitForDeviceData).
+	The record lives on the stack of the caller, nothing gets allocated per call.
+	\remark The callback must not block or call any other client API function. 
+	Once this returns, the previous callback of the controller is no longer running and won't be called again.
+	\remark Poses read from the service's shared memory (PSMInitFlags_useSharedMemoryPoses) don't trigger the callback.
+	\param controller_id The id of the controller to get the data frames of
+	\param callback The callback function, or NULL to remove the controller's callback
+	\param callback_userdata Userdata passed back to the callback
+	\return PSMResult_Success if the controller id is valid, PSMResult_Error otherwise
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetControllerDataCallback(PSMControllerID controller_id, PSMDeviceDataCallback callback, void *callback_userdata);
+
+/** \brief Sets a callback that gets the HMD's new state as soon as each of its data frames is decoded
+	Same as \ref PSM_SetControllerDataCallback for HMDs.
+	\param hmd_id The id of the HMD to get the data frames of
+	\param callback The callback function, or NULL to remove the HMD's callback
+	\param callback_userdata Userdata passed back to the callback
+	\return PSMResult_Success if the HMD id is valid, PSMResult_Error otherwise
+ */
+PSM_PUBLIC_FUNCTION(PSMResult) PSM_SetHmdDataCallback(PSMHmdID hmd_id, PSMDeviceDataCallback callback, void *callback_userdata);
+
 /** 
 @} 
 */ 
@@ -9,6 +9,18 @@
 
 #include "PSMoveProtocol.pb.h"
 
+//-- constants -----
+// Cap on the main loop frame rate. Nothing here needs more, and the
+// config tool often runs next to the service it is configuring.
+static const Uint32 k_frame_interval_ms = 1000 / 60;
+
+// Stages that don't render continuously still redraw this often,
+// so service state polled in their update() shows up without any input
+static const Uint32 k_idle_frame_interval_ms = 100;
+
+// imgui needs a couple of frames for hover and click state to settle after an input
+static const int k_redraw_frame_count = 3;
+
 class InputParser {
 public:
 	InputParser(int &argc, char **argv) {
@@ -45,6 +57,8 @@ App::App()
     , m_fixedCamera(m_renderer)
     , m_appStage(nullptr)
     , m_bShutdownRequested(false)
+    , m_pendingRedrawFrameCount(k_redraw_frame_count)
+    , m_lastRenderTicks(0)
 {
 	strncpy(m_serverAddress, PSMOVESERVICE_DEFAULT_ADDRESS, sizeof(m_serverAddress));
 	strncpy(m_serverPort, PSMOVESERVICE_DEFAULT_PORT, sizeof(m_serverPort));
@@ -108,22 +122,51 @@ int App::exec(int argc, char** argv)
 
         while (!m_bShutdownRequested) 
         {
-            if (SDL_PollEvent(&e)) 
+            const Uint32 frame_interval_ms = getFrameIntervalMs();
+            const Uint32 elapsed_ms = SDL_GetTicks() - m_lastRenderTicks;
+            const Uint32 wait_ms = (elapsed_ms < frame_interval_ms) ? frame_interval_ms - elapsed_ms : 0;
+
+            // Sleep in the event queue until there is input or the next frame is due
+            if (SDL_WaitEventTimeout(&e, static_cast<int>(wait_ms)))
             {
-                if (e.type == SDL_QUIT || 
-                    (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE)) 
+                do
+                {
+                    if (e.type == SDL_QUIT || 
+                        (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE)) 
+                    {
+                        Log_INFO("App::exec", "QUIT message received");
+                        m_bShutdownRequested= true;
+                        break;
+                    }
+                    else 
+                    {
+                        onSDLEvent(e);
+                        requestRedraw();
+                    }
+                } while (SDL_PollEvent(&e));
+
+                if (m_bShutdownRequested)
                 {
-                    Log_INFO("App::exec", "QUIT message received");
                     break;
                 }
-                else 
+            }
+
+            if (update())
+            {
+                requestRedraw();
+            }
+
+            // Input arriving before the frame is due only shortens the wait, the frame rate stays capped
+            if (SDL_GetTicks() - m_lastRenderTicks >= getFrameIntervalMs())
+            {
+                render();
+
+                m_lastRenderTicks= SDL_GetTicks();
+                if (m_pendingRedrawFrameCount > 0)
                 {
-                    onSDLEvent(e);
+                    --m_pendingRedrawFrameCount;
                 }
             }
-
-            update();
-            render();
         }
     }
     else
@@ -167,6 +210,11 @@ bool App::reconnectToServiceSync()
 	return success;
 }
 
+void App::requestRedraw()
+{
+    m_pendingRedrawFrameCount= k_redraw_frame_count;
+}
+
 void App::setCameraType(eCameraType cameraType)
 {
     switch (cameraType)
@@ -212,12 +260,24 @@ void App::setAppStage(const char *appStageName)
 		    {
 			    m_appStage->enter();
 		    }
+
+		    requestRedraw();
 	    }
     }
 }
 
 
 //-- private methods -----
+Uint32 App::getFrameIntervalMs() const
+{
+    const bool bRenderAtFullRate =
+        m_appStage == nullptr ||
+        m_appStage->getIsRenderingContinuously() ||
+        m_pendingRedrawFrameCount > 0;
+
+    return bRenderAtFullRate ? k_frame_interval_ms : k_idle_frame_interval_ms;
+}
+
 bool App::init(int argc, char** argv)
 {
     bool success= true;
@@ -337,8 +397,10 @@ void App::onClientPSMoveResponse(
         protocol_response_type_name.c_str(), request_id);
 }
 
-void App::update()
+bool App::update()
 {
+	bool bReceivedMessages= false;
+
 	if (PSM_GetIsInitialized())
 	{
 		// Poll any events from the service
@@ -348,6 +410,8 @@ void App::update()
 		PSMMessage message;
 		while (PSM_PollNextMessage(&message, sizeof(message)) == PSMResult_Success)
 		{
+			bReceivedMessages= true;
+
 			switch (message.payload_type)
 			{
 			case PSMMessage::_messagePayloadType_Response:
@@ -365,6 +429,8 @@ void App::update()
     {
         m_appStage->update();
     }
+
+    return bReceivedMessages;
 }
 
 void App::render()
@@ -5,6 +5,7 @@
 #include "PSMoveClient_CAPI.h"
 
 #include "SDL_events.h"
+#include "SDL_timer.h"
 
 #include "Camera.h"
 
@@ -43,6 +44,9 @@ public:
     inline void requestShutdown()
     { m_bShutdownRequested= true; }
 
+    /// Makes a stage that doesn't render continuously draw its next few frames
+    void requestRedraw();
+
 	inline bool getIsLocalServer() const
 	{ return m_bIsServerLocal; }
 
@@ -86,13 +90,16 @@ protected:
     void onClientPSMoveEvent(const PSMEventMessage *event);
     void onClientPSMoveResponse(const PSMResponseMessage *response);
 
-    void update();
+    bool update();
     void render();
 
 private:
 
 	void initCommandLine(int argc, char** argv);
 
+    // Time between two frames for the current stage, see AppStage::getIsRenderingContinuously()
+    Uint32 getFrameIntervalMs() const;
+
     // Contexts
     class Renderer *m_renderer;
 
@@ -123,6 +130,10 @@ private:
 
     // Flag requesting that we exit the update loop
     bool m_bShutdownRequested;
+
+    // Frames left to draw at the full rate after something changed, see requestRedraw()
+    int m_pendingRedrawFrameCount;
+    Uint32 m_lastRenderTicks;
 };
 
 #endif // APP_H
\ No newline at end of file
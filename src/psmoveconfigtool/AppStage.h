@@ -19,6 +19,11 @@ public:
     virtual void render() {};
     virtual void renderUI() {}
 
+    // Stages showing live controller/tracker data or video need a new frame every loop.
+    // Static menus return false and only get redrawn on input,
+    // on messages from the service or when they call App::requestRedraw().
+    virtual bool getIsRenderingContinuously() const { return true; }
+
     virtual void onKeyDown(int keyCode) {}
     virtual bool onClientAPIEvent(
         PSMEventMessage::eEventType event, 
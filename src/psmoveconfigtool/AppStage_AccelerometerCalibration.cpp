@@ -28,6 +28,9 @@ const char *AppStage_AccelerometerCalibration::APP_STAGE_NAME = "AcceleromterCal
 //-- constants -----
 static const double k_stabilize_wait_time_ms = 1000.f;
 static const int k_max_accelerometer_samples = 500;
+// Every IMU reading the service records, a few seconds worth
+static const int k_desired_imu_capture_sample_count = 2000;
+static const float k_imu_capture_poll_interval_ms = 100.f;
 
 static const float k_min_sample_distance = 1000.f;
 static const float k_min_sample_distance_sq = k_min_sample_distance*k_min_sample_distance;
@@ -35,54 +38,43 @@ static const float k_min_sample_distance_sq = k_min_sample_distance*k_min_sample
 //-- definitions -----
 struct AccelerometerStatistics
 {
-    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
-
+    // Readings from the data stream, only drawn as a point cloud
     PSMVector3f accelerometer_samples[k_max_accelerometer_samples];
-	Eigen::Vector3f eigen_accelerometer_samples[k_max_accelerometer_samples];
-    Eigen::Vector3f avg_accelerometer_sample;
+    int sample_count;
+
+	// Statistics gathered by the service, see SAMPLE_CONTROLLER_IMU
+	int capture_sample_count;
+	bool bIsComplete;
 	float noise_variance;
     float noise_radius;
-    int sample_count;
 
     void clear()
     {        
         sample_count= 0;
+		capture_sample_count= 0;
+		bIsComplete= false;
+		noise_variance= 0.f;
         noise_radius= 0.f;
     }
 
-	bool getIsComplete() const
-	{
-		return sample_count >= k_max_accelerometer_samples;
-	}
-
 	void addSample(const PSMVector3f &sample)
 	{
-		if (getIsComplete())
+		if (sample_count < k_max_accelerometer_samples)
 		{
-			return;
+			accelerometer_samples[sample_count] = sample;
+			++sample_count;
 		}
+	}
 
-		accelerometer_samples[sample_count] = sample;
-		eigen_accelerometer_samples[sample_count] = psm_vector3f_to_eigen_vector3(sample);
-		++sample_count;
+	void applyStatistics(const PSMoveProtocol::Response_ResultControllerIMUSamples &result)
+	{
+		capture_sample_count= result.sample_count();
+		bIsComplete= result.target_sample_count() > 0 && result.sample_count() >= result.target_sample_count();
 
-		if (getIsComplete())
+		if (bIsComplete)
 		{
-			// Compute the mean and variance of the accelerometer readings
-			Eigen::Vector3f accelerometer_variance;
-			eigen_vector3f_compute_mean_and_variance(
-				eigen_accelerometer_samples, sample_count, 
-				&avg_accelerometer_sample, &accelerometer_variance);
-			noise_variance = accelerometer_variance.maxCoeff();
-
-			// Compute the bounding radius of the accelerometer error
-			noise_radius = 0;
-			for (int sample_index = 0; sample_index < k_max_accelerometer_samples; ++sample_index)
-			{
-				Eigen::Vector3f error = eigen_accelerometer_samples[sample_index] - avg_accelerometer_sample;
-
-				noise_radius = fmaxf(noise_radius, error.norm());
-			}
+			noise_variance= result.accelerometer_variance_g_units_sqr();
+			noise_radius= result.accelerometer_noise_radius_g_units();
 		}
 	}
 };
@@ -101,6 +93,9 @@ AppStage_AccelerometerCalibration::AppStage_AccelerometerCalibration(App *app)
     , m_controllerView(nullptr)
     , m_isControllerStreamActive(false)
     , m_lastControllerSeqNum(-1)
+    , m_bIMUCaptureStarted(false)
+    , m_bIMUCaptureRequestPending(false)
+    , m_lastIMUCaptureRequestTime()
     , m_noiseSamples(new AccelerometerStatistics)
 {
 }
@@ -206,22 +201,37 @@ void AppStage_AccelerometerCalibration::update()
         } break;
     case eCalibrationMenuState::measureNoise:
         {
-            if (bControllerDataUpdatedThisFrame && m_noiseSamples->sample_count < k_max_accelerometer_samples)
+            if (bControllerDataUpdatedThisFrame)
             {
-                // Store the new sample
+                // Store the new sample for drawing
 				m_noiseSamples->addSample(m_lastCalibratedAccelerometer);
+            }
 
-                // See if we filled all of the samples for this pose
-                if (m_noiseSamples->getIsComplete())
-                {
-                    // Tell the service what the new calibration constraints are
-                    request_set_accelerometer_calibration(
-                        m_controllerView->ControllerID,
-                        m_noiseSamples->noise_radius,
-						m_noiseSamples->noise_variance);
+			// The service records every IMU reading itself, we just poll for the statistics
+			if (m_bIMUCaptureStarted && !m_bIMUCaptureRequestPending)
+			{
+				const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+				const std::chrono::duration<float, std::milli> timeSinceLastPoll = now - m_lastIMUCaptureRequestTime;
 
-                    m_menuState = AppStage_AccelerometerCalibration::measureComplete;
-                }
+				if (timeSinceLastPoll.count() >= k_imu_capture_poll_interval_ms)
+				{
+					request_sample_imu(false, 0);
+				}
+			}
+
+            // See if the service recorded all of the samples for this pose
+            if (m_noiseSamples->bIsComplete)
+            {
+                // Tell the service what the new calibration constraints are
+                request_set_accelerometer_calibration(
+                    m_controllerView->ControllerID,
+                    m_noiseSamples->noise_radius,
+					m_noiseSamples->noise_variance);
+
+				// Free the capture on the service
+				request_sample_imu(true, 0);
+
+                m_menuState = AppStage_AccelerometerCalibration::measureComplete;
             }
         } break;
     case eCalibrationMenuState::measureComplete:
@@ -419,6 +429,10 @@ void AppStage_AccelerometerCalibration::renderUI()
             if (ImGui::Button("Start Sampling"))
             {
                 m_menuState = eCalibrationMenuState::measureNoise;
+
+				// Have the service start recording the IMU readings
+				m_bIMUCaptureStarted= false;
+				request_sample_imu(true, k_desired_imu_capture_sample_count);
             }
             ImGui::SameLine();
             if (ImGui::Button("Cancel"))
@@ -435,8 +449,8 @@ void AppStage_AccelerometerCalibration::renderUI()
             ImGui::Begin(k_window_title, nullptr, window_flags);
 
             float sampleFraction =
-                static_cast<float>(m_noiseSamples->sample_count)
-                / static_cast<float>(k_max_accelerometer_samples);
+                static_cast<float>(m_noiseSamples->capture_sample_count)
+                / static_cast<float>(k_desired_imu_capture_sample_count);
 
             ImGui::Text("Sampling accelerometer.");
             ImGui::ProgressBar(sampleFraction, ImVec2(250, 20));
@@ -536,6 +550,69 @@ static void request_set_accelerometer_calibration(
     PSM_SendOpaqueRequest(&request, nullptr);
 }
 
+void AppStage_AccelerometerCalibration::request_sample_imu(
+	const bool bStartSampling,
+	const int sample_count)
+{
+    RequestPtr request(new PSMoveProtocol::Request());
+    request->set_type(PSMoveProtocol::Request_RequestType_SAMPLE_CONTROLLER_IMU);
+
+    PSMoveProtocol::Request_RequestSampleControllerIMU *sample_request =
+        request->mutable_request_sample_controller_imu();
+
+    sample_request->set_controller_id(m_controllerView->ControllerID);
+	sample_request->set_start_sampling(bStartSampling);
+	sample_request->set_sample_count(sample_count);
+
+	PSMRequestID request_id;
+	PSM_SendOpaqueRequest(&request, &request_id);
+
+	if (bStartSampling)
+	{
+		PSM_RegisterCallback(request_id, AppStage_AccelerometerCalibration::handle_start_imu_sampling_response, this);
+	}
+	else
+	{
+		PSM_RegisterCallback(request_id, AppStage_AccelerometerCalibration::handle_sample_imu_response, this);
+		m_bIMUCaptureRequestPending= true;
+	}
+
+	m_lastIMUCaptureRequestTime= std::chrono::high_resolution_clock::now();
+}
+
+void AppStage_AccelerometerCalibration::handle_start_imu_sampling_response(
+	const PSMResponseMessage *response,
+	void *userdata)
+{
+	AppStage_AccelerometerCalibration *thisPtr = reinterpret_cast<AppStage_AccelerometerCalibration *>(userdata);
+
+	// Responses come back in order, so every poll after this one sees the new capture
+	if (response->result_code == PSMResult_Success &&
+		thisPtr->m_menuState == eCalibrationMenuState::measureNoise)
+	{
+		thisPtr->m_bIMUCaptureStarted= true;
+	}
+}
+
+void AppStage_AccelerometerCalibration::handle_sample_imu_response(
+	const PSMResponseMessage *response,
+	void *userdata)
+{
+	AppStage_AccelerometerCalibration *thisPtr = reinterpret_cast<AppStage_AccelerometerCalibration *>(userdata);
+
+	thisPtr->m_bIMUCaptureRequestPending= false;
+
+	// Drop polls of an earlier capture that come in after it restarted
+	if (response->result_code == PSMResult_Success &&
+		thisPtr->m_bIMUCaptureStarted &&
+		thisPtr->m_menuState == eCalibrationMenuState::measureNoise)
+	{
+		const PSMoveProtocol::Response *protocol_response = GET_PSMOVEPROTOCOL_RESPONSE(response->opaque_response_handle);
+
+		thisPtr->m_noiseSamples->applyStatistics(protocol_response->result_controller_imu_samples());
+	}
+}
+
 void AppStage_AccelerometerCalibration::handle_acquire_controller(
     const PSMResponseMessage *response,
     void *userdata)
@@ -35,6 +35,13 @@ public:
     }
 
 protected:
+	void request_sample_imu(const bool bStartSampling, const int sample_count);
+	static void handle_start_imu_sampling_response(
+		const PSMResponseMessage *response,
+		void *userdata);
+	static void handle_sample_imu_response(
+		const PSMResponseMessage *response,
+		void *userdata);
     static void handle_acquire_controller(
         const PSMResponseMessage *response,
         void *userdata);
@@ -69,6 +76,11 @@ private:
 
     PSMVector3f m_lastCalibratedAccelerometer;
 
+	// Service side IMU capture, see SAMPLE_CONTROLLER_IMU
+	bool m_bIMUCaptureStarted;
+	bool m_bIMUCaptureRequestPending;
+	std::chrono::time_point<std::chrono::high_resolution_clock> m_lastIMUCaptureRequestTime;
+
     AccelerometerStatistics *m_noiseSamples;
 };
 
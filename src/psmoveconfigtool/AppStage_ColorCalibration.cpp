@@ -151,6 +151,7 @@ AppStage_ColorCalibration::AppStage_ColorCalibration(App *app)
     , m_bAutoChangeColor(false)
     , m_bAutoChangeTracker(false)
     , m_bAutoCalibrate(false)
+    , m_autoCalibratedTrackerCount(-1)
     , m_bShowWindows(true)
     , m_bShowAlignment(false)
     , m_bShowAlignmentColor(false)
@@ -258,22 +259,17 @@ void AppStage_ColorCalibration::update()
     // Try and read the next video frame from shared memory
     if (m_video_buffer_state != nullptr)
     {
-        const unsigned char *video_buffer= nullptr;
-        if (PSM_PollTrackerVideoStream(m_trackerView->tracker_info.tracker_id) == PSMResult_Success &&
-            PSM_GetTrackerVideoFrameBuffer(m_trackerView->tracker_info.tracker_id, &video_buffer) == PSMResult_Success)
+        cv::Mat *bgrBuffer = m_video_buffer_state->bgrBuffer;
+
+        // Read the video frame from shared memory straight into the bgr opencv buffer
+        if (PSM_PollTrackerVideoStreamIntoBuffer(
+                m_trackerView->tracker_info.tracker_id,
+                bgrBuffer->data,
+                bgrBuffer->total()*bgrBuffer->elemSize()) == PSMResult_Success)
         {
-            const int frameWidth = static_cast<int>(m_trackerView->tracker_info.tracker_screen_dimensions.x);
-            const int frameHeight = static_cast<int>(m_trackerView->tracker_info.tracker_screen_dimensions.y);
-            const unsigned char *display_buffer = video_buffer;
+            const unsigned char *display_buffer = bgrBuffer->data;
             const TrackerColorPreset &preset = getColorPreset();
 
-            // Copy the video frame buffer into the bgr opencv buffer
-            {
-                const cv::Mat videoBufferMat(frameHeight, frameWidth, CV_8UC3, const_cast<unsigned char *>(video_buffer));
-
-                videoBufferMat.copyTo(*m_video_buffer_state->bgrBuffer);
-            }
-
             // Convert the video buffer to the HSV color space
             cv::cvtColor(*m_video_buffer_state->bgrBuffer, *m_video_buffer_state->hsvBuffer, cv::COLOR_BGR2HSV);
 
@@ -671,7 +667,7 @@ void AppStage_ColorCalibration::renderUI()
         if (m_bShowWindows)
         {
             ImGui::SetNextWindowPos(ImVec2(ImGui::GetIO().DisplaySize.x - k_panel_width - 10, 10.f));
-            ImGui::SetNextWindowSize(ImVec2(k_panel_width, 300));
+            ImGui::SetNextWindowSize(ImVec2(k_panel_width, 325));
             ImGui::Begin("Controller Color", nullptr, window_flags);
 
             if (m_masterControllerView != nullptr)
@@ -797,6 +793,17 @@ void AppStage_ColorCalibration::renderUI()
             ImGui::SameLine();
             ImGui::Text("Value Range: %f", getColorPreset().value_range);
 
+            // -- Histogram Calibration --
+            if (ImGui::Button("Auto Calibrate All Trackers"))
+            {
+                request_tracker_auto_calibrate_color_presets(m_masterTrackingColorType);
+            }
+            if (m_autoCalibratedTrackerCount >= 0)
+            {
+                ImGui::SameLine();
+                ImGui::Text("%d tracker(s) calibrated", m_autoCalibratedTrackerCount);
+            }
+
             // -- Auto Calibration --
             ImGui::Text("Auto Change Setings:");
             if (m_masterControllerView != nullptr)
@@ -1530,6 +1537,83 @@ void AppStage_ColorCalibration::handle_tracker_set_color_preset_response(
     }
 }
 
+void AppStage_ColorCalibration::request_tracker_auto_calibrate_color_presets(
+    PSMTrackingColorType color_type)
+{
+    // Have the service pick the presets of every tracker from histograms of the lit bulb
+    RequestPtr request(new PSMoveProtocol::Request());
+    request->set_type(PSMoveProtocol::Request_RequestType_AUTO_CALIBRATE_TRACKER_COLOR_PRESETS);
+
+    PSMoveProtocol::Request_RequestAutoCalibrateTrackerColorPresets *calibrate_request =
+        request->mutable_request_auto_calibrate_tracker_color_presets();
+    calibrate_request->set_tracker_id(-1);
+    calibrate_request->set_color_type(static_cast<PSMoveProtocol::TrackingColorType>(color_type));
+
+    if (m_hmdView != nullptr)
+    {
+        calibrate_request->set_device_id(m_overrideHmdId);
+        calibrate_request->set_device_category(
+            PSMoveProtocol::Request_RequestAutoCalibrateTrackerColorPresets_DeviceCategory_HMD);
+    }
+    else
+    {
+        calibrate_request->set_device_id(m_overrideControllerId);
+        calibrate_request->set_device_category(
+            PSMoveProtocol::Request_RequestAutoCalibrateTrackerColorPresets_DeviceCategory_CONTROLLER);
+    }
+
+    PSMRequestID request_id;
+    PSM_SendOpaqueRequest(&request, &request_id);
+    PSM_RegisterCallback(request_id, AppStage_ColorCalibration::handle_tracker_auto_calibrate_color_presets_response, this);
+}
+
+void AppStage_ColorCalibration::handle_tracker_auto_calibrate_color_presets_response(
+    const PSMResponseMessage *response,
+    void *userdata)
+{
+    AppStage_ColorCalibration *thisPtr = static_cast<AppStage_ColorCalibration *>(userdata);
+
+    switch (response->result_code)
+    {
+    case PSMResult_Success:
+        {
+            const PSMResponseHandle response_handle = response->opaque_response_handle;
+            const PSMoveProtocol::Response *response = GET_PSMOVEPROTOCOL_RESPONSE(response_handle);
+            const PSMoveProtocol::Response_ResultAutoCalibrateTrackerColorPresets &result =
+                response->result_auto_calibrate_tracker_color_presets();
+
+            thisPtr->m_autoCalibratedTrackerCount = result.tracker_presets_size();
+
+            // Only the preset of the tracker we're looking at is shown
+            for (int preset_index = 0; preset_index < result.tracker_presets_size(); ++preset_index)
+            {
+                const auto &trackerPreset = result.tracker_presets(preset_index);
+
+                if (trackerPreset.tracker_id() == thisPtr->m_trackerView->tracker_info.tracker_id)
+                {
+                    const PSMoveProtocol::TrackingColorPreset &srcPreset = trackerPreset.color_preset();
+                    const PSMTrackingColorType color_type = static_cast<PSMTrackingColorType>(srcPreset.color_type());
+                    AppStage_ColorCalibration::TrackerColorPreset &targetPreset = thisPtr->m_colorPresets[color_type];
+
+                    targetPreset.hue_center = srcPreset.hue_center();
+                    targetPreset.hue_range = srcPreset.hue_range();
+                    targetPreset.saturation_center = srcPreset.saturation_center();
+                    targetPreset.saturation_range = srcPreset.saturation_range();
+                    targetPreset.value_center = srcPreset.value_center();
+                    targetPreset.value_range = srcPreset.value_range();
+                }
+            }
+        } break;
+    case PSMResult_Error:
+    case PSMResult_Canceled:
+    case PSMResult_Timeout:
+        {
+            // None of the trackers could see the bulb
+            thisPtr->m_autoCalibratedTrackerCount = 0;
+        } break;
+    }
+}
+
 void AppStage_ColorCalibration::request_tracker_get_settings()
 {
     // Tell the psmove service that we want to change exposure.
@@ -1636,8 +1720,8 @@ void AppStage_ColorCalibration::request_apply_default_tracker_profile()
     // Tell the psmove service that we want to apply the saved default profile to the current tracker.
     RequestPtr request(new PSMoveProtocol::Request());
     request->set_type(PSMoveProtocol::Request_RequestType_APPLY_TRACKER_PROFILE);
-    request->mutable_request_save_tracker_profile()->set_tracker_id(m_trackerView->tracker_info.tracker_id);
-    request->mutable_request_save_tracker_profile()->set_controller_id(m_overrideControllerId);
+    request->mutable_request_apply_tracker_profile()->set_tracker_id(m_trackerView->tracker_info.tracker_id);
+    request->mutable_request_apply_tracker_profile()->set_controller_id(m_overrideControllerId);
 
     PSMRequestID request_id;
     PSM_SendOpaqueRequest(&request, &request_id);
@@ -136,6 +136,11 @@ protected:
         const PSMResponseMessage *response,
         void *userdata);
 
+    void request_tracker_auto_calibrate_color_presets(PSMTrackingColorType color_type);
+    static void handle_tracker_auto_calibrate_color_presets_response(
+        const PSMResponseMessage *response,
+        void *userdata);
+
     void request_tracker_get_settings();
     static void handle_tracker_get_settings_response(
         const PSMResponseMessage *response,
@@ -198,6 +203,7 @@ private:
 	bool m_bAutoChangeColor;
 	bool m_bAutoChangeTracker;
 	bool m_bAutoCalibrate;
+	int m_autoCalibratedTrackerCount; // Trackers the last histogram calibration found the bulb in, -1 before the first one
 
 	// Setting Windows visability
 	bool m_bShowWindows;
@@ -788,14 +788,7 @@ void AppStage_ComputeTrackerPoses::update_tracker_video()
         const int tracker_id= m_renderTrackerIter->second.trackerView->tracker_info.tracker_id;
 
         // Render the latest from the currently active tracker
-        if (PSM_PollTrackerVideoStream(tracker_id) == PSMResult_Success)
-        {
-            const unsigned char *buffer= nullptr;
-            if (PSM_GetTrackerVideoFrameBuffer(tracker_id, &buffer) == PSMResult_Success)
-            {
-                m_renderTrackerIter->second.textureAsset->copyBufferIntoTexture(buffer);
-            }
-        }
+        m_renderTrackerIter->second.textureAsset->copyTrackerVideoFrameIntoTexture(tracker_id);
     }
 }
 
@@ -1071,9 +1064,11 @@ void AppStage_ComputeTrackerPoses::request_start_controller_stream(
         PSMStreamFlags_includePhysicsData;
 
     // If we are jumping straight to testing, we want the ROI optimization on
+    // and don't need the samples from every tracker used by the mat calibration
     if (!m_bSkipCalibration)
     {
         flags|= PSMStreamFlags_disableROI;
+        flags|= PSMStreamFlags_includeAllTrackerData;
     }
 
     // Start off getting getting projection data from tracker 0
@@ -1255,6 +1250,12 @@ void AppStage_ComputeTrackerPoses::request_start_hmd_stream(
         PSMStreamFlags_includePositionData |
         PSMStreamFlags_includeRawTrackerData;
 
+    // The mat calibration samples every tracker at once
+    if (!m_bSkipCalibration)
+    {
+        flags|= PSMStreamFlags_includeAllTrackerData;
+    }
+
     // Start off getting getting projection data from tracker 0
     {
         PSMRequestID requestId;
@@ -23,6 +23,11 @@
 #include "opencv2/opencv.hpp"
 #include "opencv2/calib3d/calib3d.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -54,7 +59,205 @@ static const char *k_video_display_mode_names[] = {
 
 #define STRAIGHT_LINE_TOLERANCE 5 // error tolerance in pixels
 
+// The chessboard search runs on frames downscaled to about this width,
+// the corners it finds are then refined on the full resolution frame
+#define DETECTION_FRAME_WIDTH 320
+#define MAX_DETECTION_WORKER_COUNT 4
+
+// Start calibrating in the background once this many boards are captured
+#define INCREMENTAL_CALIBRATION_MIN_BOARD_COUNT 4
+
 //-- private definitions -----
+// Searches the most recently posted grayscale frame for the chessboard on a small pool of worker threads.
+// A frame posted while every worker is busy replaces the waiting one,
+// so the search never falls behind the video stream.
+class ChessboardDetectionPool
+{
+public:
+    ChessboardDetectionPool()
+        : m_bExitRequested(false)
+        , m_pendingSequence(0)
+        , m_postedSequence(0)
+        , m_bResultFound(false)
+        , m_resultSequence(0)
+        , m_fetchedSequence(0)
+    {
+        const int core_count= static_cast<int>(std::thread::hardware_concurrency());
+        const int worker_count= std::max(std::min(core_count - 1, MAX_DETECTION_WORKER_COUNT), 1);
+
+        for (int worker_index= 0; worker_index < worker_count; ++worker_index)
+        {
+            m_workers.push_back(std::thread(&ChessboardDetectionPool::workerFunc, this));
+        }
+    }
+
+    ~ChessboardDetectionPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_bExitRequested= true;
+        }
+        m_condition.notify_all();
+
+        for (std::thread &worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    void postFrame(const cv::Mat &gsFrame)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            gsFrame.copyTo(m_pendingFrame);
+            m_pendingSequence= ++m_postedSequence;
+        }
+        m_condition.notify_one();
+    }
+
+    // Returns true if a frame got searched since the last fetch
+    bool fetchResult(bool &out_bFound, std::vector<cv::Point2f> &out_corners)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bool bNewResult= false;
+
+        if (m_resultSequence != m_fetchedSequence)
+        {
+            out_bFound= m_bResultFound;
+            out_corners= m_resultCorners;
+            m_fetchedSequence= m_resultSequence;
+            bNewResult= true;
+        }
+
+        return bNewResult;
+    }
+
+    // Drops the waiting frame along with the results of every frame posted so far
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pendingSequence= 0;
+        m_resultSequence= m_postedSequence;
+        m_fetchedSequence= m_postedSequence;
+    }
+
+private:
+    void workerFunc()
+    {
+        cv::Mat gsFrame;
+        cv::Mat gsSmallFrame;
+        std::vector<cv::Point2f> corners;
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        for (;;)
+        {
+            m_condition.wait(lock, [this]() { return m_bExitRequested || m_pendingSequence != 0; });
+
+            if (m_bExitRequested)
+            {
+                break;
+            }
+
+            // Swap the buffers so that the next post reuses our old frame buffer
+            cv::swap(gsFrame, m_pendingFrame);
+            const unsigned int sequence= m_pendingSequence;
+            m_pendingSequence= 0;
+
+            lock.unlock();
+            const bool bFound= findChessboard(gsFrame, gsSmallFrame, corners);
+            lock.lock();
+
+            // Another worker may have finished a newer frame already
+            if (sequence > m_resultSequence)
+            {
+                m_bResultFound= bFound;
+                m_resultCorners= corners;
+                m_resultSequence= sequence;
+            }
+        }
+    }
+
+    static bool findChessboard(
+        const cv::Mat &gsFrame, 
+        cv::Mat &gsSmallFrame, 
+        std::vector<cv::Point2f> &out_corners)
+    {
+        const float downscale= 
+            (gsFrame.cols > DETECTION_FRAME_WIDTH) 
+            ? static_cast<float>(DETECTION_FRAME_WIDTH) / static_cast<float>(gsFrame.cols) 
+            : 1.f;
+        const cv::Mat *searchFrame= &gsFrame;
+
+        if (downscale < 1.f)
+        {
+            cv::resize(gsFrame, gsSmallFrame, cv::Size(), downscale, downscale, cv::INTER_AREA);
+            searchFrame= &gsSmallFrame;
+        }
+
+        out_corners.clear();
+
+        // Find chessboard corners:
+        bool bFound= 
+            cv::findChessboardCorners(
+                *searchFrame, 
+                cv::Size(PATTERN_W, PATTERN_H), 
+                out_corners, // output corners
+                cv::CALIB_CB_ADAPTIVE_THRESH 
+                + cv::CALIB_CB_FILTER_QUADS 
+                // + cv::CALIB_CB_NORMALIZE_IMAGE is suuuper slow
+                + cv::CALIB_CB_FAST_CHECK);
+
+        if (bFound)
+        {
+            // Move the corners back into the full resolution frame
+            if (searchFrame != &gsFrame)
+            {
+                const float upscale= 1.f / downscale;
+
+                for (cv::Point2f &corner : out_corners)
+                {
+                    corner*= upscale;
+                }
+            }
+
+            // Get subpixel accuracy on those corners
+            cv::cornerSubPix(
+                gsFrame, 
+                out_corners, // corners to refine
+                cv::Size(11, 11), // winSize- Half of the side length of the search window
+                cv::Size(-1, -1), // zeroZone- (-1,-1) means no dead zone in search
+                cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::MAX_ITER, 30, 0.1));
+        }
+
+        return bFound;
+    }
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_bExitRequested;
+
+    // Latest frame waiting for a worker (none when the sequence is 0)
+    cv::Mat m_pendingFrame;
+    unsigned int m_pendingSequence;
+    unsigned int m_postedSequence;
+
+    // Result of the newest searched frame
+    bool m_bResultFound;
+    std::vector<cv::Point2f> m_resultCorners;
+    unsigned int m_resultSequence;
+    unsigned int m_fetchedSequence;
+};
+
+struct CameraCalibrationResult
+{
+    double reprojectionError;
+    cv::Mat intrinsic_matrix;
+    cv::Mat distortion_coeffs;
+};
+
 class OpenCVBufferState
 {
 public:
@@ -63,6 +266,11 @@ public:
         , frameWidth(static_cast<int>(_trackerInfo.tracker_screen_dimensions.x))
         , frameHeight(static_cast<int>(_trackerInfo.tracker_screen_dimensions.y))
         , capturedBoardCount(0)
+        , captureGeneration(0)
+        , calibrationGeneration(0)
+        , calibratedBoardCount(0)
+        , bIsFinalCalibration(false)
+        , bHasCalibration(false)
     {
         // Video Frame data
         bgrSourceBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
@@ -84,6 +292,12 @@ public:
 
     virtual ~OpenCVBufferState()
     {
+        // Let a background calibration finish before its result has nowhere to go
+        if (calibrationResult.valid())
+        {
+            calibrationResult.wait();
+        }
+
         // Video Frame data
         delete bgrSourceBuffer;
         delete gsBuffer;
@@ -107,11 +321,18 @@ public:
         lastValidImagePoints.clear();
         quadList.clear();
         imagePointsList.clear();
+
+        // Anything still being searched or calibrated belongs to the old boards
+        detectionPool.flush();
+        ++captureGeneration;
     }
 
     void resetCalibrationState()
     {
         reprojectionError= 0.f;
+        calibratedBoardCount= 0;
+        bIsFinalCalibration= false;
+        bHasCalibration= false;
 
         // Fill in the intrinsic matrix
         intrinsic_matrix->at<double>(0, 0)= trackerInfo.tracker_focal_lengths.x;
@@ -137,13 +358,18 @@ public:
         rebuildDistortionMap();
     }
 
-    void applyVideoFrame(const unsigned char *video_buffer)
+    // Reads the next video frame from shared memory straight into the bgr source buffer
+    bool pollVideoFrame(PSMTrackerID tracker_id)
     {
-        const cv::Mat videoBufferMat(frameHeight, frameWidth, CV_8UC3, const_cast<unsigned char *>(video_buffer));
-
-        // Copy and Flip image about the x-axis
-        videoBufferMat.copyTo(*bgrSourceBuffer);
+        return 
+            PSM_PollTrackerVideoStreamIntoBuffer(
+                tracker_id, 
+                bgrSourceBuffer->data, 
+                bgrSourceBuffer->total()*bgrSourceBuffer->elemSize()) == PSMResult_Success;
+    }
 
+    void applyVideoFrame()
+    {
         // Convert the video buffer to a grayscale image
         cv::cvtColor(*bgrSourceBuffer, *gsBuffer, cv::COLOR_BGR2GRAY);
         cv::cvtColor(*gsBuffer, *gsBGRBuffer, cv::COLOR_GRAY2BGR);
@@ -157,29 +383,17 @@ public:
 
     void findAndAppendNewChessBoard(bool appWantsAppend)
     {
-        
         if (capturedBoardCount < DESIRED_CAPTURE_BOARD_COUNT)
         {
+            bool bFound= false;
             std::vector<cv::Point2f> new_image_points;
 
-            // Find chessboard corners:
-            if (cv::findChessboardCorners(
-                    *gsBuffer, 
-                    cv::Size(PATTERN_W, PATTERN_H), 
-                    new_image_points, // output corners
-                    cv::CALIB_CB_ADAPTIVE_THRESH 
-                    + cv::CALIB_CB_FILTER_QUADS 
-                    // + cv::CALIB_CB_NORMALIZE_IMAGE is suuuper slow
-                    + cv::CALIB_CB_FAST_CHECK))
-            {
-                // Get subpixel accuracy on those corners
-                cv::cornerSubPix(
-                    *gsBuffer, 
-                    new_image_points, // corners to refine
-                    cv::Size(11, 11), // winSize- Half of the side length of the search window
-                    cv::Size(-1, -1), // zeroZone- (-1,-1) means no dead zone in search
-                    cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::MAX_ITER, 30, 0.1));
+            // Hand the new frame to the detection workers and pick up whatever they found since the last frame.
+            // The corners belong to a frame or two ago, which doesn't matter for a board held still.
+            detectionPool.postFrame(*gsBuffer);
 
+            if (detectionPool.fetchResult(bFound, new_image_points) && bFound)
+            {
                 // Append the new chessboard corner pixels into the image_points matrix
                 // Append the corresponding 3d chessboard corners into the object_points matrix
                 if (new_image_points.size() == CORNER_COUNT) 
@@ -291,35 +505,96 @@ public:
         return fabsf(safe_divide_with_default(area, line_length, 0.f));
     }
 
-    bool computeCameraCalibration(const float square_length_mm)
+    bool getIsCalibrating() const
     {
-        bool bSuccess= false;
+        return calibrationResult.valid();
+    }
+
+    // Calibrates with the boards captured so far on a background thread,
+    // starting from the previous calibration if there is one
+    bool startCameraCalibration(const float square_length_mm)
+    {
+        bool bStarted= false;
 
-        if (capturedBoardCount >= DESIRED_CAPTURE_BOARD_COUNT)
+        if (!getIsCalibrating() && 
+            capturedBoardCount >= INCREMENTAL_CALIBRATION_MIN_BOARD_COUNT &&
+            capturedBoardCount > calibratedBoardCount)
         {
             // Only need to calculate objectPointsList once,
             // then resize for each set of image points.
             std::vector<std::vector<cv::Point3f> > objectPointsList(1);
             calcBoardCornerPositions(square_length_mm, objectPointsList[0]);
             objectPointsList.resize(imagePointsList.size(), objectPointsList[0]);
-            
-            // Compute the camera intrinsic matrix and distortion parameters
-            reprojectionError= 
-                cv::calibrateCamera(
-                    objectPointsList, imagePointsList,
-                    cv::Size(frameWidth, frameHeight), 
-                    *intrinsic_matrix, *distortion_coeffs, // Output we care about
-                    cv::noArray(), cv::noArray(), // best fit board poses as rvec/tvec pairs
-                    cv::CALIB_FIX_ASPECT_RATIO,
-                    cv::TermCriteria(cv::TermCriteria::COUNT + cv::TermCriteria::EPS, 30, DBL_EPSILON));
-            
-            // Regenerate the distortion map now for the new calibration
-            rebuildDistortionMap();
-
-            bSuccess= true;
+
+            const cv::Size frameSize(frameWidth, frameHeight);
+            const int flags= 
+                cv::CALIB_FIX_ASPECT_RATIO | 
+                (bHasCalibration ? cv::CALIB_USE_INTRINSIC_GUESS : 0);
+            CameraCalibrationResult guess;
+            guess.reprojectionError= 0.0;
+            intrinsic_matrix->copyTo(guess.intrinsic_matrix);
+            distortion_coeffs->copyTo(guess.distortion_coeffs);
+
+            // The job works on its own copies of the boards so that capturing can carry on
+            calibrationResult= std::async(
+                std::launch::async, 
+                &OpenCVBufferState::computeCameraCalibration, 
+                objectPointsList, imagePointsList, frameSize, guess, flags);
+            calibrationGeneration= captureGeneration;
+            calibratedBoardCount= capturedBoardCount;
+            bIsFinalCalibration= capturedBoardCount >= DESIRED_CAPTURE_BOARD_COUNT;
+            bStarted= true;
+        }
+
+        return bStarted;
+    }
+
+    // Returns true once the calibration with all of the desired boards is done
+    bool pollCameraCalibration()
+    {
+        bool bIsComplete= false;
+
+        if (getIsCalibrating() && 
+            calibrationResult.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            CameraCalibrationResult result= calibrationResult.get();
+
+            // Drop calibrations of boards that got thrown away meanwhile
+            if (calibrationGeneration == captureGeneration)
+            {
+                reprojectionError= result.reprojectionError;
+                result.intrinsic_matrix.copyTo(*intrinsic_matrix);
+                result.distortion_coeffs.copyTo(*distortion_coeffs);
+                bHasCalibration= true;
+
+                // Regenerate the distortion map now for the new calibration
+                rebuildDistortionMap();
+
+                bIsComplete= bIsFinalCalibration;
+            }
         }
 
-        return bSuccess;
+        return bIsComplete;
+    }
+
+    static CameraCalibrationResult computeCameraCalibration(
+        const std::vector<std::vector<cv::Point3f> > objectPointsList,
+        const std::vector<std::vector<cv::Point2f> > imagePointsList,
+        const cv::Size frameSize,
+        CameraCalibrationResult result,
+        const int flags)
+    {
+        // Compute the camera intrinsic matrix and distortion parameters
+        result.reprojectionError= 
+            cv::calibrateCamera(
+                objectPointsList, imagePointsList,
+                frameSize, 
+                result.intrinsic_matrix, result.distortion_coeffs, // Output we care about
+                cv::noArray(), cv::noArray(), // best fit board poses as rvec/tvec pairs
+                flags,
+                cv::TermCriteria(cv::TermCriteria::COUNT + cv::TermCriteria::EPS, 30, DBL_EPSILON));
+
+        return result;
     }
 
     void rebuildDistortionMap()
@@ -358,7 +633,9 @@ public:
     cv::Mat *bgrUndistortBuffer;
 
     // Chess board computed state
+    ChessboardDetectionPool detectionPool;
     int capturedBoardCount;
+    int captureGeneration;
     std::vector<cv::Point2f> lastValidImagePoints;
     std::vector<cv::Point2f> currentImagePoints;
     bool bCurrentImagePointsValid;
@@ -366,6 +643,11 @@ public:
     std::vector<std::vector<cv::Point2f>> imagePointsList;
 
     // Calibration state
+    std::future<CameraCalibrationResult> calibrationResult;
+    int calibrationGeneration;
+    int calibratedBoardCount;
+    bool bIsFinalCalibration;
+    bool bHasCalibration;
     double reprojectionError;
     cv::Mat *intrinsic_matrix;
     cv::Mat *distortion_coeffs;
@@ -434,50 +716,49 @@ void AppStage_DistortionCalibration::update()
         assert(m_video_texture != nullptr);
 
         // Try and read the next video frame from shared memory
-        if (PSM_PollTrackerVideoStream(m_tracker_view->tracker_info.tracker_id) == PSMResult_Success)
+        if (m_opencv_state->pollVideoFrame(m_tracker_view->tracker_info.tracker_id))
         {
-            const unsigned char *video_frame_buffer= nullptr;
-			if (PSM_GetTrackerVideoFrameBuffer(m_tracker_view->tracker_info.tracker_id, &video_frame_buffer) == PSMResult_Success)
-			{
-				// Update the video frame buffers
-				m_opencv_state->applyVideoFrame(video_frame_buffer);
+            // Update the video frame buffers
+            m_opencv_state->applyVideoFrame();
 
-				// Update the video frame display texture
-				switch (m_videoDisplayMode)
-				{
-				case AppStage_DistortionCalibration::mode_bgr:
-					m_video_texture->copyBufferIntoTexture(m_opencv_state->bgrSourceBuffer->data);
-					break;
-				case AppStage_DistortionCalibration::mode_grayscale:
-					m_video_texture->copyBufferIntoTexture(m_opencv_state->gsBGRBuffer->data);
-					break;
-				case AppStage_DistortionCalibration::mode_undistored:
-					m_video_texture->copyBufferIntoTexture(m_opencv_state->bgrUndistortBuffer->data);
-					break;
-				default:
-					assert(0 && "unreachable");
-					break;
-				}
-			}
+            // Update the video frame display texture
+            switch (m_videoDisplayMode)
+            {
+            case AppStage_DistortionCalibration::mode_bgr:
+                m_video_texture->copyBufferIntoTexture(m_opencv_state->bgrSourceBuffer->data);
+                break;
+            case AppStage_DistortionCalibration::mode_grayscale:
+                m_video_texture->copyBufferIntoTexture(m_opencv_state->gsBGRBuffer->data);
+                break;
+            case AppStage_DistortionCalibration::mode_undistored:
+                m_video_texture->copyBufferIntoTexture(m_opencv_state->bgrUndistortBuffer->data);
+                break;
+            default:
+                assert(0 && "unreachable");
+                break;
+            }
 
             if (m_menuState == AppStage_DistortionCalibration::capture)
             {
-                
                 // Update the chess board capture state
                 ImGuiIO io_state = ImGui::GetIO();
                 m_opencv_state->findAndAppendNewChessBoard(io_state.KeysDown[32]);
+            }
+        }
 
-                if (m_opencv_state->capturedBoardCount >= DESIRED_CAPTURE_BOARD_COUNT)
-                {
-                    
-                    m_opencv_state->computeCameraCalibration(m_square_length_mm); //Will update intrinsic_matrix and distortion_coeffs
-                    cv::Mat *intrinsic_matrix= m_opencv_state->intrinsic_matrix;
-                    cv::Mat *distortion_coeffs= m_opencv_state->distortion_coeffs;
-                    
-                    
-                    float frameWidth= static_cast<float>(m_opencv_state->frameWidth);
-                    float frameHeight= static_cast<float>(m_opencv_state->frameHeight);
-                    
+        if (m_menuState == AppStage_DistortionCalibration::capture)
+        {
+            // Calibration runs in the background while the boards are captured.
+            // Each new board refines the previous result, so the last calibration is a short one.
+            if (m_opencv_state->pollCameraCalibration())
+            {
+                cv::Mat *intrinsic_matrix= m_opencv_state->intrinsic_matrix;
+                cv::Mat *distortion_coeffs= m_opencv_state->distortion_coeffs;
+                
+                
+                float frameWidth= static_cast<float>(m_opencv_state->frameWidth);
+                float frameHeight= static_cast<float>(m_opencv_state->frameHeight);
+                
 //                    double apertureWidthmm = 3.984;
 //                    double apertureHeightmm = 2.952;
 //                    double fovX;
@@ -499,32 +780,35 @@ void AppStage_DistortionCalibration::update()
 //                    std::cout << "; aspectRatio: " << aspectRatio;
 //                    std::cout << "; principalPoint: " << principalPoint.x << ", " << principalPoint.y;
 //                    std::cout << std::endl;
-                    
-                    const float f_x= static_cast<float>(intrinsic_matrix->at<double>(0, 0));
-                    const float f_y= static_cast<float>(intrinsic_matrix->at<double>(1, 1));
-                    const float p_x= static_cast<float>(intrinsic_matrix->at<double>(0, 2));
-                    const float p_y= static_cast<float>(intrinsic_matrix->at<double>(1, 2));
-
-                    const float k_1= static_cast<float>(distortion_coeffs->at<double>(0, 0));
-                    const float k_2= static_cast<float>(distortion_coeffs->at<double>(1, 0));
-                    const float p_1= static_cast<float>(distortion_coeffs->at<double>(2, 0));
-                    const float p_2= static_cast<float>(distortion_coeffs->at<double>(3, 0));
-                    const float k_3= static_cast<float>(distortion_coeffs->at<double>(4, 0));
-                    
-                    double fovx = 2 * atan(frameWidth / (2 * f_x)) * 180.0 / CV_PI;
-                    double fovy = 2 * atan(frameHeight / (2 * f_y)) * 180.0 / CV_PI;
-                    std::cout << "Manual fov x: " << fovx << "; y: " << fovy << std::endl;
-
-                    // Update the camera intrinsics for this camera
-                    request_tracker_set_intrinsic(
-                        f_x, f_y,
-                        p_x, p_y,
-                        k_1, k_2, k_3,
-                        p_1, p_2);
-
-                    m_videoDisplayMode= AppStage_DistortionCalibration::mode_undistored;
-                    m_menuState= AppStage_DistortionCalibration::complete;
-                }
+                
+                const float f_x= static_cast<float>(intrinsic_matrix->at<double>(0, 0));
+                const float f_y= static_cast<float>(intrinsic_matrix->at<double>(1, 1));
+                const float p_x= static_cast<float>(intrinsic_matrix->at<double>(0, 2));
+                const float p_y= static_cast<float>(intrinsic_matrix->at<double>(1, 2));
+
+                const float k_1= static_cast<float>(distortion_coeffs->at<double>(0, 0));
+                const float k_2= static_cast<float>(distortion_coeffs->at<double>(1, 0));
+                const float p_1= static_cast<float>(distortion_coeffs->at<double>(2, 0));
+                const float p_2= static_cast<float>(distortion_coeffs->at<double>(3, 0));
+                const float k_3= static_cast<float>(distortion_coeffs->at<double>(4, 0));
+                
+                double fovx = 2 * atan(frameWidth / (2 * f_x)) * 180.0 / CV_PI;
+                double fovy = 2 * atan(frameHeight / (2 * f_y)) * 180.0 / CV_PI;
+                std::cout << "Manual fov x: " << fovx << "; y: " << fovy << std::endl;
+
+                // Update the camera intrinsics for this camera
+                request_tracker_set_intrinsic(
+                    f_x, f_y,
+                    p_x, p_y,
+                    k_1, k_2, k_3,
+                    p_1, p_2);
+
+                m_videoDisplayMode= AppStage_DistortionCalibration::mode_undistored;
+                m_menuState= AppStage_DistortionCalibration::complete;
+            }
+            else
+            {
+                m_opencv_state->startCameraCalibration(m_square_length_mm);
             }
         }
     }
@@ -717,13 +1001,22 @@ void AppStage_DistortionCalibration::renderUI()
 
             {
                 ImGui::SetNextWindowPos(ImVec2(ImGui::GetIO().DisplaySize.x / 2.f - k_panel_width / 2.f, 20.f));
-                ImGui::SetNextWindowSize(ImVec2(k_panel_width, 110));
+                ImGui::SetNextWindowSize(ImVec2(k_panel_width, 130));
                 ImGui::Begin(k_window_title, nullptr, window_flags);
 
                 const float samplePercentage= 
                     static_cast<float>(m_opencv_state->capturedBoardCount) / static_cast<float>(DESIRED_CAPTURE_BOARD_COUNT);
                 ImGui::ProgressBar(samplePercentage, ImVec2(k_panel_width - 20, 20));
 
+                if (m_opencv_state->capturedBoardCount >= DESIRED_CAPTURE_BOARD_COUNT)
+                {
+                    ImGui::Text("Computing calibration...");
+                }
+                else if (m_opencv_state->bHasCalibration)
+                {
+                    ImGui::Text("Error: %f", m_opencv_state->reprojectionError);
+                }
+
                 if (ImGui::Button("Restart"))
                 {
                     m_opencv_state->resetCaptureState();
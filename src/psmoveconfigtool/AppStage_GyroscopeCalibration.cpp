@@ -25,82 +25,46 @@ const char *AppStage_GyroscopeCalibration::APP_STAGE_NAME = "GyroscopeCalibratio
 
 //-- constants -----
 const double k_stabilize_wait_time_ms = 1000.f;
-const int k_desired_noise_sample_count = 1000;
-const float k_desired_drift_sampling_time = 30.0*1000.f; // milliseconds
+// Every IMU reading the service records, both readings of each PSMove report (tens of seconds worth)
+const int k_desired_noise_sample_count = 6000;
+const float k_imu_capture_poll_interval_ms = 100.f;
 
 const int k_desired_scale_sample_count = 1000;
 
 //-- definitions -----
 struct GyroscopeNoiseSamples
 {
-	PSMVector3i raw_gyro_samples[k_desired_noise_sample_count];
-    PSMVector3f calibrated_omega_samples[k_desired_noise_sample_count];
-    PSMVector3f drift_rotation;
-    std::chrono::time_point<std::chrono::high_resolution_clock> sampleStartTime;
+	// Statistics gathered by the service, see SAMPLE_CONTROLLER_IMU
     int sample_count;
+    bool bIsComplete;
 
 	PSMVector3f raw_bias; // The average bias in the raw gyro measurement per frame
-    float angular_drift_variance; // Max sensor variance (raw_sensor_units/s/s for DS4, rad/s/s for PSMove)
-    float angular_drift_rate; // Max drift rate (raw_sensor_units/s for DS4, rad/s for PSMove)
+    float angular_drift_variance; // Max sensor variance (rad/s/s)
+    float angular_drift_rate; // Max drift rate (rad/s)
 
     void clear()
     {
-        drift_rotation= *k_psm_float_vector3_zero;
         sample_count= 0;
+        bIsComplete= false;
 		raw_bias= *k_psm_float_vector3_zero;
         angular_drift_variance= 0.f;
         angular_drift_rate= 0.f;
     }
 
-    void computeStatistics(std::chrono::duration<float, std::milli> sampleDurationMilli)
-    {
-        const float sampleDurationSeconds= sampleDurationMilli.count() / 1000.f;
-        const float N = static_cast<float>(sample_count);
-
-        // Compute the mean of the raw gyro measurements
-        // If this is a non-zero value then the gyro has some per frame
-		// bias we need to subtract off.
-        raw_bias= *k_psm_float_vector3_zero;
-        for (int sample_index = 0; sample_index < sample_count; sample_index++)
-        {
-            PSMVector3f raw_sample= PSM_Vector3iCastToFloat(&raw_gyro_samples[sample_index]);
-
-            raw_bias= PSM_Vector3fAdd(&raw_bias, &raw_sample);
-        }
-        raw_bias= PSM_Vector3fUnsafeScalarDivide(&raw_bias, N);
-
-        // Compute the mean of the error samples, where "error" = abs(omega_sample)
-        // If the gyro has little to no bias then the  mean of the signed omega samples 
-		// would be very close to zero since the the gyro at rest over a short period has mean-zero noise
-        PSMVector3f mean_omega_error= *k_psm_float_vector3_zero;
-        for (int sample_index = 0; sample_index < sample_count; sample_index++)
-        {
-            PSMVector3f error_sample= PSM_Vector3fAbs(&calibrated_omega_samples[sample_index]);
-
-            mean_omega_error= PSM_Vector3fAdd(&mean_omega_error, &error_sample);
-        }
-        mean_omega_error= PSM_Vector3fUnsafeScalarDivide(&mean_omega_error, N);
-
-        // Compute the variance of the (unsigned) sample error, where "error" = abs(omega_sample)
-        PSMVector3f var_omega= *k_psm_float_vector3_zero;
-        for (int sample_index = 0; sample_index < sample_count; sample_index++)
-        {
-            PSMVector3f error_sample= PSM_Vector3fAbs(&calibrated_omega_samples[sample_index]);
-            PSMVector3f diff_from_mean= PSM_Vector3fSubtract(&error_sample, &mean_omega_error);
-            PSMVector3f diff_from_mean_sqrd= PSM_Vector3fSquare(&diff_from_mean);
-
-            var_omega= PSM_Vector3fAdd(&var_omega, &diff_from_mean);
-        }
-        var_omega= PSM_Vector3fUnsafeScalarDivide(&var_omega, N - 1);
-
-        // Use the max variance of all three axes (should be close)
-        angular_drift_variance= PSM_Vector3fMaxValue(&var_omega);
+	void applyStatistics(const PSMoveProtocol::Response_ResultControllerIMUSamples &result)
+	{
+		sample_count= result.sample_count();
+		bIsComplete= result.target_sample_count() > 0 && result.sample_count() >= result.target_sample_count();
 
-        // Compute the max drift rate we got across a three axis
-        PSMVector3f drift_rate= PSM_Vector3fUnsafeScalarDivide(&drift_rotation, sampleDurationSeconds);
-        PSMVector3f drift_rate_abs= PSM_Vector3fAbs(&drift_rate);
-        angular_drift_rate= PSM_Vector3fMaxValue(&drift_rate_abs);
-    }
+		if (bIsComplete)
+		{
+			raw_bias.x= result.raw_gyroscope_mean().i();
+			raw_bias.y= result.raw_gyroscope_mean().j();
+			raw_bias.z= result.raw_gyroscope_mean().k();
+			angular_drift_variance= result.gyroscope_variance_rad_per_sec_sqr();
+			angular_drift_rate= result.gyroscope_drift_rate_rad_per_sec();
+		}
+	}
 };
 
 //-- private methods -----
@@ -115,6 +79,9 @@ AppStage_GyroscopeCalibration::AppStage_GyroscopeCalibration(App *app)
     , m_isControllerStreamActive(false)
     , m_lastControllerSeqNum(-1)
     , m_lastRawGyroscope()
+    , m_bIMUCaptureStarted(false)
+    , m_bIMUCaptureRequestPending(false)
+    , m_lastIMUCaptureRequestTime()
     , m_gyroNoiseSamples(new GyroscopeNoiseSamples)
 {
 }
@@ -159,17 +126,16 @@ void AppStage_GyroscopeCalibration::enter()
 void AppStage_GyroscopeCalibration::exit()
 {
     assert(m_controllerView != nullptr);
+    // Leave the current state first, leaving a capture still needs the controller
+    setState(eCalibrationMenuState::inactive);
     PSM_FreeControllerListener(m_controllerView->ControllerID);
     m_controllerView = nullptr;
-    setState(eCalibrationMenuState::inactive);
 }
 
 void AppStage_GyroscopeCalibration::update()
 {
     bool bControllerDataUpdatedThisFrame = false;
-    bool bTimeDeltaValid = false;
     std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<float, std::milli> sampleTimeDeltaMilli(0);
 
     if (m_isControllerStreamActive && m_controllerView->OutputSequenceNum != m_lastControllerSeqNum)
     {
@@ -202,15 +168,6 @@ void AppStage_GyroscopeCalibration::update()
         }
 
         m_lastControllerSeqNum = m_controllerView->OutputSequenceNum;
-        
-        if (m_bLastSampleTimeValid)
-        {
-            sampleTimeDeltaMilli = now - m_lastSampleTime;
-        }
-
-        m_lastSampleTime= now;
-        m_bLastSampleTimeValid= true;
-        
         bControllerDataUpdatedThisFrame = true;
     }
 
@@ -251,7 +208,6 @@ void AppStage_GyroscopeCalibration::update()
                     if (stableDuration.count() >= k_stabilize_wait_time_ms)
                     {
                         m_gyroNoiseSamples->clear();
-                        m_gyroNoiseSamples->sampleStartTime= now;
                         setState(eCalibrationMenuState::measureBiasAndDrift);
                     }
                 }
@@ -276,30 +232,20 @@ void AppStage_GyroscopeCalibration::update()
 
             if ((bCanBeStabilized && bIsStable) || m_bForceControllerStable)
             {
-                const std::chrono::duration<float, std::milli> sampleDurationMilli = now - m_gyroNoiseSamples->sampleStartTime;
-                const float deltaTimeSeconds= sampleTimeDeltaMilli.count()/1000.f;
+				// The service records every IMU reading itself, we just poll for the statistics
+				if (m_bIMUCaptureStarted && !m_bIMUCaptureRequestPending)
+				{
+					std::chrono::duration<float, std::milli> timeSinceLastPoll = now - m_lastIMUCaptureRequestTime;
 
-                // Accumulate the drift total
-                if (deltaTimeSeconds > 0.f)
-                {
-					m_gyroNoiseSamples->drift_rotation= 
-						PSM_Vector3fScaleAndAdd(&m_lastCalibratedGyroscope, deltaTimeSeconds, &m_gyroNoiseSamples->drift_rotation);
-                }
-
-                // Record the next noise sample
-                if (m_gyroNoiseSamples->sample_count < k_desired_noise_sample_count)
-                {
-					m_gyroNoiseSamples->raw_gyro_samples[m_gyroNoiseSamples->sample_count]= m_lastRawGyroscope;
-                    m_gyroNoiseSamples->calibrated_omega_samples[m_gyroNoiseSamples->sample_count]= m_lastCalibratedGyroscope;
-                    ++m_gyroNoiseSamples->sample_count;
-                }
+					if (timeSinceLastPoll.count() >= k_imu_capture_poll_interval_ms)
+					{
+						request_sample_imu(false, 0);
+					}
+				}
 
                 // See if we have completed the sampling period
-                if (sampleDurationMilli.count() >= k_desired_drift_sampling_time)
+                if (m_gyroNoiseSamples->bIsComplete)
                 {
-                    // Compute bias and drift statistics
-                    m_gyroNoiseSamples->computeStatistics(sampleDurationMilli);
-
                     // Update the gyro config on the service
                     request_set_gyroscope_calibration(
 						m_gyroNoiseSamples->raw_bias,
@@ -477,10 +423,6 @@ void AppStage_GyroscopeCalibration::renderUI()
             ImGui::SetNextWindowSize(ImVec2(k_panel_width, 130));
             ImGui::Begin(k_window_title, nullptr, window_flags);
 
-            std::chrono::time_point<std::chrono::high_resolution_clock> now= std::chrono::high_resolution_clock::now();
-            std::chrono::duration<double, std::milli> stableDuration = now - m_gyroNoiseSamples->sampleStartTime;
-            float timeFraction = static_cast<float>(stableDuration.count() / k_desired_drift_sampling_time);
-
             const float sampleFraction = 
                 static_cast<float>(m_gyroNoiseSamples->sample_count)
                 / static_cast<float>(k_desired_noise_sample_count);
@@ -488,7 +430,7 @@ void AppStage_GyroscopeCalibration::renderUI()
             ImGui::TextWrapped(
                 "[Step 1 of 2: Measuring gyroscope drift and bias]\n" \
                 "Sampling Gyroscope...");
-            ImGui::ProgressBar(fminf(sampleFraction, timeFraction), ImVec2(250, 20));
+            ImGui::ProgressBar(fminf(sampleFraction, 1.f), ImVec2(250, 20));
 
             if (ImGui::Button("Cancel"))
             {
@@ -609,7 +551,11 @@ void AppStage_GyroscopeCalibration::onExitState(eCalibrationMenuState newState)
 	case eCalibrationMenuState::waitingForStreamStartResponse:
 	case eCalibrationMenuState::failedStreamStart:
 	case eCalibrationMenuState::waitForStable:
+		break;
 	case eCalibrationMenuState::measureBiasAndDrift:
+		// Stop the service from recording any further
+		request_sample_imu(true, 0);
+		break;
 	case eCalibrationMenuState::measureComplete:
 	case eCalibrationMenuState::test:
 		break;
@@ -641,6 +587,9 @@ void AppStage_GyroscopeCalibration::onEnterState(eCalibrationMenuState newState)
 		m_bIsStable= false;
 		break;
 	case eCalibrationMenuState::measureBiasAndDrift:
+		// Have the service start recording the IMU readings
+		m_bIMUCaptureStarted= false;
+		request_sample_imu(true, k_desired_noise_sample_count);
 		break;
 	case eCalibrationMenuState::measureComplete:
 		// Reset the menu state
@@ -753,6 +702,69 @@ void AppStage_GyroscopeCalibration::request_set_gyroscope_calibration(
     PSM_SendOpaqueRequest(&request, nullptr);
 }
 
+void AppStage_GyroscopeCalibration::request_sample_imu(
+	const bool bStartSampling,
+	const int sample_count)
+{
+    RequestPtr request(new PSMoveProtocol::Request());
+    request->set_type(PSMoveProtocol::Request_RequestType_SAMPLE_CONTROLLER_IMU);
+
+    PSMoveProtocol::Request_RequestSampleControllerIMU *sample_request =
+        request->mutable_request_sample_controller_imu();
+
+    sample_request->set_controller_id(m_controllerView->ControllerID);
+	sample_request->set_start_sampling(bStartSampling);
+	sample_request->set_sample_count(sample_count);
+
+	PSMRequestID request_id;
+	PSM_SendOpaqueRequest(&request, &request_id);
+
+	if (bStartSampling)
+	{
+		PSM_RegisterCallback(request_id, AppStage_GyroscopeCalibration::handle_start_imu_sampling_response, this);
+	}
+	else
+	{
+		PSM_RegisterCallback(request_id, AppStage_GyroscopeCalibration::handle_sample_imu_response, this);
+		m_bIMUCaptureRequestPending= true;
+	}
+
+	m_lastIMUCaptureRequestTime= std::chrono::high_resolution_clock::now();
+}
+
+void AppStage_GyroscopeCalibration::handle_start_imu_sampling_response(
+	const PSMResponseMessage *response,
+	void *userdata)
+{
+	AppStage_GyroscopeCalibration *thisPtr = reinterpret_cast<AppStage_GyroscopeCalibration *>(userdata);
+
+	// Responses come back in order, so every poll after this one sees the new capture
+	if (response->result_code == PSMResult_Success &&
+		thisPtr->m_menuState == eCalibrationMenuState::measureBiasAndDrift)
+	{
+		thisPtr->m_bIMUCaptureStarted= true;
+	}
+}
+
+void AppStage_GyroscopeCalibration::handle_sample_imu_response(
+	const PSMResponseMessage *response,
+	void *userdata)
+{
+	AppStage_GyroscopeCalibration *thisPtr = reinterpret_cast<AppStage_GyroscopeCalibration *>(userdata);
+
+	thisPtr->m_bIMUCaptureRequestPending= false;
+
+	// Drop polls of an earlier capture that come in after it restarted
+	if (response->result_code == PSMResult_Success &&
+		thisPtr->m_bIMUCaptureStarted &&
+		thisPtr->m_menuState == eCalibrationMenuState::measureBiasAndDrift)
+	{
+		const PSMoveProtocol::Response *protocol_response = GET_PSMOVEPROTOCOL_RESPONSE(response->opaque_response_handle);
+
+		thisPtr->m_gyroNoiseSamples->applyStatistics(protocol_response->result_controller_imu_samples());
+	}
+}
+
 void AppStage_GyroscopeCalibration::handle_acquire_controller(
     const PSMResponseMessage *response,
     void *userdata)
@@ -57,6 +57,13 @@ protected:
 		void *userdata);
     void request_set_gyroscope_calibration(
 		const PSMVector3f &raw_bias, const float raw_drift, const float raw_variance);
+	void request_sample_imu(const bool bStartSampling, const int sample_count);
+	static void handle_start_imu_sampling_response(
+		const PSMResponseMessage *response,
+		void *userdata);
+	static void handle_sample_imu_response(
+		const PSMResponseMessage *response,
+		void *userdata);
     static void handle_acquire_controller(
         const PSMResponseMessage *response,
         void *userdata);
@@ -71,9 +78,6 @@ private:
     bool m_isControllerStreamActive;
     int m_lastControllerSeqNum;
 
-    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastSampleTime;
-    bool m_bLastSampleTimeValid;
-
     PSMVector3i m_lastRawGyroscope;
     PSMVector3f m_lastCalibratedGyroscope;
     PSMVector3f m_lastCalibratedAccelerometer;
@@ -82,6 +86,11 @@ private:
     bool m_bIsStable;
 	bool m_bForceControllerStable;
 
+	// Service side IMU capture, see SAMPLE_CONTROLLER_IMU
+	bool m_bIMUCaptureStarted;
+	bool m_bIMUCaptureRequestPending;
+	std::chrono::time_point<std::chrono::high_resolution_clock> m_lastIMUCaptureRequestTime;
+
     struct GyroscopeNoiseSamples *m_gyroNoiseSamples;
 	float m_global_forward_degrees;
 };
@@ -33,6 +33,7 @@
 namespace SICP
 {
 	typedef Eigen::Matrix<double, 3, Eigen::Dynamic> Vertices;
+	typedef nanoflann::KDTreeAdaptor<Vertices, 3, nanoflann::metric_L2_Simple> KDTree;
 };
 
 //-- statics ----
@@ -48,6 +49,7 @@ static float k_cosine_aligned_camera_angle = cosf(60.f *k_degrees_to_radians);
 static const float k_default_correspondance_tolerance = 0.2f;
 
 static const float k_icp_point_snap_distance = 3.0; // cm
+static const float k_icp_point_snap_distance_sqrd = k_icp_point_snap_distance*k_icp_point_snap_distance;
 
 static const glm::vec3 k_psmove_frustum_color = glm::vec3(0.1f, 0.7f, 0.3f);
 static const glm::vec3 k_psmove_frustum_color_no_track = glm::vec3(1.0f, 0.f, 0.f);
@@ -110,7 +112,6 @@ struct LEDModelSamples
 {
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
-	Eigen::Vector3f position_samples[k_led_position_sample_count];
 	Eigen::Vector3f average_position;
 	int position_sample_count;
 
@@ -126,25 +127,11 @@ struct LEDModelSamples
 
 		if (position_sample_count < k_led_position_sample_count)
 		{
-			position_samples[position_sample_count] = point;
 			++position_sample_count;
 
-			// Recompute the average position
-			if (position_sample_count > 1)
-			{
-				const float N = static_cast<float>(position_sample_count);
-
-				average_position = Eigen::Vector3f::Zero();
-				for (int position_index = 0; position_index < position_sample_count; ++position_index)
-				{
-					average_position += position_samples[position_index];
-				}
-				average_position /= N;
-			}
-			else
-			{
-				average_position = position_samples[0];
-			}
+			// Update the running average position
+			const float N = static_cast<float>(position_sample_count);
+			average_position += (point - average_position) / N;
 
 			bAdded = true;
 		}
@@ -162,7 +149,9 @@ public:
 		: m_expectedLEDCount(trackerLEDCount)
 		, m_seenLEDCount(0)
 		, m_totalLEDSampleCount(0)
+		, m_lastAlignmentError(0.f)
         , m_ledSampleSet(new LEDModelSamples[trackerLEDCount])
+		, m_icpTargetKdTree(nullptr)
 	{
 		m_icpTransform = Eigen::Affine3d::Identity();
 
@@ -174,6 +163,7 @@ public:
 
 	~HMDModelState()
 	{
+		delete m_icpTargetKdTree;
 		delete[] m_ledSampleSet;
 	}
 
@@ -186,12 +176,28 @@ public:
 
 	float getProgressFraction() const 
 	{
-		const float expectedSampleCount = static_cast<float>(m_seenLEDCount * k_led_position_sample_count);
+		const float expectedSampleCount = static_cast<float>(m_expectedLEDCount * k_led_position_sample_count);
 		const float fraction = static_cast<float>(m_totalLEDSampleCount) / expectedSampleCount;
 
 		return fraction;
 	}
 
+	int getSeenLEDCount() const
+	{
+		return m_seenLEDCount;
+	}
+
+	int getExpectedLEDCount() const
+	{
+		return m_expectedLEDCount;
+	}
+
+	// Mean distance (cm) between the last aligned points and their closest LED
+	float getLastAlignmentError() const
+	{
+		return m_lastAlignmentError;
+	}
+
 	void recordSamples(PSMHeadMountedDisplay *hmd_view, TrackerPairState *tracker_pair_state)
 	{
 		if (triangulateHMDProjections(hmd_view, tracker_pair_state, m_lastTriangulatedPoints))
@@ -214,28 +220,35 @@ public:
 						icpSourceVertices(2, source_index) = point.z();
 					}
 
-					// Build kd-tree of the current set of target vertices
-					nanoflann::KDTreeAdaptor<SICP::Vertices, 3, nanoflann::metric_L2_Simple> kdtree(m_icpTargetVertices);
+					// The HMD barely moves between frames,
+					// so start the alignment from where the last frame ended up
+					SICP::Vertices icpInitialSourceVertices = icpSourceVertices;
+					icpSourceVertices = m_icpTransform * icpSourceVertices;
 
 					// Attempt to align the new triangulated points with the previously found LED locations
-					// using the ICP algorithm
+					// using the ICP algorithm and the kd-tree built when the LED locations last changed
 					SICP::Parameters params;
 					params.p = .5;
 					params.max_icp = 15;
-					params.print_icpn = true;
-					SICP::point_to_point(icpSourceVertices, m_icpTargetVertices, params);
+					SICP::point_to_point(icpSourceVertices, m_icpTargetVertices, *m_icpTargetKdTree, params);
+
+					// Remember the full alignment of this frame for the next one
+					m_icpTransform = RigidMotionEstimator::point_to_point(icpInitialSourceVertices, icpSourceVertices);
 
 					// Update the LED models based on the alignment
 					bool bUpdateTargetVertices = false;
+					double alignment_error_sum = 0.0;
 					for (int source_index = 0; source_index < icpSourceVertices.cols(); ++source_index)
 					{
-						const Eigen::Vector3d source_vertex = icpSourceVertices.col(source_index).cast<double>();
-						const int closest_led_index = kdtree.closest(source_vertex.data());
-						const Eigen::Vector3d closest_led_position = m_ledSampleSet[closest_led_index].average_position.cast<double>();
-						const double cloest_distance_sqrd = (closest_led_position - source_vertex).squaredNorm();
+						const Eigen::Vector3d source_vertex = icpSourceVertices.col(source_index);
+						int closest_led_index = 0;
+						double cloest_distance_sqrd = 0.0;
+
+						m_icpTargetKdTree->query(source_vertex.data(), 1, &closest_led_index, &cloest_distance_sqrd);
+						alignment_error_sum += sqrt(cloest_distance_sqrd);
 
 						// Add the points to the their respective bucket...
-						if (cloest_distance_sqrd <= k_icp_point_snap_distance)
+						if (cloest_distance_sqrd <= k_icp_point_snap_distance_sqrd)
 						{
 							bUpdateTargetVertices |= add_point_to_led_model(closest_led_index, source_vertex.cast<float>());
 						}
@@ -246,6 +259,8 @@ public:
 						}
 					}
 
+					m_lastAlignmentError = static_cast<float>(alignment_error_sum / static_cast<double>(icpSourceVertices.cols()));
+
 					if (bUpdateTargetVertices)
 					{
 						rebuildTargetVertices();
@@ -329,6 +344,11 @@ protected:
 			m_icpTargetVertices(1, led_index) = ledSample.y();
 			m_icpTargetVertices(2, led_index) = ledSample.z();
 		}
+
+		// The kd-tree indexes into the target vertices, so it has to follow them.
+		// Rebuilding it here means the ICP and the bucket lookup of a frame share one tree.
+		delete m_icpTargetKdTree;
+		m_icpTargetKdTree = new SICP::KDTree(m_icpTargetVertices);
 	}
 
 private:
@@ -336,10 +356,12 @@ private:
 	int m_expectedLEDCount;
 	int m_seenLEDCount;
 	int m_totalLEDSampleCount;
+	float m_lastAlignmentError;
 
 	LEDModelSamples *m_ledSampleSet;
 
 	SICP::Vertices m_icpTargetVertices;
+	SICP::KDTree *m_icpTargetKdTree;
 	Eigen::Affine3d m_icpTransform;
 };
 
@@ -671,8 +693,11 @@ void AppStage_HMDModelCalibration::renderUI()
 
 		ImGui::Separator();
 
-		// TODO: Show calibration progress
 		ImGui::ProgressBar(m_hmdModelState->getProgressFraction(), ImVec2(250, 20));
+		ImGui::Text("LEDs found: %d/%d, Alignment error: %.2fcm",
+			m_hmdModelState->getSeenLEDCount(),
+			m_hmdModelState->getExpectedLEDCount(),
+			m_hmdModelState->getLastAlignmentError());
 
 		// display tracking quality
 		for (int tracker_index = 0; tracker_index < get_tracker_count(); ++tracker_index)
@@ -855,14 +880,9 @@ void AppStage_HMDModelCalibration::update_tracker_video()
 	// Render the latest from the currently active tracker
 	TrackerState &trackerState= m_trackerPairState->trackers.list[m_trackerPairState->renderTrackerIndex];
 	if (trackerState.trackerView != nullptr &&
-		PSM_PollTrackerVideoStream(trackerState.trackerView->tracker_info.tracker_id))
+		trackerState.textureAsset != nullptr)
 	{
-		const unsigned char *buffer= nullptr;
-
-		if (PSM_GetTrackerVideoFrameBuffer(trackerState.trackerView->tracker_info.tracker_id, &buffer) == PSMResult_Success)
-		{
-			trackerState.textureAsset->copyBufferIntoTexture(buffer);
-		}
+		trackerState.textureAsset->copyTrackerVideoFrameIntoTexture(trackerState.trackerView->tracker_info.tracker_id);
 	}
 }
 
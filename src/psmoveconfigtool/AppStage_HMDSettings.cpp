@@ -24,7 +24,7 @@ const int k_default_hmd_position_filter_index = 3; // LowPassExponential
 const int k_default_morpheus_position_filter_index = 5; // PositionKalman
 const int k_default_morpheus_orientation_filter_index = 3; // OrientationKalman
 
-const char* k_hmd_position_filter_names[] = { "PassThru", "LowPassOptical", "LowPassIMU", "LowPassExponential", "ComplimentaryOpticalIMU", "PositionKalman" };
+const char* k_hmd_position_filter_names[] = { "PassThru", "LowPassOptical", "LowPassIMU", "LowPassExponential", "ComplimentaryOpticalIMU", "PositionKalman", "OneEuro" };
 const char* k_morpheus_orientation_filter_names[] = { "PassThru", "MadgwickARG", "ComplementaryOpticalARG", "OrientationKalman" };
 
 const float k_max_hmd_prediction_time = 0.15f; // About 150ms seems to be about the point where you start to get really bad over-prediction 
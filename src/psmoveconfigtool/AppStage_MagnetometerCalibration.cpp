@@ -20,6 +20,9 @@
 #include <imgui.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 //-- statics ----
 const char *AppStage_MagnetometerCalibration::APP_STAGE_NAME= "MagnetometerCalibration";
@@ -32,6 +35,12 @@ static const double k_stabilize_wait_time_ms= 1000.f;
 static const int k_max_identity_magnetometer_samples= 100;
 static const int k_min_sample_distance= 20;
 static const int k_min_sample_distance_sq= k_min_sample_distance*k_min_sample_distance;
+// The fit counts as converged when it moves less than this fraction of its size ...
+static const float k_fit_convergence_tolerance= 0.01f;
+// ... over this many new samples
+static const int k_fit_convergence_sample_window= 25;
+// Don't trust a converged fit made from fewer samples than this
+static const int k_fit_convergence_min_sample_count= 100;
 
 enum eEllipseFitMethod
 {
@@ -40,11 +49,259 @@ enum eEllipseFitMethod
 };
 
 //-- private methods -----
+/// Refits the magnetometer ellipsoid on its own thread as the samples come in.
+/**
+ The main thread posts each accepted sample and the worker folds the new samples
+ into the running least squares sums, so a refit doesn't grow with the sample count
+ the way refitting every sample from scratch on the UI thread did.
+ Samples posted while a fit is running get folded in together by the next fit.
+ */
+class MagnetometerEllipsoidFitter
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    MagnetometerEllipsoidFitter()
+        : m_bExitRequested(false)
+        , m_bResetRequested(false)
+        , m_pendingFitMethod(_ellipse_fit_method_least_squares)
+        , m_postedSampleCount(0)
+        , m_bHasNewResult(false)
+        , m_resultSampleCount(0)
+        , m_bResultConverged(false)
+        , m_fitSampleCount(0)
+        , m_fitMethod(_ellipse_fit_method_least_squares)
+        , m_referenceSampleCount(0)
+        , m_bConverged(false)
+    {
+        m_resultEllipsoid.clear();
+        m_accumulator.clear();
+        m_referenceEllipsoid.clear();
+        m_worker = std::thread(&MagnetometerEllipsoidFitter::workerFunc, this);
+    }
+
+    ~MagnetometerEllipsoidFitter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_bExitRequested= true;
+        }
+        m_condition.notify_all();
+
+        m_worker.join();
+    }
+
+    // Drops all of the posted samples
+    void reset(int fit_method)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_bResetRequested= true;
+            m_pendingFitMethod= fit_method;
+            m_postedSampleCount= 0;
+            m_bHasNewResult= false;
+            m_resultSampleCount= 0;
+        }
+        m_condition.notify_one();
+    }
+
+    void postSample(const Eigen::Vector3f &sample)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_postedSampleCount < k_max_bounds_magnetometer_samples)
+            {
+                m_postedSamples[m_postedSampleCount]= sample;
+                ++m_postedSampleCount;
+            }
+        }
+        m_condition.notify_one();
+    }
+
+    // Refits all of the posted samples with the given method
+    void postFitMethod(int fit_method)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_pendingFitMethod= fit_method;
+        }
+        m_condition.notify_one();
+    }
+
+    // Returns true if there is a fit newer than the last one fetched
+    bool fetchResult(EigenFitEllipsoid &out_ellipsoid, bool &out_bConverged)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const bool bNewResult= m_bHasNewResult;
+
+        if (bNewResult)
+        {
+            out_ellipsoid= m_resultEllipsoid;
+            out_bConverged= m_bResultConverged;
+            m_bHasNewResult= false;
+        }
+
+        return bNewResult;
+    }
+
+    // Blocks until every posted sample made it into a fit
+    void waitForFit()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_condition.wait(lock, [this]() { return !getHasPendingWork(); });
+    }
+
+private:
+    // Must be called with the lock held
+    bool getHasPendingWork() const
+    {
+        return 
+            m_bResetRequested || 
+            m_pendingFitMethod != m_fitMethod || 
+            m_postedSampleCount != m_resultSampleCount;
+    }
+
+    void workerFunc()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        for (;;)
+        {
+            m_condition.wait(lock, [this]() { return m_bExitRequested || getHasPendingWork(); });
+
+            if (m_bExitRequested)
+            {
+                break;
+            }
+
+            if (m_bResetRequested)
+            {
+                m_fitSampleCount= 0;
+                m_accumulator.clear();
+                m_referenceEllipsoid.clear();
+                m_referenceSampleCount= 0;
+                m_bConverged= false;
+                m_bResetRequested= false;
+            }
+
+            // Only copy the samples posted since the last fit
+            const int postedSampleCount= m_postedSampleCount;
+            const int firstNewSampleIndex= m_fitSampleCount;
+            const bool bFitMethodChanged= m_pendingFitMethod != m_fitMethod;
+            m_fitMethod= m_pendingFitMethod;
+
+            for (int sampleIndex= firstNewSampleIndex; sampleIndex < postedSampleCount; ++sampleIndex)
+            {
+                m_fitSamples[sampleIndex]= m_postedSamples[sampleIndex];
+            }
+
+            lock.unlock();
+
+            for (int sampleIndex= firstNewSampleIndex; sampleIndex < postedSampleCount; ++sampleIndex)
+            {
+                m_accumulator.add_point(m_fitSamples[sampleIndex]);
+            }
+            m_fitSampleCount= postedSampleCount;
+
+            EigenFitEllipsoid ellipsoid;
+            fitEllipsoid(ellipsoid);
+            updateConvergence(ellipsoid, bFitMethodChanged);
+
+            lock.lock();
+
+            // A reset that came in during the fit makes this result stale
+            if (!m_bResetRequested)
+            {
+                m_resultEllipsoid= ellipsoid;
+                m_bResultConverged= m_bConverged;
+                m_resultSampleCount= postedSampleCount;
+                m_bHasNewResult= true;
+            }
+
+            m_condition.notify_all();
+        }
+    }
+
+    void fitEllipsoid(EigenFitEllipsoid &out_ellipsoid) const
+    {
+        switch (m_fitMethod)
+        {
+        case _ellipse_fit_method_least_squares:
+            eigen_alignment_fit_least_squares_axis_aligned_ellipsoid(
+                m_accumulator, m_fitSamples, m_fitSampleCount, out_ellipsoid);
+            break;
+        case _ellipse_fit_method_box:
+            eigen_alignment_fit_bounding_box_ellipsoid(
+                m_fitSamples, m_fitSampleCount, out_ellipsoid);
+            break;
+        default:
+            out_ellipsoid.clear();
+        }
+    }
+
+    // Every convergence window compare the fit against the fit from the start of the window
+    void updateConvergence(const EigenFitEllipsoid &ellipsoid, bool bFitMethodChanged)
+    {
+        if (bFitMethodChanged)
+        {
+            m_referenceEllipsoid= ellipsoid;
+            m_referenceSampleCount= m_fitSampleCount;
+            m_bConverged= false;
+        }
+        else if (m_fitSampleCount - m_referenceSampleCount >= k_fit_convergence_sample_window)
+        {
+            const float fitSize= ellipsoid.extents.norm();
+            const float fitDrift= 
+                (ellipsoid.center - m_referenceEllipsoid.center).norm() +
+                (ellipsoid.extents - m_referenceEllipsoid.extents).norm();
+
+            m_bConverged= 
+                m_fitSampleCount >= k_fit_convergence_min_sample_count &&
+                fitSize > 0.f &&
+                fitDrift < k_fit_convergence_tolerance*fitSize;
+            m_referenceEllipsoid= ellipsoid;
+            m_referenceSampleCount= m_fitSampleCount;
+        }
+    }
+
+    // Multi-threaded state
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_bExitRequested;
+    bool m_bResetRequested;
+    int m_pendingFitMethod;
+    Eigen::Vector3f m_postedSamples[k_max_bounds_magnetometer_samples];
+    int m_postedSampleCount;
+    EigenFitEllipsoid m_resultEllipsoid;
+    bool m_bHasNewResult;
+    int m_resultSampleCount;
+    bool m_bResultConverged;
+
+    // Worker thread state
+    Eigen::Vector3f m_fitSamples[k_max_bounds_magnetometer_samples];
+    int m_fitSampleCount;
+    int m_fitMethod;
+    EigenFitEllipsoidAccumulator m_accumulator;
+    EigenFitEllipsoid m_referenceEllipsoid;
+    int m_referenceSampleCount;
+    bool m_bConverged;
+
+    // Main thread state
+    std::thread m_worker;
+};
+
 struct MagnetometerBoundsStatistics
 {
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
-    PSMVector3i magnetometerIntSamples[k_max_bounds_magnetometer_samples];
+    // Kept as separate components so the spacing check against every stored sample vectorizes
+    int magnetometerSamplesX[k_max_bounds_magnetometer_samples];
+    int magnetometerSamplesY[k_max_bounds_magnetometer_samples];
+    int magnetometerSamplesZ[k_max_bounds_magnetometer_samples];
     Eigen::Vector3f magnetometerEigenSamples[k_max_bounds_magnetometer_samples];
     int sampleCount;
     int samplePercentage;
@@ -52,7 +309,9 @@ struct MagnetometerBoundsStatistics
     PSMVector3i minSampleExtent;
     PSMVector3i maxSampleExtent;
 
+    MagnetometerEllipsoidFitter ellipsoidFitter;
     EigenFitEllipsoid sampleFitEllipsoid;
+    bool bFitConverged;
     int ellipseFitMethod;
 
 	MagnetometerBoundsStatistics()
@@ -60,14 +319,18 @@ struct MagnetometerBoundsStatistics
 		, samplePercentage(0)
 		, minSampleExtent()
 		, maxSampleExtent()
+		, bFitConverged(false)
 		, ellipseFitMethod(_ellipse_fit_method_least_squares)
 	{
 		clear();
 	}
 
+	// Done once all the sample slots are full or the fit stopped moving over the full range
 	bool getIsComplete() const 
 	{
-		return sampleCount >= k_max_bounds_magnetometer_samples;
+		return 
+			sampleCount >= k_max_bounds_magnetometer_samples ||
+			(bFitConverged && samplePercentage >= 100);
 	}
 
 	void clear()
@@ -78,7 +341,28 @@ struct MagnetometerBoundsStatistics
 		minSampleExtent= *k_psm_int_vector3_zero;
 		maxSampleExtent= *k_psm_int_vector3_zero;
 
+		ellipsoidFitter.reset(ellipseFitMethod);
 		sampleFitEllipsoid.clear();
+		bFitConverged= false;
+	}
+
+	// Picks up the latest fit from the fitter thread
+	void update()
+	{
+		ellipsoidFitter.fetchResult(sampleFitEllipsoid, bFitConverged);
+	}
+
+	// Waits for the fit of every sample added so far
+	void finishFit()
+	{
+		ellipsoidFitter.waitForFit();
+		update();
+	}
+
+	void setFitMethod(int fit_method)
+	{
+		ellipseFitMethod= fit_method;
+		ellipsoidFitter.postFitMethod(fit_method);
 	}
 
 	bool addSample(const PSMVector3i &sample)
@@ -91,38 +375,31 @@ struct MagnetometerBoundsStatistics
 			expandMagnetometerBounds(sample);
 
 			// Make sure this sample isn't too close to another sample
-			for (int sampleIndex= sampleCount-1; sampleIndex >= 0; --sampleIndex)
+			int minDistanceSquared= k_min_sample_distance_sq;
+			for (int sampleIndex= 0; sampleIndex < sampleCount; ++sampleIndex)
 			{
-				const PSMVector3i diff= PSM_Vector3iSubtract(&sample, &magnetometerIntSamples[sampleIndex]);
-				const int distanceSquared= PSM_Vector3iLengthSquared(&diff);
+				const int dx= magnetometerSamplesX[sampleIndex] - sample.x;
+				const int dy= magnetometerSamplesY[sampleIndex] - sample.y;
+				const int dz= magnetometerSamplesZ[sampleIndex] - sample.z;
+				const int distanceSquared= dx*dx + dy*dy + dz*dz;
 
-				if (distanceSquared < k_min_sample_distance_sq)
-				{
-					bSuccess= false;
-					break;
-				}
+				minDistanceSquared= std::min(minDistanceSquared, distanceSquared);
 			}
+
+			bSuccess= minDistanceSquared >= k_min_sample_distance_sq;
 		}
 
 		if (bSuccess)
 		{
             // Store the new sample
-            magnetometerIntSamples[sampleCount]= sample;
+            magnetometerSamplesX[sampleCount]= sample.x;
+            magnetometerSamplesY[sampleCount]= sample.y;
+            magnetometerSamplesZ[sampleCount]= sample.z;
             magnetometerEigenSamples[sampleCount] = psm_vector3i_to_eigen_vector3(sample);
-            ++sampleCount;
 
-            // Compute a best fit ellipsoid for the sample points
-            switch (ellipseFitMethod)
-            {
-            case _ellipse_fit_method_least_squares:
-                eigen_alignment_fit_least_squares_axis_aligned_ellipsoid(
-                    magnetometerEigenSamples, sampleCount, sampleFitEllipsoid);
-                break;
-            case _ellipse_fit_method_box:
-                eigen_alignment_fit_bounding_box_ellipsoid(
-                    magnetometerEigenSamples, sampleCount, sampleFitEllipsoid);
-                break;
-            }
+            // Have the fitter thread refit the ellipsoid with the new sample
+            ellipsoidFitter.postSample(magnetometerEigenSamples[sampleCount]);
+            ++sampleCount;
 
             // Update the extents progress based on min extent size
             int minRange = computeMagnetometerCalibrationMinRange();
@@ -363,6 +640,8 @@ void AppStage_MagnetometerCalibration::update()
         } break;
     case eCalibrationMenuState::measureBExtents:
         {
+            m_boundsStatistics->update();
+
             if (bControllerDataUpdatedThisFrame && !m_boundsStatistics->getIsComplete())
             {
 				if (m_boundsStatistics->addSample(m_lastRawMagnetometer))
@@ -714,7 +993,7 @@ void AppStage_MagnetometerCalibration::renderUI()
         {
             {
                 ImGui::SetNextWindowPos(ImVec2(ImGui::GetIO().DisplaySize.x / 2.f - k_panel_width / 2.f, 20.f));
-                ImGui::SetNextWindowSize(ImVec2(k_panel_width, 150));
+                ImGui::SetNextWindowSize(ImVec2(k_panel_width, 170));
                 ImGui::Begin(k_window_title, nullptr, window_flags);
 
                 if (!m_boundsStatistics->getIsComplete())
@@ -736,6 +1015,13 @@ void AppStage_MagnetometerCalibration::renderUI()
 					m_lastControllerSeqNum,
 					m_lastRawMagnetometer.x, m_lastRawMagnetometer.y, m_lastRawMagnetometer.z);
 
+                ImGui::Text("Fit Error: %.3f per sample (%d samples)%s",
+                    (m_boundsStatistics->sampleCount > 0) 
+                        ? m_boundsStatistics->sampleFitEllipsoid.error / static_cast<float>(m_boundsStatistics->sampleCount)
+                        : 0.f,
+                    m_boundsStatistics->sampleCount,
+                    m_boundsStatistics->bFitConverged ? " - Converged" : "");
+
                 if (m_boundsStatistics->samplePercentage < 100)
                 {
                     ImGui::ProgressBar(static_cast<float>(m_boundsStatistics->samplePercentage) / 100.f, ImVec2(250, 20));
@@ -743,6 +1029,7 @@ void AppStage_MagnetometerCalibration::renderUI()
                     if (ImGui::Button("Force Accept"))
                     {
 						PSM_SetControllerLEDOverrideColor(m_controllerView->ControllerID, 0, 0, 0);
+                        m_boundsStatistics->finishFit();
                         m_menuState = waitForGravityAlignment;
                     }
                     ImGui::SameLine();
@@ -752,6 +1039,7 @@ void AppStage_MagnetometerCalibration::renderUI()
                     if (ImGui::Button("Ok"))
                     {
 						PSM_SetControllerLEDOverrideColor(m_controllerView->ControllerID, 0, 0, 0);
+                        m_boundsStatistics->finishFit();
                         m_menuState = waitForGravityAlignment;
                     }
                     ImGui::SameLine();
@@ -770,22 +1058,18 @@ void AppStage_MagnetometerCalibration::renderUI()
                 ImGui::SetNextWindowSize(ImVec2(170.f, 80.f));
                 ImGui::Begin("Ellipse Fitting Mode", nullptr, window_flags);
 
-                if (ImGui::RadioButton("Least Squares Fit", &m_boundsStatistics->ellipseFitMethod, _ellipse_fit_method_least_squares))
+                int ellipseFitMethod= m_boundsStatistics->ellipseFitMethod;
+
+                if (ImGui::RadioButton("Least Squares Fit", &ellipseFitMethod, _ellipse_fit_method_least_squares))
                 {
                     // Re-fit using min bounds
-                    eigen_alignment_fit_least_squares_axis_aligned_ellipsoid(
-                        m_boundsStatistics->magnetometerEigenSamples, 
-						m_boundsStatistics->sampleCount, 
-						m_boundsStatistics->sampleFitEllipsoid);
+                    m_boundsStatistics->setFitMethod(ellipseFitMethod);
                 }
 
-                if (ImGui::RadioButton("Bounds Fit", &m_boundsStatistics->ellipseFitMethod, _ellipse_fit_method_box))
+                if (ImGui::RadioButton("Bounds Fit", &ellipseFitMethod, _ellipse_fit_method_box))
                 {
                     // Refit to a box
-                    eigen_alignment_fit_bounding_box_ellipsoid(
-                        m_boundsStatistics->magnetometerEigenSamples, 
-						m_boundsStatistics->sampleCount, 
-						m_boundsStatistics->sampleFitEllipsoid);
+                    m_boundsStatistics->setFitMethod(ellipseFitMethod);
                 }
 
                 ImGui::End();
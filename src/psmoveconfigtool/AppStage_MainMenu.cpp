@@ -90,6 +90,11 @@ void AppStage_MainMenu::renderUI()
                 m_app->setAppStage(AppStage_TrackerSettings::APP_STAGE_NAME);
             }
     
+            if (ImGui::Button("Service Statistics"))
+            {
+                m_app->setAppStage(AppStage_ServiceSettings::APP_STAGE_NAME);
+            }
+    
             if (ImGui::Button("Exit"))
             {
                 m_app->requestShutdown();
@@ -139,7 +144,9 @@ void AppStage_MainMenu::renderUI()
 			ImGui::PushItemWidth(125.f);
 			if (ImGui::InputText("Server Address", m_app->m_serverAddress, sizeof(m_app->m_serverAddress), ImGuiInputTextFlags_CharsDecimal | ImGuiInputTextFlags_CharsNoBlank))
 			{
-				m_app->m_bIsServerLocal= (strncmp(m_app->m_serverAddress, PSMOVESERVICE_DEFAULT_ADDRESS, sizeof(m_app->m_serverAddress)) == 0);
+				m_app->m_bIsServerLocal= 
+					(strncmp(m_app->m_serverAddress, PSMOVESERVICE_DEFAULT_ADDRESS, sizeof(m_app->m_serverAddress)) == 0) ||
+					(strncmp(m_app->m_serverAddress, PSMOVESERVICE_LOCAL_ADDRESS_PREFIX, strlen(PSMOVESERVICE_LOCAL_ADDRESS_PREFIX)) == 0);
 			}
 
 			ImGui::InputText("Server Port", m_app->m_serverPort, sizeof(m_app->m_serverPort), ImGuiInputTextFlags_CharsDecimal);
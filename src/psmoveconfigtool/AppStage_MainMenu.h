@@ -15,6 +15,7 @@ public:
     virtual void exit() override;
 
     virtual void renderUI() override;
+    virtual bool getIsRenderingContinuously() const override { return false; }
 
     virtual bool onClientAPIEvent(
         PSMEventMessage::eEventType event, 
@@ -29,15 +29,12 @@ const char *AppStage_OpticalCalibration::APP_STAGE_NAME = "OpticalCalibration";
 const double k_stabilize_wait_time_ms = 1000.f;
 const int k_desired_noise_sample_count = 100;
 const int k_sample_location_count = 10;
+const float k_noise_sample_poll_interval_ms = 100.f;
 
 //-- definitions -----
 struct PoseNoiseSamplesAtLocation
 {
-	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
-
-	Eigen::Vector3f position_samples_cm[k_desired_noise_sample_count];
-    Eigen::Quaternionf orientation_samples[k_desired_noise_sample_count];
-	float projection_area_samples[k_desired_noise_sample_count];
+	// Statistics gathered by the service, see SAMPLE_CONTROLLER_OPTICAL_NOISE
 	int sample_count;
 
 	float position_variance_scalar_cm_sqr; // cm^2
@@ -52,40 +49,13 @@ struct PoseNoiseSamplesAtLocation
 		avg_proj_area_px_sqr = 0.f;
     }
 
-    void computeStatistics()
-    {
-        const float N = static_cast<float>(sample_count);
-
-		// Compute the mean of the projection areas
-		avg_proj_area_px_sqr = 0.f;
-		for (int sample_index = 0; sample_index < sample_count; sample_index++)
-		{
-			avg_proj_area_px_sqr += projection_area_samples[sample_index];
-		}
-		avg_proj_area_px_sqr /= N;
-
-		// Compute the variance of distance around the mean position
-		Eigen::Vector3f position_variance_cm_sqr;
-		eigen_vector3f_compute_mean_and_variance(
-			position_samples_cm, sample_count, nullptr, &position_variance_cm_sqr);
-		position_variance_scalar_cm_sqr = fmaxf(fmaxf(position_variance_cm_sqr.x(), position_variance_cm_sqr.y()), position_variance_cm_sqr.z());
-
-		// Compute the average(mean) of the orientation samples
-		Eigen::Quaternionf orientation_mean;
-		eigen_quaternion_compute_normalized_weighted_average(
-			orientation_samples, nullptr, sample_count, &orientation_mean);
-
-        // Compute the variance in the angle of orientation around the mean
-		orientation_variance_scalar_rad_sqr = 0.f;
-        for (int sample_index = 0; sample_index < sample_count; sample_index++)
-        {
-            const Eigen::Quaternionf &sample= orientation_samples[sample_index].normalized();
-			float diff_from_mean = eigen_quaternion_unsigned_angle_between(sample, orientation_mean);
-
-			orientation_variance_scalar_rad_sqr += diff_from_mean*diff_from_mean;
-        }
-		orientation_variance_scalar_rad_sqr /= (N - 1.f);
-    }
+	void applyStatistics(const PSMoveProtocol::Response_ResultControllerOpticalNoiseSamples &result)
+	{
+		sample_count = result.sample_count();
+		position_variance_scalar_cm_sqr = result.position_variance_cm_sqr();
+		orientation_variance_scalar_rad_sqr = result.orientation_variance_rad_sqr();
+		avg_proj_area_px_sqr = result.projection_area_px_sqr();
+	}
 };
 
 struct PoseNoiseSampleSet
@@ -189,6 +159,9 @@ AppStage_OpticalCalibration::AppStage_OpticalCalibration(App *app)
 	, m_bIsStableAndVisible(false)
     , m_poseNoiseSamplesSet(new PoseNoiseSampleSet)
 	, m_bWaitForSampleButtonRelease(false)
+	, m_bNoiseSamplingStarted(false)
+	, m_bNoiseSamplesRequestPending(false)
+	, m_lastNoiseSamplesRequestTime()
 {	
 	m_lastMulticamPositionCm = *k_psm_float_vector3_zero;
 	m_lastMulticamOrientation = *k_psm_quaternion_identity;
@@ -393,26 +366,20 @@ void AppStage_OpticalCalibration::update()
             {
 				PoseNoiseSamplesAtLocation &poseNoiseSamples = m_poseNoiseSamplesSet->getCurrentLocationSamples();
 
-                // Record the next noise sample
-                if (poseNoiseSamples.sample_count < k_desired_noise_sample_count &&
-					m_bLastMulticamOrientationValid && m_bLastMulticamPositionValid && m_bLastProjectionAreaValid)
-                {
-					poseNoiseSamples.position_samples_cm[poseNoiseSamples.sample_count] = 
-						psm_vector3f_to_eigen_vector3(m_lastMulticamPositionCm);
-					poseNoiseSamples.orientation_samples[poseNoiseSamples.sample_count] =
-						psm_quatf_to_eigen_quaternionf(m_lastMulticamOrientation);
-					poseNoiseSamples.projection_area_samples[poseNoiseSamples.sample_count] =
-						m_lastProjectionArea;
-
-                    ++poseNoiseSamples.sample_count;
-                }
+				// The service samples every optical pose itself, we just poll the running statistics
+				if (m_bNoiseSamplingStarted && !m_bNoiseSamplesRequestPending)
+				{
+					std::chrono::duration<float, std::milli> timeSinceLastPoll = now - m_lastNoiseSamplesRequestTime;
+
+					if (timeSinceLastPoll.count() >= k_noise_sample_poll_interval_ms)
+					{
+						request_sample_optical_noise(false, 0);
+					}
+				}
 
                 // See if we have completed sampling at this location
                 if (poseNoiseSamples.sample_count >= k_desired_noise_sample_count)
                 {
-                    // Compute position and orientation noise statistics
-					poseNoiseSamples.computeStatistics();
-
 					// Advance to the next location
 					++m_poseNoiseSamplesSet->completedSampleLocations;
 
@@ -805,7 +772,11 @@ void AppStage_OpticalCalibration::onExitState(eCalibrationMenuState newState)
 	case eCalibrationMenuState::waitingForStreamStartResponse:
 	case eCalibrationMenuState::failedStreamStart:
 	case eCalibrationMenuState::waitForStable:
+		break;
 	case eCalibrationMenuState::measureOpticalNoise:
+		// Stop the service from sampling any further
+		request_sample_optical_noise(true, 0);
+		break;
 	case eCalibrationMenuState::measureComplete:
 	case eCalibrationMenuState::test:
 		break;
@@ -840,6 +811,10 @@ void AppStage_OpticalCalibration::onEnterState(eCalibrationMenuState newState)
 		m_app->getOrbitCamera()->setCameraOrbitRadius(200);
 		break;
 	case eCalibrationMenuState::measureOpticalNoise:
+		// Have the service start gathering the noise statistics at this location
+		m_bNoiseSamplingStarted = false;
+		request_sample_optical_noise(true, k_desired_noise_sample_count);
+		// Fall through to the camera setup
 	case eCalibrationMenuState::measureComplete:
 		{
 			m_app->setCameraType(_cameraOrbit);
@@ -951,6 +926,70 @@ void AppStage_OpticalCalibration::request_set_optical_calibration(
 	PSM_SendOpaqueRequest(&request, nullptr);
 }
 
+void AppStage_OpticalCalibration::request_sample_optical_noise(
+	const bool bStartSampling,
+	const int sample_count)
+{
+    RequestPtr request(new PSMoveProtocol::Request());
+    request->set_type(PSMoveProtocol::Request_RequestType_SAMPLE_CONTROLLER_OPTICAL_NOISE);
+
+    PSMoveProtocol::Request_RequestSampleControllerOpticalNoise *sample_request =
+        request->mutable_request_sample_controller_optical_noise();
+
+    sample_request->set_controller_id(m_controllerView->ControllerID);
+	sample_request->set_start_sampling(bStartSampling);
+	sample_request->set_sample_count(sample_count);
+
+	PSMRequestID request_id;
+	PSM_SendOpaqueRequest(&request, &request_id);
+
+	if (bStartSampling)
+	{
+		PSM_RegisterCallback(request_id, AppStage_OpticalCalibration::handle_start_optical_noise_sampling_response, this);
+	}
+	else
+	{
+		PSM_RegisterCallback(request_id, AppStage_OpticalCalibration::handle_sample_optical_noise_response, this);
+		m_bNoiseSamplesRequestPending = true;
+	}
+
+	m_lastNoiseSamplesRequestTime = std::chrono::high_resolution_clock::now();
+}
+
+void AppStage_OpticalCalibration::handle_start_optical_noise_sampling_response(
+	const PSMResponseMessage *response,
+	void *userdata)
+{
+	AppStage_OpticalCalibration *thisPtr = reinterpret_cast<AppStage_OpticalCalibration *>(userdata);
+
+	// Responses come back in order, so every poll after this one sees the new statistics
+	if (response->result_code == PSMResult_Success &&
+		thisPtr->m_menuState == eCalibrationMenuState::measureOpticalNoise)
+	{
+		thisPtr->m_bNoiseSamplingStarted = true;
+	}
+}
+
+void AppStage_OpticalCalibration::handle_sample_optical_noise_response(
+	const PSMResponseMessage *response,
+	void *userdata)
+{
+	AppStage_OpticalCalibration *thisPtr = reinterpret_cast<AppStage_OpticalCalibration *>(userdata);
+
+	thisPtr->m_bNoiseSamplesRequestPending = false;
+
+	// Drop polls of an earlier location that come in after sampling restarted
+	if (response->result_code == PSMResult_Success &&
+		thisPtr->m_bNoiseSamplingStarted &&
+		thisPtr->m_menuState == eCalibrationMenuState::measureOpticalNoise)
+	{
+		const PSMoveProtocol::Response *protocol_response = GET_PSMOVEPROTOCOL_RESPONSE(response->opaque_response_handle);
+
+		thisPtr->m_poseNoiseSamplesSet->getCurrentLocationSamples().applyStatistics(
+			protocol_response->result_controller_optical_noise_samples());
+	}
+}
+
 void AppStage_OpticalCalibration::handle_acquire_controller(
     const PSMResponseMessage *response,
     void *userdata)
@@ -58,6 +58,13 @@ protected:
     void request_set_optical_calibration(
 		const float position_var_exp_fit_a, const float position_var_exp_fit_b,
 		const float orientation_var_exp_fit_a, const float orientation_var_exp_fit_b);
+    void request_sample_optical_noise(const bool bStartSampling, const int sample_count);
+    static void handle_start_optical_noise_sampling_response(
+        const PSMResponseMessage *response,
+        void *userdata);
+    static void handle_sample_optical_noise_response(
+        const PSMResponseMessage *response,
+        void *userdata);
     static void handle_acquire_controller(
         const PSMResponseMessage *response,
         void *userdata);
@@ -86,6 +93,10 @@ private:
     struct PoseNoiseSampleSet *m_poseNoiseSamplesSet;
 	bool m_bWaitForSampleButtonRelease;
 
+	bool m_bNoiseSamplingStarted;
+	bool m_bNoiseSamplesRequestPending;
+	std::chrono::time_point<std::chrono::high_resolution_clock> m_lastNoiseSamplesRequestTime;
+
 	PSMTrackerList m_trackerList;
 };
 
@@ -5,6 +5,8 @@
 #include "Camera.h"
 #include "Renderer.h"
 #include "UIConstants.h"
+#include "PSMoveProtocolInterface.h"
+#include "PSMoveProtocol.pb.h"
 
 #include "SDL_keycode.h"
 
@@ -15,23 +17,53 @@
 const char *AppStage_ServiceSettings::APP_STAGE_NAME= "ServiceSettings";
 
 //-- constants -----
+// The service refreshes its rates once a second, polling faster wouldn't show anything new
+static const int k_stats_refresh_interval_ms = 1000;
 
 //-- public methods -----
 AppStage_ServiceSettings::AppStage_ServiceSettings(App *app) 
     : AppStage(app)
+    , m_bIsActive(false)
+    , m_bStatsRequestPending(false)
+    , m_bHasStats(false)
+    , m_lastStatsRequestTime()
+    , m_loopRateHz(0.f)
+    , m_peakOpticalTickMs(0.f)
+    , m_overBudgetTickCount(0)
+    , m_deferredSearchCount(0)
+    , m_deviceStats()
+    , m_trackerStats()
+    , m_connectionStats()
 { }
 
 void AppStage_ServiceSettings::enter()
 {
     m_app->setCameraType(_cameraFixed);
+
+    m_bIsActive = true;
+    m_bHasStats = false;
+    request_service_stats();
 }
 
 void AppStage_ServiceSettings::exit()
 {
+    // Any response still in flight gets ignored
+    m_bIsActive = false;
 }
 
 void AppStage_ServiceSettings::update()
 {
+    if (!m_bStatsRequestPending)
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+        const long long elapsed_ms =
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastStatsRequestTime).count();
+
+        if (elapsed_ms >= k_stats_refresh_interval_ms)
+        {
+            request_service_stats();
+        }
+    }
 }
 
 void AppStage_ServiceSettings::renderUI()
@@ -40,15 +72,208 @@ void AppStage_ServiceSettings::renderUI()
         ImGuiWindowFlags_ShowBorders |
         ImGuiWindowFlags_NoResize | 
         ImGuiWindowFlags_NoMove |
-        ImGuiWindowFlags_NoScrollbar |
         ImGuiWindowFlags_NoCollapse;
     ImGui::SetNextWindowPosCenter();
-    ImGui::Begin("Service Settings", nullptr, ImVec2(300, 150), k_background_alpha, window_flags);
+    ImGui::Begin("Service Statistics", nullptr, ImVec2(450, 500), k_background_alpha, window_flags);
+
+    if (m_bHasStats)
+    {
+        ImGui::Text("Main loop: %.1f Hz", m_loopRateHz);
+        ImGui::Text("Optical work: %.1f ms/tick peak, %lld ticks over budget, %lld searches put off",
+            m_peakOpticalTickMs, m_overBudgetTickCount, m_deferredSearchCount);
+
+        ImGui::Separator();
+        ImGui::Text("Device poll rates (new data)");
+        if (m_deviceStats.size() > 0)
+        {
+            for (const DeviceStats &stats : m_deviceStats)
+            {
+                if (stats.max_sensor_backlog_count > 0)
+                {
+                    ImGui::BulletText("%s %d: %.1f Hz (%d reports/poll, max %d)",
+                        stats.category_name, stats.device_id, stats.poll_rate_hz,
+                        stats.sensor_backlog_count, stats.max_sensor_backlog_count);
+                }
+                else
+                {
+                    ImGui::BulletText("%s %d: %.1f Hz", stats.category_name, stats.device_id, stats.poll_rate_hz);
+                }
+            }
+        }
+        else
+        {
+            ImGui::BulletText("No open devices");
+        }
+
+        ImGui::Separator();
+        ImGui::Text("Tracker processing time");
+        if (m_trackerStats.size() > 0)
+        {
+            for (const TrackerStats &stats : m_trackerStats)
+            {
+                ImGui::BulletText("Tracker %d: %.2f ms/frame, %lld dropped frames",
+                    stats.tracker_id, stats.processing_ms, stats.dropped_frame_count);
+                ImGui::Indent();
+                ImGui::Text("Busy: ingest %.0f%%, vision %.0f%%, stalled %.2f ms/frame",
+                    stats.ingest_occupancy*100.f, stats.vision_occupancy*100.f, stats.pipeline_stall_ms);
+                ImGui::Unindent();
+            }
+        }
+        else
+        {
+            ImGui::BulletText("No open trackers");
+        }
+
+        ImGui::Separator();
+        ImGui::Text("Client connections (UDP)");
+        for (const ConnectionStats &stats : m_connectionStats)
+        {
+            ImGui::BulletText("Connection %d", stats.connection_id);
+            ImGui::Indent();
+            ImGui::Text("Send rate: %.1f datagrams/s, %.1f frames/s",
+                stats.udp_datagrams_per_second, stats.udp_data_frames_per_second);
+            ImGui::Text("Send queue: %d / %d", stats.queued_data_frame_count, stats.max_queued_data_frame_count);
+            ImGui::Text("Dropped frames: %lld", stats.dropped_data_frame_count);
+            ImGui::Unindent();
+        }
+
+        ImGui::Separator();
+        ImGui::Text("Memory");
+        {
+            long long total_bytes = 0;
+
+            for (const MemoryStats &stats : m_memoryStats)
+            {
+                ImGui::BulletText("%s: %.2f MB", stats.subsystem.c_str(), static_cast<double>(stats.allocated_bytes) / (1024.0*1024.0));
+                total_bytes += stats.allocated_bytes;
+            }
 
+            ImGui::BulletText("Total: %.2f MB", static_cast<double>(total_bytes) / (1024.0*1024.0));
+        }
+    }
+    else
+    {
+        ImGui::Text("Waiting for service statistics...");
+    }
+
+    ImGui::Separator();
     if (ImGui::Button("Return to Main Menu"))
     {
         m_app->setAppStage(AppStage_MainMenu::APP_STAGE_NAME);
     }
 
     ImGui::End();
-}
\ No newline at end of file
+}
+
+//-- private methods -----
+void AppStage_ServiceSettings::request_service_stats()
+{
+    if (!m_bStatsRequestPending)
+    {
+        m_bStatsRequestPending = true;
+        m_lastStatsRequestTime = std::chrono::high_resolution_clock::now();
+
+        RequestPtr request(new PSMoveProtocol::Request());
+        request->set_type(PSMoveProtocol::Request_RequestType_GET_SERVICE_STATS);
+
+        PSMRequestID request_id;
+        PSM_SendOpaqueRequest(&request, &request_id);
+        PSM_RegisterCallback(request_id, AppStage_ServiceSettings::handle_service_stats_response, this);
+    }
+}
+
+void AppStage_ServiceSettings::handle_service_stats_response(
+    const PSMResponseMessage *response,
+    void *userdata)
+{
+    AppStage_ServiceSettings *thisPtr = static_cast<AppStage_ServiceSettings *>(userdata);
+
+    thisPtr->m_bStatsRequestPending = false;
+
+    if (thisPtr->m_bIsActive && response->result_code == PSMResult_Success)
+    {
+        const PSMoveProtocol::Response *protocol_response = GET_PSMOVEPROTOCOL_RESPONSE(response->opaque_response_handle);
+        const PSMoveProtocol::Response_ResultServiceStats &result = protocol_response->result_service_stats();
+
+        thisPtr->m_loopRateHz = result.loop_rate_hz();
+        thisPtr->m_peakOpticalTickMs = result.peak_optical_tick_ms();
+        thisPtr->m_overBudgetTickCount = static_cast<long long>(result.over_budget_tick_count());
+        thisPtr->m_deferredSearchCount = static_cast<long long>(result.deferred_search_count());
+
+        thisPtr->m_deviceStats.clear();
+        for (int entry_index = 0; entry_index < result.device_entries_size(); ++entry_index)
+        {
+            const PSMoveProtocol::Response_ResultServiceStats_DeviceStats &entry = result.device_entries(entry_index);
+            DeviceStats stats;
+
+            switch (entry.device_category())
+            {
+            case PSMoveProtocol::Response_ResultServiceStats_DeviceStats_DeviceCategory_CONTROLLER:
+                stats.category_name = "Controller";
+                break;
+            case PSMoveProtocol::Response_ResultServiceStats_DeviceStats_DeviceCategory_TRACKER:
+                stats.category_name = "Tracker";
+                break;
+            case PSMoveProtocol::Response_ResultServiceStats_DeviceStats_DeviceCategory_HMD:
+                stats.category_name = "HMD";
+                break;
+            default:
+                stats.category_name = "Device";
+                break;
+            }
+            stats.device_id = entry.device_id();
+            stats.poll_rate_hz = entry.poll_rate_hz();
+            stats.sensor_backlog_count = entry.sensor_backlog_count();
+            stats.max_sensor_backlog_count = entry.max_sensor_backlog_count();
+
+            thisPtr->m_deviceStats.push_back(stats);
+        }
+
+        thisPtr->m_trackerStats.clear();
+        for (int entry_index = 0; entry_index < result.tracker_entries_size(); ++entry_index)
+        {
+            const PSMoveProtocol::Response_ResultServiceStats_TrackerStats &entry = result.tracker_entries(entry_index);
+            TrackerStats stats;
+
+            stats.tracker_id = entry.tracker_id();
+            stats.processing_ms = entry.processing_ms();
+            stats.dropped_frame_count = entry.dropped_frame_count();
+            stats.ingest_occupancy = entry.ingest_occupancy();
+            stats.vision_occupancy = entry.vision_occupancy();
+            stats.pipeline_stall_ms = entry.pipeline_stall_ms();
+
+            thisPtr->m_trackerStats.push_back(stats);
+        }
+
+        thisPtr->m_connectionStats.clear();
+        for (int entry_index = 0; entry_index < result.connection_entries_size(); ++entry_index)
+        {
+            const PSMoveProtocol::Response_ResultServiceStats_ConnectionStats &entry = result.connection_entries(entry_index);
+            ConnectionStats stats;
+
+            stats.connection_id = entry.connection_id();
+            stats.udp_datagrams_per_second = entry.udp_datagrams_per_second();
+            stats.udp_data_frames_per_second = entry.udp_data_frames_per_second();
+            stats.queued_data_frame_count = entry.queued_data_frame_count();
+            stats.max_queued_data_frame_count = entry.max_queued_data_frame_count();
+            stats.dropped_data_frame_count = entry.dropped_data_frame_count();
+
+            thisPtr->m_connectionStats.push_back(stats);
+        }
+
+        thisPtr->m_memoryStats.clear();
+        for (int entry_index = 0; entry_index < result.memory_entries_size(); ++entry_index)
+        {
+            const PSMoveProtocol::Response_ResultServiceStats_MemoryStats &entry = result.memory_entries(entry_index);
+            MemoryStats stats;
+
+            stats.subsystem = entry.subsystem();
+            stats.allocated_bytes = entry.allocated_bytes();
+
+            thisPtr->m_memoryStats.push_back(stats);
+        }
+
+        thisPtr->m_bHasStats = true;
+        thisPtr->m_app->requestRedraw();
+    }
+}
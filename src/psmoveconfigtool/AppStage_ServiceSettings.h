@@ -3,11 +3,51 @@
 
 //-- includes -----
 #include "AppStage.h"
+#include "PSMoveClient_CAPI.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
 
 //-- definitions -----
 class AppStage_ServiceSettings : public AppStage
 {
 public:
+    struct DeviceStats
+    {
+        const char *category_name;
+        int device_id;
+        float poll_rate_hz;
+        int sensor_backlog_count;
+        int max_sensor_backlog_count;
+    };
+
+    struct TrackerStats
+    {
+        int tracker_id;
+        float processing_ms;
+        long long dropped_frame_count;
+        float ingest_occupancy;
+        float vision_occupancy;
+        float pipeline_stall_ms;
+    };
+
+    struct ConnectionStats
+    {
+        int connection_id;
+        float udp_datagrams_per_second;
+        float udp_data_frames_per_second;
+        int queued_data_frame_count;
+        int max_queued_data_frame_count;
+        long long dropped_data_frame_count;
+    };
+
+    struct MemoryStats
+    {
+        std::string subsystem;
+        long long allocated_bytes;
+    };
+
     AppStage_ServiceSettings(class App *app);
 
     virtual void enter() override;
@@ -15,8 +55,30 @@ public:
     virtual void update() override;
 
     virtual void renderUI() override;
+    virtual bool getIsRenderingContinuously() const override { return false; }
 
     static const char *APP_STAGE_NAME;
+
+protected:
+    void request_service_stats();
+    static void handle_service_stats_response(
+        const PSMResponseMessage *response,
+        void *userdata);
+
+private:
+    bool m_bIsActive;
+    bool m_bStatsRequestPending;
+    bool m_bHasStats;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastStatsRequestTime;
+
+    float m_loopRateHz;
+    float m_peakOpticalTickMs;
+    long long m_overBudgetTickCount;
+    long long m_deferredSearchCount;
+    std::vector<DeviceStats> m_deviceStats;
+    std::vector<TrackerStats> m_trackerStats;
+    std::vector<ConnectionStats> m_connectionStats;
+    std::vector<MemoryStats> m_memoryStats;
 };
 
-#endif // APP_STAGE_SERVICE_SETTINGS_H
\ No newline at end of file
+#endif // APP_STAGE_SERVICE_SETTINGS_H
@@ -69,14 +69,7 @@ void AppStage_TestTracker::update()
     // Try and read the next video frame from shared memory
     if (m_video_texture != nullptr)
     {
-        if (PSM_PollTrackerVideoStream(m_tracker_view->tracker_info.tracker_id) == PSMResult_Success)
-        {
-			const unsigned char *buffer= nullptr;
-			if (PSM_GetTrackerVideoFrameBuffer(m_tracker_view->tracker_info.tracker_id, &buffer) == PSMResult_Success)
-			{
-				m_video_texture->copyBufferIntoTexture(buffer);
-			}
-        }
+        m_video_texture->copyTrackerVideoFrameIntoTexture(m_tracker_view->tracker_info.tracker_id);
     }
 }
 
@@ -22,6 +22,7 @@
 #include "opencv2/calib3d/calib3d.hpp"
 
 #include <imgui.h>
+#include <future>
 #include <vector>
 
 //-- constants -----
@@ -104,15 +105,12 @@ struct TrackerRelativePoseStatistics
 	void addControllerSample(const PSMTracker *trackerView, const PSMController *controllerView, const int sampleLocationIndex)
 	{
 		const int sampleTrackerID= trackerView->tracker_info.tracker_id;
-        int streamTrackerID= -1;
 
 		PSMVector2f screenSample;
 		PSMVector3f trackerRelativePosition;
 		
 		if (!getIsComplete() &&
-			PSM_GetControllerPixelLocationOnTracker(controllerView->ControllerID, &streamTrackerID, &screenSample) == PSMResult_Success &&
-			PSM_GetControllerPositionOnTracker(controllerView->ControllerID, &streamTrackerID, &trackerRelativePosition) == PSMResult_Success &&
-            streamTrackerID == sampleTrackerID)
+			PSM_GetControllerTrackerSample(controllerView->ControllerID, sampleTrackerID, &screenSample, &trackerRelativePosition) == PSMResult_Success)
 		{
 			screenSpacePoints[sampleCount] = screenSample;
 			trackerSpacePoints[sampleCount] = psm_vector3f_to_eigen_vector3(trackerRelativePosition);
@@ -145,15 +143,12 @@ struct TrackerRelativePoseStatistics
 	void addHmdSample(const PSMTracker *trackerView, const PSMHeadMountedDisplay *hmdView, const int sampleLocationIndex)
 	{
 		const int sampleTrackerID= trackerView->tracker_info.tracker_id;
-        int streamTrackerID= -1;
 
 		PSMVector2f screenSample;
 		PSMVector3f trackerRelativePosition;
 		
 		if (!getIsComplete() &&
-			PSM_GetHmdPixelLocationOnTracker(hmdView->HmdID, &streamTrackerID, &screenSample) == PSMResult_Success &&
-			PSM_GetHmdPositionOnTracker(hmdView->HmdID, &streamTrackerID, &trackerRelativePosition) == PSMResult_Success &&
-            streamTrackerID == sampleTrackerID)
+			PSM_GetHmdTrackerSample(hmdView->HmdID, sampleTrackerID, &screenSample, &trackerRelativePosition) == PSMResult_Success)
 		{
 			screenSpacePoints[sampleCount] = screenSample;
 			trackerSpacePoints[sampleCount] = psm_vector3f_to_eigen_vector3(trackerRelativePosition);
@@ -186,8 +181,9 @@ struct TrackerRelativePoseStatistics
 
 //-- private methods -----
 static bool computeTrackerCameraPose(
-    const PSMTracker *trackerView,
-    TrackerRelativePoseStatistics &trackerCoregData);
+    const PSMMatrix3f cameraMatrix,
+    const PSMVector2f trackerPixelDimensions,
+    TrackerRelativePoseStatistics *trackerCoregData);
 
 //-- public methods -----
 AppSubStage_CalibrateWithMat::AppSubStage_CalibrateWithMat(
@@ -292,25 +288,14 @@ void AppSubStage_CalibrateWithMat::update()
             {
                 m_bNeedMoreSamplesAtLocation= false;
 
+                // The stream carries the samples of every tracker, so they all fill up at the same time
                 for (AppStage_ComputeTrackerPoses::t_tracker_state_map_iterator iter = m_parentStage->m_trackerViews.begin();
                     iter != m_parentStage->m_trackerViews.end(); 
                     ++iter)
                 {
                     const int trackerIndex = iter->second.listIndex;
-                    const PSMTracker *trackerView = iter->second.trackerView;
 
-                    if (m_deviceTrackerPoseStats[trackerIndex]->getIsComplete())
-                    {
-                        if (trackerView->tracker_info.tracker_id == m_sampleTrackerId)
-                        {
-                            m_sampleTrackerId= (m_sampleTrackerId + 1) % m_parentStage->m_trackerViews.size();
-
-                            PSMRequestID requestId;
-                            PSM_SetControllerDataStreamTrackerIndexAsync(ControllerView->ControllerID, m_sampleTrackerId, &requestId);
-                            PSM_EatResponse(requestId);
-                        }
-                    }
-                    else
+                    if (!m_deviceTrackerPoseStats[trackerIndex]->getIsComplete())
                     {
                         m_bNeedMoreSamplesAtLocation = true;
                     }
@@ -418,25 +403,14 @@ void AppSubStage_CalibrateWithMat::update()
             {
                 m_bNeedMoreSamplesAtLocation = false;
 
+                // The stream carries the samples of every tracker, so they all fill up at the same time
                 for (AppStage_ComputeTrackerPoses::t_tracker_state_map_iterator iter = m_parentStage->m_trackerViews.begin();
                     iter != m_parentStage->m_trackerViews.end(); 
                     ++iter)
                 {
                     const int trackerIndex = iter->second.listIndex;
-                    const PSMTracker *trackerView = iter->second.trackerView;
 
-                    if (m_deviceTrackerPoseStats[trackerIndex]->getIsComplete())
-                    {
-                        if (trackerView->tracker_info.tracker_id == m_sampleTrackerId)
-                        {
-                            m_sampleTrackerId= (m_sampleTrackerId + 1) % m_parentStage->m_trackerViews.size();
-
-                            PSMRequestID requestId;
-                            PSM_SetHmdDataStreamTrackerIndexAsync(HmdView->HmdID, m_sampleTrackerId, &requestId);
-                            PSM_EatResponse(requestId);
-                        }
-                    }
-                    else
+                    if (!m_deviceTrackerPoseStats[trackerIndex]->getIsComplete())
                     {
                         m_bNeedMoreSamplesAtLocation = true;
                     }
@@ -500,16 +474,33 @@ void AppSubStage_CalibrateWithMat::update()
         {
             bool bSuccess = true;
 
-            // Compute and the pose transform for each tracker
+            // Compute the pose transform for each tracker.
+            // The trackers don't depend on each other so each solve runs on its own thread.
+            // The tracker intrinsics are read from the client here since it isn't thread safe.
+            std::vector< std::future<bool> > trackerPoseResults;
             for (AppStage_ComputeTrackerPoses::t_tracker_state_map_iterator iter = m_parentStage->m_trackerViews.begin();
-                bSuccess && iter != m_parentStage->m_trackerViews.end();
+                iter != m_parentStage->m_trackerViews.end();
                 ++iter)
             {
                 const int trackerIndex = iter->second.listIndex;
                 const PSMTracker *trackerView = iter->second.trackerView;
-                TrackerRelativePoseStatistics &trackerSampleData = *m_deviceTrackerPoseStats[trackerIndex];
+                TrackerRelativePoseStatistics *trackerSampleData = m_deviceTrackerPoseStats[trackerIndex];
+
+                PSMMatrix3f cameraMatrix;
+                PSM_GetTrackerIntrinsicMatrix(trackerView->tracker_info.tracker_id, &cameraMatrix);
+
+                trackerPoseResults.push_back(
+                    std::async(
+                        std::launch::async, 
+                        computeTrackerCameraPose, 
+                        cameraMatrix, 
+                        trackerView->tracker_info.tracker_screen_dimensions, 
+                        trackerSampleData));
+            }
 
-                bSuccess&= computeTrackerCameraPose(trackerView, trackerSampleData);
+            for (std::future<bool> &trackerPoseResult : trackerPoseResults)
+            {
+                bSuccess&= trackerPoseResult.get();
             }
 
             if (bSuccess)
@@ -784,7 +775,6 @@ void AppSubStage_CalibrateWithMat::onEnterState(
             m_sampleLocationIndex = 0;
             m_bIsStable = false;
             m_bForceStable = false;
-            m_sampleTrackerId= 0;
         }
         break;
     case AppSubStage_CalibrateWithMat::eMenuState::calibrationStepPlaceController:
@@ -802,25 +792,6 @@ void AppSubStage_CalibrateWithMat::onEnterState(
             m_bIsStable = false;
             m_bForceStable= false;
             m_bNeedMoreSamplesAtLocation= true;
-            m_sampleTrackerId= 0;
-
-            // Start off getting getting projection data from tracker 0
-            if (newState == AppSubStage_CalibrateWithMat::eMenuState::calibrationStepPlaceController)
-            {
-                const PSMController *ControllerView= m_parentStage->get_calibration_controller_view();
-                PSMRequestID requestId;
-
-                PSM_SetControllerDataStreamTrackerIndexAsync(ControllerView->ControllerID, 0, &requestId);
-                PSM_EatResponse(requestId);
-            }
-            else if (newState == AppSubStage_CalibrateWithMat::eMenuState::calibrationStepPlaceHMD)
-            {
-                const PSMHeadMountedDisplay *HmdView= m_parentStage->get_calibration_hmd_view();
-                PSMRequestID requestId;
-
-                PSM_SetHmdDataStreamTrackerIndexAsync(HmdView->HmdID, 0, &requestId);
-                PSM_EatResponse(requestId);
-            }
         } break;
     case AppSubStage_CalibrateWithMat::eMenuState::calibrationStepRecordController:
     case AppSubStage_CalibrateWithMat::eMenuState::calibrationStepRecordHMD:
@@ -837,15 +808,13 @@ void AppSubStage_CalibrateWithMat::onEnterState(
 //-- math helper functions -----
 static bool
 computeTrackerCameraPose(
-    const PSMTracker *trackerView,
-    TrackerRelativePoseStatistics &trackerCoregData)
+    const PSMMatrix3f cameraMatrix,
+    const PSMVector2f trackerPixelDimensions,
+    TrackerRelativePoseStatistics *trackerCoregDataPtr)
 {
-    // Get the pixel width and height of the tracker image
-    const PSMVector2f trackerPixelDimensions = trackerView->tracker_info.tracker_screen_dimensions;
+    TrackerRelativePoseStatistics &trackerCoregData = *trackerCoregDataPtr;
 
-    // Get the tracker "intrinsic" matrix that encodes the camera FOV
-    PSMMatrix3f cameraMatrix;
-	PSM_GetTrackerIntrinsicMatrix(trackerView->tracker_info.tracker_id, &cameraMatrix);
+    // The tracker "intrinsic" matrix encodes the camera FOV
     cv::Matx33f cvCameraMatrix = psmove_matrix3x3_to_cv_mat33f(cameraMatrix);
 
     // Copy the object/image point mappings into OpenCV format
@@ -56,7 +56,6 @@ private:
 
 	struct TrackerRelativePoseStatistics *m_deviceTrackerPoseStats[PSMOVESERVICE_MAX_TRACKER_COUNT];
 
-    int m_sampleTrackerId;
     int m_sampleLocationIndex;
     bool m_bNeedMoreSamplesAtLocation;
 };
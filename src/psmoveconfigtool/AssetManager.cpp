@@ -1,6 +1,7 @@
 //-- includes -----
 #include "AssetManager.h"
 #include "Logger.h"
+#include "Renderer.h"
 
 #define STB_TRUETYPE_IMPLEMENTATION
 #include "stb_truetype.h"
@@ -13,6 +14,9 @@
 
 #include <imgui.h>
 
+#include <stdint.h>
+#include <string.h>
+
 //-- constants -----
 static const char *k_ps3eye_texture_filename= "./assets/textures/PS3EyeDiffuse.jpg";
 static const char *k_psmove_texture_filename= "./assets/textures/PSMoveDiffuse.jpg";
@@ -22,6 +26,23 @@ static const char *k_virtual_texture_filename = "./assets/textures/VirtualDiffus
 static const char *k_morpheus_texture_filename = "./assets/textures/MorpheusDiffuse.jpg";
 static const char *k_dk2_texture_filename = "./assets/textures/DK2Diffuse.jpg";
 
+static const char *k_ps3eye_mesh_filename = "./assets/models/ps3eye.mesh";
+static const char *k_psmove_body_mesh_filename = "./assets/models/psmovebody.mesh";
+static const char *k_psmove_bulb_mesh_filename = "./assets/models/psmovebulb.mesh";
+static const char *k_psnavi_mesh_filename = "./assets/models/psnavi.mesh";
+static const char *k_psdualshock4_body_mesh_filename = "./assets/models/ds4body.mesh";
+static const char *k_psdualshock4_lightbar_mesh_filename = "./assets/models/ds4lightbar.mesh";
+static const char *k_morpheus_mesh_filename = "./assets/models/morpheus.mesh";
+static const char *k_dk2_mesh_filename = "./assets/models/dk2.mesh";
+
+// Binary mesh format written by source_assets/obj2mesh.pl (little endian)
+static const uint32_t k_mesh_magic = 0x4D4D5350; // 'PSMM'
+static const uint32_t k_mesh_version = 1;
+static const uint32_t k_mesh_flag_has_normals = 1;
+static const uint32_t k_mesh_flag_has_texcoords = 2;
+static const uint32_t k_mesh_flag_quantized = 4;
+static const float k_mesh_quantized_max = 32767.f;
+
 static const char *k_default_font_filename= "./assets/fonts/OpenSans-Regular.ttf";
 static const float k_default_font_pixel_height= 24.f;
 
@@ -31,6 +52,19 @@ static const unsigned int k_font_texture_height = 512;
 static const size_t k_kilo= 1<<10;
 static const size_t k_meg= 1<<20;
 
+//-- definitions -----
+struct MeshFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t vertex_count;
+    float position_offset[3];
+    float position_scale[3];
+    float texcoord_offset[2];
+    float texcoord_scale[2];
+};
+
 //-- statics -----
 AssetManager *AssetManager::m_instance= NULL;
 
@@ -42,6 +76,14 @@ AssetManager::AssetManager()
     , m_psdualshock4Texture()
     , m_morpheusTexture()
     , m_dk2Texture()
+    , m_ps3eyeMesh()
+    , m_psmoveBodyMesh()
+    , m_psmoveBulbMesh()
+    , m_psnaviMesh()
+    , m_psdualshock4BodyMesh()
+    , m_psdualshock4LightbarMesh()
+    , m_morpheusMesh()
+    , m_dk2Mesh()
     , m_defaultFont()
 {
 }
@@ -120,11 +162,59 @@ void AssetManager::destroy()
     m_psdualshock4Texture.dispose();
     m_morpheusTexture.dispose();
     m_dk2Texture.dispose();
+    m_ps3eyeMesh.dispose();
+    m_psmoveBodyMesh.dispose();
+    m_psmoveBulbMesh.dispose();
+    m_psnaviMesh.dispose();
+    m_psdualshock4BodyMesh.dispose();
+    m_psdualshock4LightbarMesh.dispose();
+    m_morpheusMesh.dispose();
+    m_dk2Mesh.dispose();
     m_defaultFont.dispose();
 
     m_instance= NULL;
 }
 
+const MeshAsset *AssetManager::getPS3EyeMeshAsset()
+{
+    return fetchMesh(k_ps3eye_mesh_filename, &m_ps3eyeMesh);
+}
+
+const MeshAsset *AssetManager::getPSMoveBodyMeshAsset()
+{
+    return fetchMesh(k_psmove_body_mesh_filename, &m_psmoveBodyMesh);
+}
+
+const MeshAsset *AssetManager::getPSMoveBulbMeshAsset()
+{
+    return fetchMesh(k_psmove_bulb_mesh_filename, &m_psmoveBulbMesh);
+}
+
+const MeshAsset *AssetManager::getPSNaviMeshAsset()
+{
+    return fetchMesh(k_psnavi_mesh_filename, &m_psnaviMesh);
+}
+
+const MeshAsset *AssetManager::getPSDualShock4BodyMeshAsset()
+{
+    return fetchMesh(k_psdualshock4_body_mesh_filename, &m_psdualshock4BodyMesh);
+}
+
+const MeshAsset *AssetManager::getPSDualShock4LightbarMeshAsset()
+{
+    return fetchMesh(k_psdualshock4_lightbar_mesh_filename, &m_psdualshock4LightbarMesh);
+}
+
+const MeshAsset *AssetManager::getMorpheusMeshAsset()
+{
+    return fetchMesh(k_morpheus_mesh_filename, &m_morpheusMesh);
+}
+
+const MeshAsset *AssetManager::getDK2MeshAsset()
+{
+    return fetchMesh(k_dk2_mesh_filename, &m_dk2Mesh);
+}
+
 //-- private methods -----
 bool AssetManager::loadTexture(const char *filename, TextureAsset *textureAsset)
 {
@@ -219,6 +309,205 @@ bool AssetManager::loadFont(const char *filename, const float pixelHeight, FontA
     return success;
 }
 
+const MeshAsset *AssetManager::fetchMesh(const char *filename, MeshAsset *meshAsset)
+{
+    // Only try once, so a missing mesh doesn't hit the disk every frame
+    if (!meshAsset->load_attempted)
+    {
+        if (!loadMesh(filename, meshAsset))
+        {
+            meshAsset->dispose();
+        }
+
+        meshAsset->load_attempted = true;
+    }
+
+    return meshAsset;
+}
+
+bool AssetManager::loadMesh(const char *filename, MeshAsset *meshAsset)
+{
+    unsigned char *file_buffer = NULL;
+    size_t file_size = 0;
+    MeshFileHeader header;
+
+    bool success= true;
+
+    // Load the mesh file into memory
+    FILE *fp= fopen(filename, "rb");
+    if (fp != NULL)
+    {
+        // obtain file size
+        fseek(fp, 0, SEEK_END);
+        file_size = ftell(fp);
+        rewind(fp);
+
+        if (file_size >= sizeof(MeshFileHeader) && file_size < 64*k_meg)
+        {
+            file_buffer= new unsigned char[file_size];
+            size_t bytes_read= fread(file_buffer, 1, file_size, fp);
+
+            if (bytes_read != file_size)
+            {
+                Log_ERROR("AssetManager::loadMesh", "Failed to load mesh (%s): failed to read expected # of bytes.", filename);
+                success= false;
+            }
+        }
+        else
+        {
+            Log_ERROR("AssetManager::loadMesh", "Failed to load mesh (%s): file size invalid", filename);
+            success= false;
+        }
+
+        fclose(fp);
+    }
+    else
+    {
+        Log_ERROR("AssetManager::loadMesh", "Failed to open mesh file (%s)", filename);
+        success= false;
+    }
+
+    // Validate the header against the size of the vertex data
+    size_t attribute_size= 0;
+    size_t vertex_size= 0;
+    bool has_normals= false;
+    bool has_texcoords= false;
+    bool quantized= false;
+    if (success)
+    {
+        memcpy(&header, file_buffer, sizeof(MeshFileHeader));
+
+        has_normals= (header.flags & k_mesh_flag_has_normals) != 0;
+        has_texcoords= (header.flags & k_mesh_flag_has_texcoords) != 0;
+        quantized= (header.flags & k_mesh_flag_quantized) != 0;
+        attribute_size= quantized ? sizeof(int16_t) : sizeof(float);
+        vertex_size= attribute_size*(3 + (has_normals ? 3 : 0) + (has_texcoords ? 2 : 0));
+
+        if (header.magic != k_mesh_magic || header.version != k_mesh_version)
+        {
+            Log_ERROR("AssetManager::loadMesh", "Failed to load mesh (%s): not a version %d mesh file", filename, k_mesh_version);
+            success= false;
+        }
+        else if (header.vertex_count == 0 ||
+                 header.vertex_count > (file_size - sizeof(MeshFileHeader)) / vertex_size)
+        {
+            Log_ERROR("AssetManager::loadMesh", "Failed to load mesh (%s): vertex count invalid", filename);
+            success= false;
+        }
+    }
+
+    // Unpack the vertex data into the interleaved float layout the renderer draws from
+    if (success)
+    {
+        meshAsset->init(header.vertex_count, has_normals, has_texcoords);
+
+        const unsigned char *read_ptr= file_buffer + sizeof(MeshFileHeader);
+        float *write_ptr= meshAsset->vertex_data;
+
+        for (unsigned int vertex_index = 0; vertex_index < header.vertex_count; ++vertex_index)
+        {
+            for (int attribute_index = 0; attribute_index < 8; ++attribute_index)
+            {
+                const bool is_normal= attribute_index >= 3 && attribute_index < 6;
+                const bool is_texcoord= attribute_index >= 6;
+
+                if ((is_normal && !has_normals) || (is_texcoord && !has_texcoords))
+                {
+                    continue;
+                }
+
+                float value;
+                if (quantized)
+                {
+                    int16_t quantized_value;
+                    memcpy(&quantized_value, read_ptr, sizeof(int16_t));
+
+                    if (is_texcoord)
+                    {
+                        value= header.texcoord_offset[attribute_index - 6] +
+                            static_cast<float>(quantized_value)*header.texcoord_scale[attribute_index - 6];
+                    }
+                    else if (is_normal)
+                    {
+                        value= static_cast<float>(quantized_value) / k_mesh_quantized_max;
+                    }
+                    else
+                    {
+                        value= header.position_offset[attribute_index] +
+                            static_cast<float>(quantized_value)*header.position_scale[attribute_index];
+                    }
+                }
+                else
+                {
+                    memcpy(&value, read_ptr, sizeof(float));
+                }
+
+                *write_ptr= value;
+                ++write_ptr;
+                read_ptr+= attribute_size;
+            }
+        }
+
+        meshAsset->uploadToVertexBuffer();
+    }
+
+    if (file_buffer != NULL)
+    {
+        delete[] file_buffer;
+    }
+
+    return success;
+}
+
+//-- Mesh Asset -----
+void MeshAsset::init(unsigned int vertex_count, bool has_normals, bool has_texcoords)
+{
+    dispose();
+
+    this->vertex_count= vertex_count;
+    this->vertex_stride= 3 + (has_normals ? 3 : 0) + (has_texcoords ? 2 : 0);
+    this->has_normals= has_normals;
+    this->has_texcoords= has_texcoords;
+    this->vertex_data= new float[vertex_count*vertex_stride];
+}
+
+void MeshAsset::uploadToVertexBuffer()
+{
+    if (vertex_data != NULL && vertex_buffer_id == 0)
+    {
+        vertex_buffer_id=
+            Renderer::createStaticVertexBuffer(vertex_data, vertex_count*getStrideBytes());
+
+        // Keep drawing from the CPU copy if the driver has no vertex buffers
+        if (vertex_buffer_id != 0)
+        {
+            delete[] vertex_data;
+            vertex_data= NULL;
+        }
+    }
+}
+
+void MeshAsset::dispose()
+{
+    if (vertex_buffer_id != 0)
+    {
+        Renderer::destroyBuffer(vertex_buffer_id);
+        vertex_buffer_id= 0;
+    }
+
+    if (vertex_data != NULL)
+    {
+        delete[] vertex_data;
+        vertex_data= NULL;
+    }
+
+    vertex_count= 0;
+    vertex_stride= 0;
+    has_normals= false;
+    has_texcoords= false;
+    load_attempted= false;
+}
+
 //-- Font Asset -----
 bool TextureAsset::init(
     unsigned int width,
@@ -259,34 +548,88 @@ bool TextureAsset::init(
     return success;
 }
 
+size_t TextureAsset::getBufferSize() const
+{
+    size_t bytes_per_pixel= 1;
+
+    switch (buffer_format)
+    {
+    case GL_RGB:
+    case GL_BGR:
+        bytes_per_pixel= 3;
+        break;
+    case GL_RGBA:
+    case GL_BGRA:
+        bytes_per_pixel= 4;
+        break;
+    default:
+        bytes_per_pixel= 1;
+        break;
+    }
+
+    return static_cast<size_t>(texture_width)*static_cast<size_t>(texture_height)*bytes_per_pixel;
+}
+
 void TextureAsset::copyBufferIntoTexture(const unsigned char *pixels)
 {
     if (texture_id != 0)
     {
-        glPixelStorei(GL_UNPACK_SWAP_BYTES, GL_FALSE);
-        glPixelStorei(GL_UNPACK_LSB_FIRST, GL_TRUE);
-        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-        glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
-        glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        unsigned char *mapped_pixels= beginPixelBufferUpload();
 
-        glBindTexture(GL_TEXTURE_2D, texture_id);
-        glTexSubImage2D(
-            GL_TEXTURE_2D,
-            0,
-            0,
-            0,
-            texture_width,
-            texture_height,
-            buffer_format,
-            GL_UNSIGNED_BYTE,
-            pixels);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        if (mapped_pixels != nullptr)
+        {
+            memcpy(mapped_pixels, pixels, getBufferSize());
+            endPixelBufferUpload(true);
+        }
+        else
+        {
+            uploadPixels(pixels);
+        }
+    }
+}
+
+bool TextureAsset::copyTrackerVideoFrameIntoTexture(PSMTrackerID tracker_id)
+{
+    bool bNewFrame= false;
+
+    if (texture_id != 0)
+    {
+        unsigned char *mapped_pixels= beginPixelBufferUpload();
+
+        if (mapped_pixels != nullptr)
+        {
+            // Skip the client's own frame buffer, the frame goes from shared memory into the pixel buffer
+            bNewFrame=
+                PSM_PollTrackerVideoStreamIntoBuffer(tracker_id, mapped_pixels, getBufferSize()) == PSMResult_Success;
+            endPixelBufferUpload(bNewFrame);
+        }
+        else if (PSM_PollTrackerVideoStream(tracker_id) == PSMResult_Success)
+        {
+            const unsigned char *buffer= nullptr;
+
+            if (PSM_GetTrackerVideoFrameBuffer(tracker_id, &buffer) == PSMResult_Success)
+            {
+                uploadPixels(buffer);
+                bNewFrame= true;
+            }
+        }
     }
+
+    return bNewFrame;
 }
 
 void TextureAsset::dispose()
 {
+    for (int buffer_index = 0; buffer_index < 2; ++buffer_index)
+    {
+        if (pixel_buffer_ids[buffer_index] != 0)
+        {
+            Renderer::destroyBuffer(pixel_buffer_ids[buffer_index]);
+            pixel_buffer_ids[buffer_index]= 0;
+        }
+    }
+    pixel_buffer_index= 0;
+
     // Free the OpenGL video texture
     if (texture_id != 0)
     {
@@ -299,6 +642,61 @@ void TextureAsset::dispose()
     }
 }
 
+unsigned char *TextureAsset::beginPixelBufferUpload()
+{
+    const size_t buffer_size= getBufferSize();
+
+    if (!Renderer::getHasPixelBuffers() || buffer_size == 0)
+    {
+        return nullptr;
+    }
+
+    if (pixel_buffer_ids[0] == 0)
+    {
+        pixel_buffer_ids[0]= Renderer::createStreamingPixelBuffer(buffer_size);
+        pixel_buffer_ids[1]= Renderer::createStreamingPixelBuffer(buffer_size);
+    }
+
+    // Fill one pixel buffer while the driver may still be transferring the other one
+    pixel_buffer_index= (pixel_buffer_index + 1) % 2;
+
+    return Renderer::mapPixelBuffer(pixel_buffer_ids[pixel_buffer_index], buffer_size);
+}
+
+void TextureAsset::endPixelBufferUpload(bool bHasNewPixels)
+{
+    if (Renderer::unmapPixelBuffer() && bHasNewPixels)
+    {
+        // With the pixel buffer bound the "pixels" are an offset into it
+        uploadPixels(nullptr);
+    }
+
+    Renderer::unbindPixelBuffer();
+}
+
+void TextureAsset::uploadPixels(const unsigned char *pixels)
+{
+    glPixelStorei(GL_UNPACK_SWAP_BYTES, GL_FALSE);
+    glPixelStorei(GL_UNPACK_LSB_FIRST, GL_TRUE);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glBindTexture(GL_TEXTURE_2D, texture_id);
+    glTexSubImage2D(
+        GL_TEXTURE_2D,
+        0,
+        0,
+        0,
+        texture_width,
+        texture_height,
+        buffer_format,
+        GL_UNSIGNED_BYTE,
+        pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 //-- Font Asset -----
 bool FontAsset::init(
     unsigned char *ttf_buffer,
@@ -2,6 +2,9 @@
 #define ASSET_MANAGER_H
 
 #include "stb_truetype.h"
+#include "PSMoveClient_CAPI.h"
+
+#include <stddef.h>
 
 class TextureAsset
 {
@@ -12,19 +15,37 @@ public:
     unsigned int texture_format;
     unsigned int buffer_format;
 
+    // Streaming uploads alternate between two pixel buffers,
+    // created on the first upload if the driver supports them
+    unsigned int pixel_buffer_ids[2];
+    unsigned int pixel_buffer_index;
+
     TextureAsset()
         : texture_id(0)
         , texture_width(0)
         , texture_height(0)
         , texture_format(0)
         , buffer_format(0)
-    {}
+        , pixel_buffer_index(0)
+    {
+        pixel_buffer_ids[0]= 0;
+        pixel_buffer_ids[1]= 0;
+    }
     ~TextureAsset()
     { dispose(); }
 
     bool init(unsigned int width, unsigned int height, unsigned int texture_format, unsigned int buffer_format, unsigned char *buffer);
+    size_t getBufferSize() const;
     void copyBufferIntoTexture(const unsigned char *pixels);
+    // Copies the next video frame of a tracker straight from the video stream's shared memory
+    // into the texture's pixel buffer. Returns true if there was a new frame.
+    bool copyTrackerVideoFrameIntoTexture(PSMTrackerID tracker_id);
     void dispose();
+
+private:
+    unsigned char *beginPixelBufferUpload();
+    void endPixelBufferUpload(bool bHasNewPixels);
+    void uploadPixels(const unsigned char *pixels);
 };
 
 class FontAsset : public TextureAsset
@@ -41,6 +62,47 @@ public:
     bool init(unsigned char *ttf_buffer, float pixel_height);
 };
 
+class MeshAsset
+{
+public:
+    // Interleaved position[3], normal[3] (if any) and texcoord[2] (if any) per vertex.
+    // Once the vertices are in a vertex buffer the CPU copy is freed.
+    float *vertex_data;
+    unsigned int vertex_buffer_id;
+    unsigned int vertex_count;
+    unsigned int vertex_stride;
+    bool has_normals;
+    bool has_texcoords;
+    bool load_attempted;
+
+    MeshAsset()
+        : vertex_data(nullptr)
+        , vertex_buffer_id(0)
+        , vertex_count(0)
+        , vertex_stride(0)
+        , has_normals(false)
+        , has_texcoords(false)
+        , load_attempted(false)
+    {}
+    ~MeshAsset()
+    { dispose(); }
+
+    // Byte stride between two vertices, as taken by the gl*Pointer calls
+    unsigned int getStrideBytes() const
+    { return vertex_stride*sizeof(float); }
+
+    // Attribute offsets within a vertex, in floats
+    unsigned int getNormalOffset() const
+    { return 3; }
+
+    unsigned int getTexCoordOffset() const
+    { return has_normals ? 6 : 3; }
+
+    void init(unsigned int vertex_count, bool has_normals, bool has_texcoords);
+    void uploadToVertexBuffer();
+    void dispose();
+};
+
 class AssetManager
 {
 public:
@@ -77,9 +139,22 @@ public:
     const FontAsset *getDefaultFont()
     { return &m_defaultFont; }
 
+    // Meshes are loaded the first time they are asked for.
+    // A mesh that failed to load has no vertices.
+    const MeshAsset *getPS3EyeMeshAsset();
+    const MeshAsset *getPSMoveBodyMeshAsset();
+    const MeshAsset *getPSMoveBulbMeshAsset();
+    const MeshAsset *getPSNaviMeshAsset();
+    const MeshAsset *getPSDualShock4BodyMeshAsset();
+    const MeshAsset *getPSDualShock4LightbarMeshAsset();
+    const MeshAsset *getMorpheusMeshAsset();
+    const MeshAsset *getDK2MeshAsset();
+
 private:
     bool loadTexture(const char *filename, TextureAsset *textureAsset);
     bool loadFont(const char *filename, float pixelHeight, FontAsset *fontAsset);
+    const MeshAsset *fetchMesh(const char *filename, MeshAsset *meshAsset);
+    bool loadMesh(const char *filename, MeshAsset *meshAsset);
 
     // Utility Textures
 	TextureAsset m_ps3eyeTexture;
@@ -90,6 +165,16 @@ private:
     TextureAsset m_morpheusTexture;
     TextureAsset m_dk2Texture;
 
+    // Models
+    MeshAsset m_ps3eyeMesh;
+    MeshAsset m_psmoveBodyMesh;
+    MeshAsset m_psmoveBulbMesh;
+    MeshAsset m_psnaviMesh;
+    MeshAsset m_psdualshock4BodyMesh;
+    MeshAsset m_psdualshock4LightbarMesh;
+    MeshAsset m_morpheusMesh;
+    MeshAsset m_dk2Mesh;
+
     // Font Rendering
     FontAsset m_defaultFont;
 
@@ -16,16 +16,8 @@
 
 #include <imgui.h>
 
-#include "psmovebody_3dmodel.h"
-#include "psmovebulb_3dmodel.h"
-#include "psnavi_3dmodel.h"
-#include "ps3eye_3dmodel.h"
-#include "ds4body_3dmodel.h"
-#include "ds4lightbar_3dmodel.h"
-#include "morpheus_3dmodel.h"
-#include "dk2_3dmodel.h"
-
 #include <algorithm>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning (disable: 4505) // unreferenced local function has been removed (stb stuff)
@@ -45,13 +37,98 @@ static const ImVec4 k_clear_color = ImColor(114, 144, 154);
 
 static const glm::vec3 k_psmove_frustum_color = glm::vec3(0.1f, 0.7f, 0.3f);
 
+static const float k_point_cloud_point_size= 5.f;
+
+//-- definitions -----
+// Buffer object entry points, which have to be fetched from the driver at runtime
+struct GLBufferAPI
+{
+    PFNGLGENBUFFERSPROC genBuffers;
+    PFNGLDELETEBUFFERSPROC deleteBuffers;
+    PFNGLBINDBUFFERPROC bindBuffer;
+    PFNGLBUFFERDATAPROC bufferData;
+    PFNGLBUFFERSUBDATAPROC bufferSubData;
+    PFNGLMAPBUFFERPROC mapBuffer;
+    PFNGLUNMAPBUFFERPROC unmapBuffer;
+    bool bHasPixelBuffers;
+
+    bool getIsSupported() const
+    { return genBuffers != NULL && deleteBuffers != NULL && bindBuffer != NULL && bufferData != NULL && bufferSubData != NULL; }
+
+    bool getHasPixelBuffers() const
+    { return getIsSupported() && bHasPixelBuffers; }
+};
+
+struct DebugVertex
+{
+    glm::vec3 position;
+    glm::vec3 color;
+};
+
+// Collects the debug lines and points drawn during a stage render
+// so they go out in one draw call per primitive type instead of one glBegin/glEnd per shape.
+// Everything is transformed into the space of the current modelview matrix on the CPU.
+class DebugGeometryBatch
+{
+public:
+    DebugGeometryBatch()
+        : m_transform(1.f)
+        , m_vertexBufferId(0)
+        , m_vertexBufferCapacity(0)
+    {}
+
+    void setTransform(const glm::mat4 &transform)
+    { m_transform= transform; }
+
+    void addLine(const glm::vec3 &start, const glm::vec3 &end, const glm::vec3 &color)
+    {
+        addLine(start, end, color, color);
+    }
+
+    void addLine(const glm::vec3 &start, const glm::vec3 &end, const glm::vec3 &start_color, const glm::vec3 &end_color)
+    {
+        m_lineVertices.push_back(makeVertex(start, start_color));
+        m_lineVertices.push_back(makeVertex(end, end_color));
+    }
+
+    void addPoint(const glm::vec3 &point, const glm::vec3 &color)
+    {
+        m_pointVertices.push_back(makeVertex(point, color));
+    }
+
+    void flush();
+    void dispose();
+
+private:
+    DebugVertex makeVertex(const glm::vec3 &point, const glm::vec3 &color) const
+    {
+        DebugVertex vertex;
+        vertex.position= glm::vec3(m_transform * glm::vec4(point, 1.f));
+        vertex.color= color;
+        return vertex;
+    }
+
+    void drawVertices(GLenum mode, const std::vector<DebugVertex> &vertices, size_t first_vertex);
+
+    glm::mat4 m_transform;
+    std::vector<DebugVertex> m_lineVertices;
+    std::vector<DebugVertex> m_pointVertices;
+    GLuint m_vertexBufferId;
+    size_t m_vertexBufferCapacity;
+};
+
 //-- statics -----
 Renderer *Renderer::m_instance= NULL;
 
+static GLBufferAPI g_glBufferAPI= {NULL, NULL, NULL, NULL, NULL, NULL, NULL, false};
+static DebugGeometryBatch g_debugGeometryBatch;
+
 //-- prototypes -----
 static const char* ImGui_ImplSdl_GetClipboardText();
 static void ImGui_ImplSdl_SetClipboardText(const char* text);
 static void ImGui_ImplSdl_RenderDrawLists(ImDrawData* draw_data);
+static void drawMeshAsset(const MeshAsset *mesh);
+static const GLvoid *getMeshAttributePointer(const MeshAsset *mesh, unsigned int float_offset);
 
 //-- public methods -----
 Renderer::Renderer()
@@ -129,6 +206,31 @@ bool Renderer::init()
         }
     }
 
+    if (success)
+    {
+        g_glBufferAPI.genBuffers= (PFNGLGENBUFFERSPROC)SDL_GL_GetProcAddress("glGenBuffers");
+        g_glBufferAPI.deleteBuffers= (PFNGLDELETEBUFFERSPROC)SDL_GL_GetProcAddress("glDeleteBuffers");
+        g_glBufferAPI.bindBuffer= (PFNGLBINDBUFFERPROC)SDL_GL_GetProcAddress("glBindBuffer");
+        g_glBufferAPI.bufferData= (PFNGLBUFFERDATAPROC)SDL_GL_GetProcAddress("glBufferData");
+        g_glBufferAPI.bufferSubData= (PFNGLBUFFERSUBDATAPROC)SDL_GL_GetProcAddress("glBufferSubData");
+        g_glBufferAPI.mapBuffer= (PFNGLMAPBUFFERPROC)SDL_GL_GetProcAddress("glMapBuffer");
+        g_glBufferAPI.unmapBuffer= (PFNGLUNMAPBUFFERPROC)SDL_GL_GetProcAddress("glUnmapBuffer");
+        g_glBufferAPI.bHasPixelBuffers=
+            g_glBufferAPI.mapBuffer != NULL && g_glBufferAPI.unmapBuffer != NULL &&
+            (SDL_GL_ExtensionSupported("GL_ARB_pixel_buffer_object") == SDL_TRUE ||
+             SDL_GL_ExtensionSupported("GL_EXT_pixel_buffer_object") == SDL_TRUE);
+
+        if (!g_glBufferAPI.getIsSupported())
+        {
+            Log_INFO("Renderer::init", "Vertex buffers not supported, falling back to client side vertex arrays");
+            memset(&g_glBufferAPI, 0, sizeof(g_glBufferAPI));
+        }
+        else if (!g_glBufferAPI.getHasPixelBuffers())
+        {
+            Log_INFO("Renderer::init", "Pixel buffers not supported, falling back to direct texture uploads");
+        }
+    }
+
     // Setup ImGui key-bindings and callback functions
     if (success)
     {
@@ -194,6 +296,9 @@ bool Renderer::init()
 
 void Renderer::destroy()
 {
+    g_debugGeometryBatch.dispose();
+    memset(&g_glBufferAPI, 0, sizeof(g_glBufferAPI));
+
     if (m_FontTexture)
     {
         glDeleteTextures(1, &m_FontTexture);
@@ -290,6 +395,8 @@ void Renderer::renderStageBegin()
 
 void Renderer::renderStageEnd()
 {
+    g_debugGeometryBatch.flush();
+
     m_isRenderingStage= false;
 }
 
@@ -374,6 +481,176 @@ void Renderer::renderEnd()
     SDL_GL_SwapWindow(m_window);
 }
 
+unsigned int Renderer::createStaticVertexBuffer(const void *data, size_t size_bytes)
+{
+    GLuint buffer_id= 0;
+
+    if (g_glBufferAPI.getIsSupported())
+    {
+        g_glBufferAPI.genBuffers(1, &buffer_id);
+        g_glBufferAPI.bindBuffer(GL_ARRAY_BUFFER, buffer_id);
+        g_glBufferAPI.bufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(size_bytes), data, GL_STATIC_DRAW);
+        g_glBufferAPI.bindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    return buffer_id;
+}
+
+bool Renderer::getHasPixelBuffers()
+{
+    return g_glBufferAPI.getHasPixelBuffers();
+}
+
+unsigned int Renderer::createStreamingPixelBuffer(size_t size_bytes)
+{
+    GLuint buffer_id= 0;
+
+    if (g_glBufferAPI.getHasPixelBuffers())
+    {
+        g_glBufferAPI.genBuffers(1, &buffer_id);
+        g_glBufferAPI.bindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer_id);
+        g_glBufferAPI.bufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(size_bytes), NULL, GL_STREAM_DRAW);
+        g_glBufferAPI.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    return buffer_id;
+}
+
+unsigned char *Renderer::mapPixelBuffer(unsigned int buffer_id, size_t size_bytes)
+{
+    unsigned char *pixels= nullptr;
+
+    if (buffer_id != 0 && g_glBufferAPI.getHasPixelBuffers())
+    {
+        g_glBufferAPI.bindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer_id);
+
+        // Orphan the old contents so mapping doesn't wait on a transfer still reading them
+        g_glBufferAPI.bufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(size_bytes), NULL, GL_STREAM_DRAW);
+        pixels= reinterpret_cast<unsigned char *>(g_glBufferAPI.mapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY));
+
+        if (pixels == nullptr)
+        {
+            g_glBufferAPI.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+    }
+
+    return pixels;
+}
+
+bool Renderer::unmapPixelBuffer()
+{
+    // GL_FALSE means the buffer contents got lost while mapped (e.g. a display mode change)
+    return g_glBufferAPI.getHasPixelBuffers() && g_glBufferAPI.unmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+}
+
+void Renderer::unbindPixelBuffer()
+{
+    if (g_glBufferAPI.getHasPixelBuffers())
+    {
+        g_glBufferAPI.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+}
+
+void Renderer::destroyBuffer(unsigned int buffer_id)
+{
+    if (buffer_id != 0 && g_glBufferAPI.getIsSupported())
+    {
+        GLuint gl_buffer_id= buffer_id;
+
+        g_glBufferAPI.deleteBuffers(1, &gl_buffer_id);
+    }
+}
+
+//-- Debug Geometry Batch -----
+void DebugGeometryBatch::flush()
+{
+    const size_t vertex_count= m_lineVertices.size() + m_pointVertices.size();
+
+    if (vertex_count > 0)
+    {
+        // Stream both primitive types through a single buffer, re-specified every flush
+        if (m_vertexBufferId == 0 && g_glBufferAPI.getIsSupported())
+        {
+            g_glBufferAPI.genBuffers(1, &m_vertexBufferId);
+            m_vertexBufferCapacity= 0;
+        }
+
+        if (m_vertexBufferId != 0)
+        {
+            const size_t line_bytes= m_lineVertices.size()*sizeof(DebugVertex);
+            const size_t point_bytes= m_pointVertices.size()*sizeof(DebugVertex);
+
+            g_glBufferAPI.bindBuffer(GL_ARRAY_BUFFER, m_vertexBufferId);
+            m_vertexBufferCapacity= std::max(m_vertexBufferCapacity, vertex_count);
+            g_glBufferAPI.bufferData(
+                GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_vertexBufferCapacity*sizeof(DebugVertex)), NULL, GL_STREAM_DRAW);
+            if (line_bytes > 0)
+            {
+                g_glBufferAPI.bufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(line_bytes), m_lineVertices.data());
+            }
+            if (point_bytes > 0)
+            {
+                g_glBufferAPI.bufferSubData(
+                    GL_ARRAY_BUFFER, static_cast<GLintptr>(line_bytes), static_cast<GLsizeiptr>(point_bytes), m_pointVertices.data());
+            }
+        }
+
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+
+        drawVertices(GL_LINES, m_lineVertices, 0);
+
+        glPointSize(k_point_cloud_point_size);
+        drawVertices(GL_POINTS, m_pointVertices, m_lineVertices.size());
+
+        glDisableClientState(GL_COLOR_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+
+        if (m_vertexBufferId != 0)
+        {
+            g_glBufferAPI.bindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+
+        // Drawing with a color array leaves the current color undefined
+        glColor3f(1.f, 1.f, 1.f);
+
+        m_lineVertices.clear();
+        m_pointVertices.clear();
+    }
+
+    m_transform= glm::mat4(1.f);
+}
+
+void DebugGeometryBatch::dispose()
+{
+    if (m_vertexBufferId != 0 && g_glBufferAPI.getIsSupported())
+    {
+        g_glBufferAPI.deleteBuffers(1, &m_vertexBufferId);
+    }
+
+    m_vertexBufferId= 0;
+    m_vertexBufferCapacity= 0;
+    m_lineVertices.clear();
+    m_pointVertices.clear();
+    m_transform= glm::mat4(1.f);
+}
+
+void DebugGeometryBatch::drawVertices(GLenum mode, const std::vector<DebugVertex> &vertices, size_t first_vertex)
+{
+    if (!vertices.empty())
+    {
+        // In the vertex buffer the vertices are at an offset, otherwise they come straight from the vector
+        const GLubyte *base=
+            (m_vertexBufferId != 0)
+            ? reinterpret_cast<const GLubyte *>(first_vertex*sizeof(DebugVertex))
+            : reinterpret_cast<const GLubyte *>(vertices.data());
+
+        glVertexPointer(3, GL_FLOAT, sizeof(DebugVertex), base + offsetof(DebugVertex, position));
+        glColorPointer(3, GL_FLOAT, sizeof(DebugVertex), base + offsetof(DebugVertex, color));
+        glDrawArrays(mode, 0, static_cast<GLsizei>(vertices.size()));
+    }
+}
+
 //-- Drawing Methods -----
 void drawArrow(
     const glm::mat4 &transform,
@@ -398,31 +675,22 @@ void drawArrow(
     const glm::vec3 headYPos= headOrigin + headUp*headSize;
     const glm::vec3 headYNeg= headOrigin - headUp*headSize;
    
-    glColor3fv(glm::value_ptr(color));
+    g_debugGeometryBatch.setTransform(transform);
 
-    glPushMatrix();
-    glMultMatrixf(glm::value_ptr(transform));
+    g_debugGeometryBatch.addLine(start, end, color);
 
-    glBegin(GL_LINES);
+    g_debugGeometryBatch.addLine(headXPos, headYPos, color);
+    g_debugGeometryBatch.addLine(headYPos, headXNeg, color);
+    g_debugGeometryBatch.addLine(headXNeg, headYNeg, color);
+    g_debugGeometryBatch.addLine(headYNeg, headXPos, color);
 
-    glVertex3fv(glm::value_ptr(start)); glVertex3fv(glm::value_ptr(end));
-        
-    glVertex3fv(glm::value_ptr(headXPos)); glVertex3fv(glm::value_ptr(headYPos));
-    glVertex3fv(glm::value_ptr(headYPos)); glVertex3fv(glm::value_ptr(headXNeg));
-    glVertex3fv(glm::value_ptr(headXNeg)); glVertex3fv(glm::value_ptr(headYNeg));
-    glVertex3fv(glm::value_ptr(headYNeg)); glVertex3fv(glm::value_ptr(headXPos));
+    g_debugGeometryBatch.addLine(headXPos, end, color);
+    g_debugGeometryBatch.addLine(headYPos, end, color);
+    g_debugGeometryBatch.addLine(headXNeg, end, color);
+    g_debugGeometryBatch.addLine(headYNeg, end, color);
 
-    glVertex3fv(glm::value_ptr(headXPos)); glVertex3fv(glm::value_ptr(end));
-    glVertex3fv(glm::value_ptr(headYPos)); glVertex3fv(glm::value_ptr(end));
-    glVertex3fv(glm::value_ptr(headXNeg)); glVertex3fv(glm::value_ptr(end));
-    glVertex3fv(glm::value_ptr(headYNeg)); glVertex3fv(glm::value_ptr(end));
-
-    glVertex3fv(glm::value_ptr(headXPos)); glVertex3fv(glm::value_ptr(headXNeg));
-    glVertex3fv(glm::value_ptr(headYPos)); glVertex3fv(glm::value_ptr(headYNeg));
-
-    glEnd();
-
-    glPopMatrix();
+    g_debugGeometryBatch.addLine(headXPos, headXNeg, color);
+    g_debugGeometryBatch.addLine(headYPos, headYNeg, color);
 }
 
 void drawTextAtWorldPosition(
@@ -433,6 +701,9 @@ void drawTextAtWorldPosition(
 {
     assert(Renderer::getIsRenderingStage());
 
+    // Keep the draw order of everything batched so far
+    g_debugGeometryBatch.flush();
+
     // Render with the default font
     const FontAsset *font= AssetManager::getInstance()->getDefaultFont();
 
@@ -523,6 +794,8 @@ void drawTextAtWorldPosition(
 
 void drawFullscreenTexture(const unsigned int texture_id)
 {
+    g_debugGeometryBatch.flush();
+
     // Save a backup of the projection matrix and replace with the identity matrix
     glMatrixMode(GL_PROJECTION);
     glPushMatrix();
@@ -573,6 +846,9 @@ void drawPointCloudProjection(
 {
 	assert(Renderer::getIsRenderingStage());
 
+	// Draw everything batched in world space before switching projections
+	g_debugGeometryBatch.flush();
+
 	// Clear the depth buffer to allow overdraw 
 	glClear(GL_DEPTH_BUFFER_BIT);
 
@@ -589,20 +865,17 @@ void drawPointCloudProjection(
 	glLoadIdentity();
 
 	// Draw a small color "+" for each point in the point count
-	glLineWidth(2.f);
 	for (int point_index = 0; point_index < point_count; ++point_index)
 	{
 		const PSMVector2f *point = &points[point_index];
 
-		glLineWidth(2.f);
-		glBegin(GL_LINES);
-		glColor3fv(glm::value_ptr(color));
-		glVertex3f(point->x - point_size, point->y, 0.5f);
-		glVertex3f(point->x + point_size, point->y, 0.5f);
-		glVertex3f(point->x, point->y + point_size, 0.5f);
-		glVertex3f(point->x, point->y - point_size, 0.5f);
-		glEnd();
+		g_debugGeometryBatch.addLine(
+			glm::vec3(point->x - point_size, point->y, 0.5f), glm::vec3(point->x + point_size, point->y, 0.5f), color);
+		g_debugGeometryBatch.addLine(
+			glm::vec3(point->x, point->y + point_size, 0.5f), glm::vec3(point->x, point->y - point_size, 0.5f), color);
 	}
+	glLineWidth(2.f);
+	g_debugGeometryBatch.flush();
 	glLineWidth(1.f);
 
 	// Restore the projection matrix
@@ -628,21 +901,10 @@ void drawTransformedAxes(const glm::mat4 &transform, float xScale, float yScale,
     glm::vec3 yAxis(0.f, yScale, 0.f);
     glm::vec3 zAxis(0.f, 0.f, zScale);
    
-    glPushMatrix();
-        glMultMatrixf(glm::value_ptr(transform));
-        glBegin(GL_LINES);
-
-        glColor3ub(255, 0, 0);
-        glVertex3fv(glm::value_ptr(origin)); glVertex3fv(glm::value_ptr(xAxis));
-
-        glColor3ub(0, 255, 0);
-        glVertex3fv(glm::value_ptr(origin)); glVertex3fv(glm::value_ptr(yAxis));
-
-        glColor3ub(0, 0, 255);
-        glVertex3fv(glm::value_ptr(origin)); glVertex3fv(glm::value_ptr(zAxis));
-
-        glEnd();
-    glPopMatrix();
+    g_debugGeometryBatch.setTransform(transform);
+    g_debugGeometryBatch.addLine(origin, xAxis, glm::vec3(1.f, 0.f, 0.f));
+    g_debugGeometryBatch.addLine(origin, yAxis, glm::vec3(0.f, 1.f, 0.f));
+    g_debugGeometryBatch.addLine(origin, zAxis, glm::vec3(0.f, 0.f, 1.f));
 }
 
 void drawTransformedBox(const glm::mat4 &transform, const glm::vec3 &half_extents, const glm::vec3 &color)
@@ -663,35 +925,30 @@ void drawTransformedBox(const glm::mat4 &transform, const glm::vec3 &box_min, co
     glm::vec3 v6(box_min.x, box_min.y, box_min.z);
     glm::vec3 v7(box_max.x, box_min.y, box_min.z);
 
-    glPushMatrix();
-        glMultMatrixf(glm::value_ptr(transform));
-        glColor3fv(glm::value_ptr(color));
-
-        glBegin(GL_LINES);
-
-        glVertex3fv(glm::value_ptr(v0)); glVertex3fv(glm::value_ptr(v1));
-        glVertex3fv(glm::value_ptr(v1)); glVertex3fv(glm::value_ptr(v2));
-        glVertex3fv(glm::value_ptr(v2)); glVertex3fv(glm::value_ptr(v3));
-        glVertex3fv(glm::value_ptr(v3)); glVertex3fv(glm::value_ptr(v0));
+    g_debugGeometryBatch.setTransform(transform);
 
-        glVertex3fv(glm::value_ptr(v4)); glVertex3fv(glm::value_ptr(v5));
-        glVertex3fv(glm::value_ptr(v5)); glVertex3fv(glm::value_ptr(v6));
-        glVertex3fv(glm::value_ptr(v6)); glVertex3fv(glm::value_ptr(v7));
-        glVertex3fv(glm::value_ptr(v7)); glVertex3fv(glm::value_ptr(v4));
+    g_debugGeometryBatch.addLine(v0, v1, color);
+    g_debugGeometryBatch.addLine(v1, v2, color);
+    g_debugGeometryBatch.addLine(v2, v3, color);
+    g_debugGeometryBatch.addLine(v3, v0, color);
 
-        glVertex3fv(glm::value_ptr(v0)); glVertex3fv(glm::value_ptr(v4));
-        glVertex3fv(glm::value_ptr(v1)); glVertex3fv(glm::value_ptr(v5));
-        glVertex3fv(glm::value_ptr(v2)); glVertex3fv(glm::value_ptr(v6));
-        glVertex3fv(glm::value_ptr(v3)); glVertex3fv(glm::value_ptr(v7));
+    g_debugGeometryBatch.addLine(v4, v5, color);
+    g_debugGeometryBatch.addLine(v5, v6, color);
+    g_debugGeometryBatch.addLine(v6, v7, color);
+    g_debugGeometryBatch.addLine(v7, v4, color);
 
-        glEnd();
-    glPopMatrix();
+    g_debugGeometryBatch.addLine(v0, v4, color);
+    g_debugGeometryBatch.addLine(v1, v5, color);
+    g_debugGeometryBatch.addLine(v2, v6, color);
+    g_debugGeometryBatch.addLine(v3, v7, color);
 }
 
 void drawTransformedTexturedCube(const glm::mat4 &transform, int textureId, float scale)
 {
     assert(Renderer::getIsRenderingStage());
 
+    g_debugGeometryBatch.flush();
+
     glBindTexture(GL_TEXTURE_2D, textureId);
     glColor3f(1.f, 1.f, 1.f);
 
@@ -765,50 +1022,35 @@ void drawTransformedFrustum(const glm::mat4 &transform, const PSMFrustum *frustu
     glm::vec3 far2 = origin - farX - farY + farZ;
     glm::vec3 far3 = origin + farX - farY + farZ;
 
-    glPushMatrix();
-    glMultMatrixf(glm::value_ptr(transform));
-    glColor3fv(glm::value_ptr(color));
-
-    glBegin(GL_LINES);
-
-    glVertex3fv(glm::value_ptr(near0)); glVertex3fv(glm::value_ptr(near1));
-    glVertex3fv(glm::value_ptr(near1)); glVertex3fv(glm::value_ptr(near2));
-    glVertex3fv(glm::value_ptr(near2)); glVertex3fv(glm::value_ptr(near3));
-    glVertex3fv(glm::value_ptr(near3)); glVertex3fv(glm::value_ptr(near0));
-
-    glVertex3fv(glm::value_ptr(far0)); glVertex3fv(glm::value_ptr(far1));
-    glVertex3fv(glm::value_ptr(far1)); glVertex3fv(glm::value_ptr(far2));
-    glVertex3fv(glm::value_ptr(far2)); glVertex3fv(glm::value_ptr(far3));
-    glVertex3fv(glm::value_ptr(far3)); glVertex3fv(glm::value_ptr(far0));
+    g_debugGeometryBatch.setTransform(transform);
 
-    glVertex3fv(glm::value_ptr(origin)); glVertex3fv(glm::value_ptr(far0));
-    glVertex3fv(glm::value_ptr(origin)); glVertex3fv(glm::value_ptr(far1));
-    glVertex3fv(glm::value_ptr(origin)); glVertex3fv(glm::value_ptr(far2));
-    glVertex3fv(glm::value_ptr(origin)); glVertex3fv(glm::value_ptr(far3));
+    g_debugGeometryBatch.addLine(near0, near1, color);
+    g_debugGeometryBatch.addLine(near1, near2, color);
+    g_debugGeometryBatch.addLine(near2, near3, color);
+    g_debugGeometryBatch.addLine(near3, near0, color);
 
-    glVertex3fv(glm::value_ptr(origin));
-    glColor3ub(0, 255, 0);
-    glVertex3fv(glm::value_ptr(nearCenter));
+    g_debugGeometryBatch.addLine(far0, far1, color);
+    g_debugGeometryBatch.addLine(far1, far2, color);
+    g_debugGeometryBatch.addLine(far2, far3, color);
+    g_debugGeometryBatch.addLine(far3, far0, color);
 
-    glEnd();
+    g_debugGeometryBatch.addLine(origin, far0, color);
+    g_debugGeometryBatch.addLine(origin, far1, color);
+    g_debugGeometryBatch.addLine(origin, far2, color);
+    g_debugGeometryBatch.addLine(origin, far3, color);
 
-    glPopMatrix();
+    g_debugGeometryBatch.addLine(origin, nearCenter, color, glm::vec3(0.f, 1.f, 0.f));
 }
 
 void drawPointCloud(const glm::mat4 &transform, const glm::vec3 &color, const float *points, const int point_count)
 {
     assert(Renderer::getIsRenderingStage());
 
-    glColor3fv(glm::value_ptr(color));
-
-    glPushMatrix();
-    glMultMatrixf(glm::value_ptr(transform));
-    glEnableClientState(GL_VERTEX_ARRAY);
-    glPointSize(5);
-    glVertexPointer(3, GL_FLOAT, 0, points);
-    glDrawArrays(GL_POINTS, 0, point_count);
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glPopMatrix();
+    g_debugGeometryBatch.setTransform(transform);
+    for (int point_index = 0; point_index < point_count; ++point_index)
+    {
+        g_debugGeometryBatch.addPoint(glm::make_vec3(&points[point_index*3]), color);
+    }
 }
 
 void drawEllipsoid(
@@ -822,12 +1064,11 @@ void drawEllipsoid(
     assert(subdiv >= 3);
     assert(Renderer::getIsRenderingStage());
 
-    glColor3fv(glm::value_ptr(color));
-    glPushMatrix();
-    glMultMatrixf(glm::value_ptr(transform));
+    g_debugGeometryBatch.setTransform(transform);
 
     const float angleStep = k_real_two_pi / static_cast<float>(subdiv);
     float angle;
+    glm::vec3 prevPoint;
 
     const glm::vec3 x_axis = basis[0];
     const glm::vec3 y_axis = basis[1];
@@ -837,57 +1078,50 @@ void drawEllipsoid(
     const float y_extent = extents[1];
     const float z_extent = extents[2];
 
-    glBegin(GL_LINE_STRIP);
-    angle = 0.f;
-    for (int index = 0; index <= subdiv; ++index)
+    prevPoint = x_extent*x_axis + center;
+    angle = angleStep;
+    for (int index = 1; index <= subdiv; ++index)
     {
         glm::vec3 point = x_extent*x_axis*cosf(angle) + y_extent*y_axis*sinf(angle) + center;
 
-        glVertex3fv(glm::value_ptr(point));
+        g_debugGeometryBatch.addLine(prevPoint, point, color);
+        prevPoint = point;
         angle += angleStep;
     }
-    glEnd();
 
-    glBegin(GL_LINE_STRIP);
-    angle = 0.f;
-    for (int index = 0; index <= subdiv; ++index)
+    prevPoint = x_extent*x_axis + center;
+    angle = angleStep;
+    for (int index = 1; index <= subdiv; ++index)
     {
         glm::vec3 point = x_extent*x_axis*cosf(angle) + z_extent*z_axis*sinf(angle) + center;
 
-        glVertex3fv(glm::value_ptr(point));
+        g_debugGeometryBatch.addLine(prevPoint, point, color);
+        prevPoint = point;
         angle += angleStep;
     }
-    glEnd();
 
-    glBegin(GL_LINE_STRIP);
-    angle = 0.f;
-    for (int index = 0; index <= subdiv; ++index)
+    prevPoint = y_extent*y_axis + center;
+    angle = angleStep;
+    for (int index = 1; index <= subdiv; ++index)
     {
         glm::vec3 point = y_extent*y_axis*cosf(angle) + z_extent*z_axis*sinf(angle) + center;
 
-        glVertex3fv(glm::value_ptr(point));
+        g_debugGeometryBatch.addLine(prevPoint, point, color);
+        prevPoint = point;
         angle += angleStep;
     }
-    glEnd();
-
-    glPopMatrix();
 }
 
 void drawLineStrip(const glm::mat4 &transform, const glm::vec3 &color, const float *points, const int point_count)
 {
     assert(Renderer::getIsRenderingStage());
 
-    glColor3fv(glm::value_ptr(color));
-    glPushMatrix();
-        glMultMatrixf(glm::value_ptr(transform));
-
-        glBegin(GL_LINE_STRIP);
-        for (int sampleIndex= 0; sampleIndex < point_count; ++sampleIndex)
-        {
-            glVertex3fv(&points[sampleIndex*3]);
-        }
-        glEnd();
-    glPopMatrix();
+    g_debugGeometryBatch.setTransform(transform);
+    for (int sampleIndex= 1; sampleIndex < point_count; ++sampleIndex)
+    {
+        g_debugGeometryBatch.addLine(
+            glm::make_vec3(&points[(sampleIndex-1)*3]), glm::make_vec3(&points[sampleIndex*3]), color);
+    }
 }
 
 void drawQuadList2d(const float trackerWidth, const float trackerHeight, const glm::vec3 &color, const float *points2d, const int point_count)
@@ -895,6 +1129,9 @@ void drawQuadList2d(const float trackerWidth, const float trackerHeight, const g
     assert(Renderer::getIsRenderingStage());
     assert((point_count % 4) == 0);
 
+    // Draw everything batched in world space before switching projections
+    g_debugGeometryBatch.flush();
+
     // Clear the depth buffer to allow overdraw 
     glClear(GL_DEPTH_BUFFER_BIT);
 
@@ -910,24 +1147,20 @@ void drawQuadList2d(const float trackerWidth, const float trackerHeight, const g
     glPushMatrix();
     glLoadIdentity();
 
-    // Draw line strip connecting all of the points on the line strip
-    glColor3fv(glm::value_ptr(color));
-    glBegin(GL_LINES);
+    // Draw the outline of each quad
     for (int sampleIndex= 0; sampleIndex < point_count; sampleIndex+=4)
     {
-        glVertex3f(points2d[sampleIndex*2+0], points2d[sampleIndex*2+1], 0.5f);
-        glVertex3f(points2d[sampleIndex*2+2], points2d[sampleIndex*2+3], 0.5f);
-
-        glVertex3f(points2d[sampleIndex*2+2], points2d[sampleIndex*2+3], 0.5f);
-        glVertex3f(points2d[sampleIndex*2+4], points2d[sampleIndex*2+5], 0.5f);
-
-        glVertex3f(points2d[sampleIndex*2+4], points2d[sampleIndex*2+5], 0.5f);
-        glVertex3f(points2d[sampleIndex*2+6], points2d[sampleIndex*2+7], 0.5f);
-
-        glVertex3f(points2d[sampleIndex*2+6], points2d[sampleIndex*2+7], 0.5f);
-        glVertex3f(points2d[sampleIndex*2+0], points2d[sampleIndex*2+1], 0.5f);
+        const glm::vec3 p0(points2d[sampleIndex*2+0], points2d[sampleIndex*2+1], 0.5f);
+        const glm::vec3 p1(points2d[sampleIndex*2+2], points2d[sampleIndex*2+3], 0.5f);
+        const glm::vec3 p2(points2d[sampleIndex*2+4], points2d[sampleIndex*2+5], 0.5f);
+        const glm::vec3 p3(points2d[sampleIndex*2+6], points2d[sampleIndex*2+7], 0.5f);
+
+        g_debugGeometryBatch.addLine(p0, p1, color);
+        g_debugGeometryBatch.addLine(p1, p2, color);
+        g_debugGeometryBatch.addLine(p2, p3, color);
+        g_debugGeometryBatch.addLine(p3, p0, color);
     }
-    glEnd();
+    g_debugGeometryBatch.flush();
 
     // Restore the projection matrix
     glMatrixMode(GL_PROJECTION);
@@ -942,6 +1175,9 @@ void drawOpenCVChessBoard(const float trackerWidth, const float trackerHeight, c
 {
     assert(Renderer::getIsRenderingStage());
 
+    // Draw everything batched in world space before switching projections
+    g_debugGeometryBatch.flush();
+
     // Clear the depth buffer to allow overdraw 
     glClear(GL_DEPTH_BUFFER_BIT);
 
@@ -958,62 +1194,46 @@ void drawOpenCVChessBoard(const float trackerWidth, const float trackerHeight, c
     glLoadIdentity();
 
     // Draw line strip connecting all of the corners on the chessboard
-    glBegin(GL_LINE_STRIP);
+    // and circles at each corner
+    glm::vec3 prevColor(1.f, 0.f, 0.f);
     for (int sampleIndex= 0; sampleIndex < point_count; ++sampleIndex)
     {
+        const glm::vec3 corner(points2d[sampleIndex*2+0], points2d[sampleIndex*2+1], 0.5f);
+        glm::vec3 color(1.f, 0.f, 0.f);
+
         if (validPoints)
         {
             // Match how OpenCV colors the line strip (red -> blue i.e. hue angle 0 to 255 degrees)
             const float hue= static_cast<float>(sampleIndex * 255 / point_count);
-            float r, g, b;
 
-            HSVtoRGB(hue, 1.f, 1.f, r, g, b);
-            glColor3f(r, g, b);
+            HSVtoRGB(hue, 1.f, 1.f, color.r, color.g, color.b);
         }
-        else
+
+        if (sampleIndex > 0)
         {
-            glColor3f(1.f, 0.f, 0.f);
-        }
+            const glm::vec3 prevCorner(points2d[sampleIndex*2-2], points2d[sampleIndex*2-1], 0.5f);
 
-        glVertex3f(points2d[sampleIndex*2+0], points2d[sampleIndex*2+1], 0.5f);
-    }
-    glEnd();
+            g_debugGeometryBatch.addLine(prevCorner, corner, prevColor, color);
+        }
 
-    // Draw circles at each corner
-    for (int sampleIndex= 0; sampleIndex < point_count; ++sampleIndex)
-    {
         const float radius= 2.f;
         const int subdiv = 8;
         const float angleStep = k_real_two_pi / static_cast<float>(subdiv);
-        float angle = 0.f;
-
-        if (validPoints)
-        {
-            // Match how OpenCV colors the line strip (red -> blue i.e. hue angle 0 to 255 degrees)
-            const float hue= static_cast<float>(sampleIndex * 255 / point_count);
-            float r, g, b;
-
-            HSVtoRGB(hue, 1.f, 1.f, r, g, b);
-            glColor3f(r, g, b);
-        }
-        else
-        {
-            glColor3f(1.f, 0.f, 0.f);
-        }
+        glm::vec3 prevPoint= corner + glm::vec3(radius, 0.f, 0.f);
+        float angle = angleStep;
 
-        glBegin(GL_LINE_STRIP);
-        for (int index = 0; index <= subdiv; ++index)
+        for (int index = 1; index <= subdiv; ++index)
         {
-            glm::vec3 point(
-                radius*cosf(angle) + points2d[sampleIndex*2+0],
-                radius*sinf(angle) + points2d[sampleIndex*2+1],
-                0.5f);
+            glm::vec3 point= corner + glm::vec3(radius*cosf(angle), radius*sinf(angle), 0.f);
 
-            glVertex3fv(glm::value_ptr(point));
+            g_debugGeometryBatch.addLine(prevPoint, point, color);
+            prevPoint= point;
             angle += angleStep;
         }
-        glEnd();
+
+        prevColor= color;
     }
+    g_debugGeometryBatch.flush();
 
     // Restore the projection matrix
     glMatrixMode(GL_PROJECTION);
@@ -1026,17 +1246,18 @@ void drawOpenCVChessBoard(const float trackerWidth, const float trackerHeight, c
 
 void drawPoseArrayStrip(const PSMPosef *poses, const int poseCount, const glm::vec3 &color)
 {
-    glColor3fv(glm::value_ptr(color));
-    glBegin(GL_LINE_STRIP);
+    g_debugGeometryBatch.setTransform(glm::mat4(1.f));
 
-    for (int sampleIndex = 0; sampleIndex < poseCount; ++sampleIndex)
+    for (int sampleIndex = 1; sampleIndex < poseCount; ++sampleIndex)
     {
+        const PSMPosef &prevPose = poses[sampleIndex-1];
         const PSMPosef &pose = poses[sampleIndex];
 
-        glVertex3f(pose.Position.x, pose.Position.y, pose.Position.z);
+        g_debugGeometryBatch.addLine(
+            glm::vec3(prevPose.Position.x, prevPose.Position.y, prevPose.Position.z),
+            glm::vec3(pose.Position.x, pose.Position.y, pose.Position.z),
+            color);
     }
-
-    glEnd();
 }
 
 void drawPS3EyeModel(const glm::mat4 &transform)
@@ -1053,9 +1274,7 @@ void drawPS3EyeModel(const glm::mat4 &transform)
         glMultMatrixf(glm::value_ptr(transform));
         glEnableClientState(GL_VERTEX_ARRAY);
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        glVertexPointer(3, GL_FLOAT, 0, ps3eyeVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, ps3eyeTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, ps3eyeNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getPS3EyeMeshAsset());
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
     glPopMatrix();
@@ -1079,14 +1298,10 @@ void drawPSMoveModel(const glm::mat4 &transform, const glm::vec3 &color)
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
         
         glColor3f(1.f, 1.f, 1.f);
-        glVertexPointer(3, GL_FLOAT, 0, psmovebodyVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psmovebodyTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psmovebodyNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getPSMoveBodyMeshAsset());
 
         glColor3fv(glm::value_ptr(color));
-        glVertexPointer(3, GL_FLOAT, 0, psmovebulbVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psmovebulbTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psmovebulbNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getPSMoveBulbMeshAsset());
 
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -1110,9 +1325,7 @@ void drawPSNaviModel(const glm::mat4 &transform)
         glMultMatrixf(glm::value_ptr(transform));
         glEnableClientState(GL_VERTEX_ARRAY);
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        glVertexPointer(3, GL_FLOAT, 0, psnaviVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psnaviTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psnaviNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getPSNaviMeshAsset());
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
     glPopMatrix();
@@ -1135,15 +1348,12 @@ void drawPSDualShock4Model(const glm::mat4 &transform, const glm::vec3 &color)
         glEnableClientState(GL_VERTEX_ARRAY);
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
         
-		glVertexPointer(3, GL_FLOAT, 0, ds4bodyVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, ds4bodyTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, ds4bodyNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getPSDualShock4BodyMeshAsset());
 
 		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 
 		glColor3fv(glm::value_ptr(color));
-		glVertexPointer(3, GL_FLOAT, 0, ds4lightbarVerts);
-		glDrawArrays(GL_TRIANGLES, 0, ds4lightbarNumVerts);
+		drawMeshAsset(AssetManager::getInstance()->getPSDualShock4LightbarMeshAsset());
 
         glDisableClientState(GL_VERTEX_ARRAY);
     glPopMatrix();
@@ -1167,14 +1377,10 @@ void drawVirtualControllerModel(const glm::mat4 &transform, const glm::vec3 &col
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
         
         glColor3f(1.f, 1.f, 1.f);
-        glVertexPointer(3, GL_FLOAT, 0, psmovebodyVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psmovebodyTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psmovebodyNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getPSMoveBodyMeshAsset());
 
         glColor3fv(glm::value_ptr(color));
-        glVertexPointer(3, GL_FLOAT, 0, psmovebulbVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psmovebulbTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psmovebulbNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getPSMoveBulbMeshAsset());
 
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -1229,9 +1435,7 @@ void drawMorpheusModel(const glm::mat4 &transform)
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
         
         glColor3f(1.f, 1.f, 1.f);
-        glVertexPointer(3, GL_FLOAT, 0, morpheusVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, morpheusTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, morpheusNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getMorpheusMeshAsset());
 
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -1259,9 +1463,7 @@ void drawVirtualHMDModel(const glm::mat4 &transform, const glm::vec3 &color)
         glEnableClientState(GL_TEXTURE_COORD_ARRAY);
         
         glColor3f(1.f, 1.f, 1.f);
-        glVertexPointer(3, GL_FLOAT, 0, DK2Verts);
-        glTexCoordPointer(2, GL_FLOAT, 0, DK2TexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, DK2NumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getDK2MeshAsset());
 
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -1279,9 +1481,7 @@ void drawVirtualHMDModel(const glm::mat4 &transform, const glm::vec3 &color)
         glColor3fv(glm::value_ptr(color));
         glTranslatef(0.f, -2.f, 0.f);
         glRotatef(90.f, 1.f, 0.f, 0.f);
-        glVertexPointer(3, GL_FLOAT, 0, psmovebulbVerts);
-        glTexCoordPointer(2, GL_FLOAT, 0, psmovebulbTexCoords);
-        glDrawArrays(GL_TRIANGLES, 0, psmovebulbNumVerts);
+        drawMeshAsset(AssetManager::getInstance()->getPSMoveBulbMeshAsset());
 
         glDisableClientState(GL_VERTEX_ARRAY);
         glDisableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -1292,6 +1492,38 @@ void drawVirtualHMDModel(const glm::mat4 &transform, const glm::vec3 &color)
     glBindTexture(GL_TEXTURE_2D, 0); 
 }
 
+// Expects the vertex (and texcoord) client states to be enabled by the caller
+static void drawMeshAsset(const MeshAsset *mesh)
+{
+    if (mesh->vertex_count > 0)
+    {
+        if (mesh->vertex_buffer_id != 0)
+        {
+            g_glBufferAPI.bindBuffer(GL_ARRAY_BUFFER, mesh->vertex_buffer_id);
+        }
+
+        glVertexPointer(3, GL_FLOAT, mesh->getStrideBytes(), getMeshAttributePointer(mesh, 0));
+        if (mesh->has_texcoords)
+        {
+            glTexCoordPointer(2, GL_FLOAT, mesh->getStrideBytes(), getMeshAttributePointer(mesh, mesh->getTexCoordOffset()));
+        }
+        glDrawArrays(GL_TRIANGLES, 0, mesh->vertex_count);
+
+        if (mesh->vertex_buffer_id != 0)
+        {
+            g_glBufferAPI.bindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+    }
+}
+
+// Attribute pointers are byte offsets into the bound vertex buffer, or plain pointers into the CPU copy
+static const GLvoid *getMeshAttributePointer(const MeshAsset *mesh, unsigned int float_offset)
+{
+    return (mesh->vertex_buffer_id != 0)
+        ? reinterpret_cast<const GLvoid *>(static_cast<uintptr_t>(float_offset*sizeof(float)))
+        : mesh->vertex_data + float_offset;
+}
+
 // -- IMGUI Callbacks -----
 static const char* ImGui_ImplSdl_GetClipboardText()
 {
@@ -5,6 +5,8 @@
 #include <glm/glm.hpp>
 #include "PSMoveClient_CAPI.h"
 
+#include <stddef.h>
+
 //-- typedefs -----
 typedef union SDL_Event SDL_Event;
 
@@ -55,6 +57,23 @@ public:
     static const glm::mat4 &getCurrentCameraViewMatrix()
     { return m_instance->m_cameraViewMatrix; }
 
+    // Uploads vertex data that never changes into a vertex buffer object.
+    // Returns 0 if the GL driver doesn't support vertex buffers.
+    static unsigned int createStaticVertexBuffer(const void *data, size_t size_bytes);
+
+    // Pixel unpack buffers for streaming texture uploads.
+    // Creating one returns 0 if the GL driver doesn't support pixel buffers.
+    static bool getHasPixelBuffers();
+    static unsigned int createStreamingPixelBuffer(size_t size_bytes);
+    // Binds the pixel buffer and maps it for writing, returns nullptr on failure.
+    // Texture uploads read from the bound pixel buffer until it's unbound.
+    static unsigned char *mapPixelBuffer(unsigned int buffer_id, size_t size_bytes);
+    // Returns false if the pixel buffer contents were lost while it was mapped
+    static bool unmapPixelBuffer();
+    static void unbindPixelBuffer();
+
+    static void destroyBuffer(unsigned int buffer_id);
+
 private:
     bool m_sdlapi_initialized;
     
@@ -1,17757 +0,0 @@
-/*
-created with obj2opengl.pl
-
-source file    : .\HMD.obj
-vertices       : 1202
-faces          : 2216
-normals        : 0
-texture coords : 1061
-
-
-// include generated arrays
-#import ".\HMD.h"
-
-// set input data to arrays
-glVertexPointer(3, GL_FLOAT, 0, DK2Verts);
-glTexCoordPointer(2, GL_FLOAT, 0, DK2TexCoords);
-
-// draw data
-glDrawArrays(GL_TRIANGLES, 0, DK2NumVerts);
-*/
-
-unsigned int DK2NumVerts = 6648;
-
-float DK2Verts [] = {
-  // f 12/1 11/2 75/3 76/4
-  -8.139784, 3.437104, 0.391138,
-  -8.29444, 2.635962, 0.397587,
-  -8.191614, 2.620988, 0.400915,
-  // f 12/1 11/2 75/3 76/4
-  -8.139784, 3.437104, 0.391138,
-  -8.045527, 3.375333, 0.376162,
-  -8.191614, 2.620988, 0.400915,
-  // f 11/2 14/5 77/6 75/3
-  -8.29444, 2.635962, 0.397587,
-  -8.29444, -2.687714, 0.38698,
-  -8.191614, -2.673779, 0.389892,
-  // f 11/2 14/5 77/6 75/3
-  -8.29444, 2.635962, 0.397587,
-  -8.191614, 2.620988, 0.400915,
-  -8.191614, -2.673779, 0.389892,
-  // f 14/5 16/7 78/8 77/6
-  -8.29444, -2.687714, 0.38698,
-  -8.166743, -3.404414, 0.377827,
-  -8.071859, -3.344308, 0.360978,
-  // f 14/5 16/7 78/8 77/6
-  -8.29444, -2.687714, 0.38698,
-  -8.191614, -2.673779, 0.389892,
-  -8.071859, -3.344308, 0.360978,
-  // f 16/9 18/10 79/11 78/12
-  -8.166743, -3.404414, 0.377827,
-  -7.911351, -3.776491, 0.31272,
-  -7.878956, -3.653575, 0.281102,
-  // f 16/9 18/10 79/11 78/12
-  -8.166743, -3.404414, 0.377827,
-  -8.071859, -3.344308, 0.360978,
-  -7.878956, -3.653575, 0.281102,
-  // f 18/10 21/13 80/14 79/11
-  -7.911351, -3.776491, 0.31272,
-  -5.280301, -3.776075, -1.236958,
-  -5.288243, -3.651287, -1.258799,
-  // f 18/10 21/13 80/14 79/11
-  -7.911351, -3.776491, 0.31272,
-  -7.878956, -3.653575, 0.281102,
-  -5.288243, -3.651287, -1.258799,
-  // f 21/13 20/15 81/16 80/14
-  -5.280301, -3.776075, -1.236958,
-  -2.613512, -3.77462, -2.123291,
-  -2.615603, -3.647752, -2.587361,
-  // f 21/13 20/15 81/16 80/14
-  -5.280301, -3.776075, -1.236958,
-  -5.288243, -3.651287, -1.258799,
-  -2.615603, -3.647752, -2.587361,
-  // f 82/17 81/16 20/15 41/18
-  -1.281164, -3.779196, -3.104475,
-  -2.615603, -3.647752, -2.587361,
-  -2.613512, -3.77462, -2.123291,
-  // f 82/17 81/16 20/15 41/18
-  -1.281164, -3.779196, -3.104475,
-  -1.280119, -3.870083, -3.458716,
-  -2.613512, -3.77462, -2.123291,
-  // f 35/19 34/20 83/21 84/22
-  -2.610168, 3.785054, -2.107484,
-  -5.273613, 3.783598, -1.221149,
-  -5.281346, 3.659019, -1.243407,
-  // f 35/19 34/20 83/21 84/22
-  -2.610168, 3.785054, -2.107484,
-  -2.612258, 3.658186, -2.117468,
-  -5.281346, 3.659019, -1.243407,
-  // f 34/20 24/23 85/24 83/21
-  -5.273613, 3.783598, -1.221149,
-  -7.903409, 3.779647, 0.328736,
-  -7.871223, 3.655899, 0.297326,
-  // f 34/20 24/23 85/24 83/21
-  -5.273613, 3.783598, -1.221149,
-  -5.281346, 3.659019, -1.243407,
-  -7.871223, 3.655899, 0.297326,
-  // f 24/23 12/25 76/26 85/24
-  -7.903409, 3.779647, 0.328736,
-  -8.139784, 3.437104, 0.391138,
-  -8.045527, 3.375333, 0.376162,
-  // f 24/23 12/25 76/26 85/24
-  -7.903409, 3.779647, 0.328736,
-  -7.871223, 3.655899, 0.297326,
-  -8.045527, 3.375333, 0.376162,
-  // f 239/27 238/28 245/29 246/30
-  -1.754956, 4.669387, -2.007432,
-  -1.754957, 4.670011, -2.350648,
-  -1.754957, 3.2572, -2.35356,
-  // f 239/27 238/28 245/29 246/30
-  -1.754956, 4.669387, -2.007432,
-  -1.754956, 3.256576, -2.010344,
-  -1.754957, 3.2572, -2.35356,
-  // f 238/31 244/32 247/33 245/34
-  -1.754957, 4.670011, -2.350648,
-  -1.415965, 4.670011, -2.350649,
-  -1.415965, 3.2572, -2.353561,
-  // f 238/31 244/32 247/33 245/34
-  -1.754957, 4.670011, -2.350648,
-  -1.754957, 3.2572, -2.35356,
-  -1.415965, 3.2572, -2.353561,
-  // f 244/35 237/36 248/37 247/38
-  -1.415965, 4.670011, -2.350649,
-  -1.415965, 4.669387, -2.007433,
-  -1.415965, 3.256576, -2.010345,
-  // f 244/35 237/36 248/37 247/38
-  -1.415965, 4.670011, -2.350649,
-  -1.415965, 3.2572, -2.353561,
-  -1.415965, 3.256576, -2.010345,
-  // f 237/36 239/27 246/30 248/37
-  -1.415965, 4.669387, -2.007433,
-  -1.754956, 4.669387, -2.007432,
-  -1.754956, 3.256576, -2.010344,
-  // f 237/36 239/27 246/30 248/37
-  -1.415965, 4.669387, -2.007433,
-  -1.415965, 3.256576, -2.010345,
-  -1.754956, 3.256576, -2.010344,
-  // f 242/39 241/40 240/41 243/42
-  -1.662372, 4.9173, -2.350025,
-  -1.754957, 4.837851, -2.350232,
-  -1.754956, 4.837435, -2.007015,
-  // f 242/39 241/40 240/41 243/42
-  -1.662372, 4.9173, -2.350025,
-  -1.662371, 4.916884, -2.007016,
-  -1.754956, 4.837435, -2.007015,
-  // f 10/43 9/44 249/45 250/46
-  -8.408142, 2.645529, -5.569384,
-  -8.217747, 3.443966, -5.569384,
-  -6.405541, 2.690453, -5.31707,
-  // f 10/43 9/44 249/45 250/46
-  -8.408142, 2.645529, -5.569384,
-  -6.554138, 2.066927, -5.31707,
-  -6.405541, 2.690453, -5.31707,
-  // f 13/47 10/43 250/46 251/48
-  -8.408142, -2.685843, -5.569383,
-  -8.408142, 2.645529, -5.569384,
-  -6.554138, 2.066927, -5.31707,
-  // f 13/47 10/43 250/46 251/48
-  -8.408142, -2.685843, -5.569383,
-  -6.554138, -2.096426, -5.317069,
-  -6.554138, 2.066927, -5.31707,
-  // f 15/49 13/47 251/48 252/50
-  -8.251395, -3.400255, -5.569383,
-  -8.408142, -2.685843, -5.569383,
-  -6.554138, -2.096426, -5.317069,
-  // f 15/49 13/47 251/48 252/50
-  -8.251395, -3.400255, -5.569383,
-  -6.431875, -2.654229, -5.317069,
-  -6.554138, -2.096426, -5.317069,
-  // f 9/44 23/51 253/52 249/45
-  -8.217747, 3.443966, -5.569384,
-  -7.936856, 3.786301, -5.569385,
-  -6.186305, 2.957707, -5.31707,
-  // f 9/44 23/51 253/52 249/45
-  -8.217747, 3.443966, -5.569384,
-  -6.405541, 2.690453, -5.31707,
-  -6.186305, 2.957707, -5.31707,
-  // f 17/53 15/49 252/50 254/54
-  -7.947097, -3.773165, -5.569383,
-  -8.251395, -3.400255, -5.569383,
-  -6.431875, -2.654229, -5.317069,
-  // f 17/53 15/49 252/50 254/54
-  -7.947097, -3.773165, -5.569383,
-  -6.194246, -2.94561, -5.31707,
-  -6.431875, -2.654229, -5.317069,
-  // f 22/55 17/53 254/54 255/56
-  -5.280307, -3.773165, -5.573339,
-  -7.947097, -3.773165, -5.569383,
-  -6.194246, -2.94561, -5.31707,
-  // f 22/55 17/53 254/54 255/56
-  -5.280307, -3.773165, -5.573339,
-  -4.111809, -2.94561, -5.317072,
-  -6.194246, -2.94561, -5.31707,
-  // f 19/57 22/55 255/56 256/58
-  -2.613517, -3.773165, -5.573342,
-  -5.280307, -3.773165, -5.573339,
-  -4.111809, -2.94561, -5.317072,
-  // f 19/57 22/55 255/56 256/58
-  -2.613517, -3.773165, -5.573342,
-  -2.029372, -2.94561, -5.317075,
-  -4.111809, -2.94561, -5.317072,
-  // f 33/59 36/60 257/61 258/62
-  -5.273619, 3.786301, -5.569388,
-  -2.610173, 3.786301, -5.569392,
-  -2.026655, 2.957707, -5.317076,
-  // f 33/59 36/60 257/61 258/62
-  -5.273619, 3.786301, -5.569388,
-  -4.106376, 2.957707, -5.317073,
-  -2.026655, 2.957707, -5.317076,
-  // f 23/51 33/59 258/62 253/52
-  -7.936856, 3.786301, -5.569385,
-  -5.273619, 3.786301, -5.569388,
-  -4.106376, 2.957707, -5.317073,
-  // f 23/51 33/59 258/62 253/52
-  -7.936856, 3.786301, -5.569385,
-  -6.186305, 2.957707, -5.31707,
-  -4.106376, 2.957707, -5.317073,
-  // f 50/63 259/64 257/61 36/60
-  -1.27845, 3.786301, -5.569394,
-  -0.986691, 2.957707, -5.317077,
-  -2.026655, 2.957707, -5.317076,
-  // f 50/63 259/64 257/61 36/60
-  -1.27845, 3.786301, -5.569394,
-  -2.610173, 3.786301, -5.569392,
-  -2.026655, 2.957707, -5.317076,
-  // f 153/65 152/66 264/67 265/68
-  -2.414126, -4.570768, 0.934038,
-  -2.55541, -4.54186, -0.987765,
-  -2.126341, -4.266701, -1.001286,
-  // f 153/65 152/66 264/67 265/68
-  -2.414126, -4.570768, 0.934038,
-  -2.010764, -4.283755, 0.571892,
-  -2.126341, -4.266701, -1.001286,
-  // f 41/18 269/69 276/70 82/17
-  -1.280119, -3.870083, -3.458716,
-  -0.004198, -3.921246, -3.612437,
-  -0.004198, -3.886306, -3.599332,
-  // f 41/18 269/69 276/70 82/17
-  -1.280119, -3.870083, -3.458716,
-  -1.281164, -3.779196, -3.104475,
-  -0.004198, -3.886306, -3.599332,
-  // f 35/19 84/22 277/71 49/72
-  -2.610168, 3.785054, -2.107484,
-  -2.612258, 3.658186, -2.117468,
-  -1.27949, 3.658186, -2.202962,
-  // f 35/19 84/22 277/71 49/72
-  -2.610168, 3.785054, -2.107484,
-  -1.278445, 3.785054, -2.196722,
-  -1.27949, 3.658186, -2.202962,
-  // f 40/73 19/57 256/58 279/74
-  -1.280122, -3.869043, -5.573136,
-  -2.613517, -3.773165, -5.573342,
-  -2.029372, -2.94561, -5.317075,
-  // f 40/73 19/57 256/58 279/74
-  -1.280122, -3.869043, -5.573136,
-  -0.988154, -3.276299, -5.318949,
-  -2.029372, -2.94561, -5.317075,
-  // f 275/75 280/76 259/64 50/63
-  -0.004201, 3.786301, -5.569395,
-  -0.0042, 2.957707, -5.317079,
-  -0.986691, 2.957707, -5.317077,
-  // f 275/75 280/76 259/64 50/63
-  -0.004201, 3.786301, -5.569395,
-  -1.27845, 3.786301, -5.569394,
-  -0.986691, 2.957707, -5.317077,
-  // f 49/72 277/71 393/77 274/78
-  -1.278445, 3.785054, -2.196722,
-  -1.27949, 3.658186, -2.202962,
-  -0.004196, 3.658394, -2.284711,
-  // f 49/72 277/71 393/77 274/78
-  -1.278445, 3.785054, -2.196722,
-  -0.004196, 3.785262, -2.281799,
-  -0.004196, 3.658394, -2.284711,
-  // f 268/79 40/73 279/74 403/80
-  -0.004201, -3.92083, -5.573346,
-  -1.280122, -3.869043, -5.573136,
-  -0.988154, -3.276299, -5.318949,
-  // f 268/79 40/73 279/74 403/80
-  -0.004201, -3.92083, -5.573346,
-  -0.0042, -3.589102, -5.320822,
-  -0.988154, -3.276299, -5.318949,
-  // f 414/1 479/4 480/3 415/2
-  8.131398, 3.437104, 0.391117,
-  8.03714, 3.375333, 0.37614,
-  8.183228, 2.620988, 0.400893,
-  // f 414/1 479/4 480/3 415/2
-  8.131398, 3.437104, 0.391117,
-  8.286055, 2.635962, 0.397565,
-  8.183228, 2.620988, 0.400893,
-  // f 415/2 480/3 481/6 417/5
-  8.286055, 2.635962, 0.397565,
-  8.183228, 2.620988, 0.400893,
-  8.183437, -2.673779, 0.38987,
-  // f 415/2 480/3 481/6 417/5
-  8.286055, 2.635962, 0.397565,
-  8.286263, -2.687714, 0.386957,
-  8.183437, -2.673779, 0.38987,
-  // f 417/5 481/6 482/8 419/7
-  8.286263, -2.687714, 0.386957,
-  8.183437, -2.673779, 0.38987,
-  8.063474, -3.344308, 0.360956,
-  // f 417/5 481/6 482/8 419/7
-  8.286263, -2.687714, 0.386957,
-  8.158567, -3.404414, 0.377805,
-  8.063474, -3.344308, 0.360956,
-  // f 419/9 482/12 483/11 421/10
-  8.158567, -3.404414, 0.377805,
-  8.063474, -3.344308, 0.360956,
-  7.87078, -3.653575, 0.281081,
-  // f 419/9 482/12 483/11 421/10
-  8.158567, -3.404414, 0.377805,
-  7.903174, -3.776491, 0.312699,
-  7.87078, -3.653575, 0.281081,
-  // f 421/10 483/11 484/14 425/13
-  7.903174, -3.776491, 0.312699,
-  7.87078, -3.653575, 0.281081,
-  5.280062, -3.651287, -1.258813,
-  // f 421/10 483/11 484/14 425/13
-  7.903174, -3.776491, 0.312699,
-  5.271911, -3.776075, -1.236972,
-  5.280062, -3.651287, -1.258813,
-  // f 425/13 484/14 485/16 426/15
-  5.271911, -3.776075, -1.236972,
-  5.280062, -3.651287, -1.258813,
-  2.607209, -3.647752, -2.587368,
-  // f 425/13 484/14 485/16 426/15
-  5.271911, -3.776075, -1.236972,
-  2.605329, -3.77462, -2.123298,
-  2.607209, -3.647752, -2.587368,
-  // f 486/17 444/18 426/15 485/16
-  1.272977, -3.779196, -3.104479,
-  1.271932, -3.870083, -3.45872,
-  2.605329, -3.77462, -2.123298,
-  // f 486/17 444/18 426/15 485/16
-  1.272977, -3.779196, -3.104479,
-  2.607209, -3.647752, -2.587368,
-  2.605329, -3.77462, -2.123298,
-  // f 439/19 487/22 488/21 440/20
-  2.601985, 3.785054, -2.107491,
-  2.603866, 3.658186, -2.117475,
-  5.273165, 3.659019, -1.243421,
-  // f 439/19 487/22 488/21 440/20
-  2.601985, 3.785054, -2.107491,
-  5.265223, 3.783598, -1.221164,
-  5.273165, 3.659019, -1.243421,
-  // f 440/20 488/21 489/24 428/23
-  5.265223, 3.783598, -1.221164,
-  5.273165, 3.659019, -1.243421,
-  7.862838, 3.655899, 0.297305,
-  // f 440/20 488/21 489/24 428/23
-  5.265223, 3.783598, -1.221164,
-  7.895023, 3.779647, 0.328714,
-  7.862838, 3.655899, 0.297305,
-  // f 428/23 489/24 479/26 414/25
-  7.895023, 3.779647, 0.328714,
-  7.862838, 3.655899, 0.297305,
-  8.03714, 3.375333, 0.37614,
-  // f 428/23 489/24 479/26 414/25
-  7.895023, 3.779647, 0.328714,
-  8.131398, 3.437104, 0.391117,
-  8.03714, 3.375333, 0.37614,
-  // f 635/27 639/30 640/29 632/28
-  1.746564, 4.669387, -2.007437,
-  1.746564, 3.256576, -2.010349,
-  1.746564, 3.2572, -2.353565,
-  // f 635/27 639/30 640/29 632/28
-  1.746564, 4.669387, -2.007437,
-  1.746564, 4.670011, -2.350653,
-  1.746564, 3.2572, -2.353565,
-  // f 632/31 640/34 641/33 638/32
-  1.746564, 4.670011, -2.350653,
-  1.746564, 3.2572, -2.353565,
-  1.407781, 3.2572, -2.353565,
-  // f 632/31 640/34 641/33 638/32
-  1.746564, 4.670011, -2.350653,
-  1.407781, 4.670011, -2.350653,
-  1.407781, 3.2572, -2.353565,
-  // f 638/35 641/38 642/37 631/36
-  1.407781, 4.670011, -2.350653,
-  1.407781, 3.2572, -2.353565,
-  1.407781, 3.256576, -2.010348,
-  // f 638/35 641/38 642/37 631/36
-  1.407781, 4.670011, -2.350653,
-  1.407781, 4.669387, -2.007436,
-  1.407781, 3.256576, -2.010348,
-  // f 631/36 642/37 639/30 635/27
-  1.407781, 4.669387, -2.007436,
-  1.407781, 3.256576, -2.010348,
-  1.746564, 3.256576, -2.010349,
-  // f 631/36 642/37 639/30 635/27
-  1.407781, 4.669387, -2.007436,
-  1.746564, 4.669387, -2.007437,
-  1.746564, 3.256576, -2.010349,
-  // f 636/39 637/42 634/41 633/40
-  1.653978, 4.9173, -2.350029,
-  1.653979, 4.916884, -2.00702,
-  1.746564, 4.837435, -2.00702,
-  // f 636/39 637/42 634/41 633/40
-  1.653978, 4.9173, -2.350029,
-  1.746564, 4.837851, -2.350236,
-  1.746564, 4.837435, -2.00702,
-  // f 416/43 643/46 644/45 413/44
-  8.399741, 2.645529, -5.569406,
-  6.545946, 2.066927, -5.317087,
-  6.39735, 2.690453, -5.317087,
-  // f 416/43 643/46 644/45 413/44
-  8.399741, 2.645529, -5.569406,
-  8.209555, 3.443966, -5.569406,
-  6.39735, 2.690453, -5.317087,
-  // f 418/47 645/48 643/46 416/43
-  8.399741, -2.685843, -5.569406,
-  6.545946, -2.096426, -5.317087,
-  6.545946, 2.066927, -5.317087,
-  // f 418/47 645/48 643/46 416/43
-  8.399741, -2.685843, -5.569406,
-  8.399741, 2.645529, -5.569406,
-  6.545946, 2.066927, -5.317087,
-  // f 420/49 646/50 645/48 418/47
-  8.242993, -3.400255, -5.569405,
-  6.423474, -2.654229, -5.317086,
-  6.545946, -2.096426, -5.317087,
-  // f 420/49 646/50 645/48 418/47
-  8.242993, -3.400255, -5.569405,
-  8.399741, -2.685843, -5.569406,
-  6.545946, -2.096426, -5.317087,
-  // f 413/44 644/45 647/52 427/51
-  8.209555, 3.443966, -5.569406,
-  6.39735, 2.690453, -5.317087,
-  6.177904, 2.957707, -5.317087,
-  // f 413/44 644/45 647/52 427/51
-  8.209555, 3.443966, -5.569406,
-  7.928663, 3.786301, -5.569406,
-  6.177904, 2.957707, -5.317087,
-  // f 422/53 648/54 646/50 420/49
-  7.938695, -3.773165, -5.569405,
-  6.185845, -2.94561, -5.317086,
-  6.423474, -2.654229, -5.317086,
-  // f 422/53 648/54 646/50 420/49
-  7.938695, -3.773165, -5.569405,
-  8.242993, -3.400255, -5.569405,
-  6.423474, -2.654229, -5.317086,
-  // f 424/55 649/56 648/54 422/53
-  5.271905, -3.773165, -5.573353,
-  4.103408, -2.94561, -5.317083,
-  6.185845, -2.94561, -5.317086,
-  // f 424/55 649/56 648/54 422/53
-  5.271905, -3.773165, -5.573353,
-  7.938695, -3.773165, -5.569405,
-  6.185845, -2.94561, -5.317086,
-  // f 423/57 650/58 649/56 424/55
-  2.605324, -3.773165, -5.573349,
-  2.020972, -2.94561, -5.31708,
-  4.103408, -2.94561, -5.317083,
-  // f 423/57 650/58 649/56 424/55
-  2.605324, -3.773165, -5.573349,
-  5.271905, -3.773165, -5.573353,
-  4.103408, -2.94561, -5.317083,
-  // f 437/59 651/62 652/61 438/60
-  5.265217, 3.786301, -5.569402,
-  4.098184, 2.957707, -5.317084,
-  2.018464, 2.957707, -5.317081,
-  // f 437/59 651/62 652/61 438/60
-  5.265217, 3.786301, -5.569402,
-  2.60198, 3.786301, -5.569399,
-  2.018464, 2.957707, -5.317081,
-  // f 427/51 647/52 651/62 437/59
-  7.928663, 3.786301, -5.569406,
-  6.177904, 2.957707, -5.317087,
-  4.098184, 2.957707, -5.317084,
-  // f 427/51 647/52 651/62 437/59
-  7.928663, 3.786301, -5.569406,
-  5.265217, 3.786301, -5.569402,
-  4.098184, 2.957707, -5.317084,
-  // f 454/63 438/60 652/61 653/64
-  1.270257, 3.786301, -5.569397,
-  2.60198, 3.786301, -5.569399,
-  2.018464, 2.957707, -5.317081,
-  // f 454/63 438/60 652/61 653/64
-  1.270257, 3.786301, -5.569397,
-  0.978499, 2.957707, -5.31708,
-  2.018464, 2.957707, -5.317081,
-  // f 554/65 659/68 658/67 555/66
-  2.405951, -4.570768, 0.934032,
-  2.002588, -4.283755, 0.571887,
-  2.11816, -4.266701, -1.001292,
-  // f 554/65 659/68 658/67 555/66
-  2.405951, -4.570768, 0.934032,
-  2.547229, -4.54186, -0.987772,
-  2.11816, -4.266701, -1.001292,
-  // f 444/18 486/17 276/70 269/69
-  1.271932, -3.870083, -3.45872,
-  1.272977, -3.779196, -3.104479,
-  -0.004198, -3.886306, -3.599332,
-  // f 444/18 486/17 276/70 269/69
-  1.271932, -3.870083, -3.45872,
-  -0.004198, -3.921246, -3.612437,
-  -0.004198, -3.886306, -3.599332,
-  // f 439/19 453/72 660/71 487/22
-  2.601985, 3.785054, -2.107491,
-  1.270262, 3.785054, -2.196725,
-  1.271307, 3.658186, -2.202965,
-  // f 439/19 453/72 660/71 487/22
-  2.601985, 3.785054, -2.107491,
-  2.603866, 3.658186, -2.117475,
-  1.271307, 3.658186, -2.202965,
-  // f 445/73 662/74 650/58 423/57
-  1.271929, -3.869043, -5.57314,
-  0.979753, -3.276299, -5.318952,
-  2.020972, -2.94561, -5.31708,
-  // f 445/73 662/74 650/58 423/57
-  1.271929, -3.869043, -5.57314,
-  2.605324, -3.773165, -5.573349,
-  2.020972, -2.94561, -5.31708,
-  // f 275/75 454/63 653/64 280/76
-  -0.004201, 3.786301, -5.569395,
-  1.270257, 3.786301, -5.569397,
-  0.978499, 2.957707, -5.31708,
-  // f 275/75 454/63 653/64 280/76
-  -0.004201, 3.786301, -5.569395,
-  -0.0042, 2.957707, -5.317079,
-  0.978499, 2.957707, -5.31708,
-  // f 453/72 274/78 393/77 660/71
-  1.270262, 3.785054, -2.196725,
-  -0.004196, 3.785262, -2.281799,
-  -0.004196, 3.658394, -2.284711,
-  // f 453/72 274/78 393/77 660/71
-  1.270262, 3.785054, -2.196725,
-  1.271307, 3.658186, -2.202965,
-  -0.004196, 3.658394, -2.284711,
-  // f 268/79 403/80 662/74 445/73
-  -0.004201, -3.92083, -5.573346,
-  -0.0042, -3.589102, -5.320822,
-  0.979753, -3.276299, -5.318952,
-  // f 268/79 403/80 662/74 445/73
-  -0.004201, -3.92083, -5.573346,
-  1.271929, -3.869043, -5.57314,
-  0.979753, -3.276299, -5.318952,
-  // f 1/81 2/82 3/83 4/84
-  -7.862023, 2.123707, 3.899849,
-  -7.862859, -2.207694, 3.839942,
-  -7.677898, -2.709135, 3.509623,
-  // f 1/81 2/82 3/83 4/84
-  -7.862023, 2.123707, 3.899849,
-  -7.659297, 2.62286, 3.659389,
-  -7.677898, -2.709135, 3.509623,
-  // f 5/85 6/86 7/87 8/88
-  -5.123551, -3.654823, 0.715007,
-  -2.51591, -3.650455, -1.260674,
-  -2.615392, -3.404206, -1.258386,
-  // f 5/85 6/86 7/87 8/88
-  -5.123551, -3.654823, 0.715007,
-  -5.318754, -3.406494, 0.739137,
-  -2.615392, -3.404206, -1.258386,
-  // f 9/89 10/90 11/91 12/92
-  -8.217747, 3.443966, -5.569384,
-  -8.408142, 2.645529, -5.569384,
-  -8.29444, 2.635962, 0.397587,
-  // f 9/89 10/90 11/91 12/92
-  -8.217747, 3.443966, -5.569384,
-  -8.139784, 3.437104, 0.391138,
-  -8.29444, 2.635962, 0.397587,
-  // f 10/90 13/93 14/94 11/91
-  -8.408142, 2.645529, -5.569384,
-  -8.408142, -2.685843, -5.569383,
-  -8.29444, -2.687714, 0.38698,
-  // f 10/90 13/93 14/94 11/91
-  -8.408142, 2.645529, -5.569384,
-  -8.29444, 2.635962, 0.397587,
-  -8.29444, -2.687714, 0.38698,
-  // f 13/93 15/95 16/96 14/94
-  -8.408142, -2.685843, -5.569383,
-  -8.251395, -3.400255, -5.569383,
-  -8.166743, -3.404414, 0.377827,
-  // f 13/93 15/95 16/96 14/94
-  -8.408142, -2.685843, -5.569383,
-  -8.29444, -2.687714, 0.38698,
-  -8.166743, -3.404414, 0.377827,
-  // f 15/95 17/97 18/98 16/96
-  -8.251395, -3.400255, -5.569383,
-  -7.947097, -3.773165, -5.569383,
-  -7.911351, -3.776491, 0.31272,
-  // f 15/95 17/97 18/98 16/96
-  -8.251395, -3.400255, -5.569383,
-  -8.166743, -3.404414, 0.377827,
-  -7.911351, -3.776491, 0.31272,
-  // f 19/99 20/100 21/101 22/102
-  -2.613517, -3.773165, -5.573342,
-  -2.613512, -3.77462, -2.123291,
-  -5.280301, -3.776075, -1.236958,
-  // f 19/99 20/100 21/101 22/102
-  -2.613517, -3.773165, -5.573342,
-  -5.280307, -3.773165, -5.573339,
-  -5.280301, -3.776075, -1.236958,
-  // f 23/103 9/89 12/92 24/104
-  -7.936856, 3.786301, -5.569385,
-  -8.217747, 3.443966, -5.569384,
-  -8.139784, 3.437104, 0.391138,
-  // f 23/103 9/89 12/92 24/104
-  -7.936856, 3.786301, -5.569385,
-  -7.903409, 3.779647, 0.328736,
-  -8.139784, 3.437104, 0.391138,
-  // f 25/105 26/106 27/107 28/108
-  -6.25924, 2.521989, -2.028435,
-  -6.269272, -2.47703, -2.035714,
-  -3.222318, -3.317479, -2.432808,
-  // f 25/105 26/106 27/107 28/108
-  -6.25924, 2.521989, -2.028435,
-  -3.211659, 2.522613, -2.423657,
-  -3.222318, -3.317479, -2.432808,
-  // f 29/109 30/110 31/111 32/112
-  -5.116654, 3.389892, 0.729775,
-  -5.296391, 3.437728, 0.75328,
-  -2.604106, 3.440015, -0.7887,
-  // f 29/109 30/110 31/111 32/112
-  -5.116654, 3.389892, 0.729775,
-  -2.512566, 3.516344, -0.790989,
-  -2.604106, 3.440015, -0.7887,
-  // f 33/113 34/114 35/115 36/116
-  -5.273619, 3.786301, -5.569388,
-  -5.273613, 3.783598, -1.221149,
-  -2.610168, 3.785054, -2.107484,
-  // f 33/113 34/114 35/115 36/116
-  -5.273619, 3.786301, -5.569388,
-  -2.610173, 3.786301, -5.569392,
-  -2.610168, 3.785054, -2.107484,
-  // f 6/86 37/117 38/118 7/87
-  -2.51591, -3.650455, -1.260674,
-  -2.298555, -3.780859, -2.163021,
-  -2.348296, -3.6047, -2.161981,
-  // f 6/86 37/117 38/118 7/87
-  -2.51591, -3.650455, -1.260674,
-  -2.615392, -3.404206, -1.258386,
-  -2.348296, -3.6047, -2.161981,
-  // f 8/88 3/83 39/119 5/85
-  -5.318754, -3.406494, 0.739137,
-  -7.677898, -2.709135, 3.509623,
-  -7.42564, -3.095771, 3.177223,
-  // f 8/88 3/83 39/119 5/85
-  -5.318754, -3.406494, 0.739137,
-  -5.123551, -3.654823, 0.715007,
-  -7.42564, -3.095771, 3.177223,
-  // f 19/99 40/120 41/121 20/100
-  -2.613517, -3.773165, -5.573342,
-  -1.280122, -3.869043, -5.573136,
-  -1.280119, -3.870083, -3.458716,
-  // f 19/99 40/120 41/121 20/100
-  -2.613517, -3.773165, -5.573342,
-  -2.613512, -3.77462, -2.123291,
-  -1.280119, -3.870083, -3.458716,
-  // f 18/98 17/97 22/102 21/101
-  -7.911351, -3.776491, 0.31272,
-  -7.947097, -3.773165, -5.569383,
-  -5.280307, -3.773165, -5.573339,
-  // f 18/98 17/97 22/102 21/101
-  -7.911351, -3.776491, 0.31272,
-  -5.280301, -3.776075, -1.236958,
-  -5.280307, -3.773165, -5.573339,
-  // f 42/122 43/123 26/106 25/105
-  -6.985497, 2.660712, 1.72344,
-  -6.994901, -2.629894, 1.709504,
-  -6.269272, -2.47703, -2.035714,
-  // f 42/122 43/123 26/106 25/105
-  -6.985497, 2.660712, 1.72344,
-  -6.25924, 2.521989, -2.028435,
-  -6.269272, -2.47703, -2.035714,
-  // f 27/107 44/124 45/125 28/108
-  -3.222318, -3.317479, -2.432808,
-  -1.584626, -3.333493, -3.248834,
-  -1.579191, 2.522821, -2.580291,
-  // f 27/107 44/124 45/125 28/108
-  -3.222318, -3.317479, -2.432808,
-  -3.211659, 2.522613, -2.423657,
-  -1.579191, 2.522821, -2.580291,
-  // f 46/126 4/84 30/110 29/109
-  -7.428566, 2.951885, 3.370047,
-  -7.659297, 2.62286, 3.659389,
-  -5.296391, 3.437728, 0.75328,
-  // f 46/126 4/84 30/110 29/109
-  -7.428566, 2.951885, 3.370047,
-  -5.116654, 3.389892, 0.729775,
-  -5.296391, 3.437728, 0.75328,
-  // f 47/127 48/128 32/112 31/111
-  -1.275518, 3.440639, -1.126094,
-  -1.229748, 3.582065, -1.126926,
-  -2.512566, 3.516344, -0.790989,
-  // f 47/127 48/128 32/112 31/111
-  -1.275518, 3.440639, -1.126094,
-  -2.604106, 3.440015, -0.7887,
-  -2.512566, 3.516344, -0.790989,
-  // f 23/103 24/104 34/114 33/113
-  -7.936856, 3.786301, -5.569385,
-  -7.903409, 3.779647, 0.328736,
-  -5.273613, 3.783598, -1.221149,
-  // f 23/103 24/104 34/114 33/113
-  -7.936856, 3.786301, -5.569385,
-  -5.273619, 3.786301, -5.569388,
-  -5.273613, 3.783598, -1.221149,
-  // f 49/129 50/130 36/116 35/115
-  -1.278445, 3.785054, -2.196722,
-  -1.27845, 3.786301, -5.569394,
-  -2.610173, 3.786301, -5.569392,
-  // f 49/129 50/130 36/116 35/115
-  -1.278445, 3.785054, -2.196722,
-  -2.610168, 3.785054, -2.107484,
-  -2.610173, 3.786301, -5.569392,
-  // f 51/131 52/132 53/133 54/134
-  -8.16591, 0.03995, -1.036017,
-  -8.16591, 0.464022, -1.144182,
-  -8.453697, 0.437193, -1.189111,
-  // f 51/131 52/132 53/133 54/134
-  -8.16591, 0.03995, -1.036017,
-  -8.453697, 0.03995, -1.087602,
-  -8.453697, 0.437193, -1.189111,
-  // f 52/132 55/135 56/136 53/133
-  -8.16591, 0.464022, -1.144182,
-  -8.165911, 0.774953, -1.441635,
-  -8.453698, 0.728365, -1.467429,
-  // f 52/132 55/135 56/136 53/133
-  -8.16591, 0.464022, -1.144182,
-  -8.453697, 0.437193, -1.189111,
-  -8.453698, 0.728365, -1.467429,
-  // f 55/135 57/137 58/138 56/136
-  -8.165911, 0.774953, -1.441635,
-  -8.165911, 0.889134, -1.848295,
-  -8.453698, 0.835475, -1.848502,
-  // f 55/135 57/137 58/138 56/136
-  -8.165911, 0.774953, -1.441635,
-  -8.453698, 0.728365, -1.467429,
-  -8.453698, 0.835475, -1.848502,
-  // f 57/137 59/139 60/140 58/138
-  -8.165911, 0.889134, -1.848295,
-  -8.165912, 0.776201, -2.255579,
-  -8.453699, 0.729613, -2.229993,
-  // f 57/137 59/139 60/140 58/138
-  -8.165911, 0.889134, -1.848295,
-  -8.453698, 0.835475, -1.848502,
-  -8.453699, 0.729613, -2.229993,
-  // f 59/139 61/141 62/142 60/140
-  -8.165912, 0.776201, -2.255579,
-  -8.165912, 0.46631, -2.554281,
-  -8.453699, 0.439272, -2.509558,
-  // f 59/139 61/141 62/142 60/140
-  -8.165912, 0.776201, -2.255579,
-  -8.453699, 0.729613, -2.229993,
-  -8.453699, 0.439272, -2.509558,
-  // f 61/141 63/143 64/144 62/142
-  -8.165912, 0.46631, -2.554281,
-  -8.165912, 0.042446, -2.664317,
-  -8.453699, 0.042238, -2.612523,
-  // f 61/141 63/143 64/144 62/142
-  -8.165912, 0.46631, -2.554281,
-  -8.453699, 0.439272, -2.509558,
-  -8.453699, 0.042238, -2.612523,
-  // f 63/143 65/145 66/146 64/144
-  -8.165912, 0.042446, -2.664317,
-  -8.165912, -0.381835, -2.555945,
-  -8.453699, -0.355005, -2.511222,
-  // f 63/143 65/145 66/146 64/144
-  -8.165912, 0.042446, -2.664317,
-  -8.453699, 0.042238, -2.612523,
-  -8.453699, -0.355005, -2.511222,
-  // f 65/145 67/147 68/148 66/146
-  -8.165912, -0.381835, -2.555945,
-  -8.165912, -0.692557, -2.258699,
-  -8.453699, -0.646178, -2.232696,
-  // f 65/145 67/147 68/148 66/146
-  -8.165912, -0.381835, -2.555945,
-  -8.453699, -0.355005, -2.511222,
-  -8.453699, -0.646178, -2.232696,
-  // f 67/147 69/149 70/150 68/148
-  -8.165912, -0.692557, -2.258699,
-  -8.165911, -0.806946, -1.851831,
-  -8.453698, -0.75308, -1.851831,
-  // f 67/147 69/149 70/150 68/148
-  -8.165912, -0.692557, -2.258699,
-  -8.453699, -0.646178, -2.232696,
-  -8.453698, -0.75308, -1.851831,
-  // f 69/149 71/151 72/152 70/150
-  -8.165911, -0.806946, -1.851831,
-  -8.165911, -0.693805, -1.444547,
-  -8.453698, -0.647217, -1.47034,
-  // f 69/149 71/151 72/152 70/150
-  -8.165911, -0.806946, -1.851831,
-  -8.453698, -0.75308, -1.851831,
-  -8.453698, -0.647217, -1.47034,
-  // f 71/151 73/153 74/154 72/152
-  -8.165911, -0.693805, -1.444547,
-  -8.16591, -0.383914, -1.146054,
-  -8.453697, -0.357085, -1.190567,
-  // f 71/151 73/153 74/154 72/152
-  -8.165911, -0.693805, -1.444547,
-  -8.453698, -0.647217, -1.47034,
-  -8.453697, -0.357085, -1.190567,
-  // f 73/153 51/131 54/134 74/154
-  -8.16591, -0.383914, -1.146054,
-  -8.16591, 0.03995, -1.036017,
-  -8.453697, 0.03995, -1.087602,
-  // f 73/153 51/131 54/134 74/154
-  -8.16591, -0.383914, -1.146054,
-  -8.453697, -0.357085, -1.190567,
-  -8.453697, 0.03995, -1.087602,
-  // f 53/133 56/136 58/138 74/154
-  -8.453697, 0.437193, -1.189111,
-  -8.453698, 0.728365, -1.467429,
-  -8.453698, 0.835475, -1.848502,
-  // f 53/133 56/136 58/138 74/154
-  -8.453697, 0.437193, -1.189111,
-  -8.453697, -0.357085, -1.190567,
-  -8.453698, 0.835475, -1.848502,
-  // f 58/138 60/140 62/142 66/146
-  -8.453698, 0.835475, -1.848502,
-  -8.453699, 0.729613, -2.229993,
-  -8.453699, 0.439272, -2.509558,
-  // f 58/138 60/140 62/142 66/146
-  -8.453698, 0.835475, -1.848502,
-  -8.453699, -0.355005, -2.511222,
-  -8.453699, 0.439272, -2.509558,
-  // f 62/142 64/144 66/146
-  -8.453699, 0.439272, -2.509558,
-  -8.453699, 0.042238, -2.612523,
-  -8.453699, -0.355005, -2.511222,
-  // f 66/146 68/148 70/150 74/154
-  -8.453699, -0.355005, -2.511222,
-  -8.453699, -0.646178, -2.232696,
-  -8.453698, -0.75308, -1.851831,
-  // f 66/146 68/148 70/150 74/154
-  -8.453699, -0.355005, -2.511222,
-  -8.453697, -0.357085, -1.190567,
-  -8.453698, -0.75308, -1.851831,
-  // f 70/150 72/152 74/154
-  -8.453698, -0.75308, -1.851831,
-  -8.453698, -0.647217, -1.47034,
-  -8.453697, -0.357085, -1.190567,
-  // f 58/138 66/146 74/154
-  -8.453698, 0.835475, -1.848502,
-  -8.453699, -0.355005, -2.511222,
-  -8.453697, -0.357085, -1.190567,
-  // f 54/134 53/133 74/154
-  -8.453697, 0.03995, -1.087602,
-  -8.453697, 0.437193, -1.189111,
-  -8.453697, -0.357085, -1.190567,
-  // f 86/155 87/156 88/157 89/158
-  -7.759408, 1.885153, 1.532281,
-  -7.758783, 2.429646, 0.398003,
-  -7.758574, 2.071088, 0.39613,
-  // f 86/155 87/156 88/157 89/158
-  -7.759408, 1.885153, 1.532281,
-  -7.758991, 1.801129, 1.568474,
-  -7.758574, 2.071088, 0.39613,
-  // f 88/157 90/159 91/160 89/158
-  -7.758574, 2.071088, 0.39613,
-  -7.758574, -1.910907, 0.388227,
-  -7.758782, -1.814611, 1.559946,
-  // f 88/157 90/159 91/160 89/158
-  -7.758574, 2.071088, 0.39613,
-  -7.758991, 1.801129, 1.568474,
-  -7.758782, -1.814611, 1.559946,
-  // f 91/160 90/159 92/161 93/162
-  -7.758782, -1.814611, 1.559946,
-  -7.758574, -1.910907, 0.388227,
-  -7.758783, -2.289223, 0.390307,
-  // f 91/160 90/159 92/161 93/162
-  -7.758782, -1.814611, 1.559946,
-  -7.7592, -1.845184, 1.55433,
-  -7.758783, -2.289223, 0.390307,
-  // f 78/12 79/11 39/163 3/164
-  -8.071859, -3.344308, 0.360978,
-  -7.878956, -3.653575, 0.281102,
-  -7.42564, -3.095771, 3.177223,
-  // f 78/12 79/11 39/163 3/164
-  -8.071859, -3.344308, 0.360978,
-  -7.677898, -2.709135, 3.509623,
-  -7.42564, -3.095771, 3.177223,
-  // f 79/11 80/14 5/165 39/163
-  -7.878956, -3.653575, 0.281102,
-  -5.288243, -3.651287, -1.258799,
-  -5.123551, -3.654823, 0.715007,
-  // f 79/11 80/14 5/165 39/163
-  -7.878956, -3.653575, 0.281102,
-  -7.42564, -3.095771, 3.177223,
-  -5.123551, -3.654823, 0.715007,
-  // f 80/14 81/16 6/166 5/165
-  -5.288243, -3.651287, -1.258799,
-  -2.615603, -3.647752, -2.587361,
-  -2.51591, -3.650455, -1.260674,
-  // f 80/14 81/16 6/166 5/165
-  -5.288243, -3.651287, -1.258799,
-  -5.123551, -3.654823, 0.715007,
-  -2.51591, -3.650455, -1.260674,
-  // f 81/16 82/17 37/167 6/166
-  -2.615603, -3.647752, -2.587361,
-  -1.281164, -3.779196, -3.104475,
-  -2.298555, -3.780859, -2.163021,
-  // f 81/16 82/17 37/167 6/166
-  -2.615603, -3.647752, -2.587361,
-  -2.51591, -3.650455, -1.260674,
-  -2.298555, -3.780859, -2.163021,
-  // f 84/22 83/21 29/168 32/169
-  -2.612258, 3.658186, -2.117468,
-  -5.281346, 3.659019, -1.243407,
-  -5.116654, 3.389892, 0.729775,
-  // f 84/22 83/21 29/168 32/169
-  -2.612258, 3.658186, -2.117468,
-  -2.512566, 3.516344, -0.790989,
-  -5.116654, 3.389892, 0.729775,
-  // f 83/21 85/24 46/170 29/168
-  -5.281346, 3.659019, -1.243407,
-  -7.871223, 3.655899, 0.297326,
-  -7.428566, 2.951885, 3.370047,
-  // f 83/21 85/24 46/170 29/168
-  -5.281346, 3.659019, -1.243407,
-  -5.116654, 3.389892, 0.729775,
-  -7.428566, 2.951885, 3.370047,
-  // f 85/24 76/26 4/171 46/170
-  -7.871223, 3.655899, 0.297326,
-  -8.045527, 3.375333, 0.376162,
-  -7.659297, 2.62286, 3.659389,
-  // f 85/24 76/26 4/171 46/170
-  -7.871223, 3.655899, 0.297326,
-  -7.428566, 2.951885, 3.370047,
-  -7.659297, 2.62286, 3.659389,
-  // f 4/84 3/83 94/172 95/173
-  -7.659297, 2.62286, 3.659389,
-  -7.677898, -2.709135, 3.509623,
-  -7.397425, -2.443752, 3.311805,
-  // f 4/84 3/83 94/172 95/173
-  -7.659297, 2.62286, 3.659389,
-  -7.382586, 2.395122, 3.401665,
-  -7.397425, -2.443752, 3.311805,
-  // f 3/83 8/88 96/174 94/172
-  -7.677898, -2.709135, 3.509623,
-  -5.318754, -3.406494, 0.739137,
-  -5.316664, -2.981798, 0.738513,
-  // f 3/83 8/88 96/174 94/172
-  -7.677898, -2.709135, 3.509623,
-  -7.397425, -2.443752, 3.311805,
-  -5.316664, -2.981798, 0.738513,
-  // f 8/88 7/87 97/175 96/174
-  -5.318754, -3.406494, 0.739137,
-  -2.615392, -3.404206, -1.258386,
-  -2.615183, -3.334741, -1.257346,
-  // f 8/88 7/87 97/175 96/174
-  -5.318754, -3.406494, 0.739137,
-  -5.316664, -2.981798, 0.738513,
-  -2.615183, -3.334741, -1.257346,
-  // f 7/87 38/118 98/176 97/175
-  -2.615392, -3.404206, -1.258386,
-  -2.348296, -3.6047, -2.161981,
-  -2.348087, -3.473256, -2.129532,
-  // f 7/87 38/118 98/176 97/175
-  -2.615392, -3.404206, -1.258386,
-  -2.615183, -3.334741, -1.257346,
-  -2.348087, -3.473256, -2.129532,
-  // f 31/111 30/110 99/177 100/178
-  -2.604106, 3.440015, -0.7887,
-  -5.296391, 3.437728, 0.75328,
-  -5.295346, 3.012823, 0.749535,
-  // f 31/111 30/110 99/177 100/178
-  -2.604106, 3.440015, -0.7887,
-  -2.604315, 3.015319, -0.789741,
-  -5.295346, 3.012823, 0.749535,
-  // f 30/110 4/84 95/173 99/177
-  -5.296391, 3.437728, 0.75328,
-  -7.659297, 2.62286, 3.659389,
-  -7.382586, 2.395122, 3.401665,
-  // f 30/110 4/84 95/173 99/177
-  -5.296391, 3.437728, 0.75328,
-  -5.295346, 3.012823, 0.749535,
-  -7.382586, 2.395122, 3.401665,
-  // f 95/173 94/172 43/123 42/122
-  -7.382586, 2.395122, 3.401665,
-  -7.397425, -2.443752, 3.311805,
-  -6.994901, -2.629894, 1.709504,
-  // f 95/173 94/172 43/123 42/122
-  -7.382586, 2.395122, 3.401665,
-  -6.985497, 2.660712, 1.72344,
-  -6.994901, -2.629894, 1.709504,
-  // f 43/123 94/172 96/174 26/106
-  -6.994901, -2.629894, 1.709504,
-  -7.397425, -2.443752, 3.311805,
-  -5.316664, -2.981798, 0.738513,
-  // f 43/123 94/172 96/174 26/106
-  -6.994901, -2.629894, 1.709504,
-  -6.269272, -2.47703, -2.035714,
-  -5.316664, -2.981798, 0.738513,
-  // f 96/174 97/175 27/107 26/106
-  -5.316664, -2.981798, 0.738513,
-  -2.615183, -3.334741, -1.257346,
-  -3.222318, -3.317479, -2.432808,
-  // f 96/174 97/175 27/107 26/106
-  -5.316664, -2.981798, 0.738513,
-  -6.269272, -2.47703, -2.035714,
-  -3.222318, -3.317479, -2.432808,
-  // f 27/107 97/175 98/176 44/124
-  -3.222318, -3.317479, -2.432808,
-  -2.615183, -3.334741, -1.257346,
-  -2.348087, -3.473256, -2.129532,
-  // f 27/107 97/175 98/176 44/124
-  -3.222318, -3.317479, -2.432808,
-  -1.584626, -3.333493, -3.248834,
-  -2.348087, -3.473256, -2.129532,
-  // f 100/178 99/177 25/105 28/108
-  -2.604315, 3.015319, -0.789741,
-  -5.295346, 3.012823, 0.749535,
-  -6.25924, 2.521989, -2.028435,
-  // f 100/178 99/177 25/105 28/108
-  -2.604315, 3.015319, -0.789741,
-  -3.211659, 2.522613, -2.423657,
-  -6.25924, 2.521989, -2.028435,
-  // f 99/177 95/173 42/122 25/105
-  -5.295346, 3.012823, 0.749535,
-  -7.382586, 2.395122, 3.401665,
-  -6.985497, 2.660712, 1.72344,
-  // f 99/177 95/173 42/122 25/105
-  -5.295346, 3.012823, 0.749535,
-  -6.25924, 2.521989, -2.028435,
-  -6.985497, 2.660712, 1.72344,
-  // f 76/4 75/3 101/179 102/180
-  -8.045527, 3.375333, 0.376162,
-  -8.191614, 2.620988, 0.400915,
-  -8.246789, 2.614748, 0.670288,
-  // f 76/4 75/3 101/179 102/180
-  -8.045527, 3.375333, 0.376162,
-  -8.162982, 3.08312, 0.664255,
-  -8.246789, 2.614748, 0.670288,
-  // f 75/3 77/6 103/181 101/179
-  -8.191614, 2.620988, 0.400915,
-  -8.191614, -2.673779, 0.389892,
-  -8.246998, -2.669827, 0.659473,
-  // f 75/3 77/6 103/181 101/179
-  -8.191614, 2.620988, 0.400915,
-  -8.246789, 2.614748, 0.670288,
-  -8.246998, -2.669827, 0.659473,
-  // f 77/6 78/8 104/182 103/181
-  -8.191614, -2.673779, 0.389892,
-  -8.071859, -3.344308, 0.360978,
-  -8.18618, -3.051887, 0.652192,
-  // f 77/6 78/8 104/182 103/181
-  -8.191614, -2.673779, 0.389892,
-  -8.246998, -2.669827, 0.659473,
-  -8.18618, -3.051887, 0.652192,
-  // f 78/8 3/183 105/184 104/182
-  -8.071859, -3.344308, 0.360978,
-  -7.677898, -2.709135, 3.509623,
-  -8.002052, -2.330195, 2.515128,
-  // f 78/8 3/183 105/184 104/182
-  -8.071859, -3.344308, 0.360978,
-  -8.18618, -3.051887, 0.652192,
-  -8.002052, -2.330195, 2.515128,
-  // f 3/183 2/185 106/186 105/184
-  -7.677898, -2.709135, 3.509623,
-  -7.862859, -2.207694, 3.839942,
-  -7.974046, -1.995554, 2.767028,
-  // f 3/183 2/185 106/186 105/184
-  -7.677898, -2.709135, 3.509623,
-  -8.002052, -2.330195, 2.515128,
-  -7.974046, -1.995554, 2.767028,
-  // f 2/185 1/187 107/188 106/186
-  -7.862859, -2.207694, 3.839942,
-  -7.862023, 2.123707, 3.899849,
-  -7.973629, 1.943804, 2.776388,
-  // f 2/185 1/187 107/188 106/186
-  -7.862859, -2.207694, 3.839942,
-  -7.974046, -1.995554, 2.767028,
-  -7.973629, 1.943804, 2.776388,
-  // f 1/187 4/189 108/190 107/188
-  -7.862023, 2.123707, 3.899849,
-  -7.659297, 2.62286, 3.659389,
-  -7.979898, 2.342294, 2.524488,
-  // f 1/187 4/189 108/190 107/188
-  -7.862023, 2.123707, 3.899849,
-  -7.973629, 1.943804, 2.776388,
-  -7.979898, 2.342294, 2.524488,
-  // f 4/189 76/4 102/180 108/190
-  -7.659297, 2.62286, 3.659389,
-  -8.045527, 3.375333, 0.376162,
-  -8.162982, 3.08312, 0.664255,
-  // f 4/189 76/4 102/180 108/190
-  -7.659297, 2.62286, 3.659389,
-  -7.979898, 2.342294, 2.524488,
-  -8.162982, 3.08312, 0.664255,
-  // f 87/156 102/180 101/179 88/157
-  -7.758783, 2.429646, 0.398003,
-  -8.162982, 3.08312, 0.664255,
-  -8.246789, 2.614748, 0.670288,
-  // f 87/156 102/180 101/179 88/157
-  -7.758783, 2.429646, 0.398003,
-  -7.758574, 2.071088, 0.39613,
-  -8.246789, 2.614748, 0.670288,
-  // f 101/179 103/181 90/159 88/157
-  -8.246789, 2.614748, 0.670288,
-  -8.246998, -2.669827, 0.659473,
-  -7.758574, -1.910907, 0.388227,
-  // f 101/179 103/181 90/159 88/157
-  -8.246789, 2.614748, 0.670288,
-  -7.758574, 2.071088, 0.39613,
-  -7.758574, -1.910907, 0.388227,
-  // f 90/159 103/181 104/182 92/161
-  -7.758574, -1.910907, 0.388227,
-  -8.246998, -2.669827, 0.659473,
-  -8.18618, -3.051887, 0.652192,
-  // f 90/159 103/181 104/182 92/161
-  -7.758574, -1.910907, 0.388227,
-  -7.758783, -2.289223, 0.390307,
-  -8.18618, -3.051887, 0.652192,
-  // f 104/182 105/184 93/162 92/161
-  -8.18618, -3.051887, 0.652192,
-  -8.002052, -2.330195, 2.515128,
-  -7.7592, -1.845184, 1.55433,
-  // f 104/182 105/184 93/162 92/161
-  -8.18618, -3.051887, 0.652192,
-  -7.758783, -2.289223, 0.390307,
-  -7.7592, -1.845184, 1.55433,
-  // f 105/184 106/186 91/160 93/162
-  -8.002052, -2.330195, 2.515128,
-  -7.974046, -1.995554, 2.767028,
-  -7.758782, -1.814611, 1.559946,
-  // f 105/184 106/186 91/160 93/162
-  -8.002052, -2.330195, 2.515128,
-  -7.7592, -1.845184, 1.55433,
-  -7.758782, -1.814611, 1.559946,
-  // f 106/186 107/188 89/158 91/160
-  -7.974046, -1.995554, 2.767028,
-  -7.973629, 1.943804, 2.776388,
-  -7.758991, 1.801129, 1.568474,
-  // f 106/186 107/188 89/158 91/160
-  -7.974046, -1.995554, 2.767028,
-  -7.758782, -1.814611, 1.559946,
-  -7.758991, 1.801129, 1.568474,
-  // f 107/188 108/190 86/155 89/158
-  -7.973629, 1.943804, 2.776388,
-  -7.979898, 2.342294, 2.524488,
-  -7.759408, 1.885153, 1.532281,
-  // f 107/188 108/190 86/155 89/158
-  -7.973629, 1.943804, 2.776388,
-  -7.758991, 1.801129, 1.568474,
-  -7.759408, 1.885153, 1.532281,
-  // f 108/190 102/180 87/156 86/155
-  -7.979898, 2.342294, 2.524488,
-  -8.162982, 3.08312, 0.664255,
-  -7.758783, 2.429646, 0.398003,
-  // f 108/190 102/180 87/156 86/155
-  -7.979898, 2.342294, 2.524488,
-  -7.759408, 1.885153, 1.532281,
-  -7.758783, 2.429646, 0.398003,
-  // f 109/191 110/192 111/193 112/194
-  -7.509654, -0.099812, 5.380879,
-  -6.346174, 0.09881, 4.08456,
-  -6.323184, 2.156568, 3.998652,
-  // f 109/191 110/192 111/193 112/194
-  -7.509654, -0.099812, 5.380879,
-  -7.196787, 3.355576, 5.159555,
-  -6.323184, 2.156568, 3.998652,
-  // f 113/195 114/196 115/197 116/198
-  -4.808592, -2.673154, 2.573783,
-  -6.129446, -2.425449, 3.710766,
-  -6.962502, -3.795209, 4.758929,
-  // f 113/195 114/196 115/197 116/198
-  -4.808592, -2.673154, 2.573783,
-  -4.898042, -4.241327, 2.568375,
-  -6.962502, -3.795209, 4.758929,
-  // f 117/199 113/195 116/198 118/200
-  -2.414335, -2.847858, 1.087341,
-  -4.808592, -2.673154, 2.573783,
-  -4.898042, -4.241327, 2.568375,
-  // f 117/199 113/195 116/198 118/200
-  -2.414335, -2.847858, 1.087341,
-  -2.399287, -4.378179, 1.083597,
-  -4.898042, -4.241327, 2.568375,
-  // f 119/201 120/202 121/203 122/204
-  -4.766375, 2.825849, 2.593542,
-  -2.399705, 2.808586, 0.971479,
-  -2.418097, 4.310621, 0.974598,
-  // f 119/201 120/202 121/203 122/204
-  -4.766375, 2.825849, 2.593542,
-  -4.787065, 4.297935, 2.602903,
-  -2.418097, 4.310621, 0.974598,
-  // f 123/205 119/201 122/204 124/206
-  -6.11816, 2.613709, 3.765264,
-  -4.766375, 2.825849, 2.593542,
-  -4.787065, 4.297935, 2.602903,
-  // f 123/205 119/201 122/204 124/206
-  -6.11816, 2.613709, 3.765264,
-  -6.864483, 3.952063, 4.824243,
-  -4.787065, 4.297935, 2.602903,
-  // f 125/207 126/208 127/209 128/210
-  -7.860352, -1.935656, 2.917211,
-  -8.459332, -3.118648, 4.18212,
-  -8.731654, -0.093157, 4.490806,
-  // f 125/207 126/208 127/209 128/210
-  -7.860352, -1.935656, 2.917211,
-  -7.910302, 0.120023, 3.011023,
-  -8.731654, -0.093157, 4.490806,
-  // f 129/211 130/212 131/213 132/214
-  -8.287748, -3.740094, 3.77754,
-  -7.643414, -2.394253, 2.734994,
-  -6.060689, -2.661924, 1.188855,
-  // f 129/211 130/212 131/213 132/214
-  -8.287748, -3.740094, 3.77754,
-  -6.141779, -4.223857, 1.185943,
-  -6.060689, -2.661924, 1.188855,
-  // f 132/214 131/213 133/215 134/216
-  -6.141779, -4.223857, 1.185943,
-  -6.060689, -2.661924, 1.188855,
-  -2.577145, -2.415259, -0.37788,
-  // f 132/214 131/213 133/215 134/216
-  -6.141779, -4.223857, 1.185943,
-  -2.572548, -4.342406, -1.150013,
-  -2.577145, -2.415259, -0.37788,
-  // f 135/217 136/218 137/219 138/220
-  -2.571294, 2.785501, -1.13691,
-  -2.588431, 4.316237, -1.134205,
-  -0.004196, 4.234708, -1.647993,
-  // f 135/217 136/218 137/219 138/220
-  -2.571294, 2.785501, -1.13691,
-  -0.004195, 2.715619, -1.560421,
-  -0.004196, 4.234708, -1.647993,
-  // f 136/218 135/217 139/221 140/222
-  -2.588431, 4.316237, -1.134205,
-  -2.571294, 2.785501, -1.13691,
-  -6.024115, 2.798187, 1.204455,
-  // f 136/218 135/217 139/221 140/222
-  -2.588431, 4.316237, -1.134205,
-  -6.044805, 4.311245, 1.210903,
-  -6.024115, 2.798187, 1.204455,
-  // f 140/222 139/221 141/223 142/224
-  -6.044805, 4.311245, 1.210903,
-  -6.024115, 2.798187, 1.204455,
-  -7.680407, 2.340007, 2.777427,
-  // f 140/222 139/221 141/223 142/224
-  -6.044805, 4.311245, 1.210903,
-  -8.314918, 3.978685, 3.83599,
-  -7.680407, 2.340007, 2.777427,
-  // f 143/225 144/226 145/227 146/228
-  -7.742475, -0.119778, 5.408337,
-  -8.727474, -0.109171, 4.673231,
-  -8.418788, -3.360322, 4.445252,
-  // f 143/225 144/226 145/227 146/228
-  -7.742475, -0.119778, 5.408337,
-  -7.601821, -3.39443, 5.151237,
-  -8.418788, -3.360322, 4.445252,
-  // f 110/229 128/210 147/230 111/231
-  -6.346174, 0.09881, 4.08456,
-  -7.910302, 0.120023, 3.011023,
-  -7.875191, 2.191717, 2.980653,
-  // f 110/229 128/210 147/230 111/231
-  -6.346174, 0.09881, 4.08456,
-  -6.323184, 2.156568, 3.998652,
-  -7.875191, 2.191717, 2.980653,
-  // f 148/232 149/233 150/234 151/235
-  -8.219824, -4.021076, 4.031312,
-  -6.042507, -4.443069, 1.307004,
-  -5.029083, -4.459083, 2.430881,
-  // f 148/232 149/233 150/234 151/235
-  -8.219824, -4.021076, 4.031312,
-  -7.238795, -4.066207, 4.762466,
-  -5.029083, -4.459083, 2.430881,
-  // f 131/213 130/212 114/236 113/237
-  -6.060689, -2.661924, 1.188855,
-  -7.643414, -2.394253, 2.734994,
-  -6.129446, -2.425449, 3.710766,
-  // f 131/213 130/212 114/236 113/237
-  -6.060689, -2.661924, 1.188855,
-  -4.808592, -2.673154, 2.573783,
-  -6.129446, -2.425449, 3.710766,
-  // f 149/233 152/66 153/65 150/234
-  -6.042507, -4.443069, 1.307004,
-  -2.55541, -4.54186, -0.987765,
-  -2.414126, -4.570768, 0.934038,
-  // f 149/233 152/66 153/65 150/234
-  -6.042507, -4.443069, 1.307004,
-  -5.029083, -4.459083, 2.430881,
-  -2.414126, -4.570768, 0.934038,
-  // f 133/215 131/213 113/237 117/238
-  -2.577145, -2.415259, -0.37788,
-  -6.060689, -2.661924, 1.188855,
-  -4.808592, -2.673154, 2.573783,
-  // f 133/215 131/213 113/237 117/238
-  -2.577145, -2.415259, -0.37788,
-  -2.414335, -2.847858, 1.087341,
-  -4.808592, -2.673154, 2.573783,
-  // f 154/239 155/240 156/241 157/242
-  -0.004193, 4.528585, 0.089097,
-  -0.004195, 4.455167, -1.497186,
-  -2.574847, 4.522345, -0.971333,
-  // f 154/239 155/240 156/241 157/242
-  -0.004193, 4.528585, 0.089097,
-  -2.436489, 4.518186, 0.826495,
-  -2.574847, 4.522345, -0.971333,
-  // f 156/241 158/243 159/244 157/242
-  -2.574847, 4.522345, -0.971333,
-  -5.943442, 4.515691, 1.3303,
-  -4.908492, 4.507371, 2.470817,
-  // f 156/241 158/243 159/244 157/242
-  -2.574847, 4.522345, -0.971333,
-  -2.436489, 4.518186, 0.826495,
-  -4.908492, 4.507371, 2.470817,
-  // f 139/221 135/217 120/245 119/246
-  -6.024115, 2.798187, 1.204455,
-  -2.571294, 2.785501, -1.13691,
-  -2.399705, 2.808586, 0.971479,
-  // f 139/221 135/217 120/245 119/246
-  -6.024115, 2.798187, 1.204455,
-  -4.766375, 2.825849, 2.593542,
-  -2.399705, 2.808586, 0.971479,
-  // f 158/243 160/247 161/248 159/244
-  -5.943442, 4.515691, 1.3303,
-  -8.23717, 4.201224, 4.081858,
-  -7.122593, 4.179595, 4.829443,
-  // f 158/243 160/247 161/248 159/244
-  -5.943442, 4.515691, 1.3303,
-  -4.908492, 4.507371, 2.470817,
-  -7.122593, 4.179595, 4.829443,
-  // f 141/223 139/221 119/246 123/249
-  -7.680407, 2.340007, 2.777427,
-  -6.024115, 2.798187, 1.204455,
-  -4.766375, 2.825849, 2.593542,
-  // f 141/223 139/221 119/246 123/249
-  -7.680407, 2.340007, 2.777427,
-  -6.11816, 2.613709, 3.765264,
-  -4.766375, 2.825849, 2.593542,
-  // f 109/191 162/250 163/251 110/192
-  -7.509654, -0.099812, 5.380879,
-  -7.307137, -3.150885, 5.123571,
-  -6.285983, -1.955206, 3.912328,
-  // f 109/191 162/250 163/251 110/192
-  -7.509654, -0.099812, 5.380879,
-  -6.346174, 0.09881, 4.08456,
-  -6.285983, -1.955206, 3.912328,
-  // f 127/209 164/252 147/230 128/210
-  -8.731654, -0.093157, 4.490806,
-  -8.50573, 3.403619, 4.235161,
-  -7.875191, 2.191717, 2.980653,
-  // f 127/209 164/252 147/230 128/210
-  -8.731654, -0.093157, 4.490806,
-  -7.910302, 0.120023, 3.011023,
-  -7.875191, 2.191717, 2.980653,
-  // f 165/253 166/254 144/226 143/225
-  -7.478513, 3.558356, 5.186389,
-  -8.444912, 3.609312, 4.486229,
-  -8.727474, -0.109171, 4.673231,
-  // f 165/253 166/254 144/226 143/225
-  -7.478513, 3.558356, 5.186389,
-  -7.742475, -0.119778, 5.408337,
-  -8.727474, -0.109171, 4.673231,
-  // f 163/255 125/207 128/210 110/229
-  -6.285983, -1.955206, 3.912328,
-  -7.860352, -1.935656, 2.917211,
-  -7.910302, 0.120023, 3.011023,
-  // f 163/255 125/207 128/210 110/229
-  -6.285983, -1.955206, 3.912328,
-  -6.346174, 0.09881, 4.08456,
-  -7.910302, 0.120023, 3.011023,
-  // f 112/194 165/253 143/225 109/191
-  -7.196787, 3.355576, 5.159555,
-  -7.478513, 3.558356, 5.186389,
-  -7.742475, -0.119778, 5.408337,
-  // f 112/194 165/253 143/225 109/191
-  -7.196787, 3.355576, 5.159555,
-  -7.509654, -0.099812, 5.380879,
-  -7.742475, -0.119778, 5.408337,
-  // f 115/197 151/235 150/234 116/198
-  -6.962502, -3.795209, 4.758929,
-  -7.238795, -4.066207, 4.762466,
-  -5.029083, -4.459083, 2.430881,
-  // f 115/197 151/235 150/234 116/198
-  -6.962502, -3.795209, 4.758929,
-  -4.898042, -4.241327, 2.568375,
-  -5.029083, -4.459083, 2.430881,
-  // f 116/198 150/234 153/65 118/200
-  -4.898042, -4.241327, 2.568375,
-  -5.029083, -4.459083, 2.430881,
-  -2.414126, -4.570768, 0.934038,
-  // f 116/198 150/234 153/65 118/200
-  -4.898042, -4.241327, 2.568375,
-  -2.399287, -4.378179, 1.083597,
-  -2.414126, -4.570768, 0.934038,
-  // f 121/203 157/242 159/244 122/204
-  -2.418097, 4.310621, 0.974598,
-  -2.436489, 4.518186, 0.826495,
-  -4.908492, 4.507371, 2.470817,
-  // f 121/203 157/242 159/244 122/204
-  -2.418097, 4.310621, 0.974598,
-  -4.787065, 4.297935, 2.602903,
-  -4.908492, 4.507371, 2.470817,
-  // f 122/204 159/244 161/248 124/206
-  -4.787065, 4.297935, 2.602903,
-  -4.908492, 4.507371, 2.470817,
-  -7.122593, 4.179595, 4.829443,
-  // f 122/204 159/244 161/248 124/206
-  -4.787065, 4.297935, 2.602903,
-  -6.864483, 3.952063, 4.824243,
-  -7.122593, 4.179595, 4.829443,
-  // f 126/208 145/256 144/257 127/209
-  -8.459332, -3.118648, 4.18212,
-  -8.418788, -3.360322, 4.445252,
-  -8.727474, -0.109171, 4.673231,
-  // f 126/208 145/256 144/257 127/209
-  -8.459332, -3.118648, 4.18212,
-  -8.731654, -0.093157, 4.490806,
-  -8.727474, -0.109171, 4.673231,
-  // f 132/214 149/258 148/259 129/211
-  -6.141779, -4.223857, 1.185943,
-  -6.042507, -4.443069, 1.307004,
-  -8.219824, -4.021076, 4.031312,
-  // f 132/214 149/258 148/259 129/211
-  -6.141779, -4.223857, 1.185943,
-  -8.287748, -3.740094, 3.77754,
-  -8.219824, -4.021076, 4.031312,
-  // f 134/216 152/260 149/258 132/214
-  -2.572548, -4.342406, -1.150013,
-  -2.55541, -4.54186, -0.987765,
-  -6.042507, -4.443069, 1.307004,
-  // f 134/216 152/260 149/258 132/214
-  -2.572548, -4.342406, -1.150013,
-  -6.141779, -4.223857, 1.185943,
-  -6.042507, -4.443069, 1.307004,
-  // f 136/218 156/261 155/262 137/219
-  -2.588431, 4.316237, -1.134205,
-  -2.574847, 4.522345, -0.971333,
-  -0.004195, 4.455167, -1.497186,
-  // f 136/218 156/261 155/262 137/219
-  -2.588431, 4.316237, -1.134205,
-  -0.004196, 4.234708, -1.647993,
-  -0.004195, 4.455167, -1.497186,
-  // f 140/222 158/263 156/261 136/218
-  -6.044805, 4.311245, 1.210903,
-  -5.943442, 4.515691, 1.3303,
-  -2.574847, 4.522345, -0.971333,
-  // f 140/222 158/263 156/261 136/218
-  -6.044805, 4.311245, 1.210903,
-  -2.588431, 4.316237, -1.134205,
-  -2.574847, 4.522345, -0.971333,
-  // f 142/224 160/264 158/263 140/222
-  -8.314918, 3.978685, 3.83599,
-  -8.23717, 4.201224, 4.081858,
-  -5.943442, 4.515691, 1.3303,
-  // f 142/224 160/264 158/263 140/222
-  -8.314918, 3.978685, 3.83599,
-  -6.044805, 4.311245, 1.210903,
-  -5.943442, 4.515691, 1.3303,
-  // f 109/191 143/225 146/228 162/250
-  -7.509654, -0.099812, 5.380879,
-  -7.742475, -0.119778, 5.408337,
-  -7.601821, -3.39443, 5.151237,
-  // f 109/191 143/225 146/228 162/250
-  -7.509654, -0.099812, 5.380879,
-  -7.307137, -3.150885, 5.123571,
-  -7.601821, -3.39443, 5.151237,
-  // f 127/209 144/257 166/265 164/252
-  -8.731654, -0.093157, 4.490806,
-  -8.727474, -0.109171, 4.673231,
-  -8.444912, 3.609312, 4.486229,
-  // f 127/209 144/257 166/265 164/252
-  -8.731654, -0.093157, 4.490806,
-  -8.50573, 3.403619, 4.235161,
-  -8.444912, 3.609312, 4.486229,
-  // f 162/250 115/197 114/196 163/251
-  -7.307137, -3.150885, 5.123571,
-  -6.962502, -3.795209, 4.758929,
-  -6.129446, -2.425449, 3.710766,
-  // f 162/250 115/197 114/196 163/251
-  -7.307137, -3.150885, 5.123571,
-  -6.285983, -1.955206, 3.912328,
-  -6.129446, -2.425449, 3.710766,
-  // f 111/193 123/205 124/206 112/194
-  -6.323184, 2.156568, 3.998652,
-  -6.11816, 2.613709, 3.765264,
-  -6.864483, 3.952063, 4.824243,
-  // f 111/193 123/205 124/206 112/194
-  -6.323184, 2.156568, 3.998652,
-  -7.196787, 3.355576, 5.159555,
-  -6.864483, 3.952063, 4.824243,
-  // f 125/207 130/212 129/211 126/208
-  -7.860352, -1.935656, 2.917211,
-  -7.643414, -2.394253, 2.734994,
-  -8.287748, -3.740094, 3.77754,
-  // f 125/207 130/212 129/211 126/208
-  -7.860352, -1.935656, 2.917211,
-  -8.459332, -3.118648, 4.18212,
-  -8.287748, -3.740094, 3.77754,
-  // f 164/252 142/224 141/223 147/230
-  -8.50573, 3.403619, 4.235161,
-  -8.314918, 3.978685, 3.83599,
-  -7.680407, 2.340007, 2.777427,
-  // f 164/252 142/224 141/223 147/230
-  -8.50573, 3.403619, 4.235161,
-  -7.875191, 2.191717, 2.980653,
-  -7.680407, 2.340007, 2.777427,
-  // f 165/253 161/248 160/247 166/254
-  -7.478513, 3.558356, 5.186389,
-  -7.122593, 4.179595, 4.829443,
-  -8.23717, 4.201224, 4.081858,
-  // f 165/253 161/248 160/247 166/254
-  -7.478513, 3.558356, 5.186389,
-  -8.444912, 3.609312, 4.486229,
-  -8.23717, 4.201224, 4.081858,
-  // f 145/227 148/232 151/235 146/228
-  -8.418788, -3.360322, 4.445252,
-  -8.219824, -4.021076, 4.031312,
-  -7.238795, -4.066207, 4.762466,
-  // f 145/227 148/232 151/235 146/228
-  -8.418788, -3.360322, 4.445252,
-  -7.601821, -3.39443, 5.151237,
-  -7.238795, -4.066207, 4.762466,
-  // f 163/255 114/236 130/212 125/207
-  -6.285983, -1.955206, 3.912328,
-  -6.129446, -2.425449, 3.710766,
-  -7.643414, -2.394253, 2.734994,
-  // f 163/255 114/236 130/212 125/207
-  -6.285983, -1.955206, 3.912328,
-  -7.860352, -1.935656, 2.917211,
-  -7.643414, -2.394253, 2.734994,
-  // f 147/230 141/223 123/249 111/231
-  -7.875191, 2.191717, 2.980653,
-  -7.680407, 2.340007, 2.777427,
-  -6.11816, 2.613709, 3.765264,
-  // f 147/230 141/223 123/249 111/231
-  -7.875191, 2.191717, 2.980653,
-  -6.323184, 2.156568, 3.998652,
-  -6.11816, 2.613709, 3.765264,
-  // f 161/248 165/253 112/194 124/206
-  -7.122593, 4.179595, 4.829443,
-  -7.478513, 3.558356, 5.186389,
-  -7.196787, 3.355576, 5.159555,
-  // f 161/248 165/253 112/194 124/206
-  -7.122593, 4.179595, 4.829443,
-  -6.864483, 3.952063, 4.824243,
-  -7.196787, 3.355576, 5.159555,
-  // f 146/228 151/235 115/197 162/250
-  -7.601821, -3.39443, 5.151237,
-  -7.238795, -4.066207, 4.762466,
-  -6.962502, -3.795209, 4.758929,
-  // f 146/228 151/235 115/197 162/250
-  -7.601821, -3.39443, 5.151237,
-  -7.307137, -3.150885, 5.123571,
-  -6.962502, -3.795209, 4.758929,
-  // f 142/224 164/252 166/265 160/264
-  -8.314918, 3.978685, 3.83599,
-  -8.50573, 3.403619, 4.235161,
-  -8.444912, 3.609312, 4.486229,
-  // f 142/224 164/252 166/265 160/264
-  -8.314918, 3.978685, 3.83599,
-  -8.23717, 4.201224, 4.081858,
-  -8.444912, 3.609312, 4.486229,
-  // f 126/208 129/211 148/259 145/256
-  -8.459332, -3.118648, 4.18212,
-  -8.287748, -3.740094, 3.77754,
-  -8.219824, -4.021076, 4.031312,
-  // f 126/208 129/211 148/259 145/256
-  -8.459332, -3.118648, 4.18212,
-  -8.418788, -3.360322, 4.445252,
-  -8.219824, -4.021076, 4.031312,
-  // f 167/266 168/267 169/268 170/269
-  -2.660957, 3.435647, -3.948994,
-  -3.752334, 3.435647, -3.948993,
-  -3.752331, 3.432319, -1.770922,
-  // f 167/266 168/267 169/268 170/269
-  -2.660957, 3.435647, -3.948994,
-  -2.660954, 3.432319, -1.770924,
-  -3.752331, 3.432319, -1.770922,
-  // f 168/267 171/270 172/271 169/268
-  -3.752334, 3.435647, -3.948993,
-  -4.777878, 3.064193, -3.949616,
-  -4.777875, 3.060866, -1.771752,
-  // f 168/267 171/270 172/271 169/268
-  -3.752334, 3.435647, -3.948993,
-  -3.752331, 3.432319, -1.770922,
-  -4.777875, 3.060866, -1.771752,
-  // f 171/270 173/272 174/273 172/271
-  -4.777878, 3.064193, -3.949616,
-  -5.614071, 2.366003, -3.951071,
-  -5.614069, 2.362676, -1.773207,
-  // f 171/270 173/272 174/273 172/271
-  -4.777878, 3.064193, -3.949616,
-  -4.777875, 3.060866, -1.771752,
-  -5.614069, 2.362676, -1.773207,
-  // f 173/272 175/274 176/275 174/273
-  -5.614071, 2.366003, -3.951071,
-  -6.15976, 1.425515, -3.95315,
-  -6.159757, 1.422188, -1.775079,
-  // f 173/272 175/274 176/275 174/273
-  -5.614071, 2.366003, -3.951071,
-  -5.614069, 2.362676, -1.773207,
-  -6.159757, 1.422188, -1.775079,
-  // f 175/274 177/276 178/277 176/275
-  -6.15976, 1.425515, -3.95315,
-  -6.349111, 0.355872, -3.95523,
-  -6.349108, 0.352545, -1.777366,
-  // f 175/274 177/276 178/277 176/275
-  -6.15976, 1.425515, -3.95315,
-  -6.159757, 1.422188, -1.775079,
-  -6.349108, 0.352545, -1.777366,
-  // f 177/276 179/278 180/279 178/277
-  -6.349111, 0.355872, -3.95523,
-  -6.15976, -0.713772, -3.957518,
-  -6.159757, -0.717099, -1.779446,
-  // f 177/276 179/278 180/279 178/277
-  -6.349111, 0.355872, -3.95523,
-  -6.349108, 0.352545, -1.777366,
-  -6.159757, -0.717099, -1.779446,
-  // f 179/278 181/280 182/281 180/279
-  -6.15976, -0.713772, -3.957518,
-  -5.614071, -1.654259, -3.95939,
-  -5.614069, -1.657587, -1.781527,
-  // f 179/278 181/280 182/281 180/279
-  -6.15976, -0.713772, -3.957518,
-  -6.159757, -0.717099, -1.779446,
-  -5.614069, -1.657587, -1.781527,
-  // f 181/280 183/282 184/283 182/281
-  -5.614071, -1.654259, -3.95939,
-  -4.777878, -2.35245, -3.960847,
-  -4.777875, -2.355777, -1.782984,
-  // f 181/280 183/282 184/283 182/281
-  -5.614071, -1.654259, -3.95939,
-  -5.614069, -1.657587, -1.781527,
-  -4.777875, -2.355777, -1.782984,
-  // f 183/282 185/284 186/285 184/283
-  -4.777878, -2.35245, -3.960847,
-  -3.752334, -2.723903, -3.961681,
-  -3.752331, -2.72723, -1.783609,
-  // f 183/282 185/284 186/285 184/283
-  -4.777878, -2.35245, -3.960847,
-  -4.777875, -2.355777, -1.782984,
-  -3.752331, -2.72723, -1.783609,
-  // f 185/284 187/286 188/287 186/285
-  -3.752334, -2.723903, -3.961681,
-  -2.660957, -2.723903, -3.961682,
-  -2.660954, -2.72723, -1.783611,
-  // f 185/284 187/286 188/287 186/285
-  -3.752334, -2.723903, -3.961681,
-  -3.752331, -2.72723, -1.783609,
-  -2.660954, -2.72723, -1.783611,
-  // f 187/286 189/288 190/289 188/287
-  -2.660957, -2.723903, -3.961682,
-  -1.635413, -2.35245, -3.960851,
-  -1.63541, -2.355777, -1.782988,
-  // f 187/286 189/288 190/289 188/287
-  -2.660957, -2.723903, -3.961682,
-  -2.660954, -2.72723, -1.783611,
-  -1.63541, -2.355777, -1.782988,
-  // f 189/288 191/290 192/291 190/289
-  -1.635413, -2.35245, -3.960851,
-  -0.724817, -1.719981, -3.959605,
-  -0.724814, -1.723308, -1.781533,
-  // f 189/288 191/290 192/291 190/289
-  -1.635413, -2.35245, -3.960851,
-  -1.63541, -2.355777, -1.782988,
-  -0.724814, -1.723308, -1.781533,
-  // f 193/292 194/293 192/291 191/290
-  -0.004199, -1.080025, -3.958358,
-  -0.004196, -1.083352, -1.780287,
-  -0.724814, -1.723308, -1.781533,
-  // f 193/292 194/293 192/291 191/290
-  -0.004199, -1.080025, -3.958358,
-  -0.724817, -1.719981, -3.959605,
-  -0.724814, -1.723308, -1.781533,
-  // f 195/294 196/295 197/296 198/297
-  -1.050012, 1.133927, -1.998696,
-  -1.448568, 1.820886, -1.997447,
-  -2.059046, 2.330647, -1.996198,
-  // f 195/294 196/295 197/296 198/297
-  -1.050012, 1.133927, -1.998696,
-  -1.050012, -0.428214, -2.002024,
-  -2.059046, 2.330647, -1.996198,
-  // f 197/296 199/298 200/299 201/300
-  -2.059046, 2.330647, -1.996198,
-  -2.808088, 2.602061, -1.995782,
-  -3.605199, 2.602061, -1.995781,
-  // f 197/296 199/298 200/299 201/300
-  -2.059046, 2.330647, -1.996198,
-  -4.964718, 1.820886, -1.997442,
-  -3.605199, 2.602061, -1.995781,
-  // f 200/299 202/301 201/300
-  -3.605199, 2.602061, -1.995781,
-  -4.354032, 2.330647, -1.996195,
-  -4.964718, 1.820886, -1.997442,
-  // f 201/300 203/302 204/303 205/304
-  -4.964718, 1.820886, -1.997442,
-  -5.363274, 1.133927, -1.99869,
-  -5.501629, 0.352961, -2.000353,
-  // f 201/300 203/302 204/303 205/304
-  -4.964718, 1.820886, -1.997442,
-  -4.964718, -1.115173, -2.003474,
-  -5.501629, 0.352961, -2.000353,
-  // f 204/303 206/305 205/304
-  -5.501629, 0.352961, -2.000353,
-  -5.363274, -0.428214, -2.002018,
-  -4.964718, -1.115173, -2.003474,
-  // f 205/304 207/306 208/307 209/308
-  -4.964718, -1.115173, -2.003474,
-  -4.354032, -1.624934, -2.004515,
-  -3.605199, -1.89614, -2.00514,
-  // f 205/304 207/306 208/307 209/308
-  -4.964718, -1.115173, -2.003474,
-  -2.059046, -1.624934, -2.004519,
-  -3.605199, -1.89614, -2.00514,
-  // f 208/307 210/309 209/308
-  -3.605199, -1.89614, -2.00514,
-  -2.808088, -1.89614, -2.005141,
-  -2.059046, -1.624934, -2.004519,
-  // f 201/300 205/304 209/308 197/296
-  -4.964718, 1.820886, -1.997442,
-  -4.964718, -1.115173, -2.003474,
-  -2.059046, -1.624934, -2.004519,
-  // f 201/300 205/304 209/308 197/296
-  -4.964718, 1.820886, -1.997442,
-  -2.059046, 2.330647, -1.996198,
-  -2.059046, -1.624934, -2.004519,
-  // f 209/308 211/310 198/297 197/296
-  -2.059046, -1.624934, -2.004519,
-  -1.448568, -1.115173, -2.003479,
-  -1.050012, -0.428214, -2.002024,
-  // f 209/308 211/310 198/297 197/296
-  -2.059046, -1.624934, -2.004519,
-  -2.059046, 2.330647, -1.996198,
-  -1.050012, -0.428214, -2.002024,
-  // f 212/311 195/294 198/297
-  -0.911657, 0.352961, -2.00036,
-  -1.050012, 1.133927, -1.998696,
-  -1.050012, -0.428214, -2.002024,
-  // f 170/269 169/268 213/312 214/313
-  -2.660954, 3.432319, -1.770924,
-  -3.752331, 3.432319, -1.770922,
-  -3.605198, 2.601645, -1.772586,
-  // f 170/269 169/268 213/312 214/313
-  -2.660954, 3.432319, -1.770924,
-  -2.808087, 2.601645, -1.772587,
-  -3.605198, 2.601645, -1.772586,
-  // f 169/268 172/271 215/314 213/312
-  -3.752331, 3.432319, -1.770922,
-  -4.777875, 3.060866, -1.771752,
-  -4.354032, 2.330439, -1.773208,
-  // f 169/268 172/271 215/314 213/312
-  -3.752331, 3.432319, -1.770922,
-  -3.605198, 2.601645, -1.772586,
-  -4.354032, 2.330439, -1.773208,
-  // f 172/271 174/273 216/315 215/314
-  -4.777875, 3.060866, -1.771752,
-  -5.614069, 2.362676, -1.773207,
-  -4.964718, 1.820471, -1.774248,
-  // f 172/271 174/273 216/315 215/314
-  -4.777875, 3.060866, -1.771752,
-  -4.354032, 2.330439, -1.773208,
-  -4.964718, 1.820471, -1.774248,
-  // f 174/273 176/275 217/316 216/315
-  -5.614069, 2.362676, -1.773207,
-  -6.159757, 1.422188, -1.775079,
-  -5.363273, 1.133719, -1.775703,
-  // f 174/273 176/275 217/316 216/315
-  -5.614069, 2.362676, -1.773207,
-  -4.964718, 1.820471, -1.774248,
-  -5.363273, 1.133719, -1.775703,
-  // f 176/275 178/277 218/317 217/316
-  -6.159757, 1.422188, -1.775079,
-  -6.349108, 0.352545, -1.777366,
-  -5.501629, 0.352545, -1.777367,
-  // f 176/275 178/277 218/317 217/316
-  -6.159757, 1.422188, -1.775079,
-  -5.363273, 1.133719, -1.775703,
-  -5.501629, 0.352545, -1.777367,
-  // f 178/277 180/279 219/318 218/317
-  -6.349108, 0.352545, -1.777366,
-  -6.159757, -0.717099, -1.779446,
-  -5.363273, -0.42863, -1.779031,
-  // f 178/277 180/279 219/318 218/317
-  -6.349108, 0.352545, -1.777366,
-  -5.501629, 0.352545, -1.777367,
-  -5.363273, -0.42863, -1.779031,
-  // f 180/279 182/281 220/319 219/318
-  -6.159757, -0.717099, -1.779446,
-  -5.614069, -1.657587, -1.781527,
-  -4.964718, -1.115381, -1.78028,
-  // f 180/279 182/281 220/319 219/318
-  -6.159757, -0.717099, -1.779446,
-  -5.363273, -0.42863, -1.779031,
-  -4.964718, -1.115381, -1.78028,
-  // f 182/281 184/283 221/320 220/319
-  -5.614069, -1.657587, -1.781527,
-  -4.777875, -2.355777, -1.782984,
-  -4.354032, -1.62535, -1.78132,
-  // f 182/281 184/283 221/320 220/319
-  -5.614069, -1.657587, -1.781527,
-  -4.964718, -1.115381, -1.78028,
-  -4.354032, -1.62535, -1.78132,
-  // f 184/283 186/285 222/321 221/320
-  -4.777875, -2.355777, -1.782984,
-  -3.752331, -2.72723, -1.783609,
-  -3.605198, -1.896556, -1.781946,
-  // f 184/283 186/285 222/321 221/320
-  -4.777875, -2.355777, -1.782984,
-  -4.354032, -1.62535, -1.78132,
-  -3.605198, -1.896556, -1.781946,
-  // f 186/285 188/287 223/322 222/321
-  -3.752331, -2.72723, -1.783609,
-  -2.660954, -2.72723, -1.783611,
-  -2.808087, -1.896556, -1.781947,
-  // f 186/285 188/287 223/322 222/321
-  -3.752331, -2.72723, -1.783609,
-  -3.605198, -1.896556, -1.781946,
-  -2.808087, -1.896556, -1.781947,
-  // f 188/287 190/289 224/323 223/322
-  -2.660954, -2.72723, -1.783611,
-  -1.63541, -2.355777, -1.782988,
-  -2.059045, -1.62535, -1.781323,
-  // f 188/287 190/289 224/323 223/322
-  -2.660954, -2.72723, -1.783611,
-  -2.808087, -1.896556, -1.781947,
-  -2.059045, -1.62535, -1.781323,
-  // f 190/289 192/291 225/324 224/323
-  -1.63541, -2.355777, -1.782988,
-  -0.724814, -1.723308, -1.781533,
-  -1.448568, -1.115381, -1.780285,
-  // f 190/289 192/291 225/324 224/323
-  -1.63541, -2.355777, -1.782988,
-  -2.059045, -1.62535, -1.781323,
-  -1.448568, -1.115381, -1.780285,
-  // f 194/293 226/325 227/326 225/324
-  -0.004196, -1.083352, -1.780287,
-  -0.004196, -0.989553, -1.780079,
-  -1.050012, -0.42863, -1.779037,
-  // f 194/293 226/325 227/326 225/324
-  -0.004196, -1.083352, -1.780287,
-  -1.448568, -1.115381, -1.780285,
-  -1.050012, -0.42863, -1.779037,
-  // f 192/291 194/293 225/324
-  -0.724814, -1.723308, -1.781533,
-  -0.004196, -1.083352, -1.780287,
-  -1.448568, -1.115381, -1.780285,
-  // f 228/327 229/328 195/294 212/311
-  -0.911657, 0.352545, -1.777374,
-  -1.050012, 1.133719, -1.775709,
-  -1.050012, 1.133927, -1.998696,
-  // f 228/327 229/328 195/294 212/311
-  -0.911657, 0.352545, -1.777374,
-  -0.911657, 0.352961, -2.00036,
-  -1.050012, 1.133927, -1.998696,
-  // f 229/328 230/329 196/295 195/294
-  -1.050012, 1.133719, -1.775709,
-  -1.448568, 1.820471, -1.774253,
-  -1.448568, 1.820886, -1.997447,
-  // f 229/328 230/329 196/295 195/294
-  -1.050012, 1.133719, -1.775709,
-  -1.050012, 1.133927, -1.998696,
-  -1.448568, 1.820886, -1.997447,
-  // f 230/329 231/330 197/296 196/295
-  -1.448568, 1.820471, -1.774253,
-  -2.059045, 2.330439, -1.773212,
-  -2.059046, 2.330647, -1.996198,
-  // f 230/329 231/330 197/296 196/295
-  -1.448568, 1.820471, -1.774253,
-  -1.448568, 1.820886, -1.997447,
-  -2.059046, 2.330647, -1.996198,
-  // f 231/330 214/331 199/298 197/296
-  -2.059045, 2.330439, -1.773212,
-  -2.808087, 2.601645, -1.772587,
-  -2.808088, 2.602061, -1.995782,
-  // f 231/330 214/331 199/298 197/296
-  -2.059045, 2.330439, -1.773212,
-  -2.059046, 2.330647, -1.996198,
-  -2.808088, 2.602061, -1.995782,
-  // f 214/331 213/332 200/299 199/298
-  -2.808087, 2.601645, -1.772587,
-  -3.605198, 2.601645, -1.772586,
-  -3.605199, 2.602061, -1.995781,
-  // f 214/331 213/332 200/299 199/298
-  -2.808087, 2.601645, -1.772587,
-  -2.808088, 2.602061, -1.995782,
-  -3.605199, 2.602061, -1.995781,
-  // f 213/332 215/333 202/301 200/299
-  -3.605198, 2.601645, -1.772586,
-  -4.354032, 2.330439, -1.773208,
-  -4.354032, 2.330647, -1.996195,
-  // f 213/332 215/333 202/301 200/299
-  -3.605198, 2.601645, -1.772586,
-  -3.605199, 2.602061, -1.995781,
-  -4.354032, 2.330647, -1.996195,
-  // f 215/333 216/334 201/300 202/301
-  -4.354032, 2.330439, -1.773208,
-  -4.964718, 1.820471, -1.774248,
-  -4.964718, 1.820886, -1.997442,
-  // f 215/333 216/334 201/300 202/301
-  -4.354032, 2.330439, -1.773208,
-  -4.354032, 2.330647, -1.996195,
-  -4.964718, 1.820886, -1.997442,
-  // f 216/334 217/335 203/302 201/300
-  -4.964718, 1.820471, -1.774248,
-  -5.363273, 1.133719, -1.775703,
-  -5.363274, 1.133927, -1.99869,
-  // f 216/334 217/335 203/302 201/300
-  -4.964718, 1.820471, -1.774248,
-  -4.964718, 1.820886, -1.997442,
-  -5.363274, 1.133927, -1.99869,
-  // f 217/335 218/336 204/303 203/302
-  -5.363273, 1.133719, -1.775703,
-  -5.501629, 0.352545, -1.777367,
-  -5.501629, 0.352961, -2.000353,
-  // f 217/335 218/336 204/303 203/302
-  -5.363273, 1.133719, -1.775703,
-  -5.363274, 1.133927, -1.99869,
-  -5.501629, 0.352961, -2.000353,
-  // f 218/336 219/337 206/305 204/303
-  -5.501629, 0.352545, -1.777367,
-  -5.363273, -0.42863, -1.779031,
-  -5.363274, -0.428214, -2.002018,
-  // f 218/336 219/337 206/305 204/303
-  -5.501629, 0.352545, -1.777367,
-  -5.501629, 0.352961, -2.000353,
-  -5.363274, -0.428214, -2.002018,
-  // f 219/337 220/338 205/304 206/305
-  -5.363273, -0.42863, -1.779031,
-  -4.964718, -1.115381, -1.78028,
-  -4.964718, -1.115173, -2.003474,
-  // f 219/337 220/338 205/304 206/305
-  -5.363273, -0.42863, -1.779031,
-  -5.363274, -0.428214, -2.002018,
-  -4.964718, -1.115173, -2.003474,
-  // f 220/338 221/339 207/306 205/304
-  -4.964718, -1.115381, -1.78028,
-  -4.354032, -1.62535, -1.78132,
-  -4.354032, -1.624934, -2.004515,
-  // f 220/338 221/339 207/306 205/304
-  -4.964718, -1.115381, -1.78028,
-  -4.964718, -1.115173, -2.003474,
-  -4.354032, -1.624934, -2.004515,
-  // f 221/339 222/340 208/307 207/306
-  -4.354032, -1.62535, -1.78132,
-  -3.605198, -1.896556, -1.781946,
-  -3.605199, -1.89614, -2.00514,
-  // f 221/339 222/340 208/307 207/306
-  -4.354032, -1.62535, -1.78132,
-  -4.354032, -1.624934, -2.004515,
-  -3.605199, -1.89614, -2.00514,
-  // f 222/340 223/341 210/309 208/307
-  -3.605198, -1.896556, -1.781946,
-  -2.808087, -1.896556, -1.781947,
-  -2.808088, -1.89614, -2.005141,
-  // f 222/340 223/341 210/309 208/307
-  -3.605198, -1.896556, -1.781946,
-  -3.605199, -1.89614, -2.00514,
-  -2.808088, -1.89614, -2.005141,
-  // f 223/341 224/342 209/308 210/309
-  -2.808087, -1.896556, -1.781947,
-  -2.059045, -1.62535, -1.781323,
-  -2.059046, -1.624934, -2.004519,
-  // f 223/341 224/342 209/308 210/309
-  -2.808087, -1.896556, -1.781947,
-  -2.808088, -1.89614, -2.005141,
-  -2.059046, -1.624934, -2.004519,
-  // f 224/342 225/343 211/310 209/308
-  -2.059045, -1.62535, -1.781323,
-  -1.448568, -1.115381, -1.780285,
-  -1.448568, -1.115173, -2.003479,
-  // f 224/342 225/343 211/310 209/308
-  -2.059045, -1.62535, -1.781323,
-  -2.059046, -1.624934, -2.004519,
-  -1.448568, -1.115173, -2.003479,
-  // f 225/343 227/344 198/297 211/310
-  -1.448568, -1.115381, -1.780285,
-  -1.050012, -0.42863, -1.779037,
-  -1.050012, -0.428214, -2.002024,
-  // f 225/343 227/344 198/297 211/310
-  -1.448568, -1.115381, -1.780285,
-  -1.448568, -1.115173, -2.003479,
-  -1.050012, -0.428214, -2.002024,
-  // f 227/344 228/327 212/311 198/297
-  -1.050012, -0.42863, -1.779037,
-  -0.911657, 0.352545, -1.777374,
-  -0.911657, 0.352961, -2.00036,
-  // f 227/344 228/327 212/311 198/297
-  -1.050012, -0.42863, -1.779037,
-  -1.050012, -0.428214, -2.002024,
-  -0.911657, 0.352961, -2.00036,
-  // f 232/345 233/346 234/347 235/348
-  -0.004196, 5.039384, -2.006602,
-  -0.004197, 5.040009, -2.349818,
-  -1.415965, 4.9173, -2.350025,
-  // f 232/345 233/346 234/347 235/348
-  -0.004196, 5.039384, -2.006602,
-  -1.415965, 4.916884, -2.007016,
-  -1.415965, 4.9173, -2.350025,
-  // f 236/349 232/345 235/348 237/36
-  -0.004196, 4.792096, -2.007226,
-  -0.004196, 5.039384, -2.006602,
-  -1.415965, 4.916884, -2.007016,
-  // f 236/349 232/345 235/348 237/36
-  -0.004196, 4.792096, -2.007226,
-  -1.415965, 4.669387, -2.007433,
-  -1.415965, 4.916884, -2.007016,
-  // f 238/28 239/27 240/41 241/40
-  -1.754957, 4.670011, -2.350648,
-  -1.754956, 4.669387, -2.007432,
-  -1.754956, 4.837435, -2.007015,
-  // f 238/28 239/27 240/41 241/40
-  -1.754957, 4.670011, -2.350648,
-  -1.754957, 4.837851, -2.350232,
-  -1.754956, 4.837435, -2.007015,
-  // f 242/39 243/42 235/348 234/347
-  -1.662372, 4.9173, -2.350025,
-  -1.662371, 4.916884, -2.007016,
-  -1.415965, 4.916884, -2.007016,
-  // f 242/39 243/42 235/348 234/347
-  -1.662372, 4.9173, -2.350025,
-  -1.415965, 4.9173, -2.350025,
-  -1.415965, 4.916884, -2.007016,
-  // f 235/348 243/42 237/36
-  -1.415965, 4.916884, -2.007016,
-  -1.662371, 4.916884, -2.007016,
-  -1.415965, 4.669387, -2.007433,
-  // f 241/350 242/351 244/32
-  -1.754957, 4.837851, -2.350232,
-  -1.662372, 4.9173, -2.350025,
-  -1.415965, 4.670011, -2.350649,
-  // f 242/351 234/352 244/32
-  -1.662372, 4.9173, -2.350025,
-  -1.415965, 4.9173, -2.350025,
-  -1.415965, 4.670011, -2.350649,
-  // f 240/41 239/27 237/36
-  -1.754956, 4.837435, -2.007015,
-  -1.754956, 4.669387, -2.007432,
-  -1.415965, 4.669387, -2.007433,
-  // f 237/36 243/42 240/41
-  -1.415965, 4.669387, -2.007433,
-  -1.662371, 4.916884, -2.007016,
-  -1.754956, 4.837435, -2.007015,
-  // f 260/353 261/354 262/355 263/356
-  -2.142224, -3.052927, -0.485214,
-  -2.012227, -3.301672, 0.676105,
-  -2.000314, -4.189125, 0.672985,
-  // f 260/353 261/354 262/355 263/356
-  -2.142224, -3.052927, -0.485214,
-  -2.137418, -4.174358, -1.104667,
-  -2.000314, -4.189125, 0.672985,
-  // f 264/67 263/356 262/355 265/68
-  -2.126341, -4.266701, -1.001286,
-  -2.137418, -4.174358, -1.104667,
-  -2.000314, -4.189125, 0.672985,
-  // f 264/67 263/356 262/355 265/68
-  -2.126341, -4.266701, -1.001286,
-  -2.010764, -4.283755, 0.571892,
-  -2.000314, -4.189125, 0.672985,
-  // f 117/199 118/200 262/355 261/354
-  -2.414335, -2.847858, 1.087341,
-  -2.399287, -4.378179, 1.083597,
-  -2.000314, -4.189125, 0.672985,
-  // f 117/199 118/200 262/355 261/354
-  -2.414335, -2.847858, 1.087341,
-  -2.012227, -3.301672, 0.676105,
-  -2.000314, -4.189125, 0.672985,
-  // f 118/200 153/65 265/68 262/355
-  -2.399287, -4.378179, 1.083597,
-  -2.414126, -4.570768, 0.934038,
-  -2.010764, -4.283755, 0.571892,
-  // f 118/200 153/65 265/68 262/355
-  -2.399287, -4.378179, 1.083597,
-  -2.000314, -4.189125, 0.672985,
-  -2.010764, -4.283755, 0.571892,
-  // f 152/260 134/216 263/357 264/358
-  -2.55541, -4.54186, -0.987765,
-  -2.572548, -4.342406, -1.150013,
-  -2.137418, -4.174358, -1.104667,
-  // f 152/260 134/216 263/357 264/358
-  -2.55541, -4.54186, -0.987765,
-  -2.126341, -4.266701, -1.001286,
-  -2.137418, -4.174358, -1.104667,
-  // f 134/216 133/215 260/359 263/357
-  -2.572548, -4.342406, -1.150013,
-  -2.577145, -2.415259, -0.37788,
-  -2.142224, -3.052927, -0.485214,
-  // f 134/216 133/215 260/359 263/357
-  -2.572548, -4.342406, -1.150013,
-  -2.137418, -4.174358, -1.104667,
-  -2.142224, -3.052927, -0.485214,
-  // f 133/215 117/238 261/360 260/359
-  -2.577145, -2.415259, -0.37788,
-  -2.414335, -2.847858, 1.087341,
-  -2.012227, -3.301672, 0.676105,
-  // f 133/215 117/238 261/360 260/359
-  -2.577145, -2.415259, -0.37788,
-  -2.142224, -3.052927, -0.485214,
-  -2.012227, -3.301672, 0.676105,
-  // f 37/117 266/361 267/362 38/118
-  -2.298555, -3.780859, -2.163021,
-  -0.004197, -3.801657, -2.749196,
-  -0.004197, -3.823495, -2.780814,
-  // f 37/117 266/361 267/362 38/118
-  -2.298555, -3.780859, -2.163021,
-  -2.348296, -3.6047, -2.161981,
-  -0.004197, -3.823495, -2.780814,
-  // f 40/120 268/363 269/364 41/121
-  -1.280122, -3.869043, -5.573136,
-  -0.004201, -3.92083, -5.573346,
-  -0.004198, -3.921246, -3.612437,
-  // f 40/120 268/363 269/364 41/121
-  -1.280122, -3.869043, -5.573136,
-  -1.280119, -3.870083, -3.458716,
-  -0.004198, -3.921246, -3.612437,
-  // f 44/124 270/365 271/366 45/125
-  -1.584626, -3.333493, -3.248834,
-  -0.004199, -3.401711, -4.036361,
-  -0.004197, 2.523028, -2.731308,
-  // f 44/124 270/365 271/366 45/125
-  -1.584626, -3.333493, -3.248834,
-  -1.579191, 2.522821, -2.580291,
-  -0.004197, 2.523028, -2.731308,
-  // f 272/367 273/368 48/128 47/127
-  -0.004195, 3.441055, -1.449135,
-  -0.004195, 3.644876, -1.447888,
-  -1.229748, 3.582065, -1.126926,
-  // f 272/367 273/368 48/128 47/127
-  -0.004195, 3.441055, -1.449135,
-  -1.275518, 3.440639, -1.126094,
-  -1.229748, 3.582065, -1.126926,
-  // f 274/369 275/370 50/130 49/129
-  -0.004196, 3.785262, -2.281799,
-  -0.004201, 3.786301, -5.569395,
-  -1.27845, 3.786301, -5.569394,
-  // f 274/369 275/370 50/130 49/129
-  -0.004196, 3.785262, -2.281799,
-  -1.278445, 3.785054, -2.196722,
-  -1.27845, 3.786301, -5.569394,
-  // f 82/17 276/70 266/371 37/167
-  -1.281164, -3.779196, -3.104475,
-  -0.004198, -3.886306, -3.599332,
-  -0.004197, -3.801657, -2.749196,
-  // f 82/17 276/70 266/371 37/167
-  -1.281164, -3.779196, -3.104475,
-  -2.298555, -3.780859, -2.163021,
-  -0.004197, -3.801657, -2.749196,
-  // f 38/118 267/362 266/372 98/176
-  -2.348296, -3.6047, -2.161981,
-  -0.004197, -3.823495, -2.780814,
-  -0.004197, -3.801657, -2.749196,
-  // f 38/118 267/362 266/372 98/176
-  -2.348296, -3.6047, -2.161981,
-  -2.348087, -3.473256, -2.129532,
-  -0.004197, -3.801657, -2.749196,
-  // f 266/372 270/365 44/124 98/176
-  -0.004197, -3.801657, -2.749196,
-  -0.004199, -3.401711, -4.036361,
-  -1.584626, -3.333493, -3.248834,
-  // f 266/372 270/365 44/124 98/176
-  -0.004197, -3.801657, -2.749196,
-  -2.348087, -3.473256, -2.129532,
-  -1.584626, -3.333493, -3.248834,
-  // f 84/22 32/169 48/373 277/71
-  -2.612258, 3.658186, -2.117468,
-  -2.512566, 3.516344, -0.790989,
-  -1.229748, 3.582065, -1.126926,
-  // f 84/22 32/169 48/373 277/71
-  -2.612258, 3.658186, -2.117468,
-  -1.27949, 3.658186, -2.202962,
-  -1.229748, 3.582065, -1.126926,
-  // f 31/111 100/178 278/374 47/127
-  -2.604106, 3.440015, -0.7887,
-  -2.604315, 3.015319, -0.789741,
-  -1.275518, 3.015735, -1.095725,
-  // f 31/111 100/178 278/374 47/127
-  -2.604106, 3.440015, -0.7887,
-  -1.275518, 3.440639, -1.126094,
-  -1.275518, 3.015735, -1.095725,
-  // f 100/178 28/108 45/125 278/374
-  -2.604315, 3.015319, -0.789741,
-  -3.211659, 2.522613, -2.423657,
-  -1.579191, 2.522821, -2.580291,
-  // f 100/178 28/108 45/125 278/374
-  -2.604315, 3.015319, -0.789741,
-  -1.275518, 3.015735, -1.095725,
-  -1.579191, 2.522821, -2.580291,
-  // f 281/375 282/376 283/377 284/378
-  -0.619062, 0.355664, -1.821888,
-  -0.777063, 1.247485, -1.821888,
-  -1.225149, 1.085052, -0.108718,
-  // f 281/375 282/376 283/377 284/378
-  -0.619062, 0.355664, -1.821888,
-  -1.095989, 0.355665, -0.108718,
-  -1.225149, 1.085052, -0.108718,
-  // f 282/376 285/379 286/380 283/377
-  -0.777063, 1.247485, -1.821888,
-  -1.232048, 2.031571, -1.821888,
-  -1.597371, 1.726464, -0.108717,
-  // f 282/376 285/379 286/380 283/377
-  -0.777063, 1.247485, -1.821888,
-  -1.225149, 1.085052, -0.108718,
-  -1.597371, 1.726464, -0.108717,
-  // f 285/379 287/381 288/382 286/380
-  -1.232048, 2.031571, -1.821888,
-  -1.92905, 2.6135, -1.821887,
-  -2.167512, 2.202531, -0.108717,
-  // f 285/379 287/381 288/382 286/380
-  -1.232048, 2.031571, -1.821888,
-  -1.597371, 1.726464, -0.108717,
-  -2.167512, 2.202531, -0.108717,
-  // f 287/381 289/383 290/384 288/382
-  -1.92905, 2.6135, -1.821887,
-  -2.784053, 2.923183, -1.821886,
-  -2.866813, 2.455851, -0.108716,
-  // f 287/381 289/383 290/384 288/382
-  -1.92905, 2.6135, -1.821887,
-  -2.167512, 2.202531, -0.108717,
-  -2.866813, 2.455851, -0.108716,
-  // f 289/383 291/385 292/386 290/384
-  -2.784053, 2.923183, -1.821886,
-  -3.693813, 2.923183, -1.821884,
-  -3.611048, 2.455851, -0.108715,
-  // f 289/383 291/385 292/386 290/384
-  -2.784053, 2.923183, -1.821886,
-  -2.866813, 2.455851, -0.108716,
-  -3.611048, 2.455851, -0.108715,
-  // f 291/385 293/387 294/388 292/386
-  -3.693813, 2.923183, -1.821884,
-  -4.548816, 2.6135, -1.821883,
-  -4.310349, 2.202531, -0.108714,
-  // f 291/385 293/387 294/388 292/386
-  -3.693813, 2.923183, -1.821884,
-  -3.611048, 2.455851, -0.108715,
-  -4.310349, 2.202531, -0.108714,
-  // f 293/387 295/389 296/390 294/388
-  -4.548816, 2.6135, -1.821883,
-  -5.245818, 2.031571, -1.821882,
-  -4.88049, 1.726464, -0.108713,
-  // f 293/387 295/389 296/390 294/388
-  -4.548816, 2.6135, -1.821883,
-  -4.310349, 2.202531, -0.108714,
-  -4.88049, 1.726464, -0.108713,
-  // f 295/389 297/391 298/392 296/390
-  -5.245818, 2.031571, -1.821882,
-  -5.700802, 1.247485, -1.821881,
-  -5.252712, 1.085052, -0.108712,
-  // f 295/389 297/391 298/392 296/390
-  -5.245818, 2.031571, -1.821882,
-  -4.88049, 1.726464, -0.108713,
-  -5.252712, 1.085052, -0.108712,
-  // f 297/391 299/393 300/394 298/392
-  -5.700802, 1.247485, -1.821881,
-  -5.858803, 0.355664, -1.821881,
-  -5.381872, 0.355665, -0.108712,
-  // f 297/391 299/393 300/394 298/392
-  -5.700802, 1.247485, -1.821881,
-  -5.252712, 1.085052, -0.108712,
-  -5.381872, 0.355665, -0.108712,
-  // f 299/393 301/395 302/396 300/394
-  -5.858803, 0.355664, -1.821881,
-  -5.700802, -0.535948, -1.821881,
-  -5.252712, -0.373723, -0.108712,
-  // f 299/393 301/395 302/396 300/394
-  -5.858803, 0.355664, -1.821881,
-  -5.381872, 0.355665, -0.108712,
-  -5.252712, -0.373723, -0.108712,
-  // f 301/395 303/397 304/398 302/396
-  -5.700802, -0.535948, -1.821881,
-  -5.245818, -1.320034, -1.821882,
-  -4.88049, -1.015135, -0.108712,
-  // f 301/395 303/397 304/398 302/396
-  -5.700802, -0.535948, -1.821881,
-  -5.252712, -0.373723, -0.108712,
-  -4.88049, -1.015135, -0.108712,
-  // f 303/397 305/399 306/400 304/398
-  -5.245818, -1.320034, -1.821882,
-  -4.548816, -1.902171, -1.821882,
-  -4.310349, -1.491202, -0.108713,
-  // f 303/397 305/399 306/400 304/398
-  -5.245818, -1.320034, -1.821882,
-  -4.88049, -1.015135, -0.108712,
-  -4.310349, -1.491202, -0.108713,
-  // f 305/399 307/401 308/402 306/400
-  -4.548816, -1.902171, -1.821882,
-  -3.693813, -2.211647, -1.821884,
-  -3.611048, -1.744314, -0.108714,
-  // f 305/399 307/401 308/402 306/400
-  -4.548816, -1.902171, -1.821882,
-  -4.310349, -1.491202, -0.108713,
-  -3.611048, -1.744314, -0.108714,
-  // f 307/401 309/403 310/404 308/402
-  -3.693813, -2.211647, -1.821884,
-  -2.784053, -2.211647, -1.821885,
-  -2.866813, -1.744314, -0.108715,
-  // f 307/401 309/403 310/404 308/402
-  -3.693813, -2.211647, -1.821884,
-  -3.611048, -1.744314, -0.108714,
-  -2.866813, -1.744314, -0.108715,
-  // f 309/403 311/405 312/406 310/404
-  -2.784053, -2.211647, -1.821885,
-  -1.92905, -1.902171, -1.821886,
-  -2.167512, -1.491202, -0.108716,
-  // f 309/403 311/405 312/406 310/404
-  -2.784053, -2.211647, -1.821885,
-  -2.866813, -1.744314, -0.108715,
-  -2.167512, -1.491202, -0.108716,
-  // f 311/405 313/407 314/408 312/406
-  -1.92905, -1.902171, -1.821886,
-  -1.232048, -1.320034, -1.821887,
-  -1.597371, -1.015135, -0.108717,
-  // f 311/405 313/407 314/408 312/406
-  -1.92905, -1.902171, -1.821886,
-  -2.167512, -1.491202, -0.108716,
-  -1.597371, -1.015135, -0.108717,
-  // f 313/407 315/409 316/410 314/408
-  -1.232048, -1.320034, -1.821887,
-  -0.777063, -0.535948, -1.821888,
-  -1.225149, -0.373723, -0.108717,
-  // f 313/407 315/409 316/410 314/408
-  -1.232048, -1.320034, -1.821887,
-  -1.597371, -1.015135, -0.108717,
-  -1.225149, -0.373723, -0.108717,
-  // f 315/409 281/375 284/378 316/410
-  -0.777063, -0.535948, -1.821888,
-  -0.619062, 0.355664, -1.821888,
-  -1.095989, 0.355665, -0.108718,
-  // f 315/409 281/375 284/378 316/410
-  -0.777063, -0.535948, -1.821888,
-  -1.225149, -0.373723, -0.108717,
-  -1.095989, 0.355665, -0.108718,
-  // f 317/411 318/412 319/413 320/414
-  -1.339679, 1.043664, -0.249333,
-  -1.690792, 1.648471, -0.249332,
-  -2.22833, 2.097501, -0.249332,
-  // f 317/411 318/412 319/413 320/414
-  -1.339679, 1.043664, -0.249333,
-  -1.339679, -0.332127, -0.249332,
-  -2.22833, 2.097501, -0.249332,
-  // f 319/413 321/415 322/416 323/417
-  -2.22833, 2.097501, -0.249332,
-  -2.887922, 2.33647, -0.249331,
-  -3.589939, 2.33647, -0.24933,
-  // f 319/413 321/415 322/416 323/417
-  -2.22833, 2.097501, -0.249332,
-  -4.787069, 1.648471, -0.249328,
-  -3.589939, 2.33647, -0.24933,
-  // f 322/416 324/418 323/417
-  -3.589939, 2.33647, -0.24933,
-  -4.249531, 2.097501, -0.249329,
-  -4.787069, 1.648471, -0.249328,
-  // f 323/417 325/419 326/420 327/421
-  -4.787069, 1.648471, -0.249328,
-  -5.138182, 1.043664, -0.249328,
-  -5.260027, 0.355664, -0.249327,
-  // f 323/417 325/419 326/420 327/421
-  -4.787069, 1.648471, -0.249328,
-  -4.787069, -0.937142, -0.249328,
-  -5.260027, 0.355664, -0.249327,
-  // f 326/420 328/422 327/421
-  -5.260027, 0.355664, -0.249327,
-  -5.138182, -0.332127, -0.249327,
-  -4.787069, -0.937142, -0.249328,
-  // f 327/421 329/423 330/424 331/425
-  -4.787069, -0.937142, -0.249328,
-  -4.249531, -1.385964, -0.249328,
-  -3.589939, -1.624933, -0.249329,
-  // f 327/421 329/423 330/424 331/425
-  -4.787069, -0.937142, -0.249328,
-  -2.22833, -1.385964, -0.249331,
-  -3.589939, -1.624933, -0.249329,
-  // f 330/424 332/426 331/425
-  -3.589939, -1.624933, -0.249329,
-  -2.887922, -1.624933, -0.24933,
-  -2.22833, -1.385964, -0.249331,
-  // f 323/417 327/421 331/425 319/413
-  -4.787069, 1.648471, -0.249328,
-  -4.787069, -0.937142, -0.249328,
-  -2.22833, -1.385964, -0.249331,
-  // f 323/417 327/421 331/425 319/413
-  -4.787069, 1.648471, -0.249328,
-  -2.22833, 2.097501, -0.249332,
-  -2.22833, -1.385964, -0.249331,
-  // f 331/425 333/427 320/414 319/413
-  -2.22833, -1.385964, -0.249331,
-  -1.690792, -0.937142, -0.249332,
-  -1.339679, -0.332127, -0.249332,
-  // f 331/425 333/427 320/414 319/413
-  -2.22833, -1.385964, -0.249331,
-  -2.22833, 2.097501, -0.249332,
-  -1.339679, -0.332127, -0.249332,
-  // f 334/428 317/411 320/414
-  -1.217834, 0.355664, -0.249333,
-  -1.339679, 1.043664, -0.249333,
-  -1.339679, -0.332127, -0.249332,
-  // f 284/378 283/377 335/429 336/430
-  -1.095989, 0.355665, -0.108718,
-  -1.225149, 1.085052, -0.108718,
-  -1.339678, 1.043664, -0.108717,
-  // f 284/378 283/377 335/429 336/430
-  -1.095989, 0.355665, -0.108718,
-  -1.217834, 0.355665, -0.108717,
-  -1.339678, 1.043664, -0.108717,
-  // f 283/377 286/380 337/431 335/429
-  -1.225149, 1.085052, -0.108718,
-  -1.597371, 1.726464, -0.108717,
-  -1.690792, 1.648471, -0.108717,
-  // f 283/377 286/380 337/431 335/429
-  -1.225149, 1.085052, -0.108718,
-  -1.339678, 1.043664, -0.108717,
-  -1.690792, 1.648471, -0.108717,
-  // f 286/380 288/382 338/432 337/431
-  -1.597371, 1.726464, -0.108717,
-  -2.167512, 2.202531, -0.108717,
-  -2.22833, 2.097501, -0.108716,
-  // f 286/380 288/382 338/432 337/431
-  -1.597371, 1.726464, -0.108717,
-  -1.690792, 1.648471, -0.108717,
-  -2.22833, 2.097501, -0.108716,
-  // f 288/382 290/384 339/433 338/432
-  -2.167512, 2.202531, -0.108717,
-  -2.866813, 2.455851, -0.108716,
-  -2.887922, 2.33647, -0.108716,
-  // f 288/382 290/384 339/433 338/432
-  -2.167512, 2.202531, -0.108717,
-  -2.22833, 2.097501, -0.108716,
-  -2.887922, 2.33647, -0.108716,
-  // f 290/384 292/386 340/434 339/433
-  -2.866813, 2.455851, -0.108716,
-  -3.611048, 2.455851, -0.108715,
-  -3.589939, 2.33647, -0.108715,
-  // f 290/384 292/386 340/434 339/433
-  -2.866813, 2.455851, -0.108716,
-  -2.887922, 2.33647, -0.108716,
-  -3.589939, 2.33647, -0.108715,
-  // f 292/386 294/388 341/435 340/434
-  -3.611048, 2.455851, -0.108715,
-  -4.310349, 2.202531, -0.108714,
-  -4.249531, 2.097501, -0.108714,
-  // f 292/386 294/388 341/435 340/434
-  -3.611048, 2.455851, -0.108715,
-  -3.589939, 2.33647, -0.108715,
-  -4.249531, 2.097501, -0.108714,
-  // f 294/388 296/390 342/436 341/435
-  -4.310349, 2.202531, -0.108714,
-  -4.88049, 1.726464, -0.108713,
-  -4.787069, 1.648471, -0.108713,
-  // f 294/388 296/390 342/436 341/435
-  -4.310349, 2.202531, -0.108714,
-  -4.249531, 2.097501, -0.108714,
-  -4.787069, 1.648471, -0.108713,
-  // f 296/390 298/392 343/437 342/436
-  -4.88049, 1.726464, -0.108713,
-  -5.252712, 1.085052, -0.108712,
-  -5.138182, 1.043664, -0.108712,
-  // f 296/390 298/392 343/437 342/436
-  -4.88049, 1.726464, -0.108713,
-  -4.787069, 1.648471, -0.108713,
-  -5.138182, 1.043664, -0.108712,
-  // f 298/392 300/394 344/438 343/437
-  -5.252712, 1.085052, -0.108712,
-  -5.381872, 0.355665, -0.108712,
-  -5.260027, 0.355665, -0.108712,
-  // f 298/392 300/394 344/438 343/437
-  -5.252712, 1.085052, -0.108712,
-  -5.138182, 1.043664, -0.108712,
-  -5.260027, 0.355665, -0.108712,
-  // f 300/394 302/396 345/439 344/438
-  -5.381872, 0.355665, -0.108712,
-  -5.252712, -0.373723, -0.108712,
-  -5.138182, -0.332127, -0.108712,
-  // f 300/394 302/396 345/439 344/438
-  -5.381872, 0.355665, -0.108712,
-  -5.260027, 0.355665, -0.108712,
-  -5.138182, -0.332127, -0.108712,
-  // f 302/396 304/398 346/440 345/439
-  -5.252712, -0.373723, -0.108712,
-  -4.88049, -1.015135, -0.108712,
-  -4.787069, -0.937142, -0.108712,
-  // f 302/396 304/398 346/440 345/439
-  -5.252712, -0.373723, -0.108712,
-  -5.138182, -0.332127, -0.108712,
-  -4.787069, -0.937142, -0.108712,
-  // f 304/398 306/400 347/441 346/440
-  -4.88049, -1.015135, -0.108712,
-  -4.310349, -1.491202, -0.108713,
-  -4.249531, -1.385964, -0.108713,
-  // f 304/398 306/400 347/441 346/440
-  -4.88049, -1.015135, -0.108712,
-  -4.787069, -0.937142, -0.108712,
-  -4.249531, -1.385964, -0.108713,
-  // f 306/400 308/402 348/442 347/441
-  -4.310349, -1.491202, -0.108713,
-  -3.611048, -1.744314, -0.108714,
-  -3.589939, -1.624933, -0.108714,
-  // f 306/400 308/402 348/442 347/441
-  -4.310349, -1.491202, -0.108713,
-  -4.249531, -1.385964, -0.108713,
-  -3.589939, -1.624933, -0.108714,
-  // f 308/402 310/404 349/443 348/442
-  -3.611048, -1.744314, -0.108714,
-  -2.866813, -1.744314, -0.108715,
-  -2.887922, -1.624933, -0.108715,
-  // f 308/402 310/404 349/443 348/442
-  -3.611048, -1.744314, -0.108714,
-  -3.589939, -1.624933, -0.108714,
-  -2.887922, -1.624933, -0.108715,
-  // f 310/404 312/406 350/444 349/443
-  -2.866813, -1.744314, -0.108715,
-  -2.167512, -1.491202, -0.108716,
-  -2.22833, -1.385964, -0.108716,
-  // f 310/404 312/406 350/444 349/443
-  -2.866813, -1.744314, -0.108715,
-  -2.887922, -1.624933, -0.108715,
-  -2.22833, -1.385964, -0.108716,
-  // f 312/406 314/408 351/445 350/444
-  -2.167512, -1.491202, -0.108716,
-  -1.597371, -1.015135, -0.108717,
-  -1.690792, -0.937142, -0.108717,
-  // f 312/406 314/408 351/445 350/444
-  -2.167512, -1.491202, -0.108716,
-  -2.22833, -1.385964, -0.108716,
-  -1.690792, -0.937142, -0.108717,
-  // f 314/408 316/410 352/446 351/445
-  -1.597371, -1.015135, -0.108717,
-  -1.225149, -0.373723, -0.108717,
-  -1.339678, -0.332127, -0.108717,
-  // f 314/408 316/410 352/446 351/445
-  -1.597371, -1.015135, -0.108717,
-  -1.690792, -0.937142, -0.108717,
-  -1.339678, -0.332127, -0.108717,
-  // f 316/410 284/378 336/430 352/446
-  -1.225149, -0.373723, -0.108717,
-  -1.095989, 0.355665, -0.108718,
-  -1.217834, 0.355665, -0.108717,
-  // f 316/410 284/378 336/430 352/446
-  -1.225149, -0.373723, -0.108717,
-  -1.339678, -0.332127, -0.108717,
-  -1.217834, 0.355665, -0.108717,
-  // f 336/430 335/429 317/447 334/448
-  -1.217834, 0.355665, -0.108717,
-  -1.339678, 1.043664, -0.108717,
-  -1.339679, 1.043664, -0.249333,
-  // f 336/430 335/429 317/447 334/448
-  -1.217834, 0.355665, -0.108717,
-  -1.217834, 0.355664, -0.249333,
-  -1.339679, 1.043664, -0.249333,
-  // f 335/429 337/431 318/449 317/447
-  -1.339678, 1.043664, -0.108717,
-  -1.690792, 1.648471, -0.108717,
-  -1.690792, 1.648471, -0.249332,
-  // f 335/429 337/431 318/449 317/447
-  -1.339678, 1.043664, -0.108717,
-  -1.339679, 1.043664, -0.249333,
-  -1.690792, 1.648471, -0.249332,
-  // f 337/431 338/432 319/450 318/449
-  -1.690792, 1.648471, -0.108717,
-  -2.22833, 2.097501, -0.108716,
-  -2.22833, 2.097501, -0.249332,
-  // f 337/431 338/432 319/450 318/449
-  -1.690792, 1.648471, -0.108717,
-  -1.690792, 1.648471, -0.249332,
-  -2.22833, 2.097501, -0.249332,
-  // f 338/432 339/433 321/451 319/450
-  -2.22833, 2.097501, -0.108716,
-  -2.887922, 2.33647, -0.108716,
-  -2.887922, 2.33647, -0.249331,
-  // f 338/432 339/433 321/451 319/450
-  -2.22833, 2.097501, -0.108716,
-  -2.22833, 2.097501, -0.249332,
-  -2.887922, 2.33647, -0.249331,
-  // f 339/433 340/434 322/452 321/451
-  -2.887922, 2.33647, -0.108716,
-  -3.589939, 2.33647, -0.108715,
-  -3.589939, 2.33647, -0.24933,
-  // f 339/433 340/434 322/452 321/451
-  -2.887922, 2.33647, -0.108716,
-  -2.887922, 2.33647, -0.249331,
-  -3.589939, 2.33647, -0.24933,
-  // f 340/434 341/435 324/453 322/452
-  -3.589939, 2.33647, -0.108715,
-  -4.249531, 2.097501, -0.108714,
-  -4.249531, 2.097501, -0.249329,
-  // f 340/434 341/435 324/453 322/452
-  -3.589939, 2.33647, -0.108715,
-  -3.589939, 2.33647, -0.24933,
-  -4.249531, 2.097501, -0.249329,
-  // f 341/435 342/436 323/454 324/453
-  -4.249531, 2.097501, -0.108714,
-  -4.787069, 1.648471, -0.108713,
-  -4.787069, 1.648471, -0.249328,
-  // f 341/435 342/436 323/454 324/453
-  -4.249531, 2.097501, -0.108714,
-  -4.249531, 2.097501, -0.249329,
-  -4.787069, 1.648471, -0.249328,
-  // f 342/436 343/437 325/455 323/454
-  -4.787069, 1.648471, -0.108713,
-  -5.138182, 1.043664, -0.108712,
-  -5.138182, 1.043664, -0.249328,
-  // f 342/436 343/437 325/455 323/454
-  -4.787069, 1.648471, -0.108713,
-  -4.787069, 1.648471, -0.249328,
-  -5.138182, 1.043664, -0.249328,
-  // f 343/437 344/438 326/456 325/455
-  -5.138182, 1.043664, -0.108712,
-  -5.260027, 0.355665, -0.108712,
-  -5.260027, 0.355664, -0.249327,
-  // f 343/437 344/438 326/456 325/455
-  -5.138182, 1.043664, -0.108712,
-  -5.138182, 1.043664, -0.249328,
-  -5.260027, 0.355664, -0.249327,
-  // f 344/438 345/439 328/457 326/456
-  -5.260027, 0.355665, -0.108712,
-  -5.138182, -0.332127, -0.108712,
-  -5.138182, -0.332127, -0.249327,
-  // f 344/438 345/439 328/457 326/456
-  -5.260027, 0.355665, -0.108712,
-  -5.260027, 0.355664, -0.249327,
-  -5.138182, -0.332127, -0.249327,
-  // f 345/439 346/440 327/458 328/457
-  -5.138182, -0.332127, -0.108712,
-  -4.787069, -0.937142, -0.108712,
-  -4.787069, -0.937142, -0.249328,
-  // f 345/439 346/440 327/458 328/457
-  -5.138182, -0.332127, -0.108712,
-  -5.138182, -0.332127, -0.249327,
-  -4.787069, -0.937142, -0.249328,
-  // f 346/440 347/441 329/459 327/458
-  -4.787069, -0.937142, -0.108712,
-  -4.249531, -1.385964, -0.108713,
-  -4.249531, -1.385964, -0.249328,
-  // f 346/440 347/441 329/459 327/458
-  -4.787069, -0.937142, -0.108712,
-  -4.787069, -0.937142, -0.249328,
-  -4.249531, -1.385964, -0.249328,
-  // f 347/441 348/442 330/460 329/459
-  -4.249531, -1.385964, -0.108713,
-  -3.589939, -1.624933, -0.108714,
-  -3.589939, -1.624933, -0.249329,
-  // f 347/441 348/442 330/460 329/459
-  -4.249531, -1.385964, -0.108713,
-  -4.249531, -1.385964, -0.249328,
-  -3.589939, -1.624933, -0.249329,
-  // f 348/442 349/443 332/461 330/460
-  -3.589939, -1.624933, -0.108714,
-  -2.887922, -1.624933, -0.108715,
-  -2.887922, -1.624933, -0.24933,
-  // f 348/442 349/443 332/461 330/460
-  -3.589939, -1.624933, -0.108714,
-  -3.589939, -1.624933, -0.249329,
-  -2.887922, -1.624933, -0.24933,
-  // f 349/443 350/444 331/462 332/461
-  -2.887922, -1.624933, -0.108715,
-  -2.22833, -1.385964, -0.108716,
-  -2.22833, -1.385964, -0.249331,
-  // f 349/443 350/444 331/462 332/461
-  -2.887922, -1.624933, -0.108715,
-  -2.887922, -1.624933, -0.24933,
-  -2.22833, -1.385964, -0.249331,
-  // f 350/444 351/445 333/463 331/462
-  -2.22833, -1.385964, -0.108716,
-  -1.690792, -0.937142, -0.108717,
-  -1.690792, -0.937142, -0.249332,
-  // f 350/444 351/445 333/463 331/462
-  -2.22833, -1.385964, -0.108716,
-  -2.22833, -1.385964, -0.249331,
-  -1.690792, -0.937142, -0.249332,
-  // f 351/445 352/446 320/464 333/463
-  -1.690792, -0.937142, -0.108717,
-  -1.339678, -0.332127, -0.108717,
-  -1.339679, -0.332127, -0.249332,
-  // f 351/445 352/446 320/464 333/463
-  -1.690792, -0.937142, -0.108717,
-  -1.690792, -0.937142, -0.249332,
-  -1.339679, -0.332127, -0.249332,
-  // f 352/446 336/430 334/448 320/464
-  -1.339678, -0.332127, -0.108717,
-  -1.217834, 0.355665, -0.108717,
-  -1.217834, 0.355664, -0.249333,
-  // f 352/446 336/430 334/448 320/464
-  -1.339678, -0.332127, -0.108717,
-  -1.339679, -0.332127, -0.249332,
-  -1.217834, 0.355664, -0.249333,
-  // f 353/465 354/466 355/467 356/468
-  -2.40912, 4.84929, -6.468619,
-  -0.004202, 4.90482, -6.471326,
-  -0.004203, 4.298349, -7.055418,
-  // f 353/465 354/466 355/467 356/468
-  -2.40912, 4.84929, -6.468619,
-  -2.40515, 4.254881, -7.05583,
-  -0.004203, 4.298349, -7.055418,
-  // f 357/469 358/470 356/468 355/467
-  -0.004203, 3.776318, -7.077674,
-  -2.403687, 3.733474, -7.077671,
-  -2.40515, 4.254881, -7.05583,
-  // f 357/469 358/470 356/468 355/467
-  -0.004203, 3.776318, -7.077674,
-  -0.004203, 4.298349, -7.055418,
-  -2.40515, 4.254881, -7.05583,
-  // f 353/465 359/471 360/472 354/466
-  -2.40912, 4.84929, -6.468619,
-  -2.410791, 5.07994, -5.938402,
-  -0.004201, 5.146286, -5.942773,
-  // f 353/465 359/471 360/472 354/466
-  -2.40912, 4.84929, -6.468619,
-  -0.004202, 4.90482, -6.471326,
-  -0.004201, 5.146286, -5.942773,
-  // f 361/473 362/474 363/475 357/469
-  -0.004203, 0.887261, -7.077673,
-  -2.023314, 0.874575, -7.077671,
-  -2.207231, 1.044703, -7.077671,
-  // f 361/473 362/474 363/475 357/469
-  -0.004203, 0.887261, -7.077673,
-  -0.004203, 3.776318, -7.077674,
-  -2.207231, 1.044703, -7.077671,
-  // f 363/475 358/470 357/469
-  -2.207231, 1.044703, -7.077671,
-  -2.403687, 3.733474, -7.077671,
-  -0.004203, 3.776318, -7.077674,
-  // f 364/476 365/477 366/478 367/479
-  -0.004202, 4.188536, -6.794364,
-  -0.004202, 4.671259, -6.311158,
-  -2.403477, 4.614064, -6.311155,
-  // f 364/476 365/477 366/478 367/479
-  -0.004202, 4.188536, -6.794364,
-  -2.403268, 4.145483, -6.794361,
-  -2.403477, 4.614064, -6.311155,
-  // f 367/479 368/480 369/481 364/476
-  -2.403268, 4.145483, -6.794361,
-  -2.403687, 3.733475, -6.794361,
-  -0.004202, 3.776318, -6.794364,
-  // f 367/479 368/480 369/481 364/476
-  -2.403268, 4.145483, -6.794361,
-  -0.004202, 4.188536, -6.794364,
-  -0.004202, 3.776318, -6.794364,
-  // f 370/482 371/483 366/478 365/477
-  -0.004201, 4.887558, -5.827744,
-  -2.403267, 4.819341, -5.82774,
-  -2.403477, 4.614064, -6.311155,
-  // f 370/482 371/483 366/478 365/477
-  -0.004201, 4.887558, -5.827744,
-  -0.004202, 4.671259, -6.311158,
-  -2.403477, 4.614064, -6.311155,
-  // f 372/484 373/485 374/486 369/481
-  -2.20723, 1.044703, -6.794361,
-  -2.023314, 0.874575, -6.794361,
-  -0.004202, 0.887261, -6.794364,
-  // f 372/484 373/485 374/486 369/481
-  -2.20723, 1.044703, -6.794361,
-  -0.004202, 3.776318, -6.794364,
-  -0.004202, 0.887261, -6.794364,
-  // f 369/481 368/480 372/484
-  -0.004202, 3.776318, -6.794364,
-  -2.403687, 3.733475, -6.794361,
-  -2.20723, 1.044703, -6.794361,
-  // f 367/487 366/488 353/465 356/468
-  -2.403268, 4.145483, -6.794361,
-  -2.403477, 4.614064, -6.311155,
-  -2.40912, 4.84929, -6.468619,
-  // f 367/487 366/488 353/465 356/468
-  -2.403268, 4.145483, -6.794361,
-  -2.40515, 4.254881, -7.05583,
-  -2.40912, 4.84929, -6.468619,
-  // f 368/489 367/487 356/468 358/470
-  -2.403687, 3.733475, -6.794361,
-  -2.403268, 4.145483, -6.794361,
-  -2.40515, 4.254881, -7.05583,
-  // f 368/489 367/487 356/468 358/470
-  -2.403687, 3.733475, -6.794361,
-  -2.403687, 3.733474, -7.077671,
-  -2.40515, 4.254881, -7.05583,
-  // f 366/488 371/490 359/471 353/465
-  -2.403477, 4.614064, -6.311155,
-  -2.403267, 4.819341, -5.82774,
-  -2.410791, 5.07994, -5.938402,
-  // f 366/488 371/490 359/471 353/465
-  -2.403477, 4.614064, -6.311155,
-  -2.40912, 4.84929, -6.468619,
-  -2.410791, 5.07994, -5.938402,
-  // f 371/490 370/491 360/472 359/471
-  -2.403267, 4.819341, -5.82774,
-  -0.004201, 4.887558, -5.827744,
-  -0.004201, 5.146286, -5.942773,
-  // f 371/490 370/491 360/472 359/471
-  -2.403267, 4.819341, -5.82774,
-  -2.410791, 5.07994, -5.938402,
-  -0.004201, 5.146286, -5.942773,
-  // f 374/492 373/493 362/474 361/473
-  -0.004202, 0.887261, -6.794364,
-  -2.023314, 0.874575, -6.794361,
-  -2.023314, 0.874575, -7.077671,
-  // f 374/492 373/493 362/474 361/473
-  -0.004202, 0.887261, -6.794364,
-  -0.004203, 0.887261, -7.077673,
-  -2.023314, 0.874575, -7.077671,
-  // f 373/493 372/494 363/475 362/474
-  -2.023314, 0.874575, -6.794361,
-  -2.20723, 1.044703, -6.794361,
-  -2.207231, 1.044703, -7.077671,
-  // f 373/493 372/494 363/475 362/474
-  -2.023314, 0.874575, -6.794361,
-  -2.023314, 0.874575, -7.077671,
-  -2.207231, 1.044703, -7.077671,
-  // f 372/494 368/489 358/470 363/475
-  -2.20723, 1.044703, -6.794361,
-  -2.403687, 3.733475, -6.794361,
-  -2.403687, 3.733474, -7.077671,
-  // f 372/494 368/489 358/470 363/475
-  -2.20723, 1.044703, -6.794361,
-  -2.207231, 1.044703, -7.077671,
-  -2.403687, 3.733474, -7.077671,
-  // f 375/495 376/496 377/497 378/498
-  -1.219306, 3.942079, -6.857598,
-  -1.076979, 3.754064, -6.699927,
-  -1.144484, 4.263824, -6.227744,
-  // f 375/495 376/496 377/497 378/498
-  -1.219306, 3.942079, -6.857598,
-  -1.354108, 4.540646, -6.460091,
-  -1.144484, 4.263824, -6.227744,
-  // f 379/499 380/500 381/501 382/502
-  -0.650209, 3.942079, -6.857599,
-  -0.515406, 4.540646, -6.460093,
-  -0.725029, 4.263824, -6.227745,
-  // f 379/499 380/500 381/501 382/502
-  -0.650209, 3.942079, -6.857599,
-  -0.792536, 3.754064, -6.699928,
-  -0.725029, 4.263824, -6.227745,
-  // f 383/503 384/504 380/500 379/499
-  -0.792536, 4.129885, -7.01527,
-  -0.72503, 4.817468, -6.692439,
-  -0.515406, 4.540646, -6.460093,
-  // f 383/503 384/504 380/500 379/499
-  -0.792536, 4.129885, -7.01527,
-  -0.650209, 3.942079, -6.857599,
-  -0.515406, 4.540646, -6.460093,
-  // f 385/505 386/506 384/504 383/503
-  -1.07698, 4.129885, -7.01527,
-  -1.144485, 4.817468, -6.692439,
-  -0.72503, 4.817468, -6.692439,
-  // f 385/505 386/506 384/504 383/503
-  -1.07698, 4.129885, -7.01527,
-  -0.792536, 4.129885, -7.01527,
-  -0.72503, 4.817468, -6.692439,
-  // f 385/505 375/495 378/498 386/506
-  -1.07698, 4.129885, -7.01527,
-  -1.219306, 3.942079, -6.857598,
-  -1.354108, 4.540646, -6.460091,
-  // f 385/505 375/495 378/498 386/506
-  -1.07698, 4.129885, -7.01527,
-  -1.144485, 4.817468, -6.692439,
-  -1.354108, 4.540646, -6.460091,
-  // f 387/507 388/508 389/509 390/510
-  -1.122539, 4.89151, -5.854575,
-  -0.747182, 4.89151, -5.854575,
-  -0.559295, 5.139422, -6.062586,
-  // f 387/507 388/508 389/509 390/510
-  -1.122539, 4.89151, -5.854575,
-  -1.12254, 5.387127, -6.270595,
-  -0.559295, 5.139422, -6.062586,
-  // f 389/509 391/511 390/510
-  -0.559295, 5.139422, -6.062586,
-  -0.747183, 5.387127, -6.270596,
-  -1.12254, 5.387127, -6.270595,
-  // f 392/512 387/507 390/510
-  -1.310218, 5.139422, -6.062585,
-  -1.122539, 4.89151, -5.854575,
-  -1.12254, 5.387127, -6.270595,
-  // f 387/513 392/514 378/498 377/497
-  -1.122539, 4.89151, -5.854575,
-  -1.310218, 5.139422, -6.062585,
-  -1.354108, 4.540646, -6.460091,
-  // f 387/513 392/514 378/498 377/497
-  -1.122539, 4.89151, -5.854575,
-  -1.144484, 4.263824, -6.227744,
-  -1.354108, 4.540646, -6.460091,
-  // f 388/508 387/507 377/515 381/516
-  -0.747182, 4.89151, -5.854575,
-  -1.122539, 4.89151, -5.854575,
-  -1.144484, 4.263824, -6.227744,
-  // f 388/508 387/507 377/515 381/516
-  -0.747182, 4.89151, -5.854575,
-  -0.725029, 4.263824, -6.227745,
-  -1.144484, 4.263824, -6.227744,
-  // f 380/500 389/517 388/518 381/501
-  -0.515406, 4.540646, -6.460093,
-  -0.559295, 5.139422, -6.062586,
-  -0.747182, 4.89151, -5.854575,
-  // f 380/500 389/517 388/518 381/501
-  -0.515406, 4.540646, -6.460093,
-  -0.725029, 4.263824, -6.227745,
-  -0.747182, 4.89151, -5.854575,
-  // f 384/504 391/519 389/517 380/500
-  -0.72503, 4.817468, -6.692439,
-  -0.747183, 5.387127, -6.270596,
-  -0.559295, 5.139422, -6.062586,
-  // f 384/504 391/519 389/517 380/500
-  -0.72503, 4.817468, -6.692439,
-  -0.515406, 4.540646, -6.460093,
-  -0.559295, 5.139422, -6.062586,
-  // f 390/520 391/519 384/504 386/506
-  -1.12254, 5.387127, -6.270595,
-  -0.747183, 5.387127, -6.270596,
-  -0.72503, 4.817468, -6.692439,
-  // f 390/520 391/519 384/504 386/506
-  -1.12254, 5.387127, -6.270595,
-  -1.144485, 4.817468, -6.692439,
-  -0.72503, 4.817468, -6.692439,
-  // f 392/514 390/520 386/506 378/498
-  -1.310218, 5.139422, -6.062585,
-  -1.12254, 5.387127, -6.270595,
-  -1.144485, 4.817468, -6.692439,
-  // f 392/514 390/520 386/506 378/498
-  -1.310218, 5.139422, -6.062585,
-  -1.354108, 4.540646, -6.460091,
-  -1.144485, 4.817468, -6.692439,
-  // f 277/71 48/373 273/521 393/77
-  -1.27949, 3.658186, -2.202962,
-  -1.229748, 3.582065, -1.126926,
-  -0.004195, 3.644876, -1.447888,
-  // f 277/71 48/373 273/521 393/77
-  -1.27949, 3.658186, -2.202962,
-  -0.004196, 3.658394, -2.284711,
-  -0.004195, 3.644876, -1.447888,
-  // f 47/127 278/374 394/522 272/367
-  -1.275518, 3.440639, -1.126094,
-  -1.275518, 3.015735, -1.095725,
-  -0.004195, 3.016151, -1.388605,
-  // f 47/127 278/374 394/522 272/367
-  -1.275518, 3.440639, -1.126094,
-  -0.004195, 3.441055, -1.449135,
-  -0.004195, 3.016151, -1.388605,
-  // f 394/522 278/374 45/125 271/366
-  -0.004195, 3.016151, -1.388605,
-  -1.275518, 3.015735, -1.095725,
-  -1.579191, 2.522821, -2.580291,
-  // f 394/522 278/374 45/125 271/366
-  -0.004195, 3.016151, -1.388605,
-  -0.004197, 2.523028, -2.731308,
-  -1.579191, 2.522821, -2.580291,
-  // f 121/203 120/202 395/523 396/524
-  -2.418097, 4.310621, 0.974598,
-  -2.399705, 2.808586, 0.971479,
-  -0.004193, 2.767406, 0.35535,
-  // f 121/203 120/202 395/523 396/524
-  -2.418097, 4.310621, 0.974598,
-  -0.004193, 4.329755, 0.259041,
-  -0.004193, 2.767406, 0.35535,
-  // f 395/525 120/245 135/217 138/220
-  -0.004193, 2.767406, 0.35535,
-  -2.399705, 2.808586, 0.971479,
-  -2.571294, 2.785501, -1.13691,
-  // f 395/525 120/245 135/217 138/220
-  -0.004193, 2.767406, 0.35535,
-  -0.004195, 2.715619, -1.560421,
-  -2.571294, 2.785501, -1.13691,
-  // f 157/242 121/203 396/524 154/239
-  -2.436489, 4.518186, 0.826495,
-  -2.418097, 4.310621, 0.974598,
-  -0.004193, 4.329755, 0.259041,
-  // f 157/242 121/203 396/524 154/239
-  -2.436489, 4.518186, 0.826495,
-  -0.004193, 4.528585, 0.089097,
-  -0.004193, 4.329755, 0.259041,
-  // f 167/266 170/269 397/526 398/527
-  -2.660957, 3.435647, -3.948994,
-  -2.660954, 3.432319, -1.770924,
-  -0.004196, 3.415889, -1.770927,
-  // f 167/266 170/269 397/526 398/527
-  -2.660957, 3.435647, -3.948994,
-  -0.004199, 3.419216, -3.948998,
-  -0.004196, 3.415889, -1.770927,
-  // f 191/290 189/288 187/286 183/282
-  -0.724817, -1.719981, -3.959605,
-  -1.635413, -2.35245, -3.960851,
-  -2.660957, -2.723903, -3.961682,
-  // f 191/290 189/288 187/286 183/282
-  -0.724817, -1.719981, -3.959605,
-  -4.777878, -2.35245, -3.960847,
-  -2.660957, -2.723903, -3.961682,
-  // f 187/286 185/284 183/282
-  -2.660957, -2.723903, -3.961682,
-  -3.752334, -2.723903, -3.961681,
-  -4.777878, -2.35245, -3.960847,
-  // f 183/282 181/280 179/278 175/274
-  -4.777878, -2.35245, -3.960847,
-  -5.614071, -1.654259, -3.95939,
-  -6.15976, -0.713772, -3.957518,
-  // f 183/282 181/280 179/278 175/274
-  -4.777878, -2.35245, -3.960847,
-  -6.15976, 1.425515, -3.95315,
-  -6.15976, -0.713772, -3.957518,
-  // f 179/278 177/276 175/274
-  -6.15976, -0.713772, -3.957518,
-  -6.349111, 0.355872, -3.95523,
-  -6.15976, 1.425515, -3.95315,
-  // f 175/274 173/272 171/270 167/266
-  -6.15976, 1.425515, -3.95315,
-  -5.614071, 2.366003, -3.951071,
-  -4.777878, 3.064193, -3.949616,
-  // f 175/274 173/272 171/270 167/266
-  -6.15976, 1.425515, -3.95315,
-  -2.660957, 3.435647, -3.948994,
-  -4.777878, 3.064193, -3.949616,
-  // f 171/270 168/267 167/266
-  -4.777878, 3.064193, -3.949616,
-  -3.752334, 3.435647, -3.948993,
-  -2.660957, 3.435647, -3.948994,
-  // f 183/282 175/274 167/266 191/290
-  -4.777878, -2.35245, -3.960847,
-  -6.15976, 1.425515, -3.95315,
-  -2.660957, 3.435647, -3.948994,
-  // f 183/282 175/274 167/266 191/290
-  -4.777878, -2.35245, -3.960847,
-  -0.724817, -1.719981, -3.959605,
-  -2.660957, 3.435647, -3.948994,
-  // f 191/290 167/266 398/527 193/292
-  -0.724817, -1.719981, -3.959605,
-  -2.660957, 3.435647, -3.948994,
-  -0.004199, 3.419216, -3.948998,
-  // f 191/290 167/266 398/527 193/292
-  -0.724817, -1.719981, -3.959605,
-  -0.004199, -1.080025, -3.958358,
-  -0.004199, 3.419216, -3.948998,
-  // f 229/528 228/529 399/530 400/531
-  -1.050012, 1.133719, -1.775709,
-  -0.911657, 0.352545, -1.777374,
-  -0.004196, 0.352545, -1.777375,
-  // f 229/528 228/529 399/530 400/531
-  -1.050012, 1.133719, -1.775709,
-  -0.004196, 1.39931, -1.775087,
-  -0.004196, 0.352545, -1.777375,
-  // f 230/532 229/528 400/531 401/533
-  -1.448568, 1.820471, -1.774253,
-  -1.050012, 1.133719, -1.775709,
-  -0.004196, 1.39931, -1.775087,
-  // f 230/532 229/528 400/531 401/533
-  -1.448568, 1.820471, -1.774253,
-  -0.004196, 2.327943, -1.773214,
-  -0.004196, 1.39931, -1.775087,
-  // f 231/534 230/532 401/533 402/535
-  -2.059045, 2.330439, -1.773212,
-  -1.448568, 1.820471, -1.774253,
-  -0.004196, 2.327943, -1.773214,
-  // f 231/534 230/532 401/533 402/535
-  -2.059045, 2.330439, -1.773212,
-  -0.004196, 3.360774, -1.771134,
-  -0.004196, 2.327943, -1.773214,
-  // f 170/269 214/313 231/534 402/535
-  -2.660954, 3.432319, -1.770924,
-  -2.808087, 2.601645, -1.772587,
-  -2.059045, 2.330439, -1.773212,
-  // f 170/269 214/313 231/534 402/535
-  -2.660954, 3.432319, -1.770924,
-  -0.004196, 3.360774, -1.771134,
-  -2.059045, 2.330439, -1.773212,
-  // f 397/526 170/269 402/535
-  -0.004196, 3.415889, -1.770927,
-  -2.660954, 3.432319, -1.770924,
-  -0.004196, 3.360774, -1.771134,
-  // f 399/530 228/529 227/326 226/325
-  -0.004196, 0.352545, -1.777375,
-  -0.911657, 0.352545, -1.777374,
-  -1.050012, -0.42863, -1.779037,
-  // f 399/530 228/529 227/326 226/325
-  -0.004196, 0.352545, -1.777375,
-  -0.004196, -0.989553, -1.780079,
-  -1.050012, -0.42863, -1.779037,
-  // f 404/536 234/352 233/537
-  -0.004197, 4.792511, -2.350234,
-  -1.415965, 4.9173, -2.350025,
-  -0.004197, 5.040009, -2.349818,
-  // f 405/81 406/84 407/83 408/82
-  7.853647, 2.123707, 3.899827,
-  7.651129, 2.62286, 3.659369,
-  7.66952, -2.709135, 3.509602,
-  // f 405/81 406/84 407/83 408/82
-  7.853647, 2.123707, 3.899827,
-  7.854692, -2.207694, 3.839921,
-  7.66952, -2.709135, 3.509602,
-  // f 409/85 410/88 411/87 412/86
-  5.115376, -3.654823, 0.714994,
-  5.310578, -3.406494, 0.739122,
-  2.607002, -3.404206, -1.258393,
-  // f 409/85 410/88 411/87 412/86
-  5.115376, -3.654823, 0.714994,
-  2.507729, -3.650455, -1.260681,
-  2.607002, -3.404206, -1.258393,
-  // f 413/89 414/92 415/91 416/90
-  8.209555, 3.443966, -5.569406,
-  8.131398, 3.437104, 0.391117,
-  8.286055, 2.635962, 0.397565,
-  // f 413/89 414/92 415/91 416/90
-  8.209555, 3.443966, -5.569406,
-  8.399741, 2.645529, -5.569406,
-  8.286055, 2.635962, 0.397565,
-  // f 416/90 415/91 417/94 418/93
-  8.399741, 2.645529, -5.569406,
-  8.286055, 2.635962, 0.397565,
-  8.286263, -2.687714, 0.386957,
-  // f 416/90 415/91 417/94 418/93
-  8.399741, 2.645529, -5.569406,
-  8.399741, -2.685843, -5.569406,
-  8.286263, -2.687714, 0.386957,
-  // f 418/93 417/94 419/96 420/95
-  8.399741, -2.685843, -5.569406,
-  8.286263, -2.687714, 0.386957,
-  8.158567, -3.404414, 0.377805,
-  // f 418/93 417/94 419/96 420/95
-  8.399741, -2.685843, -5.569406,
-  8.242993, -3.400255, -5.569405,
-  8.158567, -3.404414, 0.377805,
-  // f 420/95 419/96 421/98 422/97
-  8.242993, -3.400255, -5.569405,
-  8.158567, -3.404414, 0.377805,
-  7.903174, -3.776491, 0.312699,
-  // f 420/95 419/96 421/98 422/97
-  8.242993, -3.400255, -5.569405,
-  7.938695, -3.773165, -5.569405,
-  7.903174, -3.776491, 0.312699,
-  // f 423/99 424/102 425/101 426/100
-  2.605324, -3.773165, -5.573349,
-  5.271905, -3.773165, -5.573353,
-  5.271911, -3.776075, -1.236972,
-  // f 423/99 424/102 425/101 426/100
-  2.605324, -3.773165, -5.573349,
-  2.605329, -3.77462, -2.123298,
-  5.271911, -3.776075, -1.236972,
-  // f 427/103 428/104 414/92 413/89
-  7.928663, 3.786301, -5.569406,
-  7.895023, 3.779647, 0.328714,
-  8.131398, 3.437104, 0.391117,
-  // f 427/103 428/104 414/92 413/89
-  7.928663, 3.786301, -5.569406,
-  8.209555, 3.443966, -5.569406,
-  8.131398, 3.437104, 0.391117,
-  // f 429/105 430/108 431/107 432/106
-  6.250848, 2.521989, -2.028451,
-  3.203475, 2.522613, -2.423666,
-  3.214134, -3.317479, -2.432817,
-  // f 429/105 430/108 431/107 432/106
-  6.250848, 2.521989, -2.028451,
-  6.261088, -2.47703, -2.035731,
-  3.214134, -3.317479, -2.432817,
-  // f 433/109 434/112 435/111 436/110
-  5.108479, 3.389892, 0.729761,
-  2.504385, 3.516344, -0.790995,
-  2.595926, 3.440015, -0.788707,
-  // f 433/109 434/112 435/111 436/110
-  5.108479, 3.389892, 0.729761,
-  5.288215, 3.437728, 0.753265,
-  2.595926, 3.440015, -0.788707,
-  // f 437/113 438/116 439/115 440/114
-  5.265217, 3.786301, -5.569402,
-  2.60198, 3.786301, -5.569399,
-  2.601985, 3.785054, -2.107491,
-  // f 437/113 438/116 439/115 440/114
-  5.265217, 3.786301, -5.569402,
-  5.265223, 3.783598, -1.221164,
-  2.601985, 3.785054, -2.107491,
-  // f 412/86 411/87 441/118 442/117
-  2.507729, -3.650455, -1.260681,
-  2.607002, -3.404206, -1.258393,
-  2.339904, -3.6047, -2.161987,
-  // f 412/86 411/87 441/118 442/117
-  2.507729, -3.650455, -1.260681,
-  2.290163, -3.780859, -2.163028,
-  2.339904, -3.6047, -2.161987,
-  // f 410/88 409/85 443/119 407/83
-  5.310578, -3.406494, 0.739122,
-  5.115376, -3.654823, 0.714994,
-  7.417262, -3.095771, 3.177203,
-  // f 410/88 409/85 443/119 407/83
-  5.310578, -3.406494, 0.739122,
-  7.66952, -2.709135, 3.509602,
-  7.417262, -3.095771, 3.177203,
-  // f 423/99 426/100 444/121 445/120
-  2.605324, -3.773165, -5.573349,
-  2.605329, -3.77462, -2.123298,
-  1.271932, -3.870083, -3.45872,
-  // f 423/99 426/100 444/121 445/120
-  2.605324, -3.773165, -5.573349,
-  1.271929, -3.869043, -5.57314,
-  1.271932, -3.870083, -3.45872,
-  // f 421/98 425/101 424/102 422/97
-  7.903174, -3.776491, 0.312699,
-  5.271911, -3.776075, -1.236972,
-  5.271905, -3.773165, -5.573353,
-  // f 421/98 425/101 424/102 422/97
-  7.903174, -3.776491, 0.312699,
-  7.938695, -3.773165, -5.569405,
-  5.271905, -3.773165, -5.573353,
-  // f 446/122 429/105 432/106 447/123
-  6.977114, 2.660712, 1.723422,
-  6.250848, 2.521989, -2.028451,
-  6.261088, -2.47703, -2.035731,
-  // f 446/122 429/105 432/106 447/123
-  6.977114, 2.660712, 1.723422,
-  6.986519, -2.629894, 1.709486,
-  6.261088, -2.47703, -2.035731,
-  // f 431/107 430/108 448/125 449/124
-  3.214134, -3.317479, -2.432817,
-  3.203475, 2.522613, -2.423666,
-  1.571007, 2.522821, -2.580295,
-  // f 431/107 430/108 448/125 449/124
-  3.214134, -3.317479, -2.432817,
-  1.576231, -3.333493, -3.248838,
-  1.571007, 2.522821, -2.580295,
-  // f 450/126 433/109 436/110 406/84
-  7.420188, 2.951885, 3.370027,
-  5.108479, 3.389892, 0.729761,
-  5.288215, 3.437728, 0.753265,
-  // f 450/126 433/109 436/110 406/84
-  7.420188, 2.951885, 3.370027,
-  7.651129, 2.62286, 3.659369,
-  5.288215, 3.437728, 0.753265,
-  // f 451/127 435/111 434/112 452/128
-  1.267128, 3.440639, -1.126098,
-  2.595926, 3.440015, -0.788707,
-  2.504385, 3.516344, -0.790995,
-  // f 451/127 435/111 434/112 452/128
-  1.267128, 3.440639, -1.126098,
-  1.221358, 3.582065, -1.12693,
-  2.504385, 3.516344, -0.790995,
-  // f 427/103 437/113 440/114 428/104
-  7.928663, 3.786301, -5.569406,
-  5.265217, 3.786301, -5.569402,
-  5.265223, 3.783598, -1.221164,
-  // f 427/103 437/113 440/114 428/104
-  7.928663, 3.786301, -5.569406,
-  7.895023, 3.779647, 0.328714,
-  5.265223, 3.783598, -1.221164,
-  // f 453/129 439/115 438/116 454/130
-  1.270262, 3.785054, -2.196725,
-  2.601985, 3.785054, -2.107491,
-  2.60198, 3.786301, -5.569399,
-  // f 453/129 439/115 438/116 454/130
-  1.270262, 3.785054, -2.196725,
-  1.270257, 3.786301, -5.569397,
-  2.60198, 3.786301, -5.569399,
-  // f 455/131 456/134 457/133 458/132
-  8.15752, 0.03995, -1.036039,
-  8.445517, 0.03995, -1.087625,
-  8.445517, 0.437193, -1.189134,
-  // f 455/131 456/134 457/133 458/132
-  8.15752, 0.03995, -1.036039,
-  8.15752, 0.464022, -1.144204,
-  8.445517, 0.437193, -1.189134,
-  // f 458/132 457/133 459/136 460/135
-  8.15752, 0.464022, -1.144204,
-  8.445517, 0.437193, -1.189134,
-  8.445516, 0.728365, -1.467451,
-  // f 458/132 457/133 459/136 460/135
-  8.15752, 0.464022, -1.144204,
-  8.157519, 0.774953, -1.441657,
-  8.445516, 0.728365, -1.467451,
-  // f 460/135 459/136 461/138 462/137
-  8.157519, 0.774953, -1.441657,
-  8.445516, 0.728365, -1.467451,
-  8.445516, 0.835475, -1.848525,
-  // f 460/135 459/136 461/138 462/137
-  8.157519, 0.774953, -1.441657,
-  8.157519, 0.889134, -1.848317,
-  8.445516, 0.835475, -1.848525,
-  // f 462/137 461/138 463/140 464/139
-  8.157519, 0.889134, -1.848317,
-  8.445516, 0.835475, -1.848525,
-  8.445515, 0.729613, -2.230016,
-  // f 462/137 461/138 463/140 464/139
-  8.157519, 0.889134, -1.848317,
-  8.157518, 0.776201, -2.2556,
-  8.445515, 0.729613, -2.230016,
-  // f 464/139 463/140 465/142 466/141
-  8.157518, 0.776201, -2.2556,
-  8.445515, 0.729613, -2.230016,
-  8.445515, 0.439272, -2.50958,
-  // f 464/139 463/140 465/142 466/141
-  8.157518, 0.776201, -2.2556,
-  8.157518, 0.46631, -2.554302,
-  8.445515, 0.439272, -2.50958,
-  // f 466/141 465/142 467/144 468/143
-  8.157518, 0.46631, -2.554302,
-  8.445515, 0.439272, -2.50958,
-  8.445515, 0.042238, -2.612545,
-  // f 466/141 465/142 467/144 468/143
-  8.157518, 0.46631, -2.554302,
-  8.157517, 0.042446, -2.664339,
-  8.445515, 0.042238, -2.612545,
-  // f 468/143 467/144 469/146 470/145
-  8.157517, 0.042446, -2.664339,
-  8.445515, 0.042238, -2.612545,
-  8.445515, -0.355005, -2.511245,
-  // f 468/143 467/144 469/146 470/145
-  8.157517, 0.042446, -2.664339,
-  8.157518, -0.381835, -2.555967,
-  8.445515, -0.355005, -2.511245,
-  // f 470/145 469/146 471/148 472/147
-  8.157518, -0.381835, -2.555967,
-  8.445515, -0.355005, -2.511245,
-  8.445515, -0.646178, -2.232719,
-  // f 470/145 469/146 471/148 472/147
-  8.157518, -0.381835, -2.555967,
-  8.157518, -0.692557, -2.258721,
-  8.445515, -0.646178, -2.232719,
-  // f 472/147 471/148 473/150 474/149
-  8.157518, -0.692557, -2.258721,
-  8.445515, -0.646178, -2.232719,
-  8.445516, -0.75308, -1.851853,
-  // f 472/147 471/148 473/150 474/149
-  8.157518, -0.692557, -2.258721,
-  8.157519, -0.806946, -1.851853,
-  8.445516, -0.75308, -1.851853,
-  // f 474/149 473/150 475/152 476/151
-  8.157519, -0.806946, -1.851853,
-  8.445516, -0.75308, -1.851853,
-  8.445516, -0.647217, -1.470363,
-  // f 474/149 473/150 475/152 476/151
-  8.157519, -0.806946, -1.851853,
-  8.157519, -0.693805, -1.444569,
-  8.445516, -0.647217, -1.470363,
-  // f 476/151 475/152 477/154 478/153
-  8.157519, -0.693805, -1.444569,
-  8.445516, -0.647217, -1.470363,
-  8.445517, -0.357085, -1.19059,
-  // f 476/151 475/152 477/154 478/153
-  8.157519, -0.693805, -1.444569,
-  8.15752, -0.383914, -1.146075,
-  8.445517, -0.357085, -1.19059,
-  // f 478/153 477/154 456/134 455/131
-  8.15752, -0.383914, -1.146075,
-  8.445517, -0.357085, -1.19059,
-  8.445517, 0.03995, -1.087625,
-  // f 478/153 477/154 456/134 455/131
-  8.15752, -0.383914, -1.146075,
-  8.15752, 0.03995, -1.036039,
-  8.445517, 0.03995, -1.087625,
-  // f 477/154 475/152 473/150 469/146
-  8.445517, -0.357085, -1.19059,
-  8.445516, -0.647217, -1.470363,
-  8.445516, -0.75308, -1.851853,
-  // f 477/154 475/152 473/150 469/146
-  8.445517, -0.357085, -1.19059,
-  8.445515, -0.355005, -2.511245,
-  8.445516, -0.75308, -1.851853,
-  // f 473/150 471/148 469/146
-  8.445516, -0.75308, -1.851853,
-  8.445515, -0.646178, -2.232719,
-  8.445515, -0.355005, -2.511245,
-  // f 469/146 467/144 465/142 461/138
-  8.445515, -0.355005, -2.511245,
-  8.445515, 0.042238, -2.612545,
-  8.445515, 0.439272, -2.50958,
-  // f 469/146 467/144 465/142 461/138
-  8.445515, -0.355005, -2.511245,
-  8.445516, 0.835475, -1.848525,
-  8.445515, 0.439272, -2.50958,
-  // f 465/142 463/140 461/138
-  8.445515, 0.439272, -2.50958,
-  8.445515, 0.729613, -2.230016,
-  8.445516, 0.835475, -1.848525,
-  // f 477/154 469/146 461/138 457/133
-  8.445517, -0.357085, -1.19059,
-  8.445515, -0.355005, -2.511245,
-  8.445516, 0.835475, -1.848525,
-  // f 477/154 469/146 461/138 457/133
-  8.445517, -0.357085, -1.19059,
-  8.445517, 0.437193, -1.189134,
-  8.445516, 0.835475, -1.848525,
-  // f 461/138 459/136 457/133
-  8.445516, 0.835475, -1.848525,
-  8.445516, 0.728365, -1.467451,
-  8.445517, 0.437193, -1.189134,
-  // f 456/134 477/154 457/133
-  8.445517, 0.03995, -1.087625,
-  8.445517, -0.357085, -1.19059,
-  8.445517, 0.437193, -1.189134,
-  // f 490/155 491/158 492/157 493/156
-  7.751235, 1.885153, 1.53226,
-  7.750608, 1.801129, 1.568453,
-  7.750398, 2.071088, 0.396109,
-  // f 490/155 491/158 492/157 493/156
-  7.751235, 1.885153, 1.53226,
-  7.750607, 2.429646, 0.397982,
-  7.750398, 2.071088, 0.396109,
-  // f 492/157 491/158 494/160 495/159
-  7.750398, 2.071088, 0.396109,
-  7.750608, 1.801129, 1.568453,
-  7.7504, -1.814611, 1.559926,
-  // f 492/157 491/158 494/160 495/159
-  7.750398, 2.071088, 0.396109,
-  7.750189, -1.910907, 0.388206,
-  7.7504, -1.814611, 1.559926,
-  // f 494/160 496/162 497/161 495/159
-  7.7504, -1.814611, 1.559926,
-  7.751026, -1.845184, 1.55431,
-  7.750398, -2.289223, 0.390286,
-  // f 494/160 496/162 497/161 495/159
-  7.7504, -1.814611, 1.559926,
-  7.750189, -1.910907, 0.388206,
-  7.750398, -2.289223, 0.390286,
-  // f 482/12 407/164 443/163 483/11
-  8.063474, -3.344308, 0.360956,
-  7.66952, -2.709135, 3.509602,
-  7.417262, -3.095771, 3.177203,
-  // f 482/12 407/164 443/163 483/11
-  8.063474, -3.344308, 0.360956,
-  7.87078, -3.653575, 0.281081,
-  7.417262, -3.095771, 3.177203,
-  // f 483/11 443/163 409/165 484/14
-  7.87078, -3.653575, 0.281081,
-  7.417262, -3.095771, 3.177203,
-  5.115376, -3.654823, 0.714994,
-  // f 483/11 443/163 409/165 484/14
-  7.87078, -3.653575, 0.281081,
-  5.280062, -3.651287, -1.258813,
-  5.115376, -3.654823, 0.714994,
-  // f 484/14 409/165 412/166 485/16
-  5.280062, -3.651287, -1.258813,
-  5.115376, -3.654823, 0.714994,
-  2.507729, -3.650455, -1.260681,
-  // f 484/14 409/165 412/166 485/16
-  5.280062, -3.651287, -1.258813,
-  2.607209, -3.647752, -2.587368,
-  2.507729, -3.650455, -1.260681,
-  // f 485/16 412/166 442/167 486/17
-  2.607209, -3.647752, -2.587368,
-  2.507729, -3.650455, -1.260681,
-  2.290163, -3.780859, -2.163028,
-  // f 485/16 412/166 442/167 486/17
-  2.607209, -3.647752, -2.587368,
-  1.272977, -3.779196, -3.104479,
-  2.290163, -3.780859, -2.163028,
-  // f 487/22 434/169 433/168 488/21
-  2.603866, 3.658186, -2.117475,
-  2.504385, 3.516344, -0.790995,
-  5.108479, 3.389892, 0.729761,
-  // f 487/22 434/169 433/168 488/21
-  2.603866, 3.658186, -2.117475,
-  5.273165, 3.659019, -1.243421,
-  5.108479, 3.389892, 0.729761,
-  // f 488/21 433/168 450/170 489/24
-  5.273165, 3.659019, -1.243421,
-  5.108479, 3.389892, 0.729761,
-  7.420188, 2.951885, 3.370027,
-  // f 488/21 433/168 450/170 489/24
-  5.273165, 3.659019, -1.243421,
-  7.862838, 3.655899, 0.297305,
-  7.420188, 2.951885, 3.370027,
-  // f 489/24 450/170 406/171 479/26
-  7.862838, 3.655899, 0.297305,
-  7.420188, 2.951885, 3.370027,
-  7.651129, 2.62286, 3.659369,
-  // f 489/24 450/170 406/171 479/26
-  7.862838, 3.655899, 0.297305,
-  8.03714, 3.375333, 0.37614,
-  7.651129, 2.62286, 3.659369,
-  // f 406/84 498/173 499/172 407/83
-  7.651129, 2.62286, 3.659369,
-  7.374418, 2.395122, 3.401645,
-  7.389048, -2.443752, 3.311785,
-  // f 406/84 498/173 499/172 407/83
-  7.651129, 2.62286, 3.659369,
-  7.66952, -2.709135, 3.509602,
-  7.389048, -2.443752, 3.311785,
-  // f 407/83 499/172 500/174 410/88
-  7.66952, -2.709135, 3.509602,
-  7.389048, -2.443752, 3.311785,
-  5.308488, -2.981798, 0.738498,
-  // f 407/83 499/172 500/174 410/88
-  7.66952, -2.709135, 3.509602,
-  5.310578, -3.406494, 0.739122,
-  5.308488, -2.981798, 0.738498,
-  // f 410/88 500/174 501/175 411/87
-  5.310578, -3.406494, 0.739122,
-  5.308488, -2.981798, 0.738498,
-  2.607002, -3.334741, -1.257353,
-  // f 410/88 500/174 501/175 411/87
-  5.310578, -3.406494, 0.739122,
-  2.607002, -3.404206, -1.258393,
-  2.607002, -3.334741, -1.257353,
-  // f 411/87 501/175 502/176 441/118
-  2.607002, -3.404206, -1.258393,
-  2.607002, -3.334741, -1.257353,
-  2.339904, -3.473256, -2.129538,
-  // f 411/87 501/175 502/176 441/118
-  2.607002, -3.404206, -1.258393,
-  2.339904, -3.6047, -2.161987,
-  2.339904, -3.473256, -2.129538,
-  // f 435/111 503/178 504/177 436/110
-  2.595926, 3.440015, -0.788707,
-  2.595926, 3.015319, -0.789748,
-  5.28717, 3.012823, 0.749521,
-  // f 435/111 503/178 504/177 436/110
-  2.595926, 3.440015, -0.788707,
-  5.288215, 3.437728, 0.753265,
-  5.28717, 3.012823, 0.749521,
-  // f 436/110 504/177 498/173 406/84
-  5.288215, 3.437728, 0.753265,
-  5.28717, 3.012823, 0.749521,
-  7.374418, 2.395122, 3.401645,
-  // f 436/110 504/177 498/173 406/84
-  5.288215, 3.437728, 0.753265,
-  7.651129, 2.62286, 3.659369,
-  7.374418, 2.395122, 3.401645,
-  // f 498/173 446/122 447/123 499/172
-  7.374418, 2.395122, 3.401645,
-  6.977114, 2.660712, 1.723422,
-  6.986519, -2.629894, 1.709486,
-  // f 498/173 446/122 447/123 499/172
-  7.374418, 2.395122, 3.401645,
-  7.389048, -2.443752, 3.311785,
-  6.986519, -2.629894, 1.709486,
-  // f 447/123 432/106 500/174 499/172
-  6.986519, -2.629894, 1.709486,
-  6.261088, -2.47703, -2.035731,
-  5.308488, -2.981798, 0.738498,
-  // f 447/123 432/106 500/174 499/172
-  6.986519, -2.629894, 1.709486,
-  7.389048, -2.443752, 3.311785,
-  5.308488, -2.981798, 0.738498,
-  // f 500/174 432/106 431/107 501/175
-  5.308488, -2.981798, 0.738498,
-  6.261088, -2.47703, -2.035731,
-  3.214134, -3.317479, -2.432817,
-  // f 500/174 432/106 431/107 501/175
-  5.308488, -2.981798, 0.738498,
-  2.607002, -3.334741, -1.257353,
-  3.214134, -3.317479, -2.432817,
-  // f 431/107 449/124 502/176 501/175
-  3.214134, -3.317479, -2.432817,
-  1.576231, -3.333493, -3.248838,
-  2.339904, -3.473256, -2.129538,
-  // f 431/107 449/124 502/176 501/175
-  3.214134, -3.317479, -2.432817,
-  2.607002, -3.334741, -1.257353,
-  2.339904, -3.473256, -2.129538,
-  // f 503/178 430/108 429/105 504/177
-  2.595926, 3.015319, -0.789748,
-  3.203475, 2.522613, -2.423666,
-  6.250848, 2.521989, -2.028451,
-  // f 503/178 430/108 429/105 504/177
-  2.595926, 3.015319, -0.789748,
-  5.28717, 3.012823, 0.749521,
-  6.250848, 2.521989, -2.028451,
-  // f 504/177 429/105 446/122 498/173
-  5.28717, 3.012823, 0.749521,
-  6.250848, 2.521989, -2.028451,
-  6.977114, 2.660712, 1.723422,
-  // f 504/177 429/105 446/122 498/173
-  5.28717, 3.012823, 0.749521,
-  7.374418, 2.395122, 3.401645,
-  6.977114, 2.660712, 1.723422,
-  // f 479/4 505/180 506/179 480/3
-  8.03714, 3.375333, 0.37614,
-  8.154596, 3.08312, 0.664233,
-  8.238613, 2.614748, 0.670266,
-  // f 479/4 505/180 506/179 480/3
-  8.03714, 3.375333, 0.37614,
-  8.183228, 2.620988, 0.400893,
-  8.238613, 2.614748, 0.670266,
-  // f 480/3 506/179 507/181 481/6
-  8.183228, 2.620988, 0.400893,
-  8.238613, 2.614748, 0.670266,
-  8.238613, -2.669827, 0.659451,
-  // f 480/3 506/179 507/181 481/6
-  8.183228, 2.620988, 0.400893,
-  8.183437, -2.673779, 0.38987,
-  8.238613, -2.669827, 0.659451,
-  // f 481/6 507/181 508/182 482/8
-  8.183437, -2.673779, 0.38987,
-  8.238613, -2.669827, 0.659451,
-  8.177795, -3.051887, 0.65217,
-  // f 481/6 507/181 508/182 482/8
-  8.183437, -2.673779, 0.38987,
-  8.063474, -3.344308, 0.360956,
-  8.177795, -3.051887, 0.65217,
-  // f 482/8 508/182 509/184 407/183
-  8.063474, -3.344308, 0.360956,
-  8.177795, -3.051887, 0.65217,
-  7.993881, -2.330195, 2.515106,
-  // f 482/8 508/182 509/184 407/183
-  8.063474, -3.344308, 0.360956,
-  7.66952, -2.709135, 3.509602,
-  7.993881, -2.330195, 2.515106,
-  // f 407/183 509/184 510/186 408/185
-  7.66952, -2.709135, 3.509602,
-  7.993881, -2.330195, 2.515106,
-  7.965876, -1.995554, 2.767006,
-  // f 407/183 509/184 510/186 408/185
-  7.66952, -2.709135, 3.509602,
-  7.854692, -2.207694, 3.839921,
-  7.965876, -1.995554, 2.767006,
-  // f 408/185 510/186 511/188 405/187
-  7.854692, -2.207694, 3.839921,
-  7.965876, -1.995554, 2.767006,
-  7.965249, 1.943804, 2.776366,
-  // f 408/185 510/186 511/188 405/187
-  7.854692, -2.207694, 3.839921,
-  7.853647, 2.123707, 3.899827,
-  7.965249, 1.943804, 2.776366,
-  // f 405/187 511/188 512/190 406/189
-  7.853647, 2.123707, 3.899827,
-  7.965249, 1.943804, 2.776366,
-  7.971728, 2.342294, 2.524467,
-  // f 405/187 511/188 512/190 406/189
-  7.853647, 2.123707, 3.899827,
-  7.651129, 2.62286, 3.659369,
-  7.971728, 2.342294, 2.524467,
-  // f 406/189 512/190 505/180 479/4
-  7.651129, 2.62286, 3.659369,
-  7.971728, 2.342294, 2.524467,
-  8.154596, 3.08312, 0.664233,
-  // f 406/189 512/190 505/180 479/4
-  7.651129, 2.62286, 3.659369,
-  8.03714, 3.375333, 0.37614,
-  8.154596, 3.08312, 0.664233,
-  // f 493/156 492/157 506/179 505/180
-  7.750607, 2.429646, 0.397982,
-  7.750398, 2.071088, 0.396109,
-  8.238613, 2.614748, 0.670266,
-  // f 493/156 492/157 506/179 505/180
-  7.750607, 2.429646, 0.397982,
-  8.154596, 3.08312, 0.664233,
-  8.238613, 2.614748, 0.670266,
-  // f 506/179 492/157 495/159 507/181
-  8.238613, 2.614748, 0.670266,
-  7.750398, 2.071088, 0.396109,
-  7.750189, -1.910907, 0.388206,
-  // f 506/179 492/157 495/159 507/181
-  8.238613, 2.614748, 0.670266,
-  8.238613, -2.669827, 0.659451,
-  7.750189, -1.910907, 0.388206,
-  // f 495/159 497/161 508/182 507/181
-  7.750189, -1.910907, 0.388206,
-  7.750398, -2.289223, 0.390286,
-  8.177795, -3.051887, 0.65217,
-  // f 495/159 497/161 508/182 507/181
-  7.750189, -1.910907, 0.388206,
-  8.238613, -2.669827, 0.659451,
-  8.177795, -3.051887, 0.65217,
-  // f 508/182 497/161 496/162 509/184
-  8.177795, -3.051887, 0.65217,
-  7.750398, -2.289223, 0.390286,
-  7.751026, -1.845184, 1.55431,
-  // f 508/182 497/161 496/162 509/184
-  8.177795, -3.051887, 0.65217,
-  7.993881, -2.330195, 2.515106,
-  7.751026, -1.845184, 1.55431,
-  // f 509/184 496/162 494/160 510/186
-  7.993881, -2.330195, 2.515106,
-  7.751026, -1.845184, 1.55431,
-  7.7504, -1.814611, 1.559926,
-  // f 509/184 496/162 494/160 510/186
-  7.993881, -2.330195, 2.515106,
-  7.965876, -1.995554, 2.767006,
-  7.7504, -1.814611, 1.559926,
-  // f 510/186 494/160 491/158 511/188
-  7.965876, -1.995554, 2.767006,
-  7.7504, -1.814611, 1.559926,
-  7.750608, 1.801129, 1.568453,
-  // f 510/186 494/160 491/158 511/188
-  7.965876, -1.995554, 2.767006,
-  7.965249, 1.943804, 2.776366,
-  7.750608, 1.801129, 1.568453,
-  // f 511/188 491/158 490/155 512/190
-  7.965249, 1.943804, 2.776366,
-  7.750608, 1.801129, 1.568453,
-  7.751235, 1.885153, 1.53226,
-  // f 511/188 491/158 490/155 512/190
-  7.965249, 1.943804, 2.776366,
-  7.971728, 2.342294, 2.524467,
-  7.751235, 1.885153, 1.53226,
-  // f 512/190 490/155 493/156 505/180
-  7.971728, 2.342294, 2.524467,
-  7.751235, 1.885153, 1.53226,
-  7.750607, 2.429646, 0.397982,
-  // f 512/190 490/155 493/156 505/180
-  7.971728, 2.342294, 2.524467,
-  8.154596, 3.08312, 0.664233,
-  7.750607, 2.429646, 0.397982,
-  // f 513/191 514/194 515/193 516/192
-  7.50149, -0.099812, 5.380859,
-  7.188414, 3.355576, 5.159536,
-  6.315018, 2.156568, 3.998635,
-  // f 513/191 514/194 515/193 516/192
-  7.50149, -0.099812, 5.380859,
-  6.338007, 0.09881, 4.084543,
-  6.315018, 2.156568, 3.998635,
-  // f 517/195 518/198 519/197 520/196
-  4.800212, -2.673154, 2.57377,
-  4.889871, -4.241327, 2.568361,
-  6.954338, -3.795209, 4.758911,
-  // f 517/195 518/198 519/197 520/196
-  4.800212, -2.673154, 2.57377,
-  6.121278, -2.425449, 3.71075,
-  6.954338, -3.795209, 4.758911,
-  // f 521/199 522/200 518/198 517/195
-  2.40616, -2.847858, 1.087335,
-  2.390903, -4.378179, 1.083591,
-  4.889871, -4.241327, 2.568361,
-  // f 521/199 522/200 518/198 517/195
-  2.40616, -2.847858, 1.087335,
-  4.800212, -2.673154, 2.57377,
-  4.889871, -4.241327, 2.568361,
-  // f 523/201 524/204 525/203 526/202
-  4.758204, 2.825849, 2.593529,
-  4.778895, 4.297935, 2.60289,
-  2.409713, 4.310621, 0.974592,
-  // f 523/201 524/204 525/203 526/202
-  4.758204, 2.825849, 2.593529,
-  2.39153, 2.808586, 0.971472,
-  2.409713, 4.310621, 0.974592,
-  // f 527/205 528/206 524/204 523/201
-  6.109992, 2.613709, 3.765248,
-  6.856318, 3.952063, 4.824224,
-  4.778895, 4.297935, 2.60289,
-  // f 527/205 528/206 524/204 523/201
-  6.109992, 2.613709, 3.765248,
-  4.758204, 2.825849, 2.593529,
-  4.778895, 4.297935, 2.60289,
-  // f 529/207 530/210 531/209 532/208
-  7.851973, -1.935656, 2.91719,
-  7.902132, 0.120023, 3.011002,
-  8.723489, -0.093157, 4.490783,
-  // f 529/207 530/210 531/209 532/208
-  7.851973, -1.935656, 2.91719,
-  8.451167, -3.118648, 4.182097,
-  8.723489, -0.093157, 4.490783,
-  // f 533/211 534/214 535/213 536/212
-  8.279371, -3.740094, 3.777518,
-  6.133605, -4.223857, 1.185926,
-  6.052306, -2.661924, 1.188838,
-  // f 533/211 534/214 535/213 536/212
-  8.279371, -3.740094, 3.777518,
-  7.635035, -2.394253, 2.734973,
-  6.052306, -2.661924, 1.188838,
-  // f 534/214 537/216 538/215 535/213
-  6.133605, -4.223857, 1.185926,
-  2.564158, -4.342406, -1.15002,
-  2.568757, -2.415259, -0.377887,
-  // f 534/214 537/216 538/215 535/213
-  6.133605, -4.223857, 1.185926,
-  6.052306, -2.661924, 1.188838,
-  2.568757, -2.415259, -0.377887,
-  // f 539/217 138/220 137/219 540/218
-  2.562904, 2.785501, -1.136917,
-  -0.004195, 2.715619, -1.560421,
-  -0.004196, 4.234708, -1.647993,
-  // f 539/217 138/220 137/219 540/218
-  2.562904, 2.785501, -1.136917,
-  2.580042, 4.316237, -1.134212,
-  -0.004196, 4.234708, -1.647993,
-  // f 540/218 541/222 542/221 539/217
-  2.580042, 4.316237, -1.134212,
-  6.036631, 4.311245, 1.210886,
-  6.01594, 2.798187, 1.204439,
-  // f 540/218 541/222 542/221 539/217
-  2.580042, 4.316237, -1.134212,
-  2.562904, 2.785501, -1.136917,
-  6.01594, 2.798187, 1.204439,
-  // f 541/222 543/224 544/223 542/221
-  6.036631, 4.311245, 1.210886,
-  8.30654, 3.978685, 3.835968,
-  7.672028, 2.340007, 2.777407,
-  // f 541/222 543/224 544/223 542/221
-  6.036631, 4.311245, 1.210886,
-  6.01594, 2.798187, 1.204439,
-  7.672028, 2.340007, 2.777407,
-  // f 545/225 546/228 547/227 548/226
-  7.734103, -0.119778, 5.408316,
-  7.593448, -3.39443, 5.151217,
-  8.410622, -3.360322, 4.44523,
-  // f 545/225 546/228 547/227 548/226
-  7.734103, -0.119778, 5.408316,
-  8.719309, -0.109171, 4.673208,
-  8.410622, -3.360322, 4.44523,
-  // f 516/229 515/231 549/230 530/210
-  6.338007, 0.09881, 4.084543,
-  6.315018, 2.156568, 3.998635,
-  7.866812, 2.191717, 2.980632,
-  // f 516/229 515/231 549/230 530/210
-  6.338007, 0.09881, 4.084543,
-  7.902132, 0.120023, 3.011002,
-  7.866812, 2.191717, 2.980632,
-  // f 550/232 551/235 552/234 553/233
-  8.211448, -4.021076, 4.03129,
-  7.23063, -4.066207, 4.762446,
-  5.020702, -4.459083, 2.430867,
-  // f 550/232 551/235 552/234 553/233
-  8.211448, -4.021076, 4.03129,
-  6.034332, -4.443069, 1.306988,
-  5.020702, -4.459083, 2.430867,
-  // f 535/213 517/237 520/236 536/212
-  6.052306, -2.661924, 1.188838,
-  4.800212, -2.673154, 2.57377,
-  6.121278, -2.425449, 3.71075,
-  // f 535/213 517/237 520/236 536/212
-  6.052306, -2.661924, 1.188838,
-  7.635035, -2.394253, 2.734973,
-  6.121278, -2.425449, 3.71075,
-  // f 553/233 552/234 554/65 555/66
-  6.034332, -4.443069, 1.306988,
-  5.020702, -4.459083, 2.430867,
-  2.405951, -4.570768, 0.934032,
-  // f 553/233 552/234 554/65 555/66
-  6.034332, -4.443069, 1.306988,
-  2.547229, -4.54186, -0.987772,
-  2.405951, -4.570768, 0.934032,
-  // f 538/215 521/238 517/237 535/213
-  2.568757, -2.415259, -0.377887,
-  2.40616, -2.847858, 1.087335,
-  4.800212, -2.673154, 2.57377,
-  // f 538/215 521/238 517/237 535/213
-  2.568757, -2.415259, -0.377887,
-  6.052306, -2.661924, 1.188838,
-  4.800212, -2.673154, 2.57377,
-  // f 154/239 556/242 557/241 155/240
-  -0.004193, 4.528585, 0.089097,
-  2.428313, 4.518186, 0.826489,
-  2.566666, 4.522345, -0.97134,
-  // f 154/239 556/242 557/241 155/240
-  -0.004193, 4.528585, 0.089097,
-  -0.004195, 4.455167, -1.497186,
-  2.566666, 4.522345, -0.97134,
-  // f 557/241 556/242 558/244 559/243
-  2.566666, 4.522345, -0.97134,
-  2.428313, 4.518186, 0.826489,
-  4.900321, 4.507371, 2.470804,
-  // f 557/241 556/242 558/244 559/243
-  2.566666, 4.522345, -0.97134,
-  5.935059, 4.515691, 1.330284,
-  4.900321, 4.507371, 2.470804,
-  // f 542/221 523/246 526/245 539/217
-  6.01594, 2.798187, 1.204439,
-  4.758204, 2.825849, 2.593529,
-  2.39153, 2.808586, 0.971472,
-  // f 542/221 523/246 526/245 539/217
-  6.01594, 2.798187, 1.204439,
-  2.562904, 2.785501, -1.136917,
-  2.39153, 2.808586, 0.971472,
-  // f 559/243 558/244 560/248 561/247
-  5.935059, 4.515691, 1.330284,
-  4.900321, 4.507371, 2.470804,
-  7.114429, 4.179595, 4.829424,
-  // f 559/243 558/244 560/248 561/247
-  5.935059, 4.515691, 1.330284,
-  8.228795, 4.201224, 4.081835,
-  7.114429, 4.179595, 4.829424,
-  // f 544/223 527/249 523/246 542/221
-  7.672028, 2.340007, 2.777407,
-  6.109992, 2.613709, 3.765248,
-  4.758204, 2.825849, 2.593529,
-  // f 544/223 527/249 523/246 542/221
-  7.672028, 2.340007, 2.777407,
-  6.01594, 2.798187, 1.204439,
-  4.758204, 2.825849, 2.593529,
-  // f 513/191 516/192 562/251 563/250
-  7.50149, -0.099812, 5.380859,
-  6.338007, 0.09881, 4.084543,
-  6.277607, -1.955206, 3.912311,
-  // f 513/191 516/192 562/251 563/250
-  7.50149, -0.099812, 5.380859,
-  7.298973, -3.150885, 5.123551,
-  6.277607, -1.955206, 3.912311,
-  // f 531/209 530/210 549/230 564/252
-  8.723489, -0.093157, 4.490783,
-  7.902132, 0.120023, 3.011002,
-  7.866812, 2.191717, 2.980632,
-  // f 531/209 530/210 549/230 564/252
-  8.723489, -0.093157, 4.490783,
-  8.497355, 3.403619, 4.235138,
-  7.866812, 2.191717, 2.980632,
-  // f 565/253 545/225 548/226 566/254
-  7.47014, 3.558356, 5.186369,
-  7.734103, -0.119778, 5.408316,
-  8.719309, -0.109171, 4.673208,
-  // f 565/253 545/225 548/226 566/254
-  7.47014, 3.558356, 5.186369,
-  8.436747, 3.609312, 4.486207,
-  8.719309, -0.109171, 4.673208,
-  // f 562/255 516/229 530/210 529/207
-  6.277607, -1.955206, 3.912311,
-  6.338007, 0.09881, 4.084543,
-  7.902132, 0.120023, 3.011002,
-  // f 562/255 516/229 530/210 529/207
-  6.277607, -1.955206, 3.912311,
-  7.851973, -1.935656, 2.91719,
-  7.902132, 0.120023, 3.011002,
-  // f 514/194 513/191 545/225 565/253
-  7.188414, 3.355576, 5.159536,
-  7.50149, -0.099812, 5.380859,
-  7.734103, -0.119778, 5.408316,
-  // f 514/194 513/191 545/225 565/253
-  7.188414, 3.355576, 5.159536,
-  7.47014, 3.558356, 5.186369,
-  7.734103, -0.119778, 5.408316,
-  // f 519/197 518/198 552/234 551/235
-  6.954338, -3.795209, 4.758911,
-  4.889871, -4.241327, 2.568361,
-  5.020702, -4.459083, 2.430867,
-  // f 519/197 518/198 552/234 551/235
-  6.954338, -3.795209, 4.758911,
-  7.23063, -4.066207, 4.762446,
-  5.020702, -4.459083, 2.430867,
-  // f 518/198 522/200 554/65 552/234
-  4.889871, -4.241327, 2.568361,
-  2.390903, -4.378179, 1.083591,
-  2.405951, -4.570768, 0.934032,
-  // f 518/198 522/200 554/65 552/234
-  4.889871, -4.241327, 2.568361,
-  5.020702, -4.459083, 2.430867,
-  2.405951, -4.570768, 0.934032,
-  // f 525/203 524/204 558/244 556/242
-  2.409713, 4.310621, 0.974592,
-  4.778895, 4.297935, 2.60289,
-  4.900321, 4.507371, 2.470804,
-  // f 525/203 524/204 558/244 556/242
-  2.409713, 4.310621, 0.974592,
-  2.428313, 4.518186, 0.826489,
-  4.900321, 4.507371, 2.470804,
-  // f 524/204 528/206 560/248 558/244
-  4.778895, 4.297935, 2.60289,
-  6.856318, 3.952063, 4.824224,
-  7.114429, 4.179595, 4.829424,
-  // f 524/204 528/206 560/248 558/244
-  4.778895, 4.297935, 2.60289,
-  4.900321, 4.507371, 2.470804,
-  7.114429, 4.179595, 4.829424,
-  // f 532/208 531/209 548/257 547/256
-  8.451167, -3.118648, 4.182097,
-  8.723489, -0.093157, 4.490783,
-  8.719309, -0.109171, 4.673208,
-  // f 532/208 531/209 548/257 547/256
-  8.451167, -3.118648, 4.182097,
-  8.410622, -3.360322, 4.44523,
-  8.719309, -0.109171, 4.673208,
-  // f 534/214 533/211 550/259 553/258
-  6.133605, -4.223857, 1.185926,
-  8.279371, -3.740094, 3.777518,
-  8.211448, -4.021076, 4.03129,
-  // f 534/214 533/211 550/259 553/258
-  6.133605, -4.223857, 1.185926,
-  6.034332, -4.443069, 1.306988,
-  8.211448, -4.021076, 4.03129,
-  // f 537/216 534/214 553/258 555/260
-  2.564158, -4.342406, -1.15002,
-  6.133605, -4.223857, 1.185926,
-  6.034332, -4.443069, 1.306988,
-  // f 537/216 534/214 553/258 555/260
-  2.564158, -4.342406, -1.15002,
-  2.547229, -4.54186, -0.987772,
-  6.034332, -4.443069, 1.306988,
-  // f 540/218 137/219 155/262 557/261
-  2.580042, 4.316237, -1.134212,
-  -0.004196, 4.234708, -1.647993,
-  -0.004195, 4.455167, -1.497186,
-  // f 540/218 137/219 155/262 557/261
-  2.580042, 4.316237, -1.134212,
-  2.566666, 4.522345, -0.97134,
-  -0.004195, 4.455167, -1.497186,
-  // f 541/222 540/218 557/261 559/263
-  6.036631, 4.311245, 1.210886,
-  2.580042, 4.316237, -1.134212,
-  2.566666, 4.522345, -0.97134,
-  // f 541/222 540/218 557/261 559/263
-  6.036631, 4.311245, 1.210886,
-  5.935059, 4.515691, 1.330284,
-  2.566666, 4.522345, -0.97134,
-  // f 543/224 541/222 559/263 561/264
-  8.30654, 3.978685, 3.835968,
-  6.036631, 4.311245, 1.210886,
-  5.935059, 4.515691, 1.330284,
-  // f 543/224 541/222 559/263 561/264
-  8.30654, 3.978685, 3.835968,
-  8.228795, 4.201224, 4.081835,
-  5.935059, 4.515691, 1.330284,
-  // f 513/191 563/250 546/228 545/225
-  7.50149, -0.099812, 5.380859,
-  7.298973, -3.150885, 5.123551,
-  7.593448, -3.39443, 5.151217,
-  // f 513/191 563/250 546/228 545/225
-  7.50149, -0.099812, 5.380859,
-  7.734103, -0.119778, 5.408316,
-  7.593448, -3.39443, 5.151217,
-  // f 531/209 564/252 566/265 548/257
-  8.723489, -0.093157, 4.490783,
-  8.497355, 3.403619, 4.235138,
-  8.436747, 3.609312, 4.486207,
-  // f 531/209 564/252 566/265 548/257
-  8.723489, -0.093157, 4.490783,
-  8.719309, -0.109171, 4.673208,
-  8.436747, 3.609312, 4.486207,
-  // f 563/250 562/251 520/196 519/197
-  7.298973, -3.150885, 5.123551,
-  6.277607, -1.955206, 3.912311,
-  6.121278, -2.425449, 3.71075,
-  // f 563/250 562/251 520/196 519/197
-  7.298973, -3.150885, 5.123551,
-  6.954338, -3.795209, 4.758911,
-  6.121278, -2.425449, 3.71075,
-  // f 515/193 514/194 528/206 527/205
-  6.315018, 2.156568, 3.998635,
-  7.188414, 3.355576, 5.159536,
-  6.856318, 3.952063, 4.824224,
-  // f 515/193 514/194 528/206 527/205
-  6.315018, 2.156568, 3.998635,
-  6.109992, 2.613709, 3.765248,
-  6.856318, 3.952063, 4.824224,
-  // f 529/207 532/208 533/211 536/212
-  7.851973, -1.935656, 2.91719,
-  8.451167, -3.118648, 4.182097,
-  8.279371, -3.740094, 3.777518,
-  // f 529/207 532/208 533/211 536/212
-  7.851973, -1.935656, 2.91719,
-  7.635035, -2.394253, 2.734973,
-  8.279371, -3.740094, 3.777518,
-  // f 564/252 549/230 544/223 543/224
-  8.497355, 3.403619, 4.235138,
-  7.866812, 2.191717, 2.980632,
-  7.672028, 2.340007, 2.777407,
-  // f 564/252 549/230 544/223 543/224
-  8.497355, 3.403619, 4.235138,
-  8.30654, 3.978685, 3.835968,
-  7.672028, 2.340007, 2.777407,
-  // f 565/253 566/254 561/247 560/248
-  7.47014, 3.558356, 5.186369,
-  8.436747, 3.609312, 4.486207,
-  8.228795, 4.201224, 4.081835,
-  // f 565/253 566/254 561/247 560/248
-  7.47014, 3.558356, 5.186369,
-  7.114429, 4.179595, 4.829424,
-  8.228795, 4.201224, 4.081835,
-  // f 547/227 546/228 551/235 550/232
-  8.410622, -3.360322, 4.44523,
-  7.593448, -3.39443, 5.151217,
-  7.23063, -4.066207, 4.762446,
-  // f 547/227 546/228 551/235 550/232
-  8.410622, -3.360322, 4.44523,
-  8.211448, -4.021076, 4.03129,
-  7.23063, -4.066207, 4.762446,
-  // f 562/255 529/207 536/212 520/236
-  6.277607, -1.955206, 3.912311,
-  7.851973, -1.935656, 2.91719,
-  7.635035, -2.394253, 2.734973,
-  // f 562/255 529/207 536/212 520/236
-  6.277607, -1.955206, 3.912311,
-  6.121278, -2.425449, 3.71075,
-  7.635035, -2.394253, 2.734973,
-  // f 549/230 515/231 527/249 544/223
-  7.866812, 2.191717, 2.980632,
-  6.315018, 2.156568, 3.998635,
-  6.109992, 2.613709, 3.765248,
-  // f 549/230 515/231 527/249 544/223
-  7.866812, 2.191717, 2.980632,
-  7.672028, 2.340007, 2.777407,
-  6.109992, 2.613709, 3.765248,
-  // f 560/248 528/206 514/194 565/253
-  7.114429, 4.179595, 4.829424,
-  6.856318, 3.952063, 4.824224,
-  7.188414, 3.355576, 5.159536,
-  // f 560/248 528/206 514/194 565/253
-  7.114429, 4.179595, 4.829424,
-  7.47014, 3.558356, 5.186369,
-  7.188414, 3.355576, 5.159536,
-  // f 546/228 563/250 519/197 551/235
-  7.593448, -3.39443, 5.151217,
-  7.298973, -3.150885, 5.123551,
-  6.954338, -3.795209, 4.758911,
-  // f 546/228 563/250 519/197 551/235
-  7.593448, -3.39443, 5.151217,
-  7.23063, -4.066207, 4.762446,
-  6.954338, -3.795209, 4.758911,
-  // f 543/224 561/264 566/265 564/252
-  8.30654, 3.978685, 3.835968,
-  8.228795, 4.201224, 4.081835,
-  8.436747, 3.609312, 4.486207,
-  // f 543/224 561/264 566/265 564/252
-  8.30654, 3.978685, 3.835968,
-  8.497355, 3.403619, 4.235138,
-  8.436747, 3.609312, 4.486207,
-  // f 532/208 547/256 550/259 533/211
-  8.451167, -3.118648, 4.182097,
-  8.410622, -3.360322, 4.44523,
-  8.211448, -4.021076, 4.03129,
-  // f 532/208 547/256 550/259 533/211
-  8.451167, -3.118648, 4.182097,
-  8.279371, -3.740094, 3.777518,
-  8.211448, -4.021076, 4.03129,
-  // f 567/266 568/269 569/268 570/267
-  2.65256, 3.435647, -3.949001,
-  2.652562, 3.432319, -1.770931,
-  3.74394, 3.432319, -1.770932,
-  // f 567/266 568/269 569/268 570/267
-  2.65256, 3.435647, -3.949001,
-  3.743937, 3.435647, -3.949003,
-  3.74394, 3.432319, -1.770932,
-  // f 570/267 569/268 571/271 572/270
-  3.743937, 3.435647, -3.949003,
-  3.74394, 3.432319, -1.770932,
-  4.769693, 3.060866, -1.771765,
-  // f 570/267 569/268 571/271 572/270
-  3.743937, 3.435647, -3.949003,
-  4.76969, 3.064193, -3.949629,
-  4.769693, 3.060866, -1.771765,
-  // f 572/270 571/271 573/273 574/272
-  4.76969, 3.064193, -3.949629,
-  4.769693, 3.060866, -1.771765,
-  5.605677, 2.362676, -1.773222,
-  // f 572/270 571/271 573/273 574/272
-  4.76969, 3.064193, -3.949629,
-  5.605674, 2.366003, -3.951086,
-  5.605677, 2.362676, -1.773222,
-  // f 574/272 573/273 575/275 576/274
-  5.605674, 2.366003, -3.951086,
-  5.605677, 2.362676, -1.773222,
-  6.151366, 1.422188, -1.775095,
-  // f 574/272 573/273 575/275 576/274
-  5.605674, 2.366003, -3.951086,
-  6.151363, 1.425515, -3.953166,
-  6.151366, 1.422188, -1.775095,
-  // f 576/274 575/275 577/277 578/276
-  6.151363, 1.425515, -3.953166,
-  6.151366, 1.422188, -1.775095,
-  6.340925, 0.352545, -1.777383,
-  // f 576/274 575/275 577/277 578/276
-  6.151363, 1.425515, -3.953166,
-  6.340922, 0.355872, -3.955246,
-  6.340925, 0.352545, -1.777383,
-  // f 578/276 577/277 579/279 580/278
-  6.340922, 0.355872, -3.955246,
-  6.340925, 0.352545, -1.777383,
-  6.151366, -0.717099, -1.779463,
-  // f 578/276 577/277 579/279 580/278
-  6.340922, 0.355872, -3.955246,
-  6.151363, -0.713772, -3.957534,
-  6.151366, -0.717099, -1.779463,
-  // f 580/278 579/279 581/281 582/280
-  6.151363, -0.713772, -3.957534,
-  6.151366, -0.717099, -1.779463,
-  5.605677, -1.657587, -1.781542,
-  // f 580/278 579/279 581/281 582/280
-  6.151363, -0.713772, -3.957534,
-  5.605674, -1.654259, -3.959405,
-  5.605677, -1.657587, -1.781542,
-  // f 582/280 581/281 583/283 584/282
-  5.605674, -1.654259, -3.959405,
-  5.605677, -1.657587, -1.781542,
-  4.769693, -2.355777, -1.782997,
-  // f 582/280 581/281 583/283 584/282
-  5.605674, -1.654259, -3.959405,
-  4.76969, -2.35245, -3.96086,
-  4.769693, -2.355777, -1.782997,
-  // f 584/282 583/283 585/285 586/284
-  4.76969, -2.35245, -3.96086,
-  4.769693, -2.355777, -1.782997,
-  3.74394, -2.72723, -1.783619,
-  // f 584/282 583/283 585/285 586/284
-  4.76969, -2.35245, -3.96086,
-  3.743937, -2.723903, -3.961691,
-  3.74394, -2.72723, -1.783619,
-  // f 586/284 585/285 587/287 588/286
-  3.743937, -2.723903, -3.961691,
-  3.74394, -2.72723, -1.783619,
-  2.652562, -2.72723, -1.783618,
-  // f 586/284 585/285 587/287 588/286
-  3.743937, -2.723903, -3.961691,
-  2.65256, -2.723903, -3.961689,
-  2.652562, -2.72723, -1.783618,
-  // f 588/286 587/287 589/289 590/288
-  2.65256, -2.723903, -3.961689,
-  2.652562, -2.72723, -1.783618,
-  1.627019, -2.355777, -1.782993,
-  // f 588/286 587/287 589/289 590/288
-  2.65256, -2.723903, -3.961689,
-  1.627016, -2.35245, -3.960856,
-  1.627019, -2.355777, -1.782993,
-  // f 590/288 589/289 591/291 592/290
-  1.627016, -2.35245, -3.960856,
-  1.627019, -2.355777, -1.782993,
-  0.716632, -1.723308, -1.781535,
-  // f 590/288 589/289 591/291 592/290
-  1.627016, -2.35245, -3.960856,
-  0.716629, -1.719981, -3.959607,
-  0.716632, -1.723308, -1.781535,
-  // f 193/292 592/290 591/291 194/293
-  -0.004199, -1.080025, -3.958358,
-  0.716629, -1.719981, -3.959607,
-  0.716632, -1.723308, -1.781535,
-  // f 193/292 592/290 591/291 194/293
-  -0.004199, -1.080025, -3.958358,
-  -0.004196, -1.083352, -1.780287,
-  0.716632, -1.723308, -1.781535,
-  // f 593/297 594/310 595/308 596/296
-  1.041829, -0.428214, -2.002026,
-  1.440176, -1.115173, -2.003483,
-  2.050862, -1.624934, -2.004524,
-  // f 593/297 594/310 595/308 596/296
-  1.041829, -0.428214, -2.002026,
-  2.050862, 2.330647, -1.996204,
-  2.050862, -1.624934, -2.004524,
-  // f 595/308 597/309 598/307 599/304
-  2.050862, -1.624934, -2.004524,
-  2.799904, -1.89614, -2.005149,
-  3.596806, -1.89614, -2.00515,
-  // f 595/308 597/309 598/307 599/304
-  2.050862, -1.624934, -2.004524,
-  4.956326, -1.115173, -2.003488,
-  3.596806, -1.89614, -2.00515,
-  // f 598/307 600/306 599/304
-  3.596806, -1.89614, -2.00515,
-  4.345849, -1.624934, -2.004527,
-  4.956326, -1.115173, -2.003488,
-  // f 599/304 601/305 602/303 603/300
-  4.956326, -1.115173, -2.003488,
-  5.354882, -0.428214, -2.002032,
-  5.493237, 0.352961, -2.000368,
-  // f 599/304 601/305 602/303 603/300
-  4.956326, -1.115173, -2.003488,
-  4.956326, 1.820886, -1.997456,
-  5.493237, 0.352961, -2.000368,
-  // f 602/303 604/302 603/300
-  5.493237, 0.352961, -2.000368,
-  5.354882, 1.133927, -1.998705,
-  4.956326, 1.820886, -1.997456,
-  // f 595/308 599/304 603/300 596/296
-  2.050862, -1.624934, -2.004524,
-  4.956326, -1.115173, -2.003488,
-  4.956326, 1.820886, -1.997456,
-  // f 595/308 599/304 603/300 596/296
-  2.050862, -1.624934, -2.004524,
-  2.050862, 2.330647, -1.996204,
-  4.956326, 1.820886, -1.997456,
-  // f 603/300 605/301 606/299 596/296
-  4.956326, 1.820886, -1.997456,
-  4.345849, 2.330647, -1.996207,
-  3.596806, 2.602061, -1.99579,
-  // f 603/300 605/301 606/299 596/296
-  4.956326, 1.820886, -1.997456,
-  2.050862, 2.330647, -1.996204,
-  3.596806, 2.602061, -1.99579,
-  // f 606/299 607/298 596/296
-  3.596806, 2.602061, -1.99579,
-  2.799904, 2.602061, -1.995789,
-  2.050862, 2.330647, -1.996204,
-  // f 596/296 608/295 609/294 593/297
-  2.050862, 2.330647, -1.996204,
-  1.440176, 1.820886, -1.997451,
-  1.041829, 1.133927, -1.998699,
-  // f 596/296 608/295 609/294 593/297
-  2.050862, 2.330647, -1.996204,
-  1.041829, -0.428214, -2.002026,
-  1.041829, 1.133927, -1.998699,
-  // f 610/311 593/297 609/294
-  0.903265, 0.352961, -2.000362,
-  1.041829, -0.428214, -2.002026,
-  1.041829, 1.133927, -1.998699,
-  // f 568/269 611/313 612/312 569/268
-  2.652562, 3.432319, -1.770931,
-  2.799905, 2.601645, -1.772594,
-  3.596807, 2.601645, -1.772595,
-  // f 568/269 611/313 612/312 569/268
-  2.652562, 3.432319, -1.770931,
-  3.74394, 3.432319, -1.770932,
-  3.596807, 2.601645, -1.772595,
-  // f 569/268 612/312 613/314 571/271
-  3.74394, 3.432319, -1.770932,
-  3.596807, 2.601645, -1.772595,
-  4.345849, 2.330439, -1.77322,
-  // f 569/268 612/312 613/314 571/271
-  3.74394, 3.432319, -1.770932,
-  4.769693, 3.060866, -1.771765,
-  4.345849, 2.330439, -1.77322,
-  // f 571/271 613/314 614/315 573/273
-  4.769693, 3.060866, -1.771765,
-  4.345849, 2.330439, -1.77322,
-  4.956326, 1.820471, -1.774261,
-  // f 571/271 613/314 614/315 573/273
-  4.769693, 3.060866, -1.771765,
-  5.605677, 2.362676, -1.773222,
-  4.956326, 1.820471, -1.774261,
-  // f 573/273 614/315 615/316 575/275
-  5.605677, 2.362676, -1.773222,
-  4.956326, 1.820471, -1.774261,
-  5.354882, 1.133719, -1.775718,
-  // f 573/273 614/315 615/316 575/275
-  5.605677, 2.362676, -1.773222,
-  6.151366, 1.422188, -1.775095,
-  5.354882, 1.133719, -1.775718,
-  // f 575/275 615/316 616/317 577/277
-  6.151366, 1.422188, -1.775095,
-  5.354882, 1.133719, -1.775718,
-  5.493237, 0.352545, -1.777382,
-  // f 575/275 615/316 616/317 577/277
-  6.151366, 1.422188, -1.775095,
-  6.340925, 0.352545, -1.777383,
-  5.493237, 0.352545, -1.777382,
-  // f 577/277 616/317 617/318 579/279
-  6.340925, 0.352545, -1.777383,
-  5.493237, 0.352545, -1.777382,
-  5.354882, -0.42863, -1.779045,
-  // f 577/277 616/317 617/318 579/279
-  6.340925, 0.352545, -1.777383,
-  6.151366, -0.717099, -1.779463,
-  5.354882, -0.42863, -1.779045,
-  // f 579/279 617/318 618/319 581/281
-  6.151366, -0.717099, -1.779463,
-  5.354882, -0.42863, -1.779045,
-  4.956326, -1.115381, -1.780293,
-  // f 579/279 617/318 618/319 581/281
-  6.151366, -0.717099, -1.779463,
-  5.605677, -1.657587, -1.781542,
-  4.956326, -1.115381, -1.780293,
-  // f 581/281 618/319 619/320 583/283
-  5.605677, -1.657587, -1.781542,
-  4.956326, -1.115381, -1.780293,
-  4.345849, -1.62535, -1.781332,
-  // f 581/281 618/319 619/320 583/283
-  5.605677, -1.657587, -1.781542,
-  4.769693, -2.355777, -1.782997,
-  4.345849, -1.62535, -1.781332,
-  // f 583/283 619/320 620/321 585/285
-  4.769693, -2.355777, -1.782997,
-  4.345849, -1.62535, -1.781332,
-  3.596807, -1.896556, -1.781956,
-  // f 583/283 619/320 620/321 585/285
-  4.769693, -2.355777, -1.782997,
-  3.74394, -2.72723, -1.783619,
-  3.596807, -1.896556, -1.781956,
-  // f 585/285 620/321 621/322 587/287
-  3.74394, -2.72723, -1.783619,
-  3.596807, -1.896556, -1.781956,
-  2.799905, -1.896556, -1.781955,
-  // f 585/285 620/321 621/322 587/287
-  3.74394, -2.72723, -1.783619,
-  2.652562, -2.72723, -1.783618,
-  2.799905, -1.896556, -1.781955,
-  // f 587/287 621/322 622/323 589/289
-  2.652562, -2.72723, -1.783618,
-  2.799905, -1.896556, -1.781955,
-  2.050863, -1.62535, -1.781329,
-  // f 587/287 621/322 622/323 589/289
-  2.652562, -2.72723, -1.783618,
-  1.627019, -2.355777, -1.782993,
-  2.050863, -1.62535, -1.781329,
-  // f 589/289 622/323 623/324 591/291
-  1.627019, -2.355777, -1.782993,
-  2.050863, -1.62535, -1.781329,
-  1.440176, -1.115381, -1.780289,
-  // f 589/289 622/323 623/324 591/291
-  1.627019, -2.355777, -1.782993,
-  0.716632, -1.723308, -1.781535,
-  1.440176, -1.115381, -1.780289,
-  // f 624/326 226/325 194/293 623/324
-  1.04183, -0.42863, -1.77904,
-  -0.004196, -0.989553, -1.780079,
-  -0.004196, -1.083352, -1.780287,
-  // f 624/326 226/325 194/293 623/324
-  1.04183, -0.42863, -1.77904,
-  1.440176, -1.115381, -1.780289,
-  -0.004196, -1.083352, -1.780287,
-  // f 591/291 623/324 194/293
-  0.716632, -1.723308, -1.781535,
-  1.440176, -1.115381, -1.780289,
-  -0.004196, -1.083352, -1.780287,
-  // f 625/327 610/311 609/294 626/328
-  0.903265, 0.352545, -1.777376,
-  0.903265, 0.352961, -2.000362,
-  1.041829, 1.133927, -1.998699,
-  // f 625/327 610/311 609/294 626/328
-  0.903265, 0.352545, -1.777376,
-  1.04183, 1.133719, -1.775712,
-  1.041829, 1.133927, -1.998699,
-  // f 626/328 609/294 608/295 627/329
-  1.04183, 1.133719, -1.775712,
-  1.041829, 1.133927, -1.998699,
-  1.440176, 1.820886, -1.997451,
-  // f 626/328 609/294 608/295 627/329
-  1.04183, 1.133719, -1.775712,
-  1.440176, 1.820471, -1.774257,
-  1.440176, 1.820886, -1.997451,
-  // f 627/329 608/295 596/296 628/330
-  1.440176, 1.820471, -1.774257,
-  1.440176, 1.820886, -1.997451,
-  2.050862, 2.330647, -1.996204,
-  // f 627/329 608/295 596/296 628/330
-  1.440176, 1.820471, -1.774257,
-  2.050863, 2.330439, -1.773217,
-  2.050862, 2.330647, -1.996204,
-  // f 628/330 596/296 607/298 611/331
-  2.050863, 2.330439, -1.773217,
-  2.050862, 2.330647, -1.996204,
-  2.799904, 2.602061, -1.995789,
-  // f 628/330 596/296 607/298 611/331
-  2.050863, 2.330439, -1.773217,
-  2.799905, 2.601645, -1.772594,
-  2.799904, 2.602061, -1.995789,
-  // f 611/331 607/298 606/299 612/332
-  2.799905, 2.601645, -1.772594,
-  2.799904, 2.602061, -1.995789,
-  3.596806, 2.602061, -1.99579,
-  // f 611/331 607/298 606/299 612/332
-  2.799905, 2.601645, -1.772594,
-  3.596807, 2.601645, -1.772595,
-  3.596806, 2.602061, -1.99579,
-  // f 612/332 606/299 605/301 613/333
-  3.596807, 2.601645, -1.772595,
-  3.596806, 2.602061, -1.99579,
-  4.345849, 2.330647, -1.996207,
-  // f 612/332 606/299 605/301 613/333
-  3.596807, 2.601645, -1.772595,
-  4.345849, 2.330439, -1.77322,
-  4.345849, 2.330647, -1.996207,
-  // f 613/333 605/301 603/300 614/334
-  4.345849, 2.330439, -1.77322,
-  4.345849, 2.330647, -1.996207,
-  4.956326, 1.820886, -1.997456,
-  // f 613/333 605/301 603/300 614/334
-  4.345849, 2.330439, -1.77322,
-  4.956326, 1.820471, -1.774261,
-  4.956326, 1.820886, -1.997456,
-  // f 614/334 603/300 604/302 615/335
-  4.956326, 1.820471, -1.774261,
-  4.956326, 1.820886, -1.997456,
-  5.354882, 1.133927, -1.998705,
-  // f 614/334 603/300 604/302 615/335
-  4.956326, 1.820471, -1.774261,
-  5.354882, 1.133719, -1.775718,
-  5.354882, 1.133927, -1.998705,
-  // f 615/335 604/302 602/303 616/336
-  5.354882, 1.133719, -1.775718,
-  5.354882, 1.133927, -1.998705,
-  5.493237, 0.352961, -2.000368,
-  // f 615/335 604/302 602/303 616/336
-  5.354882, 1.133719, -1.775718,
-  5.493237, 0.352545, -1.777382,
-  5.493237, 0.352961, -2.000368,
-  // f 616/336 602/303 601/305 617/337
-  5.493237, 0.352545, -1.777382,
-  5.493237, 0.352961, -2.000368,
-  5.354882, -0.428214, -2.002032,
-  // f 616/336 602/303 601/305 617/337
-  5.493237, 0.352545, -1.777382,
-  5.354882, -0.42863, -1.779045,
-  5.354882, -0.428214, -2.002032,
-  // f 617/337 601/305 599/304 618/338
-  5.354882, -0.42863, -1.779045,
-  5.354882, -0.428214, -2.002032,
-  4.956326, -1.115173, -2.003488,
-  // f 617/337 601/305 599/304 618/338
-  5.354882, -0.42863, -1.779045,
-  4.956326, -1.115381, -1.780293,
-  4.956326, -1.115173, -2.003488,
-  // f 618/338 599/304 600/306 619/339
-  4.956326, -1.115381, -1.780293,
-  4.956326, -1.115173, -2.003488,
-  4.345849, -1.624934, -2.004527,
-  // f 618/338 599/304 600/306 619/339
-  4.956326, -1.115381, -1.780293,
-  4.345849, -1.62535, -1.781332,
-  4.345849, -1.624934, -2.004527,
-  // f 619/339 600/306 598/307 620/340
-  4.345849, -1.62535, -1.781332,
-  4.345849, -1.624934, -2.004527,
-  3.596806, -1.89614, -2.00515,
-  // f 619/339 600/306 598/307 620/340
-  4.345849, -1.62535, -1.781332,
-  3.596807, -1.896556, -1.781956,
-  3.596806, -1.89614, -2.00515,
-  // f 620/340 598/307 597/309 621/341
-  3.596807, -1.896556, -1.781956,
-  3.596806, -1.89614, -2.00515,
-  2.799904, -1.89614, -2.005149,
-  // f 620/340 598/307 597/309 621/341
-  3.596807, -1.896556, -1.781956,
-  2.799905, -1.896556, -1.781955,
-  2.799904, -1.89614, -2.005149,
-  // f 621/341 597/309 595/308 622/342
-  2.799905, -1.896556, -1.781955,
-  2.799904, -1.89614, -2.005149,
-  2.050862, -1.624934, -2.004524,
-  // f 621/341 597/309 595/308 622/342
-  2.799905, -1.896556, -1.781955,
-  2.050863, -1.62535, -1.781329,
-  2.050862, -1.624934, -2.004524,
-  // f 622/342 595/308 594/310 623/343
-  2.050863, -1.62535, -1.781329,
-  2.050862, -1.624934, -2.004524,
-  1.440176, -1.115173, -2.003483,
-  // f 622/342 595/308 594/310 623/343
-  2.050863, -1.62535, -1.781329,
-  1.440176, -1.115381, -1.780289,
-  1.440176, -1.115173, -2.003483,
-  // f 623/343 594/310 593/297 624/344
-  1.440176, -1.115381, -1.780289,
-  1.440176, -1.115173, -2.003483,
-  1.041829, -0.428214, -2.002026,
-  // f 623/343 594/310 593/297 624/344
-  1.440176, -1.115381, -1.780289,
-  1.04183, -0.42863, -1.77904,
-  1.041829, -0.428214, -2.002026,
-  // f 624/344 593/297 610/311 625/327
-  1.04183, -0.42863, -1.77904,
-  1.041829, -0.428214, -2.002026,
-  0.903265, 0.352961, -2.000362,
-  // f 624/344 593/297 610/311 625/327
-  1.04183, -0.42863, -1.77904,
-  0.903265, 0.352545, -1.777376,
-  0.903265, 0.352961, -2.000362,
-  // f 232/345 629/348 630/347 233/346
-  -0.004196, 5.039384, -2.006602,
-  1.407781, 4.916884, -2.00702,
-  1.407781, 4.9173, -2.350029,
-  // f 232/345 629/348 630/347 233/346
-  -0.004196, 5.039384, -2.006602,
-  -0.004197, 5.040009, -2.349818,
-  1.407781, 4.9173, -2.350029,
-  // f 236/349 631/36 629/348 232/345
-  -0.004196, 4.792096, -2.007226,
-  1.407781, 4.669387, -2.007436,
-  1.407781, 4.916884, -2.00702,
-  // f 236/349 631/36 629/348 232/345
-  -0.004196, 4.792096, -2.007226,
-  -0.004196, 5.039384, -2.006602,
-  1.407781, 4.916884, -2.00702,
-  // f 632/28 633/40 634/41 635/27
-  1.746564, 4.670011, -2.350653,
-  1.746564, 4.837851, -2.350236,
-  1.746564, 4.837435, -2.00702,
-  // f 632/28 633/40 634/41 635/27
-  1.746564, 4.670011, -2.350653,
-  1.746564, 4.669387, -2.007437,
-  1.746564, 4.837435, -2.00702,
-  // f 636/39 630/347 629/348 637/42
-  1.653978, 4.9173, -2.350029,
-  1.407781, 4.9173, -2.350029,
-  1.407781, 4.916884, -2.00702,
-  // f 636/39 630/347 629/348 637/42
-  1.653978, 4.9173, -2.350029,
-  1.653979, 4.916884, -2.00702,
-  1.407781, 4.916884, -2.00702,
-  // f 629/348 631/36 637/42
-  1.407781, 4.916884, -2.00702,
-  1.407781, 4.669387, -2.007436,
-  1.653979, 4.916884, -2.00702,
-  // f 633/350 638/32 636/351
-  1.746564, 4.837851, -2.350236,
-  1.407781, 4.670011, -2.350653,
-  1.653978, 4.9173, -2.350029,
-  // f 636/351 638/32 630/352
-  1.653978, 4.9173, -2.350029,
-  1.407781, 4.670011, -2.350653,
-  1.407781, 4.9173, -2.350029,
-  // f 634/41 631/36 635/27
-  1.746564, 4.837435, -2.00702,
-  1.407781, 4.669387, -2.007436,
-  1.746564, 4.669387, -2.007437,
-  // f 631/36 634/41 637/42
-  1.407781, 4.669387, -2.007436,
-  1.746564, 4.837435, -2.00702,
-  1.653979, 4.916884, -2.00702,
-  // f 654/353 655/356 656/355 657/354
-  2.133836, -3.052927, -0.48522,
-  2.129237, -4.174358, -1.104673,
-  1.992138, -4.189125, 0.672979,
-  // f 654/353 655/356 656/355 657/354
-  2.133836, -3.052927, -0.48522,
-  2.003842, -3.301672, 0.6761,
-  1.992138, -4.189125, 0.672979,
-  // f 658/67 659/68 656/355 655/356
-  2.11816, -4.266701, -1.001292,
-  2.002588, -4.283755, 0.571887,
-  1.992138, -4.189125, 0.672979,
-  // f 658/67 659/68 656/355 655/356
-  2.11816, -4.266701, -1.001292,
-  2.129237, -4.174358, -1.104673,
-  1.992138, -4.189125, 0.672979,
-  // f 521/199 657/354 656/355 522/200
-  2.40616, -2.847858, 1.087335,
-  2.003842, -3.301672, 0.6761,
-  1.992138, -4.189125, 0.672979,
-  // f 521/199 657/354 656/355 522/200
-  2.40616, -2.847858, 1.087335,
-  2.390903, -4.378179, 1.083591,
-  1.992138, -4.189125, 0.672979,
-  // f 522/200 656/355 659/68 554/65
-  2.390903, -4.378179, 1.083591,
-  1.992138, -4.189125, 0.672979,
-  2.002588, -4.283755, 0.571887,
-  // f 522/200 656/355 659/68 554/65
-  2.390903, -4.378179, 1.083591,
-  2.405951, -4.570768, 0.934032,
-  2.002588, -4.283755, 0.571887,
-  // f 555/260 658/358 655/357 537/216
-  2.547229, -4.54186, -0.987772,
-  2.11816, -4.266701, -1.001292,
-  2.129237, -4.174358, -1.104673,
-  // f 555/260 658/358 655/357 537/216
-  2.547229, -4.54186, -0.987772,
-  2.564158, -4.342406, -1.15002,
-  2.129237, -4.174358, -1.104673,
-  // f 537/216 655/357 654/359 538/215
-  2.564158, -4.342406, -1.15002,
-  2.129237, -4.174358, -1.104673,
-  2.133836, -3.052927, -0.48522,
-  // f 537/216 655/357 654/359 538/215
-  2.564158, -4.342406, -1.15002,
-  2.568757, -2.415259, -0.377887,
-  2.133836, -3.052927, -0.48522,
-  // f 538/215 654/359 657/360 521/238
-  2.568757, -2.415259, -0.377887,
-  2.133836, -3.052927, -0.48522,
-  2.003842, -3.301672, 0.6761,
-  // f 538/215 654/359 657/360 521/238
-  2.568757, -2.415259, -0.377887,
-  2.40616, -2.847858, 1.087335,
-  2.003842, -3.301672, 0.6761,
-  // f 442/117 441/118 267/362 266/361
-  2.290163, -3.780859, -2.163028,
-  2.339904, -3.6047, -2.161987,
-  -0.004197, -3.823495, -2.780814,
-  // f 442/117 441/118 267/362 266/361
-  2.290163, -3.780859, -2.163028,
-  -0.004197, -3.801657, -2.749196,
-  -0.004197, -3.823495, -2.780814,
-  // f 445/120 444/121 269/364 268/363
-  1.271929, -3.869043, -5.57314,
-  1.271932, -3.870083, -3.45872,
-  -0.004198, -3.921246, -3.612437,
-  // f 445/120 444/121 269/364 268/363
-  1.271929, -3.869043, -5.57314,
-  -0.004201, -3.92083, -5.573346,
-  -0.004198, -3.921246, -3.612437,
-  // f 449/124 448/125 271/366 270/365
-  1.576231, -3.333493, -3.248838,
-  1.571007, 2.522821, -2.580295,
-  -0.004197, 2.523028, -2.731308,
-  // f 449/124 448/125 271/366 270/365
-  1.576231, -3.333493, -3.248838,
-  -0.004199, -3.401711, -4.036361,
-  -0.004197, 2.523028, -2.731308,
-  // f 272/367 451/127 452/128 273/368
-  -0.004195, 3.441055, -1.449135,
-  1.267128, 3.440639, -1.126098,
-  1.221358, 3.582065, -1.12693,
-  // f 272/367 451/127 452/128 273/368
-  -0.004195, 3.441055, -1.449135,
-  -0.004195, 3.644876, -1.447888,
-  1.221358, 3.582065, -1.12693,
-  // f 274/369 453/129 454/130 275/370
-  -0.004196, 3.785262, -2.281799,
-  1.270262, 3.785054, -2.196725,
-  1.270257, 3.786301, -5.569397,
-  // f 274/369 453/129 454/130 275/370
-  -0.004196, 3.785262, -2.281799,
-  -0.004201, 3.786301, -5.569395,
-  1.270257, 3.786301, -5.569397,
-  // f 486/17 442/167 266/371 276/70
-  1.272977, -3.779196, -3.104479,
-  2.290163, -3.780859, -2.163028,
-  -0.004197, -3.801657, -2.749196,
-  // f 486/17 442/167 266/371 276/70
-  1.272977, -3.779196, -3.104479,
-  -0.004198, -3.886306, -3.599332,
-  -0.004197, -3.801657, -2.749196,
-  // f 441/118 502/176 266/372 267/362
-  2.339904, -3.6047, -2.161987,
-  2.339904, -3.473256, -2.129538,
-  -0.004197, -3.801657, -2.749196,
-  // f 441/118 502/176 266/372 267/362
-  2.339904, -3.6047, -2.161987,
-  -0.004197, -3.823495, -2.780814,
-  -0.004197, -3.801657, -2.749196,
-  // f 266/372 502/176 449/124 270/365
-  -0.004197, -3.801657, -2.749196,
-  2.339904, -3.473256, -2.129538,
-  1.576231, -3.333493, -3.248838,
-  // f 266/372 502/176 449/124 270/365
-  -0.004197, -3.801657, -2.749196,
-  -0.004199, -3.401711, -4.036361,
-  1.576231, -3.333493, -3.248838,
-  // f 487/22 660/71 452/373 434/169
-  2.603866, 3.658186, -2.117475,
-  1.271307, 3.658186, -2.202965,
-  1.221358, 3.582065, -1.12693,
-  // f 487/22 660/71 452/373 434/169
-  2.603866, 3.658186, -2.117475,
-  2.504385, 3.516344, -0.790995,
-  1.221358, 3.582065, -1.12693,
-  // f 435/111 451/127 661/374 503/178
-  2.595926, 3.440015, -0.788707,
-  1.267128, 3.440639, -1.126098,
-  1.267337, 3.015735, -1.095728,
-  // f 435/111 451/127 661/374 503/178
-  2.595926, 3.440015, -0.788707,
-  2.595926, 3.015319, -0.789748,
-  1.267337, 3.015735, -1.095728,
-  // f 503/178 661/374 448/125 430/108
-  2.595926, 3.015319, -0.789748,
-  1.267337, 3.015735, -1.095728,
-  1.571007, 2.522821, -2.580295,
-  // f 503/178 661/374 448/125 430/108
-  2.595926, 3.015319, -0.789748,
-  3.203475, 2.522613, -2.423666,
-  1.571007, 2.522821, -2.580295,
-  // f 663/375 664/378 665/377 666/376
-  0.61088, 0.355664, -1.82189,
-  1.087602, 0.355665, -0.108721,
-  1.216971, 1.085052, -0.108721,
-  // f 663/375 664/378 665/377 666/376
-  0.61088, 0.355664, -1.82189,
-  0.768881, 1.247485, -1.82189,
-  1.216971, 1.085052, -0.108721,
-  // f 666/376 665/377 667/380 668/379
-  0.768881, 1.247485, -1.82189,
-  1.216971, 1.085052, -0.108721,
-  1.588984, 1.726464, -0.108721,
-  // f 666/376 665/377 667/380 668/379
-  0.768881, 1.247485, -1.82189,
-  1.223656, 2.031571, -1.821891,
-  1.588984, 1.726464, -0.108721,
-  // f 668/379 667/380 669/382 670/381
-  1.223656, 2.031571, -1.821891,
-  1.588984, 1.726464, -0.108721,
-  2.159125, 2.202531, -0.108722,
-  // f 668/379 667/380 669/382 670/381
-  1.223656, 2.031571, -1.821891,
-  1.920658, 2.6135, -1.821892,
-  2.159125, 2.202531, -0.108722,
-  // f 670/381 669/382 671/384 672/383
-  1.920658, 2.6135, -1.821892,
-  2.159125, 2.202531, -0.108722,
-  2.858426, 2.455851, -0.108723,
-  // f 670/381 669/382 671/384 672/383
-  1.920658, 2.6135, -1.821892,
-  2.775661, 2.923183, -1.821893,
-  2.858426, 2.455851, -0.108723,
-  // f 672/383 671/384 673/386 674/385
-  2.775661, 2.923183, -1.821893,
-  2.858426, 2.455851, -0.108723,
-  3.602661, 2.455851, -0.108724,
-  // f 672/383 671/384 673/386 674/385
-  2.775661, 2.923183, -1.821893,
-  3.68563, 2.923183, -1.821894,
-  3.602661, 2.455851, -0.108724,
-  // f 674/385 673/386 675/388 676/387
-  3.68563, 2.923183, -1.821894,
-  3.602661, 2.455851, -0.108724,
-  4.302171, 2.202531, -0.108725,
-  // f 674/385 673/386 675/388 676/387
-  3.68563, 2.923183, -1.821894,
-  4.540633, 2.6135, -1.821895,
-  4.302171, 2.202531, -0.108725,
-  // f 676/387 675/388 677/390 678/389
-  4.540633, 2.6135, -1.821895,
-  4.302171, 2.202531, -0.108725,
-  4.872312, 1.726464, -0.108726,
-  // f 676/387 675/388 677/390 678/389
-  4.540633, 2.6135, -1.821895,
-  5.237426, 2.031571, -1.821896,
-  4.872312, 1.726464, -0.108726,
-  // f 678/389 677/390 679/392 680/391
-  5.237426, 2.031571, -1.821896,
-  4.872312, 1.726464, -0.108726,
-  5.244325, 1.085052, -0.108726,
-  // f 678/389 677/390 679/392 680/391
-  5.237426, 2.031571, -1.821896,
-  5.69241, 1.247485, -1.821897,
-  5.244325, 1.085052, -0.108726,
-  // f 680/391 679/392 681/394 682/393
-  5.69241, 1.247485, -1.821897,
-  5.244325, 1.085052, -0.108726,
-  5.373485, 0.355665, -0.108726,
-  // f 680/391 679/392 681/394 682/393
-  5.69241, 1.247485, -1.821897,
-  5.850411, 0.355664, -1.821897,
-  5.373485, 0.355665, -0.108726,
-  // f 682/393 681/394 683/396 684/395
-  5.850411, 0.355664, -1.821897,
-  5.373485, 0.355665, -0.108726,
-  5.244325, -0.373723, -0.108726,
-  // f 682/393 681/394 683/396 684/395
-  5.850411, 0.355664, -1.821897,
-  5.69241, -0.535948, -1.821896,
-  5.244325, -0.373723, -0.108726,
-  // f 684/395 683/396 685/398 686/397
-  5.69241, -0.535948, -1.821896,
-  5.244325, -0.373723, -0.108726,
-  4.872312, -1.015135, -0.108725,
-  // f 684/395 683/396 685/398 686/397
-  5.69241, -0.535948, -1.821896,
-  5.237426, -1.320034, -1.821896,
-  4.872312, -1.015135, -0.108725,
-  // f 686/397 685/398 687/400 688/399
-  5.237426, -1.320034, -1.821896,
-  4.872312, -1.015135, -0.108725,
-  4.302171, -1.491202, -0.108725,
-  // f 686/397 685/398 687/400 688/399
-  5.237426, -1.320034, -1.821896,
-  4.540633, -1.902171, -1.821895,
-  4.302171, -1.491202, -0.108725,
-  // f 688/399 687/400 689/402 690/401
-  4.540633, -1.902171, -1.821895,
-  4.302171, -1.491202, -0.108725,
-  3.602661, -1.744314, -0.108724,
-  // f 688/399 687/400 689/402 690/401
-  4.540633, -1.902171, -1.821895,
-  3.68563, -2.211647, -1.821893,
-  3.602661, -1.744314, -0.108724,
-  // f 690/401 689/402 691/404 692/403
-  3.68563, -2.211647, -1.821893,
-  3.602661, -1.744314, -0.108724,
-  2.858426, -1.744314, -0.108723,
-  // f 690/401 689/402 691/404 692/403
-  3.68563, -2.211647, -1.821893,
-  2.775661, -2.211647, -1.821892,
-  2.858426, -1.744314, -0.108723,
-  // f 692/403 691/404 693/406 694/405
-  2.775661, -2.211647, -1.821892,
-  2.858426, -1.744314, -0.108723,
-  2.159125, -1.491202, -0.108722,
-  // f 692/403 691/404 693/406 694/405
-  2.775661, -2.211647, -1.821892,
-  1.920658, -1.902171, -1.821891,
-  2.159125, -1.491202, -0.108722,
-  // f 694/405 693/406 695/408 696/407
-  1.920658, -1.902171, -1.821891,
-  2.159125, -1.491202, -0.108722,
-  1.588984, -1.015135, -0.108721,
-  // f 694/405 693/406 695/408 696/407
-  1.920658, -1.902171, -1.821891,
-  1.223656, -1.320034, -1.82189,
-  1.588984, -1.015135, -0.108721,
-  // f 696/407 695/408 697/410 698/409
-  1.223656, -1.320034, -1.82189,
-  1.588984, -1.015135, -0.108721,
-  1.216971, -0.373723, -0.108721,
-  // f 696/407 695/408 697/410 698/409
-  1.223656, -1.320034, -1.82189,
-  0.768881, -0.535948, -1.82189,
-  1.216971, -0.373723, -0.108721,
-  // f 698/409 697/410 664/378 663/375
-  0.768881, -0.535948, -1.82189,
-  1.216971, -0.373723, -0.108721,
-  1.087602, 0.355665, -0.108721,
-  // f 698/409 697/410 664/378 663/375
-  0.768881, -0.535948, -1.82189,
-  0.61088, 0.355664, -1.82189,
-  1.087602, 0.355665, -0.108721,
-  // f 699/414 700/427 701/425 702/413
-  1.3315, -0.332127, -0.249336,
-  1.682405, -0.937142, -0.249336,
-  2.220151, -1.385964, -0.249337,
-  // f 699/414 700/427 701/425 702/413
-  1.3315, -0.332127, -0.249336,
-  2.220151, 2.097501, -0.249338,
-  2.220151, -1.385964, -0.249337,
-  // f 701/425 703/426 704/424 705/421
-  2.220151, -1.385964, -0.249337,
-  2.879743, -1.624933, -0.249338,
-  3.581552, -1.624933, -0.249339,
-  // f 701/425 703/426 704/424 705/421
-  2.220151, -1.385964, -0.249337,
-  4.778891, -0.937142, -0.249341,
-  3.581552, -1.624933, -0.249339,
-  // f 704/424 706/423 705/421
-  3.581552, -1.624933, -0.249339,
-  4.241144, -1.385964, -0.24934,
-  4.778891, -0.937142, -0.249341,
-  // f 705/421 707/422 708/420 709/417
-  4.778891, -0.937142, -0.249341,
-  5.129795, -0.332127, -0.249341,
-  5.25164, 0.355664, -0.249341,
-  // f 705/421 707/422 708/420 709/417
-  4.778891, -0.937142, -0.249341,
-  4.778891, 1.648471, -0.249341,
-  5.25164, 0.355664, -0.249341,
-  // f 708/420 710/419 709/417
-  5.25164, 0.355664, -0.249341,
-  5.129795, 1.043664, -0.249341,
-  4.778891, 1.648471, -0.249341,
-  // f 701/425 705/421 709/417 702/413
-  2.220151, -1.385964, -0.249337,
-  4.778891, -0.937142, -0.249341,
-  4.778891, 1.648471, -0.249341,
-  // f 701/425 705/421 709/417 702/413
-  2.220151, -1.385964, -0.249337,
-  2.220151, 2.097501, -0.249338,
-  4.778891, 1.648471, -0.249341,
-  // f 709/417 711/418 712/416 702/413
-  4.778891, 1.648471, -0.249341,
-  4.241144, 2.097501, -0.24934,
-  3.581552, 2.33647, -0.249339,
-  // f 709/417 711/418 712/416 702/413
-  4.778891, 1.648471, -0.249341,
-  2.220151, 2.097501, -0.249338,
-  3.581552, 2.33647, -0.249339,
-  // f 712/416 713/415 702/413
-  3.581552, 2.33647, -0.249339,
-  2.879743, 2.33647, -0.249338,
-  2.220151, 2.097501, -0.249338,
-  // f 702/413 714/412 715/411 699/414
-  2.220151, 2.097501, -0.249338,
-  1.682405, 1.648471, -0.249337,
-  1.3315, 1.043664, -0.249336,
-  // f 702/413 714/412 715/411 699/414
-  2.220151, 2.097501, -0.249338,
-  1.3315, -0.332127, -0.249336,
-  1.3315, 1.043664, -0.249336,
-  // f 716/428 699/414 715/411
-  1.209656, 0.355664, -0.249336,
-  1.3315, -0.332127, -0.249336,
-  1.3315, 1.043664, -0.249336,
-  // f 664/378 717/430 718/429 665/377
-  1.087602, 0.355665, -0.108721,
-  1.209656, 0.355665, -0.108721,
-  1.3315, 1.043664, -0.108721,
-  // f 664/378 717/430 718/429 665/377
-  1.087602, 0.355665, -0.108721,
-  1.216971, 1.085052, -0.108721,
-  1.3315, 1.043664, -0.108721,
-  // f 665/377 718/429 719/431 667/380
-  1.216971, 1.085052, -0.108721,
-  1.3315, 1.043664, -0.108721,
-  1.682405, 1.648471, -0.108722,
-  // f 665/377 718/429 719/431 667/380
-  1.216971, 1.085052, -0.108721,
-  1.588984, 1.726464, -0.108721,
-  1.682405, 1.648471, -0.108722,
-  // f 667/380 719/431 720/432 669/382
-  1.588984, 1.726464, -0.108721,
-  1.682405, 1.648471, -0.108722,
-  2.220152, 2.097501, -0.108722,
-  // f 667/380 719/431 720/432 669/382
-  1.588984, 1.726464, -0.108721,
-  2.159125, 2.202531, -0.108722,
-  2.220152, 2.097501, -0.108722,
-  // f 669/382 720/432 721/433 671/384
-  2.159125, 2.202531, -0.108722,
-  2.220152, 2.097501, -0.108722,
-  2.879743, 2.33647, -0.108723,
-  // f 669/382 720/432 721/433 671/384
-  2.159125, 2.202531, -0.108722,
-  2.858426, 2.455851, -0.108723,
-  2.879743, 2.33647, -0.108723,
-  // f 671/384 721/433 722/434 673/386
-  2.858426, 2.455851, -0.108723,
-  2.879743, 2.33647, -0.108723,
-  3.581552, 2.33647, -0.108724,
-  // f 671/384 721/433 722/434 673/386
-  2.858426, 2.455851, -0.108723,
-  3.602661, 2.455851, -0.108724,
-  3.581552, 2.33647, -0.108724,
-  // f 673/386 722/434 723/435 675/388
-  3.602661, 2.455851, -0.108724,
-  3.581552, 2.33647, -0.108724,
-  4.241144, 2.097501, -0.108725,
-  // f 673/386 722/434 723/435 675/388
-  3.602661, 2.455851, -0.108724,
-  4.302171, 2.202531, -0.108725,
-  4.241144, 2.097501, -0.108725,
-  // f 675/388 723/435 724/436 677/390
-  4.302171, 2.202531, -0.108725,
-  4.241144, 2.097501, -0.108725,
-  4.778891, 1.648471, -0.108726,
-  // f 675/388 723/435 724/436 677/390
-  4.302171, 2.202531, -0.108725,
-  4.872312, 1.726464, -0.108726,
-  4.778891, 1.648471, -0.108726,
-  // f 677/390 724/436 725/437 679/392
-  4.872312, 1.726464, -0.108726,
-  4.778891, 1.648471, -0.108726,
-  5.129795, 1.043664, -0.108726,
-  // f 677/390 724/436 725/437 679/392
-  4.872312, 1.726464, -0.108726,
-  5.244325, 1.085052, -0.108726,
-  5.129795, 1.043664, -0.108726,
-  // f 679/392 725/437 726/438 681/394
-  5.244325, 1.085052, -0.108726,
-  5.129795, 1.043664, -0.108726,
-  5.25164, 0.355665, -0.108726,
-  // f 679/392 725/437 726/438 681/394
-  5.244325, 1.085052, -0.108726,
-  5.373485, 0.355665, -0.108726,
-  5.25164, 0.355665, -0.108726,
-  // f 681/394 726/438 727/439 683/396
-  5.373485, 0.355665, -0.108726,
-  5.25164, 0.355665, -0.108726,
-  5.129795, -0.332127, -0.108726,
-  // f 681/394 726/438 727/439 683/396
-  5.373485, 0.355665, -0.108726,
-  5.244325, -0.373723, -0.108726,
-  5.129795, -0.332127, -0.108726,
-  // f 683/396 727/439 728/440 685/398
-  5.244325, -0.373723, -0.108726,
-  5.129795, -0.332127, -0.108726,
-  4.778891, -0.937142, -0.108725,
-  // f 683/396 727/439 728/440 685/398
-  5.244325, -0.373723, -0.108726,
-  4.872312, -1.015135, -0.108725,
-  4.778891, -0.937142, -0.108725,
-  // f 685/398 728/440 729/441 687/400
-  4.872312, -1.015135, -0.108725,
-  4.778891, -0.937142, -0.108725,
-  4.241144, -1.385964, -0.108725,
-  // f 685/398 728/440 729/441 687/400
-  4.872312, -1.015135, -0.108725,
-  4.302171, -1.491202, -0.108725,
-  4.241144, -1.385964, -0.108725,
-  // f 687/400 729/441 730/442 689/402
-  4.302171, -1.491202, -0.108725,
-  4.241144, -1.385964, -0.108725,
-  3.581552, -1.624933, -0.108724,
-  // f 687/400 729/441 730/442 689/402
-  4.302171, -1.491202, -0.108725,
-  3.602661, -1.744314, -0.108724,
-  3.581552, -1.624933, -0.108724,
-  // f 689/402 730/442 731/443 691/404
-  3.602661, -1.744314, -0.108724,
-  3.581552, -1.624933, -0.108724,
-  2.879743, -1.624933, -0.108723,
-  // f 689/402 730/442 731/443 691/404
-  3.602661, -1.744314, -0.108724,
-  2.858426, -1.744314, -0.108723,
-  2.879743, -1.624933, -0.108723,
-  // f 691/404 731/443 732/444 693/406
-  2.858426, -1.744314, -0.108723,
-  2.879743, -1.624933, -0.108723,
-  2.220152, -1.385964, -0.108722,
-  // f 691/404 731/443 732/444 693/406
-  2.858426, -1.744314, -0.108723,
-  2.159125, -1.491202, -0.108722,
-  2.220152, -1.385964, -0.108722,
-  // f 693/406 732/444 733/445 695/408
-  2.159125, -1.491202, -0.108722,
-  2.220152, -1.385964, -0.108722,
-  1.682405, -0.937142, -0.108721,
-  // f 693/406 732/444 733/445 695/408
-  2.159125, -1.491202, -0.108722,
-  1.588984, -1.015135, -0.108721,
-  1.682405, -0.937142, -0.108721,
-  // f 695/408 733/445 734/446 697/410
-  1.588984, -1.015135, -0.108721,
-  1.682405, -0.937142, -0.108721,
-  1.3315, -0.332127, -0.108721,
-  // f 695/408 733/445 734/446 697/410
-  1.588984, -1.015135, -0.108721,
-  1.216971, -0.373723, -0.108721,
-  1.3315, -0.332127, -0.108721,
-  // f 697/410 734/446 717/430 664/378
-  1.216971, -0.373723, -0.108721,
-  1.3315, -0.332127, -0.108721,
-  1.209656, 0.355665, -0.108721,
-  // f 697/410 734/446 717/430 664/378
-  1.216971, -0.373723, -0.108721,
-  1.087602, 0.355665, -0.108721,
-  1.209656, 0.355665, -0.108721,
-  // f 717/430 716/448 715/447 718/429
-  1.209656, 0.355665, -0.108721,
-  1.209656, 0.355664, -0.249336,
-  1.3315, 1.043664, -0.249336,
-  // f 717/430 716/448 715/447 718/429
-  1.209656, 0.355665, -0.108721,
-  1.3315, 1.043664, -0.108721,
-  1.3315, 1.043664, -0.249336,
-  // f 718/429 715/447 714/449 719/431
-  1.3315, 1.043664, -0.108721,
-  1.3315, 1.043664, -0.249336,
-  1.682405, 1.648471, -0.249337,
-  // f 718/429 715/447 714/449 719/431
-  1.3315, 1.043664, -0.108721,
-  1.682405, 1.648471, -0.108722,
-  1.682405, 1.648471, -0.249337,
-  // f 719/431 714/449 702/450 720/432
-  1.682405, 1.648471, -0.108722,
-  1.682405, 1.648471, -0.249337,
-  2.220151, 2.097501, -0.249338,
-  // f 719/431 714/449 702/450 720/432
-  1.682405, 1.648471, -0.108722,
-  2.220152, 2.097501, -0.108722,
-  2.220151, 2.097501, -0.249338,
-  // f 720/432 702/450 713/451 721/433
-  2.220152, 2.097501, -0.108722,
-  2.220151, 2.097501, -0.249338,
-  2.879743, 2.33647, -0.249338,
-  // f 720/432 702/450 713/451 721/433
-  2.220152, 2.097501, -0.108722,
-  2.879743, 2.33647, -0.108723,
-  2.879743, 2.33647, -0.249338,
-  // f 721/433 713/451 712/452 722/434
-  2.879743, 2.33647, -0.108723,
-  2.879743, 2.33647, -0.249338,
-  3.581552, 2.33647, -0.249339,
-  // f 721/433 713/451 712/452 722/434
-  2.879743, 2.33647, -0.108723,
-  3.581552, 2.33647, -0.108724,
-  3.581552, 2.33647, -0.249339,
-  // f 722/434 712/452 711/453 723/435
-  3.581552, 2.33647, -0.108724,
-  3.581552, 2.33647, -0.249339,
-  4.241144, 2.097501, -0.24934,
-  // f 722/434 712/452 711/453 723/435
-  3.581552, 2.33647, -0.108724,
-  4.241144, 2.097501, -0.108725,
-  4.241144, 2.097501, -0.24934,
-  // f 723/435 711/453 709/454 724/436
-  4.241144, 2.097501, -0.108725,
-  4.241144, 2.097501, -0.24934,
-  4.778891, 1.648471, -0.249341,
-  // f 723/435 711/453 709/454 724/436
-  4.241144, 2.097501, -0.108725,
-  4.778891, 1.648471, -0.108726,
-  4.778891, 1.648471, -0.249341,
-  // f 724/436 709/454 710/455 725/437
-  4.778891, 1.648471, -0.108726,
-  4.778891, 1.648471, -0.249341,
-  5.129795, 1.043664, -0.249341,
-  // f 724/436 709/454 710/455 725/437
-  4.778891, 1.648471, -0.108726,
-  5.129795, 1.043664, -0.108726,
-  5.129795, 1.043664, -0.249341,
-  // f 725/437 710/455 708/456 726/438
-  5.129795, 1.043664, -0.108726,
-  5.129795, 1.043664, -0.249341,
-  5.25164, 0.355664, -0.249341,
-  // f 725/437 710/455 708/456 726/438
-  5.129795, 1.043664, -0.108726,
-  5.25164, 0.355665, -0.108726,
-  5.25164, 0.355664, -0.249341,
-  // f 726/438 708/456 707/457 727/439
-  5.25164, 0.355665, -0.108726,
-  5.25164, 0.355664, -0.249341,
-  5.129795, -0.332127, -0.249341,
-  // f 726/438 708/456 707/457 727/439
-  5.25164, 0.355665, -0.108726,
-  5.129795, -0.332127, -0.108726,
-  5.129795, -0.332127, -0.249341,
-  // f 727/439 707/457 705/458 728/440
-  5.129795, -0.332127, -0.108726,
-  5.129795, -0.332127, -0.249341,
-  4.778891, -0.937142, -0.249341,
-  // f 727/439 707/457 705/458 728/440
-  5.129795, -0.332127, -0.108726,
-  4.778891, -0.937142, -0.108725,
-  4.778891, -0.937142, -0.249341,
-  // f 728/440 705/458 706/459 729/441
-  4.778891, -0.937142, -0.108725,
-  4.778891, -0.937142, -0.249341,
-  4.241144, -1.385964, -0.24934,
-  // f 728/440 705/458 706/459 729/441
-  4.778891, -0.937142, -0.108725,
-  4.241144, -1.385964, -0.108725,
-  4.241144, -1.385964, -0.24934,
-  // f 729/441 706/459 704/460 730/442
-  4.241144, -1.385964, -0.108725,
-  4.241144, -1.385964, -0.24934,
-  3.581552, -1.624933, -0.249339,
-  // f 729/441 706/459 704/460 730/442
-  4.241144, -1.385964, -0.108725,
-  3.581552, -1.624933, -0.108724,
-  3.581552, -1.624933, -0.249339,
-  // f 730/442 704/460 703/461 731/443
-  3.581552, -1.624933, -0.108724,
-  3.581552, -1.624933, -0.249339,
-  2.879743, -1.624933, -0.249338,
-  // f 730/442 704/460 703/461 731/443
-  3.581552, -1.624933, -0.108724,
-  2.879743, -1.624933, -0.108723,
-  2.879743, -1.624933, -0.249338,
-  // f 731/443 703/461 701/462 732/444
-  2.879743, -1.624933, -0.108723,
-  2.879743, -1.624933, -0.249338,
-  2.220151, -1.385964, -0.249337,
-  // f 731/443 703/461 701/462 732/444
-  2.879743, -1.624933, -0.108723,
-  2.220152, -1.385964, -0.108722,
-  2.220151, -1.385964, -0.249337,
-  // f 732/444 701/462 700/463 733/445
-  2.220152, -1.385964, -0.108722,
-  2.220151, -1.385964, -0.249337,
-  1.682405, -0.937142, -0.249336,
-  // f 732/444 701/462 700/463 733/445
-  2.220152, -1.385964, -0.108722,
-  1.682405, -0.937142, -0.108721,
-  1.682405, -0.937142, -0.249336,
-  // f 733/445 700/463 699/464 734/446
-  1.682405, -0.937142, -0.108721,
-  1.682405, -0.937142, -0.249336,
-  1.3315, -0.332127, -0.249336,
-  // f 733/445 700/463 699/464 734/446
-  1.682405, -0.937142, -0.108721,
-  1.3315, -0.332127, -0.108721,
-  1.3315, -0.332127, -0.249336,
-  // f 734/446 699/464 716/448 717/430
-  1.3315, -0.332127, -0.108721,
-  1.3315, -0.332127, -0.249336,
-  1.209656, 0.355664, -0.249336,
-  // f 734/446 699/464 716/448 717/430
-  1.3315, -0.332127, -0.108721,
-  1.209656, 0.355665, -0.108721,
-  1.209656, 0.355664, -0.249336,
-  // f 735/465 736/468 355/467 354/466
-  2.400716, 4.84929, -6.468626,
-  2.396744, 4.254881, -7.055836,
-  -0.004203, 4.298349, -7.055418,
-  // f 735/465 736/468 355/467 354/466
-  2.400716, 4.84929, -6.468626,
-  -0.004202, 4.90482, -6.471326,
-  -0.004203, 4.298349, -7.055418,
-  // f 357/469 355/467 736/468 737/470
-  -0.004203, 3.776318, -7.077674,
-  -0.004203, 4.298349, -7.055418,
-  2.396744, 4.254881, -7.055836,
-  // f 357/469 355/467 736/468 737/470
-  -0.004203, 3.776318, -7.077674,
-  2.39549, 3.733474, -7.077677,
-  2.396744, 4.254881, -7.055836,
-  // f 735/465 354/466 360/472 738/471
-  2.400716, 4.84929, -6.468626,
-  -0.004202, 4.90482, -6.471326,
-  -0.004201, 5.146286, -5.942773,
-  // f 735/465 354/466 360/472 738/471
-  2.400716, 4.84929, -6.468626,
-  2.402598, 5.07994, -5.938408,
-  -0.004201, 5.146286, -5.942773,
-  // f 361/473 357/469 739/475 740/474
-  -0.004203, 0.887261, -7.077673,
-  -0.004203, 3.776318, -7.077674,
-  2.199034, 1.044703, -7.077676,
-  // f 361/473 357/469 739/475 740/474
-  -0.004203, 0.887261, -7.077673,
-  2.015117, 0.874575, -7.077676,
-  2.199034, 1.044703, -7.077676,
-  // f 739/475 357/469 737/470
-  2.199034, 1.044703, -7.077676,
-  -0.004203, 3.776318, -7.077674,
-  2.39549, 3.733474, -7.077677,
-  // f 364/476 741/479 742/478 365/477
-  -0.004202, 4.188536, -6.794364,
-  2.394864, 4.145483, -6.794368,
-  2.395073, 4.614064, -6.311161,
-  // f 364/476 741/479 742/478 365/477
-  -0.004202, 4.188536, -6.794364,
-  -0.004202, 4.671259, -6.311158,
-  2.395073, 4.614064, -6.311161,
-  // f 741/479 364/476 369/481 743/480
-  2.394864, 4.145483, -6.794368,
-  -0.004202, 4.188536, -6.794364,
-  -0.004202, 3.776318, -6.794364,
-  // f 741/479 364/476 369/481 743/480
-  2.394864, 4.145483, -6.794368,
-  2.39549, 3.733475, -6.794368,
-  -0.004202, 3.776318, -6.794364,
-  // f 370/482 365/477 742/478 744/483
-  -0.004201, 4.887558, -5.827744,
-  -0.004202, 4.671259, -6.311158,
-  2.395073, 4.614064, -6.311161,
-  // f 370/482 365/477 742/478 744/483
-  -0.004201, 4.887558, -5.827744,
-  2.395074, 4.819341, -5.827746,
-  2.395073, 4.614064, -6.311161,
-  // f 745/484 369/481 374/486 746/485
-  2.199034, 1.044703, -6.794367,
-  -0.004202, 3.776318, -6.794364,
-  -0.004202, 0.887261, -6.794364,
-  // f 745/484 369/481 374/486 746/485
-  2.199034, 1.044703, -6.794367,
-  2.015118, 0.874575, -6.794367,
-  -0.004202, 0.887261, -6.794364,
-  // f 369/481 745/484 743/480
-  -0.004202, 3.776318, -6.794364,
-  2.199034, 1.044703, -6.794367,
-  2.39549, 3.733475, -6.794368,
-  // f 741/487 736/468 735/465 742/488
-  2.394864, 4.145483, -6.794368,
-  2.396744, 4.254881, -7.055836,
-  2.400716, 4.84929, -6.468626,
-  // f 741/487 736/468 735/465 742/488
-  2.394864, 4.145483, -6.794368,
-  2.395073, 4.614064, -6.311161,
-  2.400716, 4.84929, -6.468626,
-  // f 743/489 737/470 736/468 741/487
-  2.39549, 3.733475, -6.794368,
-  2.39549, 3.733474, -7.077677,
-  2.396744, 4.254881, -7.055836,
-  // f 743/489 737/470 736/468 741/487
-  2.39549, 3.733475, -6.794368,
-  2.394864, 4.145483, -6.794368,
-  2.396744, 4.254881, -7.055836,
-  // f 742/488 735/465 738/471 744/490
-  2.395073, 4.614064, -6.311161,
-  2.400716, 4.84929, -6.468626,
-  2.402598, 5.07994, -5.938408,
-  // f 742/488 735/465 738/471 744/490
-  2.395073, 4.614064, -6.311161,
-  2.395074, 4.819341, -5.827746,
-  2.402598, 5.07994, -5.938408,
-  // f 744/490 738/471 360/472 370/491
-  2.395074, 4.819341, -5.827746,
-  2.402598, 5.07994, -5.938408,
-  -0.004201, 5.146286, -5.942773,
-  // f 744/490 738/471 360/472 370/491
-  2.395074, 4.819341, -5.827746,
-  -0.004201, 4.887558, -5.827744,
-  -0.004201, 5.146286, -5.942773,
-  // f 374/492 361/473 740/474 746/493
-  -0.004202, 0.887261, -6.794364,
-  -0.004203, 0.887261, -7.077673,
-  2.015117, 0.874575, -7.077676,
-  // f 374/492 361/473 740/474 746/493
-  -0.004202, 0.887261, -6.794364,
-  2.015118, 0.874575, -6.794367,
-  2.015117, 0.874575, -7.077676,
-  // f 746/493 740/474 739/475 745/494
-  2.015118, 0.874575, -6.794367,
-  2.015117, 0.874575, -7.077676,
-  2.199034, 1.044703, -7.077676,
-  // f 746/493 740/474 739/475 745/494
-  2.015118, 0.874575, -6.794367,
-  2.199034, 1.044703, -6.794367,
-  2.199034, 1.044703, -7.077676,
-  // f 745/494 739/475 737/470 743/489
-  2.199034, 1.044703, -6.794367,
-  2.199034, 1.044703, -7.077676,
-  2.39549, 3.733474, -7.077677,
-  // f 745/494 739/475 737/470 743/489
-  2.199034, 1.044703, -6.794367,
-  2.39549, 3.733475, -6.794368,
-  2.39549, 3.733474, -7.077677,
-  // f 747/495 748/498 749/497 750/496
-  1.21111, 3.942079, -6.857602,
-  1.345913, 4.540646, -6.460095,
-  1.13629, 4.263824, -6.227747,
-  // f 747/495 748/498 749/497 750/496
-  1.21111, 3.942079, -6.857602,
-  1.068784, 3.754064, -6.69993,
-  1.13629, 4.263824, -6.227747,
-  // f 751/499 752/502 753/501 754/500
-  0.642013, 3.942079, -6.857601,
-  0.784131, 3.754064, -6.69993,
-  0.716835, 4.263824, -6.227747,
-  // f 751/499 752/502 753/501 754/500
-  0.642013, 3.942079, -6.857601,
-  0.507211, 4.540646, -6.460093,
-  0.716835, 4.263824, -6.227747,
-  // f 755/503 751/499 754/500 756/504
-  0.78413, 4.129885, -7.015273,
-  0.642013, 3.942079, -6.857601,
-  0.507211, 4.540646, -6.460093,
-  // f 755/503 751/499 754/500 756/504
-  0.78413, 4.129885, -7.015273,
-  0.716834, 4.817468, -6.692441,
-  0.507211, 4.540646, -6.460093,
-  // f 757/505 755/503 756/504 758/506
-  1.068783, 4.129885, -7.015273,
-  0.78413, 4.129885, -7.015273,
-  0.716834, 4.817468, -6.692441,
-  // f 757/505 755/503 756/504 758/506
-  1.068783, 4.129885, -7.015273,
-  1.136289, 4.817468, -6.692442,
-  0.716834, 4.817468, -6.692441,
-  // f 757/505 758/506 748/498 747/495
-  1.068783, 4.129885, -7.015273,
-  1.136289, 4.817468, -6.692442,
-  1.345913, 4.540646, -6.460095,
-  // f 757/505 758/506 748/498 747/495
-  1.068783, 4.129885, -7.015273,
-  1.21111, 3.942079, -6.857602,
-  1.345913, 4.540646, -6.460095,
-  // f 759/510 760/511 761/509 762/507
-  1.114136, 5.387127, -6.270598,
-  0.738779, 5.387127, -6.270598,
-  0.551101, 5.139422, -6.062588,
-  // f 759/510 760/511 761/509 762/507
-  1.114136, 5.387127, -6.270598,
-  1.114137, 4.89151, -5.854578,
-  0.551101, 5.139422, -6.062588,
-  // f 761/509 763/508 762/507
-  0.551101, 5.139422, -6.062588,
-  0.73878, 4.89151, -5.854578,
-  1.114137, 4.89151, -5.854578,
-  // f 764/512 759/510 762/507
-  1.301815, 5.139422, -6.062589,
-  1.114136, 5.387127, -6.270598,
-  1.114137, 4.89151, -5.854578,
-  // f 762/513 749/497 748/498 764/514
-  1.114137, 4.89151, -5.854578,
-  1.13629, 4.263824, -6.227747,
-  1.345913, 4.540646, -6.460095,
-  // f 762/513 749/497 748/498 764/514
-  1.114137, 4.89151, -5.854578,
-  1.301815, 5.139422, -6.062589,
-  1.345913, 4.540646, -6.460095,
-  // f 763/508 753/516 749/515 762/507
-  0.73878, 4.89151, -5.854578,
-  0.716835, 4.263824, -6.227747,
-  1.13629, 4.263824, -6.227747,
-  // f 763/508 753/516 749/515 762/507
-  0.73878, 4.89151, -5.854578,
-  1.114137, 4.89151, -5.854578,
-  1.13629, 4.263824, -6.227747,
-  // f 754/500 753/501 763/518 761/517
-  0.507211, 4.540646, -6.460093,
-  0.716835, 4.263824, -6.227747,
-  0.73878, 4.89151, -5.854578,
-  // f 754/500 753/501 763/518 761/517
-  0.507211, 4.540646, -6.460093,
-  0.551101, 5.139422, -6.062588,
-  0.73878, 4.89151, -5.854578,
-  // f 756/504 754/500 761/517 760/519
-  0.716834, 4.817468, -6.692441,
-  0.507211, 4.540646, -6.460093,
-  0.551101, 5.139422, -6.062588,
-  // f 756/504 754/500 761/517 760/519
-  0.716834, 4.817468, -6.692441,
-  0.738779, 5.387127, -6.270598,
-  0.551101, 5.139422, -6.062588,
-  // f 759/520 758/506 756/504 760/519
-  1.114136, 5.387127, -6.270598,
-  1.136289, 4.817468, -6.692442,
-  0.716834, 4.817468, -6.692441,
-  // f 759/520 758/506 756/504 760/519
-  1.114136, 5.387127, -6.270598,
-  0.738779, 5.387127, -6.270598,
-  0.716834, 4.817468, -6.692441,
-  // f 764/514 748/498 758/506 759/520
-  1.301815, 5.139422, -6.062589,
-  1.345913, 4.540646, -6.460095,
-  1.136289, 4.817468, -6.692442,
-  // f 764/514 748/498 758/506 759/520
-  1.301815, 5.139422, -6.062589,
-  1.114136, 5.387127, -6.270598,
-  1.136289, 4.817468, -6.692442,
-  // f 660/71 393/77 273/521 452/373
-  1.271307, 3.658186, -2.202965,
-  -0.004196, 3.658394, -2.284711,
-  -0.004195, 3.644876, -1.447888,
-  // f 660/71 393/77 273/521 452/373
-  1.271307, 3.658186, -2.202965,
-  1.221358, 3.582065, -1.12693,
-  -0.004195, 3.644876, -1.447888,
-  // f 451/127 272/367 394/522 661/374
-  1.267128, 3.440639, -1.126098,
-  -0.004195, 3.441055, -1.449135,
-  -0.004195, 3.016151, -1.388605,
-  // f 451/127 272/367 394/522 661/374
-  1.267128, 3.440639, -1.126098,
-  1.267337, 3.015735, -1.095728,
-  -0.004195, 3.016151, -1.388605,
-  // f 394/522 271/366 448/125 661/374
-  -0.004195, 3.016151, -1.388605,
-  -0.004197, 2.523028, -2.731308,
-  1.571007, 2.522821, -2.580295,
-  // f 394/522 271/366 448/125 661/374
-  -0.004195, 3.016151, -1.388605,
-  1.267337, 3.015735, -1.095728,
-  1.571007, 2.522821, -2.580295,
-  // f 525/203 396/524 395/523 526/202
-  2.409713, 4.310621, 0.974592,
-  -0.004193, 4.329755, 0.259041,
-  -0.004193, 2.767406, 0.35535,
-  // f 525/203 396/524 395/523 526/202
-  2.409713, 4.310621, 0.974592,
-  2.39153, 2.808586, 0.971472,
-  -0.004193, 2.767406, 0.35535,
-  // f 395/525 138/220 539/217 526/245
-  -0.004193, 2.767406, 0.35535,
-  -0.004195, 2.715619, -1.560421,
-  2.562904, 2.785501, -1.136917,
-  // f 395/525 138/220 539/217 526/245
-  -0.004193, 2.767406, 0.35535,
-  2.39153, 2.808586, 0.971472,
-  2.562904, 2.785501, -1.136917,
-  // f 556/242 154/239 396/524 525/203
-  2.428313, 4.518186, 0.826489,
-  -0.004193, 4.528585, 0.089097,
-  -0.004193, 4.329755, 0.259041,
-  // f 556/242 154/239 396/524 525/203
-  2.428313, 4.518186, 0.826489,
-  2.409713, 4.310621, 0.974592,
-  -0.004193, 4.329755, 0.259041,
-  // f 567/266 398/527 397/526 568/269
-  2.65256, 3.435647, -3.949001,
-  -0.004199, 3.419216, -3.948998,
-  -0.004196, 3.415889, -1.770927,
-  // f 567/266 398/527 397/526 568/269
-  2.65256, 3.435647, -3.949001,
-  2.652562, 3.432319, -1.770931,
-  -0.004196, 3.415889, -1.770927,
-  // f 567/266 570/267 572/270 576/274
-  2.65256, 3.435647, -3.949001,
-  3.743937, 3.435647, -3.949003,
-  4.76969, 3.064193, -3.949629,
-  // f 567/266 570/267 572/270 576/274
-  2.65256, 3.435647, -3.949001,
-  6.151363, 1.425515, -3.953166,
-  4.76969, 3.064193, -3.949629,
-  // f 572/270 574/272 576/274
-  4.76969, 3.064193, -3.949629,
-  5.605674, 2.366003, -3.951086,
-  6.151363, 1.425515, -3.953166,
-  // f 576/274 578/276 580/278 584/282
-  6.151363, 1.425515, -3.953166,
-  6.340922, 0.355872, -3.955246,
-  6.151363, -0.713772, -3.957534,
-  // f 576/274 578/276 580/278 584/282
-  6.151363, 1.425515, -3.953166,
-  4.76969, -2.35245, -3.96086,
-  6.151363, -0.713772, -3.957534,
-  // f 580/278 582/280 584/282
-  6.151363, -0.713772, -3.957534,
-  5.605674, -1.654259, -3.959405,
-  4.76969, -2.35245, -3.96086,
-  // f 567/266 576/274 584/282 592/290
-  2.65256, 3.435647, -3.949001,
-  6.151363, 1.425515, -3.953166,
-  4.76969, -2.35245, -3.96086,
-  // f 567/266 576/274 584/282 592/290
-  2.65256, 3.435647, -3.949001,
-  0.716629, -1.719981, -3.959607,
-  4.76969, -2.35245, -3.96086,
-  // f 584/282 586/284 588/286 592/290
-  4.76969, -2.35245, -3.96086,
-  3.743937, -2.723903, -3.961691,
-  2.65256, -2.723903, -3.961689,
-  // f 584/282 586/284 588/286 592/290
-  4.76969, -2.35245, -3.96086,
-  0.716629, -1.719981, -3.959607,
-  2.65256, -2.723903, -3.961689,
-  // f 588/286 590/288 592/290
-  2.65256, -2.723903, -3.961689,
-  1.627016, -2.35245, -3.960856,
-  0.716629, -1.719981, -3.959607,
-  // f 398/527 567/266 592/290 193/292
-  -0.004199, 3.419216, -3.948998,
-  2.65256, 3.435647, -3.949001,
-  0.716629, -1.719981, -3.959607,
-  // f 398/527 567/266 592/290 193/292
-  -0.004199, 3.419216, -3.948998,
-  -0.004199, -1.080025, -3.958358,
-  0.716629, -1.719981, -3.959607,
-  // f 626/528 400/531 399/530 625/529
-  1.04183, 1.133719, -1.775712,
-  -0.004196, 1.39931, -1.775087,
-  -0.004196, 0.352545, -1.777375,
-  // f 626/528 400/531 399/530 625/529
-  1.04183, 1.133719, -1.775712,
-  0.903265, 0.352545, -1.777376,
-  -0.004196, 0.352545, -1.777375,
-  // f 627/532 401/533 400/531 626/528
-  1.440176, 1.820471, -1.774257,
-  -0.004196, 2.327943, -1.773214,
-  -0.004196, 1.39931, -1.775087,
-  // f 627/532 401/533 400/531 626/528
-  1.440176, 1.820471, -1.774257,
-  1.04183, 1.133719, -1.775712,
-  -0.004196, 1.39931, -1.775087,
-  // f 628/534 402/535 401/533 627/532
-  2.050863, 2.330439, -1.773217,
-  -0.004196, 3.360774, -1.771134,
-  -0.004196, 2.327943, -1.773214,
-  // f 628/534 402/535 401/533 627/532
-  2.050863, 2.330439, -1.773217,
-  1.440176, 1.820471, -1.774257,
-  -0.004196, 2.327943, -1.773214,
-  // f 628/534 611/313 568/269 402/535
-  2.050863, 2.330439, -1.773217,
-  2.799905, 2.601645, -1.772594,
-  2.652562, 3.432319, -1.770931,
-  // f 628/534 611/313 568/269 402/535
-  2.050863, 2.330439, -1.773217,
-  -0.004196, 3.360774, -1.771134,
-  2.652562, 3.432319, -1.770931,
-  // f 397/526 402/535 568/269
-  -0.004196, 3.415889, -1.770927,
-  -0.004196, 3.360774, -1.771134,
-  2.652562, 3.432319, -1.770931,
-  // f 399/530 226/325 624/326 625/529
-  -0.004196, 0.352545, -1.777375,
-  -0.004196, -0.989553, -1.780079,
-  1.04183, -0.42863, -1.77904,
-  // f 399/530 226/325 624/326 625/529
-  -0.004196, 0.352545, -1.777375,
-  0.903265, 0.352545, -1.777376,
-  1.04183, -0.42863, -1.77904,
-  // f 404/536 233/537 630/352 638/32
-  -0.004197, 4.792511, -2.350234,
-  -0.004197, 5.040009, -2.349818,
-  1.407781, 4.9173, -2.350029,
-  // f 404/536 233/537 630/352 638/32
-  -0.004197, 4.792511, -2.350234,
-  1.407781, 4.670011, -2.350653,
-  1.407781, 4.9173, -2.350029,
-  // f 765/538 766/539 767/540 768/541
-  -8.268326, 1.174483, -6.959513,
-  -8.077513, 1.361457, -6.959513,
-  -8.077513, -0.941095, -6.959513,
-  // f 765/538 766/539 767/540 768/541
-  -8.268326, 1.174483, -6.959513,
-  -8.268326, -0.75412, -6.959513,
-  -8.077513, -0.941095, -6.959513,
-  // f 769/542 770/543 771/544 772/545
-  -7.245708, 4.013208, -6.959515,
-  -3.922043, 4.193735, -6.959519,
-  -3.926014, 3.834137, -6.959519,
-  // f 769/542 770/543 771/544 772/545
-  -7.245708, 4.013208, -6.959515,
-  -8.036549, 3.665673, -6.959514,
-  -3.926014, 3.834137, -6.959519,
-  // f 766/539 773/546 774/547 767/540
-  -8.077513, 1.361457, -6.959513,
-  -3.926014, 1.418859, -6.959519,
-  -3.926014, -0.996418, -6.959518,
-  // f 766/539 773/546 774/547 767/540
-  -8.077513, 1.361457, -6.959513,
-  -8.077513, -0.941095, -6.959513,
-  -3.926014, -0.996418, -6.959518,
-  // f 775/548 776/549 777/550 778/551
-  -8.329352, -0.728954, -6.934136,
-  -8.868562, -0.789269, -6.502723,
-  -8.868562, 1.210879, -6.502723,
-  // f 775/548 776/549 777/550 778/551
-  -8.329352, -0.728954, -6.934136,
-  -8.329352, 1.149525, -6.934137,
-  -8.868562, 1.210879, -6.502723,
-  // f 779/552 780/553 781/554 782/555
-  -8.106563, -3.259869, -6.935593,
-  -7.280192, -3.657736, -6.937464,
-  -7.75524, -4.135467, -6.502724,
-  // f 779/552 780/553 781/554 782/555
-  -8.106563, -3.259869, -6.935593,
-  -8.633441, -3.551873, -6.502723,
-  -7.75524, -4.135467, -6.502724,
-  // f 783/556 784/557 785/558 786/559
-  -8.104473, 3.681688, -6.934137,
-  -8.328516, 3.027589, -6.93476,
-  -8.868562, 3.211027, -6.502723,
-  // f 783/556 784/557 785/558 786/559
-  -8.104473, 3.681688, -6.934137,
-  -8.563846, 3.980348, -6.502724,
-  -8.868562, 3.211027, -6.502723,
-  // f 779/552 782/555 787/560 788/561
-  -8.106563, -3.259869, -6.935593,
-  -8.633441, -3.551873, -6.502723,
-  -8.868562, -2.789417, -6.502722,
-  // f 779/552 782/555 787/560 788/561
-  -8.106563, -3.259869, -6.935593,
-  -8.328516, -2.607226, -6.934759,
-  -8.868562, -2.789417, -6.502722,
-  // f 783/556 786/559 789/562 790/563
-  -8.104473, 3.681688, -6.934137,
-  -8.563846, 3.980348, -6.502724,
-  -7.617511, 4.464109, -6.502725,
-  // f 783/556 786/559 789/562 790/563
-  -8.104473, 3.681688, -6.934137,
-  -7.276848, 4.077266, -6.933306,
-  -7.617511, 4.464109, -6.502725,
-  // f 780/553 791/564 792/565 781/554
-  -7.280192, -3.657736, -6.937464,
-  -3.923297, -3.844294, -6.93435,
-  -3.917236, -4.393363, -6.502729,
-  // f 780/553 791/564 792/565 781/554
-  -7.280192, -3.657736, -6.937464,
-  -7.75524, -4.135467, -6.502724,
-  -3.917236, -4.393363, -6.502729,
-  // f 793/566 794/567 795/568 789/562
-  -7.549587, 4.633198, -6.045935,
-  -3.911592, 4.872167, -6.04594,
-  -3.913474, 4.680201, -6.50273,
-  // f 793/566 794/567 795/568 789/562
-  -7.549587, 4.633198, -6.045935,
-  -7.617511, 4.464109, -6.502725,
-  -3.913474, 4.680201, -6.50273,
-  // f 796/569 777/550 776/549 797/570
-  -8.939411, 1.218367, -6.045933,
-  -8.868562, 1.210879, -6.502723,
-  -8.868562, -0.789269, -6.502723,
-  // f 796/569 777/550 776/549 797/570
-  -8.939411, 1.218367, -6.045933,
-  -8.939411, -0.797796, -6.045932,
-  -8.868562, -0.789269, -6.502723,
-  // f 798/571 799/572 782/555 781/554
-  -7.817311, -4.393778, -6.045933,
-  -8.702409, -3.649416, -6.045932,
-  -8.633441, -3.551873, -6.502723,
-  // f 798/571 799/572 782/555 781/554
-  -7.817311, -4.393778, -6.045933,
-  -7.75524, -4.135467, -6.502724,
-  -8.633441, -3.551873, -6.502723,
-  // f 800/573 801/574 786/559 785/558
-  -8.939411, 3.234321, -6.045933,
-  -8.567188, 4.082466, -6.045934,
-  -8.563846, 3.980348, -6.502724,
-  // f 800/573 801/574 786/559 785/558
-  -8.939411, 3.234321, -6.045933,
-  -8.868562, 3.211027, -6.502723,
-  -8.563846, 3.980348, -6.502724,
-  // f 782/555 799/572 802/575 787/560
-  -8.633441, -3.551873, -6.502723,
-  -8.702409, -3.649416, -6.045932,
-  -8.939411, -2.813959, -6.045932,
-  // f 782/555 799/572 802/575 787/560
-  -8.633441, -3.551873, -6.502723,
-  -8.868562, -2.789417, -6.502722,
-  -8.939411, -2.813959, -6.045932,
-  // f 786/559 801/574 793/566 789/562
-  -8.563846, 3.980348, -6.502724,
-  -8.567188, 4.082466, -6.045934,
-  -7.549587, 4.633198, -6.045935,
-  // f 786/559 801/574 793/566 789/562
-  -8.563846, 3.980348, -6.502724,
-  -7.617511, 4.464109, -6.502725,
-  -7.549587, 4.633198, -6.045935,
-  // f 803/576 804/577 805/578 806/579
-  -9.002316, -0.576712, -3.411072,
-  -9.002316, 0.136037, -3.514245,
-  -9.004196, 0.140404, -3.648203,
-  // f 803/576 804/577 805/578 806/579
-  -9.002316, -0.576712, -3.411072,
-  -9.004196, -0.612069, -3.545238,
-  -9.004196, 0.140404, -3.648203,
-  // f 798/580 807/581 808/582 799/583
-  -7.817311, -4.393778, -6.045933,
-  -7.817307, -4.393778, -2.876903,
-  -8.702405, -3.649416, -2.876902,
-  // f 798/580 807/581 808/582 799/583
-  -7.817311, -4.393778, -6.045933,
-  -8.702409, -3.649416, -6.045932,
-  -8.702405, -3.649416, -2.876902,
-  // f 800/584 809/585 810/586 801/587
-  -8.939411, 3.234321, -6.045933,
-  -8.939406, 3.234322, -2.871703,
-  -8.567184, 4.082467, -2.876904,
-  // f 800/584 809/585 810/586 801/587
-  -8.939411, 3.234321, -6.045933,
-  -8.567188, 4.082466, -6.045934,
-  -8.567184, 4.082467, -2.876904,
-  // f 799/583 808/582 811/588 802/589
-  -8.702409, -3.649416, -6.045932,
-  -8.702405, -3.649416, -2.876902,
-  -8.939406, -2.813958, -2.871701,
-  // f 799/583 808/582 811/588 802/589
-  -8.702409, -3.649416, -6.045932,
-  -8.939411, -2.813959, -6.045932,
-  -8.939406, -2.813958, -2.871701,
-  // f 801/587 810/586 812/590 793/591
-  -8.567188, 4.082466, -6.045934,
-  -8.567184, 4.082467, -2.876904,
-  -7.549582, 4.633199, -2.876905,
-  // f 801/587 810/586 812/590 793/591
-  -8.567188, 4.082466, -6.045934,
-  -7.549587, 4.633198, -6.045935,
-  -7.549582, 4.633199, -2.876905,
-  // f 798/580 813/592 814/593 807/581
-  -7.817311, -4.393778, -6.045933,
-  -3.918907, -4.716148, -6.036787,
-  -3.918904, -4.716147, -3.521739,
-  // f 798/580 813/592 814/593 807/581
-  -7.817311, -4.393778, -6.045933,
-  -7.817307, -4.393778, -2.876903,
-  -3.918904, -4.716147, -3.521739,
-  // f 815/594 816/595 766/539 765/538
-  -8.256413, 3.010326, -6.959513,
-  -8.077513, 3.623245, -6.959514,
-  -8.077513, 1.361457, -6.959513,
-  // f 815/594 816/595 766/539 765/538
-  -8.256413, 3.010326, -6.959513,
-  -8.268326, 1.174483, -6.959513,
-  -8.077513, 1.361457, -6.959513,
-  // f 767/540 817/596 818/597 768/541
-  -8.077513, -0.941095, -6.959513,
-  -8.077513, -3.202882, -6.959512,
-  -8.256413, -2.590172, -6.959512,
-  // f 767/540 817/596 818/597 768/541
-  -8.077513, -0.941095, -6.959513,
-  -8.268326, -0.75412, -6.959513,
-  -8.256413, -2.590172, -6.959512,
-  // f 766/539 816/595 772/545 773/546
-  -8.077513, 1.361457, -6.959513,
-  -8.077513, 3.623245, -6.959514,
-  -8.036549, 3.665673, -6.959514,
-  // f 766/539 816/595 772/545 773/546
-  -8.077513, 1.361457, -6.959513,
-  -3.926014, 1.418859, -6.959519,
-  -8.036549, 3.665673, -6.959514,
-  // f 772/545 771/544 773/546
-  -8.036549, 3.665673, -6.959514,
-  -3.926014, 3.834137, -6.959519,
-  -3.926014, 1.418859, -6.959519,
-  // f 788/561 787/560 776/549 775/548
-  -8.328516, -2.607226, -6.934759,
-  -8.868562, -2.789417, -6.502722,
-  -8.868562, -0.789269, -6.502723,
-  // f 788/561 787/560 776/549 775/548
-  -8.328516, -2.607226, -6.934759,
-  -8.329352, -0.728954, -6.934136,
-  -8.868562, -0.789269, -6.502723,
-  // f 777/550 785/558 784/557 778/551
-  -8.868562, 1.210879, -6.502723,
-  -8.868562, 3.211027, -6.502723,
-  -8.328516, 3.027589, -6.93476,
-  // f 777/550 785/558 784/557 778/551
-  -8.868562, 1.210879, -6.502723,
-  -8.329352, 1.149525, -6.934137,
-  -8.328516, 3.027589, -6.93476,
-  // f 796/569 800/573 785/558 777/550
-  -8.939411, 1.218367, -6.045933,
-  -8.939411, 3.234321, -6.045933,
-  -8.868562, 3.211027, -6.502723,
-  // f 796/569 800/573 785/558 777/550
-  -8.939411, 1.218367, -6.045933,
-  -8.868562, 1.210879, -6.502723,
-  -8.868562, 3.211027, -6.502723,
-  // f 787/560 802/575 797/570 776/549
-  -8.868562, -2.789417, -6.502722,
-  -8.939411, -2.813959, -6.045932,
-  -8.939411, -0.797796, -6.045932,
-  // f 787/560 802/575 797/570 776/549
-  -8.868562, -2.789417, -6.502722,
-  -8.868562, -0.789269, -6.502723,
-  -8.939411, -0.797796, -6.045932,
-  // f 819/598 820/599 821/600 822/601
-  -9.004195, -1.414458, -2.718607,
-  -9.002315, -1.273447, -2.650588,
-  -9.002316, -0.991425, -3.162916,
-  // f 819/598 820/599 821/600 822/601
-  -9.004195, -1.414458, -2.718607,
-  -9.004196, -1.087304, -3.281274,
-  -9.002316, -0.991425, -3.162916,
-  // f 823/602 824/603 825/604 826/605
-  -8.998967, 3.246801, -0.604811,
-  -8.998968, 3.246801, -0.812614,
-  -9.004192, 1.672597, -0.853799,
-  // f 823/602 824/603 825/604 826/605
-  -8.998967, 3.246801, -0.604811,
-  -9.000221, 1.355011, -0.604811,
-  -9.004192, 1.672597, -0.853799,
-  // f 827/606 828/607 829/608 830/609
-  -7.564837, 4.691849, -0.824264,
-  -7.568599, 4.690601, -0.604813,
-  -3.912422, 4.875288, -1.738681,
-  // f 827/606 828/607 829/608 830/609
-  -7.564837, 4.691849, -0.824264,
-  -3.911378, 4.875288, -1.969363,
-  -3.912422, 4.875288, -1.738681,
-  // f 831/610 832/611 833/612 834/613
-  -7.842383, -4.448892, -0.605228,
-  -8.753606, -3.682068, -0.60481,
-  -8.753398, -3.682276, -0.770594,
-  // f 831/610 832/611 833/612 834/613
-  -7.842383, -4.448892, -0.605228,
-  -7.83883, -4.450348, -0.814902,
-  -8.753398, -3.682276, -0.770594,
-  // f 823/602 835/614 836/615 824/603
-  -8.998967, 3.246801, -0.604811,
-  -8.612116, 4.123439, -0.604812,
-  -8.612116, 4.123439, -0.799301,
-  // f 823/602 835/614 836/615 824/603
-  -8.998967, 3.246801, -0.604811,
-  -8.998968, 3.246801, -0.812614,
-  -8.612116, 4.123439, -0.799301,
-  // f 832/611 837/616 838/617 833/612
-  -8.753606, -3.682068, -0.60481,
-  -8.999595, -2.822277, -0.60481,
-  -8.999595, -2.822277, -0.783699,
-  // f 832/611 837/616 838/617 833/612
-  -8.753606, -3.682068, -0.60481,
-  -8.753398, -3.682276, -0.770594,
-  -8.999595, -2.822277, -0.783699,
-  // f 835/614 828/607 827/606 836/615
-  -8.612116, 4.123439, -0.604812,
-  -7.568599, 4.690601, -0.604813,
-  -7.564837, 4.691849, -0.824264,
-  // f 835/614 828/607 827/606 836/615
-  -8.612116, 4.123439, -0.604812,
-  -8.612116, 4.123439, -0.799301,
-  -7.564837, 4.691849, -0.824264,
-  // f 839/618 840/619 841/620 842/621
-  -9.004196, 0.892878, -3.543367,
-  -9.002316, 0.848786, -3.409824,
-  -9.002316, 1.271818, -3.126307,
-  // f 839/618 840/619 841/620 842/621
-  -9.004196, 0.892878, -3.543367,
-  -9.004196, 1.379136, -3.241544,
-  -9.002316, 1.271818, -3.126307,
-  // f 843/622 844/623 820/599 819/598
-  -9.004192, -1.424232, -0.827589,
-  -9.002313, -1.278854, -0.824053,
-  -9.002315, -1.273447, -2.650588,
-  // f 843/622 844/623 820/599 819/598
-  -9.004192, -1.424232, -0.827589,
-  -9.004195, -1.414458, -2.718607,
-  -9.002315, -1.273447, -2.650588,
-  // f 845/624 846/625 771/544 770/543
-  -1.728002, 4.202886, -6.959522,
-  -1.729883, 3.846199, -6.959522,
-  -3.926014, 3.834137, -6.959519,
-  // f 845/624 846/625 771/544 770/543
-  -1.728002, 4.202886, -6.959522,
-  -3.922043, 4.193735, -6.959519,
-  -3.926014, 3.834137, -6.959519,
-  // f 847/626 848/627 774/547 773/546
-  -1.729883, 1.422395, -6.959522,
-  -1.729883, -1.001409, -6.959521,
-  -3.926014, -0.996418, -6.959518,
-  // f 847/626 848/627 774/547 773/546
-  -1.729883, 1.422395, -6.959522,
-  -3.926014, 1.418859, -6.959519,
-  -3.926014, -0.996418, -6.959518,
-  // f 849/628 850/629 851/630 852/631
-  -7.245708, -3.592846, -6.959514,
-  -8.036549, -3.24531, -6.959512,
-  -3.926014, -3.411695, -6.959518,
-  // f 849/628 850/629 851/630 852/631
-  -7.245708, -3.592846, -6.959514,
-  -3.923924, -3.771293, -6.959518,
-  -3.926014, -3.411695, -6.959518,
-  // f 790/563 789/562 795/568 853/632
-  -7.276848, 4.077266, -6.933306,
-  -7.617511, 4.464109, -6.502725,
-  -3.913474, 4.680201, -6.50273,
-  // f 790/563 789/562 795/568 853/632
-  -7.276848, 4.077266, -6.933306,
-  -3.920998, 4.2632, -6.930398,
-  -3.913474, 4.680201, -6.50273,
-  // f 854/633 855/634 792/565 791/564
-  -1.728629, -3.855525, -6.935184,
-  -1.725912, -4.435583, -6.502732,
-  -3.917236, -4.393363, -6.502729,
-  // f 854/633 855/634 792/565 791/564
-  -1.728629, -3.855525, -6.935184,
-  -3.923297, -3.844294, -6.93435,
-  -3.917236, -4.393363, -6.502729,
-  // f 856/635 857/636 795/568 794/567
-  -1.723403, 4.899829, -6.045943,
-  -1.72424, 4.699127, -6.502733,
-  -3.913474, 4.680201, -6.50273,
-  // f 856/635 857/636 795/568 794/567
-  -1.723403, 4.899829, -6.045943,
-  -3.911592, 4.872167, -6.04594,
-  -3.913474, 4.680201, -6.50273,
-  // f 813/637 798/571 781/554 792/565
-  -3.918907, -4.716148, -6.036787,
-  -7.817311, -4.393778, -6.045933,
-  -7.75524, -4.135467, -6.502724,
-  // f 813/637 798/571 781/554 792/565
-  -3.918907, -4.716148, -6.036787,
-  -3.917236, -4.393363, -6.502729,
-  -7.75524, -4.135467, -6.502724,
-  // f 793/591 812/590 858/638 794/639
-  -7.549587, 4.633198, -6.045935,
-  -7.549582, 4.633199, -2.876905,
-  -3.91138, 4.89983, -3.767192,
-  // f 793/591 812/590 858/638 794/639
-  -7.549587, 4.633198, -6.045935,
-  -3.911592, 4.872167, -6.04594,
-  -3.91138, 4.89983, -3.767192,
-  // f 813/592 859/640 860/641 814/593
-  -3.918907, -4.716148, -6.036787,
-  -1.726538, -4.787485, -6.05863,
-  -1.726535, -4.787485, -3.622003,
-  // f 813/592 859/640 860/641 814/593
-  -3.918907, -4.716148, -6.036787,
-  -3.918904, -4.716147, -3.521739,
-  -1.726535, -4.787485, -3.622003,
-  // f 846/625 847/626 773/546 771/544
-  -1.729883, 3.846199, -6.959522,
-  -1.729883, 1.422395, -6.959522,
-  -3.926014, 1.418859, -6.959519,
-  // f 846/625 847/626 773/546 771/544
-  -1.729883, 3.846199, -6.959522,
-  -3.926014, 3.834137, -6.959519,
-  -3.926014, 1.418859, -6.959519,
-  // f 851/630 850/629 817/596 774/547
-  -3.926014, -3.411695, -6.959518,
-  -8.036549, -3.24531, -6.959512,
-  -8.077513, -3.202882, -6.959512,
-  // f 851/630 850/629 817/596 774/547
-  -3.926014, -3.411695, -6.959518,
-  -3.926014, -0.996418, -6.959518,
-  -8.077513, -3.202882, -6.959512,
-  // f 817/596 767/540 774/547
-  -8.077513, -3.202882, -6.959512,
-  -8.077513, -0.941095, -6.959513,
-  -3.926014, -0.996418, -6.959518,
-  // f 830/609 829/608 861/642 862/643
-  -3.911378, 4.875288, -1.969363,
-  -3.912422, 4.875288, -1.738681,
-  -2.070331, 4.87508, -2.126621,
-  // f 830/609 829/608 861/642 862/643
-  -3.911378, 4.875288, -1.969363,
-  -2.217047, 4.874872, -2.303013,
-  -2.070331, 4.87508, -2.126621,
-  // f 862/643 861/642 863/644
-  -2.217047, 4.874872, -2.303013,
-  -2.070331, 4.87508, -2.126621,
-  -2.21433, 4.87508, -2.32631,
-  // f 864/645 831/610 834/613 865/646
-  -3.922663, -4.776462, -1.418967,
-  -7.842383, -4.448892, -0.605228,
-  -7.83883, -4.450348, -0.814902,
-  // f 864/645 831/610 834/613 865/646
-  -3.922663, -4.776462, -1.418967,
-  -3.922245, -4.776462, -1.635298,
-  -7.83883, -4.450348, -0.814902,
-  // f 866/647 867/648 868/649 869/650
-  -1.952876, 4.875079, -2.678472,
-  -0.004197, 4.875288, -2.819505,
-  -0.004197, 4.875288, -2.914149,
-  // f 866/647 867/648 868/649 869/650
-  -1.952876, 4.875079, -2.678472,
-  -2.063018, 4.875079, -2.880448,
-  -0.004197, 4.875288, -2.914149,
-  // f 870/651 871/652 872/653 873/654
-  -8.939406, 1.135383, -2.979452,
-  -7.921387, 1.135383, -2.979453,
-  -7.921386, 1.35501, -2.564058,
-  // f 870/651 871/652 872/653 873/654
-  -8.939406, 1.135383, -2.979452,
-  -8.939406, 1.35501, -2.564056,
-  -7.921386, 1.35501, -2.564058,
-  // f 874/655 875/656 876/657 877/658
-  -8.939406, -1.09396, -2.564056,
-  -8.939404, -1.093959, -0.604811,
-  -7.925146, -1.093959, -0.604812,
-  // f 874/655 875/656 876/657 877/658
-  -8.939406, -1.09396, -2.564056,
-  -7.921386, -1.09396, -2.564057,
-  -7.925146, -1.093959, -0.604812,
-  // f 878/659 879/660 880/661 881/662
-  -8.939407, 0.130421, -3.343885,
-  -7.921387, 0.130421, -3.343886,
-  -7.921387, 0.792839, -3.239881,
-  // f 878/659 879/660 880/661 881/662
-  -8.939407, 0.130421, -3.343885,
-  -8.939407, 0.792839, -3.23988,
-  -7.921387, 0.792839, -3.239881,
-  // f 882/663 873/654 872/653 883/664
-  -8.887572, 1.355011, -0.604811,
-  -8.939406, 1.35501, -2.564056,
-  -7.921386, 1.35501, -2.564058,
-  // f 882/663 873/654 872/653 883/664
-  -8.887572, 1.355011, -0.604811,
-  -7.917622, 1.355011, -0.604812,
-  -7.921386, 1.35501, -2.564058,
-  // f 884/665 885/666 886/667 887/668
-  -8.939406, -0.869341, -3.012317,
-  -7.921387, -0.869341, -3.012318,
-  -7.921387, -0.531788, -3.239881,
-  // f 884/665 885/666 886/667 887/668
-  -8.939406, -0.869341, -3.012317,
-  -8.939407, -0.531788, -3.23988,
-  -7.921387, -0.531788, -3.239881,
-  // f 888/669 889/670 858/638 890/671
-  -2.063436, 4.874872, -2.885233,
-  -1.937203, 4.911892, -3.933187,
-  -3.91138, 4.89983, -3.767192,
-  // f 888/669 889/670 858/638 890/671
-  -2.063436, 4.874872, -2.885233,
-  -3.911587, 4.87508, -1.970196,
-  -3.91138, 4.89983, -3.767192,
-  // f 890/671 858/638 812/590 892/672
-  -3.911587, 4.87508, -1.970196,
-  -3.91138, 4.89983, -3.767192,
-  -7.549582, 4.633199, -2.876905,
-  // f 890/671 858/638 812/590 892/672
-  -3.911587, 4.87508, -1.970196,
-  -7.54958, 4.633199, -0.824264,
-  -7.549582, 4.633199, -2.876905,
-  // f 892/672 812/590 810/586 893/673
-  -7.54958, 4.633199, -0.824264,
-  -7.549582, 4.633199, -2.876905,
-  -8.567184, 4.082467, -2.876904,
-  // f 892/672 812/590 810/586 893/673
-  -7.54958, 4.633199, -0.824264,
-  -8.567182, 4.082467, -0.799302,
-  -8.567184, 4.082467, -2.876904,
-  // f 810/586 809/585 894/674 893/673
-  -8.567184, 4.082467, -2.876904,
-  -8.939406, 3.234322, -2.871703,
-  -8.939404, 3.234322, -0.812614,
-  // f 810/586 809/585 894/674 893/673
-  -8.567184, 4.082467, -2.876904,
-  -8.567182, 4.082467, -0.799302,
-  -8.939404, 3.234322, -0.812614,
-  // f 811/588 808/582 895/675 896/676
-  -8.939406, -2.813958, -2.871701,
-  -8.702405, -3.649416, -2.876902,
-  -8.702402, -3.649415, -0.775795,
-  // f 811/588 808/582 895/675 896/676
-  -8.939406, -2.813958, -2.871701,
-  -8.939404, -2.813958, -0.783699,
-  -8.702402, -3.649415, -0.775795,
-  // f 808/582 807/581 897/677 895/675
-  -8.702405, -3.649416, -2.876902,
-  -7.817307, -4.393778, -2.876903,
-  -7.817304, -4.393777, -0.814902,
-  // f 808/582 807/581 897/677 895/675
-  -8.702405, -3.649416, -2.876902,
-  -8.702402, -3.649415, -0.775795,
-  -7.817304, -4.393777, -0.814902,
-  // f 807/581 814/593 898/678 897/677
-  -7.817307, -4.393778, -2.876903,
-  -3.918904, -4.716147, -3.521739,
-  -3.918901, -4.716147, -1.635298,
-  // f 807/581 814/593 898/678 897/677
-  -7.817307, -4.393778, -2.876903,
-  -7.817304, -4.393777, -0.814902,
-  -3.918901, -4.716147, -1.635298,
-  // f 814/593 860/641 899/679 898/678
-  -3.918904, -4.716147, -3.521739,
-  -1.726535, -4.787485, -3.622003,
-  -1.726532, -4.787485, -1.824174,
-  // f 814/593 860/641 899/679 898/678
-  -3.918904, -4.716147, -3.521739,
-  -3.918901, -4.716147, -1.635298,
-  -1.726532, -4.787485, -1.824174,
-  // f 866/647 869/650 863/644 861/642
-  -1.952876, 4.875079, -2.678472,
-  -2.063018, 4.875079, -2.880448,
-  -2.21433, 4.87508, -2.32631,
-  // f 866/647 869/650 863/644 861/642
-  -1.952876, 4.875079, -2.678472,
-  -2.070331, 4.87508, -2.126621,
-  -2.21433, 4.87508, -2.32631,
-  // f 825/604 900/680 901/681 902/682
-  -9.004192, 1.672597, -0.853799,
-  -9.004195, 1.665733, -2.644972,
-  -9.002315, 1.528882, -2.609403,
-  // f 825/604 900/680 901/681 902/682
-  -9.004192, 1.672597, -0.853799,
-  -9.002313, 1.532834, -0.848807,
-  -9.002315, 1.528882, -2.609403,
-  // f 843/622 903/683 844/623
-  -9.004192, -1.424232, -0.827589,
-  -9.000221, -1.093959, -0.604811,
-  -9.002313, -1.278854, -0.824053,
-  // f 888/669 891/684 863/644 869/650
-  -2.063436, 4.874872, -2.885233,
-  -2.217047, 4.874872, -2.329846,
-  -2.21433, 4.87508, -2.32631,
-  // f 888/669 891/684 863/644 869/650
-  -2.063436, 4.874872, -2.885233,
-  -2.063018, 4.875079, -2.880448,
-  -2.21433, 4.87508, -2.32631,
-  // f 891/685 890/671 830/609 862/643
-  -2.217047, 4.874872, -2.329846,
-  -3.911587, 4.87508, -1.970196,
-  -3.911378, 4.875288, -1.969363,
-  // f 891/685 890/671 830/609 862/643
-  -2.217047, 4.874872, -2.329846,
-  -2.217047, 4.874872, -2.303013,
-  -3.911378, 4.875288, -1.969363,
-  // f 890/671 892/672 827/606 830/609
-  -3.911587, 4.87508, -1.970196,
-  -7.54958, 4.633199, -0.824264,
-  -7.564837, 4.691849, -0.824264,
-  // f 890/671 892/672 827/606 830/609
-  -3.911587, 4.87508, -1.970196,
-  -3.911378, 4.875288, -1.969363,
-  -7.564837, 4.691849, -0.824264,
-  // f 892/672 893/673 836/615 827/606
-  -7.54958, 4.633199, -0.824264,
-  -8.567182, 4.082467, -0.799302,
-  -8.612116, 4.123439, -0.799301,
-  // f 892/672 893/673 836/615 827/606
-  -7.54958, 4.633199, -0.824264,
-  -7.564837, 4.691849, -0.824264,
-  -8.612116, 4.123439, -0.799301,
-  // f 893/673 894/674 824/603 836/615
-  -8.567182, 4.082467, -0.799302,
-  -8.939404, 3.234322, -0.812614,
-  -8.998968, 3.246801, -0.812614,
-  // f 893/673 894/674 824/603 836/615
-  -8.567182, 4.082467, -0.799302,
-  -8.612116, 4.123439, -0.799301,
-  -8.998968, 3.246801, -0.812614,
-  // f 894/674 904/686 825/604 824/603
-  -8.939404, 3.234322, -0.812614,
-  -8.922057, 1.672597, -0.853799,
-  -9.004192, 1.672597, -0.853799,
-  // f 894/674 904/686 825/604 824/603
-  -8.939404, 3.234322, -0.812614,
-  -8.998968, 3.246801, -0.812614,
-  -9.004192, 1.672597, -0.853799,
-  // f 904/686 905/687 900/680 825/604
-  -8.922057, 1.672597, -0.853799,
-  -8.92206, 1.665733, -2.644972,
-  -9.004195, 1.665733, -2.644972,
-  // f 904/686 905/687 900/680 825/604
-  -8.922057, 1.672597, -0.853799,
-  -9.004192, 1.672597, -0.853799,
-  -9.004195, 1.665733, -2.644972,
-  // f 906/688 842/621 900/680 905/687
-  -8.922061, 1.379136, -3.241544,
-  -9.004196, 1.379136, -3.241544,
-  -9.004195, 1.665733, -2.644972,
-  // f 906/688 842/621 900/680 905/687
-  -8.922061, 1.379136, -3.241544,
-  -8.92206, 1.665733, -2.644972,
-  -9.004195, 1.665733, -2.644972,
-  // f 907/689 805/578 839/618 908/690
-  -8.922061, 0.140404, -3.648203,
-  -9.004196, 0.140404, -3.648203,
-  -9.004196, 0.892878, -3.543367,
-  // f 907/689 805/578 839/618 908/690
-  -8.922061, 0.140404, -3.648203,
-  -8.922061, 0.892878, -3.543367,
-  -9.004196, 0.892878, -3.543367,
-  // f 909/691 822/601 806/579 910/692
-  -8.922061, -1.087304, -3.281274,
-  -9.004196, -1.087304, -3.281274,
-  -9.004196, -0.612069, -3.545238,
-  // f 909/691 822/601 806/579 910/692
-  -8.922061, -1.087304, -3.281274,
-  -8.922061, -0.612069, -3.545238,
-  -9.004196, -0.612069, -3.545238,
-  // f 911/693 912/694 843/622 819/598
-  -8.92206, -1.414458, -2.718607,
-  -8.922057, -1.424232, -0.827589,
-  -9.004192, -1.424232, -0.827589,
-  // f 911/693 912/694 843/622 819/598
-  -8.92206, -1.414458, -2.718607,
-  -9.004195, -1.414458, -2.718607,
-  -9.004192, -1.424232, -0.827589,
-  // f 912/694 896/676 838/617 843/622
-  -8.922057, -1.424232, -0.827589,
-  -8.939404, -2.813958, -0.783699,
-  -8.999595, -2.822277, -0.783699,
-  // f 912/694 896/676 838/617 843/622
-  -8.922057, -1.424232, -0.827589,
-  -9.004192, -1.424232, -0.827589,
-  -8.999595, -2.822277, -0.783699,
-  // f 896/676 895/675 833/612 838/617
-  -8.939404, -2.813958, -0.783699,
-  -8.702402, -3.649415, -0.775795,
-  -8.753398, -3.682276, -0.770594,
-  // f 896/676 895/675 833/612 838/617
-  -8.939404, -2.813958, -0.783699,
-  -8.999595, -2.822277, -0.783699,
-  -8.753398, -3.682276, -0.770594,
-  // f 895/675 897/677 834/613 833/612
-  -8.702402, -3.649415, -0.775795,
-  -7.817304, -4.393777, -0.814902,
-  -7.83883, -4.450348, -0.814902,
-  // f 895/675 897/677 834/613 833/612
-  -8.702402, -3.649415, -0.775795,
-  -8.753398, -3.682276, -0.770594,
-  -7.83883, -4.450348, -0.814902,
-  // f 897/677 898/678 865/646 834/613
-  -7.817304, -4.393777, -0.814902,
-  -3.918901, -4.716147, -1.635298,
-  -3.922245, -4.776462, -1.635298,
-  // f 897/677 898/678 865/646 834/613
-  -7.817304, -4.393777, -0.814902,
-  -7.83883, -4.450348, -0.814902,
-  -3.922245, -4.776462, -1.635298,
-  // f 899/679 913/695 865/646 898/678
-  -1.726532, -4.787485, -1.824174,
-  -1.729249, -4.847799, -1.824174,
-  -3.922245, -4.776462, -1.635298,
-  // f 899/679 913/695 865/646 898/678
-  -1.726532, -4.787485, -1.824174,
-  -3.918901, -4.716147, -1.635298,
-  -3.922245, -4.776462, -1.635298,
-  // f 914/696 915/697 831/610 864/645
-  -3.918901, -4.558914, -1.418967,
-  -7.816259, -4.236752, -0.605228,
-  -7.842383, -4.448892, -0.605228,
-  // f 914/696 915/697 831/610 864/645
-  -3.918901, -4.558914, -1.418967,
-  -3.922663, -4.776462, -1.418967,
-  -7.842383, -4.448892, -0.605228,
-  // f 915/697 916/698 832/611 831/610
-  -7.816259, -4.236752, -0.605228,
-  -8.702402, -3.492182, -0.604811,
-  -8.753606, -3.682068, -0.60481,
-  // f 915/697 916/698 832/611 831/610
-  -7.816259, -4.236752, -0.605228,
-  -7.842383, -4.448892, -0.605228,
-  -8.753606, -3.682068, -0.60481,
-  // f 916/698 917/699 837/616 832/611
-  -8.702402, -3.492182, -0.604811,
-  -8.876079, -2.769242, -0.60481,
-  -8.999595, -2.822277, -0.60481,
-  // f 916/698 917/699 837/616 832/611
-  -8.702402, -3.492182, -0.604811,
-  -8.753606, -3.682068, -0.60481,
-  -8.999595, -2.822277, -0.60481,
-  // f 917/699 875/700 903/683 837/616
-  -8.876079, -2.769242, -0.60481,
-  -8.939404, -1.093959, -0.604811,
-  -9.000221, -1.093959, -0.604811,
-  // f 917/699 875/700 903/683 837/616
-  -8.876079, -2.769242, -0.60481,
-  -8.999595, -2.822277, -0.60481,
-  -9.000221, -1.093959, -0.604811,
-  // f 875/700 874/701 918/702 903/683
-  -8.939404, -1.093959, -0.604811,
-  -8.939406, -1.09396, -2.564056,
-  -9.000224, -1.09396, -2.564056,
-  // f 875/700 874/701 918/702 903/683
-  -8.939404, -1.093959, -0.604811,
-  -9.000221, -1.093959, -0.604811,
-  -9.000224, -1.09396, -2.564056,
-  // f 884/665 919/703 918/704 874/655
-  -8.939406, -0.869341, -3.012317,
-  -9.000224, -0.869341, -3.012317,
-  -9.000224, -1.09396, -2.564056,
-  // f 884/665 919/703 918/704 874/655
-  -8.939406, -0.869341, -3.012317,
-  -8.939406, -1.09396, -2.564056,
-  -9.000224, -1.09396, -2.564056,
-  // f 878/659 920/705 921/706 887/668
-  -8.939407, 0.130421, -3.343885,
-  -9.000225, 0.130421, -3.343885,
-  -9.000225, -0.531788, -3.239879,
-  // f 878/659 920/705 921/706 887/668
-  -8.939407, 0.130421, -3.343885,
-  -8.939407, -0.531788, -3.23988,
-  -9.000225, -0.531788, -3.239879,
-  // f 870/651 922/707 923/708 881/662
-  -8.939406, 1.135383, -2.979452,
-  -9.000224, 1.135383, -2.979452,
-  -9.000225, 0.792839, -3.23988,
-  // f 870/651 922/707 923/708 881/662
-  -8.939406, 1.135383, -2.979452,
-  -8.939407, 0.792839, -3.23988,
-  -9.000225, 0.792839, -3.23988,
-  // f 873/709 882/710 826/711 924/712
-  -8.939406, 1.35501, -2.564056,
-  -8.887572, 1.355011, -0.604811,
-  -9.000221, 1.355011, -0.604811,
-  // f 873/709 882/710 826/711 924/712
-  -8.939406, 1.35501, -2.564056,
-  -9.000224, 1.35501, -2.564056,
-  -9.000221, 1.355011, -0.604811,
-  // f 882/710 925/713 823/602 826/605
-  -8.887572, 1.355011, -0.604811,
-  -8.895514, 3.119517, -0.604811,
-  -8.998967, 3.246801, -0.604811,
-  // f 882/710 925/713 823/602 826/605
-  -8.887572, 1.355011, -0.604811,
-  -9.000221, 1.355011, -0.604811,
-  -8.998967, 3.246801, -0.604811,
-  // f 925/713 926/714 835/614 823/602
-  -8.895514, 3.119517, -0.604811,
-  -8.523293, 3.967661, -0.604812,
-  -8.612116, 4.123439, -0.604812,
-  // f 925/713 926/714 835/614 823/602
-  -8.895514, 3.119517, -0.604811,
-  -8.998967, 3.246801, -0.604811,
-  -8.612116, 4.123439, -0.604812,
-  // f 926/714 927/715 828/607 835/614
-  -8.523293, 3.967661, -0.604812,
-  -7.548117, 4.518394, -0.604813,
-  -7.568599, 4.690601, -0.604813,
-  // f 926/714 927/715 828/607 835/614
-  -8.523293, 3.967661, -0.604812,
-  -8.612116, 4.123439, -0.604812,
-  -7.568599, 4.690601, -0.604813,
-  // f 927/715 928/716 829/608 828/607
-  -7.548117, 4.518394, -0.604813,
-  -3.911587, 4.678539, -1.73972,
-  -3.912422, 4.875288, -1.738681,
-  // f 927/715 928/716 829/608 828/607
-  -7.548117, 4.518394, -0.604813,
-  -7.568599, 4.690601, -0.604813,
-  -3.912422, 4.875288, -1.738681,
-  // f 928/716 929/717 861/642 829/608
-  -3.911587, 4.678539, -1.73972,
-  -2.074302, 4.67937, -2.129534,
-  -2.070331, 4.87508, -2.126621,
-  // f 928/716 929/717 861/642 829/608
-  -3.911587, 4.678539, -1.73972,
-  -3.912422, 4.875288, -1.738681,
-  -2.070331, 4.87508, -2.126621,
-  // f 929/717 930/718 866/647 861/642
-  -2.074302, 4.67937, -2.129534,
-  -1.953503, 4.679578, -2.683048,
-  -1.952876, 4.875079, -2.678472,
-  // f 929/717 930/718 866/647 861/642
-  -2.074302, 4.67937, -2.129534,
-  -2.070331, 4.87508, -2.126621,
-  -1.952876, 4.875079, -2.678472,
-  // f 931/719 867/648 866/647 930/718
-  -0.004197, 4.680202, -2.724653,
-  -0.004197, 4.875288, -2.819505,
-  -1.952876, 4.875079, -2.678472,
-  // f 931/719 867/648 866/647 930/718
-  -0.004197, 4.680202, -2.724653,
-  -1.953503, 4.679578, -2.683048,
-  -1.952876, 4.875079, -2.678472,
-  // f 919/720 921/721 803/576 821/600
-  -9.000224, -0.869341, -3.012317,
-  -9.000225, -0.531788, -3.239879,
-  -9.002316, -0.576712, -3.411072,
-  // f 919/720 921/721 803/576 821/600
-  -9.000224, -0.869341, -3.012317,
-  -9.002316, -0.991425, -3.162916,
-  -9.002316, -0.576712, -3.411072,
-  // f 924/712 901/681 841/620 922/722
-  -9.000224, 1.35501, -2.564056,
-  -9.002315, 1.528882, -2.609403,
-  -9.002316, 1.271818, -3.126307,
-  // f 924/712 901/681 841/620 922/722
-  -9.000224, 1.35501, -2.564056,
-  -9.000224, 1.135383, -2.979452,
-  -9.002316, 1.271818, -3.126307,
-  // f 881/662 880/661 871/652 870/651
-  -8.939407, 0.792839, -3.23988,
-  -7.921387, 0.792839, -3.239881,
-  -7.921387, 1.135383, -2.979453,
-  // f 881/662 880/661 871/652 870/651
-  -8.939407, 0.792839, -3.23988,
-  -8.939406, 1.135383, -2.979452,
-  -7.921387, 1.135383, -2.979453,
-  // f 874/655 877/658 885/666 884/665
-  -8.939406, -1.09396, -2.564056,
-  -7.921386, -1.09396, -2.564057,
-  -7.921387, -0.869341, -3.012318,
-  // f 874/655 877/658 885/666 884/665
-  -8.939406, -1.09396, -2.564056,
-  -8.939406, -0.869341, -3.012317,
-  -7.921387, -0.869341, -3.012318,
-  // f 908/690 839/618 842/621 906/688
-  -8.922061, 0.892878, -3.543367,
-  -9.004196, 0.892878, -3.543367,
-  -9.004196, 1.379136, -3.241544,
-  // f 908/690 839/618 842/621 906/688
-  -8.922061, 0.892878, -3.543367,
-  -8.922061, 1.379136, -3.241544,
-  -9.004196, 1.379136, -3.241544,
-  // f 911/693 819/598 822/601 909/691
-  -8.92206, -1.414458, -2.718607,
-  -9.004195, -1.414458, -2.718607,
-  -9.004196, -1.087304, -3.281274,
-  // f 911/693 819/598 822/601 909/691
-  -8.92206, -1.414458, -2.718607,
-  -8.922061, -1.087304, -3.281274,
-  -9.004196, -1.087304, -3.281274,
-  // f 887/668 921/706 919/703 884/665
-  -8.939407, -0.531788, -3.23988,
-  -9.000225, -0.531788, -3.239879,
-  -9.000224, -0.869341, -3.012317,
-  // f 887/668 921/706 919/703 884/665
-  -8.939407, -0.531788, -3.23988,
-  -8.939406, -0.869341, -3.012317,
-  -9.000224, -0.869341, -3.012317,
-  // f 873/654 924/723 922/707 870/651
-  -8.939406, 1.35501, -2.564056,
-  -9.000224, 1.35501, -2.564056,
-  -9.000224, 1.135383, -2.979452,
-  // f 873/654 924/723 922/707 870/651
-  -8.939406, 1.35501, -2.564056,
-  -8.939406, 1.135383, -2.979452,
-  -9.000224, 1.135383, -2.979452,
-  // f 904/686 894/674 809/585 905/687
-  -8.922057, 1.672597, -0.853799,
-  -8.939404, 3.234322, -0.812614,
-  -8.939406, 3.234322, -2.871703,
-  // f 904/686 894/674 809/585 905/687
-  -8.922057, 1.672597, -0.853799,
-  -8.92206, 1.665733, -2.644972,
-  -8.939406, 3.234322, -2.871703,
-  // f 905/687 809/585 906/688
-  -8.92206, 1.665733, -2.644972,
-  -8.939406, 3.234322, -2.871703,
-  -8.922061, 1.379136, -3.241544,
-  // f 796/724 797/725 910/692 907/689
-  -8.939411, 1.218367, -6.045933,
-  -8.939411, -0.797796, -6.045932,
-  -8.922061, -0.612069, -3.545238,
-  // f 796/724 797/725 910/692 907/689
-  -8.939411, 1.218367, -6.045933,
-  -8.922061, 0.140404, -3.648203,
-  -8.922061, -0.612069, -3.545238,
-  // f 908/690 796/724 907/689
-  -8.922061, 0.892878, -3.543367,
-  -8.939411, 1.218367, -6.045933,
-  -8.922061, 0.140404, -3.648203,
-  // f 797/725 802/589 811/588 909/691
-  -8.939411, -0.797796, -6.045932,
-  -8.939411, -2.813959, -6.045932,
-  -8.939406, -2.813958, -2.871701,
-  // f 797/725 802/589 811/588 909/691
-  -8.939411, -0.797796, -6.045932,
-  -8.922061, -1.087304, -3.281274,
-  -8.939406, -2.813958, -2.871701,
-  // f 910/692 797/725 909/691
-  -8.922061, -0.612069, -3.545238,
-  -8.939411, -0.797796, -6.045932,
-  -8.922061, -1.087304, -3.281274,
-  // f 811/588 896/676 912/694 911/693
-  -8.939406, -2.813958, -2.871701,
-  -8.939404, -2.813958, -0.783699,
-  -8.922057, -1.424232, -0.827589,
-  // f 811/588 896/676 912/694 911/693
-  -8.939406, -2.813958, -2.871701,
-  -8.92206, -1.414458, -2.718607,
-  -8.922057, -1.424232, -0.827589,
-  // f 906/688 809/585 800/584 796/724
-  -8.922061, 1.379136, -3.241544,
-  -8.939406, 3.234322, -2.871703,
-  -8.939411, 3.234321, -6.045933,
-  // f 906/688 809/585 800/584 796/724
-  -8.922061, 1.379136, -3.241544,
-  -8.939411, 1.218367, -6.045933,
-  -8.939411, 3.234321, -6.045933,
-  // f 906/688 796/724 908/690
-  -8.922061, 1.379136, -3.241544,
-  -8.939411, 1.218367, -6.045933,
-  -8.922061, 0.892878, -3.543367,
-  // f 909/691 811/588 911/693
-  -8.922061, -1.087304, -3.281274,
-  -8.939406, -2.813958, -2.871701,
-  -8.92206, -1.414458, -2.718607,
-  // f 921/721 920/726 804/577 803/576
-  -9.000225, -0.531788, -3.239879,
-  -9.000225, 0.130421, -3.343885,
-  -9.002316, 0.136037, -3.514245,
-  // f 921/721 920/726 804/577 803/576
-  -9.000225, -0.531788, -3.239879,
-  -9.002316, -0.576712, -3.411072,
-  -9.002316, 0.136037, -3.514245,
-  // f 820/599 918/702 919/720 821/600
-  -9.002315, -1.273447, -2.650588,
-  -9.000224, -1.09396, -2.564056,
-  -9.000224, -0.869341, -3.012317,
-  // f 820/599 918/702 919/720 821/600
-  -9.002315, -1.273447, -2.650588,
-  -9.002316, -0.991425, -3.162916,
-  -9.000224, -0.869341, -3.012317,
-  // f 840/619 923/727 922/722 841/620
-  -9.002316, 0.848786, -3.409824,
-  -9.000225, 0.792839, -3.23988,
-  -9.000224, 1.135383, -2.979452,
-  // f 840/619 923/727 922/722 841/620
-  -9.002316, 0.848786, -3.409824,
-  -9.002316, 1.271818, -3.126307,
-  -9.000224, 1.135383, -2.979452,
-  // f 844/623 903/683 918/702 820/599
-  -9.002313, -1.278854, -0.824053,
-  -9.000221, -1.093959, -0.604811,
-  -9.000224, -1.09396, -2.564056,
-  // f 844/623 903/683 918/702 820/599
-  -9.002313, -1.278854, -0.824053,
-  -9.002315, -1.273447, -2.650588,
-  -9.000224, -1.09396, -2.564056,
-  // f 924/712 826/711 902/682 901/681
-  -9.000224, 1.35501, -2.564056,
-  -9.000221, 1.355011, -0.604811,
-  -9.002313, 1.532834, -0.848807,
-  // f 924/712 826/711 902/682 901/681
-  -9.000224, 1.35501, -2.564056,
-  -9.002315, 1.528882, -2.609403,
-  -9.002313, 1.532834, -0.848807,
-  // f 806/579 822/601 821/600 803/576
-  -9.004196, -0.612069, -3.545238,
-  -9.004196, -1.087304, -3.281274,
-  -9.002316, -0.991425, -3.162916,
-  // f 806/579 822/601 821/600 803/576
-  -9.004196, -0.612069, -3.545238,
-  -9.002316, -0.576712, -3.411072,
-  -9.002316, -0.991425, -3.162916,
-  // f 900/680 842/621 841/620 901/681
-  -9.004195, 1.665733, -2.644972,
-  -9.004196, 1.379136, -3.241544,
-  -9.002316, 1.271818, -3.126307,
-  // f 900/680 842/621 841/620 901/681
-  -9.004195, 1.665733, -2.644972,
-  -9.002315, 1.528882, -2.609403,
-  -9.002316, 1.271818, -3.126307,
-  // f 825/604 902/682 826/711
-  -9.004192, 1.672597, -0.853799,
-  -9.002313, 1.532834, -0.848807,
-  -9.000221, 1.355011, -0.604811,
-  // f 843/622 838/617 837/616 903/683
-  -9.004192, -1.424232, -0.827589,
-  -8.999595, -2.822277, -0.783699,
-  -8.999595, -2.822277, -0.60481,
-  // f 843/622 838/617 837/616 903/683
-  -9.004192, -1.424232, -0.827589,
-  -9.000221, -1.093959, -0.604811,
-  -8.999595, -2.822277, -0.60481,
-  // f 840/619 839/618 805/578 804/577
-  -9.002316, 0.848786, -3.409824,
-  -9.004196, 0.892878, -3.543367,
-  -9.004196, 0.140404, -3.648203,
-  // f 840/619 839/618 805/578 804/577
-  -9.002316, 0.848786, -3.409824,
-  -9.002316, 0.136037, -3.514245,
-  -9.004196, 0.140404, -3.648203,
-  // f 887/668 886/667 879/660 878/659
-  -8.939407, -0.531788, -3.23988,
-  -7.921387, -0.531788, -3.239881,
-  -7.921387, 0.130421, -3.343886,
-  // f 887/668 886/667 879/660 878/659
-  -8.939407, -0.531788, -3.23988,
-  -8.939407, 0.130421, -3.343885,
-  -7.921387, 0.130421, -3.343886,
-  // f 910/692 806/579 805/578 907/689
-  -8.922061, -0.612069, -3.545238,
-  -9.004196, -0.612069, -3.545238,
-  -9.004196, 0.140404, -3.648203,
-  // f 910/692 806/579 805/578 907/689
-  -8.922061, -0.612069, -3.545238,
-  -8.922061, 0.140404, -3.648203,
-  -9.004196, 0.140404, -3.648203,
-  // f 881/662 923/708 920/705 878/659
-  -8.939407, 0.792839, -3.23988,
-  -9.000225, 0.792839, -3.23988,
-  -9.000225, 0.130421, -3.343885,
-  // f 881/662 923/708 920/705 878/659
-  -8.939407, 0.792839, -3.23988,
-  -8.939407, 0.130421, -3.343885,
-  -9.000225, 0.130421, -3.343885,
-  // f 923/727 840/619 804/577 920/726
-  -9.000225, 0.792839, -3.23988,
-  -9.002316, 0.848786, -3.409824,
-  -9.002316, 0.136037, -3.514245,
-  // f 923/727 840/619 804/577 920/726
-  -9.000225, 0.792839, -3.23988,
-  -9.000225, 0.130421, -3.343885,
-  -9.002316, 0.136037, -3.514245,
-  // f 852/631 851/630 932/728 933/729
-  -3.923924, -3.771293, -6.959518,
-  -3.926014, -3.411695, -6.959518,
-  -1.729883, -3.425213, -6.959521,
-  // f 852/631 851/630 932/728 933/729
-  -3.923924, -3.771293, -6.959518,
-  -1.728838, -3.782108, -6.959521,
-  -1.729883, -3.425213, -6.959521,
-  // f 934/730 853/632 795/568 857/636
-  -1.727584, 4.272559, -6.930609,
-  -3.920998, 4.2632, -6.930398,
-  -3.913474, 4.680201, -6.50273,
-  // f 934/730 853/632 795/568 857/636
-  -1.727584, 4.272559, -6.930609,
-  -1.72424, 4.699127, -6.502733,
-  -3.913474, 4.680201, -6.50273,
-  // f 813/637 792/565 855/634 859/731
-  -3.918907, -4.716148, -6.036787,
-  -3.917236, -4.393363, -6.502729,
-  -1.725912, -4.435583, -6.502732,
-  // f 813/637 792/565 855/634 859/731
-  -3.918907, -4.716148, -6.036787,
-  -1.726538, -4.787485, -6.05863,
-  -1.725912, -4.435583, -6.502732,
-  // f 794/639 858/638 889/670 856/732
-  -3.911592, 4.872167, -6.04594,
-  -3.91138, 4.89983, -3.767192,
-  -1.937203, 4.911892, -3.933187,
-  // f 794/639 858/638 889/670 856/732
-  -3.911592, 4.872167, -6.04594,
-  -1.723403, 4.899829, -6.045943,
-  -1.937203, 4.911892, -3.933187,
-  // f 851/630 774/547 848/627 932/728
-  -3.926014, -3.411695, -6.959518,
-  -3.926014, -0.996418, -6.959518,
-  -1.729883, -1.001409, -6.959521,
-  // f 851/630 774/547 848/627 932/728
-  -3.926014, -3.411695, -6.959518,
-  -1.729883, -3.425213, -6.959521,
-  -1.729883, -1.001409, -6.959521,
-  // f 935/733 864/645 865/646 913/695
-  -1.729458, -4.847799, -1.618868,
-  -3.922663, -4.776462, -1.418967,
-  -3.922245, -4.776462, -1.635298,
-  // f 935/733 864/645 865/646 913/695
-  -1.729458, -4.847799, -1.618868,
-  -1.729249, -4.847799, -1.824174,
-  -3.922245, -4.776462, -1.635298,
-  // f 936/734 937/735 846/625 845/624
-  -0.004203, 4.24469, -6.945172,
-  -0.004203, 3.855351, -6.959525,
-  -1.729883, 3.846199, -6.959522,
-  // f 936/734 937/735 846/625 845/624
-  -0.004203, 4.24469, -6.945172,
-  -1.728002, 4.202886, -6.959522,
-  -1.729883, 3.846199, -6.959522,
-  // f 938/736 939/737 848/627 847/626
-  -0.004203, 1.425099, -6.959524,
-  -0.004203, -1.005153, -6.959524,
-  -1.729883, -1.001409, -6.959521,
-  // f 938/736 939/737 848/627 847/626
-  -0.004203, 1.425099, -6.959524,
-  -1.729883, 1.422395, -6.959522,
-  -1.729883, -1.001409, -6.959521,
-  // f 940/738 941/739 855/634 854/633
-  -0.004203, -3.864052, -6.935812,
-  -0.004202, -4.46678, -6.502734,
-  -1.725912, -4.435583, -6.502732,
-  // f 940/738 941/739 855/634 854/633
-  -0.004203, -3.864052, -6.935812,
-  -1.728629, -3.855525, -6.935184,
-  -1.725912, -4.435583, -6.502732,
-  // f 942/740 943/741 857/636 856/635
-  -1.209482, 4.910644, -6.016822,
-  -1.2099, 4.706615, -6.473821,
-  -1.72424, 4.699127, -6.502733,
-  // f 942/740 943/741 857/636 856/635
-  -1.209482, 4.910644, -6.016822,
-  -1.723403, 4.899829, -6.045943,
-  -1.72424, 4.699127, -6.502733,
-  // f 944/742 945/743 860/641 859/640
-  -0.004202, -4.840312, -6.085466,
-  -0.004198, -4.840312, -3.696264,
-  -1.726535, -4.787485, -3.622003,
-  // f 944/742 945/743 860/641 859/640
-  -0.004202, -4.840312, -6.085466,
-  -1.726538, -4.787485, -6.05863,
-  -1.726535, -4.787485, -3.622003,
-  // f 937/735 938/736 847/626 846/625
-  -0.004203, 3.855351, -6.959525,
-  -0.004203, 1.425099, -6.959524,
-  -1.729883, 1.422395, -6.959522,
-  // f 937/735 938/736 847/626 846/625
-  -0.004203, 3.855351, -6.959525,
-  -1.729883, 3.846199, -6.959522,
-  -1.729883, 1.422395, -6.959522,
-  // f 945/743 946/744 947/745 860/641
-  -0.004198, -4.840312, -3.696264,
-  -0.004198, -4.871509, -3.1752,
-  -1.210941, -4.815562, -3.015863,
-  // f 945/743 946/744 947/745 860/641
-  -0.004198, -4.840312, -3.696264,
-  -1.726535, -4.787485, -3.622003,
-  -1.210941, -4.815562, -3.015863,
-  // f 947/745 948/746 913/695 899/679
-  -1.210941, -4.815562, -3.015863,
-  -1.21324, -4.875876, -3.015863,
-  -1.729249, -4.847799, -1.824174,
-  // f 947/745 948/746 913/695 899/679
-  -1.210941, -4.815562, -3.015863,
-  -1.726532, -4.787485, -1.824174,
-  -1.729249, -4.847799, -1.824174,
-  // f 914/696 864/645 935/733 949/747
-  -3.918901, -4.558914, -1.418967,
-  -3.922663, -4.776462, -1.418967,
-  -1.729458, -4.847799, -1.618868,
-  // f 914/696 864/645 935/733 949/747
-  -3.918901, -4.558914, -1.418967,
-  -1.726532, -4.630251, -1.618868,
-  -1.729458, -4.847799, -1.618868,
-  // f 867/648 950/748 889/670 888/669
-  -0.004197, 4.875288, -2.819505,
-  -0.004199, 4.921043, -4.057163,
-  -1.937203, 4.911892, -3.933187,
-  // f 867/648 950/748 889/670 888/669
-  -0.004197, 4.875288, -2.819505,
-  -2.063436, 4.874872, -2.885233,
-  -1.937203, 4.911892, -3.933187,
-  // f 951/749 935/733 913/695 948/746
-  -1.213449, -4.875876, -2.814925,
-  -1.729458, -4.847799, -1.618868,
-  -1.729249, -4.847799, -1.824174,
-  // f 951/749 935/733 913/695 948/746
-  -1.213449, -4.875876, -2.814925,
-  -1.21324, -4.875876, -3.015863,
-  -1.729249, -4.847799, -1.824174,
-  // f 949/747 935/733 951/749 952/750
-  -1.726532, -4.630251, -1.618868,
-  -1.729458, -4.847799, -1.618868,
-  -1.213449, -4.875876, -2.814925,
-  // f 949/747 935/733 951/749 952/750
-  -1.726532, -4.630251, -1.618868,
-  -1.21094, -4.658329, -2.814925,
-  -1.213449, -4.875876, -2.814925,
-  // f 953/751 954/752 943/741 942/740
-  -0.004201, 4.920627, -6.043658,
-  -0.004202, 4.713479, -6.500447,
-  -1.2099, 4.706615, -6.473821,
-  // f 953/751 954/752 943/741 942/740
-  -0.004201, 4.920627, -6.043658,
-  -1.209482, 4.910644, -6.016822,
-  -1.2099, 4.706615, -6.473821,
-  // f 946/744 955/753 948/746 947/745
-  -0.004198, -4.871509, -3.1752,
-  -0.004198, -4.901874, -3.273797,
-  -1.21324, -4.875876, -3.015863,
-  // f 946/744 955/753 948/746 947/745
-  -0.004198, -4.871509, -3.1752,
-  -1.210941, -4.815562, -3.015863,
-  -1.21324, -4.875876, -3.015863,
-  // f 947/745 899/679 860/641
-  -1.210941, -4.815562, -3.015863,
-  -1.726532, -4.787485, -1.824174,
-  -1.726535, -4.787485, -3.622003,
-  // f 779/552 817/596 850/629
-  -8.106563, -3.259869, -6.935593,
-  -8.077513, -3.202882, -6.959512,
-  -8.036549, -3.24531, -6.959512,
-  // f 783/556 772/545 816/595
-  -8.104473, 3.681688, -6.934137,
-  -8.036549, 3.665673, -6.959514,
-  -8.077513, 3.623245, -6.959514,
-  // f 769/542 790/563 853/632 770/543
-  -7.245708, 4.013208, -6.959515,
-  -7.276848, 4.077266, -6.933306,
-  -3.920998, 4.2632, -6.930398,
-  // f 769/542 790/563 853/632 770/543
-  -7.245708, 4.013208, -6.959515,
-  -3.922043, 4.193735, -6.959519,
-  -3.920998, 4.2632, -6.930398,
-  // f 818/597 788/561 775/548 768/541
-  -8.256413, -2.590172, -6.959512,
-  -8.328516, -2.607226, -6.934759,
-  -8.329352, -0.728954, -6.934136,
-  // f 818/597 788/561 775/548 768/541
-  -8.256413, -2.590172, -6.959512,
-  -8.268326, -0.75412, -6.959513,
-  -8.329352, -0.728954, -6.934136,
-  // f 849/628 780/553 779/552 850/629
-  -7.245708, -3.592846, -6.959514,
-  -7.280192, -3.657736, -6.937464,
-  -8.106563, -3.259869, -6.935593,
-  // f 849/628 780/553 779/552 850/629
-  -7.245708, -3.592846, -6.959514,
-  -8.036549, -3.24531, -6.959512,
-  -8.106563, -3.259869, -6.935593,
-  // f 815/594 784/557 783/556 816/595
-  -8.256413, 3.010326, -6.959513,
-  -8.328516, 3.027589, -6.93476,
-  -8.104473, 3.681688, -6.934137,
-  // f 815/594 784/557 783/556 816/595
-  -8.256413, 3.010326, -6.959513,
-  -8.077513, 3.623245, -6.959514,
-  -8.104473, 3.681688, -6.934137,
-  // f 817/596 779/552 788/561 818/597
-  -8.077513, -3.202882, -6.959512,
-  -8.106563, -3.259869, -6.935593,
-  -8.328516, -2.607226, -6.934759,
-  // f 817/596 779/552 788/561 818/597
-  -8.077513, -3.202882, -6.959512,
-  -8.256413, -2.590172, -6.959512,
-  -8.328516, -2.607226, -6.934759,
-  // f 772/545 783/556 790/563 769/542
-  -8.036549, 3.665673, -6.959514,
-  -8.104473, 3.681688, -6.934137,
-  -7.276848, 4.077266, -6.933306,
-  // f 772/545 783/556 790/563 769/542
-  -8.036549, 3.665673, -6.959514,
-  -7.245708, 4.013208, -6.959515,
-  -7.276848, 4.077266, -6.933306,
-  // f 768/541 775/548 778/551 765/538
-  -8.268326, -0.75412, -6.959513,
-  -8.329352, -0.728954, -6.934136,
-  -8.329352, 1.149525, -6.934137,
-  // f 768/541 775/548 778/551 765/538
-  -8.268326, -0.75412, -6.959513,
-  -8.268326, 1.174483, -6.959513,
-  -8.329352, 1.149525, -6.934137,
-  // f 765/538 778/551 784/557 815/594
-  -8.268326, 1.174483, -6.959513,
-  -8.329352, 1.149525, -6.934137,
-  -8.328516, 3.027589, -6.93476,
-  // f 765/538 778/551 784/557 815/594
-  -8.268326, 1.174483, -6.959513,
-  -8.256413, 3.010326, -6.959513,
-  -8.328516, 3.027589, -6.93476,
-  // f 770/543 853/632 934/730 845/624
-  -3.922043, 4.193735, -6.959519,
-  -3.920998, 4.2632, -6.930398,
-  -1.727584, 4.272559, -6.930609,
-  // f 770/543 853/632 934/730 845/624
-  -3.922043, 4.193735, -6.959519,
-  -1.728002, 4.202886, -6.959522,
-  -1.727584, 4.272559, -6.930609,
-  // f 852/631 791/564 780/553 849/628
-  -3.923924, -3.771293, -6.959518,
-  -3.923297, -3.844294, -6.93435,
-  -7.280192, -3.657736, -6.937464,
-  // f 852/631 791/564 780/553 849/628
-  -3.923924, -3.771293, -6.959518,
-  -7.245708, -3.592846, -6.959514,
-  -7.280192, -3.657736, -6.937464,
-  // f 933/729 854/633 791/564 852/631
-  -1.728838, -3.782108, -6.959521,
-  -1.728629, -3.855525, -6.935184,
-  -3.923297, -3.844294, -6.93435,
-  // f 933/729 854/633 791/564 852/631
-  -1.728838, -3.782108, -6.959521,
-  -3.923924, -3.771293, -6.959518,
-  -3.923297, -3.844294, -6.93435,
-  // f 845/624 934/730 936/734
-  -1.728002, 4.202886, -6.959522,
-  -1.727584, 4.272559, -6.930609,
-  -0.004203, 4.24469, -6.945172,
-  // f 925/754 882/663 883/664 956/755
-  -8.895514, 3.119517, -0.604811,
-  -8.887572, 1.355011, -0.604811,
-  -7.917622, 1.355011, -0.604812,
-  // f 925/754 882/663 883/664 956/755
-  -8.895514, 3.119517, -0.604811,
-  -7.920339, 3.119517, -0.604813,
-  -7.917622, 1.355011, -0.604812,
-  // f 926/756 925/754 956/755 957/757
-  -8.523293, 3.967661, -0.604812,
-  -8.895514, 3.119517, -0.604811,
-  -7.920339, 3.119517, -0.604813,
-  // f 926/756 925/754 956/755 957/757
-  -8.523293, 3.967661, -0.604812,
-  -7.54749, 3.973069, -0.604813,
-  -7.920339, 3.119517, -0.604813,
-  // f 926/756 957/757 927/758
-  -8.523293, 3.967661, -0.604812,
-  -7.54749, 3.973069, -0.604813,
-  -7.548117, 4.518394, -0.604813,
-  // f 928/759 927/758 957/757 958/760
-  -3.911587, 4.678539, -1.73972,
-  -7.548117, 4.518394, -0.604813,
-  -7.54749, 3.973069, -0.604813,
-  // f 928/759 927/758 957/757 958/760
-  -3.911587, 4.678539, -1.73972,
-  -3.911587, 4.138829, -1.73972,
-  -7.54749, 3.973069, -0.604813,
-  // f 929/761 928/759 958/760 959/762
-  -2.074302, 4.67937, -2.129534,
-  -3.911587, 4.678539, -1.73972,
-  -3.911587, 4.138829, -1.73972,
-  // f 929/761 928/759 958/760 959/762
-  -2.074302, 4.67937, -2.129534,
-  -2.074302, 4.13966, -2.129534,
-  -3.911587, 4.138829, -1.73972,
-  // f 930/763 929/761 959/762 960/764
-  -1.953503, 4.679578, -2.683048,
-  -2.074302, 4.67937, -2.129534,
-  -2.074302, 4.13966, -2.129534,
-  // f 930/763 929/761 959/762 960/764
-  -1.953503, 4.679578, -2.683048,
-  -1.953503, 4.140077, -2.683048,
-  -2.074302, 4.13966, -2.129534,
-  // f 875/656 917/765 961/766 876/657
-  -8.939404, -1.093959, -0.604811,
-  -8.876079, -2.769242, -0.60481,
-  -7.863074, -2.769242, -0.604812,
-  // f 875/656 917/765 961/766 876/657
-  -8.939404, -1.093959, -0.604811,
-  -7.925146, -1.093959, -0.604812,
-  -7.863074, -2.769242, -0.604812,
-  // f 916/767 915/768 962/769
-  -8.702402, -3.492182, -0.604811,
-  -7.816259, -4.236752, -0.605228,
-  -7.82232, -3.49863, -0.60502,
-  // f 917/765 916/767 962/769 961/766
-  -8.876079, -2.769242, -0.60481,
-  -8.702402, -3.492182, -0.604811,
-  -7.82232, -3.49863, -0.60502,
-  // f 917/765 916/767 962/769 961/766
-  -8.876079, -2.769242, -0.60481,
-  -7.863074, -2.769242, -0.604812,
-  -7.82232, -3.49863, -0.60502,
-  // f 952/770 963/771 964/772 965/773
-  -1.21094, -4.658329, -2.814925,
-  -0.004197, -4.684118, -3.076395,
-  -0.004197, -3.521508, -3.076396,
-  // f 952/770 963/771 964/772 965/773
-  -1.21094, -4.658329, -2.814925,
-  -1.21094, -3.520676, -2.814925,
-  -0.004197, -3.521508, -3.076396,
-  // f 915/768 914/774 966/775 962/769
-  -7.816259, -4.236752, -0.605228,
-  -3.918901, -4.558914, -1.418967,
-  -3.918901, -3.516932, -1.418967,
-  // f 915/768 914/774 966/775 962/769
-  -7.816259, -4.236752, -0.605228,
-  -7.82232, -3.49863, -0.60502,
-  -3.918901, -3.516932, -1.418967,
-  // f 914/774 949/776 967/777 966/775
-  -3.918901, -4.558914, -1.418967,
-  -1.726532, -4.630251, -1.618868,
-  -1.726532, -3.519636, -1.618868,
-  // f 914/774 949/776 967/777 966/775
-  -3.918901, -4.558914, -1.418967,
-  -3.918901, -3.516932, -1.418967,
-  -1.726532, -3.519636, -1.618868,
-  // f 949/776 952/770 965/773 967/777
-  -1.726532, -4.630251, -1.618868,
-  -1.21094, -4.658329, -2.814925,
-  -1.21094, -3.520676, -2.814925,
-  // f 949/776 952/770 965/773 967/777
-  -1.726532, -4.630251, -1.618868,
-  -1.726532, -3.519636, -1.618868,
-  -1.21094, -3.520676, -2.814925,
-  // f 871/652 880/661 968/778 969/779
-  -7.921387, 1.135383, -2.979453,
-  -7.921387, 0.792839, -3.239881,
-  -6.301463, 0.556573, -6.115412,
-  // f 871/652 880/661 968/778 969/779
-  -7.921387, 1.135383, -2.979453,
-  -6.301463, 0.760602, -6.105843,
-  -6.301463, 0.556573, -6.115412,
-  // f 877/658 876/657 970/780 971/781
-  -7.921386, -1.09396, -2.564057,
-  -7.925146, -1.093959, -0.604812,
-  -6.305015, -0.567145, -6.020144,
-  // f 877/658 876/657 970/780 971/781
-  -7.921386, -1.09396, -2.564057,
-  -6.301463, -0.567145, -6.090867,
-  -6.305015, -0.567145, -6.020144,
-  // f 879/660 886/667 972/782 973/783
-  -7.921387, 0.130421, -3.343886,
-  -7.921387, -0.531788, -3.239881,
-  -6.301463, -0.232297, -6.115412,
-  // f 879/660 886/667 972/782 973/783
-  -7.921387, 0.130421, -3.343886,
-  -6.301463, 0.162242, -6.119156,
-  -6.301463, -0.232297, -6.115412,
-  // f 883/664 872/653 974/784 975/784
-  -7.917622, 1.355011, -0.604812,
-  -7.921386, 1.35501, -2.564058,
-  -6.301463, 0.891421, -6.090867,
-  // f 883/664 872/653 974/784 975/784
-  -7.917622, 1.355011, -0.604812,
-  -6.2977, 0.891421, -6.020144,
-  -6.301463, 0.891421, -6.090867,
-  // f 885/666 877/658 971/781 976/785
-  -7.921387, -0.869341, -3.012318,
-  -7.921386, -1.09396, -2.564057,
-  -6.301463, -0.567145, -6.090867,
-  // f 885/666 877/658 971/781 976/785
-  -7.921387, -0.869341, -3.012318,
-  -6.301463, -0.433206, -6.107092,
-  -6.301463, -0.567145, -6.090867,
-  // f 872/653 871/652 969/779 974/784
-  -7.921386, 1.35501, -2.564058,
-  -7.921387, 1.135383, -2.979453,
-  -6.301463, 0.760602, -6.105843,
-  // f 872/653 871/652 969/779 974/784
-  -7.921386, 1.35501, -2.564058,
-  -6.301463, 0.891421, -6.090867,
-  -6.301463, 0.760602, -6.105843,
-  // f 886/667 885/666 976/785 972/782
-  -7.921387, -0.531788, -3.239881,
-  -7.921387, -0.869341, -3.012318,
-  -6.301463, -0.433206, -6.107092,
-  // f 886/667 885/666 976/785 972/782
-  -7.921387, -0.531788, -3.239881,
-  -6.301463, -0.232297, -6.115412,
-  -6.301463, -0.433206, -6.107092,
-  // f 880/661 879/660 973/783 968/778
-  -7.921387, 0.792839, -3.239881,
-  -7.921387, 0.130421, -3.343886,
-  -6.301463, 0.162242, -6.119156,
-  // f 880/661 879/660 973/783 968/778
-  -7.921387, 0.792839, -3.239881,
-  -6.301463, 0.556573, -6.115412,
-  -6.301463, 0.162242, -6.119156,
-  // f 956/755 883/664 975/784 977/786
-  -7.920339, 3.119517, -0.604813,
-  -7.917622, 1.355011, -0.604812,
-  -6.2977, 0.891421, -6.020144,
-  // f 956/755 883/664 975/784 977/786
-  -7.920339, 3.119517, -0.604813,
-  -6.300417, 1.942347, -6.020144,
-  -6.2977, 0.891421, -6.020144,
-  // f 957/757 956/755 977/786 978/787
-  -7.54749, 3.973069, -0.604813,
-  -7.920339, 3.119517, -0.604813,
-  -6.300417, 1.942347, -6.020144,
-  // f 957/757 956/755 977/786 978/787
-  -7.54749, 3.973069, -0.604813,
-  -5.92736, 2.450651, -6.020144,
-  -6.300417, 1.942347, -6.020144,
-  // f 958/760 957/757 978/787 979/788
-  -3.911587, 4.138829, -1.73972,
-  -7.54749, 3.973069, -0.604813,
-  -5.92736, 2.450651, -6.020144,
-  // f 958/760 957/757 978/787 979/788
-  -3.911587, 4.138829, -1.73972,
-  -2.291664, 2.549442, -6.061128,
-  -5.92736, 2.450651, -6.020144,
-  // f 959/762 958/760 979/788 980/789
-  -2.074302, 4.13966, -2.129534,
-  -3.911587, 4.138829, -1.73972,
-  -2.291664, 2.549442, -6.061128,
-  // f 959/762 958/760 979/788 980/789
-  -2.074302, 4.13966, -2.129534,
-  -0.454379, 2.549858, -6.075274,
-  -2.291664, 2.549442, -6.061128,
-  // f 960/764 959/762 980/789 981/790
-  -1.953503, 4.140077, -2.683048,
-  -2.074302, 4.13966, -2.129534,
-  -0.454379, 2.549858, -6.075274,
-  // f 960/764 959/762 980/789 981/790
-  -1.953503, 4.140077, -2.683048,
-  -0.333579, 2.550065, -6.095243,
-  -0.454379, 2.549858, -6.075274,
-  // f 876/657 961/766 982/791 970/780
-  -7.925146, -1.093959, -0.604812,
-  -7.863074, -2.769242, -0.604812,
-  -6.243153, -1.564828, -6.020144,
-  // f 876/657 961/766 982/791 970/780
-  -7.925146, -1.093959, -0.604812,
-  -6.305015, -0.567145, -6.020144,
-  -6.243153, -1.564828, -6.020144,
-  // f 961/766 962/769 983/792 982/791
-  -7.863074, -2.769242, -0.604812,
-  -7.82232, -3.49863, -0.60502,
-  -6.202398, -1.999299, -6.020144,
-  // f 961/766 962/769 983/792 982/791
-  -7.863074, -2.769242, -0.604812,
-  -6.243153, -1.564828, -6.020144,
-  -6.202398, -1.999299, -6.020144,
-  // f 965/773 964/772 984/793
-  -1.21094, -3.520676, -2.814925,
-  -0.004197, -3.521508, -3.076396,
-  -0.0042, -2.396958, -5.262371,
-  // f 962/769 966/775 985/794 983/792
-  -7.82232, -3.49863, -0.60502,
-  -3.918901, -3.516932, -1.418967,
-  -2.298979, -2.010114, -6.049685,
-  // f 962/769 966/775 985/794 983/792
-  -7.82232, -3.49863, -0.60502,
-  -6.202398, -1.999299, -6.020144,
-  -2.298979, -2.010114, -6.049685,
-  // f 966/775 967/777 986/795 985/794
-  -3.918901, -3.516932, -1.418967,
-  -1.726532, -3.519636, -1.618868,
-  -0.10661, -2.01157, -6.056761,
-  // f 966/775 967/777 986/795 985/794
-  -3.918901, -3.516932, -1.418967,
-  -2.298979, -2.010114, -6.049685,
-  -0.10661, -2.01157, -6.056761,
-  // f 984/793 987/796 986/795 965/773
-  -0.0042, -2.396958, -5.262371,
-  0.047212, -2.011778, -6.06113,
-  -0.10661, -2.01157, -6.056761,
-  // f 984/793 987/796 986/795 965/773
-  -0.0042, -2.396958, -5.262371,
-  -1.21094, -3.520676, -2.814925,
-  -0.10661, -2.01157, -6.056761,
-  // f 967/777 965/773 986/795
-  -1.726532, -3.519636, -1.618868,
-  -1.21094, -3.520676, -2.814925,
-  -0.10661, -2.01157, -6.056761,
-  // f 933/729 932/728 988/797 989/798
-  -1.728838, -3.782108, -6.959521,
-  -1.729883, -3.425213, -6.959521,
-  -0.004203, -3.435404, -6.959523,
-  // f 933/729 932/728 988/797 989/798
-  -1.728838, -3.782108, -6.959521,
-  -0.004203, -3.790011, -6.959523,
-  -0.004203, -3.435404, -6.959523,
-  // f 934/730 857/636 943/741 954/752
-  -1.727584, 4.272559, -6.930609,
-  -1.72424, 4.699127, -6.502733,
-  -1.2099, 4.706615, -6.473821,
-  // f 934/730 857/636 943/741 954/752
-  -1.727584, 4.272559, -6.930609,
-  -0.004202, 4.713479, -6.500447,
-  -1.2099, 4.706615, -6.473821,
-  // f 936/734 934/730 954/752
-  -0.004203, 4.24469, -6.945172,
-  -1.727584, 4.272559, -6.930609,
-  -0.004202, 4.713479, -6.500447,
-  // f 859/731 855/634 941/739 944/799
-  -1.726538, -4.787485, -6.05863,
-  -1.725912, -4.435583, -6.502732,
-  -0.004202, -4.46678, -6.502734,
-  // f 859/731 855/634 941/739 944/799
-  -1.726538, -4.787485, -6.05863,
-  -0.004202, -4.840312, -6.085466,
-  -0.004202, -4.46678, -6.502734,
-  // f 942/800 856/732 889/670 953/801
-  -1.209482, 4.910644, -6.016822,
-  -1.723403, 4.899829, -6.045943,
-  -1.937203, 4.911892, -3.933187,
-  // f 942/800 856/732 889/670 953/801
-  -1.209482, 4.910644, -6.016822,
-  -0.004201, 4.920627, -6.043658,
-  -1.937203, 4.911892, -3.933187,
-  // f 953/801 889/670 950/748
-  -0.004201, 4.920627, -6.043658,
-  -1.937203, 4.911892, -3.933187,
-  -0.004199, 4.921043, -4.057163,
-  // f 932/728 848/627 939/737 988/797
-  -1.729883, -3.425213, -6.959521,
-  -1.729883, -1.001409, -6.959521,
-  -0.004203, -1.005153, -6.959524,
-  // f 932/728 848/627 939/737 988/797
-  -1.729883, -3.425213, -6.959521,
-  -0.004203, -3.435404, -6.959523,
-  -0.004203, -1.005153, -6.959524,
-  // f 946/802 951/749 948/746
-  -0.004198, -4.871509, -3.1752,
-  -1.213449, -4.875876, -2.814925,
-  -1.21324, -4.875876, -3.015863,
-  // f 948/746 955/753 946/802
-  -1.21324, -4.875876, -3.015863,
-  -0.004198, -4.901874, -3.273797,
-  -0.004198, -4.871509, -3.1752,
-  // f 888/669 869/650 868/649 867/648
-  -2.063436, 4.874872, -2.885233,
-  -2.063018, 4.875079, -2.880448,
-  -0.004197, 4.875288, -2.914149,
-  // f 888/669 869/650 868/649 867/648
-  -2.063436, 4.874872, -2.885233,
-  -0.004197, 4.875288, -2.819505,
-  -0.004197, 4.875288, -2.914149,
-  // f 963/803 952/750 951/749 946/802
-  -0.004197, -4.684118, -3.076395,
-  -1.21094, -4.658329, -2.814925,
-  -1.213449, -4.875876, -2.814925,
-  // f 963/803 952/750 951/749 946/802
-  -0.004197, -4.684118, -3.076395,
-  -0.004198, -4.871509, -3.1752,
-  -1.213449, -4.875876, -2.814925,
-  // f 854/633 933/729 989/798 940/738
-  -1.728629, -3.855525, -6.935184,
-  -1.728838, -3.782108, -6.959521,
-  -0.004203, -3.790011, -6.959523,
-  // f 854/633 933/729 989/798 940/738
-  -1.728629, -3.855525, -6.935184,
-  -0.004203, -3.864052, -6.935812,
-  -0.004203, -3.790011, -6.959523,
-  // f 930/763 960/764 990/804 931/805
-  -1.953503, 4.679578, -2.683048,
-  -1.953503, 4.140077, -2.683048,
-  -0.004197, 4.140492, -2.724652,
-  // f 930/763 960/764 990/804 931/805
-  -1.953503, 4.679578, -2.683048,
-  -0.004197, 4.680202, -2.724653,
-  -0.004197, 4.140492, -2.724652,
-  // f 990/804 960/764 981/790 991/806
-  -0.004197, 4.140492, -2.724652,
-  -1.953503, 4.140077, -2.683048,
-  -0.333579, 2.550065, -6.095243,
-  // f 990/804 960/764 981/790 991/806
-  -0.004197, 4.140492, -2.724652,
-  -0.004202, 2.550065, -6.095452,
-  -0.333579, 2.550065, -6.095243,
-  // f 992/807 993/808 994/809 995/810
-  8.25992, 1.174483, -6.959535,
-  8.25992, -0.75412, -6.959535,
-  8.069316, -0.941095, -6.959535,
-  // f 992/807 993/808 994/809 995/810
-  8.25992, 1.174483, -6.959535,
-  8.069316, 1.361457, -6.959535,
-  8.069316, -0.941095, -6.959535,
-  // f 996/811 997/812 998/813 999/814
-  7.237302, 4.013208, -6.959534,
-  8.028353, 3.665673, -6.959535,
-  3.917818, 3.834137, -6.95953,
-  // f 996/811 997/812 998/813 999/814
-  7.237302, 4.013208, -6.959534,
-  3.913847, 4.193735, -6.95953,
-  3.917818, 3.834137, -6.95953,
-  // f 995/810 994/809 1000/815 1001/816
-  8.069316, 1.361457, -6.959535,
-  8.069316, -0.941095, -6.959535,
-  3.917818, -0.996418, -6.959529,
-  // f 995/810 994/809 1000/815 1001/816
-  8.069316, 1.361457, -6.959535,
-  3.917818, 1.418859, -6.959529,
-  3.917818, -0.996418, -6.959529,
-  // f 1002/817 1003/818 1004/819 1005/820
-  8.321157, -0.728954, -6.934159,
-  8.321157, 1.149525, -6.934159,
-  8.860158, 1.210879, -6.502747,
-  // f 1002/817 1003/818 1004/819 1005/820
-  8.321157, -0.728954, -6.934159,
-  8.860158, -0.789269, -6.502747,
-  8.860158, 1.210879, -6.502747,
-  // f 1006/821 1007/822 1008/823 1009/824
-  8.098367, -3.259869, -6.935614,
-  8.625037, -3.551873, -6.502746,
-  7.747045, -4.135467, -6.502744,
-  // f 1006/821 1007/822 1008/823 1009/824
-  8.098367, -3.259869, -6.935614,
-  7.271996, -3.657736, -6.937484,
-  7.747045, -4.135467, -6.502744,
-  // f 1010/825 1011/826 1012/827 1013/828
-  8.096276, 3.681688, -6.934159,
-  8.555651, 3.980348, -6.502747,
-  8.860158, 3.211027, -6.502747,
-  // f 1010/825 1011/826 1012/827 1013/828
-  8.096276, 3.681688, -6.934159,
-  8.320111, 3.027589, -6.934783,
-  8.860158, 3.211027, -6.502747,
-  // f 1006/821 1014/829 1015/830 1007/822
-  8.098367, -3.259869, -6.935614,
-  8.320111, -2.607226, -6.934782,
-  8.860158, -2.789417, -6.502746,
-  // f 1006/821 1014/829 1015/830 1007/822
-  8.098367, -3.259869, -6.935614,
-  8.625037, -3.551873, -6.502746,
-  8.860158, -2.789417, -6.502746,
-  // f 1010/825 1016/831 1017/832 1011/826
-  8.096276, 3.681688, -6.934159,
-  7.268443, 4.077266, -6.933325,
-  7.609316, 4.464109, -6.502746,
-  // f 1010/825 1016/831 1017/832 1011/826
-  8.096276, 3.681688, -6.934159,
-  8.555651, 3.980348, -6.502747,
-  7.609316, 4.464109, -6.502746,
-  // f 1009/824 1008/823 1018/833 1019/834
-  7.271996, -3.657736, -6.937484,
-  7.747045, -4.135467, -6.502744,
-  3.908832, -4.393363, -6.502739,
-  // f 1009/824 1008/823 1018/833 1019/834
-  7.271996, -3.657736, -6.937484,
-  3.915101, -3.844294, -6.934361,
-  3.908832, -4.393363, -6.502739,
-  // f 1020/835 1017/832 1021/836 1022/837
-  7.541393, 4.633198, -6.045956,
-  7.609316, 4.464109, -6.502746,
-  3.90507, 4.680201, -6.502741,
-  // f 1020/835 1017/832 1021/836 1022/837
-  7.541393, 4.633198, -6.045956,
-  3.903189, 4.872167, -6.04595,
-  3.90507, 4.680201, -6.502741,
-  // f 1023/838 1024/839 1005/820 1004/819
-  8.931216, 1.218367, -6.045957,
-  8.931216, -0.797796, -6.045957,
-  8.860158, -0.789269, -6.502747,
-  // f 1023/838 1024/839 1005/820 1004/819
-  8.931216, 1.218367, -6.045957,
-  8.860158, 1.210879, -6.502747,
-  8.860158, -0.789269, -6.502747,
-  // f 1025/840 1008/823 1007/822 1026/841
-  7.808908, -4.393778, -6.045954,
-  7.747045, -4.135467, -6.502744,
-  8.625037, -3.551873, -6.502746,
-  // f 1025/840 1008/823 1007/822 1026/841
-  7.808908, -4.393778, -6.045954,
-  8.694215, -3.649416, -6.045956,
-  8.625037, -3.551873, -6.502746,
-  // f 1027/842 1012/827 1011/826 1028/843
-  8.931216, 3.234321, -6.045957,
-  8.860158, 3.211027, -6.502747,
-  8.555651, 3.980348, -6.502747,
-  // f 1027/842 1012/827 1011/826 1028/843
-  8.931216, 3.234321, -6.045957,
-  8.558995, 4.082466, -6.045957,
-  8.555651, 3.980348, -6.502747,
-  // f 1007/822 1015/830 1029/844 1026/841
-  8.625037, -3.551873, -6.502746,
-  8.860158, -2.789417, -6.502746,
-  8.931216, -2.813959, -6.045956,
-  // f 1007/822 1015/830 1029/844 1026/841
-  8.625037, -3.551873, -6.502746,
-  8.694215, -3.649416, -6.045956,
-  8.931216, -2.813959, -6.045956,
-  // f 1011/826 1017/832 1020/835 1028/843
-  8.555651, 3.980348, -6.502747,
-  7.609316, 4.464109, -6.502746,
-  7.541393, 4.633198, -6.045956,
-  // f 1011/826 1017/832 1020/835 1028/843
-  8.555651, 3.980348, -6.502747,
-  8.558995, 4.082466, -6.045957,
-  7.541393, 4.633198, -6.045956,
-  // f 1030/845 1031/846 1032/847 1033/848
-  8.994129, -0.576712, -3.411096,
-  8.9958, -0.612069, -3.545262,
-  8.9958, 0.140404, -3.648227,
-  // f 1030/845 1031/846 1032/847 1033/848
-  8.994129, -0.576712, -3.411096,
-  8.994128, 0.136037, -3.514269,
-  8.9958, 0.140404, -3.648227,
-  // f 1025/849 1026/850 1034/851 1035/852
-  7.808908, -4.393778, -6.045954,
-  8.694215, -3.649416, -6.045956,
-  8.69422, -3.649416, -2.876925,
-  // f 1025/849 1026/850 1034/851 1035/852
-  7.808908, -4.393778, -6.045954,
-  7.808912, -4.393778, -2.876924,
-  8.69422, -3.649416, -2.876925,
-  // f 1036/853 1037/854 1027/855 1028/856
-  8.559, 4.082467, -2.876927,
-  8.931221, 3.234322, -2.871727,
-  8.931216, 3.234321, -6.045957,
-  // f 1036/853 1037/854 1027/855 1028/856
-  8.559, 4.082467, -2.876927,
-  8.558995, 4.082466, -6.045957,
-  8.931216, 3.234321, -6.045957,
-  // f 1038/857 1034/851 1026/850 1029/858
-  8.931221, -2.813958, -2.871726,
-  8.69422, -3.649416, -2.876925,
-  8.694215, -3.649416, -6.045956,
-  // f 1038/857 1034/851 1026/850 1029/858
-  8.931221, -2.813958, -2.871726,
-  8.931216, -2.813959, -6.045956,
-  8.694215, -3.649416, -6.045956,
-  // f 1028/856 1020/859 1039/860 1036/853
-  8.558995, 4.082466, -6.045957,
-  7.541393, 4.633198, -6.045956,
-  7.541398, 4.633199, -2.876925,
-  // f 1028/856 1020/859 1039/860 1036/853
-  8.558995, 4.082466, -6.045957,
-  8.559, 4.082467, -2.876927,
-  7.541398, 4.633199, -2.876925,
-  // f 1025/849 1035/852 1040/861 1041/862
-  7.808908, -4.393778, -6.045954,
-  7.808912, -4.393778, -2.876924,
-  3.910717, -4.716147, -3.521749,
-  // f 1025/849 1035/852 1040/861 1041/862
-  7.808908, -4.393778, -6.045954,
-  3.910504, -4.716148, -6.036797,
-  3.910717, -4.716147, -3.521749,
-  // f 1042/863 992/807 995/810 1043/864
-  8.248217, 3.010326, -6.959535,
-  8.25992, 1.174483, -6.959535,
-  8.069316, 1.361457, -6.959535,
-  // f 1042/863 992/807 995/810 1043/864
-  8.248217, 3.010326, -6.959535,
-  8.069316, 3.623245, -6.959535,
-  8.069316, 1.361457, -6.959535,
-  // f 994/809 993/808 1044/865 1045/866
-  8.069316, -0.941095, -6.959535,
-  8.25992, -0.75412, -6.959535,
-  8.248217, -2.590172, -6.959535,
-  // f 994/809 993/808 1044/865 1045/866
-  8.069316, -0.941095, -6.959535,
-  8.069316, -3.202882, -6.959534,
-  8.248217, -2.590172, -6.959535,
-  // f 1001/816 998/813 997/812 995/810
-  3.917818, 1.418859, -6.959529,
-  3.917818, 3.834137, -6.95953,
-  8.028353, 3.665673, -6.959535,
-  // f 1001/816 998/813 997/812 995/810
-  3.917818, 1.418859, -6.959529,
-  8.069316, 1.361457, -6.959535,
-  8.028353, 3.665673, -6.959535,
-  // f 995/810 997/812 1043/864
-  8.069316, 1.361457, -6.959535,
-  8.028353, 3.665673, -6.959535,
-  8.069316, 3.623245, -6.959535,
-  // f 1014/829 1002/817 1005/820 1015/830
-  8.320111, -2.607226, -6.934782,
-  8.321157, -0.728954, -6.934159,
-  8.860158, -0.789269, -6.502747,
-  // f 1014/829 1002/817 1005/820 1015/830
-  8.320111, -2.607226, -6.934782,
-  8.860158, -2.789417, -6.502746,
-  8.860158, -0.789269, -6.502747,
-  // f 1004/819 1003/818 1013/828 1012/827
-  8.860158, 1.210879, -6.502747,
-  8.321157, 1.149525, -6.934159,
-  8.320111, 3.027589, -6.934783,
-  // f 1004/819 1003/818 1013/828 1012/827
-  8.860158, 1.210879, -6.502747,
-  8.860158, 3.211027, -6.502747,
-  8.320111, 3.027589, -6.934783,
-  // f 1023/838 1004/819 1012/827 1027/842
-  8.931216, 1.218367, -6.045957,
-  8.860158, 1.210879, -6.502747,
-  8.860158, 3.211027, -6.502747,
-  // f 1023/838 1004/819 1012/827 1027/842
-  8.931216, 1.218367, -6.045957,
-  8.931216, 3.234321, -6.045957,
-  8.860158, 3.211027, -6.502747,
-  // f 1015/830 1005/820 1024/839 1029/844
-  8.860158, -2.789417, -6.502746,
-  8.860158, -0.789269, -6.502747,
-  8.931216, -0.797796, -6.045957,
-  // f 1015/830 1005/820 1024/839 1029/844
-  8.860158, -2.789417, -6.502746,
-  8.931216, -2.813959, -6.045956,
-  8.931216, -0.797796, -6.045957,
-  // f 1046/867 1047/868 1048/869 1049/870
-  8.995801, -1.414458, -2.718631,
-  8.9958, -1.087304, -3.281298,
-  8.994129, -0.991425, -3.162941,
-  // f 1046/867 1047/868 1048/869 1049/870
-  8.995801, -1.414458, -2.718631,
-  8.99413, -1.273447, -2.650612,
-  8.994129, -0.991425, -3.162941,
-  // f 1051/871 1053/872 1052/873
-  8.995804, 1.672597, -0.853823,
-  8.990579, 3.246801, -0.812638,
-  8.990579, 3.246801, -0.604835,
-  // f 1054/874 1055/875 1056/876 1057/877
-  7.556448, 4.691849, -0.824285,
-  3.903195, 4.875288, -1.969374,
-  3.904031, 4.875288, -1.738691,
-  // f 1054/874 1055/875 1056/876 1057/877
-  7.556448, 4.691849, -0.824285,
-  7.560419, 4.690601, -0.604834,
-  3.904031, 4.875288, -1.738691,
-  // f 1058/878 1059/879 1060/880 1061/881
-  7.834204, -4.448892, -0.605249,
-  7.830442, -4.450348, -0.814923,
-  8.745217, -3.682276, -0.770618,
-  // f 1058/878 1059/879 1060/880 1061/881
-  7.834204, -4.448892, -0.605249,
-  8.745218, -3.682068, -0.604834,
-  8.745217, -3.682276, -0.770618,
-  // f 1052/873 1053/872 1062/882 1063/883
-  8.990579, 3.246801, -0.604835,
-  8.990579, 3.246801, -0.812638,
-  8.603727, 4.123439, -0.799325,
-  // f 1052/873 1053/872 1062/882 1063/883
-  8.990579, 3.246801, -0.604835,
-  8.603727, 4.123439, -0.604835,
-  8.603727, 4.123439, -0.799325,
-  // f 1061/881 1060/880 1064/884 1065/885
-  8.745218, -3.682068, -0.604834,
-  8.745217, -3.682276, -0.770618,
-  8.991415, -2.822277, -0.783723,
-  // f 1061/881 1060/880 1064/884 1065/885
-  8.745218, -3.682068, -0.604834,
-  8.991415, -2.822277, -0.604834,
-  8.991415, -2.822277, -0.783723,
-  // f 1063/883 1062/882 1054/874 1057/877
-  8.603727, 4.123439, -0.604835,
-  8.603727, 4.123439, -0.799325,
-  7.556448, 4.691849, -0.824285,
-  // f 1063/883 1062/882 1054/874 1057/877
-  8.603727, 4.123439, -0.604835,
-  7.560419, 4.690601, -0.604834,
-  7.556448, 4.691849, -0.824285,
-  // f 1066/886 1067/887 1068/888 1069/889
-  8.9958, 0.892878, -3.543391,
-  8.9958, 1.379136, -3.241568,
-  8.994129, 1.271818, -3.126331,
-  // f 1066/886 1067/887 1068/888 1069/889
-  8.9958, 0.892878, -3.543391,
-  8.994129, 0.848786, -3.409848,
-  8.994129, 1.271818, -3.126331,
-  // f 1070/890 1046/867 1049/870 1071/891
-  8.995804, -1.424232, -0.827613,
-  8.995801, -1.414458, -2.718631,
-  8.99413, -1.273447, -2.650612,
-  // f 1070/890 1046/867 1049/870 1071/891
-  8.995804, -1.424232, -0.827613,
-  8.994132, -1.278854, -0.824077,
-  8.99413, -1.273447, -2.650612,
-  // f 1072/892 999/814 998/813 1073/893
-  1.719806, 4.202886, -6.959527,
-  3.913847, 4.193735, -6.95953,
-  3.917818, 3.834137, -6.95953,
-  // f 1072/892 999/814 998/813 1073/893
-  1.719806, 4.202886, -6.959527,
-  1.721478, 3.846199, -6.959527,
-  3.917818, 3.834137, -6.95953,
-  // f 1074/894 1001/816 1000/815 1075/895
-  1.721478, 1.422395, -6.959527,
-  3.917818, 1.418859, -6.959529,
-  3.917818, -0.996418, -6.959529,
-  // f 1074/894 1001/816 1000/815 1075/895
-  1.721478, 1.422395, -6.959527,
-  1.721478, -1.001409, -6.959526,
-  3.917818, -0.996418, -6.959529,
-  // f 1076/896 1077/897 1078/898 1079/899
-  7.237302, -3.592846, -6.959533,
-  3.915728, -3.771293, -6.959528,
-  3.917818, -3.411695, -6.959528,
-  // f 1076/896 1077/897 1078/898 1079/899
-  7.237302, -3.592846, -6.959533,
-  8.028353, -3.24531, -6.959534,
-  3.917818, -3.411695, -6.959528,
-  // f 1016/831 1080/900 1021/836 1017/832
-  7.268443, 4.077266, -6.933325,
-  3.912802, 4.2632, -6.930408,
-  3.90507, 4.680201, -6.502741,
-  // f 1016/831 1080/900 1021/836 1017/832
-  7.268443, 4.077266, -6.933325,
-  7.609316, 4.464109, -6.502746,
-  3.90507, 4.680201, -6.502741,
-  // f 1081/901 1019/834 1018/833 1082/902
-  1.720224, -3.855525, -6.935189,
-  3.915101, -3.844294, -6.934361,
-  3.908832, -4.393363, -6.502739,
-  // f 1081/901 1019/834 1018/833 1082/902
-  1.720224, -3.855525, -6.935189,
-  1.717508, -4.435583, -6.502736,
-  3.908832, -4.393363, -6.502739,
-  // f 1083/903 1022/837 1021/836 1084/904
-  1.715, 4.899829, -6.045948,
-  3.903189, 4.872167, -6.04595,
-  3.90507, 4.680201, -6.502741,
-  // f 1083/903 1022/837 1021/836 1084/904
-  1.715, 4.899829, -6.045948,
-  1.715836, 4.699127, -6.502738,
-  3.90507, 4.680201, -6.502741,
-  // f 1041/905 1018/833 1008/823 1025/840
-  3.910504, -4.716148, -6.036797,
-  3.908832, -4.393363, -6.502739,
-  7.747045, -4.135467, -6.502744,
-  // f 1041/905 1018/833 1008/823 1025/840
-  3.910504, -4.716148, -6.036797,
-  7.808908, -4.393778, -6.045954,
-  7.747045, -4.135467, -6.502744,
-  // f 1020/859 1022/906 1085/907 1039/860
-  7.541393, 4.633198, -6.045956,
-  3.903189, 4.872167, -6.04595,
-  3.903192, 4.89983, -3.767203,
-  // f 1020/859 1022/906 1085/907 1039/860
-  7.541393, 4.633198, -6.045956,
-  7.541398, 4.633199, -2.876925,
-  3.903192, 4.89983, -3.767203,
-  // f 1041/862 1040/861 1086/908 1087/909
-  3.910504, -4.716148, -6.036797,
-  3.910717, -4.716147, -3.521749,
-  1.718347, -4.787485, -3.622007,
-  // f 1041/862 1040/861 1086/908 1087/909
-  3.910504, -4.716148, -6.036797,
-  1.718344, -4.787485, -6.058635,
-  1.718347, -4.787485, -3.622007,
-  // f 1073/893 998/813 1001/816 1074/894
-  1.721478, 3.846199, -6.959527,
-  3.917818, 3.834137, -6.95953,
-  3.917818, 1.418859, -6.959529,
-  // f 1073/893 998/813 1001/816 1074/894
-  1.721478, 3.846199, -6.959527,
-  1.721478, 1.422395, -6.959527,
-  3.917818, 1.418859, -6.959529,
-  // f 1000/815 994/809 1045/866 1078/898
-  3.917818, -0.996418, -6.959529,
-  8.069316, -0.941095, -6.959535,
-  8.069316, -3.202882, -6.959534,
-  // f 1000/815 994/809 1045/866 1078/898
-  3.917818, -0.996418, -6.959529,
-  3.917818, -3.411695, -6.959528,
-  8.069316, -3.202882, -6.959534,
-  // f 1078/898 1045/866 1079/899
-  3.917818, -3.411695, -6.959528,
-  8.069316, -3.202882, -6.959534,
-  8.028353, -3.24531, -6.959534,
-  // f 1088/910 1089/911 1090/912 1055/875
-  2.208654, 4.874872, -2.303019,
-  2.205937, 4.87508, -2.326316,
-  2.062148, 4.87508, -2.126627,
-  // f 1088/910 1089/911 1090/912 1055/875
-  2.208654, 4.874872, -2.303019,
-  3.903195, 4.875288, -1.969374,
-  2.062148, 4.87508, -2.126627,
-  // f 1090/912 1056/876 1055/875
-  2.062148, 4.87508, -2.126627,
-  3.904031, 4.875288, -1.738691,
-  3.903195, 4.875288, -1.969374,
-  // f 1091/913 1092/914 1059/879 1058/878
-  3.914272, -4.776462, -1.418978,
-  3.913854, -4.776462, -1.635308,
-  7.830442, -4.450348, -0.814923,
-  // f 1091/913 1092/914 1059/879 1058/878
-  3.914272, -4.776462, -1.418978,
-  7.834204, -4.448892, -0.605249,
-  7.830442, -4.450348, -0.814923,
-  // f 1093/915 1094/916 868/917 867/648
-  1.944483, 4.875079, -2.678477,
-  2.054623, 4.875079, -2.880454,
-  -0.004197, 4.875288, -2.914149,
-  // f 1093/915 1094/916 868/917 867/648
-  1.944483, 4.875079, -2.678477,
-  -0.004197, 4.875288, -2.819505,
-  -0.004197, 4.875288, -2.914149,
-  // f 1095/918 1096/919 1097/920 1098/921
-  8.931221, 1.135383, -2.979476,
-  8.931221, 1.35501, -2.56408,
-  7.912993, 1.35501, -2.564079,
-  // f 1095/918 1096/919 1097/920 1098/921
-  8.931221, 1.135383, -2.979476,
-  7.912992, 1.135383, -2.979475,
-  7.912993, 1.35501, -2.564079,
-  // f 1099/922 1100/923 1101/924 1102/925
-  8.931221, -1.09396, -2.56408,
-  7.912993, -1.09396, -2.564079,
-  7.916758, -1.093959, -0.604833,
-  // f 1099/922 1100/923 1101/924 1102/925
-  8.931221, -1.09396, -2.56408,
-  8.931224, -1.093959, -0.604835,
-  7.916758, -1.093959, -0.604833,
-  // f 1103/926 1104/927 1105/928 1106/929
-  8.93122, 0.130421, -3.343909,
-  8.93122, 0.792839, -3.239904,
-  7.912992, 0.792839, -3.239902,
-  // f 1103/926 1104/927 1105/928 1106/929
-  8.93122, 0.130421, -3.343909,
-  7.912992, 0.130421, -3.343908,
-  7.912992, 0.792839, -3.239902,
-  // f 1107/930 1108/931 1097/920 1096/919
-  8.879184, 1.355011, -0.604835,
-  7.909442, 1.355011, -0.604834,
-  7.912993, 1.35501, -2.564079,
-  // f 1107/930 1108/931 1097/920 1096/919
-  8.879184, 1.355011, -0.604835,
-  8.931221, 1.35501, -2.56408,
-  7.912993, 1.35501, -2.564079,
-  // f 1109/932 1110/933 1111/934 1112/935
-  8.931221, -0.869341, -3.012341,
-  8.93122, -0.531788, -3.239903,
-  7.912992, -0.531788, -3.239902,
-  // f 1109/932 1110/933 1111/934 1112/935
-  8.931221, -0.869341, -3.012341,
-  7.912992, -0.869341, -3.01234,
-  7.912992, -0.531788, -3.239902,
-  // f 1085/907 1113/936 1114/937 1115/938
-  3.903192, 4.89983, -3.767203,
-  1.928806, 4.911892, -3.933192,
-  2.05525, 4.874872, -2.885239,
-  // f 1085/907 1113/936 1114/937 1115/938
-  3.903192, 4.89983, -3.767203,
-  3.903195, 4.87508, -1.970206,
-  2.05525, 4.874872, -2.885239,
-  // f 1115/938 1117/939 1039/860 1085/907
-  3.903195, 4.87508, -1.970206,
-  7.5414, 4.633199, -0.824285,
-  7.541398, 4.633199, -2.876925,
-  // f 1115/938 1117/939 1039/860 1085/907
-  3.903195, 4.87508, -1.970206,
-  3.903192, 4.89983, -3.767203,
-  7.541398, 4.633199, -2.876925,
-  // f 1117/939 1118/940 1036/853 1039/860
-  7.5414, 4.633199, -0.824285,
-  8.559003, 4.082467, -0.799325,
-  8.559, 4.082467, -2.876927,
-  // f 1117/939 1118/940 1036/853 1039/860
-  7.5414, 4.633199, -0.824285,
-  7.541398, 4.633199, -2.876925,
-  8.559, 4.082467, -2.876927,
-  // f 1036/853 1118/940 1119/941 1037/854
-  8.559, 4.082467, -2.876927,
-  8.559003, 4.082467, -0.799325,
-  8.931224, 3.234322, -0.812638,
-  // f 1036/853 1118/940 1119/941 1037/854
-  8.559, 4.082467, -2.876927,
-  8.931221, 3.234322, -2.871727,
-  8.931224, 3.234322, -0.812638,
-  // f 1038/857 1120/942 1121/943 1034/851
-  8.931221, -2.813958, -2.871726,
-  8.931224, -2.813958, -0.783723,
-  8.694222, -3.649415, -0.775818,
-  // f 1038/857 1120/942 1121/943 1034/851
-  8.931221, -2.813958, -2.871726,
-  8.69422, -3.649416, -2.876925,
-  8.694222, -3.649415, -0.775818,
-  // f 1034/851 1121/943 1122/944 1035/852
-  8.69422, -3.649416, -2.876925,
-  8.694222, -3.649415, -0.775818,
-  7.808915, -4.393777, -0.814923,
-  // f 1034/851 1121/943 1122/944 1035/852
-  8.69422, -3.649416, -2.876925,
-  7.808912, -4.393778, -2.876924,
-  7.808915, -4.393777, -0.814923,
-  // f 1035/852 1122/944 1123/945 1040/861
-  7.808912, -4.393778, -2.876924,
-  7.808915, -4.393777, -0.814923,
-  3.910719, -4.716147, -1.635308,
-  // f 1035/852 1122/944 1123/945 1040/861
-  7.808912, -4.393778, -2.876924,
-  3.910717, -4.716147, -3.521749,
-  3.910719, -4.716147, -1.635308,
-  // f 1040/861 1123/945 1124/946 1086/908
-  3.910717, -4.716147, -3.521749,
-  3.910719, -4.716147, -1.635308,
-  1.71835, -4.787485, -1.824179,
-  // f 1040/861 1123/945 1124/946 1086/908
-  3.910717, -4.716147, -3.521749,
-  1.718347, -4.787485, -3.622007,
-  1.71835, -4.787485, -1.824179,
-  // f 1093/915 1090/912 1089/911 1094/916
-  1.944483, 4.875079, -2.678477,
-  2.062148, 4.87508, -2.126627,
-  2.205937, 4.87508, -2.326316,
-  // f 1093/915 1090/912 1089/911 1094/916
-  1.944483, 4.875079, -2.678477,
-  2.054623, 4.875079, -2.880454,
-  2.205937, 4.87508, -2.326316,
-  // f 1051/871 1125/947 1126/948 1127/949
-  8.995804, 1.672597, -0.853823,
-  8.994132, 1.532834, -0.848831,
-  8.99413, 1.528882, -2.609427,
-  // f 1051/871 1125/947 1126/948 1127/949
-  8.995804, 1.672597, -0.853823,
-  8.995801, 1.665733, -2.644996,
-  8.99413, 1.528882, -2.609427,
-  // f 1070/890 1071/891 1128/950
-  8.995804, -1.424232, -0.827613,
-  8.994132, -1.278854, -0.824077,
-  8.991834, -1.093959, -0.604835,
-  // f 1114/937 1094/916 1089/911 1116/951
-  2.05525, 4.874872, -2.885239,
-  2.054623, 4.875079, -2.880454,
-  2.205937, 4.87508, -2.326316,
-  // f 1114/937 1094/916 1089/911 1116/951
-  2.05525, 4.874872, -2.885239,
-  2.208654, 4.874872, -2.329852,
-  2.205937, 4.87508, -2.326316,
-  // f 1116/952 1088/910 1055/875 1115/938
-  2.208654, 4.874872, -2.329852,
-  2.208654, 4.874872, -2.303019,
-  3.903195, 4.875288, -1.969374,
-  // f 1116/952 1088/910 1055/875 1115/938
-  2.208654, 4.874872, -2.329852,
-  3.903195, 4.87508, -1.970206,
-  3.903195, 4.875288, -1.969374,
-  // f 1115/938 1055/875 1054/874 1117/939
-  3.903195, 4.87508, -1.970206,
-  3.903195, 4.875288, -1.969374,
-  7.556448, 4.691849, -0.824285,
-  // f 1115/938 1055/875 1054/874 1117/939
-  3.903195, 4.87508, -1.970206,
-  7.5414, 4.633199, -0.824285,
-  7.556448, 4.691849, -0.824285,
-  // f 1117/939 1054/874 1062/882 1118/940
-  7.5414, 4.633199, -0.824285,
-  7.556448, 4.691849, -0.824285,
-  8.603727, 4.123439, -0.799325,
-  // f 1117/939 1054/874 1062/882 1118/940
-  7.5414, 4.633199, -0.824285,
-  8.559003, 4.082467, -0.799325,
-  8.603727, 4.123439, -0.799325,
-  // f 1118/940 1062/882 1053/872 1119/941
-  8.559003, 4.082467, -0.799325,
-  8.603727, 4.123439, -0.799325,
-  8.990579, 3.246801, -0.812638,
-  // f 1118/940 1062/882 1053/872 1119/941
-  8.559003, 4.082467, -0.799325,
-  8.931224, 3.234322, -0.812638,
-  8.990579, 3.246801, -0.812638,
-  // f 1119/941 1053/872 1051/871 1129/953
-  8.931224, 3.234322, -0.812638,
-  8.990579, 3.246801, -0.812638,
-  8.995804, 1.672597, -0.853823,
-  // f 1119/941 1053/872 1051/871 1129/953
-  8.931224, 3.234322, -0.812638,
-  8.913877, 1.672597, -0.853823,
-  8.995804, 1.672597, -0.853823,
-  // f 1129/953 1051/871 1127/949 1130/954
-  8.913877, 1.672597, -0.853823,
-  8.995804, 1.672597, -0.853823,
-  8.995801, 1.665733, -2.644996,
-  // f 1129/953 1051/871 1127/949 1130/954
-  8.913877, 1.672597, -0.853823,
-  8.913875, 1.665733, -2.644996,
-  8.995801, 1.665733, -2.644996,
-  // f 1131/955 1130/954 1127/949 1067/887
-  8.913874, 1.379136, -3.241568,
-  8.913875, 1.665733, -2.644996,
-  8.995801, 1.665733, -2.644996,
-  // f 1131/955 1130/954 1127/949 1067/887
-  8.913874, 1.379136, -3.241568,
-  8.9958, 1.379136, -3.241568,
-  8.995801, 1.665733, -2.644996,
-  // f 1132/956 1133/957 1066/886 1032/847
-  8.913874, 0.140404, -3.648227,
-  8.913874, 0.892878, -3.543391,
-  8.9958, 0.892878, -3.543391,
-  // f 1132/956 1133/957 1066/886 1032/847
-  8.913874, 0.140404, -3.648227,
-  8.9958, 0.140404, -3.648227,
-  8.9958, 0.892878, -3.543391,
-  // f 1134/958 1135/959 1031/846 1047/868
-  8.913874, -1.087304, -3.281298,
-  8.913874, -0.612069, -3.545262,
-  8.9958, -0.612069, -3.545262,
-  // f 1134/958 1135/959 1031/846 1047/868
-  8.913874, -1.087304, -3.281298,
-  8.9958, -1.087304, -3.281298,
-  8.9958, -0.612069, -3.545262,
-  // f 1136/960 1046/867 1070/890 1137/961
-  8.913875, -1.414458, -2.718631,
-  8.995801, -1.414458, -2.718631,
-  8.995804, -1.424232, -0.827613,
-  // f 1136/960 1046/867 1070/890 1137/961
-  8.913875, -1.414458, -2.718631,
-  8.913877, -1.424232, -0.827613,
-  8.995804, -1.424232, -0.827613,
-  // f 1137/961 1070/890 1064/884 1120/942
-  8.913877, -1.424232, -0.827613,
-  8.995804, -1.424232, -0.827613,
-  8.991415, -2.822277, -0.783723,
-  // f 1137/961 1070/890 1064/884 1120/942
-  8.913877, -1.424232, -0.827613,
-  8.931224, -2.813958, -0.783723,
-  8.991415, -2.822277, -0.783723,
-  // f 1120/942 1064/884 1060/880 1121/943
-  8.931224, -2.813958, -0.783723,
-  8.991415, -2.822277, -0.783723,
-  8.745217, -3.682276, -0.770618,
-  // f 1120/942 1064/884 1060/880 1121/943
-  8.931224, -2.813958, -0.783723,
-  8.694222, -3.649415, -0.775818,
-  8.745217, -3.682276, -0.770618,
-  // f 1121/943 1060/880 1059/879 1122/944
-  8.694222, -3.649415, -0.775818,
-  8.745217, -3.682276, -0.770618,
-  7.830442, -4.450348, -0.814923,
-  // f 1121/943 1060/880 1059/879 1122/944
-  8.694222, -3.649415, -0.775818,
-  7.808915, -4.393777, -0.814923,
-  7.830442, -4.450348, -0.814923,
-  // f 1122/944 1059/879 1092/914 1123/945
-  7.808915, -4.393777, -0.814923,
-  7.830442, -4.450348, -0.814923,
-  3.913854, -4.776462, -1.635308,
-  // f 1122/944 1059/879 1092/914 1123/945
-  7.808915, -4.393777, -0.814923,
-  3.910719, -4.716147, -1.635308,
-  3.913854, -4.776462, -1.635308,
-  // f 1124/946 1123/945 1092/914 1138/962
-  1.71835, -4.787485, -1.824179,
-  3.910719, -4.716147, -1.635308,
-  3.913854, -4.776462, -1.635308,
-  // f 1124/946 1123/945 1092/914 1138/962
-  1.71835, -4.787485, -1.824179,
-  1.720858, -4.847799, -1.824179,
-  3.913854, -4.776462, -1.635308,
-  // f 1139/963 1091/913 1058/878 1140/964
-  3.910719, -4.558914, -1.418978,
-  3.914272, -4.776462, -1.418978,
-  7.834204, -4.448892, -0.605249,
-  // f 1139/963 1091/913 1058/878 1140/964
-  3.910719, -4.558914, -1.418978,
-  7.80787, -4.236752, -0.605249,
-  7.834204, -4.448892, -0.605249,
-  // f 1140/964 1058/878 1061/881 1141/965
-  7.80787, -4.236752, -0.605249,
-  7.834204, -4.448892, -0.605249,
-  8.745218, -3.682068, -0.604834,
-  // f 1140/964 1058/878 1061/881 1141/965
-  7.80787, -4.236752, -0.605249,
-  8.694222, -3.492182, -0.604834,
-  8.745218, -3.682068, -0.604834,
-  // f 1141/965 1061/881 1065/885 1142/966
-  8.694222, -3.492182, -0.604834,
-  8.745218, -3.682068, -0.604834,
-  8.991415, -2.822277, -0.604834,
-  // f 1141/965 1061/881 1065/885 1142/966
-  8.694222, -3.492182, -0.604834,
-  8.867899, -2.769242, -0.604834,
-  8.991415, -2.822277, -0.604834,
-  // f 1142/966 1065/885 1128/950 1102/967
-  8.867899, -2.769242, -0.604834,
-  8.991415, -2.822277, -0.604834,
-  8.991834, -1.093959, -0.604835,
-  // f 1142/966 1065/885 1128/950 1102/967
-  8.867899, -2.769242, -0.604834,
-  8.931224, -1.093959, -0.604835,
-  8.991834, -1.093959, -0.604835,
-  // f 1102/967 1128/950 1143/968 1099/969
-  8.931224, -1.093959, -0.604835,
-  8.991834, -1.093959, -0.604835,
-  8.991831, -1.09396, -2.56408,
-  // f 1102/967 1128/950 1143/968 1099/969
-  8.931224, -1.093959, -0.604835,
-  8.931221, -1.09396, -2.56408,
-  8.991831, -1.09396, -2.56408,
-  // f 1109/932 1099/922 1143/970 1144/971
-  8.931221, -0.869341, -3.012341,
-  8.931221, -1.09396, -2.56408,
-  8.991831, -1.09396, -2.56408,
-  // f 1109/932 1099/922 1143/970 1144/971
-  8.931221, -0.869341, -3.012341,
-  8.99183, -0.869341, -3.012341,
-  8.991831, -1.09396, -2.56408,
-  // f 1103/926 1110/933 1145/972 1146/973
-  8.93122, 0.130421, -3.343909,
-  8.93122, -0.531788, -3.239903,
-  8.99183, -0.531788, -3.239904,
-  // f 1103/926 1110/933 1145/972 1146/973
-  8.93122, 0.130421, -3.343909,
-  8.99183, 0.130421, -3.343909,
-  8.99183, -0.531788, -3.239904,
-  // f 1095/918 1104/927 1147/974 1148/975
-  8.931221, 1.135383, -2.979476,
-  8.93122, 0.792839, -3.239904,
-  8.99183, 0.792839, -3.239904,
-  // f 1095/918 1104/927 1147/974 1148/975
-  8.931221, 1.135383, -2.979476,
-  8.99183, 1.135383, -2.979476,
-  8.99183, 0.792839, -3.239904,
-  // f 1096/976 1149/977 1050/978 1107/979
-  8.931221, 1.35501, -2.56408,
-  8.991831, 1.35501, -2.56408,
-  8.991834, 1.355011, -0.604835,
-  // f 1096/976 1149/977 1050/978 1107/979
-  8.931221, 1.35501, -2.56408,
-  8.879184, 1.355011, -0.604835,
-  8.991834, 1.355011, -0.604835,
-  // f 1107/979 1050/980 1052/873 1150/981
-  8.879184, 1.355011, -0.604835,
-  8.991834, 1.355011, -0.604835,
-  8.990579, 3.246801, -0.604835,
-  // f 1107/979 1050/980 1052/873 1150/981
-  8.879184, 1.355011, -0.604835,
-  8.887126, 3.119517, -0.604835,
-  8.990579, 3.246801, -0.604835,
-  // f 1150/981 1052/873 1063/883 1151/982
-  8.887126, 3.119517, -0.604835,
-  8.990579, 3.246801, -0.604835,
-  8.603727, 4.123439, -0.604835,
-  // f 1150/981 1052/873 1063/883 1151/982
-  8.887126, 3.119517, -0.604835,
-  8.515113, 3.967661, -0.604835,
-  8.603727, 4.123439, -0.604835,
-  // f 1151/982 1063/883 1057/877 1152/983
-  8.515113, 3.967661, -0.604835,
-  8.603727, 4.123439, -0.604835,
-  7.560419, 4.690601, -0.604834,
-  // f 1151/982 1063/883 1057/877 1152/983
-  8.515113, 3.967661, -0.604835,
-  7.539937, 4.518394, -0.604834,
-  7.560419, 4.690601, -0.604834,
-  // f 1152/983 1057/877 1056/876 1153/984
-  7.539937, 4.518394, -0.604834,
-  7.560419, 4.690601, -0.604834,
-  3.904031, 4.875288, -1.738691,
-  // f 1152/983 1057/877 1056/876 1153/984
-  7.539937, 4.518394, -0.604834,
-  3.903195, 4.678539, -1.73973,
-  3.904031, 4.875288, -1.738691,
-  // f 1153/984 1056/876 1090/912 1154/985
-  3.903195, 4.678539, -1.73973,
-  3.904031, 4.875288, -1.738691,
-  2.062148, 4.87508, -2.126627,
-  // f 1153/984 1056/876 1090/912 1154/985
-  3.903195, 4.678539, -1.73973,
-  2.066119, 4.67937, -2.129539,
-  2.062148, 4.87508, -2.126627,
-  // f 1154/985 1090/912 1093/915 1155/986
-  2.066119, 4.67937, -2.129539,
-  2.062148, 4.87508, -2.126627,
-  1.944483, 4.875079, -2.678477,
-  // f 1154/985 1090/912 1093/915 1155/986
-  2.066119, 4.67937, -2.129539,
-  1.945319, 4.679578, -2.683053,
-  1.944483, 4.875079, -2.678477,
-  // f 931/719 1155/986 1093/915 867/648
-  -0.004197, 4.680202, -2.724653,
-  1.945319, 4.679578, -2.683053,
-  1.944483, 4.875079, -2.678477,
-  // f 931/719 1155/986 1093/915 867/648
-  -0.004197, 4.680202, -2.724653,
-  -0.004197, 4.875288, -2.819505,
-  1.944483, 4.875079, -2.678477,
-  // f 1144/987 1048/869 1030/845 1145/988
-  8.99183, -0.869341, -3.012341,
-  8.994129, -0.991425, -3.162941,
-  8.994129, -0.576712, -3.411096,
-  // f 1144/987 1048/869 1030/845 1145/988
-  8.99183, -0.869341, -3.012341,
-  8.99183, -0.531788, -3.239904,
-  8.994129, -0.576712, -3.411096,
-  // f 1149/977 1148/989 1068/888 1126/948
-  8.991831, 1.35501, -2.56408,
-  8.99183, 1.135383, -2.979476,
-  8.994129, 1.271818, -3.126331,
-  // f 1149/977 1148/989 1068/888 1126/948
-  8.991831, 1.35501, -2.56408,
-  8.99413, 1.528882, -2.609427,
-  8.994129, 1.271818, -3.126331,
-  // f 1104/927 1095/918 1098/921 1105/928
-  8.93122, 0.792839, -3.239904,
-  8.931221, 1.135383, -2.979476,
-  7.912992, 1.135383, -2.979475,
-  // f 1104/927 1095/918 1098/921 1105/928
-  8.93122, 0.792839, -3.239904,
-  7.912992, 0.792839, -3.239902,
-  7.912992, 1.135383, -2.979475,
-  // f 1099/922 1109/932 1112/935 1100/923
-  8.931221, -1.09396, -2.56408,
-  8.931221, -0.869341, -3.012341,
-  7.912992, -0.869341, -3.01234,
-  // f 1099/922 1109/932 1112/935 1100/923
-  8.931221, -1.09396, -2.56408,
-  7.912993, -1.09396, -2.564079,
-  7.912992, -0.869341, -3.01234,
-  // f 1133/957 1131/955 1067/887 1066/886
-  8.913874, 0.892878, -3.543391,
-  8.913874, 1.379136, -3.241568,
-  8.9958, 1.379136, -3.241568,
-  // f 1133/957 1131/955 1067/887 1066/886
-  8.913874, 0.892878, -3.543391,
-  8.9958, 0.892878, -3.543391,
-  8.9958, 1.379136, -3.241568,
-  // f 1136/960 1134/958 1047/868 1046/867
-  8.913875, -1.414458, -2.718631,
-  8.913874, -1.087304, -3.281298,
-  8.9958, -1.087304, -3.281298,
-  // f 1136/960 1134/958 1047/868 1046/867
-  8.913875, -1.414458, -2.718631,
-  8.995801, -1.414458, -2.718631,
-  8.9958, -1.087304, -3.281298,
-  // f 1110/933 1109/932 1144/971 1145/972
-  8.93122, -0.531788, -3.239903,
-  8.931221, -0.869341, -3.012341,
-  8.99183, -0.869341, -3.012341,
-  // f 1110/933 1109/932 1144/971 1145/972
-  8.93122, -0.531788, -3.239903,
-  8.99183, -0.531788, -3.239904,
-  8.99183, -0.869341, -3.012341,
-  // f 1096/919 1095/918 1148/975 1149/990
-  8.931221, 1.35501, -2.56408,
-  8.931221, 1.135383, -2.979476,
-  8.99183, 1.135383, -2.979476,
-  // f 1096/919 1095/918 1148/975 1149/990
-  8.931221, 1.35501, -2.56408,
-  8.991831, 1.35501, -2.56408,
-  8.99183, 1.135383, -2.979476,
-  // f 1129/953 1130/954 1037/854 1119/941
-  8.913877, 1.672597, -0.853823,
-  8.913875, 1.665733, -2.644996,
-  8.931221, 3.234322, -2.871727,
-  // f 1129/953 1130/954 1037/854 1119/941
-  8.913877, 1.672597, -0.853823,
-  8.931224, 3.234322, -0.812638,
-  8.931221, 3.234322, -2.871727,
-  // f 1130/954 1131/955 1037/854
-  8.913875, 1.665733, -2.644996,
-  8.913874, 1.379136, -3.241568,
-  8.931221, 3.234322, -2.871727,
-  // f 1135/959 1024/991 1023/992 1132/956
-  8.913874, -0.612069, -3.545262,
-  8.931216, -0.797796, -6.045957,
-  8.931216, 1.218367, -6.045957,
-  // f 1135/959 1024/991 1023/992 1132/956
-  8.913874, -0.612069, -3.545262,
-  8.913874, 0.140404, -3.648227,
-  8.931216, 1.218367, -6.045957,
-  // f 1133/957 1132/956 1023/992
-  8.913874, 0.892878, -3.543391,
-  8.913874, 0.140404, -3.648227,
-  8.931216, 1.218367, -6.045957,
-  // f 1038/857 1029/858 1024/991 1134/958
-  8.931221, -2.813958, -2.871726,
-  8.931216, -2.813959, -6.045956,
-  8.931216, -0.797796, -6.045957,
-  // f 1038/857 1029/858 1024/991 1134/958
-  8.931221, -2.813958, -2.871726,
-  8.913874, -1.087304, -3.281298,
-  8.931216, -0.797796, -6.045957,
-  // f 1135/959 1134/958 1024/991
-  8.913874, -0.612069, -3.545262,
-  8.913874, -1.087304, -3.281298,
-  8.931216, -0.797796, -6.045957,
-  // f 1038/857 1136/960 1137/961 1120/942
-  8.931221, -2.813958, -2.871726,
-  8.913875, -1.414458, -2.718631,
-  8.913877, -1.424232, -0.827613,
-  // f 1038/857 1136/960 1137/961 1120/942
-  8.931221, -2.813958, -2.871726,
-  8.931224, -2.813958, -0.783723,
-  8.913877, -1.424232, -0.827613,
-  // f 1131/955 1133/957 1023/992 1027/855
-  8.913874, 1.379136, -3.241568,
-  8.913874, 0.892878, -3.543391,
-  8.931216, 1.218367, -6.045957,
-  // f 1131/955 1133/957 1023/992 1027/855
-  8.913874, 1.379136, -3.241568,
-  8.931216, 3.234321, -6.045957,
-  8.931216, 1.218367, -6.045957,
-  // f 1131/955 1027/855 1037/854
-  8.913874, 1.379136, -3.241568,
-  8.931216, 3.234321, -6.045957,
-  8.931221, 3.234322, -2.871727,
-  // f 1134/958 1136/960 1038/857
-  8.913874, -1.087304, -3.281298,
-  8.913875, -1.414458, -2.718631,
-  8.931221, -2.813958, -2.871726,
-  // f 1145/988 1030/845 1033/848 1146/993
-  8.99183, -0.531788, -3.239904,
-  8.994129, -0.576712, -3.411096,
-  8.994128, 0.136037, -3.514269,
-  // f 1145/988 1030/845 1033/848 1146/993
-  8.99183, -0.531788, -3.239904,
-  8.99183, 0.130421, -3.343909,
-  8.994128, 0.136037, -3.514269,
-  // f 1049/870 1048/869 1144/987 1143/968
-  8.99413, -1.273447, -2.650612,
-  8.994129, -0.991425, -3.162941,
-  8.99183, -0.869341, -3.012341,
-  // f 1049/870 1048/869 1144/987 1143/968
-  8.99413, -1.273447, -2.650612,
-  8.991831, -1.09396, -2.56408,
-  8.99183, -0.869341, -3.012341,
-  // f 1069/889 1068/888 1148/989 1147/994
-  8.994129, 0.848786, -3.409848,
-  8.994129, 1.271818, -3.126331,
-  8.99183, 1.135383, -2.979476,
-  // f 1069/889 1068/888 1148/989 1147/994
-  8.994129, 0.848786, -3.409848,
-  8.99183, 0.792839, -3.239904,
-  8.99183, 1.135383, -2.979476,
-  // f 1071/891 1049/870 1143/968 1128/950
-  8.994132, -1.278854, -0.824077,
-  8.99413, -1.273447, -2.650612,
-  8.991831, -1.09396, -2.56408,
-  // f 1071/891 1049/870 1143/968 1128/950
-  8.994132, -1.278854, -0.824077,
-  8.991834, -1.093959, -0.604835,
-  8.991831, -1.09396, -2.56408,
-  // f 1149/977 1126/948 1125/947 1050/978
-  8.991831, 1.35501, -2.56408,
-  8.99413, 1.528882, -2.609427,
-  8.994132, 1.532834, -0.848831,
-  // f 1149/977 1126/948 1125/947 1050/978
-  8.991831, 1.35501, -2.56408,
-  8.991834, 1.355011, -0.604835,
-  8.994132, 1.532834, -0.848831,
-  // f 1031/846 1030/845 1048/869 1047/868
-  8.9958, -0.612069, -3.545262,
-  8.994129, -0.576712, -3.411096,
-  8.994129, -0.991425, -3.162941,
-  // f 1031/846 1030/845 1048/869 1047/868
-  8.9958, -0.612069, -3.545262,
-  8.9958, -1.087304, -3.281298,
-  8.994129, -0.991425, -3.162941,
-  // f 1127/949 1126/948 1068/888 1067/887
-  8.995801, 1.665733, -2.644996,
-  8.99413, 1.528882, -2.609427,
-  8.994129, 1.271818, -3.126331,
-  // f 1127/949 1126/948 1068/888 1067/887
-  8.995801, 1.665733, -2.644996,
-  8.9958, 1.379136, -3.241568,
-  8.994129, 1.271818, -3.126331,
-  // f 1051/871 1050/978 1125/947
-  8.995804, 1.672597, -0.853823,
-  8.991834, 1.355011, -0.604835,
-  8.994132, 1.532834, -0.848831,
-  // f 1070/890 1128/950 1065/885 1064/884
-  8.995804, -1.424232, -0.827613,
-  8.991834, -1.093959, -0.604835,
-  8.991415, -2.822277, -0.604834,
-  // f 1070/890 1128/950 1065/885 1064/884
-  8.995804, -1.424232, -0.827613,
-  8.991415, -2.822277, -0.783723,
-  8.991415, -2.822277, -0.604834,
-  // f 1069/889 1033/848 1032/847 1066/886
-  8.994129, 0.848786, -3.409848,
-  8.994128, 0.136037, -3.514269,
-  8.9958, 0.140404, -3.648227,
-  // f 1069/889 1033/848 1032/847 1066/886
-  8.994129, 0.848786, -3.409848,
-  8.9958, 0.892878, -3.543391,
-  8.9958, 0.140404, -3.648227,
-  // f 1110/933 1103/926 1106/929 1111/934
-  8.93122, -0.531788, -3.239903,
-  8.93122, 0.130421, -3.343909,
-  7.912992, 0.130421, -3.343908,
-  // f 1110/933 1103/926 1106/929 1111/934
-  8.93122, -0.531788, -3.239903,
-  7.912992, -0.531788, -3.239902,
-  7.912992, 0.130421, -3.343908,
-  // f 1135/959 1132/956 1032/847 1031/846
-  8.913874, -0.612069, -3.545262,
-  8.913874, 0.140404, -3.648227,
-  8.9958, 0.140404, -3.648227,
-  // f 1135/959 1132/956 1032/847 1031/846
-  8.913874, -0.612069, -3.545262,
-  8.9958, -0.612069, -3.545262,
-  8.9958, 0.140404, -3.648227,
-  // f 1104/927 1103/926 1146/973 1147/974
-  8.93122, 0.792839, -3.239904,
-  8.93122, 0.130421, -3.343909,
-  8.99183, 0.130421, -3.343909,
-  // f 1104/927 1103/926 1146/973 1147/974
-  8.93122, 0.792839, -3.239904,
-  8.99183, 0.792839, -3.239904,
-  8.99183, 0.130421, -3.343909,
-  // f 1147/994 1146/993 1033/848 1069/889
-  8.99183, 0.792839, -3.239904,
-  8.99183, 0.130421, -3.343909,
-  8.994128, 0.136037, -3.514269,
-  // f 1147/994 1146/993 1033/848 1069/889
-  8.99183, 0.792839, -3.239904,
-  8.994129, 0.848786, -3.409848,
-  8.994128, 0.136037, -3.514269,
-  // f 1077/897 1156/995 1157/996 1078/898
-  3.915728, -3.771293, -6.959528,
-  1.720642, -3.782108, -6.959526,
-  1.721478, -3.425213, -6.959526,
-  // f 1077/897 1156/995 1157/996 1078/898
-  3.915728, -3.771293, -6.959528,
-  3.917818, -3.411695, -6.959528,
-  1.721478, -3.425213, -6.959526,
-  // f 1158/997 1084/904 1021/836 1080/900
-  1.719388, 4.272559, -6.930614,
-  1.715836, 4.699127, -6.502738,
-  3.90507, 4.680201, -6.502741,
-  // f 1158/997 1084/904 1021/836 1080/900
-  1.719388, 4.272559, -6.930614,
-  3.912802, 4.2632, -6.930408,
-  3.90507, 4.680201, -6.502741,
-  // f 1041/905 1087/998 1082/902 1018/833
-  3.910504, -4.716148, -6.036797,
-  1.718344, -4.787485, -6.058635,
-  1.717508, -4.435583, -6.502736,
-  // f 1041/905 1087/998 1082/902 1018/833
-  3.910504, -4.716148, -6.036797,
-  3.908832, -4.393363, -6.502739,
-  1.717508, -4.435583, -6.502736,
-  // f 1022/906 1083/999 1113/936 1085/907
-  3.903189, 4.872167, -6.04595,
-  1.715, 4.899829, -6.045948,
-  1.928806, 4.911892, -3.933192,
-  // f 1022/906 1083/999 1113/936 1085/907
-  3.903189, 4.872167, -6.04595,
-  3.903192, 4.89983, -3.767203,
-  1.928806, 4.911892, -3.933192,
-  // f 1078/898 1157/996 1075/895 1000/815
-  3.917818, -3.411695, -6.959528,
-  1.721478, -3.425213, -6.959526,
-  1.721478, -1.001409, -6.959526,
-  // f 1078/898 1157/996 1075/895 1000/815
-  3.917818, -3.411695, -6.959528,
-  3.917818, -0.996418, -6.959529,
-  1.721478, -1.001409, -6.959526,
-  // f 1159/1000 1138/962 1092/914 1091/913
-  1.721067, -4.847799, -1.618873,
-  1.720858, -4.847799, -1.824179,
-  3.913854, -4.776462, -1.635308,
-  // f 1159/1000 1138/962 1092/914 1091/913
-  1.721067, -4.847799, -1.618873,
-  3.914272, -4.776462, -1.418978,
-  3.913854, -4.776462, -1.635308,
-  // f 936/734 1072/892 1073/893 937/735
-  -0.004203, 4.24469, -6.945172,
-  1.719806, 4.202886, -6.959527,
-  1.721478, 3.846199, -6.959527,
-  // f 936/734 1072/892 1073/893 937/735
-  -0.004203, 4.24469, -6.945172,
-  -0.004203, 3.855351, -6.959525,
-  1.721478, 3.846199, -6.959527,
-  // f 938/736 1074/894 1075/895 939/737
-  -0.004203, 1.425099, -6.959524,
-  1.721478, 1.422395, -6.959527,
-  1.721478, -1.001409, -6.959526,
-  // f 938/736 1074/894 1075/895 939/737
-  -0.004203, 1.425099, -6.959524,
-  -0.004203, -1.005153, -6.959524,
-  1.721478, -1.001409, -6.959526,
-  // f 940/738 1081/901 1082/902 941/739
-  -0.004203, -3.864052, -6.935812,
-  1.720224, -3.855525, -6.935189,
-  1.717508, -4.435583, -6.502736,
-  // f 940/738 1081/901 1082/902 941/739
-  -0.004203, -3.864052, -6.935812,
-  -0.004202, -4.46678, -6.502734,
-  1.717508, -4.435583, -6.502736,
-  // f 1160/1001 1083/903 1084/904 1161/1002
-  1.201079, 4.910644, -6.016826,
-  1.715, 4.899829, -6.045948,
-  1.715836, 4.699127, -6.502738,
-  // f 1160/1001 1083/903 1084/904 1161/1002
-  1.201079, 4.910644, -6.016826,
-  1.201496, 4.706615, -6.473824,
-  1.715836, 4.699127, -6.502738,
-  // f 944/1003 1087/909 1086/908 945/1004
-  -0.004202, -4.840312, -6.085466,
-  1.718344, -4.787485, -6.058635,
-  1.718347, -4.787485, -3.622007,
-  // f 944/1003 1087/909 1086/908 945/1004
-  -0.004202, -4.840312, -6.085466,
-  -0.004198, -4.840312, -3.696264,
-  1.718347, -4.787485, -3.622007,
-  // f 937/735 1073/893 1074/894 938/736
-  -0.004203, 3.855351, -6.959525,
-  1.721478, 3.846199, -6.959527,
-  1.721478, 1.422395, -6.959527,
-  // f 937/735 1073/893 1074/894 938/736
-  -0.004203, 3.855351, -6.959525,
-  -0.004203, 1.425099, -6.959524,
-  1.721478, 1.422395, -6.959527,
-  // f 945/1004 1086/908 1162/1005 946/1006
-  -0.004198, -4.840312, -3.696264,
-  1.718347, -4.787485, -3.622007,
-  1.202755, -4.815562, -3.015866,
-  // f 945/1004 1086/908 1162/1005 946/1006
-  -0.004198, -4.840312, -3.696264,
-  -0.004198, -4.871509, -3.1752,
-  1.202755, -4.815562, -3.015866,
-  // f 1162/1005 1124/946 1138/962 1163/1007
-  1.202755, -4.815562, -3.015866,
-  1.71835, -4.787485, -1.824179,
-  1.720858, -4.847799, -1.824179,
-  // f 1162/1005 1124/946 1138/962 1163/1007
-  1.202755, -4.815562, -3.015866,
-  1.205054, -4.875876, -3.015866,
-  1.720858, -4.847799, -1.824179,
-  // f 1139/963 1164/1008 1159/1000 1091/913
-  3.910719, -4.558914, -1.418978,
-  1.71835, -4.630251, -1.618873,
-  1.721067, -4.847799, -1.618873,
-  // f 1139/963 1164/1008 1159/1000 1091/913
-  3.910719, -4.558914, -1.418978,
-  3.914272, -4.776462, -1.418978,
-  1.721067, -4.847799, -1.618873,
-  // f 867/648 1114/937 1113/936 950/748
-  -0.004197, 4.875288, -2.819505,
-  2.05525, 4.874872, -2.885239,
-  1.928806, 4.911892, -3.933192,
-  // f 867/648 1114/937 1113/936 950/748
-  -0.004197, 4.875288, -2.819505,
-  -0.004199, 4.921043, -4.057163,
-  1.928806, 4.911892, -3.933192,
-  // f 1165/1009 1163/1007 1138/962 1159/1000
-  1.205054, -4.875876, -2.814929,
-  1.205054, -4.875876, -3.015866,
-  1.720858, -4.847799, -1.824179,
-  // f 1165/1009 1163/1007 1138/962 1159/1000
-  1.205054, -4.875876, -2.814929,
-  1.721067, -4.847799, -1.618873,
-  1.720858, -4.847799, -1.824179,
-  // f 1164/1008 1166/1010 1165/1009 1159/1000
-  1.71835, -4.630251, -1.618873,
-  1.202755, -4.658329, -2.814929,
-  1.205054, -4.875876, -2.814929,
-  // f 1164/1008 1166/1010 1165/1009 1159/1000
-  1.71835, -4.630251, -1.618873,
-  1.721067, -4.847799, -1.618873,
-  1.205054, -4.875876, -2.814929,
-  // f 953/751 1160/1001 1161/1002 954/752
-  -0.004201, 4.920627, -6.043658,
-  1.201079, 4.910644, -6.016826,
-  1.201496, 4.706615, -6.473824,
-  // f 953/751 1160/1001 1161/1002 954/752
-  -0.004201, 4.920627, -6.043658,
-  -0.004202, 4.713479, -6.500447,
-  1.201496, 4.706615, -6.473824,
-  // f 946/1006 1162/1005 1163/1007 955/1011
-  -0.004198, -4.871509, -3.1752,
-  1.202755, -4.815562, -3.015866,
-  1.205054, -4.875876, -3.015866,
-  // f 946/1006 1162/1005 1163/1007 955/1011
-  -0.004198, -4.871509, -3.1752,
-  -0.004198, -4.901874, -3.273797,
-  1.205054, -4.875876, -3.015866,
-  // f 1162/1005 1086/908 1124/946
-  1.202755, -4.815562, -3.015866,
-  1.718347, -4.787485, -3.622007,
-  1.71835, -4.787485, -1.824179,
-  // f 1006/821 1079/899 1045/866
-  8.098367, -3.259869, -6.935614,
-  8.028353, -3.24531, -6.959534,
-  8.069316, -3.202882, -6.959534,
-  // f 1010/825 1043/864 997/812
-  8.096276, 3.681688, -6.934159,
-  8.069316, 3.623245, -6.959535,
-  8.028353, 3.665673, -6.959535,
-  // f 996/811 999/814 1080/900 1016/831
-  7.237302, 4.013208, -6.959534,
-  3.913847, 4.193735, -6.95953,
-  3.912802, 4.2632, -6.930408,
-  // f 996/811 999/814 1080/900 1016/831
-  7.237302, 4.013208, -6.959534,
-  7.268443, 4.077266, -6.933325,
-  3.912802, 4.2632, -6.930408,
-  // f 1044/865 993/808 1002/817 1014/829
-  8.248217, -2.590172, -6.959535,
-  8.25992, -0.75412, -6.959535,
-  8.321157, -0.728954, -6.934159,
-  // f 1044/865 993/808 1002/817 1014/829
-  8.248217, -2.590172, -6.959535,
-  8.320111, -2.607226, -6.934782,
-  8.321157, -0.728954, -6.934159,
-  // f 1076/896 1079/899 1006/821 1009/824
-  7.237302, -3.592846, -6.959533,
-  8.028353, -3.24531, -6.959534,
-  8.098367, -3.259869, -6.935614,
-  // f 1076/896 1079/899 1006/821 1009/824
-  7.237302, -3.592846, -6.959533,
-  7.271996, -3.657736, -6.937484,
-  8.098367, -3.259869, -6.935614,
-  // f 1042/863 1043/864 1010/825 1013/828
-  8.248217, 3.010326, -6.959535,
-  8.069316, 3.623245, -6.959535,
-  8.096276, 3.681688, -6.934159,
-  // f 1042/863 1043/864 1010/825 1013/828
-  8.248217, 3.010326, -6.959535,
-  8.320111, 3.027589, -6.934783,
-  8.096276, 3.681688, -6.934159,
-  // f 1045/866 1044/865 1014/829 1006/821
-  8.069316, -3.202882, -6.959534,
-  8.248217, -2.590172, -6.959535,
-  8.320111, -2.607226, -6.934782,
-  // f 1045/866 1044/865 1014/829 1006/821
-  8.069316, -3.202882, -6.959534,
-  8.098367, -3.259869, -6.935614,
-  8.320111, -2.607226, -6.934782,
-  // f 997/812 996/811 1016/831 1010/825
-  8.028353, 3.665673, -6.959535,
-  7.237302, 4.013208, -6.959534,
-  7.268443, 4.077266, -6.933325,
-  // f 997/812 996/811 1016/831 1010/825
-  8.028353, 3.665673, -6.959535,
-  8.096276, 3.681688, -6.934159,
-  7.268443, 4.077266, -6.933325,
-  // f 993/808 992/807 1003/818 1002/817
-  8.25992, -0.75412, -6.959535,
-  8.25992, 1.174483, -6.959535,
-  8.321157, 1.149525, -6.934159,
-  // f 993/808 992/807 1003/818 1002/817
-  8.25992, -0.75412, -6.959535,
-  8.321157, -0.728954, -6.934159,
-  8.321157, 1.149525, -6.934159,
-  // f 992/807 1042/863 1013/828 1003/818
-  8.25992, 1.174483, -6.959535,
-  8.248217, 3.010326, -6.959535,
-  8.320111, 3.027589, -6.934783,
-  // f 992/807 1042/863 1013/828 1003/818
-  8.25992, 1.174483, -6.959535,
-  8.321157, 1.149525, -6.934159,
-  8.320111, 3.027589, -6.934783,
-  // f 999/814 1072/892 1158/997 1080/900
-  3.913847, 4.193735, -6.95953,
-  1.719806, 4.202886, -6.959527,
-  1.719388, 4.272559, -6.930614,
-  // f 999/814 1072/892 1158/997 1080/900
-  3.913847, 4.193735, -6.95953,
-  3.912802, 4.2632, -6.930408,
-  1.719388, 4.272559, -6.930614,
-  // f 1077/897 1076/896 1009/824 1019/834
-  3.915728, -3.771293, -6.959528,
-  7.237302, -3.592846, -6.959533,
-  7.271996, -3.657736, -6.937484,
-  // f 1077/897 1076/896 1009/824 1019/834
-  3.915728, -3.771293, -6.959528,
-  3.915101, -3.844294, -6.934361,
-  7.271996, -3.657736, -6.937484,
-  // f 1156/995 1077/897 1019/834 1081/901
-  1.720642, -3.782108, -6.959526,
-  3.915728, -3.771293, -6.959528,
-  3.915101, -3.844294, -6.934361,
-  // f 1156/995 1077/897 1019/834 1081/901
-  1.720642, -3.782108, -6.959526,
-  1.720224, -3.855525, -6.935189,
-  3.915101, -3.844294, -6.934361,
-  // f 1072/892 936/734 1158/997
-  1.719806, 4.202886, -6.959527,
-  -0.004203, 4.24469, -6.945172,
-  1.719388, 4.272559, -6.930614,
-  // f 1150/1012 1167/1013 1108/931 1107/930
-  8.887126, 3.119517, -0.604835,
-  7.911951, 3.119517, -0.604834,
-  7.909442, 1.355011, -0.604834,
-  // f 1150/1012 1167/1013 1108/931 1107/930
-  8.887126, 3.119517, -0.604835,
-  8.879184, 1.355011, -0.604835,
-  7.909442, 1.355011, -0.604834,
-  // f 1151/1014 1168/1015 1167/1013 1150/1012
-  8.515113, 3.967661, -0.604835,
-  7.539102, 3.973069, -0.604834,
-  7.911951, 3.119517, -0.604834,
-  // f 1151/1014 1168/1015 1167/1013 1150/1012
-  8.515113, 3.967661, -0.604835,
-  8.887126, 3.119517, -0.604835,
-  7.911951, 3.119517, -0.604834,
-  // f 1151/1014 1152/1016 1168/1015
-  8.515113, 3.967661, -0.604835,
-  7.539937, 4.518394, -0.604834,
-  7.539102, 3.973069, -0.604834,
-  // f 1153/1017 1169/1018 1168/1015 1152/1016
-  3.903195, 4.678539, -1.73973,
-  3.903195, 4.138829, -1.73973,
-  7.539102, 3.973069, -0.604834,
-  // f 1153/1017 1169/1018 1168/1015 1152/1016
-  3.903195, 4.678539, -1.73973,
-  7.539937, 4.518394, -0.604834,
-  7.539102, 3.973069, -0.604834,
-  // f 1154/1019 1170/1020 1169/1018 1153/1017
-  2.066119, 4.67937, -2.129539,
-  2.066119, 4.13966, -2.129539,
-  3.903195, 4.138829, -1.73973,
-  // f 1154/1019 1170/1020 1169/1018 1153/1017
-  2.066119, 4.67937, -2.129539,
-  3.903195, 4.678539, -1.73973,
-  3.903195, 4.138829, -1.73973,
-  // f 1155/1021 1171/1022 1170/1020 1154/1019
-  1.945319, 4.679578, -2.683053,
-  1.945319, 4.140077, -2.683053,
-  2.066119, 4.13966, -2.129539,
-  // f 1155/1021 1171/1022 1170/1020 1154/1019
-  1.945319, 4.679578, -2.683053,
-  2.066119, 4.67937, -2.129539,
-  2.066119, 4.13966, -2.129539,
-  // f 1102/925 1101/924 1172/1023 1142/1024
-  8.931224, -1.093959, -0.604835,
-  7.916758, -1.093959, -0.604833,
-  7.854895, -2.769242, -0.604833,
-  // f 1102/925 1101/924 1172/1023 1142/1024
-  8.931224, -1.093959, -0.604835,
-  8.867899, -2.769242, -0.604834,
-  7.854895, -2.769242, -0.604833,
-  // f 1141/1025 1173/1026 1140/1027
-  8.694222, -3.492182, -0.604834,
-  7.813931, -3.49863, -0.605041,
-  7.80787, -4.236752, -0.605249,
-  // f 1142/1024 1172/1023 1173/1026 1141/1025
-  8.867899, -2.769242, -0.604834,
-  7.854895, -2.769242, -0.604833,
-  7.813931, -3.49863, -0.605041,
-  // f 1142/1024 1172/1023 1173/1026 1141/1025
-  8.867899, -2.769242, -0.604834,
-  8.694222, -3.492182, -0.604834,
-  7.813931, -3.49863, -0.605041,
-  // f 1166/1028 1174/1029 964/772 963/771
-  1.202755, -4.658329, -2.814929,
-  1.202755, -3.520676, -2.814929,
-  -0.004197, -3.521508, -3.076396,
-  // f 1166/1028 1174/1029 964/772 963/771
-  1.202755, -4.658329, -2.814929,
-  -0.004197, -4.684118, -3.076395,
-  -0.004197, -3.521508, -3.076396,
-  // f 1140/1027 1173/1026 1175/1030 1139/1031
-  7.80787, -4.236752, -0.605249,
-  7.813931, -3.49863, -0.605041,
-  3.910719, -3.516932, -1.418978,
-  // f 1140/1027 1173/1026 1175/1030 1139/1031
-  7.80787, -4.236752, -0.605249,
-  3.910719, -4.558914, -1.418978,
-  3.910719, -3.516932, -1.418978,
-  // f 1139/1031 1175/1030 1176/1032 1164/1033
-  3.910719, -4.558914, -1.418978,
-  3.910719, -3.516932, -1.418978,
-  1.71835, -3.519636, -1.618873,
-  // f 1139/1031 1175/1030 1176/1032 1164/1033
-  3.910719, -4.558914, -1.418978,
-  1.71835, -4.630251, -1.618873,
-  1.71835, -3.519636, -1.618873,
-  // f 1164/1033 1176/1032 1174/1029 1166/1028
-  1.71835, -4.630251, -1.618873,
-  1.71835, -3.519636, -1.618873,
-  1.202755, -3.520676, -2.814929,
-  // f 1164/1033 1176/1032 1174/1029 1166/1028
-  1.71835, -4.630251, -1.618873,
-  1.202755, -4.658329, -2.814929,
-  1.202755, -3.520676, -2.814929,
-  // f 1098/921 1177/1034 1178/1035 1105/928
-  7.912992, 1.135383, -2.979475,
-  6.293059, 0.760602, -6.10586,
-  6.293059, 0.556573, -6.115428,
-  // f 1098/921 1177/1034 1178/1035 1105/928
-  7.912992, 1.135383, -2.979475,
-  7.912992, 0.792839, -3.239902,
-  6.293059, 0.556573, -6.115428,
-  // f 1100/923 1179/1036 1180/1036 1101/924
-  7.912993, -1.09396, -2.564079,
-  6.293059, -0.567145, -6.090884,
-  6.296822, -0.567145, -6.02016,
-  // f 1100/923 1179/1036 1180/1036 1101/924
-  7.912993, -1.09396, -2.564079,
-  7.916758, -1.093959, -0.604833,
-  6.296822, -0.567145, -6.02016,
-  // f 1106/929 1181/1037 1182/1038 1111/934
-  7.912992, 0.130421, -3.343908,
-  6.293059, 0.162242, -6.119173,
-  6.293059, -0.232297, -6.115428,
-  // f 1106/929 1181/1037 1182/1038 1111/934
-  7.912992, 0.130421, -3.343908,
-  7.912992, -0.531788, -3.239902,
-  6.293059, -0.232297, -6.115428,
-  // f 1108/931 1183/1039 1184/1040 1097/920
-  7.909442, 1.355011, -0.604834,
-  6.289298, 0.891421, -6.020161,
-  6.293059, 0.891421, -6.090884,
-  // f 1108/931 1183/1039 1184/1040 1097/920
-  7.909442, 1.355011, -0.604834,
-  7.912993, 1.35501, -2.564079,
-  6.293059, 0.891421, -6.090884,
-  // f 1112/935 1185/1041 1179/1036 1100/923
-  7.912992, -0.869341, -3.01234,
-  6.293059, -0.433206, -6.107109,
-  6.293059, -0.567145, -6.090884,
-  // f 1112/935 1185/1041 1179/1036 1100/923
-  7.912992, -0.869341, -3.01234,
-  7.912993, -1.09396, -2.564079,
-  6.293059, -0.567145, -6.090884,
-  // f 1097/920 1184/1040 1177/1034 1098/921
-  7.912993, 1.35501, -2.564079,
-  6.293059, 0.891421, -6.090884,
-  6.293059, 0.760602, -6.10586,
-  // f 1097/920 1184/1040 1177/1034 1098/921
-  7.912993, 1.35501, -2.564079,
-  7.912992, 1.135383, -2.979475,
-  6.293059, 0.760602, -6.10586,
-  // f 1111/934 1182/1038 1185/1041 1112/935
-  7.912992, -0.531788, -3.239902,
-  6.293059, -0.232297, -6.115428,
-  6.293059, -0.433206, -6.107109,
-  // f 1111/934 1182/1038 1185/1041 1112/935
-  7.912992, -0.531788, -3.239902,
-  7.912992, -0.869341, -3.01234,
-  6.293059, -0.433206, -6.107109,
-  // f 1105/928 1178/1035 1181/1037 1106/929
-  7.912992, 0.792839, -3.239902,
-  6.293059, 0.556573, -6.115428,
-  6.293059, 0.162242, -6.119173,
-  // f 1105/928 1178/1035 1181/1037 1106/929
-  7.912992, 0.792839, -3.239902,
-  7.912992, 0.130421, -3.343908,
-  6.293059, 0.162242, -6.119173,
-  // f 1167/1013 1186/1042 1183/1039 1108/931
-  7.911951, 3.119517, -0.604834,
-  6.292015, 1.942347, -6.020161,
-  6.289298, 0.891421, -6.020161,
-  // f 1167/1013 1186/1042 1183/1039 1108/931
-  7.911951, 3.119517, -0.604834,
-  7.909442, 1.355011, -0.604834,
-  6.289298, 0.891421, -6.020161,
-  // f 1168/1015 1187/1043 1186/1042 1167/1013
-  7.539102, 3.973069, -0.604834,
-  5.919166, 2.450651, -6.02016,
-  6.292015, 1.942347, -6.020161,
-  // f 1168/1015 1187/1043 1186/1042 1167/1013
-  7.539102, 3.973069, -0.604834,
-  7.911951, 3.119517, -0.604834,
-  6.292015, 1.942347, -6.020161,
-  // f 1169/1018 1188/1044 1187/1043 1168/1015
-  3.903195, 4.138829, -1.73973,
-  2.283261, 2.549442, -6.061133,
-  5.919166, 2.450651, -6.02016,
-  // f 1169/1018 1188/1044 1187/1043 1168/1015
-  3.903195, 4.138829, -1.73973,
-  7.539102, 3.973069, -0.604834,
-  5.919166, 2.450651, -6.02016,
-  // f 1170/1020 1189/1045 1188/1044 1169/1018
-  2.066119, 4.13966, -2.129539,
-  0.446185, 2.549858, -6.075275,
-  2.283261, 2.549442, -6.061133,
-  // f 1170/1020 1189/1045 1188/1044 1169/1018
-  2.066119, 4.13966, -2.129539,
-  3.903195, 4.138829, -1.73973,
-  2.283261, 2.549442, -6.061133,
-  // f 1171/1022 1190/1046 1189/1045 1170/1020
-  1.945319, 4.140077, -2.683053,
-  0.325385, 2.550065, -6.095244,
-  0.446185, 2.549858, -6.075275,
-  // f 1171/1022 1190/1046 1189/1045 1170/1020
-  1.945319, 4.140077, -2.683053,
-  2.066119, 4.13966, -2.129539,
-  0.446185, 2.549858, -6.075275,
-  // f 1101/924 1180/1036 1191/1047 1172/1023
-  7.916758, -1.093959, -0.604833,
-  6.296822, -0.567145, -6.02016,
-  6.23475, -1.564828, -6.02016,
-  // f 1101/924 1180/1036 1191/1047 1172/1023
-  7.916758, -1.093959, -0.604833,
-  7.854895, -2.769242, -0.604833,
-  6.23475, -1.564828, -6.02016,
-  // f 1172/1023 1191/1047 1192/1048 1173/1026
-  7.854895, -2.769242, -0.604833,
-  6.23475, -1.564828, -6.02016,
-  6.193995, -1.999299, -6.02016,
-  // f 1172/1023 1191/1047 1192/1048 1173/1026
-  7.854895, -2.769242, -0.604833,
-  7.813931, -3.49863, -0.605041,
-  6.193995, -1.999299, -6.02016,
-  // f 1174/1029 984/793 964/772
-  1.202755, -3.520676, -2.814929,
-  -0.0042, -2.396958, -5.262371,
-  -0.004197, -3.521508, -3.076396,
-  // f 1173/1026 1192/1048 1193/1049 1175/1030
-  7.813931, -3.49863, -0.605041,
-  6.193995, -1.999299, -6.02016,
-  2.290576, -2.010114, -6.049692,
-  // f 1173/1026 1192/1048 1193/1049 1175/1030
-  7.813931, -3.49863, -0.605041,
-  3.910719, -3.516932, -1.418978,
-  2.290576, -2.010114, -6.049692,
-  // f 1175/1030 1193/1049 987/796 1176/1032
-  3.910719, -3.516932, -1.418978,
-  2.290576, -2.010114, -6.049692,
-  0.047212, -2.011778, -6.06113,
-  // f 1175/1030 1193/1049 987/796 1176/1032
-  3.910719, -3.516932, -1.418978,
-  1.71835, -3.519636, -1.618873,
-  0.047212, -2.011778, -6.06113,
-  // f 987/796 1194/1050 984/793
-  0.047212, -2.011778, -6.06113,
-  -0.004202, -2.011778, -6.065498,
-  -0.0042, -2.396958, -5.262371,
-  // f 987/796 984/793 1174/1029 1176/1032
-  0.047212, -2.011778, -6.06113,
-  -0.0042, -2.396958, -5.262371,
-  1.202755, -3.520676, -2.814929,
-  // f 987/796 984/793 1174/1029 1176/1032
-  0.047212, -2.011778, -6.06113,
-  1.71835, -3.519636, -1.618873,
-  1.202755, -3.520676, -2.814929,
-  // f 1156/995 989/798 988/797 1157/996
-  1.720642, -3.782108, -6.959526,
-  -0.004203, -3.790011, -6.959523,
-  -0.004203, -3.435404, -6.959523,
-  // f 1156/995 989/798 988/797 1157/996
-  1.720642, -3.782108, -6.959526,
-  1.721478, -3.425213, -6.959526,
-  -0.004203, -3.435404, -6.959523,
-  // f 1161/1002 1084/904 1158/997 954/752
-  1.201496, 4.706615, -6.473824,
-  1.715836, 4.699127, -6.502738,
-  1.719388, 4.272559, -6.930614,
-  // f 1161/1002 1084/904 1158/997 954/752
-  1.201496, 4.706615, -6.473824,
-  -0.004202, 4.713479, -6.500447,
-  1.719388, 4.272559, -6.930614,
-  // f 936/734 954/752 1158/997
-  -0.004203, 4.24469, -6.945172,
-  -0.004202, 4.713479, -6.500447,
-  1.719388, 4.272559, -6.930614,
-  // f 1087/998 944/799 941/739 1082/902
-  1.718344, -4.787485, -6.058635,
-  -0.004202, -4.840312, -6.085466,
-  -0.004202, -4.46678, -6.502734,
-  // f 1087/998 944/799 941/739 1082/902
-  1.718344, -4.787485, -6.058635,
-  1.717508, -4.435583, -6.502736,
-  -0.004202, -4.46678, -6.502734,
-  // f 953/801 950/748 1113/936 1160/1051
-  -0.004201, 4.920627, -6.043658,
-  -0.004199, 4.921043, -4.057163,
-  1.928806, 4.911892, -3.933192,
-  // f 953/801 950/748 1113/936 1160/1051
-  -0.004201, 4.920627, -6.043658,
-  1.201079, 4.910644, -6.016826,
-  1.928806, 4.911892, -3.933192,
-  // f 1113/936 1083/999 1160/1051
-  1.928806, 4.911892, -3.933192,
-  1.715, 4.899829, -6.045948,
-  1.201079, 4.910644, -6.016826,
-  // f 1157/996 988/797 939/737 1075/895
-  1.721478, -3.425213, -6.959526,
-  -0.004203, -3.435404, -6.959523,
-  -0.004203, -1.005153, -6.959524,
-  // f 1157/996 988/797 939/737 1075/895
-  1.721478, -3.425213, -6.959526,
-  1.721478, -1.001409, -6.959526,
-  -0.004203, -1.005153, -6.959524,
-  // f 946/1052 955/1011 1163/1007
-  -0.004198, -4.871509, -3.1752,
-  -0.004198, -4.901874, -3.273797,
-  1.205054, -4.875876, -3.015866,
-  // f 1163/1007 1165/1009 946/1052
-  1.205054, -4.875876, -3.015866,
-  1.205054, -4.875876, -2.814929,
-  -0.004198, -4.871509, -3.1752,
-  // f 1114/937 867/648 868/917 1094/916
-  2.05525, 4.874872, -2.885239,
-  -0.004197, 4.875288, -2.819505,
-  -0.004197, 4.875288, -2.914149,
-  // f 1114/937 867/648 868/917 1094/916
-  2.05525, 4.874872, -2.885239,
-  2.054623, 4.875079, -2.880454,
-  -0.004197, 4.875288, -2.914149,
-  // f 963/1053 946/1052 1165/1009 1166/1010
-  -0.004197, -4.684118, -3.076395,
-  -0.004198, -4.871509, -3.1752,
-  1.205054, -4.875876, -2.814929,
-  // f 963/1053 946/1052 1165/1009 1166/1010
-  -0.004197, -4.684118, -3.076395,
-  1.202755, -4.658329, -2.814929,
-  1.205054, -4.875876, -2.814929,
-  // f 1081/901 940/738 989/798 1156/995
-  1.720224, -3.855525, -6.935189,
-  -0.004203, -3.864052, -6.935812,
-  -0.004203, -3.790011, -6.959523,
-  // f 1081/901 940/738 989/798 1156/995
-  1.720224, -3.855525, -6.935189,
-  1.720642, -3.782108, -6.959526,
-  -0.004203, -3.790011, -6.959523,
-  // f 1155/1021 931/805 990/804 1171/1022
-  1.945319, 4.679578, -2.683053,
-  -0.004197, 4.680202, -2.724653,
-  -0.004197, 4.140492, -2.724652,
-  // f 1155/1021 931/805 990/804 1171/1022
-  1.945319, 4.679578, -2.683053,
-  1.945319, 4.140077, -2.683053,
-  -0.004197, 4.140492, -2.724652,
-  // f 990/804 991/806 1190/1046 1171/1022
-  -0.004197, 4.140492, -2.724652,
-  -0.004202, 2.550065, -6.095452,
-  0.325385, 2.550065, -6.095244,
-  // f 990/804 991/806 1190/1046 1171/1022
-  -0.004197, 4.140492, -2.724652,
-  1.945319, 4.140077, -2.683053,
-  0.325385, 2.550065, -6.095244,
-  // f 1195/1054 1196/1055 1197/1056 1198/1057
-  -3.530592, 4.749875, -6.149322,
-  -3.540206, 4.894422, -6.23315,
-  -3.824441, 4.894422, -6.23315,
-  // f 1195/1054 1196/1055 1197/1056 1198/1057
-  -3.530592, 4.749875, -6.149322,
-  -3.834264, 4.749875, -6.149322,
-  -3.824441, 4.894422, -6.23315,
-  // f 1199/1058 1200/1059 1201/1060 1202/1061
-  -3.530593, 4.572259, -6.530188,
-  -3.834264, 4.572259, -6.530187,
-  -3.824442, 4.728037, -6.589678,
-  // f 1199/1058 1200/1059 1201/1060 1202/1061
-  -3.530593, 4.572259, -6.530188,
-  -3.540207, 4.728037, -6.589679,
-  -3.824442, 4.728037, -6.589678,
-  // f 1198/1057 1197/1056 1201/1060 1200/1059
-  -3.834264, 4.749875, -6.149322,
-  -3.824441, 4.894422, -6.23315,
-  -3.824442, 4.728037, -6.589678,
-  // f 1198/1057 1197/1056 1201/1060 1200/1059
-  -3.834264, 4.749875, -6.149322,
-  -3.834264, 4.572259, -6.530187,
-  -3.824442, 4.728037, -6.589678,
-  // f 1197/1056 1196/1055 1202/1061 1201/1060
-  -3.824441, 4.894422, -6.23315,
-  -3.540206, 4.894422, -6.23315,
-  -3.540207, 4.728037, -6.589679,
-  // f 1197/1056 1196/1055 1202/1061 1201/1060
-  -3.824441, 4.894422, -6.23315,
-  -3.824442, 4.728037, -6.589678,
-  -3.540207, 4.728037, -6.589679,
-  // f 1196/1055 1195/1054 1199/1058 1202/1061
-  -3.540206, 4.894422, -6.23315,
-  -3.530592, 4.749875, -6.149322,
-  -3.530593, 4.572259, -6.530188,
-  // f 1196/1055 1195/1054 1199/1058 1202/1061
-  -3.540206, 4.894422, -6.23315,
-  -3.540207, 4.728037, -6.589679,
-  -3.530593, 4.572259, -6.530188,
-};
-
-float DK2TexCoords [] = {
-  // f 12/1 11/2 75/3 76/4
-  0.711100, 0.5646,
-  0.699300, 0.5832,
-  0.703400, 0.5873,
-  // f 12/1 11/2 75/3 76/4
-  0.711100, 0.5646,
-  0.714100, 0.5672,
-  0.703400, 0.5873,
-  // f 11/2 14/5 77/6 75/3
-  0.699300, 0.5832,
-  0.698200, 0.7293,
-  0.702300, 0.7253,
-  // f 11/2 14/5 77/6 75/3
-  0.699300, 0.5832,
-  0.703400, 0.5873,
-  0.702300, 0.7253,
-  // f 14/5 16/7 78/8 77/6
-  0.698200, 0.7293,
-  0.707700, 0.7463,
-  0.710800, 0.744,
-  // f 14/5 16/7 78/8 77/6
-  0.698200, 0.7293,
-  0.702300, 0.7253,
-  0.710800, 0.744,
-  // f 16/9 18/10 79/11 78/12
-  0.763300, 0.7784,
-  0.754700, 0.779,
-  0.752200, 0.7819,
-  // f 16/9 18/10 79/11 78/12
-  0.763300, 0.7784,
-  0.761700, 0.7815,
-  0.752200, 0.7819,
-  // f 18/10 21/13 80/14 79/11
-  0.754700, 0.779,
-  0.680000, 0.7529,
-  0.679500, 0.7565,
-  // f 18/10 21/13 80/14 79/11
-  0.754700, 0.779,
-  0.752200, 0.7819,
-  0.679500, 0.7565,
-  // f 21/13 20/15 81/16 80/14
-  0.680000, 0.7529,
-  0.608800, 0.7303,
-  0.608600, 0.7341,
-  // f 21/13 20/15 81/16 80/14
-  0.680000, 0.7529,
-  0.679500, 0.7565,
-  0.608600, 0.7341,
-  // f 82/17 81/16 20/15 41/18
-  0.572600, 0.7293,
-  0.608600, 0.7341,
-  0.608800, 0.7303,
-  // f 82/17 81/16 20/15 41/18
-  0.572600, 0.7293,
-  0.572700, 0.7255,
-  0.608800, 0.7303,
-  // f 35/19 34/20 83/21 84/22
-  0.438700, 0.7273,
-  0.368000, 0.7503,
-  0.368500, 0.754,
-  // f 35/19 34/20 83/21 84/22
-  0.438700, 0.7273,
-  0.438900, 0.7313,
-  0.368500, 0.754,
-  // f 34/20 24/23 85/24 83/21
-  0.368000, 0.7503,
-  0.294200, 0.7774,
-  0.296700, 0.7804,
-  // f 34/20 24/23 85/24 83/21
-  0.368000, 0.7503,
-  0.368500, 0.754,
-  0.296700, 0.7804,
-  // f 24/23 12/25 76/26 85/24
-  0.294200, 0.7774,
-  0.286400, 0.7774,
-  0.288100, 0.7804,
-  // f 24/23 12/25 76/26 85/24
-  0.294200, 0.7774,
-  0.296700, 0.7804,
-  0.288100, 0.7804,
-  // f 239/27 238/28 245/29 246/30
-  0.757600, 0.3306,
-  0.753900, 0.3404,
-  0.791300, 0.3456,
-  // f 239/27 238/28 245/29 246/30
-  0.757600, 0.3306,
-  0.792700, 0.335,
-  0.791300, 0.3456,
-  // f 238/31 244/32 247/33 245/34
-  0.870900, 0.3312,
-  0.871400, 0.321,
-  0.827500, 0.3189,
-  // f 238/31 244/32 247/33 245/34
-  0.870900, 0.3312,
-  0.827000, 0.3291,
-  0.827500, 0.3189,
-  // f 244/35 237/36 248/37 247/38
-  0.757800, 0.308,
-  0.756500, 0.3183,
-  0.793600, 0.3224,
-  // f 244/35 237/36 248/37 247/38
-  0.757800, 0.308,
-  0.794400, 0.312,
-  0.793600, 0.3224,
-  // f 237/36 239/27 246/30 248/37
-  0.756500, 0.3183,
-  0.757600, 0.3306,
-  0.792700, 0.335,
-  // f 237/36 239/27 246/30 248/37
-  0.756500, 0.3183,
-  0.793600, 0.3224,
-  0.792700, 0.335,
-  // f 242/39 241/40 240/41 243/42
-  0.743300, 0.3335,
-  0.747800, 0.3378,
-  0.753400, 0.3299,
-  // f 242/39 241/40 240/41 243/42
-  0.743300, 0.3335,
-  0.751100, 0.3272,
-  0.753400, 0.3299,
-  // f 10/43 9/44 249/45 250/46
-  -0.894300, 0.339,
-  -0.896500, 0.3295,
-  -0.917900, 0.3384,
-  // f 10/43 9/44 249/45 250/46
-  -0.894300, 0.339,
-  -0.916100, 0.3458,
-  -0.917900, 0.3384,
-  // f 13/47 10/43 250/46 251/48
-  -0.894300, 0.402,
-  -0.894300, 0.339,
-  -0.916100, 0.3458,
-  // f 13/47 10/43 250/46 251/48
-  -0.894300, 0.402,
-  -0.916100, 0.395,
-  -0.916100, 0.3458,
-  // f 15/49 13/47 251/48 252/50
-  -0.896100, 0.4104,
-  -0.894300, 0.402,
-  -0.916100, 0.395,
-  // f 15/49 13/47 251/48 252/50
-  -0.896100, 0.4104,
-  -0.917500, 0.4016,
-  -0.916100, 0.395,
-  // f 9/44 23/51 253/52 249/45
-  -0.896500, 0.3295,
-  -0.899800, 0.3255,
-  -0.920400, 0.3353,
-  // f 9/44 23/51 253/52 249/45
-  -0.896500, 0.3295,
-  -0.917900, 0.3384,
-  -0.920400, 0.3353,
-  // f 17/53 15/49 252/50 254/54
-  -0.899700, 0.4148,
-  -0.896100, 0.4104,
-  -0.917500, 0.4016,
-  // f 17/53 15/49 252/50 254/54
-  -0.899700, 0.4148,
-  -0.920300, 0.405,
-  -0.917500, 0.4016,
-  // f 22/55 17/53 254/54 255/56
-  -0.931100, 0.4148,
-  -0.899700, 0.4148,
-  -0.920300, 0.405,
-  // f 22/55 17/53 254/54 255/56
-  -0.931100, 0.4148,
-  -0.944800, 0.405,
-  -0.920300, 0.405,
-  // f 19/57 22/55 255/56 256/58
-  -0.962400, 0.4148,
-  -0.931100, 0.4148,
-  -0.944800, 0.405,
-  // f 19/57 22/55 255/56 256/58
-  -0.962400, 0.4148,
-  -0.969300, 0.405,
-  -0.944800, 0.405,
-  // f 33/59 36/60 257/61 258/62
-  -0.931200, 0.3255,
-  -0.962500, 0.3255,
-  -0.969300, 0.3353,
-  // f 33/59 36/60 257/61 258/62
-  -0.931200, 0.3255,
-  -0.944900, 0.3353,
-  -0.969300, 0.3353,
-  // f 23/51 33/59 258/62 253/52
-  -0.899800, 0.3255,
-  -0.931200, 0.3255,
-  -0.944900, 0.3353,
-  // f 23/51 33/59 258/62 253/52
-  -0.899800, 0.3255,
-  -0.920400, 0.3353,
-  -0.944900, 0.3353,
-  // f 50/63 259/64 257/61 36/60
-  -0.978100, 0.3255,
-  -0.981600, 0.3353,
-  -0.969300, 0.3353,
-  // f 50/63 259/64 257/61 36/60
-  -0.978100, 0.3255,
-  -0.962500, 0.3255,
-  -0.969300, 0.3353,
-  // f 153/65 152/66 264/67 265/68
-  0.067100, 0.659,
-  0.049900, 0.6832,
-  0.058500, 0.6883,
-  // f 153/65 152/66 264/67 265/68
-  0.067100, 0.659,
-  0.069800, 0.6676,
-  0.058500, 0.6883,
-  // f 41/18 269/69 276/70 82/17
-  0.572700, 0.7255,
-  0.538200, 0.7209,
-  0.538200, 0.7247,
-  // f 41/18 269/69 276/70 82/17
-  0.572700, 0.7255,
-  0.572600, 0.7293,
-  0.538200, 0.7247,
-  // f 35/19 84/22 277/71 49/72
-  0.438700, 0.7273,
-  0.438900, 0.7313,
-  0.474800, 0.7276,
-  // f 35/19 84/22 277/71 49/72
-  0.438700, 0.7273,
-  0.474600, 0.7239,
-  0.474800, 0.7276,
-  // f 40/73 19/57 256/58 279/74
-  -0.978100, 0.4148,
-  -0.962400, 0.4148,
-  -0.969300, 0.405,
-  // f 40/73 19/57 256/58 279/74
-  -0.978100, 0.4148,
-  -0.981600, 0.405,
-  -0.969300, 0.405,
-  // f 275/75 280/76 259/64 50/63
-  -0.993100, 0.3255,
-  -0.993100, 0.3353,
-  -0.981600, 0.3353,
-  // f 275/75 280/76 259/64 50/63
-  -0.993100, 0.3255,
-  -0.978100, 0.3255,
-  -0.981600, 0.3353,
-  // f 49/72 277/71 393/77 274/78
-  0.474600, 0.7239,
-  0.474800, 0.7276,
-  0.509100, 0.7242,
-  // f 49/72 277/71 393/77 274/78
-  0.474600, 0.7239,
-  0.509000, 0.7206,
-  0.509100, 0.7242,
-  // f 268/79 40/73 279/74 403/80
-  -0.993100, 0.4148,
-  -0.978100, 0.4148,
-  -0.981600, 0.405,
-  // f 268/79 40/73 279/74 403/80
-  -0.993100, 0.4148,
-  -0.993100, 0.405,
-  -0.981600, 0.405,
-  // f 414/1 479/4 480/3 415/2
-  0.711100, 0.5646,
-  0.714100, 0.5672,
-  0.703400, 0.5873,
-  // f 414/1 479/4 480/3 415/2
-  0.711100, 0.5646,
-  0.699300, 0.5832,
-  0.703400, 0.5873,
-  // f 415/2 480/3 481/6 417/5
-  0.699300, 0.5832,
-  0.703400, 0.5873,
-  0.702300, 0.7253,
-  // f 415/2 480/3 481/6 417/5
-  0.699300, 0.5832,
-  0.698200, 0.7293,
-  0.702300, 0.7253,
-  // f 417/5 481/6 482/8 419/7
-  0.698200, 0.7293,
-  0.702300, 0.7253,
-  0.710800, 0.744,
-  // f 417/5 481/6 482/8 419/7
-  0.698200, 0.7293,
-  0.707700, 0.7463,
-  0.710800, 0.744,
-  // f 419/9 482/12 483/11 421/10
-  0.763300, 0.7784,
-  0.761700, 0.7815,
-  0.752200, 0.7819,
-  // f 419/9 482/12 483/11 421/10
-  0.763300, 0.7784,
-  0.754700, 0.779,
-  0.752200, 0.7819,
-  // f 421/10 483/11 484/14 425/13
-  0.754700, 0.779,
-  0.752200, 0.7819,
-  0.679500, 0.7565,
-  // f 421/10 483/11 484/14 425/13
-  0.754700, 0.779,
-  0.680000, 0.7529,
-  0.679500, 0.7565,
-  // f 425/13 484/14 485/16 426/15
-  0.680000, 0.7529,
-  0.679500, 0.7565,
-  0.608600, 0.7341,
-  // f 425/13 484/14 485/16 426/15
-  0.680000, 0.7529,
-  0.608800, 0.7303,
-  0.608600, 0.7341,
-  // f 486/17 444/18 426/15 485/16
-  0.572600, 0.7293,
-  0.572700, 0.7255,
-  0.608800, 0.7303,
-  // f 486/17 444/18 426/15 485/16
-  0.572600, 0.7293,
-  0.608600, 0.7341,
-  0.608800, 0.7303,
-  // f 439/19 487/22 488/21 440/20
-  0.438700, 0.7273,
-  0.438900, 0.7313,
-  0.368500, 0.754,
-  // f 439/19 487/22 488/21 440/20
-  0.438700, 0.7273,
-  0.368000, 0.7503,
-  0.368500, 0.754,
-  // f 440/20 488/21 489/24 428/23
-  0.368000, 0.7503,
-  0.368500, 0.754,
-  0.296700, 0.7804,
-  // f 440/20 488/21 489/24 428/23
-  0.368000, 0.7503,
-  0.294200, 0.7774,
-  0.296700, 0.7804,
-  // f 428/23 489/24 479/26 414/25
-  0.294200, 0.7774,
-  0.296700, 0.7804,
-  0.288100, 0.7804,
-  // f 428/23 489/24 479/26 414/25
-  0.294200, 0.7774,
-  0.286400, 0.7774,
-  0.288100, 0.7804,
-  // f 635/27 639/30 640/29 632/28
-  0.757600, 0.3306,
-  0.792700, 0.335,
-  0.791300, 0.3456,
-  // f 635/27 639/30 640/29 632/28
-  0.757600, 0.3306,
-  0.753900, 0.3404,
-  0.791300, 0.3456,
-  // f 632/31 640/34 641/33 638/32
-  0.870900, 0.3312,
-  0.827000, 0.3291,
-  0.827500, 0.3189,
-  // f 632/31 640/34 641/33 638/32
-  0.870900, 0.3312,
-  0.871400, 0.321,
-  0.827500, 0.3189,
-  // f 638/35 641/38 642/37 631/36
-  0.757800, 0.308,
-  0.794400, 0.312,
-  0.793600, 0.3224,
-  // f 638/35 641/38 642/37 631/36
-  0.757800, 0.308,
-  0.756500, 0.3183,
-  0.793600, 0.3224,
-  // f 631/36 642/37 639/30 635/27
-  0.756500, 0.3183,
-  0.793600, 0.3224,
-  0.792700, 0.335,
-  // f 631/36 642/37 639/30 635/27
-  0.756500, 0.3183,
-  0.757600, 0.3306,
-  0.792700, 0.335,
-  // f 636/39 637/42 634/41 633/40
-  0.743300, 0.3335,
-  0.751100, 0.3272,
-  0.753400, 0.3299,
-  // f 636/39 637/42 634/41 633/40
-  0.743300, 0.3335,
-  0.747800, 0.3378,
-  0.753400, 0.3299,
-  // f 416/43 643/46 644/45 413/44
-  -0.894300, 0.339,
-  -0.916100, 0.3458,
-  -0.917900, 0.3384,
-  // f 416/43 643/46 644/45 413/44
-  -0.894300, 0.339,
-  -0.896500, 0.3295,
-  -0.917900, 0.3384,
-  // f 418/47 645/48 643/46 416/43
-  -0.894300, 0.402,
-  -0.916100, 0.395,
-  -0.916100, 0.3458,
-  // f 418/47 645/48 643/46 416/43
-  -0.894300, 0.402,
-  -0.894300, 0.339,
-  -0.916100, 0.3458,
-  // f 420/49 646/50 645/48 418/47
-  -0.896100, 0.4104,
-  -0.917500, 0.4016,
-  -0.916100, 0.395,
-  // f 420/49 646/50 645/48 418/47
-  -0.896100, 0.4104,
-  -0.894300, 0.402,
-  -0.916100, 0.395,
-  // f 413/44 644/45 647/52 427/51
-  -0.896500, 0.3295,
-  -0.917900, 0.3384,
-  -0.920400, 0.3353,
-  // f 413/44 644/45 647/52 427/51
-  -0.896500, 0.3295,
-  -0.899800, 0.3255,
-  -0.920400, 0.3353,
-  // f 422/53 648/54 646/50 420/49
-  -0.899700, 0.4148,
-  -0.920300, 0.405,
-  -0.917500, 0.4016,
-  // f 422/53 648/54 646/50 420/49
-  -0.899700, 0.4148,
-  -0.896100, 0.4104,
-  -0.917500, 0.4016,
-  // f 424/55 649/56 648/54 422/53
-  -0.931100, 0.4148,
-  -0.944800, 0.405,
-  -0.920300, 0.405,
-  // f 424/55 649/56 648/54 422/53
-  -0.931100, 0.4148,
-  -0.899700, 0.4148,
-  -0.920300, 0.405,
-  // f 423/57 650/58 649/56 424/55
-  -0.962400, 0.4148,
-  -0.969300, 0.405,
-  -0.944800, 0.405,
-  // f 423/57 650/58 649/56 424/55
-  -0.962400, 0.4148,
-  -0.931100, 0.4148,
-  -0.944800, 0.405,
-  // f 437/59 651/62 652/61 438/60
-  -0.931200, 0.3255,
-  -0.944900, 0.3353,
-  -0.969300, 0.3353,
-  // f 437/59 651/62 652/61 438/60
-  -0.931200, 0.3255,
-  -0.962500, 0.3255,
-  -0.969300, 0.3353,
-  // f 427/51 647/52 651/62 437/59
-  -0.899800, 0.3255,
-  -0.920400, 0.3353,
-  -0.944900, 0.3353,
-  // f 427/51 647/52 651/62 437/59
-  -0.899800, 0.3255,
-  -0.931200, 0.3255,
-  -0.944900, 0.3353,
-  // f 454/63 438/60 652/61 653/64
-  -0.978100, 0.3255,
-  -0.962500, 0.3255,
-  -0.969300, 0.3353,
-  // f 454/63 438/60 652/61 653/64
-  -0.978100, 0.3255,
-  -0.981600, 0.3353,
-  -0.969300, 0.3353,
-  // f 554/65 659/68 658/67 555/66
-  0.067100, 0.659,
-  0.069800, 0.6676,
-  0.058500, 0.6883,
-  // f 554/65 659/68 658/67 555/66
-  0.067100, 0.659,
-  0.049900, 0.6832,
-  0.058500, 0.6883,
-  // f 444/18 486/17 276/70 269/69
-  0.572700, 0.7255,
-  0.572600, 0.7293,
-  0.538200, 0.7247,
-  // f 444/18 486/17 276/70 269/69
-  0.572700, 0.7255,
-  0.538200, 0.7209,
-  0.538200, 0.7247,
-  // f 439/19 453/72 660/71 487/22
-  0.438700, 0.7273,
-  0.474600, 0.7239,
-  0.474800, 0.7276,
-  // f 439/19 453/72 660/71 487/22
-  0.438700, 0.7273,
-  0.438900, 0.7313,
-  0.474800, 0.7276,
-  // f 445/73 662/74 650/58 423/57
-  -0.978100, 0.4148,
-  -0.981600, 0.405,
-  -0.969300, 0.405,
-  // f 445/73 662/74 650/58 423/57
-  -0.978100, 0.4148,
-  -0.962400, 0.4148,
-  -0.969300, 0.405,
-  // f 275/75 454/63 653/64 280/76
-  -0.993100, 0.3255,
-  -0.978100, 0.3255,
-  -0.981600, 0.3353,
-  // f 275/75 454/63 653/64 280/76
-  -0.993100, 0.3255,
-  -0.993100, 0.3353,
-  -0.981600, 0.3353,
-  // f 453/72 274/78 393/77 660/71
-  0.474600, 0.7239,
-  0.509000, 0.7206,
-  0.509100, 0.7242,
-  // f 453/72 274/78 393/77 660/71
-  0.474600, 0.7239,
-  0.474800, 0.7276,
-  0.509100, 0.7242,
-  // f 268/79 403/80 662/74 445/73
-  -0.993100, 0.4148,
-  -0.993100, 0.405,
-  -0.981600, 0.405,
-  // f 268/79 403/80 662/74 445/73
-  -0.993100, 0.4148,
-  -0.978100, 0.4148,
-  -0.981600, 0.405,
-  // f 1/81 2/82 3/83 4/84
-  0.476200, 0.5805,
-  0.476600, 0.6405,
-  0.482900, 0.6474,
-  // f 1/81 2/82 3/83 4/84
-  0.476200, 0.5805,
-  0.481700, 0.5738,
-  0.482900, 0.6474,
-  // f 5/85 6/86 7/87 8/88
-  0.546400, 0.674,
-  0.603100, 0.6769,
-  0.601500, 0.6736,
-  // f 5/85 6/86 7/87 8/88
-  0.546400, 0.674,
-  0.543600, 0.6699,
-  0.601500, 0.6736,
-  // f 9/89 10/90 11/91 12/92
-  0.970100, 0.6712,
-  0.969100, 0.6498,
-  0.868500, 0.6555,
-  // f 9/89 10/90 11/91 12/92
-  0.970100, 0.6712,
-  0.869700, 0.6759,
-  0.868500, 0.6555,
-  // f 10/90 13/93 14/94 11/91
-  0.969100, 0.6498,
-  0.961000, 0.5164,
-  0.860400, 0.5227,
-  // f 10/90 13/93 14/94 11/91
-  0.969100, 0.6498,
-  0.868500, 0.6555,
-  0.860400, 0.5227,
-  // f 13/93 15/95 16/96 14/94
-  0.961000, 0.5164,
-  0.959500, 0.4976,
-  0.859200, 0.5044,
-  // f 13/93 15/95 16/96 14/94
-  0.961000, 0.5164,
-  0.860400, 0.5227,
-  0.859200, 0.5044,
-  // f 15/95 17/97 18/98 16/96
-  0.959500, 0.4976,
-  0.958200, 0.4835,
-  0.859900, 0.4916,
-  // f 15/95 17/97 18/98 16/96
-  0.959500, 0.4976,
-  0.859200, 0.5044,
-  0.859900, 0.4916,
-  // f 19/99 20/100 21/101 22/102
-  0.940700, 0.2998,
-  0.913500, 0.3024,
-  0.896400, 0.3967,
-  // f 19/99 20/100 21/101 22/102
-  0.940700, 0.2998,
-  0.949400, 0.3917,
-  0.896400, 0.3967,
-  // f 23/103 9/89 12/92 24/104
-  0.970500, 0.6847,
-  0.970100, 0.6712,
-  0.869700, 0.6759,
-  // f 23/103 9/89 12/92 24/104
-  0.970500, 0.6847,
-  0.871700, 0.6871,
-  0.869700, 0.6759,
-  // f 25/105 26/106 27/107 28/108
-  0.558800, 0.5855,
-  0.558500, 0.6355,
-  0.601900, 0.6425,
-  // f 25/105 26/106 27/107 28/108
-  0.558800, 0.5855,
-  0.602100, 0.5784,
-  0.601900, 0.6425,
-  // f 29/109 30/110 31/111 32/112
-  0.546900, 0.5498,
-  0.544000, 0.551,
-  0.601700, 0.5475,
-  // f 29/109 30/110 31/111 32/112
-  0.546900, 0.5498,
-  0.603200, 0.5467,
-  0.601700, 0.5475,
-  // f 33/113 34/114 35/115 36/116
-  0.970800, 0.7773,
-  0.917400, 0.7771,
-  0.941700, 0.869,
-  // f 33/113 34/114 35/115 36/116
-  0.970800, 0.7773,
-  0.969100, 0.8699,
-  0.941700, 0.869,
-  // f 6/86 37/117 38/118 7/87
-  0.603100, 0.6769,
-  0.628600, 0.6768,
-  0.627800, 0.6733,
-  // f 6/86 37/117 38/118 7/87
-  0.603100, 0.6769,
-  0.601500, 0.6736,
-  0.627800, 0.6733,
-  // f 8/88 3/83 39/119 5/85
-  0.543600, 0.6699,
-  0.482900, 0.6474,
-  0.489400, 0.654,
-  // f 8/88 3/83 39/119 5/85
-  0.543600, 0.6699,
-  0.546400, 0.674,
-  0.489400, 0.654,
-  // f 19/99 40/120 41/121 20/100
-  0.940700, 0.2998,
-  0.936300, 0.2539,
-  0.911700, 0.2563,
-  // f 19/99 40/120 41/121 20/100
-  0.940700, 0.2998,
-  0.913500, 0.3024,
-  0.911700, 0.2563,
-  // f 18/98 17/97 22/102 21/101
-  0.859900, 0.4916,
-  0.958200, 0.4835,
-  0.949400, 0.3917,
-  // f 18/98 17/97 22/102 21/101
-  0.859900, 0.4916,
-  0.896400, 0.3967,
-  0.949400, 0.3917,
-  // f 42/122 43/123 26/106 25/105
-  0.509800, 0.5769,
-  0.509400, 0.6436,
-  0.558500, 0.6355,
-  // f 42/122 43/123 26/106 25/105
-  0.509800, 0.5769,
-  0.558800, 0.5855,
-  0.558500, 0.6355,
-  // f 27/107 44/124 45/125 28/108
-  0.601900, 0.6425,
-  0.628000, 0.6429,
-  0.628100, 0.5779,
-  // f 27/107 44/124 45/125 28/108
-  0.601900, 0.6425,
-  0.602100, 0.5784,
-  0.628100, 0.5779,
-  // f 46/126 4/84 30/110 29/109
-  0.487700, 0.5688,
-  0.481700, 0.5738,
-  0.544000, 0.551,
-  // f 46/126 4/84 30/110 29/109
-  0.487700, 0.5688,
-  0.546900, 0.5498,
-  0.544000, 0.551,
-  // f 47/127 48/128 32/112 31/111
-  0.627800, 0.5479,
-  0.628600, 0.5459,
-  0.603200, 0.5467,
-  // f 47/127 48/128 32/112 31/111
-  0.627800, 0.5479,
-  0.601700, 0.5475,
-  0.603200, 0.5467,
-  // f 23/103 24/104 34/114 33/113
-  0.970500, 0.6847,
-  0.871700, 0.6871,
-  0.917400, 0.7771,
-  // f 23/103 24/104 34/114 33/113
-  0.970500, 0.6847,
-  0.970800, 0.7773,
-  0.917400, 0.7771,
-  // f 49/129 50/130 36/116 35/115
-  0.942100, 0.9149,
-  0.966800, 0.9161,
-  0.969100, 0.8699,
-  // f 49/129 50/130 36/116 35/115
-  0.942100, 0.9149,
-  0.941700, 0.869,
-  0.969100, 0.8699,
-  // f 51/131 52/132 53/133 54/134
-  0.325700, 0.7457,
-  0.325800, 0.7325,
-  0.317400, 0.7346,
-  // f 51/131 52/132 53/133 54/134
-  0.325700, 0.7457,
-  0.317300, 0.7432,
-  0.317400, 0.7346,
-  // f 52/132 55/135 56/136 53/133
-  0.325800, 0.7325,
-  0.318900, 0.7207,
-  0.312600, 0.7268,
-  // f 52/132 55/135 56/136 53/133
-  0.325800, 0.7325,
-  0.317400, 0.7346,
-  0.312600, 0.7268,
-  // f 55/135 57/137 58/138 56/136
-  0.318900, 0.7207,
-  0.306800, 0.7135,
-  0.304300, 0.722,
-  // f 55/135 57/137 58/138 56/136
-  0.318900, 0.7207,
-  0.312600, 0.7268,
-  0.304300, 0.722,
-  // f 57/137 59/139 60/140 58/138
-  0.306800, 0.7135,
-  0.292800, 0.713,
-  0.294700, 0.7215,
-  // f 57/137 59/139 60/140 58/138
-  0.306800, 0.7135,
-  0.304300, 0.722,
-  0.294700, 0.7215,
-  // f 59/139 61/141 62/142 60/140
-  0.292800, 0.713,
-  0.280600, 0.7191,
-  0.286500, 0.7255,
-  // f 59/139 61/141 62/142 60/140
-  0.292800, 0.713,
-  0.294700, 0.7215,
-  0.286500, 0.7255,
-  // f 61/141 63/143 64/144 62/142
-  0.280600, 0.7191,
-  0.273500, 0.7303,
-  0.281900, 0.7327,
-  // f 61/141 63/143 64/144 62/142
-  0.280600, 0.7191,
-  0.286500, 0.7255,
-  0.281900, 0.7327,
-  // f 63/143 65/145 66/146 64/144
-  0.273500, 0.7303,
-  0.273400, 0.7435,
-  0.281900, 0.7413,
-  // f 63/143 65/145 66/146 64/144
-  0.273500, 0.7303,
-  0.281900, 0.7327,
-  0.281900, 0.7413,
-  // f 65/145 67/147 68/148 66/146
-  0.273400, 0.7435,
-  0.280300, 0.7553,
-  0.286600, 0.7491,
-  // f 65/145 67/147 68/148 66/146
-  0.273400, 0.7435,
-  0.281900, 0.7413,
-  0.286600, 0.7491,
-  // f 67/147 69/149 70/150 68/148
-  0.280300, 0.7553,
-  0.292400, 0.7624,
-  0.294900, 0.754,
-  // f 67/147 69/149 70/150 68/148
-  0.280300, 0.7553,
-  0.286600, 0.7491,
-  0.294900, 0.754,
-  // f 69/149 71/151 72/152 70/150
-  0.292400, 0.7624,
-  0.306500, 0.763,
-  0.304500, 0.7544,
-  // f 69/149 71/151 72/152 70/150
-  0.292400, 0.7624,
-  0.294900, 0.754,
-  0.304500, 0.7544,
-  // f 71/151 73/153 74/154 72/152
-  0.306500, 0.763,
-  0.318600, 0.7568,
-  0.312700, 0.7504,
-  // f 71/151 73/153 74/154 72/152
-  0.306500, 0.763,
-  0.304500, 0.7544,
-  0.312700, 0.7504,
-  // f 73/153 51/131 54/134 74/154
-  0.318600, 0.7568,
-  0.325700, 0.7457,
-  0.317300, 0.7432,
-  // f 73/153 51/131 54/134 74/154
-  0.318600, 0.7568,
-  0.312700, 0.7504,
-  0.317300, 0.7432,
-  // f 53/133 56/136 58/138 74/154
-  0.317400, 0.7346,
-  0.312600, 0.7268,
-  0.304300, 0.722,
-  // f 53/133 56/136 58/138 74/154
-  0.317400, 0.7346,
-  0.312700, 0.7504,
-  0.304300, 0.722,
-  // f 58/138 60/140 62/142 66/146
-  0.304300, 0.722,
-  0.294700, 0.7215,
-  0.286500, 0.7255,
-  // f 58/138 60/140 62/142 66/146
-  0.304300, 0.722,
-  0.281900, 0.7413,
-  0.286500, 0.7255,
-  // f 62/142 64/144 66/146
-  0.286500, 0.7255,
-  0.281900, 0.7327,
-  0.281900, 0.7413,
-  // f 66/146 68/148 70/150 74/154
-  0.281900, 0.7413,
-  0.286600, 0.7491,
-  0.294900, 0.754,
-  // f 66/146 68/148 70/150 74/154
-  0.281900, 0.7413,
-  0.312700, 0.7504,
-  0.294900, 0.754,
-  // f 70/150 72/152 74/154
-  0.294900, 0.754,
-  0.304500, 0.7544,
-  0.312700, 0.7504,
-  // f 58/138 66/146 74/154
-  0.304300, 0.722,
-  0.281900, 0.7413,
-  0.312700, 0.7504,
-  // f 54/134 53/133 74/154
-  0.317300, 0.7432,
-  0.317400, 0.7346,
-  0.312700, 0.7504,
-  // f 86/155 87/156 88/157 89/158
-  0.753300, 0.6098,
-  0.720700, 0.5999,
-  0.721100, 0.6059,
-  // f 86/155 87/156 88/157 89/158
-  0.753300, 0.6098,
-  0.754400, 0.6117,
-  0.721100, 0.6059,
-  // f 88/157 90/159 91/160 89/158
-  0.721100, 0.6059,
-  0.719600, 0.7024,
-  0.752700, 0.7022,
-  // f 88/157 90/159 91/160 89/158
-  0.721100, 0.6059,
-  0.754400, 0.6117,
-  0.752700, 0.7022,
-  // f 91/160 90/159 92/161 93/162
-  0.752700, 0.7022,
-  0.719600, 0.7024,
-  0.719000, 0.709,
-  // f 91/160 90/159 92/161 93/162
-  0.752700, 0.7022,
-  0.752600, 0.7028,
-  0.719000, 0.709,
-  // f 78/12 79/11 39/163 3/164
-  0.761700, 0.7815,
-  0.752200, 0.7819,
-  0.751800, 0.8519,
-  // f 78/12 79/11 39/163 3/164
-  0.761700, 0.7815,
-  0.762800, 0.8592,
-  0.751800, 0.8519,
-  // f 79/11 80/14 5/165 39/163
-  0.752200, 0.7819,
-  0.679500, 0.7565,
-  0.677800, 0.8023,
-  // f 79/11 80/14 5/165 39/163
-  0.752200, 0.7819,
-  0.751800, 0.8519,
-  0.677800, 0.8023,
-  // f 80/14 81/16 6/166 5/165
-  0.679500, 0.7565,
-  0.608600, 0.7341,
-  0.604800, 0.7648,
-  // f 80/14 81/16 6/166 5/165
-  0.679500, 0.7565,
-  0.677800, 0.8023,
-  0.604800, 0.7648,
-  // f 81/16 82/17 37/167 6/166
-  0.608600, 0.7341,
-  0.572600, 0.7293,
-  0.570800, 0.754,
-  // f 81/16 82/17 37/167 6/166
-  0.608600, 0.7341,
-  0.604800, 0.7648,
-  0.570800, 0.754,
-  // f 84/22 83/21 29/168 32/169
-  0.438900, 0.7313,
-  0.368500, 0.754,
-  0.370700, 0.7999,
-  // f 84/22 83/21 29/168 32/169
-  0.438900, 0.7313,
-  0.442400, 0.762,
-  0.370700, 0.7999,
-  // f 83/21 85/24 46/170 29/168
-  0.368500, 0.754,
-  0.296700, 0.7804,
-  0.297700, 0.8545,
-  // f 83/21 85/24 46/170 29/168
-  0.368500, 0.754,
-  0.370700, 0.7999,
-  0.297700, 0.8545,
-  // f 85/24 76/26 4/171 46/170
-  0.296700, 0.7804,
-  0.288100, 0.7804,
-  0.288200, 0.861,
-  // f 85/24 76/26 4/171 46/170
-  0.296700, 0.7804,
-  0.297700, 0.8545,
-  0.288200, 0.861,
-  // f 4/84 3/83 94/172 95/173
-  0.481700, 0.5738,
-  0.482900, 0.6474,
-  0.488600, 0.6438,
-  // f 4/84 3/83 94/172 95/173
-  0.481700, 0.5738,
-  0.488000, 0.5768,
-  0.488600, 0.6438,
-  // f 3/83 8/88 96/174 94/172
-  0.482900, 0.6474,
-  0.543600, 0.6699,
-  0.543700, 0.6665,
-  // f 3/83 8/88 96/174 94/172
-  0.482900, 0.6474,
-  0.488600, 0.6438,
-  0.543700, 0.6665,
-  // f 8/88 7/87 97/175 96/174
-  0.543600, 0.6699,
-  0.601500, 0.6736,
-  0.602800, 0.669,
-  // f 8/88 7/87 97/175 96/174
-  0.543600, 0.6699,
-  0.543700, 0.6665,
-  0.602800, 0.669,
-  // f 7/87 38/118 98/176 97/175
-  0.601500, 0.6736,
-  0.627800, 0.6733,
-  0.628400, 0.6676,
-  // f 7/87 38/118 98/176 97/175
-  0.601500, 0.6736,
-  0.602800, 0.669,
-  0.628400, 0.6676,
-  // f 31/111 30/110 99/177 100/178
-  0.601700, 0.5475,
-  0.544000, 0.551,
-  0.544100, 0.5544,
-  // f 31/111 30/110 99/177 100/178
-  0.601700, 0.5475,
-  0.602900, 0.552,
-  0.544100, 0.5544,
-  // f 30/110 4/84 95/173 99/177
-  0.544000, 0.551,
-  0.481700, 0.5738,
-  0.488000, 0.5768,
-  // f 30/110 4/84 95/173 99/177
-  0.544000, 0.551,
-  0.544100, 0.5544,
-  0.488000, 0.5768,
-  // f 95/173 94/172 43/123 42/122
-  0.488000, 0.5768,
-  0.488600, 0.6438,
-  0.509400, 0.6436,
-  // f 95/173 94/172 43/123 42/122
-  0.488000, 0.5768,
-  0.509800, 0.5769,
-  0.509400, 0.6436,
-  // f 43/123 94/172 96/174 26/106
-  0.509400, 0.6436,
-  0.488600, 0.6438,
-  0.543700, 0.6665,
-  // f 43/123 94/172 96/174 26/106
-  0.509400, 0.6436,
-  0.558500, 0.6355,
-  0.543700, 0.6665,
-  // f 96/174 97/175 27/107 26/106
-  0.543700, 0.6665,
-  0.602800, 0.669,
-  0.601900, 0.6425,
-  // f 96/174 97/175 27/107 26/106
-  0.543700, 0.6665,
-  0.558500, 0.6355,
-  0.601900, 0.6425,
-  // f 27/107 97/175 98/176 44/124
-  0.601900, 0.6425,
-  0.602800, 0.669,
-  0.628400, 0.6676,
-  // f 27/107 97/175 98/176 44/124
-  0.601900, 0.6425,
-  0.628000, 0.6429,
-  0.628400, 0.6676,
-  // f 100/178 99/177 25/105 28/108
-  0.602900, 0.552,
-  0.544100, 0.5544,
-  0.558800, 0.5855,
-  // f 100/178 99/177 25/105 28/108
-  0.602900, 0.552,
-  0.602100, 0.5784,
-  0.558800, 0.5855,
-  // f 99/177 95/173 42/122 25/105
-  0.544100, 0.5544,
-  0.488000, 0.5768,
-  0.509800, 0.5769,
-  // f 99/177 95/173 42/122 25/105
-  0.544100, 0.5544,
-  0.558800, 0.5855,
-  0.509800, 0.5769,
-  // f 76/4 75/3 101/179 102/180
-  0.714100, 0.5672,
-  0.703400, 0.5873,
-  0.709700, 0.5891,
-  // f 76/4 75/3 101/179 102/180
-  0.714100, 0.5672,
-  0.721900, 0.5786,
-  0.709700, 0.5891,
-  // f 75/3 77/6 103/181 101/179
-  0.703400, 0.5873,
-  0.702300, 0.7253,
-  0.708700, 0.7238,
-  // f 75/3 77/6 103/181 101/179
-  0.703400, 0.5873,
-  0.709700, 0.5891,
-  0.708700, 0.7238,
-  // f 77/6 78/8 104/182 103/181
-  0.702300, 0.7253,
-  0.710800, 0.744,
-  0.719200, 0.733,
-  // f 77/6 78/8 104/182 103/181
-  0.702300, 0.7253,
-  0.708700, 0.7238,
-  0.719200, 0.733,
-  // f 78/8 3/183 105/184 104/182
-  0.710800, 0.744,
-  0.816800, 0.7326,
-  0.779500, 0.72,
-  // f 78/8 3/183 105/184 104/182
-  0.710800, 0.744,
-  0.719200, 0.733,
-  0.779500, 0.72,
-  // f 3/183 2/185 106/186 105/184
-  0.816800, 0.7326,
-  0.816000, 0.7136,
-  0.787200, 0.7094,
-  // f 3/183 2/185 106/186 105/184
-  0.816800, 0.7326,
-  0.779500, 0.72,
-  0.787200, 0.7094,
-  // f 2/185 1/187 107/188 106/186
-  0.816000, 0.7136,
-  0.820000, 0.604,
-  0.789300, 0.6067,
-  // f 2/185 1/187 107/188 106/186
-  0.816000, 0.7136,
-  0.787200, 0.7094,
-  0.789300, 0.6067,
-  // f 1/187 4/189 108/190 107/188
-  0.820000, 0.604,
-  0.823100, 0.5856,
-  0.781800, 0.5945,
-  // f 1/187 4/189 108/190 107/188
-  0.820000, 0.604,
-  0.789300, 0.6067,
-  0.781800, 0.5945,
-  // f 4/189 76/4 102/180 108/190
-  0.823100, 0.5856,
-  0.714100, 0.5672,
-  0.721900, 0.5786,
-  // f 4/189 76/4 102/180 108/190
-  0.823100, 0.5856,
-  0.781800, 0.5945,
-  0.721900, 0.5786,
-  // f 87/156 102/180 101/179 88/157
-  0.720700, 0.5999,
-  0.721900, 0.5786,
-  0.709700, 0.5891,
-  // f 87/156 102/180 101/179 88/157
-  0.720700, 0.5999,
-  0.721100, 0.6059,
-  0.709700, 0.5891,
-  // f 101/179 103/181 90/159 88/157
-  0.709700, 0.5891,
-  0.708700, 0.7238,
-  0.719600, 0.7024,
-  // f 101/179 103/181 90/159 88/157
-  0.709700, 0.5891,
-  0.721100, 0.6059,
-  0.719600, 0.7024,
-  // f 90/159 103/181 104/182 92/161
-  0.719600, 0.7024,
-  0.708700, 0.7238,
-  0.719200, 0.733,
-  // f 90/159 103/181 104/182 92/161
-  0.719600, 0.7024,
-  0.719000, 0.709,
-  0.719200, 0.733,
-  // f 104/182 105/184 93/162 92/161
-  0.719200, 0.733,
-  0.779500, 0.72,
-  0.752600, 0.7028,
-  // f 104/182 105/184 93/162 92/161
-  0.719200, 0.733,
-  0.719000, 0.709,
-  0.752600, 0.7028,
-  // f 105/184 106/186 91/160 93/162
-  0.779500, 0.72,
-  0.787200, 0.7094,
-  0.752700, 0.7022,
-  // f 105/184 106/186 91/160 93/162
-  0.779500, 0.72,
-  0.752600, 0.7028,
-  0.752700, 0.7022,
-  // f 106/186 107/188 89/158 91/160
-  0.787200, 0.7094,
-  0.789300, 0.6067,
-  0.754400, 0.6117,
-  // f 106/186 107/188 89/158 91/160
-  0.787200, 0.7094,
-  0.752700, 0.7022,
-  0.754400, 0.6117,
-  // f 107/188 108/190 86/155 89/158
-  0.789300, 0.6067,
-  0.781800, 0.5945,
-  0.753300, 0.6098,
-  // f 107/188 108/190 86/155 89/158
-  0.789300, 0.6067,
-  0.754400, 0.6117,
-  0.753300, 0.6098,
-  // f 108/190 102/180 87/156 86/155
-  0.781800, 0.5945,
-  0.721900, 0.5786,
-  0.720700, 0.5999,
-  // f 108/190 102/180 87/156 86/155
-  0.781800, 0.5945,
-  0.753300, 0.6098,
-  0.720700, 0.5999,
-  // f 109/191 110/192 111/193 112/194
-  0.054900, 0.5128,
-  0.082000, 0.51,
-  0.077400, 0.4686,
-  // f 109/191 110/192 111/193 112/194
-  0.054900, 0.5128,
-  0.050600, 0.4623,
-  0.077400, 0.4686,
-  // f 113/195 114/196 115/197 116/198
-  0.087000, 0.6065,
-  0.079600, 0.5722,
-  0.052300, 0.5709,
-  // f 113/195 114/196 115/197 116/198
-  0.087000, 0.6065,
-  0.063100, 0.6142,
-  0.052300, 0.5709,
-  // f 117/199 113/195 116/198 118/200
-  0.093400, 0.6546,
-  0.087000, 0.6065,
-  0.063100, 0.6142,
-  // f 117/199 113/195 116/198 118/200
-  0.093400, 0.6546,
-  0.070700, 0.6562,
-  0.063100, 0.6142,
-  // f 119/201 120/202 121/203 122/204
-  0.085800, 0.4166,
-  0.101000, 0.3743,
-  0.079500, 0.3651,
-  // f 119/201 120/202 121/203 122/204
-  0.085800, 0.4166,
-  0.064600, 0.4066,
-  0.079500, 0.3651,
-  // f 123/205 119/201 122/204 124/206
-  0.077300, 0.4493,
-  0.085800, 0.4166,
-  0.064600, 0.4066,
-  // f 123/205 119/201 122/204 124/206
-  0.077300, 0.4493,
-  0.050700, 0.4497,
-  0.064600, 0.4066,
-  // f 125/207 126/208 127/209 128/210
-  0.684700, 0.0686,
-  0.677200, 0.0446,
-  0.649700, 0.0693,
-  // f 125/207 126/208 127/209 128/210
-  0.684700, 0.0686,
-  0.660700, 0.0881,
-  0.649700, 0.0693,
-  // f 129/211 130/212 131/213 132/214
-  0.683700, 0.0409,
-  0.695200, 0.0629,
-  0.725700, 0.0564,
-  // f 129/211 130/212 131/213 132/214
-  0.683700, 0.0409,
-  0.725000, 0.0357,
-  0.725700, 0.0564,
-  // f 132/214 131/213 133/215 134/216
-  0.725000, 0.0357,
-  0.725700, 0.0564,
-  0.773700, 0.0528,
-  // f 132/214 131/213 133/215 134/216
-  0.725000, 0.0357,
-  0.778000, 0.027,
-  0.773700, 0.0528,
-  // f 135/217 136/218 137/219 138/220
-  0.585000, 0.1917,
-  0.566200, 0.1841,
-  0.552400, 0.2176,
-  // f 135/217 136/218 137/219 138/220
-  0.585000, 0.1917,
-  0.573600, 0.225,
-  0.552400, 0.2176,
-  // f 136/218 135/217 139/221 140/222
-  0.566200, 0.1841,
-  0.585000, 0.1917,
-  0.611900, 0.1437,
-  // f 136/218 135/217 139/221 140/222
-  0.566200, 0.1841,
-  0.592700, 0.1371,
-  0.611900, 0.1437,
-  // f 140/222 139/221 141/223 142/224
-  0.592700, 0.1371,
-  0.611900, 0.1437,
-  0.628800, 0.1143,
-  // f 140/222 139/221 141/223 142/224
-  0.592700, 0.1371,
-  0.607800, 0.0967,
-  0.628800, 0.1143,
-  // f 143/225 144/226 145/227 146/228
-  0.048200, 0.513,
-  0.028800, 0.5135,
-  0.028800, 0.5607,
-  // f 143/225 144/226 145/227 146/228
-  0.048200, 0.513,
-  0.045400, 0.5597,
-  0.028800, 0.5607,
-  // f 110/229 128/210 147/230 111/231
-  0.676200, 0.1083,
-  0.660700, 0.0881,
-  0.634800, 0.1062,
-  // f 110/229 128/210 147/230 111/231
-  0.676200, 0.1083,
-  0.651900, 0.1259,
-  0.634800, 0.1062,
-  // f 148/232 149/233 150/234 151/235
-  0.027200, 0.5715,
-  0.031700, 0.6227,
-  0.055400, 0.6173,
-  // f 148/232 149/233 150/234 151/235
-  0.027200, 0.5715,
-  0.045900, 0.572,
-  0.055400, 0.6173,
-  // f 131/213 130/212 114/236 113/237
-  0.725700, 0.0564,
-  0.695200, 0.0629,
-  0.706700, 0.0854,
-  // f 131/213 130/212 114/236 113/237
-  0.725700, 0.0564,
-  0.732000, 0.0806,
-  0.706700, 0.0854,
-  // f 149/233 152/66 153/65 150/234
-  0.031700, 0.6227,
-  0.049900, 0.6832,
-  0.067100, 0.659,
-  // f 149/233 152/66 153/65 150/234
-  0.031700, 0.6227,
-  0.055400, 0.6173,
-  0.067100, 0.659,
-  // f 133/215 131/213 113/237 117/238
-  0.773700, 0.0528,
-  0.725700, 0.0564,
-  0.732000, 0.0806,
-  // f 133/215 131/213 113/237 117/238
-  0.773700, 0.0528,
-  0.772400, 0.0722,
-  0.732000, 0.0806,
-  // f 154/239 155/240 156/241 157/242
-  0.094000, 0.3273,
-  0.078700, 0.3087,
-  0.055200, 0.3398,
-  // f 154/239 155/240 156/241 157/242
-  0.094000, 0.3273,
-  0.074200, 0.3609,
-  0.055200, 0.3398,
-  // f 156/241 158/243 159/244 157/242
-  0.055200, 0.3398,
-  0.034500, 0.396,
-  0.057900, 0.4031,
-  // f 156/241 158/243 159/244 157/242
-  0.055200, 0.3398,
-  0.074200, 0.3609,
-  0.057900, 0.4031,
-  // f 139/221 135/217 120/245 119/246
-  0.611900, 0.1437,
-  0.585000, 0.1917,
-  0.613300, 0.1938,
-  // f 139/221 135/217 120/245 119/246
-  0.611900, 0.1437,
-  0.633900, 0.1566,
-  0.613300, 0.1938,
-  // f 158/243 160/247 161/248 159/244
-  0.034500, 0.396,
-  0.024300, 0.4484,
-  0.044800, 0.4487,
-  // f 158/243 160/247 161/248 159/244
-  0.034500, 0.396,
-  0.057900, 0.4031,
-  0.044800, 0.4487,
-  // f 141/223 139/221 119/246 123/249
-  0.628800, 0.1143,
-  0.611900, 0.1437,
-  0.633900, 0.1566,
-  // f 141/223 139/221 119/246 123/249
-  0.628800, 0.1143,
-  0.646600, 0.1326,
-  0.633900, 0.1566,
-  // f 109/191 162/250 163/251 110/192
-  0.054900, 0.5128,
-  0.052000, 0.5576,
-  0.080300, 0.5521,
-  // f 109/191 162/250 163/251 110/192
-  0.054900, 0.5128,
-  0.082000, 0.51,
-  0.080300, 0.5521,
-  // f 127/209 164/252 147/230 128/210
-  0.649700, 0.0693,
-  0.613500, 0.092,
-  0.634800, 0.1062,
-  // f 127/209 164/252 147/230 128/210
-  0.649700, 0.0693,
-  0.660700, 0.0881,
-  0.634800, 0.1062,
-  // f 165/253 166/254 144/226 143/225
-  0.043900, 0.4606,
-  0.025400, 0.459,
-  0.028800, 0.5135,
-  // f 165/253 166/254 144/226 143/225
-  0.043900, 0.4606,
-  0.048200, 0.513,
-  0.028800, 0.5135,
-  // f 163/255 125/207 128/210 110/229
-  0.699700, 0.0894,
-  0.684700, 0.0686,
-  0.660700, 0.0881,
-  // f 163/255 125/207 128/210 110/229
-  0.699700, 0.0894,
-  0.676200, 0.1083,
-  0.660700, 0.0881,
-  // f 112/194 165/253 143/225 109/191
-  0.050600, 0.4623,
-  0.043900, 0.4606,
-  0.048200, 0.513,
-  // f 112/194 165/253 143/225 109/191
-  0.050600, 0.4623,
-  0.054900, 0.5128,
-  0.048200, 0.513,
-  // f 115/197 151/235 150/234 116/198
-  0.052300, 0.5709,
-  0.045900, 0.572,
-  0.055400, 0.6173,
-  // f 115/197 151/235 150/234 116/198
-  0.052300, 0.5709,
-  0.063100, 0.6142,
-  0.055400, 0.6173,
-  // f 116/198 150/234 153/65 118/200
-  0.063100, 0.6142,
-  0.055400, 0.6173,
-  0.067100, 0.659,
-  // f 116/198 150/234 153/65 118/200
-  0.063100, 0.6142,
-  0.070700, 0.6562,
-  0.067100, 0.659,
-  // f 121/203 157/242 159/244 122/204
-  0.079500, 0.3651,
-  0.074200, 0.3609,
-  0.057900, 0.4031,
-  // f 121/203 157/242 159/244 122/204
-  0.079500, 0.3651,
-  0.064600, 0.4066,
-  0.057900, 0.4031,
-  // f 122/204 159/244 161/248 124/206
-  0.064600, 0.4066,
-  0.057900, 0.4031,
-  0.044800, 0.4487,
-  // f 122/204 159/244 161/248 124/206
-  0.064600, 0.4066,
-  0.050700, 0.4497,
-  0.044800, 0.4487,
-  // f 126/208 145/256 144/257 127/209
-  0.677200, 0.0446,
-  0.676300, 0.0382,
-  0.648700, 0.0672,
-  // f 126/208 145/256 144/257 127/209
-  0.677200, 0.0446,
-  0.649700, 0.0693,
-  0.648700, 0.0672,
-  // f 132/214 149/258 148/259 129/211
-  0.725000, 0.0357,
-  0.725100, 0.0317,
-  0.681500, 0.0351,
-  // f 132/214 149/258 148/259 129/211
-  0.725000, 0.0357,
-  0.683700, 0.0409,
-  0.681500, 0.0351,
-  // f 134/216 152/260 149/258 132/214
-  0.778000, 0.027,
-  0.779600, 0.023,
-  0.725100, 0.0317,
-  // f 134/216 152/260 149/258 132/214
-  0.778000, 0.027,
-  0.725000, 0.0357,
-  0.725100, 0.0317,
-  // f 136/218 156/261 155/262 137/219
-  0.566200, 0.1841,
-  0.562300, 0.1827,
-  0.548700, 0.2158,
-  // f 136/218 156/261 155/262 137/219
-  0.566200, 0.1841,
-  0.552400, 0.2176,
-  0.548700, 0.2158,
-  // f 140/222 158/263 156/261 136/218
-  0.592700, 0.1371,
-  0.589200, 0.136,
-  0.562300, 0.1827,
-  // f 140/222 158/263 156/261 136/218
-  0.592700, 0.1371,
-  0.566200, 0.1841,
-  0.562300, 0.1827,
-  // f 142/224 160/264 158/263 140/222
-  0.607800, 0.0967,
-  0.603600, 0.0928,
-  0.589200, 0.136,
-  // f 142/224 160/264 158/263 140/222
-  0.607800, 0.0967,
-  0.592700, 0.1371,
-  0.589200, 0.136,
-  // f 109/191 143/225 146/228 162/250
-  0.054900, 0.5128,
-  0.048200, 0.513,
-  0.045400, 0.5597,
-  // f 109/191 143/225 146/228 162/250
-  0.054900, 0.5128,
-  0.052000, 0.5576,
-  0.045400, 0.5597,
-  // f 127/209 144/257 166/265 164/252
-  0.649700, 0.0693,
-  0.648700, 0.0672,
-  0.608000, 0.0893,
-  // f 127/209 144/257 166/265 164/252
-  0.649700, 0.0693,
-  0.613500, 0.092,
-  0.608000, 0.0893,
-  // f 162/250 115/197 114/196 163/251
-  0.052000, 0.5576,
-  0.052300, 0.5709,
-  0.079600, 0.5722,
-  // f 162/250 115/197 114/196 163/251
-  0.052000, 0.5576,
-  0.080300, 0.5521,
-  0.079600, 0.5722,
-  // f 111/193 123/205 124/206 112/194
-  0.077400, 0.4686,
-  0.077300, 0.4493,
-  0.050700, 0.4497,
-  // f 111/193 123/205 124/206 112/194
-  0.077400, 0.4686,
-  0.050600, 0.4623,
-  0.050700, 0.4497,
-  // f 125/207 130/212 129/211 126/208
-  0.684700, 0.0686,
-  0.695200, 0.0629,
-  0.683700, 0.0409,
-  // f 125/207 130/212 129/211 126/208
-  0.684700, 0.0686,
-  0.677200, 0.0446,
-  0.683700, 0.0409,
-  // f 164/252 142/224 141/223 147/230
-  0.613500, 0.092,
-  0.607800, 0.0967,
-  0.628800, 0.1143,
-  // f 164/252 142/224 141/223 147/230
-  0.613500, 0.092,
-  0.634800, 0.1062,
-  0.628800, 0.1143,
-  // f 165/253 161/248 160/247 166/254
-  0.043900, 0.4606,
-  0.044800, 0.4487,
-  0.024300, 0.4484,
-  // f 165/253 161/248 160/247 166/254
-  0.043900, 0.4606,
-  0.025400, 0.459,
-  0.024300, 0.4484,
-  // f 145/227 148/232 151/235 146/228
-  0.028800, 0.5607,
-  0.027200, 0.5715,
-  0.045900, 0.572,
-  // f 145/227 148/232 151/235 146/228
-  0.028800, 0.5607,
-  0.045400, 0.5597,
-  0.045900, 0.572,
-  // f 163/255 114/236 130/212 125/207
-  0.699700, 0.0894,
-  0.706700, 0.0854,
-  0.695200, 0.0629,
-  // f 163/255 114/236 130/212 125/207
-  0.699700, 0.0894,
-  0.684700, 0.0686,
-  0.695200, 0.0629,
-  // f 147/230 141/223 123/249 111/231
-  0.634800, 0.1062,
-  0.628800, 0.1143,
-  0.646600, 0.1326,
-  // f 147/230 141/223 123/249 111/231
-  0.634800, 0.1062,
-  0.651900, 0.1259,
-  0.646600, 0.1326,
-  // f 161/248 165/253 112/194 124/206
-  0.044800, 0.4487,
-  0.043900, 0.4606,
-  0.050600, 0.4623,
-  // f 161/248 165/253 112/194 124/206
-  0.044800, 0.4487,
-  0.050700, 0.4497,
-  0.050600, 0.4623,
-  // f 146/228 151/235 115/197 162/250
-  0.045400, 0.5597,
-  0.045900, 0.572,
-  0.052300, 0.5709,
-  // f 146/228 151/235 115/197 162/250
-  0.045400, 0.5597,
-  0.052000, 0.5576,
-  0.052300, 0.5709,
-  // f 142/224 164/252 166/265 160/264
-  0.607800, 0.0967,
-  0.613500, 0.092,
-  0.608000, 0.0893,
-  // f 142/224 164/252 166/265 160/264
-  0.607800, 0.0967,
-  0.603600, 0.0928,
-  0.608000, 0.0893,
-  // f 126/208 129/211 148/259 145/256
-  0.677200, 0.0446,
-  0.683700, 0.0409,
-  0.681500, 0.0351,
-  // f 126/208 129/211 148/259 145/256
-  0.677200, 0.0446,
-  0.676300, 0.0382,
-  0.681500, 0.0351,
-  // f 167/266 168/267 169/268 170/269
-  0.757500, 0.3852,
-  0.731000, 0.3852,
-  0.721800, 0.3787,
-  // f 167/266 168/267 169/268 170/269
-  0.757500, 0.3852,
-  0.751200, 0.3787,
-  0.721800, 0.3787,
-  // f 168/267 171/270 172/271 169/268
-  0.731000, 0.3852,
-  0.706000, 0.3942,
-  0.694100, 0.3887,
-  // f 168/267 171/270 172/271 169/268
-  0.731000, 0.3852,
-  0.721800, 0.3787,
-  0.694100, 0.3887,
-  // f 171/270 173/272 174/273 172/271
-  0.706000, 0.3942,
-  0.685700, 0.411,
-  0.671500, 0.4075,
-  // f 171/270 173/272 174/273 172/271
-  0.706000, 0.3942,
-  0.694100, 0.3887,
-  0.671500, 0.4075,
-  // f 173/272 175/274 176/275 174/273
-  0.685700, 0.411,
-  0.672400, 0.4338,
-  0.656800, 0.4327,
-  // f 173/272 175/274 176/275 174/273
-  0.685700, 0.411,
-  0.671500, 0.4075,
-  0.656800, 0.4327,
-  // f 175/274 177/276 178/277 176/275
-  0.672400, 0.4338,
-  0.667800, 0.4597,
-  0.651700, 0.4615,
-  // f 175/274 177/276 178/277 176/275
-  0.672400, 0.4338,
-  0.656800, 0.4327,
-  0.651700, 0.4615,
-  // f 177/276 179/278 180/279 178/277
-  0.667800, 0.4597,
-  0.672400, 0.4856,
-  0.656800, 0.4902,
-  // f 177/276 179/278 180/279 178/277
-  0.667800, 0.4597,
-  0.651700, 0.4615,
-  0.656800, 0.4902,
-  // f 179/278 181/280 182/281 180/279
-  0.672400, 0.4856,
-  0.685700, 0.5084,
-  0.671500, 0.5155,
-  // f 179/278 181/280 182/281 180/279
-  0.672400, 0.4856,
-  0.656800, 0.4902,
-  0.671500, 0.5155,
-  // f 181/280 183/282 184/283 182/281
-  0.685700, 0.5084,
-  0.706000, 0.5253,
-  0.694100, 0.5343,
-  // f 181/280 183/282 184/283 182/281
-  0.685700, 0.5084,
-  0.671500, 0.5155,
-  0.694100, 0.5343,
-  // f 183/282 185/284 186/285 184/283
-  0.706000, 0.5253,
-  0.731000, 0.5343,
-  0.721800, 0.5442,
-  // f 183/282 185/284 186/285 184/283
-  0.706000, 0.5253,
-  0.694100, 0.5343,
-  0.721800, 0.5442,
-  // f 185/284 187/286 188/287 186/285
-  0.731000, 0.5343,
-  0.757500, 0.5343,
-  0.751200, 0.5442,
-  // f 185/284 187/286 188/287 186/285
-  0.731000, 0.5343,
-  0.721800, 0.5442,
-  0.751200, 0.5442,
-  // f 187/286 189/288 190/289 188/287
-  0.757500, 0.5343,
-  0.782500, 0.5253,
-  0.778900, 0.5343,
-  // f 187/286 189/288 190/289 188/287
-  0.757500, 0.5343,
-  0.751200, 0.5442,
-  0.778900, 0.5343,
-  // f 189/288 191/290 192/291 190/289
-  0.782500, 0.5253,
-  0.804600, 0.5099,
-  0.803500, 0.5173,
-  // f 189/288 191/290 192/291 190/289
-  0.782500, 0.5253,
-  0.778900, 0.5343,
-  0.803500, 0.5173,
-  // f 193/292 194/293 192/291 191/290
-  0.822100, 0.4945,
-  0.822900, 0.5001,
-  0.803500, 0.5173,
-  // f 193/292 194/293 192/291 191/290
-  0.822100, 0.4945,
-  0.804600, 0.5099,
-  0.803500, 0.5173,
-  // f 195/294 196/295 197/296 198/297
-  0.298500, 0.3785,
-  0.292900, 0.3698,
-  0.284200, 0.3633,
-  // f 195/294 196/295 197/296 198/297
-  0.298500, 0.3785,
-  0.298500, 0.3982,
-  0.284200, 0.3633,
-  // f 197/296 199/298 200/299 201/300
-  0.284200, 0.3633,
-  0.273500, 0.3598,
-  0.262000, 0.3598,
-  // f 197/296 199/298 200/299 201/300
-  0.284200, 0.3633,
-  0.242600, 0.3698,
-  0.262000, 0.3598,
-  // f 200/299 202/301 201/300
-  0.262000, 0.3598,
-  0.251300, 0.3633,
-  0.242600, 0.3698,
-  // f 201/300 203/302 204/303 205/304
-  0.242600, 0.3698,
-  0.237000, 0.3785,
-  0.235100, 0.3883,
-  // f 201/300 203/302 204/303 205/304
-  0.242600, 0.3698,
-  0.242600, 0.4069,
-  0.235100, 0.3883,
-  // f 204/303 206/305 205/304
-  0.235100, 0.3883,
-  0.237000, 0.3982,
-  0.242600, 0.4069,
-  // f 205/304 207/306 208/307 209/308
-  0.242600, 0.4069,
-  0.251300, 0.4134,
-  0.262000, 0.4169,
-  // f 205/304 207/306 208/307 209/308
-  0.242600, 0.4069,
-  0.284200, 0.4134,
-  0.262000, 0.4169,
-  // f 208/307 210/309 209/308
-  0.262000, 0.4169,
-  0.273500, 0.4169,
-  0.284200, 0.4134,
-  // f 201/300 205/304 209/308 197/296
-  0.242600, 0.3698,
-  0.242600, 0.4069,
-  0.284200, 0.4134,
-  // f 201/300 205/304 209/308 197/296
-  0.242600, 0.3698,
-  0.284200, 0.3633,
-  0.284200, 0.4134,
-  // f 209/308 211/310 198/297 197/296
-  0.284200, 0.4134,
-  0.292900, 0.4069,
-  0.298500, 0.3982,
-  // f 209/308 211/310 198/297 197/296
-  0.284200, 0.4134,
-  0.284200, 0.3633,
-  0.298500, 0.3982,
-  // f 212/311 195/294 198/297
-  0.300500, 0.3883,
-  0.298500, 0.3785,
-  0.298500, 0.3982,
-  // f 170/269 169/268 213/312 214/313
-  0.751200, 0.3787,
-  0.721800, 0.3787,
-  0.734600, 0.3991,
-  // f 170/269 169/268 213/312 214/313
-  0.751200, 0.3787,
-  0.753900, 0.3991,
-  0.734600, 0.3991,
-  // f 169/268 172/271 215/314 213/312
-  0.721800, 0.3787,
-  0.694100, 0.3887,
-  0.716300, 0.4057,
-  // f 169/268 172/271 215/314 213/312
-  0.721800, 0.3787,
-  0.734600, 0.3991,
-  0.716300, 0.4057,
-  // f 172/271 174/273 216/315 215/314
-  0.694100, 0.3887,
-  0.671500, 0.4075,
-  0.701500, 0.418,
-  // f 172/271 174/273 216/315 215/314
-  0.694100, 0.3887,
-  0.716300, 0.4057,
-  0.701500, 0.418,
-  // f 174/273 176/275 217/316 216/315
-  0.671500, 0.4075,
-  0.656800, 0.4327,
-  0.691800, 0.4346,
-  // f 174/273 176/275 217/316 216/315
-  0.671500, 0.4075,
-  0.701500, 0.418,
-  0.691800, 0.4346,
-  // f 176/275 178/277 218/317 217/316
-  0.656800, 0.4327,
-  0.651700, 0.4615,
-  0.688400, 0.4535,
-  // f 176/275 178/277 218/317 217/316
-  0.656800, 0.4327,
-  0.691800, 0.4346,
-  0.688400, 0.4535,
-  // f 178/277 180/279 219/318 218/317
-  0.651700, 0.4615,
-  0.656800, 0.4902,
-  0.691800, 0.4724,
-  // f 178/277 180/279 219/318 218/317
-  0.651700, 0.4615,
-  0.688400, 0.4535,
-  0.691800, 0.4724,
-  // f 180/279 182/281 220/319 219/318
-  0.656800, 0.4902,
-  0.671500, 0.5155,
-  0.701500, 0.4891,
-  // f 180/279 182/281 220/319 219/318
-  0.656800, 0.4902,
-  0.691800, 0.4724,
-  0.701500, 0.4891,
-  // f 182/281 184/283 221/320 220/319
-  0.671500, 0.5155,
-  0.694100, 0.5343,
-  0.716300, 0.5014,
-  // f 182/281 184/283 221/320 220/319
-  0.671500, 0.5155,
-  0.701500, 0.4891,
-  0.716300, 0.5014,
-  // f 184/283 186/285 222/321 221/320
-  0.694100, 0.5343,
-  0.721800, 0.5442,
-  0.734600, 0.508,
-  // f 184/283 186/285 222/321 221/320
-  0.694100, 0.5343,
-  0.716300, 0.5014,
-  0.734600, 0.508,
-  // f 186/285 188/287 223/322 222/321
-  0.721800, 0.5442,
-  0.751200, 0.5442,
-  0.753900, 0.508,
-  // f 186/285 188/287 223/322 222/321
-  0.721800, 0.5442,
-  0.734600, 0.508,
-  0.753900, 0.508,
-  // f 188/287 190/289 224/323 223/322
-  0.751200, 0.5442,
-  0.778900, 0.5343,
-  0.772200, 0.5014,
-  // f 188/287 190/289 224/323 223/322
-  0.751200, 0.5442,
-  0.753900, 0.508,
-  0.772200, 0.5014,
-  // f 190/289 192/291 225/324 224/323
-  0.778900, 0.5343,
-  0.803500, 0.5173,
-  0.787000, 0.4891,
-  // f 190/289 192/291 225/324 224/323
-  0.778900, 0.5343,
-  0.772200, 0.5014,
-  0.787000, 0.4891,
-  // f 194/293 226/325 227/326 225/324
-  0.822900, 0.5001,
-  0.822100, 0.486,
-  0.796700, 0.4724,
-  // f 194/293 226/325 227/326 225/324
-  0.822900, 0.5001,
-  0.787000, 0.4891,
-  0.796700, 0.4724,
-  // f 192/291 194/293 225/324
-  0.803500, 0.5173,
-  0.822900, 0.5001,
-  0.787000, 0.4891,
-  // f 228/327 229/328 195/294 212/311
-  0.303400, 0.3883,
-  0.301200, 0.377,
-  0.298500, 0.3785,
-  // f 228/327 229/328 195/294 212/311
-  0.303400, 0.3883,
-  0.300500, 0.3883,
-  0.298500, 0.3785,
-  // f 229/328 230/329 196/295 195/294
-  0.301200, 0.377,
-  0.295000, 0.3672,
-  0.292900, 0.3698,
-  // f 229/328 230/329 196/295 195/294
-  0.301200, 0.377,
-  0.298500, 0.3785,
-  0.292900, 0.3698,
-  // f 230/329 231/330 197/296 196/295
-  0.295000, 0.3672,
-  0.285500, 0.3599,
-  0.284200, 0.3633,
-  // f 230/329 231/330 197/296 196/295
-  0.295000, 0.3672,
-  0.292900, 0.3698,
-  0.284200, 0.3633,
-  // f 231/330 214/331 199/298 197/296
-  0.285500, 0.3599,
-  0.273900, 0.3561,
-  0.273500, 0.3598,
-  // f 231/330 214/331 199/298 197/296
-  0.285500, 0.3599,
-  0.284200, 0.3633,
-  0.273500, 0.3598,
-  // f 214/331 213/332 200/299 199/298
-  0.273900, 0.3561,
-  0.261600, 0.3561,
-  0.262000, 0.3598,
-  // f 214/331 213/332 200/299 199/298
-  0.273900, 0.3561,
-  0.273500, 0.3598,
-  0.262000, 0.3598,
-  // f 213/332 215/333 202/301 200/299
-  0.261600, 0.3561,
-  0.250000, 0.3599,
-  0.251300, 0.3633,
-  // f 213/332 215/333 202/301 200/299
-  0.261600, 0.3561,
-  0.262000, 0.3598,
-  0.251300, 0.3633,
-  // f 215/333 216/334 201/300 202/301
-  0.250000, 0.3599,
-  0.240500, 0.3672,
-  0.242600, 0.3698,
-  // f 215/333 216/334 201/300 202/301
-  0.250000, 0.3599,
-  0.251300, 0.3633,
-  0.242600, 0.3698,
-  // f 216/334 217/335 203/302 201/300
-  0.240500, 0.3672,
-  0.234300, 0.377,
-  0.237000, 0.3785,
-  // f 216/334 217/335 203/302 201/300
-  0.240500, 0.3672,
-  0.242600, 0.3698,
-  0.237000, 0.3785,
-  // f 217/335 218/336 204/303 203/302
-  0.234300, 0.377,
-  0.232100, 0.3883,
-  0.235100, 0.3883,
-  // f 217/335 218/336 204/303 203/302
-  0.234300, 0.377,
-  0.237000, 0.3785,
-  0.235100, 0.3883,
-  // f 218/336 219/337 206/305 204/303
-  0.232100, 0.3883,
-  0.234300, 0.3996,
-  0.237000, 0.3982,
-  // f 218/336 219/337 206/305 204/303
-  0.232100, 0.3883,
-  0.235100, 0.3883,
-  0.237000, 0.3982,
-  // f 219/337 220/338 205/304 206/305
-  0.234300, 0.3996,
-  0.240500, 0.4095,
-  0.242600, 0.4069,
-  // f 219/337 220/338 205/304 206/305
-  0.234300, 0.3996,
-  0.237000, 0.3982,
-  0.242600, 0.4069,
-  // f 220/338 221/339 207/306 205/304
-  0.240500, 0.4095,
-  0.250000, 0.4168,
-  0.251300, 0.4134,
-  // f 220/338 221/339 207/306 205/304
-  0.240500, 0.4095,
-  0.242600, 0.4069,
-  0.251300, 0.4134,
-  // f 221/339 222/340 208/307 207/306
-  0.250000, 0.4168,
-  0.261600, 0.4205,
-  0.262000, 0.4169,
-  // f 221/339 222/340 208/307 207/306
-  0.250000, 0.4168,
-  0.251300, 0.4134,
-  0.262000, 0.4169,
-  // f 222/340 223/341 210/309 208/307
-  0.261600, 0.4205,
-  0.273900, 0.4205,
-  0.273500, 0.4169,
-  // f 222/340 223/341 210/309 208/307
-  0.261600, 0.4205,
-  0.262000, 0.4169,
-  0.273500, 0.4169,
-  // f 223/341 224/342 209/308 210/309
-  0.273900, 0.4205,
-  0.285500, 0.4168,
-  0.284200, 0.4134,
-  // f 223/341 224/342 209/308 210/309
-  0.273900, 0.4205,
-  0.273500, 0.4169,
-  0.284200, 0.4134,
-  // f 224/342 225/343 211/310 209/308
-  0.285500, 0.4168,
-  0.295000, 0.4095,
-  0.292900, 0.4069,
-  // f 224/342 225/343 211/310 209/308
-  0.285500, 0.4168,
-  0.284200, 0.4134,
-  0.292900, 0.4069,
-  // f 225/343 227/344 198/297 211/310
-  0.295000, 0.4095,
-  0.301200, 0.3996,
-  0.298500, 0.3982,
-  // f 225/343 227/344 198/297 211/310
-  0.295000, 0.4095,
-  0.292900, 0.4069,
-  0.298500, 0.3982,
-  // f 227/344 228/327 212/311 198/297
-  0.301200, 0.3996,
-  0.303400, 0.3883,
-  0.300500, 0.3883,
-  // f 227/344 228/327 212/311 198/297
-  0.301200, 0.3996,
-  0.298500, 0.3982,
-  0.300500, 0.3883,
-  // f 232/345 233/346 234/347 235/348
-  0.734500, 0.2795,
-  0.724200, 0.2808,
-  0.738600, 0.3242,
-  // f 232/345 233/346 234/347 235/348
-  0.734500, 0.2795,
-  0.748400, 0.3191,
-  0.738600, 0.3242,
-  // f 236/349 232/345 235/348 237/36
-  0.740200, 0.279,
-  0.734500, 0.2795,
-  0.748400, 0.3191,
-  // f 236/349 232/345 235/348 237/36
-  0.740200, 0.279,
-  0.756500, 0.3183,
-  0.748400, 0.3191,
-  // f 238/28 239/27 240/41 241/40
-  0.753900, 0.3404,
-  0.757600, 0.3306,
-  0.753400, 0.3299,
-  // f 238/28 239/27 240/41 241/40
-  0.753900, 0.3404,
-  0.747800, 0.3378,
-  0.753400, 0.3299,
-  // f 242/39 243/42 235/348 234/347
-  0.743300, 0.3335,
-  0.751100, 0.3272,
-  0.748400, 0.3191,
-  // f 242/39 243/42 235/348 234/347
-  0.743300, 0.3335,
-  0.738600, 0.3242,
-  0.748400, 0.3191,
-  // f 235/348 243/42 237/36
-  0.748400, 0.3191,
-  0.751100, 0.3272,
-  0.756500, 0.3183,
-  // f 241/350 242/351 244/32
-  0.876100, 0.3314,
-  0.878700, 0.3288,
-  0.871400, 0.321,
-  // f 242/351 234/352 244/32
-  0.878700, 0.3288,
-  0.879100, 0.3214,
-  0.871400, 0.321,
-  // f 240/41 239/27 237/36
-  0.753400, 0.3299,
-  0.757600, 0.3306,
-  0.756500, 0.3183,
-  // f 237/36 243/42 240/41
-  0.756500, 0.3183,
-  0.751100, 0.3272,
-  0.753400, 0.3299,
-  // f 260/353 261/354 262/355 263/356
-  0.082000, 0.6872,
-  0.085100, 0.6673,
-  0.072000, 0.6659,
-  // f 260/353 261/354 262/355 263/356
-  0.082000, 0.6872,
-  0.061300, 0.6906,
-  0.072000, 0.6659,
-  // f 264/67 263/356 262/355 265/68
-  0.058500, 0.6883,
-  0.061300, 0.6906,
-  0.072000, 0.6659,
-  // f 264/67 263/356 262/355 265/68
-  0.058500, 0.6883,
-  0.069800, 0.6676,
-  0.072000, 0.6659,
-  // f 117/199 118/200 262/355 261/354
-  0.093400, 0.6546,
-  0.070700, 0.6562,
-  0.072000, 0.6659,
-  // f 117/199 118/200 262/355 261/354
-  0.093400, 0.6546,
-  0.085100, 0.6673,
-  0.072000, 0.6659,
-  // f 118/200 153/65 265/68 262/355
-  0.070700, 0.6562,
-  0.067100, 0.659,
-  0.069800, 0.6676,
-  // f 118/200 153/65 265/68 262/355
-  0.070700, 0.6562,
-  0.072000, 0.6659,
-  0.069800, 0.6676,
-  // f 152/260 134/216 263/357 264/358
-  0.779600, 0.023,
-  0.778000, 0.027,
-  0.784000, 0.0294,
-  // f 152/260 134/216 263/357 264/358
-  0.779600, 0.023,
-  0.784700, 0.0274,
-  0.784000, 0.0294,
-  // f 134/216 133/215 260/359 263/357
-  0.778000, 0.027,
-  0.773700, 0.0528,
-  0.782000, 0.0493,
-  // f 134/216 133/215 260/359 263/357
-  0.778000, 0.027,
-  0.784000, 0.0294,
-  0.782000, 0.0493,
-  // f 133/215 117/238 261/360 260/359
-  0.773700, 0.0528,
-  0.772400, 0.0722,
-  0.782900, 0.0679999999999999,
-  // f 133/215 117/238 261/360 260/359
-  0.773700, 0.0528,
-  0.782000, 0.0493,
-  0.782900, 0.0679999999999999,
-  // f 37/117 266/361 267/362 38/118
-  0.628600, 0.6768,
-  0.653500, 0.6767,
-  0.653500, 0.673,
-  // f 37/117 266/361 267/362 38/118
-  0.628600, 0.6768,
-  0.627800, 0.6733,
-  0.653500, 0.673,
-  // f 40/120 268/363 269/364 41/121
-  0.936300, 0.2539,
-  0.932200, 0.21,
-  0.910000, 0.2121,
-  // f 40/120 268/363 269/364 41/121
-  0.936300, 0.2539,
-  0.911700, 0.2563,
-  0.910000, 0.2121,
-  // f 44/124 270/365 271/366 45/125
-  0.628000, 0.6429,
-  0.653200, 0.6433,
-  0.653200, 0.5774,
-  // f 44/124 270/365 271/366 45/125
-  0.628000, 0.6429,
-  0.628100, 0.5779,
-  0.653200, 0.5774,
-  // f 272/367 273/368 48/128 47/127
-  0.652900, 0.5482,
-  0.652800, 0.5452,
-  0.628600, 0.5459,
-  // f 272/367 273/368 48/128 47/127
-  0.652900, 0.5482,
-  0.627800, 0.5479,
-  0.628600, 0.5459,
-  // f 274/369 275/370 50/130 49/129
-  0.942500, 0.9588,
-  0.964700, 0.9603,
-  0.966800, 0.9161,
-  // f 274/369 275/370 50/130 49/129
-  0.942500, 0.9588,
-  0.942100, 0.9149,
-  0.966800, 0.9161,
-  // f 82/17 276/70 266/371 37/167
-  0.572600, 0.7293,
-  0.538200, 0.7247,
-  0.537700, 0.7435,
-  // f 82/17 276/70 266/371 37/167
-  0.572600, 0.7293,
-  0.570800, 0.754,
-  0.537700, 0.7435,
-  // f 38/118 267/362 266/372 98/176
-  0.627800, 0.6733,
-  0.653500, 0.673,
-  0.653500, 0.6663,
-  // f 38/118 267/362 266/372 98/176
-  0.627800, 0.6733,
-  0.628400, 0.6676,
-  0.653500, 0.6663,
-  // f 266/372 270/365 44/124 98/176
-  0.653500, 0.6663,
-  0.653200, 0.6433,
-  0.628000, 0.6429,
-  // f 266/372 270/365 44/124 98/176
-  0.653500, 0.6663,
-  0.628400, 0.6676,
-  0.628000, 0.6429,
-  // f 84/22 32/169 48/373 277/71
-  0.438900, 0.7313,
-  0.442400, 0.762,
-  0.476400, 0.7523,
-  // f 84/22 32/169 48/373 277/71
-  0.438900, 0.7313,
-  0.474800, 0.7276,
-  0.476400, 0.7523,
-  // f 31/111 100/178 278/374 47/127
-  0.601700, 0.5475,
-  0.602900, 0.552,
-  0.628500, 0.5533,
-  // f 31/111 100/178 278/374 47/127
-  0.601700, 0.5475,
-  0.627800, 0.5479,
-  0.628500, 0.5533,
-  // f 100/178 28/108 45/125 278/374
-  0.602900, 0.552,
-  0.602100, 0.5784,
-  0.628100, 0.5779,
-  // f 100/178 28/108 45/125 278/374
-  0.602900, 0.552,
-  0.628500, 0.5533,
-  0.628100, 0.5779,
-  // f 281/375 282/376 283/377 284/378
-  0.213100, 0.4272,
-  0.210000, 0.4096,
-  0.189200, 0.4172,
-  // f 281/375 282/376 283/377 284/378
-  0.213100, 0.4272,
-  0.191000, 0.4272,
-  0.189200, 0.4172,
-  // f 282/376 285/379 286/380 283/377
-  0.210000, 0.4096,
-  0.201100, 0.3942,
-  0.184100, 0.4084,
-  // f 282/376 285/379 286/380 283/377
-  0.210000, 0.4096,
-  0.189200, 0.4172,
-  0.184100, 0.4084,
-  // f 285/379 287/381 288/382 286/380
-  0.201100, 0.3942,
-  0.187400, 0.3827,
-  0.176400, 0.4018,
-  // f 285/379 287/381 288/382 286/380
-  0.201100, 0.3942,
-  0.184100, 0.4084,
-  0.176400, 0.4018,
-  // f 287/381 289/383 290/384 288/382
-  0.187400, 0.3827,
-  0.170600, 0.3766,
-  0.166800, 0.3984,
-  // f 287/381 289/383 290/384 288/382
-  0.187400, 0.3827,
-  0.176400, 0.4018,
-  0.166800, 0.3984,
-  // f 289/383 291/385 292/386 290/384
-  0.170600, 0.3766,
-  0.152800, 0.3766,
-  0.156600, 0.3984,
-  // f 289/383 291/385 292/386 290/384
-  0.170600, 0.3766,
-  0.166800, 0.3984,
-  0.156600, 0.3984,
-  // f 291/385 293/387 294/388 292/386
-  0.152800, 0.3766,
-  0.136000, 0.3827,
-  0.147100, 0.4018,
-  // f 291/385 293/387 294/388 292/386
-  0.152800, 0.3766,
-  0.156600, 0.3984,
-  0.147100, 0.4018,
-  // f 293/387 295/389 296/390 294/388
-  0.136000, 0.3827,
-  0.122300, 0.3942,
-  0.139300, 0.4084,
-  // f 293/387 295/389 296/390 294/388
-  0.136000, 0.3827,
-  0.147100, 0.4018,
-  0.139300, 0.4084,
-  // f 295/389 297/391 298/392 296/390
-  0.122300, 0.3942,
-  0.113400, 0.4096,
-  0.134200, 0.4172,
-  // f 295/389 297/391 298/392 296/390
-  0.122300, 0.3942,
-  0.139300, 0.4084,
-  0.134200, 0.4172,
-  // f 297/391 299/393 300/394 298/392
-  0.113400, 0.4096,
-  0.110300, 0.4272,
-  0.132400, 0.4272,
-  // f 297/391 299/393 300/394 298/392
-  0.113400, 0.4096,
-  0.134200, 0.4172,
-  0.132400, 0.4272,
-  // f 299/393 301/395 302/396 300/394
-  0.110300, 0.4272,
-  0.113400, 0.4448,
-  0.134200, 0.4372,
-  // f 299/393 301/395 302/396 300/394
-  0.110300, 0.4272,
-  0.132400, 0.4272,
-  0.134200, 0.4372,
-  // f 301/395 303/397 304/398 302/396
-  0.113400, 0.4448,
-  0.122300, 0.4602,
-  0.139300, 0.446,
-  // f 301/395 303/397 304/398 302/396
-  0.113400, 0.4448,
-  0.134200, 0.4372,
-  0.139300, 0.446,
-  // f 303/397 305/399 306/400 304/398
-  0.122300, 0.4602,
-  0.136000, 0.4717,
-  0.147100, 0.4526,
-  // f 303/397 305/399 306/400 304/398
-  0.122300, 0.4602,
-  0.139300, 0.446,
-  0.147100, 0.4526,
-  // f 305/399 307/401 308/402 306/400
-  0.136000, 0.4717,
-  0.152800, 0.4778,
-  0.156600, 0.456,
-  // f 305/399 307/401 308/402 306/400
-  0.136000, 0.4717,
-  0.147100, 0.4526,
-  0.156600, 0.456,
-  // f 307/401 309/403 310/404 308/402
-  0.152800, 0.4778,
-  0.170600, 0.4778,
-  0.166800, 0.456,
-  // f 307/401 309/403 310/404 308/402
-  0.152800, 0.4778,
-  0.156600, 0.456,
-  0.166800, 0.456,
-  // f 309/403 311/405 312/406 310/404
-  0.170600, 0.4778,
-  0.187400, 0.4717,
-  0.176400, 0.4526,
-  // f 309/403 311/405 312/406 310/404
-  0.170600, 0.4778,
-  0.166800, 0.456,
-  0.176400, 0.4526,
-  // f 311/405 313/407 314/408 312/406
-  0.187400, 0.4717,
-  0.201100, 0.4602,
-  0.184100, 0.446,
-  // f 311/405 313/407 314/408 312/406
-  0.187400, 0.4717,
-  0.176400, 0.4526,
-  0.184100, 0.446,
-  // f 313/407 315/409 316/410 314/408
-  0.201100, 0.4602,
-  0.210000, 0.4448,
-  0.189200, 0.4372,
-  // f 313/407 315/409 316/410 314/408
-  0.201100, 0.4602,
-  0.184100, 0.446,
-  0.189200, 0.4372,
-  // f 315/409 281/375 284/378 316/410
-  0.210000, 0.4448,
-  0.213100, 0.4272,
-  0.191000, 0.4272,
-  // f 315/409 281/375 284/378 316/410
-  0.210000, 0.4448,
-  0.189200, 0.4372,
-  0.191000, 0.4272,
-  // f 317/411 318/412 319/413 320/414
-  0.598300, 0.8824,
-  0.594200, 0.8753,
-  0.587800, 0.8699,
-  // f 317/411 318/412 319/413 320/414
-  0.598300, 0.8824,
-  0.598300, 0.8988,
-  0.587800, 0.8699,
-  // f 319/413 321/415 322/416 323/417
-  0.587800, 0.8699,
-  0.580000, 0.8671,
-  0.571700, 0.8671,
-  // f 319/413 321/415 322/416 323/417
-  0.587800, 0.8699,
-  0.557600, 0.8753,
-  0.571700, 0.8671,
-  // f 322/416 324/418 323/417
-  0.571700, 0.8671,
-  0.564000, 0.8699,
-  0.557600, 0.8753,
-  // f 323/417 325/419 326/420 327/421
-  0.557600, 0.8753,
-  0.553400, 0.8824,
-  0.552000, 0.8906,
-  // f 323/417 325/419 326/420 327/421
-  0.557600, 0.8753,
-  0.557600, 0.906,
-  0.552000, 0.8906,
-  // f 326/420 328/422 327/421
-  0.552000, 0.8906,
-  0.553400, 0.8988,
-  0.557600, 0.906,
-  // f 327/421 329/423 330/424 331/425
-  0.557600, 0.906,
-  0.564000, 0.9113,
-  0.571700, 0.9141,
-  // f 327/421 329/423 330/424 331/425
-  0.557600, 0.906,
-  0.587800, 0.9113,
-  0.571700, 0.9141,
-  // f 330/424 332/426 331/425
-  0.571700, 0.9141,
-  0.580000, 0.9141,
-  0.587800, 0.9113,
-  // f 323/417 327/421 331/425 319/413
-  0.557600, 0.8753,
-  0.557600, 0.906,
-  0.587800, 0.9113,
-  // f 323/417 327/421 331/425 319/413
-  0.557600, 0.8753,
-  0.587800, 0.8699,
-  0.587800, 0.9113,
-  // f 331/425 333/427 320/414 319/413
-  0.587800, 0.9113,
-  0.594200, 0.906,
-  0.598300, 0.8988,
-  // f 331/425 333/427 320/414 319/413
-  0.587800, 0.9113,
-  0.587800, 0.8699,
-  0.598300, 0.8988,
-  // f 334/428 317/411 320/414
-  0.599800, 0.8906,
-  0.598300, 0.8824,
-  0.598300, 0.8988,
-  // f 284/378 283/377 335/429 336/430
-  0.191000, 0.4272,
-  0.189200, 0.4172,
-  0.187300, 0.4179,
-  // f 284/378 283/377 335/429 336/430
-  0.191000, 0.4272,
-  0.188900, 0.4272,
-  0.187300, 0.4179,
-  // f 283/377 286/380 337/431 335/429
-  0.189200, 0.4172,
-  0.184100, 0.4084,
-  0.182600, 0.4097,
-  // f 283/377 286/380 337/431 335/429
-  0.189200, 0.4172,
-  0.187300, 0.4179,
-  0.182600, 0.4097,
-  // f 286/380 288/382 338/432 337/431
-  0.184100, 0.4084,
-  0.176400, 0.4018,
-  0.175300, 0.4036,
-  // f 286/380 288/382 338/432 337/431
-  0.184100, 0.4084,
-  0.182600, 0.4097,
-  0.175300, 0.4036,
-  // f 288/382 290/384 339/433 338/432
-  0.176400, 0.4018,
-  0.166800, 0.3984,
-  0.166400, 0.4004,
-  // f 288/382 290/384 339/433 338/432
-  0.176400, 0.4018,
-  0.175300, 0.4036,
-  0.166400, 0.4004,
-  // f 290/384 292/386 340/434 339/433
-  0.166800, 0.3984,
-  0.156600, 0.3984,
-  0.157000, 0.4004,
-  // f 290/384 292/386 340/434 339/433
-  0.166800, 0.3984,
-  0.166400, 0.4004,
-  0.157000, 0.4004,
-  // f 292/386 294/388 341/435 340/434
-  0.156600, 0.3984,
-  0.147100, 0.4018,
-  0.148100, 0.4036,
-  // f 292/386 294/388 341/435 340/434
-  0.156600, 0.3984,
-  0.157000, 0.4004,
-  0.148100, 0.4036,
-  // f 294/388 296/390 342/436 341/435
-  0.147100, 0.4018,
-  0.139300, 0.4084,
-  0.140800, 0.4097,
-  // f 294/388 296/390 342/436 341/435
-  0.147100, 0.4018,
-  0.148100, 0.4036,
-  0.140800, 0.4097,
-  // f 296/390 298/392 343/437 342/436
-  0.139300, 0.4084,
-  0.134200, 0.4172,
-  0.136100, 0.4179,
-  // f 296/390 298/392 343/437 342/436
-  0.139300, 0.4084,
-  0.140800, 0.4097,
-  0.136100, 0.4179,
-  // f 298/392 300/394 344/438 343/437
-  0.134200, 0.4172,
-  0.132400, 0.4272,
-  0.134500, 0.4272,
-  // f 298/392 300/394 344/438 343/437
-  0.134200, 0.4172,
-  0.136100, 0.4179,
-  0.134500, 0.4272,
-  // f 300/394 302/396 345/439 344/438
-  0.132400, 0.4272,
-  0.134200, 0.4372,
-  0.136100, 0.4365,
-  // f 300/394 302/396 345/439 344/438
-  0.132400, 0.4272,
-  0.134500, 0.4272,
-  0.136100, 0.4365,
-  // f 302/396 304/398 346/440 345/439
-  0.134200, 0.4372,
-  0.139300, 0.446,
-  0.140800, 0.4447,
-  // f 302/396 304/398 346/440 345/439
-  0.134200, 0.4372,
-  0.136100, 0.4365,
-  0.140800, 0.4447,
-  // f 304/398 306/400 347/441 346/440
-  0.139300, 0.446,
-  0.147100, 0.4526,
-  0.148100, 0.4508,
-  // f 304/398 306/400 347/441 346/440
-  0.139300, 0.446,
-  0.140800, 0.4447,
-  0.148100, 0.4508,
-  // f 306/400 308/402 348/442 347/441
-  0.147100, 0.4526,
-  0.156600, 0.456,
-  0.157000, 0.454,
-  // f 306/400 308/402 348/442 347/441
-  0.147100, 0.4526,
-  0.148100, 0.4508,
-  0.157000, 0.454,
-  // f 308/402 310/404 349/443 348/442
-  0.156600, 0.456,
-  0.166800, 0.456,
-  0.166400, 0.454,
-  // f 308/402 310/404 349/443 348/442
-  0.156600, 0.456,
-  0.157000, 0.454,
-  0.166400, 0.454,
-  // f 310/404 312/406 350/444 349/443
-  0.166800, 0.456,
-  0.176400, 0.4526,
-  0.175300, 0.4508,
-  // f 310/404 312/406 350/444 349/443
-  0.166800, 0.456,
-  0.166400, 0.454,
-  0.175300, 0.4508,
-  // f 312/406 314/408 351/445 350/444
-  0.176400, 0.4526,
-  0.184100, 0.446,
-  0.182600, 0.4447,
-  // f 312/406 314/408 351/445 350/444
-  0.176400, 0.4526,
-  0.175300, 0.4508,
-  0.182600, 0.4447,
-  // f 314/408 316/410 352/446 351/445
-  0.184100, 0.446,
-  0.189200, 0.4372,
-  0.187300, 0.4365,
-  // f 314/408 316/410 352/446 351/445
-  0.184100, 0.446,
-  0.182600, 0.4447,
-  0.187300, 0.4365,
-  // f 316/410 284/378 336/430 352/446
-  0.189200, 0.4372,
-  0.191000, 0.4272,
-  0.188900, 0.4272,
-  // f 316/410 284/378 336/430 352/446
-  0.189200, 0.4372,
-  0.187300, 0.4365,
-  0.188900, 0.4272,
-  // f 336/430 335/429 317/447 334/448
-  0.188900, 0.4272,
-  0.187300, 0.4179,
-  0.185600, 0.4185,
-  // f 336/430 335/429 317/447 334/448
-  0.188900, 0.4272,
-  0.187100, 0.4272,
-  0.185600, 0.4185,
-  // f 335/429 337/431 318/449 317/447
-  0.187300, 0.4179,
-  0.182600, 0.4097,
-  0.181200, 0.4109,
-  // f 335/429 337/431 318/449 317/447
-  0.187300, 0.4179,
-  0.185600, 0.4185,
-  0.181200, 0.4109,
-  // f 337/431 338/432 319/450 318/449
-  0.182600, 0.4097,
-  0.175300, 0.4036,
-  0.174400, 0.4052,
-  // f 337/431 338/432 319/450 318/449
-  0.182600, 0.4097,
-  0.181200, 0.4109,
-  0.174400, 0.4052,
-  // f 338/432 339/433 321/451 319/450
-  0.175300, 0.4036,
-  0.166400, 0.4004,
-  0.166100, 0.4022,
-  // f 338/432 339/433 321/451 319/450
-  0.175300, 0.4036,
-  0.174400, 0.4052,
-  0.166100, 0.4022,
-  // f 339/433 340/434 322/452 321/451
-  0.166400, 0.4004,
-  0.157000, 0.4004,
-  0.157300, 0.4022,
-  // f 339/433 340/434 322/452 321/451
-  0.166400, 0.4004,
-  0.166100, 0.4022,
-  0.157300, 0.4022,
-  // f 340/434 341/435 324/453 322/452
-  0.157000, 0.4004,
-  0.148100, 0.4036,
-  0.149000, 0.4052,
-  // f 340/434 341/435 324/453 322/452
-  0.157000, 0.4004,
-  0.157300, 0.4022,
-  0.149000, 0.4052,
-  // f 341/435 342/436 323/454 324/453
-  0.148100, 0.4036,
-  0.140800, 0.4097,
-  0.142200, 0.4109,
-  // f 341/435 342/436 323/454 324/453
-  0.148100, 0.4036,
-  0.149000, 0.4052,
-  0.142200, 0.4109,
-  // f 342/436 343/437 325/455 323/454
-  0.140800, 0.4097,
-  0.136100, 0.4179,
-  0.137800, 0.4185,
-  // f 342/436 343/437 325/455 323/454
-  0.140800, 0.4097,
-  0.142200, 0.4109,
-  0.137800, 0.4185,
-  // f 343/437 344/438 326/456 325/455
-  0.136100, 0.4179,
-  0.134500, 0.4272,
-  0.136300, 0.4272,
-  // f 343/437 344/438 326/456 325/455
-  0.136100, 0.4179,
-  0.137800, 0.4185,
-  0.136300, 0.4272,
-  // f 344/438 345/439 328/457 326/456
-  0.134500, 0.4272,
-  0.136100, 0.4365,
-  0.137800, 0.4359,
-  // f 344/438 345/439 328/457 326/456
-  0.134500, 0.4272,
-  0.136300, 0.4272,
-  0.137800, 0.4359,
-  // f 345/439 346/440 327/458 328/457
-  0.136100, 0.4365,
-  0.140800, 0.4447,
-  0.142200, 0.4435,
-  // f 345/439 346/440 327/458 328/457
-  0.136100, 0.4365,
-  0.137800, 0.4359,
-  0.142200, 0.4435,
-  // f 346/440 347/441 329/459 327/458
-  0.140800, 0.4447,
-  0.148100, 0.4508,
-  0.149000, 0.4492,
-  // f 346/440 347/441 329/459 327/458
-  0.140800, 0.4447,
-  0.142200, 0.4435,
-  0.149000, 0.4492,
-  // f 347/441 348/442 330/460 329/459
-  0.148100, 0.4508,
-  0.157000, 0.454,
-  0.157300, 0.4522,
-  // f 347/441 348/442 330/460 329/459
-  0.148100, 0.4508,
-  0.149000, 0.4492,
-  0.157300, 0.4522,
-  // f 348/442 349/443 332/461 330/460
-  0.157000, 0.454,
-  0.166400, 0.454,
-  0.166100, 0.4522,
-  // f 348/442 349/443 332/461 330/460
-  0.157000, 0.454,
-  0.157300, 0.4522,
-  0.166100, 0.4522,
-  // f 349/443 350/444 331/462 332/461
-  0.166400, 0.454,
-  0.175300, 0.4508,
-  0.174400, 0.4492,
-  // f 349/443 350/444 331/462 332/461
-  0.166400, 0.454,
-  0.166100, 0.4522,
-  0.174400, 0.4492,
-  // f 350/444 351/445 333/463 331/462
-  0.175300, 0.4508,
-  0.182600, 0.4447,
-  0.181200, 0.4435,
-  // f 350/444 351/445 333/463 331/462
-  0.175300, 0.4508,
-  0.174400, 0.4492,
-  0.181200, 0.4435,
-  // f 351/445 352/446 320/464 333/463
-  0.182600, 0.4447,
-  0.187300, 0.4365,
-  0.185600, 0.4359,
-  // f 351/445 352/446 320/464 333/463
-  0.182600, 0.4447,
-  0.181200, 0.4435,
-  0.185600, 0.4359,
-  // f 352/446 336/430 334/448 320/464
-  0.187300, 0.4365,
-  0.188900, 0.4272,
-  0.187100, 0.4272,
-  // f 352/446 336/430 334/448 320/464
-  0.187300, 0.4365,
-  0.185600, 0.4359,
-  0.187100, 0.4272,
-  // f 353/465 354/466 355/467 356/468
-  0.924000, 0.8704,
-  0.856700, 0.869,
-  0.856700, 0.8915,
-  // f 353/465 354/466 355/467 356/468
-  0.924000, 0.8704,
-  0.923200, 0.8928,
-  0.856700, 0.8915,
-  // f 357/469 358/470 356/468 355/467
-  0.856700, 0.9059,
-  0.923900, 0.9072,
-  0.923200, 0.8928,
-  // f 357/469 358/470 356/468 355/467
-  0.856700, 0.9059,
-  0.856700, 0.8915,
-  0.923200, 0.8928,
-  // f 353/465 359/471 360/472 354/466
-  0.924000, 0.8704,
-  0.923200, 0.8556,
-  0.856700, 0.8543,
-  // f 353/465 359/471 360/472 354/466
-  0.924000, 0.8704,
-  0.856700, 0.869,
-  0.856700, 0.8543,
-  // f 361/473 362/474 363/475 357/469
-  0.856700, 0.9863,
-  0.912800, 0.9859,
-  0.917500, 0.9814,
-  // f 361/473 362/474 363/475 357/469
-  0.856700, 0.9863,
-  0.856700, 0.9059,
-  0.917500, 0.9814,
-  // f 363/475 358/470 357/469
-  0.917500, 0.9814,
-  0.923900, 0.9072,
-  0.856700, 0.9059,
-  // f 364/476 365/477 366/478 367/479
-  0.849700, 0.8868,
-  0.849700, 0.8656,
-  0.769000, 0.8674,
-  // f 364/476 365/477 366/478 367/479
-  0.849700, 0.8868,
-  0.769000, 0.8881,
-  0.769000, 0.8674,
-  // f 367/479 368/480 369/481 364/476
-  0.769000, 0.8881,
-  0.769000, 0.901,
-  0.849700, 0.8997,
-  // f 367/479 368/480 369/481 364/476
-  0.769000, 0.8881,
-  0.849700, 0.8868,
-  0.849700, 0.8997,
-  // f 370/482 371/483 366/478 365/477
-  0.849700, 0.8528,
-  0.769000, 0.8549,
-  0.769000, 0.8674,
-  // f 370/482 371/483 366/478 365/477
-  0.849700, 0.8528,
-  0.849700, 0.8656,
-  0.769000, 0.8674,
-  // f 372/484 373/485 374/486 369/481
-  0.775600, 0.9854,
-  0.781800, 0.9908,
-  0.849700, 0.9904,
-  // f 372/484 373/485 374/486 369/481
-  0.775600, 0.9854,
-  0.849700, 0.8997,
-  0.849700, 0.9904,
-  // f 369/481 368/480 372/484
-  0.849700, 0.8997,
-  0.769000, 0.901,
-  0.775600, 0.9854,
-  // f 367/487 366/488 353/465 356/468
-  0.931100, 0.8922,
-  0.932300, 0.8696,
-  0.924000, 0.8704,
-  // f 367/487 366/488 353/465 356/468
-  0.931100, 0.8922,
-  0.923200, 0.8928,
-  0.924000, 0.8704,
-  // f 368/489 367/487 356/468 358/470
-  0.933100, 0.9052,
-  0.931100, 0.8922,
-  0.923200, 0.8928,
-  // f 368/489 367/487 356/468 358/470
-  0.933100, 0.9052,
-  0.923900, 0.9072,
-  0.923200, 0.8928,
-  // f 366/488 371/490 359/471 353/465
-  0.932300, 0.8696,
-  0.928800, 0.8508,
-  0.923200, 0.8556,
-  // f 366/488 371/490 359/471 353/465
-  0.932300, 0.8696,
-  0.924000, 0.8704,
-  0.923200, 0.8556,
-  // f 371/490 370/491 360/472 359/471
-  0.928800, 0.8508,
-  0.856700, 0.8494,
-  0.856700, 0.8543,
-  // f 371/490 370/491 360/472 359/471
-  0.928800, 0.8508,
-  0.923200, 0.8556,
-  0.856700, 0.8543,
-  // f 374/492 373/493 362/474 361/473
-  0.856700, 0.9952,
-  0.917300, 0.9931,
-  0.912800, 0.9859,
-  // f 374/492 373/493 362/474 361/473
-  0.856700, 0.9952,
-  0.856700, 0.9863,
-  0.912800, 0.9859,
-  // f 373/493 372/494 363/475 362/474
-  0.917300, 0.9931,
-  0.924400, 0.987,
-  0.917500, 0.9814,
-  // f 373/493 372/494 363/475 362/474
-  0.917300, 0.9931,
-  0.912800, 0.9859,
-  0.917500, 0.9814,
-  // f 372/494 368/489 358/470 363/475
-  0.924400, 0.987,
-  0.933100, 0.9052,
-  0.923900, 0.9072,
-  // f 372/494 368/489 358/470 363/475
-  0.924400, 0.987,
-  0.917500, 0.9814,
-  0.923900, 0.9072,
-  // f 375/495 376/496 377/497 378/498
-  0.757900, 0.4472,
-  0.763700, 0.4497,
-  0.768100, 0.4347,
-  // f 375/495 376/496 377/497 378/498
-  0.757900, 0.4472,
-  0.759900, 0.4316,
-  0.768100, 0.4347,
-  // f 379/499 380/500 381/501 382/502
-  0.738000, 0.4472,
-  0.735900, 0.4316,
-  0.727700, 0.4347,
-  // f 379/499 380/500 381/501 382/502
-  0.738000, 0.4472,
-  0.732100, 0.4497,
-  0.727700, 0.4347,
-  // f 383/503 384/504 380/500 379/499
-  0.744500, 0.4455,
-  0.743800, 0.4292,
-  0.735900, 0.4316,
-  // f 383/503 384/504 380/500 379/499
-  0.744500, 0.4455,
-  0.738000, 0.4472,
-  0.735900, 0.4316,
-  // f 385/505 386/506 384/504 383/503
-  0.751400, 0.4455,
-  0.752000, 0.4292,
-  0.743800, 0.4292,
-  // f 385/505 386/506 384/504 383/503
-  0.751400, 0.4455,
-  0.744500, 0.4455,
-  0.743800, 0.4292,
-  // f 385/505 375/495 378/498 386/506
-  0.751400, 0.4455,
-  0.757900, 0.4472,
-  0.759900, 0.4316,
-  // f 385/505 375/495 378/498 386/506
-  0.751400, 0.4455,
-  0.752000, 0.4292,
-  0.759900, 0.4316,
-  // f 387/507 388/508 389/509 390/510
-  0.741200, 0.4695,
-  0.755100, 0.4695,
-  0.762000, 0.4597,
-  // f 387/507 388/508 389/509 390/510
-  0.741200, 0.4695,
-  0.741200, 0.4499,
-  0.762000, 0.4597,
-  // f 389/509 391/511 390/510
-  0.762000, 0.4597,
-  0.755100, 0.4499,
-  0.741200, 0.4499,
-  // f 392/512 387/507 390/510
-  0.734300, 0.4597,
-  0.741200, 0.4695,
-  0.741200, 0.4499,
-  // f 387/513 392/514 378/498 377/497
-  0.768300, 0.4185,
-  0.760400, 0.4162,
-  0.759900, 0.4316,
-  // f 387/513 392/514 378/498 377/497
-  0.768300, 0.4185,
-  0.768100, 0.4347,
-  0.759900, 0.4316,
-  // f 388/508 387/507 377/515 381/516
-  0.755100, 0.4695,
-  0.741200, 0.4695,
-  0.740400, 0.4915,
-  // f 388/508 387/507 377/515 381/516
-  0.755100, 0.4695,
-  0.755900, 0.4915,
-  0.740400, 0.4915,
-  // f 380/500 389/517 388/518 381/501
-  0.735900, 0.4316,
-  0.735500, 0.4162,
-  0.727500, 0.4185,
-  // f 380/500 389/517 388/518 381/501
-  0.735900, 0.4316,
-  0.727700, 0.4347,
-  0.727500, 0.4185,
-  // f 384/504 391/519 389/517 380/500
-  0.743800, 0.4292,
-  0.743700, 0.4139,
-  0.735500, 0.4162,
-  // f 384/504 391/519 389/517 380/500
-  0.743800, 0.4292,
-  0.735900, 0.4316,
-  0.735500, 0.4162,
-  // f 390/520 391/519 384/504 386/506
-  0.752200, 0.4139,
-  0.743700, 0.4139,
-  0.743800, 0.4292,
-  // f 390/520 391/519 384/504 386/506
-  0.752200, 0.4139,
-  0.752000, 0.4292,
-  0.743800, 0.4292,
-  // f 392/514 390/520 386/506 378/498
-  0.760400, 0.4162,
-  0.752200, 0.4139,
-  0.752000, 0.4292,
-  // f 392/514 390/520 386/506 378/498
-  0.760400, 0.4162,
-  0.759900, 0.4316,
-  0.752000, 0.4292,
-  // f 277/71 48/373 273/521 393/77
-  0.474800, 0.7276,
-  0.476400, 0.7523,
-  0.508800, 0.743,
-  // f 277/71 48/373 273/521 393/77
-  0.474800, 0.7276,
-  0.509100, 0.7242,
-  0.508800, 0.743,
-  // f 47/127 278/374 394/522 272/367
-  0.627800, 0.5479,
-  0.628500, 0.5533,
-  0.652900, 0.5546,
-  // f 47/127 278/374 394/522 272/367
-  0.627800, 0.5479,
-  0.652900, 0.5482,
-  0.652900, 0.5546,
-  // f 394/522 278/374 45/125 271/366
-  0.652900, 0.5546,
-  0.628500, 0.5533,
-  0.628100, 0.5779,
-  // f 394/522 278/374 45/125 271/366
-  0.652900, 0.5546,
-  0.653200, 0.5774,
-  0.628100, 0.5779,
-  // f 121/203 120/202 395/523 396/524
-  0.079500, 0.3651,
-  0.101000, 0.3743,
-  0.117400, 0.3404,
-  // f 121/203 120/202 395/523 396/524
-  0.079500, 0.3651,
-  0.096100, 0.3299,
-  0.117400, 0.3404,
-  // f 395/525 120/245 135/217 138/220
-  0.601000, 0.2273,
-  0.613300, 0.1938,
-  0.585000, 0.1917,
-  // f 395/525 120/245 135/217 138/220
-  0.601000, 0.2273,
-  0.573600, 0.225,
-  0.585000, 0.1917,
-  // f 157/242 121/203 396/524 154/239
-  0.074200, 0.3609,
-  0.079500, 0.3651,
-  0.096100, 0.3299,
-  // f 157/242 121/203 396/524 154/239
-  0.074200, 0.3609,
-  0.094000, 0.3273,
-  0.096100, 0.3299,
-  // f 167/266 170/269 397/526 398/527
-  0.757500, 0.3852,
-  0.751200, 0.3787,
-  0.822900, 0.3792,
-  // f 167/266 170/269 397/526 398/527
-  0.757500, 0.3852,
-  0.822100, 0.3856,
-  0.822900, 0.3792,
-  // f 191/290 189/288 187/286 183/282
-  0.804600, 0.5099,
-  0.782500, 0.5253,
-  0.757500, 0.5343,
-  // f 191/290 189/288 187/286 183/282
-  0.804600, 0.5099,
-  0.706000, 0.5253,
-  0.757500, 0.5343,
-  // f 187/286 185/284 183/282
-  0.757500, 0.5343,
-  0.731000, 0.5343,
-  0.706000, 0.5253,
-  // f 183/282 181/280 179/278 175/274
-  0.706000, 0.5253,
-  0.685700, 0.5084,
-  0.672400, 0.4856,
-  // f 183/282 181/280 179/278 175/274
-  0.706000, 0.5253,
-  0.672400, 0.4338,
-  0.672400, 0.4856,
-  // f 179/278 177/276 175/274
-  0.672400, 0.4856,
-  0.667800, 0.4597,
-  0.672400, 0.4338,
-  // f 175/274 173/272 171/270 167/266
-  0.672400, 0.4338,
-  0.685700, 0.411,
-  0.706000, 0.3942,
-  // f 175/274 173/272 171/270 167/266
-  0.672400, 0.4338,
-  0.757500, 0.3852,
-  0.706000, 0.3942,
-  // f 171/270 168/267 167/266
-  0.706000, 0.3942,
-  0.731000, 0.3852,
-  0.757500, 0.3852,
-  // f 183/282 175/274 167/266 191/290
-  0.706000, 0.5253,
-  0.672400, 0.4338,
-  0.757500, 0.3852,
-  // f 183/282 175/274 167/266 191/290
-  0.706000, 0.5253,
-  0.804600, 0.5099,
-  0.757500, 0.3852,
-  // f 191/290 167/266 398/527 193/292
-  0.804600, 0.5099,
-  0.757500, 0.3852,
-  0.822100, 0.3856,
-  // f 191/290 167/266 398/527 193/292
-  0.804600, 0.5099,
-  0.822100, 0.4945,
-  0.822100, 0.3856,
-  // f 229/528 228/529 399/530 400/531
-  0.796700, 0.4346,
-  0.800100, 0.4535,
-  0.822100, 0.4535,
-  // f 229/528 228/529 399/530 400/531
-  0.796700, 0.4346,
-  0.822100, 0.4282,
-  0.822100, 0.4535,
-  // f 230/532 229/528 400/531 401/533
-  0.787000, 0.418,
-  0.796700, 0.4346,
-  0.822100, 0.4282,
-  // f 230/532 229/528 400/531 401/533
-  0.787000, 0.418,
-  0.822100, 0.4057,
-  0.822100, 0.4282,
-  // f 231/534 230/532 401/533 402/535
-  0.772200, 0.4057,
-  0.787000, 0.418,
-  0.822100, 0.4057,
-  // f 231/534 230/532 401/533 402/535
-  0.772200, 0.4057,
-  0.822100, 0.3807,
-  0.822100, 0.4057,
-  // f 170/269 214/313 231/534 402/535
-  0.751200, 0.3787,
-  0.753900, 0.3991,
-  0.772200, 0.4057,
-  // f 170/269 214/313 231/534 402/535
-  0.751200, 0.3787,
-  0.822100, 0.3807,
-  0.772200, 0.4057,
-  // f 397/526 170/269 402/535
-  0.822900, 0.3792,
-  0.751200, 0.3787,
-  0.822100, 0.3807,
-  // f 399/530 228/529 227/326 226/325
-  0.822100, 0.4535,
-  0.800100, 0.4535,
-  0.796700, 0.4724,
-  // f 399/530 228/529 227/326 226/325
-  0.822100, 0.4535,
-  0.822100, 0.486,
-  0.796700, 0.4724,
-  // f 404/536 234/352 233/537
-  0.877000, 0.284,
-  0.879100, 0.3214,
-  0.884700, 0.2844,
-  // f 405/81 406/84 407/83 408/82
-  0.476200, 0.5805,
-  0.481700, 0.5738,
-  0.482900, 0.6474,
-  // f 405/81 406/84 407/83 408/82
-  0.476200, 0.5805,
-  0.476600, 0.6405,
-  0.482900, 0.6474,
-  // f 409/85 410/88 411/87 412/86
-  0.546400, 0.674,
-  0.543600, 0.6699,
-  0.601500, 0.6736,
-  // f 409/85 410/88 411/87 412/86
-  0.546400, 0.674,
-  0.603100, 0.6769,
-  0.601500, 0.6736,
-  // f 413/89 414/92 415/91 416/90
-  0.970100, 0.6712,
-  0.869700, 0.6759,
-  0.868500, 0.6555,
-  // f 413/89 414/92 415/91 416/90
-  0.970100, 0.6712,
-  0.969100, 0.6498,
-  0.868500, 0.6555,
-  // f 416/90 415/91 417/94 418/93
-  0.969100, 0.6498,
-  0.868500, 0.6555,
-  0.860400, 0.5227,
-  // f 416/90 415/91 417/94 418/93
-  0.969100, 0.6498,
-  0.961000, 0.5164,
-  0.860400, 0.5227,
-  // f 418/93 417/94 419/96 420/95
-  0.961000, 0.5164,
-  0.860400, 0.5227,
-  0.859200, 0.5044,
-  // f 418/93 417/94 419/96 420/95
-  0.961000, 0.5164,
-  0.959500, 0.4976,
-  0.859200, 0.5044,
-  // f 420/95 419/96 421/98 422/97
-  0.959500, 0.4976,
-  0.859200, 0.5044,
-  0.859900, 0.4916,
-  // f 420/95 419/96 421/98 422/97
-  0.959500, 0.4976,
-  0.958200, 0.4835,
-  0.859900, 0.4916,
-  // f 423/99 424/102 425/101 426/100
-  0.940700, 0.2998,
-  0.949400, 0.3917,
-  0.896400, 0.3967,
-  // f 423/99 424/102 425/101 426/100
-  0.940700, 0.2998,
-  0.913500, 0.3024,
-  0.896400, 0.3967,
-  // f 427/103 428/104 414/92 413/89
-  0.970500, 0.6847,
-  0.871700, 0.6871,
-  0.869700, 0.6759,
-  // f 427/103 428/104 414/92 413/89
-  0.970500, 0.6847,
-  0.970100, 0.6712,
-  0.869700, 0.6759,
-  // f 429/105 430/108 431/107 432/106
-  0.558800, 0.5855,
-  0.602100, 0.5784,
-  0.601900, 0.6425,
-  // f 429/105 430/108 431/107 432/106
-  0.558800, 0.5855,
-  0.558500, 0.6355,
-  0.601900, 0.6425,
-  // f 433/109 434/112 435/111 436/110
-  0.546900, 0.5498,
-  0.603200, 0.5467,
-  0.601700, 0.5475,
-  // f 433/109 434/112 435/111 436/110
-  0.546900, 0.5498,
-  0.544000, 0.551,
-  0.601700, 0.5475,
-  // f 437/113 438/116 439/115 440/114
-  0.970800, 0.7773,
-  0.969100, 0.8699,
-  0.941700, 0.869,
-  // f 437/113 438/116 439/115 440/114
-  0.970800, 0.7773,
-  0.917400, 0.7771,
-  0.941700, 0.869,
-  // f 412/86 411/87 441/118 442/117
-  0.603100, 0.6769,
-  0.601500, 0.6736,
-  0.627800, 0.6733,
-  // f 412/86 411/87 441/118 442/117
-  0.603100, 0.6769,
-  0.628600, 0.6768,
-  0.627800, 0.6733,
-  // f 410/88 409/85 443/119 407/83
-  0.543600, 0.6699,
-  0.546400, 0.674,
-  0.489400, 0.654,
-  // f 410/88 409/85 443/119 407/83
-  0.543600, 0.6699,
-  0.482900, 0.6474,
-  0.489400, 0.654,
-  // f 423/99 426/100 444/121 445/120
-  0.940700, 0.2998,
-  0.913500, 0.3024,
-  0.911700, 0.2563,
-  // f 423/99 426/100 444/121 445/120
-  0.940700, 0.2998,
-  0.936300, 0.2539,
-  0.911700, 0.2563,
-  // f 421/98 425/101 424/102 422/97
-  0.859900, 0.4916,
-  0.896400, 0.3967,
-  0.949400, 0.3917,
-  // f 421/98 425/101 424/102 422/97
-  0.859900, 0.4916,
-  0.958200, 0.4835,
-  0.949400, 0.3917,
-  // f 446/122 429/105 432/106 447/123
-  0.509800, 0.5769,
-  0.558800, 0.5855,
-  0.558500, 0.6355,
-  // f 446/122 429/105 432/106 447/123
-  0.509800, 0.5769,
-  0.509400, 0.6436,
-  0.558500, 0.6355,
-  // f 431/107 430/108 448/125 449/124
-  0.601900, 0.6425,
-  0.602100, 0.5784,
-  0.628100, 0.5779,
-  // f 431/107 430/108 448/125 449/124
-  0.601900, 0.6425,
-  0.628000, 0.6429,
-  0.628100, 0.5779,
-  // f 450/126 433/109 436/110 406/84
-  0.487700, 0.5688,
-  0.546900, 0.5498,
-  0.544000, 0.551,
-  // f 450/126 433/109 436/110 406/84
-  0.487700, 0.5688,
-  0.481700, 0.5738,
-  0.544000, 0.551,
-  // f 451/127 435/111 434/112 452/128
-  0.627800, 0.5479,
-  0.601700, 0.5475,
-  0.603200, 0.5467,
-  // f 451/127 435/111 434/112 452/128
-  0.627800, 0.5479,
-  0.628600, 0.5459,
-  0.603200, 0.5467,
-  // f 427/103 437/113 440/114 428/104
-  0.970500, 0.6847,
-  0.970800, 0.7773,
-  0.917400, 0.7771,
-  // f 427/103 437/113 440/114 428/104
-  0.970500, 0.6847,
-  0.871700, 0.6871,
-  0.917400, 0.7771,
-  // f 453/129 439/115 438/116 454/130
-  0.942100, 0.9149,
-  0.941700, 0.869,
-  0.969100, 0.8699,
-  // f 453/129 439/115 438/116 454/130
-  0.942100, 0.9149,
-  0.966800, 0.9161,
-  0.969100, 0.8699,
-  // f 455/131 456/134 457/133 458/132
-  0.325700, 0.7457,
-  0.317300, 0.7432,
-  0.317400, 0.7346,
-  // f 455/131 456/134 457/133 458/132
-  0.325700, 0.7457,
-  0.325800, 0.7325,
-  0.317400, 0.7346,
-  // f 458/132 457/133 459/136 460/135
-  0.325800, 0.7325,
-  0.317400, 0.7346,
-  0.312600, 0.7268,
-  // f 458/132 457/133 459/136 460/135
-  0.325800, 0.7325,
-  0.318900, 0.7207,
-  0.312600, 0.7268,
-  // f 460/135 459/136 461/138 462/137
-  0.318900, 0.7207,
-  0.312600, 0.7268,
-  0.304300, 0.722,
-  // f 460/135 459/136 461/138 462/137
-  0.318900, 0.7207,
-  0.306800, 0.7135,
-  0.304300, 0.722,
-  // f 462/137 461/138 463/140 464/139
-  0.306800, 0.7135,
-  0.304300, 0.722,
-  0.294700, 0.7215,
-  // f 462/137 461/138 463/140 464/139
-  0.306800, 0.7135,
-  0.292800, 0.713,
-  0.294700, 0.7215,
-  // f 464/139 463/140 465/142 466/141
-  0.292800, 0.713,
-  0.294700, 0.7215,
-  0.286500, 0.7255,
-  // f 464/139 463/140 465/142 466/141
-  0.292800, 0.713,
-  0.280600, 0.7191,
-  0.286500, 0.7255,
-  // f 466/141 465/142 467/144 468/143
-  0.280600, 0.7191,
-  0.286500, 0.7255,
-  0.281900, 0.7327,
-  // f 466/141 465/142 467/144 468/143
-  0.280600, 0.7191,
-  0.273500, 0.7303,
-  0.281900, 0.7327,
-  // f 468/143 467/144 469/146 470/145
-  0.273500, 0.7303,
-  0.281900, 0.7327,
-  0.281900, 0.7413,
-  // f 468/143 467/144 469/146 470/145
-  0.273500, 0.7303,
-  0.273400, 0.7435,
-  0.281900, 0.7413,
-  // f 470/145 469/146 471/148 472/147
-  0.273400, 0.7435,
-  0.281900, 0.7413,
-  0.286600, 0.7491,
-  // f 470/145 469/146 471/148 472/147
-  0.273400, 0.7435,
-  0.280300, 0.7553,
-  0.286600, 0.7491,
-  // f 472/147 471/148 473/150 474/149
-  0.280300, 0.7553,
-  0.286600, 0.7491,
-  0.294900, 0.754,
-  // f 472/147 471/148 473/150 474/149
-  0.280300, 0.7553,
-  0.292400, 0.7624,
-  0.294900, 0.754,
-  // f 474/149 473/150 475/152 476/151
-  0.292400, 0.7624,
-  0.294900, 0.754,
-  0.304500, 0.7544,
-  // f 474/149 473/150 475/152 476/151
-  0.292400, 0.7624,
-  0.306500, 0.763,
-  0.304500, 0.7544,
-  // f 476/151 475/152 477/154 478/153
-  0.306500, 0.763,
-  0.304500, 0.7544,
-  0.312700, 0.7504,
-  // f 476/151 475/152 477/154 478/153
-  0.306500, 0.763,
-  0.318600, 0.7568,
-  0.312700, 0.7504,
-  // f 478/153 477/154 456/134 455/131
-  0.318600, 0.7568,
-  0.312700, 0.7504,
-  0.317300, 0.7432,
-  // f 478/153 477/154 456/134 455/131
-  0.318600, 0.7568,
-  0.325700, 0.7457,
-  0.317300, 0.7432,
-  // f 477/154 475/152 473/150 469/146
-  0.312700, 0.7504,
-  0.304500, 0.7544,
-  0.294900, 0.754,
-  // f 477/154 475/152 473/150 469/146
-  0.312700, 0.7504,
-  0.281900, 0.7413,
-  0.294900, 0.754,
-  // f 473/150 471/148 469/146
-  0.294900, 0.754,
-  0.286600, 0.7491,
-  0.281900, 0.7413,
-  // f 469/146 467/144 465/142 461/138
-  0.281900, 0.7413,
-  0.281900, 0.7327,
-  0.286500, 0.7255,
-  // f 469/146 467/144 465/142 461/138
-  0.281900, 0.7413,
-  0.304300, 0.722,
-  0.286500, 0.7255,
-  // f 465/142 463/140 461/138
-  0.286500, 0.7255,
-  0.294700, 0.7215,
-  0.304300, 0.722,
-  // f 477/154 469/146 461/138 457/133
-  0.312700, 0.7504,
-  0.281900, 0.7413,
-  0.304300, 0.722,
-  // f 477/154 469/146 461/138 457/133
-  0.312700, 0.7504,
-  0.317400, 0.7346,
-  0.304300, 0.722,
-  // f 461/138 459/136 457/133
-  0.304300, 0.722,
-  0.312600, 0.7268,
-  0.317400, 0.7346,
-  // f 456/134 477/154 457/133
-  0.317300, 0.7432,
-  0.312700, 0.7504,
-  0.317400, 0.7346,
-  // f 490/155 491/158 492/157 493/156
-  0.753300, 0.6098,
-  0.754400, 0.6117,
-  0.721100, 0.6059,
-  // f 490/155 491/158 492/157 493/156
-  0.753300, 0.6098,
-  0.720700, 0.5999,
-  0.721100, 0.6059,
-  // f 492/157 491/158 494/160 495/159
-  0.721100, 0.6059,
-  0.754400, 0.6117,
-  0.752700, 0.7022,
-  // f 492/157 491/158 494/160 495/159
-  0.721100, 0.6059,
-  0.719600, 0.7024,
-  0.752700, 0.7022,
-  // f 494/160 496/162 497/161 495/159
-  0.752700, 0.7022,
-  0.752600, 0.7028,
-  0.719000, 0.709,
-  // f 494/160 496/162 497/161 495/159
-  0.752700, 0.7022,
-  0.719600, 0.7024,
-  0.719000, 0.709,
-  // f 482/12 407/164 443/163 483/11
-  0.761700, 0.7815,
-  0.762800, 0.8592,
-  0.751800, 0.8519,
-  // f 482/12 407/164 443/163 483/11
-  0.761700, 0.7815,
-  0.752200, 0.7819,
-  0.751800, 0.8519,
-  // f 483/11 443/163 409/165 484/14
-  0.752200, 0.7819,
-  0.751800, 0.8519,
-  0.677800, 0.8023,
-  // f 483/11 443/163 409/165 484/14
-  0.752200, 0.7819,
-  0.679500, 0.7565,
-  0.677800, 0.8023,
-  // f 484/14 409/165 412/166 485/16
-  0.679500, 0.7565,
-  0.677800, 0.8023,
-  0.604800, 0.7648,
-  // f 484/14 409/165 412/166 485/16
-  0.679500, 0.7565,
-  0.608600, 0.7341,
-  0.604800, 0.7648,
-  // f 485/16 412/166 442/167 486/17
-  0.608600, 0.7341,
-  0.604800, 0.7648,
-  0.570800, 0.754,
-  // f 485/16 412/166 442/167 486/17
-  0.608600, 0.7341,
-  0.572600, 0.7293,
-  0.570800, 0.754,
-  // f 487/22 434/169 433/168 488/21
-  0.438900, 0.7313,
-  0.442400, 0.762,
-  0.370700, 0.7999,
-  // f 487/22 434/169 433/168 488/21
-  0.438900, 0.7313,
-  0.368500, 0.754,
-  0.370700, 0.7999,
-  // f 488/21 433/168 450/170 489/24
-  0.368500, 0.754,
-  0.370700, 0.7999,
-  0.297700, 0.8545,
-  // f 488/21 433/168 450/170 489/24
-  0.368500, 0.754,
-  0.296700, 0.7804,
-  0.297700, 0.8545,
-  // f 489/24 450/170 406/171 479/26
-  0.296700, 0.7804,
-  0.297700, 0.8545,
-  0.288200, 0.861,
-  // f 489/24 450/170 406/171 479/26
-  0.296700, 0.7804,
-  0.288100, 0.7804,
-  0.288200, 0.861,
-  // f 406/84 498/173 499/172 407/83
-  0.481700, 0.5738,
-  0.488000, 0.5768,
-  0.488600, 0.6438,
-  // f 406/84 498/173 499/172 407/83
-  0.481700, 0.5738,
-  0.482900, 0.6474,
-  0.488600, 0.6438,
-  // f 407/83 499/172 500/174 410/88
-  0.482900, 0.6474,
-  0.488600, 0.6438,
-  0.543700, 0.6665,
-  // f 407/83 499/172 500/174 410/88
-  0.482900, 0.6474,
-  0.543600, 0.6699,
-  0.543700, 0.6665,
-  // f 410/88 500/174 501/175 411/87
-  0.543600, 0.6699,
-  0.543700, 0.6665,
-  0.602800, 0.669,
-  // f 410/88 500/174 501/175 411/87
-  0.543600, 0.6699,
-  0.601500, 0.6736,
-  0.602800, 0.669,
-  // f 411/87 501/175 502/176 441/118
-  0.601500, 0.6736,
-  0.602800, 0.669,
-  0.628400, 0.6676,
-  // f 411/87 501/175 502/176 441/118
-  0.601500, 0.6736,
-  0.627800, 0.6733,
-  0.628400, 0.6676,
-  // f 435/111 503/178 504/177 436/110
-  0.601700, 0.5475,
-  0.602900, 0.552,
-  0.544100, 0.5544,
-  // f 435/111 503/178 504/177 436/110
-  0.601700, 0.5475,
-  0.544000, 0.551,
-  0.544100, 0.5544,
-  // f 436/110 504/177 498/173 406/84
-  0.544000, 0.551,
-  0.544100, 0.5544,
-  0.488000, 0.5768,
-  // f 436/110 504/177 498/173 406/84
-  0.544000, 0.551,
-  0.481700, 0.5738,
-  0.488000, 0.5768,
-  // f 498/173 446/122 447/123 499/172
-  0.488000, 0.5768,
-  0.509800, 0.5769,
-  0.509400, 0.6436,
-  // f 498/173 446/122 447/123 499/172
-  0.488000, 0.5768,
-  0.488600, 0.6438,
-  0.509400, 0.6436,
-  // f 447/123 432/106 500/174 499/172
-  0.509400, 0.6436,
-  0.558500, 0.6355,
-  0.543700, 0.6665,
-  // f 447/123 432/106 500/174 499/172
-  0.509400, 0.6436,
-  0.488600, 0.6438,
-  0.543700, 0.6665,
-  // f 500/174 432/106 431/107 501/175
-  0.543700, 0.6665,
-  0.558500, 0.6355,
-  0.601900, 0.6425,
-  // f 500/174 432/106 431/107 501/175
-  0.543700, 0.6665,
-  0.602800, 0.669,
-  0.601900, 0.6425,
-  // f 431/107 449/124 502/176 501/175
-  0.601900, 0.6425,
-  0.628000, 0.6429,
-  0.628400, 0.6676,
-  // f 431/107 449/124 502/176 501/175
-  0.601900, 0.6425,
-  0.602800, 0.669,
-  0.628400, 0.6676,
-  // f 503/178 430/108 429/105 504/177
-  0.602900, 0.552,
-  0.602100, 0.5784,
-  0.558800, 0.5855,
-  // f 503/178 430/108 429/105 504/177
-  0.602900, 0.552,
-  0.544100, 0.5544,
-  0.558800, 0.5855,
-  // f 504/177 429/105 446/122 498/173
-  0.544100, 0.5544,
-  0.558800, 0.5855,
-  0.509800, 0.5769,
-  // f 504/177 429/105 446/122 498/173
-  0.544100, 0.5544,
-  0.488000, 0.5768,
-  0.509800, 0.5769,
-  // f 479/4 505/180 506/179 480/3
-  0.714100, 0.5672,
-  0.721900, 0.5786,
-  0.709700, 0.5891,
-  // f 479/4 505/180 506/179 480/3
-  0.714100, 0.5672,
-  0.703400, 0.5873,
-  0.709700, 0.5891,
-  // f 480/3 506/179 507/181 481/6
-  0.703400, 0.5873,
-  0.709700, 0.5891,
-  0.708700, 0.7238,
-  // f 480/3 506/179 507/181 481/6
-  0.703400, 0.5873,
-  0.702300, 0.7253,
-  0.708700, 0.7238,
-  // f 481/6 507/181 508/182 482/8
-  0.702300, 0.7253,
-  0.708700, 0.7238,
-  0.719200, 0.733,
-  // f 481/6 507/181 508/182 482/8
-  0.702300, 0.7253,
-  0.710800, 0.744,
-  0.719200, 0.733,
-  // f 482/8 508/182 509/184 407/183
-  0.710800, 0.744,
-  0.719200, 0.733,
-  0.779500, 0.72,
-  // f 482/8 508/182 509/184 407/183
-  0.710800, 0.744,
-  0.816800, 0.7326,
-  0.779500, 0.72,
-  // f 407/183 509/184 510/186 408/185
-  0.816800, 0.7326,
-  0.779500, 0.72,
-  0.787200, 0.7094,
-  // f 407/183 509/184 510/186 408/185
-  0.816800, 0.7326,
-  0.816000, 0.7136,
-  0.787200, 0.7094,
-  // f 408/185 510/186 511/188 405/187
-  0.816000, 0.7136,
-  0.787200, 0.7094,
-  0.789300, 0.6067,
-  // f 408/185 510/186 511/188 405/187
-  0.816000, 0.7136,
-  0.820000, 0.604,
-  0.789300, 0.6067,
-  // f 405/187 511/188 512/190 406/189
-  0.820000, 0.604,
-  0.789300, 0.6067,
-  0.781800, 0.5945,
-  // f 405/187 511/188 512/190 406/189
-  0.820000, 0.604,
-  0.823100, 0.5856,
-  0.781800, 0.5945,
-  // f 406/189 512/190 505/180 479/4
-  0.823100, 0.5856,
-  0.781800, 0.5945,
-  0.721900, 0.5786,
-  // f 406/189 512/190 505/180 479/4
-  0.823100, 0.5856,
-  0.714100, 0.5672,
-  0.721900, 0.5786,
-  // f 493/156 492/157 506/179 505/180
-  0.720700, 0.5999,
-  0.721100, 0.6059,
-  0.709700, 0.5891,
-  // f 493/156 492/157 506/179 505/180
-  0.720700, 0.5999,
-  0.721900, 0.5786,
-  0.709700, 0.5891,
-  // f 506/179 492/157 495/159 507/181
-  0.709700, 0.5891,
-  0.721100, 0.6059,
-  0.719600, 0.7024,
-  // f 506/179 492/157 495/159 507/181
-  0.709700, 0.5891,
-  0.708700, 0.7238,
-  0.719600, 0.7024,
-  // f 495/159 497/161 508/182 507/181
-  0.719600, 0.7024,
-  0.719000, 0.709,
-  0.719200, 0.733,
-  // f 495/159 497/161 508/182 507/181
-  0.719600, 0.7024,
-  0.708700, 0.7238,
-  0.719200, 0.733,
-  // f 508/182 497/161 496/162 509/184
-  0.719200, 0.733,
-  0.719000, 0.709,
-  0.752600, 0.7028,
-  // f 508/182 497/161 496/162 509/184
-  0.719200, 0.733,
-  0.779500, 0.72,
-  0.752600, 0.7028,
-  // f 509/184 496/162 494/160 510/186
-  0.779500, 0.72,
-  0.752600, 0.7028,
-  0.752700, 0.7022,
-  // f 509/184 496/162 494/160 510/186
-  0.779500, 0.72,
-  0.787200, 0.7094,
-  0.752700, 0.7022,
-  // f 510/186 494/160 491/158 511/188
-  0.787200, 0.7094,
-  0.752700, 0.7022,
-  0.754400, 0.6117,
-  // f 510/186 494/160 491/158 511/188
-  0.787200, 0.7094,
-  0.789300, 0.6067,
-  0.754400, 0.6117,
-  // f 511/188 491/158 490/155 512/190
-  0.789300, 0.6067,
-  0.754400, 0.6117,
-  0.753300, 0.6098,
-  // f 511/188 491/158 490/155 512/190
-  0.789300, 0.6067,
-  0.781800, 0.5945,
-  0.753300, 0.6098,
-  // f 512/190 490/155 493/156 505/180
-  0.781800, 0.5945,
-  0.753300, 0.6098,
-  0.720700, 0.5999,
-  // f 512/190 490/155 493/156 505/180
-  0.781800, 0.5945,
-  0.721900, 0.5786,
-  0.720700, 0.5999,
-  // f 513/191 514/194 515/193 516/192
-  0.054900, 0.5128,
-  0.050600, 0.4623,
-  0.077400, 0.4686,
-  // f 513/191 514/194 515/193 516/192
-  0.054900, 0.5128,
-  0.082000, 0.51,
-  0.077400, 0.4686,
-  // f 517/195 518/198 519/197 520/196
-  0.087000, 0.6065,
-  0.063100, 0.6142,
-  0.052300, 0.5709,
-  // f 517/195 518/198 519/197 520/196
-  0.087000, 0.6065,
-  0.079600, 0.5722,
-  0.052300, 0.5709,
-  // f 521/199 522/200 518/198 517/195
-  0.093400, 0.6546,
-  0.070700, 0.6562,
-  0.063100, 0.6142,
-  // f 521/199 522/200 518/198 517/195
-  0.093400, 0.6546,
-  0.087000, 0.6065,
-  0.063100, 0.6142,
-  // f 523/201 524/204 525/203 526/202
-  0.085800, 0.4166,
-  0.064600, 0.4066,
-  0.079500, 0.3651,
-  // f 523/201 524/204 525/203 526/202
-  0.085800, 0.4166,
-  0.101000, 0.3743,
-  0.079500, 0.3651,
-  // f 527/205 528/206 524/204 523/201
-  0.077300, 0.4493,
-  0.050700, 0.4497,
-  0.064600, 0.4066,
-  // f 527/205 528/206 524/204 523/201
-  0.077300, 0.4493,
-  0.085800, 0.4166,
-  0.064600, 0.4066,
-  // f 529/207 530/210 531/209 532/208
-  0.684700, 0.0686,
-  0.660700, 0.0881,
-  0.649700, 0.0693,
-  // f 529/207 530/210 531/209 532/208
-  0.684700, 0.0686,
-  0.677200, 0.0446,
-  0.649700, 0.0693,
-  // f 533/211 534/214 535/213 536/212
-  0.683700, 0.0409,
-  0.725000, 0.0357,
-  0.725700, 0.0564,
-  // f 533/211 534/214 535/213 536/212
-  0.683700, 0.0409,
-  0.695200, 0.0629,
-  0.725700, 0.0564,
-  // f 534/214 537/216 538/215 535/213
-  0.725000, 0.0357,
-  0.778000, 0.027,
-  0.773700, 0.0528,
-  // f 534/214 537/216 538/215 535/213
-  0.725000, 0.0357,
-  0.725700, 0.0564,
-  0.773700, 0.0528,
-  // f 539/217 138/220 137/219 540/218
-  0.585000, 0.1917,
-  0.573600, 0.225,
-  0.552400, 0.2176,
-  // f 539/217 138/220 137/219 540/218
-  0.585000, 0.1917,
-  0.566200, 0.1841,
-  0.552400, 0.2176,
-  // f 540/218 541/222 542/221 539/217
-  0.566200, 0.1841,
-  0.592700, 0.1371,
-  0.611900, 0.1437,
-  // f 540/218 541/222 542/221 539/217
-  0.566200, 0.1841,
-  0.585000, 0.1917,
-  0.611900, 0.1437,
-  // f 541/222 543/224 544/223 542/221
-  0.592700, 0.1371,
-  0.607800, 0.0967,
-  0.628800, 0.1143,
-  // f 541/222 543/224 544/223 542/221
-  0.592700, 0.1371,
-  0.611900, 0.1437,
-  0.628800, 0.1143,
-  // f 545/225 546/228 547/227 548/226
-  0.048200, 0.513,
-  0.045400, 0.5597,
-  0.028800, 0.5607,
-  // f 545/225 546/228 547/227 548/226
-  0.048200, 0.513,
-  0.028800, 0.5135,
-  0.028800, 0.5607,
-  // f 516/229 515/231 549/230 530/210
-  0.676200, 0.1083,
-  0.651900, 0.1259,
-  0.634800, 0.1062,
-  // f 516/229 515/231 549/230 530/210
-  0.676200, 0.1083,
-  0.660700, 0.0881,
-  0.634800, 0.1062,
-  // f 550/232 551/235 552/234 553/233
-  0.027200, 0.5715,
-  0.045900, 0.572,
-  0.055400, 0.6173,
-  // f 550/232 551/235 552/234 553/233
-  0.027200, 0.5715,
-  0.031700, 0.6227,
-  0.055400, 0.6173,
-  // f 535/213 517/237 520/236 536/212
-  0.725700, 0.0564,
-  0.732000, 0.0806,
-  0.706700, 0.0854,
-  // f 535/213 517/237 520/236 536/212
-  0.725700, 0.0564,
-  0.695200, 0.0629,
-  0.706700, 0.0854,
-  // f 553/233 552/234 554/65 555/66
-  0.031700, 0.6227,
-  0.055400, 0.6173,
-  0.067100, 0.659,
-  // f 553/233 552/234 554/65 555/66
-  0.031700, 0.6227,
-  0.049900, 0.6832,
-  0.067100, 0.659,
-  // f 538/215 521/238 517/237 535/213
-  0.773700, 0.0528,
-  0.772400, 0.0722,
-  0.732000, 0.0806,
-  // f 538/215 521/238 517/237 535/213
-  0.773700, 0.0528,
-  0.725700, 0.0564,
-  0.732000, 0.0806,
-  // f 154/239 556/242 557/241 155/240
-  0.094000, 0.3273,
-  0.074200, 0.3609,
-  0.055200, 0.3398,
-  // f 154/239 556/242 557/241 155/240
-  0.094000, 0.3273,
-  0.078700, 0.3087,
-  0.055200, 0.3398,
-  // f 557/241 556/242 558/244 559/243
-  0.055200, 0.3398,
-  0.074200, 0.3609,
-  0.057900, 0.4031,
-  // f 557/241 556/242 558/244 559/243
-  0.055200, 0.3398,
-  0.034500, 0.396,
-  0.057900, 0.4031,
-  // f 542/221 523/246 526/245 539/217
-  0.611900, 0.1437,
-  0.633900, 0.1566,
-  0.613300, 0.1938,
-  // f 542/221 523/246 526/245 539/217
-  0.611900, 0.1437,
-  0.585000, 0.1917,
-  0.613300, 0.1938,
-  // f 559/243 558/244 560/248 561/247
-  0.034500, 0.396,
-  0.057900, 0.4031,
-  0.044800, 0.4487,
-  // f 559/243 558/244 560/248 561/247
-  0.034500, 0.396,
-  0.024300, 0.4484,
-  0.044800, 0.4487,
-  // f 544/223 527/249 523/246 542/221
-  0.628800, 0.1143,
-  0.646600, 0.1326,
-  0.633900, 0.1566,
-  // f 544/223 527/249 523/246 542/221
-  0.628800, 0.1143,
-  0.611900, 0.1437,
-  0.633900, 0.1566,
-  // f 513/191 516/192 562/251 563/250
-  0.054900, 0.5128,
-  0.082000, 0.51,
-  0.080300, 0.5521,
-  // f 513/191 516/192 562/251 563/250
-  0.054900, 0.5128,
-  0.052000, 0.5576,
-  0.080300, 0.5521,
-  // f 531/209 530/210 549/230 564/252
-  0.649700, 0.0693,
-  0.660700, 0.0881,
-  0.634800, 0.1062,
-  // f 531/209 530/210 549/230 564/252
-  0.649700, 0.0693,
-  0.613500, 0.092,
-  0.634800, 0.1062,
-  // f 565/253 545/225 548/226 566/254
-  0.043900, 0.4606,
-  0.048200, 0.513,
-  0.028800, 0.5135,
-  // f 565/253 545/225 548/226 566/254
-  0.043900, 0.4606,
-  0.025400, 0.459,
-  0.028800, 0.5135,
-  // f 562/255 516/229 530/210 529/207
-  0.699700, 0.0894,
-  0.676200, 0.1083,
-  0.660700, 0.0881,
-  // f 562/255 516/229 530/210 529/207
-  0.699700, 0.0894,
-  0.684700, 0.0686,
-  0.660700, 0.0881,
-  // f 514/194 513/191 545/225 565/253
-  0.050600, 0.4623,
-  0.054900, 0.5128,
-  0.048200, 0.513,
-  // f 514/194 513/191 545/225 565/253
-  0.050600, 0.4623,
-  0.043900, 0.4606,
-  0.048200, 0.513,
-  // f 519/197 518/198 552/234 551/235
-  0.052300, 0.5709,
-  0.063100, 0.6142,
-  0.055400, 0.6173,
-  // f 519/197 518/198 552/234 551/235
-  0.052300, 0.5709,
-  0.045900, 0.572,
-  0.055400, 0.6173,
-  // f 518/198 522/200 554/65 552/234
-  0.063100, 0.6142,
-  0.070700, 0.6562,
-  0.067100, 0.659,
-  // f 518/198 522/200 554/65 552/234
-  0.063100, 0.6142,
-  0.055400, 0.6173,
-  0.067100, 0.659,
-  // f 525/203 524/204 558/244 556/242
-  0.079500, 0.3651,
-  0.064600, 0.4066,
-  0.057900, 0.4031,
-  // f 525/203 524/204 558/244 556/242
-  0.079500, 0.3651,
-  0.074200, 0.3609,
-  0.057900, 0.4031,
-  // f 524/204 528/206 560/248 558/244
-  0.064600, 0.4066,
-  0.050700, 0.4497,
-  0.044800, 0.4487,
-  // f 524/204 528/206 560/248 558/244
-  0.064600, 0.4066,
-  0.057900, 0.4031,
-  0.044800, 0.4487,
-  // f 532/208 531/209 548/257 547/256
-  0.677200, 0.0446,
-  0.649700, 0.0693,
-  0.648700, 0.0672,
-  // f 532/208 531/209 548/257 547/256
-  0.677200, 0.0446,
-  0.676300, 0.0382,
-  0.648700, 0.0672,
-  // f 534/214 533/211 550/259 553/258
-  0.725000, 0.0357,
-  0.683700, 0.0409,
-  0.681500, 0.0351,
-  // f 534/214 533/211 550/259 553/258
-  0.725000, 0.0357,
-  0.725100, 0.0317,
-  0.681500, 0.0351,
-  // f 537/216 534/214 553/258 555/260
-  0.778000, 0.027,
-  0.725000, 0.0357,
-  0.725100, 0.0317,
-  // f 537/216 534/214 553/258 555/260
-  0.778000, 0.027,
-  0.779600, 0.023,
-  0.725100, 0.0317,
-  // f 540/218 137/219 155/262 557/261
-  0.566200, 0.1841,
-  0.552400, 0.2176,
-  0.548700, 0.2158,
-  // f 540/218 137/219 155/262 557/261
-  0.566200, 0.1841,
-  0.562300, 0.1827,
-  0.548700, 0.2158,
-  // f 541/222 540/218 557/261 559/263
-  0.592700, 0.1371,
-  0.566200, 0.1841,
-  0.562300, 0.1827,
-  // f 541/222 540/218 557/261 559/263
-  0.592700, 0.1371,
-  0.589200, 0.136,
-  0.562300, 0.1827,
-  // f 543/224 541/222 559/263 561/264
-  0.607800, 0.0967,
-  0.592700, 0.1371,
-  0.589200, 0.136,
-  // f 543/224 541/222 559/263 561/264
-  0.607800, 0.0967,
-  0.603600, 0.0928,
-  0.589200, 0.136,
-  // f 513/191 563/250 546/228 545/225
-  0.054900, 0.5128,
-  0.052000, 0.5576,
-  0.045400, 0.5597,
-  // f 513/191 563/250 546/228 545/225
-  0.054900, 0.5128,
-  0.048200, 0.513,
-  0.045400, 0.5597,
-  // f 531/209 564/252 566/265 548/257
-  0.649700, 0.0693,
-  0.613500, 0.092,
-  0.608000, 0.0893,
-  // f 531/209 564/252 566/265 548/257
-  0.649700, 0.0693,
-  0.648700, 0.0672,
-  0.608000, 0.0893,
-  // f 563/250 562/251 520/196 519/197
-  0.052000, 0.5576,
-  0.080300, 0.5521,
-  0.079600, 0.5722,
-  // f 563/250 562/251 520/196 519/197
-  0.052000, 0.5576,
-  0.052300, 0.5709,
-  0.079600, 0.5722,
-  // f 515/193 514/194 528/206 527/205
-  0.077400, 0.4686,
-  0.050600, 0.4623,
-  0.050700, 0.4497,
-  // f 515/193 514/194 528/206 527/205
-  0.077400, 0.4686,
-  0.077300, 0.4493,
-  0.050700, 0.4497,
-  // f 529/207 532/208 533/211 536/212
-  0.684700, 0.0686,
-  0.677200, 0.0446,
-  0.683700, 0.0409,
-  // f 529/207 532/208 533/211 536/212
-  0.684700, 0.0686,
-  0.695200, 0.0629,
-  0.683700, 0.0409,
-  // f 564/252 549/230 544/223 543/224
-  0.613500, 0.092,
-  0.634800, 0.1062,
-  0.628800, 0.1143,
-  // f 564/252 549/230 544/223 543/224
-  0.613500, 0.092,
-  0.607800, 0.0967,
-  0.628800, 0.1143,
-  // f 565/253 566/254 561/247 560/248
-  0.043900, 0.4606,
-  0.025400, 0.459,
-  0.024300, 0.4484,
-  // f 565/253 566/254 561/247 560/248
-  0.043900, 0.4606,
-  0.044800, 0.4487,
-  0.024300, 0.4484,
-  // f 547/227 546/228 551/235 550/232
-  0.028800, 0.5607,
-  0.045400, 0.5597,
-  0.045900, 0.572,
-  // f 547/227 546/228 551/235 550/232
-  0.028800, 0.5607,
-  0.027200, 0.5715,
-  0.045900, 0.572,
-  // f 562/255 529/207 536/212 520/236
-  0.699700, 0.0894,
-  0.684700, 0.0686,
-  0.695200, 0.0629,
-  // f 562/255 529/207 536/212 520/236
-  0.699700, 0.0894,
-  0.706700, 0.0854,
-  0.695200, 0.0629,
-  // f 549/230 515/231 527/249 544/223
-  0.634800, 0.1062,
-  0.651900, 0.1259,
-  0.646600, 0.1326,
-  // f 549/230 515/231 527/249 544/223
-  0.634800, 0.1062,
-  0.628800, 0.1143,
-  0.646600, 0.1326,
-  // f 560/248 528/206 514/194 565/253
-  0.044800, 0.4487,
-  0.050700, 0.4497,
-  0.050600, 0.4623,
-  // f 560/248 528/206 514/194 565/253
-  0.044800, 0.4487,
-  0.043900, 0.4606,
-  0.050600, 0.4623,
-  // f 546/228 563/250 519/197 551/235
-  0.045400, 0.5597,
-  0.052000, 0.5576,
-  0.052300, 0.5709,
-  // f 546/228 563/250 519/197 551/235
-  0.045400, 0.5597,
-  0.045900, 0.572,
-  0.052300, 0.5709,
-  // f 543/224 561/264 566/265 564/252
-  0.607800, 0.0967,
-  0.603600, 0.0928,
-  0.608000, 0.0893,
-  // f 543/224 561/264 566/265 564/252
-  0.607800, 0.0967,
-  0.613500, 0.092,
-  0.608000, 0.0893,
-  // f 532/208 547/256 550/259 533/211
-  0.677200, 0.0446,
-  0.676300, 0.0382,
-  0.681500, 0.0351,
-  // f 532/208 547/256 550/259 533/211
-  0.677200, 0.0446,
-  0.683700, 0.0409,
-  0.681500, 0.0351,
-  // f 567/266 568/269 569/268 570/267
-  0.757500, 0.3852,
-  0.751200, 0.3787,
-  0.721800, 0.3787,
-  // f 567/266 568/269 569/268 570/267
-  0.757500, 0.3852,
-  0.731000, 0.3852,
-  0.721800, 0.3787,
-  // f 570/267 569/268 571/271 572/270
-  0.731000, 0.3852,
-  0.721800, 0.3787,
-  0.694100, 0.3887,
-  // f 570/267 569/268 571/271 572/270
-  0.731000, 0.3852,
-  0.706000, 0.3942,
-  0.694100, 0.3887,
-  // f 572/270 571/271 573/273 574/272
-  0.706000, 0.3942,
-  0.694100, 0.3887,
-  0.671500, 0.4075,
-  // f 572/270 571/271 573/273 574/272
-  0.706000, 0.3942,
-  0.685700, 0.411,
-  0.671500, 0.4075,
-  // f 574/272 573/273 575/275 576/274
-  0.685700, 0.411,
-  0.671500, 0.4075,
-  0.656800, 0.4327,
-  // f 574/272 573/273 575/275 576/274
-  0.685700, 0.411,
-  0.672400, 0.4338,
-  0.656800, 0.4327,
-  // f 576/274 575/275 577/277 578/276
-  0.672400, 0.4338,
-  0.656800, 0.4327,
-  0.651700, 0.4615,
-  // f 576/274 575/275 577/277 578/276
-  0.672400, 0.4338,
-  0.667800, 0.4597,
-  0.651700, 0.4615,
-  // f 578/276 577/277 579/279 580/278
-  0.667800, 0.4597,
-  0.651700, 0.4615,
-  0.656800, 0.4902,
-  // f 578/276 577/277 579/279 580/278
-  0.667800, 0.4597,
-  0.672400, 0.4856,
-  0.656800, 0.4902,
-  // f 580/278 579/279 581/281 582/280
-  0.672400, 0.4856,
-  0.656800, 0.4902,
-  0.671500, 0.5155,
-  // f 580/278 579/279 581/281 582/280
-  0.672400, 0.4856,
-  0.685700, 0.5084,
-  0.671500, 0.5155,
-  // f 582/280 581/281 583/283 584/282
-  0.685700, 0.5084,
-  0.671500, 0.5155,
-  0.694100, 0.5343,
-  // f 582/280 581/281 583/283 584/282
-  0.685700, 0.5084,
-  0.706000, 0.5253,
-  0.694100, 0.5343,
-  // f 584/282 583/283 585/285 586/284
-  0.706000, 0.5253,
-  0.694100, 0.5343,
-  0.721800, 0.5442,
-  // f 584/282 583/283 585/285 586/284
-  0.706000, 0.5253,
-  0.731000, 0.5343,
-  0.721800, 0.5442,
-  // f 586/284 585/285 587/287 588/286
-  0.731000, 0.5343,
-  0.721800, 0.5442,
-  0.751200, 0.5442,
-  // f 586/284 585/285 587/287 588/286
-  0.731000, 0.5343,
-  0.757500, 0.5343,
-  0.751200, 0.5442,
-  // f 588/286 587/287 589/289 590/288
-  0.757500, 0.5343,
-  0.751200, 0.5442,
-  0.778900, 0.5343,
-  // f 588/286 587/287 589/289 590/288
-  0.757500, 0.5343,
-  0.782500, 0.5253,
-  0.778900, 0.5343,
-  // f 590/288 589/289 591/291 592/290
-  0.782500, 0.5253,
-  0.778900, 0.5343,
-  0.803500, 0.5173,
-  // f 590/288 589/289 591/291 592/290
-  0.782500, 0.5253,
-  0.804600, 0.5099,
-  0.803500, 0.5173,
-  // f 193/292 592/290 591/291 194/293
-  0.822100, 0.4945,
-  0.804600, 0.5099,
-  0.803500, 0.5173,
-  // f 193/292 592/290 591/291 194/293
-  0.822100, 0.4945,
-  0.822900, 0.5001,
-  0.803500, 0.5173,
-  // f 593/297 594/310 595/308 596/296
-  0.298500, 0.3982,
-  0.292900, 0.4069,
-  0.284200, 0.4134,
-  // f 593/297 594/310 595/308 596/296
-  0.298500, 0.3982,
-  0.284200, 0.3633,
-  0.284200, 0.4134,
-  // f 595/308 597/309 598/307 599/304
-  0.284200, 0.4134,
-  0.273500, 0.4169,
-  0.262000, 0.4169,
-  // f 595/308 597/309 598/307 599/304
-  0.284200, 0.4134,
-  0.242600, 0.4069,
-  0.262000, 0.4169,
-  // f 598/307 600/306 599/304
-  0.262000, 0.4169,
-  0.251300, 0.4134,
-  0.242600, 0.4069,
-  // f 599/304 601/305 602/303 603/300
-  0.242600, 0.4069,
-  0.237000, 0.3982,
-  0.235100, 0.3883,
-  // f 599/304 601/305 602/303 603/300
-  0.242600, 0.4069,
-  0.242600, 0.3698,
-  0.235100, 0.3883,
-  // f 602/303 604/302 603/300
-  0.235100, 0.3883,
-  0.237000, 0.3785,
-  0.242600, 0.3698,
-  // f 595/308 599/304 603/300 596/296
-  0.284200, 0.4134,
-  0.242600, 0.4069,
-  0.242600, 0.3698,
-  // f 595/308 599/304 603/300 596/296
-  0.284200, 0.4134,
-  0.284200, 0.3633,
-  0.242600, 0.3698,
-  // f 603/300 605/301 606/299 596/296
-  0.242600, 0.3698,
-  0.251300, 0.3633,
-  0.262000, 0.3598,
-  // f 603/300 605/301 606/299 596/296
-  0.242600, 0.3698,
-  0.284200, 0.3633,
-  0.262000, 0.3598,
-  // f 606/299 607/298 596/296
-  0.262000, 0.3598,
-  0.273500, 0.3598,
-  0.284200, 0.3633,
-  // f 596/296 608/295 609/294 593/297
-  0.284200, 0.3633,
-  0.292900, 0.3698,
-  0.298500, 0.3785,
-  // f 596/296 608/295 609/294 593/297
-  0.284200, 0.3633,
-  0.298500, 0.3982,
-  0.298500, 0.3785,
-  // f 610/311 593/297 609/294
-  0.300500, 0.3883,
-  0.298500, 0.3982,
-  0.298500, 0.3785,
-  // f 568/269 611/313 612/312 569/268
-  0.751200, 0.3787,
-  0.753900, 0.3991,
-  0.734600, 0.3991,
-  // f 568/269 611/313 612/312 569/268
-  0.751200, 0.3787,
-  0.721800, 0.3787,
-  0.734600, 0.3991,
-  // f 569/268 612/312 613/314 571/271
-  0.721800, 0.3787,
-  0.734600, 0.3991,
-  0.716300, 0.4057,
-  // f 569/268 612/312 613/314 571/271
-  0.721800, 0.3787,
-  0.694100, 0.3887,
-  0.716300, 0.4057,
-  // f 571/271 613/314 614/315 573/273
-  0.694100, 0.3887,
-  0.716300, 0.4057,
-  0.701500, 0.418,
-  // f 571/271 613/314 614/315 573/273
-  0.694100, 0.3887,
-  0.671500, 0.4075,
-  0.701500, 0.418,
-  // f 573/273 614/315 615/316 575/275
-  0.671500, 0.4075,
-  0.701500, 0.418,
-  0.691800, 0.4346,
-  // f 573/273 614/315 615/316 575/275
-  0.671500, 0.4075,
-  0.656800, 0.4327,
-  0.691800, 0.4346,
-  // f 575/275 615/316 616/317 577/277
-  0.656800, 0.4327,
-  0.691800, 0.4346,
-  0.688400, 0.4535,
-  // f 575/275 615/316 616/317 577/277
-  0.656800, 0.4327,
-  0.651700, 0.4615,
-  0.688400, 0.4535,
-  // f 577/277 616/317 617/318 579/279
-  0.651700, 0.4615,
-  0.688400, 0.4535,
-  0.691800, 0.4724,
-  // f 577/277 616/317 617/318 579/279
-  0.651700, 0.4615,
-  0.656800, 0.4902,
-  0.691800, 0.4724,
-  // f 579/279 617/318 618/319 581/281
-  0.656800, 0.4902,
-  0.691800, 0.4724,
-  0.701500, 0.4891,
-  // f 579/279 617/318 618/319 581/281
-  0.656800, 0.4902,
-  0.671500, 0.5155,
-  0.701500, 0.4891,
-  // f 581/281 618/319 619/320 583/283
-  0.671500, 0.5155,
-  0.701500, 0.4891,
-  0.716300, 0.5014,
-  // f 581/281 618/319 619/320 583/283
-  0.671500, 0.5155,
-  0.694100, 0.5343,
-  0.716300, 0.5014,
-  // f 583/283 619/320 620/321 585/285
-  0.694100, 0.5343,
-  0.716300, 0.5014,
-  0.734600, 0.508,
-  // f 583/283 619/320 620/321 585/285
-  0.694100, 0.5343,
-  0.721800, 0.5442,
-  0.734600, 0.508,
-  // f 585/285 620/321 621/322 587/287
-  0.721800, 0.5442,
-  0.734600, 0.508,
-  0.753900, 0.508,
-  // f 585/285 620/321 621/322 587/287
-  0.721800, 0.5442,
-  0.751200, 0.5442,
-  0.753900, 0.508,
-  // f 587/287 621/322 622/323 589/289
-  0.751200, 0.5442,
-  0.753900, 0.508,
-  0.772200, 0.5014,
-  // f 587/287 621/322 622/323 589/289
-  0.751200, 0.5442,
-  0.778900, 0.5343,
-  0.772200, 0.5014,
-  // f 589/289 622/323 623/324 591/291
-  0.778900, 0.5343,
-  0.772200, 0.5014,
-  0.787000, 0.4891,
-  // f 589/289 622/323 623/324 591/291
-  0.778900, 0.5343,
-  0.803500, 0.5173,
-  0.787000, 0.4891,
-  // f 624/326 226/325 194/293 623/324
-  0.796700, 0.4724,
-  0.822100, 0.486,
-  0.822900, 0.5001,
-  // f 624/326 226/325 194/293 623/324
-  0.796700, 0.4724,
-  0.787000, 0.4891,
-  0.822900, 0.5001,
-  // f 591/291 623/324 194/293
-  0.803500, 0.5173,
-  0.787000, 0.4891,
-  0.822900, 0.5001,
-  // f 625/327 610/311 609/294 626/328
-  0.303400, 0.3883,
-  0.300500, 0.3883,
-  0.298500, 0.3785,
-  // f 625/327 610/311 609/294 626/328
-  0.303400, 0.3883,
-  0.301200, 0.377,
-  0.298500, 0.3785,
-  // f 626/328 609/294 608/295 627/329
-  0.301200, 0.377,
-  0.298500, 0.3785,
-  0.292900, 0.3698,
-  // f 626/328 609/294 608/295 627/329
-  0.301200, 0.377,
-  0.295000, 0.3672,
-  0.292900, 0.3698,
-  // f 627/329 608/295 596/296 628/330
-  0.295000, 0.3672,
-  0.292900, 0.3698,
-  0.284200, 0.3633,
-  // f 627/329 608/295 596/296 628/330
-  0.295000, 0.3672,
-  0.285500, 0.3599,
-  0.284200, 0.3633,
-  // f 628/330 596/296 607/298 611/331
-  0.285500, 0.3599,
-  0.284200, 0.3633,
-  0.273500, 0.3598,
-  // f 628/330 596/296 607/298 611/331
-  0.285500, 0.3599,
-  0.273900, 0.3561,
-  0.273500, 0.3598,
-  // f 611/331 607/298 606/299 612/332
-  0.273900, 0.3561,
-  0.273500, 0.3598,
-  0.262000, 0.3598,
-  // f 611/331 607/298 606/299 612/332
-  0.273900, 0.3561,
-  0.261600, 0.3561,
-  0.262000, 0.3598,
-  // f 612/332 606/299 605/301 613/333
-  0.261600, 0.3561,
-  0.262000, 0.3598,
-  0.251300, 0.3633,
-  // f 612/332 606/299 605/301 613/333
-  0.261600, 0.3561,
-  0.250000, 0.3599,
-  0.251300, 0.3633,
-  // f 613/333 605/301 603/300 614/334
-  0.250000, 0.3599,
-  0.251300, 0.3633,
-  0.242600, 0.3698,
-  // f 613/333 605/301 603/300 614/334
-  0.250000, 0.3599,
-  0.240500, 0.3672,
-  0.242600, 0.3698,
-  // f 614/334 603/300 604/302 615/335
-  0.240500, 0.3672,
-  0.242600, 0.3698,
-  0.237000, 0.3785,
-  // f 614/334 603/300 604/302 615/335
-  0.240500, 0.3672,
-  0.234300, 0.377,
-  0.237000, 0.3785,
-  // f 615/335 604/302 602/303 616/336
-  0.234300, 0.377,
-  0.237000, 0.3785,
-  0.235100, 0.3883,
-  // f 615/335 604/302 602/303 616/336
-  0.234300, 0.377,
-  0.232100, 0.3883,
-  0.235100, 0.3883,
-  // f 616/336 602/303 601/305 617/337
-  0.232100, 0.3883,
-  0.235100, 0.3883,
-  0.237000, 0.3982,
-  // f 616/336 602/303 601/305 617/337
-  0.232100, 0.3883,
-  0.234300, 0.3996,
-  0.237000, 0.3982,
-  // f 617/337 601/305 599/304 618/338
-  0.234300, 0.3996,
-  0.237000, 0.3982,
-  0.242600, 0.4069,
-  // f 617/337 601/305 599/304 618/338
-  0.234300, 0.3996,
-  0.240500, 0.4095,
-  0.242600, 0.4069,
-  // f 618/338 599/304 600/306 619/339
-  0.240500, 0.4095,
-  0.242600, 0.4069,
-  0.251300, 0.4134,
-  // f 618/338 599/304 600/306 619/339
-  0.240500, 0.4095,
-  0.250000, 0.4168,
-  0.251300, 0.4134,
-  // f 619/339 600/306 598/307 620/340
-  0.250000, 0.4168,
-  0.251300, 0.4134,
-  0.262000, 0.4169,
-  // f 619/339 600/306 598/307 620/340
-  0.250000, 0.4168,
-  0.261600, 0.4205,
-  0.262000, 0.4169,
-  // f 620/340 598/307 597/309 621/341
-  0.261600, 0.4205,
-  0.262000, 0.4169,
-  0.273500, 0.4169,
-  // f 620/340 598/307 597/309 621/341
-  0.261600, 0.4205,
-  0.273900, 0.4205,
-  0.273500, 0.4169,
-  // f 621/341 597/309 595/308 622/342
-  0.273900, 0.4205,
-  0.273500, 0.4169,
-  0.284200, 0.4134,
-  // f 621/341 597/309 595/308 622/342
-  0.273900, 0.4205,
-  0.285500, 0.4168,
-  0.284200, 0.4134,
-  // f 622/342 595/308 594/310 623/343
-  0.285500, 0.4168,
-  0.284200, 0.4134,
-  0.292900, 0.4069,
-  // f 622/342 595/308 594/310 623/343
-  0.285500, 0.4168,
-  0.295000, 0.4095,
-  0.292900, 0.4069,
-  // f 623/343 594/310 593/297 624/344
-  0.295000, 0.4095,
-  0.292900, 0.4069,
-  0.298500, 0.3982,
-  // f 623/343 594/310 593/297 624/344
-  0.295000, 0.4095,
-  0.301200, 0.3996,
-  0.298500, 0.3982,
-  // f 624/344 593/297 610/311 625/327
-  0.301200, 0.3996,
-  0.298500, 0.3982,
-  0.300500, 0.3883,
-  // f 624/344 593/297 610/311 625/327
-  0.301200, 0.3996,
-  0.303400, 0.3883,
-  0.300500, 0.3883,
-  // f 232/345 629/348 630/347 233/346
-  0.734500, 0.2795,
-  0.748400, 0.3191,
-  0.738600, 0.3242,
-  // f 232/345 629/348 630/347 233/346
-  0.734500, 0.2795,
-  0.724200, 0.2808,
-  0.738600, 0.3242,
-  // f 236/349 631/36 629/348 232/345
-  0.740200, 0.279,
-  0.756500, 0.3183,
-  0.748400, 0.3191,
-  // f 236/349 631/36 629/348 232/345
-  0.740200, 0.279,
-  0.734500, 0.2795,
-  0.748400, 0.3191,
-  // f 632/28 633/40 634/41 635/27
-  0.753900, 0.3404,
-  0.747800, 0.3378,
-  0.753400, 0.3299,
-  // f 632/28 633/40 634/41 635/27
-  0.753900, 0.3404,
-  0.757600, 0.3306,
-  0.753400, 0.3299,
-  // f 636/39 630/347 629/348 637/42
-  0.743300, 0.3335,
-  0.738600, 0.3242,
-  0.748400, 0.3191,
-  // f 636/39 630/347 629/348 637/42
-  0.743300, 0.3335,
-  0.751100, 0.3272,
-  0.748400, 0.3191,
-  // f 629/348 631/36 637/42
-  0.748400, 0.3191,
-  0.756500, 0.3183,
-  0.751100, 0.3272,
-  // f 633/350 638/32 636/351
-  0.876100, 0.3314,
-  0.871400, 0.321,
-  0.878700, 0.3288,
-  // f 636/351 638/32 630/352
-  0.878700, 0.3288,
-  0.871400, 0.321,
-  0.879100, 0.3214,
-  // f 634/41 631/36 635/27
-  0.753400, 0.3299,
-  0.756500, 0.3183,
-  0.757600, 0.3306,
-  // f 631/36 634/41 637/42
-  0.756500, 0.3183,
-  0.753400, 0.3299,
-  0.751100, 0.3272,
-  // f 654/353 655/356 656/355 657/354
-  0.082000, 0.6872,
-  0.061300, 0.6906,
-  0.072000, 0.6659,
-  // f 654/353 655/356 656/355 657/354
-  0.082000, 0.6872,
-  0.085100, 0.6673,
-  0.072000, 0.6659,
-  // f 658/67 659/68 656/355 655/356
-  0.058500, 0.6883,
-  0.069800, 0.6676,
-  0.072000, 0.6659,
-  // f 658/67 659/68 656/355 655/356
-  0.058500, 0.6883,
-  0.061300, 0.6906,
-  0.072000, 0.6659,
-  // f 521/199 657/354 656/355 522/200
-  0.093400, 0.6546,
-  0.085100, 0.6673,
-  0.072000, 0.6659,
-  // f 521/199 657/354 656/355 522/200
-  0.093400, 0.6546,
-  0.070700, 0.6562,
-  0.072000, 0.6659,
-  // f 522/200 656/355 659/68 554/65
-  0.070700, 0.6562,
-  0.072000, 0.6659,
-  0.069800, 0.6676,
-  // f 522/200 656/355 659/68 554/65
-  0.070700, 0.6562,
-  0.067100, 0.659,
-  0.069800, 0.6676,
-  // f 555/260 658/358 655/357 537/216
-  0.779600, 0.023,
-  0.784700, 0.0274,
-  0.784000, 0.0294,
-  // f 555/260 658/358 655/357 537/216
-  0.779600, 0.023,
-  0.778000, 0.027,
-  0.784000, 0.0294,
-  // f 537/216 655/357 654/359 538/215
-  0.778000, 0.027,
-  0.784000, 0.0294,
-  0.782000, 0.0493,
-  // f 537/216 655/357 654/359 538/215
-  0.778000, 0.027,
-  0.773700, 0.0528,
-  0.782000, 0.0493,
-  // f 538/215 654/359 657/360 521/238
-  0.773700, 0.0528,
-  0.782000, 0.0493,
-  0.782900, 0.0679999999999999,
-  // f 538/215 654/359 657/360 521/238
-  0.773700, 0.0528,
-  0.772400, 0.0722,
-  0.782900, 0.0679999999999999,
-  // f 442/117 441/118 267/362 266/361
-  0.628600, 0.6768,
-  0.627800, 0.6733,
-  0.653500, 0.673,
-  // f 442/117 441/118 267/362 266/361
-  0.628600, 0.6768,
-  0.653500, 0.6767,
-  0.653500, 0.673,
-  // f 445/120 444/121 269/364 268/363
-  0.936300, 0.2539,
-  0.911700, 0.2563,
-  0.910000, 0.2121,
-  // f 445/120 444/121 269/364 268/363
-  0.936300, 0.2539,
-  0.932200, 0.21,
-  0.910000, 0.2121,
-  // f 449/124 448/125 271/366 270/365
-  0.628000, 0.6429,
-  0.628100, 0.5779,
-  0.653200, 0.5774,
-  // f 449/124 448/125 271/366 270/365
-  0.628000, 0.6429,
-  0.653200, 0.6433,
-  0.653200, 0.5774,
-  // f 272/367 451/127 452/128 273/368
-  0.652900, 0.5482,
-  0.627800, 0.5479,
-  0.628600, 0.5459,
-  // f 272/367 451/127 452/128 273/368
-  0.652900, 0.5482,
-  0.652800, 0.5452,
-  0.628600, 0.5459,
-  // f 274/369 453/129 454/130 275/370
-  0.942500, 0.9588,
-  0.942100, 0.9149,
-  0.966800, 0.9161,
-  // f 274/369 453/129 454/130 275/370
-  0.942500, 0.9588,
-  0.964700, 0.9603,
-  0.966800, 0.9161,
-  // f 486/17 442/167 266/371 276/70
-  0.572600, 0.7293,
-  0.570800, 0.754,
-  0.537700, 0.7435,
-  // f 486/17 442/167 266/371 276/70
-  0.572600, 0.7293,
-  0.538200, 0.7247,
-  0.537700, 0.7435,
-  // f 441/118 502/176 266/372 267/362
-  0.627800, 0.6733,
-  0.628400, 0.6676,
-  0.653500, 0.6663,
-  // f 441/118 502/176 266/372 267/362
-  0.627800, 0.6733,
-  0.653500, 0.673,
-  0.653500, 0.6663,
-  // f 266/372 502/176 449/124 270/365
-  0.653500, 0.6663,
-  0.628400, 0.6676,
-  0.628000, 0.6429,
-  // f 266/372 502/176 449/124 270/365
-  0.653500, 0.6663,
-  0.653200, 0.6433,
-  0.628000, 0.6429,
-  // f 487/22 660/71 452/373 434/169
-  0.438900, 0.7313,
-  0.474800, 0.7276,
-  0.476400, 0.7523,
-  // f 487/22 660/71 452/373 434/169
-  0.438900, 0.7313,
-  0.442400, 0.762,
-  0.476400, 0.7523,
-  // f 435/111 451/127 661/374 503/178
-  0.601700, 0.5475,
-  0.627800, 0.5479,
-  0.628500, 0.5533,
-  // f 435/111 451/127 661/374 503/178
-  0.601700, 0.5475,
-  0.602900, 0.552,
-  0.628500, 0.5533,
-  // f 503/178 661/374 448/125 430/108
-  0.602900, 0.552,
-  0.628500, 0.5533,
-  0.628100, 0.5779,
-  // f 503/178 661/374 448/125 430/108
-  0.602900, 0.552,
-  0.602100, 0.5784,
-  0.628100, 0.5779,
-  // f 663/375 664/378 665/377 666/376
-  0.213100, 0.4272,
-  0.191000, 0.4272,
-  0.189200, 0.4172,
-  // f 663/375 664/378 665/377 666/376
-  0.213100, 0.4272,
-  0.210000, 0.4096,
-  0.189200, 0.4172,
-  // f 666/376 665/377 667/380 668/379
-  0.210000, 0.4096,
-  0.189200, 0.4172,
-  0.184100, 0.4084,
-  // f 666/376 665/377 667/380 668/379
-  0.210000, 0.4096,
-  0.201100, 0.3942,
-  0.184100, 0.4084,
-  // f 668/379 667/380 669/382 670/381
-  0.201100, 0.3942,
-  0.184100, 0.4084,
-  0.176400, 0.4018,
-  // f 668/379 667/380 669/382 670/381
-  0.201100, 0.3942,
-  0.187400, 0.3827,
-  0.176400, 0.4018,
-  // f 670/381 669/382 671/384 672/383
-  0.187400, 0.3827,
-  0.176400, 0.4018,
-  0.166800, 0.3984,
-  // f 670/381 669/382 671/384 672/383
-  0.187400, 0.3827,
-  0.170600, 0.3766,
-  0.166800, 0.3984,
-  // f 672/383 671/384 673/386 674/385
-  0.170600, 0.3766,
-  0.166800, 0.3984,
-  0.156600, 0.3984,
-  // f 672/383 671/384 673/386 674/385
-  0.170600, 0.3766,
-  0.152800, 0.3766,
-  0.156600, 0.3984,
-  // f 674/385 673/386 675/388 676/387
-  0.152800, 0.3766,
-  0.156600, 0.3984,
-  0.147100, 0.4018,
-  // f 674/385 673/386 675/388 676/387
-  0.152800, 0.3766,
-  0.136000, 0.3827,
-  0.147100, 0.4018,
-  // f 676/387 675/388 677/390 678/389
-  0.136000, 0.3827,
-  0.147100, 0.4018,
-  0.139300, 0.4084,
-  // f 676/387 675/388 677/390 678/389
-  0.136000, 0.3827,
-  0.122300, 0.3942,
-  0.139300, 0.4084,
-  // f 678/389 677/390 679/392 680/391
-  0.122300, 0.3942,
-  0.139300, 0.4084,
-  0.134200, 0.4172,
-  // f 678/389 677/390 679/392 680/391
-  0.122300, 0.3942,
-  0.113400, 0.4096,
-  0.134200, 0.4172,
-  // f 680/391 679/392 681/394 682/393
-  0.113400, 0.4096,
-  0.134200, 0.4172,
-  0.132400, 0.4272,
-  // f 680/391 679/392 681/394 682/393
-  0.113400, 0.4096,
-  0.110300, 0.4272,
-  0.132400, 0.4272,
-  // f 682/393 681/394 683/396 684/395
-  0.110300, 0.4272,
-  0.132400, 0.4272,
-  0.134200, 0.4372,
-  // f 682/393 681/394 683/396 684/395
-  0.110300, 0.4272,
-  0.113400, 0.4448,
-  0.134200, 0.4372,
-  // f 684/395 683/396 685/398 686/397
-  0.113400, 0.4448,
-  0.134200, 0.4372,
-  0.139300, 0.446,
-  // f 684/395 683/396 685/398 686/397
-  0.113400, 0.4448,
-  0.122300, 0.4602,
-  0.139300, 0.446,
-  // f 686/397 685/398 687/400 688/399
-  0.122300, 0.4602,
-  0.139300, 0.446,
-  0.147100, 0.4526,
-  // f 686/397 685/398 687/400 688/399
-  0.122300, 0.4602,
-  0.136000, 0.4717,
-  0.147100, 0.4526,
-  // f 688/399 687/400 689/402 690/401
-  0.136000, 0.4717,
-  0.147100, 0.4526,
-  0.156600, 0.456,
-  // f 688/399 687/400 689/402 690/401
-  0.136000, 0.4717,
-  0.152800, 0.4778,
-  0.156600, 0.456,
-  // f 690/401 689/402 691/404 692/403
-  0.152800, 0.4778,
-  0.156600, 0.456,
-  0.166800, 0.456,
-  // f 690/401 689/402 691/404 692/403
-  0.152800, 0.4778,
-  0.170600, 0.4778,
-  0.166800, 0.456,
-  // f 692/403 691/404 693/406 694/405
-  0.170600, 0.4778,
-  0.166800, 0.456,
-  0.176400, 0.4526,
-  // f 692/403 691/404 693/406 694/405
-  0.170600, 0.4778,
-  0.187400, 0.4717,
-  0.176400, 0.4526,
-  // f 694/405 693/406 695/408 696/407
-  0.187400, 0.4717,
-  0.176400, 0.4526,
-  0.184100, 0.446,
-  // f 694/405 693/406 695/408 696/407
-  0.187400, 0.4717,
-  0.201100, 0.4602,
-  0.184100, 0.446,
-  // f 696/407 695/408 697/410 698/409
-  0.201100, 0.4602,
-  0.184100, 0.446,
-  0.189200, 0.4372,
-  // f 696/407 695/408 697/410 698/409
-  0.201100, 0.4602,
-  0.210000, 0.4448,
-  0.189200, 0.4372,
-  // f 698/409 697/410 664/378 663/375
-  0.210000, 0.4448,
-  0.189200, 0.4372,
-  0.191000, 0.4272,
-  // f 698/409 697/410 664/378 663/375
-  0.210000, 0.4448,
-  0.213100, 0.4272,
-  0.191000, 0.4272,
-  // f 699/414 700/427 701/425 702/413
-  0.598300, 0.8988,
-  0.594200, 0.906,
-  0.587800, 0.9113,
-  // f 699/414 700/427 701/425 702/413
-  0.598300, 0.8988,
-  0.587800, 0.8699,
-  0.587800, 0.9113,
-  // f 701/425 703/426 704/424 705/421
-  0.587800, 0.9113,
-  0.580000, 0.9141,
-  0.571700, 0.9141,
-  // f 701/425 703/426 704/424 705/421
-  0.587800, 0.9113,
-  0.557600, 0.906,
-  0.571700, 0.9141,
-  // f 704/424 706/423 705/421
-  0.571700, 0.9141,
-  0.564000, 0.9113,
-  0.557600, 0.906,
-  // f 705/421 707/422 708/420 709/417
-  0.557600, 0.906,
-  0.553400, 0.8988,
-  0.552000, 0.8906,
-  // f 705/421 707/422 708/420 709/417
-  0.557600, 0.906,
-  0.557600, 0.8753,
-  0.552000, 0.8906,
-  // f 708/420 710/419 709/417
-  0.552000, 0.8906,
-  0.553400, 0.8824,
-  0.557600, 0.8753,
-  // f 701/425 705/421 709/417 702/413
-  0.587800, 0.9113,
-  0.557600, 0.906,
-  0.557600, 0.8753,
-  // f 701/425 705/421 709/417 702/413
-  0.587800, 0.9113,
-  0.587800, 0.8699,
-  0.557600, 0.8753,
-  // f 709/417 711/418 712/416 702/413
-  0.557600, 0.8753,
-  0.564000, 0.8699,
-  0.571700, 0.8671,
-  // f 709/417 711/418 712/416 702/413
-  0.557600, 0.8753,
-  0.587800, 0.8699,
-  0.571700, 0.8671,
-  // f 712/416 713/415 702/413
-  0.571700, 0.8671,
-  0.580000, 0.8671,
-  0.587800, 0.8699,
-  // f 702/413 714/412 715/411 699/414
-  0.587800, 0.8699,
-  0.594200, 0.8753,
-  0.598300, 0.8824,
-  // f 702/413 714/412 715/411 699/414
-  0.587800, 0.8699,
-  0.598300, 0.8988,
-  0.598300, 0.8824,
-  // f 716/428 699/414 715/411
-  0.599800, 0.8906,
-  0.598300, 0.8988,
-  0.598300, 0.8824,
-  // f 664/378 717/430 718/429 665/377
-  0.191000, 0.4272,
-  0.188900, 0.4272,
-  0.187300, 0.4179,
-  // f 664/378 717/430 718/429 665/377
-  0.191000, 0.4272,
-  0.189200, 0.4172,
-  0.187300, 0.4179,
-  // f 665/377 718/429 719/431 667/380
-  0.189200, 0.4172,
-  0.187300, 0.4179,
-  0.182600, 0.4097,
-  // f 665/377 718/429 719/431 667/380
-  0.189200, 0.4172,
-  0.184100, 0.4084,
-  0.182600, 0.4097,
-  // f 667/380 719/431 720/432 669/382
-  0.184100, 0.4084,
-  0.182600, 0.4097,
-  0.175300, 0.4036,
-  // f 667/380 719/431 720/432 669/382
-  0.184100, 0.4084,
-  0.176400, 0.4018,
-  0.175300, 0.4036,
-  // f 669/382 720/432 721/433 671/384
-  0.176400, 0.4018,
-  0.175300, 0.4036,
-  0.166400, 0.4004,
-  // f 669/382 720/432 721/433 671/384
-  0.176400, 0.4018,
-  0.166800, 0.3984,
-  0.166400, 0.4004,
-  // f 671/384 721/433 722/434 673/386
-  0.166800, 0.3984,
-  0.166400, 0.4004,
-  0.157000, 0.4004,
-  // f 671/384 721/433 722/434 673/386
-  0.166800, 0.3984,
-  0.156600, 0.3984,
-  0.157000, 0.4004,
-  // f 673/386 722/434 723/435 675/388
-  0.156600, 0.3984,
-  0.157000, 0.4004,
-  0.148100, 0.4036,
-  // f 673/386 722/434 723/435 675/388
-  0.156600, 0.3984,
-  0.147100, 0.4018,
-  0.148100, 0.4036,
-  // f 675/388 723/435 724/436 677/390
-  0.147100, 0.4018,
-  0.148100, 0.4036,
-  0.140800, 0.4097,
-  // f 675/388 723/435 724/436 677/390
-  0.147100, 0.4018,
-  0.139300, 0.4084,
-  0.140800, 0.4097,
-  // f 677/390 724/436 725/437 679/392
-  0.139300, 0.4084,
-  0.140800, 0.4097,
-  0.136100, 0.4179,
-  // f 677/390 724/436 725/437 679/392
-  0.139300, 0.4084,
-  0.134200, 0.4172,
-  0.136100, 0.4179,
-  // f 679/392 725/437 726/438 681/394
-  0.134200, 0.4172,
-  0.136100, 0.4179,
-  0.134500, 0.4272,
-  // f 679/392 725/437 726/438 681/394
-  0.134200, 0.4172,
-  0.132400, 0.4272,
-  0.134500, 0.4272,
-  // f 681/394 726/438 727/439 683/396
-  0.132400, 0.4272,
-  0.134500, 0.4272,
-  0.136100, 0.4365,
-  // f 681/394 726/438 727/439 683/396
-  0.132400, 0.4272,
-  0.134200, 0.4372,
-  0.136100, 0.4365,
-  // f 683/396 727/439 728/440 685/398
-  0.134200, 0.4372,
-  0.136100, 0.4365,
-  0.140800, 0.4447,
-  // f 683/396 727/439 728/440 685/398
-  0.134200, 0.4372,
-  0.139300, 0.446,
-  0.140800, 0.4447,
-  // f 685/398 728/440 729/441 687/400
-  0.139300, 0.446,
-  0.140800, 0.4447,
-  0.148100, 0.4508,
-  // f 685/398 728/440 729/441 687/400
-  0.139300, 0.446,
-  0.147100, 0.4526,
-  0.148100, 0.4508,
-  // f 687/400 729/441 730/442 689/402
-  0.147100, 0.4526,
-  0.148100, 0.4508,
-  0.157000, 0.454,
-  // f 687/400 729/441 730/442 689/402
-  0.147100, 0.4526,
-  0.156600, 0.456,
-  0.157000, 0.454,
-  // f 689/402 730/442 731/443 691/404
-  0.156600, 0.456,
-  0.157000, 0.454,
-  0.166400, 0.454,
-  // f 689/402 730/442 731/443 691/404
-  0.156600, 0.456,
-  0.166800, 0.456,
-  0.166400, 0.454,
-  // f 691/404 731/443 732/444 693/406
-  0.166800, 0.456,
-  0.166400, 0.454,
-  0.175300, 0.4508,
-  // f 691/404 731/443 732/444 693/406
-  0.166800, 0.456,
-  0.176400, 0.4526,
-  0.175300, 0.4508,
-  // f 693/406 732/444 733/445 695/408
-  0.176400, 0.4526,
-  0.175300, 0.4508,
-  0.182600, 0.4447,
-  // f 693/406 732/444 733/445 695/408
-  0.176400, 0.4526,
-  0.184100, 0.446,
-  0.182600, 0.4447,
-  // f 695/408 733/445 734/446 697/410
-  0.184100, 0.446,
-  0.182600, 0.4447,
-  0.187300, 0.4365,
-  // f 695/408 733/445 734/446 697/410
-  0.184100, 0.446,
-  0.189200, 0.4372,
-  0.187300, 0.4365,
-  // f 697/410 734/446 717/430 664/378
-  0.189200, 0.4372,
-  0.187300, 0.4365,
-  0.188900, 0.4272,
-  // f 697/410 734/446 717/430 664/378
-  0.189200, 0.4372,
-  0.191000, 0.4272,
-  0.188900, 0.4272,
-  // f 717/430 716/448 715/447 718/429
-  0.188900, 0.4272,
-  0.187100, 0.4272,
-  0.185600, 0.4185,
-  // f 717/430 716/448 715/447 718/429
-  0.188900, 0.4272,
-  0.187300, 0.4179,
-  0.185600, 0.4185,
-  // f 718/429 715/447 714/449 719/431
-  0.187300, 0.4179,
-  0.185600, 0.4185,
-  0.181200, 0.4109,
-  // f 718/429 715/447 714/449 719/431
-  0.187300, 0.4179,
-  0.182600, 0.4097,
-  0.181200, 0.4109,
-  // f 719/431 714/449 702/450 720/432
-  0.182600, 0.4097,
-  0.181200, 0.4109,
-  0.174400, 0.4052,
-  // f 719/431 714/449 702/450 720/432
-  0.182600, 0.4097,
-  0.175300, 0.4036,
-  0.174400, 0.4052,
-  // f 720/432 702/450 713/451 721/433
-  0.175300, 0.4036,
-  0.174400, 0.4052,
-  0.166100, 0.4022,
-  // f 720/432 702/450 713/451 721/433
-  0.175300, 0.4036,
-  0.166400, 0.4004,
-  0.166100, 0.4022,
-  // f 721/433 713/451 712/452 722/434
-  0.166400, 0.4004,
-  0.166100, 0.4022,
-  0.157300, 0.4022,
-  // f 721/433 713/451 712/452 722/434
-  0.166400, 0.4004,
-  0.157000, 0.4004,
-  0.157300, 0.4022,
-  // f 722/434 712/452 711/453 723/435
-  0.157000, 0.4004,
-  0.157300, 0.4022,
-  0.149000, 0.4052,
-  // f 722/434 712/452 711/453 723/435
-  0.157000, 0.4004,
-  0.148100, 0.4036,
-  0.149000, 0.4052,
-  // f 723/435 711/453 709/454 724/436
-  0.148100, 0.4036,
-  0.149000, 0.4052,
-  0.142200, 0.4109,
-  // f 723/435 711/453 709/454 724/436
-  0.148100, 0.4036,
-  0.140800, 0.4097,
-  0.142200, 0.4109,
-  // f 724/436 709/454 710/455 725/437
-  0.140800, 0.4097,
-  0.142200, 0.4109,
-  0.137800, 0.4185,
-  // f 724/436 709/454 710/455 725/437
-  0.140800, 0.4097,
-  0.136100, 0.4179,
-  0.137800, 0.4185,
-  // f 725/437 710/455 708/456 726/438
-  0.136100, 0.4179,
-  0.137800, 0.4185,
-  0.136300, 0.4272,
-  // f 725/437 710/455 708/456 726/438
-  0.136100, 0.4179,
-  0.134500, 0.4272,
-  0.136300, 0.4272,
-  // f 726/438 708/456 707/457 727/439
-  0.134500, 0.4272,
-  0.136300, 0.4272,
-  0.137800, 0.4359,
-  // f 726/438 708/456 707/457 727/439
-  0.134500, 0.4272,
-  0.136100, 0.4365,
-  0.137800, 0.4359,
-  // f 727/439 707/457 705/458 728/440
-  0.136100, 0.4365,
-  0.137800, 0.4359,
-  0.142200, 0.4435,
-  // f 727/439 707/457 705/458 728/440
-  0.136100, 0.4365,
-  0.140800, 0.4447,
-  0.142200, 0.4435,
-  // f 728/440 705/458 706/459 729/441
-  0.140800, 0.4447,
-  0.142200, 0.4435,
-  0.149000, 0.4492,
-  // f 728/440 705/458 706/459 729/441
-  0.140800, 0.4447,
-  0.148100, 0.4508,
-  0.149000, 0.4492,
-  // f 729/441 706/459 704/460 730/442
-  0.148100, 0.4508,
-  0.149000, 0.4492,
-  0.157300, 0.4522,
-  // f 729/441 706/459 704/460 730/442
-  0.148100, 0.4508,
-  0.157000, 0.454,
-  0.157300, 0.4522,
-  // f 730/442 704/460 703/461 731/443
-  0.157000, 0.454,
-  0.157300, 0.4522,
-  0.166100, 0.4522,
-  // f 730/442 704/460 703/461 731/443
-  0.157000, 0.454,
-  0.166400, 0.454,
-  0.166100, 0.4522,
-  // f 731/443 703/461 701/462 732/444
-  0.166400, 0.454,
-  0.166100, 0.4522,
-  0.174400, 0.4492,
-  // f 731/443 703/461 701/462 732/444
-  0.166400, 0.454,
-  0.175300, 0.4508,
-  0.174400, 0.4492,
-  // f 732/444 701/462 700/463 733/445
-  0.175300, 0.4508,
-  0.174400, 0.4492,
-  0.181200, 0.4435,
-  // f 732/444 701/462 700/463 733/445
-  0.175300, 0.4508,
-  0.182600, 0.4447,
-  0.181200, 0.4435,
-  // f 733/445 700/463 699/464 734/446
-  0.182600, 0.4447,
-  0.181200, 0.4435,
-  0.185600, 0.4359,
-  // f 733/445 700/463 699/464 734/446
-  0.182600, 0.4447,
-  0.187300, 0.4365,
-  0.185600, 0.4359,
-  // f 734/446 699/464 716/448 717/430
-  0.187300, 0.4365,
-  0.185600, 0.4359,
-  0.187100, 0.4272,
-  // f 734/446 699/464 716/448 717/430
-  0.187300, 0.4365,
-  0.188900, 0.4272,
-  0.187100, 0.4272,
-  // f 735/465 736/468 355/467 354/466
-  0.924000, 0.8704,
-  0.923200, 0.8928,
-  0.856700, 0.8915,
-  // f 735/465 736/468 355/467 354/466
-  0.924000, 0.8704,
-  0.856700, 0.869,
-  0.856700, 0.8915,
-  // f 357/469 355/467 736/468 737/470
-  0.856700, 0.9059,
-  0.856700, 0.8915,
-  0.923200, 0.8928,
-  // f 357/469 355/467 736/468 737/470
-  0.856700, 0.9059,
-  0.923900, 0.9072,
-  0.923200, 0.8928,
-  // f 735/465 354/466 360/472 738/471
-  0.924000, 0.8704,
-  0.856700, 0.869,
-  0.856700, 0.8543,
-  // f 735/465 354/466 360/472 738/471
-  0.924000, 0.8704,
-  0.923200, 0.8556,
-  0.856700, 0.8543,
-  // f 361/473 357/469 739/475 740/474
-  0.856700, 0.9863,
-  0.856700, 0.9059,
-  0.917500, 0.9814,
-  // f 361/473 357/469 739/475 740/474
-  0.856700, 0.9863,
-  0.912800, 0.9859,
-  0.917500, 0.9814,
-  // f 739/475 357/469 737/470
-  0.917500, 0.9814,
-  0.856700, 0.9059,
-  0.923900, 0.9072,
-  // f 364/476 741/479 742/478 365/477
-  0.849700, 0.8868,
-  0.769000, 0.8881,
-  0.769000, 0.8674,
-  // f 364/476 741/479 742/478 365/477
-  0.849700, 0.8868,
-  0.849700, 0.8656,
-  0.769000, 0.8674,
-  // f 741/479 364/476 369/481 743/480
-  0.769000, 0.8881,
-  0.849700, 0.8868,
-  0.849700, 0.8997,
-  // f 741/479 364/476 369/481 743/480
-  0.769000, 0.8881,
-  0.769000, 0.901,
-  0.849700, 0.8997,
-  // f 370/482 365/477 742/478 744/483
-  0.849700, 0.8528,
-  0.849700, 0.8656,
-  0.769000, 0.8674,
-  // f 370/482 365/477 742/478 744/483
-  0.849700, 0.8528,
-  0.769000, 0.8549,
-  0.769000, 0.8674,
-  // f 745/484 369/481 374/486 746/485
-  0.775600, 0.9854,
-  0.849700, 0.8997,
-  0.849700, 0.9904,
-  // f 745/484 369/481 374/486 746/485
-  0.775600, 0.9854,
-  0.781800, 0.9908,
-  0.849700, 0.9904,
-  // f 369/481 745/484 743/480
-  0.849700, 0.8997,
-  0.775600, 0.9854,
-  0.769000, 0.901,
-  // f 741/487 736/468 735/465 742/488
-  0.931100, 0.8922,
-  0.923200, 0.8928,
-  0.924000, 0.8704,
-  // f 741/487 736/468 735/465 742/488
-  0.931100, 0.8922,
-  0.932300, 0.8696,
-  0.924000, 0.8704,
-  // f 743/489 737/470 736/468 741/487
-  0.933100, 0.9052,
-  0.923900, 0.9072,
-  0.923200, 0.8928,
-  // f 743/489 737/470 736/468 741/487
-  0.933100, 0.9052,
-  0.931100, 0.8922,
-  0.923200, 0.8928,
-  // f 742/488 735/465 738/471 744/490
-  0.932300, 0.8696,
-  0.924000, 0.8704,
-  0.923200, 0.8556,
-  // f 742/488 735/465 738/471 744/490
-  0.932300, 0.8696,
-  0.928800, 0.8508,
-  0.923200, 0.8556,
-  // f 744/490 738/471 360/472 370/491
-  0.928800, 0.8508,
-  0.923200, 0.8556,
-  0.856700, 0.8543,
-  // f 744/490 738/471 360/472 370/491
-  0.928800, 0.8508,
-  0.856700, 0.8494,
-  0.856700, 0.8543,
-  // f 374/492 361/473 740/474 746/493
-  0.856700, 0.9952,
-  0.856700, 0.9863,
-  0.912800, 0.9859,
-  // f 374/492 361/473 740/474 746/493
-  0.856700, 0.9952,
-  0.917300, 0.9931,
-  0.912800, 0.9859,
-  // f 746/493 740/474 739/475 745/494
-  0.917300, 0.9931,
-  0.912800, 0.9859,
-  0.917500, 0.9814,
-  // f 746/493 740/474 739/475 745/494
-  0.917300, 0.9931,
-  0.924400, 0.987,
-  0.917500, 0.9814,
-  // f 745/494 739/475 737/470 743/489
-  0.924400, 0.987,
-  0.917500, 0.9814,
-  0.923900, 0.9072,
-  // f 745/494 739/475 737/470 743/489
-  0.924400, 0.987,
-  0.933100, 0.9052,
-  0.923900, 0.9072,
-  // f 747/495 748/498 749/497 750/496
-  0.757900, 0.4472,
-  0.759900, 0.4316,
-  0.768100, 0.4347,
-  // f 747/495 748/498 749/497 750/496
-  0.757900, 0.4472,
-  0.763700, 0.4497,
-  0.768100, 0.4347,
-  // f 751/499 752/502 753/501 754/500
-  0.738000, 0.4472,
-  0.732100, 0.4497,
-  0.727700, 0.4347,
-  // f 751/499 752/502 753/501 754/500
-  0.738000, 0.4472,
-  0.735900, 0.4316,
-  0.727700, 0.4347,
-  // f 755/503 751/499 754/500 756/504
-  0.744500, 0.4455,
-  0.738000, 0.4472,
-  0.735900, 0.4316,
-  // f 755/503 751/499 754/500 756/504
-  0.744500, 0.4455,
-  0.743800, 0.4292,
-  0.735900, 0.4316,
-  // f 757/505 755/503 756/504 758/506
-  0.751400, 0.4455,
-  0.744500, 0.4455,
-  0.743800, 0.4292,
-  // f 757/505 755/503 756/504 758/506
-  0.751400, 0.4455,
-  0.752000, 0.4292,
-  0.743800, 0.4292,
-  // f 757/505 758/506 748/498 747/495
-  0.751400, 0.4455,
-  0.752000, 0.4292,
-  0.759900, 0.4316,
-  // f 757/505 758/506 748/498 747/495
-  0.751400, 0.4455,
-  0.757900, 0.4472,
-  0.759900, 0.4316,
-  // f 759/510 760/511 761/509 762/507
-  0.741200, 0.4499,
-  0.755100, 0.4499,
-  0.762000, 0.4597,
-  // f 759/510 760/511 761/509 762/507
-  0.741200, 0.4499,
-  0.741200, 0.4695,
-  0.762000, 0.4597,
-  // f 761/509 763/508 762/507
-  0.762000, 0.4597,
-  0.755100, 0.4695,
-  0.741200, 0.4695,
-  // f 764/512 759/510 762/507
-  0.734300, 0.4597,
-  0.741200, 0.4499,
-  0.741200, 0.4695,
-  // f 762/513 749/497 748/498 764/514
-  0.768300, 0.4185,
-  0.768100, 0.4347,
-  0.759900, 0.4316,
-  // f 762/513 749/497 748/498 764/514
-  0.768300, 0.4185,
-  0.760400, 0.4162,
-  0.759900, 0.4316,
-  // f 763/508 753/516 749/515 762/507
-  0.755100, 0.4695,
-  0.755900, 0.4915,
-  0.740400, 0.4915,
-  // f 763/508 753/516 749/515 762/507
-  0.755100, 0.4695,
-  0.741200, 0.4695,
-  0.740400, 0.4915,
-  // f 754/500 753/501 763/518 761/517
-  0.735900, 0.4316,
-  0.727700, 0.4347,
-  0.727500, 0.4185,
-  // f 754/500 753/501 763/518 761/517
-  0.735900, 0.4316,
-  0.735500, 0.4162,
-  0.727500, 0.4185,
-  // f 756/504 754/500 761/517 760/519
-  0.743800, 0.4292,
-  0.735900, 0.4316,
-  0.735500, 0.4162,
-  // f 756/504 754/500 761/517 760/519
-  0.743800, 0.4292,
-  0.743700, 0.4139,
-  0.735500, 0.4162,
-  // f 759/520 758/506 756/504 760/519
-  0.752200, 0.4139,
-  0.752000, 0.4292,
-  0.743800, 0.4292,
-  // f 759/520 758/506 756/504 760/519
-  0.752200, 0.4139,
-  0.743700, 0.4139,
-  0.743800, 0.4292,
-  // f 764/514 748/498 758/506 759/520
-  0.760400, 0.4162,
-  0.759900, 0.4316,
-  0.752000, 0.4292,
-  // f 764/514 748/498 758/506 759/520
-  0.760400, 0.4162,
-  0.752200, 0.4139,
-  0.752000, 0.4292,
-  // f 660/71 393/77 273/521 452/373
-  0.474800, 0.7276,
-  0.509100, 0.7242,
-  0.508800, 0.743,
-  // f 660/71 393/77 273/521 452/373
-  0.474800, 0.7276,
-  0.476400, 0.7523,
-  0.508800, 0.743,
-  // f 451/127 272/367 394/522 661/374
-  0.627800, 0.5479,
-  0.652900, 0.5482,
-  0.652900, 0.5546,
-  // f 451/127 272/367 394/522 661/374
-  0.627800, 0.5479,
-  0.628500, 0.5533,
-  0.652900, 0.5546,
-  // f 394/522 271/366 448/125 661/374
-  0.652900, 0.5546,
-  0.653200, 0.5774,
-  0.628100, 0.5779,
-  // f 394/522 271/366 448/125 661/374
-  0.652900, 0.5546,
-  0.628500, 0.5533,
-  0.628100, 0.5779,
-  // f 525/203 396/524 395/523 526/202
-  0.079500, 0.3651,
-  0.096100, 0.3299,
-  0.117400, 0.3404,
-  // f 525/203 396/524 395/523 526/202
-  0.079500, 0.3651,
-  0.101000, 0.3743,
-  0.117400, 0.3404,
-  // f 395/525 138/220 539/217 526/245
-  0.601000, 0.2273,
-  0.573600, 0.225,
-  0.585000, 0.1917,
-  // f 395/525 138/220 539/217 526/245
-  0.601000, 0.2273,
-  0.613300, 0.1938,
-  0.585000, 0.1917,
-  // f 556/242 154/239 396/524 525/203
-  0.074200, 0.3609,
-  0.094000, 0.3273,
-  0.096100, 0.3299,
-  // f 556/242 154/239 396/524 525/203
-  0.074200, 0.3609,
-  0.079500, 0.3651,
-  0.096100, 0.3299,
-  // f 567/266 398/527 397/526 568/269
-  0.757500, 0.3852,
-  0.822100, 0.3856,
-  0.822900, 0.3792,
-  // f 567/266 398/527 397/526 568/269
-  0.757500, 0.3852,
-  0.751200, 0.3787,
-  0.822900, 0.3792,
-  // f 567/266 570/267 572/270 576/274
-  0.757500, 0.3852,
-  0.731000, 0.3852,
-  0.706000, 0.3942,
-  // f 567/266 570/267 572/270 576/274
-  0.757500, 0.3852,
-  0.672400, 0.4338,
-  0.706000, 0.3942,
-  // f 572/270 574/272 576/274
-  0.706000, 0.3942,
-  0.685700, 0.411,
-  0.672400, 0.4338,
-  // f 576/274 578/276 580/278 584/282
-  0.672400, 0.4338,
-  0.667800, 0.4597,
-  0.672400, 0.4856,
-  // f 576/274 578/276 580/278 584/282
-  0.672400, 0.4338,
-  0.706000, 0.5253,
-  0.672400, 0.4856,
-  // f 580/278 582/280 584/282
-  0.672400, 0.4856,
-  0.685700, 0.5084,
-  0.706000, 0.5253,
-  // f 567/266 576/274 584/282 592/290
-  0.757500, 0.3852,
-  0.672400, 0.4338,
-  0.706000, 0.5253,
-  // f 567/266 576/274 584/282 592/290
-  0.757500, 0.3852,
-  0.804600, 0.5099,
-  0.706000, 0.5253,
-  // f 584/282 586/284 588/286 592/290
-  0.706000, 0.5253,
-  0.731000, 0.5343,
-  0.757500, 0.5343,
-  // f 584/282 586/284 588/286 592/290
-  0.706000, 0.5253,
-  0.804600, 0.5099,
-  0.757500, 0.5343,
-  // f 588/286 590/288 592/290
-  0.757500, 0.5343,
-  0.782500, 0.5253,
-  0.804600, 0.5099,
-  // f 398/527 567/266 592/290 193/292
-  0.822100, 0.3856,
-  0.757500, 0.3852,
-  0.804600, 0.5099,
-  // f 398/527 567/266 592/290 193/292
-  0.822100, 0.3856,
-  0.822100, 0.4945,
-  0.804600, 0.5099,
-  // f 626/528 400/531 399/530 625/529
-  0.796700, 0.4346,
-  0.822100, 0.4282,
-  0.822100, 0.4535,
-  // f 626/528 400/531 399/530 625/529
-  0.796700, 0.4346,
-  0.800100, 0.4535,
-  0.822100, 0.4535,
-  // f 627/532 401/533 400/531 626/528
-  0.787000, 0.418,
-  0.822100, 0.4057,
-  0.822100, 0.4282,
-  // f 627/532 401/533 400/531 626/528
-  0.787000, 0.418,
-  0.796700, 0.4346,
-  0.822100, 0.4282,
-  // f 628/534 402/535 401/533 627/532
-  0.772200, 0.4057,
-  0.822100, 0.3807,
-  0.822100, 0.4057,
-  // f 628/534 402/535 401/533 627/532
-  0.772200, 0.4057,
-  0.787000, 0.418,
-  0.822100, 0.4057,
-  // f 628/534 611/313 568/269 402/535
-  0.772200, 0.4057,
-  0.753900, 0.3991,
-  0.751200, 0.3787,
-  // f 628/534 611/313 568/269 402/535
-  0.772200, 0.4057,
-  0.822100, 0.3807,
-  0.751200, 0.3787,
-  // f 397/526 402/535 568/269
-  0.822900, 0.3792,
-  0.822100, 0.3807,
-  0.751200, 0.3787,
-  // f 399/530 226/325 624/326 625/529
-  0.822100, 0.4535,
-  0.822100, 0.486,
-  0.796700, 0.4724,
-  // f 399/530 226/325 624/326 625/529
-  0.822100, 0.4535,
-  0.800100, 0.4535,
-  0.796700, 0.4724,
-  // f 404/536 233/537 630/352 638/32
-  0.877000, 0.284,
-  0.884700, 0.2844,
-  0.879100, 0.3214,
-  // f 404/536 233/537 630/352 638/32
-  0.877000, 0.284,
-  0.871400, 0.321,
-  0.879100, 0.3214,
-  // f 765/538 766/539 767/540 768/541
-  0.495100, 0.138,
-  0.490100, 0.1331,
-  0.490100, 0.1939,
-  // f 765/538 766/539 767/540 768/541
-  0.495100, 0.138,
-  0.495100, 0.189,
-  0.490100, 0.1939,
-  // f 769/542 770/543 771/544 772/545
-  0.468200, 0.0631,
-  0.380800, 0.0583,
-  0.380900, 0.0678,
-  // f 769/542 770/543 771/544 772/545
-  0.468200, 0.0631,
-  0.489000, 0.0723,
-  0.380900, 0.0678,
-  // f 766/539 773/546 774/547 767/540
-  0.490100, 0.1331,
-  0.380900, 0.1316,
-  0.380900, 0.1954,
-  // f 766/539 773/546 774/547 767/540
-  0.490100, 0.1331,
-  0.490100, 0.1939,
-  0.380900, 0.1954,
-  // f 775/548 776/549 777/550 778/551
-  0.496700, 0.1883,
-  0.510800, 0.1894,
-  0.510800, 0.1365,
-  // f 775/548 776/549 777/550 778/551
-  0.496700, 0.1883,
-  0.496700, 0.1387,
-  0.510800, 0.1365,
-  // f 779/552 780/553 781/554 782/555
-  0.490800, 0.2551,
-  0.469100, 0.2656,
-  0.481600, 0.2777,
-  // f 779/552 780/553 781/554 782/555
-  0.490800, 0.2551,
-  0.504700, 0.2623,
-  0.481600, 0.2777,
-  // f 783/556 784/557 785/558 786/559
-  0.490800, 0.0718,
-  0.496700, 0.0891,
-  0.510800, 0.0837,
-  // f 783/556 784/557 785/558 786/559
-  0.490800, 0.0718,
-  0.502800, 0.0634,
-  0.510800, 0.0837,
-  // f 779/552 782/555 787/560 788/561
-  0.490800, 0.2551,
-  0.504700, 0.2623,
-  0.510800, 0.2422,
-  // f 779/552 782/555 787/560 788/561
-  0.490800, 0.2551,
-  0.496700, 0.2379,
-  0.510800, 0.2422,
-  // f 783/556 786/559 789/562 790/563
-  0.490800, 0.0718,
-  0.502800, 0.0634,
-  0.477900, 0.0507,
-  // f 783/556 786/559 789/562 790/563
-  0.490800, 0.0718,
-  0.469000, 0.0614,
-  0.477900, 0.0507,
-  // f 780/553 791/564 792/565 781/554
-  0.469100, 0.2656,
-  0.380800, 0.2705,
-  0.380600, 0.2845,
-  // f 780/553 791/564 792/565 781/554
-  0.469100, 0.2656,
-  0.481600, 0.2777,
-  0.380600, 0.2845,
-  // f 793/566 794/567 795/568 789/562
-  0.476100, 0.0457,
-  0.380400, 0.0394,
-  0.380500, 0.045,
-  // f 793/566 794/567 795/568 789/562
-  0.476100, 0.0457,
-  0.477900, 0.0507,
-  0.380500, 0.045,
-  // f 796/569 777/550 776/549 797/570
-  0.512700, 0.1358,
-  0.510800, 0.1365,
-  0.510800, 0.1894,
-  // f 796/569 777/550 776/549 797/570
-  0.512700, 0.1358,
-  0.512700, 0.189,
-  0.510800, 0.1894,
-  // f 798/571 799/572 782/555 781/554
-  0.483200, 0.284,
-  0.506400, 0.2643,
-  0.504700, 0.2623,
-  // f 798/571 799/572 782/555 781/554
-  0.483200, 0.284,
-  0.481600, 0.2777,
-  0.504700, 0.2623,
-  // f 800/573 801/574 786/559 785/558
-  0.512700, 0.0826,
-  0.502900, 0.0602,
-  0.502800, 0.0634,
-  // f 800/573 801/574 786/559 785/558
-  0.512700, 0.0826,
-  0.510800, 0.0837,
-  0.502800, 0.0634,
-  // f 782/555 799/572 802/575 787/560
-  0.504700, 0.2623,
-  0.506400, 0.2643,
-  0.512700, 0.2423,
-  // f 782/555 799/572 802/575 787/560
-  0.504700, 0.2623,
-  0.510800, 0.2422,
-  0.512700, 0.2423,
-  // f 786/559 801/574 793/566 789/562
-  0.502800, 0.0634,
-  0.502900, 0.0602,
-  0.476100, 0.0457,
-  // f 786/559 801/574 793/566 789/562
-  0.502800, 0.0634,
-  0.477900, 0.0507,
-  0.476100, 0.0457,
-  // f 803/576 804/577 805/578 806/579
-  0.251600, 0.7216,
-  0.262200, 0.7078,
-  0.258700, 0.7045,
-  // f 803/576 804/577 805/578 806/579
-  0.251600, 0.7216,
-  0.247100, 0.7193,
-  0.258700, 0.7045,
-  // f 798/580 807/581 808/582 799/583
-  0.114300, 0.7639,
-  0.170100, 0.8073,
-  0.190200, 0.7831,
-  // f 798/580 807/581 808/582 799/583
-  0.114300, 0.7639,
-  0.137400, 0.736,
-  0.190200, 0.7831,
-  // f 800/584 809/585 810/586 801/587
-  0.258100, 0.601,
-  0.314100, 0.6445,
-  0.330300, 0.621,
-  // f 800/584 809/585 810/586 801/587
-  0.258100, 0.601,
-  0.276200, 0.5755,
-  0.330300, 0.621,
-  // f 799/583 808/582 811/588 802/589
-  0.137400, 0.736,
-  0.190200, 0.7831,
-  0.209700, 0.765,
-  // f 799/583 808/582 811/588 802/589
-  0.137400, 0.736,
-  0.158600, 0.7159,
-  0.209700, 0.765,
-  // f 801/587 810/586 812/590 793/591
-  0.276200, 0.5755,
-  0.330300, 0.621,
-  0.351900, 0.5971,
-  // f 801/587 810/586 812/590 793/591
-  0.276200, 0.5755,
-  0.301400, 0.5482,
-  0.351900, 0.5971,
-  // f 798/580 813/592 814/593 807/581
-  0.114300, 0.7639,
-  0.063900, 0.8459,
-  0.112900, 0.8748,
-  // f 798/580 813/592 814/593 807/581
-  0.114300, 0.7639,
-  0.170100, 0.8073,
-  0.112900, 0.8748,
-  // f 815/594 816/595 766/539 765/538
-  0.494800, 0.0896,
-  0.490100, 0.0734,
-  0.490100, 0.1331,
-  // f 815/594 816/595 766/539 765/538
-  0.494800, 0.0896,
-  0.495100, 0.138,
-  0.490100, 0.1331,
-  // f 767/540 817/596 818/597 768/541
-  0.490100, 0.1939,
-  0.490100, 0.2536,
-  0.494800, 0.2374,
-  // f 767/540 817/596 818/597 768/541
-  0.490100, 0.1939,
-  0.495100, 0.189,
-  0.494800, 0.2374,
-  // f 766/539 816/595 772/545 773/546
-  0.490100, 0.1331,
-  0.490100, 0.0734,
-  0.489000, 0.0723,
-  // f 766/539 816/595 772/545 773/546
-  0.490100, 0.1331,
-  0.380900, 0.1316,
-  0.489000, 0.0723,
-  // f 772/545 771/544 773/546
-  0.489000, 0.0723,
-  0.380900, 0.0678,
-  0.380900, 0.1316,
-  // f 788/561 787/560 776/549 775/548
-  0.496700, 0.2379,
-  0.510800, 0.2422,
-  0.510800, 0.1894,
-  // f 788/561 787/560 776/549 775/548
-  0.496700, 0.2379,
-  0.496700, 0.1883,
-  0.510800, 0.1894,
-  // f 777/550 785/558 784/557 778/551
-  0.510800, 0.1365,
-  0.510800, 0.0837,
-  0.496700, 0.0891,
-  // f 777/550 785/558 784/557 778/551
-  0.510800, 0.1365,
-  0.496700, 0.1387,
-  0.496700, 0.0891,
-  // f 796/569 800/573 785/558 777/550
-  0.512700, 0.1358,
-  0.512700, 0.0826,
-  0.510800, 0.0837,
-  // f 796/569 800/573 785/558 777/550
-  0.512700, 0.1358,
-  0.510800, 0.1365,
-  0.510800, 0.0837,
-  // f 787/560 802/575 797/570 776/549
-  0.510800, 0.2422,
-  0.512700, 0.2423,
-  0.512700, 0.189,
-  // f 787/560 802/575 797/570 776/549
-  0.510800, 0.2422,
-  0.510800, 0.1894,
-  0.512700, 0.189,
-  // f 819/598 820/599 821/600 822/601
-  0.242600, 0.747,
-  0.247000, 0.7457,
-  0.247000, 0.7324,
-  // f 819/598 820/599 821/600 822/601
-  0.242600, 0.747,
-  0.242000, 0.732,
-  0.247000, 0.7324,
-  // f 823/602 824/603 825/604 826/605
-  0.362200, 0.6711,
-  0.357500, 0.6677,
-  0.337100, 0.695,
-  // f 823/602 824/603 825/604 826/605
-  0.362200, 0.6711,
-  0.339000, 0.7034,
-  0.337100, 0.695,
-  // f 827/606 828/607 829/608 830/609
-  0.387000, 0.6301,
-  0.391300, 0.6344,
-  0.437600, 0.5678,
-  // f 827/606 828/607 829/608 830/609
-  0.387000, 0.6301,
-  0.432900, 0.5632,
-  0.437600, 0.5678,
-  // f 831/610 832/611 833/612 834/613
-  0.213700, 0.8415,
-  0.229500, 0.8218,
-  0.225800, 0.8186,
-  // f 831/610 832/611 833/612 834/613
-  0.213700, 0.8415,
-  0.208700, 0.838,
-  0.225800, 0.8186,
-  // f 823/602 835/614 836/615 824/603
-  0.362200, 0.6711,
-  0.374400, 0.654,
-  0.370100, 0.6506,
-  // f 823/602 835/614 836/615 824/603
-  0.362200, 0.6711,
-  0.357500, 0.6677,
-  0.370100, 0.6506,
-  // f 832/611 837/616 838/617 833/612
-  0.229500, 0.8218,
-  0.243100, 0.8083,
-  0.239500, 0.8047,
-  // f 832/611 837/616 838/617 833/612
-  0.229500, 0.8218,
-  0.225800, 0.8186,
-  0.239500, 0.8047,
-  // f 835/614 828/607 827/606 836/615
-  0.374400, 0.654,
-  0.391300, 0.6344,
-  0.387000, 0.6301,
-  // f 835/614 828/607 827/606 836/615
-  0.374400, 0.654,
-  0.370100, 0.6506,
-  0.387000, 0.6301,
-  // f 839/618 840/619 841/620 842/621
-  0.272100, 0.6913,
-  0.274800, 0.6958,
-  0.285800, 0.69,
-  // f 839/618 840/619 841/620 842/621
-  0.272100, 0.6913,
-  0.284900, 0.6848,
-  0.285800, 0.69,
-  // f 843/622 844/623 820/599 819/598
-  0.260200, 0.783,
-  0.262900, 0.7805,
-  0.247000, 0.7457,
-  // f 843/622 844/623 820/599 819/598
-  0.260200, 0.783,
-  0.242600, 0.747,
-  0.247000, 0.7457,
-  // f 845/624 846/625 771/544 770/543
-  0.323100, 0.0581,
-  0.323100, 0.0675,
-  0.380900, 0.0678,
-  // f 845/624 846/625 771/544 770/543
-  0.323100, 0.0581,
-  0.380800, 0.0583,
-  0.380900, 0.0678,
-  // f 847/626 848/627 774/547 773/546
-  0.323100, 0.1315,
-  0.323100, 0.1955,
-  0.380900, 0.1954,
-  // f 847/626 848/627 774/547 773/546
-  0.323100, 0.1315,
-  0.380900, 0.1316,
-  0.380900, 0.1954,
-  // f 849/628 850/629 851/630 852/631
-  0.468200, 0.2639,
-  0.489000, 0.2547,
-  0.380900, 0.2591,
-  // f 849/628 850/629 851/630 852/631
-  0.468200, 0.2639,
-  0.380800, 0.2686,
-  0.380900, 0.2591,
-  // f 790/563 789/562 795/568 853/632
-  0.469000, 0.0614,
-  0.477900, 0.0507,
-  0.380500, 0.045,
-  // f 790/563 789/562 795/568 853/632
-  0.469000, 0.0614,
-  0.380800, 0.0565,
-  0.380500, 0.045,
-  // f 854/633 855/634 792/565 791/564
-  0.323100, 0.2708,
-  0.323000, 0.2856,
-  0.380600, 0.2845,
-  // f 854/633 855/634 792/565 791/564
-  0.323100, 0.2708,
-  0.380800, 0.2705,
-  0.380600, 0.2845,
-  // f 856/635 857/636 795/568 794/567
-  0.322900, 0.0386,
-  0.322900, 0.0445,
-  0.380500, 0.045,
-  // f 856/635 857/636 795/568 794/567
-  0.322900, 0.0386,
-  0.380400, 0.0394,
-  0.380500, 0.045,
-  // f 813/637 798/571 781/554 792/565
-  0.380600, 0.2925,
-  0.483200, 0.284,
-  0.481600, 0.2777,
-  // f 813/637 798/571 781/554 792/565
-  0.380600, 0.2925,
-  0.380600, 0.2845,
-  0.481600, 0.2777,
-  // f 793/591 812/590 858/638 794/639
-  0.301400, 0.5482,
-  0.351900, 0.5971,
-  0.404800, 0.5299,
-  // f 793/591 812/590 858/638 794/639
-  0.301400, 0.5482,
-  0.370800, 0.4907,
-  0.404800, 0.5299,
-  // f 813/592 859/640 860/641 814/593
-  0.063900, 0.8459,
-  0.039200, 0.8927,
-  0.087100, 0.9217,
-  // f 813/592 859/640 860/641 814/593
-  0.063900, 0.8459,
-  0.112900, 0.8748,
-  0.087100, 0.9217,
-  // f 846/625 847/626 773/546 771/544
-  0.323100, 0.0675,
-  0.323100, 0.1315,
-  0.380900, 0.1316,
-  // f 846/625 847/626 773/546 771/544
-  0.323100, 0.0675,
-  0.380900, 0.0678,
-  0.380900, 0.1316,
-  // f 851/630 850/629 817/596 774/547
-  0.380900, 0.2591,
-  0.489000, 0.2547,
-  0.490100, 0.2536,
-  // f 851/630 850/629 817/596 774/547
-  0.380900, 0.2591,
-  0.380900, 0.1954,
-  0.490100, 0.2536,
-  // f 817/596 767/540 774/547
-  0.490100, 0.2536,
-  0.490100, 0.1939,
-  0.380900, 0.1954,
-  // f 830/609 829/608 861/642 862/643
-  0.432900, 0.5632,
-  0.437600, 0.5678,
-  0.462800, 0.5356,
-  // f 830/609 829/608 861/642 862/643
-  0.432900, 0.5632,
-  0.457000, 0.535,
-  0.462800, 0.5356,
-  // f 862/643 861/642 863/644
-  0.457000, 0.535,
-  0.462800, 0.5356,
-  0.458100, 0.5329,
-  // f 864/645 831/610 834/613 865/646
-  0.157300, 0.9038,
-  0.213700, 0.8415,
-  0.208700, 0.838,
-  // f 864/645 831/610 834/613 865/646
-  0.157300, 0.9038,
-  0.152100, 0.9,
-  0.208700, 0.838,
-  // f 866/647 867/648 868/649 869/650
-  0.468000, 0.5222,
-  0.493400, 0.4847,
-  0.491400, 0.4875,
-  // f 866/647 867/648 868/649 869/650
-  0.468000, 0.5222,
-  0.462400, 0.5192,
-  0.491400, 0.4875,
-  // f 870/651 871/652 872/653 873/654
-  0.388300, 0.8734,
-  0.406300, 0.8734,
-  0.406100, 0.8694,
-  // f 870/651 871/652 872/653 873/654
-  0.388300, 0.8734,
-  0.388100, 0.8694,
-  0.406100, 0.8694,
-  // f 874/655 875/656 876/657 877/658
-  0.388100, 0.9129,
-  0.387300, 0.9126,
-  0.405200, 0.9126,
-  // f 874/655 875/656 876/657 877/658
-  0.388100, 0.9129,
-  0.406100, 0.9129,
-  0.405200, 0.9126,
-  // f 878/659 879/660 880/661 881/662
-  0.388400, 0.8913,
-  0.406400, 0.8913,
-  0.406400, 0.8795,
-  // f 878/659 879/660 880/661 881/662
-  0.388400, 0.8913,
-  0.388400, 0.8795,
-  0.406400, 0.8795,
-  // f 882/663 873/654 872/653 883/664
-  0.388200, 0.8691,
-  0.388100, 0.8694,
-  0.406100, 0.8694,
-  // f 882/663 873/654 872/653 883/664
-  0.388200, 0.8691,
-  0.405400, 0.8691,
-  0.406100, 0.8694,
-  // f 884/665 885/666 886/667 887/668
-  0.388300, 0.909,
-  0.406300, 0.909,
-  0.406400, 0.9031,
-  // f 884/665 885/666 886/667 887/668
-  0.388300, 0.909,
-  0.388400, 0.9031,
-  0.406400, 0.9031,
-  // f 888/669 889/670 858/638 890/671
-  0.458300, 0.5185,
-  0.441100, 0.498,
-  0.404800, 0.5299,
-  // f 888/669 889/670 858/638 890/671
-  0.458300, 0.5185,
-  0.430600, 0.5615,
-  0.404800, 0.5299,
-  // f 890/671 858/638 812/590 892/672
-  0.430600, 0.5615,
-  0.404800, 0.5299,
-  0.351900, 0.5971,
-  // f 890/671 858/638 812/590 892/672
-  0.430600, 0.5615,
-  0.384000, 0.6284,
-  0.351900, 0.5971,
-  // f 892/672 812/590 810/586 893/673
-  0.384000, 0.6284,
-  0.351900, 0.5971,
-  0.330300, 0.621,
-  // f 892/672 812/590 810/586 893/673
-  0.384000, 0.6284,
-  0.367200, 0.6486,
-  0.330300, 0.621,
-  // f 810/586 809/585 894/674 893/673
-  0.330300, 0.621,
-  0.314100, 0.6445,
-  0.354500, 0.6657,
-  // f 810/586 809/585 894/674 893/673
-  0.330300, 0.621,
-  0.367200, 0.6486,
-  0.354500, 0.6657,
-  // f 811/588 808/582 895/675 896/676
-  0.209700, 0.765,
-  0.190200, 0.7831,
-  0.223300, 0.8159,
-  // f 811/588 808/582 895/675 896/676
-  0.209700, 0.765,
-  0.237100, 0.8022,
-  0.223300, 0.8159,
-  // f 808/582 807/581 897/677 895/675
-  0.190200, 0.7831,
-  0.170100, 0.8073,
-  0.206300, 0.8351,
-  // f 808/582 807/581 897/677 895/675
-  0.190200, 0.7831,
-  0.223300, 0.8159,
-  0.206300, 0.8351,
-  // f 807/581 814/593 898/678 897/677
-  0.170100, 0.8073,
-  0.112900, 0.8748,
-  0.149100, 0.8969,
-  // f 807/581 814/593 898/678 897/677
-  0.170100, 0.8073,
-  0.206300, 0.8351,
-  0.149100, 0.8969,
-  // f 814/593 860/641 899/679 898/678
-  0.112900, 0.8748,
-  0.087100, 0.9217,
-  0.122700, 0.9358,
-  // f 814/593 860/641 899/679 898/678
-  0.112900, 0.8748,
-  0.149100, 0.8969,
-  0.122700, 0.9358,
-  // f 866/647 869/650 863/644 861/642
-  0.468000, 0.5222,
-  0.462400, 0.5192,
-  0.458100, 0.5329,
-  // f 866/647 869/650 863/644 861/642
-  0.468000, 0.5222,
-  0.462800, 0.5356,
-  0.458100, 0.5329,
-  // f 825/604 900/680 901/681 902/682
-  0.337100, 0.695,
-  0.300300, 0.6843,
-  0.299100, 0.6891,
-  // f 825/604 900/680 901/681 902/682
-  0.337100, 0.695,
-  0.335000, 0.6981,
-  0.299100, 0.6891,
-  // f 843/622 903/683 844/623
-  0.260200, 0.783,
-  0.268500, 0.7823,
-  0.262900, 0.7805,
-  // f 888/669 891/684 863/644 869/650
-  0.458300, 0.5185,
-  0.457100, 0.5327,
-  0.458100, 0.5329,
-  // f 888/669 891/684 863/644 869/650
-  0.458300, 0.5185,
-  0.462400, 0.5192,
-  0.458100, 0.5329,
-  // f 891/685 890/671 830/609 862/643
-  0.456500, 0.5338,
-  0.430600, 0.5615,
-  0.432900, 0.5632,
-  // f 891/685 890/671 830/609 862/643
-  0.456500, 0.5338,
-  0.457000, 0.535,
-  0.432900, 0.5632,
-  // f 890/671 892/672 827/606 830/609
-  0.430600, 0.5615,
-  0.384000, 0.6284,
-  0.387000, 0.6301,
-  // f 890/671 892/672 827/606 830/609
-  0.430600, 0.5615,
-  0.432900, 0.5632,
-  0.387000, 0.6301,
-  // f 892/672 893/673 836/615 827/606
-  0.384000, 0.6284,
-  0.367200, 0.6486,
-  0.370100, 0.6506,
-  // f 892/672 893/673 836/615 827/606
-  0.384000, 0.6284,
-  0.387000, 0.6301,
-  0.370100, 0.6506,
-  // f 893/673 894/674 824/603 836/615
-  0.367200, 0.6486,
-  0.354500, 0.6657,
-  0.357500, 0.6677,
-  // f 893/673 894/674 824/603 836/615
-  0.367200, 0.6486,
-  0.370100, 0.6506,
-  0.357500, 0.6677,
-  // f 894/674 904/686 825/604 824/603
-  0.354500, 0.6657,
-  0.337000, 0.6936,
-  0.337100, 0.695,
-  // f 894/674 904/686 825/604 824/603
-  0.354500, 0.6657,
-  0.357500, 0.6677,
-  0.337100, 0.695,
-  // f 904/686 905/687 900/680 825/604
-  0.337000, 0.6936,
-  0.301900, 0.6798,
-  0.300300, 0.6843,
-  // f 904/686 905/687 900/680 825/604
-  0.337000, 0.6936,
-  0.337100, 0.695,
-  0.300300, 0.6843,
-  // f 906/688 842/621 900/680 905/687
-  0.284800, 0.679,
-  0.284900, 0.6848,
-  0.300300, 0.6843,
-  // f 906/688 842/621 900/680 905/687
-  0.284800, 0.679,
-  0.301900, 0.6798,
-  0.300300, 0.6843,
-  // f 907/689 805/578 839/618 908/690
-  0.255200, 0.7013,
-  0.258700, 0.7045,
-  0.272100, 0.6913,
-  // f 907/689 805/578 839/618 908/690
-  0.255200, 0.7013,
-  0.269200, 0.6862,
-  0.272100, 0.6913,
-  // f 909/691 822/601 806/579 910/692
-  0.236600, 0.7325,
-  0.242000, 0.732,
-  0.247100, 0.7193,
-  // f 909/691 822/601 806/579 910/692
-  0.236600, 0.7325,
-  0.242000, 0.717,
-  0.247100, 0.7193,
-  // f 911/693 912/694 843/622 819/598
-  0.238700, 0.749,
-  0.259000, 0.7831,
-  0.260200, 0.783,
-  // f 911/693 912/694 843/622 819/598
-  0.238700, 0.749,
-  0.242600, 0.747,
-  0.260200, 0.783,
-  // f 912/694 896/676 838/617 843/622
-  0.259000, 0.7831,
-  0.237100, 0.8022,
-  0.239500, 0.8047,
-  // f 912/694 896/676 838/617 843/622
-  0.259000, 0.7831,
-  0.260200, 0.783,
-  0.239500, 0.8047,
-  // f 896/676 895/675 833/612 838/617
-  0.237100, 0.8022,
-  0.223300, 0.8159,
-  0.225800, 0.8186,
-  // f 896/676 895/675 833/612 838/617
-  0.237100, 0.8022,
-  0.239500, 0.8047,
-  0.225800, 0.8186,
-  // f 895/675 897/677 834/613 833/612
-  0.223300, 0.8159,
-  0.206300, 0.8351,
-  0.208700, 0.838,
-  // f 895/675 897/677 834/613 833/612
-  0.223300, 0.8159,
-  0.225800, 0.8186,
-  0.208700, 0.838,
-  // f 897/677 898/678 865/646 834/613
-  0.206300, 0.8351,
-  0.149100, 0.8969,
-  0.152100, 0.9,
-  // f 897/677 898/678 865/646 834/613
-  0.206300, 0.8351,
-  0.208700, 0.838,
-  0.152100, 0.9,
-  // f 899/679 913/695 865/646 898/678
-  0.122700, 0.9358,
-  0.123400, 0.9375,
-  0.152100, 0.9,
-  // f 899/679 913/695 865/646 898/678
-  0.122700, 0.9358,
-  0.149100, 0.8969,
-  0.152100, 0.9,
-  // f 914/696 915/697 831/610 864/645
-  0.160800, 0.9081,
-  0.219500, 0.8424,
-  0.213700, 0.8415,
-  // f 914/696 915/697 831/610 864/645
-  0.160800, 0.9081,
-  0.157300, 0.9038,
-  0.213700, 0.8415,
-  // f 915/697 916/698 832/611 831/610
-  0.219500, 0.8424,
-  0.234200, 0.8217,
-  0.229500, 0.8218,
-  // f 915/697 916/698 832/611 831/610
-  0.219500, 0.8424,
-  0.213700, 0.8415,
-  0.229500, 0.8218,
-  // f 916/698 917/699 837/616 832/611
-  0.234200, 0.8217,
-  0.245700, 0.8104,
-  0.243100, 0.8083,
-  // f 916/698 917/699 837/616 832/611
-  0.234200, 0.8217,
-  0.229500, 0.8218,
-  0.243100, 0.8083,
-  // f 917/699 875/700 903/683 837/616
-  0.245700, 0.8104,
-  0.270900, 0.7827,
-  0.268500, 0.7823,
-  // f 917/699 875/700 903/683 837/616
-  0.245700, 0.8104,
-  0.243100, 0.8083,
-  0.268500, 0.7823,
-  // f 875/700 874/701 918/702 903/683
-  0.270900, 0.7827,
-  0.252000, 0.7424,
-  0.251100, 0.7439,
-  // f 875/700 874/701 918/702 903/683
-  0.270900, 0.7827,
-  0.268500, 0.7823,
-  0.251100, 0.7439,
-  // f 884/665 919/703 918/704 874/655
-  0.388300, 0.909,
-  0.387200, 0.909,
-  0.387000, 0.9129,
-  // f 884/665 919/703 918/704 874/655
-  0.388300, 0.909,
-  0.388100, 0.9129,
-  0.387000, 0.9129,
-  // f 878/659 920/705 921/706 887/668
-  0.388400, 0.8913,
-  0.387300, 0.8913,
-  0.387300, 0.9031,
-  // f 878/659 920/705 921/706 887/668
-  0.388400, 0.8913,
-  0.388400, 0.9031,
-  0.387300, 0.9031,
-  // f 870/651 922/707 923/708 881/662
-  0.388300, 0.8734,
-  0.387200, 0.8734,
-  0.387300, 0.8795,
-  // f 870/651 922/707 923/708 881/662
-  0.388300, 0.8734,
-  0.388400, 0.8795,
-  0.387300, 0.8795,
-  // f 873/709 882/710 826/711 924/712
-  0.296100, 0.6952,
-  0.339800, 0.7062,
-  0.338600, 0.7033,
-  // f 873/709 882/710 826/711 924/712
-  0.296100, 0.6952,
-  0.297200, 0.6936,
-  0.338600, 0.7033,
-  // f 882/710 925/713 823/602 826/605
-  0.339800, 0.7062,
-  0.363900, 0.6744,
-  0.362200, 0.6711,
-  // f 882/710 925/713 823/602 826/605
-  0.339800, 0.7062,
-  0.339000, 0.7034,
-  0.362200, 0.6711,
-  // f 925/713 926/714 835/614 823/602
-  0.363900, 0.6744,
-  0.376600, 0.6576,
-  0.374400, 0.654,
-  // f 925/713 926/714 835/614 823/602
-  0.363900, 0.6744,
-  0.362200, 0.6711,
-  0.374400, 0.654,
-  // f 926/714 927/715 828/607 835/614
-  0.376600, 0.6576,
-  0.393200, 0.6389,
-  0.391300, 0.6344,
-  // f 926/714 927/715 828/607 835/614
-  0.376600, 0.6576,
-  0.374400, 0.654,
-  0.391300, 0.6344,
-  // f 927/715 928/716 829/608 828/607
-  0.393200, 0.6389,
-  0.442300, 0.5699,
-  0.437600, 0.5678,
-  // f 927/715 928/716 829/608 828/607
-  0.393200, 0.6389,
-  0.391300, 0.6344,
-  0.437600, 0.5678,
-  // f 928/716 929/717 861/642 829/608
-  0.442300, 0.5699,
-  0.467500, 0.537,
-  0.462800, 0.5356,
-  // f 928/716 929/717 861/642 829/608
-  0.442300, 0.5699,
-  0.437600, 0.5678,
-  0.462800, 0.5356,
-  // f 929/717 930/718 866/647 861/642
-  0.467500, 0.537,
-  0.472100, 0.5247,
-  0.468000, 0.5222,
-  // f 929/717 930/718 866/647 861/642
-  0.467500, 0.537,
-  0.462800, 0.5356,
-  0.468000, 0.5222,
-  // f 931/719 867/648 866/647 930/718
-  0.497200, 0.4884,
-  0.493400, 0.4847,
-  0.468000, 0.5222,
-  // f 931/719 867/648 866/647 930/718
-  0.497200, 0.4884,
-  0.472100, 0.5247,
-  0.468000, 0.5222,
-  // f 919/720 921/721 803/576 821/600
-  0.251400, 0.7335,
-  0.255300, 0.7241,
-  0.251600, 0.7216,
-  // f 919/720 921/721 803/576 821/600
-  0.251400, 0.7335,
-  0.247000, 0.7324,
-  0.251600, 0.7216,
-  // f 924/712 901/681 841/620 922/722
-  0.297200, 0.6936,
-  0.299100, 0.6891,
-  0.285800, 0.69,
-  // f 924/712 901/681 841/620 922/722
-  0.297200, 0.6936,
-  0.287200, 0.6947,
-  0.285800, 0.69,
-  // f 881/662 880/661 871/652 870/651
-  0.388400, 0.8795,
-  0.406400, 0.8795,
-  0.406300, 0.8734,
-  // f 881/662 880/661 871/652 870/651
-  0.388400, 0.8795,
-  0.388300, 0.8734,
-  0.406300, 0.8734,
-  // f 874/655 877/658 885/666 884/665
-  0.388100, 0.9129,
-  0.406100, 0.9129,
-  0.406300, 0.909,
-  // f 874/655 877/658 885/666 884/665
-  0.388100, 0.9129,
-  0.388300, 0.909,
-  0.406300, 0.909,
-  // f 908/690 839/618 842/621 906/688
-  0.269200, 0.6862,
-  0.272100, 0.6913,
-  0.284900, 0.6848,
-  // f 908/690 839/618 842/621 906/688
-  0.269200, 0.6862,
-  0.284800, 0.679,
-  0.284900, 0.6848,
-  // f 911/693 819/598 822/601 909/691
-  0.238700, 0.749,
-  0.242600, 0.747,
-  0.242000, 0.732,
-  // f 911/693 819/598 822/601 909/691
-  0.238700, 0.749,
-  0.236600, 0.7325,
-  0.242000, 0.732,
-  // f 887/668 921/706 919/703 884/665
-  0.388400, 0.9031,
-  0.387300, 0.9031,
-  0.387200, 0.909,
-  // f 887/668 921/706 919/703 884/665
-  0.388400, 0.9031,
-  0.388300, 0.909,
-  0.387200, 0.909,
-  // f 873/654 924/723 922/707 870/651
-  0.388100, 0.8694,
-  0.387000, 0.8694,
-  0.387200, 0.8734,
-  // f 873/654 924/723 922/707 870/651
-  0.388100, 0.8694,
-  0.388300, 0.8734,
-  0.387200, 0.8734,
-  // f 904/686 894/674 809/585 905/687
-  0.337000, 0.6936,
-  0.354500, 0.6657,
-  0.314100, 0.6445,
-  // f 904/686 894/674 809/585 905/687
-  0.337000, 0.6936,
-  0.301900, 0.6798,
-  0.314100, 0.6445,
-  // f 905/687 809/585 906/688
-  0.301900, 0.6798,
-  0.314100, 0.6445,
-  0.284800, 0.679,
-  // f 796/724 797/725 910/692 907/689
-  0.229100, 0.6444,
-  0.197200, 0.6812,
-  0.242000, 0.717,
-  // f 796/724 797/725 910/692 907/689
-  0.229100, 0.6444,
-  0.255200, 0.7013,
-  0.242000, 0.717,
-  // f 908/690 796/724 907/689
-  0.269200, 0.6862,
-  0.229100, 0.6444,
-  0.255200, 0.7013,
-  // f 797/725 802/589 811/588 909/691
-  0.197200, 0.6812,
-  0.158600, 0.7159,
-  0.209700, 0.765,
-  // f 797/725 802/589 811/588 909/691
-  0.197200, 0.6812,
-  0.236600, 0.7325,
-  0.209700, 0.765,
-  // f 910/692 797/725 909/691
-  0.242000, 0.717,
-  0.197200, 0.6812,
-  0.236600, 0.7325,
-  // f 811/588 896/676 912/694 911/693
-  0.209700, 0.765,
-  0.237100, 0.8022,
-  0.259000, 0.7831,
-  // f 811/588 896/676 912/694 911/693
-  0.209700, 0.765,
-  0.238700, 0.749,
-  0.259000, 0.7831,
-  // f 906/688 809/585 800/584 796/724
-  0.284800, 0.679,
-  0.314100, 0.6445,
-  0.258100, 0.601,
-  // f 906/688 809/585 800/584 796/724
-  0.284800, 0.679,
-  0.229100, 0.6444,
-  0.258100, 0.601,
-  // f 906/688 796/724 908/690
-  0.284800, 0.679,
-  0.229100, 0.6444,
-  0.269200, 0.6862,
-  // f 909/691 811/588 911/693
-  0.236600, 0.7325,
-  0.209700, 0.765,
-  0.238700, 0.749,
-  // f 921/721 920/726 804/577 803/576
-  0.255300, 0.7241,
-  0.265300, 0.7108,
-  0.262200, 0.7078,
-  // f 921/721 920/726 804/577 803/576
-  0.255300, 0.7241,
-  0.251600, 0.7216,
-  0.262200, 0.7078,
-  // f 820/599 918/702 919/720 821/600
-  0.247000, 0.7457,
-  0.251100, 0.7439,
-  0.251400, 0.7335,
-  // f 820/599 918/702 919/720 821/600
-  0.247000, 0.7457,
-  0.247000, 0.7324,
-  0.251400, 0.7335,
-  // f 840/619 923/727 922/722 841/620
-  0.274800, 0.6958,
-  0.277600, 0.6994,
-  0.287200, 0.6947,
-  // f 840/619 923/727 922/722 841/620
-  0.274800, 0.6958,
-  0.285800, 0.69,
-  0.287200, 0.6947,
-  // f 844/623 903/683 918/702 820/599
-  0.262900, 0.7805,
-  0.268500, 0.7823,
-  0.251100, 0.7439,
-  // f 844/623 903/683 918/702 820/599
-  0.262900, 0.7805,
-  0.247000, 0.7457,
-  0.251100, 0.7439,
-  // f 924/712 826/711 902/682 901/681
-  0.297200, 0.6936,
-  0.338600, 0.7033,
-  0.335000, 0.6981,
-  // f 924/712 826/711 902/682 901/681
-  0.297200, 0.6936,
-  0.299100, 0.6891,
-  0.335000, 0.6981,
-  // f 806/579 822/601 821/600 803/576
-  0.247100, 0.7193,
-  0.242000, 0.732,
-  0.247000, 0.7324,
-  // f 806/579 822/601 821/600 803/576
-  0.247100, 0.7193,
-  0.251600, 0.7216,
-  0.247000, 0.7324,
-  // f 900/680 842/621 841/620 901/681
-  0.300300, 0.6843,
-  0.284900, 0.6848,
-  0.285800, 0.69,
-  // f 900/680 842/621 841/620 901/681
-  0.300300, 0.6843,
-  0.299100, 0.6891,
-  0.285800, 0.69,
-  // f 825/604 902/682 826/711
-  0.337100, 0.695,
-  0.335000, 0.6981,
-  0.338600, 0.7033,
-  // f 843/622 838/617 837/616 903/683
-  0.260200, 0.783,
-  0.239500, 0.8047,
-  0.243100, 0.8083,
-  // f 843/622 838/617 837/616 903/683
-  0.260200, 0.783,
-  0.268500, 0.7823,
-  0.243100, 0.8083,
-  // f 840/619 839/618 805/578 804/577
-  0.274800, 0.6958,
-  0.272100, 0.6913,
-  0.258700, 0.7045,
-  // f 840/619 839/618 805/578 804/577
-  0.274800, 0.6958,
-  0.262200, 0.7078,
-  0.258700, 0.7045,
-  // f 887/668 886/667 879/660 878/659
-  0.388400, 0.9031,
-  0.406400, 0.9031,
-  0.406400, 0.8913,
-  // f 887/668 886/667 879/660 878/659
-  0.388400, 0.9031,
-  0.388400, 0.8913,
-  0.406400, 0.8913,
-  // f 910/692 806/579 805/578 907/689
-  0.242000, 0.717,
-  0.247100, 0.7193,
-  0.258700, 0.7045,
-  // f 910/692 806/579 805/578 907/689
-  0.242000, 0.717,
-  0.255200, 0.7013,
-  0.258700, 0.7045,
-  // f 881/662 923/708 920/705 878/659
-  0.388400, 0.8795,
-  0.387300, 0.8795,
-  0.387300, 0.8913,
-  // f 881/662 923/708 920/705 878/659
-  0.388400, 0.8795,
-  0.388400, 0.8913,
-  0.387300, 0.8913,
-  // f 923/727 840/619 804/577 920/726
-  0.277600, 0.6994,
-  0.274800, 0.6958,
-  0.262200, 0.7078,
-  // f 923/727 840/619 804/577 920/726
-  0.277600, 0.6994,
-  0.265300, 0.7108,
-  0.262200, 0.7078,
-  // f 852/631 851/630 932/728 933/729
-  0.380800, 0.2686,
-  0.380900, 0.2591,
-  0.323100, 0.2595,
-  // f 852/631 851/630 932/728 933/729
-  0.380800, 0.2686,
-  0.323100, 0.2689,
-  0.323100, 0.2595,
-  // f 934/730 853/632 795/568 857/636
-  0.323100, 0.0562,
-  0.380800, 0.0565,
-  0.380500, 0.045,
-  // f 934/730 853/632 795/568 857/636
-  0.323100, 0.0562,
-  0.322900, 0.0445,
-  0.380500, 0.045,
-  // f 813/637 792/565 855/634 859/731
-  0.380600, 0.2925,
-  0.380600, 0.2845,
-  0.323000, 0.2856,
-  // f 813/637 792/565 855/634 859/731
-  0.380600, 0.2925,
-  0.323000, 0.2944,
-  0.323000, 0.2856,
-  // f 794/639 858/638 889/670 856/732
-  0.370800, 0.4907,
-  0.404800, 0.5299,
-  0.441100, 0.498,
-  // f 794/639 858/638 889/670 856/732
-  0.370800, 0.4907,
-  0.411500, 0.4589,
-  0.441100, 0.498,
-  // f 851/630 774/547 848/627 932/728
-  0.380900, 0.2591,
-  0.380900, 0.1954,
-  0.323100, 0.1955,
-  // f 851/630 774/547 848/627 932/728
-  0.380900, 0.2591,
-  0.323100, 0.2595,
-  0.323100, 0.1955,
-  // f 935/733 864/645 865/646 913/695
-  0.127300, 0.9398,
-  0.157300, 0.9038,
-  0.152100, 0.9,
-  // f 935/733 864/645 865/646 913/695
-  0.127300, 0.9398,
-  0.123400, 0.9375,
-  0.152100, 0.9,
-  // f 936/734 937/735 846/625 845/624
-  0.277700, 0.0570000000000001,
-  0.277700, 0.0673,
-  0.323100, 0.0675,
-  // f 936/734 937/735 846/625 845/624
-  0.277700, 0.0570000000000001,
-  0.323100, 0.0581,
-  0.323100, 0.0675,
-  // f 938/736 939/737 848/627 847/626
-  0.277700, 0.1315,
-  0.277700, 0.1956,
-  0.323100, 0.1955,
-  // f 938/736 939/737 848/627 847/626
-  0.277700, 0.1315,
-  0.323100, 0.1315,
-  0.323100, 0.1955,
-  // f 940/738 941/739 855/634 854/633
-  0.277700, 0.2711,
-  0.277700, 0.2865,
-  0.323000, 0.2856,
-  // f 940/738 941/739 855/634 854/633
-  0.277700, 0.2711,
-  0.323100, 0.2708,
-  0.323000, 0.2856,
-  // f 942/740 943/741 857/636 856/635
-  0.309400, 0.0383,
-  0.309400, 0.0442,
-  0.322900, 0.0445,
-  // f 942/740 943/741 857/636 856/635
-  0.309400, 0.0383,
-  0.322900, 0.0386,
-  0.322900, 0.0445,
-  // f 944/742 945/743 860/641 859/640
-  0.018900, 0.9267,
-  0.065600, 0.9551,
-  0.087100, 0.9217,
-  // f 944/742 945/743 860/641 859/640
-  0.018900, 0.9267,
-  0.039200, 0.8927,
-  0.087100, 0.9217,
-  // f 937/735 938/736 847/626 846/625
-  0.277700, 0.0673,
-  0.277700, 0.1315,
-  0.323100, 0.1315,
-  // f 937/735 938/736 847/626 846/625
-  0.277700, 0.0673,
-  0.323100, 0.0675,
-  0.323100, 0.1315,
-  // f 945/743 946/744 947/745 860/641
-  0.065600, 0.9551,
-  0.075300, 0.9635,
-  0.095100, 0.9435,
-  // f 945/743 946/744 947/745 860/641
-  0.065600, 0.9551,
-  0.087100, 0.9217,
-  0.095100, 0.9435,
-  // f 947/745 948/746 913/695 899/679
-  0.095100, 0.9435,
-  0.096900, 0.9486,
-  0.123400, 0.9375,
-  // f 947/745 948/746 913/695 899/679
-  0.095100, 0.9435,
-  0.122700, 0.9358,
-  0.123400, 0.9375,
-  // f 914/696 864/645 935/733 949/747
-  0.160800, 0.9081,
-  0.157300, 0.9038,
-  0.127300, 0.9398,
-  // f 914/696 864/645 935/733 949/747
-  0.160800, 0.9081,
-  0.130100, 0.9446,
-  0.127300, 0.9398,
-  // f 867/648 950/748 889/670 888/669
-  0.493400, 0.4847,
-  0.472000, 0.4637,
-  0.441100, 0.498,
-  // f 867/648 950/748 889/670 888/669
-  0.493400, 0.4847,
-  0.458300, 0.5185,
-  0.441100, 0.498,
-  // f 951/749 935/733 913/695 948/746
-  0.101400, 0.9521,
-  0.127300, 0.9398,
-  0.123400, 0.9375,
-  // f 951/749 935/733 913/695 948/746
-  0.101400, 0.9521,
-  0.096900, 0.9486,
-  0.123400, 0.9375,
-  // f 949/747 935/733 951/749 952/750
-  0.130100, 0.9446,
-  0.127300, 0.9398,
-  0.101400, 0.9521,
-  // f 949/747 935/733 951/749 952/750
-  0.130100, 0.9446,
-  0.104000, 0.9568,
-  0.101400, 0.9521,
-  // f 953/751 954/752 943/741 942/740
-  0.277700, 0.0381,
-  0.277700, 0.0441,
-  0.309400, 0.0442,
-  // f 953/751 954/752 943/741 942/740
-  0.277700, 0.0381,
-  0.309400, 0.0383,
-  0.309400, 0.0442,
-  // f 946/744 955/753 948/746 947/745
-  0.075300, 0.9635,
-  0.076700, 0.9672,
-  0.096900, 0.9486,
-  // f 946/744 955/753 948/746 947/745
-  0.075300, 0.9635,
-  0.095100, 0.9435,
-  0.096900, 0.9486,
-  // f 947/745 899/679 860/641
-  0.095100, 0.9435,
-  0.122700, 0.9358,
-  0.087100, 0.9217,
-  // f 779/552 817/596 850/629
-  0.490800, 0.2551,
-  0.490100, 0.2536,
-  0.489000, 0.2547,
-  // f 783/556 772/545 816/595
-  0.490800, 0.0718,
-  0.489000, 0.0723,
-  0.490100, 0.0734,
-  // f 769/542 790/563 853/632 770/543
-  0.468200, 0.0631,
-  0.469000, 0.0614,
-  0.380800, 0.0565,
-  // f 769/542 790/563 853/632 770/543
-  0.468200, 0.0631,
-  0.380800, 0.0583,
-  0.380800, 0.0565,
-  // f 818/597 788/561 775/548 768/541
-  0.494800, 0.2374,
-  0.496700, 0.2379,
-  0.496700, 0.1883,
-  // f 818/597 788/561 775/548 768/541
-  0.494800, 0.2374,
-  0.495100, 0.189,
-  0.496700, 0.1883,
-  // f 849/628 780/553 779/552 850/629
-  0.468200, 0.2639,
-  0.469100, 0.2656,
-  0.490800, 0.2551,
-  // f 849/628 780/553 779/552 850/629
-  0.468200, 0.2639,
-  0.489000, 0.2547,
-  0.490800, 0.2551,
-  // f 815/594 784/557 783/556 816/595
-  0.494800, 0.0896,
-  0.496700, 0.0891,
-  0.490800, 0.0718,
-  // f 815/594 784/557 783/556 816/595
-  0.494800, 0.0896,
-  0.490100, 0.0734,
-  0.490800, 0.0718,
-  // f 817/596 779/552 788/561 818/597
-  0.490100, 0.2536,
-  0.490800, 0.2551,
-  0.496700, 0.2379,
-  // f 817/596 779/552 788/561 818/597
-  0.490100, 0.2536,
-  0.494800, 0.2374,
-  0.496700, 0.2379,
-  // f 772/545 783/556 790/563 769/542
-  0.489000, 0.0723,
-  0.490800, 0.0718,
-  0.469000, 0.0614,
-  // f 772/545 783/556 790/563 769/542
-  0.489000, 0.0723,
-  0.468200, 0.0631,
-  0.469000, 0.0614,
-  // f 768/541 775/548 778/551 765/538
-  0.495100, 0.189,
-  0.496700, 0.1883,
-  0.496700, 0.1387,
-  // f 768/541 775/548 778/551 765/538
-  0.495100, 0.189,
-  0.495100, 0.138,
-  0.496700, 0.1387,
-  // f 765/538 778/551 784/557 815/594
-  0.495100, 0.138,
-  0.496700, 0.1387,
-  0.496700, 0.0891,
-  // f 765/538 778/551 784/557 815/594
-  0.495100, 0.138,
-  0.494800, 0.0896,
-  0.496700, 0.0891,
-  // f 770/543 853/632 934/730 845/624
-  0.380800, 0.0583,
-  0.380800, 0.0565,
-  0.323100, 0.0562,
-  // f 770/543 853/632 934/730 845/624
-  0.380800, 0.0583,
-  0.323100, 0.0581,
-  0.323100, 0.0562,
-  // f 852/631 791/564 780/553 849/628
-  0.380800, 0.2686,
-  0.380800, 0.2705,
-  0.469100, 0.2656,
-  // f 852/631 791/564 780/553 849/628
-  0.380800, 0.2686,
-  0.468200, 0.2639,
-  0.469100, 0.2656,
-  // f 933/729 854/633 791/564 852/631
-  0.323100, 0.2689,
-  0.323100, 0.2708,
-  0.380800, 0.2705,
-  // f 933/729 854/633 791/564 852/631
-  0.323100, 0.2689,
-  0.380800, 0.2686,
-  0.380800, 0.2705,
-  // f 845/624 934/730 936/734
-  0.323100, 0.0581,
-  0.323100, 0.0562,
-  0.277700, 0.0570000000000001,
-  // f 925/754 882/663 883/664 956/755
-  0.388100, 0.8377,
-  0.388200, 0.8691,
-  0.405400, 0.8691,
-  // f 925/754 882/663 883/664 956/755
-  0.388100, 0.8377,
-  0.405300, 0.8377,
-  0.405400, 0.8691,
-  // f 926/756 925/754 956/755 957/757
-  0.394600, 0.8227,
-  0.388100, 0.8377,
-  0.405300, 0.8377,
-  // f 926/756 925/754 956/755 957/757
-  0.394600, 0.8227,
-  0.411900, 0.8226,
-  0.405300, 0.8377,
-  // f 926/756 957/757 927/758
-  0.394600, 0.8227,
-  0.411900, 0.8226,
-  0.411900, 0.8129,
-  // f 928/759 927/758 957/757 958/760
-  0.476700, 0.8102,
-  0.411900, 0.8129,
-  0.411900, 0.8226,
-  // f 928/759 927/758 957/757 958/760
-  0.476700, 0.8102,
-  0.476700, 0.8198,
-  0.411900, 0.8226,
-  // f 929/761 928/759 958/760 959/762
-  0.509300, 0.8102,
-  0.476700, 0.8102,
-  0.476700, 0.8198,
-  // f 929/761 928/759 958/760 959/762
-  0.509300, 0.8102,
-  0.509300, 0.8198,
-  0.476700, 0.8198,
-  // f 930/763 929/761 959/762 960/764
-  0.511700, 0.8103,
-  0.509300, 0.8102,
-  0.509300, 0.8198,
-  // f 930/763 929/761 959/762 960/764
-  0.511700, 0.8103,
-  0.511700, 0.8199,
-  0.509300, 0.8198,
-  // f 875/656 917/765 961/766 876/657
-  0.387300, 0.9126,
-  0.388400, 0.9424,
-  0.406300, 0.9424,
-  // f 875/656 917/765 961/766 876/657
-  0.387300, 0.9126,
-  0.405200, 0.9126,
-  0.406300, 0.9424,
-  // f 916/767 915/768 962/769
-  0.391500, 0.9552,
-  0.407200, 0.9685,
-  0.407000, 0.9554,
-  // f 917/765 916/767 962/769 961/766
-  0.388400, 0.9424,
-  0.391500, 0.9552,
-  0.407000, 0.9554,
-  // f 917/765 916/767 962/769 961/766
-  0.388400, 0.9424,
-  0.406300, 0.9424,
-  0.407000, 0.9554,
-  // f 952/770 963/771 964/772 965/773
-  0.524800, 0.9763,
-  0.546300, 0.9768,
-  0.546300, 0.9561,
-  // f 952/770 963/771 964/772 965/773
-  0.524800, 0.9763,
-  0.524800, 0.9561,
-  0.546300, 0.9561,
-  // f 915/768 914/774 966/775 962/769
-  0.407200, 0.9685,
-  0.476400, 0.9743,
-  0.476400, 0.9558,
-  // f 915/768 914/774 966/775 962/769
-  0.407200, 0.9685,
-  0.407000, 0.9554,
-  0.476400, 0.9558,
-  // f 914/774 949/776 967/777 966/775
-  0.476400, 0.9743,
-  0.515200, 0.9756,
-  0.515200, 0.9559,
-  // f 914/774 949/776 967/777 966/775
-  0.476400, 0.9743,
-  0.476400, 0.9558,
-  0.515200, 0.9559,
-  // f 949/776 952/770 965/773 967/777
-  0.515200, 0.9756,
-  0.524800, 0.9763,
-  0.524800, 0.9561,
-  // f 949/776 952/770 965/773 967/777
-  0.515200, 0.9756,
-  0.515200, 0.9559,
-  0.524800, 0.9561,
-  // f 871/652 880/661 968/778 969/779
-  0.406300, 0.8734,
-  0.406400, 0.8795,
-  0.436200, 0.8842,
-  // f 871/652 880/661 968/778 969/779
-  0.406300, 0.8734,
-  0.436200, 0.8805,
-  0.436200, 0.8842,
-  // f 877/658 876/657 970/780 971/781
-  0.406100, 0.9129,
-  0.405200, 0.9126,
-  0.436100, 0.9041,
-  // f 877/658 876/657 970/780 971/781
-  0.406100, 0.9129,
-  0.436200, 0.9041,
-  0.436100, 0.9041,
-  // f 879/660 886/667 972/782 973/783
-  0.406400, 0.8913,
-  0.406400, 0.9031,
-  0.436200, 0.8982,
-  // f 879/660 886/667 972/782 973/783
-  0.406400, 0.8913,
-  0.436200, 0.8912,
-  0.436200, 0.8982,
-  // f 883/664 872/653 974/784 975/784
-  0.405400, 0.8691,
-  0.406100, 0.8694,
-  0.436200, 0.8782,
-  // f 883/664 872/653 974/784 975/784
-  0.405400, 0.8691,
-  0.436200, 0.8782,
-  0.436200, 0.8782,
-  // f 885/666 877/658 971/781 976/785
-  0.406300, 0.909,
-  0.406100, 0.9129,
-  0.436200, 0.9041,
-  // f 885/666 877/658 971/781 976/785
-  0.406300, 0.909,
-  0.436200, 0.9018,
-  0.436200, 0.9041,
-  // f 872/653 871/652 969/779 974/784
-  0.406100, 0.8694,
-  0.406300, 0.8734,
-  0.436200, 0.8805,
-  // f 872/653 871/652 969/779 974/784
-  0.406100, 0.8694,
-  0.436200, 0.8782,
-  0.436200, 0.8805,
-  // f 886/667 885/666 976/785 972/782
-  0.406400, 0.9031,
-  0.406300, 0.909,
-  0.436200, 0.9018,
-  // f 886/667 885/666 976/785 972/782
-  0.406400, 0.9031,
-  0.436200, 0.8982,
-  0.436200, 0.9018,
-  // f 880/661 879/660 973/783 968/778
-  0.406400, 0.8795,
-  0.406400, 0.8913,
-  0.436200, 0.8912,
-  // f 880/661 879/660 973/783 968/778
-  0.406400, 0.8795,
-  0.436200, 0.8842,
-  0.436200, 0.8912,
-  // f 956/755 883/664 975/784 977/786
-  0.405300, 0.8377,
-  0.405400, 0.8691,
-  0.436200, 0.8782,
-  // f 956/755 883/664 975/784 977/786
-  0.405300, 0.8377,
-  0.436200, 0.8595,
-  0.436200, 0.8782,
-  // f 957/757 956/755 977/786 978/787
-  0.411900, 0.8226,
-  0.405300, 0.8377,
-  0.436200, 0.8595,
-  // f 957/757 956/755 977/786 978/787
-  0.411900, 0.8226,
-  0.442800, 0.8505,
-  0.436200, 0.8595,
-  // f 958/760 957/757 978/787 979/788
-  0.476700, 0.8198,
-  0.411900, 0.8226,
-  0.442800, 0.8505,
-  // f 958/760 957/757 978/787 979/788
-  0.476700, 0.8198,
-  0.507100, 0.8487,
-  0.442800, 0.8505,
-  // f 959/762 958/760 979/788 980/789
-  0.509300, 0.8198,
-  0.476700, 0.8198,
-  0.507100, 0.8487,
-  // f 959/762 958/760 979/788 980/789
-  0.509300, 0.8198,
-  0.539600, 0.8487,
-  0.507100, 0.8487,
-  // f 960/764 959/762 980/789 981/790
-  0.511700, 0.8199,
-  0.509300, 0.8198,
-  0.539600, 0.8487,
-  // f 960/764 959/762 980/789 981/790
-  0.511700, 0.8199,
-  0.541700, 0.8487,
-  0.539600, 0.8487,
-  // f 876/657 961/766 982/791 970/780
-  0.405200, 0.9126,
-  0.406300, 0.9424,
-  0.437200, 0.9219,
-  // f 876/657 961/766 982/791 970/780
-  0.405200, 0.9126,
-  0.436100, 0.9041,
-  0.437200, 0.9219,
-  // f 961/766 962/769 983/792 982/791
-  0.406300, 0.9424,
-  0.407000, 0.9554,
-  0.437900, 0.9296,
-  // f 961/766 962/769 983/792 982/791
-  0.406300, 0.9424,
-  0.437200, 0.9219,
-  0.437900, 0.9296,
-  // f 965/773 964/772 984/793
-  0.524800, 0.9561,
-  0.546300, 0.9561,
-  0.547200, 0.9365,
-  // f 962/769 966/775 985/794 983/792
-  0.407000, 0.9554,
-  0.476400, 0.9558,
-  0.506900, 0.9298,
-  // f 962/769 966/775 985/794 983/792
-  0.407000, 0.9554,
-  0.437900, 0.9296,
-  0.506900, 0.9298,
-  // f 966/775 967/777 986/795 985/794
-  0.476400, 0.9558,
-  0.515200, 0.9559,
-  0.545700, 0.9298,
-  // f 966/775 967/777 986/795 985/794
-  0.476400, 0.9558,
-  0.506900, 0.9298,
-  0.545700, 0.9298,
-  // f 984/793 987/796 986/795 965/773
-  0.547200, 0.9365,
-  0.548400, 0.9298,
-  0.545700, 0.9298,
-  // f 984/793 987/796 986/795 965/773
-  0.547200, 0.9365,
-  0.524800, 0.9561,
-  0.545700, 0.9298,
-  // f 967/777 965/773 986/795
-  0.515200, 0.9559,
-  0.524800, 0.9561,
-  0.545700, 0.9298,
-  // f 933/729 932/728 988/797 989/798
-  0.323100, 0.2689,
-  0.323100, 0.2595,
-  0.277700, 0.2598,
-  // f 933/729 932/728 988/797 989/798
-  0.323100, 0.2689,
-  0.277700, 0.2691,
-  0.277700, 0.2598,
-  // f 934/730 857/636 943/741 954/752
-  0.323100, 0.0562,
-  0.322900, 0.0445,
-  0.309400, 0.0442,
-  // f 934/730 857/636 943/741 954/752
-  0.323100, 0.0562,
-  0.277700, 0.0441,
-  0.309400, 0.0442,
-  // f 936/734 934/730 954/752
-  0.277700, 0.0570000000000001,
-  0.323100, 0.0562,
-  0.277700, 0.0441,
-  // f 859/731 855/634 941/739 944/799
-  0.323000, 0.2944,
-  0.323000, 0.2856,
-  0.277700, 0.2865,
-  // f 859/731 855/634 941/739 944/799
-  0.323000, 0.2944,
-  0.277700, 0.2955,
-  0.277700, 0.2865,
-  // f 942/800 856/732 889/670 953/801
-  0.420700, 0.4517,
-  0.411500, 0.4589,
-  0.441100, 0.498,
-  // f 942/800 856/732 889/670 953/801
-  0.420700, 0.4517,
-  0.439900, 0.4322,
-  0.441100, 0.498,
-  // f 953/801 889/670 950/748
-  0.439900, 0.4322,
-  0.441100, 0.498,
-  0.472000, 0.4637,
-  // f 932/728 848/627 939/737 988/797
-  0.323100, 0.2595,
-  0.323100, 0.1955,
-  0.277700, 0.1956,
-  // f 932/728 848/627 939/737 988/797
-  0.323100, 0.2595,
-  0.277700, 0.2598,
-  0.277700, 0.1956,
-  // f 946/802 951/749 948/746
-  0.078800, 0.9698,
-  0.101400, 0.9521,
-  0.096900, 0.9486,
-  // f 948/746 955/753 946/802
-  0.096900, 0.9486,
-  0.076700, 0.9672,
-  0.078800, 0.9698,
-  // f 888/669 869/650 868/649 867/648
-  0.458300, 0.5185,
-  0.462400, 0.5192,
-  0.491400, 0.4875,
-  // f 888/669 869/650 868/649 867/648
-  0.458300, 0.5185,
-  0.493400, 0.4847,
-  0.491400, 0.4875,
-  // f 963/803 952/750 951/749 946/802
-  0.082100, 0.9735,
-  0.104000, 0.9568,
-  0.101400, 0.9521,
-  // f 963/803 952/750 951/749 946/802
-  0.082100, 0.9735,
-  0.078800, 0.9698,
-  0.101400, 0.9521,
-  // f 854/633 933/729 989/798 940/738
-  0.323100, 0.2708,
-  0.323100, 0.2689,
-  0.277700, 0.2691,
-  // f 854/633 933/729 989/798 940/738
-  0.323100, 0.2708,
-  0.277700, 0.2711,
-  0.277700, 0.2691,
-  // f 930/763 960/764 990/804 931/805
-  0.511700, 0.8103,
-  0.511700, 0.8199,
-  0.546100, 0.8199,
-  // f 930/763 960/764 990/804 931/805
-  0.511700, 0.8103,
-  0.546100, 0.8103,
-  0.546100, 0.8199,
-  // f 990/804 960/764 981/790 991/806
-  0.546100, 0.8199,
-  0.511700, 0.8199,
-  0.541700, 0.8487,
-  // f 990/804 960/764 981/790 991/806
-  0.546100, 0.8199,
-  0.547500, 0.8487,
-  0.541700, 0.8487,
-  // f 992/807 993/808 994/809 995/810
-  0.060400, 0.1381,
-  0.060400, 0.189,
-  0.065400, 0.194,
-  // f 992/807 993/808 994/809 995/810
-  0.060400, 0.1381,
-  0.065400, 0.1332,
-  0.065400, 0.194,
-  // f 996/811 997/812 998/813 999/814
-  0.087300, 0.0631,
-  0.066500, 0.0723,
-  0.174600, 0.0679,
-  // f 996/811 997/812 998/813 999/814
-  0.087300, 0.0631,
-  0.174700, 0.0584,
-  0.174600, 0.0679,
-  // f 995/810 994/809 1000/815 1001/816
-  0.065400, 0.1332,
-  0.065400, 0.194,
-  0.174600, 0.1954,
-  // f 995/810 994/809 1000/815 1001/816
-  0.065400, 0.1332,
-  0.174600, 0.1316,
-  0.174600, 0.1954,
-  // f 1002/817 1003/818 1004/819 1005/820
-  0.058800, 0.1883,
-  0.058800, 0.1387,
-  0.044600, 0.1366,
-  // f 1002/817 1003/818 1004/819 1005/820
-  0.058800, 0.1883,
-  0.044600, 0.1894,
-  0.044600, 0.1366,
-  // f 1006/821 1007/822 1008/823 1009/824
-  0.064600, 0.2551,
-  0.050800, 0.2624,
-  0.073900, 0.2778,
-  // f 1006/821 1007/822 1008/823 1009/824
-  0.064600, 0.2551,
-  0.086400, 0.2656,
-  0.073900, 0.2778,
-  // f 1010/825 1011/826 1012/827 1013/828
-  0.064700, 0.0719,
-  0.052600, 0.0635,
-  0.044600, 0.0838,
-  // f 1010/825 1011/826 1012/827 1013/828
-  0.064700, 0.0719,
-  0.058800, 0.0891,
-  0.044600, 0.0838,
-  // f 1006/821 1014/829 1015/830 1007/822
-  0.064600, 0.2551,
-  0.058800, 0.2379,
-  0.044600, 0.2422,
-  // f 1006/821 1014/829 1015/830 1007/822
-  0.064600, 0.2551,
-  0.050800, 0.2624,
-  0.044600, 0.2422,
-  // f 1010/825 1016/831 1017/832 1011/826
-  0.064700, 0.0719,
-  0.086500, 0.0614,
-  0.077500, 0.0507,
-  // f 1010/825 1016/831 1017/832 1011/826
-  0.064700, 0.0719,
-  0.052600, 0.0635,
-  0.077500, 0.0507,
-  // f 1009/824 1008/823 1018/833 1019/834
-  0.086400, 0.2656,
-  0.073900, 0.2778,
-  0.174800, 0.2845,
-  // f 1009/824 1008/823 1018/833 1019/834
-  0.086400, 0.2656,
-  0.174700, 0.2706,
-  0.174800, 0.2845,
-  // f 1020/835 1017/832 1021/836 1022/837
-  0.079200, 0.0457,
-  0.077500, 0.0507,
-  0.174900, 0.045,
-  // f 1020/835 1017/832 1021/836 1022/837
-  0.079200, 0.0457,
-  0.174900, 0.0394,
-  0.174900, 0.045,
-  // f 1023/838 1024/839 1005/820 1004/819
-  0.042700, 0.1359,
-  0.042700, 0.1891,
-  0.044600, 0.1894,
-  // f 1023/838 1024/839 1005/820 1004/819
-  0.042700, 0.1359,
-  0.044600, 0.1366,
-  0.044600, 0.1894,
-  // f 1025/840 1008/823 1007/822 1026/841
-  0.072200, 0.284,
-  0.073900, 0.2778,
-  0.050800, 0.2624,
-  // f 1025/840 1008/823 1007/822 1026/841
-  0.072200, 0.284,
-  0.048900, 0.2644,
-  0.050800, 0.2624,
-  // f 1027/842 1012/827 1011/826 1028/843
-  0.042700, 0.0826,
-  0.044600, 0.0838,
-  0.052600, 0.0635,
-  // f 1027/842 1012/827 1011/826 1028/843
-  0.042700, 0.0826,
-  0.052500, 0.0602,
-  0.052600, 0.0635,
-  // f 1007/822 1015/830 1029/844 1026/841
-  0.050800, 0.2624,
-  0.044600, 0.2422,
-  0.042700, 0.2423,
-  // f 1007/822 1015/830 1029/844 1026/841
-  0.050800, 0.2624,
-  0.048900, 0.2644,
-  0.042700, 0.2423,
-  // f 1011/826 1017/832 1020/835 1028/843
-  0.052600, 0.0635,
-  0.077500, 0.0507,
-  0.079200, 0.0457,
-  // f 1011/826 1017/832 1020/835 1028/843
-  0.052600, 0.0635,
-  0.052500, 0.0602,
-  0.079200, 0.0457,
-  // f 1030/845 1031/846 1032/847 1033/848
-  0.728600, 0.24,
-  0.726500, 0.2354,
-  0.711300, 0.2467,
-  // f 1030/845 1031/846 1032/847 1033/848
-  0.728600, 0.24,
-  0.714600, 0.2503,
-  0.711300, 0.2467,
-  // f 1025/849 1026/850 1034/851 1035/852
-  0.777600, 0.1037,
-  0.748000, 0.1257,
-  0.792900, 0.1805,
-  // f 1025/849 1026/850 1034/851 1035/852
-  0.777600, 0.1037,
-  0.818200, 0.1615,
-  0.792900, 0.1805,
-  // f 1036/853 1037/854 1027/855 1028/856
-  0.627000, 0.3185,
-  0.650500, 0.302,
-  0.607200, 0.2458,
-  // f 1036/853 1037/854 1027/855 1028/856
-  0.627000, 0.3185,
-  0.581100, 0.2647,
-  0.607200, 0.2458,
-  // f 1038/857 1034/851 1026/850 1029/858
-  0.773800, 0.1993,
-  0.792900, 0.1805,
-  0.748000, 0.1257,
-  // f 1038/857 1034/851 1026/850 1029/858
-  0.773800, 0.1993,
-  0.726400, 0.1466,
-  0.748000, 0.1257,
-  // f 1028/856 1020/859 1039/860 1036/853
-  0.581100, 0.2647,
-  0.553700, 0.2907,
-  0.603100, 0.3406,
-  // f 1028/856 1020/859 1039/860 1036/853
-  0.581100, 0.2647,
-  0.627000, 0.3185,
-  0.603100, 0.3406,
-  // f 1025/849 1035/852 1040/861 1041/862
-  0.777600, 0.1037,
-  0.818200, 0.1615,
-  0.888800, 0.1078,
-  // f 1025/849 1035/852 1040/861 1041/862
-  0.777600, 0.1037,
-  0.862500, 0.0574,
-  0.888800, 0.1078,
-  // f 1042/863 992/807 995/810 1043/864
-  0.060700, 0.0896,
-  0.060400, 0.1381,
-  0.065400, 0.1332,
-  // f 1042/863 992/807 995/810 1043/864
-  0.060700, 0.0896,
-  0.065400, 0.0734,
-  0.065400, 0.1332,
-  // f 994/809 993/808 1044/865 1045/866
-  0.065400, 0.194,
-  0.060400, 0.189,
-  0.060700, 0.2375,
-  // f 994/809 993/808 1044/865 1045/866
-  0.065400, 0.194,
-  0.065400, 0.2537,
-  0.060700, 0.2375,
-  // f 1001/816 998/813 997/812 995/810
-  0.174600, 0.1316,
-  0.174600, 0.0679,
-  0.066500, 0.0723,
-  // f 1001/816 998/813 997/812 995/810
-  0.174600, 0.1316,
-  0.065400, 0.1332,
-  0.066500, 0.0723,
-  // f 995/810 997/812 1043/864
-  0.065400, 0.1332,
-  0.066500, 0.0723,
-  0.065400, 0.0734,
-  // f 1014/829 1002/817 1005/820 1015/830
-  0.058800, 0.2379,
-  0.058800, 0.1883,
-  0.044600, 0.1894,
-  // f 1014/829 1002/817 1005/820 1015/830
-  0.058800, 0.2379,
-  0.044600, 0.2422,
-  0.044600, 0.1894,
-  // f 1004/819 1003/818 1013/828 1012/827
-  0.044600, 0.1366,
-  0.058800, 0.1387,
-  0.058800, 0.0891,
-  // f 1004/819 1003/818 1013/828 1012/827
-  0.044600, 0.1366,
-  0.044600, 0.0838,
-  0.058800, 0.0891,
-  // f 1023/838 1004/819 1012/827 1027/842
-  0.042700, 0.1359,
-  0.044600, 0.1366,
-  0.044600, 0.0838,
-  // f 1023/838 1004/819 1012/827 1027/842
-  0.042700, 0.1359,
-  0.042700, 0.0826,
-  0.044600, 0.0838,
-  // f 1015/830 1005/820 1024/839 1029/844
-  0.044600, 0.2422,
-  0.044600, 0.1894,
-  0.042700, 0.1891,
-  // f 1015/830 1005/820 1024/839 1029/844
-  0.044600, 0.2422,
-  0.042700, 0.2423,
-  0.042700, 0.1891,
-  // f 1046/867 1047/868 1048/869 1049/870
-  0.754400, 0.2315,
-  0.739400, 0.2305,
-  0.739600, 0.2355,
-  // f 1046/867 1047/868 1048/869 1049/870
-  0.754400, 0.2315,
-  0.752900, 0.2358,
-  0.739600, 0.2355,
-  // f 1051/871 1053/872 1052/873
-  0.700900, 0.3248,
-  0.673700, 0.3453,
-  0.677200, 0.35,
-  // f 1054/874 1055/875 1056/876 1057/877
-  0.636400, 0.3753,
-  0.570500, 0.4225,
-  0.575200, 0.4271,
-  // f 1054/874 1055/875 1056/876 1057/877
-  0.636400, 0.3753,
-  0.640800, 0.3794,
-  0.575200, 0.4271,
-  // f 1058/878 1059/879 1060/880 1061/881
-  0.850400, 0.2065,
-  0.847100, 0.2014,
-  0.826800, 0.2175,
-  // f 1058/878 1059/879 1060/880 1061/881
-  0.850400, 0.2065,
-  0.829900, 0.2213,
-  0.826800, 0.2175,
-  // f 1052/873 1053/872 1062/882 1063/883
-  0.677200, 0.35,
-  0.673700, 0.3453,
-  0.656700, 0.3581,
-  // f 1052/873 1053/872 1062/882 1063/883
-  0.677200, 0.35,
-  0.660200, 0.3623,
-  0.656700, 0.3581,
-  // f 1061/881 1060/880 1064/884 1065/885
-  0.829900, 0.2213,
-  0.826800, 0.2175,
-  0.812400, 0.2305,
-  // f 1061/881 1060/880 1064/884 1065/885
-  0.829900, 0.2213,
-  0.815700, 0.2343,
-  0.812400, 0.2305,
-  // f 1063/883 1062/882 1054/874 1057/877
-  0.660200, 0.3623,
-  0.656700, 0.3581,
-  0.636400, 0.3753,
-  // f 1063/883 1062/882 1054/874 1057/877
-  0.660200, 0.3623,
-  0.640800, 0.3794,
-  0.636400, 0.3753,
-  // f 1066/886 1067/887 1068/888 1069/889
-  0.697800, 0.2599,
-  0.690900, 0.2726,
-  0.696200, 0.2736,
-  // f 1066/886 1067/887 1068/888 1069/889
-  0.697800, 0.2599,
-  0.702300, 0.2626,
-  0.696200, 0.2736,
-  // f 1070/890 1046/867 1049/870 1071/891
-  0.789800, 0.2503,
-  0.754400, 0.2315,
-  0.752900, 0.2358,
-  // f 1070/890 1046/867 1049/870 1071/891
-  0.789800, 0.2503,
-  0.787200, 0.2529,
-  0.752900, 0.2358,
-  // f 1072/892 999/814 998/813 1073/893
-  0.232400, 0.0581,
-  0.174700, 0.0584,
-  0.174600, 0.0679,
-  // f 1072/892 999/814 998/813 1073/893
-  0.232400, 0.0581,
-  0.232400, 0.0675,
-  0.174600, 0.0679,
-  // f 1074/894 1001/816 1000/815 1075/895
-  0.232400, 0.1315,
-  0.174600, 0.1316,
-  0.174600, 0.1954,
-  // f 1074/894 1001/816 1000/815 1075/895
-  0.232400, 0.1315,
-  0.232400, 0.1955,
-  0.174600, 0.1954,
-  // f 1076/896 1077/897 1078/898 1079/899
-  0.087300, 0.264,
-  0.174700, 0.2687,
-  0.174600, 0.2592,
-  // f 1076/896 1077/897 1078/898 1079/899
-  0.087300, 0.264,
-  0.066500, 0.2548,
-  0.174600, 0.2592,
-  // f 1016/831 1080/900 1021/836 1017/832
-  0.086500, 0.0614,
-  0.174700, 0.0565,
-  0.174900, 0.045,
-  // f 1016/831 1080/900 1021/836 1017/832
-  0.086500, 0.0614,
-  0.077500, 0.0507,
-  0.174900, 0.045,
-  // f 1081/901 1019/834 1018/833 1082/902
-  0.232400, 0.2709,
-  0.174700, 0.2706,
-  0.174800, 0.2845,
-  // f 1081/901 1019/834 1018/833 1082/902
-  0.232400, 0.2709,
-  0.232400, 0.2857,
-  0.174800, 0.2845,
-  // f 1083/903 1022/837 1021/836 1084/904
-  0.232500, 0.0386,
-  0.174900, 0.0394,
-  0.174900, 0.045,
-  // f 1083/903 1022/837 1021/836 1084/904
-  0.232500, 0.0386,
-  0.232500, 0.0445,
-  0.174900, 0.045,
-  // f 1041/905 1018/833 1008/823 1025/840
-  0.174700, 0.2925,
-  0.174800, 0.2845,
-  0.073900, 0.2778,
-  // f 1041/905 1018/833 1008/823 1025/840
-  0.174700, 0.2925,
-  0.072200, 0.284,
-  0.073900, 0.2778,
-  // f 1020/859 1022/906 1085/907 1039/860
-  0.553700, 0.2907,
-  0.497000, 0.3615,
-  0.536800, 0.3948,
-  // f 1020/859 1022/906 1085/907 1039/860
-  0.553700, 0.2907,
-  0.603100, 0.3406,
-  0.536800, 0.3948,
-  // f 1041/862 1040/861 1086/908 1087/909
-  0.862500, 0.0574,
-  0.888800, 0.1078,
-  0.937100, 0.0845,
-  // f 1041/862 1040/861 1086/908 1087/909
-  0.862500, 0.0574,
-  0.910600, 0.0351,
-  0.937100, 0.0845,
-  // f 1073/893 998/813 1001/816 1074/894
-  0.232400, 0.0675,
-  0.174600, 0.0679,
-  0.174600, 0.1316,
-  // f 1073/893 998/813 1001/816 1074/894
-  0.232400, 0.0675,
-  0.232400, 0.1315,
-  0.174600, 0.1316,
-  // f 1000/815 994/809 1045/866 1078/898
-  0.174600, 0.1954,
-  0.065400, 0.194,
-  0.065400, 0.2537,
-  // f 1000/815 994/809 1045/866 1078/898
-  0.174600, 0.1954,
-  0.174600, 0.2592,
-  0.065400, 0.2537,
-  // f 1078/898 1045/866 1079/899
-  0.174600, 0.2592,
-  0.065400, 0.2537,
-  0.066500, 0.2548,
-  // f 1088/910 1089/911 1090/912 1055/875
-  0.542800, 0.4471,
-  0.540600, 0.4483,
-  0.543500, 0.453,
-  // f 1088/910 1089/911 1090/912 1055/875
-  0.542800, 0.4471,
-  0.570500, 0.4225,
-  0.543500, 0.453,
-  // f 1090/912 1056/876 1055/875
-  0.543500, 0.453,
-  0.575200, 0.4271,
-  0.570500, 0.4225,
-  // f 1091/913 1092/914 1059/879 1058/878
-  0.915700, 0.1535,
-  0.912100, 0.1482,
-  0.847100, 0.2014,
-  // f 1091/913 1092/914 1059/879 1058/878
-  0.915700, 0.1535,
-  0.850400, 0.2065,
-  0.847100, 0.2014,
-  // f 1093/915 1094/916 868/917 867/648
-  0.530200, 0.4585,
-  0.527100, 0.4529,
-  0.496200, 0.4827,
-  // f 1093/915 1094/916 868/917 867/648
-  0.530200, 0.4585,
-  0.493400, 0.4847,
-  0.496200, 0.4827,
-  // f 1095/918 1096/919 1097/920 1098/921
-  0.704200, 0.8733,
-  0.704100, 0.8694,
-  0.686100, 0.8694,
-  // f 1095/918 1096/919 1097/920 1098/921
-  0.704200, 0.8733,
-  0.686200, 0.8733,
-  0.686100, 0.8694,
-  // f 1099/922 1100/923 1101/924 1102/925
-  0.704100, 0.9129,
-  0.686100, 0.9129,
-  0.685300, 0.9126,
-  // f 1099/922 1100/923 1101/924 1102/925
-  0.704100, 0.9129,
-  0.703300, 0.9126,
-  0.685300, 0.9126,
-  // f 1103/926 1104/927 1105/928 1106/929
-  0.704400, 0.8912,
-  0.704300, 0.8795,
-  0.686300, 0.8795,
-  // f 1103/926 1104/927 1105/928 1106/929
-  0.704400, 0.8912,
-  0.686400, 0.8912,
-  0.686300, 0.8795,
-  // f 1107/930 1108/931 1097/920 1096/919
-  0.702400, 0.869,
-  0.685200, 0.869,
-  0.686100, 0.8694,
-  // f 1107/930 1108/931 1097/920 1096/919
-  0.702400, 0.869,
-  0.704100, 0.8694,
-  0.686100, 0.8694,
-  // f 1109/932 1110/933 1111/934 1112/935
-  0.704300, 0.909,
-  0.704300, 0.903,
-  0.686300, 0.903,
-  // f 1109/932 1110/933 1111/934 1112/935
-  0.704300, 0.909,
-  0.686300, 0.909,
-  0.686300, 0.903,
-  // f 1085/907 1113/936 1114/937 1115/938
-  0.536800, 0.3948,
-  0.505500, 0.4319,
-  0.526300, 0.4488,
-  // f 1085/907 1113/936 1114/937 1115/938
-  0.536800, 0.3948,
-  0.568800, 0.4201,
-  0.526300, 0.4488,
-  // f 1115/938 1117/939 1039/860 1085/907
-  0.568800, 0.4201,
-  0.634900, 0.3723,
-  0.603100, 0.3406,
-  // f 1115/938 1117/939 1039/860 1085/907
-  0.568800, 0.4201,
-  0.536800, 0.3948,
-  0.603100, 0.3406,
-  // f 1117/939 1118/940 1036/853 1039/860
-  0.634900, 0.3723,
-  0.654700, 0.3551,
-  0.627000, 0.3185,
-  // f 1117/939 1118/940 1036/853 1039/860
-  0.634900, 0.3723,
-  0.603100, 0.3406,
-  0.627000, 0.3185,
-  // f 1036/853 1118/940 1119/941 1037/854
-  0.627000, 0.3185,
-  0.654700, 0.3551,
-  0.671800, 0.3423,
-  // f 1036/853 1118/940 1119/941 1037/854
-  0.627000, 0.3185,
-  0.650500, 0.302,
-  0.671800, 0.3423,
-  // f 1038/857 1120/942 1121/943 1034/851
-  0.773800, 0.1993,
-  0.809900, 0.228,
-  0.824300, 0.2149,
-  // f 1038/857 1120/942 1121/943 1034/851
-  0.773800, 0.1993,
-  0.792900, 0.1805,
-  0.824300, 0.2149,
-  // f 1034/851 1121/943 1122/944 1035/852
-  0.792900, 0.1805,
-  0.824300, 0.2149,
-  0.844300, 0.1989,
-  // f 1034/851 1121/943 1122/944 1035/852
-  0.792900, 0.1805,
-  0.818200, 0.1615,
-  0.844300, 0.1989,
-  // f 1035/852 1122/944 1123/945 1040/861
-  0.818200, 0.1615,
-  0.844300, 0.1989,
-  0.909100, 0.1451,
-  // f 1035/852 1122/944 1123/945 1040/861
-  0.818200, 0.1615,
-  0.888800, 0.1078,
-  0.909100, 0.1451,
-  // f 1040/861 1123/945 1124/946 1086/908
-  0.888800, 0.1078,
-  0.909100, 0.1451,
-  0.949400, 0.1207,
-  // f 1040/861 1123/945 1124/946 1086/908
-  0.888800, 0.1078,
-  0.937100, 0.0845,
-  0.949400, 0.1207,
-  // f 1093/915 1090/912 1089/911 1094/916
-  0.530200, 0.4585,
-  0.543500, 0.453,
-  0.540600, 0.4483,
-  // f 1093/915 1090/912 1089/911 1094/916
-  0.530200, 0.4585,
-  0.527100, 0.4529,
-  0.540600, 0.4483,
-  // f 1051/871 1125/947 1126/948 1127/949
-  0.700900, 0.3248,
-  0.704100, 0.3227,
-  0.694700, 0.2868,
-  // f 1051/871 1125/947 1126/948 1127/949
-  0.700900, 0.3248,
-  0.690100, 0.288,
-  0.694700, 0.2868,
-  // f 1070/890 1071/891 1128/950
-  0.789800, 0.2503,
-  0.787200, 0.2529,
-  0.788800, 0.2585,
-  // f 1114/937 1094/916 1089/911 1116/951
-  0.526300, 0.4488,
-  0.527100, 0.4529,
-  0.540600, 0.4483,
-  // f 1114/937 1094/916 1089/911 1116/951
-  0.526300, 0.4488,
-  0.540400, 0.4473,
-  0.540600, 0.4483,
-  // f 1116/952 1088/910 1055/875 1115/938
-  0.541600, 0.4466,
-  0.542800, 0.4471,
-  0.570500, 0.4225,
-  // f 1116/952 1088/910 1055/875 1115/938
-  0.541600, 0.4466,
-  0.568800, 0.4201,
-  0.570500, 0.4225,
-  // f 1115/938 1055/875 1054/874 1117/939
-  0.568800, 0.4201,
-  0.570500, 0.4225,
-  0.636400, 0.3753,
-  // f 1115/938 1055/875 1054/874 1117/939
-  0.568800, 0.4201,
-  0.634900, 0.3723,
-  0.636400, 0.3753,
-  // f 1117/939 1054/874 1062/882 1118/940
-  0.634900, 0.3723,
-  0.636400, 0.3753,
-  0.656700, 0.3581,
-  // f 1117/939 1054/874 1062/882 1118/940
-  0.634900, 0.3723,
-  0.654700, 0.3551,
-  0.656700, 0.3581,
-  // f 1118/940 1062/882 1053/872 1119/941
-  0.654700, 0.3551,
-  0.656700, 0.3581,
-  0.673700, 0.3453,
-  // f 1118/940 1062/882 1053/872 1119/941
-  0.654700, 0.3551,
-  0.671800, 0.3423,
-  0.673700, 0.3453,
-  // f 1119/941 1053/872 1051/871 1129/953
-  0.671800, 0.3423,
-  0.673700, 0.3453,
-  0.700900, 0.3248,
-  // f 1119/941 1053/872 1051/871 1129/953
-  0.671800, 0.3423,
-  0.699600, 0.3247,
-  0.700900, 0.3248,
-  // f 1129/953 1051/871 1127/949 1130/954
-  0.699600, 0.3247,
-  0.700900, 0.3248,
-  0.690100, 0.288,
-  // f 1129/953 1051/871 1127/949 1130/954
-  0.699600, 0.3247,
-  0.685700, 0.2896,
-  0.690100, 0.288,
-  // f 1131/955 1130/954 1127/949 1067/887
-  0.685100, 0.2726,
-  0.685700, 0.2896,
-  0.690100, 0.288,
-  // f 1131/955 1130/954 1127/949 1067/887
-  0.685100, 0.2726,
-  0.690900, 0.2726,
-  0.690100, 0.288,
-  // f 1132/956 1133/957 1066/886 1032/847
-  0.708300, 0.2432,
-  0.692800, 0.2571,
-  0.697800, 0.2599,
-  // f 1132/956 1133/957 1066/886 1032/847
-  0.708300, 0.2432,
-  0.711300, 0.2467,
-  0.697800, 0.2599,
-  // f 1134/958 1135/959 1031/846 1047/868
-  0.740100, 0.2252,
-  0.724400, 0.2303,
-  0.726500, 0.2354,
-  // f 1134/958 1135/959 1031/846 1047/868
-  0.740100, 0.2252,
-  0.739400, 0.2305,
-  0.726500, 0.2354,
-  // f 1136/960 1046/867 1070/890 1137/961
-  0.756500, 0.2277,
-  0.754400, 0.2315,
-  0.789800, 0.2503,
-  // f 1136/960 1046/867 1070/890 1137/961
-  0.756500, 0.2277,
-  0.789900, 0.2491,
-  0.789800, 0.2503,
-  // f 1137/961 1070/890 1064/884 1120/942
-  0.789900, 0.2491,
-  0.789800, 0.2503,
-  0.812400, 0.2305,
-  // f 1137/961 1070/890 1064/884 1120/942
-  0.789900, 0.2491,
-  0.809900, 0.228,
-  0.812400, 0.2305,
-  // f 1120/942 1064/884 1060/880 1121/943
-  0.809900, 0.228,
-  0.812400, 0.2305,
-  0.826800, 0.2175,
-  // f 1120/942 1064/884 1060/880 1121/943
-  0.809900, 0.228,
-  0.824300, 0.2149,
-  0.826800, 0.2175,
-  // f 1121/943 1060/880 1059/879 1122/944
-  0.824300, 0.2149,
-  0.826800, 0.2175,
-  0.847100, 0.2014,
-  // f 1121/943 1060/880 1059/879 1122/944
-  0.824300, 0.2149,
-  0.844300, 0.1989,
-  0.847100, 0.2014,
-  // f 1122/944 1059/879 1092/914 1123/945
-  0.844300, 0.1989,
-  0.847100, 0.2014,
-  0.912100, 0.1482,
-  // f 1122/944 1059/879 1092/914 1123/945
-  0.844300, 0.1989,
-  0.909100, 0.1451,
-  0.912100, 0.1482,
-  // f 1124/946 1123/945 1092/914 1138/962
-  0.949400, 0.1207,
-  0.909100, 0.1451,
-  0.912100, 0.1482,
-  // f 1124/946 1123/945 1092/914 1138/962
-  0.949400, 0.1207,
-  0.951100, 0.1215,
-  0.912100, 0.1482,
-  // f 1139/963 1091/913 1058/878 1140/964
-  0.919800, 0.1573,
-  0.915700, 0.1535,
-  0.850400, 0.2065,
-  // f 1139/963 1091/913 1058/878 1140/964
-  0.919800, 0.1573,
-  0.851000, 0.2123,
-  0.850400, 0.2065,
-  // f 1140/964 1058/878 1061/881 1141/965
-  0.851000, 0.2123,
-  0.850400, 0.2065,
-  0.829900, 0.2213,
-  // f 1140/964 1058/878 1061/881 1141/965
-  0.851000, 0.2123,
-  0.829600, 0.226,
-  0.829900, 0.2213,
-  // f 1141/965 1061/881 1065/885 1142/966
-  0.829600, 0.226,
-  0.829900, 0.2213,
-  0.815700, 0.2343,
-  // f 1141/965 1061/881 1065/885 1142/966
-  0.829600, 0.226,
-  0.817700, 0.2369,
-  0.815700, 0.2343,
-  // f 1142/966 1065/885 1128/950 1102/967
-  0.817700, 0.2369,
-  0.815700, 0.2343,
-  0.788800, 0.2585,
-  // f 1142/966 1065/885 1128/950 1102/967
-  0.817700, 0.2369,
-  0.789100, 0.2609,
-  0.788800, 0.2585,
-  // f 1102/967 1128/950 1143/968 1099/969
-  0.789100, 0.2609,
-  0.788800, 0.2585,
-  0.751000, 0.2398,
-  // f 1102/967 1128/950 1143/968 1099/969
-  0.789100, 0.2609,
-  0.749400, 0.2407,
-  0.751000, 0.2398,
-  // f 1109/932 1099/922 1143/970 1144/971
-  0.704300, 0.909,
-  0.704100, 0.9129,
-  0.705100, 0.9129,
-  // f 1109/932 1099/922 1143/970 1144/971
-  0.704300, 0.909,
-  0.705300, 0.909,
-  0.705100, 0.9129,
-  // f 1103/926 1110/933 1145/972 1146/973
-  0.704400, 0.8912,
-  0.704300, 0.903,
-  0.705400, 0.903,
-  // f 1103/926 1110/933 1145/972 1146/973
-  0.704400, 0.8912,
-  0.705500, 0.8912,
-  0.705400, 0.903,
-  // f 1095/918 1104/927 1147/974 1148/975
-  0.704200, 0.8733,
-  0.704300, 0.8795,
-  0.705400, 0.8795,
-  // f 1095/918 1104/927 1147/974 1148/975
-  0.704200, 0.8733,
-  0.705300, 0.8733,
-  0.705400, 0.8795,
-  // f 1096/976 1149/977 1050/978 1107/979
-  0.700300, 0.284,
-  0.698900, 0.285,
-  0.709300, 0.3262,
-  // f 1096/976 1149/977 1050/978 1107/979
-  0.700300, 0.284,
-  0.712300, 0.3273,
-  0.709300, 0.3262,
-  // f 1107/979 1050/980 1052/873 1150/981
-  0.712300, 0.3273,
-  0.709300, 0.3266,
-  0.677200, 0.35,
-  // f 1107/979 1050/980 1052/873 1150/981
-  0.712300, 0.3273,
-  0.680400, 0.3516,
-  0.677200, 0.35,
-  // f 1150/981 1052/873 1063/883 1151/982
-  0.680400, 0.3516,
-  0.677200, 0.35,
-  0.660200, 0.3623,
-  // f 1150/981 1052/873 1063/883 1151/982
-  0.680400, 0.3516,
-  0.663800, 0.3645,
-  0.660200, 0.3623,
-  // f 1151/982 1063/883 1057/877 1152/983
-  0.663800, 0.3645,
-  0.660200, 0.3623,
-  0.640800, 0.3794,
-  // f 1151/982 1063/883 1057/877 1152/983
-  0.663800, 0.3645,
-  0.645300, 0.3814,
-  0.640800, 0.3794,
-  // f 1152/983 1057/877 1056/876 1153/984
-  0.645300, 0.3814,
-  0.640800, 0.3794,
-  0.575200, 0.4271,
-  // f 1152/983 1057/877 1056/876 1153/984
-  0.645300, 0.3814,
-  0.577300, 0.4317,
-  0.575200, 0.4271,
-  // f 1153/984 1056/876 1090/912 1154/985
-  0.577300, 0.4317,
-  0.575200, 0.4271,
-  0.543500, 0.453,
-  // f 1153/984 1056/876 1090/912 1154/985
-  0.577300, 0.4317,
-  0.545000, 0.4576,
-  0.543500, 0.453,
-  // f 1154/985 1090/912 1093/915 1155/986
-  0.545000, 0.4576,
-  0.543500, 0.453,
-  0.530200, 0.4585,
-  // f 1154/985 1090/912 1093/915 1155/986
-  0.545000, 0.4576,
-  0.532800, 0.4625,
-  0.530200, 0.4585,
-  // f 931/719 1155/986 1093/915 867/648
-  0.497200, 0.4884,
-  0.532800, 0.4625,
-  0.530200, 0.4585,
-  // f 931/719 1155/986 1093/915 867/648
-  0.497200, 0.4884,
-  0.493400, 0.4847,
-  0.530200, 0.4585,
-  // f 1144/987 1048/869 1030/845 1145/988
-  0.740600, 0.24,
-  0.739600, 0.2355,
-  0.728600, 0.24,
-  // f 1144/987 1048/869 1030/845 1145/988
-  0.740600, 0.24,
-  0.731100, 0.2437,
-  0.728600, 0.24,
-  // f 1149/977 1148/989 1068/888 1126/948
-  0.698900, 0.285,
-  0.700800, 0.2751,
-  0.696200, 0.2736,
-  // f 1149/977 1148/989 1068/888 1126/948
-  0.698900, 0.285,
-  0.694700, 0.2868,
-  0.696200, 0.2736,
-  // f 1104/927 1095/918 1098/921 1105/928
-  0.704300, 0.8795,
-  0.704200, 0.8733,
-  0.686200, 0.8733,
-  // f 1104/927 1095/918 1098/921 1105/928
-  0.704300, 0.8795,
-  0.686300, 0.8795,
-  0.686200, 0.8733,
-  // f 1099/922 1109/932 1112/935 1100/923
-  0.704100, 0.9129,
-  0.704300, 0.909,
-  0.686300, 0.909,
-  // f 1099/922 1109/932 1112/935 1100/923
-  0.704100, 0.9129,
-  0.686100, 0.9129,
-  0.686300, 0.909,
-  // f 1133/957 1131/955 1067/887 1066/886
-  0.692800, 0.2571,
-  0.685100, 0.2726,
-  0.690900, 0.2726,
-  // f 1133/957 1131/955 1067/887 1066/886
-  0.692800, 0.2571,
-  0.697800, 0.2599,
-  0.690900, 0.2726,
-  // f 1136/960 1134/958 1047/868 1046/867
-  0.756500, 0.2277,
-  0.740100, 0.2252,
-  0.739400, 0.2305,
-  // f 1136/960 1134/958 1047/868 1046/867
-  0.756500, 0.2277,
-  0.754400, 0.2315,
-  0.739400, 0.2305,
-  // f 1110/933 1109/932 1144/971 1145/972
-  0.704300, 0.903,
-  0.704300, 0.909,
-  0.705300, 0.909,
-  // f 1110/933 1109/932 1144/971 1145/972
-  0.704300, 0.903,
-  0.705400, 0.903,
-  0.705300, 0.909,
-  // f 1096/919 1095/918 1148/975 1149/990
-  0.704100, 0.8694,
-  0.704200, 0.8733,
-  0.705300, 0.8733,
-  // f 1096/919 1095/918 1148/975 1149/990
-  0.704100, 0.8694,
-  0.705100, 0.8694,
-  0.705300, 0.8733,
-  // f 1129/953 1130/954 1037/854 1119/941
-  0.699600, 0.3247,
-  0.685700, 0.2896,
-  0.650500, 0.302,
-  // f 1129/953 1130/954 1037/854 1119/941
-  0.699600, 0.3247,
-  0.671800, 0.3423,
-  0.650500, 0.302,
-  // f 1130/954 1131/955 1037/854
-  0.685700, 0.2896,
-  0.685100, 0.2726,
-  0.650500, 0.302,
-  // f 1135/959 1024/991 1023/992 1132/956
-  0.724400, 0.2303,
-  0.689700, 0.1846,
-  0.651500, 0.2164,
-  // f 1135/959 1024/991 1023/992 1132/956
-  0.724400, 0.2303,
-  0.708300, 0.2432,
-  0.651500, 0.2164,
-  // f 1133/957 1132/956 1023/992
-  0.692800, 0.2571,
-  0.708300, 0.2432,
-  0.651500, 0.2164,
-  // f 1038/857 1029/858 1024/991 1134/958
-  0.773800, 0.1993,
-  0.726400, 0.1466,
-  0.689700, 0.1846,
-  // f 1038/857 1029/858 1024/991 1134/958
-  0.773800, 0.1993,
-  0.740100, 0.2252,
-  0.689700, 0.1846,
-  // f 1135/959 1134/958 1024/991
-  0.724400, 0.2303,
-  0.740100, 0.2252,
-  0.689700, 0.1846,
-  // f 1038/857 1136/960 1137/961 1120/942
-  0.773800, 0.1993,
-  0.756500, 0.2277,
-  0.789900, 0.2491,
-  // f 1038/857 1136/960 1137/961 1120/942
-  0.773800, 0.1993,
-  0.809900, 0.228,
-  0.789900, 0.2491,
-  // f 1131/955 1133/957 1023/992 1027/855
-  0.685100, 0.2726,
-  0.692800, 0.2571,
-  0.651500, 0.2164,
-  // f 1131/955 1133/957 1023/992 1027/855
-  0.685100, 0.2726,
-  0.607200, 0.2458,
-  0.651500, 0.2164,
-  // f 1131/955 1027/855 1037/854
-  0.685100, 0.2726,
-  0.607200, 0.2458,
-  0.650500, 0.302,
-  // f 1134/958 1136/960 1038/857
-  0.740100, 0.2252,
-  0.756500, 0.2277,
-  0.773800, 0.1993,
-  // f 1145/988 1030/845 1033/848 1146/993
-  0.731100, 0.2437,
-  0.728600, 0.24,
-  0.714600, 0.2503,
-  // f 1145/988 1030/845 1033/848 1146/993
-  0.731100, 0.2437,
-  0.717500, 0.2535,
-  0.714600, 0.2503,
-  // f 1049/870 1048/869 1144/987 1143/968
-  0.752900, 0.2358,
-  0.739600, 0.2355,
-  0.740600, 0.24,
-  // f 1049/870 1048/869 1144/987 1143/968
-  0.752900, 0.2358,
-  0.751000, 0.2398,
-  0.740600, 0.24,
-  // f 1069/889 1068/888 1148/989 1147/994
-  0.702300, 0.2626,
-  0.696200, 0.2736,
-  0.700800, 0.2751,
-  // f 1069/889 1068/888 1148/989 1147/994
-  0.702300, 0.2626,
-  0.705800, 0.2655,
-  0.700800, 0.2751,
-  // f 1071/891 1049/870 1143/968 1128/950
-  0.787200, 0.2529,
-  0.752900, 0.2358,
-  0.751000, 0.2398,
-  // f 1071/891 1049/870 1143/968 1128/950
-  0.787200, 0.2529,
-  0.788800, 0.2585,
-  0.751000, 0.2398,
-  // f 1149/977 1126/948 1125/947 1050/978
-  0.698900, 0.285,
-  0.694700, 0.2868,
-  0.704100, 0.3227,
-  // f 1149/977 1126/948 1125/947 1050/978
-  0.698900, 0.285,
-  0.709300, 0.3262,
-  0.704100, 0.3227,
-  // f 1031/846 1030/845 1048/869 1047/868
-  0.726500, 0.2354,
-  0.728600, 0.24,
-  0.739600, 0.2355,
-  // f 1031/846 1030/845 1048/869 1047/868
-  0.726500, 0.2354,
-  0.739400, 0.2305,
-  0.739600, 0.2355,
-  // f 1127/949 1126/948 1068/888 1067/887
-  0.690100, 0.288,
-  0.694700, 0.2868,
-  0.696200, 0.2736,
-  // f 1127/949 1126/948 1068/888 1067/887
-  0.690100, 0.288,
-  0.690900, 0.2726,
-  0.696200, 0.2736,
-  // f 1051/871 1050/978 1125/947
-  0.700900, 0.3248,
-  0.709300, 0.3262,
-  0.704100, 0.3227,
-  // f 1070/890 1128/950 1065/885 1064/884
-  0.789800, 0.2503,
-  0.788800, 0.2585,
-  0.815700, 0.2343,
-  // f 1070/890 1128/950 1065/885 1064/884
-  0.789800, 0.2503,
-  0.812400, 0.2305,
-  0.815700, 0.2343,
-  // f 1069/889 1033/848 1032/847 1066/886
-  0.702300, 0.2626,
-  0.714600, 0.2503,
-  0.711300, 0.2467,
-  // f 1069/889 1033/848 1032/847 1066/886
-  0.702300, 0.2626,
-  0.697800, 0.2599,
-  0.711300, 0.2467,
-  // f 1110/933 1103/926 1106/929 1111/934
-  0.704300, 0.903,
-  0.704400, 0.8912,
-  0.686400, 0.8912,
-  // f 1110/933 1103/926 1106/929 1111/934
-  0.704300, 0.903,
-  0.686300, 0.903,
-  0.686400, 0.8912,
-  // f 1135/959 1132/956 1032/847 1031/846
-  0.724400, 0.2303,
-  0.708300, 0.2432,
-  0.711300, 0.2467,
-  // f 1135/959 1132/956 1032/847 1031/846
-  0.724400, 0.2303,
-  0.726500, 0.2354,
-  0.711300, 0.2467,
-  // f 1104/927 1103/926 1146/973 1147/974
-  0.704300, 0.8795,
-  0.704400, 0.8912,
-  0.705500, 0.8912,
-  // f 1104/927 1103/926 1146/973 1147/974
-  0.704300, 0.8795,
-  0.705400, 0.8795,
-  0.705500, 0.8912,
-  // f 1147/994 1146/993 1033/848 1069/889
-  0.705800, 0.2655,
-  0.717500, 0.2535,
-  0.714600, 0.2503,
-  // f 1147/994 1146/993 1033/848 1069/889
-  0.705800, 0.2655,
-  0.702300, 0.2626,
-  0.714600, 0.2503,
-  // f 1077/897 1156/995 1157/996 1078/898
-  0.174700, 0.2687,
-  0.232400, 0.2689,
-  0.232400, 0.2595,
-  // f 1077/897 1156/995 1157/996 1078/898
-  0.174700, 0.2687,
-  0.174600, 0.2592,
-  0.232400, 0.2595,
-  // f 1158/997 1084/904 1021/836 1080/900
-  0.232400, 0.0562,
-  0.232500, 0.0445,
-  0.174900, 0.045,
-  // f 1158/997 1084/904 1021/836 1080/900
-  0.232400, 0.0562,
-  0.174700, 0.0565,
-  0.174900, 0.045,
-  // f 1041/905 1087/998 1082/902 1018/833
-  0.174700, 0.2925,
-  0.232400, 0.2944,
-  0.232400, 0.2857,
-  // f 1041/905 1087/998 1082/902 1018/833
-  0.174700, 0.2925,
-  0.174800, 0.2845,
-  0.232400, 0.2857,
-  // f 1022/906 1083/999 1113/936 1085/907
-  0.497000, 0.3615,
-  0.465900, 0.4032,
-  0.505500, 0.4319,
-  // f 1022/906 1083/999 1113/936 1085/907
-  0.497000, 0.3615,
-  0.536800, 0.3948,
-  0.505500, 0.4319,
-  // f 1078/898 1157/996 1075/895 1000/815
-  0.174600, 0.2592,
-  0.232400, 0.2595,
-  0.232400, 0.1955,
-  // f 1078/898 1157/996 1075/895 1000/815
-  0.174600, 0.2592,
-  0.174600, 0.1954,
-  0.232400, 0.1955,
-  // f 1159/1000 1138/962 1092/914 1091/913
-  0.953200, 0.1256,
-  0.951100, 0.1215,
-  0.912100, 0.1482,
-  // f 1159/1000 1138/962 1092/914 1091/913
-  0.953200, 0.1256,
-  0.915700, 0.1535,
-  0.912100, 0.1482,
-  // f 936/734 1072/892 1073/893 937/735
-  0.277700, 0.0570000000000001,
-  0.232400, 0.0581,
-  0.232400, 0.0675,
-  // f 936/734 1072/892 1073/893 937/735
-  0.277700, 0.0570000000000001,
-  0.277700, 0.0673,
-  0.232400, 0.0675,
-  // f 938/736 1074/894 1075/895 939/737
-  0.277700, 0.1315,
-  0.232400, 0.1315,
-  0.232400, 0.1955,
-  // f 938/736 1074/894 1075/895 939/737
-  0.277700, 0.1315,
-  0.277700, 0.1956,
-  0.232400, 0.1955,
-  // f 940/738 1081/901 1082/902 941/739
-  0.277700, 0.2711,
-  0.232400, 0.2709,
-  0.232400, 0.2857,
-  // f 940/738 1081/901 1082/902 941/739
-  0.277700, 0.2711,
-  0.277700, 0.2865,
-  0.232400, 0.2857,
-  // f 1160/1001 1083/903 1084/904 1161/1002
-  0.246000, 0.0383,
-  0.232500, 0.0386,
-  0.232500, 0.0445,
-  // f 1160/1001 1083/903 1084/904 1161/1002
-  0.246000, 0.0383,
-  0.246000, 0.0442,
-  0.232500, 0.0445,
-  // f 944/1003 1087/909 1086/908 945/1004
-  0.945700, 0.0165999999999999,
-  0.910600, 0.0351,
-  0.937100, 0.0845,
-  // f 944/1003 1087/909 1086/908 945/1004
-  0.945700, 0.0165999999999999,
-  0.971700, 0.0647,
-  0.937100, 0.0845,
-  // f 937/735 1073/893 1074/894 938/736
-  0.277700, 0.0673,
-  0.232400, 0.0675,
-  0.232400, 0.1315,
-  // f 937/735 1073/893 1074/894 938/736
-  0.277700, 0.0673,
-  0.277700, 0.1315,
-  0.232400, 0.1315,
-  // f 945/1004 1086/908 1162/1005 946/1006
-  0.971700, 0.0647,
-  0.937100, 0.0845,
-  0.958700, 0.0937,
-  // f 945/1004 1086/908 1162/1005 946/1006
-  0.971700, 0.0647,
-  0.979600, 0.0749,
-  0.958700, 0.0937,
-  // f 1162/1005 1124/946 1138/962 1163/1007
-  0.958700, 0.0937,
-  0.949400, 0.1207,
-  0.951100, 0.1215,
-  // f 1162/1005 1124/946 1138/962 1163/1007
-  0.958700, 0.0937,
-  0.963700, 0.0957,
-  0.951100, 0.1215,
-  // f 1139/963 1164/1008 1159/1000 1091/913
-  0.919800, 0.1573,
-  0.957900, 0.1286,
-  0.953200, 0.1256,
-  // f 1139/963 1164/1008 1159/1000 1091/913
-  0.919800, 0.1573,
-  0.915700, 0.1535,
-  0.953200, 0.1256,
-  // f 867/648 1114/937 1113/936 950/748
-  0.493400, 0.4847,
-  0.526300, 0.4488,
-  0.505500, 0.4319,
-  // f 867/648 1114/937 1113/936 950/748
-  0.493400, 0.4847,
-  0.472000, 0.4637,
-  0.505500, 0.4319,
-  // f 1165/1009 1163/1007 1138/962 1159/1000
-  0.967000, 0.1004,
-  0.963700, 0.0957,
-  0.951100, 0.1215,
-  // f 1165/1009 1163/1007 1138/962 1159/1000
-  0.967000, 0.1004,
-  0.953200, 0.1256,
-  0.951100, 0.1215,
-  // f 1164/1008 1166/1010 1165/1009 1159/1000
-  0.957900, 0.1286,
-  0.971600, 0.1032,
-  0.967000, 0.1004,
-  // f 1164/1008 1166/1010 1165/1009 1159/1000
-  0.957900, 0.1286,
-  0.953200, 0.1256,
-  0.967000, 0.1004,
-  // f 953/751 1160/1001 1161/1002 954/752
-  0.277700, 0.0381,
-  0.246000, 0.0383,
-  0.246000, 0.0442,
-  // f 953/751 1160/1001 1161/1002 954/752
-  0.277700, 0.0381,
-  0.277700, 0.0441,
-  0.246000, 0.0442,
-  // f 946/1006 1162/1005 1163/1007 955/1011
-  0.979600, 0.0749,
-  0.958700, 0.0937,
-  0.963700, 0.0957,
-  // f 946/1006 1162/1005 1163/1007 955/1011
-  0.979600, 0.0749,
-  0.983300, 0.0765,
-  0.963700, 0.0957,
-  // f 1162/1005 1086/908 1124/946
-  0.958700, 0.0937,
-  0.937100, 0.0845,
-  0.949400, 0.1207,
-  // f 1006/821 1079/899 1045/866
-  0.064600, 0.2551,
-  0.066500, 0.2548,
-  0.065400, 0.2537,
-  // f 1010/825 1043/864 997/812
-  0.064700, 0.0719,
-  0.065400, 0.0734,
-  0.066500, 0.0723,
-  // f 996/811 999/814 1080/900 1016/831
-  0.087300, 0.0631,
-  0.174700, 0.0584,
-  0.174700, 0.0565,
-  // f 996/811 999/814 1080/900 1016/831
-  0.087300, 0.0631,
-  0.086500, 0.0614,
-  0.174700, 0.0565,
-  // f 1044/865 993/808 1002/817 1014/829
-  0.060700, 0.2375,
-  0.060400, 0.189,
-  0.058800, 0.1883,
-  // f 1044/865 993/808 1002/817 1014/829
-  0.060700, 0.2375,
-  0.058800, 0.2379,
-  0.058800, 0.1883,
-  // f 1076/896 1079/899 1006/821 1009/824
-  0.087300, 0.264,
-  0.066500, 0.2548,
-  0.064600, 0.2551,
-  // f 1076/896 1079/899 1006/821 1009/824
-  0.087300, 0.264,
-  0.086400, 0.2656,
-  0.064600, 0.2551,
-  // f 1042/863 1043/864 1010/825 1013/828
-  0.060700, 0.0896,
-  0.065400, 0.0734,
-  0.064700, 0.0719,
-  // f 1042/863 1043/864 1010/825 1013/828
-  0.060700, 0.0896,
-  0.058800, 0.0891,
-  0.064700, 0.0719,
-  // f 1045/866 1044/865 1014/829 1006/821
-  0.065400, 0.2537,
-  0.060700, 0.2375,
-  0.058800, 0.2379,
-  // f 1045/866 1044/865 1014/829 1006/821
-  0.065400, 0.2537,
-  0.064600, 0.2551,
-  0.058800, 0.2379,
-  // f 997/812 996/811 1016/831 1010/825
-  0.066500, 0.0723,
-  0.087300, 0.0631,
-  0.086500, 0.0614,
-  // f 997/812 996/811 1016/831 1010/825
-  0.066500, 0.0723,
-  0.064700, 0.0719,
-  0.086500, 0.0614,
-  // f 993/808 992/807 1003/818 1002/817
-  0.060400, 0.189,
-  0.060400, 0.1381,
-  0.058800, 0.1387,
-  // f 993/808 992/807 1003/818 1002/817
-  0.060400, 0.189,
-  0.058800, 0.1883,
-  0.058800, 0.1387,
-  // f 992/807 1042/863 1013/828 1003/818
-  0.060400, 0.1381,
-  0.060700, 0.0896,
-  0.058800, 0.0891,
-  // f 992/807 1042/863 1013/828 1003/818
-  0.060400, 0.1381,
-  0.058800, 0.1387,
-  0.058800, 0.0891,
-  // f 999/814 1072/892 1158/997 1080/900
-  0.174700, 0.0584,
-  0.232400, 0.0581,
-  0.232400, 0.0562,
-  // f 999/814 1072/892 1158/997 1080/900
-  0.174700, 0.0584,
-  0.174700, 0.0565,
-  0.232400, 0.0562,
-  // f 1077/897 1076/896 1009/824 1019/834
-  0.174700, 0.2687,
-  0.087300, 0.264,
-  0.086400, 0.2656,
-  // f 1077/897 1076/896 1009/824 1019/834
-  0.174700, 0.2687,
-  0.174700, 0.2706,
-  0.086400, 0.2656,
-  // f 1156/995 1077/897 1019/834 1081/901
-  0.232400, 0.2689,
-  0.174700, 0.2687,
-  0.174700, 0.2706,
-  // f 1156/995 1077/897 1019/834 1081/901
-  0.232400, 0.2689,
-  0.232400, 0.2709,
-  0.174700, 0.2706,
-  // f 1072/892 936/734 1158/997
-  0.232400, 0.0581,
-  0.277700, 0.0570000000000001,
-  0.232400, 0.0562,
-  // f 1150/1012 1167/1013 1108/931 1107/930
-  0.702500, 0.8377,
-  0.685300, 0.8377,
-  0.685200, 0.869,
-  // f 1150/1012 1167/1013 1108/931 1107/930
-  0.702500, 0.8377,
-  0.702400, 0.869,
-  0.685200, 0.869,
-  // f 1151/1014 1168/1015 1167/1013 1150/1012
-  0.695900, 0.8226,
-  0.678700, 0.8225,
-  0.685300, 0.8377,
-  // f 1151/1014 1168/1015 1167/1013 1150/1012
-  0.695900, 0.8226,
-  0.702500, 0.8377,
-  0.685300, 0.8377,
-  // f 1151/1014 1152/1016 1168/1015
-  0.695900, 0.8226,
-  0.678700, 0.8128,
-  0.678700, 0.8225,
-  // f 1153/1017 1169/1018 1168/1015 1152/1016
-  0.614800, 0.8102,
-  0.614800, 0.8198,
-  0.678700, 0.8225,
-  // f 1153/1017 1169/1018 1168/1015 1152/1016
-  0.614800, 0.8102,
-  0.678700, 0.8128,
-  0.678700, 0.8225,
-  // f 1154/1019 1170/1020 1169/1018 1153/1017
-  0.582500, 0.8102,
-  0.582500, 0.8198,
-  0.614800, 0.8198,
-  // f 1154/1019 1170/1020 1169/1018 1153/1017
-  0.582500, 0.8102,
-  0.614800, 0.8102,
-  0.614800, 0.8198,
-  // f 1155/1021 1171/1022 1170/1020 1154/1019
-  0.580600, 0.8103,
-  0.580600, 0.8199,
-  0.582500, 0.8198,
-  // f 1155/1021 1171/1022 1170/1020 1154/1019
-  0.580600, 0.8103,
-  0.582500, 0.8102,
-  0.582500, 0.8198,
-  // f 1102/925 1101/924 1172/1023 1142/1024
-  0.703300, 0.9126,
-  0.685300, 0.9126,
-  0.684200, 0.9423,
-  // f 1102/925 1101/924 1172/1023 1142/1024
-  0.703300, 0.9126,
-  0.702200, 0.9423,
-  0.684200, 0.9423,
-  // f 1141/1025 1173/1026 1140/1027
-  0.699100, 0.9552,
-  0.683500, 0.9553,
-  0.683400, 0.9684,
-  // f 1142/1024 1172/1023 1173/1026 1141/1025
-  0.702200, 0.9423,
-  0.684200, 0.9423,
-  0.683500, 0.9553,
-  // f 1142/1024 1172/1023 1173/1026 1141/1025
-  0.702200, 0.9423,
-  0.699100, 0.9552,
-  0.683500, 0.9553,
-  // f 1166/1028 1174/1029 964/772 963/771
-  0.567500, 0.9763,
-  0.567500, 0.9561,
-  0.546300, 0.9561,
-  // f 1166/1028 1174/1029 964/772 963/771
-  0.567500, 0.9763,
-  0.546300, 0.9768,
-  0.546300, 0.9561,
-  // f 1140/1027 1173/1026 1175/1030 1139/1031
-  0.683400, 0.9684,
-  0.683500, 0.9553,
-  0.614800, 0.9558,
-  // f 1140/1027 1173/1026 1175/1030 1139/1031
-  0.683400, 0.9684,
-  0.614800, 0.9743,
-  0.614800, 0.9558,
-  // f 1139/1031 1175/1030 1176/1032 1164/1033
-  0.614800, 0.9743,
-  0.614800, 0.9558,
-  0.576200, 0.9559,
-  // f 1139/1031 1175/1030 1176/1032 1164/1033
-  0.614800, 0.9743,
-  0.576200, 0.9756,
-  0.576200, 0.9559,
-  // f 1164/1033 1176/1032 1174/1029 1166/1028
-  0.576200, 0.9756,
-  0.576200, 0.9559,
-  0.567500, 0.9561,
-  // f 1164/1033 1176/1032 1174/1029 1166/1028
-  0.576200, 0.9756,
-  0.567500, 0.9763,
-  0.567500, 0.9561,
-  // f 1098/921 1177/1034 1178/1035 1105/928
-  0.686200, 0.8733,
-  0.658900, 0.8805,
-  0.658900, 0.8841,
-  // f 1098/921 1177/1034 1178/1035 1105/928
-  0.686200, 0.8733,
-  0.686300, 0.8795,
-  0.658900, 0.8841,
-  // f 1100/923 1179/1036 1180/1036 1101/924
-  0.686100, 0.9129,
-  0.658900, 0.9041,
-  0.658900, 0.9041,
-  // f 1100/923 1179/1036 1180/1036 1101/924
-  0.686100, 0.9129,
-  0.685300, 0.9126,
-  0.658900, 0.9041,
-  // f 1106/929 1181/1037 1182/1038 1111/934
-  0.686400, 0.8912,
-  0.658900, 0.8911,
-  0.658900, 0.8981,
-  // f 1106/929 1181/1037 1182/1038 1111/934
-  0.686400, 0.8912,
-  0.686300, 0.903,
-  0.658900, 0.8981,
-  // f 1108/931 1183/1039 1184/1040 1097/920
-  0.685200, 0.869,
-  0.658800, 0.8782,
-  0.658900, 0.8782,
-  // f 1108/931 1183/1039 1184/1040 1097/920
-  0.685200, 0.869,
-  0.686100, 0.8694,
-  0.658900, 0.8782,
-  // f 1112/935 1185/1041 1179/1036 1100/923
-  0.686300, 0.909,
-  0.658900, 0.9017,
-  0.658900, 0.9041,
-  // f 1112/935 1185/1041 1179/1036 1100/923
-  0.686300, 0.909,
-  0.686100, 0.9129,
-  0.658900, 0.9041,
-  // f 1097/920 1184/1040 1177/1034 1098/921
-  0.686100, 0.8694,
-  0.658900, 0.8782,
-  0.658900, 0.8805,
-  // f 1097/920 1184/1040 1177/1034 1098/921
-  0.686100, 0.8694,
-  0.686200, 0.8733,
-  0.658900, 0.8805,
-  // f 1111/934 1182/1038 1185/1041 1112/935
-  0.686300, 0.903,
-  0.658900, 0.8981,
-  0.658900, 0.9017,
-  // f 1111/934 1182/1038 1185/1041 1112/935
-  0.686300, 0.903,
-  0.686300, 0.909,
-  0.658900, 0.9017,
-  // f 1105/928 1178/1035 1181/1037 1106/929
-  0.686300, 0.8795,
-  0.658900, 0.8841,
-  0.658900, 0.8911,
-  // f 1105/928 1178/1035 1181/1037 1106/929
-  0.686300, 0.8795,
-  0.686400, 0.8912,
-  0.658900, 0.8911,
-  // f 1167/1013 1186/1042 1183/1039 1108/931
-  0.685300, 0.8377,
-  0.658800, 0.8595,
-  0.658800, 0.8782,
-  // f 1167/1013 1186/1042 1183/1039 1108/931
-  0.685300, 0.8377,
-  0.685200, 0.869,
-  0.658800, 0.8782,
-  // f 1168/1015 1187/1043 1186/1042 1167/1013
-  0.678700, 0.8225,
-  0.652200, 0.8504,
-  0.658800, 0.8595,
-  // f 1168/1015 1187/1043 1186/1042 1167/1013
-  0.678700, 0.8225,
-  0.685300, 0.8377,
-  0.658800, 0.8595,
-  // f 1169/1018 1188/1044 1187/1043 1168/1015
-  0.614800, 0.8198,
-  0.588000, 0.8487,
-  0.652200, 0.8504,
-  // f 1169/1018 1188/1044 1187/1043 1168/1015
-  0.614800, 0.8198,
-  0.678700, 0.8225,
-  0.652200, 0.8504,
-  // f 1170/1020 1189/1045 1188/1044 1169/1018
-  0.582500, 0.8198,
-  0.555500, 0.8487,
-  0.588000, 0.8487,
-  // f 1170/1020 1189/1045 1188/1044 1169/1018
-  0.582500, 0.8198,
-  0.614800, 0.8198,
-  0.588000, 0.8487,
-  // f 1171/1022 1190/1046 1189/1045 1170/1020
-  0.580600, 0.8199,
-  0.553400, 0.8487,
-  0.555500, 0.8487,
-  // f 1171/1022 1190/1046 1189/1045 1170/1020
-  0.580600, 0.8199,
-  0.582500, 0.8198,
-  0.555500, 0.8487,
-  // f 1101/924 1180/1036 1191/1047 1172/1023
-  0.685300, 0.9126,
-  0.658900, 0.9041,
-  0.657800, 0.9218,
-  // f 1101/924 1180/1036 1191/1047 1172/1023
-  0.685300, 0.9126,
-  0.684200, 0.9423,
-  0.657800, 0.9218,
-  // f 1172/1023 1191/1047 1192/1048 1173/1026
-  0.684200, 0.9423,
-  0.657800, 0.9218,
-  0.657100, 0.9295,
-  // f 1172/1023 1191/1047 1192/1048 1173/1026
-  0.684200, 0.9423,
-  0.683500, 0.9553,
-  0.657100, 0.9295,
-  // f 1174/1029 984/793 964/772
-  0.567500, 0.9561,
-  0.547200, 0.9365,
-  0.546300, 0.9561,
-  // f 1173/1026 1192/1048 1193/1049 1175/1030
-  0.683500, 0.9553,
-  0.657100, 0.9295,
-  0.588100, 0.9297,
-  // f 1173/1026 1192/1048 1193/1049 1175/1030
-  0.683500, 0.9553,
-  0.614800, 0.9558,
-  0.588100, 0.9297,
-  // f 1175/1030 1193/1049 987/796 1176/1032
-  0.614800, 0.9558,
-  0.588100, 0.9297,
-  0.548400, 0.9298,
-  // f 1175/1030 1193/1049 987/796 1176/1032
-  0.614800, 0.9558,
-  0.576200, 0.9559,
-  0.548400, 0.9298,
-  // f 987/796 1194/1050 984/793
-  0.548400, 0.9298,
-  0.547500, 0.9298,
-  0.547200, 0.9365,
-  // f 987/796 984/793 1174/1029 1176/1032
-  0.548400, 0.9298,
-  0.547200, 0.9365,
-  0.567500, 0.9561,
-  // f 987/796 984/793 1174/1029 1176/1032
-  0.548400, 0.9298,
-  0.576200, 0.9559,
-  0.567500, 0.9561,
-  // f 1156/995 989/798 988/797 1157/996
-  0.232400, 0.2689,
-  0.277700, 0.2691,
-  0.277700, 0.2598,
-  // f 1156/995 989/798 988/797 1157/996
-  0.232400, 0.2689,
-  0.232400, 0.2595,
-  0.277700, 0.2598,
-  // f 1161/1002 1084/904 1158/997 954/752
-  0.246000, 0.0442,
-  0.232500, 0.0445,
-  0.232400, 0.0562,
-  // f 1161/1002 1084/904 1158/997 954/752
-  0.246000, 0.0442,
-  0.277700, 0.0441,
-  0.232400, 0.0562,
-  // f 936/734 954/752 1158/997
-  0.277700, 0.0570000000000001,
-  0.277700, 0.0441,
-  0.232400, 0.0562,
-  // f 1087/998 944/799 941/739 1082/902
-  0.232400, 0.2944,
-  0.277700, 0.2955,
-  0.277700, 0.2865,
-  // f 1087/998 944/799 941/739 1082/902
-  0.232400, 0.2944,
-  0.232400, 0.2857,
-  0.277700, 0.2865,
-  // f 953/801 950/748 1113/936 1160/1051
-  0.439900, 0.4322,
-  0.472000, 0.4637,
-  0.505500, 0.4319,
-  // f 953/801 950/748 1113/936 1160/1051
-  0.439900, 0.4322,
-  0.458800, 0.4126,
-  0.505500, 0.4319,
-  // f 1113/936 1083/999 1160/1051
-  0.505500, 0.4319,
-  0.465900, 0.4032,
-  0.458800, 0.4126,
-  // f 1157/996 988/797 939/737 1075/895
-  0.232400, 0.2595,
-  0.277700, 0.2598,
-  0.277700, 0.1956,
-  // f 1157/996 988/797 939/737 1075/895
-  0.232400, 0.2595,
-  0.232400, 0.1955,
-  0.277700, 0.1956,
-  // f 946/1052 955/1011 1163/1007
-  0.985800, 0.0787,
-  0.983300, 0.0765,
-  0.963700, 0.0957,
-  // f 1163/1007 1165/1009 946/1052
-  0.963700, 0.0957,
-  0.967000, 0.1004,
-  0.985800, 0.0787,
-  // f 1114/937 867/648 868/917 1094/916
-  0.526300, 0.4488,
-  0.493400, 0.4847,
-  0.496200, 0.4827,
-  // f 1114/937 867/648 868/917 1094/916
-  0.526300, 0.4488,
-  0.527100, 0.4529,
-  0.496200, 0.4827,
-  // f 963/1053 946/1052 1165/1009 1166/1010
-  0.989400, 0.0822000000000001,
-  0.985800, 0.0787,
-  0.967000, 0.1004,
-  // f 963/1053 946/1052 1165/1009 1166/1010
-  0.989400, 0.0822000000000001,
-  0.971600, 0.1032,
-  0.967000, 0.1004,
-  // f 1081/901 940/738 989/798 1156/995
-  0.232400, 0.2709,
-  0.277700, 0.2711,
-  0.277700, 0.2691,
-  // f 1081/901 940/738 989/798 1156/995
-  0.232400, 0.2709,
-  0.232400, 0.2689,
-  0.277700, 0.2691,
-  // f 1155/1021 931/805 990/804 1171/1022
-  0.580600, 0.8103,
-  0.546100, 0.8103,
-  0.546100, 0.8199,
-  // f 1155/1021 931/805 990/804 1171/1022
-  0.580600, 0.8103,
-  0.580600, 0.8199,
-  0.546100, 0.8199,
-  // f 990/804 991/806 1190/1046 1171/1022
-  0.546100, 0.8199,
-  0.547500, 0.8487,
-  0.553400, 0.8487,
-  // f 990/804 991/806 1190/1046 1171/1022
-  0.546100, 0.8199,
-  0.580600, 0.8199,
-  0.553400, 0.8487,
-  // f 1195/1054 1196/1055 1197/1056 1198/1057
-  0.337600, 0.3427,
-  0.342100, 0.3475,
-  0.354000, 0.3475,
-  // f 1195/1054 1196/1055 1197/1056 1198/1057
-  0.337600, 0.3427,
-  0.358500, 0.3427,
-  0.354000, 0.3475,
-  // f 1199/1058 1200/1059 1201/1060 1202/1061
-  0.337600, 0.3697,
-  0.358500, 0.3697,
-  0.354000, 0.365,
-  // f 1199/1058 1200/1059 1201/1060 1202/1061
-  0.337600, 0.3697,
-  0.342100, 0.365,
-  0.354000, 0.365,
-  // f 1198/1057 1197/1056 1201/1060 1200/1059
-  0.358500, 0.3427,
-  0.354000, 0.3475,
-  0.354000, 0.365,
-  // f 1198/1057 1197/1056 1201/1060 1200/1059
-  0.358500, 0.3427,
-  0.358500, 0.3697,
-  0.354000, 0.365,
-  // f 1197/1056 1196/1055 1202/1061 1201/1060
-  0.354000, 0.3475,
-  0.342100, 0.3475,
-  0.342100, 0.365,
-  // f 1197/1056 1196/1055 1202/1061 1201/1060
-  0.354000, 0.3475,
-  0.354000, 0.365,
-  0.342100, 0.365,
-  // f 1196/1055 1195/1054 1199/1058 1202/1061
-  0.342100, 0.3475,
-  0.337600, 0.3427,
-  0.337600, 0.3697,
-  // f 1196/1055 1195/1054 1199/1058 1202/1061
-  0.342100, 0.3475,
-  0.342100, 0.365,
-  0.337600, 0.3697,
-};
-
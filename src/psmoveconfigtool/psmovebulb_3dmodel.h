@@ -1,4209 +0,0 @@
-/*
-created with obj2opengl.pl
-
-source file    : .\PSMoveMotionControllerBulb.obj
-vertices       : 193
-faces          : 348
-normals        : 192
-texture coords : 202
-
-
-// include generated arrays
-#import ".\PSMoveMotionControllerBulb.h"
-
-// set input data to arrays
-glVertexPointer(3, GL_FLOAT, 0, psmovebulbVerts);
-glNormalPointer(GL_FLOAT, 0, psmovebulbNormals);
-glTexCoordPointer(2, GL_FLOAT, 0, psmovebulbTexCoords);
-
-// draw data
-glDrawArrays(GL_TRIANGLES, 0, psmovebulbNumVerts);
-*/
-
-unsigned int psmovebulbNumVerts = 1044;
-
-float psmovebulbVerts [] = {
-  // f 1/1/1 2/2/2 3/3/3
-  0.105107, -0.946812, -6.69275,
-  -0.368293, -0.819912, -6.69275,
-  -0.384493, -0.848112, -6.76885,
-  // f 3/3/3 4/4/4 1/1/1
-  -0.384493, -0.848112, -6.76885,
-  0.105107, -0.979312, -6.76885,
-  0.105107, -0.946812, -6.69275,
-  // f 2/2/2 5/5/5 6/6/6
-  -0.368293, -0.819912, -6.69275,
-  -0.714792, -0.473412, -6.69275,
-  -0.742992, -0.489612, -6.76885,
-  // f 6/6/6 3/3/3 2/2/2
-  -0.742992, -0.489612, -6.76885,
-  -0.384493, -0.848112, -6.76885,
-  -0.368293, -0.819912, -6.69275,
-  // f 5/5/5 7/7/7 8/8/8
-  -0.714792, -0.473412, -6.69275,
-  -0.841693, -1.2e-005, -6.69275,
-  -0.874192, -1.2e-005, -6.76885,
-  // f 8/8/8 6/6/6 5/5/5
-  -0.874192, -1.2e-005, -6.76885,
-  -0.742992, -0.489612, -6.76885,
-  -0.714792, -0.473412, -6.69275,
-  // f 7/7/7 9/9/9 10/10/10
-  -0.841693, -1.2e-005, -6.69275,
-  -0.714792, 0.473388, -6.69275,
-  -0.742992, 0.489588, -6.76885,
-  // f 10/10/10 8/8/8 7/7/7
-  -0.742992, 0.489588, -6.76885,
-  -0.874192, -1.2e-005, -6.76885,
-  -0.841693, -1.2e-005, -6.69275,
-  // f 9/9/9 11/11/11 12/12/12
-  -0.714792, 0.473388, -6.69275,
-  -0.368293, 0.819888, -6.69275,
-  -0.384493, 0.848088, -6.76885,
-  // f 12/12/12 10/10/10 9/9/9
-  -0.384493, 0.848088, -6.76885,
-  -0.742992, 0.489588, -6.76885,
-  -0.714792, 0.473388, -6.69275,
-  // f 11/11/11 13/13/13 14/14/14
-  -0.368293, 0.819888, -6.69275,
-  0.105107, 0.946788, -6.69275,
-  0.105107, 0.979288, -6.76885,
-  // f 14/14/14 12/12/12 11/11/11
-  0.105107, 0.979288, -6.76885,
-  -0.384493, 0.848088, -6.76885,
-  -0.368293, 0.819888, -6.69275,
-  // f 15/15/15 16/16/16 17/17/17
-  -0.361493, -0.808112, -6.68005,
-  0.105107, -0.933112, -6.68005,
-  0.105107, -0.809612, -6.63565,
-  // f 17/17/17 18/18/18 15/15/15
-  0.105107, -0.809612, -6.63565,
-  -0.299693, -0.701212, -6.63565,
-  -0.361493, -0.808112, -6.68005,
-  // f 19/19/19 15/15/15 18/18/18
-  -0.702992, -0.466612, -6.68005,
-  -0.361493, -0.808112, -6.68005,
-  -0.299693, -0.701212, -6.63565,
-  // f 18/18/18 20/20/20 19/19/19
-  -0.299693, -0.701212, -6.63565,
-  -0.596092, -0.404812, -6.63565,
-  -0.702992, -0.466612, -6.68005,
-  // f 21/21/21 19/19/19 20/20/20
-  -0.827992, -1.2e-005, -6.68005,
-  -0.702992, -0.466612, -6.68005,
-  -0.596092, -0.404812, -6.63565,
-  // f 20/20/20 22/22/22 21/21/21
-  -0.596092, -0.404812, -6.63565,
-  -0.704493, -1.2e-005, -6.63565,
-  -0.827992, -1.2e-005, -6.68005,
-  // f 23/23/23 21/21/21 22/22/22
-  -0.702992, 0.466588, -6.68005,
-  -0.827992, -1.2e-005, -6.68005,
-  -0.704493, -1.2e-005, -6.63565,
-  // f 22/22/22 24/24/24 23/23/23
-  -0.704493, -1.2e-005, -6.63565,
-  -0.596092, 0.404788, -6.63565,
-  -0.702992, 0.466588, -6.68005,
-  // f 25/25/25 23/23/23 24/24/24
-  -0.361493, 0.808088, -6.68005,
-  -0.702992, 0.466588, -6.68005,
-  -0.596092, 0.404788, -6.63565,
-  // f 24/24/24 26/26/26 25/25/25
-  -0.596092, 0.404788, -6.63565,
-  -0.299693, 0.701188, -6.63565,
-  -0.361493, 0.808088, -6.68005,
-  // f 27/27/27 25/25/25 26/26/26
-  0.105107, 0.933088, -6.68005,
-  -0.361493, 0.808088, -6.68005,
-  -0.299693, 0.701188, -6.63565,
-  // f 26/26/26 28/28/28 27/27/27
-  -0.299693, 0.701188, -6.63565,
-  0.105107, 0.809588, -6.63565,
-  0.105107, 0.933088, -6.68005,
-  // f 4/4/4 3/3/3 29/29/29
-  0.105107, -0.979312, -6.76885,
-  -0.384493, -0.848112, -6.76885,
-  -0.532393, -1.104212, -6.92675,
-  // f 29/29/29 30/30/30 4/4/4
-  -0.532393, -1.104212, -6.92675,
-  0.105107, -1.275012, -6.92675,
-  0.105107, -0.979312, -6.76885,
-  // f 3/3/3 6/6/6 31/31/31
-  -0.384493, -0.848112, -6.76885,
-  -0.742992, -0.489612, -6.76885,
-  -0.999093, -0.637512, -6.92675,
-  // f 31/31/31 29/29/29 3/3/3
-  -0.999093, -0.637512, -6.92675,
-  -0.532393, -1.104212, -6.92675,
-  -0.384493, -0.848112, -6.76885,
-  // f 6/6/6 8/8/8 32/32/32
-  -0.742992, -0.489612, -6.76885,
-  -0.874192, -1.2e-005, -6.76885,
-  -1.169892, -1.2e-005, -6.92675,
-  // f 32/32/32 31/31/31 6/6/6
-  -1.169892, -1.2e-005, -6.92675,
-  -0.999093, -0.637512, -6.92675,
-  -0.742992, -0.489612, -6.76885,
-  // f 8/8/8 10/10/10 33/33/33
-  -0.874192, -1.2e-005, -6.76885,
-  -0.742992, 0.489588, -6.76885,
-  -0.999093, 0.637488, -6.92675,
-  // f 33/33/33 32/32/32 8/8/8
-  -0.999093, 0.637488, -6.92675,
-  -1.169892, -1.2e-005, -6.92675,
-  -0.874192, -1.2e-005, -6.76885,
-  // f 10/10/10 12/12/12 34/34/34
-  -0.742992, 0.489588, -6.76885,
-  -0.384493, 0.848088, -6.76885,
-  -0.532393, 1.104188, -6.92675,
-  // f 34/34/34 33/33/33 10/10/10
-  -0.532393, 1.104188, -6.92675,
-  -0.999093, 0.637488, -6.92675,
-  -0.742992, 0.489588, -6.76885,
-  // f 12/12/12 14/14/14 35/35/35
-  -0.384493, 0.848088, -6.76885,
-  0.105107, 0.979288, -6.76885,
-  0.105107, 1.274988, -6.92675,
-  // f 35/35/35 34/34/34 12/12/12
-  0.105107, 1.274988, -6.92675,
-  -0.532393, 1.104188, -6.92675,
-  -0.384493, 0.848088, -6.76885,
-  // f 30/30/30 29/29/29 36/36/36
-  0.105107, -1.275012, -6.92675,
-  -0.532393, -1.104212, -6.92675,
-  -0.862693, -1.676212, -7.539251,
-  // f 36/36/36 37/37/37 30/30/30
-  -0.862693, -1.676212, -7.539251,
-  0.105107, -1.935512, -7.539251,
-  0.105107, -1.275012, -6.92675,
-  // f 29/29/29 31/31/31 38/38/38
-  -0.532393, -1.104212, -6.92675,
-  -0.999093, -0.637512, -6.92675,
-  -1.571093, -0.967812, -7.53925,
-  // f 38/38/38 36/36/36 29/29/29
-  -1.571093, -0.967812, -7.53925,
-  -0.862693, -1.676212, -7.539251,
-  -0.532393, -1.104212, -6.92675,
-  // f 31/31/31 32/32/32 39/39/39
-  -0.999093, -0.637512, -6.92675,
-  -1.169892, -1.2e-005, -6.92675,
-  -1.830393, -1.2e-005, -7.53925,
-  // f 39/39/39 38/38/38 31/31/31
-  -1.830393, -1.2e-005, -7.53925,
-  -1.571093, -0.967812, -7.53925,
-  -0.999093, -0.637512, -6.92675,
-  // f 32/32/32 33/33/33 40/40/40
-  -1.169892, -1.2e-005, -6.92675,
-  -0.999093, 0.637488, -6.92675,
-  -1.571093, 0.967788, -7.53925,
-  // f 40/40/40 39/39/39 32/32/32
-  -1.571093, 0.967788, -7.53925,
-  -1.830393, -1.2e-005, -7.53925,
-  -1.169892, -1.2e-005, -6.92675,
-  // f 33/33/33 34/34/34 41/41/41
-  -0.999093, 0.637488, -6.92675,
-  -0.532393, 1.104188, -6.92675,
-  -0.862693, 1.676188, -7.539249,
-  // f 41/41/41 40/40/40 33/33/33
-  -0.862693, 1.676188, -7.539249,
-  -1.571093, 0.967788, -7.53925,
-  -0.999093, 0.637488, -6.92675,
-  // f 34/34/34 35/35/35 42/42/42
-  -0.532393, 1.104188, -6.92675,
-  0.105107, 1.274988, -6.92675,
-  0.105107, 1.935488, -7.539249,
-  // f 42/42/42 41/41/41 34/34/34
-  0.105107, 1.935488, -7.539249,
-  -0.862693, 1.676188, -7.539249,
-  -0.532393, 1.104188, -6.92675,
-  // f 37/37/37 36/36/36 43/43/43
-  0.105107, -1.935512, -7.539251,
-  -0.862693, -1.676212, -7.539251,
-  -1.059293, -2.016811, -8.416551,
-  // f 43/43/43 44/44/44 37/37/37
-  -1.059293, -2.016811, -8.416551,
-  0.105107, -2.32881, -8.416551,
-  0.105107, -1.935512, -7.539251,
-  // f 36/36/36 38/38/38 45/45/45
-  -0.862693, -1.676212, -7.539251,
-  -1.571093, -0.967812, -7.53925,
-  -1.911693, -1.164411, -8.416551,
-  // f 45/45/45 43/43/43 36/36/36
-  -1.911693, -1.164411, -8.416551,
-  -1.059293, -2.016811, -8.416551,
-  -0.862693, -1.676212, -7.539251,
-  // f 38/38/38 39/39/39 46/46/46
-  -1.571093, -0.967812, -7.53925,
-  -1.830393, -1.2e-005, -7.53925,
-  -2.223693, -1.2e-005, -8.416551,
-  // f 46/46/46 45/45/45 38/38/38
-  -2.223693, -1.2e-005, -8.416551,
-  -1.911693, -1.164411, -8.416551,
-  -1.571093, -0.967812, -7.53925,
-  // f 39/39/39 40/40/40 47/47/47
-  -1.830393, -1.2e-005, -7.53925,
-  -1.571093, 0.967788, -7.53925,
-  -1.911693, 1.164388, -8.416551,
-  // f 47/47/47 46/46/46 39/39/39
-  -1.911693, 1.164388, -8.416551,
-  -2.223693, -1.2e-005, -8.416551,
-  -1.830393, -1.2e-005, -7.53925,
-  // f 40/40/40 41/41/41 48/48/48
-  -1.571093, 0.967788, -7.53925,
-  -0.862693, 1.676188, -7.539249,
-  -1.059293, 2.016789, -8.416551,
-  // f 48/48/48 47/47/47 40/40/40
-  -1.059293, 2.016789, -8.416551,
-  -1.911693, 1.164388, -8.416551,
-  -1.571093, 0.967788, -7.53925,
-  // f 41/41/41 42/42/42 49/49/49
-  -0.862693, 1.676188, -7.539249,
-  0.105107, 1.935488, -7.539249,
-  0.105107, 2.328789, -8.416551,
-  // f 49/49/49 48/48/48 41/41/41
-  0.105107, 2.328789, -8.416551,
-  -1.059293, 2.016789, -8.416551,
-  -0.862693, 1.676188, -7.539249,
-  // f 44/44/44 43/43/43 50/50/50
-  0.105107, -2.32881, -8.416551,
-  -1.059293, -2.016811, -8.416551,
-  -1.059293, -2.016811, -9.36445,
-  // f 50/50/50 51/51/51 44/44/44
-  -1.059293, -2.016811, -9.36445,
-  0.105107, -2.32881, -9.36445,
-  0.105107, -2.32881, -8.416551,
-  // f 43/43/43 45/45/45 52/52/52
-  -1.059293, -2.016811, -8.416551,
-  -1.911693, -1.164411, -8.416551,
-  -1.911693, -1.16441, -9.36445,
-  // f 52/52/52 50/50/50 43/43/43
-  -1.911693, -1.16441, -9.36445,
-  -1.059293, -2.016811, -9.36445,
-  -1.059293, -2.016811, -8.416551,
-  // f 45/45/45 46/46/46 53/53/53
-  -1.911693, -1.164411, -8.416551,
-  -2.223693, -1.2e-005, -8.416551,
-  -2.223693, -1e-005, -9.36445,
-  // f 53/53/53 52/52/52 45/45/45
-  -2.223693, -1e-005, -9.36445,
-  -1.911693, -1.16441, -9.36445,
-  -1.911693, -1.164411, -8.416551,
-  // f 46/46/46 47/47/47 54/54/54
-  -2.223693, -1.2e-005, -8.416551,
-  -1.911693, 1.164388, -8.416551,
-  -1.911693, 1.164389, -9.36445,
-  // f 54/54/54 53/53/53 46/46/46
-  -1.911693, 1.164389, -9.36445,
-  -2.223693, -1e-005, -9.36445,
-  -2.223693, -1.2e-005, -8.416551,
-  // f 47/47/47 48/48/48 55/55/55
-  -1.911693, 1.164388, -8.416551,
-  -1.059293, 2.016789, -8.416551,
-  -1.059293, 2.016789, -9.36445,
-  // f 55/55/55 54/54/54 47/47/47
-  -1.059293, 2.016789, -9.36445,
-  -1.911693, 1.164389, -9.36445,
-  -1.911693, 1.164388, -8.416551,
-  // f 48/48/48 49/49/49 56/56/56
-  -1.059293, 2.016789, -8.416551,
-  0.105107, 2.328789, -8.416551,
-  0.105107, 2.328789, -9.36445,
-  // f 56/56/56 55/55/55 48/48/48
-  0.105107, 2.328789, -9.36445,
-  -1.059293, 2.016789, -9.36445,
-  -1.059293, 2.016789, -8.416551,
-  // f 51/51/51 50/50/50 57/57/57
-  0.105107, -2.32881, -9.36445,
-  -1.059293, -2.016811, -9.36445,
-  -0.879892, -1.70621, -10.14235,
-  // f 57/57/57 58/58/58 51/51/51
-  -0.879892, -1.70621, -10.14235,
-  0.105107, -1.97011, -10.14235,
-  0.105107, -2.32881, -9.36445,
-  // f 50/50/50 52/52/52 59/59/59
-  -1.059293, -2.016811, -9.36445,
-  -1.911693, -1.16441, -9.36445,
-  -1.601092, -0.98501, -10.14235,
-  // f 59/59/59 57/57/57 50/50/50
-  -1.601092, -0.98501, -10.14235,
-  -0.879892, -1.70621, -10.14235,
-  -1.059293, -2.016811, -9.36445,
-  // f 52/52/52 53/53/53 60/60/60
-  -1.911693, -1.16441, -9.36445,
-  -2.223693, -1e-005, -9.36445,
-  -1.864993, -1e-005, -10.14235,
-  // f 60/60/60 59/59/59 52/52/52
-  -1.864993, -1e-005, -10.14235,
-  -1.601092, -0.98501, -10.14235,
-  -1.911693, -1.16441, -9.36445,
-  // f 53/53/53 54/54/54 61/61/61
-  -2.223693, -1e-005, -9.36445,
-  -1.911693, 1.164389, -9.36445,
-  -1.601092, 0.98499, -10.14235,
-  // f 61/61/61 60/60/60 53/53/53
-  -1.601092, 0.98499, -10.14235,
-  -1.864993, -1e-005, -10.14235,
-  -2.223693, -1e-005, -9.36445,
-  // f 54/54/54 55/55/55 62/62/62
-  -1.911693, 1.164389, -9.36445,
-  -1.059293, 2.016789, -9.36445,
-  -0.879892, 1.70619, -10.14235,
-  // f 62/62/62 61/61/61 54/54/54
-  -0.879892, 1.70619, -10.14235,
-  -1.601092, 0.98499, -10.14235,
-  -1.911693, 1.164389, -9.36445,
-  // f 55/55/55 56/56/56 63/63/63
-  -1.059293, 2.016789, -9.36445,
-  0.105107, 2.328789, -9.36445,
-  0.105107, 1.97009, -10.14235,
-  // f 63/63/63 62/62/62 55/55/55
-  0.105107, 1.97009, -10.14235,
-  -0.879892, 1.70619, -10.14235,
-  -1.059293, 2.016789, -9.36445,
-  // f 58/58/58 57/57/57 64/64/64
-  0.105107, -1.97011, -10.14235,
-  -0.879892, -1.70621, -10.14235,
-  -0.568493, -1.16671, -10.76235,
-  // f 64/64/64 65/65/65 58/58/58
-  -0.568493, -1.16671, -10.76235,
-  0.105107, -1.34721, -10.76235,
-  0.105107, -1.97011, -10.14235,
-  // f 57/57/57 59/59/59 66/66/66
-  -0.879892, -1.70621, -10.14235,
-  -1.601092, -0.98501, -10.14235,
-  -1.061593, -0.67361, -10.76235,
-  // f 66/66/66 64/64/64 57/57/57
-  -1.061593, -0.67361, -10.76235,
-  -0.568493, -1.16671, -10.76235,
-  -0.879892, -1.70621, -10.14235,
-  // f 59/59/59 60/60/60 67/67/67
-  -1.601092, -0.98501, -10.14235,
-  -1.864993, -1e-005, -10.14235,
-  -1.242093, -1e-005, -10.76235,
-  // f 67/67/67 66/66/66 59/59/59
-  -1.242093, -1e-005, -10.76235,
-  -1.061593, -0.67361, -10.76235,
-  -1.601092, -0.98501, -10.14235,
-  // f 60/60/60 61/61/61 68/68/68
-  -1.864993, -1e-005, -10.14235,
-  -1.601092, 0.98499, -10.14235,
-  -1.061593, 0.67359, -10.76235,
-  // f 68/68/68 67/67/67 60/60/60
-  -1.061593, 0.67359, -10.76235,
-  -1.242093, -1e-005, -10.76235,
-  -1.864993, -1e-005, -10.14235,
-  // f 61/61/61 62/62/62 69/69/69
-  -1.601092, 0.98499, -10.14235,
-  -0.879892, 1.70619, -10.14235,
-  -0.568493, 1.16669, -10.76235,
-  // f 69/69/69 68/68/68 61/61/61
-  -0.568493, 1.16669, -10.76235,
-  -1.061593, 0.67359, -10.76235,
-  -1.601092, 0.98499, -10.14235,
-  // f 62/62/62 63/63/63 70/70/70
-  -0.879892, 1.70619, -10.14235,
-  0.105107, 1.97009, -10.14235,
-  0.105107, 1.34719, -10.76235,
-  // f 70/70/70 69/69/69 62/62/62
-  0.105107, 1.34719, -10.76235,
-  -0.568493, 1.16669, -10.76235,
-  -0.879892, 1.70619, -10.14235,
-  // f 65/65/65 64/64/64 71/71/71
-  0.105107, -1.34721, -10.76235,
-  -0.568493, -1.16671, -10.76235,
-  -0.180793, -0.49521, -11.065551,
-  // f 71/71/71 72/72/72 65/65/65
-  -0.180793, -0.49521, -11.065551,
-  0.105107, -0.57181, -11.065551,
-  0.105107, -1.34721, -10.76235,
-  // f 64/64/64 66/66/66 73/73/73
-  -0.568493, -1.16671, -10.76235,
-  -1.061593, -0.67361, -10.76235,
-  -0.390093, -0.28591, -11.065551,
-  // f 73/73/73 71/71/71 64/64/64
-  -0.390093, -0.28591, -11.065551,
-  -0.180793, -0.49521, -11.065551,
-  -0.568493, -1.16671, -10.76235,
-  // f 66/66/66 67/67/67 74/74/74
-  -1.061593, -0.67361, -10.76235,
-  -1.242093, -1e-005, -10.76235,
-  -0.466693, -1e-005, -11.065551,
-  // f 74/74/74 73/73/73 66/66/66
-  -0.466693, -1e-005, -11.065551,
-  -0.390093, -0.28591, -11.065551,
-  -1.061593, -0.67361, -10.76235,
-  // f 67/67/67 68/68/68 75/75/75
-  -1.242093, -1e-005, -10.76235,
-  -1.061593, 0.67359, -10.76235,
-  -0.390093, 0.28589, -11.065551,
-  // f 75/75/75 74/74/74 67/67/67
-  -0.390093, 0.28589, -11.065551,
-  -0.466693, -1e-005, -11.065551,
-  -1.242093, -1e-005, -10.76235,
-  // f 68/68/68 69/69/69 76/76/76
-  -1.061593, 0.67359, -10.76235,
-  -0.568493, 1.16669, -10.76235,
-  -0.180793, 0.49519, -11.065551,
-  // f 76/76/76 75/75/75 68/68/68
-  -0.180793, 0.49519, -11.065551,
-  -0.390093, 0.28589, -11.065551,
-  -1.061593, 0.67359, -10.76235,
-  // f 69/69/69 70/70/70 77/77/77
-  -0.568493, 1.16669, -10.76235,
-  0.105107, 1.34719, -10.76235,
-  0.105107, 0.57179, -11.065551,
-  // f 77/77/77 76/76/76 69/69/69
-  0.105107, 0.57179, -11.065551,
-  -0.180793, 0.49519, -11.065551,
-  -0.568493, 1.16669, -10.76235,
-  // f 72/72/72 71/71/71 78/78/78
-  0.105107, -0.57181, -11.065551,
-  -0.180793, -0.49521, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  // f 71/71/71 73/73/73 78/78/78
-  -0.180793, -0.49521, -11.065551,
-  -0.390093, -0.28591, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  // f 73/73/73 74/74/74 78/78/78
-  -0.390093, -0.28591, -11.065551,
-  -0.466693, -1e-005, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  // f 74/74/74 75/75/75 78/78/78
-  -0.466693, -1e-005, -11.065551,
-  -0.390093, 0.28589, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  // f 75/75/75 76/76/76 78/78/78
-  -0.390093, 0.28589, -11.065551,
-  -0.180793, 0.49519, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  // f 76/76/76 77/77/77 78/78/78
-  -0.180793, 0.49519, -11.065551,
-  0.105107, 0.57179, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  // f 1/1/1 16/16/16 15/15/15
-  0.105107, -0.946812, -6.69275,
-  0.105107, -0.933112, -6.68005,
-  -0.361493, -0.808112, -6.68005,
-  // f 15/15/15 2/2/2 1/1/1
-  -0.361493, -0.808112, -6.68005,
-  -0.368293, -0.819912, -6.69275,
-  0.105107, -0.946812, -6.69275,
-  // f 2/2/2 15/15/15 19/19/19
-  -0.368293, -0.819912, -6.69275,
-  -0.361493, -0.808112, -6.68005,
-  -0.702992, -0.466612, -6.68005,
-  // f 19/19/19 5/5/5 2/2/2
-  -0.702992, -0.466612, -6.68005,
-  -0.714792, -0.473412, -6.69275,
-  -0.368293, -0.819912, -6.69275,
-  // f 5/5/5 19/19/19 21/21/21
-  -0.714792, -0.473412, -6.69275,
-  -0.702992, -0.466612, -6.68005,
-  -0.827992, -1.2e-005, -6.68005,
-  // f 21/21/21 7/7/7 5/5/5
-  -0.827992, -1.2e-005, -6.68005,
-  -0.841693, -1.2e-005, -6.69275,
-  -0.714792, -0.473412, -6.69275,
-  // f 7/7/7 21/21/21 23/23/23
-  -0.841693, -1.2e-005, -6.69275,
-  -0.827992, -1.2e-005, -6.68005,
-  -0.702992, 0.466588, -6.68005,
-  // f 23/23/23 9/9/9 7/7/7
-  -0.702992, 0.466588, -6.68005,
-  -0.714792, 0.473388, -6.69275,
-  -0.841693, -1.2e-005, -6.69275,
-  // f 9/9/9 23/23/23 25/25/25
-  -0.714792, 0.473388, -6.69275,
-  -0.702992, 0.466588, -6.68005,
-  -0.361493, 0.808088, -6.68005,
-  // f 25/25/25 11/11/11 9/9/9
-  -0.361493, 0.808088, -6.68005,
-  -0.368293, 0.819888, -6.69275,
-  -0.714792, 0.473388, -6.69275,
-  // f 11/11/11 25/25/25 27/27/27
-  -0.368293, 0.819888, -6.69275,
-  -0.361493, 0.808088, -6.68005,
-  0.105107, 0.933088, -6.68005,
-  // f 27/27/27 13/13/13 11/11/11
-  0.105107, 0.933088, -6.68005,
-  0.105107, 0.946788, -6.69275,
-  -0.368293, 0.819888, -6.69275,
-  // f 1/1/1 4/4/4 79/79/79
-  0.105107, -0.946812, -6.69275,
-  0.105107, -0.979312, -6.76885,
-  0.594707, -0.848112, -6.76885,
-  // f 79/79/79 80/80/80 1/1/1
-  0.594707, -0.848112, -6.76885,
-  0.578507, -0.819912, -6.69275,
-  0.105107, -0.946812, -6.69275,
-  // f 80/80/80 79/79/79 81/81/81
-  0.578507, -0.819912, -6.69275,
-  0.594707, -0.848112, -6.76885,
-  0.953207, -0.489612, -6.76885,
-  // f 81/81/81 82/82/82 80/80/80
-  0.953207, -0.489612, -6.76885,
-  0.925007, -0.473412, -6.69275,
-  0.578507, -0.819912, -6.69275,
-  // f 82/82/82 81/81/81 83/83/83
-  0.925007, -0.473412, -6.69275,
-  0.953207, -0.489612, -6.76885,
-  1.084407, -1.2e-005, -6.76885,
-  // f 83/83/83 84/84/84 82/82/82
-  1.084407, -1.2e-005, -6.76885,
-  1.051908, -1.2e-005, -6.69275,
-  0.925007, -0.473412, -6.69275,
-  // f 84/84/84 83/83/83 85/85/85
-  1.051908, -1.2e-005, -6.69275,
-  1.084407, -1.2e-005, -6.76885,
-  0.953207, 0.489588, -6.76885,
-  // f 85/85/85 86/86/86 84/84/84
-  0.953207, 0.489588, -6.76885,
-  0.925007, 0.473388, -6.69275,
-  1.051908, -1.2e-005, -6.69275,
-  // f 86/86/86 85/85/85 87/87/87
-  0.925007, 0.473388, -6.69275,
-  0.953207, 0.489588, -6.76885,
-  0.594707, 0.848088, -6.76885,
-  // f 87/87/87 88/88/88 86/86/86
-  0.594707, 0.848088, -6.76885,
-  0.578507, 0.819888, -6.69275,
-  0.925007, 0.473388, -6.69275,
-  // f 88/88/88 87/87/87 14/14/14
-  0.578507, 0.819888, -6.69275,
-  0.594707, 0.848088, -6.76885,
-  0.105107, 0.979288, -6.76885,
-  // f 14/14/14 13/13/13 88/88/88
-  0.105107, 0.979288, -6.76885,
-  0.105107, 0.946788, -6.69275,
-  0.578507, 0.819888, -6.69275,
-  // f 89/89/89 90/90/90 17/17/17
-  0.571708, -0.808112, -6.68005,
-  0.509908, -0.701212, -6.63565,
-  0.105107, -0.809612, -6.63565,
-  // f 17/17/17 16/16/16 89/89/89
-  0.105107, -0.809612, -6.63565,
-  0.105107, -0.933112, -6.68005,
-  0.571708, -0.808112, -6.68005,
-  // f 91/91/91 92/92/92 90/90/90
-  0.913207, -0.466612, -6.68005,
-  0.806307, -0.404812, -6.63565,
-  0.509908, -0.701212, -6.63565,
-  // f 90/90/90 89/89/89 91/91/91
-  0.509908, -0.701212, -6.63565,
-  0.571708, -0.808112, -6.68005,
-  0.913207, -0.466612, -6.68005,
-  // f 93/93/93 94/94/94 92/92/92
-  1.038207, -1.2e-005, -6.68005,
-  0.914707, -1.2e-005, -6.63565,
-  0.806307, -0.404812, -6.63565,
-  // f 92/92/92 91/91/91 93/93/93
-  0.806307, -0.404812, -6.63565,
-  0.913207, -0.466612, -6.68005,
-  1.038207, -1.2e-005, -6.68005,
-  // f 95/95/95 96/96/96 94/94/94
-  0.913207, 0.466588, -6.68005,
-  0.806307, 0.404788, -6.63565,
-  0.914707, -1.2e-005, -6.63565,
-  // f 94/94/94 93/93/93 95/95/95
-  0.914707, -1.2e-005, -6.63565,
-  1.038207, -1.2e-005, -6.68005,
-  0.913207, 0.466588, -6.68005,
-  // f 97/97/97 98/98/98 96/96/96
-  0.571708, 0.808088, -6.68005,
-  0.509908, 0.701188, -6.63565,
-  0.806307, 0.404788, -6.63565,
-  // f 96/96/96 95/95/95 97/97/97
-  0.806307, 0.404788, -6.63565,
-  0.913207, 0.466588, -6.68005,
-  0.571708, 0.808088, -6.68005,
-  // f 27/27/27 28/28/28 98/98/98
-  0.105107, 0.933088, -6.68005,
-  0.105107, 0.809588, -6.63565,
-  0.509908, 0.701188, -6.63565,
-  // f 98/98/98 97/97/97 27/27/27
-  0.509908, 0.701188, -6.63565,
-  0.571708, 0.808088, -6.68005,
-  0.105107, 0.933088, -6.68005,
-  // f 4/4/4 30/30/30 99/99/99
-  0.105107, -0.979312, -6.76885,
-  0.105107, -1.275012, -6.92675,
-  0.742607, -1.104212, -6.92675,
-  // f 99/99/99 79/79/79 4/4/4
-  0.742607, -1.104212, -6.92675,
-  0.594707, -0.848112, -6.76885,
-  0.105107, -0.979312, -6.76885,
-  // f 79/79/79 99/99/99 100/100/100
-  0.594707, -0.848112, -6.76885,
-  0.742607, -1.104212, -6.92675,
-  1.209308, -0.637512, -6.92675,
-  // f 100/100/100 81/81/81 79/79/79
-  1.209308, -0.637512, -6.92675,
-  0.953207, -0.489612, -6.76885,
-  0.594707, -0.848112, -6.76885,
-  // f 81/81/81 100/100/100 101/101/101
-  0.953207, -0.489612, -6.76885,
-  1.209308, -0.637512, -6.92675,
-  1.380107, -1.2e-005, -6.92675,
-  // f 101/101/101 83/83/83 81/81/81
-  1.380107, -1.2e-005, -6.92675,
-  1.084407, -1.2e-005, -6.76885,
-  0.953207, -0.489612, -6.76885,
-  // f 83/83/83 101/101/101 102/102/102
-  1.084407, -1.2e-005, -6.76885,
-  1.380107, -1.2e-005, -6.92675,
-  1.209308, 0.637488, -6.92675,
-  // f 102/102/102 85/85/85 83/83/83
-  1.209308, 0.637488, -6.92675,
-  0.953207, 0.489588, -6.76885,
-  1.084407, -1.2e-005, -6.76885,
-  // f 85/85/85 102/102/102 103/103/103
-  0.953207, 0.489588, -6.76885,
-  1.209308, 0.637488, -6.92675,
-  0.742607, 1.104188, -6.92675,
-  // f 103/103/103 87/87/87 85/85/85
-  0.742607, 1.104188, -6.92675,
-  0.594707, 0.848088, -6.76885,
-  0.953207, 0.489588, -6.76885,
-  // f 87/87/87 103/103/103 35/35/35
-  0.594707, 0.848088, -6.76885,
-  0.742607, 1.104188, -6.92675,
-  0.105107, 1.274988, -6.92675,
-  // f 35/35/35 14/14/14 87/87/87
-  0.105107, 1.274988, -6.92675,
-  0.105107, 0.979288, -6.76885,
-  0.594707, 0.848088, -6.76885,
-  // f 30/30/30 37/37/37 104/104/104
-  0.105107, -1.275012, -6.92675,
-  0.105107, -1.935512, -7.539251,
-  1.072907, -1.676212, -7.539251,
-  // f 104/104/104 99/99/99 30/30/30
-  1.072907, -1.676212, -7.539251,
-  0.742607, -1.104212, -6.92675,
-  0.105107, -1.275012, -6.92675,
-  // f 99/99/99 104/104/104 105/105/105
-  0.742607, -1.104212, -6.92675,
-  1.072907, -1.676212, -7.539251,
-  1.781307, -0.967812, -7.53925,
-  // f 105/105/105 100/100/100 99/99/99
-  1.781307, -0.967812, -7.53925,
-  1.209308, -0.637512, -6.92675,
-  0.742607, -1.104212, -6.92675,
-  // f 100/100/100 105/105/105 106/106/106
-  1.209308, -0.637512, -6.92675,
-  1.781307, -0.967812, -7.53925,
-  2.040607, -1.2e-005, -7.53925,
-  // f 106/106/106 101/101/101 100/100/100
-  2.040607, -1.2e-005, -7.53925,
-  1.380107, -1.2e-005, -6.92675,
-  1.209308, -0.637512, -6.92675,
-  // f 101/101/101 106/106/106 107/107/107
-  1.380107, -1.2e-005, -6.92675,
-  2.040607, -1.2e-005, -7.53925,
-  1.781307, 0.967788, -7.53925,
-  // f 107/107/107 102/102/102 101/101/101
-  1.781307, 0.967788, -7.53925,
-  1.209308, 0.637488, -6.92675,
-  1.380107, -1.2e-005, -6.92675,
-  // f 102/102/102 107/107/107 108/108/108
-  1.209308, 0.637488, -6.92675,
-  1.781307, 0.967788, -7.53925,
-  1.072907, 1.676188, -7.539249,
-  // f 108/108/108 103/103/103 102/102/102
-  1.072907, 1.676188, -7.539249,
-  0.742607, 1.104188, -6.92675,
-  1.209308, 0.637488, -6.92675,
-  // f 103/103/103 108/108/108 42/42/42
-  0.742607, 1.104188, -6.92675,
-  1.072907, 1.676188, -7.539249,
-  0.105107, 1.935488, -7.539249,
-  // f 42/42/42 35/35/35 103/103/103
-  0.105107, 1.935488, -7.539249,
-  0.105107, 1.274988, -6.92675,
-  0.742607, 1.104188, -6.92675,
-  // f 37/37/37 44/44/44 109/109/109
-  0.105107, -1.935512, -7.539251,
-  0.105107, -2.32881, -8.416551,
-  1.269507, -2.016811, -8.416551,
-  // f 109/109/109 104/104/104 37/37/37
-  1.269507, -2.016811, -8.416551,
-  1.072907, -1.676212, -7.539251,
-  0.105107, -1.935512, -7.539251,
-  // f 104/104/104 109/109/109 110/110/110
-  1.072907, -1.676212, -7.539251,
-  1.269507, -2.016811, -8.416551,
-  2.121907, -1.164411, -8.416551,
-  // f 110/110/110 105/105/105 104/104/104
-  2.121907, -1.164411, -8.416551,
-  1.781307, -0.967812, -7.53925,
-  1.072907, -1.676212, -7.539251,
-  // f 105/105/105 110/110/110 111/111/111
-  1.781307, -0.967812, -7.53925,
-  2.121907, -1.164411, -8.416551,
-  2.433908, -1.2e-005, -8.416551,
-  // f 111/111/111 106/106/106 105/105/105
-  2.433908, -1.2e-005, -8.416551,
-  2.040607, -1.2e-005, -7.53925,
-  1.781307, -0.967812, -7.53925,
-  // f 106/106/106 111/111/111 112/112/112
-  2.040607, -1.2e-005, -7.53925,
-  2.433908, -1.2e-005, -8.416551,
-  2.121907, 1.164388, -8.416551,
-  // f 112/112/112 107/107/107 106/106/106
-  2.121907, 1.164388, -8.416551,
-  1.781307, 0.967788, -7.53925,
-  2.040607, -1.2e-005, -7.53925,
-  // f 107/107/107 112/112/112 113/113/113
-  1.781307, 0.967788, -7.53925,
-  2.121907, 1.164388, -8.416551,
-  1.269507, 2.016789, -8.416551,
-  // f 113/113/113 108/108/108 107/107/107
-  1.269507, 2.016789, -8.416551,
-  1.072907, 1.676188, -7.539249,
-  1.781307, 0.967788, -7.53925,
-  // f 108/108/108 113/113/113 49/49/49
-  1.072907, 1.676188, -7.539249,
-  1.269507, 2.016789, -8.416551,
-  0.105107, 2.328789, -8.416551,
-  // f 49/49/49 42/42/42 108/108/108
-  0.105107, 2.328789, -8.416551,
-  0.105107, 1.935488, -7.539249,
-  1.072907, 1.676188, -7.539249,
-  // f 44/44/44 51/114/51 114/115/114
-  0.105107, -2.32881, -8.416551,
-  0.105107, -2.32881, -9.36445,
-  1.269507, -2.016811, -9.36445,
-  // f 114/115/114 109/109/109 44/44/44
-  1.269507, -2.016811, -9.36445,
-  1.269507, -2.016811, -8.416551,
-  0.105107, -2.32881, -8.416551,
-  // f 109/109/109 114/115/114 115/116/115
-  1.269507, -2.016811, -8.416551,
-  1.269507, -2.016811, -9.36445,
-  2.121907, -1.16441, -9.36445,
-  // f 115/116/115 110/110/110 109/109/109
-  2.121907, -1.16441, -9.36445,
-  2.121907, -1.164411, -8.416551,
-  1.269507, -2.016811, -8.416551,
-  // f 110/110/110 115/116/115 116/117/116
-  2.121907, -1.164411, -8.416551,
-  2.121907, -1.16441, -9.36445,
-  2.433908, -1e-005, -9.36445,
-  // f 116/117/116 111/111/111 110/110/110
-  2.433908, -1e-005, -9.36445,
-  2.433908, -1.2e-005, -8.416551,
-  2.121907, -1.164411, -8.416551,
-  // f 111/111/111 116/117/116 117/118/117
-  2.433908, -1.2e-005, -8.416551,
-  2.433908, -1e-005, -9.36445,
-  2.121907, 1.164389, -9.36445,
-  // f 117/118/117 112/112/112 111/111/111
-  2.121907, 1.164389, -9.36445,
-  2.121907, 1.164388, -8.416551,
-  2.433908, -1.2e-005, -8.416551,
-  // f 112/112/112 117/118/117 118/119/118
-  2.121907, 1.164388, -8.416551,
-  2.121907, 1.164389, -9.36445,
-  1.269507, 2.016789, -9.36445,
-  // f 118/119/118 113/113/113 112/112/112
-  1.269507, 2.016789, -9.36445,
-  1.269507, 2.016789, -8.416551,
-  2.121907, 1.164388, -8.416551,
-  // f 113/113/113 118/119/118 56/120/56
-  1.269507, 2.016789, -8.416551,
-  1.269507, 2.016789, -9.36445,
-  0.105107, 2.328789, -9.36445,
-  // f 56/120/56 49/49/49 113/113/113
-  0.105107, 2.328789, -9.36445,
-  0.105107, 2.328789, -8.416551,
-  1.269507, 2.016789, -8.416551,
-  // f 51/114/51 58/121/58 119/122/119
-  0.105107, -2.32881, -9.36445,
-  0.105107, -1.97011, -10.14235,
-  1.090107, -1.70621, -10.14235,
-  // f 119/122/119 114/115/114 51/114/51
-  1.090107, -1.70621, -10.14235,
-  1.269507, -2.016811, -9.36445,
-  0.105107, -2.32881, -9.36445,
-  // f 114/115/114 119/122/119 120/123/120
-  1.269507, -2.016811, -9.36445,
-  1.090107, -1.70621, -10.14235,
-  1.811307, -0.98501, -10.14235,
-  // f 120/123/120 115/116/115 114/115/114
-  1.811307, -0.98501, -10.14235,
-  2.121907, -1.16441, -9.36445,
-  1.269507, -2.016811, -9.36445,
-  // f 115/116/115 120/123/120 121/124/121
-  2.121907, -1.16441, -9.36445,
-  1.811307, -0.98501, -10.14235,
-  2.075208, -1e-005, -10.14235,
-  // f 121/124/121 116/117/116 115/116/115
-  2.075208, -1e-005, -10.14235,
-  2.433908, -1e-005, -9.36445,
-  2.121907, -1.16441, -9.36445,
-  // f 116/117/116 121/124/121 122/125/122
-  2.433908, -1e-005, -9.36445,
-  2.075208, -1e-005, -10.14235,
-  1.811307, 0.98499, -10.14235,
-  // f 122/125/122 117/118/117 116/117/116
-  1.811307, 0.98499, -10.14235,
-  2.121907, 1.164389, -9.36445,
-  2.433908, -1e-005, -9.36445,
-  // f 117/118/117 122/125/122 123/126/123
-  2.121907, 1.164389, -9.36445,
-  1.811307, 0.98499, -10.14235,
-  1.090107, 1.70619, -10.14235,
-  // f 123/126/123 118/119/118 117/118/117
-  1.090107, 1.70619, -10.14235,
-  1.269507, 2.016789, -9.36445,
-  2.121907, 1.164389, -9.36445,
-  // f 118/119/118 123/126/123 63/127/63
-  1.269507, 2.016789, -9.36445,
-  1.090107, 1.70619, -10.14235,
-  0.105107, 1.97009, -10.14235,
-  // f 63/127/63 56/120/56 118/119/118
-  0.105107, 1.97009, -10.14235,
-  0.105107, 2.328789, -9.36445,
-  1.269507, 2.016789, -9.36445,
-  // f 58/121/58 65/128/65 124/129/124
-  0.105107, -1.97011, -10.14235,
-  0.105107, -1.34721, -10.76235,
-  0.778708, -1.16671, -10.76235,
-  // f 124/129/124 119/122/119 58/121/58
-  0.778708, -1.16671, -10.76235,
-  1.090107, -1.70621, -10.14235,
-  0.105107, -1.97011, -10.14235,
-  // f 119/122/119 124/129/124 125/130/125
-  1.090107, -1.70621, -10.14235,
-  0.778708, -1.16671, -10.76235,
-  1.271808, -0.67361, -10.76235,
-  // f 125/130/125 120/123/120 119/122/119
-  1.271808, -0.67361, -10.76235,
-  1.811307, -0.98501, -10.14235,
-  1.090107, -1.70621, -10.14235,
-  // f 120/123/120 125/130/125 126/131/126
-  1.811307, -0.98501, -10.14235,
-  1.271808, -0.67361, -10.76235,
-  1.452308, -1e-005, -10.76235,
-  // f 126/131/126 121/124/121 120/123/120
-  1.452308, -1e-005, -10.76235,
-  2.075208, -1e-005, -10.14235,
-  1.811307, -0.98501, -10.14235,
-  // f 121/124/121 126/131/126 127/132/127
-  2.075208, -1e-005, -10.14235,
-  1.452308, -1e-005, -10.76235,
-  1.271808, 0.67359, -10.76235,
-  // f 127/132/127 122/125/122 121/124/121
-  1.271808, 0.67359, -10.76235,
-  1.811307, 0.98499, -10.14235,
-  2.075208, -1e-005, -10.14235,
-  // f 122/125/122 127/132/127 128/133/128
-  1.811307, 0.98499, -10.14235,
-  1.271808, 0.67359, -10.76235,
-  0.778708, 1.16669, -10.76235,
-  // f 128/133/128 123/126/123 122/125/122
-  0.778708, 1.16669, -10.76235,
-  1.090107, 1.70619, -10.14235,
-  1.811307, 0.98499, -10.14235,
-  // f 123/126/123 128/133/128 70/134/70
-  1.090107, 1.70619, -10.14235,
-  0.778708, 1.16669, -10.76235,
-  0.105107, 1.34719, -10.76235,
-  // f 70/134/70 63/127/63 123/126/123
-  0.105107, 1.34719, -10.76235,
-  0.105107, 1.97009, -10.14235,
-  1.090107, 1.70619, -10.14235,
-  // f 65/128/65 72/135/72 129/136/129
-  0.105107, -1.34721, -10.76235,
-  0.105107, -0.57181, -11.065551,
-  0.391007, -0.49521, -11.065551,
-  // f 129/136/129 124/129/124 65/128/65
-  0.391007, -0.49521, -11.065551,
-  0.778708, -1.16671, -10.76235,
-  0.105107, -1.34721, -10.76235,
-  // f 124/129/124 129/136/129 130/137/130
-  0.778708, -1.16671, -10.76235,
-  0.391007, -0.49521, -11.065551,
-  0.600307, -0.28591, -11.065551,
-  // f 130/137/130 125/130/125 124/129/124
-  0.600307, -0.28591, -11.065551,
-  1.271808, -0.67361, -10.76235,
-  0.778708, -1.16671, -10.76235,
-  // f 125/130/125 130/137/130 131/138/131
-  1.271808, -0.67361, -10.76235,
-  0.600307, -0.28591, -11.065551,
-  0.676908, -1e-005, -11.065551,
-  // f 131/138/131 126/131/126 125/130/125
-  0.676908, -1e-005, -11.065551,
-  1.452308, -1e-005, -10.76235,
-  1.271808, -0.67361, -10.76235,
-  // f 126/131/126 131/138/131 132/139/132
-  1.452308, -1e-005, -10.76235,
-  0.676908, -1e-005, -11.065551,
-  0.600307, 0.28589, -11.065551,
-  // f 132/139/132 127/132/127 126/131/126
-  0.600307, 0.28589, -11.065551,
-  1.271808, 0.67359, -10.76235,
-  1.452308, -1e-005, -10.76235,
-  // f 127/132/127 132/139/132 133/140/133
-  1.271808, 0.67359, -10.76235,
-  0.600307, 0.28589, -11.065551,
-  0.391007, 0.49519, -11.065551,
-  // f 133/140/133 128/133/128 127/132/127
-  0.391007, 0.49519, -11.065551,
-  0.778708, 1.16669, -10.76235,
-  1.271808, 0.67359, -10.76235,
-  // f 128/133/128 133/140/133 77/141/77
-  0.778708, 1.16669, -10.76235,
-  0.391007, 0.49519, -11.065551,
-  0.105107, 0.57179, -11.065551,
-  // f 77/141/77 70/134/70 128/133/128
-  0.105107, 0.57179, -11.065551,
-  0.105107, 1.34719, -10.76235,
-  0.778708, 1.16669, -10.76235,
-  // f 72/135/72 78/142/78 129/136/129
-  0.105107, -0.57181, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  0.391007, -0.49521, -11.065551,
-  // f 129/136/129 78/142/78 130/137/130
-  0.391007, -0.49521, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  0.600307, -0.28591, -11.065551,
-  // f 130/137/130 78/142/78 131/138/131
-  0.600307, -0.28591, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  0.676908, -1e-005, -11.065551,
-  // f 131/138/131 78/142/78 132/139/132
-  0.676908, -1e-005, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  0.600307, 0.28589, -11.065551,
-  // f 132/139/132 78/142/78 133/140/133
-  0.600307, 0.28589, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  0.391007, 0.49519, -11.065551,
-  // f 133/140/133 78/142/78 77/141/77
-  0.391007, 0.49519, -11.065551,
-  0.105107, -1e-005, -11.15225,
-  0.105107, 0.57179, -11.065551,
-  // f 1/1/1 80/80/80 89/89/89
-  0.105107, -0.946812, -6.69275,
-  0.578507, -0.819912, -6.69275,
-  0.571708, -0.808112, -6.68005,
-  // f 89/89/89 16/16/16 1/1/1
-  0.571708, -0.808112, -6.68005,
-  0.105107, -0.933112, -6.68005,
-  0.105107, -0.946812, -6.69275,
-  // f 80/80/80 82/82/82 91/91/91
-  0.578507, -0.819912, -6.69275,
-  0.925007, -0.473412, -6.69275,
-  0.913207, -0.466612, -6.68005,
-  // f 91/91/91 89/89/89 80/80/80
-  0.913207, -0.466612, -6.68005,
-  0.571708, -0.808112, -6.68005,
-  0.578507, -0.819912, -6.69275,
-  // f 82/82/82 84/84/84 93/93/93
-  0.925007, -0.473412, -6.69275,
-  1.051908, -1.2e-005, -6.69275,
-  1.038207, -1.2e-005, -6.68005,
-  // f 93/93/93 91/91/91 82/82/82
-  1.038207, -1.2e-005, -6.68005,
-  0.913207, -0.466612, -6.68005,
-  0.925007, -0.473412, -6.69275,
-  // f 84/84/84 86/86/86 95/95/95
-  1.051908, -1.2e-005, -6.69275,
-  0.925007, 0.473388, -6.69275,
-  0.913207, 0.466588, -6.68005,
-  // f 95/95/95 93/93/93 84/84/84
-  0.913207, 0.466588, -6.68005,
-  1.038207, -1.2e-005, -6.68005,
-  1.051908, -1.2e-005, -6.69275,
-  // f 86/86/86 88/88/88 97/97/97
-  0.925007, 0.473388, -6.69275,
-  0.578507, 0.819888, -6.69275,
-  0.571708, 0.808088, -6.68005,
-  // f 97/97/97 95/95/95 86/86/86
-  0.571708, 0.808088, -6.68005,
-  0.913207, 0.466588, -6.68005,
-  0.925007, 0.473388, -6.69275,
-  // f 88/88/88 13/13/13 27/27/27
-  0.578507, 0.819888, -6.69275,
-  0.105107, 0.946788, -6.69275,
-  0.105107, 0.933088, -6.68005,
-  // f 27/27/27 97/97/97 88/88/88
-  0.105107, 0.933088, -6.68005,
-  0.571708, 0.808088, -6.68005,
-  0.578507, 0.819888, -6.69275,
-  // f 141/143/134 142/144/135 143/145/136
-  0.105107, -0.983712, -6.593451,
-  -0.386693, -0.851912, -6.59265,
-  -0.368692, -0.820612, -6.66025,
-  // f 143/145/136 144/146/137 141/143/134
-  -0.368692, -0.820612, -6.66025,
-  0.105107, -0.947612, -6.66105,
-  0.105107, -0.983712, -6.593451,
-  // f 142/144/135 145/147/138 146/148/139
-  -0.386693, -0.851912, -6.59265,
-  -0.746793, -0.491812, -6.59265,
-  -0.715492, -0.473812, -6.66025,
-  // f 146/148/139 143/145/136 142/144/135
-  -0.715492, -0.473812, -6.66025,
-  -0.368692, -0.820612, -6.66025,
-  -0.386693, -0.851912, -6.59265,
-  // f 145/147/138 147/149/140 148/150/141
-  -0.746793, -0.491812, -6.59265,
-  -0.878592, -1.2e-005, -6.59265,
-  -0.842493, -1.2e-005, -6.66025,
-  // f 148/150/141 146/148/139 145/147/138
-  -0.842493, -1.2e-005, -6.66025,
-  -0.715492, -0.473812, -6.66025,
-  -0.746793, -0.491812, -6.59265,
-  // f 147/149/140 149/151/142 150/152/143
-  -0.878592, -1.2e-005, -6.59265,
-  -0.746793, 0.491788, -6.59265,
-  -0.715492, 0.473788, -6.66025,
-  // f 150/152/143 148/150/141 147/149/140
-  -0.715492, 0.473788, -6.66025,
-  -0.842493, -1.2e-005, -6.66025,
-  -0.878592, -1.2e-005, -6.59265,
-  // f 149/151/142 151/153/144 152/154/145
-  -0.746793, 0.491788, -6.59265,
-  -0.386693, 0.851888, -6.59265,
-  -0.368692, 0.820588, -6.66025,
-  // f 152/154/145 150/152/143 149/151/142
-  -0.368692, 0.820588, -6.66025,
-  -0.715492, 0.473788, -6.66025,
-  -0.746793, 0.491788, -6.59265,
-  // f 151/153/144 153/155/146 154/156/147
-  -0.386693, 0.851888, -6.59265,
-  0.105107, 0.983688, -6.593451,
-  0.105107, 0.947588, -6.66105,
-  // f 154/156/147 152/154/145 151/153/144
-  0.105107, 0.947588, -6.66105,
-  -0.368692, 0.820588, -6.66025,
-  -0.386693, 0.851888, -6.59265,
-  // f 155/157/148 156/158/149 157/159/150
-  0.105107, -0.932512, -6.66995,
-  -0.361093, -0.807512, -6.66915,
-  -0.299892, -0.701212, -6.66995,
-  // f 157/159/150 158/160/78 155/157/148
-  -0.299892, -0.701212, -6.66995,
-  0.105107, -0.809612, -6.66995,
-  0.105107, -0.932512, -6.66995,
-  // f 156/158/149 159/161/151 160/162/152
-  -0.361093, -0.807512, -6.66915,
-  -0.702393, -0.466212, -6.66915,
-  -0.596292, -0.404812, -6.66995,
-  // f 160/162/152 157/159/150 156/158/149
-  -0.596292, -0.404812, -6.66995,
-  -0.299892, -0.701212, -6.66995,
-  -0.361093, -0.807512, -6.66915,
-  // f 159/161/151 161/163/153 162/164/154
-  -0.702393, -0.466212, -6.66915,
-  -0.827393, -1.2e-005, -6.66915,
-  -0.704793, -1.2e-005, -6.66995,
-  // f 162/164/154 160/162/152 159/161/151
-  -0.704793, -1.2e-005, -6.66995,
-  -0.596292, -0.404812, -6.66995,
-  -0.702393, -0.466212, -6.66915,
-  // f 161/163/153 163/165/155 164/166/156
-  -0.827393, -1.2e-005, -6.66915,
-  -0.702393, 0.466188, -6.66915,
-  -0.596292, 0.404788, -6.66995,
-  // f 164/166/156 162/164/154 161/163/153
-  -0.596292, 0.404788, -6.66995,
-  -0.704793, -1.2e-005, -6.66995,
-  -0.827393, -1.2e-005, -6.66915,
-  // f 163/165/155 165/167/157 166/168/158
-  -0.702393, 0.466188, -6.66915,
-  -0.361093, 0.807488, -6.66915,
-  -0.299892, 0.701188, -6.66995,
-  // f 166/168/158 164/166/156 163/165/155
-  -0.299892, 0.701188, -6.66995,
-  -0.596292, 0.404788, -6.66995,
-  -0.702393, 0.466188, -6.66915,
-  // f 165/167/157 167/169/159 168/170/160
-  -0.361093, 0.807488, -6.66915,
-  0.105107, 0.932488, -6.66995,
-  0.105107, 0.809588, -6.66995,
-  // f 168/170/160 166/168/158 165/167/157
-  0.105107, 0.809588, -6.66995,
-  -0.299892, 0.701188, -6.66995,
-  -0.361093, 0.807488, -6.66915,
-  // f 134/171/161 142/144/135 141/143/134
-  -0.394193, -0.864812, -6.58215,
-  -0.386693, -0.851912, -6.59265,
-  0.105107, -0.983712, -6.593451,
-  // f 141/143/134 135/172/162 134/171/161
-  0.105107, -0.983712, -6.593451,
-  0.105107, -0.998612, -6.58305,
-  -0.394193, -0.864812, -6.58215,
-  // f 136/173/163 145/147/138 142/144/135
-  -0.759693, -0.499312, -6.58215,
-  -0.746793, -0.491812, -6.59265,
-  -0.386693, -0.851912, -6.59265,
-  // f 142/144/135 134/171/161 136/173/163
-  -0.386693, -0.851912, -6.59265,
-  -0.394193, -0.864812, -6.58215,
-  -0.759693, -0.499312, -6.58215,
-  // f 137/174/164 147/149/140 145/147/138
-  -0.893493, -1.2e-005, -6.58215,
-  -0.878592, -1.2e-005, -6.59265,
-  -0.746793, -0.491812, -6.59265,
-  // f 145/147/138 136/173/163 137/174/164
-  -0.746793, -0.491812, -6.59265,
-  -0.759693, -0.499312, -6.58215,
-  -0.893493, -1.2e-005, -6.58215,
-  // f 138/175/165 149/151/142 147/149/140
-  -0.759693, 0.499288, -6.58215,
-  -0.746793, 0.491788, -6.59265,
-  -0.878592, -1.2e-005, -6.59265,
-  // f 147/149/140 137/174/164 138/175/165
-  -0.878592, -1.2e-005, -6.59265,
-  -0.893493, -1.2e-005, -6.58215,
-  -0.759693, 0.499288, -6.58215,
-  // f 139/176/166 151/153/144 149/151/142
-  -0.394193, 0.864788, -6.58215,
-  -0.386693, 0.851888, -6.59265,
-  -0.746793, 0.491788, -6.59265,
-  // f 149/151/142 138/175/165 139/176/166
-  -0.746793, 0.491788, -6.59265,
-  -0.759693, 0.499288, -6.58215,
-  -0.394193, 0.864788, -6.58215,
-  // f 140/177/167 153/155/146 151/153/144
-  0.105107, 0.998588, -6.58305,
-  0.105107, 0.983688, -6.593451,
-  -0.386693, 0.851888, -6.59265,
-  // f 151/153/144 139/176/166 140/177/167
-  -0.386693, 0.851888, -6.59265,
-  -0.394193, 0.864788, -6.58215,
-  0.105107, 0.998588, -6.58305,
-  // f 143/145/136 156/158/149 155/157/148
-  -0.368692, -0.820612, -6.66025,
-  -0.361093, -0.807512, -6.66915,
-  0.105107, -0.932512, -6.66995,
-  // f 155/157/148 144/146/137 143/145/136
-  0.105107, -0.932512, -6.66995,
-  0.105107, -0.947612, -6.66105,
-  -0.368692, -0.820612, -6.66025,
-  // f 146/148/139 159/161/151 156/158/149
-  -0.715492, -0.473812, -6.66025,
-  -0.702393, -0.466212, -6.66915,
-  -0.361093, -0.807512, -6.66915,
-  // f 156/158/149 143/145/136 146/148/139
-  -0.361093, -0.807512, -6.66915,
-  -0.368692, -0.820612, -6.66025,
-  -0.715492, -0.473812, -6.66025,
-  // f 148/150/141 161/163/153 159/161/151
-  -0.842493, -1.2e-005, -6.66025,
-  -0.827393, -1.2e-005, -6.66915,
-  -0.702393, -0.466212, -6.66915,
-  // f 159/161/151 146/148/139 148/150/141
-  -0.702393, -0.466212, -6.66915,
-  -0.715492, -0.473812, -6.66025,
-  -0.842493, -1.2e-005, -6.66025,
-  // f 150/152/143 163/165/155 161/163/153
-  -0.715492, 0.473788, -6.66025,
-  -0.702393, 0.466188, -6.66915,
-  -0.827393, -1.2e-005, -6.66915,
-  // f 161/163/153 148/150/141 150/152/143
-  -0.827393, -1.2e-005, -6.66915,
-  -0.842493, -1.2e-005, -6.66025,
-  -0.715492, 0.473788, -6.66025,
-  // f 152/154/145 165/167/157 163/165/155
-  -0.368692, 0.820588, -6.66025,
-  -0.361093, 0.807488, -6.66915,
-  -0.702393, 0.466188, -6.66915,
-  // f 163/165/155 150/152/143 152/154/145
-  -0.702393, 0.466188, -6.66915,
-  -0.715492, 0.473788, -6.66025,
-  -0.368692, 0.820588, -6.66025,
-  // f 154/156/147 167/169/159 165/167/157
-  0.105107, 0.947588, -6.66105,
-  0.105107, 0.932488, -6.66995,
-  -0.361093, 0.807488, -6.66915,
-  // f 165/167/157 152/154/145 154/156/147
-  -0.361093, 0.807488, -6.66915,
-  -0.368692, 0.820588, -6.66025,
-  0.105107, 0.947588, -6.66105,
-  // f 141/143/134 144/146/137 174/178/168
-  0.105107, -0.983712, -6.593451,
-  0.105107, -0.947612, -6.66105,
-  0.578907, -0.820612, -6.66025,
-  // f 174/178/168 175/179/169 141/143/134
-  0.578907, -0.820612, -6.66025,
-  0.596908, -0.851912, -6.59265,
-  0.105107, -0.983712, -6.593451,
-  // f 175/179/169 174/178/168 176/180/170
-  0.596908, -0.851912, -6.59265,
-  0.578907, -0.820612, -6.66025,
-  0.925707, -0.473812, -6.66025,
-  // f 176/180/170 177/181/171 175/179/169
-  0.925707, -0.473812, -6.66025,
-  0.957007, -0.491812, -6.59265,
-  0.596908, -0.851912, -6.59265,
-  // f 177/181/171 176/180/170 178/182/172
-  0.957007, -0.491812, -6.59265,
-  0.925707, -0.473812, -6.66025,
-  1.052708, -1.2e-005, -6.66025,
-  // f 178/182/172 179/183/173 177/181/171
-  1.052708, -1.2e-005, -6.66025,
-  1.088807, -1.2e-005, -6.59265,
-  0.957007, -0.491812, -6.59265,
-  // f 179/183/173 178/182/172 180/184/174
-  1.088807, -1.2e-005, -6.59265,
-  1.052708, -1.2e-005, -6.66025,
-  0.925707, 0.473788, -6.66025,
-  // f 180/184/174 181/185/175 179/183/173
-  0.925707, 0.473788, -6.66025,
-  0.957007, 0.491788, -6.59265,
-  1.088807, -1.2e-005, -6.59265,
-  // f 181/185/175 180/184/174 182/186/176
-  0.957007, 0.491788, -6.59265,
-  0.925707, 0.473788, -6.66025,
-  0.578907, 0.820588, -6.66025,
-  // f 182/186/176 183/187/177 181/185/175
-  0.578907, 0.820588, -6.66025,
-  0.596908, 0.851888, -6.59265,
-  0.957007, 0.491788, -6.59265,
-  // f 183/187/177 182/186/176 154/156/147
-  0.596908, 0.851888, -6.59265,
-  0.578907, 0.820588, -6.66025,
-  0.105107, 0.947588, -6.66105,
-  // f 154/156/147 153/155/146 183/187/177
-  0.105107, 0.947588, -6.66105,
-  0.105107, 0.983688, -6.593451,
-  0.596908, 0.851888, -6.59265,
-  // f 155/157/148 158/160/78 184/188/178
-  0.105107, -0.932512, -6.66995,
-  0.105107, -0.809612, -6.66995,
-  0.510107, -0.701212, -6.66995,
-  // f 184/188/178 185/189/179 155/157/148
-  0.510107, -0.701212, -6.66995,
-  0.571307, -0.807512, -6.66915,
-  0.105107, -0.932512, -6.66995,
-  // f 185/189/179 184/188/178 186/190/180
-  0.571307, -0.807512, -6.66915,
-  0.510107, -0.701212, -6.66995,
-  0.806507, -0.404812, -6.66995,
-  // f 186/190/180 187/191/181 185/189/179
-  0.806507, -0.404812, -6.66995,
-  0.912607, -0.466212, -6.66915,
-  0.571307, -0.807512, -6.66915,
-  // f 187/191/181 186/190/180 188/192/182
-  0.912607, -0.466212, -6.66915,
-  0.806507, -0.404812, -6.66995,
-  0.915008, -1.2e-005, -6.66995,
-  // f 188/192/182 189/193/183 187/191/181
-  0.915008, -1.2e-005, -6.66995,
-  1.037607, -1.2e-005, -6.66915,
-  0.912607, -0.466212, -6.66915,
-  // f 189/193/183 188/192/182 190/194/184
-  1.037607, -1.2e-005, -6.66915,
-  0.915008, -1.2e-005, -6.66995,
-  0.806507, 0.404788, -6.66995,
-  // f 190/194/184 191/195/185 189/193/183
-  0.806507, 0.404788, -6.66995,
-  0.912607, 0.466188, -6.66915,
-  1.037607, -1.2e-005, -6.66915,
-  // f 191/195/185 190/194/184 192/196/186
-  0.912607, 0.466188, -6.66915,
-  0.806507, 0.404788, -6.66995,
-  0.510107, 0.701188, -6.66995,
-  // f 192/196/186 193/197/187 191/195/185
-  0.510107, 0.701188, -6.66995,
-  0.571307, 0.807488, -6.66915,
-  0.912607, 0.466188, -6.66915,
-  // f 193/197/187 192/196/186 168/170/160
-  0.571307, 0.807488, -6.66915,
-  0.510107, 0.701188, -6.66995,
-  0.105107, 0.809588, -6.66995,
-  // f 168/170/160 167/169/159 193/197/187
-  0.105107, 0.809588, -6.66995,
-  0.105107, 0.932488, -6.66995,
-  0.571307, 0.807488, -6.66915,
-  // f 169/198/188 135/172/162 141/143/134
-  0.604407, -0.864812, -6.58215,
-  0.105107, -0.998612, -6.58305,
-  0.105107, -0.983712, -6.593451,
-  // f 141/143/134 175/179/169 169/198/188
-  0.105107, -0.983712, -6.593451,
-  0.596908, -0.851912, -6.59265,
-  0.604407, -0.864812, -6.58215,
-  // f 170/199/189 169/198/188 175/179/169
-  0.969908, -0.499312, -6.58215,
-  0.604407, -0.864812, -6.58215,
-  0.596908, -0.851912, -6.59265,
-  // f 175/179/169 177/181/171 170/199/189
-  0.596908, -0.851912, -6.59265,
-  0.957007, -0.491812, -6.59265,
-  0.969908, -0.499312, -6.58215,
-  // f 171/200/190 170/199/189 177/181/171
-  1.103707, -1.2e-005, -6.58215,
-  0.969908, -0.499312, -6.58215,
-  0.957007, -0.491812, -6.59265,
-  // f 177/181/171 179/183/173 171/200/190
-  0.957007, -0.491812, -6.59265,
-  1.088807, -1.2e-005, -6.59265,
-  1.103707, -1.2e-005, -6.58215,
-  // f 172/201/191 171/200/190 179/183/173
-  0.969908, 0.499288, -6.58215,
-  1.103707, -1.2e-005, -6.58215,
-  1.088807, -1.2e-005, -6.59265,
-  // f 179/183/173 181/185/175 172/201/191
-  1.088807, -1.2e-005, -6.59265,
-  0.957007, 0.491788, -6.59265,
-  0.969908, 0.499288, -6.58215,
-  // f 173/202/192 172/201/191 181/185/175
-  0.604407, 0.864788, -6.58215,
-  0.969908, 0.499288, -6.58215,
-  0.957007, 0.491788, -6.59265,
-  // f 181/185/175 183/187/177 173/202/192
-  0.957007, 0.491788, -6.59265,
-  0.596908, 0.851888, -6.59265,
-  0.604407, 0.864788, -6.58215,
-  // f 140/177/167 173/202/192 183/187/177
-  0.105107, 0.998588, -6.58305,
-  0.604407, 0.864788, -6.58215,
-  0.596908, 0.851888, -6.59265,
-  // f 183/187/177 153/155/146 140/177/167
-  0.596908, 0.851888, -6.59265,
-  0.105107, 0.983688, -6.593451,
-  0.105107, 0.998588, -6.58305,
-  // f 174/178/168 144/146/137 155/157/148
-  0.578907, -0.820612, -6.66025,
-  0.105107, -0.947612, -6.66105,
-  0.105107, -0.932512, -6.66995,
-  // f 155/157/148 185/189/179 174/178/168
-  0.105107, -0.932512, -6.66995,
-  0.571307, -0.807512, -6.66915,
-  0.578907, -0.820612, -6.66025,
-  // f 176/180/170 174/178/168 185/189/179
-  0.925707, -0.473812, -6.66025,
-  0.578907, -0.820612, -6.66025,
-  0.571307, -0.807512, -6.66915,
-  // f 185/189/179 187/191/181 176/180/170
-  0.571307, -0.807512, -6.66915,
-  0.912607, -0.466212, -6.66915,
-  0.925707, -0.473812, -6.66025,
-  // f 178/182/172 176/180/170 187/191/181
-  1.052708, -1.2e-005, -6.66025,
-  0.925707, -0.473812, -6.66025,
-  0.912607, -0.466212, -6.66915,
-  // f 187/191/181 189/193/183 178/182/172
-  0.912607, -0.466212, -6.66915,
-  1.037607, -1.2e-005, -6.66915,
-  1.052708, -1.2e-005, -6.66025,
-  // f 180/184/174 178/182/172 189/193/183
-  0.925707, 0.473788, -6.66025,
-  1.052708, -1.2e-005, -6.66025,
-  1.037607, -1.2e-005, -6.66915,
-  // f 189/193/183 191/195/185 180/184/174
-  1.037607, -1.2e-005, -6.66915,
-  0.912607, 0.466188, -6.66915,
-  0.925707, 0.473788, -6.66025,
-  // f 182/186/176 180/184/174 191/195/185
-  0.578907, 0.820588, -6.66025,
-  0.925707, 0.473788, -6.66025,
-  0.912607, 0.466188, -6.66915,
-  // f 191/195/185 193/197/187 182/186/176
-  0.912607, 0.466188, -6.66915,
-  0.571307, 0.807488, -6.66915,
-  0.578907, 0.820588, -6.66025,
-  // f 154/156/147 182/186/176 193/197/187
-  0.105107, 0.947588, -6.66105,
-  0.578907, 0.820588, -6.66025,
-  0.571307, 0.807488, -6.66915,
-  // f 193/197/187 167/169/159 154/156/147
-  0.571307, 0.807488, -6.66915,
-  0.105107, 0.932488, -6.66995,
-  0.105107, 0.947588, -6.66105,
-};
-
-float psmovebulbNormals [] = {
-  // f 1/1/1 2/2/2 3/3/3
-  0, -0.828494925484122, 0.559996570031513,
-  -0.41470392104411, -0.718006788786282, 0.559005285419961,
-  -0.354901870337785, -0.614703239494608, 0.704403712217345,
-  // f 3/3/3 4/4/4 1/1/1
-  -0.354901870337785, -0.614703239494608, 0.704403712217345,
-  0, -0.709901242328261, 0.704301232528235,
-  0, -0.828494925484122, 0.559996570031513,
-  // f 2/2/2 5/5/5 6/6/6
-  -0.41470392104411, -0.718006788786282, 0.559005285419961,
-  -0.718036563352733, -0.414621113044628, 0.559028466454286,
-  -0.614725053630101, -0.354814460758028, 0.7044287095771,
-  // f 6/6/6 3/3/3 2/2/2
-  -0.614725053630101, -0.354814460758028, 0.7044287095771,
-  -0.354901870337785, -0.614703239494608, 0.704403712217345,
-  -0.41470392104411, -0.718006788786282, 0.559005285419961,
-  // f 5/5/5 7/7/7 8/8/8
-  -0.718036563352733, -0.414621113044628, 0.559028466454286,
-  -0.828494925484122, 0, 0.559996570031513,
-  -0.709901242328261, 0, 0.704301232528235,
-  // f 8/8/8 6/6/6 5/5/5
-  -0.709901242328261, 0, 0.704301232528235,
-  -0.614725053630101, -0.354814460758028, 0.7044287095771,
-  -0.718036563352733, -0.414621113044628, 0.559028466454286,
-  // f 7/7/7 9/9/9 10/10/10
-  -0.828494925484122, 0, 0.559996570031513,
-  -0.718006788786282, 0.41470392104411, 0.559005285419961,
-  -0.614703239494608, 0.354901870337785, 0.704403712217345,
-  // f 10/10/10 8/8/8 7/7/7
-  -0.614703239494608, 0.354901870337785, 0.704403712217345,
-  -0.709901242328261, 0, 0.704301232528235,
-  -0.828494925484122, 0, 0.559996570031513,
-  // f 9/9/9 11/11/11 12/12/12
-  -0.718006788786282, 0.41470392104411, 0.559005285419961,
-  -0.414621113044628, 0.718036563352733, 0.559028466454286,
-  -0.354814460758028, 0.614725053630101, 0.7044287095771,
-  // f 12/12/12 10/10/10 9/9/9
-  -0.354814460758028, 0.614725053630101, 0.7044287095771,
-  -0.614703239494608, 0.354901870337785, 0.704403712217345,
-  -0.718006788786282, 0.41470392104411, 0.559005285419961,
-  // f 11/11/11 13/13/13 14/14/14
-  -0.414621113044628, 0.718036563352733, 0.559028466454286,
-  0, 0.828494925484122, 0.559996570031513,
-  0, 0.709901242328261, 0.704301232528235,
-  // f 14/14/14 12/12/12 11/11/11
-  0, 0.709901242328261, 0.704301232528235,
-  -0.354814460758028, 0.614725053630101, 0.7044287095771,
-  -0.414621113044628, 0.718036563352733, 0.559028466454286,
-  // f 15/15/15 16/16/16 17/17/17
-  -0.272214122835049, -0.471424458135349, 0.838843520330781,
-  0, -0.54301490867898, 0.839723054912963,
-  0, -0.338312198066206, 0.941033929590008,
-  // f 17/17/17 18/18/18 15/15/15
-  0, -0.338312198066206, 0.941033929590008,
-  -0.169101401856432, -0.293102429829215, 0.941007800987005,
-  -0.272214122835049, -0.471424458135349, 0.838843520330781,
-  // f 19/19/19 15/15/15 18/18/18
-  -0.471424458135349, -0.272214122835049, 0.838843520330781,
-  -0.272214122835049, -0.471424458135349, 0.838843520330781,
-  -0.169101401856432, -0.293102429829215, 0.941007800987005,
-  // f 18/18/18 20/20/20 19/19/19
-  -0.169101401856432, -0.293102429829215, 0.941007800987005,
-  -0.293102429829215, -0.169101401856432, 0.941007800987005,
-  -0.471424458135349, -0.272214122835049, 0.838843520330781,
-  // f 21/21/21 19/19/19 20/20/20
-  -0.54301490867898, 0, 0.839723054912963,
-  -0.471424458135349, -0.272214122835049, 0.838843520330781,
-  -0.293102429829215, -0.169101401856432, 0.941007800987005,
-  // f 20/20/20 22/22/22 21/21/21
-  -0.293102429829215, -0.169101401856432, 0.941007800987005,
-  -0.338312198066206, 0, 0.941033929590008,
-  -0.54301490867898, 0, 0.839723054912963,
-  // f 23/23/23 21/21/21 22/22/22
-  -0.471384913567258, 0.272191288657208, 0.838873152294384,
-  -0.54301490867898, 0, 0.839723054912963,
-  -0.338312198066206, 0, 0.941033929590008,
-  // f 22/22/22 24/24/24 23/23/23
-  -0.338312198066206, 0, 0.941033929590008,
-  -0.293102429829215, 0.169101401856432, 0.941007800987005,
-  -0.471384913567258, 0.272191288657208, 0.838873152294384,
-  // f 25/25/25 23/23/23 24/24/24
-  -0.272214122835049, 0.471424458135349, 0.838843520330781,
-  -0.471384913567258, 0.272191288657208, 0.838873152294384,
-  -0.293102429829215, 0.169101401856432, 0.941007800987005,
-  // f 24/24/24 26/26/26 25/25/25
-  -0.293102429829215, 0.169101401856432, 0.941007800987005,
-  -0.169101401856432, 0.293102429829215, 0.941007800987005,
-  -0.272214122835049, 0.471424458135349, 0.838843520330781,
-  // f 27/27/27 25/25/25 26/26/26
-  0, 0.54301490867898, 0.839723054912963,
-  -0.272214122835049, 0.471424458135349, 0.838843520330781,
-  -0.169101401856432, 0.293102429829215, 0.941007800987005,
-  // f 26/26/26 28/28/28 27/27/27
-  -0.169101401856432, 0.293102429829215, 0.941007800987005,
-  0, 0.338312198066206, 0.941033929590008,
-  0, 0.54301490867898, 0.839723054912963,
-  // f 4/4/4 3/3/3 29/29/29
-  0, -0.709901242328261, 0.704301232528235,
-  -0.354901870337785, -0.614703239494608, 0.704403712217345,
-  -0.297003176465959, -0.514505502665777, 0.804408603196017,
-  // f 29/29/29 30/30/30 4/4/4
-  -0.297003176465959, -0.514505502665777, 0.804408603196017,
-  0, -0.594095790846233, 0.804394300886567,
-  0, -0.709901242328261, 0.704301232528235,
-  // f 3/3/3 6/6/6 31/31/31
-  -0.354901870337785, -0.614703239494608, 0.704403712217345,
-  -0.614725053630101, -0.354814460758028, 0.7044287095771,
-  -0.514505502665777, -0.297003176465959, 0.804408603196017,
-  // f 31/31/31 29/29/29 3/3/3
-  -0.514505502665777, -0.297003176465959, 0.804408603196017,
-  -0.297003176465959, -0.514505502665777, 0.804408603196017,
-  -0.354901870337785, -0.614703239494608, 0.704403712217345,
-  // f 6/6/6 8/8/8 32/32/32
-  -0.614725053630101, -0.354814460758028, 0.7044287095771,
-  -0.709901242328261, 0, 0.704301232528235,
-  -0.594095790846233, 0, 0.804394300886567,
-  // f 32/32/32 31/31/31 6/6/6
-  -0.594095790846233, 0, 0.804394300886567,
-  -0.514505502665777, -0.297003176465959, 0.804408603196017,
-  -0.614725053630101, -0.354814460758028, 0.7044287095771,
-  // f 8/8/8 10/10/10 33/33/33
-  -0.709901242328261, 0, 0.704301232528235,
-  -0.614703239494608, 0.354901870337785, 0.704403712217345,
-  -0.514505502665777, 0.297003176465959, 0.804408603196017,
-  // f 33/33/33 32/32/32 8/8/8
-  -0.514505502665777, 0.297003176465959, 0.804408603196017,
-  -0.594095790846233, 0, 0.804394300886567,
-  -0.709901242328261, 0, 0.704301232528235,
-  // f 10/10/10 12/12/12 34/34/34
-  -0.614703239494608, 0.354901870337785, 0.704403712217345,
-  -0.354814460758028, 0.614725053630101, 0.7044287095771,
-  -0.297003176465959, 0.514505502665777, 0.804408603196017,
-  // f 34/34/34 33/33/33 10/10/10
-  -0.297003176465959, 0.514505502665777, 0.804408603196017,
-  -0.514505502665777, 0.297003176465959, 0.804408603196017,
-  -0.614703239494608, 0.354901870337785, 0.704403712217345,
-  // f 12/12/12 14/14/14 35/35/35
-  -0.354814460758028, 0.614725053630101, 0.7044287095771,
-  0, 0.709901242328261, 0.704301232528235,
-  0, 0.594095790846233, 0.804394300886567,
-  // f 35/35/35 34/34/34 12/12/12
-  0, 0.594095790846233, 0.804394300886567,
-  -0.297003176465959, 0.514505502665777, 0.804408603196017,
-  -0.354814460758028, 0.614725053630101, 0.7044287095771,
-  // f 30/30/30 29/29/29 36/36/36
-  0, -0.594095790846233, 0.804394300886567,
-  -0.297003176465959, -0.514505502665777, 0.804408603196017,
-  -0.411615588177492, -0.712926999056691, 0.567721500020316,
-  // f 36/36/36 37/37/37 30/30/30
-  -0.411615588177492, -0.712926999056691, 0.567721500020316,
-  0, -0.823224067307417, 0.567716597437343,
-  0, -0.594095790846233, 0.804394300886567,
-  // f 29/29/29 31/31/31 38/38/38
-  -0.297003176465959, -0.514505502665777, 0.804408603196017,
-  -0.514505502665777, -0.297003176465959, 0.804408603196017,
-  -0.712926999056691, -0.411615588177492, 0.567721500020316,
-  // f 38/38/38 36/36/36 29/29/29
-  -0.712926999056691, -0.411615588177492, 0.567721500020316,
-  -0.411615588177492, -0.712926999056691, 0.567721500020316,
-  -0.297003176465959, -0.514505502665777, 0.804408603196017,
-  // f 31/31/31 32/32/32 39/39/39
-  -0.514505502665777, -0.297003176465959, 0.804408603196017,
-  -0.594095790846233, 0, 0.804394300886567,
-  -0.823224067307417, 0, 0.567716597437343,
-  // f 39/39/39 38/38/38 31/31/31
-  -0.823224067307417, 0, 0.567716597437343,
-  -0.712926999056691, -0.411615588177492, 0.567721500020316,
-  -0.514505502665777, -0.297003176465959, 0.804408603196017,
-  // f 32/32/32 33/33/33 40/40/40
-  -0.594095790846233, 0, 0.804394300886567,
-  -0.514505502665777, 0.297003176465959, 0.804408603196017,
-  -0.712926999056691, 0.411615588177492, 0.567721500020316,
-  // f 40/40/40 39/39/39 32/32/32
-  -0.712926999056691, 0.411615588177492, 0.567721500020316,
-  -0.823224067307417, 0, 0.567716597437343,
-  -0.594095790846233, 0, 0.804394300886567,
-  // f 33/33/33 34/34/34 41/41/41
-  -0.514505502665777, 0.297003176465959, 0.804408603196017,
-  -0.297003176465959, 0.514505502665777, 0.804408603196017,
-  -0.411615588177492, 0.712926999056691, 0.567721500020316,
-  // f 41/41/41 40/40/40 33/33/33
-  -0.411615588177492, 0.712926999056691, 0.567721500020316,
-  -0.712926999056691, 0.411615588177492, 0.567721500020316,
-  -0.514505502665777, 0.297003176465959, 0.804408603196017,
-  // f 34/34/34 35/35/35 42/42/42
-  -0.297003176465959, 0.514505502665777, 0.804408603196017,
-  0, 0.594095790846233, 0.804394300886567,
-  0, 0.823177330008493, 0.567784363433943,
-  // f 42/42/42 41/41/41 34/34/34
-  0, 0.823177330008493, 0.567784363433943,
-  -0.411615588177492, 0.712926999056691, 0.567721500020316,
-  -0.297003176465959, 0.514505502665777, 0.804408603196017,
-  // f 37/37/37 36/36/36 43/43/43
-  0, -0.823224067307417, 0.567716597437343,
-  -0.411615588177492, -0.712926999056691, 0.567721500020316,
-  -0.489612845161491, -0.848122250779128, 0.20240531017297,
-  // f 43/43/43 44/44/44 37/37/37
-  -0.489612845161491, -0.848122250779128, 0.20240531017297,
-  0, -0.979302815499642, 0.202400581902509,
-  0, -0.823224067307417, 0.567716597437343,
-  // f 36/36/36 38/38/38 45/45/45
-  -0.411615588177492, -0.712926999056691, 0.567721500020316,
-  -0.712926999056691, -0.411615588177492, 0.567721500020316,
-  -0.848122250779128, -0.489612845161491, 0.20240531017297,
-  // f 45/45/45 43/43/43 36/36/36
-  -0.848122250779128, -0.489612845161491, 0.20240531017297,
-  -0.489612845161491, -0.848122250779128, 0.20240531017297,
-  -0.411615588177492, -0.712926999056691, 0.567721500020316,
-  // f 38/38/38 39/39/39 46/46/46
-  -0.712926999056691, -0.411615588177492, 0.567721500020316,
-  -0.823224067307417, 0, 0.567716597437343,
-  -0.979302815499642, 0, 0.202400581902509,
-  // f 46/46/46 45/45/45 38/38/38
-  -0.979302815499642, 0, 0.202400581902509,
-  -0.848122250779128, -0.489612845161491, 0.20240531017297,
-  -0.712926999056691, -0.411615588177492, 0.567721500020316,
-  // f 39/39/39 40/40/40 47/47/47
-  -0.823224067307417, 0, 0.567716597437343,
-  -0.712926999056691, 0.411615588177492, 0.567721500020316,
-  -0.848122250779128, 0.489612845161491, 0.20240531017297,
-  // f 47/47/47 46/46/46 39/39/39
-  -0.848122250779128, 0.489612845161491, 0.20240531017297,
-  -0.979302815499642, 0, 0.202400581902509,
-  -0.823224067307417, 0, 0.567716597437343,
-  // f 40/40/40 41/41/41 48/48/48
-  -0.712926999056691, 0.411615588177492, 0.567721500020316,
-  -0.411615588177492, 0.712926999056691, 0.567721500020316,
-  -0.489612845161491, 0.848122250779128, 0.20240531017297,
-  // f 48/48/48 47/47/47 40/40/40
-  -0.489612845161491, 0.848122250779128, 0.20240531017297,
-  -0.848122250779128, 0.489612845161491, 0.20240531017297,
-  -0.712926999056691, 0.411615588177492, 0.567721500020316,
-  // f 41/41/41 42/42/42 49/49/49
-  -0.411615588177492, 0.712926999056691, 0.567721500020316,
-  0, 0.823177330008493, 0.567784363433943,
-  0, 0.979302815499642, 0.202400581902509,
-  // f 49/49/49 48/48/48 41/41/41
-  0, 0.979302815499642, 0.202400581902509,
-  -0.489612845161491, 0.848122250779128, 0.20240531017297,
-  -0.411615588177492, 0.712926999056691, 0.567721500020316,
-  // f 44/44/44 43/43/43 50/50/50
-  0, -0.979302815499642, 0.202400581902509,
-  -0.489612845161491, -0.848122250779128, 0.20240531017297,
-  -0.489114688334639, -0.847225442562066, -0.207306225499429,
-  // f 50/50/50 51/51/51 44/44/44
-  -0.489114688334639, -0.847225442562066, -0.207306225499429,
-  0, -0.978278390069042, -0.207295420894728,
-  0, -0.979302815499642, 0.202400581902509,
-  // f 43/43/43 45/45/45 52/52/52
-  -0.489612845161491, -0.848122250779128, 0.20240531017297,
-  -0.848122250779128, -0.489612845161491, 0.20240531017297,
-  -0.847225442562066, -0.489114688334639, -0.207306225499429,
-  // f 52/52/52 50/50/50 43/43/43
-  -0.847225442562066, -0.489114688334639, -0.207306225499429,
-  -0.489114688334639, -0.847225442562066, -0.207306225499429,
-  -0.489612845161491, -0.848122250779128, 0.20240531017297,
-  // f 45/45/45 46/46/46 53/53/53
-  -0.848122250779128, -0.489612845161491, 0.20240531017297,
-  -0.979302815499642, 0, 0.202400581902509,
-  -0.978278390069042, 0, -0.207295420894728,
-  // f 53/53/53 52/52/52 45/45/45
-  -0.978278390069042, 0, -0.207295420894728,
-  -0.847225442562066, -0.489114688334639, -0.207306225499429,
-  -0.848122250779128, -0.489612845161491, 0.20240531017297,
-  // f 46/46/46 47/47/47 54/54/54
-  -0.979302815499642, 0, 0.202400581902509,
-  -0.848122250779128, 0.489612845161491, 0.20240531017297,
-  -0.847225442562066, 0.489114688334639, -0.207306225499429,
-  // f 54/54/54 53/53/53 46/46/46
-  -0.847225442562066, 0.489114688334639, -0.207306225499429,
-  -0.978278390069042, 0, -0.207295420894728,
-  -0.979302815499642, 0, 0.202400581902509,
-  // f 47/47/47 48/48/48 55/55/55
-  -0.848122250779128, 0.489612845161491, 0.20240531017297,
-  -0.489612845161491, 0.848122250779128, 0.20240531017297,
-  -0.489114688334639, 0.847225442562066, -0.207306225499429,
-  // f 55/55/55 54/54/54 47/47/47
-  -0.489114688334639, 0.847225442562066, -0.207306225499429,
-  -0.847225442562066, 0.489114688334639, -0.207306225499429,
-  -0.848122250779128, 0.489612845161491, 0.20240531017297,
-  // f 48/48/48 49/49/49 56/56/56
-  -0.489612845161491, 0.848122250779128, 0.20240531017297,
-  0, 0.979302815499642, 0.202400581902509,
-  0, 0.978278390069042, -0.207295420894728,
-  // f 56/56/56 55/55/55 48/48/48
-  0, 0.978278390069042, -0.207295420894728,
-  -0.489114688334639, 0.847225442562066, -0.207306225499429,
-  -0.489612845161491, 0.848122250779128, 0.20240531017297,
-  // f 51/51/51 50/50/50 57/57/57
-  0, -0.978278390069042, -0.207295420894728,
-  -0.489114688334639, -0.847225442562066, -0.207306225499429,
-  -0.414422263361998, -0.71783856332346, -0.559430053389724,
-  // f 57/57/57 58/58/58 51/51/51
-  -0.414422263361998, -0.71783856332346, -0.559430053389724,
-  0, -0.828898520417462, -0.559399001473674,
-  0, -0.978278390069042, -0.207295420894728,
-  // f 50/50/50 52/52/52 59/59/59
-  -0.489114688334639, -0.847225442562066, -0.207306225499429,
-  -0.847225442562066, -0.489114688334639, -0.207306225499429,
-  -0.71783856332346, -0.414422263361998, -0.559430053389724,
-  // f 59/59/59 57/57/57 50/50/50
-  -0.71783856332346, -0.414422263361998, -0.559430053389724,
-  -0.414422263361998, -0.71783856332346, -0.559430053389724,
-  -0.489114688334639, -0.847225442562066, -0.207306225499429,
-  // f 52/52/52 53/53/53 60/60/60
-  -0.847225442562066, -0.489114688334639, -0.207306225499429,
-  -0.978278390069042, 0, -0.207295420894728,
-  -0.828898520417462, 0, -0.559399001473674,
-  // f 60/60/60 59/59/59 52/52/52
-  -0.828898520417462, 0, -0.559399001473674,
-  -0.71783856332346, -0.414422263361998, -0.559430053389724,
-  -0.847225442562066, -0.489114688334639, -0.207306225499429,
-  // f 53/53/53 54/54/54 61/61/61
-  -0.978278390069042, 0, -0.207295420894728,
-  -0.847225442562066, 0.489114688334639, -0.207306225499429,
-  -0.71783856332346, 0.414422263361998, -0.559430053389724,
-  // f 61/61/61 60/60/60 53/53/53
-  -0.71783856332346, 0.414422263361998, -0.559430053389724,
-  -0.828898520417462, 0, -0.559399001473674,
-  -0.978278390069042, 0, -0.207295420894728,
-  // f 54/54/54 55/55/55 62/62/62
-  -0.847225442562066, 0.489114688334639, -0.207306225499429,
-  -0.489114688334639, 0.847225442562066, -0.207306225499429,
-  -0.414422263361998, 0.71783856332346, -0.559430053389724,
-  // f 62/62/62 61/61/61 54/54/54
-  -0.414422263361998, 0.71783856332346, -0.559430053389724,
-  -0.71783856332346, 0.414422263361998, -0.559430053389724,
-  -0.847225442562066, 0.489114688334639, -0.207306225499429,
-  // f 55/55/55 56/56/56 63/63/63
-  -0.489114688334639, 0.847225442562066, -0.207306225499429,
-  0, 0.978278390069042, -0.207295420894728,
-  0, 0.828898520417462, -0.559399001473674,
-  // f 63/63/63 62/62/62 55/55/55
-  0, 0.828898520417462, -0.559399001473674,
-  -0.414422263361998, 0.71783856332346, -0.559430053389724,
-  -0.489114688334639, 0.847225442562066, -0.207306225499429,
-  // f 58/58/58 57/57/57 64/64/64
-  0, -0.828898520417462, -0.559399001473674,
-  -0.414422263361998, -0.71783856332346, -0.559430053389724,
-  -0.284605633824283, -0.492909757245218, -0.822216275932275,
-  // f 64/64/64 65/65/65 58/58/58
-  -0.284605633824283, -0.492909757245218, -0.822216275932275,
-  0, -0.569199578792468, -0.822199391572675,
-  0, -0.828898520417462, -0.559399001473674,
-  // f 57/57/57 59/59/59 66/66/66
-  -0.414422263361998, -0.71783856332346, -0.559430053389724,
-  -0.71783856332346, -0.414422263361998, -0.559430053389724,
-  -0.492909757245218, -0.284605633824283, -0.822216275932275,
-  // f 66/66/66 64/64/64 57/57/57
-  -0.492909757245218, -0.284605633824283, -0.822216275932275,
-  -0.284605633824283, -0.492909757245218, -0.822216275932275,
-  -0.414422263361998, -0.71783856332346, -0.559430053389724,
-  // f 59/59/59 60/60/60 67/67/67
-  -0.71783856332346, -0.414422263361998, -0.559430053389724,
-  -0.828898520417462, 0, -0.559399001473674,
-  -0.569199578792468, 0, -0.822199391572675,
-  // f 67/67/67 66/66/66 59/59/59
-  -0.569199578792468, 0, -0.822199391572675,
-  -0.492909757245218, -0.284605633824283, -0.822216275932275,
-  -0.71783856332346, -0.414422263361998, -0.559430053389724,
-  // f 60/60/60 61/61/61 68/68/68
-  -0.828898520417462, 0, -0.559399001473674,
-  -0.71783856332346, 0.414422263361998, -0.559430053389724,
-  -0.492909757245218, 0.284605633824283, -0.822216275932275,
-  // f 68/68/68 67/67/67 60/60/60
-  -0.492909757245218, 0.284605633824283, -0.822216275932275,
-  -0.569199578792468, 0, -0.822199391572675,
-  -0.828898520417462, 0, -0.559399001473674,
-  // f 61/61/61 62/62/62 69/69/69
-  -0.71783856332346, 0.414422263361998, -0.559430053389724,
-  -0.414422263361998, 0.71783856332346, -0.559430053389724,
-  -0.284605633824283, 0.492909757245218, -0.822216275932275,
-  // f 69/69/69 68/68/68 61/61/61
-  -0.284605633824283, 0.492909757245218, -0.822216275932275,
-  -0.492909757245218, 0.284605633824283, -0.822216275932275,
-  -0.71783856332346, 0.414422263361998, -0.559430053389724,
-  // f 62/62/62 63/63/63 70/70/70
-  -0.414422263361998, 0.71783856332346, -0.559430053389724,
-  0, 0.828898520417462, -0.559399001473674,
-  0, 0.569131971886556, -0.822246190977204,
-  // f 70/70/70 69/69/69 62/62/62
-  0, 0.569131971886556, -0.822246190977204,
-  -0.284605633824283, 0.492909757245218, -0.822216275932275,
-  -0.414422263361998, 0.71783856332346, -0.559430053389724,
-  // f 65/65/65 64/64/64 71/71/71
-  0, -0.569199578792468, -0.822199391572675,
-  -0.284605633824283, -0.492909757245218, -0.822216275932275,
-  -0.137903634498181, -0.238806293822812, -0.961225333427498,
-  // f 71/71/71 72/72/72 65/65/65
-  -0.137903634498181, -0.238806293822812, -0.961225333427498,
-  0, -0.27571158978027, -0.961240406589754,
-  0, -0.569199578792468, -0.822199391572675,
-  // f 64/64/64 66/66/66 73/73/73
-  -0.284605633824283, -0.492909757245218, -0.822216275932275,
-  -0.492909757245218, -0.284605633824283, -0.822216275932275,
-  -0.238806293822812, -0.137903634498181, -0.961225333427498,
-  // f 73/73/73 71/71/71 64/64/64
-  -0.238806293822812, -0.137903634498181, -0.961225333427498,
-  -0.137903634498181, -0.238806293822812, -0.961225333427498,
-  -0.284605633824283, -0.492909757245218, -0.822216275932275,
-  // f 66/66/66 67/67/67 74/74/74
-  -0.492909757245218, -0.284605633824283, -0.822216275932275,
-  -0.569199578792468, 0, -0.822199391572675,
-  -0.27571158978027, 0, -0.961240406589754,
-  // f 74/74/74 73/73/73 66/66/66
-  -0.27571158978027, 0, -0.961240406589754,
-  -0.238806293822812, -0.137903634498181, -0.961225333427498,
-  -0.492909757245218, -0.284605633824283, -0.822216275932275,
-  // f 67/67/67 68/68/68 75/75/75
-  -0.569199578792468, 0, -0.822199391572675,
-  -0.492909757245218, 0.284605633824283, -0.822216275932275,
-  -0.238806293822812, 0.137903634498181, -0.961225333427498,
-  // f 75/75/75 74/74/74 67/67/67
-  -0.238806293822812, 0.137903634498181, -0.961225333427498,
-  -0.27571158978027, 0, -0.961240406589754,
-  -0.569199578792468, 0, -0.822199391572675,
-  // f 68/68/68 69/69/69 76/76/76
-  -0.492909757245218, 0.284605633824283, -0.822216275932275,
-  -0.284605633824283, 0.492909757245218, -0.822216275932275,
-  -0.137903634498181, 0.238806293822812, -0.961225333427498,
-  // f 76/76/76 75/75/75 68/68/68
-  -0.137903634498181, 0.238806293822812, -0.961225333427498,
-  -0.238806293822812, 0.137903634498181, -0.961225333427498,
-  -0.492909757245218, 0.284605633824283, -0.822216275932275,
-  // f 69/69/69 70/70/70 77/77/77
-  -0.284605633824283, 0.492909757245218, -0.822216275932275,
-  0, 0.569131971886556, -0.822246190977204,
-  0, 0.27571158978027, -0.961240406589754,
-  // f 77/77/77 76/76/76 69/69/69
-  0, 0.27571158978027, -0.961240406589754,
-  -0.137903634498181, 0.238806293822812, -0.961225333427498,
-  -0.284605633824283, 0.492909757245218, -0.822216275932275,
-  // f 72/72/72 71/71/71 78/78/78
-  0, -0.27571158978027, -0.961240406589754,
-  -0.137903634498181, -0.238806293822812, -0.961225333427498,
-  0, 0, -1,
-  // f 71/71/71 73/73/73 78/78/78
-  -0.137903634498181, -0.238806293822812, -0.961225333427498,
-  -0.238806293822812, -0.137903634498181, -0.961225333427498,
-  0, 0, -1,
-  // f 73/73/73 74/74/74 78/78/78
-  -0.238806293822812, -0.137903634498181, -0.961225333427498,
-  -0.27571158978027, 0, -0.961240406589754,
-  0, 0, -1,
-  // f 74/74/74 75/75/75 78/78/78
-  -0.27571158978027, 0, -0.961240406589754,
-  -0.238806293822812, 0.137903634498181, -0.961225333427498,
-  0, 0, -1,
-  // f 75/75/75 76/76/76 78/78/78
-  -0.238806293822812, 0.137903634498181, -0.961225333427498,
-  -0.137903634498181, 0.238806293822812, -0.961225333427498,
-  0, 0, -1,
-  // f 76/76/76 77/77/77 78/78/78
-  -0.137903634498181, 0.238806293822812, -0.961225333427498,
-  0, 0.27571158978027, -0.961240406589754,
-  0, 0, -1,
-  // f 1/1/1 16/16/16 15/15/15
-  0, -0.828494925484122, 0.559996570031513,
-  0, -0.54301490867898, 0.839723054912963,
-  -0.272214122835049, -0.471424458135349, 0.838843520330781,
-  // f 15/15/15 2/2/2 1/1/1
-  -0.272214122835049, -0.471424458135349, 0.838843520330781,
-  -0.41470392104411, -0.718006788786282, 0.559005285419961,
-  0, -0.828494925484122, 0.559996570031513,
-  // f 2/2/2 15/15/15 19/19/19
-  -0.41470392104411, -0.718006788786282, 0.559005285419961,
-  -0.272214122835049, -0.471424458135349, 0.838843520330781,
-  -0.471424458135349, -0.272214122835049, 0.838843520330781,
-  // f 19/19/19 5/5/5 2/2/2
-  -0.471424458135349, -0.272214122835049, 0.838843520330781,
-  -0.718036563352733, -0.414621113044628, 0.559028466454286,
-  -0.41470392104411, -0.718006788786282, 0.559005285419961,
-  // f 5/5/5 19/19/19 21/21/21
-  -0.718036563352733, -0.414621113044628, 0.559028466454286,
-  -0.471424458135349, -0.272214122835049, 0.838843520330781,
-  -0.54301490867898, 0, 0.839723054912963,
-  // f 21/21/21 7/7/7 5/5/5
-  -0.54301490867898, 0, 0.839723054912963,
-  -0.828494925484122, 0, 0.559996570031513,
-  -0.718036563352733, -0.414621113044628, 0.559028466454286,
-  // f 7/7/7 21/21/21 23/23/23
-  -0.828494925484122, 0, 0.559996570031513,
-  -0.54301490867898, 0, 0.839723054912963,
-  -0.471384913567258, 0.272191288657208, 0.838873152294384,
-  // f 23/23/23 9/9/9 7/7/7
-  -0.471384913567258, 0.272191288657208, 0.838873152294384,
-  -0.718006788786282, 0.41470392104411, 0.559005285419961,
-  -0.828494925484122, 0, 0.559996570031513,
-  // f 9/9/9 23/23/23 25/25/25
-  -0.718006788786282, 0.41470392104411, 0.559005285419961,
-  -0.471384913567258, 0.272191288657208, 0.838873152294384,
-  -0.272214122835049, 0.471424458135349, 0.838843520330781,
-  // f 25/25/25 11/11/11 9/9/9
-  -0.272214122835049, 0.471424458135349, 0.838843520330781,
-  -0.414621113044628, 0.718036563352733, 0.559028466454286,
-  -0.718006788786282, 0.41470392104411, 0.559005285419961,
-  // f 11/11/11 25/25/25 27/27/27
-  -0.414621113044628, 0.718036563352733, 0.559028466454286,
-  -0.272214122835049, 0.471424458135349, 0.838843520330781,
-  0, 0.54301490867898, 0.839723054912963,
-  // f 27/27/27 13/13/13 11/11/11
-  0, 0.54301490867898, 0.839723054912963,
-  0, 0.828494925484122, 0.559996570031513,
-  -0.414621113044628, 0.718036563352733, 0.559028466454286,
-  // f 1/1/1 4/4/4 79/79/79
-  0, -0.828494925484122, 0.559996570031513,
-  0, -0.709901242328261, 0.704301232528235,
-  0.354901870337785, -0.614703239494608, 0.704403712217345,
-  // f 79/79/79 80/80/80 1/1/1
-  0.354901870337785, -0.614703239494608, 0.704403712217345,
-  0.41470392104411, -0.718006788786282, 0.559005285419961,
-  0, -0.828494925484122, 0.559996570031513,
-  // f 80/80/80 79/79/79 81/81/81
-  0.41470392104411, -0.718006788786282, 0.559005285419961,
-  0.354901870337785, -0.614703239494608, 0.704403712217345,
-  0.614725053630101, -0.354814460758028, 0.7044287095771,
-  // f 81/81/81 82/82/82 80/80/80
-  0.614725053630101, -0.354814460758028, 0.7044287095771,
-  0.718036563352733, -0.414621113044628, 0.559028466454286,
-  0.41470392104411, -0.718006788786282, 0.559005285419961,
-  // f 82/82/82 81/81/81 83/83/83
-  0.718036563352733, -0.414621113044628, 0.559028466454286,
-  0.614725053630101, -0.354814460758028, 0.7044287095771,
-  0.709901242328261, 0, 0.704301232528235,
-  // f 83/83/83 84/84/84 82/82/82
-  0.709901242328261, 0, 0.704301232528235,
-  0.828494925484122, 0, 0.559996570031513,
-  0.718036563352733, -0.414621113044628, 0.559028466454286,
-  // f 84/84/84 83/83/83 85/85/85
-  0.828494925484122, 0, 0.559996570031513,
-  0.709901242328261, 0, 0.704301232528235,
-  0.614703239494608, 0.354901870337785, 0.704403712217345,
-  // f 85/85/85 86/86/86 84/84/84
-  0.614703239494608, 0.354901870337785, 0.704403712217345,
-  0.718006788786282, 0.41470392104411, 0.559005285419961,
-  0.828494925484122, 0, 0.559996570031513,
-  // f 86/86/86 85/85/85 87/87/87
-  0.718006788786282, 0.41470392104411, 0.559005285419961,
-  0.614703239494608, 0.354901870337785, 0.704403712217345,
-  0.354814460758028, 0.614725053630101, 0.7044287095771,
-  // f 87/87/87 88/88/88 86/86/86
-  0.354814460758028, 0.614725053630101, 0.7044287095771,
-  0.414621113044628, 0.718036563352733, 0.559028466454286,
-  0.718006788786282, 0.41470392104411, 0.559005285419961,
-  // f 88/88/88 87/87/87 14/14/14
-  0.414621113044628, 0.718036563352733, 0.559028466454286,
-  0.354814460758028, 0.614725053630101, 0.7044287095771,
-  0, 0.709901242328261, 0.704301232528235,
-  // f 14/14/14 13/13/13 88/88/88
-  0, 0.709901242328261, 0.704301232528235,
-  0, 0.828494925484122, 0.559996570031513,
-  0.414621113044628, 0.718036563352733, 0.559028466454286,
-  // f 89/89/89 90/90/90 17/17/17
-  0.272306713804794, -0.471411622796842, 0.838820681378852,
-  0.169101401856432, -0.293102429829215, 0.941007800987005,
-  0, -0.338312198066206, 0.941033929590008,
-  // f 17/17/17 16/16/16 89/89/89
-  0, -0.338312198066206, 0.941033929590008,
-  0, -0.54301490867898, 0.839723054912963,
-  0.272306713804794, -0.471411622796842, 0.838820681378852,
-  // f 91/91/91 92/92/92 90/90/90
-  0.471424458135349, -0.272214122835049, 0.838843520330781,
-  0.293102429829215, -0.169101401856432, 0.941007800987005,
-  0.169101401856432, -0.293102429829215, 0.941007800987005,
-  // f 90/90/90 89/89/89 91/91/91
-  0.169101401856432, -0.293102429829215, 0.941007800987005,
-  0.272306713804794, -0.471411622796842, 0.838820681378852,
-  0.471424458135349, -0.272214122835049, 0.838843520330781,
-  // f 93/93/93 94/94/94 92/92/92
-  0.54301490867898, 0, 0.839723054912963,
-  0.338312198066206, 0, 0.941033929590008,
-  0.293102429829215, -0.169101401856432, 0.941007800987005,
-  // f 92/92/92 91/91/91 93/93/93
-  0.293102429829215, -0.169101401856432, 0.941007800987005,
-  0.471424458135349, -0.272214122835049, 0.838843520330781,
-  0.54301490867898, 0, 0.839723054912963,
-  // f 95/95/95 96/96/96 94/94/94
-  0.471384913567258, 0.272191288657208, 0.838873152294384,
-  0.293102429829215, 0.169101401856432, 0.941007800987005,
-  0.338312198066206, 0, 0.941033929590008,
-  // f 94/94/94 93/93/93 95/95/95
-  0.338312198066206, 0, 0.941033929590008,
-  0.54301490867898, 0, 0.839723054912963,
-  0.471384913567258, 0.272191288657208, 0.838873152294384,
-  // f 97/97/97 98/98/98 96/96/96
-  0.272214122835049, 0.471424458135349, 0.838843520330781,
-  0.169101401856432, 0.293102429829215, 0.941007800987005,
-  0.293102429829215, 0.169101401856432, 0.941007800987005,
-  // f 96/96/96 95/95/95 97/97/97
-  0.293102429829215, 0.169101401856432, 0.941007800987005,
-  0.471384913567258, 0.272191288657208, 0.838873152294384,
-  0.272214122835049, 0.471424458135349, 0.838843520330781,
-  // f 27/27/27 28/28/28 98/98/98
-  0, 0.54301490867898, 0.839723054912963,
-  0, 0.338312198066206, 0.941033929590008,
-  0.169101401856432, 0.293102429829215, 0.941007800987005,
-  // f 98/98/98 97/97/97 27/27/27
-  0.169101401856432, 0.293102429829215, 0.941007800987005,
-  0.272214122835049, 0.471424458135349, 0.838843520330781,
-  0, 0.54301490867898, 0.839723054912963,
-  // f 4/4/4 30/30/30 99/99/99
-  0, -0.709901242328261, 0.704301232528235,
-  0, -0.594095790846233, 0.804394300886567,
-  0.297003176465959, -0.514505502665777, 0.804408603196017,
-  // f 99/99/99 79/79/79 4/4/4
-  0.297003176465959, -0.514505502665777, 0.804408603196017,
-  0.354901870337785, -0.614703239494608, 0.704403712217345,
-  0, -0.709901242328261, 0.704301232528235,
-  // f 79/79/79 99/99/99 100/100/100
-  0.354901870337785, -0.614703239494608, 0.704403712217345,
-  0.297003176465959, -0.514505502665777, 0.804408603196017,
-  0.514505502665777, -0.297003176465959, 0.804408603196017,
-  // f 100/100/100 81/81/81 79/79/79
-  0.514505502665777, -0.297003176465959, 0.804408603196017,
-  0.614725053630101, -0.354814460758028, 0.7044287095771,
-  0.354901870337785, -0.614703239494608, 0.704403712217345,
-  // f 81/81/81 100/100/100 101/101/101
-  0.614725053630101, -0.354814460758028, 0.7044287095771,
-  0.514505502665777, -0.297003176465959, 0.804408603196017,
-  0.594095790846233, 0, 0.804394300886567,
-  // f 101/101/101 83/83/83 81/81/81
-  0.594095790846233, 0, 0.804394300886567,
-  0.709901242328261, 0, 0.704301232528235,
-  0.614725053630101, -0.354814460758028, 0.7044287095771,
-  // f 83/83/83 101/101/101 102/102/102
-  0.709901242328261, 0, 0.704301232528235,
-  0.594095790846233, 0, 0.804394300886567,
-  0.514505502665777, 0.297003176465959, 0.804408603196017,
-  // f 102/102/102 85/85/85 83/83/83
-  0.514505502665777, 0.297003176465959, 0.804408603196017,
-  0.614703239494608, 0.354901870337785, 0.704403712217345,
-  0.709901242328261, 0, 0.704301232528235,
-  // f 85/85/85 102/102/102 103/103/103
-  0.614703239494608, 0.354901870337785, 0.704403712217345,
-  0.514505502665777, 0.297003176465959, 0.804408603196017,
-  0.297003176465959, 0.514505502665777, 0.804408603196017,
-  // f 103/103/103 87/87/87 85/85/85
-  0.297003176465959, 0.514505502665777, 0.804408603196017,
-  0.354814460758028, 0.614725053630101, 0.7044287095771,
-  0.614703239494608, 0.354901870337785, 0.704403712217345,
-  // f 87/87/87 103/103/103 35/35/35
-  0.354814460758028, 0.614725053630101, 0.7044287095771,
-  0.297003176465959, 0.514505502665777, 0.804408603196017,
-  0, 0.594095790846233, 0.804394300886567,
-  // f 35/35/35 14/14/14 87/87/87
-  0, 0.594095790846233, 0.804394300886567,
-  0, 0.709901242328261, 0.704301232528235,
-  0.354814460758028, 0.614725053630101, 0.7044287095771,
-  // f 30/30/30 37/37/37 104/104/104
-  0, -0.594095790846233, 0.804394300886567,
-  0, -0.823224067307417, 0.567716597437343,
-  0.411615588177492, -0.712926999056691, 0.567721500020316,
-  // f 104/104/104 99/99/99 30/30/30
-  0.411615588177492, -0.712926999056691, 0.567721500020316,
-  0.297003176465959, -0.514505502665777, 0.804408603196017,
-  0, -0.594095790846233, 0.804394300886567,
-  // f 99/99/99 104/104/104 105/105/105
-  0.297003176465959, -0.514505502665777, 0.804408603196017,
-  0.411615588177492, -0.712926999056691, 0.567721500020316,
-  0.712926999056691, -0.411615588177492, 0.567721500020316,
-  // f 105/105/105 100/100/100 99/99/99
-  0.712926999056691, -0.411615588177492, 0.567721500020316,
-  0.514505502665777, -0.297003176465959, 0.804408603196017,
-  0.297003176465959, -0.514505502665777, 0.804408603196017,
-  // f 100/100/100 105/105/105 106/106/106
-  0.514505502665777, -0.297003176465959, 0.804408603196017,
-  0.712926999056691, -0.411615588177492, 0.567721500020316,
-  0.823224067307417, 0, 0.567716597437343,
-  // f 106/106/106 101/101/101 100/100/100
-  0.823224067307417, 0, 0.567716597437343,
-  0.594095790846233, 0, 0.804394300886567,
-  0.514505502665777, -0.297003176465959, 0.804408603196017,
-  // f 101/101/101 106/106/106 107/107/107
-  0.594095790846233, 0, 0.804394300886567,
-  0.823224067307417, 0, 0.567716597437343,
-  0.712926999056691, 0.411615588177492, 0.567721500020316,
-  // f 107/107/107 102/102/102 101/101/101
-  0.712926999056691, 0.411615588177492, 0.567721500020316,
-  0.514505502665777, 0.297003176465959, 0.804408603196017,
-  0.594095790846233, 0, 0.804394300886567,
-  // f 102/102/102 107/107/107 108/108/108
-  0.514505502665777, 0.297003176465959, 0.804408603196017,
-  0.712926999056691, 0.411615588177492, 0.567721500020316,
-  0.411615588177492, 0.712926999056691, 0.567721500020316,
-  // f 108/108/108 103/103/103 102/102/102
-  0.411615588177492, 0.712926999056691, 0.567721500020316,
-  0.297003176465959, 0.514505502665777, 0.804408603196017,
-  0.514505502665777, 0.297003176465959, 0.804408603196017,
-  // f 103/103/103 108/108/108 42/42/42
-  0.297003176465959, 0.514505502665777, 0.804408603196017,
-  0.411615588177492, 0.712926999056691, 0.567721500020316,
-  0, 0.823177330008493, 0.567784363433943,
-  // f 42/42/42 35/35/35 103/103/103
-  0, 0.823177330008493, 0.567784363433943,
-  0, 0.594095790846233, 0.804394300886567,
-  0.297003176465959, 0.514505502665777, 0.804408603196017,
-  // f 37/37/37 44/44/44 109/109/109
-  0, -0.823224067307417, 0.567716597437343,
-  0, -0.979302815499642, 0.202400581902509,
-  0.489612845161491, -0.848122250779128, 0.20240531017297,
-  // f 109/109/109 104/104/104 37/37/37
-  0.489612845161491, -0.848122250779128, 0.20240531017297,
-  0.411615588177492, -0.712926999056691, 0.567721500020316,
-  0, -0.823224067307417, 0.567716597437343,
-  // f 104/104/104 109/109/109 110/110/110
-  0.411615588177492, -0.712926999056691, 0.567721500020316,
-  0.489612845161491, -0.848122250779128, 0.20240531017297,
-  0.848122250779128, -0.489612845161491, 0.20240531017297,
-  // f 110/110/110 105/105/105 104/104/104
-  0.848122250779128, -0.489612845161491, 0.20240531017297,
-  0.712926999056691, -0.411615588177492, 0.567721500020316,
-  0.411615588177492, -0.712926999056691, 0.567721500020316,
-  // f 105/105/105 110/110/110 111/111/111
-  0.712926999056691, -0.411615588177492, 0.567721500020316,
-  0.848122250779128, -0.489612845161491, 0.20240531017297,
-  0.979302815499642, 0, 0.202400581902509,
-  // f 111/111/111 106/106/106 105/105/105
-  0.979302815499642, 0, 0.202400581902509,
-  0.823224067307417, 0, 0.567716597437343,
-  0.712926999056691, -0.411615588177492, 0.567721500020316,
-  // f 106/106/106 111/111/111 112/112/112
-  0.823224067307417, 0, 0.567716597437343,
-  0.979302815499642, 0, 0.202400581902509,
-  0.848122250779128, 0.489612845161491, 0.20240531017297,
-  // f 112/112/112 107/107/107 106/106/106
-  0.848122250779128, 0.489612845161491, 0.20240531017297,
-  0.712926999056691, 0.411615588177492, 0.567721500020316,
-  0.823224067307417, 0, 0.567716597437343,
-  // f 107/107/107 112/112/112 113/113/113
-  0.712926999056691, 0.411615588177492, 0.567721500020316,
-  0.848122250779128, 0.489612845161491, 0.20240531017297,
-  0.489612845161491, 0.848122250779128, 0.20240531017297,
-  // f 113/113/113 108/108/108 107/107/107
-  0.489612845161491, 0.848122250779128, 0.20240531017297,
-  0.411615588177492, 0.712926999056691, 0.567721500020316,
-  0.712926999056691, 0.411615588177492, 0.567721500020316,
-  // f 108/108/108 113/113/113 49/49/49
-  0.411615588177492, 0.712926999056691, 0.567721500020316,
-  0.489612845161491, 0.848122250779128, 0.20240531017297,
-  0, 0.979302815499642, 0.202400581902509,
-  // f 49/49/49 42/42/42 108/108/108
-  0, 0.979302815499642, 0.202400581902509,
-  0, 0.823177330008493, 0.567784363433943,
-  0.411615588177492, 0.712926999056691, 0.567721500020316,
-  // f 44/44/44 51/114/51 114/115/114
-  0, -0.979302815499642, 0.202400581902509,
-  0, -0.978278390069042, -0.207295420894728,
-  0.489114688334639, -0.847225442562066, -0.207306225499429,
-  // f 114/115/114 109/109/109 44/44/44
-  0.489114688334639, -0.847225442562066, -0.207306225499429,
-  0.489612845161491, -0.848122250779128, 0.20240531017297,
-  0, -0.979302815499642, 0.202400581902509,
-  // f 109/109/109 114/115/114 115/116/115
-  0.489612845161491, -0.848122250779128, 0.20240531017297,
-  0.489114688334639, -0.847225442562066, -0.207306225499429,
-  0.847225442562066, -0.489114688334639, -0.207306225499429,
-  // f 115/116/115 110/110/110 109/109/109
-  0.847225442562066, -0.489114688334639, -0.207306225499429,
-  0.848122250779128, -0.489612845161491, 0.20240531017297,
-  0.489612845161491, -0.848122250779128, 0.20240531017297,
-  // f 110/110/110 115/116/115 116/117/116
-  0.848122250779128, -0.489612845161491, 0.20240531017297,
-  0.847225442562066, -0.489114688334639, -0.207306225499429,
-  0.978278390069042, 0, -0.207295420894728,
-  // f 116/117/116 111/111/111 110/110/110
-  0.978278390069042, 0, -0.207295420894728,
-  0.979302815499642, 0, 0.202400581902509,
-  0.848122250779128, -0.489612845161491, 0.20240531017297,
-  // f 111/111/111 116/117/116 117/118/117
-  0.979302815499642, 0, 0.202400581902509,
-  0.978278390069042, 0, -0.207295420894728,
-  0.847225442562066, 0.489114688334639, -0.207306225499429,
-  // f 117/118/117 112/112/112 111/111/111
-  0.847225442562066, 0.489114688334639, -0.207306225499429,
-  0.848122250779128, 0.489612845161491, 0.20240531017297,
-  0.979302815499642, 0, 0.202400581902509,
-  // f 112/112/112 117/118/117 118/119/118
-  0.848122250779128, 0.489612845161491, 0.20240531017297,
-  0.847225442562066, 0.489114688334639, -0.207306225499429,
-  0.489114688334639, 0.847225442562066, -0.207306225499429,
-  // f 118/119/118 113/113/113 112/112/112
-  0.489114688334639, 0.847225442562066, -0.207306225499429,
-  0.489612845161491, 0.848122250779128, 0.20240531017297,
-  0.848122250779128, 0.489612845161491, 0.20240531017297,
-  // f 113/113/113 118/119/118 56/120/56
-  0.489612845161491, 0.848122250779128, 0.20240531017297,
-  0.489114688334639, 0.847225442562066, -0.207306225499429,
-  0, 0.978278390069042, -0.207295420894728,
-  // f 56/120/56 49/49/49 113/113/113
-  0, 0.978278390069042, -0.207295420894728,
-  0, 0.979302815499642, 0.202400581902509,
-  0.489612845161491, 0.848122250779128, 0.20240531017297,
-  // f 51/114/51 58/121/58 119/122/119
-  0, -0.978278390069042, -0.207295420894728,
-  0, -0.828898520417462, -0.559399001473674,
-  0.414422263361998, -0.71783856332346, -0.559430053389724,
-  // f 119/122/119 114/115/114 51/114/51
-  0.414422263361998, -0.71783856332346, -0.559430053389724,
-  0.489114688334639, -0.847225442562066, -0.207306225499429,
-  0, -0.978278390069042, -0.207295420894728,
-  // f 114/115/114 119/122/119 120/123/120
-  0.489114688334639, -0.847225442562066, -0.207306225499429,
-  0.414422263361998, -0.71783856332346, -0.559430053389724,
-  0.71783856332346, -0.414422263361998, -0.559430053389724,
-  // f 120/123/120 115/116/115 114/115/114
-  0.71783856332346, -0.414422263361998, -0.559430053389724,
-  0.847225442562066, -0.489114688334639, -0.207306225499429,
-  0.489114688334639, -0.847225442562066, -0.207306225499429,
-  // f 115/116/115 120/123/120 121/124/121
-  0.847225442562066, -0.489114688334639, -0.207306225499429,
-  0.71783856332346, -0.414422263361998, -0.559430053389724,
-  0.828898520417462, 0, -0.559399001473674,
-  // f 121/124/121 116/117/116 115/116/115
-  0.828898520417462, 0, -0.559399001473674,
-  0.978278390069042, 0, -0.207295420894728,
-  0.847225442562066, -0.489114688334639, -0.207306225499429,
-  // f 116/117/116 121/124/121 122/125/122
-  0.978278390069042, 0, -0.207295420894728,
-  0.828898520417462, 0, -0.559399001473674,
-  0.71783856332346, 0.414422263361998, -0.559430053389724,
-  // f 122/125/122 117/118/117 116/117/116
-  0.71783856332346, 0.414422263361998, -0.559430053389724,
-  0.847225442562066, 0.489114688334639, -0.207306225499429,
-  0.978278390069042, 0, -0.207295420894728,
-  // f 117/118/117 122/125/122 123/126/123
-  0.847225442562066, 0.489114688334639, -0.207306225499429,
-  0.71783856332346, 0.414422263361998, -0.559430053389724,
-  0.414422263361998, 0.71783856332346, -0.559430053389724,
-  // f 123/126/123 118/119/118 117/118/117
-  0.414422263361998, 0.71783856332346, -0.559430053389724,
-  0.489114688334639, 0.847225442562066, -0.207306225499429,
-  0.847225442562066, 0.489114688334639, -0.207306225499429,
-  // f 118/119/118 123/126/123 63/127/63
-  0.489114688334639, 0.847225442562066, -0.207306225499429,
-  0.414422263361998, 0.71783856332346, -0.559430053389724,
-  0, 0.828898520417462, -0.559399001473674,
-  // f 63/127/63 56/120/56 118/119/118
-  0, 0.828898520417462, -0.559399001473674,
-  0, 0.978278390069042, -0.207295420894728,
-  0.489114688334639, 0.847225442562066, -0.207306225499429,
-  // f 58/121/58 65/128/65 124/129/124
-  0, -0.828898520417462, -0.559399001473674,
-  0, -0.569199578792468, -0.822199391572675,
-  0.284605633824283, -0.492909757245218, -0.822216275932275,
-  // f 124/129/124 119/122/119 58/121/58
-  0.284605633824283, -0.492909757245218, -0.822216275932275,
-  0.414422263361998, -0.71783856332346, -0.559430053389724,
-  0, -0.828898520417462, -0.559399001473674,
-  // f 119/122/119 124/129/124 125/130/125
-  0.414422263361998, -0.71783856332346, -0.559430053389724,
-  0.284605633824283, -0.492909757245218, -0.822216275932275,
-  0.492909757245218, -0.284605633824283, -0.822216275932275,
-  // f 125/130/125 120/123/120 119/122/119
-  0.492909757245218, -0.284605633824283, -0.822216275932275,
-  0.71783856332346, -0.414422263361998, -0.559430053389724,
-  0.414422263361998, -0.71783856332346, -0.559430053389724,
-  // f 120/123/120 125/130/125 126/131/126
-  0.71783856332346, -0.414422263361998, -0.559430053389724,
-  0.492909757245218, -0.284605633824283, -0.822216275932275,
-  0.569199578792468, 0, -0.822199391572675,
-  // f 126/131/126 121/124/121 120/123/120
-  0.569199578792468, 0, -0.822199391572675,
-  0.828898520417462, 0, -0.559399001473674,
-  0.71783856332346, -0.414422263361998, -0.559430053389724,
-  // f 121/124/121 126/131/126 127/132/127
-  0.828898520417462, 0, -0.559399001473674,
-  0.569199578792468, 0, -0.822199391572675,
-  0.492909757245218, 0.284605633824283, -0.822216275932275,
-  // f 127/132/127 122/125/122 121/124/121
-  0.492909757245218, 0.284605633824283, -0.822216275932275,
-  0.71783856332346, 0.414422263361998, -0.559430053389724,
-  0.828898520417462, 0, -0.559399001473674,
-  // f 122/125/122 127/132/127 128/133/128
-  0.71783856332346, 0.414422263361998, -0.559430053389724,
-  0.492909757245218, 0.284605633824283, -0.822216275932275,
-  0.284605633824283, 0.492909757245218, -0.822216275932275,
-  // f 128/133/128 123/126/123 122/125/122
-  0.284605633824283, 0.492909757245218, -0.822216275932275,
-  0.414422263361998, 0.71783856332346, -0.559430053389724,
-  0.71783856332346, 0.414422263361998, -0.559430053389724,
-  // f 123/126/123 128/133/128 70/134/70
-  0.414422263361998, 0.71783856332346, -0.559430053389724,
-  0.284605633824283, 0.492909757245218, -0.822216275932275,
-  0, 0.569131971886556, -0.822246190977204,
-  // f 70/134/70 63/127/63 123/126/123
-  0, 0.569131971886556, -0.822246190977204,
-  0, 0.828898520417462, -0.559399001473674,
-  0.414422263361998, 0.71783856332346, -0.559430053389724,
-  // f 65/128/65 72/135/72 129/136/129
-  0, -0.569199578792468, -0.822199391572675,
-  0, -0.27571158978027, -0.961240406589754,
-  0.137903634498181, -0.238806293822812, -0.961225333427498,
-  // f 129/136/129 124/129/124 65/128/65
-  0.137903634498181, -0.238806293822812, -0.961225333427498,
-  0.284605633824283, -0.492909757245218, -0.822216275932275,
-  0, -0.569199578792468, -0.822199391572675,
-  // f 124/129/124 129/136/129 130/137/130
-  0.284605633824283, -0.492909757245218, -0.822216275932275,
-  0.137903634498181, -0.238806293822812, -0.961225333427498,
-  0.238806293822812, -0.137903634498181, -0.961225333427498,
-  // f 130/137/130 125/130/125 124/129/124
-  0.238806293822812, -0.137903634498181, -0.961225333427498,
-  0.492909757245218, -0.284605633824283, -0.822216275932275,
-  0.284605633824283, -0.492909757245218, -0.822216275932275,
-  // f 125/130/125 130/137/130 131/138/131
-  0.492909757245218, -0.284605633824283, -0.822216275932275,
-  0.238806293822812, -0.137903634498181, -0.961225333427498,
-  0.27571158978027, 0, -0.961240406589754,
-  // f 131/138/131 126/131/126 125/130/125
-  0.27571158978027, 0, -0.961240406589754,
-  0.569199578792468, 0, -0.822199391572675,
-  0.492909757245218, -0.284605633824283, -0.822216275932275,
-  // f 126/131/126 131/138/131 132/139/132
-  0.569199578792468, 0, -0.822199391572675,
-  0.27571158978027, 0, -0.961240406589754,
-  0.238806293822812, 0.137903634498181, -0.961225333427498,
-  // f 132/139/132 127/132/127 126/131/126
-  0.238806293822812, 0.137903634498181, -0.961225333427498,
-  0.492909757245218, 0.284605633824283, -0.822216275932275,
-  0.569199578792468, 0, -0.822199391572675,
-  // f 127/132/127 132/139/132 133/140/133
-  0.492909757245218, 0.284605633824283, -0.822216275932275,
-  0.238806293822812, 0.137903634498181, -0.961225333427498,
-  0.137903634498181, 0.238806293822812, -0.961225333427498,
-  // f 133/140/133 128/133/128 127/132/127
-  0.137903634498181, 0.238806293822812, -0.961225333427498,
-  0.284605633824283, 0.492909757245218, -0.822216275932275,
-  0.492909757245218, 0.284605633824283, -0.822216275932275,
-  // f 128/133/128 133/140/133 77/141/77
-  0.284605633824283, 0.492909757245218, -0.822216275932275,
-  0.137903634498181, 0.238806293822812, -0.961225333427498,
-  0, 0.27571158978027, -0.961240406589754,
-  // f 77/141/77 70/134/70 128/133/128
-  0, 0.27571158978027, -0.961240406589754,
-  0, 0.569131971886556, -0.822246190977204,
-  0.284605633824283, 0.492909757245218, -0.822216275932275,
-  // f 72/135/72 78/142/78 129/136/129
-  0, -0.27571158978027, -0.961240406589754,
-  0, 0, -1,
-  0.137903634498181, -0.238806293822812, -0.961225333427498,
-  // f 129/136/129 78/142/78 130/137/130
-  0.137903634498181, -0.238806293822812, -0.961225333427498,
-  0, 0, -1,
-  0.238806293822812, -0.137903634498181, -0.961225333427498,
-  // f 130/137/130 78/142/78 131/138/131
-  0.238806293822812, -0.137903634498181, -0.961225333427498,
-  0, 0, -1,
-  0.27571158978027, 0, -0.961240406589754,
-  // f 131/138/131 78/142/78 132/139/132
-  0.27571158978027, 0, -0.961240406589754,
-  0, 0, -1,
-  0.238806293822812, 0.137903634498181, -0.961225333427498,
-  // f 132/139/132 78/142/78 133/140/133
-  0.238806293822812, 0.137903634498181, -0.961225333427498,
-  0, 0, -1,
-  0.137903634498181, 0.238806293822812, -0.961225333427498,
-  // f 133/140/133 78/142/78 77/141/77
-  0.137903634498181, 0.238806293822812, -0.961225333427498,
-  0, 0, -1,
-  0, 0.27571158978027, -0.961240406589754,
-  // f 1/1/1 80/80/80 89/89/89
-  0, -0.828494925484122, 0.559996570031513,
-  0.41470392104411, -0.718006788786282, 0.559005285419961,
-  0.272306713804794, -0.471411622796842, 0.838820681378852,
-  // f 89/89/89 16/16/16 1/1/1
-  0.272306713804794, -0.471411622796842, 0.838820681378852,
-  0, -0.54301490867898, 0.839723054912963,
-  0, -0.828494925484122, 0.559996570031513,
-  // f 80/80/80 82/82/82 91/91/91
-  0.41470392104411, -0.718006788786282, 0.559005285419961,
-  0.718036563352733, -0.414621113044628, 0.559028466454286,
-  0.471424458135349, -0.272214122835049, 0.838843520330781,
-  // f 91/91/91 89/89/89 80/80/80
-  0.471424458135349, -0.272214122835049, 0.838843520330781,
-  0.272306713804794, -0.471411622796842, 0.838820681378852,
-  0.41470392104411, -0.718006788786282, 0.559005285419961,
-  // f 82/82/82 84/84/84 93/93/93
-  0.718036563352733, -0.414621113044628, 0.559028466454286,
-  0.828494925484122, 0, 0.559996570031513,
-  0.54301490867898, 0, 0.839723054912963,
-  // f 93/93/93 91/91/91 82/82/82
-  0.54301490867898, 0, 0.839723054912963,
-  0.471424458135349, -0.272214122835049, 0.838843520330781,
-  0.718036563352733, -0.414621113044628, 0.559028466454286,
-  // f 84/84/84 86/86/86 95/95/95
-  0.828494925484122, 0, 0.559996570031513,
-  0.718006788786282, 0.41470392104411, 0.559005285419961,
-  0.471384913567258, 0.272191288657208, 0.838873152294384,
-  // f 95/95/95 93/93/93 84/84/84
-  0.471384913567258, 0.272191288657208, 0.838873152294384,
-  0.54301490867898, 0, 0.839723054912963,
-  0.828494925484122, 0, 0.559996570031513,
-  // f 86/86/86 88/88/88 97/97/97
-  0.718006788786282, 0.41470392104411, 0.559005285419961,
-  0.414621113044628, 0.718036563352733, 0.559028466454286,
-  0.272214122835049, 0.471424458135349, 0.838843520330781,
-  // f 97/97/97 95/95/95 86/86/86
-  0.272214122835049, 0.471424458135349, 0.838843520330781,
-  0.471384913567258, 0.272191288657208, 0.838873152294384,
-  0.718006788786282, 0.41470392104411, 0.559005285419961,
-  // f 88/88/88 13/13/13 27/27/27
-  0.414621113044628, 0.718036563352733, 0.559028466454286,
-  0, 0.828494925484122, 0.559996570031513,
-  0, 0.54301490867898, 0.839723054912963,
-  // f 27/27/27 97/97/97 88/88/88
-  0, 0.54301490867898, 0.839723054912963,
-  0.272214122835049, 0.471424458135349, 0.838843520330781,
-  0.414621113044628, 0.718036563352733, 0.559028466454286,
-  // f 141/143/134 142/144/135 143/145/136
-  0, -0.729973630178906, -0.683475309900387,
-  -0.365907532284079, -0.633113032765921, -0.682114041462067,
-  -0.37138614755504, -0.641976054739729, -0.670774980559829,
-  // f 143/145/136 144/146/137 141/143/134
-  -0.37138614755504, -0.641976054739729, -0.670774980559829,
-  0, -0.741855501132357, -0.670559777678068,
-  0, -0.729973630178906, -0.683475309900387,
-  // f 142/144/135 145/147/138 146/148/139
-  -0.365907532284079, -0.633113032765921, -0.682114041462067,
-  -0.633385362633402, -0.365491553587794, -0.682084237215415,
-  -0.642110906346367, -0.370906299897006, -0.67091139552683,
-  // f 146/148/139 143/145/136 142/144/135
-  -0.642110906346367, -0.370906299897006, -0.67091139552683,
-  -0.37138614755504, -0.641976054739729, -0.670774980559829,
-  -0.365907532284079, -0.633113032765921, -0.682114041462067,
-  // f 145/147/138 147/149/140 148/150/141
-  -0.633385362633402, -0.365491553587794, -0.682084237215415,
-  -0.731567153372204, 0, -0.681769389241619,
-  -0.741999940640007, 0, -0.670399946368006,
-  // f 148/150/141 146/148/139 145/147/138
-  -0.741999940640007, 0, -0.670399946368006,
-  -0.642110906346367, -0.370906299897006, -0.67091139552683,
-  -0.633385362633402, -0.365491553587794, -0.682084237215415,
-  // f 147/149/140 149/151/142 150/152/143
-  -0.731567153372204, 0, -0.681769389241619,
-  -0.633385362633402, 0.365491553587794, -0.682084237215415,
-  -0.642110906346367, 0.370906299897006, -0.67091139552683,
-  // f 150/152/143 148/150/141 147/149/140
-  -0.642110906346367, 0.370906299897006, -0.67091139552683,
-  -0.741999940640007, 0, -0.670399946368006,
-  -0.731567153372204, 0, -0.681769389241619,
-  // f 149/151/142 151/153/144 152/154/145
-  -0.633385362633402, 0.365491553587794, -0.682084237215415,
-  -0.366017311198109, 0.633029939859025, -0.68213226220828,
-  -0.371409989205991, 0.641917264597, -0.670818041893858,
-  // f 152/154/145 150/152/143 149/151/142
-  -0.371409989205991, 0.641917264597, -0.670818041893858,
-  -0.642110906346367, 0.370906299897006, -0.67091139552683,
-  -0.633385362633402, 0.365491553587794, -0.682084237215415,
-  // f 151/153/144 153/155/146 154/156/147
-  -0.366017311198109, 0.633029939859025, -0.68213226220828,
-  0, 0.729973630178906, -0.683475309900387,
-  0, 0.74181053378437, -0.670609522722834,
-  // f 154/156/147 152/154/145 151/153/144
-  0, 0.74181053378437, -0.670609522722834,
-  -0.371409989205991, 0.641917264597, -0.670818041893858,
-  -0.366017311198109, 0.633029939859025, -0.68213226220828,
-  // f 155/157/148 156/158/149 157/159/150
-  0, -0.303298589664837, -0.952895569045906,
-  -0.153096703863448, -0.263694322722347, -0.952379495490191,
-  -0.00379992879000171, -0.00479991005052847, -0.999981260526765,
-  // f 157/159/150 158/160/78 155/157/148
-  -0.00379992879000171, -0.00479991005052847, -0.999981260526765,
-  0, 0, -1,
-  0, -0.303298589664837, -0.952895569045906,
-  // f 156/158/149 159/161/151 160/162/152
-  -0.153096703863448, -0.263694322722347, -0.952379495490191,
-  -0.264098697996628, -0.152299249166552, -0.952395304702722,
-  -0.0055998817037485, -0.00329993028970894, -0.999978875669375,
-  // f 160/162/152 157/159/150 156/158/149
-  -0.0055998817037485, -0.00329993028970894, -0.999978875669375,
-  -0.00379992879000171, -0.00479991005052847, -0.999981260526765,
-  -0.153096703863448, -0.263694322722347, -0.952379495490191,
-  // f 159/161/151 161/163/153 162/164/154
-  -0.264098697996628, -0.152299249166552, -0.952395304702722,
-  -0.305588357305376, 0, -0.952163723253203,
-  -0.00649986269185094, 0, -0.999978875669375,
-  // f 162/164/154 160/162/152 159/161/151
-  -0.00649986269185094, 0, -0.999978875669375,
-  -0.0055998817037485, -0.00329993028970894, -0.999978875669375,
-  -0.264098697996628, -0.152299249166552, -0.952395304702722,
-  // f 161/163/153 163/165/155 164/166/156
-  -0.305588357305376, 0, -0.952163723253203,
-  -0.26409467458458, 0.152396926946952, -0.952380795434888,
-  -0.00569987637102225, 0.00329992842532867, -0.999978310705659,
-  // f 164/166/156 162/164/154 161/163/153
-  -0.00569987637102225, 0.00329992842532867, -0.999978310705659,
-  -0.00649986269185094, 0, -0.999978875669375,
-  -0.305588357305376, 0, -0.952163723253203,
-  // f 163/165/155 165/167/157 166/168/158
-  -0.26409467458458, 0.152396926946952, -0.952380795434888,
-  -0.15279319703435, 0.263588263993813, -0.952457592769752,
-  -0.00329993028970894, 0.0055998817037485, -0.999978875669375,
-  // f 166/168/158 164/166/156 163/165/155
-  -0.00329993028970894, 0.0055998817037485, -0.999978875669375,
-  -0.00569987637102225, 0.00329992842532867, -0.999978310705659,
-  -0.26409467458458, 0.152396926946952, -0.952380795434888,
-  // f 165/167/157 167/169/159 168/170/160
-  -0.15279319703435, 0.263588263993813, -0.952457592769752,
-  0, 0.302906450461545, -0.953020294783268,
-  0, 0.000899999635500221, -0.999999595000246,
-  // f 168/170/160 166/168/158 165/167/157
-  0, 0.000899999635500221, -0.999999595000246,
-  -0.00329993028970894, 0.0055998817037485, -0.999978875669375,
-  -0.15279319703435, 0.263588263993813, -0.952457592769752,
-  // f 134/171/161 142/144/135 141/143/134
-  -0.288509593103459, -0.497916556000735, -0.817827193206269,
-  -0.365907532284079, -0.633113032765921, -0.682114041462067,
-  0, -0.729973630178906, -0.683475309900387,
-  // f 141/143/134 135/172/162 134/171/161
-  0, -0.729973630178906, -0.683475309900387,
-  0, -0.572388048662315, -0.81998287893623,
-  -0.288509593103459, -0.497916556000735, -0.817827193206269,
-  // f 136/173/163 145/147/138 142/144/135
-  -0.498303453254897, -0.28790199516774, -0.817805667412913,
-  -0.633385362633402, -0.365491553587794, -0.682084237215415,
-  -0.365907532284079, -0.633113032765921, -0.682114041462067,
-  // f 142/144/135 134/171/161 136/173/163
-  -0.365907532284079, -0.633113032765921, -0.682114041462067,
-  -0.288509593103459, -0.497916556000735, -0.817827193206269,
-  -0.498303453254897, -0.28790199516774, -0.817805667412913,
-  // f 137/174/164 147/149/140 145/147/138
-  -0.575976313461153, 0, -0.817466382386272,
-  -0.731567153372204, 0, -0.681769389241619,
-  -0.633385362633402, -0.365491553587794, -0.682084237215415,
-  // f 145/147/138 136/173/163 137/174/164
-  -0.633385362633402, -0.365491553587794, -0.682084237215415,
-  -0.498303453254897, -0.28790199516774, -0.817805667412913,
-  -0.575976313461153, 0, -0.817466382386272,
-  // f 138/175/165 149/151/142 147/149/140
-  -0.498303453254897, 0.28790199516774, -0.817805667412913,
-  -0.633385362633402, 0.365491553587794, -0.682084237215415,
-  -0.731567153372204, 0, -0.681769389241619,
-  // f 147/149/140 137/174/164 138/175/165
-  -0.731567153372204, 0, -0.681769389241619,
-  -0.575976313461153, 0, -0.817466382386272,
-  -0.498303453254897, 0.28790199516774, -0.817805667412913,
-  // f 139/176/166 151/153/144 149/151/142
-  -0.288601268405362, 0.497902188284926, -0.817803594254695,
-  -0.366017311198109, 0.633029939859025, -0.68213226220828,
-  -0.633385362633402, 0.365491553587794, -0.682084237215415,
-  // f 149/151/142 138/175/165 139/176/166
-  -0.633385362633402, 0.365491553587794, -0.682084237215415,
-  -0.498303453254897, 0.28790199516774, -0.817805667412913,
-  -0.288601268405362, 0.497902188284926, -0.817803594254695,
-  // f 140/177/167 153/155/146 151/153/144
-  0, 0.572502215587862, -0.819903173031419,
-  0, 0.729973630178906, -0.683475309900387,
-  -0.366017311198109, 0.633029939859025, -0.68213226220828,
-  // f 151/153/144 139/176/166 140/177/167
-  -0.366017311198109, 0.633029939859025, -0.68213226220828,
-  -0.288601268405362, 0.497902188284926, -0.817803594254695,
-  0, 0.572502215587862, -0.819903173031419,
-  // f 143/145/136 156/158/149 155/157/148
-  -0.37138614755504, -0.641976054739729, -0.670774980559829,
-  -0.153096703863448, -0.263694322722347, -0.952379495490191,
-  0, -0.303298589664837, -0.952895569045906,
-  // f 155/157/148 144/146/137 143/145/136
-  0, -0.303298589664837, -0.952895569045906,
-  0, -0.741855501132357, -0.670559777678068,
-  -0.37138614755504, -0.641976054739729, -0.670774980559829,
-  // f 146/148/139 159/161/151 156/158/149
-  -0.642110906346367, -0.370906299897006, -0.67091139552683,
-  -0.264098697996628, -0.152299249166552, -0.952395304702722,
-  -0.153096703863448, -0.263694322722347, -0.952379495490191,
-  // f 156/158/149 143/145/136 146/148/139
-  -0.153096703863448, -0.263694322722347, -0.952379495490191,
-  -0.37138614755504, -0.641976054739729, -0.670774980559829,
-  -0.642110906346367, -0.370906299897006, -0.67091139552683,
-  // f 148/150/141 161/163/153 159/161/151
-  -0.741999940640007, 0, -0.670399946368006,
-  -0.305588357305376, 0, -0.952163723253203,
-  -0.264098697996628, -0.152299249166552, -0.952395304702722,
-  // f 159/161/151 146/148/139 148/150/141
-  -0.264098697996628, -0.152299249166552, -0.952395304702722,
-  -0.642110906346367, -0.370906299897006, -0.67091139552683,
-  -0.741999940640007, 0, -0.670399946368006,
-  // f 150/152/143 163/165/155 161/163/153
-  -0.642110906346367, 0.370906299897006, -0.67091139552683,
-  -0.26409467458458, 0.152396926946952, -0.952380795434888,
-  -0.305588357305376, 0, -0.952163723253203,
-  // f 161/163/153 148/150/141 150/152/143
-  -0.305588357305376, 0, -0.952163723253203,
-  -0.741999940640007, 0, -0.670399946368006,
-  -0.642110906346367, 0.370906299897006, -0.67091139552683,
-  // f 152/154/145 165/167/157 163/165/155
-  -0.371409989205991, 0.641917264597, -0.670818041893858,
-  -0.15279319703435, 0.263588263993813, -0.952457592769752,
-  -0.26409467458458, 0.152396926946952, -0.952380795434888,
-  // f 163/165/155 150/152/143 152/154/145
-  -0.26409467458458, 0.152396926946952, -0.952380795434888,
-  -0.642110906346367, 0.370906299897006, -0.67091139552683,
-  -0.371409989205991, 0.641917264597, -0.670818041893858,
-  // f 154/156/147 167/169/159 165/167/157
-  0, 0.74181053378437, -0.670609522722834,
-  0, 0.302906450461545, -0.953020294783268,
-  -0.15279319703435, 0.263588263993813, -0.952457592769752,
-  // f 165/167/157 152/154/145 154/156/147
-  -0.15279319703435, 0.263588263993813, -0.952457592769752,
-  -0.371409989205991, 0.641917264597, -0.670818041893858,
-  0, 0.74181053378437, -0.670609522722834,
-  // f 141/143/134 144/146/137 174/178/168
-  0, -0.729973630178906, -0.683475309900387,
-  0, -0.741855501132357, -0.670559777678068,
-  0.37138614755504, -0.641976054739729, -0.670774980559829,
-  // f 174/178/168 175/179/169 141/143/134
-  0.37138614755504, -0.641976054739729, -0.670774980559829,
-  0.365907532284079, -0.633113032765921, -0.682114041462067,
-  0, -0.729973630178906, -0.683475309900387,
-  // f 175/179/169 174/178/168 176/180/170
-  0.365907532284079, -0.633113032765921, -0.682114041462067,
-  0.37138614755504, -0.641976054739729, -0.670774980559829,
-  0.642110906346367, -0.370906299897006, -0.67091139552683,
-  // f 176/180/170 177/181/171 175/179/169
-  0.642110906346367, -0.370906299897006, -0.67091139552683,
-  0.633385362633402, -0.365491553587794, -0.682084237215415,
-  0.365907532284079, -0.633113032765921, -0.682114041462067,
-  // f 177/181/171 176/180/170 178/182/172
-  0.633385362633402, -0.365491553587794, -0.682084237215415,
-  0.642110906346367, -0.370906299897006, -0.67091139552683,
-  0.741999940640007, 0, -0.670399946368006,
-  // f 178/182/172 179/183/173 177/181/171
-  0.741999940640007, 0, -0.670399946368006,
-  0.731567153372204, 0, -0.681769389241619,
-  0.633385362633402, -0.365491553587794, -0.682084237215415,
-  // f 179/183/173 178/182/172 180/184/174
-  0.731567153372204, 0, -0.681769389241619,
-  0.741999940640007, 0, -0.670399946368006,
-  0.642110906346367, 0.370906299897006, -0.67091139552683,
-  // f 180/184/174 181/185/175 179/183/173
-  0.642110906346367, 0.370906299897006, -0.67091139552683,
-  0.633385362633402, 0.365491553587794, -0.682084237215415,
-  0.731567153372204, 0, -0.681769389241619,
-  // f 181/185/175 180/184/174 182/186/176
-  0.633385362633402, 0.365491553587794, -0.682084237215415,
-  0.642110906346367, 0.370906299897006, -0.67091139552683,
-  0.371409989205991, 0.641917264597, -0.670818041893858,
-  // f 182/186/176 183/187/177 181/185/175
-  0.371409989205991, 0.641917264597, -0.670818041893858,
-  0.366017311198109, 0.633029939859025, -0.68213226220828,
-  0.633385362633402, 0.365491553587794, -0.682084237215415,
-  // f 183/187/177 182/186/176 154/156/147
-  0.366017311198109, 0.633029939859025, -0.68213226220828,
-  0.371409989205991, 0.641917264597, -0.670818041893858,
-  0, 0.74181053378437, -0.670609522722834,
-  // f 154/156/147 153/155/146 183/187/177
-  0, 0.74181053378437, -0.670609522722834,
-  0, 0.729973630178906, -0.683475309900387,
-  0.366017311198109, 0.633029939859025, -0.68213226220828,
-  // f 155/157/148 158/160/78 184/188/178
-  0, -0.303298589664837, -0.952895569045906,
-  0, 0, -1,
-  0.00379992879000171, -0.00479991005052847, -0.999981260526765,
-  // f 184/188/178 185/189/179 155/157/148
-  0.00379992879000171, -0.00479991005052847, -0.999981260526765,
-  0.153096703863448, -0.263694322722347, -0.952379495490191,
-  0, -0.303298589664837, -0.952895569045906,
-  // f 185/189/179 184/188/178 186/190/180
-  0.153096703863448, -0.263694322722347, -0.952379495490191,
-  0.00379992879000171, -0.00479991005052847, -0.999981260526765,
-  0.0055998817037485, -0.00329993028970894, -0.999978875669375,
-  // f 186/190/180 187/191/181 185/189/179
-  0.0055998817037485, -0.00329993028970894, -0.999978875669375,
-  0.264098697996628, -0.152299249166552, -0.952395304702722,
-  0.153096703863448, -0.263694322722347, -0.952379495490191,
-  // f 187/191/181 186/190/180 188/192/182
-  0.264098697996628, -0.152299249166552, -0.952395304702722,
-  0.0055998817037485, -0.00329993028970894, -0.999978875669375,
-  0.00649986269185094, 0, -0.999978875669375,
-  // f 188/192/182 189/193/183 187/191/181
-  0.00649986269185094, 0, -0.999978875669375,
-  0.305588357305376, 0, -0.952163723253203,
-  0.264098697996628, -0.152299249166552, -0.952395304702722,
-  // f 189/193/183 188/192/182 190/194/184
-  0.305588357305376, 0, -0.952163723253203,
-  0.00649986269185094, 0, -0.999978875669375,
-  0.00569987637102225, 0.00329992842532867, -0.999978310705659,
-  // f 190/194/184 191/195/185 189/193/183
-  0.00569987637102225, 0.00329992842532867, -0.999978310705659,
-  0.264001647375419, 0.152400950984901, -0.952405943031627,
-  0.305588357305376, 0, -0.952163723253203,
-  // f 191/195/185 190/194/184 192/196/186
-  0.264001647375419, 0.152400950984901, -0.952405943031627,
-  0.00569987637102225, 0.00329992842532867, -0.999978310705659,
-  0.00329993028970894, 0.0055998817037485, -0.999978875669375,
-  // f 192/196/186 193/197/187 191/195/185
-  0.00329993028970894, 0.0055998817037485, -0.999978875669375,
-  0.152695533720957, 0.263592290038273, -0.952472140597325,
-  0.264001647375419, 0.152400950984901, -0.952405943031627,
-  // f 193/197/187 192/196/186 168/170/160
-  0.152695533720957, 0.263592290038273, -0.952472140597325,
-  0.00329993028970894, 0.0055998817037485, -0.999978875669375,
-  0, 0.000899999635500221, -0.999999595000246,
-  // f 168/170/160 167/169/159 193/197/187
-  0, 0.000899999635500221, -0.999999595000246,
-  0, 0.302906450461545, -0.953020294783268,
-  0.152695533720957, 0.263592290038273, -0.952472140597325,
-  // f 169/198/188 135/172/162 141/143/134
-  0.288509593103459, -0.497916556000735, -0.817827193206269,
-  0, -0.572388048662315, -0.81998287893623,
-  0, -0.729973630178906, -0.683475309900387,
-  // f 141/143/134 175/179/169 169/198/188
-  0, -0.729973630178906, -0.683475309900387,
-  0.365907532284079, -0.633113032765921, -0.682114041462067,
-  0.288509593103459, -0.497916556000735, -0.817827193206269,
-  // f 170/199/189 169/198/188 175/179/169
-  0.498228277748378, -0.287916341155677, -0.817846418190734,
-  0.288509593103459, -0.497916556000735, -0.817827193206269,
-  0.365907532284079, -0.633113032765921, -0.682114041462067,
-  // f 175/179/169 177/181/171 170/199/189
-  0.365907532284079, -0.633113032765921, -0.682114041462067,
-  0.633385362633402, -0.365491553587794, -0.682084237215415,
-  0.498228277748378, -0.287916341155677, -0.817846418190734,
-  // f 171/200/190 170/199/189 177/181/171
-  0.576023398545683, 0, -0.817433204811183,
-  0.498228277748378, -0.287916341155677, -0.817846418190734,
-  0.633385362633402, -0.365491553587794, -0.682084237215415,
-  // f 177/181/171 179/183/173 171/200/190
-  0.633385362633402, -0.365491553587794, -0.682084237215415,
-  0.731567153372204, 0, -0.681769389241619,
-  0.576023398545683, 0, -0.817433204811183,
-  // f 172/201/191 171/200/190 179/183/173
-  0.498303453254897, 0.28790199516774, -0.817805667412913,
-  0.576023398545683, 0, -0.817433204811183,
-  0.731567153372204, 0, -0.681769389241619,
-  // f 179/183/173 181/185/175 172/201/191
-  0.731567153372204, 0, -0.681769389241619,
-  0.633385362633402, 0.365491553587794, -0.682084237215415,
-  0.498303453254897, 0.28790199516774, -0.817805667412913,
-  // f 173/202/192 172/201/191 181/185/175
-  0.288601268405362, 0.497902188284926, -0.817803594254695,
-  0.498303453254897, 0.28790199516774, -0.817805667412913,
-  0.633385362633402, 0.365491553587794, -0.682084237215415,
-  // f 181/185/175 183/187/177 173/202/192
-  0.633385362633402, 0.365491553587794, -0.682084237215415,
-  0.366017311198109, 0.633029939859025, -0.68213226220828,
-  0.288601268405362, 0.497902188284926, -0.817803594254695,
-  // f 140/177/167 173/202/192 183/187/177
-  0, 0.572502215587862, -0.819903173031419,
-  0.288601268405362, 0.497902188284926, -0.817803594254695,
-  0.366017311198109, 0.633029939859025, -0.68213226220828,
-  // f 183/187/177 153/155/146 140/177/167
-  0.366017311198109, 0.633029939859025, -0.68213226220828,
-  0, 0.729973630178906, -0.683475309900387,
-  0, 0.572502215587862, -0.819903173031419,
-  // f 174/178/168 144/146/137 155/157/148
-  0.37138614755504, -0.641976054739729, -0.670774980559829,
-  0, -0.741855501132357, -0.670559777678068,
-  0, -0.303298589664837, -0.952895569045906,
-  // f 155/157/148 185/189/179 174/178/168
-  0, -0.303298589664837, -0.952895569045906,
-  0.153096703863448, -0.263694322722347, -0.952379495490191,
-  0.37138614755504, -0.641976054739729, -0.670774980559829,
-  // f 176/180/170 174/178/168 185/189/179
-  0.642110906346367, -0.370906299897006, -0.67091139552683,
-  0.37138614755504, -0.641976054739729, -0.670774980559829,
-  0.153096703863448, -0.263694322722347, -0.952379495490191,
-  // f 185/189/179 187/191/181 176/180/170
-  0.153096703863448, -0.263694322722347, -0.952379495490191,
-  0.264098697996628, -0.152299249166552, -0.952395304702722,
-  0.642110906346367, -0.370906299897006, -0.67091139552683,
-  // f 178/182/172 176/180/170 187/191/181
-  0.741999940640007, 0, -0.670399946368006,
-  0.642110906346367, -0.370906299897006, -0.67091139552683,
-  0.264098697996628, -0.152299249166552, -0.952395304702722,
-  // f 187/191/181 189/193/183 178/182/172
-  0.264098697996628, -0.152299249166552, -0.952395304702722,
-  0.305588357305376, 0, -0.952163723253203,
-  0.741999940640007, 0, -0.670399946368006,
-  // f 180/184/174 178/182/172 189/193/183
-  0.642110906346367, 0.370906299897006, -0.67091139552683,
-  0.741999940640007, 0, -0.670399946368006,
-  0.305588357305376, 0, -0.952163723253203,
-  // f 189/193/183 191/195/185 180/184/174
-  0.305588357305376, 0, -0.952163723253203,
-  0.264001647375419, 0.152400950984901, -0.952405943031627,
-  0.642110906346367, 0.370906299897006, -0.67091139552683,
-  // f 182/186/176 180/184/174 191/195/185
-  0.371409989205991, 0.641917264597, -0.670818041893858,
-  0.642110906346367, 0.370906299897006, -0.67091139552683,
-  0.264001647375419, 0.152400950984901, -0.952405943031627,
-  // f 191/195/185 193/197/187 182/186/176
-  0.264001647375419, 0.152400950984901, -0.952405943031627,
-  0.152695533720957, 0.263592290038273, -0.952472140597325,
-  0.371409989205991, 0.641917264597, -0.670818041893858,
-  // f 154/156/147 182/186/176 193/197/187
-  0, 0.74181053378437, -0.670609522722834,
-  0.371409989205991, 0.641917264597, -0.670818041893858,
-  0.152695533720957, 0.263592290038273, -0.952472140597325,
-  // f 193/197/187 167/169/159 154/156/147
-  0.152695533720957, 0.263592290038273, -0.952472140597325,
-  0, 0.302906450461545, -0.953020294783268,
-  0, 0.74181053378437, -0.670609522722834,
-};
-
-float psmovebulbTexCoords [] = {
-  // f 1/1/1 2/2/2 3/3/3
-  0.151800, 0.1707,
-  0.141800, 0.1653,
-  0.141100, 0.1673,
-  // f 3/3/3 4/4/4 1/1/1
-  0.141100, 0.1673,
-  0.151800, 0.1731,
-  0.151800, 0.1707,
-  // f 2/2/2 5/5/5 6/6/6
-  0.141800, 0.1653,
-  0.135000, 0.1511,
-  0.133900, 0.1522,
-  // f 6/6/6 3/3/3 2/2/2
-  0.133900, 0.1522,
-  0.141100, 0.1673,
-  0.141800, 0.1653,
-  // f 5/5/5 7/7/7 8/8/8
-  0.135000, 0.1511,
-  0.132600, 0.1324,
-  0.131400, 0.1324,
-  // f 8/8/8 6/6/6 5/5/5
-  0.131400, 0.1324,
-  0.133900, 0.1522,
-  0.135000, 0.1511,
-  // f 7/7/7 9/9/9 10/10/10
-  0.132600, 0.1324,
-  0.135000, 0.1136,
-  0.133900, 0.1125,
-  // f 10/10/10 8/8/8 7/7/7
-  0.133900, 0.1125,
-  0.131400, 0.1324,
-  0.132600, 0.1324,
-  // f 9/9/9 11/11/11 12/12/12
-  0.135000, 0.1136,
-  0.141800, 0.0994,
-  0.141100, 0.0974,
-  // f 12/12/12 10/10/10 9/9/9
-  0.141100, 0.0974,
-  0.133900, 0.1125,
-  0.135000, 0.1136,
-  // f 11/11/11 13/13/13 14/14/14
-  0.141800, 0.0994,
-  0.151800, 0.0941,
-  0.151800, 0.0917,
-  // f 14/14/14 12/12/12 11/11/11
-  0.151800, 0.0917,
-  0.141100, 0.0974,
-  0.141800, 0.0994,
-  // f 15/15/15 16/16/16 17/17/17
-  0.142000, 0.1647,
-  0.151800, 0.17,
-  0.151800, 0.1648,
-  // f 17/17/17 18/18/18 15/15/15
-  0.151800, 0.1648,
-  0.143400, 0.1603,
-  0.142000, 0.1647,
-  // f 19/19/19 15/15/15 18/18/18
-  0.135300, 0.1508,
-  0.142000, 0.1647,
-  0.143400, 0.1603,
-  // f 18/18/18 20/20/20 19/19/19
-  0.143400, 0.1603,
-  0.137600, 0.1483,
-  0.135300, 0.1508,
-  // f 21/21/21 19/19/19 20/20/20
-  0.133000, 0.1324,
-  0.135300, 0.1508,
-  0.137600, 0.1483,
-  // f 20/20/20 22/22/22 21/21/21
-  0.137600, 0.1483,
-  0.135600, 0.1324,
-  0.133000, 0.1324,
-  // f 23/23/23 21/21/21 22/22/22
-  0.135300, 0.1139,
-  0.133000, 0.1324,
-  0.135600, 0.1324,
-  // f 22/22/22 24/24/24 23/23/23
-  0.135600, 0.1324,
-  0.137600, 0.1164,
-  0.135300, 0.1139,
-  // f 25/25/25 23/23/23 24/24/24
-  0.142000, 0.1,
-  0.135300, 0.1139,
-  0.137600, 0.1164,
-  // f 24/24/24 26/26/26 25/25/25
-  0.137600, 0.1164,
-  0.143400, 0.1044,
-  0.142000, 0.1,
-  // f 27/27/27 25/25/25 26/26/26
-  0.151800, 0.0948,
-  0.142000, 0.1,
-  0.143400, 0.1044,
-  // f 26/26/26 28/28/28 27/27/27
-  0.143400, 0.1044,
-  0.151800, 0.0999,
-  0.151800, 0.0948,
-  // f 4/4/4 3/3/3 29/29/29
-  0.151800, 0.1731,
-  0.141100, 0.1673,
-  0.137000, 0.1786,
-  // f 29/29/29 30/30/30 4/4/4
-  0.137000, 0.1786,
-  0.151800, 0.1866,
-  0.151800, 0.1731,
-  // f 3/3/3 6/6/6 31/31/31
-  0.141100, 0.1673,
-  0.133900, 0.1522,
-  0.127700, 0.1583,
-  // f 31/31/31 29/29/29 3/3/3
-  0.127700, 0.1583,
-  0.137000, 0.1786,
-  0.141100, 0.1673,
-  // f 6/6/6 8/8/8 32/32/32
-  0.133900, 0.1522,
-  0.131400, 0.1324,
-  0.124700, 0.1324,
-  // f 32/32/32 31/31/31 6/6/6
-  0.124700, 0.1324,
-  0.127700, 0.1583,
-  0.133900, 0.1522,
-  // f 8/8/8 10/10/10 33/33/33
-  0.131400, 0.1324,
-  0.133900, 0.1125,
-  0.127700, 0.1064,
-  // f 33/33/33 32/32/32 8/8/8
-  0.127700, 0.1064,
-  0.124700, 0.1324,
-  0.131400, 0.1324,
-  // f 10/10/10 12/12/12 34/34/34
-  0.133900, 0.1125,
-  0.141100, 0.0974,
-  0.137000, 0.0861,
-  // f 34/34/34 33/33/33 10/10/10
-  0.137000, 0.0861,
-  0.127700, 0.1064,
-  0.133900, 0.1125,
-  // f 12/12/12 14/14/14 35/35/35
-  0.141100, 0.0974,
-  0.151800, 0.0917,
-  0.151800, 0.0782,
-  // f 35/35/35 34/34/34 12/12/12
-  0.151800, 0.0782,
-  0.137000, 0.0861,
-  0.141100, 0.0974,
-  // f 30/30/30 29/29/29 36/36/36
-  0.151800, 0.1866,
-  0.137000, 0.1786,
-  0.122500, 0.2067,
-  // f 36/36/36 37/37/37 30/30/30
-  0.122500, 0.2067,
-  0.151800, 0.2229,
-  0.151800, 0.1866,
-  // f 29/29/29 31/31/31 38/38/38
-  0.137000, 0.1786,
-  0.127700, 0.1583,
-  0.109800, 0.1722,
-  // f 38/38/38 36/36/36 29/29/29
-  0.109800, 0.1722,
-  0.122500, 0.2067,
-  0.137000, 0.1786,
-  // f 31/31/31 32/32/32 39/39/39
-  0.127700, 0.1583,
-  0.124700, 0.1324,
-  0.106500, 0.1324,
-  // f 39/39/39 38/38/38 31/31/31
-  0.106500, 0.1324,
-  0.109800, 0.1722,
-  0.127700, 0.1583,
-  // f 32/32/32 33/33/33 40/40/40
-  0.124700, 0.1324,
-  0.127700, 0.1064,
-  0.109800, 0.0926,
-  // f 40/40/40 39/39/39 32/32/32
-  0.109800, 0.0926,
-  0.106500, 0.1324,
-  0.124700, 0.1324,
-  // f 33/33/33 34/34/34 41/41/41
-  0.127700, 0.1064,
-  0.137000, 0.0861,
-  0.122500, 0.0580000000000001,
-  // f 41/41/41 40/40/40 33/33/33
-  0.122500, 0.0580000000000001,
-  0.109800, 0.0926,
-  0.127700, 0.1064,
-  // f 34/34/34 35/35/35 42/42/42
-  0.137000, 0.0861,
-  0.151800, 0.0782,
-  0.151800, 0.0419,
-  // f 42/42/42 41/41/41 34/34/34
-  0.151800, 0.0419,
-  0.122500, 0.0580000000000001,
-  0.137000, 0.0861,
-  // f 37/37/37 36/36/36 43/43/43
-  0.151800, 0.2229,
-  0.122500, 0.2067,
-  0.096100, 0.2279,
-  // f 43/43/43 44/44/44 37/37/37
-  0.096100, 0.2279,
-  0.151800, 0.2614,
-  0.151800, 0.2229,
-  // f 36/36/36 38/38/38 45/45/45
-  0.122500, 0.2067,
-  0.109800, 0.1722,
-  0.088700, 0.1806,
-  // f 45/45/45 43/43/43 36/36/36
-  0.088700, 0.1806,
-  0.096100, 0.2279,
-  0.122500, 0.2067,
-  // f 38/38/38 39/39/39 46/46/46
-  0.109800, 0.1722,
-  0.106500, 0.1324,
-  0.087300, 0.1324,
-  // f 46/46/46 45/45/45 38/38/38
-  0.087300, 0.1324,
-  0.088700, 0.1806,
-  0.109800, 0.1722,
-  // f 39/39/39 40/40/40 47/47/47
-  0.106500, 0.1324,
-  0.109800, 0.0926,
-  0.088700, 0.0841,
-  // f 47/47/47 46/46/46 39/39/39
-  0.088700, 0.0841,
-  0.087300, 0.1324,
-  0.106500, 0.1324,
-  // f 40/40/40 41/41/41 48/48/48
-  0.109800, 0.0926,
-  0.122500, 0.0580000000000001,
-  0.096100, 0.0369,
-  // f 48/48/48 47/47/47 40/40/40
-  0.096100, 0.0369,
-  0.088700, 0.0841,
-  0.109800, 0.0926,
-  // f 41/41/41 42/42/42 49/49/49
-  0.122500, 0.0580000000000001,
-  0.151800, 0.0419,
-  0.151800, 0.00329999999999997,
-  // f 49/49/49 48/48/48 41/41/41
-  0.151800, 0.00329999999999997,
-  0.096100, 0.0369,
-  0.122500, 0.0580000000000001,
-  // f 44/44/44 43/43/43 50/50/50
-  0.151800, 0.2614,
-  0.096100, 0.2279,
-  0.059600, 0.2279,
-  // f 50/50/50 51/51/51 44/44/44
-  0.059600, 0.2279,
-  0.003700, 0.2617,
-  0.151800, 0.2614,
-  // f 43/43/43 45/45/45 52/52/52
-  0.096100, 0.2279,
-  0.088700, 0.1806,
-  0.066900, 0.1806,
-  // f 52/52/52 50/50/50 43/43/43
-  0.066900, 0.1806,
-  0.059600, 0.2279,
-  0.096100, 0.2279,
-  // f 45/45/45 46/46/46 53/53/53
-  0.088700, 0.1806,
-  0.087300, 0.1324,
-  0.068400, 0.1324,
-  // f 53/53/53 52/52/52 45/45/45
-  0.068400, 0.1324,
-  0.066900, 0.1806,
-  0.088700, 0.1806,
-  // f 46/46/46 47/47/47 54/54/54
-  0.087300, 0.1324,
-  0.088700, 0.0841,
-  0.066900, 0.0841,
-  // f 54/54/54 53/53/53 46/46/46
-  0.066900, 0.0841,
-  0.068400, 0.1324,
-  0.087300, 0.1324,
-  // f 47/47/47 48/48/48 55/55/55
-  0.088700, 0.0841,
-  0.096100, 0.0369,
-  0.059600, 0.0368000000000001,
-  // f 55/55/55 54/54/54 47/47/47
-  0.059600, 0.0368000000000001,
-  0.066900, 0.0841,
-  0.088700, 0.0841,
-  // f 48/48/48 49/49/49 56/56/56
-  0.096100, 0.0369,
-  0.151800, 0.00329999999999997,
-  0.003700, 0.00309999999999999,
-  // f 56/56/56 55/55/55 48/48/48
-  0.003700, 0.00309999999999999,
-  0.059600, 0.0368000000000001,
-  0.096100, 0.0369,
-  // f 51/51/51 50/50/50 57/57/57
-  0.003700, 0.2617,
-  0.059600, 0.2279,
-  0.035200, 0.2097,
-  // f 57/57/57 58/58/58 51/51/51
-  0.035200, 0.2097,
-  0.003700, 0.2272,
-  0.003700, 0.2617,
-  // f 50/50/50 52/52/52 59/59/59
-  0.059600, 0.2279,
-  0.066900, 0.1806,
-  0.048000, 0.1735,
-  // f 59/59/59 57/57/57 50/50/50
-  0.048000, 0.1735,
-  0.035200, 0.2097,
-  0.059600, 0.2279,
-  // f 52/52/52 53/53/53 60/60/60
-  0.066900, 0.1806,
-  0.068400, 0.1324,
-  0.051100, 0.1324,
-  // f 60/60/60 59/59/59 52/52/52
-  0.051100, 0.1324,
-  0.048000, 0.1735,
-  0.066900, 0.1806,
-  // f 53/53/53 54/54/54 61/61/61
-  0.068400, 0.1324,
-  0.066900, 0.0841,
-  0.048000, 0.0913,
-  // f 61/61/61 60/60/60 53/53/53
-  0.048000, 0.0913,
-  0.051100, 0.1324,
-  0.068400, 0.1324,
-  // f 54/54/54 55/55/55 62/62/62
-  0.066900, 0.0841,
-  0.059600, 0.0368000000000001,
-  0.035200, 0.055,
-  // f 62/62/62 61/61/61 54/54/54
-  0.035200, 0.055,
-  0.048000, 0.0913,
-  0.066900, 0.0841,
-  // f 55/55/55 56/56/56 63/63/63
-  0.059600, 0.0368000000000001,
-  0.003700, 0.00309999999999999,
-  0.003700, 0.0375,
-  // f 63/63/63 62/62/62 55/55/55
-  0.003700, 0.0375,
-  0.035200, 0.055,
-  0.059600, 0.0368000000000001,
-  // f 58/58/58 57/57/57 64/64/64
-  0.003700, 0.2272,
-  0.035200, 0.2097,
-  0.020000, 0.1824,
-  // f 64/64/64 65/65/65 58/58/58
-  0.020000, 0.1824,
-  0.003700, 0.1913,
-  0.003700, 0.2272,
-  // f 57/57/57 59/59/59 66/66/66
-  0.035200, 0.2097,
-  0.048000, 0.1735,
-  0.030000, 0.1603,
-  // f 66/66/66 64/64/64 57/57/57
-  0.030000, 0.1603,
-  0.020000, 0.1824,
-  0.035200, 0.2097,
-  // f 59/59/59 60/60/60 67/67/67
-  0.048000, 0.1735,
-  0.051100, 0.1324,
-  0.033200, 0.1324,
-  // f 67/67/67 66/66/66 59/59/59
-  0.033200, 0.1324,
-  0.030000, 0.1603,
-  0.048000, 0.1735,
-  // f 60/60/60 61/61/61 68/68/68
-  0.051100, 0.1324,
-  0.048000, 0.0913,
-  0.030000, 0.1044,
-  // f 68/68/68 67/67/67 60/60/60
-  0.030000, 0.1044,
-  0.033200, 0.1324,
-  0.051100, 0.1324,
-  // f 61/61/61 62/62/62 69/69/69
-  0.048000, 0.0913,
-  0.035200, 0.055,
-  0.020000, 0.0823,
-  // f 69/69/69 68/68/68 61/61/61
-  0.020000, 0.0823,
-  0.030000, 0.1044,
-  0.048000, 0.0913,
-  // f 62/62/62 63/63/63 70/70/70
-  0.035200, 0.055,
-  0.003700, 0.0375,
-  0.003700, 0.0735,
-  // f 70/70/70 69/69/69 62/62/62
-  0.003700, 0.0735,
-  0.020000, 0.0823,
-  0.035200, 0.055,
-  // f 65/65/65 64/64/64 71/71/71
-  0.003700, 0.1913,
-  0.020000, 0.1824,
-  0.009900, 0.1533,
-  // f 71/71/71 72/72/72 65/65/65
-  0.009900, 0.1533,
-  0.003700, 0.1566,
-  0.003700, 0.1913,
-  // f 64/64/64 66/66/66 73/73/73
-  0.020000, 0.1824,
-  0.030000, 0.1603,
-  0.014300, 0.1444,
-  // f 73/73/73 71/71/71 64/64/64
-  0.014300, 0.1444,
-  0.009900, 0.1533,
-  0.020000, 0.1824,
-  // f 66/66/66 67/67/67 74/74/74
-  0.030000, 0.1603,
-  0.033200, 0.1324,
-  0.015800, 0.1324,
-  // f 74/74/74 73/73/73 66/66/66
-  0.015800, 0.1324,
-  0.014300, 0.1444,
-  0.030000, 0.1603,
-  // f 67/67/67 68/68/68 75/75/75
-  0.033200, 0.1324,
-  0.030000, 0.1044,
-  0.014300, 0.1203,
-  // f 75/75/75 74/74/74 67/67/67
-  0.014300, 0.1203,
-  0.015800, 0.1324,
-  0.033200, 0.1324,
-  // f 68/68/68 69/69/69 76/76/76
-  0.030000, 0.1044,
-  0.020000, 0.0823,
-  0.009900, 0.1114,
-  // f 76/76/76 75/75/75 68/68/68
-  0.009900, 0.1114,
-  0.014300, 0.1203,
-  0.030000, 0.1044,
-  // f 69/69/69 70/70/70 77/77/77
-  0.020000, 0.0823,
-  0.003700, 0.0735,
-  0.003700, 0.1081,
-  // f 77/77/77 76/76/76 69/69/69
-  0.003700, 0.1081,
-  0.009900, 0.1114,
-  0.020000, 0.0823,
-  // f 72/72/72 71/71/71 78/78/78
-  0.003700, 0.1566,
-  0.009900, 0.1533,
-  0.003700, 0.1324,
-  // f 71/71/71 73/73/73 78/78/78
-  0.009900, 0.1533,
-  0.014300, 0.1444,
-  0.003700, 0.1324,
-  // f 73/73/73 74/74/74 78/78/78
-  0.014300, 0.1444,
-  0.015800, 0.1324,
-  0.003700, 0.1324,
-  // f 74/74/74 75/75/75 78/78/78
-  0.015800, 0.1324,
-  0.014300, 0.1203,
-  0.003700, 0.1324,
-  // f 75/75/75 76/76/76 78/78/78
-  0.014300, 0.1203,
-  0.009900, 0.1114,
-  0.003700, 0.1324,
-  // f 76/76/76 77/77/77 78/78/78
-  0.009900, 0.1114,
-  0.003700, 0.1081,
-  0.003700, 0.1324,
-  // f 1/1/1 16/16/16 15/15/15
-  0.151800, 0.1707,
-  0.151800, 0.17,
-  0.142000, 0.1647,
-  // f 15/15/15 2/2/2 1/1/1
-  0.142000, 0.1647,
-  0.141800, 0.1653,
-  0.151800, 0.1707,
-  // f 2/2/2 15/15/15 19/19/19
-  0.141800, 0.1653,
-  0.142000, 0.1647,
-  0.135300, 0.1508,
-  // f 19/19/19 5/5/5 2/2/2
-  0.135300, 0.1508,
-  0.135000, 0.1511,
-  0.141800, 0.1653,
-  // f 5/5/5 19/19/19 21/21/21
-  0.135000, 0.1511,
-  0.135300, 0.1508,
-  0.133000, 0.1324,
-  // f 21/21/21 7/7/7 5/5/5
-  0.133000, 0.1324,
-  0.132600, 0.1324,
-  0.135000, 0.1511,
-  // f 7/7/7 21/21/21 23/23/23
-  0.132600, 0.1324,
-  0.133000, 0.1324,
-  0.135300, 0.1139,
-  // f 23/23/23 9/9/9 7/7/7
-  0.135300, 0.1139,
-  0.135000, 0.1136,
-  0.132600, 0.1324,
-  // f 9/9/9 23/23/23 25/25/25
-  0.135000, 0.1136,
-  0.135300, 0.1139,
-  0.142000, 0.1,
-  // f 25/25/25 11/11/11 9/9/9
-  0.142000, 0.1,
-  0.141800, 0.0994,
-  0.135000, 0.1136,
-  // f 11/11/11 25/25/25 27/27/27
-  0.141800, 0.0994,
-  0.142000, 0.1,
-  0.151800, 0.0948,
-  // f 27/27/27 13/13/13 11/11/11
-  0.151800, 0.0948,
-  0.151800, 0.0941,
-  0.141800, 0.0994,
-  // f 1/1/1 4/4/4 79/79/79
-  0.151800, 0.1707,
-  0.151800, 0.1731,
-  0.162500, 0.1673,
-  // f 79/79/79 80/80/80 1/1/1
-  0.162500, 0.1673,
-  0.161800, 0.1653,
-  0.151800, 0.1707,
-  // f 80/80/80 79/79/79 81/81/81
-  0.161800, 0.1653,
-  0.162500, 0.1673,
-  0.169700, 0.1522,
-  // f 81/81/81 82/82/82 80/80/80
-  0.169700, 0.1522,
-  0.168600, 0.1511,
-  0.161800, 0.1653,
-  // f 82/82/82 81/81/81 83/83/83
-  0.168600, 0.1511,
-  0.169700, 0.1522,
-  0.172100, 0.1324,
-  // f 83/83/83 84/84/84 82/82/82
-  0.172100, 0.1324,
-  0.170900, 0.1324,
-  0.168600, 0.1511,
-  // f 84/84/84 83/83/83 85/85/85
-  0.170900, 0.1324,
-  0.172100, 0.1324,
-  0.169700, 0.1125,
-  // f 85/85/85 86/86/86 84/84/84
-  0.169700, 0.1125,
-  0.168600, 0.1136,
-  0.170900, 0.1324,
-  // f 86/86/86 85/85/85 87/87/87
-  0.168600, 0.1136,
-  0.169700, 0.1125,
-  0.162500, 0.0974,
-  // f 87/87/87 88/88/88 86/86/86
-  0.162500, 0.0974,
-  0.161800, 0.0994,
-  0.168600, 0.1136,
-  // f 88/88/88 87/87/87 14/14/14
-  0.161800, 0.0994,
-  0.162500, 0.0974,
-  0.151800, 0.0917,
-  // f 14/14/14 13/13/13 88/88/88
-  0.151800, 0.0917,
-  0.151800, 0.0941,
-  0.161800, 0.0994,
-  // f 89/89/89 90/90/90 17/17/17
-  0.161600, 0.1647,
-  0.160100, 0.1603,
-  0.151800, 0.1648,
-  // f 17/17/17 16/16/16 89/89/89
-  0.151800, 0.1648,
-  0.151800, 0.17,
-  0.161600, 0.1647,
-  // f 91/91/91 92/92/92 90/90/90
-  0.168300, 0.1508,
-  0.166000, 0.1483,
-  0.160100, 0.1603,
-  // f 90/90/90 89/89/89 91/91/91
-  0.160100, 0.1603,
-  0.161600, 0.1647,
-  0.168300, 0.1508,
-  // f 93/93/93 94/94/94 92/92/92
-  0.170600, 0.1324,
-  0.168000, 0.1324,
-  0.166000, 0.1483,
-  // f 92/92/92 91/91/91 93/93/93
-  0.166000, 0.1483,
-  0.168300, 0.1508,
-  0.170600, 0.1324,
-  // f 95/95/95 96/96/96 94/94/94
-  0.168300, 0.1139,
-  0.166000, 0.1164,
-  0.168000, 0.1324,
-  // f 94/94/94 93/93/93 95/95/95
-  0.168000, 0.1324,
-  0.170600, 0.1324,
-  0.168300, 0.1139,
-  // f 97/97/97 98/98/98 96/96/96
-  0.161600, 0.1,
-  0.160100, 0.1044,
-  0.166000, 0.1164,
-  // f 96/96/96 95/95/95 97/97/97
-  0.166000, 0.1164,
-  0.168300, 0.1139,
-  0.161600, 0.1,
-  // f 27/27/27 28/28/28 98/98/98
-  0.151800, 0.0948,
-  0.151800, 0.0999,
-  0.160100, 0.1044,
-  // f 98/98/98 97/97/97 27/27/27
-  0.160100, 0.1044,
-  0.161600, 0.1,
-  0.151800, 0.0948,
-  // f 4/4/4 30/30/30 99/99/99
-  0.151800, 0.1731,
-  0.151800, 0.1866,
-  0.166600, 0.1786,
-  // f 99/99/99 79/79/79 4/4/4
-  0.166600, 0.1786,
-  0.162500, 0.1673,
-  0.151800, 0.1731,
-  // f 79/79/79 99/99/99 100/100/100
-  0.162500, 0.1673,
-  0.166600, 0.1786,
-  0.175900, 0.1583,
-  // f 100/100/100 81/81/81 79/79/79
-  0.175900, 0.1583,
-  0.169700, 0.1522,
-  0.162500, 0.1673,
-  // f 81/81/81 100/100/100 101/101/101
-  0.169700, 0.1522,
-  0.175900, 0.1583,
-  0.178900, 0.1324,
-  // f 101/101/101 83/83/83 81/81/81
-  0.178900, 0.1324,
-  0.172100, 0.1324,
-  0.169700, 0.1522,
-  // f 83/83/83 101/101/101 102/102/102
-  0.172100, 0.1324,
-  0.178900, 0.1324,
-  0.175900, 0.1064,
-  // f 102/102/102 85/85/85 83/83/83
-  0.175900, 0.1064,
-  0.169700, 0.1125,
-  0.172100, 0.1324,
-  // f 85/85/85 102/102/102 103/103/103
-  0.169700, 0.1125,
-  0.175900, 0.1064,
-  0.166600, 0.0861,
-  // f 103/103/103 87/87/87 85/85/85
-  0.166600, 0.0861,
-  0.162500, 0.0974,
-  0.169700, 0.1125,
-  // f 87/87/87 103/103/103 35/35/35
-  0.162500, 0.0974,
-  0.166600, 0.0861,
-  0.151800, 0.0782,
-  // f 35/35/35 14/14/14 87/87/87
-  0.151800, 0.0782,
-  0.151800, 0.0917,
-  0.162500, 0.0974,
-  // f 30/30/30 37/37/37 104/104/104
-  0.151800, 0.1866,
-  0.151800, 0.2229,
-  0.181000, 0.2067,
-  // f 104/104/104 99/99/99 30/30/30
-  0.181000, 0.2067,
-  0.166600, 0.1786,
-  0.151800, 0.1866,
-  // f 99/99/99 104/104/104 105/105/105
-  0.166600, 0.1786,
-  0.181000, 0.2067,
-  0.193800, 0.1722,
-  // f 105/105/105 100/100/100 99/99/99
-  0.193800, 0.1722,
-  0.175900, 0.1583,
-  0.166600, 0.1786,
-  // f 100/100/100 105/105/105 106/106/106
-  0.175900, 0.1583,
-  0.193800, 0.1722,
-  0.197000, 0.1324,
-  // f 106/106/106 101/101/101 100/100/100
-  0.197000, 0.1324,
-  0.178900, 0.1324,
-  0.175900, 0.1583,
-  // f 101/101/101 106/106/106 107/107/107
-  0.178900, 0.1324,
-  0.197000, 0.1324,
-  0.193800, 0.0926,
-  // f 107/107/107 102/102/102 101/101/101
-  0.193800, 0.0926,
-  0.175900, 0.1064,
-  0.178900, 0.1324,
-  // f 102/102/102 107/107/107 108/108/108
-  0.175900, 0.1064,
-  0.193800, 0.0926,
-  0.181000, 0.0580000000000001,
-  // f 108/108/108 103/103/103 102/102/102
-  0.181000, 0.0580000000000001,
-  0.166600, 0.0861,
-  0.175900, 0.1064,
-  // f 103/103/103 108/108/108 42/42/42
-  0.166600, 0.0861,
-  0.181000, 0.0580000000000001,
-  0.151800, 0.0419,
-  // f 42/42/42 35/35/35 103/103/103
-  0.151800, 0.0419,
-  0.151800, 0.0782,
-  0.166600, 0.0861,
-  // f 37/37/37 44/44/44 109/109/109
-  0.151800, 0.2229,
-  0.151800, 0.2614,
-  0.207500, 0.2279,
-  // f 109/109/109 104/104/104 37/37/37
-  0.207500, 0.2279,
-  0.181000, 0.2067,
-  0.151800, 0.2229,
-  // f 104/104/104 109/109/109 110/110/110
-  0.181000, 0.2067,
-  0.207500, 0.2279,
-  0.214900, 0.1806,
-  // f 110/110/110 105/105/105 104/104/104
-  0.214900, 0.1806,
-  0.193800, 0.1722,
-  0.181000, 0.2067,
-  // f 105/105/105 110/110/110 111/111/111
-  0.193800, 0.1722,
-  0.214900, 0.1806,
-  0.216300, 0.1324,
-  // f 111/111/111 106/106/106 105/105/105
-  0.216300, 0.1324,
-  0.197000, 0.1324,
-  0.193800, 0.1722,
-  // f 106/106/106 111/111/111 112/112/112
-  0.197000, 0.1324,
-  0.216300, 0.1324,
-  0.214900, 0.0841,
-  // f 112/112/112 107/107/107 106/106/106
-  0.214900, 0.0841,
-  0.193800, 0.0926,
-  0.197000, 0.1324,
-  // f 107/107/107 112/112/112 113/113/113
-  0.193800, 0.0926,
-  0.214900, 0.0841,
-  0.207500, 0.0369,
-  // f 113/113/113 108/108/108 107/107/107
-  0.207500, 0.0369,
-  0.181000, 0.0580000000000001,
-  0.193800, 0.0926,
-  // f 108/108/108 113/113/113 49/49/49
-  0.181000, 0.0580000000000001,
-  0.207500, 0.0369,
-  0.151800, 0.00329999999999997,
-  // f 49/49/49 42/42/42 108/108/108
-  0.151800, 0.00329999999999997,
-  0.151800, 0.0419,
-  0.181000, 0.0580000000000001,
-  // f 44/44/44 51/114/51 114/115/114
-  0.151800, 0.2614,
-  0.299900, 0.2617,
-  0.243900, 0.2279,
-  // f 114/115/114 109/109/109 44/44/44
-  0.243900, 0.2279,
-  0.207500, 0.2279,
-  0.151800, 0.2614,
-  // f 109/109/109 114/115/114 115/116/115
-  0.207500, 0.2279,
-  0.243900, 0.2279,
-  0.236600, 0.1806,
-  // f 115/116/115 110/110/110 109/109/109
-  0.236600, 0.1806,
-  0.214900, 0.1806,
-  0.207500, 0.2279,
-  // f 110/110/110 115/116/115 116/117/116
-  0.214900, 0.1806,
-  0.236600, 0.1806,
-  0.235200, 0.1324,
-  // f 116/117/116 111/111/111 110/110/110
-  0.235200, 0.1324,
-  0.216300, 0.1324,
-  0.214900, 0.1806,
-  // f 111/111/111 116/117/116 117/118/117
-  0.216300, 0.1324,
-  0.235200, 0.1324,
-  0.236600, 0.0841,
-  // f 117/118/117 112/112/112 111/111/111
-  0.236600, 0.0841,
-  0.214900, 0.0841,
-  0.216300, 0.1324,
-  // f 112/112/112 117/118/117 118/119/118
-  0.214900, 0.0841,
-  0.236600, 0.0841,
-  0.243900, 0.0368000000000001,
-  // f 118/119/118 113/113/113 112/112/112
-  0.243900, 0.0368000000000001,
-  0.207500, 0.0369,
-  0.214900, 0.0841,
-  // f 113/113/113 118/119/118 56/120/56
-  0.207500, 0.0369,
-  0.243900, 0.0368000000000001,
-  0.299900, 0.00309999999999999,
-  // f 56/120/56 49/49/49 113/113/113
-  0.299900, 0.00309999999999999,
-  0.151800, 0.00329999999999997,
-  0.207500, 0.0369,
-  // f 51/114/51 58/121/58 119/122/119
-  0.299900, 0.2617,
-  0.299900, 0.2272,
-  0.268400, 0.2097,
-  // f 119/122/119 114/115/114 51/114/51
-  0.268400, 0.2097,
-  0.243900, 0.2279,
-  0.299900, 0.2617,
-  // f 114/115/114 119/122/119 120/123/120
-  0.243900, 0.2279,
-  0.268400, 0.2097,
-  0.255600, 0.1735,
-  // f 120/123/120 115/116/115 114/115/114
-  0.255600, 0.1735,
-  0.236600, 0.1806,
-  0.243900, 0.2279,
-  // f 115/116/115 120/123/120 121/124/121
-  0.236600, 0.1806,
-  0.255600, 0.1735,
-  0.252400, 0.1324,
-  // f 121/124/121 116/117/116 115/116/115
-  0.252400, 0.1324,
-  0.235200, 0.1324,
-  0.236600, 0.1806,
-  // f 116/117/116 121/124/121 122/125/122
-  0.235200, 0.1324,
-  0.252400, 0.1324,
-  0.255600, 0.0913,
-  // f 122/125/122 117/118/117 116/117/116
-  0.255600, 0.0913,
-  0.236600, 0.0841,
-  0.235200, 0.1324,
-  // f 117/118/117 122/125/122 123/126/123
-  0.236600, 0.0841,
-  0.255600, 0.0913,
-  0.268400, 0.055,
-  // f 123/126/123 118/119/118 117/118/117
-  0.268400, 0.055,
-  0.243900, 0.0368000000000001,
-  0.236600, 0.0841,
-  // f 118/119/118 123/126/123 63/127/63
-  0.243900, 0.0368000000000001,
-  0.268400, 0.055,
-  0.299900, 0.0375,
-  // f 63/127/63 56/120/56 118/119/118
-  0.299900, 0.0375,
-  0.299900, 0.00309999999999999,
-  0.243900, 0.0368000000000001,
-  // f 58/121/58 65/128/65 124/129/124
-  0.299900, 0.2272,
-  0.299900, 0.1913,
-  0.283600, 0.1824,
-  // f 124/129/124 119/122/119 58/121/58
-  0.283600, 0.1824,
-  0.268400, 0.2097,
-  0.299900, 0.2272,
-  // f 119/122/119 124/129/124 125/130/125
-  0.268400, 0.2097,
-  0.283600, 0.1824,
-  0.273600, 0.1603,
-  // f 125/130/125 120/123/120 119/122/119
-  0.273600, 0.1603,
-  0.255600, 0.1735,
-  0.268400, 0.2097,
-  // f 120/123/120 125/130/125 126/131/126
-  0.255600, 0.1735,
-  0.273600, 0.1603,
-  0.270400, 0.1324,
-  // f 126/131/126 121/124/121 120/123/120
-  0.270400, 0.1324,
-  0.252400, 0.1324,
-  0.255600, 0.1735,
-  // f 121/124/121 126/131/126 127/132/127
-  0.252400, 0.1324,
-  0.270400, 0.1324,
-  0.273600, 0.1044,
-  // f 127/132/127 122/125/122 121/124/121
-  0.273600, 0.1044,
-  0.255600, 0.0913,
-  0.252400, 0.1324,
-  // f 122/125/122 127/132/127 128/133/128
-  0.255600, 0.0913,
-  0.273600, 0.1044,
-  0.283600, 0.0823,
-  // f 128/133/128 123/126/123 122/125/122
-  0.283600, 0.0823,
-  0.268400, 0.055,
-  0.255600, 0.0913,
-  // f 123/126/123 128/133/128 70/134/70
-  0.268400, 0.055,
-  0.283600, 0.0823,
-  0.299900, 0.0735,
-  // f 70/134/70 63/127/63 123/126/123
-  0.299900, 0.0735,
-  0.299900, 0.0375,
-  0.268400, 0.055,
-  // f 65/128/65 72/135/72 129/136/129
-  0.299900, 0.1913,
-  0.299900, 0.1566,
-  0.293700, 0.1533,
-  // f 129/136/129 124/129/124 65/128/65
-  0.293700, 0.1533,
-  0.283600, 0.1824,
-  0.299900, 0.1913,
-  // f 124/129/124 129/136/129 130/137/130
-  0.283600, 0.1824,
-  0.293700, 0.1533,
-  0.289300, 0.1444,
-  // f 130/137/130 125/130/125 124/129/124
-  0.289300, 0.1444,
-  0.273600, 0.1603,
-  0.283600, 0.1824,
-  // f 125/130/125 130/137/130 131/138/131
-  0.273600, 0.1603,
-  0.289300, 0.1444,
-  0.287700, 0.1324,
-  // f 131/138/131 126/131/126 125/130/125
-  0.287700, 0.1324,
-  0.270400, 0.1324,
-  0.273600, 0.1603,
-  // f 126/131/126 131/138/131 132/139/132
-  0.270400, 0.1324,
-  0.287700, 0.1324,
-  0.289300, 0.1203,
-  // f 132/139/132 127/132/127 126/131/126
-  0.289300, 0.1203,
-  0.273600, 0.1044,
-  0.270400, 0.1324,
-  // f 127/132/127 132/139/132 133/140/133
-  0.273600, 0.1044,
-  0.289300, 0.1203,
-  0.293700, 0.1114,
-  // f 133/140/133 128/133/128 127/132/127
-  0.293700, 0.1114,
-  0.283600, 0.0823,
-  0.273600, 0.1044,
-  // f 128/133/128 133/140/133 77/141/77
-  0.283600, 0.0823,
-  0.293700, 0.1114,
-  0.299900, 0.1081,
-  // f 77/141/77 70/134/70 128/133/128
-  0.299900, 0.1081,
-  0.299900, 0.0735,
-  0.283600, 0.0823,
-  // f 72/135/72 78/142/78 129/136/129
-  0.299900, 0.1566,
-  0.299900, 0.1324,
-  0.293700, 0.1533,
-  // f 129/136/129 78/142/78 130/137/130
-  0.293700, 0.1533,
-  0.299900, 0.1324,
-  0.289300, 0.1444,
-  // f 130/137/130 78/142/78 131/138/131
-  0.289300, 0.1444,
-  0.299900, 0.1324,
-  0.287700, 0.1324,
-  // f 131/138/131 78/142/78 132/139/132
-  0.287700, 0.1324,
-  0.299900, 0.1324,
-  0.289300, 0.1203,
-  // f 132/139/132 78/142/78 133/140/133
-  0.289300, 0.1203,
-  0.299900, 0.1324,
-  0.293700, 0.1114,
-  // f 133/140/133 78/142/78 77/141/77
-  0.293700, 0.1114,
-  0.299900, 0.1324,
-  0.299900, 0.1081,
-  // f 1/1/1 80/80/80 89/89/89
-  0.151800, 0.1707,
-  0.161800, 0.1653,
-  0.161600, 0.1647,
-  // f 89/89/89 16/16/16 1/1/1
-  0.161600, 0.1647,
-  0.151800, 0.17,
-  0.151800, 0.1707,
-  // f 80/80/80 82/82/82 91/91/91
-  0.161800, 0.1653,
-  0.168600, 0.1511,
-  0.168300, 0.1508,
-  // f 91/91/91 89/89/89 80/80/80
-  0.168300, 0.1508,
-  0.161600, 0.1647,
-  0.161800, 0.1653,
-  // f 82/82/82 84/84/84 93/93/93
-  0.168600, 0.1511,
-  0.170900, 0.1324,
-  0.170600, 0.1324,
-  // f 93/93/93 91/91/91 82/82/82
-  0.170600, 0.1324,
-  0.168300, 0.1508,
-  0.168600, 0.1511,
-  // f 84/84/84 86/86/86 95/95/95
-  0.170900, 0.1324,
-  0.168600, 0.1136,
-  0.168300, 0.1139,
-  // f 95/95/95 93/93/93 84/84/84
-  0.168300, 0.1139,
-  0.170600, 0.1324,
-  0.170900, 0.1324,
-  // f 86/86/86 88/88/88 97/97/97
-  0.168600, 0.1136,
-  0.161800, 0.0994,
-  0.161600, 0.1,
-  // f 97/97/97 95/95/95 86/86/86
-  0.161600, 0.1,
-  0.168300, 0.1139,
-  0.168600, 0.1136,
-  // f 88/88/88 13/13/13 27/27/27
-  0.161800, 0.0994,
-  0.151800, 0.0941,
-  0.151800, 0.0948,
-  // f 27/27/27 97/97/97 88/88/88
-  0.151800, 0.0948,
-  0.161600, 0.1,
-  0.161800, 0.0994,
-  // f 141/143/134 142/144/135 143/145/136
-  0.438700, 0.1935,
-  0.408200, 0.1853,
-  0.409300, 0.1833,
-  // f 143/145/136 144/146/137 141/143/134
-  0.409300, 0.1833,
-  0.438700, 0.1912,
-  0.438700, 0.1935,
-  // f 142/144/135 145/147/138 146/148/139
-  0.408200, 0.1853,
-  0.385900, 0.1629,
-  0.387800, 0.1618,
-  // f 146/148/139 143/145/136 142/144/135
-  0.387800, 0.1618,
-  0.409300, 0.1833,
-  0.408200, 0.1853,
-  // f 145/147/138 147/149/140 148/150/141
-  0.385900, 0.1629,
-  0.377700, 0.1324,
-  0.379900, 0.1324,
-  // f 148/150/141 146/148/139 145/147/138
-  0.379900, 0.1324,
-  0.387800, 0.1618,
-  0.385900, 0.1629,
-  // f 147/149/140 149/151/142 150/152/143
-  0.377700, 0.1324,
-  0.385900, 0.1019,
-  0.387800, 0.103,
-  // f 150/152/143 148/150/141 147/149/140
-  0.387800, 0.103,
-  0.379900, 0.1324,
-  0.377700, 0.1324,
-  // f 149/151/142 151/153/144 152/154/145
-  0.385900, 0.1019,
-  0.408200, 0.0795,
-  0.409300, 0.0815,
-  // f 152/154/145 150/152/143 149/151/142
-  0.409300, 0.0815,
-  0.387800, 0.103,
-  0.385900, 0.1019,
-  // f 151/153/144 153/155/146 154/156/147
-  0.408200, 0.0795,
-  0.438700, 0.0713,
-  0.438700, 0.0736,
-  // f 154/156/147 152/154/145 151/153/144
-  0.438700, 0.0736,
-  0.409300, 0.0815,
-  0.408200, 0.0795,
-  // f 155/157/148 156/158/149 157/159/150
-  0.438700, 0.1903,
-  0.409800, 0.1825,
-  0.413600, 0.1759,
-  // f 157/159/150 158/160/78 155/157/148
-  0.413600, 0.1759,
-  0.438700, 0.1827,
-  0.438700, 0.1903,
-  // f 156/158/149 159/161/151 160/162/152
-  0.409800, 0.1825,
-  0.388600, 0.1613,
-  0.395200, 0.1575,
-  // f 160/162/152 157/159/150 156/158/149
-  0.395200, 0.1575,
-  0.413600, 0.1759,
-  0.409800, 0.1825,
-  // f 159/161/151 161/163/153 162/164/154
-  0.388600, 0.1613,
-  0.380900, 0.1324,
-  0.388500, 0.1324,
-  // f 162/164/154 160/162/152 159/161/151
-  0.388500, 0.1324,
-  0.395200, 0.1575,
-  0.388600, 0.1613,
-  // f 161/163/153 163/165/155 164/166/156
-  0.380900, 0.1324,
-  0.388600, 0.1035,
-  0.395200, 0.1073,
-  // f 164/166/156 162/164/154 161/163/153
-  0.395200, 0.1073,
-  0.388500, 0.1324,
-  0.380900, 0.1324,
-  // f 163/165/155 165/167/157 166/168/158
-  0.388600, 0.1035,
-  0.409800, 0.0823,
-  0.413600, 0.0889,
-  // f 166/168/158 164/166/156 163/165/155
-  0.413600, 0.0889,
-  0.395200, 0.1073,
-  0.388600, 0.1035,
-  // f 165/167/157 167/169/159 168/170/160
-  0.409800, 0.0823,
-  0.438700, 0.0745,
-  0.438700, 0.0821,
-  // f 168/170/160 166/168/158 165/167/157
-  0.438700, 0.0821,
-  0.413600, 0.0889,
-  0.409800, 0.0823,
-  // f 134/171/161 142/144/135 141/143/134
-  0.407700, 0.1861,
-  0.408200, 0.1853,
-  0.438700, 0.1935,
-  // f 141/143/134 135/172/162 134/171/161
-  0.438700, 0.1935,
-  0.438700, 0.1944,
-  0.407700, 0.1861,
-  // f 136/173/163 145/147/138 142/144/135
-  0.385000, 0.1634,
-  0.385900, 0.1629,
-  0.408200, 0.1853,
-  // f 142/144/135 134/171/161 136/173/163
-  0.408200, 0.1853,
-  0.407700, 0.1861,
-  0.385000, 0.1634,
-  // f 137/174/164 147/149/140 145/147/138
-  0.376700, 0.1324,
-  0.377700, 0.1324,
-  0.385900, 0.1629,
-  // f 145/147/138 136/173/163 137/174/164
-  0.385900, 0.1629,
-  0.385000, 0.1634,
-  0.376700, 0.1324,
-  // f 138/175/165 149/151/142 147/149/140
-  0.385000, 0.1014,
-  0.385900, 0.1019,
-  0.377700, 0.1324,
-  // f 147/149/140 137/174/164 138/175/165
-  0.377700, 0.1324,
-  0.376700, 0.1324,
-  0.385000, 0.1014,
-  // f 139/176/166 151/153/144 149/151/142
-  0.407700, 0.0787,
-  0.408200, 0.0795,
-  0.385900, 0.1019,
-  // f 149/151/142 138/175/165 139/176/166
-  0.385900, 0.1019,
-  0.385000, 0.1014,
-  0.407700, 0.0787,
-  // f 140/177/167 153/155/146 151/153/144
-  0.438700, 0.0704,
-  0.438700, 0.0713,
-  0.408200, 0.0795,
-  // f 151/153/144 139/176/166 140/177/167
-  0.408200, 0.0795,
-  0.407700, 0.0787,
-  0.438700, 0.0704,
-  // f 143/145/136 156/158/149 155/157/148
-  0.409300, 0.1833,
-  0.409800, 0.1825,
-  0.438700, 0.1903,
-  // f 155/157/148 144/146/137 143/145/136
-  0.438700, 0.1903,
-  0.438700, 0.1912,
-  0.409300, 0.1833,
-  // f 146/148/139 159/161/151 156/158/149
-  0.387800, 0.1618,
-  0.388600, 0.1613,
-  0.409800, 0.1825,
-  // f 156/158/149 143/145/136 146/148/139
-  0.409800, 0.1825,
-  0.409300, 0.1833,
-  0.387800, 0.1618,
-  // f 148/150/141 161/163/153 159/161/151
-  0.379900, 0.1324,
-  0.380900, 0.1324,
-  0.388600, 0.1613,
-  // f 159/161/151 146/148/139 148/150/141
-  0.388600, 0.1613,
-  0.387800, 0.1618,
-  0.379900, 0.1324,
-  // f 150/152/143 163/165/155 161/163/153
-  0.387800, 0.103,
-  0.388600, 0.1035,
-  0.380900, 0.1324,
-  // f 161/163/153 148/150/141 150/152/143
-  0.380900, 0.1324,
-  0.379900, 0.1324,
-  0.387800, 0.103,
-  // f 152/154/145 165/167/157 163/165/155
-  0.409300, 0.0815,
-  0.409800, 0.0823,
-  0.388600, 0.1035,
-  // f 163/165/155 150/152/143 152/154/145
-  0.388600, 0.1035,
-  0.387800, 0.103,
-  0.409300, 0.0815,
-  // f 154/156/147 167/169/159 165/167/157
-  0.438700, 0.0736,
-  0.438700, 0.0745,
-  0.409800, 0.0823,
-  // f 165/167/157 152/154/145 154/156/147
-  0.409800, 0.0823,
-  0.409300, 0.0815,
-  0.438700, 0.0736,
-  // f 141/143/134 144/146/137 174/178/168
-  0.438700, 0.1935,
-  0.438700, 0.1912,
-  0.468200, 0.1833,
-  // f 174/178/168 175/179/169 141/143/134
-  0.468200, 0.1833,
-  0.469300, 0.1853,
-  0.438700, 0.1935,
-  // f 175/179/169 174/178/168 176/180/170
-  0.469300, 0.1853,
-  0.468200, 0.1833,
-  0.489700, 0.1618,
-  // f 176/180/170 177/181/171 175/179/169
-  0.489700, 0.1618,
-  0.491600, 0.1629,
-  0.469300, 0.1853,
-  // f 177/181/171 176/180/170 178/182/172
-  0.491600, 0.1629,
-  0.489700, 0.1618,
-  0.497600, 0.1324,
-  // f 178/182/172 179/183/173 177/181/171
-  0.497600, 0.1324,
-  0.499800, 0.1324,
-  0.491600, 0.1629,
-  // f 179/183/173 178/182/172 180/184/174
-  0.499800, 0.1324,
-  0.497600, 0.1324,
-  0.489700, 0.103,
-  // f 180/184/174 181/185/175 179/183/173
-  0.489700, 0.103,
-  0.491600, 0.1019,
-  0.499800, 0.1324,
-  // f 181/185/175 180/184/174 182/186/176
-  0.491600, 0.1019,
-  0.489700, 0.103,
-  0.468200, 0.0815,
-  // f 182/186/176 183/187/177 181/185/175
-  0.468200, 0.0815,
-  0.469300, 0.0795,
-  0.491600, 0.1019,
-  // f 183/187/177 182/186/176 154/156/147
-  0.469300, 0.0795,
-  0.468200, 0.0815,
-  0.438700, 0.0736,
-  // f 154/156/147 153/155/146 183/187/177
-  0.438700, 0.0736,
-  0.438700, 0.0713,
-  0.469300, 0.0795,
-  // f 155/157/148 158/160/78 184/188/178
-  0.438700, 0.1903,
-  0.438700, 0.1827,
-  0.463900, 0.1759,
-  // f 184/188/178 185/189/179 155/157/148
-  0.463900, 0.1759,
-  0.467700, 0.1825,
-  0.438700, 0.1903,
-  // f 185/189/179 184/188/178 186/190/180
-  0.467700, 0.1825,
-  0.463900, 0.1759,
-  0.482300, 0.1575,
-  // f 186/190/180 187/191/181 185/189/179
-  0.482300, 0.1575,
-  0.488900, 0.1613,
-  0.467700, 0.1825,
-  // f 187/191/181 186/190/180 188/192/182
-  0.488900, 0.1613,
-  0.482300, 0.1575,
-  0.489000, 0.1324,
-  // f 188/192/182 189/193/183 187/191/181
-  0.489000, 0.1324,
-  0.496600, 0.1324,
-  0.488900, 0.1613,
-  // f 189/193/183 188/192/182 190/194/184
-  0.496600, 0.1324,
-  0.489000, 0.1324,
-  0.482300, 0.1073,
-  // f 190/194/184 191/195/185 189/193/183
-  0.482300, 0.1073,
-  0.488900, 0.1035,
-  0.496600, 0.1324,
-  // f 191/195/185 190/194/184 192/196/186
-  0.488900, 0.1035,
-  0.482300, 0.1073,
-  0.463900, 0.0889,
-  // f 192/196/186 193/197/187 191/195/185
-  0.463900, 0.0889,
-  0.467700, 0.0823,
-  0.488900, 0.1035,
-  // f 193/197/187 192/196/186 168/170/160
-  0.467700, 0.0823,
-  0.463900, 0.0889,
-  0.438700, 0.0821,
-  // f 168/170/160 167/169/159 193/197/187
-  0.438700, 0.0821,
-  0.438700, 0.0745,
-  0.467700, 0.0823,
-  // f 169/198/188 135/172/162 141/143/134
-  0.469700, 0.1861,
-  0.438700, 0.1944,
-  0.438700, 0.1935,
-  // f 141/143/134 175/179/169 169/198/188
-  0.438700, 0.1935,
-  0.469300, 0.1853,
-  0.469700, 0.1861,
-  // f 170/199/189 169/198/188 175/179/169
-  0.492400, 0.1634,
-  0.469700, 0.1861,
-  0.469300, 0.1853,
-  // f 175/179/169 177/181/171 170/199/189
-  0.469300, 0.1853,
-  0.491600, 0.1629,
-  0.492400, 0.1634,
-  // f 171/200/190 170/199/189 177/181/171
-  0.500700, 0.1324,
-  0.492400, 0.1634,
-  0.491600, 0.1629,
-  // f 177/181/171 179/183/173 171/200/190
-  0.491600, 0.1629,
-  0.499800, 0.1324,
-  0.500700, 0.1324,
-  // f 172/201/191 171/200/190 179/183/173
-  0.492400, 0.1014,
-  0.500700, 0.1324,
-  0.499800, 0.1324,
-  // f 179/183/173 181/185/175 172/201/191
-  0.499800, 0.1324,
-  0.491600, 0.1019,
-  0.492400, 0.1014,
-  // f 173/202/192 172/201/191 181/185/175
-  0.469700, 0.0787,
-  0.492400, 0.1014,
-  0.491600, 0.1019,
-  // f 181/185/175 183/187/177 173/202/192
-  0.491600, 0.1019,
-  0.469300, 0.0795,
-  0.469700, 0.0787,
-  // f 140/177/167 173/202/192 183/187/177
-  0.438700, 0.0704,
-  0.469700, 0.0787,
-  0.469300, 0.0795,
-  // f 183/187/177 153/155/146 140/177/167
-  0.469300, 0.0795,
-  0.438700, 0.0713,
-  0.438700, 0.0704,
-  // f 174/178/168 144/146/137 155/157/148
-  0.468200, 0.1833,
-  0.438700, 0.1912,
-  0.438700, 0.1903,
-  // f 155/157/148 185/189/179 174/178/168
-  0.438700, 0.1903,
-  0.467700, 0.1825,
-  0.468200, 0.1833,
-  // f 176/180/170 174/178/168 185/189/179
-  0.489700, 0.1618,
-  0.468200, 0.1833,
-  0.467700, 0.1825,
-  // f 185/189/179 187/191/181 176/180/170
-  0.467700, 0.1825,
-  0.488900, 0.1613,
-  0.489700, 0.1618,
-  // f 178/182/172 176/180/170 187/191/181
-  0.497600, 0.1324,
-  0.489700, 0.1618,
-  0.488900, 0.1613,
-  // f 187/191/181 189/193/183 178/182/172
-  0.488900, 0.1613,
-  0.496600, 0.1324,
-  0.497600, 0.1324,
-  // f 180/184/174 178/182/172 189/193/183
-  0.489700, 0.103,
-  0.497600, 0.1324,
-  0.496600, 0.1324,
-  // f 189/193/183 191/195/185 180/184/174
-  0.496600, 0.1324,
-  0.488900, 0.1035,
-  0.489700, 0.103,
-  // f 182/186/176 180/184/174 191/195/185
-  0.468200, 0.0815,
-  0.489700, 0.103,
-  0.488900, 0.1035,
-  // f 191/195/185 193/197/187 182/186/176
-  0.488900, 0.1035,
-  0.467700, 0.0823,
-  0.468200, 0.0815,
-  // f 154/156/147 182/186/176 193/197/187
-  0.438700, 0.0736,
-  0.468200, 0.0815,
-  0.467700, 0.0823,
-  // f 193/197/187 167/169/159 154/156/147
-  0.467700, 0.0823,
-  0.438700, 0.0745,
-  0.438700, 0.0736,
-};
-
@@ -0,0 +1,302 @@
+#! /usr/bin/perl
+=head1 NAME
+
+ obj2mesh - converts obj files to the config tool binary mesh format
+
+=head1 SYNOPSIS
+
+ obj2mesh [options] file
+
+ use -help or -man for further information
+
+=head1 DESCRIPTION
+
+Converts an OBJ file (or a header generated by obj2opengl.pl) into a .mesh
+file that the config tool AssetManager loads at runtime.
+
+Faces are expanded into a flat triangle list the same way obj2opengl.pl does
+it (quads are split in two, texture V is flipped), so a mesh converted from
+an OBJ draws exactly like the header generated from it.
+
+=head1 FILE FORMAT
+
+All values are little endian.
+
+ uint32   magic ('PSMM')
+ uint32   version (1)
+ uint32   flags (1: has normals, 2: has texcoords, 4: quantized)
+ uint32   vertex count
+ float[3] position offset
+ float[3] position scale
+ float[2] texcoord offset
+ float[2] texcoord scale
+
+Followed by one interleaved record per vertex: position[3], normal[3] (if any)
+and texcoord[2] (if any). Unquantized records are floats. Quantized records
+are int16s, where position= offset + value*scale (same for texcoords) and
+normals are divided by 32767.
+
+=head1 OPTIONS
+
+=over
+
+=item B<-help>
+
+Print a brief help message and exits.
+
+=item B<-o>, B<-outputFilename>
+
+Name of the output file name. If omitted, the output file the same as the
+input filename but with the extension .mesh
+
+=item B<-noNormals>
+
+Leaves the normals out of the mesh.
+
+=item B<-quantize>
+
+Stores the vertex attributes as 16-bit integers instead of floats.
+
+=item B<-noverbose>
+
+Runs this script silently.
+
+=cut
+
+use strict;
+use warnings;
+use Getopt::Long;
+use File::Basename;
+use Pod::Usage;
+
+use constant MESH_MAGIC => 0x4D4D5350; # 'PSMM'
+use constant MESH_VERSION => 1;
+use constant MESH_FLAG_HAS_NORMALS => 1;
+use constant MESH_FLAG_HAS_TEXCOORDS => 2;
+use constant MESH_FLAG_QUANTIZED => 4;
+use constant QUANTIZED_MAX => 32767;
+
+my $inFilename;
+my $outFilename;
+my $noNormals = 0;
+my $quantize = 0;
+my $verbose = 1;
+
+# Flat triangle list, one entry per emitted vertex
+my @positions;
+my @normals;
+my @texcoords;
+
+# -----------------------------------------------------------------
+# Main Program
+# -----------------------------------------------------------------
+handleArguments();
+
+if ($inFilename =~ /\.h$/i) {
+	loadHeader();
+} else {
+	loadObj();
+}
+
+@normals = () if $noNormals;
+
+writeMesh();
+
+# -----------------------------------------------------------------
+# Sub Routines
+# -----------------------------------------------------------------
+
+sub handleArguments {
+	my $help = 0;
+	my $man = 0;
+	my $errorInOptions = !GetOptions (
+		"help" => \$help,
+		"man"  => \$man,
+		"outputFilename=s" => \$outFilename,
+		"noNormals" => \$noNormals,
+		"quantize" => \$quantize,
+		"verbose!" => \$verbose,
+		);
+
+	if ($#ARGV == 0) {
+		$inFilename = $ARGV[0];
+	} else {
+		$errorInOptions = 1;
+	}
+
+	unless ($errorInOptions || defined($outFilename)) {
+		my ($file, $dir, $ext) = fileparse($inFilename, qr/\.[^.]*/);
+		$outFilename = $dir . $file . ".mesh";
+	}
+
+	if ($errorInOptions || $man || $help) {
+		pod2usage(-verbose => 2) if $man;
+		pod2usage(-verbose => 1) if $help;
+		pod2usage();
+	}
+}
+
+sub fixedIndex {
+	my ($idx, $num) = @_;
+	return ($idx >= 0) ? $idx : $num + $idx + 1;
+}
+
+sub loadObj {
+	my (@v, @vt, @vn);
+
+	open (my $in, "<", $inFilename)
+	  || die "Can't find file $inFilename...exiting \n";
+
+	while (my $line = <$in>)
+	{
+		$line =~ s/\s+$//;
+		my @tokens = split(' ', $line);
+		next unless @tokens;
+
+		if ($tokens[0] eq 'v') {
+			push @v, [ @tokens[1..3] ];
+		} elsif ($tokens[0] eq 'vt') {
+			push @vt, [ $tokens[1], 1 - $tokens[2] ];
+		} elsif ($tokens[0] eq 'vn') {
+			my ($x, $y, $z) = @tokens[1..3];
+			my $d = sqrt($x*$x + $y*$y + $z*$z);
+			push @vn, ($d == 0) ? [ 1, 0, 0 ] : [ $x/$d, $y/$d, $z/$d ];
+		} elsif ($tokens[0] eq 'f' && @tokens >= 4) {
+			my @corners = map { [ split('/', $_) ] } @tokens[1..$#tokens];
+			my @triangles = ([ 0, 1, 2 ]);
+
+			# quad => second triangle
+			push @triangles, [ 0, 3, 2 ] if @corners >= 4;
+
+			foreach my $triangle (@triangles) {
+				foreach my $corner_index (@$triangle) {
+					my ($vi, $ti, $ni) = @{$corners[$corner_index]};
+
+					push @positions, @{$v[fixedIndex($vi - 1, scalar(@v))]};
+					push @texcoords, @{$vt[fixedIndex($ti - 1, scalar(@vt))]}
+						if @vt && defined($ti) && $ti ne '';
+					push @normals, @{$vn[fixedIndex($ni - 1, scalar(@vn))]}
+						if @vn && defined($ni) && $ni ne '';
+				}
+			}
+		}
+	}
+
+	close $in;
+}
+
+sub loadHeaderArray {
+	my ($text, $suffix) = @_;
+
+	return () unless $text =~ /float\s+\w+$suffix\s*\[\]\s*=\s*\{(.*?)\};/s;
+
+	my $body = $1;
+	$body =~ s/\/\/[^\n]*//g;
+
+	return grep { $_ ne '' } split(/[\s,]+/, $body);
+}
+
+sub loadHeader {
+	open (my $in, "<", $inFilename)
+	  || die "Can't find file $inFilename...exiting \n";
+	my $text = do { local $/; <$in> };
+	close $in;
+
+	@positions = loadHeaderArray($text, 'Verts');
+	@normals = loadHeaderArray($text, 'Normals');
+	@texcoords = loadHeaderArray($text, 'TexCoords');
+}
+
+# Returns the (offset, scale) pairs that map each component onto [-32767, 32767]
+sub quantizationRange {
+	my ($values, $component_count) = @_;
+	my @offsets;
+	my @scales;
+
+	for (my $c = 0; $c < $component_count; ++$c) {
+		my ($min, $max);
+
+		for (my $i = $c; $i < scalar(@$values); $i += $component_count) {
+			my $value = $values->[$i];
+			$min = $value if !defined($min) || $value < $min;
+			$max = $value if !defined($max) || $value > $max;
+		}
+
+		$min = 0 unless defined($min);
+		$max = 0 unless defined($max);
+
+		my $half_extent = ($max - $min) / 2;
+		push @offsets, ($min + $max) / 2;
+		push @scales, ($half_extent > 0) ? $half_extent / QUANTIZED_MAX : 1;
+	}
+
+	return (\@offsets, \@scales);
+}
+
+sub quantize {
+	my ($value, $offset, $scale) = @_;
+	my $q = ($value - $offset) / $scale;
+	$q = ($q >= 0) ? int($q + 0.5) : -int(-$q + 0.5);
+	$q = QUANTIZED_MAX if $q > QUANTIZED_MAX;
+	$q = -QUANTIZED_MAX if $q < -QUANTIZED_MAX;
+	return $q;
+}
+
+sub writeMesh {
+	my $vertex_count = scalar(@positions) / 3;
+	my $has_normals = (scalar(@normals) == $vertex_count * 3 && $vertex_count > 0);
+	my $has_texcoords = (scalar(@texcoords) == $vertex_count * 2 && $vertex_count > 0);
+
+	die "$inFilename has no triangles...exiting \n" if $vertex_count == 0;
+
+	warn "Ignoring normals: count doesn't match the vertex count\n"
+		if @normals && !$has_normals;
+	warn "Ignoring texcoords: count doesn't match the vertex count\n"
+		if @texcoords && !$has_texcoords;
+
+	my $flags = 0;
+	$flags |= MESH_FLAG_HAS_NORMALS if $has_normals;
+	$flags |= MESH_FLAG_HAS_TEXCOORDS if $has_texcoords;
+	$flags |= MESH_FLAG_QUANTIZED if $quantize;
+
+	my ($position_offset, $position_scale) = ([0, 0, 0], [1, 1, 1]);
+	my ($texcoord_offset, $texcoord_scale) = ([0, 0], [1, 1]);
+
+	if ($quantize) {
+		($position_offset, $position_scale) = quantizationRange(\@positions, 3);
+		($texcoord_offset, $texcoord_scale) = quantizationRange(\@texcoords, 2)
+			if $has_texcoords;
+	}
+
+	open (my $out, ">:raw", $outFilename)
+	  || die "Can't create file $outFilename ... exiting\n";
+
+	print $out pack("V4", MESH_MAGIC, MESH_VERSION, $flags, $vertex_count);
+	print $out pack("(f<)10",
+		@$position_offset, @$position_scale, @$texcoord_offset, @$texcoord_scale);
+
+	for (my $i = 0; $i < $vertex_count; ++$i) {
+		my @p = @positions[$i*3 .. $i*3 + 2];
+		my @n = $has_normals ? @normals[$i*3 .. $i*3 + 2] : ();
+		my @t = $has_texcoords ? @texcoords[$i*2 .. $i*2 + 1] : ();
+
+		if ($quantize) {
+			print $out pack("(s<)3", map { quantize($p[$_], $position_offset->[$_], $position_scale->[$_]) } 0..2);
+			print $out pack("(s<)3", map { quantize($n[$_], 0, 1 / QUANTIZED_MAX) } 0..2) if $has_normals;
+			print $out pack("(s<)2", map { quantize($t[$_], $texcoord_offset->[$_], $texcoord_scale->[$_]) } 0..1) if $has_texcoords;
+		} else {
+			print $out pack("(f<)*", @p, @n, @t);
+		}
+	}
+
+	close $out;
+
+	if ($verbose) {
+		print "source file    : $inFilename\n";
+		print "output file    : $outFilename\n";
+		print "vertices       : $vertex_count\n";
+		print "normals        : " . ($has_normals ? "yes" : "no") . "\n";
+		print "texture coords : " . ($has_texcoords ? "yes" : "no") . "\n";
+		print "quantized      : " . ($quantize ? "yes" : "no") . "\n";
+	}
+}
@@ -1,2 +0,0 @@
-perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject DK2 DK2_3dmodel.obj
-pause
\ No newline at end of file
@@ -0,0 +1,2 @@
+perl obj2mesh.pl -noNormals -quantize -o ../assets/models/dk2.mesh DK2_3dmodel.obj
+pause
\ No newline at end of file
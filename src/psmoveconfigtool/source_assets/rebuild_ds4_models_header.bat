@@ -1,3 +0,0 @@
-perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject ds4body DS4/ds4.obj
-perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject ds4lightbar DS4/lightbar.obj
-pause
\ No newline at end of file
@@ -0,0 +1,3 @@
+perl obj2mesh.pl -noNormals -quantize -o ../assets/models/ds4body.mesh DS4/ds4.obj
+perl obj2mesh.pl -noNormals -quantize -o ../assets/models/ds4lightbar.mesh DS4/lightbar.obj
+pause
\ No newline at end of file
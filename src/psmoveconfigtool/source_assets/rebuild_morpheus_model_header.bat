@@ -1,2 +0,0 @@
-perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject morpheus Morpheus/morpheus2.obj
-pause
\ No newline at end of file
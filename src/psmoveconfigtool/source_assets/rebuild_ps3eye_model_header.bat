@@ -1,2 +0,0 @@
-perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject ps3eye PS3EyeCamera.obj
-pause
\ No newline at end of file
@@ -0,0 +1,2 @@
+perl obj2mesh.pl -noNormals -quantize -o ../assets/models/ps3eye.mesh PS3EyeCamera.obj
+pause
\ No newline at end of file
@@ -1,3 +0,0 @@
-perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject psmovebody PSMoveMotionControllerBody.obj
-perl ../../../thirdparty/HBehrens-obj2opengl/obj2opengl.pl -noScale -noMove -nameOfObject psmovebulb PSMoveMotionControllerBulb.obj
-pause
\ No newline at end of file
@@ -0,0 +1,3 @@
+perl obj2mesh.pl -noNormals -quantize -o ../assets/models/psmovebody.mesh PSMoveMotionControllerBody.obj
+perl obj2mesh.pl -noNormals -quantize -o ../assets/models/psmovebulb.mesh PSMoveMotionControllerBulb.obj
+pause
\ No newline at end of file
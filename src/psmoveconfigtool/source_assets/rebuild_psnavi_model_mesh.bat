@@ -0,0 +1,2 @@
+perl obj2mesh.pl -noNormals -quantize -o ../assets/models/psnavi.mesh PSNaviController.obj
+pause
\ No newline at end of file
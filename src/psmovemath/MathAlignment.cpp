@@ -2,6 +2,8 @@
 #include "MathAlignment.h"
 #include "Eigen/SVD"
 #include "Eigen/Dense"
+#include <algorithm>
+#include <limits>
 #include <iostream>
 
 //-- public methods -----
@@ -207,6 +209,18 @@ eigen_alignment_fit_bounding_box_ellipsoid(
     }
 }
 
+void
+eigen_alignment_fit_min_volume_ellipsoid(
+    const Eigen::Vector3f *points,
+    const int point_count,
+    const float tolerance,
+    EigenFitEllipsoid &out_ellipsoid)
+{
+    EigenFitMinVolumeEllipsoidWorkspace workspace;
+
+    eigen_alignment_fit_min_volume_ellipsoid(points, point_count, tolerance, workspace, out_ellipsoid);
+}
+
 // See http://stackoverflow.com/questions/1768197/bounding-ellipse/1768440#1768440
 // Relevant paper: http://www.seas.upenn.edu/~nima/papers/Mim_vol_ellipse.pdf
 void
@@ -214,71 +228,88 @@ eigen_alignment_fit_min_volume_ellipsoid(
     const Eigen::Vector3f *points,
     const int point_count,
     const float tolerance,
+    EigenFitMinVolumeEllipsoidWorkspace &workspace,
     EigenFitEllipsoid &out_ellipsoid)
 {
     const float POINT_DIMENSION = 3.f;
 
     if (point_count > POINT_DIMENSION)
     {
-        const float N = static_cast<float>(point_count);
-
-        //u is an Nx1 vector where each element is 1/N
-        Eigen::VectorXf u(point_count);
-
         const int k_max_iteration_count = 100;
         float error = k_real_max;
 
-        // Fill out 3xN and 4xN point matrices P & Q
-        Eigen::MatrixXf P(3, point_count);
-        Eigen::MatrixXf Q(4, point_count);
-
-        int dest_row = 0;
-        for (int point_index = 0; point_index < point_count; ++point_index)
-        {
-            const Eigen::Vector3f &point = points[point_index];
-
-            P.col(dest_row) = point;
-            Q.col(dest_row) = Eigen::Vector4f(point.x(), point.y(), point.z(), 1.f);
-            ++dest_row;
-        }
+        // u holds one weight per point, each starting out at 1/N.
+        // Q is the 4xN matrix of the points with a 1 appended, it never gets built explicitly.
+        std::vector<float> &u = workspace.weights;
+        u.assign(point_count, 1.f / static_cast<float>(point_count));
+        double u_squared_norm = 1.0 / static_cast<double>(point_count);
 
         // Run the Khachiyan Convex Optimization Algorithm
-        u.setConstant(1.f / N);
         for (int iteration_count = 0; error > tolerance && iteration_count < k_max_iteration_count; ++iteration_count)
         {
-            Eigen::Matrix4f X = Q*u.asDiagonal()*Q.transpose(); // (4xN)(NxN)(Nx4) = (4x4)
-            Eigen::VectorXf M = (Q.transpose()*X.inverse()*Q).diagonal(); // [(Nx4)(4x4)(4xN)].diagonal() = (Nx1)
+            // X = Q*diag(u)*Q' (4x4)
+            Eigen::Matrix4d X = Eigen::Matrix4d::Zero();
+            for (int point_index = 0; point_index < point_count; ++point_index)
+            {
+                const Eigen::Vector4d q = points[point_index].cast<double>().homogeneous();
+
+                X.noalias() += static_cast<double>(u[point_index])*q*q.transpose();
+            }
+            const Eigen::Matrix4d X_inverse = X.inverse();
 
-            // Find the max element and position in M
+            // Find the max element and position in M = diagonal(Q'*X^-1*Q).
+            // Each element only depends on its own point, so the NxN product is never needed.
             int max_element_index = 0;
-            float max_element = M[0];
-            for (int element_index = 1; element_index < 4; ++element_index)
+            double max_element = -1.0;
+            for (int point_index = 0; point_index < point_count; ++point_index)
             {
-                if (M[element_index] > max_element)
+                const Eigen::Vector4d q = points[point_index].cast<double>().homogeneous();
+                const double element = q.dot(X_inverse*q);
+
+                if (element > max_element)
                 {
-                    max_element = M[element_index];
-                    max_element_index = element_index;
+                    max_element = element;
+                    max_element_index = point_index;
                 }
             }
 
             // Update u
             {
                 // Calculate the step size for the ascent
-                const float step_size = (max_element - POINT_DIMENSION - 1.f) / ((POINT_DIMENSION + 1.f)*(max_element - 1.f));
-                Eigen::VectorXf new_u = (1.f - step_size)*u;
-
-                new_u[max_element_index] = new_u[max_element_index] + step_size;
+                const double step_size = (max_element - POINT_DIMENSION - 1.0) / ((POINT_DIMENSION + 1.0)*(max_element - 1.0));
+                const double u_max = static_cast<double>(u[max_element_index]);
+
+                // new_u = (1-step_size)*u + step_size*e_max, so |new_u - u| = step_size*|e_max - u|
+                error = static_cast<float>(fabs(step_size)*sqrt(std::max(u_squared_norm - 2.0*u_max + 1.0, 0.0)));
+                u_squared_norm =
+                    (1.0 - step_size)*(1.0 - step_size)*u_squared_norm +
+                    2.0*(1.0 - step_size)*step_size*u_max +
+                    step_size*step_size;
+
+                const float u_scale = static_cast<float>(1.0 - step_size);
+                for (int point_index = 0; point_index < point_count; ++point_index)
+                {
+                    u[point_index] *= u_scale;
+                }
+                u[max_element_index] += static_cast<float>(step_size);
+            }
+        }
 
-                error = (new_u - u).norm();
+        // Compute the center P*u and P*diag(u)*P'
+        Eigen::Vector3d Pu = Eigen::Vector3d::Zero();
+        Eigen::Matrix3d PuP_trans = Eigen::Matrix3d::Zero();
+        for (int point_index = 0; point_index < point_count; ++point_index)
+        {
+            const Eigen::Vector3d p = points[point_index].cast<double>();
+            const double weight = static_cast<double>(u[point_index]);
 
-                u = new_u;
-            }
+            Pu += weight*p;
+            PuP_trans.noalias() += weight*p*p.transpose();
         }
 
         // Compute the Ellipsoid A-matrix i.e. (X-c)'*A*(X-c)
-		Eigen::Matrix3f PuP_trans= P*u.asDiagonal()*P.transpose();
-		Eigen::Matrix3f PuPu_trans= (P*u)*(P*u).transpose();
-        Eigen::Matrix3f A = (1.f / POINT_DIMENSION) * (PuP_trans - PuPu_trans).inverse();
+        const Eigen::Matrix3d PuPu_trans = Pu*Pu.transpose();
+        Eigen::Matrix3f A = ((1.0 / POINT_DIMENSION) * (PuP_trans - PuPu_trans).inverse()).cast<float>();
 
         // Compute the singular values of A (where A = U*D*V)
         const Eigen::JacobiSVD<Eigen::Matrix3f> svd(A, Eigen::ComputeFullU | Eigen::ComputeFullV);
@@ -295,7 +326,7 @@ eigen_alignment_fit_min_volume_ellipsoid(
             1.f / safe_sqrt_with_default(D(2), 100000));
 
         // Compute the center
-        out_ellipsoid.center = P*u;
+        out_ellipsoid.center = Pu.cast<float>();
 
         // Compute the fit error
         out_ellipsoid.error = eigen_alignment_compute_ellipsoid_fit_error(points, point_count, out_ellipsoid);
@@ -329,6 +360,37 @@ pseudoinverse(const MatT &mat, typename MatT::Scalar tolerance = typename MatT::
     return svd.matrixV() * singularValuesInv * svd.matrixU().adjoint();
 }
 
+// Converts the coefficients of A*x^2 + B*y^2 + C*z^2 + 2D*x + 2E*y + 2F*z = 1 into an ellipsoid
+static void
+axis_aligned_ellipsoid_from_coefficients(
+    const Eigen::VectorXd &v,
+    EigenFitEllipsoid &out_ellipsoid)
+{
+    const double v0= v(0);
+    const double v1= v(1);
+    const double v2= v(2);
+    const double v3= v(3);
+    const double v4= v(4);
+    const double v5= v(5);
+    const double Gamma= 
+        1.0
+        + safe_divide_with_default(v3*v3, v0, 0.0) 
+        + safe_divide_with_default(v4*v4, v1, 0.0) 
+        + safe_divide_with_default(v5*v5, v2, 0.0);
+
+    out_ellipsoid.center= 
+        Eigen::Vector3d(
+            safe_divide_with_default(-v3, v0, 0.0), 
+            safe_divide_with_default(-v4, v1, 0.0), 
+            safe_divide_with_default(-v5, v2, 0.0)).cast<float>();
+    out_ellipsoid.extents= 
+        Eigen::Vector3d(
+            safe_sqrt_with_default(Gamma/v0, 0.0), 
+            safe_sqrt_with_default(Gamma/v1, 0.0), 
+            safe_sqrt_with_default(Gamma/v2, 0.0)).cast<float>();
+    out_ellipsoid.basis = Eigen::Matrix3f::Identity();
+}
+
 // See https://engineering.purdue.edu/HSL/uploads/papers/UGV_F09_Magnetometer.docx
 void
 eigen_alignment_fit_least_squares_axis_aligned_ellipsoid(
@@ -357,29 +419,29 @@ eigen_alignment_fit_least_squares_axis_aligned_ellipsoid(
         //Eigen::VectorXd v= (D.transpose()*D).inverse()*(D.transpose()*Eigen::VectorXd::Ones(point_count));
         Eigen::VectorXd v= pseudoinverse(D)*Eigen::VectorXd::Ones(point_count);
 
-        const double v0= v(0);
-        const double v1= v(1);
-        const double v2= v(2);
-        const double v3= v(3);
-        const double v4= v(4);
-        const double v5= v(5);
-        const double Gamma= 
-            1.0
-            + safe_divide_with_default(v3*v3, v0, 0.0) 
-            + safe_divide_with_default(v4*v4, v1, 0.0) 
-            + safe_divide_with_default(v5*v5, v2, 0.0);
-
-        out_ellipsoid.center= 
-            Eigen::Vector3d(
-                safe_divide_with_default(-v3, v0, 0.0), 
-                safe_divide_with_default(-v4, v1, 0.0), 
-                safe_divide_with_default(-v5, v2, 0.0)).cast<float>();
-        out_ellipsoid.extents= 
-            Eigen::Vector3d(
-                safe_sqrt_with_default(Gamma/v0, 0.0), 
-                safe_sqrt_with_default(Gamma/v1, 0.0), 
-                safe_sqrt_with_default(Gamma/v2, 0.0)).cast<float>();
-        out_ellipsoid.basis = Eigen::Matrix3f::Identity();
+        axis_aligned_ellipsoid_from_coefficients(v, out_ellipsoid);
+        out_ellipsoid.error = eigen_alignment_compute_ellipsoid_fit_error(points, point_count, out_ellipsoid);
+    }
+    else
+    {
+        eigen_alignment_fit_bounding_box_ellipsoid(points, point_count, out_ellipsoid);
+    }
+}
+
+void
+eigen_alignment_fit_least_squares_axis_aligned_ellipsoid(
+    const EigenFitEllipsoidAccumulator &accumulator,
+    const Eigen::Vector3f *points, const int point_count,
+    EigenFitEllipsoid &out_ellipsoid)
+{
+    if (accumulator.point_count >= 6)
+    {
+        // v[6x1] = inv(DT D)[6x6] (DT 1)[6x1]
+        // The sums are over the squared coordinates, so scale the tolerance with the largest of them
+        const double tolerance= 1e-12 * accumulator.DtD.diagonal().maxCoeff();
+        Eigen::VectorXd v= pseudoinverse(accumulator.DtD, tolerance)*accumulator.Dt1;
+
+        axis_aligned_ellipsoid_from_coefficients(v, out_ellipsoid);
         out_ellipsoid.error = eigen_alignment_compute_ellipsoid_fit_error(points, point_count, out_ellipsoid);
     }
     else
@@ -771,6 +833,477 @@ eigen_alignment_fit_focal_cone_to_sphere(
     }
 }
 
+float
+eigen_alignment_fit_focal_cone_to_sphere_fast(
+    const float *xy_points,
+    const int point_count,
+    const float sphere_radius,
+    const float focal_length_pts, // a.k.a. "f_px"
+    Eigen::Vector3f *out_sphere_center,
+    EigenFitEllipse *out_ellipse_projection)
+{
+    if (point_count < 3)
+    {
+        return -1.f;
+    }
+
+    // Same system as the QR version: each point contributes the row [x, y, -|(x, y, f)|] * [Bx, By, c]' = -f^2.
+    // Accumulate A'A and A'b directly in several independent lanes so the loop vectorizes.
+    const double zz = static_cast<double>(focal_length_pts) * static_cast<double>(focal_length_pts);
+    const int k_lanes = 4;
+    double sum_xx[k_lanes] = { 0 }, sum_xy[k_lanes] = { 0 }, sum_xn[k_lanes] = { 0 };
+    double sum_yy[k_lanes] = { 0 }, sum_yn[k_lanes] = { 0 }, sum_nn[k_lanes] = { 0 };
+    double sum_x[k_lanes] = { 0 }, sum_y[k_lanes] = { 0 }, sum_n[k_lanes] = { 0 };
+
+    int point_index = 0;
+    for (; point_index + k_lanes <= point_count; point_index += k_lanes)
+    {
+        for (int lane = 0; lane < k_lanes; ++lane)
+        {
+            const double x = xy_points[2 * (point_index + lane)];
+            const double y = xy_points[2 * (point_index + lane) + 1];
+            const double nn = x*x + y*y + zz;
+            const double n = sqrt(nn);
+
+            sum_xx[lane] += x*x; sum_xy[lane] += x*y; sum_xn[lane] += x*n;
+            sum_yy[lane] += y*y; sum_yn[lane] += y*n; sum_nn[lane] += nn;
+            sum_x[lane] += x; sum_y[lane] += y; sum_n[lane] += n;
+        }
+    }
+    for (; point_index < point_count; ++point_index)
+    {
+        const double x = xy_points[2 * point_index];
+        const double y = xy_points[2 * point_index + 1];
+        const double nn = x*x + y*y + zz;
+        const double n = sqrt(nn);
+
+        sum_xx[0] += x*x; sum_xy[0] += x*y; sum_xn[0] += x*n;
+        sum_yy[0] += y*y; sum_yn[0] += y*n; sum_nn[0] += nn;
+        sum_x[0] += x; sum_y[0] += y; sum_n[0] += n;
+    }
+
+    for (int lane = 1; lane < k_lanes; ++lane)
+    {
+        sum_xx[0] += sum_xx[lane]; sum_xy[0] += sum_xy[lane]; sum_xn[0] += sum_xn[lane];
+        sum_yy[0] += sum_yy[lane]; sum_yn[0] += sum_yn[lane]; sum_nn[0] += sum_nn[lane];
+        sum_x[0] += sum_x[lane]; sum_y[0] += sum_y[lane]; sum_n[0] += sum_n[lane];
+    }
+
+    Eigen::Matrix3d AtA;
+    AtA <<
+        sum_xx[0], sum_xy[0], -sum_xn[0],
+        sum_xy[0], sum_yy[0], -sum_yn[0],
+        -sum_xn[0], -sum_yn[0], sum_nn[0];
+    const Eigen::Vector3d Atb(-zz*sum_x[0], -zz*sum_y[0], zz*sum_n[0]);
+
+    const Eigen::LDLT<Eigen::Matrix3d> ldlt(AtA);
+    if (ldlt.info() != Eigen::Success || !ldlt.isPositive())
+    {
+        return -1.f;
+    }
+
+    const Eigen::Vector3d Bx_By_c = ldlt.solve(Atb);
+    if (!Bx_By_c.allFinite())
+    {
+        return -1.f;
+    }
+
+    const double norm_norm_B = sqrt(Bx_By_c[0] * Bx_By_c[0] + Bx_By_c[1] * Bx_By_c[1] + zz);
+    const double cos_theta = Bx_By_c[2] / norm_norm_B;
+    const double k = cos_theta * cos_theta;
+
+    if (k >= 1.0)
+    {
+        return -1.f;
+    }
+
+    const double norm_B = sphere_radius / sqrt(1.0 - k);
+    const double scale = norm_B / norm_norm_B;
+
+    *out_sphere_center <<
+        static_cast<float>(Bx_By_c[0] * scale),
+        static_cast<float>(Bx_By_c[1] * scale),
+        static_cast<float>(focal_length_pts * scale);
+
+    // RMS of the per-point residuals
+    double residual_sqr_sum = 0.0;
+    for (point_index = 0; point_index < point_count; ++point_index)
+    {
+        const double x = xy_points[2 * point_index];
+        const double y = xy_points[2 * point_index + 1];
+        const double n = sqrt(x*x + y*y + zz);
+        const double residual = x*Bx_By_c[0] + y*Bx_By_c[1] - n*Bx_By_c[2] + zz;
+
+        residual_sqr_sum += residual*residual;
+    }
+    const float fit_residual = static_cast<float>(sqrt(residual_sqr_sum / point_count) / zz);
+
+    // Optionally compute the best fit ellipse
+    if (out_ellipse_projection != nullptr)
+    {
+        eigen_alignment_project_ellipse(out_sphere_center, static_cast<float>(k),
+                                        focal_length_pts, static_cast<float>(zz),
+                                        out_ellipse_projection);
+
+        // The packed pairs have the same layout as an array of Eigen::Vector2f
+        out_ellipse_projection->error=
+            eigen_alignment_compute_ellipse_fit_error(
+                reinterpret_cast<const Eigen::Vector2f *>(xy_points), point_count, *out_ellipse_projection);
+    }
+
+    return fit_residual;
+}
+
+
+void
+EigenP3PBearings::set(const Eigen::Vector2f normalized_image_points[3])
+{
+    for (int point_index = 0; point_index < 3; ++point_index)
+    {
+        const Eigen::Vector2f &point = normalized_image_points[point_index];
+
+        bearings[point_index] = Eigen::Vector3d(point.x(), point.y(), 1.0).normalized();
+    }
+
+    b12 = -2.0*bearings[0].dot(bearings[1]);
+    b13 = -2.0*bearings[0].dot(bearings[2]);
+    b23 = -2.0*bearings[1].dot(bearings[2]);
+}
+
+// Real roots of x^2 + b*x + c, computed without cancellation
+static bool
+p3p_solve_quadratic(const double b, const double c, double &out_r1, double &out_r2)
+{
+    const double discriminant = b*b - 4.0*c;
+
+    if (discriminant < 0.0)
+    {
+        return false;
+    }
+
+    const double y = sqrt(discriminant);
+
+    out_r1 = (b < 0.0) ? 0.5*(-b + y) : 0.5*(-b - y);
+    out_r2 = (out_r1 != 0.0) ? c / out_r1 : 0.0;
+
+    return true;
+}
+
+// Largest real root of x^3 + b*x^2 + c*x + d
+static double
+p3p_solve_cubic_largest_root(const double b, const double c, const double d)
+{
+    // Depressed cubic t^3 + p*t + q with x = t - b/3
+    const double p = c - b*b / 3.0;
+    const double q = 2.0*b*b*b / 27.0 - b*c / 3.0 + d;
+    const double discriminant = q*q / 4.0 + p*p*p / 27.0;
+    double root;
+
+    if (discriminant > 0.0)
+    {
+        // One real root
+        const double sqrt_discriminant = sqrt(discriminant);
+
+        root = cbrt(-q / 2.0 + sqrt_discriminant) + cbrt(-q / 2.0 - sqrt_discriminant) - b / 3.0;
+    }
+    else
+    {
+        // Three real roots, k=0 is the largest
+        const double r = sqrt(-p / 3.0);
+        const double cos_arg = (r > 0.0) ? fmin(fmax(-q / (2.0*r*r*r), -1.0), 1.0) : 0.0;
+
+        root = 2.0*r*cos(acos(cos_arg) / 3.0) - b / 3.0;
+    }
+
+    // Polish the closed form root
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        const double f = ((root + b)*root + c)*root + d;
+        const double df = (3.0*root + 2.0*b)*root + c;
+
+        if (df == 0.0)
+        {
+            break;
+        }
+
+        root -= f / df;
+    }
+
+    return root;
+}
+
+// Coefficients of det(A + g*B) = c3*g^3 + c2*g^2 + c1*g + c0
+static void
+p3p_compute_determinant_cubic(
+    const Eigen::Matrix3d &A, const Eigen::Matrix3d &B,
+    double &c3, double &c2, double &c1, double &c0)
+{
+    c3 = B.determinant();
+    c0 = A.determinant();
+    c2 = 0.0;
+    c1 = 0.0;
+
+    for (int col = 0; col < 3; ++col)
+    {
+        Eigen::Matrix3d A_with_B_column = A;
+        Eigen::Matrix3d B_with_A_column = B;
+
+        A_with_B_column.col(col) = B.col(col);
+        B_with_A_column.col(col) = A.col(col);
+
+        c1 += A_with_B_column.determinant();
+        c2 += B_with_A_column.determinant();
+    }
+}
+
+int
+eigen_alignment_solve_p3p(
+    const EigenP3PBearings &bearings,
+    const Eigen::Vector3f object_points[3],
+    Eigen::Matrix3f out_rotations[4],
+    Eigen::Vector3f out_translations[4])
+{
+    const Eigen::Vector3d X1 = object_points[0].cast<double>();
+    const Eigen::Vector3d X2 = object_points[1].cast<double>();
+    const Eigen::Vector3d X3 = object_points[2].cast<double>();
+    const Eigen::Vector3d d12 = X1 - X2;
+    const Eigen::Vector3d d13 = X1 - X3;
+    const Eigen::Vector3d d23 = X2 - X3;
+    const double a12 = d12.squaredNorm();
+    const double a13 = d13.squaredNorm();
+    const double a23 = d23.squaredNorm();
+    const double b12 = bearings.b12;
+    const double b13 = bearings.b13;
+    const double b23 = bearings.b23;
+
+    // Object frame built from the edges of the triangle, inverted once per solve
+    Eigen::Matrix3d X;
+    X.col(0) = d12;
+    X.col(1) = d13;
+    X.col(2) = d12.cross(d13);
+
+    if (fabs(X.determinant()) < 1e-12)
+    {
+        // Collinear object points
+        return 0;
+    }
+
+    const Eigen::Matrix3d X_inverse = X.inverse();
+
+    // The depths L= (l1, l2, l3) satisfy l_i^2 + l_j^2 + b_ij*l_i*l_j = a_ij,
+    // i.e. L^T*M_ij*L = a_ij for these quadratic forms
+    Eigen::Matrix3d M12, M13, M23;
+    M12 << 1.0, 0.5*b12, 0.0, 0.5*b12, 1.0, 0.0, 0.0, 0.0, 0.0;
+    M13 << 1.0, 0.0, 0.5*b13, 0.0, 0.0, 0.0, 0.5*b13, 0.0, 1.0;
+    M23 << 0.0, 0.0, 0.0, 0.0, 1.0, 0.5*b23, 0.0, 0.5*b23, 1.0;
+
+    // Two homogeneous forms L^T*D*L = 0 that the depths satisfy
+    const Eigen::Matrix3d D1 = M12*a23 - M23*a12;
+    const Eigen::Matrix3d D2 = M13*a23 - M23*a13;
+
+    // Find a degenerate combination D0 = D1 + g*D2 from a root of det(D0) = 0
+    double c3, c2, c1, c0;
+    p3p_compute_determinant_cubic(D1, D2, c3, c2, c1, c0);
+    if (fabs(c3) < 1e-15)
+    {
+        return 0;
+    }
+
+    const double g = p3p_solve_cubic_largest_root(c2 / c3, c1 / c3, c0 / c3);
+    const Eigen::Matrix3d D0 = D1 + g*D2;
+
+    // D0 = s1*e1*e1^T + s2*e2*e2^T (+ 0*e3*e3^T) factors L^T*D0*L = 0 into two planes
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eigen_solver;
+    eigen_solver.computeDirect(D0);
+    const Eigen::Vector3d &eigenvalues = eigen_solver.eigenvalues();
+
+    // The known zero eigenvalue is the one closest to zero
+    int zero_index = 0;
+    for (int index = 1; index < 3; ++index)
+    {
+        if (fabs(eigenvalues(index)) < fabs(eigenvalues(zero_index)))
+        {
+            zero_index = index;
+        }
+    }
+
+    int major_index = (zero_index + 1) % 3;
+    int minor_index = (zero_index + 2) % 3;
+    if (fabs(eigenvalues(minor_index)) > fabs(eigenvalues(major_index)))
+    {
+        std::swap(major_index, minor_index);
+    }
+
+    const double s1 = eigenvalues(major_index);
+    const double s2 = eigenvalues(minor_index);
+    if (s1 == 0.0 || s1*s2 > 0.0)
+    {
+        return 0;
+    }
+
+    const double s = sqrt(-s2 / s1);
+    const Eigen::Vector3d e1 = eigen_solver.eigenvectors().col(major_index);
+    const Eigen::Vector3d e2 = eigen_solver.eigenvectors().col(minor_index);
+
+    Eigen::Vector3d solution_depths[4];
+    int solution_count = 0;
+
+    for (int sign_index = 0; sign_index < 2; ++sign_index)
+    {
+        // Plane u.L = 0 written as l1 = w0*l2 + w1*l3
+        const Eigen::Vector3d u = (sign_index == 0) ? Eigen::Vector3d(e1 - s*e2) : Eigen::Vector3d(e1 + s*e2);
+
+        if (fabs(u(0)) < 1e-12)
+        {
+            continue;
+        }
+
+        const double w0 = -u(1) / u(0);
+        const double w1 = -u(2) / u(0);
+
+        // With L = l2*(p + tau*q), L^T*D2*L = 0 is a quadratic in tau = l3/l2
+        const Eigen::Vector3d p(w0, 1.0, 0.0);
+        const Eigen::Vector3d q(w1, 0.0, 1.0);
+        const double qa = q.dot(D2*q);
+        const double qb = 2.0*p.dot(D2*q);
+        const double qc = p.dot(D2*p);
+
+        if (fabs(qa) < 1e-15)
+        {
+            continue;
+        }
+
+        double taus[2];
+        if (!p3p_solve_quadratic(qb / qa, qc / qa, taus[0], taus[1]))
+        {
+            continue;
+        }
+
+        for (int tau_index = 0; tau_index < 2; ++tau_index)
+        {
+            const double tau = taus[tau_index];
+
+            if (tau <= 0.0)
+            {
+                continue;
+            }
+
+            // Scale from l2^2*(1 + tau^2 + b23*tau) = a23
+            const double l2 = sqrt(a23 / (tau*(tau + b23) + 1.0));
+            const double l3 = tau*l2;
+            const double l1 = w0*l2 + w1*l3;
+
+            if (l1 > 0.0 && solution_count < 4)
+            {
+                solution_depths[solution_count++] = Eigen::Vector3d(l1, l2, l3);
+            }
+        }
+    }
+
+    for (int solution_index = 0; solution_index < solution_count; ++solution_index)
+    {
+        Eigen::Vector3d L = solution_depths[solution_index];
+
+        // A few Gauss-Newton steps on the three distance equations clean up the closed form
+        for (int iteration = 0; iteration < 3; ++iteration)
+        {
+            const Eigen::Vector3d r(
+                L(0)*L(0) + L(1)*L(1) + b12*L(0)*L(1) - a12,
+                L(0)*L(0) + L(2)*L(2) + b13*L(0)*L(2) - a13,
+                L(1)*L(1) + L(2)*L(2) + b23*L(1)*L(2) - a23);
+
+            Eigen::Matrix3d J;
+            J << 2.0*L(0) + b12*L(1), 2.0*L(1) + b12*L(0), 0.0,
+                 2.0*L(0) + b13*L(2), 0.0, 2.0*L(2) + b13*L(0),
+                 0.0, 2.0*L(1) + b23*L(2), 2.0*L(2) + b23*L(1);
+
+            const double det_J = J.determinant();
+            if (fabs(det_J) < 1e-15)
+            {
+                break;
+            }
+
+            L -= J.inverse()*r;
+        }
+
+        // The camera frame triangle is the rotated object frame triangle
+        const Eigen::Vector3d P1 = bearings.bearings[0]*L(0);
+        const Eigen::Vector3d P2 = bearings.bearings[1]*L(1);
+        const Eigen::Vector3d P3 = bearings.bearings[2]*L(2);
+        const Eigen::Vector3d e12 = P1 - P2;
+        const Eigen::Vector3d e13 = P1 - P3;
+
+        Eigen::Matrix3d Y;
+        Y.col(0) = e12;
+        Y.col(1) = e13;
+        Y.col(2) = e12.cross(e13);
+
+        const Eigen::Matrix3d R = Y*X_inverse;
+
+        out_rotations[solution_index] = R.cast<float>();
+        out_translations[solution_index] = (P1 - R*X1).cast<float>();
+    }
+
+    return solution_count;
+}
+
+// Eigenvector of the largest eigenvalue of M = sum(q*q'), i.e. the average quaternion.
+// M is symmetric positive semi-definite, so power iteration converges on it.
+// Seeded with one of the samples it only needs a few steps when the samples agree,
+// the full solver only runs when the samples are spread out so much that it stalls.
+template <typename t_scalar>
+static bool
+eigen_quaternion_accumulator_dominant_eigenvector(
+    const Eigen::Matrix<t_scalar, 4, 4> &M,
+    const Eigen::Matrix<t_scalar, 4, 1> &seed,
+    Eigen::Matrix<t_scalar, 4, 1> &out_eigenvector)
+{
+    typedef Eigen::Matrix<t_scalar, 4, 1> Vector4;
+    const int k_max_iteration_count = 16;
+    const t_scalar k_tolerance = static_cast<t_scalar>(1e-5);
+
+    // A seed orthogonal to the answer falls back on the column of M with the largest diagonal
+    Vector4 v = M*seed;
+    t_scalar length = v.norm();
+    if (!(length > std::numeric_limits<t_scalar>::min()))
+    {
+        int largest_column = 0;
+        M.diagonal().maxCoeff(&largest_column);
+        v = M.col(largest_column);
+        length = v.norm();
+
+        if (!(length > std::numeric_limits<t_scalar>::min()))
+        {
+            return false;
+        }
+    }
+    v /= length;
+
+    for (int iteration = 0; iteration < k_max_iteration_count; ++iteration)
+    {
+        const Vector4 Mv = M*v;
+        const t_scalar eigenvalue = v.dot(Mv);
+
+        // Converged once v is an eigenvector up to the tolerance
+        if ((Mv - eigenvalue*v).squaredNorm() <= k_tolerance*k_tolerance*eigenvalue*eigenvalue)
+        {
+            out_eigenvector = v;
+            return true;
+        }
+
+        v = Mv / Mv.norm();
+    }
+
+    // Eigenvalues are in increasing order
+    const Eigen::SelfAdjointEigenSolver<Eigen::Matrix<t_scalar, 4, 4> > eigsolv(M);
+    if (eigsolv.info() == Eigen::Success)
+    {
+        out_eigenvector = eigsolv.eigenvectors().col(3);
+        return true;
+    }
+
+    return false;
+}
 
 bool
 eigen_quaternion_compute_normalized_weighted_average(
@@ -800,8 +1333,9 @@ eigen_quaternion_compute_normalized_weighted_average(
     else if (count > 2)
     {
         // http://stackoverflow.com/questions/12374087/average-of-multiple-quaternions
-        Eigen::MatrixXf q(4, count);
-        Eigen::MatrixXf q_transpose(count, 4);
+        Eigen::Matrix4f M= Eigen::Matrix4f::Zero();
+        Eigen::Vector4f seed= Eigen::Vector4f::Zero();
+        float seed_weight= -1.f;
 
         float total_weight= 0.f;
 		if (weights != nullptr)
@@ -819,40 +1353,22 @@ eigen_quaternion_compute_normalized_weighted_average(
             const Eigen::Quaternionf &sample = quaternions[index];
 			const float weight = (weights != nullptr) ? weights[index] : 0.f;
             const float normalized_weight= safe_divide_with_default(weight, total_weight, 1.f);
+            const Eigen::Vector4f q(sample.w(), sample.x(), sample.y(), sample.z());
+            const Eigen::Vector4f weighted_q= q * normalized_weight;
 
-            const float w= sample.w() * normalized_weight;
-            const float x= sample.x() * normalized_weight;
-            const float y= sample.y() * normalized_weight;
-            const float z= sample.z() * normalized_weight;
-
-            q(0, index) = w;
-            q(1, index) = x;
-            q(2, index) = y;
-            q(3, index) = z;
-
-            q_transpose(index, 0) = w;
-            q_transpose(index, 1) = x;
-            q_transpose(index, 2) = y;
-            q_transpose(index, 3) = z;
-        }
-
-        Eigen::Matrix4f M= q*q_transpose;
+            M.noalias()+= weighted_q*weighted_q.transpose();
 
-        Eigen::EigenSolver<Eigen::Matrix4f> eigsolv(M);
-        if (eigsolv.info() == Eigen::Success)
-        {
-            int largest_row = 0;
-            float largest_eigenvalue = eigsolv.eigenvalues()[0].real();
-            for (int row_ix = 1; row_ix < 4; ++row_ix) 
+            // Seed the eigenvector search with the most trusted sample
+            if (normalized_weight > seed_weight)
             {
-                if (eigsolv.eigenvalues()[row_ix].real() > largest_eigenvalue)
-                {
-                    largest_eigenvalue = eigsolv.eigenvalues()[row_ix].real();
-                    largest_row = row_ix;
-                }                
+                seed= q;
+                seed_weight= normalized_weight;
             }
+        }
 
-            Eigen::Vector4f largest_eigenvector = eigsolv.eigenvectors().col(largest_row).real();
+        Eigen::Vector4f largest_eigenvector;
+        if (eigen_quaternion_accumulator_dominant_eigenvector(M, seed, largest_eigenvector))
+        {
             float w= largest_eigenvector(0);
             float x= largest_eigenvector(1);
             float y= largest_eigenvector(2);
@@ -883,8 +1399,9 @@ eigen_quaternion_compute_weighted_average(
     else
     {
         // http://stackoverflow.com/questions/12374087/average-of-multiple-quaternions
-        Eigen::MatrixXd q(4, count);
-        Eigen::MatrixXd q_transpose(count, 4);
+        Eigen::Matrix4d M= Eigen::Matrix4d::Zero();
+        Eigen::Vector4d seed= Eigen::Vector4d::Zero();
+        double seed_weight= -1.0;
 
         for (int index = 0; index < count; ++index)
         {
@@ -892,41 +1409,26 @@ eigen_quaternion_compute_weighted_average(
 			const double signed_weight= (weights != nullptr) ? weights[index] : 1.f;
             const double unsigned_weight= fabs(signed_weight);
 
-            const double w= sample.w() * unsigned_weight;
 			// For negative weights, use the conjugate of the quaternion 
 			// (i.e. flip the rotation axis)
-            const double x= sample.x() * signed_weight;
-            const double y= sample.y() * signed_weight;
-            const double z= sample.z() * signed_weight;
-
-            q(0, index) = w;
-            q(1, index) = x;
-            q(2, index) = y;
-            q(3, index) = z;
-
-            q_transpose(index, 0) = w;
-            q_transpose(index, 1) = x;
-            q_transpose(index, 2) = y;
-            q_transpose(index, 3) = z;
-        }
+            const Eigen::Vector4d weighted_q(
+                sample.w() * unsigned_weight,
+                sample.x() * signed_weight,
+                sample.y() * signed_weight,
+                sample.z() * signed_weight);
 
-        Eigen::Matrix4d M= q*q_transpose;
+            M.noalias()+= weighted_q*weighted_q.transpose();
 
-        Eigen::EigenSolver<Eigen::Matrix4d> eigsolv(M);
-        if (eigsolv.info() == Eigen::Success)
-        {
-            int largest_row = 0;
-            double largest_eigenvalue = eigsolv.eigenvalues()[0].real();
-            for (int row_ix = 1; row_ix < 4; ++row_ix) 
+            if (unsigned_weight > seed_weight)
             {
-                if (eigsolv.eigenvalues()[row_ix].real() > largest_eigenvalue)
-                {
-                    largest_eigenvalue = eigsolv.eigenvalues()[row_ix].real();
-                    largest_row = row_ix;
-                }                
+                seed= weighted_q;
+                seed_weight= unsigned_weight;
             }
+        }
 
-            Eigen::Vector4d largest_eigenvector = eigsolv.eigenvectors().col(largest_row).real();
+        Eigen::Vector4d largest_eigenvector;
+        if (eigen_quaternion_accumulator_dominant_eigenvector(M, seed, largest_eigenvector))
+        {
             double w= largest_eigenvector(0);
             double x= largest_eigenvector(1);
             double y= largest_eigenvector(2);
@@ -1116,29 +1618,34 @@ eigen_alignment_fit_least_squares_plane(
 
 	if (sample_count > 3)
 	{
-		Eigen::Matrix< float, Eigen::Dynamic, Eigen::Dynamic > coord(3, sample_count);
+		// calculate centroid
+		Eigen::Vector3d centroid= Eigen::Vector3d::Zero();
 		for (int i = 0; i < sample_count; ++i)
 		{
-			coord.col(i) = samples[i];
+			centroid+= samples[i].cast<double>();
 		}
+		centroid/= static_cast<double>(sample_count);
 
-		// calculate centroid
-		Eigen::Vector3f centroid(coord.row(0).mean(), coord.row(1).mean(), coord.row(2).mean());
+		// Scatter matrix of the samples about the centroid.
+		// Its eigenvectors are the left-singular vectors of the centered 3xN sample matrix,
+		// so the normal can be found without building (or decomposing) the 3xN matrix.
+		//  http://math.stackexchange.com/questions/99299/best-fitting-plane-given-a-set-of-points
+		Eigen::Matrix3d scatter= Eigen::Matrix3d::Zero();
+		for (int i = 0; i < sample_count; ++i)
+		{
+			const Eigen::Vector3d offset= samples[i].cast<double>() - centroid;
 
-		// subtract centroid
-		coord.row(0).array() -= centroid(0);
-		coord.row(1).array() -= centroid(1); 
-		coord.row(2).array() -= centroid(2);
+			scatter.noalias()+= offset*offset.transpose();
+		}
 
-		// we only need the left-singular matrix here
-		//  http://math.stackexchange.com/questions/99299/best-fitting-plane-given-a-set-of-points
-		auto svd = coord.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV);
-		Eigen::Vector3f plane_normal = svd.matrixU().rightCols<1>();
+		// The normal is the direction of least spread (eigenvalues are sorted in increasing order)
+		const Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eigen_solver(scatter);
+		Eigen::Vector3f plane_normal = eigen_solver.eigenvectors().col(0).cast<float>();
 		float length= plane_normal.norm();
 
-		if (length > k_real_epsilon)
+		if (eigen_solver.info() == Eigen::Success && length > k_real_epsilon)
 		{
-			*out_centroid= centroid;
+			*out_centroid= centroid.cast<float>();
 			*out_normal= plane_normal / length;
 			bSuccess= true;
 		}
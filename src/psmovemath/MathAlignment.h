@@ -4,6 +4,8 @@
 //-- includes -----
 #include "MathEigen.h"
 
+#include <vector>
+
 //-- structs -----
 struct EigenFitEllipsoid
 {
@@ -24,6 +26,47 @@ public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
+/// Running sums of the least squares axis aligned ellipsoid fit.
+/// Adding a point costs the same no matter how many points were already added,
+/// so the fit can be refreshed after every new sample.
+struct EigenFitEllipsoidAccumulator
+{
+    Eigen::Matrix<double, 6, 6> DtD;
+    Eigen::Matrix<double, 6, 1> Dt1;
+    int point_count;
+
+    void clear()
+    {
+        DtD.setZero();
+        Dt1.setZero();
+        point_count = 0;
+    }
+
+    void add_point(const Eigen::Vector3f &point)
+    {
+        const double X = point.x();
+        const double Y = point.y();
+        const double Z = point.z();
+        Eigen::Matrix<double, 6, 1> row;
+
+        row << X*X, Y*Y, Z*Z, 2.0*X, 2.0*Y, 2.0*Z;
+
+        DtD.noalias() += row*row.transpose();
+        Dt1 += row;
+        ++point_count;
+    }
+
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Scratch memory of the minimum volume ellipsoid fit.
+/// Keep one around to refit a growing sample set without reallocating the per point weights.
+struct EigenFitMinVolumeEllipsoidWorkspace
+{
+    std::vector<float> weights;
+};
+
 struct EigenFitEllipse
 {
     Eigen::Vector2f center;
@@ -45,6 +88,21 @@ public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
 
+/// Camera side of a P3P problem.
+/// Only depends on the three image points, so a RANSAC style search that tries
+/// many object point hypotheses against the same image points only sets it up once.
+struct EigenP3PBearings
+{
+    Eigen::Vector3d bearings[3]; // unit rays through the image points
+    double b12, b13, b23; // -2 * cosine of the angle between each pair of rays
+
+    // Takes normalized (undistorted, f=1) image coordinates
+    void set(const Eigen::Vector2f normalized_image_points[3]);
+
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
 //-- interface -----
 Eigen::Quaternionf
 eigen_alignment_quaternion_between_vectors(const Eigen::Vector3f &from, const Eigen::Vector3f &to);
@@ -74,8 +132,25 @@ eigen_alignment_fit_min_volume_ellipsoid(
     const float tolerance,
     EigenFitEllipsoid &out_ellipsoid);
 
+// Same fit as above using caller owned scratch memory.
+// Stops once an iteration moves the point weights by less than the tolerance.
+void
+eigen_alignment_fit_min_volume_ellipsoid(
+    const Eigen::Vector3f *points, const int point_count,
+    const float tolerance,
+    EigenFitMinVolumeEllipsoidWorkspace &workspace,
+    EigenFitEllipsoid &out_ellipsoid);
+
+void
+eigen_alignment_fit_least_squares_axis_aligned_ellipsoid(
+    const Eigen::Vector3f *points, const int point_count,
+    EigenFitEllipsoid &out_ellipsoid);
+
+// Same fit as above solved from the accumulated normal equations.
+// The points are only used to compute the fit error.
 void
 eigen_alignment_fit_least_squares_axis_aligned_ellipsoid(
+    const EigenFitEllipsoidAccumulator &accumulator,
     const Eigen::Vector3f *points, const int point_count,
     EigenFitEllipsoid &out_ellipsoid);
 
@@ -125,6 +200,30 @@ eigen_alignment_fit_focal_cone_to_sphere(
     Eigen::Vector3f *out_sphere_center,
     EigenFitEllipse *out_ellipse_projection= nullptr);
 
+// Allocation free version of the Doc_ok fit that works directly on packed (x, y) float pairs.
+// Solves the 3x3 normal equations of the fit rather than a QR decomposition of the Nx3 system.
+// Returns the RMS residual of the fit relative to focal_length_pts^2 (0 is a perfect fit),
+// or a negative value if the points were degenerate and no sphere was fit.
+float
+eigen_alignment_fit_focal_cone_to_sphere_fast(
+    const float *xy_points,
+    const int point_count,
+    const float sphere_radius,
+    const float focal_length_pts, // a.k.a. "f_px"
+    Eigen::Vector3f *out_sphere_center,
+    EigenFitEllipse *out_ellipse_projection= nullptr);
+
+// "Lambda Twist" P3P solver of Persson and Nordberg (ECCV 2018).
+// Finds every camera relative pose that puts the three object points in front of the camera
+// along the bearing rays: bearing_i ~ out_rotation*object_point_i + out_translation.
+// Allocation free. Returns the number of poses written (at most 4).
+int
+eigen_alignment_solve_p3p(
+    const EigenP3PBearings &bearings,
+    const Eigen::Vector3f object_points[3],
+    Eigen::Matrix3f out_rotations[4],
+    Eigen::Vector3f out_translations[4]);
+
 // Compute the weighted average of multiple quaternions
 // * All weights will be renormalized against the total weight
 // * All input weights must be >= 0
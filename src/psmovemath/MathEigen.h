@@ -92,50 +92,147 @@ eigen_quaternion_concatenate(const Eigen::Quaternion<T> &first, const Eigen::Qua
 	return first * second;
 }
 
-Eigen::Quaternionf
-eigen_quaternion_normalized_lerp(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b, const float u);
+// The per sample helpers below are inline for the same reason as the ones in MathUtility.h
+inline Eigen::Quaternionf
+eigen_quaternion_normalized_lerp(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b, const float u)
+{	
+	Eigen::Quaternionf q(a.coeffs()*(1.f - u) + b.coeffs()*u);
+	q.normalize();
+
+	return q;
+}
 
-Eigen::Quaternionf
-eigen_quaternion_safe_divide_with_default(const Eigen::Quaternionf &q, const float divisor, const Eigen::Quaternionf &default_result);
+inline Eigen::Quaternionf
+eigen_quaternion_safe_divide_with_default(const Eigen::Quaternionf &q, const float divisor, const Eigen::Quaternionf &default_result)
+{
+	Eigen::Quaternionf q_n;
 
-Eigen::Quaterniond
-eigen_quaterniond_safe_divide_with_default(const Eigen::Quaterniond &q, const double divisor, const Eigen::Quaterniond &default_result);
+	if (!is_nearly_zero(divisor))
+	{
+		q_n = Eigen::Quaternionf(q.coeffs() / divisor);
+	}
+	else
+	{
+		q_n = default_result;
+	}
 
-float
-eigen_quaternion_normalize_with_default(Eigen::Quaternionf &inout_v, const Eigen::Quaternionf &default_result);
+	return q_n;
+}
 
-double
-eigen_quaterniond_normalize_with_default(Eigen::Quaterniond &inout_v, const Eigen::Quaterniond &default_result);
+inline Eigen::Quaterniond
+eigen_quaterniond_safe_divide_with_default(const Eigen::Quaterniond &q, const double divisor, const Eigen::Quaterniond &default_result)
+{
+	Eigen::Quaterniond q_n;
 
-bool
-eigen_vector3f_is_valid(const Eigen::Vector3f &v);
+	if (!is_double_nearly_zero(divisor))
+	{
+		q_n = Eigen::Quaterniond(q.coeffs() / divisor);
+	}
+	else
+	{
+		q_n = default_result;
+	}
 
-bool
-eigen_quaternion_is_valid(const Eigen::Quaternionf &q);
+	return q_n;
+}
 
-Eigen::Vector3f
-eigen_vector3f_clockwise_rotate(const Eigen::Quaternionf &q, const Eigen::Vector3f &v);
+inline float
+eigen_quaternion_normalize_with_default(Eigen::Quaternionf &inout_v, const Eigen::Quaternionf &default_result)
+{
+	const float magnitude = inout_v.norm();
+	inout_v = eigen_quaternion_safe_divide_with_default(inout_v, magnitude, default_result);
+	return magnitude;
+}
 
-Eigen::Vector3d
-eigen_vector3d_clockwise_rotate(const Eigen::Quaterniond &q, const Eigen::Vector3d &v);
+inline double
+eigen_quaterniond_normalize_with_default(Eigen::Quaterniond &inout_v, const Eigen::Quaterniond &default_result)
+{
+	const double magnitude = inout_v.norm();
+	inout_v = eigen_quaterniond_safe_divide_with_default(inout_v, magnitude, default_result);
+	return magnitude;
+}
 
-Eigen::Matrix3f
-eigen_quaternion_to_clockwise_matrix3f(const Eigen::Quaternionf &q);
+inline bool
+eigen_vector3f_is_valid(const Eigen::Vector3f &v)
+{
+    return is_valid_float(v.x()) && is_valid_float(v.y()) && is_valid_float(v.z());
+}
 
-Eigen::Quaternionf
-eigen_matrix3f_to_clockwise_quaternion(const Eigen::Matrix3f &m);
+inline bool
+eigen_quaternion_is_valid(const Eigen::Quaternionf &q)
+{
+	return is_valid_float(q.x()) && is_valid_float(q.y()) && is_valid_float(q.z()) && is_valid_float(q.w());
+}
 
-Eigen::Vector3f
+inline Eigen::Vector3f
+eigen_vector3f_clockwise_rotate(const Eigen::Quaternionf &q, const Eigen::Vector3f &v)
+{
+	assert_eigen_quaternion_is_normalized(q);
+
+	// Eigen rotates counterclockwise (i.e. q*v*q^-1), 
+	// while we want the inverse of that (q^-1*v*q)
+	return q.conjugate()._transformVector(v);
+}
+
+inline Eigen::Vector3d
+eigen_vector3d_clockwise_rotate(const Eigen::Quaterniond &q, const Eigen::Vector3d &v)
+{
+	assert_eigen_quaterniond_is_normalized(q);
+
+	// Eigen rotates counterclockwise (i.e. q*v*q^-1), 
+	// while we want the inverse of that (q^-1*v*q)
+	return q.conjugate()._transformVector(v);
+}
+
+inline Eigen::Matrix3f
+eigen_quaternion_to_clockwise_matrix3f(const Eigen::Quaternionf &q)
+{
+	return q.conjugate().toRotationMatrix();
+}
+
+inline Eigen::Quaternionf
+eigen_matrix3f_to_clockwise_quaternion(const Eigen::Matrix3f &m)
+{
+	Eigen::Quaternionf q(m);
+
+	return q.conjugate();
+}
+
+inline Eigen::Vector3f
 eigen_vector3f_divide_by_vector_with_default(
-    const Eigen::Vector3f &v, 
-    const Eigen::Vector3f &divisor, 
-    const Eigen::Vector3f &default_result);
+	const Eigen::Vector3f &v,
+	const Eigen::Vector3f &divisor,
+	const Eigen::Vector3f &default_result)
+{
+	Eigen::Vector3f result(
+		safe_divide_with_default(v.x(), divisor.x(), default_result.x()),
+		safe_divide_with_default(v.y(), divisor.y(), default_result.y()),
+		safe_divide_with_default(v.z(), divisor.z(), default_result.z()));
+
+	return result;
+}
+
+inline float
+eigen_vector3f_normalize_with_default(Eigen::Vector3f &v, const Eigen::Vector3f &default_result)
+{
+	const float length = v.norm();
 
-float 
-eigen_vector3f_normalize_with_default(Eigen::Vector3f &v, const Eigen::Vector3f &default_value);
+	// Use the default value if v is too tiny
+	v = (length > k_normal_epsilon) ? (v / length) : default_result;
 
-double 
-eigen_vector3d_normalize_with_default(Eigen::Vector3d &v, const Eigen::Vector3d &default_value);
+	return length;
+}
+
+inline double
+eigen_vector3d_normalize_with_default(Eigen::Vector3d &v, const Eigen::Vector3d &default_result)
+{
+	const double length = v.norm();
+
+	// Use the default value if v is too tiny
+	v = (length > 0.0001) ? (v / length) : default_result;
+
+	return length;
+}
 
 float
 eigen_quaternion_unsigned_angle_between(const Eigen::Quaternionf &a, const Eigen::Quaternionf &b);
@@ -58,20 +58,84 @@
 #endif
 
 //-- float methods -----
-float safe_divide_with_default(float numerator, float denomenator, float default_result);
-double safe_divide_with_default(double numerator, double denomenator, double default_result);
-float safe_sqrt_with_default(float square, float default_result);
-double safe_sqrt_with_default(double square, double default_result);
-float clampf(float x, float lo, float hi);
-float clampf01(float x);
-float lerpf(float a, float b, float u);
-float lerp_clampf(float a, float b, float u);
-float degrees_to_radians(float x);
-float radians_to_degrees(float x);
-float wrap_radians(float angle);
-float wrap_degrees(float angle);
-float wrap_range(float value, float range_min, float range_max);
-double wrap_ranged(double value, double range_min, double range_max);
+// The small helpers are defined inline here since the filters and the tracker
+// call them per sample and they would otherwise be a call into the math library.
+inline float safe_divide_with_default(float numerator, float denomenator, float default_result)
+{
+    return is_nearly_zero(denomenator) ? default_result : (numerator / denomenator);
+}
+
+inline double safe_divide_with_default(double numerator, double denomenator, double default_result)
+{
+    return is_double_nearly_zero(denomenator) ? default_result : (numerator / denomenator);
+}
+
+inline float safe_sqrt_with_default(float square, float default_result)
+{
+    return (square > k_real_epsilon) ? sqrtf(square) : default_result;
+}
+
+inline double safe_sqrt_with_default(double square, double default_result)
+{
+    return (square > k_real64_epsilon) ? sqrt(square) : default_result;
+}
+
+inline float clampf(float x, float lo, float hi)
+{
+    return fminf(fmaxf(x, lo), hi);
+}
+
+inline float clampf01(float x)
+{
+    return clampf(x, 0.f, 1.f);
+}
+
+inline float lerpf(float a, float b, float u)
+{
+    return a*(1.f - u) + b*u;
+}
+
+inline float lerp_clampf(float a, float b, float u)
+{
+    return clampf(lerpf(a, b, u), a, b);
+}
+
+inline float degrees_to_radians(float x)
+{
+    return ((x * k_real_pi) / 180.f);
+}
+
+inline float radians_to_degrees(float x)
+{
+    return ((x * 180.f) / k_real_pi);
+}
+
+inline float wrap_radians(float angle)
+{
+    return fmodf(angle + k_real_two_pi, k_real_two_pi);
+}
+
+inline float wrap_degrees(float angle)
+{
+    return fmodf(angle + 360.f, 360.f);
+}
+
+inline float wrap_range(float value, float range_min, float range_max)
+{
+    assert(range_max > range_min);
+    const float range = range_max - range_min;
+
+    return range_min + fmodf((value - range_min) + range, range);
+}
+
+inline double wrap_ranged(double value, double range_min, double range_max)
+{
+    assert(range_max > range_min);
+    const double range = range_max - range_min;
+
+    return range_min + fmod((value - range_min) + range, range);
+}
+
 float wrap_lerpf(float a, float b, float u, float range_min, float range_max);
 
 #endif // MATH_UTILITY_h
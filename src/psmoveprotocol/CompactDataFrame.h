@@ -0,0 +1,128 @@
+#ifndef COMPACT_DATA_FRAME_H
+#define COMPACT_DATA_FRAME_H
+
+//-- includes -----
+#include <stdint.h>
+
+//-- constants -----
+// First byte of a compact data frame datagram.
+// Protobuf data frames start with a big-endian length header whose first byte is always 0
+// (MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE < 2^24), so the two datagram kinds can't be confused.
+#define COMPACT_DATA_FRAME_MARKER   0xFF
+
+// First byte of a CompactControllerOrientationFrame, sent on dual rate streams in between pose frames
+#define COMPACT_ORIENTATION_FRAME_MARKER   0xFE
+
+// Bump this whenever the layout of CompactControllerPoseFrame, CompactControllerOrientationFrame,
+// CompactHMDPoseFrame or CompactMulticastSnapshotHeader changes
+#define COMPACT_DATA_FRAME_VERSION  2
+
+// Bits in CompactControllerPoseFrame::flags
+#define COMPACT_POSE_FLAG_IS_CONNECTED               0x01
+#define COMPACT_POSE_FLAG_VALID_HARDWARE_CALIBRATION 0x02
+#define COMPACT_POSE_FLAG_IS_TRACKING_ENABLED        0x04
+#define COMPACT_POSE_FLAG_IS_CURRENTLY_TRACKING      0x08
+#define COMPACT_POSE_FLAG_IS_ORIENTATION_VALID       0x10
+#define COMPACT_POSE_FLAG_IS_POSITION_VALID          0x20
+
+//-- definitions -----
+/// Fixed layout controller pose update, sent in place of a protobuf DeviceOutputDataFrame
+/// when a controller stream is started with use_compact_pose_stream.
+/**
+ Only carries what a game usually needs every frame: pose, linear velocity, buttons and trigger.
+ Fields are little-endian and the struct is sent as-is, so decoding is a single memcpy.
+ The button bitmask uses the same bit indices as ControllerDataPacket::ButtonType.
+ */
+#pragma pack(push, 1)
+struct CompactControllerPoseFrame
+{
+    uint8_t marker;             // COMPACT_DATA_FRAME_MARKER
+    uint8_t version;            // COMPACT_DATA_FRAME_VERSION
+    uint8_t controller_id;
+    uint8_t controller_type;    // ControllerType enum value
+    int32_t sequence_num;
+    uint32_t flags;             // COMPACT_POSE_FLAG_* bits
+    uint32_t button_down_bitmask;
+    float orientation[4];       // w, x, y, z
+    float position_cm[3];
+    float velocity_cm_per_sec[3];
+    uint8_t trigger_value;      // [0, 255]
+    uint8_t battery_value;
+    uint16_t reserved;
+    float sensor_data_age_ms;   // Time since the last IMU sample at send time, -1 if unknown
+    int64_t service_time_us;    // DeviceOutputDataFrame::service_time_us
+};
+#pragma pack(pop)
+
+static_assert(sizeof(CompactControllerPoseFrame) == 72, "CompactControllerPoseFrame must stay 72 bytes");
+
+/// Orientation only controller update, for streams started with use_dual_rate_pose_stream.
+/**
+ The orientation comes out of the filter at the IMU rate, but the position only moves when
+ a tracker frame lands (30-60Hz). Rather than resending the unchanged position, velocity and buttons
+ with every IMU update, a dual rate stream sends a full CompactControllerPoseFrame when a new
+ optical measurement got fused (or the buttons, trigger or flags changed) and this much smaller
+ frame in between. The client keeps the rest of the state from the last full frame.
+ */
+#pragma pack(push, 1)
+struct CompactControllerOrientationFrame
+{
+    uint8_t marker;             // COMPACT_ORIENTATION_FRAME_MARKER
+    uint8_t version;            // COMPACT_DATA_FRAME_VERSION
+    uint8_t controller_id;
+    uint8_t flags;              // COMPACT_POSE_FLAG_* bits (all of them fit in a byte)
+    int32_t sequence_num;
+    float orientation[4];       // w, x, y, z
+    int64_t service_time_us;    // DeviceOutputDataFrame::service_time_us
+};
+#pragma pack(pop)
+
+static_assert(sizeof(CompactControllerOrientationFrame) == 32, "CompactControllerOrientationFrame must stay 32 bytes");
+
+/// Fixed layout HMD pose update.
+/**
+ Only used by the shared memory pose channel (see SharedPoseState.h) so far.
+ Same conventions as CompactControllerPoseFrame. HMDs have no buttons,
+ so the tail of the frame is reserved.
+ */
+#pragma pack(push, 1)
+struct CompactHMDPoseFrame
+{
+    uint8_t marker;             // COMPACT_DATA_FRAME_MARKER
+    uint8_t version;            // COMPACT_DATA_FRAME_VERSION
+    uint8_t hmd_id;
+    uint8_t hmd_type;           // HMDType enum value
+    int32_t sequence_num;
+    uint32_t flags;             // COMPACT_POSE_FLAG_* bits
+    float orientation[4];       // w, x, y, z
+    float position_cm[3];
+    float velocity_cm_per_sec[3];
+    float sensor_data_age_ms;   // Time since the last IMU sample at send time, -1 if unknown
+    int64_t service_time_us;    // DeviceOutputDataFrame::service_time_us
+};
+#pragma pack(pop)
+
+static_assert(sizeof(CompactHMDPoseFrame) == 64, "CompactHMDPoseFrame must stay 64 bytes");
+
+/// Header of a pose snapshot datagram on the optional LAN multicast stream (see NetworkManagerConfig).
+/**
+ The service sends at most one snapshot datagram per update, holding the pose frames of every
+ device that published new state that update: controller_frame_count CompactControllerPoseFrames
+ followed by hmd_frame_count CompactHMDPoseFrames, laid out right after this header.
+ sequence_num goes up by one for every snapshot sent, so a receiver can count dropped datagrams.
+ */
+#pragma pack(push, 1)
+struct CompactMulticastSnapshotHeader
+{
+    uint8_t marker;                 // COMPACT_DATA_FRAME_MARKER
+    uint8_t version;                // COMPACT_DATA_FRAME_VERSION
+    uint8_t controller_frame_count;
+    uint8_t hmd_frame_count;
+    uint32_t sequence_num;
+    int64_t service_time_us;        // When the snapshot was sent
+};
+#pragma pack(pop)
+
+static_assert(sizeof(CompactMulticastSnapshotHeader) == 16, "CompactMulticastSnapshotHeader must stay 16 bytes");
+
+#endif  // COMPACT_DATA_FRAME_H
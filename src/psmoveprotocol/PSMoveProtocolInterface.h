@@ -26,6 +26,8 @@ namespace PSMoveProtocol
 	class Request;
 	class Response;
 };
+struct CompactControllerPoseFrame;
+struct CompactControllerOrientationFrame;
 
 typedef std::shared_ptr<PSMoveProtocol::DeviceOutputDataFrame> DeviceOutputDataFramePtr;
 typedef std::shared_ptr<PSMoveProtocol::DeviceInputDataFrame> DeviceInputDataFramePtr;
@@ -43,6 +45,8 @@ class IDataFrameListener
 {
 public:
     virtual void handle_data_frame(const PSMoveProtocol::DeviceOutputDataFrame *data_frame) = 0;
+    virtual void handle_compact_pose_frame(const CompactControllerPoseFrame *pose_frame) = 0;
+    virtual void handle_compact_orientation_frame(const CompactControllerOrientationFrame *orientation_frame) = 0;
 };
 
 class IResponseListener
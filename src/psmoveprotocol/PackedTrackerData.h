@@ -0,0 +1,139 @@
+#ifndef PACKED_TRACKER_DATA_H
+#define PACKED_TRACKER_DATA_H
+
+//-- includes -----
+#include <stdint.h>
+#include <math.h>
+
+//-- constants -----
+// Fixed point units of the packed_* raw tracker data fields.
+// 1/8 of a pixel is well below the noise of a blob centroid
+// and keeps the coordinates of a 640x480 frame in two varint bytes.
+#define PACKED_TRACKER_DATA_UNITS_PER_PIXEL 8.f
+// 1/10 of a millimeter
+#define PACKED_TRACKER_DATA_UNITS_PER_CM    100.f
+
+// Values per packed tracker sample: tracker_id, screen x, screen y, relative position x, y, z
+#define PACKED_TRACKER_SAMPLE_VALUE_COUNT   6
+
+//-- interface -----
+/// Encoding of the packed_* raw tracker data fields, sent instead of the Pixel/Polygon/TrackerSample
+/// messages when a data stream is started with use_packed_tracker_data.
+/**
+ The fields are proto3 repeated sint32 values, so each one is a zigzag varint in a single packed run.
+ A point list is x0, y0, then the delta to the previous point for every further point,
+ so the LED points of one device (that sit close together) mostly take a byte or two per coordinate.
+ A float Pixel costs 12 bytes as a Polygon vertex, a packed point usually 3-4.
+ The helpers take any repeated field with Add(), size() and Get() (i.e. google::protobuf::RepeatedField<int32>).
+ */
+inline int32_t packed_tracker_data_quantize(float value, float units)
+{
+    // Keep well clear of the int32 limits so the point deltas can't overflow
+    const float k_max_quantized_value = 1.0e9f;
+    const float quantized = value * units;
+
+    if (quantized != quantized)
+    {
+        return 0;
+    }
+    if (quantized > k_max_quantized_value)
+    {
+        return static_cast<int32_t>(k_max_quantized_value);
+    }
+    if (quantized < -k_max_quantized_value)
+    {
+        return -static_cast<int32_t>(k_max_quantized_value);
+    }
+
+    return static_cast<int32_t>(floorf(quantized + 0.5f));
+}
+
+inline float packed_tracker_data_dequantize(int32_t value, float units)
+{
+    return static_cast<float>(value) / units;
+}
+
+/// Appends point_count points (anything with float x and y) as a delta coded point list
+template <typename t_repeated_int32, typename t_point>
+void packed_tracker_data_append_points(t_repeated_int32 *out_values, const t_point *points, int point_count)
+{
+    int32_t last_x = 0;
+    int32_t last_y = 0;
+
+    for (int point_index = 0; point_index < point_count; ++point_index)
+    {
+        const int32_t x = packed_tracker_data_quantize(points[point_index].x, PACKED_TRACKER_DATA_UNITS_PER_PIXEL);
+        const int32_t y = packed_tracker_data_quantize(points[point_index].y, PACKED_TRACKER_DATA_UNITS_PER_PIXEL);
+
+        out_values->Add(x - last_x);
+        out_values->Add(y - last_y);
+        last_x = x;
+        last_y = y;
+    }
+}
+
+template <typename t_repeated_int32>
+int packed_tracker_data_point_count(const t_repeated_int32 &values)
+{
+    return values.size() / 2;
+}
+
+/// Decodes up to max_points points, returns how many got written
+template <typename t_repeated_int32, typename t_point>
+int packed_tracker_data_read_points(const t_repeated_int32 &values, t_point *out_points, int max_points)
+{
+    const int point_count = packed_tracker_data_point_count(values) < max_points ? packed_tracker_data_point_count(values) : max_points;
+    int32_t x = 0;
+    int32_t y = 0;
+
+    for (int point_index = 0; point_index < point_count; ++point_index)
+    {
+        x += values.Get(2*point_index);
+        y += values.Get(2*point_index + 1);
+        out_points[point_index].x = packed_tracker_data_dequantize(x, PACKED_TRACKER_DATA_UNITS_PER_PIXEL);
+        out_points[point_index].y = packed_tracker_data_dequantize(y, PACKED_TRACKER_DATA_UNITS_PER_PIXEL);
+    }
+
+    return point_count;
+}
+
+template <typename t_repeated_int32>
+void packed_tracker_data_append_sample(
+    t_repeated_int32 *out_values,
+    int tracker_id,
+    float screen_x, float screen_y,
+    float position_x_cm, float position_y_cm, float position_z_cm)
+{
+    out_values->Add(tracker_id);
+    out_values->Add(packed_tracker_data_quantize(screen_x, PACKED_TRACKER_DATA_UNITS_PER_PIXEL));
+    out_values->Add(packed_tracker_data_quantize(screen_y, PACKED_TRACKER_DATA_UNITS_PER_PIXEL));
+    out_values->Add(packed_tracker_data_quantize(position_x_cm, PACKED_TRACKER_DATA_UNITS_PER_CM));
+    out_values->Add(packed_tracker_data_quantize(position_y_cm, PACKED_TRACKER_DATA_UNITS_PER_CM));
+    out_values->Add(packed_tracker_data_quantize(position_z_cm, PACKED_TRACKER_DATA_UNITS_PER_CM));
+}
+
+template <typename t_repeated_int32>
+int packed_tracker_data_sample_count(const t_repeated_int32 &values)
+{
+    return values.size() / PACKED_TRACKER_SAMPLE_VALUE_COUNT;
+}
+
+template <typename t_repeated_int32>
+void packed_tracker_data_read_sample(
+    const t_repeated_int32 &values,
+    int sample_index,
+    int &out_tracker_id,
+    float out_screen_location[2],
+    float out_position_cm[3])
+{
+    const int base = sample_index*PACKED_TRACKER_SAMPLE_VALUE_COUNT;
+
+    out_tracker_id = values.Get(base);
+    out_screen_location[0] = packed_tracker_data_dequantize(values.Get(base + 1), PACKED_TRACKER_DATA_UNITS_PER_PIXEL);
+    out_screen_location[1] = packed_tracker_data_dequantize(values.Get(base + 2), PACKED_TRACKER_DATA_UNITS_PER_PIXEL);
+    out_position_cm[0] = packed_tracker_data_dequantize(values.Get(base + 3), PACKED_TRACKER_DATA_UNITS_PER_CM);
+    out_position_cm[1] = packed_tracker_data_dequantize(values.Get(base + 4), PACKED_TRACKER_DATA_UNITS_PER_CM);
+    out_position_cm[2] = packed_tracker_data_dequantize(values.Get(base + 5), PACKED_TRACKER_DATA_UNITS_PER_CM);
+}
+
+#endif  // PACKED_TRACKER_DATA_H
@@ -0,0 +1,108 @@
+#ifndef POSE_RECORD_FORMAT_H
+#define POSE_RECORD_FORMAT_H
+
+//-- includes -----
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+//-- constants -----
+// First word of a chunk file and of the index file
+#define POSE_RECORD_CHUNK_MAGIC     0x524D5350  // "PSMR"
+#define POSE_RECORD_INDEX_MAGIC     0x494D5350  // "PSMI"
+
+// Bump this whenever the layout of PoseRecord, PoseRecordChunkHeader or the index changes
+#define POSE_RECORD_FORMAT_VERSION  1
+
+// PoseRecord::device_class values
+#define POSE_RECORD_DEVICE_CONTROLLER   0
+#define POSE_RECORD_DEVICE_HMD          1
+
+//-- definitions -----
+/// One filtered pose published by the service, as stored by the pose recorder (see DeviceManagerConfig::record_poses).
+/**
+ A recording is a set of chunk files (<base>.<chunk index>.psmr) plus an index file (<base>.psmi).
+ Each chunk is a PoseRecordChunkHeader followed by record_count fixed size records,
+ appended in publish order, so the records of a chunk are sorted by service_time_us
+ and can be binary searched. flags uses the COMPACT_POSE_FLAG_* bits of CompactDataFrame.h.
+ Fields are little-endian and the structs are written as-is.
+ */
+#pragma pack(push, 1)
+struct PoseRecord
+{
+    int64_t service_time_us;    // When the pose was published (DeviceOutputDataFrame::service_time_us)
+    int32_t sequence_num;       // The device's data frame sequence number
+    uint8_t device_class;       // POSE_RECORD_DEVICE_*
+    uint8_t device_id;
+    uint8_t device_type;        // ControllerType or HMDType enum value
+    uint8_t reserved;
+    uint32_t flags;             // COMPACT_POSE_FLAG_* bits
+    float orientation[4];       // w, x, y, z
+    float position_cm[3];
+    float velocity_cm_per_sec[3];
+    float sensor_data_age_ms;   // Time since the last IMU sample at publish time, -1 if unknown
+};
+#pragma pack(pop)
+
+static_assert(sizeof(PoseRecord) == 64, "PoseRecord must stay 64 bytes");
+
+/// Start of every chunk file, the records follow right after it
+#pragma pack(push, 1)
+struct PoseRecordChunkHeader
+{
+    uint32_t magic;             // POSE_RECORD_CHUNK_MAGIC
+    uint32_t version;           // POSE_RECORD_FORMAT_VERSION
+    uint32_t chunk_index;
+    uint32_t record_size;       // sizeof(PoseRecord)
+    uint64_t record_count;      // Records written so far, updated after every append
+    int64_t first_time_us;      // service_time_us of the first and last record (0 while empty)
+    int64_t last_time_us;
+    uint8_t reserved[24];
+};
+#pragma pack(pop)
+
+static_assert(sizeof(PoseRecordChunkHeader) == 64, "PoseRecordChunkHeader must stay 64 bytes");
+
+/// Start of the index file, followed by chunk_count PoseRecordIndexEntry in chunk order
+#pragma pack(push, 1)
+struct PoseRecordIndexHeader
+{
+    uint32_t magic;             // POSE_RECORD_INDEX_MAGIC
+    uint32_t version;           // POSE_RECORD_FORMAT_VERSION
+    uint32_t chunk_count;
+    uint32_t reserved;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(PoseRecordIndexHeader) == 16, "PoseRecordIndexHeader must stay 16 bytes");
+
+/// Time span of one chunk file, so a reader can pick the chunk to seek in without opening the others.
+/// Chunks dropped by the rotation (DeviceManagerConfig::pose_record_max_chunk_count) aren't listed.
+#pragma pack(push, 1)
+struct PoseRecordIndexEntry
+{
+    uint32_t chunk_index;
+    uint32_t reserved;
+    uint64_t record_count;
+    int64_t first_time_us;
+    int64_t last_time_us;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(PoseRecordIndexEntry) == 32, "PoseRecordIndexEntry must stay 32 bytes");
+
+//-- public interface -----
+inline std::string pose_record_get_chunk_path(const std::string &base_path, const uint32_t chunk_index)
+{
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%04u.psmr", static_cast<unsigned int>(chunk_index));
+
+    return base_path + suffix;
+}
+
+inline std::string pose_record_get_index_path(const std::string &base_path)
+{
+    return base_path + ".psmi";
+}
+
+#endif // POSE_RECORD_FORMAT_H
@@ -4,9 +4,23 @@
 #define PSMOVESERVICE_DEFAULT_ADDRESS   "localhost"
 #define PSMOVESERVICE_DEFAULT_PORT      "9512"
 
+// Hosts starting with this prefix connect to the service's unix domain socket at the path after it
+// (e.g. "unix:/tmp/psmoveservice.sock") instead of over TCP/UDP. The port goes unused.
+// Only for clients running on the same machine as the service.
+#define PSMOVESERVICE_LOCAL_ADDRESS_PREFIX      "unix:"
+#define PSMOVESERVICE_DEFAULT_LOCAL_SOCKET_PATH "/tmp/psmoveservice.sock"
+#define PSMOVESERVICE_DEFAULT_LOCAL_ADDRESS     PSMOVESERVICE_LOCAL_ADDRESS_PREFIX PSMOVESERVICE_DEFAULT_LOCAL_SOCKET_PATH
+
+// The data frames of local connections go through a datagram socket at the request socket's path plus this suffix
+#define PSMOVESERVICE_LOCAL_DATA_FRAME_SOCKET_SUFFIX    ".dgram"
+
 #define MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE 500
 #define MAX_INPUT_DATA_FRAME_MESSAGE_SIZE 64
 
+// Max size of a UDP datagram carrying several batched output data frames.
+// Stays under a typical 1500 byte Ethernet MTU to avoid IP fragmentation.
+#define MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE 1400
+
 // See ControllerManager.h in PSMoveService
 #define PSMOVESERVICE_MAX_CONTROLLER_COUNT  5
 
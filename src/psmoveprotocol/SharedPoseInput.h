@@ -0,0 +1,124 @@
+#ifndef SHARED_POSE_INPUT_H
+#define SHARED_POSE_INPUT_H
+
+#include "SharedPoseState.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+
+//-- constants -----
+// Name of the shared memory block external trackers write virtual device poses into
+#define PSMOVESERVICE_SHARED_POSE_INPUT_NAME "psmoveservice_pose_input"
+
+// Bumped whenever the layout of the block changes
+#define SHARED_POSE_INPUT_VERSION 1
+
+// Samples each device ring holds. At 1kHz that's a 128ms hiccup of the service before samples get lost.
+#define SHARED_POSE_INPUT_RING_CAPACITY 128
+
+// ExternalPoseSample::flags
+#define EXTERNAL_POSE_FLAG_HAS_POSITION     0x01
+#define EXTERNAL_POSE_FLAG_HAS_ORIENTATION  0x02
+
+//-- definitions -----
+/// One pose measured by an external tracking system, in the PSMoveService world space
+struct ExternalPoseSample
+{
+    // When the pose got measured, in microseconds of std::chrono::steady_clock
+    // (see getExternalPoseTimestampNow()). That clock is shared by every process on the machine.
+    int64_t timestamp_us;
+    float position_cm[3];
+    float orientation[4]; // w, x, y, z
+    // How noisy the position is, cm^2 (<= 0 uses the device's configured variance)
+    float position_variance_cm_sqr;
+    uint32_t flags; // EXTERNAL_POSE_FLAG_*
+};
+
+inline int64_t getExternalPoseTimestampNow()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// Single producer, single consumer ring of the external poses of one device.
+/**
+ The producer never waits on the service: it overwrites the oldest sample when the ring is full.
+ Each sample sits in a seqlock slot, so a reader that got lapped mid read sees the failed read
+ instead of a torn sample. The write count only ever grows (wrapping at 2^32).
+ */
+class SharedPoseInputRing
+{
+public:
+    SharedPoseInputRing()
+    {
+        write_count.store(0);
+    }
+
+    // Producer side
+    void push(const ExternalPoseSample &sample)
+    {
+        const uint32_t sample_index = write_count.load(std::memory_order_relaxed);
+
+        slots[sample_index % SHARED_POSE_INPUT_RING_CAPACITY].write(sample);
+        write_count.store(sample_index + 1, std::memory_order_release);
+    }
+
+    // Consumer side: copies out up to max_count of the samples written since read_count and advances it.
+    // Samples the producer already overwrote get skipped.
+    int read(uint32_t &read_count, ExternalPoseSample *out_samples, const int max_count) const
+    {
+        const uint32_t end_count = write_count.load(std::memory_order_acquire);
+        int sample_count = 0;
+
+        if (end_count - read_count > SHARED_POSE_INPUT_RING_CAPACITY)
+        {
+            read_count = end_count - SHARED_POSE_INPUT_RING_CAPACITY;
+        }
+
+        while (read_count != end_count && sample_count < max_count)
+        {
+            uint32_t version;
+
+            if (slots[read_count % SHARED_POSE_INPUT_RING_CAPACITY].tryRead(out_samples[sample_count], version))
+            {
+                ++sample_count;
+            }
+
+            ++read_count;
+        }
+
+        return sample_count;
+    }
+
+    inline uint32_t getWriteCount() const
+    {
+        return write_count.load(std::memory_order_acquire);
+    }
+
+    std::atomic<uint32_t> write_count;
+    SharedPoseSlot<ExternalPoseSample> slots[SHARED_POSE_INPUT_RING_CAPACITY];
+};
+
+/// Layout of the shared memory block the service reads injected virtual device poses from.
+/**
+ Created by the service (when DeviceManagerConfig::shared_memory_pose_input_enabled is set),
+ opened read/write by the producers. One ring per device id: the samples in a controller ring drive
+ the virtual controller with that id, the ones in an HMD ring the virtual HMD with that id.
+ Rings of any other kind of device get ignored.
+ A producer should check layout_version before writing.
+ */
+class SharedPoseInputHeader
+{
+public:
+    SharedPoseInputHeader()
+        : layout_version(SHARED_POSE_INPUT_VERSION)
+    {
+    }
+
+    uint32_t layout_version; // SHARED_POSE_INPUT_VERSION of the service that created the block
+    SharedPoseInputRing controller_rings[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    SharedPoseInputRing hmd_rings[PSMOVESERVICE_MAX_HMD_COUNT];
+};
+
+#endif // SHARED_POSE_INPUT_H
@@ -0,0 +1,116 @@
+#ifndef SHARED_POSE_STATE_H
+#define SHARED_POSE_STATE_H
+
+#if defined(WIN32) && !defined(BOOST_INTERPROCESS_SHARED_DIR_PATH)
+#define BOOST_INTERPROCESS_SHARED_DIR_PATH "shared_mem"
+#endif // WIN32
+
+#include "CompactDataFrame.h"
+#include "SharedConstants.h"
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+//-- constants -----
+// Name of the shared memory block the service publishes device poses into
+#define PSMOVESERVICE_SHARED_POSE_STATE_NAME "psmoveservice_pose_state"
+
+//-- definitions -----
+/// Seqlock protected slot holding the latest pose frame of one device.
+/**
+ There is only ever one writer (the service main thread), so writing never waits.
+ The version counter is odd while a write is in progress and 0 if the slot was never written.
+ Readers copy the frame and then re-check the version, retrying if the writer got in the way.
+ The frame is stored as relaxed atomic words so a racing copy is still well defined.
+ */
+template <typename t_frame>
+class SharedPoseSlot
+{
+public:
+    static const int k_word_count = (sizeof(t_frame) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    SharedPoseSlot()
+    {
+        version.store(0);
+
+        for (int word_index = 0; word_index < k_word_count; ++word_index)
+        {
+            words[word_index].store(0);
+        }
+    }
+
+    void write(const t_frame &frame)
+    {
+        uint32_t frame_words[k_word_count] = { 0 };
+        memcpy(frame_words, &frame, sizeof(t_frame));
+
+        const uint32_t old_version = version.load(std::memory_order_relaxed);
+        // Skip 0 on wrap around, it means "never written"
+        const uint32_t new_version = (old_version + 2 != 0) ? old_version + 2 : 2;
+
+        version.store(old_version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (int word_index = 0; word_index < k_word_count; ++word_index)
+        {
+            words[word_index].store(frame_words[word_index], std::memory_order_relaxed);
+        }
+
+        version.store(new_version, std::memory_order_release);
+    }
+
+    // Returns false if the slot was never written or a write was in progress
+    bool tryRead(t_frame &out_frame, uint32_t &out_version) const
+    {
+        const uint32_t start_version = version.load(std::memory_order_acquire);
+
+        if (start_version == 0 || (start_version & 1) != 0)
+        {
+            return false;
+        }
+
+        uint32_t frame_words[k_word_count];
+        for (int word_index = 0; word_index < k_word_count; ++word_index)
+        {
+            frame_words[word_index] = words[word_index].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (version.load(std::memory_order_relaxed) != start_version)
+        {
+            return false;
+        }
+
+        memcpy(&out_frame, frame_words, sizeof(t_frame));
+        out_version = start_version;
+
+        return true;
+    }
+
+    std::atomic<uint32_t> version;
+    std::atomic<uint32_t> words[k_word_count];
+};
+
+/// Layout of the shared memory used to publish device poses to clients on the same machine.
+/**
+ One slot per device id, rewritten every time the service publishes new state for that device.
+ The frames carry the same sequence numbers as the UDP data frames, so a client can mix both.
+ */
+class SharedPoseStateHeader
+{
+public:
+    SharedPoseStateHeader()
+        : layout_version(COMPACT_DATA_FRAME_VERSION)
+    {
+    }
+
+    uint32_t layout_version; // COMPACT_DATA_FRAME_VERSION of the service that created the block
+    SharedPoseSlot<CompactControllerPoseFrame> controller_slots[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    SharedPoseSlot<CompactHMDPoseFrame> hmd_slots[PSMOVESERVICE_MAX_HMD_COUNT];
+};
+
+// The slots are shared between processes, so the atomics must not fall back to a (process local) lock
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared pose slot atomics must be lock free");
+
+#endif // SHARED_POSE_STATE_H
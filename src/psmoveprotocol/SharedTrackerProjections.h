@@ -0,0 +1,93 @@
+#ifndef SHARED_TRACKER_PROJECTIONS_H
+#define SHARED_TRACKER_PROJECTIONS_H
+
+#include "SharedPoseState.h"
+
+#include <stdint.h>
+
+//-- constants -----
+// Name of the shared memory block the service publishes the tracker projections into
+#define PSMOVESERVICE_SHARED_TRACKER_PROJECTIONS_NAME "psmoveservice_tracker_projections"
+
+// Bumped whenever the layout of the block changes
+#define SHARED_TRACKER_PROJECTIONS_VERSION 1
+
+// Most devices a tracker frame reports, the ones past it get left out
+#define SHARED_TRACKER_PROJECTION_MAX_DEVICES 10
+
+// Enough for a light bar (3 triangle + 4 quad points) and a point cloud (6 points)
+#define SHARED_TRACKER_PROJECTION_MAX_POINTS 7
+
+// SharedDeviceProjection::flags
+#define SHARED_PROJECTION_FLAG_IS_HMD       0x01
+#define SHARED_PROJECTION_FLAG_HAS_ROI      0x02 // The device got searched for in the roi_* rectangle
+#define SHARED_PROJECTION_FLAG_IS_FOUND     0x04 // The shape fields hold the projection the search found
+
+//-- definitions -----
+enum eSharedProjectionShape
+{
+    SharedProjectionShape_None,
+    // points[0] is the center, ellipse_* the rest of the ellipse
+    SharedProjectionShape_Ellipse,
+    // points[0..2] are the triangle, points[3..6] the quad
+    SharedProjectionShape_LightBar,
+    // points[0..point_count-1] are the LED blobs
+    SharedProjectionShape_Points,
+};
+
+#pragma pack(push, 1)
+/// What one tracker saw of one device in a video frame, in raw (distorted) pixel coordinates
+struct SharedDeviceProjection
+{
+    uint8_t device_id;          // Controller or HMD id, see SHARED_PROJECTION_FLAG_IS_HMD
+    uint8_t flags;              // SHARED_PROJECTION_FLAG_*
+    uint8_t shape_type;         // eSharedProjectionShape
+    uint8_t point_count;        // Valid entries in points
+    int16_t roi_x;
+    int16_t roi_y;
+    int16_t roi_width;
+    int16_t roi_height;
+    float screen_area;          // pixels^2
+    float fit_residual;         // Sphere fits only: rms residual of the fit (0 = perfect fit)
+    float ellipse_half_x_extent;
+    float ellipse_half_y_extent;
+    float ellipse_angle;        // degrees
+    float points[SHARED_TRACKER_PROJECTION_MAX_POINTS][2]; // x, y
+};
+
+/// Every device a tracker searched its latest video frame for
+struct SharedTrackerProjectionFrame
+{
+    // When the video frame got captured, in microseconds on the service clock the data frames are stamped with
+    int64_t capture_timestamp_us;
+    // Counts the frames published for this tracker, so a tool sees the frames it missed as gaps
+    uint32_t frame_index;
+    uint16_t frame_width;
+    uint16_t frame_height;
+    uint8_t device_count;       // Valid entries in devices
+    uint8_t reserved[3];
+    SharedDeviceProjection devices[SHARED_TRACKER_PROJECTION_MAX_DEVICES];
+};
+#pragma pack(pop)
+
+/// Layout of the shared memory block that lets debug tools draw their own tracking overlays.
+/**
+ A lightweight alternative to the tracker video stream (see SharedTrackerState.h):
+ instead of the video frame and its overlay, each tracker publishes only the search regions
+ and the shapes it found, under a kilobyte per frame.
+ Created by the service (when DeviceManagerConfig::shared_memory_projections_enabled is set).
+ One seqlock slot per tracker id (see SharedPoseSlot), rewritten every time the tracker finishes a frame.
+ */
+class SharedTrackerProjectionsHeader
+{
+public:
+    SharedTrackerProjectionsHeader()
+        : layout_version(SHARED_TRACKER_PROJECTIONS_VERSION)
+    {
+    }
+
+    uint32_t layout_version; // SHARED_TRACKER_PROJECTIONS_VERSION of the service that created the block
+    SharedPoseSlot<SharedTrackerProjectionFrame> tracker_slots[PSMOVESERVICE_MAX_TRACKER_COUNT];
+};
+
+#endif // SHARED_TRACKER_PROJECTIONS_H
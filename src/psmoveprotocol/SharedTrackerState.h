@@ -5,37 +5,157 @@
 #define BOOST_INTERPROCESS_SHARED_DIR_PATH "shared_mem"
 #endif // WIN32
 
-#include <boost/interprocess/sync/interprocess_mutex.hpp>
+#include <atomic>
+#include <stddef.h>
 
+/// Palette indices used in the debug overlay layer.
+/// The service draws tracking debug info into a one byte per pixel overlay
+/// and the client composites it over the BGR video frame.
+enum eSharedVideoOverlayColor
+{
+    OverlayColor_None= 0, // transparent
+    OverlayColor_Blue,
+    OverlayColor_White,
+    OverlayColor_Red,
+
+    MAX_OVERLAY_COLOR_COUNT
+};
+
+/// How the video frame in a ring slot is stored.
+/// Preview streams ask for a reduced format, see RequestStartTrackerDataStream::video_preview_format.
+enum eSharedVideoPixelFormat
+{
+    SharedVideoPixelFormat_BGR= 0, // 3 bytes per pixel
+    SharedVideoPixelFormat_Gray,   // 1 byte per pixel
+    SharedVideoPixelFormat_OverlayOnly, // No video, only the debug overlay
+
+    MAX_SHARED_VIDEO_PIXEL_FORMAT_COUNT
+};
+
+// Largest video_preview_scale: a preview is at most 1/4 of the frame width and height
+#define SHARED_VIDEO_MAX_PREVIEW_SCALE 4
+
+/// Per-slot bookkeeping for the shared video frame ring
+struct SharedVideoFrameSlot
+{
+    // Index of the frame held in this slot. 0 while the service is writing to it.
+    // Readers check it before and after copying the slot to detect a torn read.
+    std::atomic_int frame_index;
+    // Time (std::chrono::steady_clock, in microseconds) the frame was captured by the service
+    std::atomic_llong timestamp_us;
+    // Layout of the frame in this slot, written before frame_index.
+    // A preview is downscaled from the header's full frame size and/or stored in a reduced pixel format.
+    // The overlay is always width x height bytes.
+    int width;
+    int height;
+    int stride; // 0 for SharedVideoPixelFormat_OverlayOnly
+    int pixel_format; // eSharedVideoPixelFormat
+};
+
+/// Layout of the shared memory used to stream tracker video to clients.
+/**
+ Frames are written into a lock free ring of slots, triple buffered the same way as AtomicObject:
+ the service always writes into a slot that is neither the latest frame nor the slot a client
+ said it's reading, so it never has to wait on a client. Clients read the latest slot and
+ use the slot frame index as a sequence number to detect (and retry) the rare torn read.
+ The header's width, height and stride are the size of the full video frame every slot has room for.
+ The frame a slot holds can be smaller (see SharedVideoFrameSlot), so the slots never move
+ when the streams ask for a different preview.
+ */
 class SharedVideoFrameHeader
 {
 public:
+    static const int k_frame_slot_count = 3;
+
     SharedVideoFrameHeader()
-        : mutex()
-        , width(0)
+        : width(0)
         , height(0)
         , stride(0)
-        , frame_index(0)
     {
+        frame_index.store(0);
+        active_slot_index.store(-1);
+        reader_slot_index.store(-1);
+        last_read_frame_index.store(0);
+
+        for (int slot_index = 0; slot_index < k_frame_slot_count; ++slot_index)
+        {
+            slots[slot_index].frame_index.store(0);
+            slots[slot_index].timestamp_us.store(0);
+            slots[slot_index].width= 0;
+            slots[slot_index].height= 0;
+            slots[slot_index].stride= 0;
+            slots[slot_index].pixel_format= SharedVideoPixelFormat_BGR;
+        }
     }
-    
-    //Mutex to protect access to the shared memory
-    boost::interprocess::interprocess_mutex mutex;
 
     int width;
     int height;
     int stride;
-    int frame_index;
-    // Buffer stored past the end of the header
+    std::atomic_int frame_index; // Index of the latest published frame (0 = none yet)
+    std::atomic_int active_slot_index; // Slot holding the latest published frame (-1 = none yet)
+    std::atomic_int reader_slot_index; // Slot a client is copying from (-1 = none)
+    std::atomic_int last_read_frame_index; // Set by the client. The service skips writing frames nobody has read.
+    SharedVideoFrameSlot slots[k_frame_slot_count];
+    // Slot buffers stored past the end of the header.
+    // Each slot holds the BGR video buffer followed by the overlay buffer.
+
+    const unsigned char *getBuffer(int slot_index) const
+    {
+        return reinterpret_cast<const unsigned char *>(this) + sizeof(SharedVideoFrameHeader) +
+            slot_index*computeSlotSize(width, height, stride);
+    }
+
+    unsigned char *getBufferMutable(int slot_index)
+    {
+        return const_cast<unsigned char *>(getBuffer(slot_index));
+    }
 
-    const unsigned char *getBuffer() const
+    const unsigned char *getOverlayBuffer(int slot_index) const
     {
-        return reinterpret_cast<const unsigned char *>(this) + sizeof(SharedVideoFrameHeader);
+        return getBuffer(slot_index) + computeVideoBufferSize(stride, height);
     }
 
-    unsigned char *getBufferMutable()
+    unsigned char *getOverlayBufferMutable(int slot_index)
     {
-        return const_cast<unsigned char *>(getBuffer());
+        return const_cast<unsigned char *>(getOverlayBuffer(slot_index));
+    }
+
+    // Pick a slot for the writer that no reader can be looking at
+    int getWriteSlotIndex() const
+    {
+        const int active_index = active_slot_index.load();
+        const int reader_index = reader_slot_index.load();
+        int write_index = 0;
+
+        while (write_index == active_index || write_index == reader_index)
+        {
+            ++write_index;
+        }
+
+        return write_index;
+    }
+
+    // False for a slot layout that doesn't fit the slots (ex: read while the service rewrote it)
+    bool getIsSlotLayoutValid(const int slot_width, const int slot_height, const int slot_stride, const int slot_pixel_format) const
+    {
+        return
+            slot_width > 0 && slot_width <= width &&
+            slot_height > 0 && slot_height <= height &&
+            slot_stride >= 0 && slot_stride <= stride &&
+            slot_pixel_format >= 0 && slot_pixel_format < MAX_SHARED_VIDEO_PIXEL_FORMAT_COUNT;
+    }
+
+    static int getBytesPerPixel(int pixel_format)
+    {
+        switch (pixel_format)
+        {
+        case SharedVideoPixelFormat_BGR:
+            return 3;
+        case SharedVideoPixelFormat_Gray:
+            return 1;
+        default:
+            return 0;
+        }
     }
 
     static size_t computeVideoBufferSize(int stride, int height)
@@ -43,10 +163,38 @@ public:
         return stride*height;
     }
 
-    static size_t computeTotalSize(int stride, int height)
+    static size_t computeOverlayBufferSize(int width, int height)
     {
-        return sizeof(SharedVideoFrameHeader) + computeVideoBufferSize(stride, height);
+        return width*height;
+    }
+
+    static size_t computeSlotSize(int width, int height, int stride)
+    {
+        return computeVideoBufferSize(stride, height) + computeOverlayBufferSize(width, height);
+    }
+
+    static size_t computeTotalSize(int width, int height, int stride)
+    {
+        return sizeof(SharedVideoFrameHeader) + k_frame_slot_count*computeSlotSize(width, height, stride);
+    }
+
+    static void getOverlayColorBGR(unsigned char color_index, unsigned char *out_bgr)
+    {
+        static const unsigned char k_overlay_colors[MAX_OVERLAY_COLOR_COUNT][3] = {
+            {0, 0, 0},
+            {255, 0, 0},
+            {255, 255, 255},
+            {0, 0, 255}
+        };
+        const int safe_index = (color_index < MAX_OVERLAY_COLOR_COUNT) ? static_cast<int>(color_index) : static_cast<int>(OverlayColor_White);
+
+        out_bgr[0] = k_overlay_colors[safe_index][0];
+        out_bgr[1] = k_overlay_colors[safe_index][1];
+        out_bgr[2] = k_overlay_colors[safe_index][2];
     }
 };
 
+// The ring is shared between processes, so the atomics must not fall back to a (process local) lock
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2, "Shared video frame atomics must be lock free");
+
 #endif // SHARED_TRACKER_STATE_H
\ No newline at end of file
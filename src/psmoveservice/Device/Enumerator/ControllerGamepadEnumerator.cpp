@@ -6,7 +6,7 @@
 #include "assert.h"
 #include "string.h"
 
-#include "gamepad/Gamepad.h"
+#include "GamepadPoller.h"
 
 // -- private definitions -----
 #ifdef _MSC_VER
@@ -46,7 +46,7 @@ ControllerGamepadEnumerator::ControllerGamepadEnumerator()
 	m_deviceType= CommonDeviceState::PSMove;
 	assert(m_deviceType >= 0 && GET_DEVICE_TYPE_INDEX(m_deviceType) < MAX_CONTROLLER_TYPE_INDEX);
 
-	Gamepad_detectDevices();
+	// The gamepad thread keeps the device list current, no need to re-detect here
 	next();
 }
 
@@ -59,18 +59,21 @@ ControllerGamepadEnumerator::ControllerGamepadEnumerator(
 	m_deviceTypeFilter= deviceTypeFilter;
 	assert(m_deviceType >= 0 && GET_DEVICE_TYPE_INDEX(m_deviceType) < MAX_CONTROLLER_TYPE_INDEX);
 
-	Gamepad_detectDevices();
 	next();
 }
 
 int ControllerGamepadEnumerator::get_vendor_id() const
 {
-	return is_valid() ? Gamepad_deviceAtIndex(static_cast<unsigned int>(m_controllerIndex))->vendorID : -1;
+	GamepadState gamepad;
+
+	return (is_valid() && GamepadPoller::fetchGamepadState(m_controllerIndex, gamepad)) ? gamepad.vendorID : -1;
 }
 
 int ControllerGamepadEnumerator::get_product_id() const
 {
-	return is_valid() ? Gamepad_deviceAtIndex(static_cast<unsigned int>(m_controllerIndex))->productID : -1;
+	GamepadState gamepad;
+
+	return (is_valid() && GamepadPoller::fetchGamepadState(m_controllerIndex, gamepad)) ? gamepad.productID : -1;
 }
 
 const char *ControllerGamepadEnumerator::get_path() const
@@ -80,18 +83,18 @@ const char *ControllerGamepadEnumerator::get_path() const
 
 bool ControllerGamepadEnumerator::is_valid() const
 {
-	return m_controllerIndex < static_cast<int>(Gamepad_numDevices());
+	return m_controllerIndex < GamepadPoller::getGamepadCount();
 }
 
 bool ControllerGamepadEnumerator::next()
 {
 	bool foundValid = false;
 
-	while (m_controllerIndex < static_cast<int>(Gamepad_numDevices()) && !foundValid)
+	while (m_controllerIndex < GamepadPoller::getGamepadCount() && !foundValid)
 	{
 		++m_controllerIndex;
 
-		if (m_controllerIndex < static_cast<int>(Gamepad_numDevices()) && 
+		if (m_controllerIndex < GamepadPoller::getGamepadCount() && 
 			is_gamepad_supported(m_controllerIndex, m_deviceTypeFilter, m_deviceType))
 		{
 			ServerUtility::format_string(m_currentUSBPath, sizeof(m_currentUSBPath), "gamepad_%d", m_controllerIndex);		
@@ -110,9 +113,9 @@ static bool is_gamepad_supported(
 {
 	bool bIsValidDevice = false;
 
-	const Gamepad_device *devInfo= Gamepad_deviceAtIndex(static_cast<unsigned int>(gamepad_index));
+	GamepadState devInfo;
 
-	if (devInfo != nullptr)
+	if (GamepadPoller::fetchGamepadState(gamepad_index, devInfo))
 	{
 		// See if the next filtered device is a controller type that we care about
 		for (int gamepad_type_index = 0; gamepad_type_index < MAX_CONTROLLER_TYPE_INDEX; ++gamepad_type_index)
@@ -120,8 +123,8 @@ static bool is_gamepad_supported(
 			const GamepadAPIDeviceFilter &supported_type = g_supported_gamepad_infos[gamepad_type_index];
 
 			if (supported_type.bGamepadApiSupported &&
-				devInfo->productID == supported_type.filter.product_id &&
-				devInfo->vendorID == supported_type.filter.vendor_id)
+				devInfo.productID == supported_type.filter.product_id &&
+				devInfo.vendorID == supported_type.filter.vendor_id)
 			{				
 				CommonDeviceState::eDeviceType device_type =
 					static_cast<CommonDeviceState::eDeviceType>(CommonDeviceState::Controller + gamepad_type_index);
@@ -1,5 +1,6 @@
 // -- includes -----
 #include "ControllerHidDeviceEnumerator.h"
+#include "DeviceInputLog.h"
 #include "ServerUtility.h"
 #include "USBDeviceInfo.h"
 #include "assert.h"
@@ -51,7 +52,7 @@ ControllerHidDeviceEnumerator::~ControllerHidDeviceEnumerator()
 {
 	if (m_HIDdevices != nullptr)
 	{
-		hid_free_enumeration(m_HIDdevices);
+		logged_hid_free_enumeration(m_HIDdevices);
 	}
 }
 
@@ -127,7 +128,7 @@ bool ControllerHidDeviceEnumerator::next()
 			// Free any previous enumeration
 			if (m_HIDdevices != nullptr)
 			{
-				hid_free_enumeration(m_HIDdevices);
+				logged_hid_free_enumeration(m_HIDdevices);
 				m_currentHIDDevice = nullptr;
 				m_HIDdevices = nullptr;
 			}
@@ -140,7 +141,7 @@ bool ControllerHidDeviceEnumerator::next()
 				if (m_deviceType == m_deviceTypeFilter || m_deviceTypeFilter == CommonDeviceState::INVALID_DEVICE_TYPE)
 				{
 					// Create a new HID enumeration
-					m_HIDdevices = hid_enumerate(dev_info.filter.vendor_id, dev_info.filter.product_id);
+					m_HIDdevices = logged_hid_enumerate(dev_info.filter.vendor_id, dev_info.filter.product_id);
 					m_currentHIDDevice = m_HIDdevices;
 					foundValid = is_valid();
 				}
@@ -1,5 +1,6 @@
 // -- includes -----
 #include "HidHMDDeviceEnumerator.h"
+#include "DeviceInputLog.h"
 #include "ServerUtility.h"
 #include "USBDeviceInfo.h" // for MAX_USB_DEVICE_PORT_PATH, t_usb_device_handle
 #include "assert.h"
@@ -102,7 +103,7 @@ std::string HidHMDDeviceEnumerator::get_interface_path(int interface_number) con
 void HidHMDDeviceEnumerator::build_interface_list()
 {
 	USBDeviceFilter &dev_info = g_supported_hmd_infos[GET_DEVICE_TYPE_INDEX(m_deviceType)];
-	hid_device_info * devs = hid_enumerate(dev_info.vendor_id, dev_info.product_id);
+	hid_device_info * devs = logged_hid_enumerate(dev_info.vendor_id, dev_info.product_id);
 
 	current_device_identifier = "";
 	current_device_interfaces.clear();
@@ -126,6 +127,6 @@ void HidHMDDeviceEnumerator::build_interface_list()
 			current_device_interfaces.push_back(hmd_interface);
 		}
 
-		hid_free_enumeration(devs);
+		logged_hid_free_enumeration(devs);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,47 @@
+// -- includes -----
+#include "InputLogTrackerEnumerator.h"
+#include "DeviceInputLog.h"
+
+// -- constants -----
+// Recorded trackers are always PS3Eyes
+static const int k_replay_tracker_vendor_id = 0x1415;
+static const int k_replay_tracker_product_id = 0x2000;
+
+// -- InputLogTrackerEnumerator -----
+InputLogTrackerEnumerator::InputLogTrackerEnumerator()
+    : DeviceEnumerator(CommonDeviceState::PS3EYE)
+    , m_current_device_path()
+    , m_camera_index(0)
+    , m_camera_count(DeviceInputLog::get_replay_tracker_count())
+{
+	m_deviceType= CommonDeviceState::PS3EYE;
+
+	DeviceInputLog::get_replay_tracker_path(m_camera_index, m_current_device_path);
+}
+
+const char *InputLogTrackerEnumerator::get_path() const
+{
+	return is_valid() ? m_current_device_path.c_str() : nullptr;
+}
+
+int InputLogTrackerEnumerator::get_vendor_id() const
+{
+	return is_valid() ? k_replay_tracker_vendor_id : -1;
+}
+
+int InputLogTrackerEnumerator::get_product_id() const
+{
+	return is_valid() ? k_replay_tracker_product_id : -1;
+}
+
+bool InputLogTrackerEnumerator::is_valid() const
+{
+	return m_camera_index < m_camera_count;
+}
+
+bool InputLogTrackerEnumerator::next()
+{
+	++m_camera_index;
+
+	return DeviceInputLog::get_replay_tracker_path(m_camera_index, m_current_device_path);
+}
@@ -0,0 +1,29 @@
+#ifndef INPUT_LOG_TRACKER_ENUMERATOR_H
+#define INPUT_LOG_TRACKER_ENUMERATOR_H
+
+// -- includes -----
+#include "DeviceEnumerator.h"
+#include <string>
+
+// -- definitions -----
+/// Lists the trackers recorded in the device input log being replayed
+class InputLogTrackerEnumerator : public DeviceEnumerator
+{
+public:
+    InputLogTrackerEnumerator();
+
+    bool is_valid() const override;
+    bool next() override;
+	int get_vendor_id() const override;
+	int get_product_id() const override;
+    const char *get_path() const override;
+
+    inline int get_camera_index() const { return m_camera_index; }
+
+private:
+    std::string m_current_device_path;
+    int m_camera_index;
+    int m_camera_count;
+};
+
+#endif // INPUT_LOG_TRACKER_ENUMERATOR_H
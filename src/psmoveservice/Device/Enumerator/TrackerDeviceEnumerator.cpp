@@ -1,5 +1,6 @@
 // -- includes -----
 #include "TrackerDeviceEnumerator.h"
+#include "CameraNodeLink.h"
 #include "ServerUtility.h"
 #include "USBDeviceManager.h"
 #include "ServerLog.h"
@@ -30,13 +31,21 @@ TrackerDeviceEnumerator::TrackerDeviceEnumerator()
 	: DeviceEnumerator()
 	, m_usb_enumerator(nullptr)
     , m_cameraIndex(-1)
+    , m_remote_camera_paths()
+    , m_remote_camera_index(-1)
 {
 	USBDeviceManager *usbRequestMgr = USBDeviceManager::getInstance();
+	const CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
 
 	m_deviceType= CommonDeviceState::PS3EYE;
 	assert(m_deviceType >= 0 && GET_DEVICE_TYPE_INDEX(m_deviceType) < MAX_CAMERA_TYPE_INDEX);
 	m_usb_enumerator = usb_device_enumerator_allocate();
 
+	if (camera_node_link != nullptr && camera_node_link->getIsHost())
+	{
+		camera_node_link->getRemoteCameraPaths(m_remote_camera_paths);
+	}
+
 	// If the first USB device handle isn't a tracker, move on to the next device
 	if (testUSBEnumerator())
 	{
@@ -61,7 +70,7 @@ int TrackerDeviceEnumerator::get_vendor_id() const
 	USBDeviceFilter devInfo;
 	int vendor_id = -1;
 
-	if (is_valid() && usb_device_enumerator_get_filter(m_usb_enumerator, devInfo))
+	if (is_usb_valid() && usb_device_enumerator_get_filter(m_usb_enumerator, devInfo))
 	{
 		vendor_id = devInfo.vendor_id;
 	}
@@ -74,7 +83,7 @@ int TrackerDeviceEnumerator::get_product_id() const
 	USBDeviceFilter devInfo;
 	int product_id = -1;
 
-	if (is_valid() && usb_device_enumerator_get_filter(m_usb_enumerator, devInfo))
+	if (is_usb_valid() && usb_device_enumerator_get_filter(m_usb_enumerator, devInfo))
 	{
 		product_id = devInfo.product_id;
 	}
@@ -86,18 +95,24 @@ const char *TrackerDeviceEnumerator::get_path() const
 {
     const char *result = nullptr;
 
-    if (is_valid())
+    if (is_usb_valid())
     {
         // Return a pointer to our member variable that has the path cached
         result= m_currentUSBPath;
     }
+    else if (is_valid())
+    {
+        result= m_remote_camera_paths[m_remote_camera_index].c_str();
+    }
 
     return result;
 }
 
 bool TrackerDeviceEnumerator::is_valid() const
 {
-	return m_usb_enumerator != nullptr && usb_device_enumerator_is_valid(m_usb_enumerator);
+	return 
+		is_usb_valid() ||
+		(m_remote_camera_index >= 0 && m_remote_camera_index < static_cast<int>(m_remote_camera_paths.size()));
 }
 
 bool TrackerDeviceEnumerator::next()
@@ -105,7 +120,7 @@ bool TrackerDeviceEnumerator::next()
 	USBDeviceManager *usbRequestMgr = USBDeviceManager::getInstance();
 	bool foundValid = false;
 
-	while (is_valid() && !foundValid)
+	while (is_usb_valid() && !foundValid)
 	{
 		usb_device_enumerator_next(m_usb_enumerator);
 
@@ -115,6 +130,13 @@ bool TrackerDeviceEnumerator::next()
 		}
 	}
 
+	// The remote cameras come after the USB ones
+	if (!foundValid && m_remote_camera_index < static_cast<int>(m_remote_camera_paths.size()))
+	{
+		++m_remote_camera_index;
+		foundValid= m_remote_camera_index < static_cast<int>(m_remote_camera_paths.size());
+	}
+
 	if (foundValid)
 	{
 		++m_cameraIndex;
@@ -127,7 +149,7 @@ bool TrackerDeviceEnumerator::testUSBEnumerator()
 {
 	bool foundValid= false;
 
-	if (is_valid() && is_tracker_supported(m_usb_enumerator, m_deviceTypeFilter, m_deviceType))
+	if (is_usb_valid() && is_tracker_supported(m_usb_enumerator, m_deviceTypeFilter, m_deviceType))
 	{
 		char USBPath[256];
 
@@ -152,6 +174,11 @@ bool TrackerDeviceEnumerator::testUSBEnumerator()
 	return foundValid;
 }
 
+bool TrackerDeviceEnumerator::is_usb_valid() const
+{
+	return m_usb_enumerator != nullptr && usb_device_enumerator_is_valid(m_usb_enumerator);
+}
+
 //-- private methods -----
 static bool is_tracker_supported(
 	USBDeviceEnumerator *enumerator, 
@@ -4,8 +4,11 @@
 //-- includes -----
 #include "DeviceEnumerator.h"
 #include "USBApiInterface.h"
+#include <string>
+#include <vector>
 
 //-- definitions -----
+/// Lists the USB cameras, then the cameras of the camera nodes streaming to this service (see CameraNodeLink)
 class TrackerDeviceEnumerator : public DeviceEnumerator
 {
 public:
@@ -19,14 +22,20 @@ public:
     const char *get_path() const override;
     inline int get_camera_index() const { return m_cameraIndex; }
 	inline struct USBDeviceEnumerator* get_usb_device_enumerator() const { return m_usb_enumerator; }
+    inline bool get_is_remote_camera() const { return !is_usb_valid() && is_valid(); }
 
 protected: 
 	bool testUSBEnumerator();
+    bool is_usb_valid() const;
 
 private:
     char m_currentUSBPath[256];
 	struct USBDeviceEnumerator* m_usb_enumerator;
     int m_cameraIndex;
+
+    // Walked once the USB cameras run out
+    std::vector<std::string> m_remote_camera_paths;
+    int m_remote_camera_index;
 };
 
 #endif // TRACKER_DEVICE_ENUMERATOR_H
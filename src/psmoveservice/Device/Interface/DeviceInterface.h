@@ -2,6 +2,7 @@
 #define DEVICE_INTERFACE_H
 
 // -- includes -----
+#include <chrono>
 #include <string>
 #include <tuple>
 
@@ -26,6 +27,16 @@ enum eCommonTrackingColorID {
     MAX_TRACKING_COLOR_TYPES
 };
 
+// How much a device's optical tracking is worth when the vision work has to be cut back.
+// The values get stored in the device configs and sent as PSMoveProtocol::VisionPriority.
+enum eCommonVisionPriority {
+    VisionPriority_Low,     // Props: the first to lose their searches when the ticks go over budget
+    VisionPriority_Normal,
+    VisionPriority_High,    // Never held back for the sake of the optical time budget
+
+    MAX_VISION_PRIORITY_TYPES
+};
+
 enum eCommonTrackingShapeType {
     INVALID_SHAPE = -1,
 
@@ -215,6 +226,10 @@ struct CommonDeviceState
     
     eDeviceType DeviceType;
     int PollSequenceNumber;
+
+    // When the device data was captured (HID read completion, video frame retrieval).
+    // Default constructed (zero) if the device doesn't provide one.
+    std::chrono::time_point<std::chrono::high_resolution_clock> CaptureTimestamp;
     
     inline CommonDeviceState()
     {
@@ -225,6 +240,12 @@ struct CommonDeviceState
     {
         DeviceType= SUPPORTED_CONTROLLER_TYPE_COUNT; // invalid
         PollSequenceNumber= 0;
+        CaptureTimestamp= std::chrono::time_point<std::chrono::high_resolution_clock>();
+    }
+
+    inline bool getHasCaptureTimestamp() const
+    {
+        return CaptureTimestamp.time_since_epoch().count() != 0;
     }
 
     static const char *getDeviceTypeString(eDeviceType device_type)
@@ -291,8 +312,6 @@ struct CommonControllerState : CommonDeviceState
 
     enum BatteryLevel Battery;
     unsigned int AllButtons;                    // all-buttons, used to detect changes
-
-    //TODO: high-precision timestamp. Need to do in hidapi?
     
     inline CommonControllerState()
     {
@@ -395,11 +414,13 @@ struct CommonDeviceTrackingProjection
 
 		struct {
 			CommonDeviceScreenLocation point[MAX_POINT_CLOUD_POINT_COUNT];
+			int shape_point_index[MAX_POINT_CLOUD_POINT_COUNT]; // tracking shape point each blob was matched to, -1 if none
 			int point_count;
 		} points;
     } shape;
 
     float screen_area; // area in pixels^2
+    float fit_residual; // sphere projections only: rms residual of the sphere fit (0 = perfect fit)
     eCommonTrackingProjectionType shape_type;
     
     struct {
@@ -441,6 +462,10 @@ public:
     
     // Get the number of milliseconds we're willing to accept no data from the device before we disconnect it
     virtual long getMaxPollFailureCount() const = 0;
+
+    // How often the device wants to be polled (ms), -1 uses the device manager's poll_interval
+    virtual int getPollIntervalMs() const
+    { return -1; }
     
     // Returns what type of device
     virtual CommonDeviceState::eDeviceType getDeviceType() const = 0;
@@ -510,6 +535,9 @@ public:
 	// Get the state prediction time specified in the controller config
 	virtual float getPredictionTime() const = 0;
 
+	// Get the vision scheduler priority specified in the controller config
+	virtual eCommonVisionPriority getVisionPriority() const = 0;
+
     // See if the system button was pressed this frame
     virtual bool getWasSystemButtonPressed() const = 0;
 };
@@ -538,9 +566,34 @@ public:
     // Returns the video frame size (used to compute frame buffer size)
     virtual bool getVideoFrameDimensions(int *out_width, int *out_height, int *out_stride) const = 0;
 
-    // Returns a pointer to the last video frame buffer captured
+    // Returns a pointer to the last video frame buffer captured (or nullptr if no frame captured yet).
+    // The buffer is owned by the tracker and stays valid and unmodified until the next call to poll(),
+    // so callers may reference it directly rather than copying it.
     virtual const unsigned char *getVideoFrameBuffer() const = 0;
 
+    // Returns the layout of the buffer getVideoFrameBuffer() hands out: 3 (BGR) or 4 (BGRA, the native
+    // CL Eye Multicam layout) bytes per pixel and the distance between rows in bytes.
+    // getVideoFrameDimensions() keeps describing the BGR frame the service publishes.
+    virtual void getVideoFrameBufferLayout(int *out_bytes_per_pixel, int *out_stride) const = 0;
+
+    // Returns a pointer to the last raw Bayer frame captured (GB pattern, one byte per pixel)
+    // when raw capture is enabled, otherwise nullptr. Same lifetime rules as getVideoFrameBuffer().
+    // While raw capture is enabled getVideoFrameBuffer() returns nullptr.
+    virtual const unsigned char *getRawBayerFrameBuffer() const = 0;
+
+    // Returns the number of the last video frame captured (or -1 if no frame captured yet).
+    // Counts every frame the camera sent since open, including the ones that never made it
+    // to a poll, so a jump of more than one between two new frames means frames got dropped.
+    virtual long long getVideoFrameSequenceNumber() const = 0;
+
+    // -- Setters
+    // Capture raw Bayer frames instead of demosaicing every frame to BGR.
+    // Returns false if the camera can't provide raw frames.
+    virtual bool setRawBayerFrameCapture(bool bEnable) = 0;
+    // Stop the camera stream while nobody needs its frames, without closing the tracker.
+    // Polls get no new frames while suspended. Returns false if the camera can't stop its stream.
+    virtual bool setCaptureSuspended(bool bSuspended) = 0;
+
     static const char *getDriverTypeString(eDriverType device_type)
     {
         const char *result = nullptr;
@@ -629,6 +682,13 @@ public:
 
 	// Get the state prediction time from the HMD config
 	virtual float getPredictionTime() const = 0;
+
+	// Get the vision scheduler priority from the HMD config
+	virtual eCommonVisionPriority getVisionPriority() const = 0;
+
+	// Sensor reports the last poll drained, and the most a single poll drained since the HMD opened
+	virtual int getLastPollSensorBacklog() const = 0;
+	virtual int getMaxPollSensorBacklog() const = 0;
 };
 
 #endif // DEVICE_INTERFACE_H
@@ -0,0 +1,67 @@
+#ifndef DEVICE_INTERFACE_EIGEN_H
+#define DEVICE_INTERFACE_EIGEN_H
+
+// -- includes -----
+#include "DeviceInterface.h"
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <cstddef>
+#include <type_traits>
+
+// -- layout checks -----
+// The Common* POD types are laid out like the matching Eigen types
+// (CommonDeviceQuaternion stores x,y,z,w just like Eigen's quaternion coefficients),
+// so they can be read and written in place through an Eigen::Map instead of being copied.
+static_assert(std::is_standard_layout<CommonDevicePosition>::value, "CommonDevicePosition must stay POD");
+static_assert(sizeof(CommonDevicePosition) == 3*sizeof(float), "CommonDevicePosition must be 3 packed floats");
+static_assert(offsetof(CommonDevicePosition, y) == 1*sizeof(float), "CommonDevicePosition must be x,y,z");
+static_assert(offsetof(CommonDevicePosition, z) == 2*sizeof(float), "CommonDevicePosition must be x,y,z");
+
+static_assert(std::is_standard_layout<CommonDeviceVector>::value, "CommonDeviceVector must stay POD");
+static_assert(sizeof(CommonDeviceVector) == 3*sizeof(float), "CommonDeviceVector must be 3 packed floats");
+static_assert(offsetof(CommonDeviceVector, j) == 1*sizeof(float), "CommonDeviceVector must be i,j,k");
+static_assert(offsetof(CommonDeviceVector, k) == 2*sizeof(float), "CommonDeviceVector must be i,j,k");
+
+static_assert(std::is_standard_layout<CommonDeviceQuaternion>::value, "CommonDeviceQuaternion must stay POD");
+static_assert(sizeof(CommonDeviceQuaternion) == 4*sizeof(float), "CommonDeviceQuaternion must be 4 packed floats");
+static_assert(offsetof(CommonDeviceQuaternion, y) == 1*sizeof(float), "CommonDeviceQuaternion must be x,y,z,w");
+static_assert(offsetof(CommonDeviceQuaternion, z) == 2*sizeof(float), "CommonDeviceQuaternion must be x,y,z,w");
+static_assert(offsetof(CommonDeviceQuaternion, w) == 3*sizeof(float), "CommonDeviceQuaternion must be x,y,z,w");
+
+// -- interface -----
+// Zero cost Eigen views of the Common* types.
+// Read: Eigen::Vector3f p= eigen_vector3f_view(pose.PositionCm);
+// Write: eigen_quaternionf_view(pose.Orientation)= q;
+inline Eigen::Map<const Eigen::Vector3f> eigen_vector3f_view(const CommonDevicePosition &p)
+{
+    return Eigen::Map<const Eigen::Vector3f>(&p.x);
+}
+
+inline Eigen::Map<Eigen::Vector3f> eigen_vector3f_view(CommonDevicePosition &p)
+{
+    return Eigen::Map<Eigen::Vector3f>(&p.x);
+}
+
+inline Eigen::Map<const Eigen::Vector3f> eigen_vector3f_view(const CommonDeviceVector &v)
+{
+    return Eigen::Map<const Eigen::Vector3f>(&v.i);
+}
+
+inline Eigen::Map<Eigen::Vector3f> eigen_vector3f_view(CommonDeviceVector &v)
+{
+    return Eigen::Map<Eigen::Vector3f>(&v.i);
+}
+
+inline Eigen::Map<const Eigen::Quaternionf> eigen_quaternionf_view(const CommonDeviceQuaternion &q)
+{
+    return Eigen::Map<const Eigen::Quaternionf>(&q.x);
+}
+
+inline Eigen::Map<Eigen::Quaternionf> eigen_quaternionf_view(CommonDeviceQuaternion &q)
+{
+    return Eigen::Map<Eigen::Quaternionf>(&q.x);
+}
+
+#endif // DEVICE_INTERFACE_EIGEN_H
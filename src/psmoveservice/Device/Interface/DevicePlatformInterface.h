@@ -39,6 +39,8 @@ public:
 	virtual void handle_bluetooth_request_finished() {};
 
 	// Queries
+	// False if devices of the class never raise hotplug events here and have to be polled for
+	virtual bool get_is_hotplug_supported(const DeviceClass deviceClass) const { return true; }
 	virtual bool get_device_property(
 		const DeviceClass deviceClass,
 		const int vendor_id,
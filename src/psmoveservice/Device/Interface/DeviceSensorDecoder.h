@@ -0,0 +1,166 @@
+#ifndef DEVICE_SENSOR_DECODER_H
+#define DEVICE_SENSOR_DECODER_H
+
+// -- includes -----
+#include "DeviceInterface.h"
+#include "MathUtility.h"
+
+#include <Eigen/Core>
+
+#include <cstddef>
+#include <type_traits>
+
+// -- layout checks -----
+// The decoders write straight into the i,j,k members of the Common* vector types
+static_assert(std::is_standard_layout<CommonRawDeviceVector>::value, "CommonRawDeviceVector must stay POD");
+static_assert(sizeof(CommonRawDeviceVector) == 3*sizeof(int), "CommonRawDeviceVector must be 3 packed ints");
+static_assert(std::is_standard_layout<CommonDeviceVector>::value, "CommonDeviceVector must stay POD");
+static_assert(sizeof(CommonDeviceVector) == 3*sizeof(float), "CommonDeviceVector must be 3 packed floats");
+
+// -- constants -----
+// How an IMU axis is packed into the HID report
+enum eIMURawEncoding
+{
+    IMURawEncoding_Unsigned16,      // 16-bit little endian, offset binary (0x8000 is zero)
+    IMURawEncoding_Signed16,        // 16-bit little endian two's complement
+    IMURawEncoding_Signed12High,    // 12-bit two's complement in the top bits of a 16-bit little endian field
+};
+
+// -- definitions -----
+/// Turns the raw fields of one IMU sensor (accelerometer, gyroscope) in a report into
+/// calibrated values in a single pass: unpack, flip into the device's axes, then
+/// calibrated= raw*scale + offset per axis.
+/// Every device folds its own gain/bias/drift convention into scale and offset when its config changes,
+/// so the per sample work is the same for all of them.
+struct IMUSensorDecoder
+{
+    eIMURawEncoding encoding;
+    int byte_offset[3];     // Start of each axis' field, relative to the start of the sensor frame
+    int sign[3];            // +1 or -1, applied to the raw value
+    float scale[3];
+    float offset[3];
+
+    IMUSensorDecoder()
+    {
+        setLayout(IMURawEncoding_Signed16, 0, 2, 4);
+
+        for (int axis_index = 0; axis_index < 3; ++axis_index)
+        {
+            setAxisCalibration(axis_index, 1.f, 0.f);
+        }
+    }
+
+    inline void setLayout(const eIMURawEncoding in_encoding, const int x_offset, const int y_offset, const int z_offset)
+    {
+        encoding = in_encoding;
+        byte_offset[0] = x_offset;
+        byte_offset[1] = y_offset;
+        byte_offset[2] = z_offset;
+        sign[0] = sign[1] = sign[2] = 1;
+    }
+
+    inline void setAxisSign(const int axis_index, const int in_sign)
+    {
+        sign[axis_index] = in_sign;
+    }
+
+    inline void setAxisCalibration(const int axis_index, const float in_scale, const float in_offset)
+    {
+        scale[axis_index] = in_scale;
+        offset[axis_index] = in_offset;
+    }
+
+    inline void decode(const unsigned char *frame_data, int *out_raw, float *out_calibrated) const
+    {
+        for (int axis_index = 0; axis_index < 3; ++axis_index)
+        {
+            const unsigned char *field = frame_data + byte_offset[axis_index];
+            const int value = field[0] | (field[1] << 8);
+            int raw_value;
+
+            switch (encoding)
+            {
+            case IMURawEncoding_Unsigned16:
+                raw_value = value - 0x8000;
+                break;
+            case IMURawEncoding_Signed12High:
+                raw_value = static_cast<short>(value) >> 4;
+                break;
+            case IMURawEncoding_Signed16:
+            default:
+                raw_value = static_cast<short>(value);
+                break;
+            }
+
+            raw_value *= sign[axis_index];
+
+            out_raw[axis_index] = raw_value;
+            out_calibrated[axis_index] = static_cast<float>(raw_value)*scale[axis_index] + offset[axis_index];
+        }
+    }
+};
+
+/// The accelerometer and gyroscope decoders of a device model, for reports that carry
+/// frame_count IMU frames spaced frame_stride bytes apart
+struct IMUPacketDecoder
+{
+    IMUSensorDecoder accelerometer;
+    IMUSensorDecoder gyroscope;
+    int frame_count;
+    int frame_stride;
+
+    IMUPacketDecoder()
+        : frame_count(1)
+        , frame_stride(0)
+    {
+    }
+
+    inline void decodeFrame(
+        const void *packet,
+        const int frame_index,
+        int *out_raw_accel,
+        float *out_calibrated_accel,
+        int *out_raw_gyro,
+        float *out_calibrated_gyro) const
+    {
+        const unsigned char *frame_data = static_cast<const unsigned char *>(packet) + frame_index*frame_stride;
+
+        accelerometer.decode(frame_data, out_raw_accel, out_calibrated_accel);
+        gyroscope.decode(frame_data, out_raw_gyro, out_calibrated_gyro);
+    }
+};
+
+/// Full affine raw -> calibrated transform for sensors whose calibration mixes axes
+/// (the magnetometer's ellipsoid fit): calibrated= linear*raw + offset
+struct IMUAffineCalibration
+{
+    Eigen::Matrix3f linear;
+    Eigen::Vector3f offset;
+
+    IMUAffineCalibration()
+        : linear(Eigen::Matrix3f::Identity())
+        , offset(Eigen::Vector3f::Zero())
+    {
+    }
+
+    /// Same as eigen_alignment_project_point_on_ellipsoid_basis(): move to the center,
+    /// project on the basis, then scale each axis by 1/extent (zero extents project to zero)
+    inline void setFromEllipsoid(const Eigen::Vector3f &center, const Eigen::Matrix3f &basis, const Eigen::Vector3f &extents)
+    {
+        linear = basis.transpose();
+        for (int axis_index = 0; axis_index < 3; ++axis_index)
+        {
+            const float extent = extents(axis_index);
+
+            linear.row(axis_index) *= is_nearly_zero(extent) ? 0.f : (1.f / extent);
+        }
+        offset = -(linear*center);
+    }
+
+    inline Eigen::Vector3f apply(const Eigen::Vector3f &raw) const
+    {
+        return linear*raw + offset;
+    }
+};
+
+#endif // DEVICE_SENSOR_DECODER_H
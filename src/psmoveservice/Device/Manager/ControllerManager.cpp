@@ -1,19 +1,30 @@
 //-- includes -----
 #include "ControllerManager.h"
 #include "BluetoothQueries.h"
+#include "CompactDataFrame.h"
 #include "ControllerDeviceEnumerator.h"
 #include "ControllerGamepadEnumerator.h"
 #include "OrientationFilter.h"
+#include "PoseFilterBatch.h"
+#include "PoseRecordWriter.h"
 #include "PSMoveProtocol.pb.h"
 #include "ServerLog.h"
 #include "ServerControllerView.h"
 #include "ServerDeviceView.h"
 #include "ServerNetworkManager.h"
+#include "ServerRequestHandler.h"
+#include "ServerTrace.h"
 #include "ServerUtility.h"
+#include "SharedPoseInputReader.h"
+#include "SharedPoseStateWriter.h"
 #include "VirtualControllerEnumerator.h"
 
 #include "hidapi.h"
-#include "gamepad/Gamepad.h"
+#include <algorithm>
+#include "GamepadPoller.h"
+
+//-- constants -----
+static_assert(ControllerManager::k_max_devices <= k_orientation_filter_batch_max_lanes, "Every controller has to fit in the pose filter batch");
 
 //-- methods -----
 //-- Tracker Manager Config -----
@@ -22,6 +33,10 @@ const int ControllerManagerConfig::CONFIG_VERSION = 1;
 ControllerManagerConfig::ControllerManagerConfig(const std::string &fnamebase)
     : PSMoveConfig(fnamebase)
     , virtual_controller_count(0)
+    , max_controller_count(PSMOVESERVICE_MAX_CONTROLLER_COUNT)
+    , filter_warm_start_max_gap_ms(2000)
+    , reference_sphere_fit_residual(0.001f)
+    , max_optical_position_variance(0.f)
 {
 
 };
@@ -33,6 +48,10 @@ ControllerManagerConfig::config2ptree()
 
     pt.put("version", ControllerManagerConfig::CONFIG_VERSION);
     pt.put("virtual_controller_count", virtual_controller_count);
+    pt.put("max_controller_count", max_controller_count);
+    pt.put("filter_warm_start_max_gap_ms", filter_warm_start_max_gap_ms);
+    pt.put("reference_sphere_fit_residual", reference_sphere_fit_residual);
+    pt.put("max_optical_position_variance", max_optical_position_variance);
 
     return pt;
 }
@@ -45,6 +64,10 @@ ControllerManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
     if (version == ControllerManagerConfig::CONFIG_VERSION)
     {
         virtual_controller_count = pt.get<int>("virtual_controller_count", 0);
+        max_controller_count = pt.get<int>("max_controller_count", PSMOVESERVICE_MAX_CONTROLLER_COUNT);
+        filter_warm_start_max_gap_ms = pt.get<int>("filter_warm_start_max_gap_ms", 2000);
+        reference_sphere_fit_residual = pt.get<float>("reference_sphere_fit_residual", reference_sphere_fit_residual);
+        max_optical_position_variance = pt.get<float>("max_optical_position_variance", max_optical_position_variance);
     }
     else
     {
@@ -57,7 +80,16 @@ ControllerManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
 //-- Controller Manager ----
 ControllerManager::ControllerManager()
     : DeviceTypeManager(1000, 2)
+    , shared_pose_writer(nullptr)
+    , shared_pose_input_reader(nullptr)
+    , pose_record_writer(nullptr)
+    , m_pose_filter_batch(new PoseFilterBatch)
+{
+}
+
+ControllerManager::~ControllerManager()
 {
+    delete m_pose_filter_batch;
 }
 
 bool
@@ -65,6 +97,12 @@ ControllerManager::startup()
 {
     bool success = true;
 
+    // Load any config from disk (it sizes the device table)
+    cfg.load();
+
+    // Save back out the config in case there were updated defaults
+    cfg.save();
+
     if (!DeviceTypeManager::startup())
     {
         success = false;
@@ -72,12 +110,6 @@ ControllerManager::startup()
 
     if (success)
     {
-		// Load any config from disk
-		cfg.load();
-
-        // Save back out the config in case there were updated defaults
-        cfg.save();
-
         // Copy the virtual controller count into the Virtual and Gamepad controller enumerator's static variable.
         // This breaks the dependency between the Controller Manager and the enumerator.
         VirtualControllerEnumerator::virtual_controller_count= cfg.virtual_controller_count;
@@ -93,7 +125,8 @@ ControllerManager::startup()
 
 	if (success && gamepad_api_enabled)
 	{
-		Gamepad_init();
+		// Gamepad events get pumped on their own thread from here on
+		success = GamepadPoller::startup();
 	}
 
     if (success)
@@ -118,35 +151,148 @@ ControllerManager::shutdown()
 	// Shutdown the gamepad api
 	if (gamepad_api_enabled)
 	{
-		Gamepad_shutdown();
+		GamepadPoller::shutdown();
 	}
 }
 
+void
+ControllerManager::poll_devices(const std::chrono::time_point<std::chrono::high_resolution_clock> &now)
+{
+    DeviceTypeManager::poll_devices(now);
+
+    // The injected poses skip the request path, they get read straight out of shared memory on every poll
+    if (shared_pose_input_reader != nullptr)
+    {
+        for (int device_id : getActiveDeviceIds())
+        {
+            ServerControllerView *controllerView = getControllerView(device_id);
+
+            if (controllerView->getIsVirtualController())
+            {
+                controllerView->pollExternalPoses(shared_pose_input_reader);
+            }
+        }
+    }
+}
+
+static bool
+get_is_filter_update_enabled(const ServerControllerView *controllerView)
+{
+	return
+		controllerView->getIsOpen() &&
+		controllerView->getControllerDeviceType() != CommonDeviceState::PSNavi &&
+		(controllerView->getIsBluetooth() || controllerView->getIsVirtualController());
+}
+
 void
 ControllerManager::updateStateAndPredict(TrackerManager* tracker_manager)
 {
-	for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
+	// Each controller only reads the tracker projection results and updates its own filter,
+	// so the controllers can all be updated in parallel.
+	// Pose filters with a batch kernel get left for the batched pass below.
+	run_device_tasks_and_wait([this, tracker_manager](int device_id)
 	{
-		ServerControllerViewPtr controllerView = getControllerViewPtr(device_id);
+		ServerControllerView *controllerView = getControllerView(device_id);
 
-		if (controllerView->getIsOpen() && 
-			controllerView->getControllerDeviceType() != CommonDeviceState::PSNavi &&
-            (controllerView->getIsBluetooth() || controllerView->getIsVirtualController()))
+		if (get_is_filter_update_enabled(controllerView))
 		{
 			controllerView->updateOpticalPoseEstimation(tracker_manager);
-			controllerView->updateStateAndPredict();
+
+			if (!controllerView->getCanBatchPoseFilter())
+			{
+				controllerView->updateStateAndPredict();
+			}
+		}
+	});
+
+	// Step the Madgwick/complementary filters of all the other controllers together,
+	// one packet of every controller per pass with the IMU steps vectorized across the controllers
+	ServerControllerView *batchedControllerViews[k_max_devices];
+	int batchedControllerCount = 0;
+
+	m_pose_filter_batch->clear();
+	for (int device_id : getActiveDeviceIds())
+	{
+		ServerControllerView *controllerView = getControllerView(device_id);
+
+		if (get_is_filter_update_enabled(controllerView) &&
+			controllerView->getCanBatchPoseFilter() &&
+			controllerView->beginBatchedStateUpdate(m_pose_filter_batch))
+		{
+			batchedControllerViews[batchedControllerCount++] = controllerView;
+		}
+	}
+
+	if (batchedControllerCount > 0)
+	{
+		{
+			SERVER_TRACE_SCOPE(ServerTraceStage_FilterUpdate);
+			m_pose_filter_batch->update();
+		}
+
+		for (int batch_index = 0; batch_index < batchedControllerCount; ++batch_index)
+		{
+			batchedControllerViews[batch_index]->endBatchedStateUpdate();
 		}
 	}
 }
 
 void ControllerManager::publish()
 {
+    // Write the shared memory slots (and the multicast snapshot) before DeviceTypeManager::publish()
+    // bumps the sequence numbers, so that a slot and the matching UDP data frame carry the same sequence number
+    ServerNetworkManager *network_manager= ServerNetworkManager::get_instance();
+    const bool bMulticastPoses= network_manager != nullptr && network_manager->get_is_multicast_pose_stream_enabled();
+
+    if (shared_pose_writer != nullptr || pose_record_writer != nullptr || bMulticastPoses)
+    {
+        ControllerStreamInfo stream_info;
+        stream_info.Clear();
+        stream_info.include_position_data= true;
+        stream_info.include_physics_data= true;
+
+        // Devices that closed this tick are still in the active list, so their slots get cleared once
+        for (int device_id : getActiveDeviceIds())
+        {
+            ServerControllerView *controllerView = getControllerView(device_id);
+
+            if (controllerView->getIsOpen())
+            {
+                CompactControllerPoseFrame pose_frame;
+
+                if (controllerView->getHasUnpublishedState() &&
+                    ServerControllerView::generate_controller_compact_pose_frame_for_stream(
+                        controllerView, &stream_info, &pose_frame))
+                {
+                    if (shared_pose_writer != nullptr)
+                    {
+                        shared_pose_writer->writeControllerPose(device_id, pose_frame);
+                    }
+
+                    if (pose_record_writer != nullptr)
+                    {
+                        pose_record_writer->writeControllerPose(pose_frame);
+                    }
+
+                    if (bMulticastPoses)
+                    {
+                        network_manager->add_multicast_controller_pose(pose_frame);
+                    }
+                }
+            }
+            else if (shared_pose_writer != nullptr)
+            {
+                shared_pose_writer->clearControllerPose(device_id);
+            }
+        }
+    }
+
     DeviceTypeManager::publish();
 
     bool bWasSystemButtonPressed= false;
-    for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
+    for (int device_id : getActiveDeviceIds())
 	{
-		ServerControllerViewPtr controllerView = getControllerViewPtr(device_id);
+		ServerControllerView *controllerView = getControllerView(device_id);
 
         if (controllerView->getIsOpen() && controllerView->getIsBluetooth())
         {
@@ -165,16 +311,42 @@ void ControllerManager::publish()
     }
 }
 
+bool
+ControllerManager::can_update_connected_devices()
+{
+    // A controller that's being paired drops and reappears on its own,
+    // so only rebuild the controller list once the bluetooth requests are done
+    return !ServerRequestHandler::get_instance()->any_active_bluetooth_requests();
+}
+
+bool
+ControllerManager::can_scan_devices_off_main_thread() const
+{
+	return true;
+}
+
 void
-ControllerManager::poll_devices()
+ControllerManager::scan_connected_device_paths(std::vector<std::string> &out_device_paths)
 {
-	// Poll all gamepads before updating the individual controllers
-	if (gamepad_api_enabled && can_poll_connected_devices())
+	// Only the HID and libusb enumerators are safe to walk off the main thread.
+	// The gamepad snapshots only support the main thread as a reader,
+	// and virtual controllers only change with the config,
+	// so both are picked up by the full update a scan change triggers.
+	const ControllerDeviceEnumerator::eAPIType scan_api_types[2] = {
+		ControllerDeviceEnumerator::CommunicationType_HID,
+		ControllerDeviceEnumerator::CommunicationType_USB
+	};
+
+	for (int api_index = 0; api_index < 2; ++api_index)
 	{
-		Gamepad_processEvents();
-	}
+		ControllerDeviceEnumerator enumerator(scan_api_types[api_index]);
 
-	DeviceTypeManager::poll_devices();
+		while (enumerator.is_valid())
+		{
+			out_device_paths.push_back(enumerator.get_path());
+			enumerator.next();
+		}
+	}
 }
 
 DeviceEnumerator *
@@ -195,6 +367,12 @@ ControllerManager::allocate_device_view(int device_id)
 	return new ServerControllerView(device_id);
 }
 
+int
+ControllerManager::get_configured_max_devices() const
+{
+    return std::max(std::min(cfg.max_controller_count, ControllerManager::k_max_devices), 1);
+}
+
 int ControllerManager::getListUpdatedResponseType()
 {
 	return PSMoveProtocol::Response_ResponseType_CONTROLLER_LIST_UPDATED;
@@ -203,7 +381,7 @@ int ControllerManager::getListUpdatedResponseType()
 int
 ControllerManager::getGamepadCount() const
 {
-    return gamepad_api_enabled ? Gamepad_numDevices() : 0;
+    return gamepad_api_enabled ? GamepadPoller::getGamepadCount() : 0;
 }
 
 void
@@ -223,7 +401,15 @@ ControllerManager::setControllerRumble(
 ServerControllerViewPtr
 ControllerManager::getControllerViewPtr(int device_id)
 {
-    assert(m_deviceViews != nullptr);
+    assert(ServerUtility::is_index_valid(device_id, getMaxDevices()));
 
     return std::static_pointer_cast<ServerControllerView>(m_deviceViews[device_id]);
+}
+
+ServerControllerView *
+ControllerManager::getControllerView(int device_id) const
+{
+    assert(ServerUtility::is_index_valid(device_id, getMaxDevices()));
+
+    return static_cast<ServerControllerView *>(getDeviceView(device_id));
 }
\ No newline at end of file
@@ -27,12 +27,24 @@ public:
 
     int version;
     int virtual_controller_count;
+    // Number of controller slots (1 to ControllerManager::k_max_devices).
+    // Clients only see the first PSMOVESERVICE_MAX_CONTROLLER_COUNT of them.
+    int max_controller_count;
+    // A controller that reconnects within this many milliseconds of dropping out resumes
+    // its previous pose filter state instead of converging from scratch (0 disables).
+    int filter_warm_start_max_gap_ms;
+    // Sphere fit residual at which an optical position counts as twice as noisy
+    // as its projection area alone says (<= 0 ignores the fit residual)
+    float reference_sphere_fit_residual;
+    // Optical positions with a higher variance (cm^2) get dropped before they reach the pose filter (<= 0 keeps all)
+    float max_optical_position_variance;
 };
 
 class ControllerManager : public DeviceTypeManager
 {
 public:
     ControllerManager();
+    virtual ~ControllerManager();
 
     /// Call hid_init()
     bool startup() override;
@@ -48,11 +60,8 @@ public:
         return cfg;
     }
 
-    static const int k_max_devices = PSMOVESERVICE_MAX_CONTROLLER_COUNT;
-    int getMaxDevices() const override
-    {
-        return ControllerManager::k_max_devices;
-    }
+    /// Most controller slots the config can ask for, sizes the per-device scratch arrays
+    static const int k_max_devices = 32;
 
     int getGamepadCount() const;
 
@@ -62,26 +71,46 @@ public:
     }
 
     ServerControllerViewPtr getControllerViewPtr(int device_id);
+    /// No ref counting, for the per-tick loops over getActiveDeviceIds()
+    ServerControllerView *getControllerView(int device_id) const;
 
     void setControllerRumble(int controller_id, float rumble_amount, CommonControllerState::RumbleChannel channel);
 
 protected:
-	// Fetch latest controller state
-	void poll_devices() override;
+	// Controller list changes wait for pending bluetooth requests
+	bool can_update_connected_devices() override;
+
+	// Also drains the shared memory pose input of the virtual controllers
+	void poll_devices(const std::chrono::time_point<std::chrono::high_resolution_clock> &now) override;
 
 	// Controller enumerator methods
+    bool can_scan_devices_off_main_thread() const override;
+    void scan_connected_device_paths(std::vector<std::string> &out_device_paths) override;
     class DeviceEnumerator *allocate_device_enumerator() override;
     void free_device_enumerator(class DeviceEnumerator *) override;
     ServerDeviceView *allocate_device_view(int device_id) override;
+    int get_configured_max_devices() const override;
 	int getListUpdatedResponseType() override;
 
 public:
 	bool gamepad_api_enabled;
 
+    /// Local shared memory pose channel (owned by the DeviceManager, null when disabled)
+    class SharedPoseStateWriter *shared_pose_writer;
+
+    /// Shared memory pose input of the virtual devices (owned by the DeviceManager, null when disabled)
+    class SharedPoseInputReader *shared_pose_input_reader;
+
+    /// Binary pose recording (owned by the DeviceManager, null when not recording)
+    class PoseRecordWriter *pose_record_writer;
+
 private:
     static const PSMoveProtocol::Response_ResponseType k_list_udpated_response_type = PSMoveProtocol::Response_ResponseType_CONTROLLER_LIST_UPDATED;
     std::string m_bluetooth_host_address;
     ControllerManagerConfig cfg;
+
+    // Steps the Madgwick/complementary pose filters of all the controllers together
+    class PoseFilterBatch *m_pose_filter_batch;
 };
 
 #endif // CONTROLLER_MANAGER_H
\ No newline at end of file
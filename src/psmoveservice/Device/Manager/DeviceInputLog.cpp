@@ -0,0 +1,1447 @@
+//-- includes -----
+#include "DeviceInputLog.h"
+#include "PSMoveConfig.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+//-- constants -----
+static const char k_log_magic[8] = { 'P', 'S', 'M', 'I', 'N', 'L', 'O', 'G' };
+static const uint32_t k_log_version = 1;
+
+// stdio buffer of the recording, big enough to absorb a few raw video frames
+static const size_t k_log_write_buffer_size = 4 << 20;
+
+// How long a blocking read of a replayed device sleeps once its recording has run out
+static const int k_exhausted_stream_sleep_ms = 10;
+
+static const wchar_t *k_replay_hid_error = L"Device input log replay";
+
+enum eLogRecordType
+{
+    LogRecord_ConfigFile = 1,           // Config name and contents
+    LogRecord_HIDDeviceList,            // Vendor/product filter followed by the enumerated devices
+    LogRecord_HIDDeviceOpened,          // Device path. Starts a new stream (stream 0 if the open failed).
+    LogRecord_HIDInputReport,           // Bytes returned by hid_read
+    LogRecord_HIDReadError,             // hid_read failed
+    LogRecord_HIDFeatureReport,         // Bytes returned by hid_get_feature_report
+    LogRecord_HIDFeatureReportError,    // Report id of a failed hid_get_feature_report
+    LogRecord_TrackerOpened,            // Device path and config name. Starts a new stream.
+    LogRecord_TrackerFrame,             // LogTrackerFrameHeader followed by the pixels
+};
+
+//-- private definitions -----
+// Everything in the log is stored in the byte order of the recording machine
+#pragma pack(push, 1)
+struct LogFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+
+struct LogRecordHeader
+{
+    uint32_t record_type;   // eLogRecordType
+    uint32_t stream_id;     // Device the record belongs to, 0 for global records
+    int64_t time_us;        // Time since the recording was started
+    uint32_t payload_size;
+    uint32_t reserved;
+};
+
+struct LogTrackerFrameHeader
+{
+    uint32_t is_raw_bayer;
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;
+};
+#pragma pack(pop)
+
+class LogPayloadWriter
+{
+public:
+    void write_bytes(const void *data, size_t byte_count)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+
+        m_bytes.insert(m_bytes.end(), bytes, bytes + byte_count);
+    }
+
+    void write_u32(uint32_t value)
+    {
+        write_bytes(&value, sizeof(value));
+    }
+
+    void write_string(const char *string)
+    {
+        const uint32_t length = (string != nullptr) ? static_cast<uint32_t>(strlen(string)) : 0;
+
+        write_u32(length);
+        write_bytes(string, length);
+    }
+
+    // Null strings are stored with a length of ~0
+    void write_wide_string(const wchar_t *string)
+    {
+        if (string != nullptr)
+        {
+            const size_t length = wcslen(string);
+
+            write_u32(static_cast<uint32_t>(length));
+            for (size_t char_index = 0; char_index < length; ++char_index)
+            {
+                write_u32(static_cast<uint32_t>(string[char_index]));
+            }
+        }
+        else
+        {
+            write_u32(~0u);
+        }
+    }
+
+    inline const unsigned char *get_data() const { return m_bytes.empty() ? nullptr : &m_bytes[0]; }
+    inline size_t get_size() const { return m_bytes.size(); }
+
+private:
+    std::vector<unsigned char> m_bytes;
+};
+
+class LogPayloadReader
+{
+public:
+    LogPayloadReader(const unsigned char *data, size_t byte_count)
+        : m_data(data)
+        , m_byte_count(byte_count)
+        , m_offset(0)
+    {
+    }
+
+    bool read_bytes(void *out_data, size_t byte_count)
+    {
+        bool bSuccess = false;
+
+        if (m_offset + byte_count <= m_byte_count)
+        {
+            memcpy(out_data, m_data + m_offset, byte_count);
+            m_offset += byte_count;
+            bSuccess = true;
+        }
+
+        return bSuccess;
+    }
+
+    bool read_u32(uint32_t &out_value)
+    {
+        return read_bytes(&out_value, sizeof(out_value));
+    }
+
+    bool read_string(std::string &out_string)
+    {
+        uint32_t length = 0;
+        bool bSuccess = false;
+
+        if (read_u32(length) && m_offset + length <= m_byte_count)
+        {
+            out_string.assign(reinterpret_cast<const char *>(m_data + m_offset), length);
+            m_offset += length;
+            bSuccess = true;
+        }
+
+        return bSuccess;
+    }
+
+    bool read_wide_string(std::wstring &out_string, bool &out_bIsNull)
+    {
+        uint32_t length = 0;
+        bool bSuccess = read_u32(length);
+
+        out_string.clear();
+        out_bIsNull = (length == ~0u);
+
+        if (bSuccess && !out_bIsNull)
+        {
+            for (uint32_t char_index = 0; bSuccess && char_index < length; ++char_index)
+            {
+                uint32_t value = 0;
+
+                bSuccess = read_u32(value);
+                out_string.push_back(static_cast<wchar_t>(value));
+            }
+        }
+
+        return bSuccess;
+    }
+
+    inline const unsigned char *get_remaining_data() const { return m_data + m_offset; }
+    inline size_t get_remaining_size() const { return m_byte_count - m_offset; }
+
+private:
+    const unsigned char *m_data;
+    size_t m_byte_count;
+    size_t m_offset;
+};
+
+// State of a recording, shared by every thread reading from a device
+struct LogRecorder
+{
+    LogRecorder()
+        : mutex()
+        , file(nullptr)
+        , start_us(0)
+        , next_stream_id(1)
+        , bRecordTrackerFrames(false)
+        , bWriteFailed(false)
+    {
+    }
+
+    std::mutex mutex;
+    FILE *file;
+    std::vector<char> write_buffer;
+    long long start_us;
+    uint32_t next_stream_id;
+    bool bRecordTrackerFrames;
+    bool bWriteFailed;
+};
+
+// Handed out in place of the hidapi handle while recording or replaying
+struct LoggedHIDDevice
+{
+    hid_device *device; // nullptr when replaying
+    uint32_t stream_id;
+    bool bNonBlocking;
+};
+
+struct ReplayRecord
+{
+    int64_t time_us;
+    uint32_t record_type;
+    uint32_t payload_size;
+    const unsigned char *payload; // Points into the mapped log
+};
+
+// Recorded reads of one opened device
+struct ReplayStream
+{
+    ReplayStream()
+        : mutex()
+        , input_cursor(0)
+        , feature_cursor(0)
+    {
+    }
+
+    std::mutex mutex;
+    std::vector<ReplayRecord> input_records; // Input reports and read errors, or tracker video frames
+    std::vector<ReplayRecord> feature_records;
+    size_t input_cursor;
+    size_t feature_cursor;
+};
+typedef std::unique_ptr<ReplayStream> ReplayStreamPtr;
+
+struct ReplayHIDDeviceInfo
+{
+    std::string path;
+    unsigned short vendor_id;
+    unsigned short product_id;
+    unsigned short release_number;
+    unsigned short usage_page;
+    unsigned short usage;
+    int interface_number;
+    std::wstring serial_number;
+    std::wstring manufacturer_string;
+    std::wstring product_string;
+    bool bHasSerialNumber;
+    bool bHasManufacturerString;
+    bool bHasProductString;
+};
+
+struct ReplayHIDDeviceList
+{
+    int64_t time_us;
+    uint32_t vendor_id;
+    uint32_t product_id;
+    std::vector<ReplayHIDDeviceInfo> devices;
+};
+
+struct ReplayDeviceOpening
+{
+    uint32_t stream_id;
+    std::string config_name;
+};
+typedef std::map<std::string, std::vector<ReplayDeviceOpening> > t_replay_opening_map;
+typedef std::map<std::string, size_t> t_replay_open_count_map;
+typedef std::map<uint32_t, size_t> t_replay_list_cursor_map;
+
+// State of a replay. Everything but the cursors is immutable once the log has been indexed.
+struct LogReplayer
+{
+    LogReplayer()
+        : file(nullptr)
+        , region(nullptr)
+        , bMaxSpeed(false)
+        , clock_start_us(-1)
+        , record_count(0)
+        , bFinished(false)
+    {
+    }
+
+    ~LogReplayer()
+    {
+        delete region;
+        delete file;
+    }
+
+    boost::interprocess::file_mapping *file;
+    boost::interprocess::mapped_region *region;
+    bool bMaxSpeed;
+    std::atomic<long long> clock_start_us;
+    long long record_count;
+    bool bFinished;
+
+    std::vector<ReplayStreamPtr> streams; // Indexed by stream id
+    std::vector<ReplayHIDDeviceList> hid_device_lists;
+    std::vector<std::string> tracker_paths;
+    t_replay_opening_map hid_openings;
+    t_replay_opening_map tracker_openings;
+
+    // Guards the cursors below, device opening is rare
+    std::mutex open_mutex;
+    t_replay_open_count_map hid_open_counts;
+    t_replay_open_count_map tracker_open_counts;
+    t_replay_list_cursor_map hid_device_list_cursors;
+};
+
+//-- globals -----
+static std::atomic<int> g_log_mode(DeviceInputLogMode_Off);
+static LogRecorder *g_recorder = nullptr;
+static LogReplayer *g_replayer = nullptr;
+
+//-- private methods -----
+static inline eDeviceInputLogMode get_log_mode()
+{
+    return static_cast<eDeviceInputLogMode>(g_log_mode.load(std::memory_order_acquire));
+}
+
+static inline LoggedHIDDevice *get_logged_device(hid_device *device)
+{
+    return reinterpret_cast<LoggedHIDDevice *>(device);
+}
+
+static void write_log_record(
+    uint32_t record_type,
+    uint32_t stream_id,
+    const void *payload, size_t payload_size,
+    const void *payload_tail = nullptr, size_t payload_tail_size = 0)
+{
+    LogRecorder *recorder = g_recorder;
+    std::lock_guard<std::mutex> lock(recorder->mutex);
+
+    if (!recorder->bWriteFailed)
+    {
+        LogRecordHeader header;
+        header.record_type = record_type;
+        header.stream_id = stream_id;
+        header.time_us = ServerUtility::get_service_time_us() - recorder->start_us;
+        header.payload_size = static_cast<uint32_t>(payload_size + payload_tail_size);
+        header.reserved = 0;
+
+        bool bSuccess = fwrite(&header, sizeof(header), 1, recorder->file) == 1;
+        if (bSuccess && payload_size > 0)
+        {
+            bSuccess = fwrite(payload, payload_size, 1, recorder->file) == 1;
+        }
+        if (bSuccess && payload_tail_size > 0)
+        {
+            bSuccess = fwrite(payload_tail, payload_tail_size, 1, recorder->file) == 1;
+        }
+
+        if (!bSuccess)
+        {
+            // Stop writing rather than leaving a torn record in the middle of the log
+            SERVER_MT_LOG_ERROR("DeviceInputLog") << "Failed to write the device input log, recording stopped";
+            recorder->bWriteFailed = true;
+        }
+    }
+}
+
+static uint32_t allocate_stream_id()
+{
+    LogRecorder *recorder = g_recorder;
+    std::lock_guard<std::mutex> lock(recorder->mutex);
+
+    return recorder->next_stream_id++;
+}
+
+static void record_config_directory()
+{
+    const boost::filesystem::path config_directory(PSMoveConfig::getConfigDirectoryPath());
+    boost::system::error_code error;
+
+    for (boost::filesystem::directory_iterator iter(config_directory, error), end; !error && iter != end; iter.increment(error))
+    {
+        const boost::filesystem::path &config_path = iter->path();
+
+        if (config_path.extension() == ".json" && boost::filesystem::is_regular_file(config_path))
+        {
+            std::ifstream config_file(config_path.string(), std::ios::in | std::ios::binary);
+            std::stringstream contents;
+
+            contents << config_file.rdbuf();
+            DeviceInputLog::record_config_file(config_path.stem().string(), contents.str());
+        }
+    }
+}
+
+static long long get_replay_time_us()
+{
+    const long long clock_start_us = g_replayer->clock_start_us.load(std::memory_order_relaxed);
+
+    return (clock_start_us >= 0) ? ServerUtility::get_service_time_us() - clock_start_us : 0;
+}
+
+static ReplayStream *get_replay_stream(uint32_t stream_id)
+{
+    return (stream_id > 0 && stream_id < g_replayer->streams.size()) ? g_replayer->streams[stream_id].get() : nullptr;
+}
+
+static ReplayStream *get_or_add_replay_stream(LogReplayer *replayer, uint32_t stream_id)
+{
+    if (stream_id >= replayer->streams.size())
+    {
+        replayer->streams.resize(stream_id + 1);
+    }
+
+    if (!replayer->streams[stream_id])
+    {
+        replayer->streams[stream_id].reset(new ReplayStream);
+    }
+
+    return replayer->streams[stream_id].get();
+}
+
+static bool parse_hid_device_list(const ReplayRecord &record, ReplayHIDDeviceList &out_list)
+{
+    LogPayloadReader reader(record.payload, record.payload_size);
+    uint32_t device_count = 0;
+    bool bSuccess =
+        reader.read_u32(out_list.vendor_id) &&
+        reader.read_u32(out_list.product_id) &&
+        reader.read_u32(device_count);
+
+    out_list.time_us = record.time_us;
+
+    for (uint32_t device_index = 0; bSuccess && device_index < device_count; ++device_index)
+    {
+        ReplayHIDDeviceInfo info;
+        uint32_t vendor_id = 0, product_id = 0, release_number = 0, usage_page = 0, usage = 0, interface_number = 0;
+
+        bSuccess =
+            reader.read_u32(vendor_id) &&
+            reader.read_u32(product_id) &&
+            reader.read_u32(release_number) &&
+            reader.read_u32(usage_page) &&
+            reader.read_u32(usage) &&
+            reader.read_u32(interface_number) &&
+            reader.read_string(info.path) &&
+            reader.read_wide_string(info.serial_number, info.bHasSerialNumber) &&
+            reader.read_wide_string(info.manufacturer_string, info.bHasManufacturerString) &&
+            reader.read_wide_string(info.product_string, info.bHasProductString);
+
+        // read_wide_string reports whether the string was null
+        info.bHasSerialNumber = !info.bHasSerialNumber;
+        info.bHasManufacturerString = !info.bHasManufacturerString;
+        info.bHasProductString = !info.bHasProductString;
+
+        info.vendor_id = static_cast<unsigned short>(vendor_id);
+        info.product_id = static_cast<unsigned short>(product_id);
+        info.release_number = static_cast<unsigned short>(release_number);
+        info.usage_page = static_cast<unsigned short>(usage_page);
+        info.usage = static_cast<unsigned short>(usage);
+        info.interface_number = static_cast<int>(interface_number);
+
+        if (bSuccess)
+        {
+            out_list.devices.push_back(info);
+        }
+    }
+
+    return bSuccess;
+}
+
+// Builds the replay index and extracts the first recorded version of every config file
+static bool index_replay_log(LogReplayer *replayer, const std::string &config_directory_path)
+{
+    const unsigned char *data = static_cast<const unsigned char *>(replayer->region->get_address());
+    const size_t byte_count = replayer->region->get_size();
+    LogFileHeader file_header;
+
+    if (byte_count < sizeof(file_header))
+    {
+        SERVER_LOG_ERROR("DeviceInputLog") << "Device input log is empty";
+        return false;
+    }
+
+    memcpy(&file_header, data, sizeof(file_header));
+    if (memcmp(file_header.magic, k_log_magic, sizeof(k_log_magic)) != 0 || file_header.version != k_log_version)
+    {
+        SERVER_LOG_ERROR("DeviceInputLog") << "Not a device input log (or recorded by another version of the service)";
+        return false;
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::create_directories(config_directory_path, error);
+
+    // Don't let configs from an older replay leak into this one
+    for (boost::filesystem::directory_iterator iter(config_directory_path, error), end; !error && iter != end; iter.increment(error))
+    {
+        if (iter->path().extension() == ".json")
+        {
+            boost::system::error_code remove_error;
+            boost::filesystem::remove(iter->path(), remove_error);
+        }
+    }
+
+    std::map<std::string, bool> extracted_configs;
+    size_t offset = sizeof(file_header);
+
+    while (offset + sizeof(LogRecordHeader) <= byte_count)
+    {
+        LogRecordHeader header;
+        memcpy(&header, data + offset, sizeof(header));
+
+        if (offset + sizeof(header) + header.payload_size > byte_count)
+        {
+            SERVER_LOG_WARNING("DeviceInputLog") << "Device input log ends with a truncated record, ignoring it";
+            break;
+        }
+
+        ReplayRecord record;
+        record.time_us = header.time_us;
+        record.record_type = header.record_type;
+        record.payload_size = header.payload_size;
+        record.payload = data + offset + sizeof(header);
+
+        switch (header.record_type)
+        {
+        case LogRecord_ConfigFile:
+            {
+                LogPayloadReader reader(record.payload, record.payload_size);
+                std::string config_name;
+
+                if (reader.read_string(config_name) && extracted_configs.find(config_name) == extracted_configs.end())
+                {
+                    const boost::filesystem::path config_path =
+                        boost::filesystem::path(config_directory_path) / (config_name + ".json");
+                    std::ofstream config_file(config_path.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+                    config_file.write(reinterpret_cast<const char *>(reader.get_remaining_data()), reader.get_remaining_size());
+                    extracted_configs[config_name] = true;
+                }
+            } break;
+        case LogRecord_HIDDeviceList:
+            {
+                ReplayHIDDeviceList device_list;
+
+                if (parse_hid_device_list(record, device_list))
+                {
+                    replayer->hid_device_lists.push_back(device_list);
+                }
+            } break;
+        case LogRecord_HIDDeviceOpened:
+        case LogRecord_TrackerOpened:
+            {
+                LogPayloadReader reader(record.payload, record.payload_size);
+                ReplayDeviceOpening opening;
+                std::string device_path;
+
+                opening.stream_id = header.stream_id;
+                if (reader.read_string(device_path))
+                {
+                    if (header.record_type == LogRecord_HIDDeviceOpened)
+                    {
+                        replayer->hid_openings[device_path].push_back(opening);
+                    }
+                    else if (reader.read_string(opening.config_name))
+                    {
+                        if (replayer->tracker_openings.find(device_path) == replayer->tracker_openings.end())
+                        {
+                            replayer->tracker_paths.push_back(device_path);
+                        }
+                        replayer->tracker_openings[device_path].push_back(opening);
+                    }
+
+                    if (opening.stream_id > 0)
+                    {
+                        get_or_add_replay_stream(replayer, opening.stream_id);
+                    }
+                }
+            } break;
+        case LogRecord_HIDInputReport:
+        case LogRecord_HIDReadError:
+        case LogRecord_TrackerFrame:
+            {
+                if (header.record_type != LogRecord_TrackerFrame || record.payload_size >= sizeof(LogTrackerFrameHeader))
+                {
+                    get_or_add_replay_stream(replayer, header.stream_id)->input_records.push_back(record);
+                }
+            } break;
+        case LogRecord_HIDFeatureReport:
+        case LogRecord_HIDFeatureReportError:
+            {
+                if (record.payload_size > 0)
+                {
+                    get_or_add_replay_stream(replayer, header.stream_id)->feature_records.push_back(record);
+                }
+            } break;
+        default:
+            // Skip record types added by newer versions of the service
+            break;
+        }
+
+        offset += sizeof(header) + header.payload_size;
+        ++replayer->record_count;
+    }
+
+    SERVER_LOG_INFO("DeviceInputLog") << "Indexed " << replayer->record_count << " device input records, extracted "
+        << extracted_configs.size() << " config files to " << config_directory_path;
+
+    return true;
+}
+
+static hid_device_info *allocate_replay_device_info_list(const ReplayHIDDeviceList &device_list)
+{
+    hid_device_info *head = nullptr;
+    hid_device_info **link = &head;
+
+    for (const ReplayHIDDeviceInfo &info : device_list.devices)
+    {
+        hid_device_info *device_info = new hid_device_info;
+        memset(device_info, 0, sizeof(hid_device_info));
+
+        device_info->path = new char[info.path.size() + 1];
+        memcpy(device_info->path, info.path.c_str(), info.path.size() + 1);
+        device_info->vendor_id = info.vendor_id;
+        device_info->product_id = info.product_id;
+        device_info->release_number = info.release_number;
+        device_info->usage_page = info.usage_page;
+        device_info->usage = info.usage;
+        device_info->interface_number = info.interface_number;
+
+        if (info.bHasSerialNumber)
+        {
+            device_info->serial_number = new wchar_t[info.serial_number.size() + 1];
+            wcscpy(device_info->serial_number, info.serial_number.c_str());
+        }
+        if (info.bHasManufacturerString)
+        {
+            device_info->manufacturer_string = new wchar_t[info.manufacturer_string.size() + 1];
+            wcscpy(device_info->manufacturer_string, info.manufacturer_string.c_str());
+        }
+        if (info.bHasProductString)
+        {
+            device_info->product_string = new wchar_t[info.product_string.size() + 1];
+            wcscpy(device_info->product_string, info.product_string.c_str());
+        }
+
+        *link = device_info;
+        link = &device_info->next;
+    }
+
+    return head;
+}
+
+static hid_device_info *replay_hid_enumerate(unsigned short vendor_id, unsigned short product_id)
+{
+    LogReplayer *replayer = g_replayer;
+    const long long replay_time_us = get_replay_time_us();
+    const uint32_t filter_key = (static_cast<uint32_t>(vendor_id) << 16) | product_id;
+    const ReplayHIDDeviceList *device_list = nullptr;
+    size_t match_index = 0;
+
+    std::lock_guard<std::mutex> lock(replayer->open_mutex);
+    const size_t list_cursor = replayer->hid_device_list_cursors[filter_key];
+
+    for (const ReplayHIDDeviceList &recorded_list : replayer->hid_device_lists)
+    {
+        if (recorded_list.vendor_id == vendor_id && recorded_list.product_id == product_id)
+        {
+            if (replayer->bMaxSpeed)
+            {
+                // Time is meaningless at max speed, hand out the recorded lists in order
+                device_list = &recorded_list;
+                if (match_index == list_cursor)
+                {
+                    break;
+                }
+            }
+            else if (device_list == nullptr || recorded_list.time_us <= replay_time_us)
+            {
+                // Use the latest list that is due (or the first one if none is due yet)
+                device_list = &recorded_list;
+            }
+
+            ++match_index;
+        }
+    }
+    replayer->hid_device_list_cursors[filter_key] = list_cursor + 1;
+
+    return (device_list != nullptr) ? allocate_replay_device_info_list(*device_list) : nullptr;
+}
+
+static void replay_hid_free_enumeration(hid_device_info *devs)
+{
+    while (devs != nullptr)
+    {
+        hid_device_info *next = devs->next;
+
+        delete[] devs->path;
+        delete[] devs->serial_number;
+        delete[] devs->manufacturer_string;
+        delete[] devs->product_string;
+        delete devs;
+
+        devs = next;
+    }
+}
+
+// Returns the stream of the n-th recorded opening of a device for the n-th replayed opening
+static const ReplayDeviceOpening *find_replay_opening(
+    const t_replay_opening_map &openings,
+    t_replay_open_count_map &open_counts,
+    const std::string &device_path)
+{
+    const ReplayDeviceOpening *opening = nullptr;
+    t_replay_opening_map::const_iterator iter = openings.find(device_path);
+
+    if (iter != openings.end())
+    {
+        size_t &open_count = open_counts[device_path];
+
+        if (open_count < iter->second.size())
+        {
+            opening = &iter->second[open_count];
+        }
+        ++open_count;
+    }
+
+    return opening;
+}
+
+static int replay_hid_read(LoggedHIDDevice *logged_device, unsigned char *data, size_t length, int milliseconds)
+{
+    ReplayStream *stream = get_replay_stream(logged_device->stream_id);
+    const long long deadline_us =
+        (milliseconds >= 0)
+        ? ServerUtility::get_service_time_us() + static_cast<long long>(milliseconds)*1000
+        : -1;
+
+    if (stream == nullptr)
+    {
+        return -1;
+    }
+
+    for (;;)
+    {
+        long long wait_us = 0;
+        bool bExhausted = false;
+
+        {
+            std::lock_guard<std::mutex> lock(stream->mutex);
+
+            if (stream->input_cursor < stream->input_records.size())
+            {
+                const ReplayRecord &record = stream->input_records[stream->input_cursor];
+
+                wait_us = g_replayer->bMaxSpeed ? 0 : record.time_us - get_replay_time_us();
+                if (wait_us <= 0)
+                {
+                    ++stream->input_cursor;
+
+                    if (record.record_type == LogRecord_HIDReadError)
+                    {
+                        return -1;
+                    }
+
+                    const size_t copy_size = (record.payload_size < length) ? record.payload_size : length;
+                    memcpy(data, record.payload, copy_size);
+
+                    return static_cast<int>(copy_size);
+                }
+            }
+            else
+            {
+                bExhausted = true;
+            }
+        }
+
+        // Block the way the device would until the next report is due or the read times out
+        const long long now_us = ServerUtility::get_service_time_us();
+
+        if (milliseconds == 0 || (deadline_us >= 0 && now_us >= deadline_us))
+        {
+            return 0;
+        }
+
+        if (bExhausted)
+        {
+            const long long remaining_us = (deadline_us >= 0) ? deadline_us - now_us : k_exhausted_stream_sleep_ms*1000;
+
+            std::this_thread::sleep_for(std::chrono::microseconds(
+                remaining_us < k_exhausted_stream_sleep_ms*1000 ? remaining_us : k_exhausted_stream_sleep_ms*1000));
+            return 0;
+        }
+
+        if (deadline_us >= 0 && now_us + wait_us > deadline_us)
+        {
+            wait_us = deadline_us - now_us;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+    }
+}
+
+static int replay_hid_get_feature_report(LoggedHIDDevice *logged_device, unsigned char *data, size_t length)
+{
+    ReplayStream *stream = get_replay_stream(logged_device->stream_id);
+
+    if (stream == nullptr || length == 0)
+    {
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(stream->mutex);
+    const size_t record_count = stream->feature_records.size();
+
+    // Reports get requested in the same order as when recording,
+    // but wrap around in case a driver asks for one more often now
+    for (size_t search_index = 0; search_index < record_count; ++search_index)
+    {
+        const size_t record_index = (stream->feature_cursor + search_index) % record_count;
+        const ReplayRecord &record = stream->feature_records[record_index];
+
+        if (record.payload[0] == data[0])
+        {
+            stream->feature_cursor = record_index + 1;
+
+            if (record.record_type == LogRecord_HIDFeatureReportError)
+            {
+                return -1;
+            }
+
+            const size_t copy_size = (record.payload_size < length) ? record.payload_size : length;
+            memcpy(data, record.payload, copy_size);
+
+            return static_cast<int>(copy_size);
+        }
+    }
+
+    return -1;
+}
+
+//-- public interface -----
+namespace DeviceInputLog
+{
+    bool start_recording(const std::string &log_path, bool bRecordTrackerFrames)
+    {
+        if (get_log_mode() != DeviceInputLogMode_Off)
+        {
+            SERVER_LOG_WARNING("DeviceInputLog::start_recording") << "Device input log already active, not recording";
+            return false;
+        }
+
+        FILE *file = fopen(log_path.c_str(), "wb");
+        if (file == nullptr)
+        {
+            SERVER_LOG_ERROR("DeviceInputLog::start_recording") << "Failed to create device input log " << log_path;
+            return false;
+        }
+
+        LogRecorder *recorder = new LogRecorder;
+        recorder->file = file;
+        recorder->write_buffer.resize(k_log_write_buffer_size);
+        setvbuf(file, &recorder->write_buffer[0], _IOFBF, recorder->write_buffer.size());
+        recorder->start_us = ServerUtility::get_service_time_us();
+        recorder->bRecordTrackerFrames = bRecordTrackerFrames;
+
+        LogFileHeader file_header;
+        memcpy(file_header.magic, k_log_magic, sizeof(k_log_magic));
+        file_header.version = k_log_version;
+        file_header.reserved = 0;
+        fwrite(&file_header, sizeof(file_header), 1, file);
+
+        g_recorder = recorder;
+        g_log_mode.store(DeviceInputLogMode_Recording, std::memory_order_release);
+
+        record_config_directory();
+
+        SERVER_LOG_INFO("DeviceInputLog::start_recording") << "Recording device input to " << log_path;
+
+        return true;
+    }
+
+    bool start_replay(const std::string &log_path, const std::string &config_directory_path, bool bMaxSpeed)
+    {
+        if (get_log_mode() != DeviceInputLogMode_Off)
+        {
+            SERVER_LOG_WARNING("DeviceInputLog::start_replay") << "Device input log already active, not replaying";
+            return false;
+        }
+
+        LogReplayer *replayer = new LogReplayer;
+        bool bSuccess = false;
+
+        replayer->bMaxSpeed = bMaxSpeed;
+
+        try
+        {
+            replayer->file = new boost::interprocess::file_mapping(log_path.c_str(), boost::interprocess::read_only);
+            replayer->region = new boost::interprocess::mapped_region(*replayer->file, boost::interprocess::read_only);
+
+            bSuccess = index_replay_log(replayer, config_directory_path);
+        }
+        catch (boost::interprocess::interprocess_exception &ex)
+        {
+            SERVER_LOG_ERROR("DeviceInputLog::start_replay") << "Failed to map device input log " << log_path << ": " << ex.what();
+        }
+
+        if (bSuccess)
+        {
+            PSMoveConfig::setConfigDirectoryOverride(config_directory_path);
+
+            g_replayer = replayer;
+            g_log_mode.store(DeviceInputLogMode_Replaying, std::memory_order_release);
+
+            SERVER_LOG_INFO("DeviceInputLog::start_replay") << "Replaying device input from " << log_path
+                << (bMaxSpeed ? " at max speed" : " at the recorded speed");
+        }
+        else
+        {
+            delete replayer;
+        }
+
+        return bSuccess;
+    }
+
+    void start_replay_clock()
+    {
+        if (get_log_mode() == DeviceInputLogMode_Replaying)
+        {
+            g_replayer->clock_start_us.store(ServerUtility::get_service_time_us());
+        }
+    }
+
+    bool poll_replay_finished()
+    {
+        if (get_log_mode() != DeviceInputLogMode_Replaying)
+        {
+            return false;
+        }
+
+        LogReplayer *replayer = g_replayer;
+
+        if (!replayer->bFinished)
+        {
+            size_t consumed_count = 0;
+            bool bAllStreamsConsumed = true;
+
+            for (const ReplayStreamPtr &stream : replayer->streams)
+            {
+                if (stream)
+                {
+                    std::lock_guard<std::mutex> lock(stream->mutex);
+
+                    consumed_count += stream->input_cursor;
+                    bAllStreamsConsumed &= (stream->input_cursor >= stream->input_records.size());
+                }
+            }
+
+            if (bAllStreamsConsumed)
+            {
+                const double elapsed_sec = static_cast<double>(get_replay_time_us()) / 1000000.0;
+
+                SERVER_LOG_INFO("DeviceInputLog::poll_replay_finished") << "Replay finished: " << consumed_count
+                    << " device reads and frames in " << elapsed_sec << "s ("
+                    << (elapsed_sec > 0.0 ? static_cast<double>(consumed_count) / elapsed_sec : 0.0) << "/s)";
+                replayer->bFinished = true;
+            }
+        }
+
+        return replayer->bFinished;
+    }
+
+    void shutdown()
+    {
+        const eDeviceInputLogMode mode = get_log_mode();
+
+        g_log_mode.store(DeviceInputLogMode_Off, std::memory_order_release);
+
+        if (mode == DeviceInputLogMode_Recording)
+        {
+            fclose(g_recorder->file);
+            delete g_recorder;
+            g_recorder = nullptr;
+        }
+        else if (mode == DeviceInputLogMode_Replaying)
+        {
+            delete g_replayer;
+            g_replayer = nullptr;
+        }
+    }
+
+    eDeviceInputLogMode get_mode()
+    {
+        return get_log_mode();
+    }
+
+    void record_config_file(const std::string &config_name, const std::string &contents)
+    {
+        if (get_log_mode() == DeviceInputLogMode_Recording)
+        {
+            LogPayloadWriter payload;
+
+            payload.write_string(config_name.c_str());
+            write_log_record(LogRecord_ConfigFile, 0, payload.get_data(), payload.get_size(), contents.data(), contents.size());
+        }
+    }
+
+    int record_tracker_opened(const std::string &device_path, const std::string &config_name)
+    {
+        uint32_t stream_id = 0;
+
+        if (get_log_mode() == DeviceInputLogMode_Recording && g_recorder->bRecordTrackerFrames)
+        {
+            LogPayloadWriter payload;
+
+            payload.write_string(device_path.c_str());
+            payload.write_string(config_name.c_str());
+            stream_id = allocate_stream_id();
+            write_log_record(LogRecord_TrackerOpened, stream_id, payload.get_data(), payload.get_size());
+        }
+
+        return static_cast<int>(stream_id);
+    }
+
+    void record_tracker_frame(int stream_id, const DeviceInputLogTrackerFrame &frame)
+    {
+        if (stream_id > 0 && get_log_mode() == DeviceInputLogMode_Recording && frame.buffer != nullptr)
+        {
+            LogTrackerFrameHeader frame_header;
+
+            frame_header.is_raw_bayer = frame.bIsRawBayer ? 1 : 0;
+            frame_header.width = static_cast<uint32_t>(frame.width);
+            frame_header.height = static_cast<uint32_t>(frame.height);
+            frame_header.stride = static_cast<uint32_t>(frame.stride);
+
+            write_log_record(
+                LogRecord_TrackerFrame, static_cast<uint32_t>(stream_id),
+                &frame_header, sizeof(frame_header),
+                frame.buffer, static_cast<size_t>(frame.stride)*frame.height);
+        }
+    }
+
+    int get_replay_tracker_count()
+    {
+        return (get_log_mode() == DeviceInputLogMode_Replaying) ? static_cast<int>(g_replayer->tracker_paths.size()) : 0;
+    }
+
+    bool get_replay_tracker_path(int tracker_index, std::string &out_device_path)
+    {
+        bool bSuccess = false;
+
+        if (ServerUtility::is_index_valid(tracker_index, get_replay_tracker_count()))
+        {
+            out_device_path = g_replayer->tracker_paths[tracker_index];
+            bSuccess = true;
+        }
+
+        return bSuccess;
+    }
+
+    int open_replay_tracker(const std::string &device_path, std::string &out_config_name)
+    {
+        uint32_t stream_id = 0;
+
+        if (get_log_mode() == DeviceInputLogMode_Replaying)
+        {
+            LogReplayer *replayer = g_replayer;
+            std::lock_guard<std::mutex> lock(replayer->open_mutex);
+            const ReplayDeviceOpening *opening =
+                find_replay_opening(replayer->tracker_openings, replayer->tracker_open_counts, device_path);
+
+            if (opening != nullptr)
+            {
+                stream_id = opening->stream_id;
+                out_config_name = opening->config_name;
+            }
+        }
+
+        return static_cast<int>(stream_id);
+    }
+
+    bool fetch_replay_tracker_frame(int stream_id, DeviceInputLogTrackerFrame &out_frame)
+    {
+        ReplayStream *stream =
+            (get_log_mode() == DeviceInputLogMode_Replaying) ? get_replay_stream(static_cast<uint32_t>(stream_id)) : nullptr;
+        bool bSuccess = false;
+
+        if (stream != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(stream->mutex);
+            const long long replay_time_us = get_replay_time_us();
+            size_t frame_index = stream->input_cursor;
+
+            if (g_replayer->bMaxSpeed)
+            {
+                bSuccess = frame_index < stream->input_records.size();
+            }
+            else
+            {
+                // Like a real camera, skip to the latest due frame if the service fell behind
+                while (frame_index < stream->input_records.size() &&
+                       stream->input_records[frame_index].time_us <= replay_time_us)
+                {
+                    ++frame_index;
+                    bSuccess = true;
+                }
+
+                if (bSuccess)
+                {
+                    --frame_index;
+                }
+            }
+
+            if (bSuccess)
+            {
+                const ReplayRecord &record = stream->input_records[frame_index];
+                LogTrackerFrameHeader frame_header;
+
+                memcpy(&frame_header, record.payload, sizeof(frame_header));
+                bSuccess = record.payload_size >= sizeof(frame_header) + static_cast<size_t>(frame_header.stride)*frame_header.height;
+
+                if (bSuccess)
+                {
+                    out_frame.buffer = record.payload + sizeof(frame_header);
+                    out_frame.width = static_cast<int>(frame_header.width);
+                    out_frame.height = static_cast<int>(frame_header.height);
+                    out_frame.stride = static_cast<int>(frame_header.stride);
+                    out_frame.bIsRawBayer = frame_header.is_raw_bayer != 0;
+                    out_frame.sequence_number = static_cast<long long>(frame_index);
+                }
+
+                stream->input_cursor = frame_index + 1;
+            }
+        }
+
+        return bSuccess;
+    }
+};
+
+//-- HID shims -----
+hid_device_info *logged_hid_enumerate(unsigned short vendor_id, unsigned short product_id)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+    hid_device_info *devs = nullptr;
+
+    if (mode == DeviceInputLogMode_Replaying)
+    {
+        devs = replay_hid_enumerate(vendor_id, product_id);
+    }
+    else
+    {
+        devs = hid_enumerate(vendor_id, product_id);
+
+        if (mode == DeviceInputLogMode_Recording)
+        {
+            LogPayloadWriter payload;
+            uint32_t device_count = 0;
+
+            for (hid_device_info *cur_dev = devs; cur_dev != nullptr; cur_dev = cur_dev->next)
+            {
+                ++device_count;
+            }
+
+            payload.write_u32(vendor_id);
+            payload.write_u32(product_id);
+            payload.write_u32(device_count);
+            for (hid_device_info *cur_dev = devs; cur_dev != nullptr; cur_dev = cur_dev->next)
+            {
+                payload.write_u32(cur_dev->vendor_id);
+                payload.write_u32(cur_dev->product_id);
+                payload.write_u32(cur_dev->release_number);
+                payload.write_u32(cur_dev->usage_page);
+                payload.write_u32(cur_dev->usage);
+                payload.write_u32(static_cast<uint32_t>(cur_dev->interface_number));
+                payload.write_string(cur_dev->path);
+                payload.write_wide_string(cur_dev->serial_number);
+                payload.write_wide_string(cur_dev->manufacturer_string);
+                payload.write_wide_string(cur_dev->product_string);
+            }
+
+            write_log_record(LogRecord_HIDDeviceList, 0, payload.get_data(), payload.get_size());
+        }
+    }
+
+    return devs;
+}
+
+void logged_hid_free_enumeration(hid_device_info *devs)
+{
+    if (get_log_mode() == DeviceInputLogMode_Replaying)
+    {
+        replay_hid_free_enumeration(devs);
+    }
+    else
+    {
+        hid_free_enumeration(devs);
+    }
+}
+
+hid_device *logged_hid_open_path(const char *path)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+    hid_device *result = nullptr;
+
+    if (mode == DeviceInputLogMode_Off)
+    {
+        result = hid_open_path(path);
+    }
+    else if (mode == DeviceInputLogMode_Recording)
+    {
+        hid_device *device = hid_open_path(path);
+        LogPayloadWriter payload;
+        uint32_t stream_id = 0;
+
+        if (device != nullptr)
+        {
+            LoggedHIDDevice *logged_device = new LoggedHIDDevice;
+
+            stream_id = allocate_stream_id();
+            logged_device->device = device;
+            logged_device->stream_id = stream_id;
+            logged_device->bNonBlocking = false;
+            result = reinterpret_cast<hid_device *>(logged_device);
+        }
+
+        // Failed opens get recorded too, so the replay fails the same ones
+        payload.write_string(path);
+        write_log_record(LogRecord_HIDDeviceOpened, stream_id, payload.get_data(), payload.get_size());
+    }
+    else
+    {
+        LogReplayer *replayer = g_replayer;
+        std::lock_guard<std::mutex> lock(replayer->open_mutex);
+        const ReplayDeviceOpening *opening =
+            find_replay_opening(replayer->hid_openings, replayer->hid_open_counts, path != nullptr ? path : "");
+
+        if (opening != nullptr && opening->stream_id > 0)
+        {
+            LoggedHIDDevice *logged_device = new LoggedHIDDevice;
+
+            logged_device->device = nullptr;
+            logged_device->stream_id = opening->stream_id;
+            logged_device->bNonBlocking = false;
+            result = reinterpret_cast<hid_device *>(logged_device);
+        }
+    }
+
+    return result;
+}
+
+void logged_hid_close(hid_device *device)
+{
+    if (get_log_mode() == DeviceInputLogMode_Off)
+    {
+        hid_close(device);
+    }
+    else if (device != nullptr)
+    {
+        LoggedHIDDevice *logged_device = get_logged_device(device);
+
+        if (logged_device->device != nullptr)
+        {
+            hid_close(logged_device->device);
+        }
+        delete logged_device;
+    }
+}
+
+int logged_hid_set_nonblocking(hid_device *device, int nonblock)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+    int result = 0;
+
+    if (mode == DeviceInputLogMode_Off)
+    {
+        result = hid_set_nonblocking(device, nonblock);
+    }
+    else if (device != nullptr)
+    {
+        LoggedHIDDevice *logged_device = get_logged_device(device);
+
+        if (logged_device->device != nullptr)
+        {
+            result = hid_set_nonblocking(logged_device->device, nonblock);
+        }
+        if (result == 0)
+        {
+            logged_device->bNonBlocking = (nonblock != 0);
+        }
+    }
+    else
+    {
+        result = -1;
+    }
+
+    return result;
+}
+
+int logged_hid_read(hid_device *device, unsigned char *data, size_t length)
+{
+    if (get_log_mode() == DeviceInputLogMode_Off)
+    {
+        return hid_read(device, data, length);
+    }
+
+    return logged_hid_read_timeout(device, data, length, get_logged_device(device)->bNonBlocking ? 0 : -1);
+}
+
+int logged_hid_read_timeout(hid_device *device, unsigned char *data, size_t length, int milliseconds)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+    int result = -1;
+
+    if (mode == DeviceInputLogMode_Off)
+    {
+        result = hid_read_timeout(device, data, length, milliseconds);
+    }
+    else if (mode == DeviceInputLogMode_Recording)
+    {
+        LoggedHIDDevice *logged_device = get_logged_device(device);
+
+        result = hid_read_timeout(logged_device->device, data, length, milliseconds);
+
+        if (result > 0)
+        {
+            write_log_record(LogRecord_HIDInputReport, logged_device->stream_id, data, static_cast<size_t>(result));
+        }
+        else if (result < 0)
+        {
+            write_log_record(LogRecord_HIDReadError, logged_device->stream_id, nullptr, 0);
+        }
+    }
+    else
+    {
+        result = replay_hid_read(get_logged_device(device), data, length, milliseconds);
+    }
+
+    return result;
+}
+
+int logged_hid_write(hid_device *device, const unsigned char *data, size_t length)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+
+    if (mode == DeviceInputLogMode_Off)
+    {
+        return hid_write(device, data, length);
+    }
+    else if (mode == DeviceInputLogMode_Recording)
+    {
+        return hid_write(get_logged_device(device)->device, data, length);
+    }
+
+    // Output reports (rumble, LEDs) have nowhere to go when replaying
+    return static_cast<int>(length);
+}
+
+int logged_hid_get_feature_report(hid_device *device, unsigned char *data, size_t length)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+    int result = -1;
+
+    if (mode == DeviceInputLogMode_Off)
+    {
+        result = hid_get_feature_report(device, data, length);
+    }
+    else if (mode == DeviceInputLogMode_Recording)
+    {
+        LoggedHIDDevice *logged_device = get_logged_device(device);
+        const unsigned char report_id = (length > 0) ? data[0] : 0;
+
+        result = hid_get_feature_report(logged_device->device, data, length);
+
+        if (result > 0)
+        {
+            write_log_record(LogRecord_HIDFeatureReport, logged_device->stream_id, data, static_cast<size_t>(result));
+        }
+        else
+        {
+            write_log_record(LogRecord_HIDFeatureReportError, logged_device->stream_id, &report_id, sizeof(report_id));
+        }
+    }
+    else
+    {
+        result = replay_hid_get_feature_report(get_logged_device(device), data, length);
+    }
+
+    return result;
+}
+
+int logged_hid_send_feature_report(hid_device *device, const unsigned char *data, size_t length)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+
+    if (mode == DeviceInputLogMode_Off)
+    {
+        return hid_send_feature_report(device, data, length);
+    }
+    else if (mode == DeviceInputLogMode_Recording)
+    {
+        return hid_send_feature_report(get_logged_device(device)->device, data, length);
+    }
+
+    return static_cast<int>(length);
+}
+
+const wchar_t *logged_hid_error(hid_device *device)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+
+    if (mode == DeviceInputLogMode_Off)
+    {
+        return hid_error(device);
+    }
+    else if (mode == DeviceInputLogMode_Recording)
+    {
+        return hid_error(device != nullptr ? get_logged_device(device)->device : nullptr);
+    }
+
+    return k_replay_hid_error;
+}
+
+hid_device *logged_hid_get_hidapi_device(hid_device *device)
+{
+    const eDeviceInputLogMode mode = get_log_mode();
+
+    if (mode == DeviceInputLogMode_Off)
+    {
+        return device;
+    }
+
+    return (device != nullptr) ? get_logged_device(device)->device : nullptr;
+}
@@ -0,0 +1,103 @@
+#ifndef DEVICE_INPUT_LOG_H
+#define DEVICE_INPUT_LOG_H
+
+//-- includes -----
+#include "hidapi.h"
+
+#include <string>
+#include <stddef.h>
+
+//-- constants -----
+enum eDeviceInputLogMode
+{
+    DeviceInputLogMode_Off,         // Devices are used directly
+    DeviceInputLogMode_Recording,   // Everything read from the devices also gets appended to the log
+    DeviceInputLogMode_Replaying    // The devices are simulated from a previously recorded log
+};
+
+//-- definitions -----
+/// A tracker video frame stored in the log
+struct DeviceInputLogTrackerFrame
+{
+    const unsigned char *buffer; // When replaying, points into the mapped log (valid until shutdown)
+    int width;
+    int height;
+    int stride;
+    bool bIsRawBayer;
+    long long sequence_number; // Replay only: index of the frame in the recording (frames skipped to catch up leave gaps)
+};
+
+//-- interface -----
+/// Record and replay of the raw input of the HID devices and trackers.
+/**
+ While recording, every HID device list, input and feature report, every tracker video frame
+ and the service config files get appended to a streaming binary log, each record stamped
+ with the time since the recording started.
+ Replaying maps the log and simulates the same devices from it (see the logged_hid_* shims
+ and InputLogTracker), so the service update loop can be profiled deterministically without
+ any hardware attached, either at the recorded pace or as fast as the service can consume it.
+ */
+namespace DeviceInputLog
+{
+    /// Starts appending everything read from the devices to the given file.
+    /// Also stores the current config files, so a replay starts out with the same settings.
+    /// Tracker frames are stored uncompressed, leave them out to only replay the HID devices.
+    bool start_recording(const std::string &log_path, bool bRecordTrackerFrames);
+
+    /// Maps a recorded log and routes every HID device and tracker to it.
+    /// The recorded config files get extracted into config_directory_path and every config gets pointed at it,
+    /// so this must happen before any of the service managers get constructed (they load their config then).
+    bool start_replay(const std::string &log_path, const std::string &config_directory_path, bool bMaxSpeed);
+
+    /// Starts the replay clock. Called from DeviceManager::startup, which is also where recordings start.
+    void start_replay_clock();
+
+    /// Logs the replay throughput once every recorded device stream has been consumed.
+    /// Returns true once the replay has finished.
+    bool poll_replay_finished();
+
+    /// Flushes and closes the log. Every logged device must have been closed by now.
+    void shutdown();
+
+    eDeviceInputLogMode get_mode();
+
+    // -- Recording
+    void record_config_file(const std::string &config_name, const std::string &contents);
+
+    /// Returns the stream id to record the frames of the tracker with (0 if not recording tracker frames)
+    int record_tracker_opened(const std::string &device_path, const std::string &config_name);
+    void record_tracker_frame(int stream_id, const DeviceInputLogTrackerFrame &frame);
+
+    // -- Replaying
+    int get_replay_tracker_count();
+    bool get_replay_tracker_path(int tracker_index, std::string &out_device_path);
+
+    /// Returns the stream id of the next recorded opening of the tracker (0 if there is none)
+    /// along with the name of the config the tracker was using
+    int open_replay_tracker(const std::string &device_path, std::string &out_config_name);
+
+    /// Fetches the next recorded frame of the tracker once it's due.
+    /// Returns false if there is no new frame yet.
+    bool fetch_replay_tracker_frame(int stream_id, DeviceInputLogTrackerFrame &out_frame);
+};
+
+//-- HID shims -----
+// Drop in replacements for the hidapi calls made by the HID device drivers and enumerators.
+// They call straight through to hidapi unless the device input log is recording
+// (what gets read is appended to the log) or replaying (the devices are simulated).
+struct hid_device_info *logged_hid_enumerate(unsigned short vendor_id, unsigned short product_id);
+void logged_hid_free_enumeration(struct hid_device_info *devs);
+hid_device *logged_hid_open_path(const char *path);
+void logged_hid_close(hid_device *device);
+int logged_hid_set_nonblocking(hid_device *device, int nonblock);
+int logged_hid_read(hid_device *device, unsigned char *data, size_t length);
+int logged_hid_read_timeout(hid_device *device, unsigned char *data, size_t length, int milliseconds);
+int logged_hid_write(hid_device *device, const unsigned char *data, size_t length);
+int logged_hid_get_feature_report(hid_device *device, unsigned char *data, size_t length);
+int logged_hid_send_feature_report(hid_device *device, const unsigned char *data, size_t length);
+const wchar_t *logged_hid_error(hid_device *device);
+
+// The hidapi handle behind a logged device, for calls that need to go around hidapi (nullptr when replaying)
+hid_device *logged_hid_get_hidapi_device(hid_device *device);
+
+#endif // DEVICE_INPUT_LOG_H
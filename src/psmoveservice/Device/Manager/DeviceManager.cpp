@@ -1,12 +1,16 @@
 //-- includes -----
 #include "DeviceManager.h"
+#include "CameraNodeLink.h"
 
 #include "ControllerManager.h"
 #include "DeviceEnumerator.h"
+#include "DeviceInputLog.h"
 #include "HMDManager.h"
 #include "OrientationFilter.h"
 #ifdef WIN32
 #include "PlatformDeviceAPIWin32.h"
+#else
+#include "PlatformDeviceAPILibUSB.h"
 #endif // WIN32
 #include "ServerControllerView.h"
 #include "ServerHMDView.h"
@@ -18,7 +22,17 @@
 #include "ServerUtility.h"
 #include "PSMoveProtocol.pb.h"
 #include "PSMoveConfig.h"
+#include "PoseRecordWriter.h"
+#include "SharedPoseInputReader.h"
+#include "SharedPoseStateWriter.h"
+#include "SharedTrackerProjectionWriter.h"
+#include "ThreadPool.h"
 #include "TrackerManager.h"
+#include "WakeupSignal.h"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
 
 #include <chrono>
 
@@ -29,6 +43,12 @@ static const int k_default_tracker_reconnect_interval= 10000; // ms
 static const int k_default_tracker_poll_interval= 13; // 1000/75 ms
 static const int k_default_hmd_reconnect_interval= 10000; // ms
 static const int k_default_hmd_poll_interval= 2; // ms
+static const int k_default_device_update_worker_count= -1; // one per spare core
+static const int k_default_idle_mode_delay= 2000; // ms
+static const int k_default_idle_poll_interval= 50; // ms
+static const char *k_default_device_input_log_filename= "DeviceInputLog.bin";
+static const char *k_default_pose_record_basename= "PoseRecord";
+static const int k_default_pose_record_chunk_size_mb= 64;
 
 class DeviceManagerConfig : public PSMoveConfig
 {
@@ -45,6 +65,23 @@ public:
         , hmd_poll_interval(k_default_hmd_poll_interval)
 		, gamepad_api_enabled(true)
 		, platform_api_enabled(true)
+		, device_update_worker_count(k_default_device_update_worker_count)
+		, device_update_worker_cpu_cores()
+		, device_update_worker_priority("normal")
+		, idle_when_not_streaming(true)
+		, idle_mode_delay(k_default_idle_mode_delay)
+		, idle_poll_interval(k_default_idle_poll_interval)
+		, shared_memory_poses_enabled(true)
+		, shared_memory_pose_input_enabled(false)
+		, shared_memory_projections_enabled(false)
+		, background_device_scan_enabled(true)
+		, record_device_input(false)
+		, record_tracker_frames(true)
+		, device_input_log_path()
+		, record_poses(false)
+		, pose_record_path()
+		, pose_record_chunk_size_mb(k_default_pose_record_chunk_size_mb)
+		, pose_record_max_chunk_count(0)
     {};
 
     const boost::property_tree::ptree
@@ -61,6 +98,23 @@ public:
         pt.put("hmd_poll_interval", hmd_poll_interval); 
 		pt.put("gamepad_api_enabled", gamepad_api_enabled);
 		pt.put("platform_api_enabled", platform_api_enabled);
+		pt.put("device_update_worker_count", device_update_worker_count);
+		pt.put("device_update_worker_cpu_cores", device_update_worker_cpu_cores);
+		pt.put("device_update_worker_priority", device_update_worker_priority);
+		pt.put("idle_when_not_streaming", idle_when_not_streaming);
+		pt.put("idle_mode_delay", idle_mode_delay);
+		pt.put("idle_poll_interval", idle_poll_interval);
+		pt.put("shared_memory_poses_enabled", shared_memory_poses_enabled);
+		pt.put("shared_memory_pose_input_enabled", shared_memory_pose_input_enabled);
+		pt.put("shared_memory_projections_enabled", shared_memory_projections_enabled);
+		pt.put("background_device_scan_enabled", background_device_scan_enabled);
+		pt.put("record_device_input", record_device_input);
+		pt.put("record_tracker_frames", record_tracker_frames);
+		pt.put("device_input_log_path", device_input_log_path);
+		pt.put("record_poses", record_poses);
+		pt.put("pose_record_path", pose_record_path);
+		pt.put("pose_record_chunk_size_mb", pose_record_chunk_size_mb);
+		pt.put("pose_record_max_chunk_count", pose_record_max_chunk_count);
 
         return pt;
     }
@@ -80,6 +134,23 @@ public:
             hmd_poll_interval = pt.get<int>("hmd_poll_interval", k_default_hmd_poll_interval);
 		    gamepad_api_enabled = pt.get<bool>("gamepad_api_enabled", gamepad_api_enabled);
 		    platform_api_enabled = pt.get<bool>("platform_api_enabled", platform_api_enabled);
+		    device_update_worker_count = pt.get<int>("device_update_worker_count", device_update_worker_count);
+		    device_update_worker_cpu_cores = pt.get<std::string>("device_update_worker_cpu_cores", device_update_worker_cpu_cores);
+		    device_update_worker_priority = pt.get<std::string>("device_update_worker_priority", device_update_worker_priority);
+		    idle_when_not_streaming = pt.get<bool>("idle_when_not_streaming", idle_when_not_streaming);
+		    idle_mode_delay = pt.get<int>("idle_mode_delay", idle_mode_delay);
+		    idle_poll_interval = pt.get<int>("idle_poll_interval", idle_poll_interval);
+		    shared_memory_poses_enabled = pt.get<bool>("shared_memory_poses_enabled", shared_memory_poses_enabled);
+		    shared_memory_pose_input_enabled = pt.get<bool>("shared_memory_pose_input_enabled", shared_memory_pose_input_enabled);
+		    shared_memory_projections_enabled = pt.get<bool>("shared_memory_projections_enabled", shared_memory_projections_enabled);
+		    background_device_scan_enabled = pt.get<bool>("background_device_scan_enabled", background_device_scan_enabled);
+		    record_device_input = pt.get<bool>("record_device_input", record_device_input);
+		    record_tracker_frames = pt.get<bool>("record_tracker_frames", record_tracker_frames);
+		    device_input_log_path = pt.get<std::string>("device_input_log_path", device_input_log_path);
+		    record_poses = pt.get<bool>("record_poses", record_poses);
+		    pose_record_path = pt.get<std::string>("pose_record_path", pose_record_path);
+		    pose_record_chunk_size_mb = pt.get<int>("pose_record_chunk_size_mb", pose_record_chunk_size_mb);
+		    pose_record_max_chunk_count = pt.get<int>("pose_record_max_chunk_count", pose_record_max_chunk_count);
         }
         else
         {
@@ -97,9 +168,66 @@ public:
     int hmd_reconnect_interval;
     int hmd_poll_interval;    
 	bool gamepad_api_enabled;
+	// Listen for device hotplug events (Win32 device notifications, libusb/udev elsewhere)
+	// instead of enumerating the devices every reconnect_interval
 	bool platform_api_enabled;
+	// Worker threads used to update device filters in parallel (-1 = auto, 0 = main thread only)
+	int device_update_worker_count;
+	// Cores the device update workers are pinned to, ex) "2-5" (empty = any core)
+	std::string device_update_worker_cpu_cores;
+	// Scheduling class of the device update workers: "normal", "high" or "realtime"
+	std::string device_update_worker_priority;
+	// With no data streams running, stop processing tracker video and poll the devices
+	// no faster than idle_poll_interval (ms) once idle_mode_delay (ms) has passed
+	bool idle_when_not_streaming;
+	int idle_mode_delay;
+	int idle_poll_interval;
+	// Publish controller and HMD poses into shared memory for clients on the same machine
+	bool shared_memory_poses_enabled;
+	// Let external tracking systems drive the virtual controllers and HMDs through shared memory (see SharedPoseInput.h)
+	bool shared_memory_pose_input_enabled;
+	// Publish each tracker's search regions and found projections into shared memory (see SharedTrackerProjections.h),
+	// so debug tools can draw the tracking overlay without streaming the tracker video
+	bool shared_memory_projections_enabled;
+	// Without platform hotplug events, look for device changes on a background thread
+	// instead of enumerating on the main thread every reconnect interval
+	bool background_device_scan_enabled;
+	// Record the raw input of the HID devices and trackers for replaying with --replay
+	bool record_device_input;
+	// Include the (uncompressed) tracker video frames in the recording
+	bool record_tracker_frames;
+	// Where the recording goes, empty for DeviceInputLog.bin in the config directory
+	std::string device_input_log_path;
+	// Append every published controller and HMD pose to a binary recording (see PoseRecordFormat.h)
+	bool record_poses;
+	// Base path of the recording's chunk and index files, empty for PoseRecord in the config directory
+	std::string pose_record_path;
+	// Size of each chunk file, the recording moves on to a new chunk once one fills up
+	int pose_record_chunk_size_mb;
+	// Chunks kept on disk, the oldest gets deleted past this (0 = keep every chunk)
+	int pose_record_max_chunk_count;
 };
 
+//-- private methods -----
+static DeviceStateSnapshotEntry make_snapshot_entry(
+    int device_id,
+    CommonDeviceState::eDeviceType device_type,
+    bool is_tracking,
+    const CommonDevicePose &pose,
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &last_new_data_time)
+{
+    DeviceStateSnapshotEntry entry;
+
+    entry.device_id = device_id;
+    entry.device_type = device_type;
+    entry.is_tracking = is_tracking;
+    entry.pose = pose;
+    entry.last_new_data_time_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(last_new_data_time.time_since_epoch()).count();
+
+    return entry;
+}
+
 // DeviceManager - This is the interface used by PSMoveService
 DeviceManager *DeviceManager::m_instance= nullptr;
 
@@ -107,9 +235,21 @@ DeviceManager::DeviceManager()
     : m_config() // NULL config until startup
 	, m_platform_api_type(_eDevicePlatformApiType_None)
 	, m_platform_api(nullptr)
+	, m_update_rate()
+	, m_bIsIdle(false)
+	, m_last_active_time()
+	, m_command_queue()
+	, m_snapshot_readers()
+	, m_snapshot()
+	, m_update_index(0)
     , m_controller_manager(new ControllerManager())
     , m_tracker_manager(new TrackerManager())
     , m_hmd_manager(new HMDManager())
+    , m_thread_pool(new ThreadPool())
+    , m_shared_pose_writer(new SharedPoseStateWriter())
+    , m_shared_pose_input_reader(new SharedPoseInputReader())
+    , m_shared_projection_writer(new SharedTrackerProjectionWriter())
+    , m_pose_record_writer(new PoseRecordWriter())
 {
 }
 
@@ -118,6 +258,11 @@ DeviceManager::~DeviceManager()
     delete m_controller_manager;
     delete m_tracker_manager;
     delete m_hmd_manager;
+    delete m_thread_pool;
+    delete m_shared_pose_writer;
+    delete m_shared_pose_input_reader;
+    delete m_shared_projection_writer;
+    delete m_pose_record_writer;
 
 	if (m_platform_api != nullptr)
 	{
@@ -137,13 +282,36 @@ DeviceManager::startup()
 
 	// Save the config back out again in case defaults changed
 	m_config->save();
+
+	// The recording and replay clocks both start before any device gets opened
+	const bool bIsReplaying = DeviceInputLog::get_mode() == DeviceInputLogMode_Replaying;
+	if (bIsReplaying)
+	{
+		DeviceInputLog::start_replay_clock();
+	}
+	else if (m_config->record_device_input)
+	{
+		std::string log_path = m_config->device_input_log_path;
+
+		if (log_path.empty())
+		{
+			log_path = (boost::filesystem::path(PSMoveConfig::getConfigDirectoryPath()) / k_default_device_input_log_filename).string();
+		}
+
+		// Not fatal, the service just runs without recording
+		DeviceInputLog::start_recording(log_path, m_config->record_tracker_frames);
+	}
     
-	// Optionally create the platform device hot plug API
-	if (m_config->platform_api_enabled)
+	// Optionally create the platform device hot plug API.
+	// Hotplug events of the real devices mean nothing to a replay.
+	if (m_config->platform_api_enabled && !bIsReplaying)
 	{
 #ifdef WIN32
 		m_platform_api_type = _eDevicePlatformApiType_Win32;
 		m_platform_api = new PlatformDeviceAPIWin32;
+#else
+		m_platform_api_type = _eDevicePlatformApiType_LibUSB;
+		m_platform_api = new PlatformDeviceAPILibUSB;
 #endif
 		SERVER_LOG_INFO("DeviceManager::startup") << "Platform Hotplug API is ENABLED";
 	}
@@ -157,35 +325,144 @@ DeviceManager::startup()
 		success &= m_platform_api->startup(this);
 	}
 
-	// Register for hotplug events if this platform supports them
+	// Register for hotplug events if this platform supports them,
+	// the device types it can't report keep getting enumerated periodically
 	int controller_reconnect_interval = m_config->controller_reconnect_interval;
 	int tracker_reconnect_interval = m_config->tracker_reconnect_interval;
 	int hmd_reconnect_interval = m_config->hmd_reconnect_interval;
 	if (success && m_platform_api_type != _eDevicePlatformApiType_None)
 	{
-		registerHotplugListener(CommonDeviceState::Controller, m_controller_manager);
-		controller_reconnect_interval = -1;
+		const bool bHasHIDHotplug = m_platform_api->get_is_hotplug_supported(DeviceClass::DeviceClass_HID);
+		const bool bHasCameraHotplug = m_platform_api->get_is_hotplug_supported(DeviceClass::DeviceClass_Camera);
+
+		if (bHasHIDHotplug)
+		{
+			registerHotplugListener(CommonDeviceState::Controller, m_controller_manager);
+			controller_reconnect_interval = -1;
+		}
+
+		if (bHasCameraHotplug)
+		{
+			registerHotplugListener(CommonDeviceState::TrackingCamera, m_tracker_manager);
+			tracker_reconnect_interval = -1;
+		}
+
+		if (bHasHIDHotplug)
+		{
+			registerHotplugListener(CommonDeviceState::HeadMountedDisplay, m_hmd_manager);
+			hmd_reconnect_interval = -1;
+		}
+	}
+
+	// Pool shared by the device managers for per-device work
+	success &= m_thread_pool->startup(
+		m_config->device_update_worker_count,
+		m_config->device_update_worker_cpu_cores,
+		m_config->device_update_worker_priority);
+
+	// Optionally publish poses to local clients through shared memory.
+	// Not fatal if it fails, clients just keep using the UDP data frames.
+	SharedPoseStateWriter *shared_pose_writer = nullptr;
+	if (m_config->shared_memory_poses_enabled)
+	{
+		if (m_shared_pose_writer->startup())
+		{
+			shared_pose_writer = m_shared_pose_writer;
+			SERVER_LOG_INFO("DeviceManager::startup") << "Shared memory pose channel is ENABLED";
+		}
+		else
+		{
+			SERVER_LOG_WARNING("DeviceManager::startup") << "Failed to create the shared memory pose channel";
+		}
+	}
+	else
+	{
+		SERVER_LOG_INFO("DeviceManager::startup") << "Shared memory pose channel is DISABLED";
+	}
+
+	// Optionally take the virtual device poses from external trackers through shared memory (not fatal either)
+	SharedPoseInputReader *shared_pose_input_reader = nullptr;
+	if (m_config->shared_memory_pose_input_enabled)
+	{
+		if (m_shared_pose_input_reader->startup())
+		{
+			shared_pose_input_reader = m_shared_pose_input_reader;
+			SERVER_LOG_INFO("DeviceManager::startup") << "Shared memory pose input is ENABLED";
+		}
+		else
+		{
+			SERVER_LOG_WARNING("DeviceManager::startup") << "Failed to create the shared memory pose input";
+		}
+	}
+
+	// Optionally export the tracker projections for debug tools (not fatal either)
+	SharedTrackerProjectionWriter *shared_projection_writer = nullptr;
+	if (m_config->shared_memory_projections_enabled)
+	{
+		if (m_shared_projection_writer->startup())
+		{
+			shared_projection_writer = m_shared_projection_writer;
+			SERVER_LOG_INFO("DeviceManager::startup") << "Shared memory tracker projections are ENABLED";
+		}
+		else
+		{
+			SERVER_LOG_WARNING("DeviceManager::startup") << "Failed to create the shared memory tracker projections";
+		}
+	}
 
-		registerHotplugListener(CommonDeviceState::TrackingCamera, m_tracker_manager);
-		tracker_reconnect_interval = -1;
+	// Optionally record the published poses for offline analysis (not fatal either)
+	PoseRecordWriter *pose_record_writer = nullptr;
+	if (m_config->record_poses)
+	{
+		std::string record_path = m_config->pose_record_path;
+
+		if (record_path.empty())
+		{
+			record_path = (boost::filesystem::path(PSMoveConfig::getConfigDirectoryPath()) / k_default_pose_record_basename).string();
+		}
 
-		registerHotplugListener(CommonDeviceState::HeadMountedDisplay, m_hmd_manager);
-		hmd_reconnect_interval = -1;
+		const size_t chunk_size_bytes = static_cast<size_t>(std::max(m_config->pose_record_chunk_size_mb, 1)) * 1024 * 1024;
+		if (m_pose_record_writer->startup(record_path, chunk_size_bytes, m_config->pose_record_max_chunk_count))
+		{
+			pose_record_writer = m_pose_record_writer;
+		}
+		else
+		{
+			SERVER_LOG_WARNING("DeviceManager::startup") << "Failed to start the pose recording at " << record_path;
+		}
 	}
 
     m_controller_manager->reconnect_interval = controller_reconnect_interval;
+    m_controller_manager->background_scan_enabled = m_config->background_device_scan_enabled;
+    m_controller_manager->thread_pool = m_thread_pool;
     m_controller_manager->poll_interval = m_config->controller_poll_interval;
-	m_controller_manager->gamepad_api_enabled= m_config->gamepad_api_enabled;
+    m_controller_manager->idle_poll_interval = m_config->idle_poll_interval;
+	m_controller_manager->gamepad_api_enabled= m_config->gamepad_api_enabled && !bIsReplaying; // Gamepads aren't recorded
+    m_controller_manager->shared_pose_writer = shared_pose_writer;
+    m_controller_manager->shared_pose_input_reader = shared_pose_input_reader;
+    m_controller_manager->pose_record_writer = pose_record_writer;
     success &= m_controller_manager->startup();
     
     m_tracker_manager->reconnect_interval = tracker_reconnect_interval;
+    m_tracker_manager->thread_pool = m_thread_pool;
     m_tracker_manager->poll_interval = m_config->tracker_poll_interval;
+    m_tracker_manager->idle_poll_interval = m_config->idle_poll_interval;
+    m_tracker_manager->shared_projection_writer = shared_projection_writer;
     success &= m_tracker_manager->startup();
 
     m_hmd_manager->reconnect_interval = hmd_reconnect_interval;
+    m_hmd_manager->background_scan_enabled = m_config->background_device_scan_enabled;
+    m_hmd_manager->thread_pool = m_thread_pool;
     m_hmd_manager->poll_interval = m_config->hmd_poll_interval;
+    m_hmd_manager->idle_poll_interval = m_config->idle_poll_interval;
+    m_hmd_manager->shared_pose_writer = shared_pose_writer;
+    m_hmd_manager->shared_pose_input_reader = shared_pose_input_reader;
+    m_hmd_manager->pose_record_writer = pose_record_writer;
     success &= m_hmd_manager->startup();    
     
+    // Give the first clients idle_mode_delay to connect before idling
+    m_last_active_time = std::chrono::high_resolution_clock::now();
+
     m_instance= this;
     
     return success;
@@ -194,6 +471,13 @@ DeviceManager::startup()
 void
 DeviceManager::update()
 {
+    m_update_rate.addEvents();
+
+	m_command_queue.runPending(); // Apply the changes other threads asked for since the last update
+
+	refreshIdleMode(); // Throttle everything down while nobody is streaming
+	m_tracker_manager->updateCaptureSuspension(); // Stop the camera streams while nothing needs video frames
+
 	if (m_platform_api != nullptr)
 	{
 		m_platform_api->poll(); // Send device hotplug events
@@ -203,12 +487,180 @@ DeviceManager::update()
     m_tracker_manager->poll(); // Update tracker count and poll video frames
     m_hmd_manager->poll(); // Update HMD count and poll IMU state
 
+    if (!m_bIsIdle)
+    {
+        m_tracker_manager->computeProjections(); // Find tracking blobs in new video frames (on the tracker worker threads)
+        m_tracker_manager->sendCameraNodeProjections(); // Camera nodes only: hand the tracking blobs to the host
+        m_tracker_manager->publishSharedProjections(); // Let local debug tools draw the tracking blobs
+    }
+
     m_controller_manager->updateStateAndPredict(m_tracker_manager); // Compute pose/prediction of tracking blob+IMU state
     m_hmd_manager->updateStateAndPredict(m_tracker_manager); // Compute pose/prediction of tracking blobs+IMU state
 
+    if (!m_bIsIdle)
+    {
+        m_tracker_manager->computeDeferredProjections(); // Process the frames that start the next frameset
+    }
+
     m_controller_manager->publish(); // publish controller state to any listening clients  (common case)
     m_tracker_manager->publish(); // publish tracker state to any listening clients (probably only used by ConfigTool)
     m_hmd_manager->publish(); // publish hmd state to any listening clients (common case)
+
+    DeviceInputLog::poll_replay_finished(); // Report the replay throughput once the log runs out
+
+    publishStateSnapshot(); // Hand the final state of this update to the other threads
+    ++m_update_index;
+}
+
+DeviceStateSnapshotReader *
+DeviceManager::openStateSnapshotReader()
+{
+    m_snapshot_readers.push_back(std::unique_ptr<DeviceStateSnapshotReader>(new DeviceStateSnapshotReader()));
+
+    DeviceStateSnapshotReader *reader = m_snapshot_readers.back().get();
+
+    // Readers opened between updates still see the last state
+    if (m_snapshot.update_index >= 0)
+    {
+        reader->publish(m_snapshot);
+    }
+
+    return reader;
+}
+
+void
+DeviceManager::closeStateSnapshotReader(DeviceStateSnapshotReader *reader)
+{
+    auto iter = std::find_if(
+        m_snapshot_readers.begin(), m_snapshot_readers.end(),
+        [reader](const std::unique_ptr<DeviceStateSnapshotReader> &entry) { return entry.get() == reader; });
+
+    if (iter != m_snapshot_readers.end())
+    {
+        m_snapshot_readers.erase(iter);
+    }
+}
+
+void
+DeviceManager::postCommand(const CommandQueue::t_command &command)
+{
+    // Commands can use the tracker views like a request handler, so they wait for pipelined vision work too
+    m_command_queue.post(
+        [this, command]()
+        {
+            m_tracker_manager->finishPipelinedProjections();
+            command();
+        });
+
+    // Don't leave the command waiting for the next device poll
+    WakeupSignal::notifyMainLoop();
+}
+
+void
+DeviceManager::publishStateSnapshot()
+{
+    if (m_snapshot_readers.empty())
+    {
+        return;
+    }
+
+    m_snapshot.update_index = m_update_index;
+    m_snapshot.snapshot_time_us = ServerUtility::get_service_time_us();
+    m_snapshot.controllers.clear();
+    m_snapshot.trackers.clear();
+    m_snapshot.hmds.clear();
+
+    for (int device_id : m_controller_manager->getActiveDeviceIds())
+    {
+        const ServerControllerView *view = m_controller_manager->getControllerView(device_id);
+
+        if (view->getIsOpen())
+        {
+            m_snapshot.controllers.push_back(make_snapshot_entry(
+                device_id, view->getControllerDeviceType(), view->getIsCurrentlyTracking(),
+                view->getFilteredPose(), view->getLastNewDataTimestamp()));
+        }
+    }
+
+    for (int device_id : m_tracker_manager->getActiveDeviceIds())
+    {
+        const ServerTrackerView *view = m_tracker_manager->getTrackerView(device_id);
+
+        if (view->getIsOpen())
+        {
+            m_snapshot.trackers.push_back(make_snapshot_entry(
+                device_id, view->getTrackerDeviceType(), false,
+                view->getTrackerPose(), view->getLastNewDataTimestamp()));
+        }
+    }
+
+    for (int device_id : m_hmd_manager->getActiveDeviceIds())
+    {
+        const ServerHMDView *view = m_hmd_manager->getHMDView(device_id);
+
+        if (view->getIsOpen())
+        {
+            m_snapshot.hmds.push_back(make_snapshot_entry(
+                device_id, view->getHMDDeviceType(), view->getIsCurrentlyTracking(),
+                view->getFilteredPose(), view->getLastNewDataTimestamp()));
+        }
+    }
+
+    for (const std::unique_ptr<DeviceStateSnapshotReader> &reader : m_snapshot_readers)
+    {
+        reader->publish(m_snapshot);
+    }
+}
+
+void
+DeviceManager::refreshIdleMode()
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+    const ServerRequestHandler *request_handler = ServerRequestHandler::get_instance();
+    const CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+    bool bWantsIdle = false;
+
+    // Replays get consumed at full rate whether or not anybody is watching.
+    // A camera node's clients are on its host.
+    if (m_config->idle_when_not_streaming &&
+        request_handler != nullptr &&
+        DeviceInputLog::get_mode() != DeviceInputLogMode_Replaying &&
+        (camera_node_link == nullptr || !camera_node_link->getIsNode()))
+    {
+        if (request_handler->any_active_data_streams() || request_handler->any_active_bluetooth_requests())
+        {
+            m_last_active_time = now;
+        }
+        else
+        {
+            bWantsIdle = (now - m_last_active_time) >= std::chrono::milliseconds(m_config->idle_mode_delay);
+        }
+    }
+
+    if (bWantsIdle != m_bIsIdle)
+    {
+        SERVER_LOG_INFO("DeviceManager::refreshIdleMode") << (bWantsIdle ? "No data streams running, entering idle mode" : "Leaving idle mode");
+
+        m_bIsIdle = bWantsIdle;
+        m_controller_manager->setIsIdle(bWantsIdle);
+        m_tracker_manager->setIsIdle(bWantsIdle);
+        m_hmd_manager->setIsIdle(bWantsIdle);
+
+        // The device threads would otherwise still wake the main loop for every report
+        WakeupSignal::setNotificationsEnabled(!bWantsIdle);
+    }
+}
+
+std::chrono::time_point<std::chrono::high_resolution_clock>
+DeviceManager::getNextUpdateDeadline(const std::chrono::time_point<std::chrono::high_resolution_clock> &now) const
+{
+    // IMU polls due right before a video frame wait for it, so the frame gets processed the moment it lands
+    const std::chrono::time_point<std::chrono::high_resolution_clock> device_poll_deadline =
+        m_tracker_manager->alignPollDeadlineToFrames(
+            now,
+            std::min(m_controller_manager->getNextPollDeadline(now), m_hmd_manager->getNextPollDeadline(now)));
+
+    return std::min(device_poll_deadline, m_tracker_manager->getNextPollDeadline(now));
 }
 
 void
@@ -234,11 +686,39 @@ DeviceManager::shutdown()
 	    m_hmd_manager->shutdown();
 	}
 
+	if (m_thread_pool != nullptr)
+	{
+		m_thread_pool->shutdown();
+	}
+
+	if (m_shared_pose_writer != nullptr)
+	{
+		m_shared_pose_writer->shutdown();
+	}
+
+	if (m_shared_pose_input_reader != nullptr)
+	{
+		m_shared_pose_input_reader->shutdown();
+	}
+
+	if (m_shared_projection_writer != nullptr)
+	{
+		m_shared_projection_writer->shutdown();
+	}
+
+	if (m_pose_record_writer != nullptr)
+	{
+		m_pose_record_writer->shutdown();
+	}
+
 	if (m_platform_api != nullptr)
 	{
 		m_platform_api->shutdown();
 	}
 
+	// Every device is closed now
+	DeviceInputLog::shutdown();
+
     m_instance= nullptr;
 }
 
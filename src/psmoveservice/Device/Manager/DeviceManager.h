@@ -4,6 +4,9 @@
 //-- includes -----
 #include "DeviceInterface.h"
 #include "DevicePlatformInterface.h"
+#include "CommandQueue.h"
+#include "DeviceStateSnapshot.h"
+#include "ServerUtility.h"
 #include <memory>
 #include <chrono>
 #include <vector>
@@ -14,6 +17,8 @@ enum eDevicePlatformApiType
 	_eDevicePlatformApiType_None,
 #ifdef WIN32
 	_eDevicePlatformApiType_Win32,
+#else
+	_eDevicePlatformApiType_LibUSB,
 #endif // WIN32
 };
 
@@ -49,6 +54,27 @@ public:
     void update();  /**< Poll all connected devices for each specific manager. */
     void shutdown();/**< Shutdown the interfaces for each specific manager. */
 
+    /// Enters idle mode once no connection has had a data stream (or bluetooth request) running
+    /// for the configured idle_mode_delay and leaves it as soon as one starts.
+    /// Called every update() and by the request handler when a stream starts.
+    void refreshIdleMode();
+    inline bool getIsIdle() const
+    { return m_bIsIdle; }
+
+    // -- Cross thread access (see DeviceStateSnapshot.h) ---
+    /// Main thread only. The returned reader belongs to one other thread
+    /// and stays valid until closeStateSnapshotReader().
+    DeviceStateSnapshotReader *openStateSnapshotReader();
+    void closeStateSnapshotReader(DeviceStateSnapshotReader *reader);
+
+    /// Safe to call from any thread. The command runs on the main thread at the start of the next update().
+    void postCommand(const CommandQueue::t_command &command);
+
+    /// The earliest time any device manager has a device poll or device list refresh due
+    /// (controller and HMD polls just ahead of an expected video frame move onto the frame)
+    std::chrono::time_point<std::chrono::high_resolution_clock> getNextUpdateDeadline(
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &now) const;
+
     static inline DeviceManager *getInstance()
     { return m_instance; }
 
@@ -71,6 +97,10 @@ public:
     int getTrackerViewMaxCount() const;
     int getHMDViewMaxCount() const;       
 
+    /// Calls to update() per second, i.e. the rate of the service main loop
+    inline float getUpdateRate()
+    { return m_update_rate.getRatePerSecond(); }
+
 	// -- Notification --
 	void registerHotplugListener(const CommonDeviceState::eDeviceClass deviceClass, IDeviceHotplugListener *listener);
 	void handle_device_connected(enum DeviceClass device_class, const std::string &device_path) override;
@@ -92,10 +122,32 @@ private:
 	// List of registered hot-plug listeners
 	std::vector<DeviceHotplugListener> m_listeners;
 
+	// Counts calls to update()
+	ServerRateCounter m_update_rate;
+
+	// See refreshIdleMode()
+	bool m_bIsIdle;
+	std::chrono::time_point<std::chrono::high_resolution_clock> m_last_active_time;
+
+	// Commands posted from other threads, see postCommand()
+	CommandQueue m_command_queue;
+
+	// See openStateSnapshotReader(). Snapshots only get built while at least one reader is open.
+	std::vector<std::unique_ptr<DeviceStateSnapshotReader>> m_snapshot_readers;
+	DeviceStateSnapshot m_snapshot;
+	long long m_update_index;
+
+	void publishStateSnapshot();
+
 public:
     class ControllerManager *m_controller_manager;
     class TrackerManager *m_tracker_manager;
     class HMDManager *m_hmd_manager;
+    class ThreadPool *m_thread_pool;
+    class SharedPoseStateWriter *m_shared_pose_writer;
+    class SharedPoseInputReader *m_shared_pose_input_reader;
+    class SharedTrackerProjectionWriter *m_shared_projection_writer;
+    class PoseRecordWriter *m_pose_record_writer;
 };
 
 #endif  // DEVICE_MANAGER_H
\ No newline at end of file
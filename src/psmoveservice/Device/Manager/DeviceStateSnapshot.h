@@ -0,0 +1,80 @@
+#ifndef DEVICE_STATE_SNAPSHOT_H
+#define DEVICE_STATE_SNAPSHOT_H
+
+//-- includes -----
+#include "AtomicPrimitives.h"
+#include "DeviceInterface.h"
+#include <vector>
+
+//-- definitions -----
+/**
+ Threading model of the device layer.
+
+ The DeviceManager, the device type managers and every Server*View (and the device objects behind them)
+ belong to the main thread: only it calls their methods, and only it handles client requests.
+ Work that runs somewhere else reaches them in one of three ways:
+ * Per device tasks fanned out by DeviceTypeManager::run_device_tasks_and_wait() while the main thread
+   waits on them. A task touches its own device view only (see run_device_tasks_and_wait()).
+ * Reads go through a DeviceStateSnapshotReader (see DeviceManager::openStateSnapshotReader()).
+   At the end of every update the main thread copies the state of the open devices into an immutable
+   snapshot and hands it to every reader through an AtomicObject, so readers never wait on the main thread
+   and never see a half updated device.
+ * Changes get posted with DeviceManager::postCommand() and run on the main thread
+   at the start of its next update, where they can use the device views like any request handler.
+ Device reader threads (HID, USB, cameras) hand their data over through their own AtomicObject/AtomicQueue
+ channels as before and wake the main loop with WakeupSignal::notifyMainLoop().
+ */
+
+/// State of one open device as of the end of a main thread update
+struct DeviceStateSnapshotEntry
+{
+    int device_id;
+    CommonDeviceState::eDeviceType device_type;
+    // Controllers and HMDs: currently tracked by the cameras. Trackers: always false.
+    bool is_tracking;
+    // Controllers and HMDs: filtered pose (cleared if the device has no pose filter). Trackers: camera pose.
+    CommonDevicePose pose;
+    // Service time (see ServerUtility::get_service_time_us()) of the last poll that returned new data
+    long long last_new_data_time_us;
+};
+
+/// Every open device, in ascending device id order per device class
+struct DeviceStateSnapshot
+{
+    // Counts main thread updates, so readers can tell a new snapshot from one they already saw
+    long long update_index;
+    // Service time the snapshot got taken at
+    long long snapshot_time_us;
+    std::vector<DeviceStateSnapshotEntry> controllers;
+    std::vector<DeviceStateSnapshotEntry> trackers;
+    std::vector<DeviceStateSnapshotEntry> hmds;
+
+    DeviceStateSnapshot()
+        : update_index(-1)
+        , snapshot_time_us(0)
+    {
+    }
+};
+
+/// One thread's view of the per update device snapshots.
+/// AtomicObject supports a single reader, so every reading thread opens its own.
+class DeviceStateSnapshotReader
+{
+public:
+    /// Reader thread only. The snapshot stays valid until this thread's next fetchLatest().
+    inline const DeviceStateSnapshot &fetchLatest()
+    {
+        return m_snapshot.fetchValueRef();
+    }
+
+    /// Main thread only
+    inline void publish(const DeviceStateSnapshot &snapshot)
+    {
+        m_snapshot.storeValue(snapshot);
+    }
+
+private:
+    AtomicObject<DeviceStateSnapshot> m_snapshot;
+};
+
+#endif // DEVICE_STATE_SNAPSHOT_H
@@ -3,34 +3,52 @@
 #include "DeviceEnumerator.h"
 #include "PSMoveProtocol.pb.h"
 #include "ServerLog.h"
+#include "ServerTrace.h"
 #include "ServerDeviceView.h"
 #include "ServerNetworkManager.h"
-#include "ServerUtility.h"
 #include "ServerRequestHandler.h"
+#include "ServerUtility.h"
+#include "ThreadPool.h"
+#include "WakeupSignal.h"
+
+#include <algorithm>
 
 //-- methods -----
 /// Constructor and set intervals (ms) for reconnect and polling
 DeviceTypeManager::DeviceTypeManager(const int recon_int, const int poll_int)
     : reconnect_interval(recon_int)
     , poll_interval(poll_int)
-    , m_deviceViews(nullptr)
+    , idle_poll_interval(poll_int)
+    , background_scan_enabled(false)
+    , thread_pool(nullptr)
+    , m_deviceViews()
+    , m_max_device_count(0)
+    , m_active_device_ids()
 	, m_bIsDeviceListDirty(false)
+	, m_bHasUnopenedDevices(false)
+	, m_bIsIdle(false)
+	, m_bScanThreadStarted(false)
+	, m_bScanExitRequested(false)
+	, m_bScannedDeviceListChanged(false)
 {
 }
 
 DeviceTypeManager::~DeviceTypeManager()
 {
-    assert(m_deviceViews == nullptr);
+    assert(m_deviceViews.empty());
 }
 
 /// Override if the device type needs to initialize any services (e.g., hid_init)
 bool
 DeviceTypeManager::startup()
 {
-    assert(m_deviceViews == nullptr);
+    assert(m_deviceViews.empty());
 
-    const int maxDeviceCount = getMaxDevices();
-    m_deviceViews = new ServerDeviceViewPtr[maxDeviceCount];
+    const int maxDeviceCount = get_configured_max_devices();
+    m_deviceViews.resize(maxDeviceCount);
+    m_max_device_count = maxDeviceCount;
+    m_active_device_ids.clear();
+    m_active_device_ids.reserve(maxDeviceCount);
 
     // Allocate all of the device views
     for (int device_id = 0; device_id < maxDeviceCount; ++device_id)
@@ -50,7 +68,9 @@ DeviceTypeManager::startup()
 void
 DeviceTypeManager::shutdown()
 {
-	if (m_deviceViews != nullptr)
+	stop_device_scan_thread();
+
+	if (!m_deviceViews.empty())
 	{
 		// Close any controllers that were opened
 		for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
@@ -66,32 +86,43 @@ DeviceTypeManager::shutdown()
 		}
 
 		// Free the device view pointer list
-		delete[] m_deviceViews;
-		m_deviceViews = nullptr;
+		m_deviceViews.clear();
+		m_max_device_count = 0;
+		m_active_device_ids.clear();
 	}
 }
 
-/// Calls poll_devices and update_connected_devices if poll_interval and reconnect_interval has elapsed, respectively.
+/// Polls the devices that are due and calls update_connected_devices if reconnect_interval has elapsed.
 void
 DeviceTypeManager::poll()
 {
     std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
 
-    // See if it's time to poll controllers for data
-    std::chrono::duration<double, std::milli> update_diff = now - m_last_poll_time;
-
-    if (update_diff.count() >= poll_interval)
-    {
-        poll_devices();
-        m_last_poll_time = now;
-    }
+    // Each device keeps its own poll schedule
+    poll_devices(now);
 
     // See if it's time to try update the list of connected devices
 	if (reconnect_interval > 0)
 	{
 		std::chrono::duration<double, std::milli> reconnect_diff = now - m_last_reconnect_time;
 
-		if (reconnect_diff.count() >= reconnect_interval)
+		// Started on the first poll so the device type's own startup (e.g. hid_init) is done by then
+		if (background_scan_enabled && !m_bScanThreadStarted && can_scan_devices_off_main_thread())
+		{
+			start_device_scan_thread();
+		}
+
+		if (m_bScanThreadStarted)
+		{
+			// Only walk the enumerators here when the scan thread saw the device list change,
+			// or to retry devices that couldn't be opened last time
+			if (fetch_scanned_device_list_changed() ||
+				(m_bHasUnopenedDevices && reconnect_diff.count() >= reconnect_interval))
+			{
+				m_bIsDeviceListDirty = true;
+			}
+		}
+		else if (reconnect_diff.count() >= reconnect_interval)
 		{
 			m_bIsDeviceListDirty = true;
 		}
@@ -112,17 +143,14 @@ DeviceTypeManager::update_connected_devices()
 {
     bool success = false;
 
-    // Don't do any connection opening/closing until all pending bluetooth operations are finished
+    // Managers can hold off opening/closing connections (e.g. controllers during bluetooth pairing)
     if (can_update_connected_devices())
     {
         const int maxDeviceCount = getMaxDevices();
-        bool exists_in_enumerator[64];
+        // Temp table used to keep track of open devices still found in the enumerator
+        std::vector<bool> exists_in_enumerator(maxDeviceCount, false);
         bool bSendControllerUpdatedNotification = false;
-
-        // Initialize temp table used to keep track of open devices
-        // still found in the enumerator
-        assert(maxDeviceCount <= 64);
-        memset(exists_in_enumerator, 0, sizeof(exists_in_enumerator));
+        bool bHasUnopenedDevices = false;
 
         // Step 1
         // Mark any open devices that still show up in the enumerator.
@@ -162,6 +190,7 @@ DeviceTypeManager::update_connected_devices()
 
                             // Mark the device as having showed up in the enumerator
                             exists_in_enumerator[device_id_] = true;
+                            add_active_device_id(device_id_);
 
                             // Send notificiation to clients that a new device was added
                             bSendControllerUpdatedNotification = true;
@@ -170,12 +199,14 @@ DeviceTypeManager::update_connected_devices()
                         {
                             SERVER_LOG_ERROR("DeviceTypeManager::update_connected_devices") << 
                                 "Device device_id " << device_id_ << " (" << enumerator->get_path() << ") failed to open!";
+                            bHasUnopenedDevices = true;
                         }
                     }
                     else
                     {
                         SERVER_LOG_ERROR("DeviceTypeManager::update_connected_devices") << 
                             "Can't connect any more new devices. Too many open device.";
+                        bHasUnopenedDevices = true;
                         break;
                     }
                 }
@@ -188,9 +219,9 @@ DeviceTypeManager::update_connected_devices()
 
         // Step 2
         // Close any device that is open and wasn't found in the enumerator
-        for (int device_id = 0; device_id < maxDeviceCount; ++device_id)
+        for (int device_id : m_active_device_ids)
         {
-            ServerDeviceViewPtr existingDevice = getDeviceViewPtr(device_id);
+            ServerDeviceView *existingDevice = getDeviceView(device_id);
 
             // This probably shouldn't happen very often (at all?) as polling should catch
             // disconnected devices first.
@@ -212,6 +243,7 @@ DeviceTypeManager::update_connected_devices()
             send_device_list_changed_notification();
         }
 
+        m_bHasUnopenedDevices = bHasUnopenedDevices;
         success = true;
     }
 
@@ -222,11 +254,56 @@ void
 DeviceTypeManager::publish()
 {
     // Publish any new data to client connections
-    for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
+    for (int device_id : m_active_device_ids)
     {
-        ServerDeviceViewPtr device = getDeviceViewPtr(device_id);
+        getDeviceView(device_id)->publish();
+    }
+
+    // Everything downstream has seen the devices that closed this tick by now
+    prune_active_device_ids();
+}
+
+void
+DeviceTypeManager::add_active_device_id(int device_id)
+{
+    std::vector<int>::iterator it =
+        std::lower_bound(m_active_device_ids.begin(), m_active_device_ids.end(), device_id);
+
+    if (it == m_active_device_ids.end() || *it != device_id)
+    {
+        m_active_device_ids.insert(it, device_id);
+    }
+}
+
+void
+DeviceTypeManager::prune_active_device_ids()
+{
+    m_active_device_ids.erase(
+        std::remove_if(
+            m_active_device_ids.begin(), m_active_device_ids.end(),
+            [this](int device_id) { return !getDeviceView(device_id)->getIsOpen(); }),
+        m_active_device_ids.end());
+}
+
+void
+DeviceTypeManager::run_device_tasks_and_wait(const std::function<void(int device_id)> &device_task)
+{
+    if (thread_pool != nullptr && thread_pool->getWorkerCount() > 0 && m_active_device_ids.size() > 1)
+    {
+        for (int device_id : m_active_device_ids)
+        {
+            thread_pool->submit([&device_task, device_id]() { device_task(device_id); });
+        }
 
-        device->publish();
+        // Barrier: nothing downstream (e.g. publish) may see a half updated device
+        thread_pool->waitForAll();
+    }
+    else
+    {
+        for (int device_id : m_active_device_ids)
+        {
+            device_task(device_id);
+        }
     }
 }
 
@@ -238,32 +315,196 @@ DeviceTypeManager::send_device_list_changed_notification()
     response->set_request_id(-1);
     response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
 
+    // The clients are about to ask for the new list
+    if (ServerRequestHandler::get_instance() != nullptr)
+    {
+        ServerRequestHandler::get_instance()->invalidate_device_list_caches();
+    }
+
     ServerNetworkManager::get_instance()->send_notification_to_all_clients(response);
 }
 
 bool
 DeviceTypeManager::can_poll_connected_devices()
 {
-    return !ServerRequestHandler::get_instance()->any_active_bluetooth_requests();
+    // Bluetooth requests do their work on their own worker threads,
+    // so the open devices keep getting polled while one is running
+    return true;
 }
 
 bool
 DeviceTypeManager::can_update_connected_devices()
 {
-    return !ServerRequestHandler::get_instance()->any_active_bluetooth_requests();
+    return true;
+}
+
+bool
+DeviceTypeManager::can_scan_devices_off_main_thread() const
+{
+    return false;
 }
 
 void
-DeviceTypeManager::poll_devices()
+DeviceTypeManager::scan_connected_device_paths(std::vector<std::string> &out_device_paths)
+{
+    DeviceEnumerator *enumerator = allocate_device_enumerator();
+
+    while (enumerator->is_valid())
+    {
+        out_device_paths.push_back(enumerator->get_path());
+        enumerator->next();
+    }
+
+    free_device_enumerator(enumerator);
+}
+
+void
+DeviceTypeManager::start_device_scan_thread()
+{
+    if (!m_bScanThreadStarted)
+    {
+        m_bScanExitRequested = false;
+        m_bScannedDeviceListChanged = false;
+        m_scanned_device_paths.clear();
+
+        m_scan_thread = std::thread(&DeviceTypeManager::device_scan_thread_func, this);
+        m_bScanThreadStarted = true;
+    }
+}
+
+void
+DeviceTypeManager::stop_device_scan_thread()
+{
+    if (m_bScanThreadStarted)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_scan_mutex);
+            m_bScanExitRequested = true;
+        }
+        m_scan_condition.notify_all();
+
+        m_scan_thread.join();
+        m_bScanThreadStarted = false;
+    }
+}
+
+void
+DeviceTypeManager::device_scan_thread_func()
+{
+    ServerUtility::set_current_thread_name("Device Scan Thread");
+    ServerTrace::set_current_thread_name("Device Scan Thread");
+
+    // Started from the main loop, don't inherit its scheduling class
+    ServerUtility::set_current_thread_priority("normal");
+
+    std::unique_lock<std::mutex> lock(m_scan_mutex);
+    bool bIsFirstScan = true;
+
+    while (!m_bScanExitRequested)
+    {
+        lock.unlock();
+
+        std::vector<std::string> device_paths;
+        scan_connected_device_paths(device_paths);
+        std::sort(device_paths.begin(), device_paths.end());
+
+        // The main thread already does a full update at startup,
+        // so the first scan only establishes what the device list looks like.
+        const bool bListChanged = !bIsFirstScan && device_paths != m_scanned_device_paths;
+        m_scanned_device_paths.swap(device_paths);
+        bIsFirstScan = false;
+
+        lock.lock();
+
+        if (bListChanged)
+        {
+            m_bScannedDeviceListChanged = true;
+
+            // Let the main loop apply the change right away
+            WakeupSignal::notifyMainLoop();
+        }
+
+        m_scan_condition.wait_for(
+            lock,
+            std::chrono::milliseconds(reconnect_interval),
+            [this]() { return m_bScanExitRequested; });
+    }
+}
+
+bool
+DeviceTypeManager::fetch_scanned_device_list_changed()
+{
+    std::lock_guard<std::mutex> lock(m_scan_mutex);
+    const bool bChanged = m_bScannedDeviceListChanged;
+
+    m_bScannedDeviceListChanged = false;
+
+    return bChanged;
+}
+
+void
+DeviceTypeManager::setIsIdle(bool bIsIdle)
+{
+    if (m_bIsIdle && !bIsIdle)
+    {
+        // Don't make anyone wait out an idle poll interval
+        for (int device_id : m_active_device_ids)
+        {
+            getDeviceView(device_id)->resetPollSchedule();
+        }
+    }
+
+    m_bIsIdle = bIsIdle;
+}
+
+std::chrono::time_point<std::chrono::high_resolution_clock>
+DeviceTypeManager::getNextPollDeadline(const std::chrono::time_point<std::chrono::high_resolution_clock> &now) const
+{
+    std::chrono::time_point<std::chrono::high_resolution_clock> deadline =
+        std::chrono::time_point<std::chrono::high_resolution_clock>::max();
+
+    for (int device_id : m_active_device_ids)
+    {
+        const ServerDeviceView *device = getDeviceView(device_id);
+
+        if (device->getIsOpen())
+        {
+            deadline = std::min(deadline, device->getNextPollTime());
+        }
+    }
+
+    // The scan thread wakes the main loop itself when the device list changes
+    if (reconnect_interval > 0 && (!m_bScanThreadStarted || m_bHasUnopenedDevices))
+    {
+        // A refresh the manager is holding off (e.g. during bluetooth pairing) stays overdue,
+        // retry it at the poll rate rather than spinning on it
+        const std::chrono::time_point<std::chrono::high_resolution_clock> reconnect_deadline =
+            std::max(
+                m_last_reconnect_time + std::chrono::milliseconds(reconnect_interval),
+                now + std::chrono::milliseconds(poll_interval));
+
+        deadline = std::min(deadline, reconnect_deadline);
+    }
+
+    return deadline;
+}
+
+void
+DeviceTypeManager::poll_devices(const std::chrono::time_point<std::chrono::high_resolution_clock> &now)
 {
     if (can_poll_connected_devices())
     {
         bool bAllUpdatedOk = true;
 
-        for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
+        for (int device_id : m_active_device_ids)
         {
-            ServerDeviceViewPtr device = getDeviceViewPtr(device_id);
-            bAllUpdatedOk &= device->poll();
+            ServerDeviceView *device = getDeviceView(device_id);
+
+            if (device->getIsPollDue(now))
+            {
+                bAllUpdatedOk &= device->poll();
+                device->scheduleNextPoll(now, poll_interval, m_bIsIdle ? idle_poll_interval : 0);
+            }
         }
 
         if (!bAllUpdatedOk)
@@ -271,6 +512,19 @@ DeviceTypeManager::poll_devices()
             send_device_list_changed_notification();
         }
     }
+    else
+    {
+        // Check back in a poll interval rather than have the main loop spin on the overdue polls
+        for (int device_id : m_active_device_ids)
+        {
+            ServerDeviceView *device = getDeviceView(device_id);
+
+            if (device->getIsPollDue(now))
+            {
+                device->scheduleNextPoll(now, poll_interval, m_bIsIdle ? idle_poll_interval : 0);
+            }
+        }
+    }
 }
 
 
@@ -279,11 +533,11 @@ DeviceTypeManager::find_open_device_device_id(const DeviceEnumerator *enumerator
 {
     int result_device_id = -1;
 
-    for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
+    for (int device_id : m_active_device_ids)
     {
-        ServerDeviceViewPtr device = getDeviceViewPtr(device_id);
+        const ServerDeviceView *device = getDeviceView(device_id);
 
-        if (device && device->matchesDeviceEnumerator(enumerator))
+        if (device->matchesDeviceEnumerator(enumerator))
         {
             result_device_id = device_id;
             break;
@@ -313,7 +567,7 @@ DeviceTypeManager::find_first_closed_device_device_id()
 ServerDeviceViewPtr
 DeviceTypeManager::getDeviceViewPtr(int device_id)
 {
-    assert(m_deviceViews != nullptr);
+    assert(ServerUtility::is_index_valid(device_id, m_max_device_count));
 
     return m_deviceViews[device_id];
 }
@@ -5,8 +5,14 @@
 #include "DevicePlatformInterface.h"
 #include "PSMoveProtocolInterface.h"
 
+#include <functional>
 #include <memory>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 //-- typedefs -----
 class ServerDeviceView;
@@ -26,7 +32,24 @@ public:
     void poll();
     virtual void publish();
 
-    virtual int getMaxDevices() const = 0;
+    /// When poll() has work to do next: the earliest device poll or device list refresh.
+    /// The main loop sleeps until then unless new data wakes it up first.
+    std::chrono::time_point<std::chrono::high_resolution_clock> getNextPollDeadline(
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &now) const;
+
+    /// While idle the devices get polled no faster than idle_poll_interval.
+    /// Leaving idle makes every device due right away.
+    void setIsIdle(bool bIsIdle);
+    inline bool getIsIdle() const
+    {
+        return m_bIsIdle;
+    }
+
+    /// Number of device slots, fixed at startup from the device type's config
+    inline int getMaxDevices() const
+    {
+        return m_max_device_count;
+    }
 
     /**
     Returns an upcast device view ptr. Useful for generic functions that are
@@ -37,15 +60,43 @@ public:
     */
     ServerDeviceViewPtr getDeviceViewPtr(int device_id);
 
+    /// Same as getDeviceViewPtr() without the ref count traffic, for the per-tick loops
+    inline ServerDeviceView *getDeviceView(int device_id) const
+    {
+        return m_deviceViews[device_id].get();
+    }
+
+    /**
+    Ids of the open devices, in ascending order.
+    Devices that closed since the last publish() stay in the list until the end of it
+    (so the per-tick loops still get to see them close), so check getIsOpen() as before.
+    Only changes on the main thread in poll() and publish().
+    */
+    inline const std::vector<int> &getActiveDeviceIds() const
+    {
+        return m_active_device_ids;
+    }
+
 	// IDeviceHotplugListener
 	void handle_device_connected(enum DeviceClass device_class, const std::string &device_path) override;
 	void handle_device_disconnected(enum DeviceClass device_class, const std::string &device_path) override;
 
     int reconnect_interval;
+    /// Poll interval (ms) of the devices that don't ask for their own (see IDeviceInterface::getPollIntervalMs())
     int poll_interval;
+    /// Slowest poll interval (ms) while idle (see setIsIdle())
+    int idle_poll_interval;
+
+    /// Look for connected and disconnected devices on a background thread every reconnect_interval
+    /// instead of walking the device enumerators on the main thread (device types have to opt in)
+    bool background_scan_enabled;
+
+    /// Shared pool per-device work gets fanned out to (owned by the DeviceManager, null runs everything inline)
+    class ThreadPool *thread_pool;
 
 protected:
-    virtual void poll_devices();
+    /// Polls every open device whose poll is due
+    virtual void poll_devices(const std::chrono::time_point<std::chrono::high_resolution_clock> &now);
 
     /** This method tries make the list of open devices in m_devices match
     the list of connected devices in the device enumerator.
@@ -56,23 +107,71 @@ protected:
 
     virtual bool can_poll_connected_devices();
     virtual bool can_update_connected_devices();
+
+    /// Override to return true if scan_connected_device_paths() is safe to call off the main thread
+    virtual bool can_scan_devices_off_main_thread() const;
+
+    /** Called on the device scan thread.
+    Fills in the paths of the connected devices, in any order.
+    Only needs to cover devices that can come and go without a platform hotplug event.
+    */
+    virtual void scan_connected_device_paths(std::vector<std::string> &out_device_paths);
+
     virtual class DeviceEnumerator *allocate_device_enumerator() = 0;
     virtual void free_device_enumerator(class DeviceEnumerator *) = 0;
     virtual ServerDeviceView *allocate_device_view(int device_id) = 0;
 
+    /// How many device slots startup() allocates (the config must already be loaded)
+    virtual int get_configured_max_devices() const = 0;
+
     void send_device_list_changed_notification();
 
+    void add_active_device_id(int device_id);
+    void prune_active_device_ids();
+
+    /** Runs device_task once for every active device id on the shared thread pool
+    and returns once all of them have finished.
+    The tasks must only touch their own device view (plus read-only shared state)
+    and must use the SERVER_MT_LOG_* macros for logging.
+    */
+    void run_device_tasks_and_wait(const std::function<void(int device_id)> &device_task);
+
     virtual int getListUpdatedResponseType() = 0;
 
     int find_first_closed_device_device_id();
     int find_open_device_device_id(const class DeviceEnumerator *enumerator);
 
     std::chrono::time_point<std::chrono::high_resolution_clock> m_last_reconnect_time;
-    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_poll_time;
 
-    ServerDeviceViewPtr *m_deviceViews;
+    // One slot per possible device id, allocated once at startup
+    std::vector<ServerDeviceViewPtr> m_deviceViews;
+    int m_max_device_count;
+
+    // See getActiveDeviceIds()
+    std::vector<int> m_active_device_ids;
 
 	bool m_bIsDeviceListDirty;
+
+	// Set when the last update left connected devices unopened (open failed or no free slot)
+	bool m_bHasUnopenedDevices;
+
+	// See setIsIdle()
+	bool m_bIsIdle;
+
+private:
+    void start_device_scan_thread();
+    void stop_device_scan_thread();
+    void device_scan_thread_func();
+    bool fetch_scanned_device_list_changed();
+
+    // Device scan thread state
+    std::thread m_scan_thread;
+    bool m_bScanThreadStarted;
+    std::mutex m_scan_mutex;
+    std::condition_variable m_scan_condition;
+    bool m_bScanExitRequested; // guarded by m_scan_mutex
+    bool m_bScannedDeviceListChanged; // guarded by m_scan_mutex
+    std::vector<std::string> m_scanned_device_paths; // scan thread only
 };
 
 #endif // DEVICE_TYPE_MANAGER
@@ -0,0 +1,286 @@
+//-- includes -----
+#include "GamepadPoller.h"
+#include "AtomicPrimitives.h"
+#include "ServerLog.h"
+#include "ServerTrace.h"
+#include "ServerUtility.h"
+#include "WakeupSignal.h"
+
+#include "gamepad/Gamepad.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string.h>
+#include <thread>
+
+//-- constants -----
+// How often the gamepad thread pumps the gamepad events
+static const int k_gamepad_poll_interval_ms = 2;
+// How often the gamepad thread looks for connected or removed gamepads
+static const int k_gamepad_detect_interval_ms = 1000;
+
+//-- private definitions -----
+class GamepadPollerImpl
+{
+public:
+    GamepadPollerImpl()
+        : m_gamepadCount(0)
+        , m_bExitRequested(false)
+        , m_bHasPublished(false)
+    {
+    }
+
+    void start()
+    {
+        m_thread = std::thread(&GamepadPollerImpl::threadFunc, this);
+
+        // Wait for the first device detection so the initial device enumeration sees the gamepads
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_bHasPublished; });
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_bExitRequested = true;
+        }
+        m_condition.notify_all();
+
+        m_thread.join();
+    }
+
+    int getGamepadCount() const
+    {
+        return m_gamepadCount.load();
+    }
+
+    // Main thread only, the snapshots only support a single reader
+    bool fetchGamepadState(int gamepad_index, GamepadState &out_state)
+    {
+        if (gamepad_index >= 0 && gamepad_index < getGamepadCount())
+        {
+            m_gamepadStates[gamepad_index].fetchValue(out_state);
+        }
+        else
+        {
+            out_state.clear();
+        }
+
+        return out_state.bIsConnected;
+    }
+
+private:
+    static bool getStatesDiffer(const GamepadState &a, const GamepadState &b)
+    {
+        return
+            a.bIsConnected != b.bIsConnected ||
+            a.vendorID != b.vendorID ||
+            a.productID != b.productID ||
+            a.numButtons != b.numButtons ||
+            a.numAxes != b.numAxes ||
+            memcmp(a.buttonStates, b.buttonStates, sizeof(bool)*a.numButtons) != 0 ||
+            memcmp(a.axisStates, b.axisStates, sizeof(float)*a.numAxes) != 0 ||
+            strcmp(a.description, b.description) != 0;
+    }
+
+    static void readGamepadState(unsigned int gamepad_index, GamepadState &out_state)
+    {
+        const Gamepad_device *gamepad = Gamepad_deviceAtIndex(gamepad_index);
+
+        out_state.clear();
+
+        if (gamepad != nullptr)
+        {
+            out_state.bIsConnected = true;
+            out_state.vendorID = gamepad->vendorID;
+            out_state.productID = gamepad->productID;
+            ServerUtility::format_string(
+                out_state.description, sizeof(out_state.description),
+                "%s", gamepad->description != nullptr ? gamepad->description : "");
+
+            out_state.numButtons = std::min(static_cast<int>(gamepad->numButtons), GAMEPAD_POLLER_MAX_BUTTONS);
+            for (int button_index = 0; button_index < out_state.numButtons; ++button_index)
+            {
+                out_state.buttonStates[button_index] = gamepad->buttonStates[button_index];
+            }
+
+            out_state.numAxes = std::min(static_cast<int>(gamepad->numAxes), GAMEPAD_POLLER_MAX_AXES);
+            for (int axis_index = 0; axis_index < out_state.numAxes; ++axis_index)
+            {
+                out_state.axisStates[axis_index] = gamepad->axisStates[axis_index];
+            }
+        }
+    }
+
+    void threadFunc()
+    {
+        ServerUtility::set_current_thread_name("Gamepad Thread");
+        ServerTrace::set_current_thread_name("Gamepad Thread");
+
+        // Some platforms tie the gamepad api to the thread that initialized it,
+        // so it lives and dies on this thread
+        Gamepad_init();
+        Gamepad_detectDevices();
+        Gamepad_processEvents();
+        publishGamepadStates();
+
+        std::chrono::time_point<std::chrono::high_resolution_clock> last_detect_time =
+            std::chrono::high_resolution_clock::now();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_bHasPublished = true;
+        m_condition.notify_all();
+
+        while (!m_bExitRequested)
+        {
+            lock.unlock();
+
+            const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+                std::chrono::high_resolution_clock::now();
+            if (now - last_detect_time >= std::chrono::milliseconds(k_gamepad_detect_interval_ms))
+            {
+                Gamepad_detectDevices();
+                last_detect_time = now;
+            }
+
+            Gamepad_processEvents();
+
+            publishGamepadStates();
+
+            lock.lock();
+            m_condition.wait_for(lock, std::chrono::milliseconds(k_gamepad_poll_interval_ms));
+        }
+
+        lock.unlock();
+
+        // Nobody sees the gamepads anymore once the api is gone
+        m_gamepadCount.store(0);
+        Gamepad_shutdown();
+    }
+
+    void publishGamepadStates()
+    {
+        const int gamepad_count = std::min(static_cast<int>(Gamepad_numDevices()), GAMEPAD_POLLER_MAX_GAMEPADS);
+        bool bAnyChanged = gamepad_count != m_gamepadCount.load();
+
+        for (int gamepad_index = 0; gamepad_index < gamepad_count; ++gamepad_index)
+        {
+            GamepadState state;
+            readGamepadState(static_cast<unsigned int>(gamepad_index), state);
+
+            if (getStatesDiffer(state, m_publishedStates[gamepad_index]))
+            {
+                m_gamepadStates[gamepad_index].storeValue(state);
+                m_publishedStates[gamepad_index] = state;
+                bAnyChanged = true;
+            }
+        }
+
+        for (int gamepad_index = gamepad_count; gamepad_index < GAMEPAD_POLLER_MAX_GAMEPADS; ++gamepad_index)
+        {
+            if (m_publishedStates[gamepad_index].bIsConnected)
+            {
+                m_publishedStates[gamepad_index].clear();
+                m_gamepadStates[gamepad_index].storeValue(m_publishedStates[gamepad_index]);
+            }
+        }
+
+        m_gamepadCount.store(gamepad_count);
+
+        // Let the main loop pick up button presses right away instead of on its next timeout
+        if (bAnyChanged)
+        {
+            WakeupSignal::notifyMainLoop();
+        }
+    }
+
+    // Multi-threaded state
+    AtomicObject<GamepadState> m_gamepadStates[GAMEPAD_POLLER_MAX_GAMEPADS];
+    std::atomic_int m_gamepadCount;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_bExitRequested;
+    bool m_bHasPublished;
+
+    // Gamepad thread state
+    GamepadState m_publishedStates[GAMEPAD_POLLER_MAX_GAMEPADS];
+
+    // Main thread state
+    std::thread m_thread;
+};
+
+//-- globals -----
+// Only ever started and stopped from the main thread
+static std::atomic<GamepadPollerImpl *> g_gamepad_poller = { nullptr };
+
+//-- GamepadState -----
+GamepadState::GamepadState()
+{
+    clear();
+}
+
+void GamepadState::clear()
+{
+    bIsConnected = false;
+    vendorID = -1;
+    productID = -1;
+    description[0] = '\0';
+    numButtons = 0;
+    numAxes = 0;
+    memset(buttonStates, 0, sizeof(buttonStates));
+    memset(axisStates, 0, sizeof(axisStates));
+}
+
+//-- GamepadPoller -----
+bool GamepadPoller::startup()
+{
+    if (g_gamepad_poller.load() == nullptr)
+    {
+        GamepadPollerImpl *poller = new GamepadPollerImpl();
+
+        SERVER_LOG_INFO("GamepadPoller::startup") << "Starting the gamepad thread";
+        poller->start();
+        g_gamepad_poller.store(poller);
+    }
+
+    return true;
+}
+
+void GamepadPoller::shutdown()
+{
+    GamepadPollerImpl *poller = g_gamepad_poller.exchange(nullptr);
+
+    if (poller != nullptr)
+    {
+        SERVER_LOG_INFO("GamepadPoller::shutdown") << "Stopping the gamepad thread";
+        poller->stop();
+        delete poller;
+    }
+}
+
+int GamepadPoller::getGamepadCount()
+{
+    GamepadPollerImpl *poller = g_gamepad_poller.load();
+
+    return (poller != nullptr) ? poller->getGamepadCount() : 0;
+}
+
+bool GamepadPoller::fetchGamepadState(int gamepad_index, GamepadState &out_state)
+{
+    GamepadPollerImpl *poller = g_gamepad_poller.load();
+    bool bSuccess = false;
+
+    if (poller != nullptr)
+    {
+        bSuccess = poller->fetchGamepadState(gamepad_index, out_state);
+    }
+    else
+    {
+        out_state.clear();
+    }
+
+    return bSuccess;
+}
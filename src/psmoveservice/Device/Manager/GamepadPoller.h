@@ -0,0 +1,54 @@
+#ifndef GAMEPAD_POLLER_H
+#define GAMEPAD_POLLER_H
+
+//-- constants -----
+#define GAMEPAD_POLLER_MAX_GAMEPADS 8
+#define GAMEPAD_POLLER_MAX_BUTTONS 32
+#define GAMEPAD_POLLER_MAX_AXES 32
+#define GAMEPAD_POLLER_MAX_DESCRIPTION_LENGTH 128
+
+//-- definitions -----
+/// Snapshot of one gamepad as of the last time the gamepad thread pumped its events
+struct GamepadState
+{
+    bool bIsConnected;
+    int vendorID;
+    int productID;
+    char description[GAMEPAD_POLLER_MAX_DESCRIPTION_LENGTH];
+    int numButtons;
+    int numAxes;
+    bool buttonStates[GAMEPAD_POLLER_MAX_BUTTONS];
+    float axisStates[GAMEPAD_POLLER_MAX_AXES];
+
+    GamepadState();
+    void clear();
+};
+
+/// Owns the gamepad api (libstem) on its own thread.
+/**
+ The gamepad api keeps its device list in globals and some of its drivers block while
+ processing events or detecting devices, so only the gamepad thread ever calls into it.
+ The thread pumps the gamepad events, periodically re-detects the gamepads and publishes
+ a GamepadState per gamepad index. Everything else (the gamepad enumerator,
+ virtual controllers and gamepad driven navis) just copies the latest snapshot,
+ so polling a gamepad never stalls the main loop.
+ Until startup() is called there are no gamepads.
+ */
+class GamepadPoller
+{
+public:
+    /// Starts the gamepad thread, which initializes the gamepad api
+    static bool startup();
+
+    /// Stops the gamepad thread after it shut down the gamepad api
+    static void shutdown();
+
+    /// Number of gamepads found by the last device detection. Safe to call from any thread.
+    static int getGamepadCount();
+
+    /// Copies the latest state of the gamepad at the given index.
+    /// Returns false (and a cleared state) if there is no gamepad at that index.
+    static bool fetchGamepadState(int gamepad_index, GamepadState &out_state);
+};
+
+#endif // GAMEPAD_POLLER_H
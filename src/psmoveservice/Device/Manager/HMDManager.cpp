@@ -1,13 +1,22 @@
 //-- includes -----
 #include "HMDManager.h"
+#include "CompactDataFrame.h"
 #include "HMDDeviceEnumerator.h"
+#include "PoseRecordWriter.h"
 #include "ServerLog.h"
 #include "ServerHMDView.h"
 #include "ServerDeviceView.h"
+#include "ServerNetworkManager.h"
+#include "ServerRequestHandler.h"
+#include "ServerUtility.h"
+#include "SharedPoseInputReader.h"
+#include "SharedPoseStateWriter.h"
 #include "PSMoveProtocol.pb.h"
 #include <boost/foreach.hpp>
 #include "VirtualHMDDeviceEnumerator.h"
 
+#include <algorithm>
+
 //-- methods -----
 //-- Tracker Manager Config -----
 const int HMDManagerConfig::CONFIG_VERSION = 1;
@@ -15,6 +24,7 @@ const int HMDManagerConfig::CONFIG_VERSION = 1;
 HMDManagerConfig::HMDManagerConfig(const std::string &fnamebase)
     : PSMoveConfig(fnamebase)
     , virtual_hmd_count(0)
+    , max_hmd_count(PSMOVESERVICE_MAX_HMD_COUNT)
 {
 
 };
@@ -26,6 +36,7 @@ HMDManagerConfig::config2ptree()
 
     pt.put("version", HMDManagerConfig::CONFIG_VERSION);
     pt.put("virtual_hmd_count", virtual_hmd_count);
+    pt.put("max_hmd_count", max_hmd_count);
 
     return pt;
 }
@@ -38,6 +49,7 @@ HMDManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
     if (version == HMDManagerConfig::CONFIG_VERSION)
     {
         virtual_hmd_count = pt.get<int>("virtual_hmd_count", 0);
+        max_hmd_count = pt.get<int>("max_hmd_count", PSMOVESERVICE_MAX_HMD_COUNT);
     }
     else
     {
@@ -50,6 +62,9 @@ HMDManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
 //-- HMD Manager -----
 HMDManager::HMDManager()
     : DeviceTypeManager(1000, 2)
+    , shared_pose_writer(nullptr)
+    , shared_pose_input_reader(nullptr)
+    , pose_record_writer(nullptr)
 {
 }
 
@@ -58,14 +73,14 @@ HMDManager::startup()
 {
     bool success = false;
 
-    if (DeviceTypeManager::startup())
-    {
-		// Load any config from disk
-		cfg.load();
+    // Load any config from disk (it sizes the device table)
+    cfg.load();
 
-        // Save back out the config in case there were updated defaults
-        cfg.save();
+    // Save back out the config in case there were updated defaults
+    cfg.save();
 
+    if (DeviceTypeManager::startup())
+    {
         // Copy the virtual controller count into the Virtual controller enumerator static variable.
         // This breaks the dependency between the Controller Manager and the enumerator.
         VirtualHMDDeviceEnumerator::virtual_hmd_count= cfg.virtual_hmd_count;
@@ -82,35 +97,136 @@ HMDManager::shutdown()
     DeviceTypeManager::shutdown();
 }
 
+void
+HMDManager::poll_devices(const std::chrono::time_point<std::chrono::high_resolution_clock> &now)
+{
+    DeviceTypeManager::poll_devices(now);
+
+    // Same as ControllerManager::poll_devices()
+    if (shared_pose_input_reader != nullptr)
+    {
+        for (int device_id : getActiveDeviceIds())
+        {
+            ServerHMDView *hmdView = getHMDView(device_id);
+
+            if (hmdView->getIsOpen() && hmdView->getHMDDeviceType() == CommonDeviceState::VirtualHMD)
+            {
+                hmdView->pollExternalPoses(shared_pose_input_reader);
+            }
+        }
+    }
+}
+
 void
 HMDManager::updateStateAndPredict(TrackerManager* tracker_manager)
 {
-	for (int device_id = 0; device_id < getMaxDevices(); ++device_id)
+	// Each HMD only reads the tracker projection results and updates its own filter,
+	// so the HMDs can all be updated in parallel
+	run_device_tasks_and_wait([this, tracker_manager](int device_id)
 	{
-		ServerHMDViewPtr hmdView = getHMDViewPtr(device_id);
+		ServerHMDView *hmdView = getHMDView(device_id);
 
 		if (hmdView->getIsOpen())
 		{
 			hmdView->updateOpticalPoseEstimation(tracker_manager);
 			hmdView->updateStateAndPredict();
 		}
-	}
+	});
+}
+
+void
+HMDManager::publish()
+{
+    // Same as ControllerManager::publish(): the slots have to be written before the sequence numbers get bumped
+    ServerNetworkManager *network_manager= ServerNetworkManager::get_instance();
+    const bool bMulticastPoses= network_manager != nullptr && network_manager->get_is_multicast_pose_stream_enabled();
+
+    if (shared_pose_writer != nullptr || pose_record_writer != nullptr || bMulticastPoses)
+    {
+        HMDStreamInfo stream_info;
+        stream_info.Clear();
+        stream_info.include_position_data= true;
+        stream_info.include_physics_data= true;
+
+        // Devices that closed this tick are still in the active list, so their slots get cleared once
+        for (int device_id : getActiveDeviceIds())
+        {
+            ServerHMDView *hmdView = getHMDView(device_id);
+
+            if (hmdView->getIsOpen())
+            {
+                CompactHMDPoseFrame pose_frame;
+
+                if (hmdView->getHasUnpublishedState() &&
+                    ServerHMDView::generate_hmd_compact_pose_frame_for_stream(hmdView, &stream_info, &pose_frame))
+                {
+                    if (shared_pose_writer != nullptr)
+                    {
+                        shared_pose_writer->writeHMDPose(device_id, pose_frame);
+                    }
+
+                    if (pose_record_writer != nullptr)
+                    {
+                        pose_record_writer->writeHMDPose(pose_frame);
+                    }
+
+                    if (bMulticastPoses)
+                    {
+                        network_manager->add_multicast_hmd_pose(pose_frame);
+                    }
+                }
+            }
+            else if (shared_pose_writer != nullptr)
+            {
+                shared_pose_writer->clearHMDPose(device_id);
+            }
+        }
+    }
+
+    DeviceTypeManager::publish();
 }
 
 ServerHMDViewPtr
 HMDManager::getHMDViewPtr(int device_id)
 {
-    assert(m_deviceViews != nullptr);
+    assert(ServerUtility::is_index_valid(device_id, getMaxDevices()));
 
     return std::static_pointer_cast<ServerHMDView>(m_deviceViews[device_id]);
 }
 
+ServerHMDView *
+HMDManager::getHMDView(int device_id) const
+{
+    assert(ServerUtility::is_index_valid(device_id, getMaxDevices()));
+
+    return static_cast<ServerHMDView *>(getDeviceView(device_id));
+}
+
 bool
 HMDManager::can_update_connected_devices()
 {
     return true;
 }
 
+bool
+HMDManager::can_scan_devices_off_main_thread() const
+{
+    return true;
+}
+
+void
+HMDManager::scan_connected_device_paths(std::vector<std::string> &out_device_paths)
+{
+    // Virtual HMDs only change with the config, so the scan only covers the HID HMDs
+    HMDDeviceEnumerator enumerator(HMDDeviceEnumerator::CommunicationType_HID);
+
+    while (enumerator.is_valid())
+    {
+        out_device_paths.push_back(enumerator.get_path());
+        enumerator.next();
+    }
+}
+
 DeviceEnumerator *
 HMDManager::allocate_device_enumerator()
 {
@@ -129,6 +245,12 @@ HMDManager::allocate_device_view(int device_id)
     return new ServerHMDView(device_id);
 }
 
+int
+HMDManager::get_configured_max_devices() const
+{
+    return std::max(std::min(cfg.max_hmd_count, HMDManager::k_max_devices), 1);
+}
+
 int 
 HMDManager::getListUpdatedResponseType()
 {
@@ -28,6 +28,9 @@ public:
 
     int version;
     int virtual_hmd_count;
+    // Number of HMD slots (1 to HMDManager::k_max_devices).
+    // Clients only see the first PSMOVESERVICE_MAX_HMD_COUNT of them.
+    int max_hmd_count;
 };
 
 class HMDManager : public DeviceTypeManager
@@ -39,14 +42,14 @@ public:
     virtual void shutdown() override;
 
 	void updateStateAndPredict(TrackerManager* tracker_manager);
+    void publish() override;
 
-    static const int k_max_devices = PSMOVESERVICE_MAX_HMD_COUNT;
-    int getMaxDevices() const override
-    {
-        return HMDManager::k_max_devices;
-    }
+    /// Most HMD slots the config can ask for, sizes the per-device scratch arrays
+    static const int k_max_devices = 16;
 
     ServerHMDViewPtr getHMDViewPtr(int device_id);
+    /// No ref counting, for the per-tick loops over getActiveDeviceIds()
+    ServerHMDView *getHMDView(int device_id) const;
 
     inline const HMDManagerConfig& getConfig() const
     {
@@ -55,11 +58,26 @@ public:
 
 protected:
     bool can_update_connected_devices() override;
+    // Also drains the shared memory pose input of the virtual HMDs
+    void poll_devices(const std::chrono::time_point<std::chrono::high_resolution_clock> &now) override;
+    bool can_scan_devices_off_main_thread() const override;
+    void scan_connected_device_paths(std::vector<std::string> &out_device_paths) override;
     class DeviceEnumerator *allocate_device_enumerator() override;
     void free_device_enumerator(class DeviceEnumerator *) override;
     ServerDeviceView *allocate_device_view(int device_id) override;
+    int get_configured_max_devices() const override;
     int getListUpdatedResponseType() override;
 
+public:
+    /// Local shared memory pose channel (owned by the DeviceManager, null when disabled)
+    class SharedPoseStateWriter *shared_pose_writer;
+
+    /// Shared memory pose input of the virtual devices (owned by the DeviceManager, null when disabled)
+    class SharedPoseInputReader *shared_pose_input_reader;
+
+    /// Binary pose recording (owned by the DeviceManager, null when not recording)
+    class PoseRecordWriter *pose_record_writer;
+
 private:
     HMDManagerConfig cfg;
 };
@@ -0,0 +1,298 @@
+//-- includes -----
+#include "PoseRecordWriter.h"
+#include "CompactDataFrame.h"
+#include "PoseRecordFormat.h"
+#include "ServerLog.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <string.h>
+
+//-- constants -----
+// Smallest chunk that still holds a useful amount of records
+static const size_t k_min_chunk_size_bytes = 64*1024;
+
+//-- public interface -----
+PoseRecordWriter::PoseRecordWriter()
+    : m_base_path()
+    , m_chunk_record_capacity(0)
+    , m_max_chunk_count(0)
+    , m_file_mapping(nullptr)
+    , m_region(nullptr)
+    , m_chunk_index(0)
+    , m_chunk_spans()
+{
+}
+
+PoseRecordWriter::~PoseRecordWriter()
+{
+    shutdown();
+}
+
+bool PoseRecordWriter::startup(const std::string &base_path, size_t chunk_size_bytes, int max_chunk_count)
+{
+    const size_t chunk_size = std::max(chunk_size_bytes, k_min_chunk_size_bytes);
+
+    m_base_path = base_path;
+    m_chunk_record_capacity = (chunk_size - sizeof(PoseRecordChunkHeader)) / sizeof(PoseRecord);
+    m_max_chunk_count = max_chunk_count;
+    m_chunk_spans.clear();
+
+    // Leftovers of an older recording at the same path would be mistaken for part of this one
+    // (the rotation can have dropped its first chunks, so look for every <base>.*.psmr)
+    {
+        const boost::filesystem::path base(m_base_path);
+        const std::string chunk_prefix = base.filename().string() + ".";
+        boost::filesystem::path directory = base.parent_path();
+        boost::system::error_code ec;
+
+        if (directory.empty())
+        {
+            directory = ".";
+        }
+
+        std::vector<boost::filesystem::path> stale_chunk_paths;
+        for (boost::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec))
+        {
+            const std::string filename = it->path().filename().string();
+
+            if (filename.compare(0, chunk_prefix.size(), chunk_prefix) == 0 && it->path().extension() == ".psmr")
+            {
+                stale_chunk_paths.push_back(it->path());
+            }
+        }
+
+        for (const boost::filesystem::path &stale_chunk_path : stale_chunk_paths)
+        {
+            boost::filesystem::remove(stale_chunk_path, ec);
+        }
+    }
+
+    const bool bSuccess = openChunk(0);
+
+    if (bSuccess)
+    {
+        writeIndex();
+
+        SERVER_LOG_INFO("PoseRecordWriter::startup()") << "Recording poses to " << m_base_path
+            << " (" << m_chunk_record_capacity << " records per chunk)";
+    }
+
+    return bSuccess;
+}
+
+void PoseRecordWriter::shutdown()
+{
+    if (m_region != nullptr)
+    {
+        closeChunk();
+        writeIndex();
+    }
+}
+
+void PoseRecordWriter::writeControllerPose(const CompactControllerPoseFrame &pose_frame)
+{
+    PoseRecord record;
+
+    memset(&record, 0, sizeof(PoseRecord));
+    record.service_time_us = pose_frame.service_time_us;
+    record.sequence_num = pose_frame.sequence_num;
+    record.device_class = POSE_RECORD_DEVICE_CONTROLLER;
+    record.device_id = pose_frame.controller_id;
+    record.device_type = pose_frame.controller_type;
+    record.flags = pose_frame.flags;
+    memcpy(record.orientation, pose_frame.orientation, sizeof(record.orientation));
+    memcpy(record.position_cm, pose_frame.position_cm, sizeof(record.position_cm));
+    memcpy(record.velocity_cm_per_sec, pose_frame.velocity_cm_per_sec, sizeof(record.velocity_cm_per_sec));
+    record.sensor_data_age_ms = pose_frame.sensor_data_age_ms;
+
+    appendRecord(record);
+}
+
+void PoseRecordWriter::writeHMDPose(const CompactHMDPoseFrame &pose_frame)
+{
+    PoseRecord record;
+
+    memset(&record, 0, sizeof(PoseRecord));
+    record.service_time_us = pose_frame.service_time_us;
+    record.sequence_num = pose_frame.sequence_num;
+    record.device_class = POSE_RECORD_DEVICE_HMD;
+    record.device_id = pose_frame.hmd_id;
+    record.device_type = pose_frame.hmd_type;
+    record.flags = pose_frame.flags;
+    memcpy(record.orientation, pose_frame.orientation, sizeof(record.orientation));
+    memcpy(record.position_cm, pose_frame.position_cm, sizeof(record.position_cm));
+    memcpy(record.velocity_cm_per_sec, pose_frame.velocity_cm_per_sec, sizeof(record.velocity_cm_per_sec));
+    record.sensor_data_age_ms = pose_frame.sensor_data_age_ms;
+
+    appendRecord(record);
+}
+
+//-- private methods -----
+void PoseRecordWriter::appendRecord(const PoseRecord &record)
+{
+    if (m_region == nullptr)
+    {
+        return;
+    }
+
+    PoseRecordChunkHeader *header = getChunkHeader();
+
+    if (header->record_count >= m_chunk_record_capacity)
+    {
+        // Rotate to the next chunk
+        const uint32_t next_chunk_index = m_chunk_index + 1;
+
+        closeChunk();
+
+        if (m_max_chunk_count > 0 && static_cast<int>(m_chunk_spans.size()) >= m_max_chunk_count)
+        {
+            boost::system::error_code ec;
+            boost::filesystem::remove(pose_record_get_chunk_path(m_base_path, m_chunk_spans.front().chunk_index), ec);
+            m_chunk_spans.erase(m_chunk_spans.begin());
+        }
+
+        if (!openChunk(next_chunk_index))
+        {
+            writeIndex();
+            return;
+        }
+
+        writeIndex();
+        header = getChunkHeader();
+    }
+
+    PoseRecord *records = reinterpret_cast<PoseRecord *>(header + 1);
+    records[header->record_count] = record;
+
+    if (header->record_count == 0)
+    {
+        header->first_time_us = record.service_time_us;
+    }
+    header->last_time_us = record.service_time_us;
+    ++header->record_count;
+}
+
+bool PoseRecordWriter::openChunk(uint32_t chunk_index)
+{
+    const std::string chunk_path = pose_record_get_chunk_path(m_base_path, chunk_index);
+    const size_t chunk_size = sizeof(PoseRecordChunkHeader) + m_chunk_record_capacity*sizeof(PoseRecord);
+    bool bSuccess = false;
+
+    try
+    {
+        // Size the file up front, a file mapping can't grow
+        {
+            std::filebuf file;
+            file.open(chunk_path.c_str(), std::ios_base::in | std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+            file.pubseekoff(chunk_size - 1, std::ios_base::beg);
+            file.sputc(0);
+        }
+
+        m_file_mapping = new boost::interprocess::file_mapping(chunk_path.c_str(), boost::interprocess::read_write);
+        m_region = new boost::interprocess::mapped_region(*m_file_mapping, boost::interprocess::read_write);
+        m_chunk_index = chunk_index;
+
+        PoseRecordChunkHeader *header = getChunkHeader();
+        memset(header, 0, sizeof(PoseRecordChunkHeader));
+        header->magic = POSE_RECORD_CHUNK_MAGIC;
+        header->version = POSE_RECORD_FORMAT_VERSION;
+        header->chunk_index = chunk_index;
+        header->record_size = sizeof(PoseRecord);
+
+        bSuccess = true;
+    }
+    catch (boost::interprocess::interprocess_exception &ex)
+    {
+        SERVER_LOG_ERROR("PoseRecordWriter::openChunk()") << "Failed to map pose record chunk: " << chunk_path
+            << ", reason: " << ex.what();
+
+        delete m_region;
+        m_region = nullptr;
+        delete m_file_mapping;
+        m_file_mapping = nullptr;
+    }
+
+    return bSuccess;
+}
+
+void PoseRecordWriter::closeChunk()
+{
+    const PoseRecordChunkHeader *header = getChunkHeader();
+
+    t_chunk_span span;
+    span.chunk_index = m_chunk_index;
+    span.record_count = header->record_count;
+    span.first_time_us = header->first_time_us;
+    span.last_time_us = header->last_time_us;
+    m_chunk_spans.push_back(span);
+
+    m_region->flush();
+    delete m_region;
+    m_region = nullptr;
+    delete m_file_mapping;
+    m_file_mapping = nullptr;
+
+    // Drop the unused tail of the chunk
+    boost::system::error_code ec;
+    boost::filesystem::resize_file(
+        pose_record_get_chunk_path(m_base_path, span.chunk_index),
+        sizeof(PoseRecordChunkHeader) + span.record_count*sizeof(PoseRecord),
+        ec);
+}
+
+void PoseRecordWriter::writeIndex()
+{
+    // The chunk being written goes in too, readers pick up its live count from its header
+    std::vector<PoseRecordIndexEntry> entries;
+    for (const t_chunk_span &span : m_chunk_spans)
+    {
+        PoseRecordIndexEntry entry;
+        memset(&entry, 0, sizeof(PoseRecordIndexEntry));
+        entry.chunk_index = span.chunk_index;
+        entry.record_count = span.record_count;
+        entry.first_time_us = span.first_time_us;
+        entry.last_time_us = span.last_time_us;
+        entries.push_back(entry);
+    }
+
+    if (m_region != nullptr)
+    {
+        const PoseRecordChunkHeader *header = getChunkHeader();
+        PoseRecordIndexEntry entry;
+        memset(&entry, 0, sizeof(PoseRecordIndexEntry));
+        entry.chunk_index = m_chunk_index;
+        entry.record_count = header->record_count;
+        entry.first_time_us = header->first_time_us;
+        entry.last_time_us = header->last_time_us;
+        entries.push_back(entry);
+    }
+
+    PoseRecordIndexHeader index_header;
+    memset(&index_header, 0, sizeof(PoseRecordIndexHeader));
+    index_header.magic = POSE_RECORD_INDEX_MAGIC;
+    index_header.version = POSE_RECORD_FORMAT_VERSION;
+    index_header.chunk_count = static_cast<uint32_t>(entries.size());
+
+    const std::string index_path = pose_record_get_index_path(m_base_path);
+    std::ofstream index_file(index_path.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    index_file.write(reinterpret_cast<const char *>(&index_header), sizeof(PoseRecordIndexHeader));
+    if (!entries.empty())
+    {
+        index_file.write(reinterpret_cast<const char *>(entries.data()), entries.size()*sizeof(PoseRecordIndexEntry));
+    }
+
+    if (!index_file.good())
+    {
+        SERVER_LOG_WARNING("PoseRecordWriter::writeIndex()") << "Failed to write pose record index: " << index_path;
+    }
+}
+
+PoseRecordChunkHeader *PoseRecordWriter::getChunkHeader()
+{
+    return reinterpret_cast<PoseRecordChunkHeader *>(m_region->get_address());
+}
@@ -0,0 +1,73 @@
+#ifndef POSE_RECORD_WRITER_H
+#define POSE_RECORD_WRITER_H
+
+//-- includes -----
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//-- pre-declarations -----
+namespace boost {
+    namespace interprocess {
+        class file_mapping;
+        class mapped_region;
+    }
+}
+
+//-- definitions -----
+/// Appends the poses the service publishes to a memory-mapped binary recording (see PoseRecordFormat.h).
+/**
+ Owned by the DeviceManager and handed to the controller and HMD managers,
+ which append a record whenever they publish new state for a device,
+ same as the SharedPoseStateWriter. Appending is a copy into the mapped chunk,
+ the OS writes the pages back in the background.
+ Once a chunk is full it gets trimmed and closed, the index is rewritten and the next chunk is started.
+ Main thread only.
+ */
+class PoseRecordWriter
+{
+public:
+    PoseRecordWriter();
+    virtual ~PoseRecordWriter();
+
+    /// Starts a new recording at base_path (any previous recording there gets overwritten).
+    /// max_chunk_count > 0 deletes the oldest chunk once a newer one would exceed it.
+    bool startup(const std::string &base_path, size_t chunk_size_bytes, int max_chunk_count);
+
+    /// Closes the current chunk and writes the final index
+    void shutdown();
+
+    void writeControllerPose(const struct CompactControllerPoseFrame &pose_frame);
+    void writeHMDPose(const struct CompactHMDPoseFrame &pose_frame);
+
+    inline bool getIsRecording() const
+    { return m_region != nullptr; }
+
+private:
+    struct t_chunk_span
+    {
+        uint32_t chunk_index;
+        uint64_t record_count;
+        int64_t first_time_us;
+        int64_t last_time_us;
+    };
+
+    void appendRecord(const struct PoseRecord &record);
+    bool openChunk(uint32_t chunk_index);
+    void closeChunk();
+    void writeIndex();
+    struct PoseRecordChunkHeader *getChunkHeader();
+
+    std::string m_base_path;
+    uint64_t m_chunk_record_capacity;
+    int m_max_chunk_count;
+
+    boost::interprocess::file_mapping *m_file_mapping;
+    boost::interprocess::mapped_region *m_region;
+    uint32_t m_chunk_index;
+
+    // Closed chunks still on disk, oldest first
+    std::vector<t_chunk_span> m_chunk_spans;
+};
+
+#endif // POSE_RECORD_WRITER_H
@@ -0,0 +1,124 @@
+//-- includes -----
+#include "SharedPoseInputReader.h"
+#include "SharedPoseInput.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <new>
+
+//-- public interface -----
+SharedPoseInputReader::SharedPoseInputReader()
+    : m_shared_memory_object(nullptr)
+    , m_region(nullptr)
+{
+    memset(m_controller_read_counts, 0, sizeof(m_controller_read_counts));
+    memset(m_hmd_read_counts, 0, sizeof(m_hmd_read_counts));
+}
+
+SharedPoseInputReader::~SharedPoseInputReader()
+{
+    shutdown();
+}
+
+bool SharedPoseInputReader::startup()
+{
+    bool bSuccess = false;
+
+    try
+    {
+        SERVER_LOG_INFO("SharedPoseInputReader::startup()") << "Allocating shared memory: " << PSMOVESERVICE_SHARED_POSE_INPUT_NAME;
+
+        // Make sure a block left behind by a crashed service has been removed first
+        boost::interprocess::shared_memory_object::remove(PSMOVESERVICE_SHARED_POSE_INPUT_NAME);
+
+        // Allow non admin-level processed to write poses into the shared memory
+        boost::interprocess::permissions permissions;
+        permissions.set_unrestricted();
+
+        m_shared_memory_object =
+            new boost::interprocess::shared_memory_object(
+                boost::interprocess::create_only,
+                PSMOVESERVICE_SHARED_POSE_INPUT_NAME,
+                boost::interprocess::read_write,
+                permissions);
+        m_shared_memory_object->truncate(sizeof(SharedPoseInputHeader));
+
+        m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
+
+        // Call the constructor using placement new so the ring atomics get initialized
+        new (m_region->get_address()) SharedPoseInputHeader();
+
+        memset(m_controller_read_counts, 0, sizeof(m_controller_read_counts));
+        memset(m_hmd_read_counts, 0, sizeof(m_hmd_read_counts));
+
+        bSuccess = true;
+    }
+    catch (boost::interprocess::interprocess_exception &ex)
+    {
+        shutdown();
+        SERVER_LOG_ERROR("SharedPoseInputReader::startup()") << "Failed to allocate shared memory: " << PSMOVESERVICE_SHARED_POSE_INPUT_NAME
+            << ", reason: " << ex.what();
+    }
+
+    return bSuccess;
+}
+
+void SharedPoseInputReader::shutdown()
+{
+    if (m_region != nullptr)
+    {
+        // Call the destructor manually since the header was constructed via placement new
+        getPoseInputHeader()->~SharedPoseInputHeader();
+
+        delete m_region;
+        m_region = nullptr;
+    }
+
+    if (m_shared_memory_object != nullptr)
+    {
+        delete m_shared_memory_object;
+        m_shared_memory_object = nullptr;
+
+        if (!boost::interprocess::shared_memory_object::remove(PSMOVESERVICE_SHARED_POSE_INPUT_NAME))
+        {
+            SERVER_LOG_ERROR("SharedPoseInputReader::shutdown") << "Failed to free shared memory: " << PSMOVESERVICE_SHARED_POSE_INPUT_NAME;
+        }
+    }
+}
+
+int SharedPoseInputReader::readControllerPoses(int controller_id, ExternalPoseSample *out_samples, int max_count)
+{
+    int sample_count = 0;
+
+    if (m_region != nullptr && ServerUtility::is_index_valid(controller_id, PSMOVESERVICE_MAX_CONTROLLER_COUNT))
+    {
+        sample_count =
+            getPoseInputHeader()->controller_rings[controller_id].read(
+                m_controller_read_counts[controller_id], out_samples, max_count);
+    }
+
+    return sample_count;
+}
+
+int SharedPoseInputReader::readHMDPoses(int hmd_id, ExternalPoseSample *out_samples, int max_count)
+{
+    int sample_count = 0;
+
+    if (m_region != nullptr && ServerUtility::is_index_valid(hmd_id, PSMOVESERVICE_MAX_HMD_COUNT))
+    {
+        sample_count =
+            getPoseInputHeader()->hmd_rings[hmd_id].read(
+                m_hmd_read_counts[hmd_id], out_samples, max_count);
+    }
+
+    return sample_count;
+}
+
+//-- private methods -----
+SharedPoseInputHeader *SharedPoseInputReader::getPoseInputHeader()
+{
+    return reinterpret_cast<SharedPoseInputHeader *>(m_region->get_address());
+}
@@ -0,0 +1,49 @@
+#ifndef SHARED_POSE_INPUT_READER_H
+#define SHARED_POSE_INPUT_READER_H
+
+//-- includes -----
+#include "PSMoveProtocolInterface.h"
+
+#include <stdint.h>
+
+//-- pre-declarations -----
+namespace boost {
+    namespace interprocess {
+        class shared_memory_object;
+        class mapped_region;
+    }
+}
+
+//-- definitions -----
+/// Service side of the shared memory pose input of the virtual devices (see SharedPoseInput.h).
+/**
+ Owned by the DeviceManager and handed to the controller and HMD managers,
+ which drain the rings of their open virtual devices every poll.
+ Keeps its own read position per ring. Main thread only.
+ */
+class SharedPoseInputReader
+{
+public:
+    SharedPoseInputReader();
+    virtual ~SharedPoseInputReader();
+
+    /// Creates and maps the shared memory block. Returns false if the block couldn't be allocated.
+    bool startup();
+
+    /// Unmaps and removes the shared memory block
+    void shutdown();
+
+    /// Copies out up to max_count of the samples written to the device's ring since the last read
+    int readControllerPoses(int controller_id, struct ExternalPoseSample *out_samples, int max_count);
+    int readHMDPoses(int hmd_id, struct ExternalPoseSample *out_samples, int max_count);
+
+private:
+    class SharedPoseInputHeader *getPoseInputHeader();
+
+    boost::interprocess::shared_memory_object *m_shared_memory_object;
+    boost::interprocess::mapped_region *m_region;
+    uint32_t m_controller_read_counts[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    uint32_t m_hmd_read_counts[PSMOVESERVICE_MAX_HMD_COUNT];
+};
+
+#endif // SHARED_POSE_INPUT_READER_H
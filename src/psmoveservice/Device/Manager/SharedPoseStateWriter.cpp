@@ -0,0 +1,147 @@
+//-- includes -----
+#include "SharedPoseStateWriter.h"
+#include "SharedPoseState.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <new>
+
+//-- public interface -----
+SharedPoseStateWriter::SharedPoseStateWriter()
+    : m_shared_memory_object(nullptr)
+    , m_region(nullptr)
+{
+    memset(m_bControllerSlotConnected, 0, sizeof(m_bControllerSlotConnected));
+    memset(m_bHMDSlotConnected, 0, sizeof(m_bHMDSlotConnected));
+}
+
+SharedPoseStateWriter::~SharedPoseStateWriter()
+{
+    shutdown();
+}
+
+bool SharedPoseStateWriter::startup()
+{
+    bool bSuccess = false;
+
+    try
+    {
+        SERVER_LOG_INFO("SharedPoseStateWriter::startup()") << "Allocating shared memory: " << PSMOVESERVICE_SHARED_POSE_STATE_NAME;
+
+        // Make sure a block left behind by a crashed service has been removed first
+        boost::interprocess::shared_memory_object::remove(PSMOVESERVICE_SHARED_POSE_STATE_NAME);
+
+        // Allow non admin-level processed to access the shared memory
+        boost::interprocess::permissions permissions;
+        permissions.set_unrestricted();
+
+        m_shared_memory_object =
+            new boost::interprocess::shared_memory_object(
+                boost::interprocess::create_only,
+                PSMOVESERVICE_SHARED_POSE_STATE_NAME,
+                boost::interprocess::read_write,
+                permissions);
+        m_shared_memory_object->truncate(sizeof(SharedPoseStateHeader));
+
+        m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
+
+        // Call the constructor using placement new so the slot atomics get initialized
+        new (m_region->get_address()) SharedPoseStateHeader();
+
+        bSuccess = true;
+    }
+    catch (boost::interprocess::interprocess_exception &ex)
+    {
+        shutdown();
+        SERVER_LOG_ERROR("SharedPoseStateWriter::startup()") << "Failed to allocate shared memory: " << PSMOVESERVICE_SHARED_POSE_STATE_NAME
+            << ", reason: " << ex.what();
+    }
+
+    return bSuccess;
+}
+
+void SharedPoseStateWriter::shutdown()
+{
+    if (m_region != nullptr)
+    {
+        // Call the destructor manually since the header was constructed via placement new
+        getPoseStateHeader()->~SharedPoseStateHeader();
+
+        delete m_region;
+        m_region = nullptr;
+    }
+
+    if (m_shared_memory_object != nullptr)
+    {
+        delete m_shared_memory_object;
+        m_shared_memory_object = nullptr;
+
+        if (!boost::interprocess::shared_memory_object::remove(PSMOVESERVICE_SHARED_POSE_STATE_NAME))
+        {
+            SERVER_LOG_ERROR("SharedPoseStateWriter::shutdown") << "Failed to free shared memory: " << PSMOVESERVICE_SHARED_POSE_STATE_NAME;
+        }
+    }
+}
+
+void SharedPoseStateWriter::writeControllerPose(int controller_id, const CompactControllerPoseFrame &pose_frame)
+{
+    if (m_region != nullptr && ServerUtility::is_index_valid(controller_id, PSMOVESERVICE_MAX_CONTROLLER_COUNT))
+    {
+        getPoseStateHeader()->controller_slots[controller_id].write(pose_frame);
+        m_bControllerSlotConnected[controller_id] = (pose_frame.flags & COMPACT_POSE_FLAG_IS_CONNECTED) != 0;
+    }
+}
+
+void SharedPoseStateWriter::writeHMDPose(int hmd_id, const CompactHMDPoseFrame &pose_frame)
+{
+    if (m_region != nullptr && ServerUtility::is_index_valid(hmd_id, PSMOVESERVICE_MAX_HMD_COUNT))
+    {
+        getPoseStateHeader()->hmd_slots[hmd_id].write(pose_frame);
+        m_bHMDSlotConnected[hmd_id] = (pose_frame.flags & COMPACT_POSE_FLAG_IS_CONNECTED) != 0;
+    }
+}
+
+void SharedPoseStateWriter::clearControllerPose(int controller_id)
+{
+    if (ServerUtility::is_index_valid(controller_id, PSMOVESERVICE_MAX_CONTROLLER_COUNT) &&
+        m_bControllerSlotConnected[controller_id])
+    {
+        CompactControllerPoseFrame pose_frame;
+
+        memset(&pose_frame, 0, sizeof(CompactControllerPoseFrame));
+        pose_frame.marker = COMPACT_DATA_FRAME_MARKER;
+        pose_frame.version = COMPACT_DATA_FRAME_VERSION;
+        pose_frame.controller_id = static_cast<uint8_t>(controller_id);
+        pose_frame.sequence_num = -1;
+        pose_frame.sensor_data_age_ms = -1.f;
+
+        writeControllerPose(controller_id, pose_frame);
+    }
+}
+
+void SharedPoseStateWriter::clearHMDPose(int hmd_id)
+{
+    if (ServerUtility::is_index_valid(hmd_id, PSMOVESERVICE_MAX_HMD_COUNT) &&
+        m_bHMDSlotConnected[hmd_id])
+    {
+        CompactHMDPoseFrame pose_frame;
+
+        memset(&pose_frame, 0, sizeof(CompactHMDPoseFrame));
+        pose_frame.marker = COMPACT_DATA_FRAME_MARKER;
+        pose_frame.version = COMPACT_DATA_FRAME_VERSION;
+        pose_frame.hmd_id = static_cast<uint8_t>(hmd_id);
+        pose_frame.sequence_num = -1;
+        pose_frame.sensor_data_age_ms = -1.f;
+
+        writeHMDPose(hmd_id, pose_frame);
+    }
+}
+
+//-- private methods -----
+SharedPoseStateHeader *SharedPoseStateWriter::getPoseStateHeader()
+{
+    return reinterpret_cast<SharedPoseStateHeader *>(m_region->get_address());
+}
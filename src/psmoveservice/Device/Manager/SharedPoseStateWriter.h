@@ -0,0 +1,50 @@
+#ifndef SHARED_POSE_STATE_WRITER_H
+#define SHARED_POSE_STATE_WRITER_H
+
+//-- includes -----
+#include "PSMoveProtocolInterface.h"
+
+//-- pre-declarations -----
+namespace boost {
+    namespace interprocess {
+        class shared_memory_object;
+        class mapped_region;
+    }
+}
+
+//-- definitions -----
+/// Service side of the local shared memory pose channel (see SharedPoseState.h).
+/**
+ Owned by the DeviceManager and handed to the controller and HMD managers,
+ which write a slot whenever they publish new state for a device.
+ Main thread only.
+ */
+class SharedPoseStateWriter
+{
+public:
+    SharedPoseStateWriter();
+    virtual ~SharedPoseStateWriter();
+
+    /// Creates and maps the shared memory block. Returns false if the block couldn't be allocated.
+    bool startup();
+
+    /// Unmaps and removes the shared memory block
+    void shutdown();
+
+    void writeControllerPose(int controller_id, const struct CompactControllerPoseFrame &pose_frame);
+    void writeHMDPose(int hmd_id, const struct CompactHMDPoseFrame &pose_frame);
+
+    /// Overwrites the slot of a closed device with a disconnected frame (once)
+    void clearControllerPose(int controller_id);
+    void clearHMDPose(int hmd_id);
+
+private:
+    class SharedPoseStateHeader *getPoseStateHeader();
+
+    boost::interprocess::shared_memory_object *m_shared_memory_object;
+    boost::interprocess::mapped_region *m_region;
+    bool m_bControllerSlotConnected[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    bool m_bHMDSlotConnected[PSMOVESERVICE_MAX_HMD_COUNT];
+};
+
+#endif // SHARED_POSE_STATE_WRITER_H
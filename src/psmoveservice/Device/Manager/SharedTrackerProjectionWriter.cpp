@@ -0,0 +1,104 @@
+//-- includes -----
+#include "SharedTrackerProjectionWriter.h"
+#include "SharedTrackerProjections.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <new>
+
+//-- public interface -----
+SharedTrackerProjectionWriter::SharedTrackerProjectionWriter()
+    : m_shared_memory_object(nullptr)
+    , m_region(nullptr)
+{
+    memset(m_tracker_frame_indices, 0, sizeof(m_tracker_frame_indices));
+}
+
+SharedTrackerProjectionWriter::~SharedTrackerProjectionWriter()
+{
+    shutdown();
+}
+
+bool SharedTrackerProjectionWriter::startup()
+{
+    bool bSuccess = false;
+
+    try
+    {
+        SERVER_LOG_INFO("SharedTrackerProjectionWriter::startup()") << "Allocating shared memory: " << PSMOVESERVICE_SHARED_TRACKER_PROJECTIONS_NAME;
+
+        // Make sure a block left behind by a crashed service has been removed first
+        boost::interprocess::shared_memory_object::remove(PSMOVESERVICE_SHARED_TRACKER_PROJECTIONS_NAME);
+
+        // Allow non admin-level processed to access the shared memory
+        boost::interprocess::permissions permissions;
+        permissions.set_unrestricted();
+
+        m_shared_memory_object =
+            new boost::interprocess::shared_memory_object(
+                boost::interprocess::create_only,
+                PSMOVESERVICE_SHARED_TRACKER_PROJECTIONS_NAME,
+                boost::interprocess::read_write,
+                permissions);
+        m_shared_memory_object->truncate(sizeof(SharedTrackerProjectionsHeader));
+
+        m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
+
+        // Call the constructor using placement new so the slot atomics get initialized
+        new (m_region->get_address()) SharedTrackerProjectionsHeader();
+
+        memset(m_tracker_frame_indices, 0, sizeof(m_tracker_frame_indices));
+
+        bSuccess = true;
+    }
+    catch (boost::interprocess::interprocess_exception &ex)
+    {
+        shutdown();
+        SERVER_LOG_ERROR("SharedTrackerProjectionWriter::startup()") << "Failed to allocate shared memory: " << PSMOVESERVICE_SHARED_TRACKER_PROJECTIONS_NAME
+            << ", reason: " << ex.what();
+    }
+
+    return bSuccess;
+}
+
+void SharedTrackerProjectionWriter::shutdown()
+{
+    if (m_region != nullptr)
+    {
+        // Call the destructor manually since the header was constructed via placement new
+        getProjectionsHeader()->~SharedTrackerProjectionsHeader();
+
+        delete m_region;
+        m_region = nullptr;
+    }
+
+    if (m_shared_memory_object != nullptr)
+    {
+        delete m_shared_memory_object;
+        m_shared_memory_object = nullptr;
+
+        if (!boost::interprocess::shared_memory_object::remove(PSMOVESERVICE_SHARED_TRACKER_PROJECTIONS_NAME))
+        {
+            SERVER_LOG_ERROR("SharedTrackerProjectionWriter::shutdown") << "Failed to free shared memory: " << PSMOVESERVICE_SHARED_TRACKER_PROJECTIONS_NAME;
+        }
+    }
+}
+
+void SharedTrackerProjectionWriter::writeTrackerProjections(int tracker_id, SharedTrackerProjectionFrame &projection_frame)
+{
+    // Trackers past the client visible count have no slot
+    if (m_region != nullptr && ServerUtility::is_index_valid(tracker_id, PSMOVESERVICE_MAX_TRACKER_COUNT))
+    {
+        projection_frame.frame_index = ++m_tracker_frame_indices[tracker_id];
+        getProjectionsHeader()->tracker_slots[tracker_id].write(projection_frame);
+    }
+}
+
+//-- private methods -----
+SharedTrackerProjectionsHeader *SharedTrackerProjectionWriter::getProjectionsHeader()
+{
+    return reinterpret_cast<SharedTrackerProjectionsHeader *>(m_region->get_address());
+}
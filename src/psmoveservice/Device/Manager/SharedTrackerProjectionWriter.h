@@ -0,0 +1,47 @@
+#ifndef SHARED_TRACKER_PROJECTION_WRITER_H
+#define SHARED_TRACKER_PROJECTION_WRITER_H
+
+//-- includes -----
+#include "PSMoveProtocolInterface.h"
+
+#include <stdint.h>
+
+//-- pre-declarations -----
+namespace boost {
+    namespace interprocess {
+        class shared_memory_object;
+        class mapped_region;
+    }
+}
+
+//-- definitions -----
+/// Service side of the shared memory tracker projection export (see SharedTrackerProjections.h).
+/**
+ Owned by the DeviceManager and handed to the tracker manager,
+ which writes a tracker's slot whenever the tracker has new projection results.
+ Main thread only.
+ */
+class SharedTrackerProjectionWriter
+{
+public:
+    SharedTrackerProjectionWriter();
+    virtual ~SharedTrackerProjectionWriter();
+
+    /// Creates and maps the shared memory block. Returns false if the block couldn't be allocated.
+    bool startup();
+
+    /// Unmaps and removes the shared memory block
+    void shutdown();
+
+    /// Stamps the frame with the tracker's next frame index and publishes it
+    void writeTrackerProjections(int tracker_id, struct SharedTrackerProjectionFrame &projection_frame);
+
+private:
+    class SharedTrackerProjectionsHeader *getProjectionsHeader();
+
+    boost::interprocess::shared_memory_object *m_shared_memory_object;
+    boost::interprocess::mapped_region *m_region;
+    uint32_t m_tracker_frame_indices[PSMOVESERVICE_MAX_TRACKER_COUNT];
+};
+
+#endif // SHARED_TRACKER_PROJECTION_WRITER_H
@@ -1,18 +1,167 @@
 //-- includes -----
 #include "TrackerManager.h"
 #include "TrackerDeviceEnumerator.h"
+#include "CameraNodeLink.h"
 #include "ControllerManager.h"
+#include "DeviceInputLog.h"
 #include "DeviceManager.h"
 #include "HMDManager.h"
+#include "InputLogTrackerEnumerator.h"
 #include "ServerLog.h"
 #include "ServerControllerView.h"
 #include "ServerHMDView.h"
 #include "ServerTrackerView.h"
 #include "ServerDeviceView.h"
+#include "ServerUtility.h"
+#include "SharedTrackerProjectionWriter.h"
 #include "MathUtility.h"
 #include "PSMoveProtocol.pb.h"
 
+#include <algorithm>
+#include <cmath>
+
 //-- constants -----
+// Frame period assumed for trackers that don't report a frame rate
+static const float k_default_tracker_frame_rate = 60.f;
+
+// Frame intervals in a row that have to fit the period before the frame clock predicts frames
+static const int k_frame_clock_lock_count = 8;
+// A gap of more frame periods than this (stream suspended or restarted) relearns the clock
+static const int k_frame_clock_max_frame_gap = 8;
+
+//-- Tracker Frameset -----
+void TrackerFrameset::clear()
+{
+    for (int tracker_id = 0; tracker_id < TRACKER_MANAGER_MAX_DEVICES; ++tracker_id)
+    {
+        bHasTracker[tracker_id] = false;
+        tracker_capture_timestamps[tracker_id] = std::chrono::time_point<std::chrono::high_resolution_clock>();
+        tracker_frame_drop_counts[tracker_id] = 0;
+    }
+    tracker_count = 0;
+    capture_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
+    start_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
+    sync_window = std::chrono::microseconds::zero();
+    timeout = std::chrono::microseconds::zero();
+}
+
+void TrackerFrameset::addTracker(
+    int tracker_id,
+    const ServerTrackerView *tracker_view,
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &now)
+{
+    if (tracker_count == 0)
+    {
+        const double frame_rate = tracker_view->getFrameRate();
+        const double frame_period_us =
+            1000000.0 / ((frame_rate > 0.0) ? frame_rate : static_cast<double>(k_default_tracker_frame_rate));
+
+        // Frames of the same exposure land well within half a frame period of each other.
+        // A frame that hasn't shown up a full period after the first one got dropped.
+        capture_timestamp = tracker_view->getLastVideoFrameCaptureTimestamp();
+        start_timestamp = now;
+        sync_window = std::chrono::microseconds(static_cast<long long>(frame_period_us * 0.5));
+        timeout = std::chrono::microseconds(static_cast<long long>(frame_period_us));
+    }
+
+    bHasTracker[tracker_id] = true;
+    tracker_capture_timestamps[tracker_id] = tracker_view->getLastVideoFrameCaptureTimestamp();
+    tracker_frame_drop_counts[tracker_id] = tracker_view->getLastVideoFrameDropCount();
+    ++tracker_count;
+}
+
+bool TrackerFrameset::getCanAddFrame(
+    int tracker_id,
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &frame_capture_timestamp) const
+{
+    if (tracker_count == 0)
+    {
+        return true;
+    }
+
+    const std::chrono::high_resolution_clock::duration capture_offset =
+        (frame_capture_timestamp > capture_timestamp)
+        ? frame_capture_timestamp - capture_timestamp
+        : capture_timestamp - frame_capture_timestamp;
+
+    return !bHasTracker[tracker_id] && capture_offset <= sync_window;
+}
+
+//-- Tracker Frame Clock -----
+void TrackerFrameClock::clear()
+{
+    last_capture_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
+    frame_period_us = 0.0;
+    consistent_frame_count = 0;
+}
+
+void TrackerFrameClock::addFrame(
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &capture_timestamp,
+    double nominal_frame_period_us)
+{
+    // A frame held back for the next frameset shows up again
+    if (capture_timestamp <= last_capture_timestamp)
+    {
+        return;
+    }
+
+    if (last_capture_timestamp == std::chrono::time_point<std::chrono::high_resolution_clock>() || frame_period_us <= 0.0)
+    {
+        last_capture_timestamp = capture_timestamp;
+        frame_period_us = nominal_frame_period_us;
+        consistent_frame_count = 0;
+        return;
+    }
+
+    const double interval_us =
+        std::chrono::duration<double, std::micro>(capture_timestamp - last_capture_timestamp).count();
+    // Dropped frames leave a gap of several periods
+    const double frame_steps = std::max(std::floor(interval_us / frame_period_us + 0.5), 1.0);
+
+    if (frame_steps > k_frame_clock_max_frame_gap)
+    {
+        frame_period_us = nominal_frame_period_us;
+        consistent_frame_count = 0;
+    }
+    else
+    {
+        const double sample_period_us = interval_us / frame_steps;
+
+        if (std::abs(sample_period_us - frame_period_us) < frame_period_us * 0.25)
+        {
+            frame_period_us += 0.1 * (sample_period_us - frame_period_us);
+            consistent_frame_count = std::min(consistent_frame_count + 1, k_frame_clock_lock_count);
+        }
+        else
+        {
+            consistent_frame_count = 0;
+        }
+    }
+
+    last_capture_timestamp = capture_timestamp;
+}
+
+std::chrono::time_point<std::chrono::high_resolution_clock>
+TrackerFrameClock::getNextFrameTime(const std::chrono::time_point<std::chrono::high_resolution_clock> &now) const
+{
+    if (consistent_frame_count < k_frame_clock_lock_count || now < last_capture_timestamp)
+    {
+        return std::chrono::time_point<std::chrono::high_resolution_clock>::max();
+    }
+
+    const double elapsed_us = std::chrono::duration<double, std::micro>(now - last_capture_timestamp).count();
+    const double frame_steps = std::floor(elapsed_us / frame_period_us) + 1.0;
+
+    // The stream stopped
+    if (frame_steps > k_frame_clock_max_frame_gap)
+    {
+        return std::chrono::time_point<std::chrono::high_resolution_clock>::max();
+    }
+
+    return last_capture_timestamp +
+        std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+            std::chrono::duration<double, std::micro>(frame_steps * frame_period_us));
+}
 
 //-- Tracker Manager Config -----
 const int TrackerManagerConfig::CONFIG_VERSION = 2;
@@ -25,10 +174,52 @@ TrackerManagerConfig::TrackerManagerConfig(const std::string &fnamebase)
 	ignore_pose_from_one_tracker = false;
     optical_tracking_timeout= 100;
 	tracker_sleep_ms = 1;
+	sleep_until_next_device_poll = true;
+	main_thread_cpu_cores = "";
+	main_thread_priority = "normal";
 	use_bgr_to_hsv_lookup_table = true;
+	use_quantized_bgr_to_hsv_lookup_table = false;
+	cache_bgr_to_hsv_lookup_table = true;
+	use_fused_hsv_mask_kernel = false;
+	use_opencl_color_mask = false;
+	use_vision_worker_threads = true;
+	use_pipelined_vision = false;
+	use_camera_capture_threads = true;
+	use_roi_demosaic = false;
+	use_bayer_cell_search = false;
+	use_motion_gating = false;
+	motion_gate_max_pixel_difference = 2.f;
+	motion_gate_max_angular_velocity = 0.1f;
+	motion_gate_max_reused_frames = 30;
+	use_frustum_culling = false;
+	frustum_culling_margin_cm = 15.f;
+	use_auto_exposure = false;
+	auto_exposure_target_value = 200.f;
+	auto_exposure_max_saturated_fraction = 0.25f;
+	auto_exposure_interval_ms = 500;
+	auto_exposure_min_exposure = 8.f;
+	auto_exposure_max_exposure = 255.f;
+	auto_exposure_min_gain = 0.f;
+	auto_exposure_max_gain = 64.f;
 	exclude_opposed_cameras = false;
+	max_fused_tracker_count = 0;
+	unfused_tracker_search_interval = 4;
+	optical_time_budget_ms = 8.f;
+	overload_search_interval = 4;
+	triangulation_refinement_iterations = 2;
+	synchronize_tracker_frames = true;
+	frame_aligned_poll_window_ms = 1.5f;
 	min_valid_projection_area= 16;
+	max_sphere_fit_residual = 0.f;
 	disable_roi = false;
+	max_devices_per_tracking_color = 1;
+	reacquisition_pyramid_levels = 2;
+	use_adaptive_prediction = false;
+	adaptive_prediction_extra_time = 0.f;
+	max_adaptive_prediction_time = 0.1f;
+	suspend_idle_trackers = true;
+	tracker_suspend_delay_ms = 5000;
+	max_tracker_count = PSMOVESERVICE_MAX_TRACKER_COUNT;
 	default_tracker_profile.frame_width = 640;
 	//default_tracker_profile.frame_height = 480;
 	default_tracker_profile.frame_rate = 40;
@@ -53,13 +244,55 @@ TrackerManagerConfig::config2ptree()
 	pt.put("ignore_pose_from_one_tracker", ignore_pose_from_one_tracker);
     pt.put("optical_tracking_timeout", optical_tracking_timeout);
 	pt.put("use_bgr_to_hsv_lookup_table", use_bgr_to_hsv_lookup_table);
+	pt.put("use_quantized_bgr_to_hsv_lookup_table", use_quantized_bgr_to_hsv_lookup_table);
+	pt.put("cache_bgr_to_hsv_lookup_table", cache_bgr_to_hsv_lookup_table);
+	pt.put("use_fused_hsv_mask_kernel", use_fused_hsv_mask_kernel);
+	pt.put("use_opencl_color_mask", use_opencl_color_mask);
 	pt.put("tracker_sleep_ms", tracker_sleep_ms);
+	pt.put("sleep_until_next_device_poll", sleep_until_next_device_poll);
+	pt.put("main_thread_cpu_cores", main_thread_cpu_cores);
+	pt.put("main_thread_priority", main_thread_priority);
+	pt.put("use_vision_worker_threads", use_vision_worker_threads);
+	pt.put("use_pipelined_vision", use_pipelined_vision);
+	pt.put("use_camera_capture_threads", use_camera_capture_threads);
+	pt.put("use_roi_demosaic", use_roi_demosaic);
+	pt.put("use_bayer_cell_search", use_bayer_cell_search);
+	pt.put("use_motion_gating", use_motion_gating);
+	pt.put("motion_gate_max_pixel_difference", motion_gate_max_pixel_difference);
+	pt.put("motion_gate_max_angular_velocity", motion_gate_max_angular_velocity);
+	pt.put("motion_gate_max_reused_frames", motion_gate_max_reused_frames);
+	pt.put("use_frustum_culling", use_frustum_culling);
+	pt.put("frustum_culling_margin_cm", frustum_culling_margin_cm);
+	pt.put("use_auto_exposure", use_auto_exposure);
+	pt.put("auto_exposure_target_value", auto_exposure_target_value);
+	pt.put("auto_exposure_max_saturated_fraction", auto_exposure_max_saturated_fraction);
+	pt.put("auto_exposure_interval_ms", auto_exposure_interval_ms);
+	pt.put("auto_exposure_min_exposure", auto_exposure_min_exposure);
+	pt.put("auto_exposure_max_exposure", auto_exposure_max_exposure);
+	pt.put("auto_exposure_min_gain", auto_exposure_min_gain);
+	pt.put("auto_exposure_max_gain", auto_exposure_max_gain);
 
 	pt.put("excluded_opposed_cameras", exclude_opposed_cameras);	
+	pt.put("max_fused_tracker_count", max_fused_tracker_count);
+	pt.put("unfused_tracker_search_interval", unfused_tracker_search_interval);
+	pt.put("optical_time_budget_ms", optical_time_budget_ms);
+	pt.put("overload_search_interval", overload_search_interval);
+	pt.put("triangulation_refinement_iterations", triangulation_refinement_iterations);
+	pt.put("synchronize_tracker_frames", synchronize_tracker_frames);
+	pt.put("frame_aligned_poll_window_ms", frame_aligned_poll_window_ms);
 
 	pt.put("min_valid_projection_area", min_valid_projection_area);	
+	pt.put("max_sphere_fit_residual", max_sphere_fit_residual);
 
 	pt.put("disable_roi", disable_roi);
+	pt.put("max_devices_per_tracking_color", max_devices_per_tracking_color);
+	pt.put("reacquisition_pyramid_levels", reacquisition_pyramid_levels);
+	pt.put("use_adaptive_prediction", use_adaptive_prediction);
+	pt.put("adaptive_prediction_extra_time", adaptive_prediction_extra_time);
+	pt.put("max_adaptive_prediction_time", max_adaptive_prediction_time);
+	pt.put("suspend_idle_trackers", suspend_idle_trackers);
+	pt.put("tracker_suspend_delay_ms", tracker_suspend_delay_ms);
+	pt.put("max_tracker_count", max_tracker_count);
 
 	pt.put("default_tracker_profile.frame_width", default_tracker_profile.frame_width);
 	//pt.put("default_tracker_profile.frame_height", default_tracker_profile.frame_height);
@@ -85,10 +318,52 @@ TrackerManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
 		ignore_pose_from_one_tracker = pt.get<bool>("ignore_pose_from_one_tracker", ignore_pose_from_one_tracker);
         optical_tracking_timeout= pt.get<int>("optical_tracking_timeout", optical_tracking_timeout);
 		use_bgr_to_hsv_lookup_table = pt.get<bool>("use_bgr_to_hsv_lookup_table", use_bgr_to_hsv_lookup_table);
+		use_quantized_bgr_to_hsv_lookup_table = pt.get<bool>("use_quantized_bgr_to_hsv_lookup_table", use_quantized_bgr_to_hsv_lookup_table);
+		cache_bgr_to_hsv_lookup_table = pt.get<bool>("cache_bgr_to_hsv_lookup_table", cache_bgr_to_hsv_lookup_table);
+		use_fused_hsv_mask_kernel = pt.get<bool>("use_fused_hsv_mask_kernel", use_fused_hsv_mask_kernel);
+		use_opencl_color_mask = pt.get<bool>("use_opencl_color_mask", use_opencl_color_mask);
 		tracker_sleep_ms = pt.get<int>("tracker_sleep_ms", tracker_sleep_ms);
+		sleep_until_next_device_poll = pt.get<bool>("sleep_until_next_device_poll", sleep_until_next_device_poll);
+		main_thread_cpu_cores = pt.get<std::string>("main_thread_cpu_cores", main_thread_cpu_cores);
+		main_thread_priority = pt.get<std::string>("main_thread_priority", main_thread_priority);
+		use_vision_worker_threads = pt.get<bool>("use_vision_worker_threads", use_vision_worker_threads);
+		use_pipelined_vision = pt.get<bool>("use_pipelined_vision", use_pipelined_vision);
+		use_camera_capture_threads = pt.get<bool>("use_camera_capture_threads", use_camera_capture_threads);
+		use_roi_demosaic = pt.get<bool>("use_roi_demosaic", use_roi_demosaic);
+		use_bayer_cell_search = pt.get<bool>("use_bayer_cell_search", use_bayer_cell_search);
+		use_motion_gating = pt.get<bool>("use_motion_gating", use_motion_gating);
+		motion_gate_max_pixel_difference = pt.get<float>("motion_gate_max_pixel_difference", motion_gate_max_pixel_difference);
+		motion_gate_max_angular_velocity = pt.get<float>("motion_gate_max_angular_velocity", motion_gate_max_angular_velocity);
+		motion_gate_max_reused_frames = pt.get<int>("motion_gate_max_reused_frames", motion_gate_max_reused_frames);
+		use_frustum_culling = pt.get<bool>("use_frustum_culling", use_frustum_culling);
+		frustum_culling_margin_cm = pt.get<float>("frustum_culling_margin_cm", frustum_culling_margin_cm);
+		use_auto_exposure = pt.get<bool>("use_auto_exposure", use_auto_exposure);
+		auto_exposure_target_value = pt.get<float>("auto_exposure_target_value", auto_exposure_target_value);
+		auto_exposure_max_saturated_fraction = pt.get<float>("auto_exposure_max_saturated_fraction", auto_exposure_max_saturated_fraction);
+		auto_exposure_interval_ms = pt.get<int>("auto_exposure_interval_ms", auto_exposure_interval_ms);
+		auto_exposure_min_exposure = pt.get<float>("auto_exposure_min_exposure", auto_exposure_min_exposure);
+		auto_exposure_max_exposure = pt.get<float>("auto_exposure_max_exposure", auto_exposure_max_exposure);
+		auto_exposure_min_gain = pt.get<float>("auto_exposure_min_gain", auto_exposure_min_gain);
+		auto_exposure_max_gain = pt.get<float>("auto_exposure_max_gain", auto_exposure_max_gain);
 		exclude_opposed_cameras = pt.get<bool>("excluded_opposed_cameras", exclude_opposed_cameras);
+		max_fused_tracker_count = pt.get<int>("max_fused_tracker_count", max_fused_tracker_count);
+		unfused_tracker_search_interval = pt.get<int>("unfused_tracker_search_interval", unfused_tracker_search_interval);
+		optical_time_budget_ms = pt.get<float>("optical_time_budget_ms", optical_time_budget_ms);
+		overload_search_interval = pt.get<int>("overload_search_interval", overload_search_interval);
+		triangulation_refinement_iterations = pt.get<int>("triangulation_refinement_iterations", triangulation_refinement_iterations);
+		synchronize_tracker_frames = pt.get<bool>("synchronize_tracker_frames", synchronize_tracker_frames);
+		frame_aligned_poll_window_ms = pt.get<float>("frame_aligned_poll_window_ms", frame_aligned_poll_window_ms);
 		min_valid_projection_area = pt.get<float>("min_valid_projection_area", min_valid_projection_area);	
+		max_sphere_fit_residual = pt.get<float>("max_sphere_fit_residual", max_sphere_fit_residual);
 		disable_roi = pt.get<bool>("disable_roi", disable_roi);
+		max_devices_per_tracking_color = pt.get<int>("max_devices_per_tracking_color", max_devices_per_tracking_color);
+		reacquisition_pyramid_levels = pt.get<int>("reacquisition_pyramid_levels", reacquisition_pyramid_levels);
+		use_adaptive_prediction = pt.get<bool>("use_adaptive_prediction", use_adaptive_prediction);
+		adaptive_prediction_extra_time = pt.get<float>("adaptive_prediction_extra_time", adaptive_prediction_extra_time);
+		max_adaptive_prediction_time = pt.get<float>("max_adaptive_prediction_time", max_adaptive_prediction_time);
+		suspend_idle_trackers = pt.get<bool>("suspend_idle_trackers", suspend_idle_trackers);
+		tracker_suspend_delay_ms = pt.get<int>("tracker_suspend_delay_ms", tracker_suspend_delay_ms);
+		max_tracker_count = pt.get<int>("max_tracker_count", max_tracker_count);
 		default_tracker_profile.frame_width = pt.get<float>("default_tracker_profile.frame_width", 640);
 		//default_tracker_profile.frame_height = pt.get<float>("default_tracker_profile.frame_height", 480);
 		default_tracker_profile.frame_rate = pt.get<float>("default_tracker_profile.frame_rate", 40);
@@ -146,23 +421,46 @@ TrackerManagerConfig::get_global_down_axis() const
 //-- Tracker Manager -----
 TrackerManager::TrackerManager()
     : DeviceTypeManager(10000, 13)
+    , shared_projection_writer(nullptr)
     , m_tracker_list_dirty(false)
+    , m_bIsFramesetReady(false)
+    , m_optical_tick_time(std::chrono::high_resolution_clock::duration::zero())
+    , m_overload_end_time()
+    , m_optical_window_start_time()
+    , m_optical_window_peak_ms(0.f)
+    , m_peak_optical_tick_time_ms(0.f)
+    , m_bIsSheddingOpticalWork(false)
+    , m_over_budget_tick_count(0)
+    , m_deferred_optical_search_count(0)
+    , m_last_capture_demand_time() // Nothing needs frames yet, so the cameras stop right after they open
 {
+    m_pending_frameset.clear();
+    m_ready_frameset.clear();
+    for (int tracker_id = 0; tracker_id < k_max_devices; ++tracker_id)
+    {
+        m_bIsProjectionDeferred[tracker_id] = false;
+        m_bHasPipelinedProjection[tracker_id] = false;
+        m_frame_clocks[tracker_id].clear();
+    }
+    for (int color_index = 0; color_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++color_index)
+    {
+        m_tracking_color_user_counts[color_index] = 0;
+    }
 }
 
 bool 
 TrackerManager::startup()
 {
+    // Load any config from disk (it sizes the device table)
+    cfg.load();
+
+    // Save back out the config in case there were updated defaults
+    cfg.save();
+
     bool bSuccess = DeviceTypeManager::startup();
 
     if (bSuccess)
     {
-		// Load any config from disk
-		cfg.load();
-
-        // Save back out the config in case there were updated defaults
-        cfg.save();
-
         // Refresh the tracker list
         mark_tracker_list_dirty();
 
@@ -179,7 +477,7 @@ TrackerManager::startup()
 void
 TrackerManager::closeAllTrackers()
 {
-    for (int tracker_id = 0; tracker_id < k_max_devices; ++tracker_id)
+    for (int tracker_id = 0; tracker_id < getMaxDevices(); ++tracker_id)
     {
         ServerTrackerViewPtr tracker_view = getTrackerViewPtr(tracker_id);
 
@@ -196,6 +494,478 @@ TrackerManager::closeAllTrackers()
     send_device_list_changed_notification();
 }
 
+void
+TrackerManager::computeProjections()
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+
+    updateOpticalLoad(now);
+    updateFrameClocks();
+
+    if (!cfg.synchronize_tracker_frames)
+    {
+        // Kick off the work on every tracker with a new video frame first.
+        // Pipelined trackers hand in the results of the frame they finished since the last tick before taking the new one.
+        for (int tracker_id : getActiveDeviceIds())
+        {
+            ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+            m_bHasPipelinedProjection[tracker_id] =
+                tracker_view->getIsOpen() &&
+                tracker_view->getIsVisionPipelined() &&
+                tracker_view->pollPipelinedProjectionWork();
+
+            if (tracker_view->getIsOpen() && tracker_view->getHasUnpublishedState())
+            {
+                tracker_view->startProjectionWork();
+            }
+        }
+
+        // ...then wait for all of the others to finish
+        for (int tracker_id : getActiveDeviceIds())
+        {
+            ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+            if (tracker_view->getIsOpen() && tracker_view->getHasUnpublishedState() && !tracker_view->getIsVisionPipelined())
+            {
+                tracker_view->waitForProjectionWork();
+            }
+        }
+
+        m_optical_tick_time = std::chrono::high_resolution_clock::now() - now;
+        return;
+    }
+
+    int open_tracker_count = 0;
+    bool bHasNewFrame[k_max_devices];
+
+    for (int tracker_id = 0; tracker_id < getMaxDevices(); ++tracker_id)
+    {
+        bHasNewFrame[tracker_id] = false;
+        m_bIsProjectionDeferred[tracker_id] = false;
+    }
+
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+        const bool bIsOpen = tracker_view->getIsOpen();
+
+        bHasNewFrame[tracker_id] = bIsOpen && tracker_view->getHasUnpublishedState();
+        if (bIsOpen)
+        {
+            ++open_tracker_count;
+        }
+    }
+
+    m_ready_frameset.clear();
+    m_bIsFramesetReady = false;
+
+    // Frames from the trackers missing in the pending frameset complete it...
+    for (int tracker_id = 0; tracker_id < getMaxDevices(); ++tracker_id)
+    {
+        if (bHasNewFrame[tracker_id] && m_pending_frameset.tracker_count > 0)
+        {
+            ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+            if (m_pending_frameset.getCanAddFrame(tracker_id, tracker_view->getLastVideoFrameCaptureTimestamp()))
+            {
+                m_pending_frameset.addTracker(tracker_id, tracker_view, now);
+                tracker_view->startProjectionWork();
+                bHasNewFrame[tracker_id] = false;
+            }
+        }
+    }
+
+    // ...while any frame that doesn't fit, or waiting out the timeout, closes it incomplete
+    bool bHasUnfitFrame = false;
+    for (int tracker_id = 0; tracker_id < getMaxDevices(); ++tracker_id)
+    {
+        bHasUnfitFrame |= bHasNewFrame[tracker_id];
+    }
+
+    if (m_pending_frameset.tracker_count > 0 &&
+        (m_pending_frameset.tracker_count >= open_tracker_count ||
+         bHasUnfitFrame ||
+         now - m_pending_frameset.start_timestamp >= m_pending_frameset.timeout))
+    {
+        m_ready_frameset = m_pending_frameset;
+        m_pending_frameset.clear();
+        m_bIsFramesetReady = true;
+    }
+
+    // The remaining frames start the next frameset.
+    // A tracker whose previous frame is in the ready frameset has to wait until that got consumed,
+    // since its projection results would be overwritten otherwise.
+    for (int tracker_id = 0; tracker_id < getMaxDevices(); ++tracker_id)
+    {
+        if (bHasNewFrame[tracker_id])
+        {
+            if (m_ready_frameset.bHasTracker[tracker_id])
+            {
+                m_bIsProjectionDeferred[tracker_id] = true;
+            }
+            else
+            {
+                m_pending_frameset.addTracker(tracker_id, getTrackerView(tracker_id), now);
+                getTrackerView(tracker_id)->startProjectionWork();
+            }
+        }
+    }
+
+    // Wait for all of the started work to finish
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        if (tracker_view->getIsOpen() && tracker_view->getHasUnpublishedState() && !m_bIsProjectionDeferred[tracker_id])
+        {
+            tracker_view->waitForProjectionWork();
+        }
+    }
+
+    // A frameset that got its last frame this tick is ready right away
+    if (!m_bIsFramesetReady && m_pending_frameset.tracker_count >= open_tracker_count && open_tracker_count > 0)
+    {
+        m_ready_frameset = m_pending_frameset;
+        m_pending_frameset.clear();
+        m_bIsFramesetReady = true;
+    }
+
+    m_optical_tick_time = std::chrono::high_resolution_clock::now() - now;
+}
+
+void
+TrackerManager::finishPipelinedProjections()
+{
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        if (tracker_view->getIsVisionPipelined())
+        {
+            tracker_view->finishPipelinedProjectionWork();
+        }
+    }
+}
+
+void
+TrackerManager::finishTrackerSettingsChanges()
+{
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        getTrackerView(tracker_id)->finishSettingsChange();
+    }
+}
+
+void
+TrackerManager::computeDeferredProjections()
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+    bool bAnyDeferred = false;
+
+    for (int tracker_id = 0; tracker_id < getMaxDevices(); ++tracker_id)
+    {
+        if (m_bIsProjectionDeferred[tracker_id])
+        {
+            m_pending_frameset.addTracker(tracker_id, getTrackerView(tracker_id), now);
+            getTrackerView(tracker_id)->startProjectionWork();
+            bAnyDeferred = true;
+        }
+    }
+
+    if (bAnyDeferred)
+    {
+        for (int tracker_id = 0; tracker_id < getMaxDevices(); ++tracker_id)
+        {
+            if (m_bIsProjectionDeferred[tracker_id])
+            {
+                getTrackerView(tracker_id)->waitForProjectionWork();
+                m_bIsProjectionDeferred[tracker_id] = false;
+            }
+        }
+
+        // Counts against the budget of the tick that held the frames back
+        m_optical_tick_time += std::chrono::high_resolution_clock::now() - now;
+    }
+}
+
+void
+TrackerManager::updateOpticalLoad(const std::chrono::time_point<std::chrono::high_resolution_clock> &now)
+{
+    // Shedding keeps going this long after the last tick over budget,
+    // so a tick that fits only because searches got put off doesn't end it right away
+    static const std::chrono::milliseconds k_overload_hold_time(500);
+
+    const float tick_time_ms = std::chrono::duration<float, std::milli>(m_optical_tick_time).count();
+
+    if (cfg.optical_time_budget_ms > 0.f && tick_time_ms > cfg.optical_time_budget_ms)
+    {
+        m_overload_end_time = now + k_overload_hold_time;
+        ++m_over_budget_tick_count;
+    }
+    m_bIsSheddingOpticalWork = cfg.optical_time_budget_ms > 0.f && now < m_overload_end_time;
+    m_optical_tick_time = std::chrono::high_resolution_clock::duration::zero();
+
+    if (now - m_optical_window_start_time >= std::chrono::seconds(1))
+    {
+        m_peak_optical_tick_time_ms = m_optical_window_peak_ms;
+        m_optical_window_peak_ms = 0.f;
+        m_optical_window_start_time = now;
+    }
+    m_optical_window_peak_ms = std::max(m_optical_window_peak_ms, tick_time_ms);
+}
+
+void
+TrackerManager::updateFrameClocks()
+{
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        if (tracker_view->getIsOpen() && tracker_view->getHasUnpublishedState())
+        {
+            const double frame_rate = tracker_view->getFrameRate();
+
+            m_frame_clocks[tracker_id].addFrame(
+                tracker_view->getLastVideoFrameCaptureTimestamp(),
+                1000000.0 / ((frame_rate > 0.0) ? frame_rate : static_cast<double>(k_default_tracker_frame_rate)));
+        }
+        else if (!tracker_view->getIsOpen())
+        {
+            m_frame_clocks[tracker_id].clear();
+        }
+    }
+}
+
+std::chrono::time_point<std::chrono::high_resolution_clock>
+TrackerManager::alignPollDeadlineToFrames(
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &now,
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &poll_deadline) const
+{
+    if (cfg.frame_aligned_poll_window_ms <= 0.f ||
+        poll_deadline == std::chrono::time_point<std::chrono::high_resolution_clock>::max())
+    {
+        return poll_deadline;
+    }
+
+    const std::chrono::high_resolution_clock::duration window =
+        std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+            std::chrono::duration<float, std::milli>(cfg.frame_aligned_poll_window_ms));
+    std::chrono::time_point<std::chrono::high_resolution_clock> next_frame_time =
+        std::chrono::time_point<std::chrono::high_resolution_clock>::max();
+
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        if (getTrackerView(tracker_id)->getIsOpen())
+        {
+            next_frame_time = std::min(next_frame_time, m_frame_clocks[tracker_id].getNextFrameTime(now));
+        }
+    }
+
+    // The frame's arrival wakes the main loop, the deadline only matters if the frame is late.
+    // A frame running late past the expected time doesn't hold the polls up any further.
+    if (next_frame_time != std::chrono::time_point<std::chrono::high_resolution_clock>::max() &&
+        poll_deadline < next_frame_time &&
+        next_frame_time - poll_deadline <= window)
+    {
+        return next_frame_time;
+    }
+
+    return poll_deadline;
+}
+
+void
+TrackerManager::sendCameraNodeProjections()
+{
+    const CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+
+    if (camera_node_link == nullptr || !camera_node_link->getIsNode())
+    {
+        return;
+    }
+
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        if (tracker_view->getIsOpen() && getIsTrackerInFrameset(tracker_id))
+        {
+            tracker_view->sendCameraNodeProjections();
+        }
+    }
+}
+
+void
+TrackerManager::publishSharedProjections()
+{
+    if (shared_projection_writer == nullptr)
+    {
+        return;
+    }
+
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        // Only the trackers with new results this tick, so every published frame is a new video frame
+        if (tracker_view->getIsOpen() && getIsTrackerInFrameset(tracker_id))
+        {
+            tracker_view->writeSharedProjections(shared_projection_writer);
+        }
+    }
+}
+
+void
+TrackerManager::updateCaptureSuspension()
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+    const CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+
+    // A camera node's cameras serve the jobs of its host
+    if (!cfg.suspend_idle_trackers ||
+        (camera_node_link != nullptr && camera_node_link->getIsNode()) ||
+        getHasCaptureDemand())
+    {
+        m_last_capture_demand_time = now;
+    }
+
+    const bool bWantsSuspend =
+        (now - m_last_capture_demand_time) >= std::chrono::milliseconds(cfg.tracker_suspend_delay_ms);
+
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        // Cameras that can't stop their stream just keep capturing
+        if (tracker_view->getIsOpen() && tracker_view->getIsCaptureSuspended() != bWantsSuspend)
+        {
+            tracker_view->setCaptureSuspended(bWantsSuspend);
+        }
+    }
+}
+
+bool
+TrackerManager::getHasCaptureDemand() const
+{
+    const DeviceManager *device_manager = DeviceManager::getInstance();
+
+    for (int tracker_id : getActiveDeviceIds())
+    {
+        const ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        if (tracker_view->getIsOpen() && tracker_view->getHasActiveVideoStream())
+        {
+            return true;
+        }
+    }
+
+    for (int controller_id : device_manager->m_controller_manager->getActiveDeviceIds())
+    {
+        const ServerControllerView *controller_view = device_manager->m_controller_manager->getControllerView(controller_id);
+
+        if (controller_view->getIsOpen() && controller_view->getIsTrackingEnabled())
+        {
+            return true;
+        }
+    }
+
+    for (int hmd_id : device_manager->m_hmd_manager->getActiveDeviceIds())
+    {
+        const ServerHMDView *hmd_view = device_manager->m_hmd_manager->getHMDView(hmd_id);
+
+        if (hmd_view->getIsOpen() && hmd_view->getIsTrackingEnabled())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void
+TrackerManager::handleRemoteCameraListChanged()
+{
+    // Remote cameras come and go without a hotplug event
+    mark_tracker_list_dirty();
+    m_bIsDeviceListDirty = true;
+}
+
+bool
+TrackerManager::getIsTrackerInFrameset(int tracker_id) const
+{
+    if (!cfg.synchronize_tracker_frames)
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        return tracker_view->getIsVisionPipelined()
+            ? m_bHasPipelinedProjection[tracker_id]
+            : tracker_view->getHasUnpublishedState();
+    }
+
+    return m_bIsFramesetReady && m_ready_frameset.bHasTracker[tracker_id];
+}
+
+std::chrono::time_point<std::chrono::high_resolution_clock>
+TrackerManager::getTrackerFrameCaptureTimestamp(int tracker_id) const
+{
+    // The tracker's latest frame may already belong to the next frameset
+    if (cfg.synchronize_tracker_frames && m_bIsFramesetReady && m_ready_frameset.bHasTracker[tracker_id])
+    {
+        return m_ready_frameset.tracker_capture_timestamps[tracker_id];
+    }
+
+    return getTrackerView(tracker_id)->getProjectionResultCaptureTimestamp();
+}
+
+int
+TrackerManager::getTrackerFrameDropCount(int tracker_id) const
+{
+    if (cfg.synchronize_tracker_frames && m_bIsFramesetReady && m_ready_frameset.bHasTracker[tracker_id])
+    {
+        return m_ready_frameset.tracker_frame_drop_counts[tracker_id];
+    }
+
+    return getTrackerView(tracker_id)->getProjectionResultFrameDropCount();
+}
+
+float
+TrackerManager::computeFusionScore(const CommonDevicePosition &tracker_relative_position_cm, float projection_area)
+{
+    const float distance_cm = sqrtf(
+        tracker_relative_position_cm.x*tracker_relative_position_cm.x +
+        tracker_relative_position_cm.y*tracker_relative_position_cm.y +
+        tracker_relative_position_cm.z*tracker_relative_position_cm.z);
+
+    // Devices right on top of the camera (or without a position) are scored by area alone
+    if (distance_cm < 1.f)
+    {
+        return projection_area;
+    }
+
+    // Cosine of the angle between the optical axis and the direction to the device,
+    // grazing views near the edge of the frame are the most distorted
+    const float cos_off_axis = std::max(tracker_relative_position_cm.z / distance_cm, 0.f);
+
+    // The area already falls off with the square of the distance,
+    // the extra falloff favors the closer of two similar views since its depth estimate is better
+    return projection_area*cos_off_axis / (distance_cm / 100.f);
+}
+
+int
+TrackerManager::selectFusedTrackers(int *tracker_ids, int tracker_count, const float *fusion_scores) const
+{
+    if (cfg.max_fused_tracker_count <= 0 || tracker_count <= cfg.max_fused_tracker_count)
+    {
+        return tracker_count;
+    }
+
+    std::partial_sort(
+        tracker_ids, tracker_ids + cfg.max_fused_tracker_count, tracker_ids + tracker_count,
+        [fusion_scores](int a, int b) { return fusion_scores[a] > fusion_scores[b]; });
+
+    return cfg.max_fused_tracker_count;
+}
+
 bool
 TrackerManager::can_update_connected_devices()
 {
@@ -211,13 +981,19 @@ TrackerManager::mark_tracker_list_dirty()
 DeviceEnumerator *
 TrackerManager::allocate_device_enumerator()
 {
+    // Replays only ever see the cameras that were recorded
+    if (DeviceInputLog::get_mode() == DeviceInputLogMode_Replaying)
+    {
+        return new InputLogTrackerEnumerator;
+    }
+
     return new TrackerDeviceEnumerator;
 }
 
 void
 TrackerManager::free_device_enumerator(DeviceEnumerator *enumerator)
 {
-    delete static_cast<TrackerDeviceEnumerator *>(enumerator);
+    delete enumerator;
 
     // Tracker list is no longer dirty after we have iterated through the list of cameras
     m_tracker_list_dirty = false;
@@ -232,11 +1008,25 @@ TrackerManager::allocate_device_view(int device_id)
 ServerTrackerViewPtr
 TrackerManager::getTrackerViewPtr(int device_id) const
 {
-    assert(m_deviceViews != nullptr);
+    assert(ServerUtility::is_index_valid(device_id, getMaxDevices()));
 
     return std::static_pointer_cast<ServerTrackerView>(m_deviceViews[device_id]);
 }
 
+ServerTrackerView *
+TrackerManager::getTrackerView(int device_id) const
+{
+    assert(ServerUtility::is_index_valid(device_id, getMaxDevices()));
+
+    return static_cast<ServerTrackerView *>(getDeviceView(device_id));
+}
+
+int
+TrackerManager::get_configured_max_devices() const
+{
+    return std::max(std::min(cfg.max_tracker_count, TrackerManager::k_max_devices), 1);
+}
+
 int TrackerManager::getListUpdatedResponseType()
 {
 	return PSMoveProtocol::Response_ResponseType_TRACKER_LIST_UPDATED;
@@ -245,10 +1035,41 @@ int TrackerManager::getListUpdatedResponseType()
 eCommonTrackingColorID 
 TrackerManager::allocateTrackingColorID()
 {
-    assert(m_available_color_ids.size() > 0);
+    invalidateTrackingColorPresets();
+
+    // With more device slots than tracking colors the pool can run dry.
+    // Then the least used color gets shared if the config allows it,
+    // otherwise the device just doesn't get optically tracked.
+    if (m_available_color_ids.empty())
+    {
+        int shared_color_index = -1;
+
+        for (int color_index = 0; color_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++color_index)
+        {
+            const int user_count = m_tracking_color_user_counts[color_index];
+
+            if (user_count < cfg.max_devices_per_tracking_color &&
+                (shared_color_index < 0 || user_count < m_tracking_color_user_counts[shared_color_index]))
+            {
+                shared_color_index = color_index;
+            }
+        }
+
+        if (shared_color_index < 0)
+        {
+            SERVER_LOG_WARNING("TrackerManager::allocateTrackingColorID") << "All tracking colors are in use";
+            return eCommonTrackingColorID::INVALID_COLOR;
+        }
+
+        ++m_tracking_color_user_counts[shared_color_index];
+
+        return static_cast<eCommonTrackingColorID>(shared_color_index);
+    }
+
     eCommonTrackingColorID tracking_color = m_available_color_ids.front();
 
     m_available_color_ids.pop_front();
+    ++m_tracking_color_user_counts[tracking_color];
 
     return tracking_color;
 }
@@ -256,6 +1077,8 @@ TrackerManager::allocateTrackingColorID()
 bool 
 TrackerManager::claimTrackingColorID(const ServerControllerView *claiming_controller_view, eCommonTrackingColorID color_id)
 {
+    invalidateTrackingColorPresets();
+
     bool bColorWasInUse = false;
     bool bSuccess= true;
 
@@ -315,6 +1138,8 @@ TrackerManager::claimTrackingColorID(const ServerControllerView *claiming_contro
                 break;
             }
         }
+
+        ++m_tracking_color_user_counts[color_id];
     }
 
     return bSuccess;
@@ -323,6 +1148,8 @@ TrackerManager::claimTrackingColorID(const ServerControllerView *claiming_contro
 bool 
 TrackerManager::claimTrackingColorID(const ServerHMDView *claiming_hmd_view, eCommonTrackingColorID color_id)
 {
+    invalidateTrackingColorPresets();
+
     bool bColorWasInUse = false;
     bool bSuccess= true;
 
@@ -382,6 +1209,8 @@ TrackerManager::claimTrackingColorID(const ServerHMDView *claiming_hmd_view, eCo
                 break;
             }
         }
+
+        ++m_tracking_color_user_counts[color_id];
     }
 
     return bSuccess;
@@ -390,6 +1219,36 @@ TrackerManager::claimTrackingColorID(const ServerHMDView *claiming_hmd_view, eCo
 void 
 TrackerManager::freeTrackingColorID(eCommonTrackingColorID color_id)
 {
+    invalidateTrackingColorPresets();
+
+    if (color_id == eCommonTrackingColorID::INVALID_COLOR)
+    {
+        return;
+    }
+
+    // Shared colors only go back in the queue once the last device lets go of them
+    assert(m_tracking_color_user_counts[color_id] > 0);
+    if (--m_tracking_color_user_counts[color_id] > 0)
+    {
+        return;
+    }
+
     assert(std::find(m_available_color_ids.begin(), m_available_color_ids.end(), color_id) == m_available_color_ids.end());
     m_available_color_ids.push_back(color_id);
 }
+
+void
+TrackerManager::invalidateTrackingColorPresets()
+{
+    // Every color (re)assignment comes through here, including a device opening in a slot another one left,
+    // so the trackers look the presets up again by the device's config identifier
+    for (int tracker_id = 0; tracker_id < getMaxDevices(); ++tracker_id)
+    {
+        ServerTrackerView *tracker_view = getTrackerView(tracker_id);
+
+        if (tracker_view != nullptr)
+        {
+            tracker_view->invalidateTrackingColorPresets();
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #define TRACKER_MANAGER_H
 
 //-- includes -----
+#include <chrono>
 #include <memory>
 #include <deque>
 #include "DeviceTypeManager.h"
@@ -9,12 +10,53 @@
 #include "DeviceInterface.h"
 #include "PSMoveConfig.h"
 
+//-- constants -----
+// Most tracker slots TrackerManagerConfig::max_tracker_count can ask for
+#define TRACKER_MANAGER_MAX_DEVICES 16
+
 //-- typedefs -----
 
 class ServerTrackerView;
 typedef std::shared_ptr<ServerTrackerView> ServerTrackerViewPtr;
 
 //-- definitions -----
+/// The video frames of each tracker that were captured at (about) the same time
+struct TrackerFrameset
+{
+	bool bHasTracker[TRACKER_MANAGER_MAX_DEVICES];
+	std::chrono::time_point<std::chrono::high_resolution_clock> tracker_capture_timestamps[TRACKER_MANAGER_MAX_DEVICES];
+	// Frames each tracker dropped right before its frame in the frameset
+	int tracker_frame_drop_counts[TRACKER_MANAGER_MAX_DEVICES];
+	int tracker_count;
+	// Capture time of the first frame in the frameset
+	std::chrono::time_point<std::chrono::high_resolution_clock> capture_timestamp;
+	// When the first frame in the frameset arrived
+	std::chrono::time_point<std::chrono::high_resolution_clock> start_timestamp;
+	// Frames captured more than this far apart from the first frame belong to another frameset
+	std::chrono::microseconds sync_window;
+	// Stop waiting for the missing frames once the frameset is this old
+	std::chrono::microseconds timeout;
+
+	void clear();
+	void addTracker(int tracker_id, const class ServerTrackerView *tracker_view, const std::chrono::time_point<std::chrono::high_resolution_clock> &now);
+	bool getCanAddFrame(int tracker_id, const std::chrono::time_point<std::chrono::high_resolution_clock> &frame_capture_timestamp) const;
+};
+
+/// Learns when a tracker's next video frame is due from the capture times of its last frames
+struct TrackerFrameClock
+{
+	std::chrono::time_point<std::chrono::high_resolution_clock> last_capture_timestamp;
+	// Smoothed frame period, starts out at the tracker's nominal frame rate
+	double frame_period_us;
+	// Frame intervals in a row that fit the period (the prediction is only used once enough of them did)
+	int consistent_frame_count;
+
+	void clear();
+	void addFrame(const std::chrono::time_point<std::chrono::high_resolution_clock> &capture_timestamp, double nominal_frame_period_us);
+	// When the next frame should show up, time_point::max() while the clock isn't locked onto the frames
+	std::chrono::time_point<std::chrono::high_resolution_clock> getNextFrameTime(const std::chrono::time_point<std::chrono::high_resolution_clock> &now) const;
+};
+
 struct TrackerProfile
 {
 	float frame_width;
@@ -54,10 +96,101 @@ public:
     long version;
     int optical_tracking_timeout;
 	int tracker_sleep_ms;
+	// Sleep the main loop until the next device poll is due (or new data arrives) instead of for tracker_sleep_ms
+	bool sleep_until_next_device_poll;
+	// Cores the main service loop is pinned to, ex) "1" (empty = any core)
+	std::string main_thread_cpu_cores;
+	// Scheduling class of the main service loop: "normal", "high" or "realtime"
+	std::string main_thread_priority;
 	bool use_bgr_to_hsv_lookup_table;
+	// Index the BGR->HSV lookup table with 5-6-5 bit colors (192KB table instead of 48MB, slightly less accurate)
+	bool use_quantized_bgr_to_hsv_lookup_table;
+	// Memory map the BGR->HSV lookup table from a file in the config directory instead of rebuilding it every start
+	bool cache_bgr_to_hsv_lookup_table;
+	bool use_fused_hsv_mask_kernel;
+	// Demosaic, convert to HSV and threshold the video frames with OpenCL (OpenCV's transparent API),
+	// reading back only the color masks of the ROIs. Falls back to the CPU path without an OpenCL device.
+	bool use_opencl_color_mask;
+	bool use_vision_worker_threads;
+	// Let the vision worker search a tracker's frame while the main loop fuses the results of the frame before,
+	// instead of waiting for the search every tick. Costs a frame of optical latency.
+	// Needs use_vision_worker_threads and is ignored with synchronize_tracker_frames.
+	bool use_pipelined_vision;
+	// Grab and debayer the camera frames on a capture thread per tracker.
+	// The main loop only picks up the newest finished frame, so camera I/O never holds up the device polls.
+	bool use_camera_capture_threads;
+	bool use_roi_demosaic;
+	// With raw Bayer frames, build the coarse reacquisition image straight from the 2x2 Bayer cells
+	// instead of demosaicing the whole frame first. Best when every tracked color has a well separated hue.
+	bool use_bayer_cell_search;
+	// Reuse a device's last projection while its gyro reads still and the pixels around it
+	// haven't changed since that projection got computed (mean absolute difference of a
+	// downsampled copy of the region, in 8-bit intensity steps).
+	// The projection gets recomputed at least every motion_gate_max_reused_frames frames.
+	bool use_motion_gating;
+	float motion_gate_max_pixel_difference;
+	float motion_gate_max_angular_velocity; // radians/s
+	int motion_gate_max_reused_frames;
+	// Don't search a tracker's frames for a device that this tracker lost and whose predicted position
+	// lies outside of the tracker's frustum (FOV and z range) grown by frustum_culling_margin_cm.
+	// Devices no camera sees right now (no trustworthy position) are always searched for.
+	bool use_frustum_culling;
+	float frustum_culling_margin_cm;
+	// Steer every tracker's exposure and gain within the bounds below so that the tracked blobs stay
+	// around auto_exposure_target_value (8-bit brightness) with at most auto_exposure_max_saturated_fraction
+	// of their pixels clipped. Adjusts every auto_exposure_interval_ms and leaves the tracker configs alone.
+	bool use_auto_exposure;
+	float auto_exposure_target_value;
+	float auto_exposure_max_saturated_fraction;
+	int auto_exposure_interval_ms;
+	float auto_exposure_min_exposure;
+	float auto_exposure_max_exposure;
+	float auto_exposure_min_gain;
+	float auto_exposure_max_gain;
 	bool exclude_opposed_cameras;
+	// Only fuse the max_fused_tracker_count trackers with the best view of a device (0 fuses all of them),
+	// see TrackerManager::computeFusionScore(). The other trackers only search for the device once every
+	// unfused_tracker_search_interval frames, often enough to take over when their view gets better.
+	int max_fused_tracker_count;
+	int unfused_tracker_search_interval;
+	// Main thread time a tick may spend on optical work (starting and waiting for the blob searches, 0 = no budget).
+	// Once a tick goes over it, the devices a tracker lost only get searched for every overload_search_interval
+	// frames until no tick went over for a while, and so do the low priority devices it still tracks.
+	// High priority devices (the HMDs by default, see eCommonVisionPriority), the IMU updates and the publish always run.
+	float optical_time_budget_ms;
+	int overload_search_interval;
+	// Gauss-Newton reprojection steps run after the linear multi-camera triangulation (0 = linear only)
+	int triangulation_refinement_iterations;
+	// Group the video frames of all trackers into framesets by capture time and only solve multi-camera poses per frameset
+	bool synchronize_tracker_frames;
+	// Controller and HMD polls due less than this long before a tracker's next video frame is expected
+	// get put off until the frame arrives, so the frame doesn't wait behind an IMU only tick and both
+	// share one tick (0 = poll on the device schedule only)
+	float frame_aligned_poll_window_ms;
 	float min_valid_projection_area;
+	// Sphere projections whose fit residual is above this are dropped (<= 0 keeps every fit)
+	float max_sphere_fit_residual;
 	bool disable_roi;
+	// Once every tracking color is taken, let up to this many devices share a color (1 never shares).
+	// Devices sharing a color get told apart by where their pose filters predict them in each video frame.
+	int max_devices_per_tracking_color;
+	// Number of half resolution steps in the pyramid lost devices are searched for in first (0 searches the full resolution frame, max 2)
+	int reacquisition_pyramid_levels;
+	// Predict streamed poses ahead by the measured capture to publish latency of each device
+	// instead of the prediction_time in the device config
+	bool use_adaptive_prediction;
+	// Added to the measured latency for the part of the path the service can't see (transport, client)
+	// when the stream has no display target
+	float adaptive_prediction_extra_time; // seconds
+	float max_adaptive_prediction_time; // seconds
+	// Stop the camera streams while no controller or HMD is optically tracked and no client watches
+	// a video stream, once that has been the case for tracker_suspend_delay_ms.
+	// Trackers still open (and show up in the tracker list), they just don't capture until needed again.
+	bool suspend_idle_trackers;
+	int tracker_suspend_delay_ms;
+	// Number of tracker slots (1 to TrackerManager::k_max_devices).
+	// Clients only see the first PSMOVESERVICE_MAX_TRACKER_COUNT of them.
+	int max_tracker_count;
     TrackerProfile default_tracker_profile;
 	float global_forward_degrees;
 
@@ -78,13 +211,100 @@ public:
 
     void closeAllTrackers();
 
-    static const int k_max_devices = PSMOVESERVICE_MAX_TRACKER_COUNT;
-    int getMaxDevices() const override
+    /// Search every tracker that got a new video frame this tick for tracked controllers and HMDs.
+    /// The trackers process their frames in parallel on their vision worker threads.
+    /// Trackers with pipelined vision don't get waited on: their results come from the last frame that finished.
+    /// With synchronize_tracker_frames on, the frames also get grouped into framesets and
+    /// a frameset becomes ready once every open tracker contributed a frame or it timed out.
+    void computeProjections();
+
+    /// Block until every tracker with pipelined vision (see TrackerManagerConfig::use_pipelined_vision)
+    /// has finished the frame it is working on. Call before touching tracker buffers or cameras outside of the tick.
+    void finishPipelinedProjections();
+
+    /// Block until every tracker has swapped in the settings change it has in flight (see ServerTrackerView::startSettingsChange()).
+    /// Call before touching tracker cameras or their configs outside of the tick.
+    void finishTrackerSettingsChanges();
+
+    /// Process the frames held back by computeProjections() because their tracker's previous frame
+    /// is part of the frameset that was ready this tick. Call once the controllers and HMDs consumed it.
+    void computeDeferredProjections();
+
+    /// Moves a controller or HMD poll deadline that falls just ahead of the next expected video frame
+    /// onto that frame (see TrackerManagerConfig::frame_aligned_poll_window_ms)
+    std::chrono::time_point<std::chrono::high_resolution_clock> alignPollDeadlineToFrames(
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &now,
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &poll_deadline) const;
+
+    /// Camera nodes only (see CameraNodeLink): send the projections of every tracker in this tick's frameset to the host
+    void sendCameraNodeProjections();
+
+    /// Write the search regions and projections of every tracker in this tick's frameset into shared_projection_writer
+    void publishSharedProjections();
+
+    /// Stop or restart the camera streams depending on whether anything needs video frames,
+    /// see TrackerManagerConfig::suspend_idle_trackers. Called by DeviceManager::update() before the device polls.
+    void updateCaptureSuspension();
+
+    /// Called by the CameraNodeLink when a camera node's camera starts or stops sending projections
+    void handleRemoteCameraListChanged();
+
+    /// True if the controllers and HMDs should solve their multi-camera poses this tick.
+    /// Always true without synchronize_tracker_frames.
+    inline bool getIsFramesetReady() const
+    {
+        return !cfg.synchronize_tracker_frames || m_bIsFramesetReady;
+    }
+
+    /// True while recent ticks went over optical_time_budget_ms,
+    /// the trackers then put off searching for the lower priority devices (see TrackerManagerConfig)
+    inline bool getIsSheddingOpticalWork() const
     {
-        return TrackerManager::k_max_devices;
+        return m_bIsSheddingOpticalWork;
     }
 
+    /// Called by a tracker that put off a controller search because of the shedding
+    inline void addDeferredOpticalSearch()
+    {
+        ++m_deferred_optical_search_count;
+    }
+
+    /// Overload counters since startup for the service stats
+    inline long long getOverBudgetTickCount() const { return m_over_budget_tick_count; }
+    inline long long getDeferredOpticalSearchCount() const { return m_deferred_optical_search_count; }
+    /// Most main thread time a tick spent on optical work in the last completed one second window
+    inline float getPeakOpticalTickTimeMs() const { return m_peak_optical_tick_time_ms; }
+
+    /// True if the given tracker has a new projection result for the multi-camera solve this tick
+    bool getIsTrackerInFrameset(int tracker_id) const;
+
+    /// Capture time of the video frame the tracker's current projection result came from
+    std::chrono::time_point<std::chrono::high_resolution_clock> getTrackerFrameCaptureTimestamp(int tracker_id) const;
+
+    /// Frames the tracker dropped right before the video frame its current projection result came from
+    int getTrackerFrameDropCount(int tracker_id) const;
+
+    /// How much a tracker's view of a device is worth to the multi-camera fusion (bigger is better):
+    /// the projection area, scaled down the further the device sits from the camera and from its optical axis
+    static float computeFusionScore(const CommonDevicePosition &tracker_relative_position_cm, float projection_area);
+
+    /// Sorts the tracker ids by descending fusion score (indexed by tracker id)
+    /// and returns how many of them to fuse (at most max_fused_tracker_count)
+    int selectFusedTrackers(int *tracker_ids, int tracker_count, const float *fusion_scores) const;
+
+    /// Run the task for every tracker id on the device update thread pool and wait for all of them.
+    /// Only call between ticks, while no projection work is in flight.
+    inline void runTrackerTasksAndWait(const std::function<void(int tracker_id)> &tracker_task)
+    {
+        run_device_tasks_and_wait(tracker_task);
+    }
+
+    /// Most tracker slots the config can ask for, sizes the per-device scratch arrays
+    static const int k_max_devices = TRACKER_MANAGER_MAX_DEVICES;
+
     ServerTrackerViewPtr getTrackerViewPtr(int device_id) const;
+    /// No ref counting, for the per-tick loops over getActiveDeviceIds()
+    ServerTrackerView *getTrackerView(int device_id) const;
 
     inline void saveDefaultTrackerProfile(const TrackerProfile *profile)
     {
@@ -107,6 +327,9 @@ public:
     bool claimTrackingColorID(const class ServerHMDView *hmd_view, eCommonTrackingColorID color_id);
     void freeTrackingColorID(eCommonTrackingColorID color_id);
 
+    /// Shared memory projection export for debug tools (owned by the DeviceManager, null when disabled)
+    class SharedTrackerProjectionWriter *shared_projection_writer;
+
 protected:
     bool can_update_connected_devices() override;
     void mark_tracker_list_dirty();
@@ -114,12 +337,48 @@ protected:
     DeviceEnumerator *allocate_device_enumerator() override;
     void free_device_enumerator(DeviceEnumerator *) override;
     ServerDeviceView *allocate_device_view(int device_id) override;
+    int get_configured_max_devices() const override;
 	int getListUpdatedResponseType() override;
 
 private:
+    // True if any device is optically tracked or any client watches a tracker's video stream
+    bool getHasCaptureDemand() const;
+    // Drops the color presets every tracker resolved for the controllers and HMDs
+    void invalidateTrackingColorPresets();
+    // Checks the optical time of the last tick against the budget, at the start of computeProjections()
+    void updateOpticalLoad(const std::chrono::time_point<std::chrono::high_resolution_clock> &now);
+    // Feeds the capture times of this tick's new video frames to the frame clocks
+    void updateFrameClocks();
+
     std::deque<eCommonTrackingColorID> m_available_color_ids;
+    int m_tracking_color_user_counts[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES]; // devices using each color
     TrackerManagerConfig cfg;
     bool m_tracker_list_dirty;
+
+    // Frameset synchronization state (main thread only)
+    TrackerFrameset m_pending_frameset;
+    TrackerFrameset m_ready_frameset;
+    bool m_bIsFramesetReady;
+    bool m_bIsProjectionDeferred[k_max_devices];
+
+    // Frame phase of each tracker (main thread only, see alignPollDeadlineToFrames())
+    TrackerFrameClock m_frame_clocks[k_max_devices];
+
+    // Trackers with pipelined vision whose work on an earlier frame got retired this tick (main thread only)
+    bool m_bHasPipelinedProjection[k_max_devices];
+
+    // Optical time budget state (main thread only, see updateOpticalLoad())
+    std::chrono::high_resolution_clock::duration m_optical_tick_time;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_overload_end_time;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_optical_window_start_time;
+    float m_optical_window_peak_ms;
+    float m_peak_optical_tick_time_ms;
+    bool m_bIsSheddingOpticalWork;
+    long long m_over_budget_tick_count;
+    long long m_deferred_optical_search_count;
+
+    // Last tick anything needed video frames (see updateCaptureSuspension())
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_capture_demand_time;
 };
 
 #endif // TRACKER_MANAGER_H
\ No newline at end of file
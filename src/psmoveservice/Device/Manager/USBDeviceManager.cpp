@@ -5,13 +5,20 @@
 #include "LibUSBBulkTransferBundle.h"
 #include "LibUSBApi.h"
 #include "NullUSBApi.h"
+#ifdef _WIN32
+#include "WinUSBApi.h"
+#endif // _WIN32
 #include "ServerLog.h"
+#include "ServerTrace.h"
 #include "ServerUtility.h"
+#include "WakeupSignal.h"
 
 #include <atomic>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include <map>
+#include <string.h>
 
 #include <boost/lockfree/spsc_queue.hpp>
 
@@ -25,8 +32,132 @@ const char * k_nullusb_api_name= "nullusb_api";
 const char * k_libusb_api_name= "libusb_api";
 const char * k_winusb_api_name= "winusb_api";
 
+// Capacity of the lock-free queues between the main thread and the USB worker thread
+const int k_max_usb_request_queue_size= 128;
+const int k_max_usb_result_queue_size= 128;
+
+// Number of queue entries popped at once when draining a queue
+const int k_usb_queue_drain_batch_size= 16;
+
+// How often the worker thread copies the bulk transfer counters out for the main thread
+const long long k_bulk_statistics_publish_interval_us= 250 * 1000;
+
 //-- private implementation -----
 
+//-- USB Transfer Statistics -----
+/// Running transfer totals of one USB device
+struct USBDeviceTransferCounters
+{
+	uint64_t transfer_count;
+	uint64_t byte_count;
+	uint64_t error_count;
+	uint64_t latency_histogram[USB_LATENCY_HISTOGRAM_BUCKET_COUNT];
+
+	void clear()
+	{
+		memset(this, 0, sizeof(USBDeviceTransferCounters));
+	}
+
+	void recordTransfer(int transfer_byte_count, long long latency_us)
+	{
+		++transfer_count;
+		byte_count+= transfer_byte_count;
+		++latency_histogram[usb_latency_histogram_bucket_index(latency_us > 0 ? static_cast<uint64_t>(latency_us) : 0)];
+	}
+
+	void add(const USBDeviceTransferCounters &other)
+	{
+		transfer_count+= other.transfer_count;
+		byte_count+= other.byte_count;
+		error_count+= other.error_count;
+
+		for (int bucket_index= 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+		{
+			latency_histogram[bucket_index]+= other.latency_histogram[bucket_index];
+		}
+	}
+
+	void add(const USBBulkTransferStatistics &bulk_statistics)
+	{
+		transfer_count+= bulk_statistics.completed_transfer_count;
+		byte_count+= bulk_statistics.completed_byte_count;
+		error_count+= bulk_statistics.dropped_payload_count;
+
+		for (int bucket_index= 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+		{
+			latency_histogram[bucket_index]+= bulk_statistics.completion_latency_histogram[bucket_index];
+		}
+	}
+
+	// Assumes other is an earlier snapshot of the same totals
+	void subtract(const USBDeviceTransferCounters &other)
+	{
+		transfer_count-= other.transfer_count;
+		byte_count-= other.byte_count;
+		error_count-= other.error_count;
+
+		for (int bucket_index= 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+		{
+			latency_histogram[bucket_index]-= other.latency_histogram[bucket_index];
+		}
+	}
+
+	// Interpolates the given percentile [0, 1] inside the histogram bucket it falls in
+	float computeLatencyPercentileMs(float percentile) const
+	{
+		uint64_t sample_count= 0;
+		for (int bucket_index= 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+		{
+			sample_count+= latency_histogram[bucket_index];
+		}
+
+		float latency_ms= 0.f;
+		if (sample_count > 0)
+		{
+			const double target_count= static_cast<double>(percentile) * static_cast<double>(sample_count);
+			uint64_t cumulative_count= 0;
+
+			for (int bucket_index= 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+			{
+				const uint64_t bucket_count= latency_histogram[bucket_index];
+
+				if (bucket_count > 0 && static_cast<double>(cumulative_count + bucket_count) >= target_count)
+				{
+					const double lower_us= (bucket_index > 0) ? static_cast<double>(1ull << bucket_index) : 0.0;
+					const double upper_us= static_cast<double>(1ull << (bucket_index + 1));
+					const double fraction= (target_count - static_cast<double>(cumulative_count)) / static_cast<double>(bucket_count);
+
+					latency_ms= static_cast<float>((lower_us + fraction*(upper_us - lower_us)) / 1000.0);
+					break;
+				}
+
+				cumulative_count+= bucket_count;
+			}
+		}
+
+		return latency_ms;
+	}
+};
+
+/// Main thread statistics bookkeeping of one open USB device
+struct USBDeviceStatisticsState
+{
+	// Control and interrupt transfer results
+	USBDeviceTransferCounters request_counters;
+	// request_counters + bulk transfer counters when the current window started
+	USBDeviceTransferCounters window_start_totals;
+	// Results of the last completed window
+	USBDeviceTransferStatistics window_statistics;
+
+	void clear(t_usb_device_handle handle)
+	{
+		request_counters.clear();
+		window_start_totals.clear();
+		memset(&window_statistics, 0, sizeof(USBDeviceTransferStatistics));
+		window_statistics.usb_device_handle= handle;
+	}
+};
+
 //-- USB Manager Config -----
 const int USBManagerConfig::CONFIG_VERSION = 1;
 
@@ -35,6 +166,11 @@ USBManagerConfig::USBManagerConfig(const std::string &fnamebase)
 {
 	usb_api_name= k_libusb_api_name;
 	enable_usb_transfers= true;
+	bulk_transfer_in_flight_count= 0;
+	transfer_statistics_window_seconds= 10.f;
+	log_transfer_statistics= true;
+	usb_thread_cpu_cores= "";
+	usb_thread_priority= "normal";
 };
 
 const boost::property_tree::ptree
@@ -45,6 +181,11 @@ USBManagerConfig::config2ptree()
     pt.put("version", USBManagerConfig::CONFIG_VERSION);
 	pt.put("usb_api", usb_api_name);
 	pt.put("enable_usb_transfers", enable_usb_transfers);
+	pt.put("bulk_transfer_in_flight_count", bulk_transfer_in_flight_count);
+	pt.put("transfer_statistics_window_seconds", transfer_statistics_window_seconds);
+	pt.put("log_transfer_statistics", log_transfer_statistics);
+	pt.put("usb_thread_cpu_cores", usb_thread_cpu_cores);
+	pt.put("usb_thread_priority", usb_thread_priority);
 
     return pt;
 }
@@ -58,6 +199,11 @@ USBManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
     {
 		usb_api_name = pt.get<std::string>("usb_api", usb_api_name);
 		enable_usb_transfers = pt.get<bool>("enable_usb_transfers", enable_usb_transfers);
+		bulk_transfer_in_flight_count = pt.get<int>("bulk_transfer_in_flight_count", bulk_transfer_in_flight_count);
+		transfer_statistics_window_seconds = pt.get<float>("transfer_statistics_window_seconds", transfer_statistics_window_seconds);
+		log_transfer_statistics = pt.get<bool>("log_transfer_statistics", log_transfer_statistics);
+		usb_thread_cpu_cores = pt.get<std::string>("usb_thread_cpu_cores", usb_thread_cpu_cores);
+		usb_thread_priority = pt.get<std::string>("usb_thread_priority", usb_thread_priority);
     }
     else
     {
@@ -79,6 +225,11 @@ public:
         , m_active_control_transfers(0)
 		, m_active_interrupt_transfers(0)
 		, m_transfers_enabled(false)
+		, m_bulk_transfer_in_flight_count(0)
+		, m_statistics_window_seconds(0.f)
+		, m_log_transfer_statistics(false)
+		, m_statistics_window_start_us(0)
+		, m_last_bulk_statistics_publish_us(0)
         , m_thread_started(false)
 		, m_next_usb_device_handle(0)
     {
@@ -95,6 +246,13 @@ public:
         bool bSuccess= true;
 
 		m_transfers_enabled= cfg.enable_usb_transfers;
+		m_main_thread_id= std::this_thread::get_id();
+		m_bulk_transfer_in_flight_count= cfg.bulk_transfer_in_flight_count;
+		m_statistics_window_seconds= cfg.transfer_statistics_window_seconds;
+		m_log_transfer_statistics= cfg.log_transfer_statistics;
+		m_statistics_window_start_us= ServerUtility::get_service_time_us();
+		m_thread_cpu_cores= cfg.usb_thread_cpu_cores;
+		m_thread_priority= cfg.usb_thread_priority;
 
 		if (m_usb_api == nullptr)
 		{
@@ -130,11 +288,13 @@ public:
 				m_usb_api = new LibUSBApi;
 				break;
 			case _USBApiType_WinUSB:
-				//###HipsterSloth $TODO actually implement WinUSB interface
-				//SERVER_LOG_INFO("USBAsyncRequestManager::startup") << "Creating WinUSBApi";
-				//m_usb_api = new WinUSBApi;
-				SERVER_LOG_INFO("USBAsyncRequestManager::startup") << "Creating LibUSBApi (WinUSBApi not yet implemented)";
+#ifdef _WIN32
+				SERVER_LOG_INFO("USBAsyncRequestManager::startup") << "Creating WinUSBApi";
+				m_usb_api = new WinUSBApi;
+#else
+				SERVER_LOG_INFO("USBAsyncRequestManager::startup") << "Creating LibUSBApi (WinUSBApi only exists on Windows)";
 				m_usb_api = new LibUSBApi;
+#endif // _WIN32
 				break;
 			default:
 				assert(0 && "unreachable");
@@ -160,9 +320,10 @@ public:
 
     void update()
     {
-        // If the thread terminated, reset the started and exited flags
-        if (m_exit_signaled)
+        // If the thread terminated on its own, join it and reset the started and exited flags
+        if (m_thread_started && m_exit_signaled)
         {
+            m_worker_thread.join();
             m_thread_started= false;
             m_exit_signaled= false;
         }
@@ -188,6 +349,8 @@ public:
 				// If the thread is running, only process the results since the thread is handling the requests
 				processResults();
 			}
+
+			updateTransferStatistics();
 		}
     }
 
@@ -231,6 +394,7 @@ public:
 			++m_next_usb_device_handle;
 
 			m_device_state_map.insert(t_handle_usb_device_pair(state->public_handle, state));
+			m_device_statistics_map[handle].clear(handle);
         }
 
         return handle;
@@ -247,6 +411,14 @@ public:
 			m_device_state_map.erase(iter);
 			m_usb_api->close_usb_device(usb_device_state);
 		}
+
+		m_device_statistics_map.erase(handle);
+		{
+			std::lock_guard<std::mutex> lock(m_bulk_statistics_mutex);
+
+			m_bulk_statistics_snapshot.erase(handle);
+			m_retired_bulk_statistics.erase(handle);
+		}
     }
 
 	bool canUSBDeviceBeOpened(struct USBDeviceEnumerator* enumerator, char *outReason, size_t bufferSize)
@@ -266,47 +438,38 @@ public:
     {
 		bool bAddedRequest= false;
 
+		// Time the request from now until its result callback fires on the main thread
+		const long long submit_time_us= ServerUtility::get_service_time_us();
+		std::function<void(USBTransferResult&)> timed_callback=
+			[this, submit_time_us, callback](USBTransferResult &result)
+			{
+				recordTransferResult(result, submit_time_us);
+				callback(result);
+			};
+
 		if (m_transfers_enabled)
 		{
-			USBTransferRequestState requestState = {request, callback};
+			USBTransferRequestState requestState = {request, timed_callback};
 
 			if (request_queue.push(requestState))
 			{
-				// Give the other thread a chance to process the request
-				ServerUtility::sleep_ms(10);
+				// Don't make the request wait for the worker thread's current poll to time out
+				if (m_thread_started)
+				{
+					m_usb_api->interrupt_poll();
+				}
+
 				bAddedRequest= true;
 			}
+			else
+			{
+				SERVER_LOG_WARNING("USBAsyncRequestManager::submitTransferRequest") << "Request queue full, rejecting transfer request";
+				postSubmitFailedResult(request, timed_callback);
+			}
 		}
 		else
 		{
-			USBTransferResult result;
-			memset(&result, 0, sizeof(USBTransferResult));
-
-			switch (request.request_type)
-			{
-			case eUSBTransferRequestType::_USBRequestType_InterruptTransfer:
-				result.result_type= _USBResultType_InterrupTransfer;
-				result.payload.interrupt_transfer.result_code= eUSBResultCode::_USBResultCode_SubmitFailed;
-				result.payload.interrupt_transfer.usb_device_handle= request.payload.interrupt_transfer.usb_device_handle;
-				break;
-			case eUSBTransferRequestType::_USBRequestType_ControlTransfer:
-				result.result_type= _USBResultType_ControlTransfer;
-				result.payload.control_transfer.result_code= eUSBResultCode::_USBResultCode_SubmitFailed;
-				result.payload.control_transfer.usb_device_handle= request.payload.control_transfer.usb_device_handle;
-				break;
-			case eUSBTransferRequestType::_USBRequestType_StartBulkTransfer:
-				result.result_type= _USBResultType_BulkTransfer;
-				result.payload.bulk_transfer.result_code= eUSBResultCode::_USBResultCode_SubmitFailed;
-				result.payload.bulk_transfer.usb_device_handle= request.payload.start_bulk_transfer.usb_device_handle;
-				break;
-			case eUSBTransferRequestType::_USBRequestType_CancelBulkTransfer:
-				result.result_type= _USBResultType_BulkTransfer;
-				result.payload.bulk_transfer.result_code= eUSBResultCode::_USBResultCode_SubmitFailed;
-				result.payload.bulk_transfer.usb_device_handle= request.payload.cancel_bulk_transfer.usb_device_handle;
-				break;
-			}
-			
-			callback(result);
+			postSubmitFailedResult(request, timed_callback);
 		}
 
         return bAddedRequest;
@@ -363,6 +526,35 @@ public:
 		return bIsOpen;
 	}
 
+	void getTransferStatistics(std::vector<USBDeviceTransferStatistics> &out_statistics)
+	{
+		std::map<t_usb_device_handle, USBDeviceTransferCounters> bulk_statistics;
+		{
+			std::lock_guard<std::mutex> lock(m_bulk_statistics_mutex);
+			bulk_statistics= m_bulk_statistics_snapshot;
+		}
+
+		out_statistics.clear();
+		for (auto it = m_device_statistics_map.begin(); it != m_device_statistics_map.end(); ++it)
+		{
+			USBDeviceTransferStatistics statistics= it->second.window_statistics;
+			USBDeviceTransferCounters totals= it->second.request_counters;
+			auto bulk_it= bulk_statistics.find(it->first);
+
+			if (bulk_it != bulk_statistics.end())
+			{
+				totals.add(bulk_it->second);
+			}
+
+			// Rates come from the last window, the totals are up to date
+			statistics.completed_transfer_count= totals.transfer_count;
+			statistics.completed_byte_count= totals.byte_count;
+			statistics.error_count= totals.error_count;
+
+			out_statistics.push_back(statistics);
+		}
+	}
+
 	void postUSBTransferResult(const USBTransferResult &result, std::function<void(USBTransferResult&)> callback)
 	{
 		USBTransferResultState state = { result, callback };
@@ -382,10 +574,194 @@ public:
 			--m_active_interrupt_transfers;
 		}
 
-		result_queue.push(state);
+		// Results are never dropped since a blocking request waits on its callback.
+		// If the main thread has fallen behind, wake it and wait for room in the queue.
+		while (!result_queue.push(state))
+		{
+			if (std::this_thread::get_id() == m_main_thread_id)
+			{
+				// Requests are processed on the main thread when the worker isn't running
+				processResults();
+			}
+			else
+			{
+				WakeupSignal::notifyMainLoop();
+				std::this_thread::yield();
+			}
+		}
+
+		// Wake up the main thread so it can process the result right away
+		WakeupSignal::notifyMainLoop();
 	}
 
 protected:
+    void recordTransferResult(const USBTransferResult &result, long long submit_time_us)
+    {
+		t_usb_device_handle handle= k_invalid_usb_device_handle;
+		eUSBResultCode result_code= _USBResultCode_GeneralError;
+		int transfer_byte_count= 0;
+		bool bIsTransfer= true;
+
+		switch (result.result_type)
+		{
+		case _USBResultType_InterrupTransfer:
+			handle= result.payload.interrupt_transfer.usb_device_handle;
+			result_code= result.payload.interrupt_transfer.result_code;
+			transfer_byte_count= result.payload.interrupt_transfer.dataLength;
+			break;
+		case _USBResultType_ControlTransfer:
+			handle= result.payload.control_transfer.usb_device_handle;
+			result_code= result.payload.control_transfer.result_code;
+			transfer_byte_count= result.payload.control_transfer.dataLength;
+			break;
+		case _USBResultType_BulkTransfer:
+			// Bulk start/cancel acknowledgments only count if they failed,
+			// the bulk transfers themselves are counted by their bundle
+			handle= result.payload.bulk_transfer.usb_device_handle;
+			result_code= result.payload.bulk_transfer.result_code;
+			bIsTransfer= false;
+			break;
+		}
+
+		auto it= m_device_statistics_map.find(handle);
+		if (it != m_device_statistics_map.end())
+		{
+			USBDeviceTransferCounters &counters= it->second.request_counters;
+			const bool bSucceeded=
+				result_code == _USBResultCode_Started ||
+				result_code == _USBResultCode_Canceled ||
+				result_code == _USBResultCode_Completed;
+
+			if (!bSucceeded)
+			{
+				++counters.error_count;
+			}
+			else if (bIsTransfer)
+			{
+				counters.recordTransfer(transfer_byte_count, ServerUtility::get_service_time_us() - submit_time_us);
+			}
+		}
+    }
+
+    void updateTransferStatistics()
+    {
+		const long long now_us= ServerUtility::get_service_time_us();
+		const float window_seconds= static_cast<float>(now_us - m_statistics_window_start_us) / 1000000.f;
+
+		if (m_statistics_window_seconds <= 0.f || window_seconds < m_statistics_window_seconds)
+		{
+			return;
+		}
+
+		std::map<t_usb_device_handle, USBDeviceTransferCounters> bulk_statistics;
+		{
+			std::lock_guard<std::mutex> lock(m_bulk_statistics_mutex);
+			bulk_statistics= m_bulk_statistics_snapshot;
+		}
+
+		for (auto it = m_device_statistics_map.begin(); it != m_device_statistics_map.end(); ++it)
+		{
+			USBDeviceStatisticsState &state= it->second;
+			USBDeviceTransferCounters totals= state.request_counters;
+			auto bulk_it= bulk_statistics.find(it->first);
+
+			if (bulk_it != bulk_statistics.end())
+			{
+				totals.add(bulk_it->second);
+			}
+
+			USBDeviceTransferCounters window_counters= totals;
+			window_counters.subtract(state.window_start_totals);
+			state.window_start_totals= totals;
+
+			USBDeviceTransferStatistics &statistics= state.window_statistics;
+			statistics.usb_device_handle= it->first;
+			statistics.window_duration_seconds= window_seconds;
+			statistics.transfers_per_second= static_cast<float>(window_counters.transfer_count) / window_seconds;
+			statistics.bytes_per_second= static_cast<float>(window_counters.byte_count) / window_seconds;
+			statistics.completion_latency_p50_ms= window_counters.computeLatencyPercentileMs(0.5f);
+			statistics.completion_latency_p99_ms= window_counters.computeLatencyPercentileMs(0.99f);
+			statistics.completed_transfer_count= totals.transfer_count;
+			statistics.completed_byte_count= totals.byte_count;
+			statistics.error_count= totals.error_count;
+
+			if (m_log_transfer_statistics && (window_counters.transfer_count > 0 || window_counters.error_count > 0))
+			{
+				SERVER_LOG_INFO("USBAsyncRequestManager::updateTransferStatistics") << "USB device " << it->first
+					<< ": " << statistics.transfers_per_second << " transfers/s, "
+					<< statistics.bytes_per_second / 1024.f << " KB/s, latency p50 "
+					<< statistics.completion_latency_p50_ms << "ms p99 "
+					<< statistics.completion_latency_p99_ms << "ms, "
+					<< window_counters.error_count << " errors (" << totals.error_count << " total)";
+			}
+		}
+
+		m_statistics_window_start_us= now_us;
+    }
+
+    // Called on whichever thread is processing requests
+    void publishBulkTransferStatistics()
+    {
+		const long long now_us= ServerUtility::get_service_time_us();
+
+		if (now_us - m_last_bulk_statistics_publish_us >= k_bulk_statistics_publish_interval_us)
+		{
+			std::lock_guard<std::mutex> lock(m_bulk_statistics_mutex);
+
+			m_bulk_statistics_snapshot= m_retired_bulk_statistics;
+			addBulkTransferStatistics(m_active_bulk_transfer_bundles, m_bulk_statistics_snapshot);
+			addBulkTransferStatistics(m_canceled_bulk_transfer_bundles, m_bulk_statistics_snapshot);
+
+			m_last_bulk_statistics_publish_us= now_us;
+		}
+    }
+
+    // Keeps the counters of a bundle that's about to be deleted in the device totals
+    void retireBulkTransferStatistics(const IUSBBulkTransferBundle *bundle)
+    {
+		USBBulkTransferStatistics bulk_statistics;
+		bundle->getTransferStatistics(bulk_statistics);
+
+		std::lock_guard<std::mutex> lock(m_bulk_statistics_mutex);
+		auto it= m_retired_bulk_statistics.find(bundle->getUSBDeviceHandle());
+
+		if (it == m_retired_bulk_statistics.end())
+		{
+			USBDeviceTransferCounters counters;
+			counters.clear();
+
+			it= m_retired_bulk_statistics.insert(std::make_pair(bundle->getUSBDeviceHandle(), counters)).first;
+		}
+
+		it->second.add(bulk_statistics);
+
+		// Publish the new totals on the next call instead of waiting out the interval
+		m_last_bulk_statistics_publish_us= 0;
+    }
+
+    static void addBulkTransferStatistics(
+		const std::vector<IUSBBulkTransferBundle *> &bundles,
+		std::map<t_usb_device_handle, USBDeviceTransferCounters> &out_counters_map)
+    {
+		for (auto bundle_it = bundles.begin(); bundle_it != bundles.end(); ++bundle_it)
+		{
+			const IUSBBulkTransferBundle *bundle= *bundle_it;
+			USBBulkTransferStatistics bulk_statistics;
+			bundle->getTransferStatistics(bulk_statistics);
+
+			auto it= out_counters_map.find(bundle->getUSBDeviceHandle());
+			if (it == out_counters_map.end())
+			{
+				USBDeviceTransferCounters counters;
+				counters.clear();
+
+				it= out_counters_map.insert(std::make_pair(bundle->getUSBDeviceHandle(), counters)).first;
+			}
+
+			it->second.add(bulk_statistics);
+		}
+    }
+
     void startWorkerThread()
     {
         if (!m_thread_started)
@@ -400,25 +776,31 @@ protected:
     {
         bool bHadRequests= false;
 
-        // Process incoming USB transfer requests
-		USBTransferRequestState requestState;
-        while (request_queue.pop(requestState))
+        // Process incoming USB transfer requests a batch at a time
+		USBTransferRequestState requestStates[k_usb_queue_drain_batch_size];
+		size_t request_count;
+        while ((request_count= request_queue.pop(requestStates, k_usb_queue_drain_batch_size)) > 0)
         {
-            switch (requestState.request.request_type)
-            {
-			case eUSBTransferRequestType::_USBRequestType_InterruptTransfer:
-				handleInterruptTransferRequest(requestState);
-				break;
-            case eUSBTransferRequestType::_USBRequestType_ControlTransfer:
-                handleControlTransferRequest(requestState);
-                break;
-            case eUSBTransferRequestType::_USBRequestType_StartBulkTransfer:
-                handleStartBulkTransferRequest(requestState);
-                break;
-            case eUSBTransferRequestType::_USBRequestType_CancelBulkTransfer:
-                handleCancelBulkTransferRequest(requestState);
-                break;
-            }
+			for (size_t request_index = 0; request_index < request_count; ++request_index)
+			{
+				const USBTransferRequestState &requestState= requestStates[request_index];
+
+				switch (requestState.request.request_type)
+				{
+				case eUSBTransferRequestType::_USBRequestType_InterruptTransfer:
+					handleInterruptTransferRequest(requestState);
+					break;
+				case eUSBTransferRequestType::_USBRequestType_ControlTransfer:
+					handleControlTransferRequest(requestState);
+					break;
+				case eUSBTransferRequestType::_USBRequestType_StartBulkTransfer:
+					handleStartBulkTransferRequest(requestState);
+					break;
+				case eUSBTransferRequestType::_USBRequestType_CancelBulkTransfer:
+					handleCancelBulkTransferRequest(requestState);
+					break;
+				}
+			}
 
             bHadRequests= true;
         }
@@ -440,6 +822,9 @@ protected:
 
             // Cleanup any requests that no longer have any pending cancellations
             cleanupCanceledRequests(false);
+
+            // Let the main thread see how the bulk transfers are doing
+            publishBulkTransferStatistics();
         }
 
         return bHadRequests;
@@ -447,16 +832,53 @@ protected:
 
     void processResults()
     {
-        USBTransferResultState resultState;
+        USBTransferResultState resultStates[k_usb_queue_drain_batch_size];
+		size_t result_count;
 
-        // Process all pending results
-        while (result_queue.pop(resultState))
+        // Process all pending results a batch at a time
+        while ((result_count= result_queue.pop(resultStates, k_usb_queue_drain_batch_size)) > 0)
         {
-            // Fire the callback on the result
-            resultState.callback(resultState.result);
+			for (size_t result_index = 0; result_index < result_count; ++result_index)
+			{
+				// Fire the callback on the result
+				resultStates[result_index].callback(resultStates[result_index].result);
+			}
         }
     }
 
+	void postSubmitFailedResult(const USBTransferRequest &request, std::function<void(USBTransferResult&)> callback)
+	{
+		USBTransferResult result;
+		memset(&result, 0, sizeof(USBTransferResult));
+
+		switch (request.request_type)
+		{
+		case eUSBTransferRequestType::_USBRequestType_InterruptTransfer:
+			result.result_type= _USBResultType_InterrupTransfer;
+			result.payload.interrupt_transfer.result_code= eUSBResultCode::_USBResultCode_SubmitFailed;
+			result.payload.interrupt_transfer.usb_device_handle= request.payload.interrupt_transfer.usb_device_handle;
+			break;
+		case eUSBTransferRequestType::_USBRequestType_ControlTransfer:
+			result.result_type= _USBResultType_ControlTransfer;
+			result.payload.control_transfer.result_code= eUSBResultCode::_USBResultCode_SubmitFailed;
+			result.payload.control_transfer.usb_device_handle= request.payload.control_transfer.usb_device_handle;
+			break;
+		case eUSBTransferRequestType::_USBRequestType_StartBulkTransfer:
+			result.result_type= _USBResultType_BulkTransfer;
+			result.payload.bulk_transfer.result_code= eUSBResultCode::_USBResultCode_SubmitFailed;
+			result.payload.bulk_transfer.usb_device_handle= request.payload.start_bulk_transfer.usb_device_handle;
+			break;
+		case eUSBTransferRequestType::_USBRequestType_CancelBulkTransfer:
+			result.result_type= _USBResultType_BulkTransfer;
+			result.payload.bulk_transfer.result_code= eUSBResultCode::_USBResultCode_SubmitFailed;
+			result.payload.bulk_transfer.usb_device_handle= request.payload.cancel_bulk_transfer.usb_device_handle;
+			break;
+		}
+
+		// Called on the main thread, so the callback can fire right away
+		callback(result);
+	}
+
     void requestProcessingTeardown()
     {
         // Drain the request queue
@@ -494,6 +916,16 @@ protected:
     void workerThreadFunc()
     {
         ServerUtility::set_current_thread_name("USB Async Worker Thread");
+        ServerTrace::set_current_thread_name("USB Async Worker Thread");
+
+        if (!ServerUtility::set_current_thread_cpu_affinity(m_thread_cpu_cores))
+        {
+            SERVER_MT_LOG_WARNING("USBDeviceManager::workerThreadFunc") << "Failed to pin the USB thread to cores: " << m_thread_cpu_cores;
+        }
+        if (!ServerUtility::set_current_thread_priority(m_thread_priority))
+        {
+            SERVER_MT_LOG_WARNING("USBDeviceManager::workerThreadFunc") << "Failed to set the USB thread priority: " << m_thread_priority;
+        }
 
         // Stay in the message loop until asked to exit by the main thread
         while (!m_exit_signaled)
@@ -511,15 +943,21 @@ protected:
 
     void cleanupCanceledRequests(bool bForceCleanup)
     {
-        for (auto it = m_canceled_bulk_transfer_bundles.begin(); it != m_canceled_bulk_transfer_bundles.end(); ++it)
+        for (auto it = m_canceled_bulk_transfer_bundles.begin(); it != m_canceled_bulk_transfer_bundles.end(); )
         {
             IUSBBulkTransferBundle *bundle = *it;
 
             if (bundle->getActiveTransferCount() == 0 || bForceCleanup)
             {
-                m_canceled_bulk_transfer_bundles.erase(it);
+                retireBulkTransferStatistics(bundle);
+
+                it = m_canceled_bulk_transfer_bundles.erase(it);
                 delete bundle;
             }
+            else
+            {
+                ++it;
+            }
         }
     }
 
@@ -658,7 +1096,15 @@ protected:
 
             if (it == m_active_bulk_transfer_bundles.end())
             {
-                IUSBBulkTransferBundle *bundle = m_usb_api->allocate_bulk_transfer_bundle(state, &requestState.request.payload.start_bulk_transfer);
+                USBRequestPayload_BulkTransfer bundle_request= request;
+
+                // The config can override how deep the in-flight transfer queue is
+                if (m_bulk_transfer_in_flight_count > 0)
+                {
+                    bundle_request.in_flight_transfer_packet_count= m_bulk_transfer_in_flight_count;
+                }
+
+                IUSBBulkTransferBundle *bundle = m_usb_api->allocate_bulk_transfer_bundle(state, &bundle_request);
 
                 // Allocate and initialize the bulk transfers
                 if (bundle->initialize())
@@ -813,8 +1259,8 @@ private:
 	IUSBApi *m_usb_api;
     bool m_bUseMultithreading;
     std::atomic_bool m_exit_signaled;
-    boost::lockfree::spsc_queue<USBTransferRequestState, boost::lockfree::capacity<128> > request_queue;
-    boost::lockfree::spsc_queue<USBTransferResultState, boost::lockfree::capacity<128> > result_queue;
+    boost::lockfree::spsc_queue<USBTransferRequestState, boost::lockfree::capacity<k_max_usb_request_queue_size> > request_queue;
+    boost::lockfree::spsc_queue<USBTransferResultState, boost::lockfree::capacity<k_max_usb_result_queue_size> > result_queue;
 
     // Worker thread state
     std::vector<IUSBBulkTransferBundle *> m_active_bulk_transfer_bundles;
@@ -824,11 +1270,27 @@ private:
 
     // Main thread state
 	bool m_transfers_enabled;
+	int m_bulk_transfer_in_flight_count;
     bool m_thread_started;
     std::thread m_worker_thread;
+    std::thread::id m_main_thread_id;
+    std::string m_thread_cpu_cores;
+    std::string m_thread_priority;
     std::vector<USBDeviceFilter> m_device_whitelist;
 	t_usb_device_map m_device_state_map;
 	t_usb_device_handle m_next_usb_device_handle;
+
+	// Transfer statistics state (main thread)
+	float m_statistics_window_seconds;
+	bool m_log_transfer_statistics;
+	long long m_statistics_window_start_us;
+	std::map<t_usb_device_handle, USBDeviceStatisticsState> m_device_statistics_map;
+
+	// Bulk transfer counters copied out by the request processing thread
+	std::mutex m_bulk_statistics_mutex;
+	std::map<t_usb_device_handle, USBDeviceTransferCounters> m_bulk_statistics_snapshot;
+	std::map<t_usb_device_handle, USBDeviceTransferCounters> m_retired_bulk_statistics;
+	long long m_last_bulk_statistics_publish_us;
 };
 
 //-- public interface -----
@@ -961,6 +1423,12 @@ USBTransferResult usb_device_submit_transfer_request_blocking(const USBTransferR
 	return result;
 }
 
+// -- Device Statistics ----
+void usb_device_get_transfer_statistics(std::vector<USBDeviceTransferStatistics> &out_statistics)
+{
+	USBDeviceManager::getInstance()->getImplementation()->getTransferStatistics(out_statistics);
+}
+
 // -- Device Queries ----
 bool usb_device_get_filter(t_usb_device_handle handle, USBDeviceFilter &outDeviceInfo)
 {
@@ -5,6 +5,7 @@
 #include "PSMoveConfig.h"
 #include "USBDeviceRequest.h"
 #include <functional>
+#include <vector>
 
 //-- constants -----
 enum eUSBApiType
@@ -30,6 +31,32 @@ public:
     long version;
 	std::string usb_api_name;
 	bool enable_usb_transfers;
+	// Number of bulk transfers kept in flight per device stream (0 = use the count the device asks for)
+	int bulk_transfer_in_flight_count;
+	// How long each transfer statistics window lasts
+	float transfer_statistics_window_seconds;
+	// Log the statistics of every device with transfer activity at the end of each window
+	bool log_transfer_statistics;
+	// Cores the USB transfer thread is pinned to, ex) "2,3" (empty = any core)
+	std::string usb_thread_cpu_cores;
+	// Scheduling class of the USB transfer thread: "normal", "high" or "realtime"
+	std::string usb_thread_priority;
+};
+
+/// Transfer statistics of an open USB device (see usb_device_get_transfer_statistics)
+struct USBDeviceTransferStatistics
+{
+	t_usb_device_handle usb_device_handle;
+	// Rates and latency percentiles cover the last completed statistics window
+	float window_duration_seconds;
+	float transfers_per_second;
+	float bytes_per_second;
+	float completion_latency_p50_ms;
+	float completion_latency_p99_ms;
+	// Totals since the device was opened
+	uint64_t completed_transfer_count;
+	uint64_t completed_byte_count;
+	uint64_t error_count;
 };
 
 /// Manages async control and bulk transfer requests to usb devices via selected usb api.
@@ -94,6 +121,11 @@ bool usb_device_get_port_path(t_usb_device_handle handle, char *outBuffer, size_
 bool usb_device_get_is_open(t_usb_device_handle handle);
 const char *usb_device_get_error_string(eUSBResultCode result_code);
 
+// -- Device Statistics ----
+// Control and interrupt transfers are timed from submission until the result callback fires,
+// bulk transfers from libusb submission until their completion callback.
+void usb_device_get_transfer_statistics(std::vector<USBDeviceTransferStatistics> &out_statistics);
+
 // -- Notifications ----
 void usb_device_post_transfer_result(const USBTransferResult &result, std::function<void(USBTransferResult&)> callback);
 
@@ -33,10 +33,12 @@ static bool libusb_device_get_port_path(libusb_device *dev, char *outBuffer, siz
 LibUSBApi::LibUSBApi() : IUSBApi()
 {
 	m_apiContext = new APIContext;
+	m_transferBufferPool = new LibUSBTransferBufferPool;
 }
 
 LibUSBApi::~LibUSBApi()
 {
+	delete m_transferBufferPool;
 	delete m_apiContext;
 }
 
@@ -58,6 +60,14 @@ void LibUSBApi::poll()
 	libusb_handle_events_timeout_completed(m_apiContext->lib_usb_context, &tv, NULL);
 }
 
+void LibUSBApi::interrupt_poll()
+{
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+	// Wake up the event handler so newly queued requests don't wait out the poll timeout
+	libusb_interrupt_event_handler(m_apiContext->lib_usb_context);
+#endif
+}
+
 void LibUSBApi::shutdown()
 {
 	if (m_apiContext->lib_usb_context != nullptr)
@@ -590,7 +600,7 @@ static void LIBUSB_CALL control_transfer_cb(struct libusb_transfer *transfer)
 
 IUSBBulkTransferBundle *LibUSBApi::allocate_bulk_transfer_bundle(const USBDeviceState *device_state, const USBRequestPayload_BulkTransfer *request)
 {
-	return new LibUSBBulkTransferBundle(device_state, request);
+	return new LibUSBBulkTransferBundle(device_state, request, m_transferBufferPool);
 }
 
 bool LibUSBApi::get_usb_device_filter(const USBDeviceState* device_state, struct USBDeviceFilter *outDeviceInfo) const
@@ -27,6 +27,7 @@ public:
 
 	bool startup() override;
 	void poll() override;
+	void interrupt_poll() override;
 	void shutdown() override;
 
 	USBDeviceEnumerator* device_enumerator_create() override;
@@ -50,6 +51,7 @@ public:
 
 private:
 	struct APIContext *m_apiContext;
+	class LibUSBTransferBufferPool *m_transferBufferPool;
 };
 
 #endif // USB_API_INTERFACE_H
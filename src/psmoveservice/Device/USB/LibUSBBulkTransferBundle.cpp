@@ -4,34 +4,165 @@
 #include "ServerLog.h"
 #include "ServerUtility.h"
 #include "USBDeviceRequest.h"
+#include "WakeupSignal.h"
 
 #include "libusb.h"
 
 #include <assert.h>
 #include <memory>
 #include <cstring>
+#include <stdlib.h>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+//-- constants -----
+// Transfer buffers are allocated on page boundaries
+static const size_t k_transfer_buffer_alignment = 4096;
+
+// Transfer packets within a buffer start on a cache line
+static const size_t k_transfer_packet_alignment = 64;
+
+// Released transfer buffers beyond this many bytes get freed instead of pooled
+static const size_t k_max_pooled_transfer_buffer_bytes = 16 * 1024 * 1024;
 
 //-- private methods -----
 static void LIBUSB_CALL transfer_callback_function(struct libusb_transfer *bulk_transfer);
+static unsigned char *aligned_buffer_alloc(size_t byte_size);
+static void aligned_buffer_free(unsigned char *buffer);
 
-//-- implementation -----
+static inline size_t round_up_to_alignment(size_t byte_size, size_t alignment)
+{
+    return ((byte_size + alignment - 1) / alignment) * alignment;
+}
+
+static inline void atomic_store_max(std::atomic<uint64_t> &value, uint64_t sample)
+{
+    uint64_t current = value.load(std::memory_order_relaxed);
+
+    while (sample > current && !value.compare_exchange_weak(current, sample, std::memory_order_relaxed))
+    {
+    }
+}
+
+//-- LibUSBTransferBufferPool -----
+LibUSBTransferBufferPool::LibUSBTransferBufferPool()
+    : m_free_byte_count(0)
+{
+}
+
+LibUSBTransferBufferPool::~LibUSBTransferBufferPool()
+{
+    for (auto it = m_free_buffers.begin(); it != m_free_buffers.end(); ++it)
+    {
+        aligned_buffer_free(it->buffer);
+    }
+
+    m_free_buffers.clear();
+    m_free_byte_count = 0;
+}
+
+unsigned char *LibUSBTransferBufferPool::allocate(size_t byte_size)
+{
+    const size_t aligned_byte_size = round_up_to_alignment(byte_size, k_transfer_buffer_alignment);
+    unsigned char *buffer = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+
+        for (auto it = m_free_buffers.begin(); it != m_free_buffers.end(); ++it)
+        {
+            if (it->byte_size == aligned_byte_size)
+            {
+                buffer = it->buffer;
+                m_free_byte_count -= it->byte_size;
+                m_free_buffers.erase(it);
+                break;
+            }
+        }
+    }
+
+    if (buffer == nullptr)
+    {
+        buffer = aligned_buffer_alloc(aligned_byte_size);
+    }
+
+    if (buffer != nullptr)
+    {
+        memset(buffer, 0, aligned_byte_size);
+    }
+
+    return buffer;
+}
+
+void LibUSBTransferBufferPool::release(unsigned char *buffer, size_t byte_size)
+{
+    const size_t aligned_byte_size = round_up_to_alignment(byte_size, k_transfer_buffer_alignment);
+    bool bPooled = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+
+        if (m_free_byte_count + aligned_byte_size <= k_max_pooled_transfer_buffer_bytes)
+        {
+            PooledBuffer pooled_buffer = { buffer, aligned_byte_size };
+
+            m_free_buffers.push_back(pooled_buffer);
+            m_free_byte_count += aligned_byte_size;
+            bPooled = true;
+        }
+    }
+
+    if (!bPooled)
+    {
+        aligned_buffer_free(buffer);
+    }
+}
+
+//-- LibUSBBulkTransferBundle -----
 LibUSBBulkTransferBundle::LibUSBBulkTransferBundle(
 	const USBDeviceState *state,
-	const USBRequestPayload_BulkTransfer *request)
+	const USBRequestPayload_BulkTransfer *request,
+    LibUSBTransferBufferPool *buffer_pool)
     : IUSBBulkTransferBundle(state, request)
 	, m_request(*request)
     , m_device(static_cast<const LibUSBDeviceState *>(state)->device)
     , m_device_handle(static_cast<const LibUSBDeviceState *>(state)->device_handle)
+    , m_buffer_pool(buffer_pool)
     , m_active_transfer_count(0)
     , m_is_canceled(false)
     , bulk_transfer_requests(nullptr)
     , transfer_buffer(nullptr)
+    , transfer_buffer_size(0)
+    , transfer_buffer_stride(0)
+    , transfer_submit_time_us(nullptr)
+    , m_completed_transfer_count(0)
+    , m_completed_byte_count(0)
+    , m_dropped_payload_count(0)
+    , m_total_completion_latency_us(0)
+    , m_max_completion_latency_us(0)
+    , m_max_resubmit_gap_us(0)
 {
-	
+    for (int bucket_index = 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+    {
+        m_completion_latency_histogram[bucket_index].store(0);
+    }
 }
 
 LibUSBBulkTransferBundle::~LibUSBBulkTransferBundle()
 {
+    if (m_completed_transfer_count > 0 || m_dropped_payload_count > 0)
+    {
+        USBBulkTransferStatistics stats;
+        getTransferStatistics(stats);
+
+        SERVER_MT_LOG_INFO("USBBulkTransferBundle::destructor") << "USB device " << m_request.usb_device_handle
+            << " bulk transfers: " << stats.completed_transfer_count << " completed (" << stats.completed_byte_count << " bytes), "
+            << stats.dropped_payload_count << " dropped, avg latency " << (stats.total_completion_latency_us / (stats.completed_transfer_count > 0 ? stats.completed_transfer_count : 1))
+            << "us, max latency " << stats.max_completion_latency_us << "us, max resubmit gap " << stats.max_resubmit_gap_us << "us";
+    }
+
     dispose();
 
     if (m_active_transfer_count > 0)
@@ -78,19 +209,23 @@ bool LibUSBBulkTransferBundle::initialize()
     if (bSuccess)
     {
         // Allocate the transfer buffer that the requests write data into
-        size_t xfer_buffer_size = m_request.in_flight_transfer_packet_count * m_request.transfer_packet_size;
-        transfer_buffer = (uint8_t *)malloc(xfer_buffer_size);
+        transfer_buffer_stride = round_up_to_alignment(m_request.transfer_packet_size, k_transfer_packet_alignment);
+        transfer_buffer_size = m_request.in_flight_transfer_packet_count * transfer_buffer_stride;
+        transfer_buffer = m_buffer_pool->allocate(transfer_buffer_size);
 
-        if (transfer_buffer != nullptr)
-        {
-            memset(transfer_buffer, 0, xfer_buffer_size);
-        }
-        else
+        if (transfer_buffer == nullptr)
         {
             bSuccess = false;
         }
     }
 
+    // Allocate the per-transfer submit timestamps used for the latency counters
+    if (bSuccess)
+    {
+        transfer_submit_time_us = new long long[m_request.in_flight_transfer_packet_count];
+        memset(transfer_submit_time_us, 0, m_request.in_flight_transfer_packet_count * sizeof(long long));
+    }
+
     // Allocate and initialize the transfers
     if (bSuccess)
     {
@@ -104,7 +239,7 @@ bool LibUSBBulkTransferBundle::initialize()
                     bulk_transfer_requests[transfer_index],
                     m_device_handle,
                     bulk_endpoint,
-                    transfer_buffer + transfer_index*m_request.transfer_packet_size,
+                    transfer_buffer + transfer_index*transfer_buffer_stride,
                     m_request.transfer_packet_size,
                     transfer_callback_function,
                     reinterpret_cast<void*>(this),
@@ -124,20 +259,30 @@ void LibUSBBulkTransferBundle::dispose()
 {
     assert(m_active_transfer_count == 0);
 
-    for (int transfer_index = 0;
-        transfer_index < m_request.in_flight_transfer_packet_count;
-        ++transfer_index)
+    if (bulk_transfer_requests != nullptr)
     {
-        if (bulk_transfer_requests[transfer_index] != nullptr)
+        for (int transfer_index = 0;
+            transfer_index < m_request.in_flight_transfer_packet_count;
+            ++transfer_index)
         {
-            libusb_free_transfer(bulk_transfer_requests[transfer_index]);
+            if (bulk_transfer_requests[transfer_index] != nullptr)
+            {
+                libusb_free_transfer(bulk_transfer_requests[transfer_index]);
+            }
         }
     }
 
     if (transfer_buffer != nullptr)
     {
-        free(transfer_buffer);
+        m_buffer_pool->release(transfer_buffer, transfer_buffer_size);
         transfer_buffer = nullptr;
+        transfer_buffer_size = 0;
+    }
+
+    if (transfer_submit_time_us != nullptr)
+    {
+        delete[] transfer_submit_time_us;
+        transfer_submit_time_us = nullptr;
     }
 
     if (bulk_transfer_requests != nullptr)
@@ -158,6 +303,7 @@ bool LibUSBBulkTransferBundle::startTransfers()
         {
             libusb_transfer *bulk_transfer = bulk_transfer_requests[transfer_index];
 
+            transfer_submit_time_us[transfer_index] = ServerUtility::get_service_time_us();
             if (libusb_submit_transfer(bulk_transfer) == 0)
             {
                 ++m_active_transfer_count;
@@ -179,11 +325,60 @@ void LibUSBBulkTransferBundle::notifyActiveTransfersDecremented()
     --m_active_transfer_count;
 }
 
+void LibUSBBulkTransferBundle::notifyTransferCompleted(
+    struct libusb_transfer *bulk_transfer,
+    bool bDroppedPayload,
+    long long completion_time_us)
+{
+    const int transfer_index = getTransferIndex(bulk_transfer);
+    const long long latency_us = completion_time_us - transfer_submit_time_us[transfer_index];
+    const uint64_t latency_sample = latency_us > 0 ? static_cast<uint64_t>(latency_us) : 0;
+
+    if (bDroppedPayload)
+    {
+        m_dropped_payload_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_completed_transfer_count.fetch_add(1, std::memory_order_relaxed);
+        m_completed_byte_count.fetch_add(bulk_transfer->actual_length, std::memory_order_relaxed);
+        m_total_completion_latency_us.fetch_add(latency_sample, std::memory_order_relaxed);
+        atomic_store_max(m_max_completion_latency_us, latency_sample);
+        m_completion_latency_histogram[usb_latency_histogram_bucket_index(latency_sample)].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void LibUSBBulkTransferBundle::notifyTransferResubmitted(
+    struct libusb_transfer *bulk_transfer,
+    long long completion_time_us)
+{
+    const int transfer_index = getTransferIndex(bulk_transfer);
+    const long long resubmit_time_us = ServerUtility::get_service_time_us();
+    const long long gap_us = resubmit_time_us - completion_time_us;
+
+    transfer_submit_time_us[transfer_index] = resubmit_time_us;
+    atomic_store_max(m_max_resubmit_gap_us, gap_us > 0 ? static_cast<uint64_t>(gap_us) : 0);
+}
+
+int LibUSBBulkTransferBundle::getTransferIndex(const struct libusb_transfer *bulk_transfer) const
+{
+    const int transfer_index = static_cast<int>((bulk_transfer->buffer - transfer_buffer) / transfer_buffer_stride);
+    assert(transfer_index >= 0 && transfer_index < m_request.in_flight_transfer_packet_count);
+
+    return transfer_index;
+}
+
 static void LIBUSB_CALL transfer_callback_function(struct libusb_transfer *bulk_transfer)
 {
     LibUSBBulkTransferBundle *bundle = reinterpret_cast<LibUSBBulkTransferBundle*>(bulk_transfer->user_data);
     const auto &request = bundle->getTransferRequest();
     enum libusb_transfer_status status = bulk_transfer->status;
+    const long long completion_time_us = ServerUtility::get_service_time_us();
+
+    if (status != LIBUSB_TRANSFER_CANCELLED)
+    {
+        bundle->notifyTransferCompleted(bulk_transfer, status != LIBUSB_TRANSFER_COMPLETED, completion_time_us);
+    }
 
     if (status == LIBUSB_TRANSFER_COMPLETED)
     {
@@ -197,6 +392,9 @@ static void LIBUSB_CALL transfer_callback_function(struct libusb_transfer *bulk_
             bulk_transfer->buffer,
             bulk_transfer->actual_length,
             request.transfer_callback_userdata);
+
+        // Let the main thread know a new chunk of data is ready
+        WakeupSignal::notifyMainLoop();
     }
 
     // See if the request wants to resubmitted the moment it completes.
@@ -207,8 +405,13 @@ static void LIBUSB_CALL transfer_callback_function(struct libusb_transfer *bulk_
         // Start the transfer over with the same properties
         if (libusb_submit_transfer(bulk_transfer) == 0)
         {
+            bundle->notifyTransferResubmitted(bulk_transfer, completion_time_us);
             bRestartedTransfer = true;
         }
+        else
+        {
+            SERVER_MT_LOG_WARNING("USBBulkTransferBundle::transfer_callback_function") << "Failed to resubmit bulk transfer for USB device " << request.usb_device_handle;
+        }
     }
 
     // If the transfer didn't restart update the active transfer count
@@ -298,4 +501,47 @@ t_usb_device_handle LibUSBBulkTransferBundle::getUSBDeviceHandle() const
 int LibUSBBulkTransferBundle::getActiveTransferCount() const
 {
 	return m_active_transfer_count;
+}
+
+void LibUSBBulkTransferBundle::getTransferStatistics(USBBulkTransferStatistics &out_statistics) const
+{
+	out_statistics.in_flight_transfer_count = m_request.in_flight_transfer_packet_count;
+	out_statistics.transfer_packet_size = m_request.transfer_packet_size;
+	out_statistics.completed_transfer_count = m_completed_transfer_count.load(std::memory_order_relaxed);
+	out_statistics.completed_byte_count = m_completed_byte_count.load(std::memory_order_relaxed);
+	out_statistics.dropped_payload_count = m_dropped_payload_count.load(std::memory_order_relaxed);
+	out_statistics.total_completion_latency_us = m_total_completion_latency_us.load(std::memory_order_relaxed);
+	out_statistics.max_completion_latency_us = m_max_completion_latency_us.load(std::memory_order_relaxed);
+	out_statistics.max_resubmit_gap_us = m_max_resubmit_gap_us.load(std::memory_order_relaxed);
+
+	for (int bucket_index = 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+	{
+		out_statistics.completion_latency_histogram[bucket_index] = m_completion_latency_histogram[bucket_index].load(std::memory_order_relaxed);
+	}
+}
+
+//-- private helpers -----
+static unsigned char *aligned_buffer_alloc(size_t byte_size)
+{
+#ifdef _MSC_VER
+    return reinterpret_cast<unsigned char *>(_aligned_malloc(byte_size, k_transfer_buffer_alignment));
+#else
+    void *buffer = nullptr;
+
+    if (posix_memalign(&buffer, k_transfer_buffer_alignment, byte_size) != 0)
+    {
+        buffer = nullptr;
+    }
+
+    return reinterpret_cast<unsigned char *>(buffer);
+#endif
+}
+
+static void aligned_buffer_free(unsigned char *buffer)
+{
+#ifdef _MSC_VER
+    _aligned_free(buffer);
+#else
+    free(buffer);
+#endif
 }
\ No newline at end of file
@@ -5,14 +5,48 @@
 #include "USBApiInterface.h"
 #include "USBDeviceRequest.h"
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 //-- definitions -----
+/// Page aligned transfer buffers shared by all of the bulk transfer bundles of a LibUSBApi.
+/**
+ Restarting a camera stream releases its buffer back into the pool
+ so the next bundle of the same size doesn't have to allocate again.
+ */
+class LibUSBTransferBufferPool
+{
+public:
+    LibUSBTransferBufferPool();
+    virtual ~LibUSBTransferBufferPool();
+
+    /// Returns a page aligned buffer of at least byte_size bytes, or nullptr if out of memory
+    unsigned char *allocate(size_t byte_size);
+
+    /// Hands a buffer returned by allocate() back to the pool
+    void release(unsigned char *buffer, size_t byte_size);
+
+private:
+    struct PooledBuffer
+    {
+        unsigned char *buffer;
+        size_t byte_size;
+    };
+
+    std::mutex m_pool_mutex;
+    std::vector<PooledBuffer> m_free_buffers;
+    size_t m_free_byte_count;
+};
+
 /// Internal class used to manage a set of libusb bulk transfer packets.
 class LibUSBBulkTransferBundle : public IUSBBulkTransferBundle
 {
 public:
     LibUSBBulkTransferBundle(
         const USBDeviceState *device_state,
-		const struct USBRequestPayload_BulkTransfer *request);
+		const struct USBRequestPayload_BulkTransfer *request,
+        LibUSBTransferBufferPool *buffer_pool);
     virtual ~LibUSBBulkTransferBundle();
 
     // Interface
@@ -22,11 +56,14 @@ public:
 
     // Events
     void notifyActiveTransfersDecremented();
+    void notifyTransferCompleted(struct libusb_transfer *bulk_transfer, bool bDroppedPayload, long long completion_time_us);
+    void notifyTransferResubmitted(struct libusb_transfer *bulk_transfer, long long completion_time_us);
 
     // Accessors
 	const USBRequestPayload_BulkTransfer &getTransferRequest() const override;
 	t_usb_device_handle getUSBDeviceHandle() const override;
 	int getActiveTransferCount() const override;
+	void getTransferStatistics(USBBulkTransferStatistics &out_statistics) const override;
 
     // Helpers
     // Search for an input transfer endpoint in the endpoint descriptor
@@ -35,16 +72,30 @@ public:
 
 protected:
     void dispose();
+    int getTransferIndex(const struct libusb_transfer *bulk_transfer) const;
 
 private:
     USBRequestPayload_BulkTransfer m_request;
     struct libusb_device *m_device;
     struct libusb_device_handle *m_device_handle;
+    LibUSBTransferBufferPool *m_buffer_pool;
 
     int m_active_transfer_count;
     bool m_is_canceled;
     struct libusb_transfer** bulk_transfer_requests;
     unsigned char* transfer_buffer;
+    size_t transfer_buffer_size;
+    size_t transfer_buffer_stride;
+    long long *transfer_submit_time_us;
+
+    // Written on the USB worker thread, safe to read from any thread
+    std::atomic<uint64_t> m_completed_transfer_count;
+    std::atomic<uint64_t> m_completed_byte_count;
+    std::atomic<uint64_t> m_dropped_payload_count;
+    std::atomic<uint64_t> m_total_completion_latency_us;
+    std::atomic<uint64_t> m_max_completion_latency_us;
+    std::atomic<uint64_t> m_max_resubmit_gap_us;
+    std::atomic<uint64_t> m_completion_latency_histogram[USB_LATENCY_HISTOGRAM_BUCKET_COUNT];
 };
 
-#endif // USB_BULK_TRANSFER_BUNDLE_H
\ No newline at end of file
+#endif // USB_BULK_TRANSFER_BUNDLE_H
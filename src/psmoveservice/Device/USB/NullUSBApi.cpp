@@ -20,6 +20,10 @@ void NullUSBApi::poll()
 {
 }
 
+void NullUSBApi::interrupt_poll()
+{
+}
+
 void NullUSBApi::shutdown()
 {
 }
@@ -141,4 +145,9 @@ t_usb_device_handle NullUSBBulkTransferBundle::getUSBDeviceHandle() const
 int NullUSBBulkTransferBundle::getActiveTransferCount() const
 {
 	return 0;
+}
+
+void NullUSBBulkTransferBundle::getTransferStatistics(USBBulkTransferStatistics &out_statistics) const
+{
+	out_statistics.clear();
 }
\ No newline at end of file
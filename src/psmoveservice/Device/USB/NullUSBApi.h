@@ -11,6 +11,7 @@ public:
 
 	bool startup() override;
 	void poll() override;
+	void interrupt_poll() override;
 	void shutdown() override;
 
 	USBDeviceEnumerator* device_enumerator_create() override;
@@ -49,6 +50,7 @@ public:
 	const USBRequestPayload_BulkTransfer &getTransferRequest() const override;
 	t_usb_device_handle getUSBDeviceHandle() const override;
 	int getActiveTransferCount() const override;
+	void getTransferStatistics(USBBulkTransferStatistics &out_statistics) const override;
 
 private:
     USBRequestPayload_BulkTransfer m_request;
@@ -2,6 +2,7 @@
 #define USB_API_INTERFACE_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 //-- constants -----
 enum eUSBResultCode
@@ -25,6 +26,9 @@ enum eUSBResultCode
 	_USBResultCode_InvalidAPI
 };
 
+// Completion latencies are binned into power of two buckets: bucket i counts latencies in [2^i, 2^(i+1)) us
+#define USB_LATENCY_HISTOGRAM_BUCKET_COUNT 24
+
 //-- typedefs -----
 typedef int t_usb_device_handle;
 const t_usb_device_handle k_invalid_usb_device_handle = -1;
@@ -53,6 +57,54 @@ struct USBDeviceState
 	}
 };
 
+/// Counters kept by a bulk transfer bundle while its transfers are running
+struct USBBulkTransferStatistics
+{
+	int in_flight_transfer_count;
+	int transfer_packet_size;
+	uint64_t completed_transfer_count;
+	uint64_t completed_byte_count;
+	// Transfers that came back with an error status or couldn't be resubmitted
+	uint64_t dropped_payload_count;
+	// Time from submitting a transfer to its completion callback
+	uint64_t total_completion_latency_us;
+	uint64_t max_completion_latency_us;
+	// Time from a completion callback to the transfer getting resubmitted
+	uint64_t max_resubmit_gap_us;
+	uint64_t completion_latency_histogram[USB_LATENCY_HISTOGRAM_BUCKET_COUNT];
+
+	void clear()
+	{
+		in_flight_transfer_count= 0;
+		transfer_packet_size= 0;
+		completed_transfer_count= 0;
+		completed_byte_count= 0;
+		dropped_payload_count= 0;
+		total_completion_latency_us= 0;
+		max_completion_latency_us= 0;
+		max_resubmit_gap_us= 0;
+
+		for (int bucket_index= 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+		{
+			completion_latency_histogram[bucket_index]= 0;
+		}
+	}
+};
+
+//-- functions -----
+inline int usb_latency_histogram_bucket_index(uint64_t latency_us)
+{
+	int bucket_index= 0;
+
+	while (latency_us > 1 && bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT - 1)
+	{
+		latency_us>>= 1;
+		++bucket_index;
+	}
+
+	return bucket_index;
+}
+
 //-- interface -----
 class IUSBApi
 {
@@ -62,6 +114,8 @@ public:
 
 	virtual bool startup() = 0;
 	virtual void poll() = 0;
+	// Makes a poll() blocked on another thread return early. Safe to call from any thread.
+	virtual void interrupt_poll() = 0;
 	virtual void shutdown() = 0;
 
 	virtual USBDeviceEnumerator* device_enumerator_create() = 0;
@@ -99,6 +153,7 @@ public:
 	virtual const USBRequestPayload_BulkTransfer &getTransferRequest() const = 0;
 	virtual t_usb_device_handle getUSBDeviceHandle() const = 0;
 	virtual int getActiveTransferCount() const = 0;
+	virtual void getTransferStatistics(USBBulkTransferStatistics &out_statistics) const = 0;
 };
 
 #endif // USB_API_INTERFACE_H
@@ -0,0 +1,703 @@
+//-- includes -----
+#include "WinUSBApi.h"
+#include "WinUSBBulkTransferBundle.h"
+#include "LibUSBBulkTransferBundle.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+#include "USBDeviceInfo.h"
+#include "USBDeviceRequest.h"
+#include "USBDeviceManager.h"
+
+#include <setupapi.h>
+#include <initguid.h>
+#include <usbiodef.h>
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+//-- constants -----
+// Completion packets drained per call to GetQueuedCompletionStatusEx()
+static const ULONG k_max_completions_per_poll = 32;
+
+// Same wait as LibUSBApi::poll()
+static const DWORD k_poll_timeout_ms = 50;
+
+//-- definitions -----
+struct WinUSBAPIContext
+{
+	HANDLE completion_port;
+};
+
+struct WinUSBDeviceInfo
+{
+	std::string device_interface_path;
+	std::string port_path;
+	uint16_t vendor_id;
+	uint16_t product_id;
+};
+
+struct WinUSBDeviceEnumerator : USBDeviceEnumerator
+{
+	std::vector<WinUSBDeviceInfo> *device_list;
+};
+
+// Heap copy of a control or interrupt request while its overlapped I/O is in flight
+struct WinUSBRequestOp
+{
+	WinUSBOverlappedOp op;
+	USBTransferRequestState requestState;
+};
+
+//-- private methods -----
+static void winusb_enumerate_devices(std::vector<WinUSBDeviceInfo> &out_devices);
+static bool winusb_open_device_handles(const std::string &device_interface_path, HANDLE &out_file_handle, WINUSB_INTERFACE_HANDLE &out_winusb_handle, DWORD &out_error);
+static void winusb_close_device_handles(HANDLE file_handle, WINUSB_INTERFACE_HANDLE winusb_handle);
+static eUSBResultCode winusb_error_to_result_code(DWORD error);
+static void interrupt_transfer_completed(WinUSBRequestOp *requestOp);
+static void control_transfer_completed(WinUSBRequestOp *requestOp);
+
+//-- public interface -----
+WinUSBApi::WinUSBApi() : IUSBApi()
+{
+	m_apiContext = new WinUSBAPIContext;
+	m_apiContext->completion_port = NULL;
+	m_transferBufferPool = new LibUSBTransferBufferPool;
+}
+
+WinUSBApi::~WinUSBApi()
+{
+	delete m_transferBufferPool;
+	delete m_apiContext;
+}
+
+bool WinUSBApi::startup()
+{
+	// One port for every opened device, only ever waited on by the USB worker thread
+	m_apiContext->completion_port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1);
+
+	if (m_apiContext->completion_port == NULL)
+	{
+		SERVER_LOG_ERROR("WinUSBApi::startup") << "Failed to create I/O completion port: " << GetLastError();
+	}
+
+	return m_apiContext->completion_port != NULL;
+}
+
+void WinUSBApi::poll()
+{
+	OVERLAPPED_ENTRY completions[k_max_completions_per_poll];
+	ULONG completion_count = 0;
+
+	// Services every transfer that finished, or waits up to the poll timeout for one to
+	if (GetQueuedCompletionStatusEx(
+			m_apiContext->completion_port,
+			completions,
+			k_max_completions_per_poll,
+			&completion_count,
+			k_poll_timeout_ms,
+			FALSE))
+	{
+		for (ULONG completion_index = 0; completion_index < completion_count; ++completion_index)
+		{
+			// Packets from interrupt_poll() don't carry an OVERLAPPED
+			if (completions[completion_index].lpOverlapped == nullptr)
+			{
+				continue;
+			}
+
+			WinUSBOverlappedOp *op = reinterpret_cast<WinUSBOverlappedOp *>(completions[completion_index].lpOverlapped);
+
+			switch (op->op_type)
+			{
+			case _WinUSBOpType_BulkTransfer:
+				static_cast<WinUSBBulkTransferBundle *>(op->owner)->handleTransferCompletion(op);
+				break;
+			case _WinUSBOpType_ControlTransfer:
+				control_transfer_completed(static_cast<WinUSBRequestOp *>(op->owner));
+				break;
+			case _WinUSBOpType_InterruptTransfer:
+				interrupt_transfer_completed(static_cast<WinUSBRequestOp *>(op->owner));
+				break;
+			default:
+				assert(0 && "unreachable");
+				break;
+			}
+		}
+	}
+}
+
+void WinUSBApi::interrupt_poll()
+{
+	// Wake up the completion wait so newly queued requests don't wait out the poll timeout
+	if (m_apiContext->completion_port != NULL)
+	{
+		PostQueuedCompletionStatus(m_apiContext->completion_port, 0, 0, nullptr);
+	}
+}
+
+void WinUSBApi::shutdown()
+{
+	if (m_apiContext->completion_port != NULL)
+	{
+		CloseHandle(m_apiContext->completion_port);
+		m_apiContext->completion_port = NULL;
+	}
+}
+
+USBDeviceEnumerator* WinUSBApi::device_enumerator_create()
+{
+	WinUSBDeviceEnumerator *winusb_enumerator = new WinUSBDeviceEnumerator;
+
+	winusb_enumerator->device_index = 0;
+	winusb_enumerator->device_list = new std::vector<WinUSBDeviceInfo>;
+	winusb_enumerate_devices(*winusb_enumerator->device_list);
+
+	return winusb_enumerator;
+}
+
+bool WinUSBApi::device_enumerator_is_valid(USBDeviceEnumerator* enumerator)
+{
+	WinUSBDeviceEnumerator *winusb_enumerator = static_cast<WinUSBDeviceEnumerator *>(enumerator);
+
+	return winusb_enumerator->device_index < static_cast<int>(winusb_enumerator->device_list->size());
+}
+
+bool WinUSBApi::device_enumerator_get_filter(const USBDeviceEnumerator* enumerator, USBDeviceFilter *outDeviceInfo) const
+{
+	const WinUSBDeviceEnumerator *winusb_enumerator = static_cast<const WinUSBDeviceEnumerator *>(enumerator);
+	bool bSuccess = false;
+
+	if (winusb_enumerator->device_index < static_cast<int>(winusb_enumerator->device_list->size()))
+	{
+		const WinUSBDeviceInfo &device_info = (*winusb_enumerator->device_list)[winusb_enumerator->device_index];
+
+		outDeviceInfo->product_id = device_info.product_id;
+		outDeviceInfo->vendor_id = device_info.vendor_id;
+		bSuccess = true;
+	}
+
+	return bSuccess;
+}
+
+bool WinUSBApi::device_enumerator_get_path(const USBDeviceEnumerator* enumerator, char *outBuffer, size_t bufferSize) const
+{
+	const WinUSBDeviceEnumerator *winusb_enumerator = static_cast<const WinUSBDeviceEnumerator *>(enumerator);
+	bool bSuccess = false;
+
+	if (winusb_enumerator->device_index < static_cast<int>(winusb_enumerator->device_list->size()))
+	{
+		const WinUSBDeviceInfo &device_info = (*winusb_enumerator->device_list)[winusb_enumerator->device_index];
+
+		// Same format as the libusb device paths
+		int nCharsWritten =
+			ServerUtility::format_string(
+				outBuffer, bufferSize,
+				"USB\\VID_%04X&PID_%04X\\%s",
+				device_info.vendor_id, device_info.product_id, device_info.port_path.c_str());
+
+		bSuccess = (nCharsWritten > 0);
+	}
+
+	return bSuccess;
+}
+
+void WinUSBApi::device_enumerator_next(USBDeviceEnumerator* enumerator)
+{
+	WinUSBDeviceEnumerator *winusb_enumerator = static_cast<WinUSBDeviceEnumerator *>(enumerator);
+
+	if (device_enumerator_is_valid(winusb_enumerator))
+	{
+		++winusb_enumerator->device_index;
+	}
+}
+
+void WinUSBApi::device_enumerator_dispose(USBDeviceEnumerator* enumerator)
+{
+	WinUSBDeviceEnumerator *winusb_enumerator = static_cast<WinUSBDeviceEnumerator *>(enumerator);
+	assert(winusb_enumerator != nullptr);
+
+	delete winusb_enumerator->device_list;
+	delete winusb_enumerator;
+}
+
+USBDeviceState *WinUSBApi::open_usb_device(USBDeviceEnumerator* enumerator)
+{
+	WinUSBDeviceEnumerator *winusb_enumerator = static_cast<WinUSBDeviceEnumerator *>(enumerator);
+	WinUSBDeviceState *winusb_device_state = nullptr;
+
+	if (device_enumerator_is_valid(enumerator))
+	{
+		const WinUSBDeviceInfo &device_info = (*winusb_enumerator->device_list)[winusb_enumerator->device_index];
+		HANDLE file_handle = INVALID_HANDLE_VALUE;
+		WINUSB_INTERFACE_HANDLE winusb_handle = nullptr;
+		DWORD error = ERROR_SUCCESS;
+		bool bOpened = false;
+
+		winusb_device_state = new WinUSBDeviceState;
+		winusb_device_state->clear();
+
+		winusb_device_state->device_interface_path = device_info.device_interface_path;
+		winusb_device_state->port_path = device_info.port_path;
+		winusb_device_state->vendor_id = device_info.vendor_id;
+		winusb_device_state->product_id = device_info.product_id;
+
+		if (winusb_open_device_handles(device_info.device_interface_path, file_handle, winusb_handle, error))
+		{
+			winusb_device_state->device_file_handle = file_handle;
+			winusb_device_state->winusb_interface_handle = winusb_handle;
+
+			// Completions of everything submitted on the device now show up in poll()
+			if (CreateIoCompletionPort(file_handle, m_apiContext->completion_port, 0, 0) != NULL)
+			{
+				bOpened = true;
+
+				SERVER_LOG_INFO("WinUSBApi::openUSBDevice") << "Successfully opened device " << winusb_device_state->public_handle;
+			}
+			else
+			{
+				SERVER_LOG_ERROR("WinUSBApi::openUSBDevice") << "Failed to attach USB device to the completion port: " << GetLastError();
+			}
+		}
+		else
+		{
+			SERVER_LOG_ERROR("WinUSBApi::openUSBDevice") << "Failed to open USB device: " << error;
+		}
+
+		if (!bOpened)
+		{
+			close_usb_device(winusb_device_state);
+			winusb_device_state = nullptr;
+		}
+	}
+
+	return winusb_device_state;
+}
+
+void WinUSBApi::close_usb_device(USBDeviceState* device_state)
+{
+	if (device_state != nullptr)
+	{
+		WinUSBDeviceState *winusb_device_state = static_cast<WinUSBDeviceState *>(device_state);
+
+		if (winusb_device_state->device_file_handle != nullptr)
+		{
+			SERVER_LOG_INFO("WinUSBApi::closeUSBDevice") << "Close USB device on handle " << winusb_device_state->public_handle;
+			winusb_close_device_handles(
+				static_cast<HANDLE>(winusb_device_state->device_file_handle),
+				static_cast<WINUSB_INTERFACE_HANDLE>(winusb_device_state->winusb_interface_handle));
+			winusb_device_state->device_file_handle = nullptr;
+			winusb_device_state->winusb_interface_handle = nullptr;
+		}
+
+		delete winusb_device_state;
+	}
+}
+
+bool WinUSBApi::can_usb_device_be_opened(USBDeviceEnumerator* enumerator, char *outReason, size_t bufferSize)
+{
+	WinUSBDeviceEnumerator *winusb_enumerator = static_cast<WinUSBDeviceEnumerator *>(enumerator);
+	bool bCanBeOpened = false;
+
+	if (device_enumerator_is_valid(enumerator))
+	{
+		const WinUSBDeviceInfo &device_info = (*winusb_enumerator->device_list)[winusb_enumerator->device_index];
+		HANDLE file_handle = INVALID_HANDLE_VALUE;
+		WINUSB_INTERFACE_HANDLE winusb_handle = nullptr;
+		DWORD error = ERROR_SUCCESS;
+
+		// Can be opened if we can open the device now or it's already opened
+		if (winusb_open_device_handles(device_info.device_interface_path, file_handle, winusb_handle, error))
+		{
+			strncpy(outReason, "SUCCESS(can be opened)", bufferSize);
+			winusb_close_device_handles(file_handle, winusb_handle);
+			bCanBeOpened = true;
+		}
+		else if (error == ERROR_ACCESS_DENIED)
+		{
+			strncpy(outReason, "SUCCESS(already opened)", bufferSize);
+			bCanBeOpened = true;
+		}
+		else
+		{
+			ServerUtility::format_string(outReason, bufferSize, "FAILED(WinUSB open error %d)", static_cast<int>(error));
+		}
+	}
+
+	return bCanBeOpened;
+}
+
+eUSBResultCode WinUSBApi::submit_interrupt_transfer(
+	const USBDeviceState* device_state,
+	const USBTransferRequestState *requestState)
+{
+	const WinUSBDeviceState *winusb_device_state = static_cast<const WinUSBDeviceState *>(device_state);
+	WINUSB_INTERFACE_HANDLE winusb_handle = static_cast<WINUSB_INTERFACE_HANDLE>(winusb_device_state->winusb_interface_handle);
+
+	// Make a copy of the request on the heap so that it's safe
+	// to point to while the overlapped I/O is in flight
+	WinUSBRequestOp *requestOp = new WinUSBRequestOp;
+	memset(&requestOp->op, 0, sizeof(WinUSBOverlappedOp));
+	requestOp->op.op_type = _WinUSBOpType_InterruptTransfer;
+	requestOp->op.winusb_interface_handle = winusb_handle;
+	requestOp->op.owner = requestOp;
+	requestOp->requestState.request = requestState->request;
+	requestOp->requestState.callback = requestState->callback;
+
+	USBRequestPayload_InterruptTransfer &request = requestOp->requestState.request.payload.interrupt_transfer;
+	ULONG timeout_ms = request.timeout;
+	BOOL bSubmitResult = FALSE;
+
+	WinUsb_SetPipePolicy(winusb_handle, request.endpoint, PIPE_TRANSFER_TIMEOUT, sizeof(timeout_ms), &timeout_ms);
+
+	if ((request.endpoint & USB_ENDPOINT_IN) != 0)
+	{
+		bSubmitResult = WinUsb_ReadPipe(winusb_handle, request.endpoint, request.data, request.length, nullptr, &requestOp->op.overlapped);
+	}
+	else
+	{
+		bSubmitResult = WinUsb_WritePipe(winusb_handle, request.endpoint, request.data, request.length, nullptr, &requestOp->op.overlapped);
+	}
+
+	eUSBResultCode result_code = _USBResultCode_Started;
+	if (!bSubmitResult && GetLastError() != ERROR_IO_PENDING)
+	{
+		result_code = _USBResultCode_SubmitFailed;
+		delete requestOp;
+	}
+
+	return result_code;
+}
+
+static void interrupt_transfer_completed(WinUSBRequestOp *requestOp)
+{
+	const USBRequestPayload_InterruptTransfer *request = &requestOp->requestState.request.payload.interrupt_transfer;
+
+	DWORD bytes_transferred = 0;
+	const BOOL bCompleted = WinUsb_GetOverlappedResult(requestOp->op.winusb_interface_handle, &requestOp->op.overlapped, &bytes_transferred, FALSE);
+
+	USBTransferResult result;
+
+	memset(&result, 0, sizeof(USBTransferResult));
+	result.result_type = _USBResultType_InterrupTransfer;
+	result.payload.control_transfer.usb_device_handle = request->usb_device_handle;
+
+	if ((request->endpoint & USB_ENDPOINT_IN) != 0 && bytes_transferred > 0)
+	{
+		// WinUSB wrote the result on the request data buffer since that's the buffer pointer we gave it
+		memcpy(&result.payload.control_transfer.data, request->data, bytes_transferred);
+	}
+	result.payload.control_transfer.dataLength = bytes_transferred;
+	result.payload.control_transfer.result_code = bCompleted ? _USBResultCode_Completed : winusb_error_to_result_code(GetLastError());
+
+	// Add the result to the outgoing result queue
+	usb_device_post_transfer_result(result, requestOp->requestState.callback);
+
+	// Free request state stored in the heap now that the result is posted
+	delete requestOp;
+}
+
+eUSBResultCode WinUSBApi::submit_control_transfer(
+	const USBDeviceState* device_state,
+	const USBTransferRequestState *requestState)
+{
+	const WinUSBDeviceState *winusb_device_state = static_cast<const WinUSBDeviceState *>(device_state);
+	WINUSB_INTERFACE_HANDLE winusb_handle = static_cast<WINUSB_INTERFACE_HANDLE>(winusb_device_state->winusb_interface_handle);
+
+	// Make a copy of the request on the heap so that it's safe
+	// to point to while the overlapped I/O is in flight
+	WinUSBRequestOp *requestOp = new WinUSBRequestOp;
+	memset(&requestOp->op, 0, sizeof(WinUSBOverlappedOp));
+	requestOp->op.op_type = _WinUSBOpType_ControlTransfer;
+	requestOp->op.winusb_interface_handle = winusb_handle;
+	requestOp->op.owner = requestOp;
+	requestOp->requestState.request = requestState->request;
+	requestOp->requestState.callback = requestState->callback;
+
+	USBRequestPayload_ControlTransfer &request = requestOp->requestState.request.payload.control_transfer;
+	ULONG timeout_ms = request.timeout;
+
+	WINUSB_SETUP_PACKET setup_packet;
+	setup_packet.RequestType = request.bmRequestType;
+	setup_packet.Request = request.bRequest;
+	setup_packet.Value = request.wValue;
+	setup_packet.Index = request.wIndex;
+	setup_packet.Length = request.wLength;
+
+	WinUsb_SetPipePolicy(winusb_handle, 0, PIPE_TRANSFER_TIMEOUT, sizeof(timeout_ms), &timeout_ms);
+
+	// OUT transfers send the request data, IN transfers read back into it
+	const BOOL bSubmitResult =
+		WinUsb_ControlTransfer(
+			winusb_handle,
+			setup_packet,
+			request.data,
+			request.wLength,
+			nullptr,
+			&requestOp->op.overlapped);
+
+	eUSBResultCode result_code = _USBResultCode_Started;
+	if (!bSubmitResult && GetLastError() != ERROR_IO_PENDING)
+	{
+		result_code = _USBResultCode_SubmitFailed;
+		delete requestOp;
+	}
+
+	return result_code;
+}
+
+static void control_transfer_completed(WinUSBRequestOp *requestOp)
+{
+	const USBRequestPayload_ControlTransfer *request = &requestOp->requestState.request.payload.control_transfer;
+
+	DWORD bytes_transferred = 0;
+	const BOOL bCompleted = WinUsb_GetOverlappedResult(requestOp->op.winusb_interface_handle, &requestOp->op.overlapped, &bytes_transferred, FALSE);
+
+	USBTransferResult result;
+
+	memset(&result, 0, sizeof(USBTransferResult));
+	result.result_type = _USBResultType_ControlTransfer;
+	result.payload.control_transfer.usb_device_handle = request->usb_device_handle;
+
+	if ((request->bmRequestType & USB_ENDPOINT_IN) != 0 && bytes_transferred > 0)
+	{
+		memcpy(&result.payload.control_transfer.data, request->data, bytes_transferred);
+	}
+	result.payload.control_transfer.dataLength = bytes_transferred;
+	result.payload.control_transfer.result_code = bCompleted ? _USBResultCode_Completed : winusb_error_to_result_code(GetLastError());
+
+	// Add the result to the outgoing result queue
+	usb_device_post_transfer_result(result, requestOp->requestState.callback);
+
+	// Free request state stored in the heap now that the result is posted
+	delete requestOp;
+}
+
+IUSBBulkTransferBundle *WinUSBApi::allocate_bulk_transfer_bundle(const USBDeviceState *device_state, const USBRequestPayload_BulkTransfer *request)
+{
+	return new WinUSBBulkTransferBundle(device_state, request, m_transferBufferPool);
+}
+
+bool WinUSBApi::get_usb_device_filter(const USBDeviceState* device_state, struct USBDeviceFilter *outDeviceInfo) const
+{
+	bool bSuccess = false;
+
+	if (device_state != nullptr)
+	{
+		const WinUSBDeviceState *winusb_device_state = static_cast<const WinUSBDeviceState *>(device_state);
+
+		outDeviceInfo->product_id = winusb_device_state->product_id;
+		outDeviceInfo->vendor_id = winusb_device_state->vendor_id;
+		bSuccess = true;
+	}
+
+	return bSuccess;
+}
+
+bool WinUSBApi::get_usb_device_path(USBDeviceState* device_state, char *outBuffer, size_t bufferSize) const
+{
+	bool bSuccess = false;
+
+	if (device_state != nullptr)
+	{
+		WinUSBDeviceState *winusb_device_state = static_cast<WinUSBDeviceState *>(device_state);
+
+		int nCharsWritten =
+			ServerUtility::format_string(
+				outBuffer, bufferSize,
+				"USB\\VID_%04X&PID_%04X\\%s",
+				winusb_device_state->vendor_id, winusb_device_state->product_id, winusb_device_state->port_path.c_str());
+
+		bSuccess = (nCharsWritten > 0);
+	}
+
+	return bSuccess;
+}
+
+bool WinUSBApi::get_usb_device_port_path(USBDeviceState* device_state, char *outBuffer, size_t bufferSize) const
+{
+	bool bSuccess = false;
+
+	if (device_state != nullptr)
+	{
+		WinUSBDeviceState *winusb_device_state = static_cast<WinUSBDeviceState *>(device_state);
+
+		bSuccess = ServerUtility::format_string(outBuffer, bufferSize, "%s", winusb_device_state->port_path.c_str()) > 0;
+	}
+
+	return bSuccess;
+}
+
+//-- private helpers -----
+static void winusb_enumerate_devices(std::vector<WinUSBDeviceInfo> &out_devices)
+{
+	HDEVINFO device_info_set =
+		SetupDiGetClassDevsA(&GUID_DEVINTERFACE_USB_DEVICE, NULL, NULL, DIGCF_PRESENT | DIGCF_DEVICEINTERFACE);
+
+	if (device_info_set == INVALID_HANDLE_VALUE)
+	{
+		SERVER_LOG_INFO("usb_enumerate") << "Unable to fetch device list.";
+		return;
+	}
+
+	SP_DEVICE_INTERFACE_DATA interface_data;
+	interface_data.cbSize = sizeof(SP_DEVICE_INTERFACE_DATA);
+
+	for (DWORD interface_index = 0;
+		SetupDiEnumDeviceInterfaces(device_info_set, NULL, &GUID_DEVINTERFACE_USB_DEVICE, interface_index, &interface_data);
+		++interface_index)
+	{
+		DWORD detail_size = 0;
+		SetupDiGetDeviceInterfaceDetailA(device_info_set, &interface_data, NULL, 0, &detail_size, NULL);
+
+		std::vector<char> detail_buffer(detail_size > 0 ? detail_size : sizeof(SP_DEVICE_INTERFACE_DETAIL_DATA_A));
+		SP_DEVICE_INTERFACE_DETAIL_DATA_A *detail = reinterpret_cast<SP_DEVICE_INTERFACE_DETAIL_DATA_A *>(detail_buffer.data());
+		detail->cbSize = sizeof(SP_DEVICE_INTERFACE_DETAIL_DATA_A);
+
+		SP_DEVINFO_DATA devinfo_data;
+		devinfo_data.cbSize = sizeof(SP_DEVINFO_DATA);
+
+		if (!SetupDiGetDeviceInterfaceDetailA(device_info_set, &interface_data, detail, detail_size, NULL, &devinfo_data))
+		{
+			continue;
+		}
+
+		// Only devices bound to the WinUSB driver can be opened with WinUsb_Initialize()
+		char service_name[64];
+		if (!SetupDiGetDeviceRegistryPropertyA(
+				device_info_set, &devinfo_data, SPDRP_SERVICE, NULL,
+				reinterpret_cast<PBYTE>(service_name), sizeof(service_name), NULL) ||
+			_stricmp(service_name, "WinUSB") != 0)
+		{
+			continue;
+		}
+
+		// Interface paths look like \\?\usb#vid_1415&pid_2000#<instance>#{guid}
+		WinUSBDeviceInfo device_info;
+		unsigned int vendor_id = 0;
+		unsigned int product_id = 0;
+		const char *vid_token = strstr(detail->DevicePath, "vid_");
+		const char *pid_token = strstr(detail->DevicePath, "pid_");
+
+		if (vid_token == nullptr || pid_token == nullptr ||
+			sscanf(vid_token, "vid_%4x", &vendor_id) != 1 ||
+			sscanf(pid_token, "pid_%4x", &product_id) != 1)
+		{
+			continue;
+		}
+
+		device_info.device_interface_path = detail->DevicePath;
+		device_info.vendor_id = static_cast<uint16_t>(vendor_id);
+		device_info.product_id = static_cast<uint16_t>(product_id);
+
+		// Location comes back as "Port_#0002.Hub_#0003"
+		char location[128];
+		int port_number = 0;
+		int hub_number = 0;
+		char port_path[32];
+
+		if (SetupDiGetDeviceRegistryPropertyA(
+				device_info_set, &devinfo_data, SPDRP_LOCATION_INFORMATION, NULL,
+				reinterpret_cast<PBYTE>(location), sizeof(location), NULL) &&
+			sscanf(location, "Port_#%d.Hub_#%d", &port_number, &hub_number) == 2)
+		{
+			ServerUtility::format_string(port_path, sizeof(port_path), "h%d_p%d", hub_number, port_number);
+		}
+		else
+		{
+			ServerUtility::format_string(port_path, sizeof(port_path), "i%d", static_cast<int>(devinfo_data.DevInst));
+		}
+		device_info.port_path = port_path;
+
+		out_devices.push_back(device_info);
+	}
+
+	SetupDiDestroyDeviceInfoList(device_info_set);
+}
+
+static bool winusb_open_device_handles(
+	const std::string &device_interface_path,
+	HANDLE &out_file_handle,
+	WINUSB_INTERFACE_HANDLE &out_winusb_handle,
+	DWORD &out_error)
+{
+	bool bSuccess = false;
+
+	out_file_handle =
+		CreateFileA(
+			device_interface_path.c_str(),
+			GENERIC_READ | GENERIC_WRITE,
+			FILE_SHARE_READ | FILE_SHARE_WRITE,
+			NULL,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED,
+			NULL);
+	out_winusb_handle = nullptr;
+	out_error = ERROR_SUCCESS;
+
+	if (out_file_handle != INVALID_HANDLE_VALUE)
+	{
+		if (WinUsb_Initialize(out_file_handle, &out_winusb_handle))
+		{
+			bSuccess = true;
+		}
+		else
+		{
+			out_error = GetLastError();
+			CloseHandle(out_file_handle);
+			out_file_handle = INVALID_HANDLE_VALUE;
+			out_winusb_handle = nullptr;
+		}
+	}
+	else
+	{
+		out_error = GetLastError();
+	}
+
+	return bSuccess;
+}
+
+static void winusb_close_device_handles(HANDLE file_handle, WINUSB_INTERFACE_HANDLE winusb_handle)
+{
+	if (winusb_handle != nullptr)
+	{
+		WinUsb_Free(winusb_handle);
+	}
+
+	if (file_handle != nullptr && file_handle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(file_handle);
+	}
+}
+
+static eUSBResultCode winusb_error_to_result_code(DWORD error)
+{
+	eUSBResultCode result_code;
+
+	switch (error)
+	{
+	case ERROR_SEM_TIMEOUT:
+		result_code = _USBResultCode_TimedOut;
+		break;
+	case ERROR_OPERATION_ABORTED:
+		result_code = _USBResultCode_Canceled;
+		break;
+	case ERROR_GEN_FAILURE:
+		// What a stalled endpoint comes back as
+		result_code = _USBResultCode_Pipe;
+		break;
+	case ERROR_DEVICE_NOT_CONNECTED:
+	case ERROR_BAD_COMMAND:
+	case ERROR_INVALID_HANDLE:
+		result_code = _USBResultCode_DeviceNotOpen;
+		break;
+	case ERROR_MORE_DATA:
+		result_code = _USBResultCode_Overflow;
+		break;
+	default:
+		result_code = _USBResultCode_GeneralError;
+	}
+
+	return result_code;
+}
@@ -0,0 +1,74 @@
+#ifndef WIN_USB_API_H
+#define WIN_USB_API_H
+
+#include "USBApiInterface.h"
+
+#include <string>
+
+struct WinUSBDeviceState : USBDeviceState
+{
+	std::string device_interface_path;
+	std::string port_path;
+	uint16_t vendor_id;
+	uint16_t product_id;
+
+	// HANDLE and WINUSB_INTERFACE_HANDLE, kept opaque so this header doesn't pull in windows.h
+	void *device_file_handle;
+	void *winusb_interface_handle;
+
+	void clear()
+	{
+		USBDeviceState::clear();
+
+		device_interface_path.clear();
+		port_path.clear();
+		vendor_id= 0;
+		product_id= 0;
+		device_file_handle= nullptr;
+		winusb_interface_handle= nullptr;
+	}
+};
+
+/// USB transfers through the WinUSB driver on Windows.
+/**
+ Every device gets opened for overlapped I/O and associated with a single
+ I/O completion port, so poll() services the completions of all of the
+ control, interrupt and bulk transfers in flight with one wait.
+ Only devices bound to the WinUSB driver (e.g. with Zadig) show up in the enumeration.
+ */
+class WinUSBApi : public IUSBApi
+{
+public:
+	WinUSBApi();
+	virtual ~WinUSBApi();
+
+	bool startup() override;
+	void poll() override;
+	void interrupt_poll() override;
+	void shutdown() override;
+
+	USBDeviceEnumerator* device_enumerator_create() override;
+	bool device_enumerator_get_filter(const USBDeviceEnumerator* enumerator, struct USBDeviceFilter *outDeviceInfo) const override;
+	bool device_enumerator_get_path(const USBDeviceEnumerator* enumerator, char *outBuffer, size_t bufferSize) const override;
+	bool device_enumerator_is_valid(USBDeviceEnumerator* enumerator) override;
+	void device_enumerator_next(USBDeviceEnumerator* enumerator) override;
+	void device_enumerator_dispose(USBDeviceEnumerator* enumerator) override;
+
+	USBDeviceState *open_usb_device(USBDeviceEnumerator* enumerator) override;
+	void close_usb_device(USBDeviceState* device_state) override;
+	bool can_usb_device_be_opened(struct USBDeviceEnumerator* enumerator, char *outReason, size_t bufferSize) override;
+
+	eUSBResultCode submit_interrupt_transfer(const USBDeviceState* device_state, const struct USBTransferRequestState *requestState) override;
+	eUSBResultCode submit_control_transfer(const USBDeviceState* device_state, const struct USBTransferRequestState *requestState) override;
+	IUSBBulkTransferBundle *allocate_bulk_transfer_bundle(const USBDeviceState *device_state, const struct USBRequestPayload_BulkTransfer *request) override;
+
+	bool get_usb_device_filter(const USBDeviceState* device_state, struct USBDeviceFilter *outDeviceInfo) const override;
+	bool get_usb_device_path(USBDeviceState* device_state, char *outBuffer, size_t bufferSize) const override;
+	bool get_usb_device_port_path(USBDeviceState* device_state, char *outBuffer, size_t bufferSize) const override;
+
+private:
+	struct WinUSBAPIContext *m_apiContext;
+	class LibUSBTransferBufferPool *m_transferBufferPool;
+};
+
+#endif // WIN_USB_API_H
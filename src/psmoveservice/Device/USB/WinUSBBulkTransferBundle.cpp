@@ -0,0 +1,390 @@
+//-- includes -----
+#include "WinUSBBulkTransferBundle.h"
+#include "WinUSBApi.h"
+#include "LibUSBBulkTransferBundle.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+#include "USBDeviceRequest.h"
+#include "WakeupSignal.h"
+
+#include <assert.h>
+#include <cstring>
+
+//-- constants -----
+// Transfer packets within a buffer start on a cache line
+static const size_t k_transfer_packet_alignment = 64;
+
+//-- private methods -----
+static inline size_t round_up_to_alignment(size_t byte_size, size_t alignment)
+{
+	return ((byte_size + alignment - 1) / alignment) * alignment;
+}
+
+static inline void atomic_store_max(std::atomic<uint64_t> &value, uint64_t sample)
+{
+	uint64_t current = value.load(std::memory_order_relaxed);
+
+	while (sample > current && !value.compare_exchange_weak(current, sample, std::memory_order_relaxed))
+	{
+	}
+}
+
+//-- WinUSBBulkTransferBundle -----
+WinUSBBulkTransferBundle::WinUSBBulkTransferBundle(
+	const USBDeviceState *state,
+	const USBRequestPayload_BulkTransfer *request,
+	LibUSBTransferBufferPool *buffer_pool)
+	: IUSBBulkTransferBundle(state, request)
+	, m_request(*request)
+	, m_winusb_handle(static_cast<WINUSB_INTERFACE_HANDLE>(static_cast<const WinUSBDeviceState *>(state)->winusb_interface_handle))
+	, m_buffer_pool(buffer_pool)
+	, m_pipe_id(0)
+	, m_active_transfer_count(0)
+	, m_is_canceled(false)
+	, transfer_ops(nullptr)
+	, transfer_buffer(nullptr)
+	, transfer_buffer_size(0)
+	, transfer_buffer_stride(0)
+	, transfer_submit_time_us(nullptr)
+	, m_completed_transfer_count(0)
+	, m_completed_byte_count(0)
+	, m_dropped_payload_count(0)
+	, m_total_completion_latency_us(0)
+	, m_max_completion_latency_us(0)
+	, m_max_resubmit_gap_us(0)
+{
+	for (int bucket_index = 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+	{
+		m_completion_latency_histogram[bucket_index].store(0);
+	}
+}
+
+WinUSBBulkTransferBundle::~WinUSBBulkTransferBundle()
+{
+	if (m_completed_transfer_count > 0 || m_dropped_payload_count > 0)
+	{
+		USBBulkTransferStatistics stats;
+		getTransferStatistics(stats);
+
+		SERVER_MT_LOG_INFO("WinUSBBulkTransferBundle::destructor") << "USB device " << m_request.usb_device_handle
+			<< " bulk transfers: " << stats.completed_transfer_count << " completed (" << stats.completed_byte_count << " bytes), "
+			<< stats.dropped_payload_count << " dropped, avg latency " << (stats.total_completion_latency_us / (stats.completed_transfer_count > 0 ? stats.completed_transfer_count : 1))
+			<< "us, max latency " << stats.max_completion_latency_us << "us, max resubmit gap " << stats.max_resubmit_gap_us << "us";
+	}
+
+	dispose();
+
+	if (m_active_transfer_count > 0)
+	{
+		SERVER_MT_LOG_INFO("WinUSBBulkTransferBundle::destructor") << "active transfer count non-zero!";
+	}
+}
+
+bool WinUSBBulkTransferBundle::initialize()
+{
+	bool bSuccess = (m_active_transfer_count == 0 && m_winusb_handle != nullptr);
+	WINUSB_PIPE_INFORMATION pipe_info;
+
+	// Find the bulk transfer pipe
+	if (bSuccess)
+	{
+		if (find_bulk_transfer_pipe(m_winusb_handle, pipe_info))
+		{
+			m_pipe_id = pipe_info.PipeId;
+
+			// Same as libusb_clear_halt()
+			WinUsb_ResetPipe(m_winusb_handle, m_pipe_id);
+		}
+		else
+		{
+			bSuccess = false;
+		}
+	}
+
+	// Set up the pipe policies
+	if (bSuccess)
+	{
+		// Reads never time out, the bundle gets canceled instead
+		ULONG pipe_timeout_ms = 0;
+		WinUsb_SetPipePolicy(m_winusb_handle, m_pipe_id, PIPE_TRANSFER_TIMEOUT, sizeof(pipe_timeout_ms), &pipe_timeout_ms);
+
+		// RAW_IO hands the reads straight to the host controller instead of queuing them
+		// in WinUSB, which keeps every in flight packet on the bus. It requires reads
+		// of a whole number of max size packets no bigger than MAXIMUM_TRANSFER_SIZE.
+		ULONG maximum_transfer_size = 0;
+		ULONG value_length = sizeof(maximum_transfer_size);
+		const bool bCanUseRawIO =
+			pipe_info.MaximumPacketSize > 0 &&
+			(m_request.transfer_packet_size % pipe_info.MaximumPacketSize) == 0 &&
+			WinUsb_GetPipePolicy(m_winusb_handle, m_pipe_id, MAXIMUM_TRANSFER_SIZE, &value_length, &maximum_transfer_size) &&
+			static_cast<ULONG>(m_request.transfer_packet_size) <= maximum_transfer_size;
+		UCHAR raw_io = bCanUseRawIO ? TRUE : FALSE;
+
+		if (!WinUsb_SetPipePolicy(m_winusb_handle, m_pipe_id, RAW_IO, sizeof(raw_io), &raw_io) || !bCanUseRawIO)
+		{
+			SERVER_MT_LOG_INFO("WinUSBBulkTransferBundle::initialize") << "RAW_IO disabled on USB device " << m_request.usb_device_handle
+				<< " (transfer size " << m_request.transfer_packet_size << ", max packet size " << pipe_info.MaximumPacketSize << ")";
+		}
+	}
+
+	// Allocate the transfer buffer
+	if (bSuccess)
+	{
+		// Allocate the transfer buffer that the reads write data into
+		transfer_buffer_stride = round_up_to_alignment(m_request.transfer_packet_size, k_transfer_packet_alignment);
+		transfer_buffer_size = m_request.in_flight_transfer_packet_count * transfer_buffer_stride;
+		transfer_buffer = m_buffer_pool->allocate(transfer_buffer_size);
+
+		if (transfer_buffer == nullptr)
+		{
+			bSuccess = false;
+		}
+	}
+
+	// Allocate the per-transfer submit timestamps used for the latency counters
+	if (bSuccess)
+	{
+		transfer_submit_time_us = new long long[m_request.in_flight_transfer_packet_count];
+		memset(transfer_submit_time_us, 0, m_request.in_flight_transfer_packet_count * sizeof(long long));
+	}
+
+	// Allocate and initialize the overlapped reads
+	if (bSuccess)
+	{
+		transfer_ops = new WinUSBOverlappedOp[m_request.in_flight_transfer_packet_count];
+
+		for (int transfer_index = 0; transfer_index < m_request.in_flight_transfer_packet_count; ++transfer_index)
+		{
+			WinUSBOverlappedOp &op = transfer_ops[transfer_index];
+
+			memset(&op, 0, sizeof(WinUSBOverlappedOp));
+			op.op_type = _WinUSBOpType_BulkTransfer;
+			op.winusb_interface_handle = m_winusb_handle;
+			op.owner = this;
+		}
+	}
+
+	return bSuccess;
+}
+
+void WinUSBBulkTransferBundle::dispose()
+{
+	assert(m_active_transfer_count == 0);
+
+	if (transfer_buffer != nullptr)
+	{
+		m_buffer_pool->release(transfer_buffer, transfer_buffer_size);
+		transfer_buffer = nullptr;
+		transfer_buffer_size = 0;
+	}
+
+	if (transfer_submit_time_us != nullptr)
+	{
+		delete[] transfer_submit_time_us;
+		transfer_submit_time_us = nullptr;
+	}
+
+	if (transfer_ops != nullptr)
+	{
+		delete[] transfer_ops;
+		transfer_ops = nullptr;
+	}
+}
+
+bool WinUSBBulkTransferBundle::startTransfers()
+{
+	bool bSuccess = (m_active_transfer_count == 0 && !m_is_canceled && transfer_ops != nullptr);
+
+	// Start the transfers
+	if (bSuccess)
+	{
+		for (int transfer_index = 0; transfer_index < m_request.in_flight_transfer_packet_count; ++transfer_index)
+		{
+			if (submitTransfer(transfer_index))
+			{
+				++m_active_transfer_count;
+			}
+			else
+			{
+				bSuccess = false;
+				break;
+			}
+		}
+	}
+
+	return bSuccess;
+}
+
+bool WinUSBBulkTransferBundle::submitTransfer(int transfer_index)
+{
+	WinUSBOverlappedOp &op = transfer_ops[transfer_index];
+
+	// The completion port posts a packet whether the read finishes right away or later
+	memset(&op.overlapped, 0, sizeof(OVERLAPPED));
+	transfer_submit_time_us[transfer_index] = ServerUtility::get_service_time_us();
+
+	const BOOL bReadResult =
+		WinUsb_ReadPipe(
+			m_winusb_handle,
+			m_pipe_id,
+			transfer_buffer + transfer_index*transfer_buffer_stride,
+			m_request.transfer_packet_size,
+			nullptr,
+			&op.overlapped);
+
+	return bReadResult || GetLastError() == ERROR_IO_PENDING;
+}
+
+void WinUSBBulkTransferBundle::handleTransferCompletion(WinUSBOverlappedOp *op)
+{
+	const int transfer_index = getTransferIndex(op);
+	const long long completion_time_us = ServerUtility::get_service_time_us();
+	unsigned char *buffer = transfer_buffer + transfer_index*transfer_buffer_stride;
+
+	DWORD bytes_transferred = 0;
+	const bool bCompleted = WinUsb_GetOverlappedResult(m_winusb_handle, &op->overlapped, &bytes_transferred, FALSE) != FALSE;
+	const bool bAborted = !bCompleted && GetLastError() == ERROR_OPERATION_ABORTED;
+
+	if (!bAborted)
+	{
+		const long long latency_us = completion_time_us - transfer_submit_time_us[transfer_index];
+		const uint64_t latency_sample = latency_us > 0 ? static_cast<uint64_t>(latency_us) : 0;
+
+		if (bCompleted)
+		{
+			m_completed_transfer_count.fetch_add(1, std::memory_order_relaxed);
+			m_completed_byte_count.fetch_add(bytes_transferred, std::memory_order_relaxed);
+			m_total_completion_latency_us.fetch_add(latency_sample, std::memory_order_relaxed);
+			atomic_store_max(m_max_completion_latency_us, latency_sample);
+			m_completion_latency_histogram[usb_latency_histogram_bucket_index(latency_sample)].fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			m_dropped_payload_count.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	if (bCompleted)
+	{
+		// NOTE: This is getting executed on the worker thread!
+		// It should not:
+		// 1) Do any expensive work
+		// 2) Call any blocking functions
+		// 3) Access data on the main thread, unless it can do so in an atomic way
+		m_request.on_data_callback(
+			buffer,
+			static_cast<int>(bytes_transferred),
+			m_request.transfer_callback_userdata);
+
+		// Let the main thread know a new chunk of data is ready
+		WakeupSignal::notifyMainLoop();
+	}
+
+	// See if the request wants to resubmitted the moment it completes.
+	// A read that finished just before WinUsb_AbortPipe() still completes successfully,
+	// so the cancel flag has to be checked too.
+	bool bRestartedTransfer = false;
+	if (!bAborted && !m_is_canceled && m_request.bAutoResubmit)
+	{
+		// Start the read over with the same properties
+		if (submitTransfer(transfer_index))
+		{
+			const long long resubmit_time_us = transfer_submit_time_us[transfer_index];
+			const long long gap_us = resubmit_time_us - completion_time_us;
+
+			atomic_store_max(m_max_resubmit_gap_us, gap_us > 0 ? static_cast<uint64_t>(gap_us) : 0);
+			bRestartedTransfer = true;
+		}
+		else
+		{
+			SERVER_MT_LOG_WARNING("WinUSBBulkTransferBundle::handleTransferCompletion") << "Failed to resubmit bulk transfer for USB device " << m_request.usb_device_handle;
+		}
+	}
+
+	// If the transfer didn't restart update the active transfer count
+	if (!bRestartedTransfer)
+	{
+		assert(m_active_transfer_count > 0);
+		--m_active_transfer_count;
+	}
+}
+
+int WinUSBBulkTransferBundle::getTransferIndex(const WinUSBOverlappedOp *op) const
+{
+	const int transfer_index = static_cast<int>(op - transfer_ops);
+	assert(transfer_index >= 0 && transfer_index < m_request.in_flight_transfer_packet_count);
+
+	return transfer_index;
+}
+
+void WinUSBBulkTransferBundle::cancelTransfers()
+{
+	assert(transfer_ops != nullptr);
+
+	if (!m_is_canceled)
+	{
+		// Every pending read completes with ERROR_OPERATION_ABORTED
+		WinUsb_AbortPipe(m_winusb_handle, m_pipe_id);
+
+		m_is_canceled = true;
+	}
+}
+
+bool WinUSBBulkTransferBundle::find_bulk_transfer_pipe(WINUSB_INTERFACE_HANDLE winusb_handle, WINUSB_PIPE_INFORMATION &out_pipe_info)
+{
+	bool bSuccess = false;
+	USB_INTERFACE_DESCRIPTOR interface_desc;
+
+	if (WinUsb_QueryInterfaceSettings(winusb_handle, 0, &interface_desc))
+	{
+		for (UCHAR pipe_index = 0; pipe_index < interface_desc.bNumEndpoints; ++pipe_index)
+		{
+			WINUSB_PIPE_INFORMATION pipe_info;
+
+			if (WinUsb_QueryPipe(winusb_handle, 0, pipe_index, &pipe_info) &&
+				pipe_info.PipeType == UsbdPipeTypeBulk &&
+				USB_ENDPOINT_DIRECTION_IN(pipe_info.PipeId) &&
+				pipe_info.MaximumPacketSize != 0)
+			{
+				out_pipe_info = pipe_info;
+				bSuccess = true;
+				break;
+			}
+		}
+	}
+
+	return bSuccess;
+}
+
+// Accessors
+const USBRequestPayload_BulkTransfer &WinUSBBulkTransferBundle::getTransferRequest() const
+{
+	return m_request;
+}
+
+t_usb_device_handle WinUSBBulkTransferBundle::getUSBDeviceHandle() const
+{
+	return m_request.usb_device_handle;
+}
+
+int WinUSBBulkTransferBundle::getActiveTransferCount() const
+{
+	return m_active_transfer_count;
+}
+
+void WinUSBBulkTransferBundle::getTransferStatistics(USBBulkTransferStatistics &out_statistics) const
+{
+	out_statistics.in_flight_transfer_count = m_request.in_flight_transfer_packet_count;
+	out_statistics.transfer_packet_size = m_request.transfer_packet_size;
+	out_statistics.completed_transfer_count = m_completed_transfer_count.load(std::memory_order_relaxed);
+	out_statistics.completed_byte_count = m_completed_byte_count.load(std::memory_order_relaxed);
+	out_statistics.dropped_payload_count = m_dropped_payload_count.load(std::memory_order_relaxed);
+	out_statistics.total_completion_latency_us = m_total_completion_latency_us.load(std::memory_order_relaxed);
+	out_statistics.max_completion_latency_us = m_max_completion_latency_us.load(std::memory_order_relaxed);
+	out_statistics.max_resubmit_gap_us = m_max_resubmit_gap_us.load(std::memory_order_relaxed);
+
+	for (int bucket_index = 0; bucket_index < USB_LATENCY_HISTOGRAM_BUCKET_COUNT; ++bucket_index)
+	{
+		out_statistics.completion_latency_histogram[bucket_index] = m_completion_latency_histogram[bucket_index].load(std::memory_order_relaxed);
+	}
+}
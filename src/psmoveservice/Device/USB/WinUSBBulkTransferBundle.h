@@ -0,0 +1,91 @@
+#ifndef WIN_USB_BULK_TRANSFER_BUNDLE_H
+#define WIN_USB_BULK_TRANSFER_BUNDLE_H
+
+//-- includes -----
+#include "USBApiInterface.h"
+#include "USBDeviceRequest.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <winusb.h>
+
+#include <atomic>
+
+//-- constants -----
+enum eWinUSBOverlappedOpType
+{
+	_WinUSBOpType_BulkTransfer,
+	_WinUSBOpType_ControlTransfer,
+	_WinUSBOpType_InterruptTransfer
+};
+
+//-- definitions -----
+/// Every overlapped WinUSB operation starts with one of these,
+/// so WinUSBApi::poll() can route a completion packet back to whoever started it.
+struct WinUSBOverlappedOp
+{
+	OVERLAPPED overlapped; // Must stay the first member, the completion port hands back its address
+	eWinUSBOverlappedOpType op_type;
+	WINUSB_INTERFACE_HANDLE winusb_interface_handle;
+	void *owner;
+};
+
+/// Internal class used to manage a set of overlapped WinUSB bulk reads.
+class WinUSBBulkTransferBundle : public IUSBBulkTransferBundle
+{
+public:
+	WinUSBBulkTransferBundle(
+		const USBDeviceState *device_state,
+		const struct USBRequestPayload_BulkTransfer *request,
+		class LibUSBTransferBufferPool *buffer_pool);
+	virtual ~WinUSBBulkTransferBundle();
+
+	// Interface
+	bool initialize() override;
+	bool startTransfers() override;
+	void cancelTransfers() override;
+
+	// Events
+	// Called by WinUSBApi::poll() on the USB worker thread
+	void handleTransferCompletion(WinUSBOverlappedOp *op);
+
+	// Accessors
+	const USBRequestPayload_BulkTransfer &getTransferRequest() const override;
+	t_usb_device_handle getUSBDeviceHandle() const override;
+	int getActiveTransferCount() const override;
+	void getTransferStatistics(USBBulkTransferStatistics &out_statistics) const override;
+
+	// Helpers
+	// Search for an input bulk pipe in the first alt setting of interface 0
+	static bool find_bulk_transfer_pipe(WINUSB_INTERFACE_HANDLE winusb_handle, WINUSB_PIPE_INFORMATION &out_pipe_info);
+
+protected:
+	void dispose();
+	bool submitTransfer(int transfer_index);
+	int getTransferIndex(const WinUSBOverlappedOp *op) const;
+
+private:
+	USBRequestPayload_BulkTransfer m_request;
+	WINUSB_INTERFACE_HANDLE m_winusb_handle;
+	class LibUSBTransferBufferPool *m_buffer_pool;
+	UCHAR m_pipe_id;
+
+	int m_active_transfer_count;
+	bool m_is_canceled;
+	WinUSBOverlappedOp *transfer_ops;
+	unsigned char* transfer_buffer;
+	size_t transfer_buffer_size;
+	size_t transfer_buffer_stride;
+	long long *transfer_submit_time_us;
+
+	// Written on the USB worker thread, safe to read from any thread
+	std::atomic<uint64_t> m_completed_transfer_count;
+	std::atomic<uint64_t> m_completed_byte_count;
+	std::atomic<uint64_t> m_dropped_payload_count;
+	std::atomic<uint64_t> m_total_completion_latency_us;
+	std::atomic<uint64_t> m_max_completion_latency_us;
+	std::atomic<uint64_t> m_max_resubmit_gap_us;
+	std::atomic<uint64_t> m_completion_latency_histogram[USB_LATENCY_HISTOGRAM_BUCKET_COUNT];
+};
+
+#endif // WIN_USB_BULK_TRANSFER_BUNDLE_H
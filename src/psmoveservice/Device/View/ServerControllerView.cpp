@@ -3,12 +3,18 @@
 
 #include "AtomicPrimitives.h"
 #include "BluetoothRequests.h"
+#include "CompactDataFrame.h"
 #include "ControllerManager.h"
+#include "DeviceInterfaceEigen.h"
 #include "DeviceManager.h"
 #include "MathAlignment.h"
+#include "PackedTrackerData.h"
 #include "ServerLog.h"
+#include "ServerTrace.h"
 #include "ServerRequestHandler.h"
 #include "CompoundPoseFilter.h"
+#include "PoseFilterBatch.h"
+#include "ErrorStateKalmanPoseFilter.h"
 #include "KalmanPoseFilter.h"
 #include "PSDualShock4Controller.h"
 #include "PSMoveController.h"
@@ -18,7 +24,12 @@
 #include "PSMoveProtocol.pb.h"
 #include "ServerUtility.h"
 #include "ServerTrackerView.h"
+#include "SharedPoseInput.h"
+#include "SharedPoseInputReader.h"
+#include "WakeupSignal.h"
 
+#include <algorithm>
+#include <map>
 #include <glm/glm.hpp>
 
 //-- typedefs ----
@@ -29,11 +40,64 @@ using t_high_resolution_duration= t_high_resolution_timepoint::duration;
 static const float k_min_time_delta_seconds = 1 / 2500.f;
 static const float k_max_time_delta_seconds = 1 / 30.f;
 
+// Injected poses come with a variance of their own, this only marks their packets as optical measurements
+static const float k_external_pose_projection_area_px_sqr = 1.f;
+// Most injected poses read out of the shared memory ring at a time
+static const int k_external_pose_read_batch_size = 32;
+
+// Most readings an IMU capture records, a few minutes of PSMove readings (~6MB)
+static const int k_max_imu_capture_sample_count = 65536;
+
+//-- private definitions -----
+// Filter state of a controller that closed, kept around for a quick reconnect
+struct WarmStartPoseFilter
+{
+    CommonDeviceState::eDeviceType device_type;
+    t_high_resolution_timepoint close_timestamp;
+    IPoseFilter *pose_filter;
+    PoseFilterSpace *pose_filter_space;
+};
+typedef std::map<std::string, WarmStartPoseFilter> t_warm_start_pose_filter_map;
+
+// The per sample stages (sensor packet -> filter packet, filter state -> data frame) of one kind of controller.
+// Picked once when the device gets allocated instead of switching on the device type for every sample.
+// Each stage is a template instance bound to the type specific function at compile time,
+// so the cast to the concrete controller and the type specific body inline into one call.
+// A stage the controller type doesn't have is null.
+struct ControllerPipeline
+{
+    CommonDeviceState::eDeviceType device_type;
+
+    void (*post_imu_filter_packets)(
+        const IControllerInterface *device,
+        const CommonDeviceState *sensor_state,
+        const t_high_resolution_timepoint now,
+        const t_high_resolution_duration durationSinceLastUpdate,
+        t_controller_pose_sensor_queue *pose_filter_queue);
+
+    void (*post_optical_filter_packet)(
+        const IControllerInterface *device,
+        const t_high_resolution_timepoint now,
+        const ControllerOpticalPoseEstimation *poseEstimation,
+        t_controller_pose_optical_queue *pose_filter_queue);
+
+    void (*generate_data_frame_for_stream)(
+        const ServerControllerView *controller_view,
+        const ControllerStreamInfo *stream_info,
+        PSMoveProtocol::DeviceOutputDataFrame *data_frame);
+};
+
+//-- globals -----
+// Keyed by controller serial, so the filter state follows the controller to whatever slot it reconnects in
+static t_warm_start_pose_filter_map g_warm_start_pose_filters;
+
 //-- macros -----
 #define SET_BUTTON_BIT(bitmask, bit_index, button_state) \
     bitmask|= (button_state == CommonControllerState::Button_DOWN || button_state == CommonControllerState::Button_PRESSED) ? (0x1 << (bit_index)) : 0x0;
 
 //-- private methods -----
+static const ControllerPipeline *select_controller_pipeline(const CommonDeviceState::eDeviceType deviceType);
+
 static IPoseFilter *pose_filter_factory(
     const CommonDeviceState::eDeviceType deviceType,
     const std::string &position_filter_type,
@@ -53,6 +117,18 @@ static void init_filters_for_virtual_controller(
     PoseFilterSpace **out_pose_filter_space,
     IPoseFilter **out_pose_filter);
 
+static void stash_warm_start_pose_filter(
+    const std::string &serial,
+    const CommonDeviceState::eDeviceType device_type,
+    IPoseFilter *pose_filter,
+    PoseFilterSpace *pose_filter_space);
+static bool claim_warm_start_pose_filter(
+    const std::string &serial,
+    const CommonDeviceState::eDeviceType device_type,
+    const int max_gap_ms,
+    IPoseFilter **out_pose_filter,
+    PoseFilterSpace **out_pose_filter_space);
+
 static void post_imu_filter_packets_for_psmove(
     const PSMoveController *psmove,
 	const PSMoveControllerInputState *psmoveState,
@@ -82,6 +158,13 @@ static void post_optical_filter_packet_for_virtual_controller(
     const t_high_resolution_timepoint now,
     const ControllerOpticalPoseEstimation *poseEstimation,
 	t_controller_pose_optical_queue *pose_filter_queue);
+static bool post_external_filter_packet_for_virtual_controller(
+    const VirtualController *virtual_controller,
+    const ExternalPoseSample &sample,
+    const t_high_resolution_timepoint now,
+    const int64_t now_us,
+    const int64_t max_age_us,
+	t_controller_pose_optical_queue *pose_filter_queue);
 
 static void generate_psmove_data_frame_for_stream(
     const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, PSMoveProtocol::DeviceOutputDataFrame *data_frame);
@@ -91,6 +174,11 @@ static void generate_psdualshock4_data_frame_for_stream(
     const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, PSMoveProtocol::DeviceOutputDataFrame *data_frame);
 static void generate_virtual_controller_data_frame_for_stream(
     const ServerControllerView *controller_view, const ControllerStreamInfo *stream_info, PSMoveProtocol::DeviceOutputDataFrame *data_frame);
+template <typename t_raw_tracker_data>
+static void add_controller_tracker_samples(
+    const ServerControllerView *controller_view,
+    bool bUsePackedTrackerData,
+    t_raw_tracker_data *raw_tracker_data);
 
 static void computeSpherePoseForControllerFromSingleTracker(
     const ServerControllerView *controllerView,
@@ -118,6 +206,223 @@ static void computeLightBarPoseForControllerFromMultipleTrackers(
     ControllerOpticalPoseEstimation *multicam_pose_estimation);
 
 //-- public implementation -----
+void ControllerOpticalNoiseStatistics::clear()
+{
+    target_sample_count = 0;
+    sample_count = 0;
+    projection_area_mean = 0.0;
+    orientation_sample_count = 0;
+    reference_orientation.clear();
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        position_mean_cm[axis] = 0.0;
+        position_m2_cm_sqr[axis] = 0.0;
+        orientation_mean_rad[axis] = 0.0;
+        orientation_m2_rad_sqr[axis] = 0.0;
+    }
+}
+
+void ControllerOpticalNoiseStatistics::addSample(const ControllerOpticalPoseEstimation &pose_estimate)
+{
+    ++sample_count;
+
+    const double N = static_cast<double>(sample_count);
+    const double position_sample_cm[3] = {
+        pose_estimate.position_cm.x, pose_estimate.position_cm.y, pose_estimate.position_cm.z };
+
+    projection_area_mean += (pose_estimate.projection.screen_area - projection_area_mean) / N;
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const double delta = position_sample_cm[axis] - position_mean_cm[axis];
+
+        position_mean_cm[axis] += delta / N;
+        position_m2_cm_sqr[axis] += delta*(position_sample_cm[axis] - position_mean_cm[axis]);
+    }
+
+    if (pose_estimate.bOrientationValid)
+    {
+        const Eigen::Quaternionf orientation(
+            pose_estimate.orientation.w, pose_estimate.orientation.x, pose_estimate.orientation.y, pose_estimate.orientation.z);
+
+        if (orientation_sample_count == 0)
+        {
+            reference_orientation = pose_estimate.orientation;
+        }
+
+        const Eigen::Quaternionf reference(
+            reference_orientation.w, reference_orientation.x, reference_orientation.y, reference_orientation.z);
+
+        // The noise is small, so the rotation vectors around the reference 
+        // are close enough to the angles around the mean
+        Eigen::Quaternionf offset = reference.conjugate()*orientation.normalized();
+        if (offset.w() < 0.f)
+        {
+            offset.coeffs() = -offset.coeffs();
+        }
+
+        const float vector_length = offset.vec().norm();
+        const float angle = 2.f*atan2f(vector_length, offset.w());
+        const Eigen::Vector3f rotation_vector = 
+            (vector_length > k_normal_epsilon) ? Eigen::Vector3f(offset.vec()*(angle / vector_length)) : Eigen::Vector3f::Zero();
+
+        ++orientation_sample_count;
+
+        const double orientation_N = static_cast<double>(orientation_sample_count);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const double delta = rotation_vector[axis] - orientation_mean_rad[axis];
+
+            orientation_mean_rad[axis] += delta / orientation_N;
+            orientation_m2_rad_sqr[axis] += delta*(rotation_vector[axis] - orientation_mean_rad[axis]);
+        }
+    }
+}
+
+float ControllerOpticalNoiseStatistics::getPositionVariance() const
+{
+    double variance = 0.0;
+
+    if (sample_count > 1)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            variance = std::max(variance, position_m2_cm_sqr[axis] / static_cast<double>(sample_count - 1));
+        }
+    }
+
+    return static_cast<float>(variance);
+}
+
+float ControllerOpticalNoiseStatistics::getOrientationVariance() const
+{
+    double variance = 0.0;
+
+    // The squared angle from the mean is the sum of the squared rotation vector components
+    if (orientation_sample_count > 1)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            variance += orientation_m2_rad_sqr[axis] / static_cast<double>(orientation_sample_count - 1);
+        }
+    }
+
+    return static_cast<float>(variance);
+}
+
+void ControllerIMUCaptureSession::clear()
+{
+    target_sample_count = 0;
+    std::vector<ControllerIMUCaptureSample>().swap(samples);
+
+    duration_sec = 0.f;
+    raw_accelerometer_mean = Eigen::Vector3f::Zero();
+    raw_accelerometer_variance = Eigen::Vector3f::Zero();
+    raw_gyroscope_mean = Eigen::Vector3f::Zero();
+    raw_gyroscope_variance = Eigen::Vector3f::Zero();
+    accelerometer_mean_g_units = Eigen::Vector3f::Zero();
+    accelerometer_variance_g_units_sqr = 0.f;
+    accelerometer_noise_radius_g_units = 0.f;
+    gyroscope_variance_rad_per_sec_sqr = 0.f;
+    gyroscope_drift_rate_rad_per_sec = 0.f;
+}
+
+void ControllerIMUCaptureSession::addSample(const PoseSensorPacket &packet)
+{
+    if (!packet.has_accelerometer_measurement || !packet.has_gyroscope_measurement)
+    {
+        return;
+    }
+
+    ControllerIMUCaptureSample sample;
+    sample.timestamp = packet.timestamp;
+    sample.raw_accelerometer = packet.raw_imu_accelerometer;
+    sample.raw_gyroscope = packet.raw_imu_gyroscope;
+    sample.accelerometer_g_units = packet.imu_accelerometer_g_units;
+    sample.gyroscope_rad_per_sec = packet.imu_gyroscope_rad_per_sec;
+    samples.push_back(sample);
+
+    if (getIsComplete())
+    {
+        computeStatistics();
+    }
+}
+
+void ControllerIMUCaptureSession::computeStatistics()
+{
+    const int sample_count = getSampleCount();
+    const double N = static_cast<double>(sample_count);
+
+    // Means first, the variances and the noise radius are taken around them
+    Eigen::Vector3d raw_accel_sum = Eigen::Vector3d::Zero();
+    Eigen::Vector3d raw_gyro_sum = Eigen::Vector3d::Zero();
+    Eigen::Vector3d accel_sum = Eigen::Vector3d::Zero();
+    Eigen::Vector3d gyro_sum = Eigen::Vector3d::Zero();
+    Eigen::Vector3d drift_rotation = Eigen::Vector3d::Zero();
+
+    for (int sample_index = 0; sample_index < sample_count; ++sample_index)
+    {
+        const ControllerIMUCaptureSample &sample = samples[sample_index];
+
+        raw_accel_sum += Eigen::Vector3d(sample.raw_accelerometer.i, sample.raw_accelerometer.j, sample.raw_accelerometer.k);
+        raw_gyro_sum += Eigen::Vector3d(sample.raw_gyroscope.i, sample.raw_gyroscope.j, sample.raw_gyroscope.k);
+        accel_sum += sample.accelerometer_g_units.cast<double>();
+        gyro_sum += sample.gyroscope_rad_per_sec.cast<double>();
+
+        // Same time step clamping as the pose filters, so a stall doesn't count as drift
+        if (sample_index > 0)
+        {
+            const std::chrono::duration<float> time_delta = sample.timestamp - samples[sample_index - 1].timestamp;
+            const float delta_time = clampf(time_delta.count(), 0.f, k_max_time_delta_seconds);
+
+            drift_rotation += sample.gyroscope_rad_per_sec.cast<double>()*static_cast<double>(delta_time);
+        }
+    }
+
+    const Eigen::Vector3d raw_accel_mean = raw_accel_sum / N;
+    const Eigen::Vector3d raw_gyro_mean = raw_gyro_sum / N;
+    const Eigen::Vector3d accel_mean = accel_sum / N;
+    const Eigen::Vector3d gyro_mean = gyro_sum / N;
+
+    Eigen::Vector3d raw_accel_m2 = Eigen::Vector3d::Zero();
+    Eigen::Vector3d raw_gyro_m2 = Eigen::Vector3d::Zero();
+    Eigen::Vector3d accel_m2 = Eigen::Vector3d::Zero();
+    Eigen::Vector3d gyro_m2 = Eigen::Vector3d::Zero();
+    double noise_radius = 0.0;
+
+    for (const ControllerIMUCaptureSample &sample : samples)
+    {
+        const Eigen::Vector3d raw_accel_error =
+            Eigen::Vector3d(sample.raw_accelerometer.i, sample.raw_accelerometer.j, sample.raw_accelerometer.k) - raw_accel_mean;
+        const Eigen::Vector3d raw_gyro_error =
+            Eigen::Vector3d(sample.raw_gyroscope.i, sample.raw_gyroscope.j, sample.raw_gyroscope.k) - raw_gyro_mean;
+        const Eigen::Vector3d accel_error = sample.accelerometer_g_units.cast<double>() - accel_mean;
+        const Eigen::Vector3d gyro_error = sample.gyroscope_rad_per_sec.cast<double>() - gyro_mean;
+
+        raw_accel_m2 += raw_accel_error.cwiseProduct(raw_accel_error);
+        raw_gyro_m2 += raw_gyro_error.cwiseProduct(raw_gyro_error);
+        accel_m2 += accel_error.cwiseProduct(accel_error);
+        gyro_m2 += gyro_error.cwiseProduct(gyro_error);
+        noise_radius = std::max(noise_radius, accel_error.norm());
+    }
+
+    const double variance_N = std::max(N - 1.0, 1.0);
+    const std::chrono::duration<float> duration = samples.back().timestamp - samples.front().timestamp;
+
+    duration_sec = duration.count();
+    raw_accelerometer_mean = raw_accel_mean.cast<float>();
+    raw_accelerometer_variance = (raw_accel_m2 / variance_N).cast<float>();
+    raw_gyroscope_mean = raw_gyro_mean.cast<float>();
+    raw_gyroscope_variance = (raw_gyro_m2 / variance_N).cast<float>();
+    accelerometer_mean_g_units = accel_mean.cast<float>();
+    accelerometer_variance_g_units_sqr = static_cast<float>((accel_m2 / variance_N).maxCoeff());
+    accelerometer_noise_radius_g_units = static_cast<float>(noise_radius);
+    gyroscope_variance_rad_per_sec_sqr = static_cast<float>((gyro_m2 / variance_N).maxCoeff());
+    gyroscope_drift_rate_rad_per_sec =
+        (duration_sec > 0.f) ? static_cast<float>(drift_rotation.cwiseAbs().maxCoeff() / duration_sec) : 0.f;
+}
+
 ServerControllerView::ServerControllerView(const int device_id)
     : ServerDeviceView(device_id)
     , m_tracking_listener_count(0)
@@ -126,15 +431,24 @@ ServerControllerView::ServerControllerView(const int device_id)
     , m_LED_override_active(false)
     , m_device(nullptr)
     , m_tracker_pose_estimations(nullptr)
+    , m_tracker_pose_estimation_count(0)
     , m_multicam_pose_estimation(nullptr)
+    , m_optical_noise_statistics()
+    , m_imu_capture_session()
     , m_pose_filter(nullptr)
     , m_pose_filter_space(nullptr)
     , m_lastPollSeqNumProcessed(-1)
     , m_last_filter_update_timestamp()
     , m_last_filter_update_timestamp_valid(false)
+    , m_optical_update_count(0)
+    , m_bFilterPacketsHaveOptical(false)
+    , m_pipeline(nullptr)
 {
     m_tracking_color = std::make_tuple(0x00, 0x00, 0x00);
     m_LED_override_color = std::make_tuple(0x00, 0x00, 0x00);
+    m_optical_noise_statistics.clear();
+    m_imu_capture_session.clear();
+    m_pose_latency.setMetric(ServerMetric_ControllerPoseLatency, device_id);
 }
 
 ServerControllerView::~ServerControllerView()
@@ -144,6 +458,13 @@ ServerControllerView::~ServerControllerView()
 bool ServerControllerView::allocate_device_interface(
     const class DeviceEnumerator *enumerator)
 {
+    // One pose estimate per tracker slot
+    m_tracker_pose_estimation_count = DeviceManager::getInstance()->getTrackerViewMaxCount();
+    m_tracker_fusion_standby.assign(m_tracker_pose_estimation_count, false);
+
+    // Pick the per sample stages before the device gets a chance to post sensor data
+    m_pipeline = select_controller_pipeline(enumerator->get_device_type());
+
     switch (enumerator->get_device_type())
     {
     case CommonDeviceState::PSMove:
@@ -151,10 +472,10 @@ bool ServerControllerView::allocate_device_interface(
             m_device = new PSMoveController();
 			m_device->setControllerListener(this); // Listen for IMU packets
 
-            m_tracker_pose_estimations = new ControllerOpticalPoseEstimation[TrackerManager::k_max_devices];
+            m_tracker_pose_estimations = new ControllerOpticalPoseEstimation[m_tracker_pose_estimation_count];
             m_pose_filter= nullptr; // no pose filter until the device is opened
 
-            for (int tracker_index = 0; tracker_index < TrackerManager::k_max_devices; ++tracker_index)
+            for (int tracker_index = 0; tracker_index < m_tracker_pose_estimation_count; ++tracker_index)
             {
                 m_tracker_pose_estimations[tracker_index].clear();
             }
@@ -173,10 +494,10 @@ bool ServerControllerView::allocate_device_interface(
             m_device = new PSDualShock4Controller();
 			m_device->setControllerListener(this); // Listen for IMU packets
 
-            m_tracker_pose_estimations = new ControllerOpticalPoseEstimation[TrackerManager::k_max_devices];
+            m_tracker_pose_estimations = new ControllerOpticalPoseEstimation[m_tracker_pose_estimation_count];
             m_pose_filter = nullptr; // no pose filter until the device is opened
 
-            for (int tracker_index = 0; tracker_index < TrackerManager::k_max_devices; ++tracker_index)
+            for (int tracker_index = 0; tracker_index < m_tracker_pose_estimation_count; ++tracker_index)
             {
                 m_tracker_pose_estimations[tracker_index].clear();
             }
@@ -187,10 +508,10 @@ bool ServerControllerView::allocate_device_interface(
     case CommonDeviceState::VirtualController:
         {
             m_device = new VirtualController();
-            m_tracker_pose_estimations = new ControllerOpticalPoseEstimation[TrackerManager::k_max_devices];
+            m_tracker_pose_estimations = new ControllerOpticalPoseEstimation[m_tracker_pose_estimation_count];
             m_pose_filter = nullptr; // no pose filter until the device is opened
 
-            for (int tracker_index = 0; tracker_index < TrackerManager::k_max_devices; ++tracker_index)
+            for (int tracker_index = 0; tracker_index < m_tracker_pose_estimation_count; ++tracker_index)
             {
                 m_tracker_pose_estimations[tracker_index].clear();
             }
@@ -233,6 +554,9 @@ void ServerControllerView::free_device_interface()
                           // for m_device.
         m_device= nullptr;
     }
+
+    m_pipeline= nullptr;
+    m_imu_capture_session.clear();
 }
 
 bool ServerControllerView::open(const class DeviceEnumerator *enumerator)
@@ -256,8 +580,9 @@ bool ServerControllerView::open(const class DeviceEnumerator *enumerator)
                 // for usb connected controllers
                 if (psmoveController->getIsBluetooth())
                 {
-                    // Create a pose filter based on the controller type
-                    resetPoseFilter();
+                    // Pick up the filter state from before a brief dropout,
+                    // otherwise create a pose filter based on the controller type
+                    warmStartPoseFilter();
                     m_multicam_pose_estimation->clear();
 
                     bAllocateTrackingColor = true;
@@ -275,8 +600,9 @@ bool ServerControllerView::open(const class DeviceEnumerator *enumerator)
                 // for usb connected controllers
                 if (psdualshock4Controller->getIsBluetooth())
                 {
-                    // Create a pose filter based on the controller type
-                    resetPoseFilter();
+                    // Pick up the filter state from before a brief dropout,
+                    // otherwise create a pose filter based on the controller type
+                    warmStartPoseFilter();
                     m_multicam_pose_estimation->clear();
 
                     bAllocateTrackingColor = true;
@@ -318,7 +644,8 @@ bool ServerControllerView::open(const class DeviceEnumerator *enumerator)
             eCommonTrackingColorID allocatedColorID= DeviceManager::getInstance()->m_tracker_manager->allocateTrackingColorID();
 
             // Attempt to assign the tracking color id to the controller
-            if (!m_device->setTrackingColorID(allocatedColorID))
+            if (allocatedColorID != eCommonTrackingColorID::INVALID_COLOR &&
+                !m_device->setTrackingColorID(allocatedColorID))
             {
                 // If the device can't be assigned a tracking color, release the color back to the pool
                 DeviceManager::getInstance()->m_tracker_manager->freeTrackingColorID(allocatedColorID);
@@ -329,6 +656,7 @@ bool ServerControllerView::open(const class DeviceEnumerator *enumerator)
     // Clear the filter update timestamp
     m_last_filter_update_timestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
     m_last_filter_update_timestamp_valid= false;
+    m_pose_latency.reset();
 
     return bSuccess;
 }
@@ -346,6 +674,15 @@ void ServerControllerView::close()
         }
     }
 
+    // Hold on to a converged filter in case the controller comes right back (see warmStartPoseFilter())
+    if (m_device != nullptr && m_pose_filter != nullptr && m_pose_filter->getIsStateValid())
+    {
+        stash_warm_start_pose_filter(getSerial(), m_device->getDeviceType(), m_pose_filter, m_pose_filter_space);
+        m_pose_filter = nullptr;
+        m_pose_filter_space = nullptr;
+        m_filtered_pose_cache.invalidate();
+    }
+
     ServerDeviceView::close();
 }
 
@@ -396,10 +733,48 @@ bool ServerControllerView::recenterOrientation(const CommonDeviceQuaternion& q_p
     return bSuccess;
 }
 
+void ServerControllerView::warmStartPoseFilter()
+{
+    assert(m_device != nullptr);
+
+    const int max_gap_ms = DeviceManager::getInstance()->m_controller_manager->getConfig().filter_warm_start_max_gap_ms;
+    IPoseFilter *pose_filter = nullptr;
+    PoseFilterSpace *pose_filter_space = nullptr;
+
+    if (claim_warm_start_pose_filter(
+            getSerial(), m_device->getDeviceType(), max_gap_ms,
+            &pose_filter, &pose_filter_space))
+    {
+        SERVER_LOG_INFO("ServerControllerView::warmStartPoseFilter") <<
+            "Controller " << getSerial() << " reconnected, resuming its previous filter state";
+
+        m_filtered_pose_cache.invalidate();
+
+        if (m_pose_filter != nullptr)
+        {
+            delete m_pose_filter;
+        }
+
+        if (m_pose_filter_space != nullptr)
+        {
+            delete m_pose_filter_space;
+        }
+
+        m_pose_filter = pose_filter;
+        m_pose_filter_space = pose_filter_space;
+    }
+    else
+    {
+        resetPoseFilter();
+    }
+}
+
 void ServerControllerView::resetPoseFilter()
 {
     assert(m_device != nullptr);
 
+    m_filtered_pose_cache.invalidate();
+
     if (m_pose_filter != nullptr)
     {
         delete m_pose_filter;
@@ -444,13 +819,22 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
 {
     const std::chrono::time_point<std::chrono::high_resolution_clock> now= std::chrono::high_resolution_clock::now();
 
+    // Capture time of the newest video frame the controller was seen in this update
+    std::chrono::time_point<std::chrono::high_resolution_clock> optical_capture_timestamp= now;
+    bool bHasOpticalCaptureTimestamp= false;
+    // Set if a tracker the controller was seen by this update dropped frames before its frame
+    bool bHasOpticalFrameDrop= false;
+
     // TODO: Probably need to first update IMU state to get velocity.
     // If velocity is too high, don't bother getting a new position.
     // Though it may be enough to just use the camera ROI as the limit.
     
-    if (getIsTrackingEnabled())
+    // With synchronized tracker frames the poses only get solved once per frameset,
+    // so that every tracker's projection comes from the same exposure
+    if (getIsTrackingEnabled() && tracker_manager->getIsFramesetReady())
     {
         int valid_projection_tracker_ids[TrackerManager::k_max_devices];
+        float fusion_scores[TrackerManager::k_max_devices]; // indexed by tracker id
         int projections_found = 0;
 
         CommonDeviceTrackingShape trackingShape;
@@ -459,9 +843,10 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
 
         // Find the projection of the controller from the perspective of each tracker.
         // In the case of sphere projections, go ahead and compute the tracker relative position as well.
-        for (int tracker_id = 0; tracker_id < tracker_manager->getMaxDevices(); ++tracker_id)
+        // Trackers that closed after the last tick are still in the active list, so their estimates get reset here.
+        for (int tracker_id : tracker_manager->getActiveDeviceIds())
         {
-            ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
+            ServerTrackerView *tracker = tracker_manager->getTrackerView(tracker_id);
             ControllerOpticalPoseEstimation &trackerPoseEstimateRef = m_tracker_pose_estimations[tracker_id];
 
             const bool bWasTracking= trackerPoseEstimateRef.bCurrentlyTracking;
@@ -482,28 +867,32 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
                 // Can't compute tracking on video data that's too old
                 if (timeSinceNewDataMillis.count() < timeoutMilli)
                 {
-                    // Initially the newTrackerPoseEstimate is a copy of the existing pose
                     bool bIsVisibleThisUpdate= false;
 
                     // If a new video frame is available this tick, 
                     // attempt to update the tracking location
-                    if (tracker->getHasUnpublishedState())
+                    if (tracker_manager->getIsTrackerInFrameset(tracker_id))
                     {
-                        // Create a copy of the pose estimate state so that in event of a 
-                        // failure part way through computing the projection we don't
-                        // set partially valid state
-                        ControllerOpticalPoseEstimation newTrackerPoseEstimate= trackerPoseEstimateRef;
-
-                        if (tracker->computeProjectionForController(
-                                this, 
-                                &trackingShape,
-                                &newTrackerPoseEstimate))
+                        // The fetch only writes the estimate when it has a complete result,
+                        // so it can go straight into the tracker's estimate without a scratch copy
+                        if (tracker->fetchControllerProjectionResult(
+                                getDeviceID(),
+                                &trackerPoseEstimateRef))
                         {
                             bIsVisibleThisUpdate= true;
-
-                            // Actually apply the pose estimate state
-                            trackerPoseEstimateRef= newTrackerPoseEstimate;
                             trackerPoseEstimateRef.last_visible_timestamp = now;
+
+                            // The optical measurement is as old as the frame it came from
+                            const std::chrono::time_point<std::chrono::high_resolution_clock> frame_timestamp=
+                                tracker_manager->getTrackerFrameCaptureTimestamp(tracker_id);
+
+                            if (!bHasOpticalCaptureTimestamp || frame_timestamp > optical_capture_timestamp)
+                            {
+                                optical_capture_timestamp= frame_timestamp;
+                                bHasOpticalCaptureTimestamp= true;
+                            }
+
+                            bHasOpticalFrameDrop|= tracker_manager->getTrackerFrameDropCount(tracker_id) > 0;
                         }
                     }
 
@@ -517,9 +906,16 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
                         if (timeSinceLastVisibleMillis.count() < timeoutMilli)
                         {
                             // If this tracker has a valid projection for the controller
-                            // add it to the tracker id list
-                            valid_projection_tracker_ids[projections_found] = tracker_id;
-                            ++projections_found;
+                            // add it to the tracker id list.
+                            // A tracker on fusion standby only competes with a fresh projection,
+                            // not with the one held over from its last standby search.
+                            if (bIsVisibleThisUpdate || !getIsTrackerOnFusionStandby(tracker_id))
+                            {
+                                valid_projection_tracker_ids[projections_found] = tracker_id;
+                                fusion_scores[tracker_id] = TrackerManager::computeFusionScore(
+                                    trackerPoseEstimateRef.position_cm, trackerPoseEstimateRef.projection.screen_area);
+                                ++projections_found;
+                            }
 
                             // Flag this pose estimate as invalid
                             bCurrentlyTracking = true;
@@ -534,6 +930,23 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
             trackerPoseEstimateRef.bCurrentlyTracking = bCurrentlyTracking;
         }
 
+        // Only fuse the trackers with the best view of the controller.
+        // The ones left out drop to the slower standby search (see ServerTrackerView::startProjectionWork()).
+        {
+            const int max_fused_tracker_count = tracker_manager->getConfig().max_fused_tracker_count;
+            const int fused_count = tracker_manager->selectFusedTrackers(valid_projection_tracker_ids, projections_found, fusion_scores);
+
+            std::fill(
+                m_tracker_fusion_standby.begin(), m_tracker_fusion_standby.end(),
+                max_fused_tracker_count > 0 && fused_count >= max_fused_tracker_count);
+            for (int list_index = 0; list_index < fused_count; ++list_index)
+            {
+                m_tracker_fusion_standby[valid_projection_tracker_ids[list_index]] = false;
+            }
+
+            projections_found = fused_count;
+        }
+
         // How we compute the final world pose estimate varies based on
         // * Number of trackers that currently have a valid projections of the controller
         // * The kind of projection shape (psmove sphere or ds4 lightbar)
@@ -605,57 +1018,42 @@ void ServerControllerView::updateOpticalPoseEstimation(TrackerManager* tracker_m
         }
         m_multicam_pose_estimation->last_update_timestamp = now;
         m_multicam_pose_estimation->bValidTimestamps = true;
+        // A pose held over from older frames is as much of a gap as one solved after dropped frames
+        m_multicam_pose_estimation->bFollowsFrameGap = !bHasOpticalCaptureTimestamp || bHasOpticalFrameDrop;
+
+        // Only sample poses solved from a new video frame, not held over ones
+        if (m_optical_noise_statistics.getIsSampling() &&
+            m_multicam_pose_estimation->bCurrentlyTracking &&
+            bHasOpticalCaptureTimestamp)
+        {
+            m_optical_noise_statistics.addSample(*m_multicam_pose_estimation);
+        }
     }
 
 	// Update the filter if we have a valid optically tracked pose
 	// TODO: These packets will eventually get posted from the notifyTrackerDataReceived()
 	// callback function which will be called by camera processing threads as new video
 	// frames are received.
-	if (m_multicam_pose_estimation->bCurrentlyTracking)
+	if (tracker_manager->getIsFramesetReady() && m_multicam_pose_estimation->bCurrentlyTracking)
 	{
-		switch (getControllerDeviceType())
-		{
-		case CommonDeviceState::PSMove:
-			{
-				const PSMoveController *psmove = this->castCheckedConst<PSMoveController>();
-
-				post_optical_filter_packet_for_psmove(
-					psmove,
-					now,
-					m_multicam_pose_estimation,
-					&m_PoseSensorOpticalPacketQueue);
-			} break;
-		case CommonDeviceState::PSDualShock4:
-			{
-				const PSDualShock4Controller *ds4 = this->castCheckedConst<PSDualShock4Controller>();
-
-				post_optical_filter_packet_for_ds4(
-					ds4,
-					now,
-					m_multicam_pose_estimation,
-					&m_PoseSensorOpticalPacketQueue);
-			} break;
-		case CommonDeviceState::VirtualController:
-			{
-				const VirtualController *virtual_controller = this->castCheckedConst<VirtualController>();
-
-				post_optical_filter_packet_for_virtual_controller(
-					virtual_controller,
-					now,
-					m_multicam_pose_estimation,
-					&m_PoseSensorOpticalPacketQueue);
-			} break;
-		default:
-			assert(0 && "Unhandled Controller Type");
-		}
+		assert(m_pipeline->post_optical_filter_packet != nullptr && "Unhandled Controller Type");
+		m_pipeline->post_optical_filter_packet(
+			m_device,
+			optical_capture_timestamp,
+			m_multicam_pose_estimation,
+			&m_PoseSensorOpticalPacketQueue);
 	}
 }
 
 void 
 ServerControllerView::notifySensorDataReceived(const CommonDeviceState *sensor_state)
 {
-    // Compute the time in seconds since the last update
-    const t_high_resolution_timepoint now = std::chrono::high_resolution_clock::now();
+    // Compute the time in seconds since the last update.
+    // Prefer the time the device captured the sample over the time we got around to processing it.
+    const t_high_resolution_timepoint now = 
+        sensor_state->getHasCaptureTimestamp()
+        ? sensor_state->CaptureTimestamp
+        : std::chrono::high_resolution_clock::now();
 	t_high_resolution_duration durationSinceLastUpdate= t_high_resolution_duration::zero();
 
 	if (m_bIsLastSensorDataTimestampValid)
@@ -666,48 +1064,126 @@ ServerControllerView::notifySensorDataReceived(const CommonDeviceState *sensor_s
 	m_bIsLastSensorDataTimestampValid= true;
 
 	// Apply device specific filtering
-    switch (sensor_state->DeviceType)
+    assert(sensor_state->DeviceType == m_pipeline->device_type);
+    assert(m_pipeline->post_imu_filter_packets != nullptr && "Unhandled Controller Type");
+    m_pipeline->post_imu_filter_packets(
+        m_device, sensor_state,
+        now, durationSinceLastUpdate,
+        &m_PoseSensorIMUPacketQueue);
+
+    // Consider this HMD state sequence num processed
+    m_lastPollSeqNumProcessed = sensor_state->PollSequenceNumber;
+
+	// Wake up the main thread so the new IMU packets get filtered and published right away
+	WakeupSignal::notifyMainLoop();
+}
+
+void ServerControllerView::pollExternalPoses(SharedPoseInputReader *pose_input_reader)
+{
+    const VirtualController *virtual_controller = this->castCheckedConst<VirtualController>();
+
+    // Poses older than the optical tracking timeout are as stale as a lost tracker's last projection.
+    // That also drops whatever got written to the ring before the controller opened.
+    const t_high_resolution_timepoint now = std::chrono::high_resolution_clock::now();
+    const int64_t now_us = getExternalPoseTimestampNow();
+    const int64_t max_age_us =
+        static_cast<int64_t>(DeviceManager::getInstance()->m_tracker_manager->getConfig().optical_tracking_timeout) * 1000;
+    bool bHasNewPose = false;
+
+    ExternalPoseSample samples[k_external_pose_read_batch_size];
+    int sample_count;
+    do
     {
-    case CommonDeviceState::PSMove:
-        {
-            const PSMoveController *psmove = this->castCheckedConst<PSMoveController>();
-            const PSMoveControllerInputState *psmoveState = 
-				static_cast<const PSMoveControllerInputState *>(sensor_state);
+        sample_count = pose_input_reader->readControllerPoses(getDeviceID(), samples, k_external_pose_read_batch_size);
 
-            // Only update the position filter when tracking is enabled
-            post_imu_filter_packets_for_psmove(
-                psmove, psmoveState,
-                now, durationSinceLastUpdate,
-				&m_PoseSensorIMUPacketQueue);
-        } break;
-    case CommonDeviceState::PSDualShock4:
+        for (int sample_index = 0; sample_index < sample_count; ++sample_index)
         {
-            const PSDualShock4Controller *ds4 = this->castCheckedConst<PSDualShock4Controller>();
-            const DualShock4ControllerInputState *ds4State = 
-				static_cast<const DualShock4ControllerInputState *>(sensor_state);
+            bHasNewPose |= 
+                post_external_filter_packet_for_virtual_controller(
+                    virtual_controller, samples[sample_index], now, now_us, max_age_us, &m_PoseSensorOpticalPacketQueue);
+        }
+    } while (sample_count == k_external_pose_read_batch_size);
 
-            // Only update the position filter when tracking is enabled
-            post_imu_filter_packets_for_ds4(
-                ds4, ds4State,
-                now, durationSinceLastUpdate,
-				&m_PoseSensorIMUPacketQueue);
-        } break;
-    default:
-        assert(0 && "Unhandled Controller Type");
+    if (bHasNewPose)
+    {
+        markStateAsUnpublished();
     }
-
-    // Consider this HMD state sequence num processed
-    m_lastPollSeqNumProcessed = sensor_state->PollSequenceNumber;
 }
 
 void ServerControllerView::updateStateAndPredict()
 {
-	std::vector<PoseSensorPacket> timeSortedPackets;
+	if (drain_filter_packets())
+	{
+		SERVER_TRACE_DEVICE_SCOPE(ServerTraceStage_FilterUpdate, getDeviceID());
+
+		// Integrate every IMU sub-frame and optical update in one pass over the filter
+		m_pose_filter->updateBatch(
+			m_pose_filter_space,
+			m_filter_packets.data(),
+			m_filter_packet_time_deltas.data(),
+			static_cast<int>(m_filter_packets.size()));
+
+		finish_filter_update();
+	}
+}
+
+bool ServerControllerView::getCanBatchPoseFilter() const
+{
+	return m_pose_filter != nullptr && m_pose_filter->getBatchKernel() != OrientationFilterBatchKernel_None;
+}
+
+bool ServerControllerView::beginBatchedStateUpdate(PoseFilterBatch *pose_filter_batch)
+{
+	bool bIsBatched= false;
+
+	if (drain_filter_packets())
+	{
+		bIsBatched=
+			pose_filter_batch->addFilter(
+				m_pose_filter,
+				m_pose_filter_space,
+				m_filter_packets.data(),
+				m_filter_packet_time_deltas.data(),
+				static_cast<int>(m_filter_packets.size()));
+
+		// A full batch leaves the filter to update on its own
+		if (!bIsBatched)
+		{
+			SERVER_TRACE_DEVICE_SCOPE(ServerTraceStage_FilterUpdate, getDeviceID());
+
+			m_pose_filter->updateBatch(
+				m_pose_filter_space,
+				m_filter_packets.data(),
+				m_filter_packet_time_deltas.data(),
+				static_cast<int>(m_filter_packets.size()));
+
+			finish_filter_update();
+		}
+	}
+
+	return bIsBatched;
+}
+
+void ServerControllerView::endBatchedStateUpdate()
+{
+	finish_filter_update();
+}
+
+bool ServerControllerView::drain_filter_packets()
+{
+	std::vector<PoseSensorPacket> &timeSortedPackets= m_filter_packets;
+	timeSortedPackets.clear();
 
 	// Drain the packet queues filled by the threads
 	PoseSensorPacket packet;
 	while (m_PoseSensorIMUPacketQueue.try_dequeue(packet))
 	{
+		// Record the capture before the trimming below gets a chance to drop samples
+		if (m_imu_capture_session.getIsSampling())
+		{
+			m_imu_capture_session.addSample(packet);
+		}
+
 		timeSortedPackets.push_back(packet);
 	}
 	//TODO: m_PoseSensorOpticalPacketQueue is currently getting filled on the main thread by
@@ -739,7 +1215,7 @@ void ServerControllerView::updateStateAndPredict()
 		{
 			const size_t excess= timeSortedPackets.size() - k_max_process_count;
 
-			SERVER_LOG_WARNING("updatePoseFilter()") << "Incoming packet count: " << timeSortedPackets.size() << " (" << milli_duration.count() << "ms)" << ", trimming: " << excess;
+			SERVER_MT_LOG_WARNING("updatePoseFilter()") << "Incoming packet count: " << timeSortedPackets.size() << " (" << milli_duration.count() << "ms)" << ", trimming: " << excess;
 			timeSortedPackets.erase(timeSortedPackets.begin(), timeSortedPackets.begin()+excess);
 		}
 		else
@@ -748,10 +1224,14 @@ void ServerControllerView::updateStateAndPredict()
 		}
 	}
 
-	// Process the sensor packets from oldest to newest
+	// Compute the time since the previous packet for each of the sensor packets from oldest to newest
+	std::vector<float> &timeDeltas= m_filter_packet_time_deltas;
+	bool bHasOpticalPacket= false;
+	timeDeltas.clear();
 	for (const PoseSensorPacket &sensorPacket : timeSortedPackets)
     {
-		// Compute the time since the last packet
+		bHasOpticalPacket|= sensorPacket.has_optical_measurement();
+
 		float time_delta_seconds;
 		if (m_last_filter_update_timestamp_valid)
 		{
@@ -766,26 +1246,33 @@ void ServerControllerView::updateStateAndPredict()
 			time_delta_seconds = k_max_time_delta_seconds;
 		}
 
-		m_last_filter_update_timestamp = sensorPacket.timestamp;
+		// A late optical packet (captured before IMU packets applied last update) must not move
+		// the time base backwards, or the next IMU packet would get a time delta spanning the gap twice.
+		// The Kalman pose filters rewind to the capture time themselves.
+		if (!m_last_filter_update_timestamp_valid || sensorPacket.timestamp > m_last_filter_update_timestamp)
+		{
+			m_last_filter_update_timestamp = sensorPacket.timestamp;
+		}
 		m_last_filter_update_timestamp_valid = true;
 
-		{
-			PoseFilterPacket filter_packet;
-			filter_packet.clear();
+		timeDeltas.push_back(time_delta_seconds);
+	}
+	m_bFilterPacketsHaveOptical= bHasOpticalPacket;
 
-			// Create a filter input packet from the sensor data 
-			// and the filter's previous orientation and position
-			m_pose_filter_space->createFilterPacket(
-				sensorPacket,
-				m_pose_filter,
-				filter_packet);
-			// Process the filter packet
-			m_pose_filter->update(time_delta_seconds, filter_packet);
-		}
+	return timeSortedPackets.size() > 0;
+}
+
+void ServerControllerView::finish_filter_update()
+{
+	m_filtered_pose_cache.invalidate();
 
-		// Flag the state as unpublished, which will trigger an update to the client
-		markStateAsUnpublished();
+	if (m_bFilterPacketsHaveOptical)
+	{
+		++m_optical_update_count;
 	}
+
+	// Flag the state as unpublished, which will trigger an update to the client
+	markStateAsUnpublished();
 }
 
 bool ServerControllerView::setHostBluetoothAddress(
@@ -799,6 +1286,11 @@ ServerControllerView::getFilteredPose(float time) const
 {
     CommonDevicePose pose;
 
+    if (m_filtered_pose_cache.tryGetPose(m_pose_filter, time, pose))
+    {
+        return pose;
+    }
+
     pose.clear();
 
     if (m_pose_filter != nullptr)
@@ -806,16 +1298,13 @@ ServerControllerView::getFilteredPose(float time) const
         const Eigen::Quaternionf orientation= m_pose_filter->getOrientation(time);
         const Eigen::Vector3f position_cm= m_pose_filter->getPositionCm(time);
 
-        pose.Orientation.w= orientation.w();
-        pose.Orientation.x= orientation.x();
-        pose.Orientation.y= orientation.y();
-        pose.Orientation.z= orientation.z();
+        eigen_quaternionf_view(pose.Orientation)= orientation;
 
-        pose.PositionCm.x= position_cm.x();
-        pose.PositionCm.y= position_cm.y();
-        pose.PositionCm.z= position_cm.z();
+        eigen_vector3f_view(pose.PositionCm)= position_cm;
     }
 
+    m_filtered_pose_cache.storePose(m_pose_filter, time, pose);
+
     return pose;
 }
 
@@ -824,6 +1313,13 @@ ServerControllerView::getFilteredPhysics() const
 {
     CommonDevicePhysics physics;
 
+    if (m_filtered_pose_cache.tryGetPhysics(m_pose_filter, physics))
+    {
+        return physics;
+    }
+
+    physics.clear();
+
     if (m_pose_filter != nullptr)
     {
         const Eigen::Vector3f first_derivative= m_pose_filter->getAngularVelocityRadPerSec();
@@ -848,6 +1344,8 @@ ServerControllerView::getFilteredPhysics() const
         physics.AccelerationCmPerSecSqr.k = acceleration.z();
     }
 
+    m_filtered_pose_cache.storePhysics(m_pose_filter, physics);
+
     return physics;
 }
 
@@ -982,6 +1480,29 @@ bool ServerControllerView::getWasSystemButtonPressed() const
     return bWasPressed;
 }
 
+void ServerControllerView::startOpticalNoiseSampling(int sample_count)
+{
+    m_optical_noise_statistics.clear();
+    m_optical_noise_statistics.target_sample_count = std::max(sample_count, 0);
+}
+
+bool ServerControllerView::startIMUCapture(int sample_count)
+{
+    const CommonDeviceState::eDeviceType device_type = getControllerDeviceType();
+
+    if (device_type != CommonDeviceState::PSMove && device_type != CommonDeviceState::PSDualShock4)
+    {
+        return false;
+    }
+
+    m_imu_capture_session.clear();
+    m_imu_capture_session.target_sample_count = 
+        std::min(std::max(sample_count, 0), k_max_imu_capture_sample_count);
+    m_imu_capture_session.samples.reserve(m_imu_capture_session.target_sample_count);
+
+    return true;
+}
+
 void ServerControllerView::setLEDOverride(unsigned char r, unsigned char g, unsigned char b)
 {
     m_LED_override_color = std::make_tuple(r, g, b);
@@ -1222,10 +1743,18 @@ bool ServerControllerView::setControllerRumble(
 
 void ServerControllerView::publish_device_data_frame()
 {
+    // The filter state is as old as the newest sample it consumed
+    if (m_last_filter_update_timestamp_valid)
+    {
+        m_pose_latency.addSample(m_last_filter_update_timestamp, std::chrono::high_resolution_clock::now());
+    }
+
     // Tell the server request handler we want to send out controller updates.
     // This will call generate_controller_data_frame_for_stream for each listening connection.
     ServerRequestHandler::get_instance()->publish_controller_data_frame(
-        this, &ServerControllerView::generate_controller_data_frame_for_stream);
+        this,
+        &ServerControllerView::generate_controller_data_frame_for_stream,
+        &ServerControllerView::generate_controller_compact_pose_frame_for_stream);
 }
 
 void ServerControllerView::generate_controller_data_frame_for_stream(
@@ -1240,29 +1769,108 @@ void ServerControllerView::generate_controller_data_frame_for_stream(
     controller_data_frame->set_sequence_num(controller_view->m_sequence_number);
     controller_data_frame->set_isconnected(controller_view->getDevice()->getIsOpen());
 
-    switch (controller_view->getControllerDeviceType())
+    assert(controller_view->m_pipeline != nullptr && "Unhandled controller type");
+    controller_view->m_pipeline->generate_data_frame_for_stream(controller_view, stream_info, data_frame);
+
+    data_frame->set_device_category(PSMoveProtocol::DeviceOutputDataFrame::CONTROLLER);
+    data_frame->set_service_time_us(stream_info->prediction_target.getServiceTimeUs());
+}
+
+bool ServerControllerView::generate_controller_compact_pose_frame_for_stream(
+    const ServerControllerView *controller_view,
+    const ControllerStreamInfo *stream_info,
+    CompactControllerPoseFrame *pose_frame)
+{
+    // Only the PSMove has a compact layout so far.
+    // Everything else keeps streaming protobuf data frames.
+    if (controller_view->m_pipeline == nullptr ||
+        controller_view->m_pipeline->device_type != CommonControllerState::PSMove)
     {
-    case CommonControllerState::PSMove:
-        {            
-            generate_psmove_data_frame_for_stream(controller_view, stream_info, data_frame);
-        } break;
-    case CommonControllerState::PSNavi:
+        return false;
+    }
+
+    const PSMoveController *psmove_controller= controller_view->castCheckedConst<PSMoveController>();
+    const IPoseFilter *pose_filter= controller_view->getPoseFilter();
+    const PSMoveControllerConfig *psmove_config= psmove_controller->getConfig();
+    const CommonControllerState *controller_state= controller_view->getState();
+
+    memset(pose_frame, 0, sizeof(CompactControllerPoseFrame));
+    pose_frame->marker= COMPACT_DATA_FRAME_MARKER;
+    pose_frame->version= COMPACT_DATA_FRAME_VERSION;
+    pose_frame->controller_id= static_cast<uint8_t>(controller_view->getDeviceID());
+    pose_frame->controller_type= static_cast<uint8_t>(PSMoveProtocol::PSMOVE);
+    pose_frame->sequence_num= controller_view->m_sequence_number;
+    pose_frame->sensor_data_age_ms= -1.f;
+    pose_frame->service_time_us= stream_info->prediction_target.getServiceTimeUs();
+
+    if (controller_view->getDevice()->getIsOpen())
+    {
+        pose_frame->flags|= COMPACT_POSE_FLAG_IS_CONNECTED;
+    }
+
+    if (controller_state != nullptr)
+    {
+        assert(controller_state->DeviceType == CommonDeviceState::PSMove);
+        const PSMoveControllerInputState *psmove_state= static_cast<const PSMoveControllerInputState *>(controller_state);
+        const CommonDevicePose controller_pose= controller_view->getFilteredPose(controller_view->getStreamPredictionTime(stream_info->prediction_target, psmove_config->prediction_time));
+
+        if (psmove_config->is_valid)
+            pose_frame->flags|= COMPACT_POSE_FLAG_VALID_HARDWARE_CALIBRATION;
+        if (controller_view->getIsTrackingEnabled())
+            pose_frame->flags|= COMPACT_POSE_FLAG_IS_TRACKING_ENABLED;
+        if (controller_view->getIsCurrentlyTracking())
+            pose_frame->flags|= COMPACT_POSE_FLAG_IS_CURRENTLY_TRACKING;
+        if (pose_filter->getIsOrientationStateValid())
+            pose_frame->flags|= COMPACT_POSE_FLAG_IS_ORIENTATION_VALID;
+        if (pose_filter->getIsPositionStateValid())
+            pose_frame->flags|= COMPACT_POSE_FLAG_IS_POSITION_VALID;
+
+        pose_frame->orientation[0]= controller_pose.Orientation.w;
+        pose_frame->orientation[1]= controller_pose.Orientation.x;
+        pose_frame->orientation[2]= controller_pose.Orientation.y;
+        pose_frame->orientation[3]= controller_pose.Orientation.z;
+
+        if (stream_info->include_position_data)
         {
-            generate_psnavi_data_frame_for_stream(controller_view, stream_info, data_frame);
-        } break;
-    case CommonControllerState::PSDualShock4:
+            pose_frame->position_cm[0]= controller_pose.PositionCm.x;
+            pose_frame->position_cm[1]= controller_pose.PositionCm.y;
+            pose_frame->position_cm[2]= controller_pose.PositionCm.z;
+        }
+
+        if (stream_info->include_physics_data)
         {
-            generate_psdualshock4_data_frame_for_stream(controller_view, stream_info, data_frame);
-        } break;
-    case CommonControllerState::VirtualController:
+            const CommonDevicePhysics controller_physics= controller_view->getFilteredPhysics();
+
+            pose_frame->velocity_cm_per_sec[0]= controller_physics.VelocityCmPerSec.i;
+            pose_frame->velocity_cm_per_sec[1]= controller_physics.VelocityCmPerSec.j;
+            pose_frame->velocity_cm_per_sec[2]= controller_physics.VelocityCmPerSec.k;
+        }
+
+        unsigned int button_bitmask= 0;
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::TRIANGLE, psmove_state->Triangle);
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::CIRCLE, psmove_state->Circle);
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::CROSS, psmove_state->Cross);
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::SQUARE, psmove_state->Square);
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::SELECT, psmove_state->Select);
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::START, psmove_state->Start);
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::PS, psmove_state->PS);
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::MOVE, psmove_state->Move);
+        SET_BUTTON_BIT(button_bitmask, PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket::TRIGGER, psmove_state->Trigger);
+        pose_frame->button_down_bitmask= button_bitmask;
+
+        pose_frame->trigger_value= psmove_state->TriggerValue;
+        pose_frame->battery_value= static_cast<uint8_t>(psmove_state->BatteryValue);
+
+        if (controller_view->m_bIsLastSensorDataTimestampValid)
         {
-            generate_virtual_controller_data_frame_for_stream(controller_view, stream_info, data_frame);
-        } break;
-    default:
-        assert(0 && "Unhandled controller type");
+            const std::chrono::duration<float, std::milli> sensor_data_age=
+                std::chrono::high_resolution_clock::now() - controller_view->m_lastSensorDataTimestamp;
+
+            pose_frame->sensor_data_age_ms= sensor_data_age.count();
+        }
     }
 
-    data_frame->set_device_category(PSMoveProtocol::DeviceOutputDataFrame::CONTROLLER);
+    return true;
 }
 
 static void generate_psmove_data_frame_for_stream(
@@ -1274,7 +1882,7 @@ static void generate_psmove_data_frame_for_stream(
     const IPoseFilter *pose_filter= controller_view->getPoseFilter();
     const PSMoveControllerConfig *psmove_config= psmove_controller->getConfig();
     const CommonControllerState *controller_state= controller_view->getState();
-    const CommonDevicePose controller_pose = controller_view->getFilteredPose(psmove_config->prediction_time);
+    const CommonDevicePose controller_pose = controller_view->getFilteredPose(controller_view->getStreamPredictionTime(stream_info->prediction_target, psmove_config->prediction_time));
 
     auto *controller_data_frame= data_frame->mutable_controller_data_packet();
     auto *psmove_data_frame = controller_data_frame->mutable_psmove_state();
@@ -1376,14 +1984,14 @@ static void generate_psmove_data_frame_for_stream(
             int selectedTrackerId= stream_info->selected_tracker_index;
             unsigned int validTrackerBitmask= 0;
 
-            for (int trackerId = 0; trackerId < TrackerManager::k_max_devices; ++trackerId)
+            for (int trackerId = 0; trackerId < controller_view->getTrackerPoseEstimateCount(); ++trackerId)
             {
                 const ControllerOpticalPoseEstimation *positionEstimate= 
                     controller_view->getTrackerPoseEstimate(trackerId);
 
                 if (positionEstimate != nullptr && positionEstimate->bCurrentlyTracking)
                 {
-                    validTrackerBitmask&= (1 << trackerId);
+                    validTrackerBitmask|= (1 << trackerId);
 
                     if (trackerId == selectedTrackerId)
                     {
@@ -1433,6 +2041,11 @@ static void generate_psmove_data_frame_for_stream(
             }
             raw_tracker_data->set_valid_tracker_bitmask(validTrackerBitmask);
 
+            if (stream_info->include_all_tracker_data)
+            {
+                add_controller_tracker_samples(controller_view, stream_info->use_packed_tracker_data, raw_tracker_data);
+            }
+
             {
                 const ControllerOpticalPoseEstimation *poseEstimate = controller_view->getMulticamPoseEstimate();
 
@@ -1519,7 +2132,7 @@ static void generate_psdualshock4_data_frame_for_stream(
     const IPoseFilter *pose_filter= controller_view->getPoseFilter();
     const PSDualShock4ControllerConfig *psmove_config = ds4_controller->getConfig();
     const CommonControllerState *controller_state = controller_view->getState();
-    const CommonDevicePose controller_pose = controller_view->getFilteredPose(psmove_config->prediction_time);
+    const CommonDevicePose controller_pose = controller_view->getFilteredPose(controller_view->getStreamPredictionTime(stream_info->prediction_target, psmove_config->prediction_time));
 
     auto *controller_data_frame = data_frame->mutable_controller_data_packet();
     auto *psds4_data_frame = controller_data_frame->mutable_psdualshock4_state();
@@ -1622,14 +2235,14 @@ static void generate_psdualshock4_data_frame_for_stream(
             int selectedTrackerId= stream_info->selected_tracker_index;
             unsigned int validTrackerBitmask= 0;
 
-            for (int trackerId = 0; trackerId < TrackerManager::k_max_devices; ++trackerId)
+            for (int trackerId = 0; trackerId < controller_view->getTrackerPoseEstimateCount(); ++trackerId)
             {
                 const ControllerOpticalPoseEstimation *positionEstimate= 
                     controller_view->getTrackerPoseEstimate(trackerId);
 
                 if (positionEstimate != nullptr && positionEstimate->bCurrentlyTracking)
                 {
-                    validTrackerBitmask&= (1 << trackerId);
+                    validTrackerBitmask|= (1 << trackerId);
 
                     if (trackerId == selectedTrackerId)
                     {
@@ -1663,14 +2276,35 @@ static void generate_psdualshock4_data_frame_for_stream(
                                     poseEstimate->projection;
 
                                 assert(trackerRelativeProjection.shape_type == eCommonTrackingProjectionType::ProjectionType_LightBar);
-                                PSMoveProtocol::Polygon *polygon = raw_tracker_data->mutable_projected_blob();
 
-                                for (int vert_index = 0; vert_index < 3; ++vert_index)
+                                // Same vertex order either way: the triangle, then the quad
+                                if (stream_info->use_packed_tracker_data)
                                 {
-                                    PSMoveProtocol::Pixel *pixel = polygon->add_vertices();
+                                    CommonDeviceScreenLocation blob_points[7];
 
-                                    pixel->set_x(trackerRelativeProjection.shape.lightbar.triangle[vert_index].x);
-                                    pixel->set_y(trackerRelativeProjection.shape.lightbar.triangle[vert_index].y);
+                                    std::copy(trackerRelativeProjection.shape.lightbar.triangle, trackerRelativeProjection.shape.lightbar.triangle + 3, blob_points);
+                                    std::copy(trackerRelativeProjection.shape.lightbar.quad, trackerRelativeProjection.shape.lightbar.quad + 4, blob_points + 3);
+                                    packed_tracker_data_append_points(raw_tracker_data->mutable_packed_projected_blob(), blob_points, 7);
+                                }
+                                else
+                                {
+                                    PSMoveProtocol::Polygon *polygon = raw_tracker_data->mutable_projected_blob();
+
+                                    for (int vert_index = 0; vert_index < 3; ++vert_index)
+                                    {
+                                        PSMoveProtocol::Pixel *pixel = polygon->add_vertices();
+
+                                        pixel->set_x(trackerRelativeProjection.shape.lightbar.triangle[vert_index].x);
+                                        pixel->set_y(trackerRelativeProjection.shape.lightbar.triangle[vert_index].y);
+                                    }
+
+                                    for (int vert_index = 0; vert_index < 4; ++vert_index)
+                                    {
+                                        PSMoveProtocol::Pixel *pixel = polygon->add_vertices();
+
+                                        pixel->set_x(trackerRelativeProjection.shape.lightbar.quad[vert_index].x);
+                                        pixel->set_y(trackerRelativeProjection.shape.lightbar.quad[vert_index].y);
+                                    }
                                 }
 
                                 CommonDeviceScreenLocation center_pixel;
@@ -1679,10 +2313,6 @@ static void generate_psdualshock4_data_frame_for_stream(
                                 for (int vert_index = 0; vert_index < 4; ++vert_index)
                                 {
                                     const CommonDeviceScreenLocation &screenLocation= trackerRelativeProjection.shape.lightbar.quad[vert_index];
-                                    PSMoveProtocol::Pixel *pixel = polygon->add_vertices();
-
-                                    pixel->set_x(screenLocation.x);
-                                    pixel->set_y(screenLocation.y);
 
                                     center_pixel.x += screenLocation.x;
                                     center_pixel.y += screenLocation.y;
@@ -1706,6 +2336,11 @@ static void generate_psdualshock4_data_frame_for_stream(
             }
             raw_tracker_data->set_valid_tracker_bitmask(validTrackerBitmask);
 
+            if (stream_info->include_all_tracker_data)
+            {
+                add_controller_tracker_samples(controller_view, stream_info->use_packed_tracker_data, raw_tracker_data);
+            }
+
             {
                 const ControllerOpticalPoseEstimation *poseEstimate = controller_view->getMulticamPoseEstimate();
 
@@ -1762,7 +2397,7 @@ static void generate_virtual_controller_data_frame_for_stream(
     const IPoseFilter *pose_filter= controller_view->getPoseFilter();
     const VirtualControllerConfig *controller_config= virtual_controller->getConfig();
     const CommonControllerState *controller_state= controller_view->getState();
-    const CommonDevicePose controller_pose = controller_view->getFilteredPose(controller_config->prediction_time);
+    const CommonDevicePose controller_pose = controller_view->getFilteredPose(controller_view->getStreamPredictionTime(stream_info->prediction_target, controller_config->prediction_time));
 
     auto *controller_data_frame= data_frame->mutable_controller_data_packet();
     auto *virtual_controller_data_frame = controller_data_frame->mutable_virtualcontroller_state();
@@ -1808,14 +2443,14 @@ static void generate_virtual_controller_data_frame_for_stream(
             int selectedTrackerId= stream_info->selected_tracker_index;
             unsigned int validTrackerBitmask= 0;
 
-            for (int trackerId = 0; trackerId < TrackerManager::k_max_devices; ++trackerId)
+            for (int trackerId = 0; trackerId < controller_view->getTrackerPoseEstimateCount(); ++trackerId)
             {
                 const ControllerOpticalPoseEstimation *positionEstimate= 
                     controller_view->getTrackerPoseEstimate(trackerId);
 
                 if (positionEstimate != nullptr && positionEstimate->bCurrentlyTracking)
                 {
-                    validTrackerBitmask&= (1 << trackerId);
+                    validTrackerBitmask|= (1 << trackerId);
 
                     if (trackerId == selectedTrackerId)
                     {
@@ -1862,6 +2497,11 @@ static void generate_virtual_controller_data_frame_for_stream(
             }
             raw_tracker_data->set_valid_tracker_bitmask(validTrackerBitmask);
 
+            if (stream_info->include_all_tracker_data)
+            {
+                add_controller_tracker_samples(controller_view, stream_info->use_packed_tracker_data, raw_tracker_data);
+            }
+
             {
                 const ControllerOpticalPoseEstimation *poseEstimate = controller_view->getMulticamPoseEstimate();
 
@@ -1894,6 +2534,130 @@ static void generate_virtual_controller_data_frame_for_stream(
     controller_data_frame->set_controller_type(PSMoveProtocol::VIRTUALCONTROLLER);
 }
 
+template <class t_controller, class t_input_state,
+          void (*t_post_imu_filter_packets)(
+              const t_controller *, const t_input_state *,
+              const t_high_resolution_timepoint, const t_high_resolution_duration,
+              t_controller_pose_sensor_queue *)>
+static void post_imu_filter_packets_stage(
+    const IControllerInterface *device,
+    const CommonDeviceState *sensor_state,
+    const t_high_resolution_timepoint now,
+    const t_high_resolution_duration durationSinceLastUpdate,
+    t_controller_pose_sensor_queue *pose_filter_queue)
+{
+    assert(device->getDeviceType() == t_controller::getDeviceTypeStatic());
+
+    t_post_imu_filter_packets(
+        static_cast<const t_controller *>(device),
+        static_cast<const t_input_state *>(sensor_state),
+        now, durationSinceLastUpdate,
+        pose_filter_queue);
+}
+
+template <class t_controller,
+          void (*t_post_optical_filter_packet)(
+              const t_controller *, const t_high_resolution_timepoint,
+              const ControllerOpticalPoseEstimation *, t_controller_pose_optical_queue *)>
+static void post_optical_filter_packet_stage(
+    const IControllerInterface *device,
+    const t_high_resolution_timepoint now,
+    const ControllerOpticalPoseEstimation *poseEstimation,
+    t_controller_pose_optical_queue *pose_filter_queue)
+{
+    assert(device->getDeviceType() == t_controller::getDeviceTypeStatic());
+
+    t_post_optical_filter_packet(static_cast<const t_controller *>(device), now, poseEstimation, pose_filter_queue);
+}
+
+static const ControllerPipeline k_psmove_pipeline = {
+    CommonDeviceState::PSMove,
+    &post_imu_filter_packets_stage<PSMoveController, PSMoveControllerInputState, post_imu_filter_packets_for_psmove>,
+    &post_optical_filter_packet_stage<PSMoveController, post_optical_filter_packet_for_psmove>,
+    &generate_psmove_data_frame_for_stream
+};
+
+static const ControllerPipeline k_psnavi_pipeline = {
+    CommonDeviceState::PSNavi,
+    nullptr, // No IMU
+    nullptr, // Not optically tracked
+    &generate_psnavi_data_frame_for_stream
+};
+
+static const ControllerPipeline k_psdualshock4_pipeline = {
+    CommonDeviceState::PSDualShock4,
+    &post_imu_filter_packets_stage<PSDualShock4Controller, DualShock4ControllerInputState, post_imu_filter_packets_for_ds4>,
+    &post_optical_filter_packet_stage<PSDualShock4Controller, post_optical_filter_packet_for_ds4>,
+    &generate_psdualshock4_data_frame_for_stream
+};
+
+static const ControllerPipeline k_virtual_controller_pipeline = {
+    CommonDeviceState::VirtualController,
+    nullptr, // No IMU, external poses get posted by pollExternalPoses()
+    &post_optical_filter_packet_stage<VirtualController, post_optical_filter_packet_for_virtual_controller>,
+    &generate_virtual_controller_data_frame_for_stream
+};
+
+static const ControllerPipeline *select_controller_pipeline(const CommonDeviceState::eDeviceType deviceType)
+{
+    switch (deviceType)
+    {
+    case CommonDeviceState::PSMove:
+        return &k_psmove_pipeline;
+    case CommonDeviceState::PSNavi:
+        return &k_psnavi_pipeline;
+    case CommonDeviceState::PSDualShock4:
+        return &k_psdualshock4_pipeline;
+    case CommonDeviceState::VirtualController:
+        return &k_virtual_controller_pipeline;
+    default:
+        return nullptr;
+    }
+}
+
+// One sample per tracker that currently sees the controller, for clients calibrating all trackers at once.
+// Unlike the selected tracker's raw data the screen location is always the projected tracker relative position.
+template <typename t_raw_tracker_data>
+static void add_controller_tracker_samples(
+    const ServerControllerView *controller_view,
+    bool bUsePackedTrackerData,
+    t_raw_tracker_data *raw_tracker_data)
+{
+    for (int trackerId = 0; trackerId < controller_view->getTrackerPoseEstimateCount(); ++trackerId)
+    {
+        const ControllerOpticalPoseEstimation *positionEstimate =
+            controller_view->getTrackerPoseEstimate(trackerId);
+
+        if (positionEstimate != nullptr && positionEstimate->bCurrentlyTracking)
+        {
+            const CommonDevicePosition &trackerRelativePosition = positionEstimate->position_cm;
+            const ServerTrackerViewPtr tracker_view = DeviceManager::getInstance()->getTrackerViewPtr(trackerId);
+            const CommonDeviceScreenLocation trackerScreenLocation =
+                tracker_view->projectTrackerRelativePosition(&trackerRelativePosition);
+
+            if (bUsePackedTrackerData)
+            {
+                packed_tracker_data_append_sample(
+                    raw_tracker_data->mutable_packed_tracker_samples(),
+                    trackerId,
+                    trackerScreenLocation.x, trackerScreenLocation.y,
+                    trackerRelativePosition.x, trackerRelativePosition.y, trackerRelativePosition.z);
+            }
+            else
+            {
+                PSMoveProtocol::TrackerSample *sample = raw_tracker_data->add_tracker_samples();
+
+                sample->set_tracker_id(trackerId);
+                sample->mutable_screen_location()->set_x(trackerScreenLocation.x);
+                sample->mutable_screen_location()->set_y(trackerScreenLocation.y);
+                sample->mutable_relative_position_cm()->set_x(trackerRelativePosition.x);
+                sample->mutable_relative_position_cm()->set_y(trackerRelativePosition.y);
+                sample->mutable_relative_position_cm()->set_z(trackerRelativePosition.z);
+            }
+        }
+    }
+}
+
 static IPoseFilter *
 pose_filter_factory(
     const CommonDeviceState::eDeviceType deviceType,
@@ -1924,6 +2688,50 @@ pose_filter_factory(
             assert(0 && "unreachable");
         }
     }
+    else if (position_filter_type == "PoseKalmanFloat" && orientation_filter_type == "PoseKalmanFloat")
+    {
+        // Same filter as "PoseKalman" but updated in single precision (cheaper at 1kHz IMU rates)
+        switch (deviceType)
+        {
+        case CommonDeviceState::PSMove:
+        case CommonDeviceState::VirtualController:
+            {
+                KalmanPoseFilterPSMovef *kalmanFilter = new KalmanPoseFilterPSMovef();
+                kalmanFilter->init(constants);
+                filter= kalmanFilter;
+            } break;
+        case CommonDeviceState::PSDualShock4:
+            {
+                KalmanPoseFilterDS4f *kalmanFilter = new KalmanPoseFilterDS4f();
+                kalmanFilter->init(constants);
+                filter= kalmanFilter;
+            } break;
+        default:
+            assert(0 && "unreachable");
+        }
+    }
+    else if (position_filter_type == "PoseErrorStateKalman" && orientation_filter_type == "PoseErrorStateKalman")
+    {
+        // Error-state EKF: linearized updates instead of sigma points, a fraction of the SR-UKF cost per update
+        switch (deviceType)
+        {
+        case CommonDeviceState::PSMove:
+        case CommonDeviceState::VirtualController:
+            {
+                ErrorStateKalmanPoseFilterPSMove *kalmanFilter = new ErrorStateKalmanPoseFilterPSMove();
+                kalmanFilter->init(constants);
+                filter= kalmanFilter;
+            } break;
+        case CommonDeviceState::PSDualShock4:
+            {
+                ErrorStateKalmanPoseFilterDS4 *kalmanFilter = new ErrorStateKalmanPoseFilterDS4();
+                kalmanFilter->init(constants);
+                filter= kalmanFilter;
+            } break;
+        default:
+            assert(0 && "unreachable");
+        }
+    }
     else
     {
         // Convert the position filter type string into an enum
@@ -1956,6 +2764,10 @@ pose_filter_factory(
         {
             position_filter_enum= PositionFilterTypeKalman;
         }
+        else if (position_filter_type == "OneEuro")
+        {
+            position_filter_enum= PositionFilterTypeOneEuro;
+        }
         else
         {
             SERVER_LOG_INFO("pose_filter_factory()") << 
@@ -2038,6 +2850,93 @@ pose_filter_factory(
     return filter;
 }
 
+static void
+free_warm_start_pose_filter(WarmStartPoseFilter &entry)
+{
+    delete entry.pose_filter;
+    entry.pose_filter = nullptr;
+
+    delete entry.pose_filter_space;
+    entry.pose_filter_space = nullptr;
+}
+
+static void
+stash_warm_start_pose_filter(
+    const std::string &serial,
+    const CommonDeviceState::eDeviceType device_type,
+    IPoseFilter *pose_filter,
+    PoseFilterSpace *pose_filter_space)
+{
+    const t_high_resolution_timepoint now = std::chrono::high_resolution_clock::now();
+    const int max_gap_ms = DeviceManager::getInstance()->m_controller_manager->getConfig().filter_warm_start_max_gap_ms;
+
+    // Drop the filters of controllers that stayed away too long to be resumed
+    for (auto it = g_warm_start_pose_filters.begin(); it != g_warm_start_pose_filters.end(); )
+    {
+        const std::chrono::duration<double, std::milli> gap = now - it->second.close_timestamp;
+
+        if (it->first == serial || gap.count() > max_gap_ms)
+        {
+            free_warm_start_pose_filter(it->second);
+            it = g_warm_start_pose_filters.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (max_gap_ms > 0 && !serial.empty())
+    {
+        WarmStartPoseFilter entry;
+        entry.device_type = device_type;
+        entry.close_timestamp = now;
+        entry.pose_filter = pose_filter;
+        entry.pose_filter_space = pose_filter_space;
+
+        g_warm_start_pose_filters[serial] = entry;
+    }
+    else
+    {
+        delete pose_filter;
+        delete pose_filter_space;
+    }
+}
+
+static bool
+claim_warm_start_pose_filter(
+    const std::string &serial,
+    const CommonDeviceState::eDeviceType device_type,
+    const int max_gap_ms,
+    IPoseFilter **out_pose_filter,
+    PoseFilterSpace **out_pose_filter_space)
+{
+    bool bClaimed = false;
+    auto it = g_warm_start_pose_filters.find(serial);
+
+    if (it != g_warm_start_pose_filters.end())
+    {
+        const std::chrono::duration<double, std::milli> gap =
+            std::chrono::high_resolution_clock::now() - it->second.close_timestamp;
+
+        // A stale filter would only take longer to pull back than a fresh one takes to converge
+        if (it->second.device_type == device_type && gap.count() <= max_gap_ms)
+        {
+            *out_pose_filter = it->second.pose_filter;
+            *out_pose_filter_space = it->second.pose_filter_space;
+            bClaimed = true;
+        }
+        else
+        {
+            free_warm_start_pose_filter(it->second);
+        }
+
+        g_warm_start_pose_filters.erase(it);
+    }
+
+    return bClaimed;
+}
+
 static void
 init_filters_for_psmove(
     const PSMoveController *psmoveController, 
@@ -2313,6 +3212,40 @@ static void post_imu_filter_packets_for_psmove(
 	}
 }
 
+/// Variance of a multicam optical position (cm^2), from the live quality of its projections:
+/// the calibrated variance for the projection area, scaled up by the sphere fit residual
+/// and down by the number of trackers the position got triangulated from
+static float compute_optical_position_variance_cm_sqr(
+    const float position_variance_exp_fit_a,
+    const float position_variance_exp_fit_b,
+    const ControllerOpticalPoseEstimation *pose_estimation)
+{
+    const ControllerManagerConfig &cfg = DeviceManager::getInstance()->m_controller_manager->getConfig();
+    const ExponentialCurve position_variance_curve = { position_variance_exp_fit_a, position_variance_exp_fit_b, 1.f };
+
+    float variance_cm_sqr = position_variance_curve.evaluate(pose_estimation->projection.screen_area);
+
+    if (cfg.reference_sphere_fit_residual > 0.f)
+    {
+        const float residual_fraction = pose_estimation->projection.fit_residual / cfg.reference_sphere_fit_residual;
+
+        variance_cm_sqr *= 1.f + residual_fraction*residual_fraction;
+    }
+
+    // Independent measurements from N cameras average out to 1/N of the variance
+    variance_cm_sqr /= static_cast<float>(std::max(pose_estimation->tracker_count, 1));
+
+    return variance_cm_sqr;
+}
+
+/// True if the optical position is too noisy to be worth a filter update
+static bool should_drop_optical_position(const float position_variance_cm_sqr)
+{
+    const ControllerManagerConfig &cfg = DeviceManager::getInstance()->m_controller_manager->getConfig();
+
+    return cfg.max_optical_position_variance > 0.f && position_variance_cm_sqr > cfg.max_optical_position_variance;
+}
+
 static void post_optical_filter_packet_for_psmove(
     const PSMoveController *psmove,
     const t_high_resolution_timepoint now,
@@ -2331,12 +3264,19 @@ static void post_optical_filter_packet_for_psmove(
 	// PSMove does have an optical position
     if (pose_estimation->bCurrentlyTracking)
     {
-		sensor_packet.optical_position_cm =
-		Eigen::Vector3f(
-				pose_estimation->position_cm.x,
-				pose_estimation->position_cm.y,
-				pose_estimation->position_cm.z);
+		const float position_variance_cm_sqr =
+			compute_optical_position_variance_cm_sqr(
+				config->position_variance_exp_fit_a, config->position_variance_exp_fit_b, pose_estimation);
+
+		if (should_drop_optical_position(position_variance_cm_sqr))
+		{
+			return;
+		}
+
+		sensor_packet.optical_position_cm = eigen_vector3f_view(pose_estimation->position_cm);
 		sensor_packet.tracking_projection_area_px_sqr= pose_estimation->projection.screen_area;
+		sensor_packet.optical_position_variance_cm_sqr= position_variance_cm_sqr;
+		sensor_packet.optical_follows_frame_gap= pose_estimation->bFollowsFrameGap;
     }
 
 	pose_filter_queue->push_back(sensor_packet);
@@ -2397,12 +3337,7 @@ static void post_optical_filter_packet_for_ds4(
 
     if (pose_estimation->bOrientationValid)
     {
-        sensor_packet.optical_orientation = 
-            Eigen::Quaternionf(
-                pose_estimation->orientation.w, 
-                pose_estimation->orientation.x,
-                pose_estimation->orientation.y,
-                pose_estimation->orientation.z);
+        sensor_packet.optical_orientation = eigen_quaternionf_view(pose_estimation->orientation);
     }
 
     if (pose_estimation->bCurrentlyTracking)
@@ -2410,13 +3345,19 @@ static void post_optical_filter_packet_for_ds4(
 		const float screen_area =
 			(pose_estimation->projection.screen_area > config->min_screen_projection_area)
 			? pose_estimation->projection.screen_area : 0.f;
+		const float position_variance_cm_sqr =
+			compute_optical_position_variance_cm_sqr(
+				config->position_variance_exp_fit_a, config->position_variance_exp_fit_b, pose_estimation);
 
-		sensor_packet.optical_position_cm =
-		Eigen::Vector3f(
-				pose_estimation->position_cm.x,
-				pose_estimation->position_cm.y,
-				pose_estimation->position_cm.z);
+		if (should_drop_optical_position(position_variance_cm_sqr))
+		{
+			return;
+		}
+
+		sensor_packet.optical_position_cm = eigen_vector3f_view(pose_estimation->position_cm);
 		sensor_packet.tracking_projection_area_px_sqr= screen_area;
+		sensor_packet.optical_position_variance_cm_sqr= position_variance_cm_sqr;
+		sensor_packet.optical_follows_frame_gap= pose_estimation->bFollowsFrameGap;
     }
 
 	pose_filter_queue->push_back(sensor_packet);
@@ -2440,15 +3381,68 @@ static void post_optical_filter_packet_for_virtual_controller(
 
     if (pose_estimation->bCurrentlyTracking)
     {
-		sensor_packet.optical_position_cm =
-		Eigen::Vector3f(
-				pose_estimation->position_cm.x,
-				pose_estimation->position_cm.y,
-				pose_estimation->position_cm.z);
+		const float position_variance_cm_sqr =
+			compute_optical_position_variance_cm_sqr(
+				config->position_variance_exp_fit_a, config->position_variance_exp_fit_b, pose_estimation);
+
+		if (should_drop_optical_position(position_variance_cm_sqr))
+		{
+			return;
+		}
+
+		sensor_packet.optical_position_cm = eigen_vector3f_view(pose_estimation->position_cm);
 		sensor_packet.tracking_projection_area_px_sqr= pose_estimation->projection.screen_area;
+		sensor_packet.optical_position_variance_cm_sqr= position_variance_cm_sqr;
+		sensor_packet.optical_follows_frame_gap= pose_estimation->bFollowsFrameGap;
+    }
+
+	pose_filter_queue->push_back(sensor_packet);
+}
+
+static bool post_external_filter_packet_for_virtual_controller(
+    const VirtualController *virtual_controller,
+    const ExternalPoseSample &sample,
+    const t_high_resolution_timepoint now,
+    const int64_t now_us,
+    const int64_t max_age_us,
+	t_controller_pose_optical_queue *pose_filter_queue)
+{
+    const VirtualControllerConfig *config = virtual_controller->getConfig();
+
+    // The timestamp is on the producer's steady clock, so only its age carries over to our clock
+    const int64_t age_us = std::max<int64_t>(now_us - sample.timestamp_us, 0);
+
+    // Virtual controllers only have a position filter
+    if ((sample.flags & EXTERNAL_POSE_FLAG_HAS_POSITION) == 0 || age_us > max_age_us)
+    {
+        return false;
+    }
+
+    const float position_variance_cm_sqr =
+        (sample.position_variance_cm_sqr > 0.f) ? sample.position_variance_cm_sqr : config->external_pose_position_variance;
+
+    if (should_drop_optical_position(position_variance_cm_sqr))
+    {
+        return false;
     }
 
+    PoseSensorPacket sensor_packet;
+
+    sensor_packet.clear();
+	sensor_packet.timestamp= now - std::chrono::duration_cast<t_high_resolution_duration>(std::chrono::microseconds(age_us));
+	sensor_packet.optical_position_cm = Eigen::Vector3f(sample.position_cm[0], sample.position_cm[1], sample.position_cm[2]);
+	sensor_packet.tracking_projection_area_px_sqr= k_external_pose_projection_area_px_sqr;
+	sensor_packet.optical_position_variance_cm_sqr= position_variance_cm_sqr;
+
+	if ((sample.flags & EXTERNAL_POSE_FLAG_HAS_ORIENTATION) != 0)
+	{
+		sensor_packet.optical_orientation = 
+			Eigen::Quaternionf(sample.orientation[0], sample.orientation[1], sample.orientation[2], sample.orientation[3]).normalized();
+	}
+
 	pose_filter_queue->push_back(sensor_packet);
+
+	return true;
 }
 
 static void computeSpherePoseForControllerFromSingleTracker(
@@ -2466,8 +3460,10 @@ static void computeSpherePoseForControllerFromSingleTracker(
     multicam_pose_estimation->position_cm = tracker->computeWorldPosition(&tracker_pose_estimation->position_cm);
     multicam_pose_estimation->bCurrentlyTracking = true;
 
-    // Copy over the screen projection area
+    // Copy over the screen projection area and the quality of the sphere fit
     multicam_pose_estimation->projection.screen_area = tracker_pose_estimation->projection.screen_area;
+    multicam_pose_estimation->projection.fit_residual = tracker_pose_estimation->projection.fit_residual;
+    multicam_pose_estimation->tracker_count = 1;
 }
 
 static void computeLightBarPoseForControllerFromSingleTracker(
@@ -2508,6 +3504,8 @@ static void computeLightBarPoseForControllerFromSingleTracker(
         
         // Copy over the screen projection area
         multicam_pose_estimation->projection.screen_area = tracker_pose_estimation->projection.screen_area;
+        multicam_pose_estimation->projection.fit_residual = 0.f;
+        multicam_pose_estimation->tracker_count = 1;
     }
     else
     {
@@ -2525,9 +3523,13 @@ static void computeSpherePoseForControllerFromMultipleTrackers(
 {
     const TrackerManagerConfig &cfg = tracker_manager->getConfig();
     float screen_area_sum = 0;
+    float fit_residual_sum = 0;
 
-    // Project the tracker relative 3d tracking position back on to the tracker camera plane
+    // Gather the tracker relative 3d tracking positions
     // and sum up the total controller projection area across all trackers
+    const ServerTrackerView *projection_trackers[TrackerManager::k_max_devices];
+    CommonDevicePosition tracker_relative_positions[TrackerManager::k_max_devices];
+    CommonDevicePosition tracker_positions[TrackerManager::k_max_devices];
     CommonDeviceScreenLocation position2d_list[TrackerManager::k_max_devices];
     for (int list_index = 0; list_index < projections_found; ++list_index)
     {
@@ -2535,97 +3537,114 @@ static void computeSpherePoseForControllerFromMultipleTrackers(
         const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
         const ControllerOpticalPoseEstimation &poseEstimate = tracker_pose_estimations[tracker_id];
 
-        position2d_list[list_index] = tracker->projectTrackerRelativePosition(&poseEstimate.position_cm);
+        projection_trackers[list_index] = tracker.get();
+        tracker_relative_positions[list_index] = poseEstimate.position_cm;
+        tracker_positions[list_index] = tracker->getTrackerPose().PositionCm;
         screen_area_sum += poseEstimate.projection.screen_area;
+        fit_residual_sum += poseEstimate.projection.fit_residual;
     }
 
-    // Compute triangulations amongst all pairs of projections
-    int pair_count = 0;
+    // Project every tracker relative position back on to its camera plane in one pass
+    ServerTrackerView::projectTrackerRelativePositionsBatch(
+        projection_trackers, tracker_relative_positions, projections_found, position2d_list);
+
+    // Pick the trackers that take part in the triangulation.
+    // With exclude_opposed_cameras a tracker is only used if at least one non-opposed tracker also sees the sphere.
+    const ServerTrackerView *triangulation_trackers[TrackerManager::k_max_devices];
+    CommonDeviceScreenLocation triangulation_screen_locations[TrackerManager::k_max_devices];
+    float triangulation_weights[TrackerManager::k_max_devices];
+    int triangulation_count = 0;
     int biggest_prjection_id = -1;
-    CommonDevicePosition average_world_position = { 0.f, 0.f, 0.f };
     for (int list_index = 0; list_index < projections_found; ++list_index)
     {
         const int tracker_id = valid_projection_tracker_ids[list_index];
-        const CommonDeviceScreenLocation &screen_location = position2d_list[list_index];
         const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
+        const float screen_area = tracker_pose_estimations[tracker_id].projection.screen_area;
 
-        for (int other_list_index = list_index + 1; other_list_index < projections_found; ++other_list_index)
+        if (biggest_prjection_id < 0 || screen_area > tracker_pose_estimations[biggest_prjection_id].projection.screen_area)
         {
-            const int other_tracker_id = valid_projection_tracker_ids[other_list_index];
-            const CommonDeviceScreenLocation &other_screen_location = position2d_list[other_list_index];
-            const ServerTrackerViewPtr other_tracker = tracker_manager->getTrackerViewPtr(other_tracker_id);
-            // if trackers are on poposite sides
-            if (cfg.exclude_opposed_cameras)
-            {
-                if ((tracker->getTrackerPose().PositionCm.x > 0) == (other_tracker->getTrackerPose().PositionCm.x < 0) &&
-                    (tracker->getTrackerPose().PositionCm.z > 0) == (other_tracker->getTrackerPose().PositionCm.z < 0))
-                {
-                    float screen_area = tracker_pose_estimations[tracker_id].projection.screen_area;
-                    float other_screen_area = tracker_pose_estimations[other_tracker_id].projection.screen_area;
-
-                    biggest_prjection_id = screen_area > other_screen_area ? tracker_id : other_tracker_id;
+            biggest_prjection_id = tracker_id;
+        }
 
-                    continue;
-                }
+        bool bHasPartner = !cfg.exclude_opposed_cameras;
+        for (int other_list_index = 0; !bHasPartner && other_list_index < projections_found; ++other_list_index)
+        {
+            if (other_list_index == list_index)
+            {
+                continue;
             }
 
-            // Using the screen locations on two different trackers we can triangulate a world position
-            CommonDevicePosition world_position =
-                ServerTrackerView::triangulateWorldPosition(
-                    tracker.get(), &screen_location,
-                    other_tracker.get(), &other_screen_location);
+            const CommonDevicePosition &position = tracker_positions[list_index];
+            const CommonDevicePosition &other_position = tracker_positions[other_list_index];
 
-            average_world_position.x += world_position.x;
-            average_world_position.y += world_position.y;
-            average_world_position.z += world_position.z;
+            // if trackers are on opposite sides
+            const bool bOpposed =
+                (position.x > 0) == (other_position.x < 0) &&
+                (position.z > 0) == (other_position.z < 0);
 
-            ++pair_count;
+            bHasPartner = !bOpposed;
+        }
+
+        if (bHasPartner)
+        {
+            triangulation_trackers[triangulation_count] = tracker.get();
+            triangulation_screen_locations[triangulation_count] = position2d_list[list_index];
+            triangulation_weights[triangulation_count] = screen_area;
+            ++triangulation_count;
         }
     }
 
-    if (pair_count == 0 && biggest_prjection_id >= 0 && !DeviceManager::getInstance()->m_tracker_manager->getConfig().ignore_pose_from_one_tracker)
+    // Triangulate the world position from all of the selected trackers at once,
+    // weighting each camera by its projection area
+    CommonDevicePosition world_position = { 0.f, 0.f, 0.f };
+    const bool bTriangulated =
+        triangulation_count >= 2 &&
+        ServerTrackerView::triangulateWorldPositionFromMultipleTrackers(
+            triangulation_trackers,
+            triangulation_screen_locations,
+            triangulation_weights,
+            triangulation_count,
+            cfg.triangulation_refinement_iterations,
+            &world_position);
+
+    if (!bTriangulated && biggest_prjection_id >= 0 && !DeviceManager::getInstance()->m_tracker_manager->getConfig().ignore_pose_from_one_tracker)
     {
-        // Position not triangulated from opposed camera, estimate from one tracker only.
-
+        // Position not triangulated (opposed or degenerate cameras), estimate from one tracker only.
         computeSpherePoseForControllerFromSingleTracker(
             controllerView,
             tracker_manager->getTrackerViewPtr(biggest_prjection_id),
             &tracker_pose_estimations[biggest_prjection_id],
-            multicam_pose_estimation);		
+            multicam_pose_estimation);
     }
-    else if(pair_count > 0)
+    else if (bTriangulated)
     {
-        // Compute the average position
-        const float N = static_cast<float>(pair_count);
-
-        average_world_position.x /= N;
-        average_world_position.y /= N;
-        average_world_position.z /= N;
-
-        // Store the averaged tracking position
+        // Store the triangulated tracking position
         const float q = tracker_manager->getConfig().controller_position_smoothing;
         if (q <= 0.01f)
         {
-            multicam_pose_estimation->position_cm = average_world_position;
+            multicam_pose_estimation->position_cm = world_position;
         }
         else
         {
-            multicam_pose_estimation->position_cm.x = q * multicam_pose_estimation->position_cm.x + (1 - q) * average_world_position.x;
-            multicam_pose_estimation->position_cm.y = q * multicam_pose_estimation->position_cm.y + (1 - q) * average_world_position.y;
-            multicam_pose_estimation->position_cm.z = q * multicam_pose_estimation->position_cm.z + (1 - q) * average_world_position.z;
+            multicam_pose_estimation->position_cm.x = q * multicam_pose_estimation->position_cm.x + (1 - q) * world_position.x;
+            multicam_pose_estimation->position_cm.y = q * multicam_pose_estimation->position_cm.y + (1 - q) * world_position.y;
+            multicam_pose_estimation->position_cm.z = q * multicam_pose_estimation->position_cm.z + (1 - q) * world_position.z;
         }
 
         multicam_pose_estimation->bCurrentlyTracking = true;
+        multicam_pose_estimation->tracker_count = triangulation_count;
     }
 
     // No orientation for the sphere projection
     multicam_pose_estimation->orientation.clear();
     multicam_pose_estimation->bOrientationValid = false;
 
-    // Compute the average projection area.
-    // This is proportional to our position tracking quality.
+    // Compute the average projection area and sphere fit residual.
+    // These are proportional to our position tracking quality.
     multicam_pose_estimation->projection.screen_area =
         screen_area_sum / static_cast<float>(projections_found);
+    multicam_pose_estimation->projection.fit_residual =
+        fit_residual_sum / static_cast<float>(projections_found);
 }
 
 static void computeLightBarPoseForControllerFromMultipleTrackers(
@@ -2672,11 +3691,7 @@ static void computeLightBarPoseForControllerFromMultipleTrackers(
 
             // Add the quaternion to a list for the purpose of averaging
             world_orientations[pair_count] = 
-                Eigen::Quaternionf(
-                    world_pose.Orientation.w,
-                    world_pose.Orientation.x,
-                    world_pose.Orientation.y, 
-                    world_pose.Orientation.z);
+                eigen_quaternionf_view(world_pose.Orientation);
 
             // Weight the quaternion base on how visible the controller is on each screen
             orientation_weights[pair_count] = projection.screen_area + other_projection.screen_area;
@@ -2698,6 +3713,7 @@ static void computeLightBarPoseForControllerFromMultipleTrackers(
         // Store the averaged tracking position
         multicam_pose_estimation->position_cm = average_world_position;
         multicam_pose_estimation->bCurrentlyTracking = true;
+        multicam_pose_estimation->tracker_count = projections_found;
     }
 
     // Compute the average orientation
@@ -2710,10 +3726,7 @@ static void computeLightBarPoseForControllerFromMultipleTrackers(
                 pair_count,
                 &avg_world_orientation))
         {
-            multicam_pose_estimation->orientation.w = avg_world_orientation.w();
-            multicam_pose_estimation->orientation.x = avg_world_orientation.x();
-            multicam_pose_estimation->orientation.y = avg_world_orientation.y();
-            multicam_pose_estimation->orientation.z = avg_world_orientation.z();
+            eigen_quaternionf_view(multicam_pose_estimation->orientation)= avg_world_orientation;
             multicam_pose_estimation->bOrientationValid = true;
         }
         else
@@ -2726,4 +3739,5 @@ static void computeLightBarPoseForControllerFromMultipleTrackers(
     // This is proportional to our position tracking quality.
     multicam_pose_estimation->projection.screen_area =
         screen_area_sum / static_cast<float>(projections_found);
+    multicam_pose_estimation->projection.fit_residual = 0.f;
 }
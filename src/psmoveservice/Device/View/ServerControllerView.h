@@ -25,20 +25,31 @@ template<typename t_object_type>
 class AtomicObject;
 
 struct ShapeTimestampedPose;
+struct ControllerPipeline;
 
 // -- declarations -----
+// The fields every tracker's estimate gets checked against each update come first,
+// so the fusion loop in updateOpticalPoseEstimation() mostly stays within the first cache line.
+// The bulky projection is only needed by the pose solvers and goes last.
 struct ControllerOpticalPoseEstimation
 {
     std::chrono::time_point<std::chrono::high_resolution_clock> last_update_timestamp;
     std::chrono::time_point<std::chrono::high_resolution_clock> last_visible_timestamp;
     bool bValidTimestamps;
-
-    CommonDevicePosition position_cm; // centimeters
-    CommonDeviceTrackingProjection projection;
     bool bCurrentlyTracking;
+    bool bOrientationValid;
+
+    // Multicam pose only: not solved from the frames right after the previous pose's
+    // (a tracker dropped frames, or no tracker had a new frame), see PoseSensorPacket
+    bool bFollowsFrameGap;
 
+    CommonDevicePosition position_cm; // centimeters
     CommonDeviceQuaternion orientation;
-    bool bOrientationValid;
+
+    // Multicam pose only: number of trackers the position got triangulated from (1 if it came from a single tracker)
+    int tracker_count;
+
+    CommonDeviceTrackingProjection projection;
 
     inline void clear()
     {
@@ -48,6 +59,8 @@ struct ControllerOpticalPoseEstimation
 
         position_cm.clear();
         bCurrentlyTracking= false;
+        bFollowsFrameGap= false;
+        tracker_count= 0;
 
         orientation.clear();
         bOrientationValid= false;
@@ -57,6 +70,80 @@ struct ControllerOpticalPoseEstimation
     }
 };
 
+// Running statistics of the multicam optical pose used by the optical noise calibration.
+// Welford updates keep the mean and variance current without storing the samples.
+struct ControllerOpticalNoiseStatistics
+{
+    int target_sample_count;
+    int sample_count;
+    double projection_area_mean; // pixels^2
+
+    double position_mean_cm[3];
+    double position_m2_cm_sqr[3];
+
+    // Orientations are measured as rotation vectors relative to the first sampled orientation
+    int orientation_sample_count;
+    CommonDeviceQuaternion reference_orientation;
+    double orientation_mean_rad[3];
+    double orientation_m2_rad_sqr[3];
+
+    void clear();
+
+    inline bool getIsSampling() const { return sample_count < target_sample_count; }
+
+    void addSample(const ControllerOpticalPoseEstimation &pose_estimate);
+
+    // Largest variance of the position axes, in cm^2
+    float getPositionVariance() const;
+
+    // Variance of the angle from the mean orientation, in radians^2
+    float getOrientationVariance() const;
+};
+
+// One IMU reading recorded by a ControllerIMUCaptureSession
+struct ControllerIMUCaptureSample
+{
+    std::chrono::time_point<std::chrono::high_resolution_clock> timestamp;
+    CommonRawDeviceVector raw_accelerometer;
+    CommonRawDeviceVector raw_gyroscope;
+    Eigen::Vector3f accelerometer_g_units;
+    Eigen::Vector3f gyroscope_rad_per_sec;
+};
+
+// Every IMU reading of the controller over a gyroscope / accelerometer calibration capture.
+// Samples get recorded as the main thread drains the IMU packet queue, so the capture sees
+// both readings of a PSMove report instead of the newest one per data frame.
+// The statistics get computed once the last sample came in.
+struct ControllerIMUCaptureSession
+{
+    int target_sample_count;
+    std::vector<ControllerIMUCaptureSample> samples;
+
+    // Only valid once getIsComplete()
+    float duration_sec;
+    Eigen::Vector3f raw_accelerometer_mean;
+    Eigen::Vector3f raw_accelerometer_variance;
+    Eigen::Vector3f raw_gyroscope_mean;
+    Eigen::Vector3f raw_gyroscope_variance;
+    Eigen::Vector3f accelerometer_mean_g_units;
+    float accelerometer_variance_g_units_sqr; // largest variance of the axes
+    float accelerometer_noise_radius_g_units; // largest distance of a sample from the mean
+    float gyroscope_variance_rad_per_sec_sqr; // largest variance of the axes
+    float gyroscope_drift_rate_rad_per_sec; // largest integrated rotation of the axes, per second
+
+    // Also frees the recorded samples
+    void clear();
+
+    inline int getSampleCount() const { return static_cast<int>(samples.size()); }
+    inline bool getIsSampling() const { return getSampleCount() < target_sample_count; }
+    inline bool getIsComplete() const { return target_sample_count > 0 && !getIsSampling(); }
+
+    void addSample(const PoseSensorPacket &packet);
+
+private:
+    void computeStatistics();
+};
+
 class ServerControllerView : public ServerDeviceView, public IControllerListener
 {
 public:
@@ -74,15 +161,31 @@ public:
 	// Recreate and initialize the pose filter for the controller
 	void resetPoseFilter();
 
+	// Resume the filter state the controller had when it closed, if it closed less than
+	// ControllerManagerConfig::filter_warm_start_max_gap_ms ago, otherwise resetPoseFilter()
+	void warmStartPoseFilter();
+
     // Compute pose/prediction of tracking blob+IMU state
     void updateOpticalPoseEstimation(TrackerManager* tracker_manager);
     void updateStateAndPredict();
 
+    // Whether the pose filter can step together with other controllers' filters in a PoseFilterBatch
+    bool getCanBatchPoseFilter() const;
+    // updateStateAndPredict() split around a PoseFilterBatch update: queues the new sensor packets on the batch.
+    // Returns true if endBatchedStateUpdate() has to be called once the batch has been updated.
+    bool beginBatchedStateUpdate(class PoseFilterBatch *pose_filter_batch);
+    void endBatchedStateUpdate();
+
+    // Virtual controllers only: queue up the poses an external tracker wrote into the
+    // shared memory pose input since the last poll (see SharedPoseInput.h)
+    void pollExternalPoses(class SharedPoseInputReader *pose_input_reader);
+
     // Registers the address of the bluetooth adapter on the host PC with the controller
     bool setHostBluetoothAddress(const std::string &address);
     
     IDeviceInterface* getDevice() const override {return m_device;}
-    inline class IPoseFilter * getPoseFilterMutable() { return m_pose_filter; }
+    // Any mutable access may change the filter state, so it drops the cached filtered pose
+    inline class IPoseFilter * getPoseFilterMutable() { m_filtered_pose_cache.invalidate(); return m_pose_filter; }
     inline const class IPoseFilter * getPoseFilter() const { return m_pose_filter; }
 
     // Estimate the given pose if the controller at some point into the future
@@ -148,6 +251,9 @@ public:
     // Set the assigned tracking color ID for the controller
     bool setTrackingColorID(eCommonTrackingColorID colorID);
 
+    // How the vision scheduler ranks the controller against the other tracked devices
+    inline eCommonVisionPriority getVisionPriority() const { return m_device->getVisionPriority(); }
+
     // Get the tracking is enabled on this controller
     inline bool getIsTrackingEnabled() const { return m_tracking_enabled && m_multicam_pose_estimation != nullptr; }
 
@@ -176,7 +282,17 @@ public:
 
     // Get the pose estimate relative to the given tracker id
     inline const ControllerOpticalPoseEstimation *getTrackerPoseEstimate(int trackerId) const {
-        return (m_tracker_pose_estimations != nullptr) ? &m_tracker_pose_estimations[trackerId] : nullptr;
+        return (m_tracker_pose_estimations != nullptr && trackerId >= 0 && trackerId < m_tracker_pose_estimation_count) 
+            ? &m_tracker_pose_estimations[trackerId] : nullptr;
+    }
+
+    // Number of tracker slots there are pose estimates for
+    inline int getTrackerPoseEstimateCount() const { return m_tracker_pose_estimation_count; }
+
+    // Set while enough trackers with a better view of the controller get fused that the given one is left out
+    // (see TrackerManagerConfig::max_fused_tracker_count)
+    inline bool getIsTrackerOnFusionStandby(int trackerId) const {
+        return trackerId >= 0 && trackerId < static_cast<int>(m_tracker_fusion_standby.size()) && m_tracker_fusion_standby[trackerId];
     }
 
     // Get the pose estimate derived from multicam pose tracking
@@ -189,6 +305,30 @@ public:
         return getIsTrackingEnabled() ? m_multicam_pose_estimation->bCurrentlyTracking : false;
     }
 
+    // Goes up by one for every filter update that fused a new optical measurement.
+    // Dual rate streams only resend the position when this changed.
+    inline int getOpticalUpdateCount() const {
+        return m_optical_update_count;
+    }
+
+    // Restart the optical noise statistics and gather them over the next sample_count optical poses.
+    // A sample count of 0 stops the sampling.
+    void startOpticalNoiseSampling(int sample_count);
+
+    // Get the optical noise statistics gathered since the last startOpticalNoiseSampling()
+    inline const ControllerOpticalNoiseStatistics &getOpticalNoiseStatistics() const {
+        return m_optical_noise_statistics;
+    }
+
+    // Restart the IMU capture and record the next sample_count IMU readings (capped at the capture limit).
+    // A sample count of 0 stops the capture. Returns false for controllers without an IMU.
+    bool startIMUCapture(int sample_count);
+
+    // Get the IMU capture recorded since the last startIMUCapture()
+    inline const ControllerIMUCaptureSession &getIMUCaptureSession() const {
+        return m_imu_capture_session;
+    }
+
     // Set the rumble value between 0.f-1.f on a channel
     bool setControllerRumble(float rumble_amount, CommonControllerState::RumbleChannel channel);
 
@@ -198,6 +338,13 @@ public:
         const struct ControllerStreamInfo *stream_info,
         PSMoveProtocol::DeviceOutputDataFrame *data_frame);
 
+    // Helper used to publish the current controller state to the given fixed layout pose frame.
+    // Returns false for controller types that don't support the compact pose stream.
+    static bool generate_controller_compact_pose_frame_for_stream(
+        const ServerControllerView *controller_view,
+        const struct ControllerStreamInfo *stream_info,
+        struct CompactControllerPoseFrame *pose_frame);
+
 	// Incoming device data callbacks
 	void notifySensorDataReceived(const CommonDeviceState *sensor_state) override;
 
@@ -208,6 +355,10 @@ protected:
     void free_device_interface() override;
     void publish_device_data_frame() override;
 
+    // Drains the sensor packet queues into the time sorted filter packets, returns true if there were any
+    bool drain_filter_packets();
+    void finish_filter_update();
+
 private:
     // Tracking color state
     std::tuple<unsigned char, unsigned char, unsigned char> m_tracking_color;
@@ -233,13 +384,26 @@ private:
 	t_controller_pose_optical_queue m_PoseSensorOpticalPacketQueue; // TODO: Currently on main thread
     
     // Filter state
-    ControllerOpticalPoseEstimation *m_tracker_pose_estimations; // array of size TrackerManager::k_max_devices
+    ControllerOpticalPoseEstimation *m_tracker_pose_estimations; // array of size m_tracker_pose_estimation_count
+    int m_tracker_pose_estimation_count; // the tracker manager's slot count when the device got allocated
+    std::vector<bool> m_tracker_fusion_standby; // one per tracker slot, see getIsTrackerOnFusionStandby()
     ControllerOpticalPoseEstimation *m_multicam_pose_estimation;
+    ControllerOpticalNoiseStatistics m_optical_noise_statistics;
+    ControllerIMUCaptureSession m_imu_capture_session;
     class IPoseFilter *m_pose_filter;
     class PoseFilterSpace *m_pose_filter_space;
+    mutable FilteredPoseCache m_filtered_pose_cache; // getFilteredPose()/getFilteredPhysics() results since the last filter update
     int m_lastPollSeqNumProcessed;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_last_filter_update_timestamp;
     bool m_last_filter_update_timestamp_valid;
+    int m_optical_update_count;
+    // Sensor packets of the current filter update, oldest first, along with the time delta of each
+    std::vector<PoseSensorPacket> m_filter_packets;
+    std::vector<float> m_filter_packet_time_deltas;
+    bool m_bFilterPacketsHaveOptical;
+
+    // Per sample stages of the device type, picked in allocate_device_interface() (see ControllerPipeline)
+    const ControllerPipeline *m_pipeline;
 };
 
 #endif // SERVER_CONTROLLER_VIEW_H
@@ -1,17 +1,163 @@
 //-- includes -----
 #include "ServerDeviceView.h"
+#include "DeviceManager.h"
+#include "MathUtility.h"
 #include "ServerLog.h"
+#include "ServerRequestHandler.h"
+#include "ServerTrace.h"
+#include "TrackerManager.h"
 
+#include <algorithm>
 #include <chrono>
+#include <math.h>
+
+//-- constants -----
+// Time constant of the pose latency moving average
+static const float k_pose_latency_time_constant_seconds = 0.25f;
+// Samples older than this are a stalled device rather than pipeline latency
+static const float k_max_pose_latency_sample_seconds = 0.25f;
 
 //-- private methods -----
 
 //-- public implementation -----
+//-- FilteredPoseCache -----
+FilteredPoseCache::FilteredPoseCache()
+    : m_next_pose_entry(0)
+    , m_physics_filter(nullptr)
+    , m_physics_revision(-1)
+    , m_revision(0)
+{
+    for (int entry_index = 0; entry_index < k_max_pose_entries; ++entry_index)
+    {
+        m_pose_entries[entry_index].filter= nullptr;
+        m_pose_entries[entry_index].revision= -1;
+        m_pose_entries[entry_index].time= 0.f;
+        m_pose_entries[entry_index].pose.clear();
+    }
+
+    m_physics.clear();
+}
+
+void FilteredPoseCache::invalidate()
+{
+    ++m_revision;
+}
+
+bool FilteredPoseCache::tryGetPose(const IPoseFilter *filter, float time, CommonDevicePose &out_pose) const
+{
+    for (int entry_index = 0; entry_index < k_max_pose_entries; ++entry_index)
+    {
+        const PoseEntry &entry= m_pose_entries[entry_index];
+
+        if (entry.revision == m_revision && entry.filter == filter && entry.time == time)
+        {
+            out_pose= entry.pose;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FilteredPoseCache::storePose(const IPoseFilter *filter, float time, const CommonDevicePose &pose)
+{
+    // Round robin replacement, stale entries get overwritten first in practice
+    // since there are only ever a handful of distinct prediction times
+    PoseEntry &entry= m_pose_entries[m_next_pose_entry];
+
+    entry.filter= filter;
+    entry.revision= m_revision;
+    entry.time= time;
+    entry.pose= pose;
+
+    m_next_pose_entry= (m_next_pose_entry + 1) % k_max_pose_entries;
+}
+
+bool FilteredPoseCache::tryGetPhysics(const IPoseFilter *filter, CommonDevicePhysics &out_physics) const
+{
+    if (m_physics_revision == m_revision && m_physics_filter == filter)
+    {
+        out_physics= m_physics;
+        return true;
+    }
+
+    return false;
+}
+
+void FilteredPoseCache::storePhysics(const IPoseFilter *filter, const CommonDevicePhysics &physics)
+{
+    m_physics_filter= filter;
+    m_physics_revision= m_revision;
+    m_physics= physics;
+}
+
+//-- PoseLatencyEstimator -----
+PoseLatencyEstimator::PoseLatencyEstimator()
+    : m_latency_seconds(0.f)
+    , m_last_publish_timestamp()
+    , m_bIsValid(false)
+    , m_metric(ServerMetric_COUNT)
+    , m_metric_slot(-1)
+{
+}
+
+void PoseLatencyEstimator::setMetric(eServerMetric metric, int slot)
+{
+    m_metric= metric;
+    m_metric_slot= slot;
+}
+
+void PoseLatencyEstimator::reset()
+{
+    m_latency_seconds= 0.f;
+    m_last_publish_timestamp= std::chrono::time_point<std::chrono::high_resolution_clock>();
+    m_bIsValid= false;
+}
+
+void PoseLatencyEstimator::addSample(
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &capture_timestamp,
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &publish_timestamp)
+{
+    const std::chrono::duration<float> latency= publish_timestamp - capture_timestamp;
+
+    if (latency.count() < 0.f || latency.count() > k_max_pose_latency_sample_seconds)
+    {
+        return;
+    }
+
+    if (m_metric != ServerMetric_COUNT)
+    {
+        ServerMetrics::record(
+            m_metric, m_metric_slot,
+            std::chrono::duration_cast<std::chrono::microseconds>(publish_timestamp - capture_timestamp).count());
+    }
+
+    if (m_bIsValid)
+    {
+        // Weight the sample by the time since the previous one so the average
+        // settles at the same rate whatever the publish rate is
+        const std::chrono::duration<float> time_delta= publish_timestamp - m_last_publish_timestamp;
+        const float alpha= 1.f - expf(-fmaxf(time_delta.count(), 0.f) / k_pose_latency_time_constant_seconds);
+
+        m_latency_seconds= lerpf(m_latency_seconds, latency.count(), alpha);
+    }
+    else
+    {
+        m_latency_seconds= latency.count();
+        m_bIsValid= true;
+    }
+
+    m_last_publish_timestamp= publish_timestamp;
+}
+
+//-- ServerDeviceView -----
 ServerDeviceView::ServerDeviceView(
     const int device_id)
     : m_bHasUnpublishedState(false)
     , m_pollNoDataCount(0)
     , m_sequence_number(0)
+    , m_pollRate()
+    , m_nextPollTime()
     , m_deviceID(device_id)
 {
 }
@@ -36,11 +182,26 @@ ServerDeviceView::open(const DeviceEnumerator *enumerator)
     {
         // Consider a successful opening as an update
         m_pollNoDataCount= 0;
+
+        // Poll it on the next update
+        resetPollSchedule();
     }
 
     return bSuccess;
 }
 
+void ServerDeviceView::scheduleNextPoll(
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &now,
+    int default_poll_interval_ms,
+    int min_poll_interval_ms)
+{
+    IDeviceInterface* device= getDevice();
+    const int device_poll_interval_ms= (device != nullptr) ? device->getPollIntervalMs() : -1;
+    const int poll_interval_ms= (device_poll_interval_ms >= 0) ? device_poll_interval_ms : default_poll_interval_ms;
+
+    m_nextPollTime= now + std::chrono::milliseconds(std::max(std::max(poll_interval_ms, min_poll_interval_ms), 0));
+}
+
 bool
 ServerDeviceView::getIsOpen() const
 {
@@ -83,6 +244,7 @@ bool ServerDeviceView::poll()
             {
                 m_pollNoDataCount= 0;
                 m_lastNewDataTimestamp= std::chrono::high_resolution_clock::now();
+                m_pollRate.addEvents();
 
                 // If we got new sensor data, then we have new state to publish
                 markStateAsUnpublished();
@@ -110,6 +272,8 @@ void ServerDeviceView::publish()
 {
     if (m_bHasUnpublishedState)
     {
+        SERVER_TRACE_DEVICE_SCOPE(ServerTraceStage_Serialize, getDeviceID());
+
         publish_device_data_frame();
 
         m_bHasUnpublishedState= false;
@@ -117,6 +281,23 @@ void ServerDeviceView::publish()
     }
 }
 
+float ServerDeviceView::getStreamPredictionTime(
+    const StreamPredictionTarget &target,
+    float config_prediction_time) const
+{
+    const TrackerManagerConfig &cfg= DeviceManager::getInstance()->m_tracker_manager->getConfig();
+
+    if (!cfg.use_adaptive_prediction || !m_pose_latency.getIsValid())
+    {
+        return target.getPredictionTime(config_prediction_time);
+    }
+
+    // The filter state is already as old as the pipeline latency when the time to display starts counting
+    const float time_to_display= target.getPredictionTime(cfg.adaptive_prediction_extra_time);
+
+    return clampf(m_pose_latency.getLatencySeconds() + time_to_display, 0.f, cfg.max_adaptive_prediction_time);
+}
+
 void
 ServerDeviceView::close()
 {
@@ -3,10 +3,87 @@
 
 //-- includes -----
 #include "DeviceInterface.h"
+#include "ServerMetrics.h"
+#include "ServerUtility.h"
+#include <algorithm>
 #include <chrono>
 #include <assert.h>
 
 // -- declarations -----
+/// Memoizes the filtered pose and physics of a device between pose filter updates.
+/**
+ Several client streams (and request handlers) usually ask a device for the same
+ predicted pose within one DeviceManager::update(). Entries are keyed by the filter
+ instance, the filter revision and the prediction time.
+ The owning view calls invalidate() whenever the filter state may have changed.
+ */
+class FilteredPoseCache
+{
+public:
+    FilteredPoseCache();
+
+    // Bumps the filter revision, dropping all cached results
+    void invalidate();
+
+    bool tryGetPose(const class IPoseFilter *filter, float time, CommonDevicePose &out_pose) const;
+    void storePose(const class IPoseFilter *filter, float time, const CommonDevicePose &pose);
+
+    bool tryGetPhysics(const class IPoseFilter *filter, CommonDevicePhysics &out_physics) const;
+    void storePhysics(const class IPoseFilter *filter, const CommonDevicePhysics &physics);
+
+private:
+    // Distinct prediction times asked for per tick (0, the config prediction time, a few client targets)
+    static const int k_max_pose_entries = 4;
+
+    struct PoseEntry
+    {
+        const class IPoseFilter *filter;
+        int revision;
+        float time;
+        CommonDevicePose pose;
+    };
+
+    PoseEntry m_pose_entries[k_max_pose_entries];
+    int m_next_pose_entry;
+
+    const class IPoseFilter *m_physics_filter;
+    int m_physics_revision;
+    CommonDevicePhysics m_physics;
+
+    int m_revision;
+};
+
+/// Running estimate of how old a device's filtered pose is by the time it gets published.
+/**
+ Measured from the capture time of the newest sample (IMU or video frame) the pose filter
+ consumed to the publish of the device's data frames, so it follows the camera frame rate,
+ main loop load and filter cost of the rig. Smoothed over a few hundred milliseconds.
+ Every accepted sample also goes into the ServerMetrics histogram set with setMetric().
+ */
+class PoseLatencyEstimator
+{
+public:
+    PoseLatencyEstimator();
+
+    void setMetric(eServerMetric metric, int slot);
+    void reset();
+    void addSample(
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &capture_timestamp,
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &publish_timestamp);
+
+    inline bool getIsValid() const
+    { return m_bIsValid; }
+    inline float getLatencySeconds() const
+    { return m_latency_seconds; }
+
+private:
+    float m_latency_seconds;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_publish_timestamp;
+    bool m_bIsValid;
+    eServerMetric m_metric; // ServerMetric_COUNT records nothing
+    int m_metric_slot;
+};
+
 class ServerDeviceView
 {
 public:
@@ -53,8 +130,43 @@ public:
     bool getIsOpen() const;
     inline bool getHasUnpublishedState()
     { return m_bHasUnpublishedState; }
+    // Sequence number the next published data frame goes out with
+    inline int getSequenceNumber() const
+    { return m_sequence_number; }
+    // Keeps the published sequence numbers from falling behind a data frame sent outside of publish()
+    // (a fixed rate stream output), so a client switching back to published frames doesn't drop them as stale
+    inline void reserveSequenceNumber(int sequence_number)
+    { m_sequence_number= std::max(m_sequence_number, sequence_number); }
     inline std::chrono::time_point<std::chrono::high_resolution_clock> getLastNewDataTimestamp() const
     { return m_lastNewDataTimestamp; }
+    // Polls per second that returned new data
+    inline float getPollRate()
+    { return m_pollRate.getRatePerSecond(); }
+    // Smoothed capture to publish latency of the filtered pose
+    inline float getPoseLatencySeconds() const
+    { return m_pose_latency.getLatencySeconds(); }
+
+    // When the device manager should poll the device next (right away after it opened)
+    inline std::chrono::time_point<std::chrono::high_resolution_clock> getNextPollTime() const
+    { return m_nextPollTime; }
+    inline bool getIsPollDue(const std::chrono::time_point<std::chrono::high_resolution_clock> &now) const
+    { return now >= m_nextPollTime; }
+    /// Schedules the next poll one poll interval of the device from now,
+    /// default_poll_interval_ms if the device has no preference (see IDeviceInterface::getPollIntervalMs()),
+    /// but no sooner than min_poll_interval_ms
+    void scheduleNextPoll(
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &now,
+        int default_poll_interval_ms,
+        int min_poll_interval_ms = 0);
+    /// Makes the device due for polling on the next update
+    inline void resetPollSchedule()
+    { m_nextPollTime= std::chrono::time_point<std::chrono::high_resolution_clock>(); }
+
+    /// Seconds a stream should extrapolate the filtered pose ahead.
+    /// With use_adaptive_prediction on this is the measured pose latency plus the time until the
+    /// stream's display target (or adaptive_prediction_extra_time without one),
+    /// otherwise the display target or the prediction time from the device config.
+    float getStreamPredictionTime(const struct StreamPredictionTarget &target, float config_prediction_time) const;
     
     // setters
     inline void markStateAsUnpublished()
@@ -68,7 +180,10 @@ protected:
     bool m_bHasUnpublishedState;
     int m_pollNoDataCount;
     int m_sequence_number;
+    ServerRateCounter m_pollRate;
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastNewDataTimestamp;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_nextPollTime;
+    PoseLatencyEstimator m_pose_latency;
     
 private:
     int m_deviceID;
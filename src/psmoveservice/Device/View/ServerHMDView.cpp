@@ -1,20 +1,36 @@
 //-- includes -----
+#include "CompactDataFrame.h"
+#include "DeviceInterfaceEigen.h"
 #include "DeviceManager.h"
 #include "ServerHMDView.h"
 #include "MathAlignment.h"
 #include "MorpheusHMD.h"
+#include "PackedTrackerData.h"
 #include "VirtualHMD.h"
 #include "CompoundPoseFilter.h"
 #include "PoseFilterInterface.h"
 #include "PSMoveProtocol.pb.h"
 #include "ServerLog.h"
+#include "ServerTrace.h"
 #include "ServerRequestHandler.h"
 #include "ServerTrackerView.h"
+#include "ServerUtility.h"
+#include "SharedPoseInput.h"
+#include "SharedPoseInputReader.h"
 #include "TrackerManager.h"
 
+#include <algorithm>
+#include <vector>
+
 //-- constants -----
 static const float k_min_time_delta_seconds = 1 / 120.f;
 static const float k_max_time_delta_seconds = 1 / 30.f;
+// Limits for the delta between two consecutive capture timestamped sensor samples
+static const float k_min_capture_time_delta_seconds = 1 / 2500.f;
+// Injected poses come with a variance of their own, this only marks their packets as optical measurements
+static const float k_external_pose_projection_area_px_sqr = 1.f;
+// Most injected poses read out of the shared memory ring at a time
+static const int k_external_pose_read_batch_size = 32;
 
 //-- private methods -----
 static void init_filters_for_morpheus_hmd(
@@ -25,27 +41,27 @@ static IPoseFilter *pose_filter_factory(
 	const CommonDeviceState::eDeviceType deviceType,
 	const std::string &position_filter_type, const std::string &orientation_filter_type,
 	const PoseFilterConstants &constants);
-static void update_filters_for_morpheus_hmd(
+static void append_filter_packets_for_morpheus_hmd(
 	const MorpheusHMD *morpheusHMD, const MorpheusHMDState *morpheusHMDState,
 	const float delta_time,
-	const HMDOpticalPoseEstimation *poseEstimation, const PoseFilterSpace *poseFilterSpace, IPoseFilter *poseFilter);
-static void update_filters_for_virtual_hmd(
+	const HMDOpticalPoseEstimation *poseEstimation,
+	std::vector<PoseSensorPacket> &outSensorPackets, std::vector<float> &outDeltaTimes);
+static void append_filter_packets_for_virtual_hmd(
 	const VirtualHMD *virtualHMD, const VirtualHMDState *virtualHMDState,
 	const float delta_time,
-	const HMDOpticalPoseEstimation *poseEstimation, const PoseFilterSpace *poseFilterSpace, IPoseFilter *poseFilter);
+	const HMDOpticalPoseEstimation *poseEstimation,
+	std::vector<PoseSensorPacket> &outSensorPackets, std::vector<float> &outDeltaTimes);
 static void generate_morpheus_hmd_data_frame_for_stream(
     const ServerHMDView *hmd_view, const HMDStreamInfo *stream_info,
     DeviceOutputDataFramePtr &data_frame);
 static void generate_virtual_hmd_data_frame_for_stream(
     const ServerHMDView *hmd_view, const HMDStreamInfo *stream_info,
     DeviceOutputDataFramePtr &data_frame);
-
-static Eigen::Vector3f CommonDevicePosition_to_EigenVector3f(const CommonDevicePosition &p);
-static Eigen::Vector3f CommonDeviceVector_to_EigenVector3f(const CommonDeviceVector &v);
-static Eigen::Quaternionf CommonDeviceQuaternion_to_EigenQuaternionf(const CommonDeviceQuaternion &q);
-
-static CommonDevicePosition EigenVector3f_to_CommonDevicePosition(const Eigen::Vector3f &p);
-static CommonDeviceQuaternion EigenQuaternionf_to_CommonDeviceQuaternion(const Eigen::Quaternionf &q);
+template <typename t_raw_tracker_data>
+static void add_hmd_tracker_samples(
+    const ServerHMDView *hmd_view,
+    bool bUsePackedTrackerData,
+    t_raw_tracker_data *raw_tracker_data);
 
 static void computeSpherePoseForHmdFromSingleTracker(
     const ServerHMDView *hmdView,
@@ -80,13 +96,20 @@ ServerHMDView::ServerHMDView(const int device_id)
 	, m_roi_disable_count(0)
 	, m_device(nullptr)
 	, m_tracker_pose_estimations(nullptr)
+	, m_tracker_pose_estimation_count(0)
 	, m_multicam_pose_estimation(nullptr)
 	, m_pose_filter(nullptr)
 	, m_pose_filter_space(nullptr)
 	, m_lastPollSeqNumProcessed(-1)
 	, m_last_filter_update_timestamp()
 	, m_last_filter_update_timestamp_valid(false)
+	, m_last_sample_capture_timestamp()
+	, m_last_sample_capture_timestamp_valid(false)
+	, m_external_pose_packets()
+	, m_external_pose_delta_times()
+	, m_last_external_pose_timestamp_us(0)
 {
+	m_pose_latency.setMetric(ServerMetric_HMDPoseLatency, device_id);
 }
 
 ServerHMDView::~ServerHMDView()
@@ -95,6 +118,10 @@ ServerHMDView::~ServerHMDView()
 
 bool ServerHMDView::allocate_device_interface(const class DeviceEnumerator *enumerator)
 {
+    // One pose estimate per tracker slot
+    m_tracker_pose_estimation_count = DeviceManager::getInstance()->getTrackerViewMaxCount();
+    m_tracker_fusion_standby.assign(m_tracker_pose_estimation_count, false);
+
     switch (enumerator->get_device_type())
     {
     case CommonDeviceState::Morpheus:
@@ -102,8 +129,8 @@ bool ServerHMDView::allocate_device_interface(const class DeviceEnumerator *enum
             m_device = new MorpheusHMD();
 			m_pose_filter = nullptr; // no pose filter until the device is opened
 
-			m_tracker_pose_estimations = new HMDOpticalPoseEstimation[TrackerManager::k_max_devices];
-			for (int tracker_index = 0; tracker_index < TrackerManager::k_max_devices; ++tracker_index)
+			m_tracker_pose_estimations = new HMDOpticalPoseEstimation[m_tracker_pose_estimation_count];
+			for (int tracker_index = 0; tracker_index < m_tracker_pose_estimation_count; ++tracker_index)
 			{
 				m_tracker_pose_estimations[tracker_index].clear();
 			}
@@ -116,8 +143,8 @@ bool ServerHMDView::allocate_device_interface(const class DeviceEnumerator *enum
             m_device = new VirtualHMD();
 			m_pose_filter = nullptr; // no pose filter until the device is opened
 
-			m_tracker_pose_estimations = new HMDOpticalPoseEstimation[TrackerManager::k_max_devices];
-			for (int tracker_index = 0; tracker_index < TrackerManager::k_max_devices; ++tracker_index)
+			m_tracker_pose_estimations = new HMDOpticalPoseEstimation[m_tracker_pose_estimation_count];
+			for (int tracker_index = 0; tracker_index < m_tracker_pose_estimation_count; ++tracker_index)
 			{
 				m_tracker_pose_estimations[tracker_index].clear();
 			}
@@ -208,7 +235,8 @@ bool ServerHMDView::open(const class DeviceEnumerator *enumerator)
                 eCommonTrackingColorID allocatedColorID= DeviceManager::getInstance()->m_tracker_manager->allocateTrackingColorID();
 
                 // Attempt to assign the tracking color id to the controller
-                if (!m_device->setTrackingColorID(allocatedColorID))
+                if (allocatedColorID != eCommonTrackingColorID::INVALID_COLOR &&
+                    !m_device->setTrackingColorID(allocatedColorID))
                 {
                     // If the device can't be assigned a tracking color, release the color back to the pool
                     DeviceManager::getInstance()->m_tracker_manager->freeTrackingColorID(allocatedColorID);
@@ -236,6 +264,9 @@ void ServerHMDView::close()
         }
     }
 
+    m_external_pose_packets.clear();
+    m_external_pose_delta_times.clear();
+
     ServerDeviceView::close();
 }
 
@@ -243,6 +274,9 @@ void ServerHMDView::resetPoseFilter()
 {
 	assert(m_device != nullptr);
 
+	m_filtered_pose_cache.invalidate();
+	m_pose_latency.reset();
+
 	if (m_pose_filter != nullptr)
 	{
 		delete m_pose_filter;
@@ -282,20 +316,28 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
     // If velocity is too high, don't bother getting a new position.
     // Though it may be enough to just use the camera ROI as the limit.
     
-    if (getIsTrackingEnabled())
+    // With synchronized tracker frames the poses only get solved once per frameset,
+    // so that every tracker's projection comes from the same exposure
+    if (getIsTrackingEnabled() && tracker_manager->getIsFramesetReady())
     {
         int valid_projection_tracker_ids[TrackerManager::k_max_devices];
+        float fusion_scores[TrackerManager::k_max_devices]; // indexed by tracker id
         int projections_found = 0;
 
+        // Whether the HMD got seen in a new video frame this update, and if one of those followed dropped frames
+        bool bHasNewOpticalProjection = false;
+        bool bHasOpticalFrameDrop = false;
+
         CommonDeviceTrackingShape trackingShape;
         m_device->getTrackingShape(trackingShape);
         assert(trackingShape.shape_type != eCommonTrackingShapeType::INVALID_SHAPE);
 
         // Find the projection of the controller from the perspective of each tracker.
         // In the case of sphere projections, go ahead and compute the tracker relative position as well.
-        for (int tracker_id = 0; tracker_id < tracker_manager->getMaxDevices(); ++tracker_id)
+        // Trackers that closed after the last tick are still in the active list, so their estimates get reset here.
+        for (int tracker_id : tracker_manager->getActiveDeviceIds())
         {
-            ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
+            ServerTrackerView *tracker = tracker_manager->getTrackerView(tracker_id);
             HMDOpticalPoseEstimation &trackerPoseEstimateRef = m_tracker_pose_estimations[tracker_id];
 
             const bool bWasTracking= trackerPoseEstimateRef.bCurrentlyTracking;
@@ -316,28 +358,23 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
                 // Can't compute tracking on video data that's too old
                 if (timeSinceNewDataMillis.count() < timeoutMilli)
                 {
-                    // Initially the newTrackerPoseEstimate is a copy of the existing pose
                     bool bIsVisibleThisUpdate= false;
 
                     // If a new video frame is available this tick, 
                     // attempt to update the tracking location
-                    if (tracker->getHasUnpublishedState())
+                    if (tracker_manager->getIsTrackerInFrameset(tracker_id))
                     {
-                        // Create a copy of the pose estimate state so that in event of a 
-                        // failure part way through computing the projection we don't
-                        // set partially valid state
-                        HMDOpticalPoseEstimation newTrackerPoseEstimate= trackerPoseEstimateRef;
-
-                        if (tracker->computeProjectionForHMD(
-                                this, 
-                                &trackingShape,
-                                &newTrackerPoseEstimate))
+                        // The fetch only writes the estimate when it has a complete result,
+                        // so it can go straight into the tracker's estimate without a scratch copy
+                        if (tracker->fetchHMDProjectionResult(
+                                getDeviceID(),
+                                &trackerPoseEstimateRef))
                         {
                             bIsVisibleThisUpdate= true;
-
-                            // Actually apply the pose estimate state
-                            trackerPoseEstimateRef= newTrackerPoseEstimate;
                             trackerPoseEstimateRef.last_visible_timestamp = now;
+
+                            bHasNewOpticalProjection = true;
+                            bHasOpticalFrameDrop |= tracker_manager->getTrackerFrameDropCount(tracker_id) > 0;
                         }
                     }
 
@@ -351,9 +388,16 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
                         if (timeSinceLastVisibleMillis.count() < timeoutMilli)
                         {
                             // If this tracker has a valid projection for the controller
-                            // add it to the tracker id list
-                            valid_projection_tracker_ids[projections_found] = tracker_id;
-                            ++projections_found;
+                            // add it to the tracker id list.
+                            // A tracker on fusion standby only competes with a fresh projection,
+                            // not with the one held over from its last standby search.
+                            if (bIsVisibleThisUpdate || !getIsTrackerOnFusionStandby(tracker_id))
+                            {
+                                valid_projection_tracker_ids[projections_found] = tracker_id;
+                                fusion_scores[tracker_id] = TrackerManager::computeFusionScore(
+                                    trackerPoseEstimateRef.position_cm, trackerPoseEstimateRef.projection.screen_area);
+                                ++projections_found;
+                            }
 
                             // Flag this pose estimate as invalid
                             bCurrentlyTracking = true;
@@ -368,6 +412,23 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
             trackerPoseEstimateRef.bCurrentlyTracking = bCurrentlyTracking;
         }
 
+        // Only fuse the trackers with the best view of the HMD.
+        // The ones left out drop to the slower standby search (see ServerTrackerView::startProjectionWork()).
+        {
+            const int max_fused_tracker_count = tracker_manager->getConfig().max_fused_tracker_count;
+            const int fused_count = tracker_manager->selectFusedTrackers(valid_projection_tracker_ids, projections_found, fusion_scores);
+
+            std::fill(
+                m_tracker_fusion_standby.begin(), m_tracker_fusion_standby.end(),
+                max_fused_tracker_count > 0 && fused_count >= max_fused_tracker_count);
+            for (int list_index = 0; list_index < fused_count; ++list_index)
+            {
+                m_tracker_fusion_standby[valid_projection_tracker_ids[list_index]] = false;
+            }
+
+            projections_found = fused_count;
+        }
+
         // How we compute the final world pose estimate varies based on
         // * Number of trackers that currently have a valid projections of the controller
         // * The kind of projection shape (psmove sphere or ds4 lightbar)
@@ -439,9 +500,73 @@ void ServerHMDView::updateOpticalPoseEstimation(TrackerManager* tracker_manager)
         }
         m_multicam_pose_estimation->last_update_timestamp = now;
         m_multicam_pose_estimation->bValidTimestamps = true;
+        m_multicam_pose_estimation->bFollowsFrameGap = !bHasNewOpticalProjection || bHasOpticalFrameDrop;
     }
 }
 
+void ServerHMDView::pollExternalPoses(SharedPoseInputReader *pose_input_reader)
+{
+	const VirtualHMDConfig *config = this->castCheckedConst<VirtualHMD>()->getConfig();
+
+	// Poses older than the optical tracking timeout are as stale as a lost tracker's last projection.
+	// That also drops whatever got written to the ring before the HMD opened.
+	const int64_t now_us = getExternalPoseTimestampNow();
+	const int64_t max_age_us =
+		static_cast<int64_t>(DeviceManager::getInstance()->m_tracker_manager->getConfig().optical_tracking_timeout) * 1000;
+	bool bHasNewPose = false;
+
+	ExternalPoseSample samples[k_external_pose_read_batch_size];
+	int sample_count;
+	do
+	{
+		sample_count = pose_input_reader->readHMDPoses(getDeviceID(), samples, k_external_pose_read_batch_size);
+
+		for (int sample_index = 0; sample_index < sample_count; ++sample_index)
+		{
+			const ExternalPoseSample &sample = samples[sample_index];
+
+			// Virtual HMDs only have a position filter.
+			// The filter steps by time deltas, so samples can't go back in time either.
+			if ((sample.flags & EXTERNAL_POSE_FLAG_HAS_POSITION) == 0 ||
+				now_us - sample.timestamp_us > max_age_us ||
+				sample.timestamp_us <= m_last_external_pose_timestamp_us)
+			{
+				continue;
+			}
+
+			// The HMD filter takes the time since the previous packet rather than a timestamp
+			const float time_delta_seconds =
+				(m_last_external_pose_timestamp_us != 0)
+				? clampf(static_cast<float>(sample.timestamp_us - m_last_external_pose_timestamp_us) / 1000000.f,
+						 k_min_capture_time_delta_seconds, k_max_time_delta_seconds)
+				: k_max_time_delta_seconds;
+			m_last_external_pose_timestamp_us = sample.timestamp_us;
+
+			PoseSensorPacket sensorPacket;
+			sensorPacket.clear();
+			sensorPacket.optical_position_cm = Eigen::Vector3f(sample.position_cm[0], sample.position_cm[1], sample.position_cm[2]);
+			sensorPacket.tracking_projection_area_px_sqr = k_external_pose_projection_area_px_sqr;
+			sensorPacket.optical_position_variance_cm_sqr =
+				(sample.position_variance_cm_sqr > 0.f) ? sample.position_variance_cm_sqr : config->external_pose_position_variance;
+
+			if ((sample.flags & EXTERNAL_POSE_FLAG_HAS_ORIENTATION) != 0)
+			{
+				sensorPacket.optical_orientation =
+					Eigen::Quaternionf(sample.orientation[0], sample.orientation[1], sample.orientation[2], sample.orientation[3]).normalized();
+			}
+
+			m_external_pose_packets.push_back(sensorPacket);
+			m_external_pose_delta_times.push_back(time_delta_seconds);
+			bHasNewPose = true;
+		}
+	} while (sample_count == k_external_pose_read_batch_size);
+
+	if (bHasNewPose)
+	{
+		markStateAsUnpublished();
+	}
+}
+
 void ServerHMDView::updateStateAndPredict()
 {
 	if (!getHasUnpublishedState())
@@ -483,12 +608,33 @@ void ServerHMDView::updateStateAndPredict()
 	// Evenly apply the list of hmd state updates over the time since last filter update
 	float per_state_time_delta_seconds = time_delta_seconds / static_cast<float>(firstLookBackIndex + 1);
 
+	// Every IMU sub-frame of every new state, handed to the filter in a single batch
+	std::vector<PoseSensorPacket> sensorPackets;
+	std::vector<float> sensorPacketDeltaTimes;
+
 	// Process the polled hmd states forward in time
 	// computing the new orientation along the way.
 	for (int lookBackIndex = firstLookBackIndex; lookBackIndex >= 0; --lookBackIndex)
 	{
 		const CommonHMDState *hmdState = getState(lookBackIndex);
 
+		// Use the true spacing between samples when the device stamped them at capture time
+		float state_time_delta_seconds = per_state_time_delta_seconds;
+		if (hmdState->getHasCaptureTimestamp())
+		{
+			if (m_last_sample_capture_timestamp_valid)
+			{
+				const std::chrono::duration<float> capture_delta = 
+					hmdState->CaptureTimestamp - m_last_sample_capture_timestamp;
+
+				state_time_delta_seconds = 
+					clampf(capture_delta.count(), k_min_capture_time_delta_seconds, k_max_time_delta_seconds);
+			}
+
+			m_last_sample_capture_timestamp = hmdState->CaptureTimestamp;
+			m_last_sample_capture_timestamp_valid = true;
+		}
+
 		switch (hmdState->DeviceType)
 		{
 		case CommonHMDState::Morpheus:
@@ -496,34 +642,55 @@ void ServerHMDView::updateStateAndPredict()
 			    const MorpheusHMD *morpheusHMD = this->castCheckedConst<MorpheusHMD>();
 			    const MorpheusHMDState *morpheusHMDState = static_cast<const MorpheusHMDState *>(hmdState);
 
-			    // Only update the position filter when tracking is enabled
-			    update_filters_for_morpheus_hmd(
+			    append_filter_packets_for_morpheus_hmd(
 				    morpheusHMD, morpheusHMDState,
-				    per_state_time_delta_seconds,
+				    state_time_delta_seconds,
 				    m_multicam_pose_estimation,
-				    m_pose_filter_space,
-				    m_pose_filter);
+				    sensorPackets, sensorPacketDeltaTimes);
 		    } break;
 		case CommonHMDState::VirtualHMD:
 		    {
 			    const VirtualHMD *virtualHMD = this->castCheckedConst<VirtualHMD>();
 			    const VirtualHMDState *virtualHMDState = static_cast<const VirtualHMDState *>(hmdState);
 
-			    // Only update the position filter when tracking is enabled
-			    update_filters_for_virtual_hmd(
-				    virtualHMD, virtualHMDState,
-				    per_state_time_delta_seconds,
-				    m_multicam_pose_estimation,
-				    m_pose_filter_space,
-				    m_pose_filter);
+			    // Injected poses stand in for the camera tracked ones while they keep coming,
+			    // mixing both would count the time since the last update twice
+			    if (m_external_pose_packets.empty())
+			    {
+				    append_filter_packets_for_virtual_hmd(
+					    virtualHMD, virtualHMDState,
+					    state_time_delta_seconds,
+					    m_multicam_pose_estimation,
+					    sensorPackets, sensorPacketDeltaTimes);
+			    }
 		    } break;
 		default:
 			assert(0 && "Unhandled HMD type");
 		}
 
+		// Every later packet repeats the optical pose the first one already delivered
+		m_multicam_pose_estimation->bFollowsFrameGap = true;
+
 		// Consider this hmd state sequence num processed
 		m_lastPollSeqNumProcessed = hmdState->PollSequenceNumber;
 	}
+
+	sensorPackets.insert(sensorPackets.end(), m_external_pose_packets.begin(), m_external_pose_packets.end());
+	sensorPacketDeltaTimes.insert(sensorPacketDeltaTimes.end(), m_external_pose_delta_times.begin(), m_external_pose_delta_times.end());
+	m_external_pose_packets.clear();
+	m_external_pose_delta_times.clear();
+
+	if (m_pose_filter != nullptr && sensorPackets.size() > 0)
+	{
+		SERVER_TRACE_DEVICE_SCOPE(ServerTraceStage_FilterUpdate, getDeviceID());
+
+		m_pose_filter->updateBatch(
+			m_pose_filter_space,
+			sensorPackets.data(),
+			sensorPacketDeltaTimes.data(),
+			static_cast<int>(sensorPackets.size()));
+		m_filtered_pose_cache.invalidate();
+	}
 }
 
 CommonDevicePose
@@ -531,6 +698,11 @@ ServerHMDView::getFilteredPose(float time) const
 {
 	CommonDevicePose pose;
 
+	if (m_filtered_pose_cache.tryGetPose(m_pose_filter, time, pose))
+	{
+		return pose;
+	}
+
 	pose.clear();
 
 	if (m_pose_filter != nullptr)
@@ -538,16 +710,13 @@ ServerHMDView::getFilteredPose(float time) const
 		const Eigen::Quaternionf orientation = m_pose_filter->getOrientation(time);
 		const Eigen::Vector3f position_cm = m_pose_filter->getPositionCm(time);
 
-		pose.Orientation.w = orientation.w();
-		pose.Orientation.x = orientation.x();
-		pose.Orientation.y = orientation.y();
-		pose.Orientation.z = orientation.z();
+		eigen_quaternionf_view(pose.Orientation)= orientation;
 
-		pose.PositionCm.x = position_cm.x();
-		pose.PositionCm.y = position_cm.y();
-		pose.PositionCm.z = position_cm.z();
+		eigen_vector3f_view(pose.PositionCm)= position_cm;
 	}
 
+	m_filtered_pose_cache.storePose(m_pose_filter, time, pose);
+
 	return pose;
 }
 
@@ -556,6 +725,13 @@ ServerHMDView::getFilteredPhysics() const
 {
 	CommonDevicePhysics physics;
 
+	if (m_filtered_pose_cache.tryGetPhysics(m_pose_filter, physics))
+	{
+		return physics;
+	}
+
+	physics.clear();
+
 	if (m_pose_filter != nullptr)
 	{
 		const Eigen::Vector3f first_derivative = m_pose_filter->getAngularVelocityRadPerSec();
@@ -580,6 +756,8 @@ ServerHMDView::getFilteredPhysics() const
 		physics.AccelerationCmPerSecSqr.k = acceleration.z();
 	}
 
+	m_filtered_pose_cache.storePhysics(m_pose_filter, physics);
+
 	return physics;
 }
 
@@ -728,6 +906,17 @@ float ServerHMDView::getROIPredictionTime() const
 
 void ServerHMDView::publish_device_data_frame()
 {
+    // The filter state is as old as the newest sample it consumed,
+    // HMDs that don't stamp their samples only have the time the filter ran
+    if (m_last_sample_capture_timestamp_valid)
+    {
+        m_pose_latency.addSample(m_last_sample_capture_timestamp, std::chrono::high_resolution_clock::now());
+    }
+    else if (m_last_filter_update_timestamp_valid)
+    {
+        m_pose_latency.addSample(m_last_filter_update_timestamp, std::chrono::high_resolution_clock::now());
+    }
+
     // Tell the server request handler we want to send out HMD updates.
     // This will call generate_hmd_data_frame_for_stream for each listening connection.
     ServerRequestHandler::get_instance()->publish_hmd_data_frame(
@@ -761,6 +950,86 @@ void ServerHMDView::generate_hmd_data_frame_for_stream(
     }
 
     data_frame->set_device_category(PSMoveProtocol::DeviceOutputDataFrame::HMD);
+    data_frame->set_service_time_us(ServerUtility::get_service_time_us());
+}
+
+bool ServerHMDView::generate_hmd_compact_pose_frame_for_stream(
+    const ServerHMDView *hmd_view,
+    const HMDStreamInfo *stream_info,
+    CompactHMDPoseFrame *pose_frame)
+{
+    const CommonDeviceState::eDeviceType hmd_type= hmd_view->getHMDDeviceType();
+
+    if (hmd_type != CommonHMDState::Morpheus && hmd_type != CommonHMDState::VirtualHMD)
+    {
+        return false;
+    }
+
+    const IPoseFilter *pose_filter= hmd_view->getPoseFilter();
+    const CommonHMDState *hmd_state= hmd_view->getState();
+
+    memset(pose_frame, 0, sizeof(CompactHMDPoseFrame));
+    pose_frame->marker= COMPACT_DATA_FRAME_MARKER;
+    pose_frame->version= COMPACT_DATA_FRAME_VERSION;
+    pose_frame->hmd_id= static_cast<uint8_t>(hmd_view->getDeviceID());
+    pose_frame->hmd_type= 
+        static_cast<uint8_t>(
+            (hmd_type == CommonHMDState::Morpheus) ? PSMoveProtocol::Morpheus : PSMoveProtocol::VirtualHMD);
+    pose_frame->sequence_num= hmd_view->m_sequence_number;
+    pose_frame->sensor_data_age_ms= -1.f;
+    pose_frame->service_time_us= ServerUtility::get_service_time_us();
+
+    if (hmd_view->getDevice()->getIsOpen())
+    {
+        pose_frame->flags|= COMPACT_POSE_FLAG_IS_CONNECTED;
+    }
+
+    if (hmd_state != nullptr)
+    {
+        const CommonDevicePose hmd_pose= hmd_view->getFilteredPose(hmd_view->getStreamPredictionTime(stream_info->prediction_target, 0.f));
+
+        if (hmd_view->getIsTrackingEnabled())
+            pose_frame->flags|= COMPACT_POSE_FLAG_IS_TRACKING_ENABLED;
+        if (hmd_view->getIsCurrentlyTracking())
+            pose_frame->flags|= COMPACT_POSE_FLAG_IS_CURRENTLY_TRACKING;
+        if (pose_filter->getIsStateValid())
+        {
+            // Same validity rules as the full data frames: the virtual HMD has no orientation
+            if (hmd_type == CommonHMDState::Morpheus)
+                pose_frame->flags|= COMPACT_POSE_FLAG_IS_ORIENTATION_VALID;
+            pose_frame->flags|= COMPACT_POSE_FLAG_IS_POSITION_VALID;
+        }
+
+        if (hmd_type == CommonHMDState::Morpheus)
+        {
+            pose_frame->orientation[0]= hmd_pose.Orientation.w;
+            pose_frame->orientation[1]= hmd_pose.Orientation.x;
+            pose_frame->orientation[2]= hmd_pose.Orientation.y;
+            pose_frame->orientation[3]= hmd_pose.Orientation.z;
+        }
+        else
+        {
+            pose_frame->orientation[0]= 1.f;
+        }
+
+        if (stream_info->include_position_data)
+        {
+            pose_frame->position_cm[0]= hmd_pose.PositionCm.x;
+            pose_frame->position_cm[1]= hmd_pose.PositionCm.y;
+            pose_frame->position_cm[2]= hmd_pose.PositionCm.z;
+        }
+
+        if (stream_info->include_physics_data)
+        {
+            const CommonDevicePhysics hmd_physics= hmd_view->getFilteredPhysics();
+
+            pose_frame->velocity_cm_per_sec[0]= hmd_physics.VelocityCmPerSec.i;
+            pose_frame->velocity_cm_per_sec[1]= hmd_physics.VelocityCmPerSec.j;
+            pose_frame->velocity_cm_per_sec[2]= hmd_physics.VelocityCmPerSec.k;
+        }
+    }
+
+    return true;
 }
 
 static void
@@ -899,6 +1168,10 @@ pose_filter_factory(
 	{
 		position_filter_enum = PositionFilterTypeKalman;
 	}
+	else if (position_filter_type == "OneEuro")
+	{
+		position_filter_enum = PositionFilterTypeOneEuro;
+	}
 	else
 	{
 		SERVER_LOG_INFO("pose_filter_factory()") <<
@@ -967,133 +1240,82 @@ pose_filter_factory(
 }
 
 static void
-update_filters_for_morpheus_hmd(
+append_filter_packets_for_morpheus_hmd(
     const MorpheusHMD *morpheusHMD,
     const MorpheusHMDState *morpheusHMDState,
 	const float delta_time,
 	const HMDOpticalPoseEstimation *poseEstimation,
-	const PoseFilterSpace *poseFilterSpace,
-	IPoseFilter *poseFilter)
+	std::vector<PoseSensorPacket> &outSensorPackets,
+	std::vector<float> &outDeltaTimes)
 {
     const MorpheusHMDConfig *config = morpheusHMD->getConfig();
 
-	// Update the orientation filter
-	if (poseFilter != nullptr)
-	{
-		PoseSensorPacket sensorPacket;
-
-		sensorPacket.imu_magnetometer_unit = Eigen::Vector3f::Zero();
+	PoseSensorPacket sensorPacket;
+	sensorPacket.clear();
 
-		if (poseEstimation->bOrientationValid)
-		{
-			sensorPacket.optical_orientation =
-				Eigen::Quaternionf(
-					poseEstimation->orientation.w,
-					poseEstimation->orientation.x,
-					poseEstimation->orientation.y,
-					poseEstimation->orientation.z);
-		}
-		else
-		{
-			sensorPacket.optical_orientation = Eigen::Quaternionf::Identity();
-		}
-
-		if (poseEstimation->bCurrentlyTracking)
-		{
-			sensorPacket.optical_position_cm =
-				Eigen::Vector3f(
-					poseEstimation->position_cm.x,
-					poseEstimation->position_cm.y,
-					poseEstimation->position_cm.z);
-			sensorPacket.tracking_projection_area_px_sqr = poseEstimation->projection.screen_area;
-		}
-		else
-		{
-			sensorPacket.optical_position_cm = Eigen::Vector3f::Zero();
-			sensorPacket.tracking_projection_area_px_sqr = 0.f;
-		}
-
-		// Each state update contains two readings (one earlier and one later) of accelerometer and gyro data
-		for (int frame = 0; frame < 2; ++frame)
-		{
-			const MorpheusHMDSensorFrame &sensorFrame= morpheusHMDState->SensorFrames[frame];
-
-			sensorPacket.imu_accelerometer_g_units =
-				Eigen::Vector3f(
-					sensorFrame.CalibratedAccel.i,
-					sensorFrame.CalibratedAccel.j,
-					sensorFrame.CalibratedAccel.k);
-			sensorPacket.imu_gyroscope_rad_per_sec =
-				Eigen::Vector3f(
-					sensorFrame.CalibratedGyro.i,
-					sensorFrame.CalibratedGyro.j,
-					sensorFrame.CalibratedGyro.k);
-			sensorPacket.imu_magnetometer_unit = Eigen::Vector3f::Zero();
-
-			{
-				PoseFilterPacket filterPacket;
+	if (poseEstimation->bOrientationValid)
+	{
+		sensorPacket.optical_orientation = eigen_quaternionf_view(poseEstimation->orientation);
+	}
 
-				// Create a filter input packet from the sensor data 
-				// and the filter's previous orientation and position
-				poseFilterSpace->createFilterPacket(
-					sensorPacket,
-					poseFilter,
-					filterPacket);
+	if (poseEstimation->bCurrentlyTracking)
+	{
+		sensorPacket.optical_position_cm = eigen_vector3f_view(poseEstimation->position_cm);
+		sensorPacket.tracking_projection_area_px_sqr = poseEstimation->projection.screen_area;
+		sensorPacket.optical_follows_frame_gap = poseEstimation->bFollowsFrameGap;
+	}
 
-				poseFilter->update(delta_time / 2.f, filterPacket);
-			}
-		}
+	// Each state update contains two readings (one earlier and one later) of accelerometer and gyro data
+	for (int frame = 0; frame < 2; ++frame)
+	{
+		const MorpheusHMDSensorFrame &sensorFrame= morpheusHMDState->SensorFrames[frame];
+
+		sensorPacket.imu_accelerometer_g_units =
+			Eigen::Vector3f(
+				sensorFrame.CalibratedAccel.i,
+				sensorFrame.CalibratedAccel.j,
+				sensorFrame.CalibratedAccel.k);
+		sensorPacket.has_accelerometer_measurement = true;
+
+		sensorPacket.imu_gyroscope_rad_per_sec =
+			Eigen::Vector3f(
+				sensorFrame.CalibratedGyro.i,
+				sensorFrame.CalibratedGyro.j,
+				sensorFrame.CalibratedGyro.k);
+		sensorPacket.has_gyroscope_measurement = true;
+
+		outSensorPackets.push_back(sensorPacket);
+		outDeltaTimes.push_back(delta_time / 2.f);
+
+		// The later reading carries the same optical pose again
+		sensorPacket.optical_follows_frame_gap = true;
 	}
 }
 
 static void
-update_filters_for_virtual_hmd(
+append_filter_packets_for_virtual_hmd(
     const VirtualHMD *virtualHMD,
     const VirtualHMDState *virtualHMDState,
 	const float delta_time,
 	const HMDOpticalPoseEstimation *poseEstimation,
-	const PoseFilterSpace *poseFilterSpace,
-	IPoseFilter *poseFilter)
+	std::vector<PoseSensorPacket> &outSensorPackets,
+	std::vector<float> &outDeltaTimes)
 {
     const VirtualHMDConfig *config = virtualHMD->getConfig();
 
-	// Update the orientation filter
-	if (poseFilter != nullptr)
-	{
-		PoseSensorPacket sensorPacket;
-
-		sensorPacket.imu_magnetometer_unit = Eigen::Vector3f::Zero();
-		sensorPacket.optical_orientation = Eigen::Quaternionf::Identity();
-
-		if (poseEstimation->bCurrentlyTracking)
-		{
-			sensorPacket.optical_position_cm =
-				Eigen::Vector3f(
-					poseEstimation->position_cm.x,
-					poseEstimation->position_cm.y,
-					poseEstimation->position_cm.z);
-			sensorPacket.tracking_projection_area_px_sqr = poseEstimation->projection.screen_area;
-		}
-		else
-		{
-			sensorPacket.optical_position_cm = Eigen::Vector3f::Zero();
-			sensorPacket.tracking_projection_area_px_sqr = 0.f;
-		}
-
-		sensorPacket.imu_accelerometer_g_units = Eigen::Vector3f::Zero();
-		sensorPacket.imu_gyroscope_rad_per_sec = Eigen::Vector3f::Zero();
-		sensorPacket.imu_magnetometer_unit = Eigen::Vector3f::Zero();
-
-		{
-			PoseFilterPacket filterPacket;
-
-			// Create a filter input packet from the sensor data 
-			// and the filter's previous orientation and position
-			poseFilterSpace->createFilterPacket(sensorPacket, poseFilter, filterPacket);
+	PoseSensorPacket sensorPacket;
+	sensorPacket.clear();
 
-			poseFilter->update(delta_time, filterPacket);
-		}
+	if (poseEstimation->bCurrentlyTracking)
+	{
+		sensorPacket.optical_position_cm = eigen_vector3f_view(poseEstimation->position_cm);
+		sensorPacket.tracking_projection_area_px_sqr = poseEstimation->projection.screen_area;
+		sensorPacket.optical_follows_frame_gap = poseEstimation->bFollowsFrameGap;
 	}
+
+	// Virtual HMDs have no IMU, so there is just the optical update
+	outSensorPackets.push_back(sensorPacket);
+	outDeltaTimes.push_back(delta_time);
 }
 
 static void generate_morpheus_hmd_data_frame_for_stream(
@@ -1105,7 +1327,7 @@ static void generate_morpheus_hmd_data_frame_for_stream(
     const MorpheusHMDConfig *morpheus_config = morpheus_hmd->getConfig();
 	const IPoseFilter *pose_filter = hmd_view->getPoseFilter();
     const CommonHMDState *hmd_state = hmd_view->getState();
-    const CommonDevicePose hmd_pose = hmd_view->getFilteredPose();
+    const CommonDevicePose hmd_pose = hmd_view->getFilteredPose(hmd_view->getStreamPredictionTime(stream_info->prediction_target, 0.f));
 
     PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket *hmd_data_frame = data_frame->mutable_hmd_data_packet();
 
@@ -1208,13 +1430,13 @@ static void generate_morpheus_hmd_data_frame_for_stream(
             int selectedTrackerId= stream_info->selected_tracker_index;
             unsigned int validTrackerBitmask= 0;
 
-            for (int trackerId = 0; trackerId < TrackerManager::k_max_devices; ++trackerId)
+            for (int trackerId = 0; trackerId < hmd_view->getTrackerPoseEstimateCount(); ++trackerId)
             {
 			    const HMDOpticalPoseEstimation *positionEstimate = hmd_view->getTrackerPoseEstimate(trackerId);
 
                 if (positionEstimate != nullptr && positionEstimate->bCurrentlyTracking)
                 {
-                    validTrackerBitmask&= (1 << trackerId);
+                    validTrackerBitmask|= (1 << trackerId);
 
                     if (trackerId == selectedTrackerId)
                     {
@@ -1246,14 +1468,25 @@ static void generate_morpheus_hmd_data_frame_for_stream(
 						        positionEstimate->projection;
 
 					        assert(trackerRelativeProjection.shape_type == eCommonTrackingProjectionType::ProjectionType_Points);
-					        PSMoveProtocol::Polygon *polygon = raw_tracker_data->mutable_projected_point_cloud();
 
-					        for (int vert_index = 0; vert_index < trackerRelativeProjection.shape.points.point_count; ++vert_index)
+					        if (stream_info->use_packed_tracker_data)
 					        {
-						        PSMoveProtocol::Pixel *pixel = polygon->add_vertices();
+						        packed_tracker_data_append_points(
+							        raw_tracker_data->mutable_packed_projected_point_cloud(),
+							        trackerRelativeProjection.shape.points.point,
+							        trackerRelativeProjection.shape.points.point_count);
+					        }
+					        else
+					        {
+						        PSMoveProtocol::Polygon *polygon = raw_tracker_data->mutable_projected_point_cloud();
 
-						        pixel->set_x(trackerRelativeProjection.shape.points.point[vert_index].x);
-						        pixel->set_y(trackerRelativeProjection.shape.points.point[vert_index].y);
+						        for (int vert_index = 0; vert_index < trackerRelativeProjection.shape.points.point_count; ++vert_index)
+						        {
+							        PSMoveProtocol::Pixel *pixel = polygon->add_vertices();
+
+							        pixel->set_x(trackerRelativeProjection.shape.points.point[vert_index].x);
+							        pixel->set_y(trackerRelativeProjection.shape.points.point[vert_index].y);
+						        }
 					        }
 				        }
 
@@ -1262,6 +1495,11 @@ static void generate_morpheus_hmd_data_frame_for_stream(
                 }
             }
             raw_tracker_data->set_valid_tracker_bitmask(validTrackerBitmask);
+
+            if (stream_info->include_all_tracker_data)
+            {
+                add_hmd_tracker_samples(hmd_view, stream_info->use_packed_tracker_data, raw_tracker_data);
+            }
 		}
     }
 
@@ -1277,7 +1515,7 @@ static void generate_virtual_hmd_data_frame_for_stream(
     const VirtualHMDConfig *virtual_hmd_config = virtual_hmd->getConfig();
 	const IPoseFilter *pose_filter = hmd_view->getPoseFilter();
     const CommonHMDState *hmd_state = hmd_view->getState();
-    const CommonDevicePose hmd_pose = hmd_view->getFilteredPose();
+    const CommonDevicePose hmd_pose = hmd_view->getFilteredPose(hmd_view->getStreamPredictionTime(stream_info->prediction_target, 0.f));
 
     PSMoveProtocol::DeviceOutputDataFrame_HMDDataPacket *hmd_data_frame = data_frame->mutable_hmd_data_packet();
 
@@ -1327,13 +1565,13 @@ static void generate_virtual_hmd_data_frame_for_stream(
 			int selectedTrackerId= stream_info->selected_tracker_index;
             unsigned int validTrackerBitmask= 0;
 
-            for (int trackerId = 0; trackerId < TrackerManager::k_max_devices; ++trackerId)
+            for (int trackerId = 0; trackerId < hmd_view->getTrackerPoseEstimateCount(); ++trackerId)
             {
 			    const HMDOpticalPoseEstimation *positionEstimate = hmd_view->getTrackerPoseEstimate(trackerId);
 
                 if (positionEstimate != nullptr && positionEstimate->bCurrentlyTracking)
                 {
-                    validTrackerBitmask&= (1 << trackerId);
+                    validTrackerBitmask|= (1 << trackerId);
 
                     if (trackerId == selectedTrackerId)
                     {
@@ -1379,48 +1617,56 @@ static void generate_virtual_hmd_data_frame_for_stream(
                 }
             }
             raw_tracker_data->set_valid_tracker_bitmask(validTrackerBitmask);
+
+            if (stream_info->include_all_tracker_data)
+            {
+                add_hmd_tracker_samples(hmd_view, stream_info->use_packed_tracker_data, raw_tracker_data);
+            }
 		}
     }
 
     hmd_data_frame->set_hmd_type(PSMoveProtocol::VirtualHMD);
 }
 
-static Eigen::Vector3f CommonDevicePosition_to_EigenVector3f(const CommonDevicePosition &p)
-{
-    return Eigen::Vector3f(p.x, p.y, p.z);
-}
-
-static Eigen::Vector3f CommonDeviceVector_to_EigenVector3f(const CommonDeviceVector &v)
-{
-    return Eigen::Vector3f(v.i, v.j, v.k);
-}
-
-static Eigen::Quaternionf CommonDeviceQuaternion_to_EigenQuaternionf(const CommonDeviceQuaternion &q)
-{
-    return Eigen::Quaternionf(q.w, q.x, q.y, q.z);
-}
-
-static CommonDevicePosition EigenVector3f_to_CommonDevicePosition(const Eigen::Vector3f &p)
-{
-    CommonDevicePosition result;
-
-    result.x = p.x();
-    result.y = p.y();
-    result.z = p.z();
-
-    return result;
-}
-
-static CommonDeviceQuaternion EigenQuaternionf_to_CommonDeviceQuaternion(const Eigen::Quaternionf &q)
+// One sample per tracker that currently sees the HMD, for clients calibrating all trackers at once
+template <typename t_raw_tracker_data>
+static void add_hmd_tracker_samples(
+    const ServerHMDView *hmd_view,
+    bool bUsePackedTrackerData,
+    t_raw_tracker_data *raw_tracker_data)
 {
-    CommonDeviceQuaternion result;
+    for (int trackerId = 0; trackerId < hmd_view->getTrackerPoseEstimateCount(); ++trackerId)
+    {
+        const HMDOpticalPoseEstimation *positionEstimate = hmd_view->getTrackerPoseEstimate(trackerId);
 
-    result.w = q.w();
-    result.x = q.x();
-    result.y = q.y();
-    result.z = q.z();
+        if (positionEstimate != nullptr && positionEstimate->bCurrentlyTracking)
+        {
+            const CommonDevicePosition &trackerRelativePosition = positionEstimate->position_cm;
+            const ServerTrackerViewPtr tracker_view = DeviceManager::getInstance()->getTrackerViewPtr(trackerId);
+            const CommonDeviceScreenLocation trackerScreenLocation =
+                tracker_view->projectTrackerRelativePosition(&trackerRelativePosition);
 
-    return result;
+            if (bUsePackedTrackerData)
+            {
+                packed_tracker_data_append_sample(
+                    raw_tracker_data->mutable_packed_tracker_samples(),
+                    trackerId,
+                    trackerScreenLocation.x, trackerScreenLocation.y,
+                    trackerRelativePosition.x, trackerRelativePosition.y, trackerRelativePosition.z);
+            }
+            else
+            {
+                PSMoveProtocol::TrackerSample *sample = raw_tracker_data->add_tracker_samples();
+
+                sample->set_tracker_id(trackerId);
+                sample->mutable_screen_location()->set_x(trackerScreenLocation.x);
+                sample->mutable_screen_location()->set_y(trackerScreenLocation.y);
+                sample->mutable_relative_position_cm()->set_x(trackerRelativePosition.x);
+                sample->mutable_relative_position_cm()->set_y(trackerRelativePosition.y);
+                sample->mutable_relative_position_cm()->set_z(trackerRelativePosition.z);
+            }
+        }
+    }
 }
 
 static void computeSpherePoseForHmdFromSingleTracker(
@@ -1472,8 +1718,11 @@ static void computeSpherePoseForHmdFromMultipleTrackers(
     const TrackerManagerConfig &cfg = tracker_manager->getConfig();
     float screen_area_sum = 0;
 
-    // Project the tracker relative 3d tracking position back on to the tracker camera plane
+    // Gather the tracker relative 3d tracking positions
     // and sum up the total controller projection area across all trackers
+    const ServerTrackerView *projection_trackers[TrackerManager::k_max_devices];
+    CommonDevicePosition tracker_relative_positions[TrackerManager::k_max_devices];
+    CommonDevicePosition tracker_positions[TrackerManager::k_max_devices];
     CommonDeviceScreenLocation position2d_list[TrackerManager::k_max_devices];
     for (int list_index = 0; list_index < projections_found; ++list_index)
     {
@@ -1481,83 +1730,97 @@ static void computeSpherePoseForHmdFromMultipleTrackers(
         const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
         const HMDOpticalPoseEstimation &poseEstimate = tracker_pose_estimations[tracker_id];
 
-        position2d_list[list_index] = tracker->projectTrackerRelativePosition(&poseEstimate.position_cm);
+        projection_trackers[list_index] = tracker.get();
+        tracker_relative_positions[list_index] = poseEstimate.position_cm;
+        tracker_positions[list_index] = tracker->getTrackerPose().PositionCm;
         screen_area_sum += poseEstimate.projection.screen_area;
     }
 
-    // Compute triangulations amongst all pairs of projections
-    int pair_count = 0;
+    // Project every tracker relative position back on to its camera plane in one pass
+    ServerTrackerView::projectTrackerRelativePositionsBatch(
+        projection_trackers, tracker_relative_positions, projections_found, position2d_list);
+
+    // Pick the trackers that take part in the triangulation.
+    // With exclude_opposed_cameras a tracker is only used if at least one non-opposed tracker also sees the sphere.
+    const ServerTrackerView *triangulation_trackers[TrackerManager::k_max_devices];
+    CommonDeviceScreenLocation triangulation_screen_locations[TrackerManager::k_max_devices];
+    float triangulation_weights[TrackerManager::k_max_devices];
+    int triangulation_count = 0;
     int biggest_prjection_id = -1;
-    CommonDevicePosition average_world_position = { 0.f, 0.f, 0.f };
     for (int list_index = 0; list_index < projections_found; ++list_index)
     {
         const int tracker_id = valid_projection_tracker_ids[list_index];
-        const CommonDeviceScreenLocation &screen_location = position2d_list[list_index];
         const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
+        const float screen_area = tracker_pose_estimations[tracker_id].projection.screen_area;
 
-        for (int other_list_index = list_index + 1; other_list_index < projections_found; ++other_list_index)
+        if (biggest_prjection_id < 0 || screen_area > tracker_pose_estimations[biggest_prjection_id].projection.screen_area)
         {
-            const int other_tracker_id = valid_projection_tracker_ids[other_list_index];
-            const CommonDeviceScreenLocation &other_screen_location = position2d_list[other_list_index];
-            const ServerTrackerViewPtr other_tracker = tracker_manager->getTrackerViewPtr(other_tracker_id);
-            // if trackers are on opposite sides
-            if (cfg.exclude_opposed_cameras)
-            {
-                if ((tracker->getTrackerPose().PositionCm.x > 0) == (other_tracker->getTrackerPose().PositionCm.x < 0) &&
-                    (tracker->getTrackerPose().PositionCm.z > 0) == (other_tracker->getTrackerPose().PositionCm.z < 0))
-                {
-                    float screen_area = tracker_pose_estimations[tracker_id].projection.screen_area;
-                    float other_screen_area = tracker_pose_estimations[other_tracker_id].projection.screen_area;
-
-                    biggest_prjection_id = screen_area > other_screen_area ? tracker_id : other_tracker_id;
+            biggest_prjection_id = tracker_id;
+        }
 
-                    continue;
-                }
+        bool bHasPartner = !cfg.exclude_opposed_cameras;
+        for (int other_list_index = 0; !bHasPartner && other_list_index < projections_found; ++other_list_index)
+        {
+            if (other_list_index == list_index)
+            {
+                continue;
             }
 
-            // Using the screen locations on two different trackers we can triangulate a world position
-            CommonDevicePosition world_position =
-                ServerTrackerView::triangulateWorldPosition(
-                    tracker.get(), &screen_location,
-                    other_tracker.get(), &other_screen_location);
+            const CommonDevicePosition &position = tracker_positions[list_index];
+            const CommonDevicePosition &other_position = tracker_positions[other_list_index];
+
+            // if trackers are on opposite sides
+            const bool bOpposed =
+                (position.x > 0) == (other_position.x < 0) &&
+                (position.z > 0) == (other_position.z < 0);
 
-            average_world_position.x += world_position.x;
-            average_world_position.y += world_position.y;
-            average_world_position.z += world_position.z;
+            bHasPartner = !bOpposed;
+        }
 
-            ++pair_count;
+        if (bHasPartner)
+        {
+            triangulation_trackers[triangulation_count] = tracker.get();
+            triangulation_screen_locations[triangulation_count] = position2d_list[list_index];
+            triangulation_weights[triangulation_count] = screen_area;
+            ++triangulation_count;
         }
     }
 
-    if (pair_count == 0 && biggest_prjection_id >= 0 && !DeviceManager::getInstance()->m_tracker_manager->getConfig().ignore_pose_from_one_tracker)
+    // Triangulate the world position from all of the selected trackers at once,
+    // weighting each camera by its projection area
+    CommonDevicePosition world_position = { 0.f, 0.f, 0.f };
+    const bool bTriangulated =
+        triangulation_count >= 2 &&
+        ServerTrackerView::triangulateWorldPositionFromMultipleTrackers(
+            triangulation_trackers,
+            triangulation_screen_locations,
+            triangulation_weights,
+            triangulation_count,
+            cfg.triangulation_refinement_iterations,
+            &world_position);
+
+    if (!bTriangulated && biggest_prjection_id >= 0 && !DeviceManager::getInstance()->m_tracker_manager->getConfig().ignore_pose_from_one_tracker)
     {
-        // Position not triangulated from opposed camera, estimate from one tracker only.
+        // Position not triangulated (opposed or degenerate cameras), estimate from one tracker only.
         computeSpherePoseForHmdFromSingleTracker(
             hmdView,
             tracker_manager->getTrackerViewPtr(biggest_prjection_id),
             &tracker_pose_estimations[biggest_prjection_id],
-            multicam_pose_estimation);		
+            multicam_pose_estimation);
     }
-    else if(pair_count > 0)
+    else if (bTriangulated)
     {
-        // Compute the average position
-        const float N = static_cast<float>(pair_count);
-
-        average_world_position.x /= N;
-        average_world_position.y /= N;
-        average_world_position.z /= N;
-
-        // Store the averaged tracking position
+        // Store the triangulated tracking position
         const float q = tracker_manager->getConfig().controller_position_smoothing;
         if (q <= 0.01f)
         {
-            multicam_pose_estimation->position_cm = average_world_position;
+            multicam_pose_estimation->position_cm = world_position;
         }
         else
         {
-            multicam_pose_estimation->position_cm.x = q * multicam_pose_estimation->position_cm.x + (1 - q) * average_world_position.x;
-            multicam_pose_estimation->position_cm.y = q * multicam_pose_estimation->position_cm.y + (1 - q) * average_world_position.y;
-            multicam_pose_estimation->position_cm.z = q * multicam_pose_estimation->position_cm.z + (1 - q) * average_world_position.z;
+            multicam_pose_estimation->position_cm.x = q * multicam_pose_estimation->position_cm.x + (1 - q) * world_position.x;
+            multicam_pose_estimation->position_cm.y = q * multicam_pose_estimation->position_cm.y + (1 - q) * world_position.y;
+            multicam_pose_estimation->position_cm.z = q * multicam_pose_estimation->position_cm.z + (1 - q) * world_position.z;
         }
 
         multicam_pose_estimation->bCurrentlyTracking = true;
@@ -1581,106 +1844,123 @@ static void computePointCloudPoseForHmdFromMultipleTrackers(
     HMDOpticalPoseEstimation *tracker_pose_estimations,
     HMDOpticalPoseEstimation *multicam_pose_estimation)
 {
+    const int k_max_led_count = CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT;
+    typedef Eigen::Matrix<float, 3, Eigen::Dynamic, Eigen::ColMajor, 3, k_max_led_count> t_led_point_matrix;
+
     const TrackerManagerConfig &cfg = tracker_manager->getConfig();
     float screen_area_sum = 0;
+    int biggest_prjection_id = -1;
 
-    // Project the tracker relative 3d tracking position back on to the tracker camera plane
-    // and sum up the total controller projection area across all trackers
-    CommonDeviceScreenLocation position2d_list[TrackerManager::k_max_devices];
-    for (int list_index = 0; list_index < projections_found; ++list_index)
-    {
-        const int tracker_id = valid_projection_tracker_ids[list_index];
-        const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
-        const HMDOpticalPoseEstimation &poseEstimate = tracker_pose_estimations[tracker_id];
+    CommonDeviceTrackingShape tracking_shape;
+    hmdView->getTrackingShape(tracking_shape);
+    const int led_count = std::min(tracking_shape.shape.point_cloud.point_count, k_max_led_count);
 
-        position2d_list[list_index] = tracker->projectTrackerRelativePosition(&poseEstimate.position_cm);
-        screen_area_sum += poseEstimate.projection.screen_area;
-    }
+    // Bucket the blobs every tracker matched to each LED.
+    // The buckets are fixed size, so this stays allocation free for any number of trackers.
+    const ServerTrackerView *led_trackers[k_max_led_count][TrackerManager::k_max_devices];
+    CommonDeviceScreenLocation led_screen_locations[k_max_led_count][TrackerManager::k_max_devices];
+    float led_weights[k_max_led_count][TrackerManager::k_max_devices];
+    int led_observation_counts[k_max_led_count] = { 0 };
 
-    // Compute triangulations amongst all pairs of projections
-    int pair_count = 0;
-    int biggest_prjection_id = -1;
-    CommonDevicePosition average_world_position = { 0.f, 0.f, 0.f };
     for (int list_index = 0; list_index < projections_found; ++list_index)
     {
         const int tracker_id = valid_projection_tracker_ids[list_index];
-        const CommonDeviceScreenLocation &screen_location = position2d_list[list_index];
         const ServerTrackerViewPtr tracker = tracker_manager->getTrackerViewPtr(tracker_id);
+        const CommonDeviceTrackingProjection &projection = tracker_pose_estimations[tracker_id].projection;
 
-        for (int other_list_index = list_index + 1; other_list_index < projections_found; ++other_list_index)
-        {
-            const int other_tracker_id = valid_projection_tracker_ids[other_list_index];
-            const CommonDeviceScreenLocation &other_screen_location = position2d_list[other_list_index];
-            const ServerTrackerViewPtr other_tracker = tracker_manager->getTrackerViewPtr(other_tracker_id);
-            // if trackers are on opposite sides
-            if (cfg.exclude_opposed_cameras)
-            {
-                if ((tracker->getTrackerPose().PositionCm.x > 0) == (other_tracker->getTrackerPose().PositionCm.x < 0) &&
-                    (tracker->getTrackerPose().PositionCm.z > 0) == (other_tracker->getTrackerPose().PositionCm.z < 0))
-                {
-                    float screen_area = tracker_pose_estimations[tracker_id].projection.screen_area;
-                    float other_screen_area = tracker_pose_estimations[other_tracker_id].projection.screen_area;
+        screen_area_sum += projection.screen_area;
 
-                    biggest_prjection_id = screen_area > other_screen_area ? tracker_id : other_tracker_id;
+        if (biggest_prjection_id < 0 ||
+            projection.screen_area > tracker_pose_estimations[biggest_prjection_id].projection.screen_area)
+        {
+            biggest_prjection_id = tracker_id;
+        }
 
-                    continue;
-                }
-            }
+        if (projection.shape_type != eCommonTrackingProjectionType::ProjectionType_Points)
+        {
+            continue;
+        }
 
-            // Using the screen locations on two different trackers we can triangulate a world position
-            CommonDevicePosition world_position =
-                ServerTrackerView::triangulateWorldPosition(
-                    tracker.get(), &screen_location,
-                    other_tracker.get(), &other_screen_location);
+        for (int point_index = 0; point_index < projection.shape.points.point_count; ++point_index)
+        {
+            const int led_index = projection.shape.points.shape_point_index[point_index];
 
-            average_world_position.x += world_position.x;
-            average_world_position.y += world_position.y;
-            average_world_position.z += world_position.z;
+            if (led_index >= 0 && led_index < led_count)
+            {
+                const int observation_index = led_observation_counts[led_index];
 
-            ++pair_count;
+                led_trackers[led_index][observation_index] = tracker.get();
+                led_screen_locations[led_index][observation_index] = projection.shape.points.point[point_index];
+                led_weights[led_index][observation_index] = projection.screen_area;
+                ++led_observation_counts[led_index];
+            }
         }
     }
 
-    if (pair_count == 0 && biggest_prjection_id >= 0 && !DeviceManager::getInstance()->m_tracker_manager->getConfig().ignore_pose_from_one_tracker)
+    // Triangulate every LED seen by at least two trackers into one world space point cloud
+    t_led_point_matrix model_points(3, 0);
+    t_led_point_matrix world_points(3, 0);
+    int fused_led_count = 0;
+    for (int led_index = 0; led_index < led_count; ++led_index)
     {
-        // Position not triangulated from opposed camera, estimate from one tracker only.
-        computePointCloudPoseForHmdFromSingleTracker(
-            hmdView,
-            tracker_manager->getTrackerViewPtr(biggest_prjection_id),
-            &tracker_pose_estimations[biggest_prjection_id],
-            multicam_pose_estimation);		
+        CommonDevicePosition world_position;
+
+        if (led_observation_counts[led_index] >= 2 &&
+            ServerTrackerView::triangulateWorldPositionFromMultipleTrackers(
+                led_trackers[led_index],
+                led_screen_locations[led_index],
+                led_weights[led_index],
+                led_observation_counts[led_index],
+                cfg.triangulation_refinement_iterations,
+                &world_position))
+        {
+            const CommonDevicePosition &model_point = tracking_shape.shape.point_cloud.point[led_index];
+
+            // Stays within the fixed capacity of the matrices, so no allocation
+            model_points.conservativeResize(Eigen::NoChange, fused_led_count + 1);
+            world_points.conservativeResize(Eigen::NoChange, fused_led_count + 1);
+            model_points.col(fused_led_count) = eigen_vector3f_view(model_point);
+            world_points.col(fused_led_count) = eigen_vector3f_view(world_position);
+            ++fused_led_count;
+        }
     }
-    else if(pair_count > 0)
-    {
-        // Compute the average position
-        const float N = static_cast<float>(pair_count);
 
-        average_world_position.x /= N;
-        average_world_position.y /= N;
-        average_world_position.z /= N;
+    if (fused_led_count >= 3)
+    {
+        // Fit the HMD model to the fused cloud once (rigid transform, no scaling)
+        const Eigen::Matrix4f model_to_world = Eigen::umeyama(model_points, world_points, false);
+        const Eigen::Matrix3f rotation = model_to_world.topLeftCorner<3, 3>();
+        const Eigen::Vector3f world_position = model_to_world.topRightCorner<3, 1>();
 
-        // Store the averaged tracking position
-        const float q = tracker_manager->getConfig().controller_position_smoothing;
+        // Store the fitted tracking position
+        const float q = cfg.controller_position_smoothing;
         if (q <= 0.01f)
         {
-            multicam_pose_estimation->position_cm = average_world_position;
+            eigen_vector3f_view(multicam_pose_estimation->position_cm)= world_position;
         }
         else
         {
-            multicam_pose_estimation->position_cm.x = q * multicam_pose_estimation->position_cm.x + (1 - q) * average_world_position.x;
-            multicam_pose_estimation->position_cm.y = q * multicam_pose_estimation->position_cm.y + (1 - q) * average_world_position.y;
-            multicam_pose_estimation->position_cm.z = q * multicam_pose_estimation->position_cm.z + (1 - q) * average_world_position.z;
+            multicam_pose_estimation->position_cm.x = q * multicam_pose_estimation->position_cm.x + (1 - q) * world_position.x();
+            multicam_pose_estimation->position_cm.y = q * multicam_pose_estimation->position_cm.y + (1 - q) * world_position.y();
+            multicam_pose_estimation->position_cm.z = q * multicam_pose_estimation->position_cm.z + (1 - q) * world_position.z();
         }
 
+        eigen_quaternionf_view(multicam_pose_estimation->orientation)= Eigen::Quaternionf(rotation).normalized();
+        multicam_pose_estimation->bOrientationValid = true;
         multicam_pose_estimation->bCurrentlyTracking = true;
-    }
 
-    // No orientation for the sphere projection
-    multicam_pose_estimation->orientation.clear();
-    multicam_pose_estimation->bOrientationValid = false;
-
-    // Compute the average projection area.
-    // This is proportional to our position tracking quality.
-    multicam_pose_estimation->projection.screen_area =
-        screen_area_sum / static_cast<float>(projections_found);
+        // Compute the average projection area.
+        // This is proportional to our position tracking quality.
+        multicam_pose_estimation->projection.screen_area =
+            screen_area_sum / static_cast<float>(projections_found);
+    }
+    else if (biggest_prjection_id >= 0 && !cfg.ignore_pose_from_one_tracker)
+    {
+        // Too few LEDs seen by more than one tracker, fall back to the best single tracker solve
+        computePointCloudPoseForHmdFromSingleTracker(
+            hmdView,
+            tracker_manager->getTrackerViewPtr(biggest_prjection_id),
+            &tracker_pose_estimations[biggest_prjection_id],
+            multicam_pose_estimation);
+    }
 }
\ No newline at end of file
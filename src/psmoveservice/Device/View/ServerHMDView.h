@@ -3,25 +3,32 @@
 
 //-- includes -----
 #include "ServerDeviceView.h"
+#include "PoseFilterInterface.h"
 #include "PSMoveProtocolInterface.h"
 #include <cstring>
+#include <vector>
 
 // -- pre-declarations -----
 class TrackerManager;
 
 // -- declarations -----
+// Same layout as ControllerOpticalPoseEstimation: the per update fields first, the projection last
 struct HMDOpticalPoseEstimation
 {
 	std::chrono::time_point<std::chrono::high_resolution_clock> last_update_timestamp;
 	std::chrono::time_point<std::chrono::high_resolution_clock> last_visible_timestamp;
 	bool bValidTimestamps;
-
-	CommonDevicePosition position_cm;
-	CommonDeviceTrackingProjection projection;
 	bool bCurrentlyTracking;
+	bool bOrientationValid;
+
+	// Multicam pose only: not solved from the frames right after the previous pose's
+	// (a tracker dropped frames, or no tracker had a new frame), see PoseSensorPacket
+	bool bFollowsFrameGap;
 
+	CommonDevicePosition position_cm;
 	CommonDeviceQuaternion orientation;
-	bool bOrientationValid;
+
+	CommonDeviceTrackingProjection projection;
 
 	inline void clear()
 	{
@@ -31,6 +38,7 @@ struct HMDOpticalPoseEstimation
 
 		position_cm.clear();
 		bCurrentlyTracking = false;
+		bFollowsFrameGap = false;
 
 		orientation.clear();
 		bOrientationValid = false;
@@ -56,8 +64,13 @@ public:
 	void updateOpticalPoseEstimation(TrackerManager* tracker_manager);
     void updateStateAndPredict();
 
+	// Virtual HMDs only: queue up the poses an external tracker wrote into the
+	// shared memory pose input since the last poll (see SharedPoseInput.h)
+	void pollExternalPoses(class SharedPoseInputReader *pose_input_reader);
+
     IDeviceInterface* getDevice() const override { return m_device; }
-	inline class IPoseFilter * getPoseFilterMutable() { return m_pose_filter; }
+	// Any mutable access may change the filter state, so it drops the cached filtered pose
+	inline class IPoseFilter * getPoseFilterMutable() { m_filtered_pose_cache.invalidate(); return m_pose_filter; }
 	inline const class IPoseFilter * getPoseFilter() const { return m_pose_filter; }
 
 	// Estimate the given pose if the controller at some point into the future
@@ -79,6 +92,10 @@ public:
     // A lookBack of 0 corresponds to the most recent data.
     const struct CommonHMDState * getState(int lookBack = 0) const;
 
+	// Sensor reports the last poll drained, and the most a single poll drained since the HMD opened
+	inline int getLastPollSensorBacklog() const { return m_device->getLastPollSensorBacklog(); }
+	inline int getMaxPollSensorBacklog() const { return m_device->getMaxPollSensorBacklog(); }
+
 	// Get the tracking is enabled on this controller
 	inline bool getIsTrackingEnabled() const { return m_tracking_enabled && m_multicam_pose_estimation != nullptr; }
 
@@ -99,6 +116,9 @@ public:
     // Set the assigned tracking color ID for the controller
     bool setTrackingColorID(eCommonTrackingColorID colorID);
 
+	// How the vision scheduler ranks the HMD against the other tracked devices
+	inline eCommonVisionPriority getVisionPriority() const { return m_device->getVisionPriority(); }
+
 	// Get if the region-of-interest optimization is disabled for this HMD
 	inline bool getIsROIDisabled() const { return m_roi_disable_count > 0; }
 
@@ -113,7 +133,17 @@ public:
 
 	// Get the pose estimate relative to the given tracker id
 	inline const HMDOpticalPoseEstimation *getTrackerPoseEstimate(int trackerId) const {
-		return (m_tracker_pose_estimations != nullptr) ? &m_tracker_pose_estimations[trackerId] : nullptr;
+		return (m_tracker_pose_estimations != nullptr && trackerId >= 0 && trackerId < m_tracker_pose_estimation_count)
+			? &m_tracker_pose_estimations[trackerId] : nullptr;
+	}
+
+	// Number of tracker slots there are pose estimates for
+	inline int getTrackerPoseEstimateCount() const { return m_tracker_pose_estimation_count; }
+
+	// Set while enough trackers with a better view of the HMD get fused that the given one is left out
+	// (see TrackerManagerConfig::max_fused_tracker_count)
+	inline bool getIsTrackerOnFusionStandby(int trackerId) const {
+		return trackerId >= 0 && trackerId < static_cast<int>(m_tracker_fusion_standby.size()) && m_tracker_fusion_standby[trackerId];
 	}
 
 	// Get the pose estimate derived from multicam pose tracking
@@ -126,6 +156,13 @@ public:
 		return getIsTrackingEnabled() ? m_multicam_pose_estimation->bCurrentlyTracking : false;
 	}
 
+    // Helper used to publish the current HMD state to the given fixed layout pose frame.
+    // Returns false for HMD types that don't have a compact layout.
+    static bool generate_hmd_compact_pose_frame_for_stream(
+        const ServerHMDView *hmd_view,
+        const struct HMDStreamInfo *stream_info,
+        struct CompactHMDPoseFrame *pose_frame);
+
 protected:
 	void set_tracking_enabled_internal(bool bEnabled);
     bool allocate_device_interface(const class DeviceEnumerator *enumerator) override;
@@ -148,13 +185,23 @@ private:
     IHMDInterface *m_device;
 
 	// Filter state
-	HMDOpticalPoseEstimation *m_tracker_pose_estimations; // array of size TrackerManager::k_max_devices
+	HMDOpticalPoseEstimation *m_tracker_pose_estimations; // array of size m_tracker_pose_estimation_count
+	int m_tracker_pose_estimation_count; // the tracker manager's slot count when the device got allocated
+	std::vector<bool> m_tracker_fusion_standby; // one per tracker slot, see getIsTrackerOnFusionStandby()
 	HMDOpticalPoseEstimation *m_multicam_pose_estimation;
 	class IPoseFilter *m_pose_filter;
 	class PoseFilterSpace *m_pose_filter_space;
+	mutable FilteredPoseCache m_filtered_pose_cache; // getFilteredPose()/getFilteredPhysics() results since the last filter update
     int m_lastPollSeqNumProcessed;
 	std::chrono::time_point<std::chrono::high_resolution_clock> m_last_filter_update_timestamp;
 	bool m_last_filter_update_timestamp_valid;
+	std::chrono::time_point<std::chrono::high_resolution_clock> m_last_sample_capture_timestamp;
+	bool m_last_sample_capture_timestamp_valid;
+
+	// Injected poses waiting for the next updateStateAndPredict(), see pollExternalPoses()
+	std::vector<PoseSensorPacket> m_external_pose_packets;
+	std::vector<float> m_external_pose_delta_times;
+	int64_t m_last_external_pose_timestamp_us; // 0 before the first one
 };
 
 #endif // SERVER_HMD_VIEW_H
\ No newline at end of file
@@ -1,36 +1,114 @@
 //-- includes -----
+#include "CameraNodeLink.h"
 #include "DeviceEnumerator.h"
+#include "DeviceInputLog.h"
+#include "DeviceInterfaceEigen.h"
 #include "DeviceManager.h"
 #include "ServerTrackerView.h"
 #include "ServerControllerView.h"
 #include "ServerHMDView.h"
+#include "ControllerManager.h"
+#include "HMDManager.h"
 #include "MathUtility.h"
 #include "MathEigen.h"
 #include "MathGLM.h"
 #include "MathAlignment.h"
+#include "Eigen/Dense"
+#include "InputLogTracker.h"
 #include "PS3EyeTracker.h"
+#include "RemoteTracker.h"
 #include "PSMoveProtocol.pb.h"
+#include "PSMoveConfig.h"
 #include "ServerUtility.h"
 #include "ServerLog.h"
+#include "ServerMetrics.h"
+#include "ServerTrace.h"
 #include "ServerRequestHandler.h"
+#include "SharedTrackerProjections.h"
+#include "SharedTrackerProjectionWriter.h"
 #include "SharedTrackerState.h"
 #include "TrackerManager.h"
 #include "PoseFilterInterface.h"
+#include "AtomicPrimitives.h"
+#include "WorkerThread.h"
 
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
 #include <boost/interprocess/shared_memory_object.hpp>
 #include <boost/interprocess/mapped_region.hpp>
-#include <boost/interprocess/sync/scoped_lock.hpp>
+#include <chrono>
+#include <fstream>
 #include <memory>
 
 #include "opencv2/opencv.hpp"
 #include "opencv2/calib3d/calib3d.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+#include "opencv2/core/ocl.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 #define USE_OPEN_CV_ELLIPSE_FIT
 
 //-- constants ----
+// Smallest ROI half extent at k_roi_reference_frame_width, scaled to the actual frame width (see computeMinROISize())
 static const int k_min_roi_size= 32;
+static const int k_roi_reference_frame_width= 640;
+// Fraction of the speed the filter's velocity estimate may be off by over one frame, used to pad the ROI
+static const float k_roi_velocity_uncertainty= 0.25f;
+// Points around the silhouette of a tracking shape's bounding sphere that get projected to size the ROI
+static const int k_roi_silhouette_sample_count= 8;
+// Half and quarter resolution levels of the reacquisition pyramid
+static const int k_max_reacquisition_pyramid_levels= 2;
+// Most separate regions of a frame that get color converted and segmented (see planSearchRegions())
+static const int k_max_search_regions= eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES;
+// Most boundary points of a sphere blob that get undistorted and fit
+static const int k_max_blob_boundary_samples= 64;
+// Furthest a blob can be from a predicted LED projection and still be matched to that LED
+static const float k_point_cloud_match_gate_px= 12.f;
+// Largest RMS reprojection error of the matched LEDs for a point cloud pose to be accepted
+static const float k_point_cloud_max_reprojection_error_px= 4.f;
+// Fewest LED to blob correspondences a point cloud pose is solved from
+static const int k_point_cloud_min_correspondences= 4;
+// Point cloud LEDs facing further away from a tracker than this (cosine of the angle between the LED's outward
+// direction and its line of sight to the tracker) get left out of the LED to blob matching.
+// Generous, since the filter's orientation can be off while the HMD is lost.
+static const float k_point_cloud_led_visibility_min_cos= -0.2f;
+// Distance the LED visibility assumes while the filter has no position, straight down the tracker's optical axis
+static const float k_point_cloud_led_visibility_default_distance_cm= 150.f;
+// Furthest (in OpenCV hue units) the color auto calibration looks from the default hue of a color,
+// half the spacing of the default tracking colors
+static const int k_color_histogram_hue_search_range= 15;
+// Least saturated and darkest pixels the color auto calibration counts as part of a lit LED
+static const int k_color_histogram_min_saturation= 64;
+static const int k_color_histogram_min_value= 96;
+// Fewest LED pixels the color auto calibration needs to trust its histograms
+static const int k_color_histogram_min_pixel_count= 16;
+// Fraction of the LED pixels an auto calibrated color range covers
+static const float k_color_histogram_coverage= 0.95f;
+// Narrowest auto calibrated ranges, so that the preset holds up to small lighting changes
+static const int k_color_histogram_min_hue_range= 4;
+static const float k_color_histogram_min_range= 16.f;
+// Sample spacing of the motion gate thumbnails (kept even to land on the green raw Bayer pixels),
+// widened for big regions so that a thumbnail never gets more than this many samples across
+static const int k_motion_gate_min_sample_step= 4;
+static const int k_motion_gate_max_thumbnail_width= 32;
+// Most brightness samples the auto exposure takes across either axis of a blob
+static const int k_exposure_stats_max_samples_per_axis= 16;
+// Brightness at which a blob pixel counts as clipped
+static const int k_exposure_stats_saturated_value= 250;
+// Fewest blob pixels an auto exposure step gets based on, fewer can't tell a dim blob from no blob at all
+static const int k_auto_exposure_min_sample_count= 32;
+// Biggest brightness change an auto exposure step makes, and the smallest one worth making
+static const float k_auto_exposure_max_step= 1.25f;
+static const float k_auto_exposure_dead_band= 0.05f;
+// JPEG quality of the network video streams that don't pick one
+static const int k_network_video_default_quality= 70;
 
 //-- typedefs ----
 typedef std::vector<cv::Point> t_opencv_int_contour;
@@ -43,7 +121,46 @@ typedef std::vector<t_opencv_float_contour> t_opencv_float_contour_list;
 template<typename t_opencv_contour_type>
 cv::Point2f computeSafeCenterOfMassForContour(const t_opencv_contour_type &contour);
 
+// Copy between a Controller/HMDOpticalPoseEstimation and its camera node wire form
+template<typename t_pose_estimate_type>
+void poseEstimateToCameraNodePoseEstimate(const t_pose_estimate_type &pose_estimate, CameraNodePoseEstimate &out_pose_estimate);
+template<typename t_pose_estimate_type>
+void cameraNodePoseEstimateToPoseEstimate(const CameraNodePoseEstimate &pose_estimate, t_pose_estimate_type *out_pose_estimate);
+
 //-- private methods -----
+// Whether the overload shedding may put off the search for a device of the given priority this frame
+static inline bool getIsVisionPrioritySheddable(const eCommonVisionPriority vision_priority, const bool bIsCurrentlyTracking)
+{
+    switch (vision_priority)
+    {
+    case VisionPriority_Low:
+        return true;
+    case VisionPriority_Normal:
+        return !bIsCurrentlyTracking;
+    default:
+        return false;
+    }
+}
+
+// The ROI sizes are tuned for VGA frames. Smaller camera modes (ex: the PS3Eye's 320x240 high speed mode)
+// see the same scene with fewer pixels, so the minimums shrink with them.
+static inline int computeMinROISize(const int frame_width)
+{
+    return std::max((k_min_roi_size*frame_width) / k_roi_reference_frame_width, 8);
+}
+
+// Index of a shared memory preview scale in ServerTrackerView::m_shared_memory_preview_scale_counts,
+// unsupported scales round to the next smaller downscale
+static inline int getPreviewScaleLevel(const int scale)
+{
+    return (scale >= 4) ? 2 : ((scale >= 2) ? 1 : 0);
+}
+
+static inline int getPreviewPixelFormat(const int pixel_format)
+{
+    return (pixel_format > 0 && pixel_format < MAX_SHARED_VIDEO_PIXEL_FORMAT_COUNT) ? pixel_format : SharedVideoPixelFormat_BGR;
+}
+
 class SharedVideoFrameReadWriteAccessor
 {
 public:
@@ -84,23 +201,23 @@ public:
                     permissions);
 
             // Resize the shared memory
-            m_shared_memory_object->truncate(SharedVideoFrameHeader::computeTotalSize(stride, width));
+            m_shared_memory_object->truncate(SharedVideoFrameHeader::computeTotalSize(width, height, stride));
 
             // Map all of the shared memory for read/write access
             m_region = new boost::interprocess::mapped_region(*m_shared_memory_object, boost::interprocess::read_write);
 
             // Initialize the shared memory (call constructor using placement new)
-            // This make sure the mutex has the constructor called on it.
+            // This make sure the atomics have the constructor called on them.
             SharedVideoFrameHeader *frameState = new (getFrameHeader()) SharedVideoFrameHeader();
             
             frameState->width = width;
             frameState->height = height;
             frameState->stride = stride;
-            frameState->frame_index = 0;
             std::memset(
-                frameState->getBufferMutable(),
+                frameState->getBufferMutable(0),
                 0,
-                SharedVideoFrameHeader::computeVideoBufferSize(stride, height));
+                SharedVideoFrameHeader::k_frame_slot_count *
+                SharedVideoFrameHeader::computeSlotSize(width, height, stride));
 
             bSuccess = true;
         }
@@ -119,7 +236,7 @@ public:
         if (m_region != nullptr)
         {
             // Call the destructor manually on the frame header since it was constructed via placement new
-            // This will make sure the mutex has the destructor called on it.
+            // This will make sure the atomics have the destructor called on them.
             getFrameHeader()->~SharedVideoFrameHeader();
             
             delete m_region;
@@ -138,19 +255,114 @@ public:
         }
     }
 
-    void writeVideoFrame(const unsigned char *buffer)
+    // Never blocks: the frame goes into a ring slot that no client is reading.
+    // The row pitch of the source frame doesn't have to match the shared frame's.
+    // A preview gets downscaled and converted straight into the slot, so only the reduced frame gets written.
+    void writeVideoFrame(
+        const cv::Mat &bgr_frame,
+        const unsigned char *overlay_buffer,
+        long long timestamp_us,
+        const TrackerVideoPreviewSettings &preview)
     {
         SharedVideoFrameHeader *sharedFrameState = getFrameHeader();
-        boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex> lock(sharedFrameState->mutex);
 
         size_t buffer_size = 
             SharedVideoFrameHeader::computeVideoBufferSize(sharedFrameState->stride, sharedFrameState->height);
+        size_t overlay_size = 
+            SharedVideoFrameHeader::computeOverlayBufferSize(sharedFrameState->width, sharedFrameState->height);
         size_t total_shared_mem_size =
-            SharedVideoFrameHeader::computeTotalSize(sharedFrameState->stride, sharedFrameState->height);
+            SharedVideoFrameHeader::computeTotalSize(sharedFrameState->width, sharedFrameState->height, sharedFrameState->stride);
         assert(m_region->get_size() >= total_shared_mem_size);
 
-        ++sharedFrameState->frame_index;
-        std::memcpy(sharedFrameState->getBufferMutable(), buffer, buffer_size);
+        const int slot_index = sharedFrameState->getWriteSlotIndex();
+        SharedVideoFrameSlot &slot = sharedFrameState->slots[slot_index];
+        const int frame_index = sharedFrameState->frame_index.load() + 1;
+
+        // Mark the slot as being written so that a reader that raced us to it retries
+        slot.frame_index.store(0);
+        if (preview.scale <= 1 && preview.pixel_format == SharedVideoPixelFormat_BGR)
+        {
+            const unsigned char *buffer = bgr_frame.data;
+            const size_t buffer_stride = bgr_frame.step;
+
+            if (buffer_stride == static_cast<size_t>(sharedFrameState->stride))
+            {
+                std::memcpy(sharedFrameState->getBufferMutable(slot_index), buffer, buffer_size);
+            }
+            else
+            {
+                const size_t row_size = std::min(buffer_stride, static_cast<size_t>(sharedFrameState->stride));
+                unsigned char *slot_buffer = sharedFrameState->getBufferMutable(slot_index);
+
+                for (int row = 0; row < sharedFrameState->height; ++row)
+                {
+                    std::memcpy(slot_buffer + row*sharedFrameState->stride, buffer + row*buffer_stride, row_size);
+                }
+            }
+            std::memcpy(sharedFrameState->getOverlayBufferMutable(slot_index), overlay_buffer, overlay_size);
+
+            slot.width = sharedFrameState->width;
+            slot.height = sharedFrameState->height;
+            slot.stride = sharedFrameState->stride;
+        }
+        else
+        {
+            const int scale = std::max(preview.scale, 1);
+            const int preview_width = sharedFrameState->width / scale;
+            const int preview_height = sharedFrameState->height / scale;
+            const int preview_stride = preview_width*SharedVideoFrameHeader::getBytesPerPixel(preview.pixel_format);
+            unsigned char *slot_buffer = sharedFrameState->getBufferMutable(slot_index);
+
+            if (preview.pixel_format == SharedVideoPixelFormat_BGR)
+            {
+                cv::Mat preview_frame(preview_height, preview_width, CV_8UC3, slot_buffer, preview_stride);
+
+                cv::resize(bgr_frame, preview_frame, preview_frame.size(), 0, 0, cv::INTER_AREA);
+            }
+            else if (preview.pixel_format == SharedVideoPixelFormat_Gray)
+            {
+                cv::Mat preview_frame(preview_height, preview_width, CV_8UC1, slot_buffer, preview_stride);
+
+                if (scale > 1)
+                {
+                    cv::resize(bgr_frame, m_scaled_frame, preview_frame.size(), 0, 0, cv::INTER_AREA);
+                    cv::cvtColor(m_scaled_frame, preview_frame, cv::COLOR_BGR2GRAY);
+                }
+                else
+                {
+                    cv::cvtColor(bgr_frame, preview_frame, cv::COLOR_BGR2GRAY);
+                }
+            }
+
+            downscaleOverlay(
+                overlay_buffer, sharedFrameState->width, 
+                scale, preview_width, preview_height,
+                sharedFrameState->getOverlayBufferMutable(slot_index));
+
+            slot.width = preview_width;
+            slot.height = preview_height;
+            slot.stride = preview_stride;
+        }
+        slot.pixel_format = preview.pixel_format;
+        slot.timestamp_us.store(timestamp_us);
+        slot.frame_index.store(frame_index);
+
+        // Publish the slot
+        sharedFrameState->active_slot_index.store(slot_index);
+        sharedFrameState->frame_index.store(frame_index);
+    }
+
+    // True once a client has read the last frame we wrote (or we haven't written one yet)
+    size_t getAllocatedBytes() const
+    {
+        return (m_region != nullptr) ? m_region->get_size() : 0;
+    }
+
+    bool getWasLastFrameRead()
+    {
+        SharedVideoFrameHeader *sharedFrameState = getFrameHeader();
+
+        return sharedFrameState->last_read_frame_index.load() == sharedFrameState->frame_index.load();
     }
 
 protected:
@@ -159,10 +371,44 @@ protected:
         return reinterpret_cast<SharedVideoFrameHeader *>(m_region->get_address());
     }
 
+    // Overlay palette indices can't be averaged: each preview pixel takes the first overlay color in its block,
+    // so the one pixel wide debug lines survive the downscale
+    static void downscaleOverlay(
+        const unsigned char *overlay_buffer,
+        const int overlay_width,
+        const int scale,
+        const int preview_width,
+        const int preview_height,
+        unsigned char *out_preview_overlay)
+    {
+        for (int y = 0; y < preview_height; ++y)
+        {
+            unsigned char *preview_row = out_preview_overlay + y*preview_width;
+
+            for (int x = 0; x < preview_width; ++x)
+            {
+                unsigned char color = OverlayColor_None;
+
+                for (int block_y = 0; block_y < scale && color == OverlayColor_None; ++block_y)
+                {
+                    const unsigned char *block_row = overlay_buffer + (y*scale + block_y)*overlay_width + x*scale;
+
+                    for (int block_x = 0; block_x < scale && color == OverlayColor_None; ++block_x)
+                    {
+                        color = block_row[block_x];
+                    }
+                }
+
+                preview_row[x] = color;
+            }
+        }
+    }
+
 private:
     const char *m_shared_memory_name;
     boost::interprocess::shared_memory_object *m_shared_memory_object;
     boost::interprocess::mapped_region *m_region;
+    cv::Mat m_scaled_frame; // Gray previews get downscaled before they get converted
 };
 
 struct OpenCVPlane2D
@@ -248,17 +494,37 @@ struct OpenCVPlane2D
     }
 };
 
+// Header of the precomputed BGR->HSV table file (followed by the packed HSV entries)
+struct BGRToHSVTableFileHeader
+{
+    char magic[4];              // "PSHV"
+    uint32_t file_version;
+    uint32_t quantized;         // 1 if indexed by 5-6-5 bit colors
+    uint32_t entry_count;
+    char opencv_version[32];    // CV_VERSION the table was generated with
+};
+static const uint32_t k_bgr_to_hsv_table_file_version = 1;
+
+/// Maps BGR pixels to HSV through a table that holds every (optionally 5-6-5 quantized) color.
+/**
+ The table only depends on the OpenCV version, so the first service to need it writes it
+ into the config directory and every later start (or any other process) maps the file read-only.
+ The pages of the file are then shared through the OS file cache instead of each process
+ holding its own 48MB copy. The quantized table is only 192KB and stays cache resident.
+ On average it is off by about 1 unit of hue and 2-3 units of saturation/value, but hue and saturation
+ can be far off for very dark or nearly gray colors (the measured error is logged on generation).
+ */
 class OpenCVBGRToHSVMapper
 {
 public:
     typedef cv::Point3_<uint8_t> ColorTuple;
 
-    static OpenCVBGRToHSVMapper *allocate()
+    static OpenCVBGRToHSVMapper *allocate(bool bQuantized, bool bUseCacheFile)
     {
         if (m_refCount == 0)
         {
             assert(m_instance == nullptr);
-            m_instance = new OpenCVBGRToHSVMapper();
+            m_instance = new OpenCVBGRToHSVMapper(bQuantized, bUseCacheFile);
         }
         assert(m_instance != nullptr);
 
@@ -280,626 +546,4221 @@ public:
         }
     }
 
+    // Bytes of the table this process holds on its own, and mapped from the table file
+    // (those pages are shared with every other process that maps the file).
+    // Zero until a tracker converted its first frame.
+    static void getAllocatedBytes(size_t &out_private_bytes, size_t &out_mapped_bytes)
+    {
+        out_private_bytes = (m_instance != nullptr) ? m_instance->m_privateTableBytes.load() : 0;
+        out_mapped_bytes = (m_instance != nullptr) ? m_instance->m_mappedTableBytes.load() : 0;
+    }
+
     void cvtColor(const cv::Mat &bgrBuffer, cv::Mat &hsvBuffer)
     {
-        hsvBuffer.forEach<ColorTuple>([&bgrBuffer, this](ColorTuple &hsvColor, const int position[]) -> void {
-            const ColorTuple &bgrColor = bgrBuffer.at<ColorTuple>(position[0], position[1]);
-            const int b = bgrColor.x;
-            const int g = bgrColor.y;
-            const int r = bgrColor.z;
-            const int LUTIndex = OpenCVBGRToHSVMapper::getLUTIndex(r, g, b);
+        // The table takes a while to build (or map), so don't hold up service startup with it.
+        // It gets built by whichever tracker converts a frame first.
+        std::call_once(m_buildOnce, [this]() { buildLUT(); });
 
-            hsvColor = bgr2hsv->at<ColorTuple>(LUTIndex, 0);
-        });
+        const ColorTuple *table = m_table;
+
+        if (m_bQuantized)
+        {
+            hsvBuffer.forEach<ColorTuple>([&bgrBuffer, table](ColorTuple &hsvColor, const int position[]) -> void {
+                const ColorTuple &bgrColor = bgrBuffer.at<ColorTuple>(position[0], position[1]);
+
+                hsvColor = table[OpenCVBGRToHSVMapper::getQuantizedLUTIndex(bgrColor.z, bgrColor.y, bgrColor.x)];
+            });
+        }
+        else
+        {
+            hsvBuffer.forEach<ColorTuple>([&bgrBuffer, table](ColorTuple &hsvColor, const int position[]) -> void {
+                const ColorTuple &bgrColor = bgrBuffer.at<ColorTuple>(position[0], position[1]);
+
+                hsvColor = table[OpenCVBGRToHSVMapper::getLUTIndex(bgrColor.z, bgrColor.y, bgrColor.x)];
+            });
+        }
     }
 
 private:
     static OpenCVBGRToHSVMapper *m_instance;
     static int m_refCount;
 
-    OpenCVBGRToHSVMapper()
+    OpenCVBGRToHSVMapper(bool bQuantized, bool bUseCacheFile)
+        : m_bQuantized(bQuantized)
+        , m_bUseCacheFile(bUseCacheFile)
+        , m_table(nullptr)
+        , m_tableFile(nullptr)
+        , m_tableRegion(nullptr)
+        , m_privateTableBytes(0)
+        , m_mappedTableBytes(0)
     {
-        bgr2hsv = new cv::Mat(256*256*256, 1, CV_8UC3);
+    }
 
-        int LUTIndex = 0;
-        for (int r = 0; r < 256; ++r)
+    ~OpenCVBGRToHSVMapper()
+    {
+        if (m_tableRegion != nullptr)
         {
-            for (int g = 0; g < 256; ++g)
-            {
-                for (int b = 0; b < 256; ++b)
-                {
-                    bgr2hsv->at<ColorTuple>(LUTIndex, 0) = ColorTuple(b, g, r);
-                    ++LUTIndex;
-                }
-            }
+            delete m_tableRegion;
         }
 
-        cv::cvtColor(*bgr2hsv, *bgr2hsv, cv::COLOR_BGR2HSV);
+        if (m_tableFile != nullptr)
+        {
+            delete m_tableFile;
+        }
     }
 
-    ~OpenCVBGRToHSVMapper()
+    int getEntryCount() const
     {
-        delete bgr2hsv;
+        return m_bQuantized ? (1 << 16) : (256 * 256 * 256);
     }
 
-    static int getLUTIndex(int r, int g, int b)
+    std::string getTableFilePath() const
     {
-        return (256 * 256)*r + 256*g + b;
-    }
+        boost::filesystem::path table_path(PSMoveConfig::getConfigDirectoryPath());
+        table_path /= m_bQuantized ? "BGRToHSVTable565.bin" : "BGRToHSVTable888.bin";
 
-    cv::Mat *bgr2hsv;
-};
-OpenCVBGRToHSVMapper *OpenCVBGRToHSVMapper::m_instance = nullptr;
-int OpenCVBGRToHSVMapper::m_refCount= 0;
+        return table_path.string();
+    }
 
-class OpenCVBufferState
-{
-public:
-    OpenCVBufferState(ITrackerInterface *device)
-        : bgrBuffer(nullptr)
-        , bgrShmemBuffer(nullptr)
-        , hsvBuffer(nullptr)
-        , gsLowerBuffer(nullptr)
-        , gsUpperBuffer(nullptr)
-        , maskedBuffer(nullptr)
+    void buildLUT()
     {
-        device->getVideoFrameDimensions(&frameWidth, &frameHeight, nullptr);
+        const std::string table_path = getTableFilePath();
 
-        bgrBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
-        bgrShmemBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
-        hsvBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
-        gsLowerBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC1);
-        gsUpperBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC1);
-        maskedBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
-        
-        const TrackerManagerConfig &cfg= DeviceManager::getInstance()->m_tracker_manager->getConfig();
-        if (cfg.use_bgr_to_hsv_lookup_table)
+        if (m_bUseCacheFile && mapTableFile(table_path))
+        {
+            SERVER_MT_LOG_INFO("OpenCVBGRToHSVMapper") << "Mapped BGR->HSV table from " << table_path;
+            return;
+        }
+
+        const int entry_count = getEntryCount();
+        m_tableBuffer.resize(entry_count);
+        m_privateTableBytes = sizeof(ColorTuple)*m_tableBuffer.capacity();
+
+        if (m_bQuantized)
         {
-            bgr2hsv = OpenCVBGRToHSVMapper::allocate();
+            // Use the center of each quantization bucket as the representative color
+            for (int LUTIndex = 0; LUTIndex < entry_count; ++LUTIndex)
+            {
+                const int r = ((LUTIndex >> 11) << 3) | 0x4;
+                const int g = (((LUTIndex >> 5) & 0x3f) << 2) | 0x2;
+                const int b = ((LUTIndex & 0x1f) << 3) | 0x4;
+
+                m_tableBuffer[LUTIndex] = ColorTuple(b, g, r);
+            }
         }
         else
         {
-            bgr2hsv = nullptr;
+            int LUTIndex = 0;
+            for (int r = 0; r < 256; ++r)
+            {
+                for (int g = 0; g < 256; ++g)
+                {
+                    for (int b = 0; b < 256; ++b)
+                    {
+                        m_tableBuffer[LUTIndex] = ColorTuple(b, g, r);
+                        ++LUTIndex;
+                    }
+                }
+            }
         }
-        
-        //Apply default ROI (full frame).
-        applyROI(cv::Rect2i(cv::Point(0,0), cv::Size(frameWidth, frameHeight)));
-    }
 
-    virtual ~OpenCVBufferState()
-    {
-        if (maskedBuffer != nullptr)
+        cv::Mat tableMat(entry_count, 1, CV_8UC3, m_tableBuffer.data());
+        cv::cvtColor(tableMat, tableMat, cv::COLOR_BGR2HSV);
+        m_table = m_tableBuffer.data();
+
+        if (m_bQuantized)
         {
-            delete maskedBuffer;
+            logQuantizationError();
         }
-        
-        if (gsLowerBuffer != nullptr)
+
+        if (m_bUseCacheFile && writeTableFile(table_path) && mapTableFile(table_path))
         {
-            delete gsLowerBuffer;
+            // Drop the private copy in favor of the shared mapping
+            std::vector<ColorTuple>().swap(m_tableBuffer);
+            m_privateTableBytes = 0;
+            SERVER_MT_LOG_INFO("OpenCVBGRToHSVMapper") << "Generated BGR->HSV table " << table_path;
         }
-        
-        if (gsUpperBuffer != nullptr)
+    }
+
+    bool mapTableFile(const std::string &table_path)
+    {
+        bool bSuccess = false;
+
+        try
         {
-            delete gsUpperBuffer;
+            const size_t entry_bytes = sizeof(ColorTuple)*getEntryCount();
+            boost::system::error_code error;
+            const boost::uintmax_t file_size = boost::filesystem::file_size(table_path, error);
+
+            if (!error && file_size == sizeof(BGRToHSVTableFileHeader) + entry_bytes)
+            {
+                boost::interprocess::file_mapping *file =
+                    new boost::interprocess::file_mapping(table_path.c_str(), boost::interprocess::read_only);
+                boost::interprocess::mapped_region *region =
+                    new boost::interprocess::mapped_region(*file, boost::interprocess::read_only);
+                const BGRToHSVTableFileHeader *header =
+                    reinterpret_cast<const BGRToHSVTableFileHeader *>(region->get_address());
+
+                if (isTableFileHeaderValid(*header))
+                {
+                    m_tableFile = file;
+                    m_tableRegion = region;
+                    m_mappedTableBytes = region->get_size();
+                    m_table = reinterpret_cast<const ColorTuple *>(header + 1);
+                    bSuccess = true;
+                }
+                else
+                {
+                    SERVER_MT_LOG_WARNING("OpenCVBGRToHSVMapper") << "Ignoring out of date BGR->HSV table " << table_path;
+                    delete region;
+                    delete file;
+                }
+            }
         }
-        
-        if (hsvBuffer != nullptr)
+        catch (boost::interprocess::interprocess_exception &ex)
         {
-            delete hsvBuffer;
+            SERVER_MT_LOG_WARNING("OpenCVBGRToHSVMapper") << "Failed to map BGR->HSV table " << table_path << ": " << ex.what();
         }
-        
-        if (bgrShmemBuffer != nullptr)
+
+        return bSuccess;
+    }
+
+    bool writeTableFile(const std::string &table_path) const
+    {
+        BGRToHSVTableFileHeader header;
+        makeTableFileHeader(header);
+
+        // Write to a temp file first so another process never maps a partially written table
+        boost::system::error_code error;
+        const boost::filesystem::path temp_path = table_path + "." + boost::filesystem::unique_path().string();
+        bool bSuccess = false;
+
         {
-            delete bgrShmemBuffer;
+            std::ofstream table_file(temp_path.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+            table_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            table_file.write(reinterpret_cast<const char *>(m_table), sizeof(ColorTuple)*getEntryCount());
+            bSuccess = table_file.good();
         }
-        
-        if (bgrBuffer != nullptr)
+
+        if (bSuccess)
         {
-            delete bgrBuffer;
+            boost::filesystem::rename(temp_path, table_path, error);
+            bSuccess = !error;
         }
-        
-        if (bgr2hsv != nullptr)
+
+        if (!bSuccess)
         {
-            OpenCVBGRToHSVMapper::dispose(bgr2hsv);
+            SERVER_MT_LOG_WARNING("OpenCVBGRToHSVMapper") << "Failed to write BGR->HSV table " << table_path;
+            boost::filesystem::remove(temp_path, error);
         }
+
+        return bSuccess;
+    }
+
+    void makeTableFileHeader(BGRToHSVTableFileHeader &out_header) const
+    {
+        memset(&out_header, 0, sizeof(BGRToHSVTableFileHeader));
+        memcpy(out_header.magic, "PSHV", 4);
+        out_header.file_version = k_bgr_to_hsv_table_file_version;
+        out_header.quantized = m_bQuantized ? 1 : 0;
+        out_header.entry_count = static_cast<uint32_t>(getEntryCount());
+        strncpy(out_header.opencv_version, CV_VERSION, sizeof(out_header.opencv_version) - 1);
     }
 
-    void writeVideoFrame(const unsigned char *video_buffer)
+    bool isTableFileHeaderValid(const BGRToHSVTableFileHeader &header) const
     {
-        const cv::Mat videoBufferMat(frameHeight, frameWidth, CV_8UC3, const_cast<unsigned char *>(video_buffer));
+        BGRToHSVTableFileHeader expected_header;
+        makeTableFileHeader(expected_header);
 
-        videoBufferMat.copyTo(*bgrBuffer);
-        videoBufferMat.copyTo(*bgrShmemBuffer);
+        return memcmp(&header, &expected_header, sizeof(BGRToHSVTableFileHeader)) == 0;
     }
-    
-    void updateHsvBuffer()
+
+    // Compares the quantized table against the exact conversion on a sample of colors
+    void logQuantizationError() const
     {
-        // Convert the video buffer to the HSV color space
-        if (bgr2hsv != nullptr)
+        const int k_sample_step = 3;
+        const int sample_axis_count = (255 / k_sample_step) + 1;
+        cv::Mat exactMat(sample_axis_count*sample_axis_count*sample_axis_count, 1, CV_8UC3);
+
+        int sample_index = 0;
+        for (int r = 0; r < 256; r += k_sample_step)
         {
-            bgr2hsv->cvtColor(bgrROI, hsvROI);
+            for (int g = 0; g < 256; g += k_sample_step)
+            {
+                for (int b = 0; b < 256; b += k_sample_step)
+                {
+                    exactMat.at<ColorTuple>(sample_index, 0) = ColorTuple(b, g, r);
+                    ++sample_index;
+                }
+            }
         }
-        else
+
+        cv::Mat bgrMat = exactMat.clone();
+        cv::cvtColor(exactMat, exactMat, cv::COLOR_BGR2HSV);
+
+        int max_error[3] = { 0, 0, 0 };
+        double total_error[3] = { 0.0, 0.0, 0.0 };
+        for (sample_index = 0; sample_index < exactMat.rows; ++sample_index)
         {
-            cv::cvtColor(bgrROI, hsvROI, cv::COLOR_BGR2HSV);
+            const ColorTuple &bgr = bgrMat.at<ColorTuple>(sample_index, 0);
+            const ColorTuple &exact = exactMat.at<ColorTuple>(sample_index, 0);
+            const ColorTuple &approx = m_table[getQuantizedLUTIndex(bgr.z, bgr.y, bgr.x)];
+
+            // Hue wraps around at 180
+            const int hue_error = std::abs(static_cast<int>(exact.x) - static_cast<int>(approx.x));
+            const int errors[3] = {
+                std::min(hue_error, 180 - hue_error),
+                std::abs(static_cast<int>(exact.y) - static_cast<int>(approx.y)),
+                std::abs(static_cast<int>(exact.z) - static_cast<int>(approx.z)) };
+
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                max_error[channel] = std::max(max_error[channel], errors[channel]);
+                total_error[channel] += errors[channel];
+            }
         }
+
+        SERVER_MT_LOG_INFO("OpenCVBGRToHSVMapper") << "5-6-5 BGR->HSV table error over " << exactMat.rows << " colors"
+            << " (mean/max) H: " << total_error[0] / exactMat.rows << "/" << max_error[0]
+            << " S: " << total_error[1] / exactMat.rows << "/" << max_error[1]
+            << " V: " << total_error[2] / exactMat.rows << "/" << max_error[2];
     }
-    
-    void applyROI(cv::Rect2i ROI)
+
+    static int getLUTIndex(int r, int g, int b)
     {
-        // Make sure the ROI box is always clamped in bounds of the frame buffer
-        int x0= std::min(std::max(ROI.tl().x, 0), frameWidth-1);
-        int y0= std::min(std::max(ROI.tl().y, 0), frameHeight-1);
-        int x1= std::min(std::max(ROI.br().x, 0), frameWidth-1);
-        int y1= std::min(std::max(ROI.br().y, 0), frameHeight-1);
-        int clamped_width = std::max(x1-x0, 0);
-        int clamped_height = std::max(y1-y0, 0);
+        return (256 * 256)*r + 256*g + b;
+    }
 
-        // If the clamped ROI ends up being zero-width or zero-height, 
-        // just make it full screen
-        if (clamped_width > 0 && clamped_height > 0)
+    static int getQuantizedLUTIndex(int r, int g, int b)
+    {
+        return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    }
+
+    std::once_flag m_buildOnce;
+    bool m_bQuantized;
+    bool m_bUseCacheFile;
+    const ColorTuple *m_table;
+    std::vector<ColorTuple> m_tableBuffer;
+    boost::interprocess::file_mapping *m_tableFile;
+    boost::interprocess::mapped_region *m_tableRegion;
+    // Written by whichever thread builds the table, see getAllocatedBytes()
+    std::atomic<size_t> m_privateTableBytes;
+    std::atomic<size_t> m_mappedTableBytes;
+};
+OpenCVBGRToHSVMapper *OpenCVBGRToHSVMapper::m_instance = nullptr;
+int OpenCVBGRToHSVMapper::m_refCount= 0;
+
+/// Converts BGR pixels to HSV and applies the hue-wrapped HSV range test in a single pass,
+/// writing the grayscale mask directly (no intermediate HSV or partial mask buffers).
+/// The HSV math matches the 8-bit cv::cvtColor(COLOR_BGR2HSV) path and the range test matches cv::inRange.
+/// Where 128-bit SIMD is available (SSE2+/NEON via OpenCV's universal intrinsics) blocks of 16 pixels
+/// are first rejected on value and saturation, which is most of the ROI, before computing hue.
+class OpenCVFusedHSVMaskKernel
+{
+public:
+    struct Threshold
+    {
+        int hue_min[2];
+        int hue_max[2];
+        int saturation_min, saturation_max;
+        int value_min, value_max;
+        bool bIsEmpty;
+    };
+
+    static void computeThreshold(const CommonHSVColorRange &hsvColorRange, Threshold &out_threshold)
+    {
+        // Same hue wrapping rules as OpenCVBufferState::computeBiggestNContours()
+        const float hue_min = hsvColorRange.hue_range.center - hsvColorRange.hue_range.range;
+        const float hue_max = hsvColorRange.hue_range.center + hsvColorRange.hue_range.range;
+        const float saturation_min = clampf(hsvColorRange.saturation_range.center - hsvColorRange.saturation_range.range, 0, 255);
+        const float saturation_max = clampf(hsvColorRange.saturation_range.center + hsvColorRange.saturation_range.range, 0, 255);
+        const float value_min = clampf(hsvColorRange.value_range.center - hsvColorRange.value_range.range, 0, 255);
+        const float value_max = clampf(hsvColorRange.value_range.center + hsvColorRange.value_range.range, 0, 255);
+
+        if (hue_min < 0)
         {
-            ROI.x= x0;
-            ROI.y= y0;
-            ROI.width = clamped_width;
-            ROI.height = clamped_height;
+            out_threshold.hue_min[0] = 0;
+            out_threshold.hue_max[0] = cvRound(clampf(hue_max, 0, 180));
+            out_threshold.hue_min[1] = cvRound(clampf(180 + hue_min, 0, 180));
+            out_threshold.hue_max[1] = 180;
+        }
+        else if (hue_max > 180)
+        {
+            out_threshold.hue_min[0] = 0;
+            out_threshold.hue_max[0] = cvRound(clampf(hue_max - 180, 0, 180));
+            out_threshold.hue_min[1] = cvRound(clampf(hue_min, 0, 180));
+            out_threshold.hue_max[1] = 180;
         }
         else
         {
-            ROI.x= 0;
-            ROI.y= 0;
-            ROI.width = frameWidth;
-            ROI.height = frameHeight;
+            out_threshold.hue_min[0] = cvRound(hue_min);
+            out_threshold.hue_max[0] = cvRound(hue_max);
+            out_threshold.hue_min[1] = 0;
+            out_threshold.hue_max[1] = -1;
         }
-       
-        //Create the ROI matrices.
-        //It's not a full copy, so this isn't too slow.
-        //adjustROI is probably slightly faster but I ran into trouble with it.
-        bgrROI = cv::Mat(*bgrBuffer, ROI);
-        hsvROI = cv::Mat(*hsvBuffer, ROI);
-        gsLowerROI = cv::Mat(*gsLowerBuffer, ROI);
-        gsUpperROI = cv::Mat(*gsUpperBuffer, ROI);
-        
-        updateHsvBuffer();
-        
-        //Draw ROI.
-        cv::rectangle(*bgrShmemBuffer, ROI, cv::Scalar(255, 0, 0));
+
+        out_threshold.saturation_min = cvRound(saturation_min);
+        out_threshold.saturation_max = cvRound(saturation_max);
+        out_threshold.value_min = cvRound(value_min);
+        out_threshold.value_max = cvRound(value_max);
+        out_threshold.bIsEmpty = 
+            out_threshold.saturation_min > out_threshold.saturation_max ||
+            out_threshold.value_min > out_threshold.value_max;
     }
 
-    // Return points in raw image space:
-    // i.e. [0, 0] at lower left  to [frameWidth-1, frameHeight-1] at lower right
-    bool computeBiggestNContours(
-        const CommonHSVColorRange &hsvColorRange,
-        t_opencv_int_contour_list &out_biggest_N_contours,
-        std::vector<double> &out_contour_areas,
-        const int max_contour_count,
-        const int min_points_in_contour = 6)
+    static void apply(const cv::Mat &bgrROI, const Threshold &threshold, cv::Mat &maskROI)
     {
-        out_biggest_N_contours.clear();
-        out_contour_areas.clear();
-        
-        // Clamp the HSV image, taking into account wrapping the hue angle
+        assert(bgrROI.type() == CV_8UC3);
+        assert(maskROI.type() == CV_8UC1);
+        assert(bgrROI.size() == maskROI.size());
+
+        if (threshold.bIsEmpty)
         {
-            const float hue_min = hsvColorRange.hue_range.center - hsvColorRange.hue_range.range;
-            const float hue_max = hsvColorRange.hue_range.center + hsvColorRange.hue_range.range;
-            const float saturation_min = clampf(hsvColorRange.saturation_range.center - hsvColorRange.saturation_range.range, 0, 255);
-            const float saturation_max = clampf(hsvColorRange.saturation_range.center + hsvColorRange.saturation_range.range, 0, 255);
-            const float value_min = clampf(hsvColorRange.value_range.center - hsvColorRange.value_range.range, 0, 255);
-            const float value_max = clampf(hsvColorRange.value_range.center + hsvColorRange.value_range.range, 0, 255);
-
-            if (hue_min < 0)
-            {
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(0, saturation_min, value_min),
-                    cv::Scalar(clampf(hue_max, 0, 180), saturation_max, value_max),
-                    gsLowerROI);
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(clampf(180 + hue_min, 0, 180), saturation_min, value_min),
-                    cv::Scalar(180, saturation_max, value_max),
-                    gsUpperROI);
-                cv::bitwise_or(gsLowerROI, gsUpperROI, gsLowerROI);
-            }
-            else if (hue_max > 180)
-            {
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(0, saturation_min, value_min),
-                    cv::Scalar(clampf(hue_max - 180, 0, 180), saturation_max, value_max),
-                    gsLowerROI);
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(clampf(hue_min, 0, 180), saturation_min, value_min),
-                    cv::Scalar(180, saturation_max, value_max),
-                    gsUpperROI);
-                cv::bitwise_or(gsLowerROI, gsUpperROI, gsLowerROI);
-            }
-            else
+            maskROI.setTo(cv::Scalar(0));
+            return;
+        }
+
+        const DivisionTables &tables = getDivisionTables();
+
+        for (int row = 0; row < bgrROI.rows; ++row)
+        {
+            const uint8_t *bgr = bgrROI.ptr<uint8_t>(row);
+            uint8_t *mask = maskROI.ptr<uint8_t>(row);
+            int col = 0;
+
+#if CV_SIMD128
+            // Conservative value/saturation test on 16 pixels at a time.
+            // Saturation is rounded, so the bounds are widened by one to never reject a pixel
+            // the exact test would accept: s >= s_min needs 255*diff >= (s_min-1)*v, etc.
+            const cv::v_uint8x16 v_value_min = cv::v_setall_u8(static_cast<uchar>(threshold.value_min));
+            const cv::v_uint8x16 v_value_max = cv::v_setall_u8(static_cast<uchar>(threshold.value_max));
+            const cv::v_uint16x8 v_255 = cv::v_setall_u16(255);
+            const cv::v_uint16x8 v_sat_min = cv::v_setall_u16(static_cast<ushort>(std::max(threshold.saturation_min - 1, 0)));
+            const cv::v_uint16x8 v_sat_max = cv::v_setall_u16(static_cast<ushort>(threshold.saturation_max + 1));
+
+            for (; col <= bgrROI.cols - 16; col += 16)
+            {
+                cv::v_uint8x16 b, g, r;
+                cv::v_load_deinterleave(bgr + 3*col, b, g, r);
+
+                const cv::v_uint8x16 v = cv::v_max(cv::v_max(b, g), r);
+                const cv::v_uint8x16 diff = v - cv::v_min(cv::v_min(b, g), r);
+                const cv::v_uint8x16 value_ok = (v >= v_value_min) & (v <= v_value_max);
+
+                cv::v_uint16x8 v_lo, v_hi, diff_lo, diff_hi;
+                cv::v_expand(v, v_lo, v_hi);
+                cv::v_expand(diff, diff_lo, diff_hi);
+
+                const cv::v_uint16x8 sdiff_lo = diff_lo * v_255;
+                const cv::v_uint16x8 sdiff_hi = diff_hi * v_255;
+                const cv::v_uint16x8 sat_ok_lo = (sdiff_lo >= v_lo * v_sat_min) & (sdiff_lo <= v_lo * v_sat_max);
+                const cv::v_uint16x8 sat_ok_hi = (sdiff_hi >= v_hi * v_sat_min) & (sdiff_hi <= v_hi * v_sat_max);
+
+                const cv::v_uint8x16 candidates = value_ok & cv::v_pack(sat_ok_lo, sat_ok_hi);
+
+                if (cv::v_check_any(candidates))
+                {
+                    // At least one pixel might pass, run the exact test on the block
+                    for (int i = col; i < col + 16; ++i)
+                    {
+                        mask[i] = computeMaskValue(bgr + 3*i, threshold, tables);
+                    }
+                }
+                else
+                {
+                    cv::v_store(mask + col, cv::v_setzero_u8());
+                }
+            }
+#endif
+
+            // Remaining pixels (or all of them without SIMD support)
+            for (; col < bgrROI.cols; ++col)
+            {
+                mask[col] = computeMaskValue(bgr + 3*col, threshold, tables);
+            }
+        }
+    }
+
+    /// Tests every pixel against several thresholds at once, computing its HSV value only once.
+    /// Each labelROI pixel gets the bit of every threshold it passes OR'd together.
+    static void classify(
+        const cv::Mat &bgrROI,
+        const Threshold *thresholds,
+        const uint8_t *threshold_bits,
+        const int threshold_count,
+        cv::Mat &labelROI)
+    {
+        assert(bgrROI.type() == CV_8UC3);
+        assert(labelROI.type() == CV_8UC1);
+        assert(bgrROI.size() == labelROI.size());
+
+        const DivisionTables &tables = getDivisionTables();
+
+        for (int row = 0; row < bgrROI.rows; ++row)
+        {
+            const uint8_t *bgr = bgrROI.ptr<uint8_t>(row);
+            uint8_t *label = labelROI.ptr<uint8_t>(row);
+
+            for (int col = 0; col < bgrROI.cols; ++col, bgr += 3)
+            {
+                int h, s, v;
+                computeHSV(bgr, tables, h, s, v);
+
+                uint8_t pixel_label = 0;
+                for (int threshold_index = 0; threshold_index < threshold_count; ++threshold_index)
+                {
+                    if (passesThreshold(h, s, v, thresholds[threshold_index]))
+                    {
+                        pixel_label |= threshold_bits[threshold_index];
+                    }
+                }
+
+                label[col] = pixel_label;
+            }
+        }
+    }
+
+private:
+    static const int k_hsv_shift = 12;
+
+    struct DivisionTables
+    {
+        int sdiv_table[256];
+        int hdiv_table[256];
+
+        DivisionTables()
+        {
+            // Same fixed point reciprocal tables OpenCV uses for the 8-bit BGR->HSV conversion
+            sdiv_table[0] = hdiv_table[0] = 0;
+            for (int i = 1; i < 256; ++i)
+            {
+                sdiv_table[i] = cv::saturate_cast<int>((255 << k_hsv_shift) / (1.*i));
+                hdiv_table[i] = cv::saturate_cast<int>((180 << k_hsv_shift) / (6.*i));
+            }
+        }
+    };
+
+    static const DivisionTables &getDivisionTables()
+    {
+        static DivisionTables tables;
+        return tables;
+    }
+
+    static inline void computeHSV(const uint8_t *bgr, const DivisionTables &tables, int &out_h, int &out_s, int &out_v)
+    {
+        const int b = bgr[0];
+        const int g = bgr[1];
+        const int r = bgr[2];
+        const int v = std::max(std::max(b, g), r);
+        const int diff = v - std::min(std::min(b, g), r);
+        const int vr = (v == r) ? -1 : 0;
+        const int vg = (v == g) ? -1 : 0;
+
+        int h = (vr & (g - b)) + (~vr & ((vg & (b - r + 2 * diff)) + ((~vg) & (r - g + 4 * diff))));
+        h = (h * tables.hdiv_table[diff] + (1 << (k_hsv_shift - 1))) >> k_hsv_shift;
+        h += (h < 0) ? 180 : 0;
+
+        out_h = h;
+        out_s = (diff * tables.sdiv_table[v] + (1 << (k_hsv_shift - 1))) >> k_hsv_shift;
+        out_v = v;
+    }
+
+    static inline bool passesThreshold(const int h, const int s, const int v, const Threshold &threshold)
+    {
+        return
+            !threshold.bIsEmpty &&
+            v >= threshold.value_min && v <= threshold.value_max &&
+            s >= threshold.saturation_min && s <= threshold.saturation_max &&
+            ((h >= threshold.hue_min[0] && h <= threshold.hue_max[0]) ||
+             (h >= threshold.hue_min[1] && h <= threshold.hue_max[1]));
+    }
+
+    static inline uint8_t computeMaskValue(const uint8_t *bgr, const Threshold &threshold, const DivisionTables &tables)
+    {
+        const int b = bgr[0];
+        const int g = bgr[1];
+        const int r = bgr[2];
+        const int v = std::max(std::max(b, g), r);
+
+        if (v < threshold.value_min || v > threshold.value_max)
+        {
+            return 0;
+        }
+
+        const int diff = v - std::min(std::min(b, g), r);
+        const int s = (diff * tables.sdiv_table[v] + (1 << (k_hsv_shift - 1))) >> k_hsv_shift;
+
+        if (s < threshold.saturation_min || s > threshold.saturation_max)
+        {
+            return 0;
+        }
+
+        const int vr = (v == r) ? -1 : 0;
+        const int vg = (v == g) ? -1 : 0;
+        int h = (vr & (g - b)) + (~vr & ((vg & (b - r + 2 * diff)) + ((~vg) & (r - g + 4 * diff))));
+        h = (h * tables.hdiv_table[diff] + (1 << (k_hsv_shift - 1))) >> k_hsv_shift;
+        h += (h < 0) ? 180 : 0;
+
+        const bool bInHueRange =
+            (h >= threshold.hue_min[0] && h <= threshold.hue_max[0]) ||
+            (h >= threshold.hue_min[1] && h <= threshold.hue_max[1]);
+
+        return bInHueRange ? 255 : 0;
+    }
+};
+
+/// A horizontal run of set mask pixels, linked to the other runs of its blob (union-find)
+struct OpenCVBlobRun
+{
+    int row;
+    int start;
+    int end; // inclusive
+    int parent; // index of the parent run, the blob root is its own parent
+};
+
+/// Stats of a blob being labeled, accumulated on its root run
+struct OpenCVBlobStats
+{
+    int area;
+    double sum_x;
+    double sum_y;
+    int min_x, max_x;
+    int min_y, max_y;
+};
+
+/// Scratch buffers of the light bar fit, reused every frame
+struct OpenCVLightBarFitScratch
+{
+    t_opencv_float_contour contour; // source contour converted to float
+    t_opencv_float_contour undistortedContour;
+    t_opencv_float_contour hull; // convex hull of the undistorted contour
+    t_opencv_float_contour triangle; // minimum enclosing triangle of the hull
+};
+
+/// What a device's previous projection got computed from, see OpenCVBufferState::computeMotionGateDifference()
+struct OpenCVMotionGate
+{
+    cv::Rect2i region; // ROI the projection got searched in
+    cv::Mat thumbnail; // see OpenCVBufferState::computeMotionGateThumbnail()
+    int reused_frame_count; // frames the projection got reused for since
+    bool bIsValid;
+
+    OpenCVMotionGate()
+        : region()
+        , thumbnail()
+        , reused_frame_count(0)
+        , bIsValid(false)
+    {
+    }
+};
+
+/// Brightness of the tracked blobs since the auto exposure last looked, see OpenCVBufferState::accumulateExposureStats()
+struct OpenCVExposureStats
+{
+    int sample_count; // blob pixels sampled
+    int saturated_count; // of those, the clipped ones
+    double value_sum;
+
+    OpenCVExposureStats()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        sample_count = 0;
+        saturated_count = 0;
+        value_sum = 0.0;
+    }
+};
+
+/// The biggest blob found by OpenCVBufferState::computeBiggestBlob()
+struct OpenCVBlobInfo
+{
+    int pixel_area;
+    cv::Point2f centroid;
+    cv::Rect2i bounding_box;
+    t_opencv_int_contour boundary_samples; // run end points on the left and right boundary of the blob
+};
+
+/// A contour of OpenCVContourScratch::contours and its area
+struct OpenCVContourInfo
+{
+    int contour_index;
+    double contour_area;
+};
+
+/// Scratch containers of the contour searches and sphere, light bar and point cloud fits.
+/// They live as long as the tracker and only get cleared or resized each frame,
+/// so once their capacities settle a tracked frame doesn't touch the heap.
+/// Only the tracker's vision worker uses them, one projection job at a time.
+struct OpenCVContourScratch
+{
+    t_opencv_int_contour_list contours; // every contour cv::findContours() found
+    std::vector<OpenCVContourInfo> sortedContours; // by area, largest first
+    std::vector<cv::Rect2i> candidateRects; // reacquisition candidates, see computeReacquisitionCandidateROI()
+    t_opencv_int_contour_list biggestContours; // see computeBiggestNContours()
+    std::vector<double> contourAreas;
+    std::vector<cv::Point2f> contourCenters;
+    OpenCVBlobInfo biggestBlob; // see computeBiggestBlob()
+    t_opencv_int_contour convexContour; // hull of biggestBlob
+    t_opencv_float_contour convexContourF;
+    t_opencv_float_contour undistortedContour;
+    t_opencv_float_contour_list floatContours; // biggestContours converted to float
+};
+
+/// How OpenCVBufferState picks a device's blob out of the ones of the other devices sharing its tracking color
+struct OpenCVBlobSelection
+{
+    int candidate_count; // only this many of the biggest blobs are considered
+    bool bHasPredictedLocation;
+    cv::Point2f predicted_location; // raw image space, the candidate closest to it wins
+};
+
+/// One level of the downsampled frame pyramid used to reacquire lost devices
+struct ReacquisitionPyramidLevel
+{
+    cv::Mat bgr; // source frame downsampled by 2^(level+1)
+    cv::Mat labels; // per-pixel bitmask of the reacquisition colors each pixel matched
+    cv::Mat mask; // grayscale mask of the color currently being searched for
+    bool bBgrValid; // bgr was built from the current video frame
+    bool bLabelsValid; // labels were computed for the current video frame and reacquisition colors
+};
+
+class OpenCVBufferState
+{
+public:
+    OpenCVBufferState(ITrackerInterface *device, int tracker_id)
+        : traceTrackerID(tracker_id)
+        , bgrBuffer(nullptr)
+        , overlayBuffer(nullptr)
+        , bayerBuffer(nullptr)
+        , bgraBuffer(nullptr)
+        , bgrConvertedBuffer(nullptr)
+        , hsvBuffer(nullptr)
+        , gsLowerBuffer(nullptr)
+        , labelBuffer(nullptr)
+        , bUseOpenCL(false)
+        , bGpuHsvFrameValid(false)
+    {
+        device->getVideoFrameDimensions(&frameWidth, &frameHeight, nullptr);
+
+        const TrackerManagerConfig &cfg= DeviceManager::getInstance()->m_tracker_manager->getConfig();
+        bUseFusedHSVMask = cfg.use_fused_hsv_mask_kernel;
+        bUseBayerCellSearch = cfg.use_bayer_cell_search;
+        bCollectExposureStats = cfg.use_auto_exposure;
+
+        if (cfg.use_opencl_color_mask)
+        {
+            if (cv::ocl::haveOpenCL())
+            {
+                cv::ocl::setUseOpenCL(true);
+                bUseOpenCL = cv::ocl::useOpenCL();
+            }
+
+            if (!bUseOpenCL)
+            {
+                SERVER_LOG_WARNING("OpenCVBufferState") << "No OpenCL device available, computing the color masks on the CPU";
+            }
+        }
+
+        bgrBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
+        overlayBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC1, cv::Scalar(OverlayColor_None));
+        bDrawDebugOverlay = false;
+        bayerBuffer = new cv::Mat();
+        bHasRawBayerFrame = false;
+        bgraBuffer = new cv::Mat();
+        bHasNativeBGRAFrame = false;
+        convertedROICount = 0;
+        gsLowerBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC1);
+        labelBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC1);
+        controllerMotionGates.resize(DeviceManager::getInstance()->getControllerViewMaxCount());
+        hmdMotionGates.resize(DeviceManager::getInstance()->getHMDViewMaxCount());
+        clearColorSegmentation();
+        clearReacquisitionPyramid();
+
+        // The fused kernel writes the mask straight from the BGR buffer
+        if (!bUseFusedHSVMask)
+        {
+            hsvBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
+        }
+        
+        if (cfg.use_bgr_to_hsv_lookup_table && !bUseFusedHSVMask && !bUseOpenCL)
+        {
+            bgr2hsv = OpenCVBGRToHSVMapper::allocate(
+                cfg.use_quantized_bgr_to_hsv_lookup_table, cfg.cache_bgr_to_hsv_lookup_table);
+        }
+        else
+        {
+            bgr2hsv = nullptr;
+        }
+        
+        //Apply default ROI (full frame).
+        applyROI(cv::Rect2i(cv::Point(0,0), cv::Size(frameWidth, frameHeight)));
+    }
+
+    virtual ~OpenCVBufferState()
+    {
+        if (labelBuffer != nullptr)
+        {
+            delete labelBuffer;
+        }
+
+        if (gsLowerBuffer != nullptr)
+        {
+            delete gsLowerBuffer;
+        }
+        
+        if (hsvBuffer != nullptr)
+        {
+            delete hsvBuffer;
+        }
+        
+        if (overlayBuffer != nullptr)
+        {
+            delete overlayBuffer;
+        }
+
+        if (bgrConvertedBuffer != nullptr)
+        {
+            delete bgrConvertedBuffer;
+        }
+
+        if (bgraBuffer != nullptr)
+        {
+            delete bgraBuffer;
+        }
+
+        if (bayerBuffer != nullptr)
+        {
+            delete bayerBuffer;
+        }
+        
+        if (bgrBuffer != nullptr)
+        {
+            delete bgrBuffer;
+        }
+        
+        if (bgr2hsv != nullptr)
+        {
+            OpenCVBGRToHSVMapper::dispose(bgr2hsv);
+        }
+    }
+
+    // bPublishFrame: this frame (and its debug overlay) will be sent out on the shared memory video stream
+    // bytes_per_pixel/stride: layout of the tracker's buffer, see ITrackerInterface::getVideoFrameBufferLayout()
+    void writeVideoFrame(
+        const unsigned char *video_buffer,
+        const int bytes_per_pixel,
+        const int stride,
+        const bool bPublishFrame)
+    {
+        bHasRawBayerFrame = false;
+
+        if (bytes_per_pixel == 4)
+        {
+            // Native BGRA frame (CL Eye Multicam), referenced in place like a BGR frame.
+            // Only the ROIs we actually search get converted to BGR, see convertSourceROI().
+            *bgraBuffer = cv::Mat(frameHeight, frameWidth, CV_8UC4, const_cast<unsigned char *>(video_buffer), stride);
+            bHasNativeBGRAFrame = true;
+            convertedROICount = 0;
+
+            if (bgrConvertedBuffer == nullptr)
+            {
+                bgrConvertedBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
+            }
+            *bgrBuffer = *bgrConvertedBuffer;
+        }
+        else
+        {
+            // The tracker guarantees the frame buffer stays valid until its next poll,
+            // so the source frame just references it rather than taking a copy.
+            *bgrBuffer = cv::Mat(frameHeight, frameWidth, CV_8UC3, const_cast<unsigned char *>(video_buffer), stride);
+            bHasNativeBGRAFrame = false;
+        }
+
+        // Any color segmentation was for the previous frame
+        clearColorSegmentation();
+        clearReacquisitionPyramid();
+        bGpuHsvFrameValid = false;
+        beginDebugOverlay(bPublishFrame);
+
+        if (bPublishFrame && bHasNativeBGRAFrame)
+        {
+            convertSourceROI(cv::Rect2i(cv::Point(0, 0), cv::Size(frameWidth, frameHeight)));
+        }
+    }
+
+    // Only bother drawing debug info when someone is going to look at it
+    void beginDebugOverlay(const bool bDrawOverlay)
+    {
+        bDrawDebugOverlay = bDrawOverlay;
+
+        if (bDrawDebugOverlay)
+        {
+            overlayBuffer->setTo(cv::Scalar(OverlayColor_None));
+        }
+    }
+
+    // Cache a raw (GB pattern) Bayer frame.
+    // Nothing is demosaiced up front unless the full frame is being published on the video stream.
+    // Otherwise only the ROIs we actually search get converted, see convertSourceROI().
+    void writeRawBayerFrame(const unsigned char *bayer_buffer, const bool bPublishFrame)
+    {
+        *bayerBuffer = cv::Mat(frameHeight, frameWidth, CV_8UC1, const_cast<unsigned char *>(bayer_buffer));
+        bHasRawBayerFrame = true;
+        bHasNativeBGRAFrame = false;
+        convertedROICount = 0;
+
+        // The source frame can't reference the tracker's buffer in this mode,
+        // so it needs a buffer of our own to demosaic into
+        if (bgrConvertedBuffer == nullptr)
+        {
+            bgrConvertedBuffer = new cv::Mat(frameHeight, frameWidth, CV_8UC3);
+        }
+        *bgrBuffer = *bgrConvertedBuffer;
+
+        clearColorSegmentation();
+        clearReacquisitionPyramid();
+        bGpuHsvFrameValid = false;
+        beginDebugOverlay(bPublishFrame);
+
+        if (bPublishFrame)
+        {
+            convertSourceROI(cv::Rect2i(cv::Point(0, 0), cv::Size(frameWidth, frameHeight)));
+        }
+    }
+
+    // Make sure the given region of the BGR frame has been converted from the native BGRA frame
+    // or demosaiced from the raw Bayer frame
+    void convertSourceROI(const cv::Rect2i &ROI)
+    {
+        if (!bHasRawBayerFrame && !bHasNativeBGRAFrame)
+        {
+            return;
+        }
+
+        for (int region_index = 0; region_index < convertedROICount; ++region_index)
+        {
+            if ((ROI & convertedROIs[region_index]) == ROI)
+            {
+                return;
+            }
+        }
+
+        if (bHasNativeBGRAFrame)
+        {
+            // No neighborhood involved, so just drop the alpha channel of the pixels in the ROI
+            if (ROI.area() > 0)
+            {
+                cv::Mat bgrROIDest(*bgrBuffer, ROI);
+                cv::cvtColor(cv::Mat(*bgraBuffer, ROI), bgrROIDest, cv::COLOR_BGRA2BGR);
+            }
+
+            addConvertedROI(ROI);
+            return;
+        }
+
+        // Grow the region by a small border so that the bilinear demosaic
+        // of the pixels we care about doesn't use the edge approximation.
+        // The origin has to land on an even pixel to keep the same Bayer pattern phase.
+        const int k_demosaic_border = 2;
+        const int x0 = std::max(ROI.x - k_demosaic_border, 0) & ~1;
+        const int y0 = std::max(ROI.y - k_demosaic_border, 0) & ~1;
+        const int x1 = std::min(ROI.x + ROI.width + k_demosaic_border, frameWidth);
+        const int y1 = std::min(ROI.y + ROI.height + k_demosaic_border, frameHeight);
+        const cv::Rect2i demosaicRect(x0, y0, x1 - x0, y1 - y0);
+
+        if (demosaicRect.width >= 2 && demosaicRect.height >= 2)
+        {
+            SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_Debayer, -1, traceTrackerID);
+            cv::Mat bgrROIDest(*bgrBuffer, demosaicRect);
+            cv::cvtColor(cv::Mat(*bayerBuffer, demosaicRect), bgrROIDest, CV_BayerGB2BGR);
+        }
+
+        addConvertedROI(ROI);
+    }
+
+    void addConvertedROI(const cv::Rect2i &ROI)
+    {
+        // Once the list is full the latest region replaces the last one, which at worst converts it again
+        const int region_index = std::min(convertedROICount, k_max_search_regions - 1);
+
+        convertedROIs[region_index] = ROI;
+        convertedROICount = region_index + 1;
+    }
+
+    // OpenCL path: upload the source frame once per frame and demosaic + convert the whole thing to HSV on the GPU.
+    // The per color thresholds then only read back the mask of their ROI, see computeColorMask().
+    void updateGpuHsvFrame()
+    {
+        if (bGpuHsvFrameValid)
+        {
+            return;
+        }
+
+        if (bHasRawBayerFrame)
+        {
+            SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_Debayer, -1, traceTrackerID);
+            bayerBuffer->copyTo(gpuSourceFrame);
+            cv::cvtColor(gpuSourceFrame, gpuBgrFrame, CV_BayerGB2BGR);
+        }
+        else if (bHasNativeBGRAFrame)
+        {
+            bgraBuffer->copyTo(gpuSourceFrame);
+            cv::cvtColor(gpuSourceFrame, gpuBgrFrame, cv::COLOR_BGRA2BGR);
+        }
+        else
+        {
+            bgrBuffer->copyTo(gpuBgrFrame);
+        }
+
+        {
+            SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_HSV, -1, traceTrackerID);
+            cv::cvtColor(gpuBgrFrame, gpuHsvFrame, cv::COLOR_BGR2HSV);
+        }
+
+        if (gpuLowerMask.size() != gpuHsvFrame.size())
+        {
+            gpuLowerMask.create(gpuHsvFrame.size(), CV_8UC1);
+            gpuUpperMask.create(gpuHsvFrame.size(), CV_8UC1);
+        }
+
+        bGpuHsvFrameValid = true;
+    }
+
+    void clearColorSegmentation()
+    {
+        segmentedColorMask = 0;
+        segmentationROICount = 0;
+    }
+
+    // Classify every pixel in the regions against all of the given color ranges in a single pass.
+    // computeBiggestNContours() then only has to pick out the label bit for its color
+    // rather than re-thresholding the ROI for every tracked device.
+    // The regions shouldn't overlap, see ServerTrackerView::planSearchRegions().
+    void segmentColors(
+        const cv::Rect2i *ROIs,
+        const int roi_count,
+        const eCommonTrackingColorID *color_ids,
+        const CommonHSVColorRange *color_ranges,
+        const int color_count)
+    {
+        OpenCVFusedHSVMaskKernel::Threshold thresholds[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+        uint8_t threshold_bits[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+        int threshold_count = 0;
+        uint8_t color_mask = 0;
+
+        // The OpenCL path thresholds each color on the GPU instead of labeling on the CPU
+        if (bUseOpenCL)
+        {
+            clearColorSegmentation();
+            return;
+        }
+
+        for (int color_index = 0; color_index < color_count; ++color_index)
+        {
+            const eCommonTrackingColorID color_id = color_ids[color_index];
+
+            if (color_id >= 0 && color_id < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES &&
+                threshold_count < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)
+            {
+                OpenCVFusedHSVMaskKernel::computeThreshold(color_ranges[color_index], thresholds[threshold_count]);
+                threshold_bits[threshold_count] = getColorLabelBit(color_id);
+                color_mask |= threshold_bits[threshold_count];
+                ++threshold_count;
+            }
+        }
+
+        if (threshold_count > 0 && roi_count > 0)
+        {
+            segmentationROICount = std::min(roi_count, k_max_search_regions);
+
+            for (int region_index = 0; region_index < segmentationROICount; ++region_index)
+            {
+                const cv::Rect2i segmentationROI = clampROI(ROIs[region_index]);
+
+                segmentationROIs[region_index] = segmentationROI;
+                convertSourceROI(segmentationROI);
+
+                SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_HSV, -1, traceTrackerID);
+                cv::Mat labelROI(*labelBuffer, segmentationROI);
+                OpenCVFusedHSVMaskKernel::classify(
+                    cv::Mat(*bgrBuffer, segmentationROI),
+                    thresholds, threshold_bits, threshold_count,
+                    labelROI);
+            }
+
+            segmentedColorMask = color_mask;
+        }
+        else
+        {
+            clearColorSegmentation();
+        }
+    }
+
+    static uint8_t getColorLabelBit(const eCommonTrackingColorID color_id)
+    {
+        static_assert(eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES <= 8, "Color labels must fit in 8 bits");
+        return static_cast<uint8_t>(1 << static_cast<int>(color_id));
+    }
+    
+    void updateHsvBuffer()
+    {
+        // Convert the video buffer to the HSV color space
+        if (bUseFusedHSVMask)
+        {
+            // Nothing to do, HSV conversion happens while computing the mask
+        }
+        else if (bgr2hsv != nullptr)
+        {
+            bgr2hsv->cvtColor(bgrROI, hsvROI);
+        }
+        else
+        {
+            cv::cvtColor(bgrROI, hsvROI, cv::COLOR_BGR2HSV);
+        }
+    }
+    
+    cv::Rect2i clampROI(cv::Rect2i ROI) const
+    {
+        // Make sure the ROI box is always clamped in bounds of the frame buffer
+        int x0= std::min(std::max(ROI.tl().x, 0), frameWidth-1);
+        int y0= std::min(std::max(ROI.tl().y, 0), frameHeight-1);
+        int x1= std::min(std::max(ROI.br().x, 0), frameWidth-1);
+        int y1= std::min(std::max(ROI.br().y, 0), frameHeight-1);
+        int clamped_width = std::max(x1-x0, 0);
+        int clamped_height = std::max(y1-y0, 0);
+
+        // If the clamped ROI ends up being zero-width or zero-height, 
+        // just make it full screen
+        if (clamped_width > 0 && clamped_height > 0)
+        {
+            ROI.x= x0;
+            ROI.y= y0;
+            ROI.width = clamped_width;
+            ROI.height = clamped_height;
+        }
+        else
+        {
+            ROI.x= 0;
+            ROI.y= 0;
+            ROI.width = frameWidth;
+            ROI.height = frameHeight;
+        }
+
+        return ROI;
+    }
+
+    void applyROI(cv::Rect2i ROI)
+    {
+        ROI = clampROI(ROI);
+        currentROI = ROI;
+        convertSourceROI(ROI);
+       
+        //Create the ROI matrices.
+        //It's not a full copy, so this isn't too slow.
+        //adjustROI is probably slightly faster but I ran into trouble with it.
+        bgrROI = cv::Mat(*bgrBuffer, ROI);
+        gsLowerROI = cv::Mat(*gsLowerBuffer, ROI);
+        if (!bUseFusedHSVMask)
+        {
+            hsvROI = cv::Mat(*hsvBuffer, ROI);
+        }
+        
+        //Draw ROI.
+        if (bDrawDebugOverlay)
+        {
+            cv::rectangle(*overlayBuffer, ROI, cv::Scalar(OverlayColor_Blue));
+        }
+    }
+
+    void clearReacquisitionPyramid()
+    {
+        for (int level = 0; level < k_max_reacquisition_pyramid_levels; ++level)
+        {
+            reacquisitionPyramid[level].bBgrValid = false;
+            reacquisitionPyramid[level].bLabelsValid = false;
+        }
+
+        reacquisitionThresholdCount = 0;
+        reacquisitionColorMask = 0;
+    }
+
+    // Set the colors of the devices that will be searched for in the reacquisition pyramid this frame.
+    // Each pyramid level is labeled against all of them in one pass the first time it gets searched.
+    void setReacquisitionColors(
+        const eCommonTrackingColorID *color_ids,
+        const CommonHSVColorRange *color_ranges,
+        const int color_count)
+    {
+        reacquisitionThresholdCount = 0;
+        reacquisitionColorMask = 0;
+
+        for (int color_index = 0; color_index < color_count; ++color_index)
+        {
+            const eCommonTrackingColorID color_id = color_ids[color_index];
+
+            if (color_id >= 0 && color_id < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES &&
+                reacquisitionThresholdCount < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)
+            {
+                OpenCVFusedHSVMaskKernel::computeThreshold(color_ranges[color_index], reacquisitionThresholds[reacquisitionThresholdCount]);
+                reacquisitionThresholdBits[reacquisitionThresholdCount] = getColorLabelBit(color_id);
+                reacquisitionColorMask |= reacquisitionThresholdBits[reacquisitionThresholdCount];
+                ++reacquisitionThresholdCount;
+            }
+        }
+
+        for (int level = 0; level < k_max_reacquisition_pyramid_levels; ++level)
+        {
+            reacquisitionPyramid[level].bLabelsValid = false;
+        }
+    }
+
+    // Downsampled copy of the source frame for the given pyramid level, built on first use each frame
+    const cv::Mat &getReacquisitionLevelBgr(const int level)
+    {
+        ReacquisitionPyramidLevel &pyramidLevel = reacquisitionPyramid[level];
+
+        if (!pyramidLevel.bBgrValid)
+        {
+            const cv::Mat *sourceBuffer = nullptr;
+
+            if (level > 0)
+            {
+                sourceBuffer = &getReacquisitionLevelBgr(level - 1);
+            }
+            else if (bHasRawBayerFrame && bUseBayerCellSearch)
+            {
+                // Every 2x2 Bayer cell already has all three colors in it, no demosaic needed
+                SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_Debayer, -1, traceTrackerID);
+                computeBayerCellFrame(*bayerBuffer, pyramidLevel.bgr);
+                pyramidLevel.bBgrValid = true;
+
+                return pyramidLevel.bgr;
+            }
+            else
+            {
+                // The whole frame gets sampled, so a raw Bayer frame has to be fully demosaiced first
+                convertSourceROI(cv::Rect2i(cv::Point(0, 0), cv::Size(frameWidth, frameHeight)));
+                sourceBuffer = bgrBuffer;
+            }
+
+            // Nearest neighbor keeps the blob colors intact rather than blending them with the background
+            cv::resize(
+                *sourceBuffer, pyramidLevel.bgr, 
+                cv::Size(sourceBuffer->cols / 2, sourceBuffer->rows / 2), 
+                0, 0, cv::INTER_NEAREST);
+            pyramidLevel.bBgrValid = true;
+        }
+
+        return pyramidLevel.bgr;
+    }
+
+    // Half resolution BGR image of a GB pattern raw Bayer frame (see CV_BayerGB2BGR), one pixel per 2x2 cell:
+    // even rows are G R G R ..., odd rows B G B G ..., so each cell holds a red, a blue and two green samples.
+    // Same size as pyramid level 0, so the coarse search needs no full resolution demosaic at all.
+    static void computeBayerCellFrame(const cv::Mat &bayerFrame, cv::Mat &out_bgr)
+    {
+        const int cellColumns = bayerFrame.cols / 2;
+        const int cellRows = bayerFrame.rows / 2;
+
+        out_bgr.create(cellRows, cellColumns, CV_8UC3);
+
+        for (int cellRow = 0; cellRow < cellRows; ++cellRow)
+        {
+            const uint8_t *gr_row = bayerFrame.ptr<uint8_t>(2*cellRow);
+            const uint8_t *bg_row = bayerFrame.ptr<uint8_t>(2*cellRow + 1);
+            uint8_t *bgr_row = out_bgr.ptr<uint8_t>(cellRow);
+
+            for (int cellColumn = 0; cellColumn < cellColumns; ++cellColumn)
+            {
+                const int x = 2*cellColumn;
+
+                bgr_row[0] = bg_row[x];
+                bgr_row[1] = static_cast<uint8_t>((gr_row[x] + bg_row[x + 1] + 1) >> 1);
+                bgr_row[2] = gr_row[x + 1];
+                bgr_row += 3;
+            }
+        }
+    }
+
+    // Search the reacquisition pyramid for the given color, coarsest level first, and return
+    // the full resolution region around the biggest blobs found at the first level that has any.
+    // Used to reacquire a device we lost track of without thresholding the full frame.
+    // Blobs less than 2^pyramid_levels pixels across can be missed at the coarsest level,
+    // which is why the finer levels are searched next.
+    bool computeReacquisitionROI(
+        const eCommonTrackingColorID tracked_color_id,
+        const CommonHSVColorRange &hsvColorRange,
+        const int pyramid_levels,
+        const int max_blob_count,
+        cv::Rect2i &out_ROI)
+    {
+        const int level_count = std::min(pyramid_levels, k_max_reacquisition_pyramid_levels);
+
+        // Use the shared labels if this color was registered for this frame's reacquisition pass
+        const bool bIsColorLabeled = 
+            tracked_color_id >= 0 && tracked_color_id < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES &&
+            (reacquisitionColorMask & getColorLabelBit(tracked_color_id)) != 0;
+
+        for (int level = level_count - 1; level >= 0; --level)
+        {
+            const int downsample_factor = 2 << level;
+
+            if (frameWidth < downsample_factor || frameHeight < downsample_factor)
+            {
+                continue;
+            }
+
+            ReacquisitionPyramidLevel &pyramidLevel = reacquisitionPyramid[level];
+            const cv::Mat &levelBgr = getReacquisitionLevelBgr(level);
+
+            if (pyramidLevel.mask.size() != levelBgr.size())
+            {
+                pyramidLevel.mask.create(levelBgr.size(), CV_8UC1);
+            }
+
+            if (bIsColorLabeled)
+            {
+                if (!pyramidLevel.bLabelsValid)
+                {
+                    if (pyramidLevel.labels.size() != levelBgr.size())
+                    {
+                        pyramidLevel.labels.create(levelBgr.size(), CV_8UC1);
+                    }
+
+                    OpenCVFusedHSVMaskKernel::classify(
+                        levelBgr, 
+                        reacquisitionThresholds, reacquisitionThresholdBits, reacquisitionThresholdCount,
+                        pyramidLevel.labels);
+                    pyramidLevel.bLabelsValid = true;
+                }
+
+                cv::bitwise_and(pyramidLevel.labels, cv::Scalar(getColorLabelBit(tracked_color_id)), pyramidLevel.mask);
+            }
+            else
+            {
+                OpenCVFusedHSVMaskKernel::Threshold threshold;
+
+                OpenCVFusedHSVMaskKernel::computeThreshold(hsvColorRange, threshold);
+                OpenCVFusedHSVMaskKernel::apply(levelBgr, threshold, pyramidLevel.mask);
+            }
+
+            if (computeReacquisitionCandidateROI(pyramidLevel.mask, downsample_factor, max_blob_count, out_ROI))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Full resolution region around the biggest blobs in a pyramid level mask
+    bool computeReacquisitionCandidateROI(
+        cv::Mat &levelMask,
+        const int downsample_factor,
+        const int max_blob_count,
+        cv::Rect2i &out_ROI)
+    {
+        t_opencv_int_contour_list &contours = contourScratch.contours;
+        cv::findContours(levelMask, contours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_SIMPLE);
+
+        // Blobs that are only a pixel or two across at this scale have no contour area,
+        // so rank the candidates by their bounding box instead
+        std::vector<cv::Rect2i> &candidate_rects = contourScratch.candidateRects;
+        candidate_rects.clear();
+        for (const t_opencv_int_contour &contour : contours)
+        {
+            candidate_rects.push_back(cv::boundingRect(contour));
+        }
+
+        std::sort(
+            candidate_rects.begin(), candidate_rects.end(), 
+            [](const cv::Rect2i &a, const cv::Rect2i &b) {
+                return b.area() < a.area();
+        });
+
+        const int candidate_count = std::min(static_cast<int>(candidate_rects.size()), max_blob_count);
+        if (candidate_count <= 0)
+        {
+            return false;
+        }
+
+        cv::Rect2i coarseROI = candidate_rects[0];
+        for (int candidate_index = 1; candidate_index < candidate_count; ++candidate_index)
+        {
+            coarseROI |= candidate_rects[candidate_index];
+        }
+
+        // Scale back up to full resolution and pad by a coarse pixel plus the usual minimum ROI margin
+        // so that the edges of the blobs (which may have failed the threshold at this scale) get searched too.
+        // Only this region gets refined at full resolution.
+        const int padding = downsample_factor + computeMinROISize(frameWidth) / 2;
+        out_ROI = clampROI(cv::Rect2i(
+            coarseROI.x*downsample_factor - padding,
+            coarseROI.y*downsample_factor - padding,
+            coarseROI.width*downsample_factor + 2*padding,
+            coarseROI.height*downsample_factor + 2*padding));
+
+        return true;
+    }
+
+    // Threshold the current ROI by the given color into gsLowerROI
+    void computeColorMask(
+        const eCommonTrackingColorID tracked_color_id,
+        const CommonHSVColorRange &hsvColorRange)
+    {
+        SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_HSV, -1, traceTrackerID);
+
+        // Use the label image if this color was part of this frame's segmentation pass
+        bool bIsColorSegmented = false;
+        if (tracked_color_id >= 0 && tracked_color_id < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES &&
+            (segmentedColorMask & getColorLabelBit(tracked_color_id)) != 0)
+        {
+            for (int region_index = 0; !bIsColorSegmented && region_index < segmentationROICount; ++region_index)
+            {
+                bIsColorSegmented = (currentROI & segmentationROIs[region_index]) == currentROI;
+            }
+        }
+
+        if (bIsColorSegmented)
+        {
+            const cv::Mat labelROI(*labelBuffer, currentROI);
+
+            cv::bitwise_and(labelROI, cv::Scalar(getColorLabelBit(tracked_color_id)), gsLowerROI);
+        }
+        // Threshold the ROI of the HSV frame on the GPU, only the mask comes back
+        else if (bUseOpenCL)
+        {
+            updateGpuHsvFrame();
+
+            cv::UMat gpuLowerROI(gpuLowerMask, currentROI);
+            cv::UMat gpuUpperROI(gpuUpperMask, currentROI);
+
+            thresholdHSVRange(cv::UMat(gpuHsvFrame, currentROI), hsvColorRange, gpuLowerROI, gpuUpperROI);
+            gpuLowerROI.copyTo(gsLowerROI);
+        }
+        // Compute the HSV mask for the ROI in one pass
+        else if (bUseFusedHSVMask)
+        {
+            OpenCVFusedHSVMaskKernel::Threshold threshold;
+
+            OpenCVFusedHSVMaskKernel::computeThreshold(hsvColorRange, threshold);
+            OpenCVFusedHSVMaskKernel::apply(bgrROI, threshold, gsLowerROI);
+        }
+        // Clamp the HSV image, taking into account wrapping the hue angle
+        else
+        {
+            updateHsvBuffer();
+            thresholdHSVRange(hsvROI, hsvColorRange, gsLowerROI, getUpperMaskROI());
+        }
+    }
+
+    // Only colors whose hue range wraps around 0 need a second mask.
+    // Its buffer grows to the largest ROI searched for one of them instead of taking up a full frame per tracker.
+    cv::Mat &getUpperMaskROI()
+    {
+        if (gsUpperBuffer.rows < currentROI.height || gsUpperBuffer.cols < currentROI.width)
+        {
+            gsUpperBuffer.create(
+                std::max(gsUpperBuffer.rows, currentROI.height),
+                std::max(gsUpperBuffer.cols, currentROI.width),
+                CV_8UC1);
+        }
+
+        gsUpperROI = cv::Mat(gsUpperBuffer, cv::Rect2i(0, 0, currentROI.width, currentROI.height));
+        return gsUpperROI;
+    }
+
+    // Bytes of the buffers this state allocated itself.
+    // Frames that reference the tracker's capture buffer don't count, and neither does the shared BGR->HSV table.
+    size_t getAllocatedBytes() const
+    {
+        size_t bytes =
+            getMatAllocatedBytes(bgrBuffer) +
+            getMatAllocatedBytes(overlayBuffer) +
+            getMatAllocatedBytes(bayerBuffer) +
+            getMatAllocatedBytes(bgraBuffer) +
+            getMatAllocatedBytes(bgrConvertedBuffer) +
+            getMatAllocatedBytes(hsvBuffer) +
+            getMatAllocatedBytes(gsLowerBuffer) +
+            getMatAllocatedBytes(&gsUpperBuffer) +
+            getMatAllocatedBytes(labelBuffer) +
+            getMatAllocatedBytes(&motionGateScratch);
+
+        for (int level = 0; level < k_max_reacquisition_pyramid_levels; ++level)
+        {
+            bytes +=
+                getMatAllocatedBytes(&reacquisitionPyramid[level].bgr) +
+                getMatAllocatedBytes(&reacquisitionPyramid[level].labels) +
+                getMatAllocatedBytes(&reacquisitionPyramid[level].mask);
+        }
+
+        return bytes;
+    }
+
+    static size_t getMatAllocatedBytes(const cv::Mat *mat)
+    {
+        // Headers onto memory the Mat doesn't own have no UMatData
+        return (mat != nullptr && mat->u != nullptr) ? mat->u->size : 0;
+    }
+
+    // Mask of the pixels of an HSV image inside the given color range, taking into account wrapping the hue angle.
+    // Works on cv::Mat and, for the OpenCL path, cv::UMat images alike.
+    template <class t_image>
+    static void thresholdHSVRange(
+        const t_image &hsvImage,
+        const CommonHSVColorRange &hsvColorRange,
+        t_image &lowerMask,
+        t_image &upperMask)
+    {
+        const float hue_min = hsvColorRange.hue_range.center - hsvColorRange.hue_range.range;
+        const float hue_max = hsvColorRange.hue_range.center + hsvColorRange.hue_range.range;
+        const float saturation_min = clampf(hsvColorRange.saturation_range.center - hsvColorRange.saturation_range.range, 0, 255);
+        const float saturation_max = clampf(hsvColorRange.saturation_range.center + hsvColorRange.saturation_range.range, 0, 255);
+        const float value_min = clampf(hsvColorRange.value_range.center - hsvColorRange.value_range.range, 0, 255);
+        const float value_max = clampf(hsvColorRange.value_range.center + hsvColorRange.value_range.range, 0, 255);
+
+        if (hue_min < 0)
+        {
+            cv::inRange(
+                hsvImage,
+                cv::Scalar(0, saturation_min, value_min),
+                cv::Scalar(clampf(hue_max, 0, 180), saturation_max, value_max),
+                lowerMask);
+            cv::inRange(
+                hsvImage,
+                cv::Scalar(clampf(180 + hue_min, 0, 180), saturation_min, value_min),
+                cv::Scalar(180, saturation_max, value_max),
+                upperMask);
+            cv::bitwise_or(lowerMask, upperMask, lowerMask);
+        }
+        else if (hue_max > 180)
+        {
+            cv::inRange(
+                hsvImage,
+                cv::Scalar(0, saturation_min, value_min),
+                cv::Scalar(clampf(hue_max - 180, 0, 180), saturation_max, value_max),
+                lowerMask);
+            cv::inRange(
+                hsvImage,
+                cv::Scalar(clampf(hue_min, 0, 180), saturation_min, value_min),
+                cv::Scalar(180, saturation_max, value_max),
+                upperMask);
+            cv::bitwise_or(lowerMask, upperMask, lowerMask);
+        }
+        else
+        {
+            cv::inRange(
+                hsvImage,
+                cv::Scalar(hue_min, saturation_min, value_min),
+                cv::Scalar(hue_max, saturation_max, value_max),
+                lowerMask);
+        }
+    }
+
+    // Pick the color range of a lit LED from the hue, saturation and value histograms of the ROI.
+    // Only bright, saturated pixels within k_color_histogram_hue_search_range of the search hue count.
+    // The hue range is the narrowest window around the hue histogram peak that covers most of them,
+    // the saturation and value ranges span most of the pixels inside that hue window.
+    // Returns false if too few pixels look like the LED.
+    bool computeColorRangeFromHistogram(
+        const cv::Rect2i &searchROI,
+        const float search_hue,
+        CommonHSVColorRange &out_range)
+    {
+        SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_HSV, -1, traceTrackerID);
+
+        const cv::Rect2i ROI = clampROI(searchROI);
+        convertSourceROI(ROI);
+
+        // Doesn't run every frame, so just convert a copy of the ROI
+        cv::Mat hsvPixels;
+        cv::cvtColor(cv::Mat(*bgrBuffer, ROI), hsvPixels, cv::COLOR_BGR2HSV);
+
+        const int search_center_hue = wrapHue(static_cast<int>(search_hue + 0.5f));
+        int hue_histogram[k_hue_bin_count] = { 0 };
+        int candidate_count = 0;
+
+        for (int row = 0; row < hsvPixels.rows; ++row)
+        {
+            const uint8_t *hsv = hsvPixels.ptr<uint8_t>(row);
+
+            for (int col = 0; col < hsvPixels.cols; ++col, hsv += 3)
+            {
+                if (hsv[1] >= k_color_histogram_min_saturation &&
+                    hsv[2] >= k_color_histogram_min_value &&
+                    getHueDistance(hsv[0], search_center_hue) <= k_color_histogram_hue_search_range)
+                {
+                    ++hue_histogram[hsv[0]];
+                    ++candidate_count;
+                }
+            }
+        }
+
+        if (candidate_count < k_color_histogram_min_pixel_count)
+        {
+            return false;
+        }
+
+        // The peak of the (3 bin smoothed) hue histogram is the hue of the LED
+        int peak_hue = search_center_hue;
+        int peak_count = -1;
+        for (int offset = -k_color_histogram_hue_search_range; offset <= k_color_histogram_hue_search_range; ++offset)
+        {
+            const int hue = wrapHue(search_center_hue + offset);
+            const int count = hue_histogram[wrapHue(hue - 1)] + hue_histogram[hue] + hue_histogram[wrapHue(hue + 1)];
+
+            if (count > peak_count)
+            {
+                peak_hue = hue;
+                peak_count = count;
+            }
+        }
+
+        // Grow the hue window around the peak until it covers most of the candidates.
+        // Every candidate is within twice the search range of the peak.
+        const int target_count = static_cast<int>(ceilf(k_color_histogram_coverage*static_cast<float>(candidate_count)));
+        int hue_range = 0;
+        int window_count = hue_histogram[peak_hue];
+        while (window_count < target_count && hue_range < 2*k_color_histogram_hue_search_range)
+        {
+            ++hue_range;
+            window_count += hue_histogram[wrapHue(peak_hue - hue_range)] + hue_histogram[wrapHue(peak_hue + hue_range)];
+        }
+        hue_range = std::max(hue_range, k_color_histogram_min_hue_range);
+
+        int saturation_histogram[256] = { 0 };
+        int value_histogram[256] = { 0 };
+        int window_pixel_count = 0;
+
+        for (int row = 0; row < hsvPixels.rows; ++row)
+        {
+            const uint8_t *hsv = hsvPixels.ptr<uint8_t>(row);
+
+            for (int col = 0; col < hsvPixels.cols; ++col, hsv += 3)
+            {
+                if (hsv[1] >= k_color_histogram_min_saturation &&
+                    hsv[2] >= k_color_histogram_min_value &&
+                    getHueDistance(hsv[0], peak_hue) <= hue_range)
+                {
+                    ++saturation_histogram[hsv[1]];
+                    ++value_histogram[hsv[2]];
+                    ++window_pixel_count;
+                }
+            }
+        }
+
+        out_range.hue_range.center = static_cast<float>(peak_hue);
+        out_range.hue_range.range = static_cast<float>(hue_range);
+        computeHistogramRange(saturation_histogram, window_pixel_count, out_range.saturation_range);
+        computeHistogramRange(value_histogram, window_pixel_count, out_range.value_range);
+
+        return true;
+    }
+
+    // OpenCV hue is in [0, 180)
+    static const int k_hue_bin_count = 180;
+
+    static int wrapHue(const int hue)
+    {
+        return ((hue % k_hue_bin_count) + k_hue_bin_count) % k_hue_bin_count;
+    }
+
+    static int getHueDistance(const int hue, const int other_hue)
+    {
+        const int distance = std::abs(hue - other_hue) % k_hue_bin_count;
+
+        return std::min(distance, k_hue_bin_count - distance);
+    }
+
+    // Range from the low end of the 8-bit histogram, skipping the few dimmest or least saturated pixels
+    // (where the LED blends into the background), up to the highest populated bin
+    static void computeHistogramRange(const int *histogram, const int total_count, CommonDeviceRange &out_range)
+    {
+        const int skip_count = static_cast<int>((1.f - k_color_histogram_coverage)*static_cast<float>(total_count));
+
+        int low = 0;
+        int accumulated_count = histogram[0];
+        while (accumulated_count <= skip_count && low < 255)
+        {
+            ++low;
+            accumulated_count += histogram[low];
+        }
+
+        int high = 255;
+        while (histogram[high] == 0 && high > low)
+        {
+            --high;
+        }
+
+        out_range.center = static_cast<float>(low + high) / 2.f;
+        out_range.range = std::max(static_cast<float>(high - low) / 2.f, k_color_histogram_min_range);
+    }
+
+    // Downsampled copy of the green channel of the given region of the current frame.
+    // Raw Bayer frames get sampled straight from the green pixels, so nothing needs to be demosaiced.
+    void computeMotionGateThumbnail(const cv::Rect2i &region, cv::Mat &out_thumbnail) const
+    {
+        const int sample_step =
+            (std::max(k_motion_gate_min_sample_step,
+                      (region.width + k_motion_gate_max_thumbnail_width - 1) / k_motion_gate_max_thumbnail_width) + 1) & ~1;
+        // Even origin: (even, even) is a green pixel of the GB pattern
+        const int x0 = region.x & ~1;
+        const int y0 = region.y & ~1;
+        const int columns = std::max((region.x + region.width - x0 + sample_step - 1) / sample_step, 1);
+        const int rows = std::max((region.y + region.height - y0 + sample_step - 1) / sample_step, 1);
+        const cv::Mat &source = bHasRawBayerFrame ? *bayerBuffer : bHasNativeBGRAFrame ? *bgraBuffer : *bgrBuffer;
+        const int pixel_size = bHasRawBayerFrame ? 1 : bHasNativeBGRAFrame ? 4 : 3;
+        const int green_offset = bHasRawBayerFrame ? 0 : 1;
+
+        out_thumbnail.create(rows, columns, CV_8UC1);
+
+        for (int row = 0; row < rows; ++row)
+        {
+            const unsigned char *source_row = source.ptr<unsigned char>(y0 + row*sample_step);
+            unsigned char *thumbnail_row = out_thumbnail.ptr<unsigned char>(row);
+
+            for (int column = 0; column < columns; ++column)
+            {
+                thumbnail_row[column] = source_row[(x0 + column*sample_step)*pixel_size + green_offset];
+            }
+        }
+    }
+
+    // Mean absolute difference between the gate's region of the current frame and its thumbnail
+    float computeMotionGateDifference(const OpenCVMotionGate &gate)
+    {
+        computeMotionGateThumbnail(gate.region, motionGateScratch);
+
+        return static_cast<float>(
+            cv::norm(motionGateScratch, gate.thumbnail, cv::NORM_L1) / static_cast<double>(motionGateScratch.total()));
+    }
+
+    // Gate of the given controller or HMD, or nullptr if the device id is out of range
+    OpenCVMotionGate *getMotionGate(const bool bIsHMD, const int device_id)
+    {
+        std::vector<OpenCVMotionGate> &gates = bIsHMD ? hmdMotionGates : controllerMotionGates;
+
+        return ServerUtility::is_index_valid(device_id, static_cast<int>(gates.size())) ? &gates[device_id] : nullptr;
+    }
+
+    // Find the biggest 8-connected blob of the given color in the current ROI.
+    // The mask is labeled a run of pixels at a time in a single pass, collecting the
+    // area, centroid and bounding box of every blob as it goes, so unlike computeBiggestNContours()
+    // no contours get traced. The boundary samples are the end points of the blob's runs
+    // on up to max_boundary_samples/2 evenly spaced rows, which is all a convex hull fit needs.
+    // Returns points in raw image space, like computeBiggestNContours().
+    bool computeBiggestBlob(
+        const eCommonTrackingColorID tracked_color_id,
+        const CommonHSVColorRange &hsvColorRange,
+        OpenCVBlobInfo &out_blob,
+        const OpenCVBlobSelection *selection = nullptr,
+        const int max_boundary_samples = k_max_blob_boundary_samples,
+        const int min_boundary_samples = 6)
+    {
+        computeColorMask(tracked_color_id, hsvColorRange);
+        SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_Contour, -1, traceTrackerID);
+
+        // Extract the runs of set pixels from each row,
+        // merging each one with the runs it touches on the row above
+        blobRuns.clear();
+        int prev_row_begin = 0;
+        int prev_row_end = 0;
+        for (int row = 0; row < gsLowerROI.rows; ++row)
+        {
+            const uint8_t *mask = gsLowerROI.ptr<uint8_t>(row);
+            const int row_begin = static_cast<int>(blobRuns.size());
+            int prev_index = prev_row_begin;
+            int col = 0;
+
+            while (col < gsLowerROI.cols)
+            {
+                if (mask[col] == 0)
+                {
+                    ++col;
+                    continue;
+                }
+
+                OpenCVBlobRun run;
+                run.row = row;
+                run.start = col;
+                while (col < gsLowerROI.cols && mask[col] != 0)
+                {
+                    ++col;
+                }
+                run.end = col - 1;
+                run.parent = static_cast<int>(blobRuns.size());
+                blobRuns.push_back(run);
+
+                // Diagonal neighbors count as touching
+                while (prev_index < prev_row_end && blobRuns[prev_index].end < run.start - 1)
+                {
+                    ++prev_index;
+                }
+                for (int other_index = prev_index; 
+                     other_index < prev_row_end && blobRuns[other_index].start <= run.end + 1; 
+                     ++other_index)
+                {
+                    mergeBlobRuns(run.parent, other_index);
+                }
+            }
+
+            prev_row_begin = row_begin;
+            prev_row_end = static_cast<int>(blobRuns.size());
+        }
+
+        const int run_count = static_cast<int>(blobRuns.size());
+        if (run_count == 0)
+        {
+            return false;
+        }
+
+        // Accumulate the stats of each blob on its root run
+        blobStats.resize(run_count);
+        for (int run_index = 0; run_index < run_count; ++run_index)
+        {
+            OpenCVBlobStats &stats = blobStats[run_index];
+
+            stats.area = 0;
+            stats.sum_x = 0.0;
+            stats.sum_y = 0.0;
+        }
+
+        int best_root = -1;
+        for (int run_index = 0; run_index < run_count; ++run_index)
+        {
+            const OpenCVBlobRun &run = blobRuns[run_index];
+            const int root = findBlobRoot(run_index);
+            OpenCVBlobStats &stats = blobStats[root];
+            const int run_length = run.end - run.start + 1;
+
+            if (stats.area == 0)
+            {
+                stats.min_x = run.start;
+                stats.max_x = run.end;
+                stats.min_y = run.row;
+                stats.max_y = run.row;
+            }
+            else
+            {
+                stats.min_x = std::min(stats.min_x, run.start);
+                stats.max_x = std::max(stats.max_x, run.end);
+                stats.max_y = std::max(stats.max_y, run.row);
+            }
+
+            stats.area += run_length;
+            stats.sum_x += 0.5 * static_cast<double>(run.start + run.end) * static_cast<double>(run_length);
+            stats.sum_y += static_cast<double>(run.row) * static_cast<double>(run_length);
+
+            if (best_root < 0 || stats.area > blobStats[best_root].area)
+            {
+                best_root = root;
+            }
+        }
+
+        // With a shared tracking color the device's blob is one of the few biggest ones
+        if (selection != nullptr && selection->candidate_count > 1)
+        {
+            blobCandidateRoots.clear();
+            for (int run_index = 0; run_index < run_count; ++run_index)
+            {
+                if (findBlobRoot(run_index) == run_index)
+                {
+                    blobCandidateRoots.push_back(run_index);
+                }
+            }
+
+            const int candidate_count = std::min(selection->candidate_count, static_cast<int>(blobCandidateRoots.size()));
+            std::partial_sort(
+                blobCandidateRoots.begin(), blobCandidateRoots.begin() + candidate_count, blobCandidateRoots.end(),
+                [this](int a, int b) { return blobStats[a].area > blobStats[b].area; });
+            blobCandidateRoots.resize(candidate_count);
+
+            blobCandidateCenters.clear();
+            for (int root : blobCandidateRoots)
+            {
+                const OpenCVBlobStats &stats = blobStats[root];
+
+                blobCandidateCenters.push_back(cv::Point2f(
+                    static_cast<float>(stats.sum_x / stats.area) + currentROI.x,
+                    static_cast<float>(stats.sum_y / stats.area) + currentROI.y));
+            }
+
+            const int candidate_index = selectBlobCandidate(tracked_color_id, *selection, blobCandidateCenters);
+            if (candidate_index < 0)
+            {
+                return false;
+            }
+
+            best_root = blobCandidateRoots[candidate_index];
+        }
+
+        // Sample the boundary of the biggest blob
+        const OpenCVBlobStats &best_stats = blobStats[best_root];
+        const int blob_height = best_stats.max_y - best_stats.min_y + 1;
+        const int max_sample_rows = std::max(max_boundary_samples / 2, 2);
+        const int row_step = std::max((blob_height + max_sample_rows - 1) / max_sample_rows, 1);
+
+        out_blob.boundary_samples.clear();
+        for (int run_index = 0; run_index < run_count; ++run_index)
+        {
+            const OpenCVBlobRun &run = blobRuns[run_index];
+
+            if ((run.row - best_stats.min_y) % row_step != 0 && run.row != best_stats.max_y)
+            {
+                continue;
+            }
+
+            if (findBlobRoot(run_index) != best_root)
+            {
+                continue;
+            }
+
+            const int y = run.row + currentROI.y;
+            const int x_start = run.start + currentROI.x;
+            const int x_end = run.end + currentROI.x;
+
+            // Skip points on edge of camera, the blob is clipped there
+            if (y == 0 || y == (frameHeight - 1))
+            {
+                continue;
+            }
+
+            if (x_start != 0)
+            {
+                out_blob.boundary_samples.push_back(cv::Point(x_start, y));
+            }
+
+            if (x_end != x_start && x_end != (frameWidth - 1))
+            {
+                out_blob.boundary_samples.push_back(cv::Point(x_end, y));
+            }
+        }
+
+        out_blob.pixel_area = best_stats.area;
+        out_blob.centroid = cv::Point2f(
+            static_cast<float>(best_stats.sum_x / best_stats.area) + currentROI.x,
+            static_cast<float>(best_stats.sum_y / best_stats.area) + currentROI.y);
+        out_blob.bounding_box = cv::Rect2i(
+            best_stats.min_x + currentROI.x, best_stats.min_y + currentROI.y,
+            best_stats.max_x - best_stats.min_x + 1, blob_height);
+
+        return static_cast<int>(out_blob.boundary_samples.size()) > min_boundary_samples;
+    }
+
+    // Forget the blobs handed out to devices sharing a tracking color, before searching a new video frame
+    void clearBlobClaims()
+    {
+        for (int color_index = 0; color_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++color_index)
+        {
+            claimedBlobBoxes[color_index].clear();
+        }
+    }
+
+    // Keep the other devices with the same tracking color from picking the given blob in this video frame
+    void claimBlob(const eCommonTrackingColorID tracked_color_id, const cv::Rect2i &blobBounds)
+    {
+        claimedBlobBoxes[tracked_color_id].push_back(blobBounds);
+    }
+
+    // Pick the device's blob out of the candidates (listed biggest first) by their centers in raw image space.
+    // Blobs claimed by another device this frame are skipped, of the rest the one closest to the
+    // predicted location wins (the biggest one without a prediction). Returns -1 if every candidate is taken.
+    int selectBlobCandidate(
+        const eCommonTrackingColorID tracked_color_id,
+        const OpenCVBlobSelection &selection,
+        const std::vector<cv::Point2f> &candidate_centers) const
+    {
+        const std::vector<cv::Rect2i> &claimed_boxes = claimedBlobBoxes[tracked_color_id];
+        int best_index = -1;
+        float best_distance_sqr = 0.f;
+
+        for (int candidate_index = 0; candidate_index < static_cast<int>(candidate_centers.size()); ++candidate_index)
+        {
+            const cv::Point2f &center = candidate_centers[candidate_index];
+            const cv::Point2i pixel(cvRound(center.x), cvRound(center.y));
+            const bool bIsClaimed =
+                std::any_of(claimed_boxes.begin(), claimed_boxes.end(), [&pixel](const cv::Rect2i &box) { return box.contains(pixel); });
+
+            if (bIsClaimed)
+            {
+                continue;
+            }
+
+            if (!selection.bHasPredictedLocation)
+            {
+                return candidate_index;
+            }
+
+            const cv::Point2f offset = center - selection.predicted_location;
+            const float distance_sqr = offset.dot(offset);
+
+            if (best_index < 0 || distance_sqr < best_distance_sqr)
+            {
+                best_index = candidate_index;
+                best_distance_sqr = distance_sqr;
+            }
+        }
+
+        return best_index;
+    }
+
+    // Sample the brightness (HSV value) of a blob found in the current ROI for the auto exposure.
+    // Only the pixels of the box above the color range's value floor count as part of the lit LED.
+    void accumulateExposureStats(const cv::Rect2i &blobBounds, const CommonHSVColorRange &hsvColorRange)
+    {
+        const cv::Rect2i bounds = blobBounds & currentROI;
+
+        if (!bCollectExposureStats || bounds.area() <= 0)
+        {
+            return;
+        }
+
+        const int value_min = std::max(
+            cvRound(hsvColorRange.value_range.center - hsvColorRange.value_range.range), 1);
+        const int step_x = std::max(bounds.width / k_exposure_stats_max_samples_per_axis, 1);
+        const int step_y = std::max(bounds.height / k_exposure_stats_max_samples_per_axis, 1);
+
+        // currentROI has been converted to BGR by applyROI()
+        for (int y = bounds.y; y < bounds.y + bounds.height; y += step_y)
+        {
+            const unsigned char *row = bgrBuffer->ptr<unsigned char>(y);
+
+            for (int x = bounds.x; x < bounds.x + bounds.width; x += step_x)
+            {
+                const unsigned char *bgr = row + x*3;
+                const int value = std::max(std::max(bgr[0], bgr[1]), bgr[2]);
+
+                if (value >= value_min)
+                {
+                    ++exposureStats.sample_count;
+                    exposureStats.value_sum += value;
+
+                    if (value >= k_exposure_stats_saturated_value)
+                    {
+                        ++exposureStats.saturated_count;
+                    }
+                }
+            }
+        }
+    }
+
+    int findBlobRoot(int run_index)
+    {
+        while (blobRuns[run_index].parent != run_index)
+        {
+            // Path halving
+            blobRuns[run_index].parent = blobRuns[blobRuns[run_index].parent].parent;
+            run_index = blobRuns[run_index].parent;
+        }
+
+        return run_index;
+    }
+
+    void mergeBlobRuns(const int run_index, const int other_run_index)
+    {
+        const int root = findBlobRoot(run_index);
+        const int other_root = findBlobRoot(other_run_index);
+
+        // Keep the earliest run as the root so that it's already been visited when accumulating stats
+        if (root < other_root)
+        {
+            blobRuns[other_root].parent = root;
+        }
+        else if (other_root < root)
+        {
+            blobRuns[root].parent = other_root;
+        }
+    }
+
+    // Return points in raw image space:
+    // i.e. [0, 0] at lower left  to [frameWidth-1, frameHeight-1] at lower right
+    bool computeBiggestNContours(
+        const eCommonTrackingColorID tracked_color_id,
+        const CommonHSVColorRange &hsvColorRange,
+        t_opencv_int_contour_list &out_biggest_N_contours,
+        std::vector<double> &out_contour_areas,
+        const int max_contour_count,
+        const int min_points_in_contour = 6)
+    {
+        // The output contours get swapped in rather than copied,
+        // so their buffers go back and forth with the ones of contourScratch.contours
+        int found_contour_count = 0;
+        out_contour_areas.clear();
+        
+        computeColorMask(tracked_color_id, hsvColorRange);
+        SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_Contour, -1, traceTrackerID);
+
+        //TODO: Why no blurring of the gsLowerBuffer?
+
+        // Find the largest convex blob in the filtered grayscale buffer
+        {
+            std::vector<OpenCVContourInfo> &sorted_contour_list = contourScratch.sortedContours;
+            sorted_contour_list.clear();
+
+            // Find all counters in the image buffer
+            cv::Size size; cv::Point ofs;
+            gsLowerROI.locateROI(size, ofs);
+            t_opencv_int_contour_list &contours = contourScratch.contours;
+            cv::findContours(gsLowerROI,
+                             contours,
+                             CV_RETR_EXTERNAL,
+                             CV_CHAIN_APPROX_SIMPLE,  //CV_CHAIN_APPROX_NONE?
+                             ofs);
+
+            // Compute the area of each contour
+            int contour_index = 0;
+            for (auto it = contours.begin(); it != contours.end(); ++it) 
+            {
+                const double contour_area = cv::contourArea(*it);
+                const OpenCVContourInfo contour_info = { contour_index, contour_area };
+
+                sorted_contour_list.push_back(contour_info);
+                ++contour_index;
+            }
+            
+            // Sort the list of contours by area, largest to smallest
+            if (sorted_contour_list.size() > 1)
+            {
+                std::sort(
+                    sorted_contour_list.begin(), sorted_contour_list.end(), 
+                    [](const OpenCVContourInfo &a, const OpenCVContourInfo &b) {
+                        return b.contour_area < a.contour_area;
+                });
+            }
+
+            // Copy up to N valid contours
+            for (auto it = sorted_contour_list.begin(); 
+                it != sorted_contour_list.end() && found_contour_count < max_contour_count; 
+                ++it)
+            {
+                const OpenCVContourInfo &contour_info = *it;
+                t_opencv_int_contour &contour = contours[contour_info.contour_index];
+
+                if (contour.size() > min_points_in_contour)
+                {
+                    // Remove any points in contour on edge of camera/ROI
+                    // TODO: Contours touching image border will be clipped,
+                    // so this might not be necessary.
+                    t_opencv_int_contour::iterator it = contour.begin();
+                    while (it != contour.end()) 
+                    {
+                        if (it->x == 0 || it->x == (frameWidth - 1) || it->y == 0 || it->y == (frameHeight - 1))
+                        {
+                            it = contour.erase(it);
+                        }
+                        else
+                        {
+                            ++it;
+                        }
+                    }
+
+                    // Add cleaned up contour to the output list
+                    if (found_contour_count == static_cast<int>(out_biggest_N_contours.size()))
+                    {
+                        out_biggest_N_contours.emplace_back();
+                    }
+                    out_biggest_N_contours[found_contour_count].swap(contour);
+                    ++found_contour_count;
+                    // Add its area to the output list too.
+                    out_contour_areas.push_back(contour_info.contour_area);
+                }
+            }
+        }
+
+        out_biggest_N_contours.resize(found_contour_count);
+
+        return (found_contour_count > 0);
+    }
+    
+    void
+    draw_contour(const t_opencv_int_contour &contour)
+    {
+        // Draws the contour onto the debug overlay (composited over the video by the client).
+        // This is useful for debugging
+        if (!bDrawDebugOverlay)
+        {
+            return;
+        }
+
+        // A closed polyline is what cv::drawContours() draws for a single contour,
+        // without having to wrap the contour in a list first
+        const cv::Point2f massCenter = computeSafeCenterOfMassForContour<t_opencv_int_contour>(contour);
+        const cv::Rect2i bounds = cv::boundingRect(contour);
+        cv::polylines(*overlayBuffer, contour, true, cv::Scalar(OverlayColor_White));
+        cv::rectangle(*overlayBuffer, bounds, cv::Scalar(OverlayColor_White));
+        cv::drawMarker(*overlayBuffer, massCenter, cv::Scalar(OverlayColor_White), 0,
+            (bounds.height < bounds.width) ? bounds.height : bounds.width);
+    }
+    
+    void
+    draw_pose_projection(const CommonDeviceTrackingProjection &pose_projection)
+    {
+        // Draw the projection of the pose onto the debug overlay.
+        if (!bDrawDebugOverlay)
+        {
+            return;
+        }
+
+        switch (pose_projection.shape_type)
+        {
+        case eCommonTrackingProjectionType::ProjectionType_Ellipse:
+            {
+                // For the sphere, its ellipse projection parameters should already
+                // be calculated, so we can use those parameters to draw an ellipse.
+
+                //Create cv::ellipse from pose_estimate
+                cv::Point ell_center(
+                    static_cast<int>(pose_projection.shape.ellipse.center.x),
+                    static_cast<int>(pose_projection.shape.ellipse.center.y));
+                cv::Size ell_size(
+                    static_cast<int>(pose_projection.shape.ellipse.half_x_extent),
+                    static_cast<int>(pose_projection.shape.ellipse.half_y_extent));
+
+                //Draw ellipse on overlayBuffer
+                cv::ellipse(*overlayBuffer,
+                    ell_center,
+                    ell_size,
+                    pose_projection.shape.ellipse.angle,
+                    0, 360, cv::Scalar(OverlayColor_Red));
+                cv::drawMarker(*overlayBuffer, ell_center, cv::Scalar(OverlayColor_Red), 0,
+                    (ell_size.height < ell_size.width) ? ell_size.height * 2 : ell_size.width * 2);
+            } break;
+        case eCommonTrackingProjectionType::ProjectionType_LightBar:
+            {
+                int prev_point_index;
+
+                prev_point_index = CommonDeviceTrackingShape::QuadVertexCount - 1;
+                for (int point_index = 0; point_index < CommonDeviceTrackingShape::QuadVertexCount; ++point_index)
+                {
+                    cv::Point pt1(
+                        static_cast<int>(pose_projection.shape.lightbar.quad[prev_point_index].x),
+                        static_cast<int>(pose_projection.shape.lightbar.quad[prev_point_index].y));
+                    cv::Point pt2(
+                        static_cast<int>(pose_projection.shape.lightbar.quad[point_index].x),
+                        static_cast<int>(pose_projection.shape.lightbar.quad[point_index].y));
+                    cv::line(*overlayBuffer, pt1, pt2, cv::Scalar(OverlayColor_Red));
+
+                    prev_point_index = point_index;
+                }
+
+                prev_point_index = CommonDeviceTrackingShape::TriVertexCount - 1;
+                for (int point_index = 0; point_index < CommonDeviceTrackingShape::TriVertexCount; ++point_index)
+                {
+                    cv::Point pt1(
+                        static_cast<int>(pose_projection.shape.lightbar.triangle[prev_point_index].x),
+                        static_cast<int>(pose_projection.shape.lightbar.triangle[prev_point_index].y));
+                    cv::Point pt2(
+                        static_cast<int>(pose_projection.shape.lightbar.triangle[point_index].x),
+                        static_cast<int>(pose_projection.shape.lightbar.triangle[point_index].y));
+                    cv::line(*overlayBuffer, pt1, pt2, cv::Scalar(OverlayColor_Red));
+
+                    prev_point_index = point_index;
+                }
+                
+            } break;
+        case eCommonTrackingProjectionType::ProjectionType_Points:
+            {
+                for (int point_index = 0; point_index < pose_projection.shape.points.point_count; ++point_index)
+                {
+                    cv::Point pt(
+                        static_cast<int>(pose_projection.shape.points.point[point_index].x),
+                        static_cast<int>(pose_projection.shape.points.point[point_index].y));
+                    cv::drawMarker(*overlayBuffer, pt, cv::Scalar(OverlayColor_Red));
+                }
+            } break;
+        default:
+            assert(false && "unreachable");
+            break;
+        }		
+    }
+
+    int traceTrackerID; // Tracker id attached to the trace events of this buffer state
+    int frameWidth;
+    int frameHeight;
+    bool bUseFusedHSVMask;
+    bool bUseBayerCellSearch; // see computeBayerCellFrame()
+    cv::Rect2i currentROI;
+    cv::Rect2i segmentationROIs[k_max_search_regions]; // regions of the label buffer filled in this frame
+    int segmentationROICount;
+    uint8_t segmentedColorMask; // label bits of the colors in the label buffer
+
+    cv::Mat *bgrBuffer; // source video frame (references the tracker's capture buffer once a frame is written)
+    cv::Mat *overlayBuffer; // Palette indexed layer onto which we draw debug lines, and transmit via shared mem.
+    bool bDrawDebugOverlay; // Only true for frames that get published
+    cv::Mat *bayerBuffer; // raw Bayer video frame (references the tracker's capture buffer)
+    cv::Mat *bgraBuffer; // native BGRA video frame (references the tracker's capture buffer)
+    bool bHasNativeBGRAFrame;
+    cv::Mat *bgrConvertedBuffer; // owned destination of the ROI conversion when capturing raw Bayer or BGRA frames
+    bool bHasRawBayerFrame;
+    cv::Rect2i convertedROIs[k_max_search_regions]; // regions of bgrBuffer converted from the current raw Bayer or BGRA frame
+    int convertedROICount;
+    cv::Mat bgrROI;
+    cv::Mat *hsvBuffer; // source frame converted to HSV color space
+    cv::Mat hsvROI;
+    cv::Mat *gsLowerBuffer; // HSV image clamped by HSV range into grayscale mask
+    cv::Mat gsLowerROI;
+    cv::Mat gsUpperBuffer; // second half of a wrapped hue range mask, see getUpperMaskROI()
+    cv::Mat gsUpperROI;
+    cv::Mat *labelBuffer; // per-pixel bitmask of the tracking colors each pixel matched
+    ReacquisitionPyramidLevel reacquisitionPyramid[k_max_reacquisition_pyramid_levels];
+    OpenCVFusedHSVMaskKernel::Threshold reacquisitionThresholds[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    uint8_t reacquisitionThresholdBits[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    int reacquisitionThresholdCount;
+    uint8_t reacquisitionColorMask; // label bits of the colors labeled in the pyramid
+    std::vector<OpenCVBlobRun> blobRuns; // scratch space for computeBiggestBlob(), reused every frame
+    std::vector<OpenCVBlobStats> blobStats;
+    std::vector<int> blobCandidateRoots; // scratch space for picking a blob out of a shared tracking color
+    std::vector<cv::Point2f> blobCandidateCenters;
+    std::vector<cv::Rect2i> claimedBlobBoxes[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES]; // see claimBlob()
+    OpenCVLightBarFitScratch lightBarFitScratch; // scratch space for the light bar fit, reused every frame
+    OpenCVContourScratch contourScratch; // scratch space for the contour searches and pose fits, reused every frame
+    std::vector<OpenCVMotionGate> controllerMotionGates; // indexed by controller id
+    std::vector<OpenCVMotionGate> hmdMotionGates; // indexed by HMD id
+    cv::Mat motionGateScratch; // thumbnail of the current frame, see computeMotionGateDifference()
+    bool bCollectExposureStats; // see TrackerManagerConfig::use_auto_exposure
+    OpenCVExposureStats exposureStats; // written by the projection work, read between frames
+    OpenCVBGRToHSVMapper *bgr2hsv; // Used to convert an rgb image to an hsv image
+    bool bUseOpenCL; // color masks get computed with the transparent API, see updateGpuHsvFrame()
+    bool bGpuHsvFrameValid; // gpuHsvFrame holds the current frame
+    cv::UMat gpuSourceFrame; // upload of the current raw Bayer frame
+    cv::UMat gpuBgrFrame;
+    cv::UMat gpuHsvFrame;
+    cv::UMat gpuLowerMask;
+    cv::UMat gpuUpperMask;
+};
+
+/// The projections found for every tracked device in the most recent video frame.
+/// Sized to the controller and HMD slot counts, which are fixed once the service started.
+// Stands in for the frame size, which only the main thread may read. Clip it to the frame before use.
+static const cv::Rect2i k_full_frame_search_roi(0, 0, SHRT_MAX, SHRT_MAX);
+
+struct TrackerProjectionResults
+{
+    std::vector<bool> bControllerProjectionValid;
+    std::vector<ControllerOpticalPoseEstimation> controllerPoseEstimates;
+    std::vector<bool> bHMDProjectionValid;
+    std::vector<HMDOpticalPoseEstimation> hmdPoseEstimates;
+    // Where each device got searched for (empty for the devices without a job this frame,
+    // k_full_frame_search_roi for the ones searched for in the whole frame)
+    std::vector<cv::Rect2i> controllerSearchROIs;
+    std::vector<cv::Rect2i> hmdSearchROIs;
+
+    void resize(int controller_count, int hmd_count)
+    {
+        bControllerProjectionValid.resize(controller_count);
+        controllerPoseEstimates.resize(controller_count);
+        controllerSearchROIs.resize(controller_count);
+        bHMDProjectionValid.resize(hmd_count);
+        hmdPoseEstimates.resize(hmd_count);
+        hmdSearchROIs.resize(hmd_count);
+    }
+
+    void clear()
+    {
+        for (size_t controller_id = 0; controller_id < controllerPoseEstimates.size(); ++controller_id)
+        {
+            bControllerProjectionValid[controller_id] = false;
+            controllerPoseEstimates[controller_id].clear();
+            controllerSearchROIs[controller_id] = cv::Rect2i();
+        }
+
+        for (size_t hmd_id = 0; hmd_id < hmdPoseEstimates.size(); ++hmd_id)
+        {
+            bHMDProjectionValid[hmd_id] = false;
+            hmdPoseEstimates[hmd_id].clear();
+            hmdSearchROIs[hmd_id] = cv::Rect2i();
+        }
+    }
+};
+
+/// A request to search the current video frame for a single tracked device.
+/// Everything the search needs to know about the device gets copied in on the main thread,
+/// so the worker never reads device state the main thread may be updating (see use_pipelined_vision).
+struct TrackerProjectionJob
+{
+    // Null for the jobs a camera node gets from its host, the vision work goes by bIsHMD
+    const ServerControllerView *controller_view;
+    const ServerHMDView *hmd_view;
+    bool bIsHMD;
+    int device_id;
+    // Shared colors: higher priority devices claim their blobs first
+    eCommonVisionPriority vision_priority;
+    CommonDeviceTrackingShape tracking_shape;
+    // The device's gyro reads still, so its previous projection may get reused (see ServerTrackerView::tryReuseProjection())
+    bool bIsMotionless;
+    eCommonTrackingColorID tracking_color_id;
+    CommonHSVColorRange hsv_color_range;
+    // Where the device is expected to show up, predicted from its pose filter
+    cv::Rect2i roi;
+    bool bRoiDisabled;
+    // Number of this frame's jobs searching for the same tracking color, this one included
+    // (see TrackerManagerConfig::max_devices_per_tracking_color)
+    int shared_color_job_count;
+    // Where the pose filter expects the device in the video frame (raw image space),
+    // set only for shared colors while the device is tracked
+    cv::Point2f predicted_pixel_location;
+    bool bHasPredictedPixelLocation;
+    // The device's estimate from this tracker's last frame (only the one matching the device type is valid)
+    ControllerOpticalPoseEstimation prior_controller_pose_estimate;
+    HMDOpticalPoseEstimation prior_hmd_pose_estimate;
+    // Point cloud shapes only: the LEDs that may face this tracker, see predictPointCloudLEDVisibility()
+    bool bIsLEDVisible[CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT];
+};
+
+/// Smoothed timing of one stage of the vision pipeline (frame ingest, blob search, ...).
+/// Written by the one thread running the stage, safe to read from any thread.
+class VisionStageTimer
+{
+public:
+    VisionStageTimer()
+        : m_last_start_us(-1)
+        , m_busy_ms(0.f)
+        , m_occupancy(0.f)
+    {
+    }
+
+    // Record the service times (see ServerUtility::get_service_time_us()) the stage started and finished a frame at
+    void addFrame(const long long start_us, const long long end_us)
+    {
+        const float busy_ms = static_cast<float>(end_us - start_us) / 1000.f;
+
+        m_busy_ms.store(smooth(m_busy_ms.load(std::memory_order_relaxed), busy_ms), std::memory_order_relaxed);
+
+        // Occupancy is the fraction of the time since the stage started the previous frame it spent busy
+        if (m_last_start_us >= 0 && start_us > m_last_start_us)
+        {
+            const float occupancy = std::min(static_cast<float>(end_us - start_us) / static_cast<float>(start_us - m_last_start_us), 1.f);
+
+            m_occupancy.store(smooth(m_occupancy.load(std::memory_order_relaxed), occupancy), std::memory_order_relaxed);
+        }
+
+        m_last_start_us = start_us;
+    }
+
+    void reset()
+    {
+        m_last_start_us = -1;
+        m_busy_ms.store(0.f, std::memory_order_relaxed);
+        m_occupancy.store(0.f, std::memory_order_relaxed);
+    }
+
+    float getBusyTimeMs() const
+    {
+        return m_busy_ms.load(std::memory_order_relaxed);
+    }
+
+    float getOccupancy() const
+    {
+        return m_occupancy.load(std::memory_order_relaxed);
+    }
+
+private:
+    static float smooth(const float smoothed, const float sample)
+    {
+        return (smoothed > 0.f) ? smoothed + (sample - smoothed)*k_smoothing : sample;
+    }
+
+    // Exponential moving average weight of the newest frame
+    static const float k_smoothing;
+
+    long long m_last_start_us; // stage thread only
+    std::atomic<float> m_busy_ms;
+    std::atomic<float> m_occupancy;
+};
+const float VisionStageTimer::k_smoothing = 0.1f;
+
+/// Runs the blob search for one tracker on its own thread.
+/// The main thread fills in the list of devices to look for after a new video frame arrives,
+/// the worker computes all of the projections and hands them back through an AtomicObject.
+class TrackerVisionWorker : public WorkerThread
+{
+public:
+    TrackerVisionWorker(ServerTrackerView *tracker_view, const char *thread_name)
+        : WorkerThread(thread_name)
+        , m_tracker_view(tracker_view)
+        , m_bWorkPending(false)
+        , m_latched_results(nullptr)
+    {
+    }
+
+    // Called on the main thread
+    void postJobs(const std::vector<TrackerProjectionJob> &jobs)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_job_mutex);
+
+            m_jobs = jobs;
+            m_bWorkPending = true;
+        }
+
+        m_job_condition.notify_one();
+    }
+
+    // Called on the main thread
+    void waitForJobs()
+    {
+        std::unique_lock<std::mutex> lock(m_job_mutex);
+
+        // Don't wait on a thread that has stopped doing work
+        m_job_condition.wait(lock, [this] { return !m_bWorkPending || hasThreadEnded(); });
+    }
+
+    // Called on the main thread. Same as waitForJobs() returning right away.
+    bool getAreJobsDone()
+    {
+        std::lock_guard<std::mutex> lock(m_job_mutex);
+
+        return !m_bWorkPending || hasThreadEnded();
+    }
+
+    // Called on the main thread (the only reader) once the jobs are done.
+    // The fetch*Result() calls return these results until the next latchResults(),
+    // even if the worker already finished the next frame.
+    void latchResults()
+    {
+        m_latched_results = &m_results.fetchValueRef();
+    }
+
+    // Called on the main thread, reads the latched results.
+    // Only the entries asked for get copied out.
+    bool fetchControllerResult(int controller_id, ControllerOpticalPoseEstimation *out_pose_estimate) const
+    {
+        const bool bValid =
+            m_latched_results != nullptr &&
+            ServerUtility::is_index_valid(controller_id, static_cast<int>(m_latched_results->controllerPoseEstimates.size())) &&
+            m_latched_results->bControllerProjectionValid[controller_id];
+
+        if (bValid)
+        {
+            *out_pose_estimate = m_latched_results->controllerPoseEstimates[controller_id];
+        }
+
+        return bValid;
+    }
+
+    bool fetchHMDResult(int hmd_id, HMDOpticalPoseEstimation *out_pose_estimate) const
+    {
+        const bool bValid =
+            m_latched_results != nullptr &&
+            ServerUtility::is_index_valid(hmd_id, static_cast<int>(m_latched_results->hmdPoseEstimates.size())) &&
+            m_latched_results->bHMDProjectionValid[hmd_id];
+
+        if (bValid)
+        {
+            *out_pose_estimate = m_latched_results->hmdPoseEstimates[hmd_id];
+        }
+
+        return bValid;
+    }
+
+    // Where the latched frame got searched for the given device, false if the device had no job
+    bool fetchSearchROI(bool bIsHMD, int device_id, cv::Rect2i &out_roi) const
+    {
+        bool bValid = false;
+
+        if (m_latched_results != nullptr)
+        {
+            const std::vector<cv::Rect2i> &search_rois =
+                bIsHMD ? m_latched_results->hmdSearchROIs : m_latched_results->controllerSearchROIs;
+
+            if (ServerUtility::is_index_valid(device_id, static_cast<int>(search_rois.size())) &&
+                search_rois[device_id].area() > 0)
+            {
+                out_roi = search_rois[device_id];
+                bValid = true;
+            }
+        }
+
+        return bValid;
+    }
+
+    // Safe to call from any thread
+    float getProcessingTimeMs() const
+    {
+        return m_timer.getBusyTimeMs();
+    }
+
+    float getOccupancy() const
+    {
+        return m_timer.getOccupancy();
+    }
+
+    // Compute the projections for the given jobs on the calling thread
+    void processJobs(const std::vector<TrackerProjectionJob> &jobs)
+    {
+        const long long start_us = ServerUtility::get_service_time_us();
+        TrackerProjectionResults &results = m_scratch_results;
+
+        // Reused every frame, so this only allocates the first time
+        results.resize(
+            DeviceManager::getInstance()->getControllerViewMaxCount(),
+            DeviceManager::getInstance()->getHMDViewMaxCount());
+        results.clear();
+
+        // Start from a copy of the previous estimates so that
+        // a failed projection doesn't leave partially valid state.
+        // Devices that haven't moved since their previous projection keep it and skip the search.
+        m_search_jobs.clear();
+        for (const TrackerProjectionJob &job : jobs)
+        {
+            bool bReused = false;
+
+            (job.bIsHMD ? results.hmdSearchROIs : results.controllerSearchROIs)[job.device_id] =
+                job.bRoiDisabled ? k_full_frame_search_roi : job.roi;
+
+            if (!job.bIsHMD)
+            {
+                ControllerOpticalPoseEstimation &pose_estimate = results.controllerPoseEstimates[job.device_id];
+                pose_estimate = job.prior_controller_pose_estimate;
+
+                bReused = pose_estimate.bCurrentlyTracking && m_tracker_view->tryReuseProjection(job, pose_estimate.projection);
+                results.bControllerProjectionValid[job.device_id] = bReused;
+            }
+            else
+            {
+                HMDOpticalPoseEstimation &pose_estimate = results.hmdPoseEstimates[job.device_id];
+                pose_estimate = job.prior_hmd_pose_estimate;
+
+                bReused = pose_estimate.bCurrentlyTracking && m_tracker_view->tryReuseProjection(job, pose_estimate.projection);
+                results.bHMDProjectionValid[job.device_id] = bReused;
+            }
+
+            if (!bReused)
+            {
+                m_search_jobs.push_back(job);
+            }
+        }
+
+        // Classify the frame against all of the tracking colors at once
+        // rather than thresholding it again for every device
+        if (m_search_jobs.size() > 1)
+        {
+            m_tracker_view->segmentTrackingColors(m_search_jobs);
+        }
+
+        // Devices sharing a tracking color pick their blobs in turn.
+        // The ones with a predicted location go first, so lost devices only get the blobs left over,
+        // and within those the higher priority devices go first.
+        m_tracker_view->clearBlobClaims();
+        std::stable_sort(
+            m_search_jobs.begin(), m_search_jobs.end(),
+            [](const TrackerProjectionJob &a, const TrackerProjectionJob &b)
+            {
+                if (a.bHasPredictedPixelLocation != b.bHasPredictedPixelLocation)
+                {
+                    return a.bHasPredictedPixelLocation;
+                }
+
+                return a.vision_priority > b.vision_priority;
+            });
+
+        for (const TrackerProjectionJob &job : m_search_jobs)
+        {
+            bool bProjectionValid = false;
+
+            if (!job.bIsHMD)
+            {
+                bProjectionValid =
+                    m_tracker_view->computeProjectionForController(
+                        job,
+                        &results.controllerPoseEstimates[job.device_id]);
+                results.bControllerProjectionValid[job.device_id] = bProjectionValid;
+            }
+            else
+            {
+                bProjectionValid =
+                    m_tracker_view->computeProjectionForHMD(
+                        job,
+                        &results.hmdPoseEstimates[job.device_id]);
+                results.bHMDProjectionValid[job.device_id] = bProjectionValid;
+            }
+
+            m_tracker_view->updateProjectionMotionGate(job, bProjectionValid);
+        }
+
+        m_results.storeValue(results);
+
+        // Only one thread ever processes jobs at a time
+        const long long end_us = ServerUtility::get_service_time_us();
+        m_timer.addFrame(start_us, end_us);
+        ServerMetrics::record(ServerMetric_TrackerVisionTime, m_tracker_view->getDeviceID(), end_us - start_us);
+    }
+
+protected:
+    void onThreadHaltBegin() override
+    {
+        // Wake up the worker so that it sees the exit flag.
+        // Taking the lock first guarantees the worker is either waiting or will see the flag.
+        {
+            std::lock_guard<std::mutex> lock(m_job_mutex);
+        }
+        m_job_condition.notify_all();
+    }
+
+    bool doWork() override
+    {
+        std::vector<TrackerProjectionJob> jobs;
+
+        {
+            std::unique_lock<std::mutex> lock(m_job_mutex);
+
+            m_job_condition.wait(lock, [this] { return m_bWorkPending || m_exitSignaled.load(); });
+
+            if (!m_bWorkPending)
+            {
+                // Exit was requested
+                return true;
+            }
+
+            jobs.swap(m_jobs);
+        }
+
+        processJobs(jobs);
+
+        {
+            std::lock_guard<std::mutex> lock(m_job_mutex);
+
+            m_bWorkPending = false;
+        }
+
+        m_job_condition.notify_all();
+
+        return true;
+    }
+
+private:
+    ServerTrackerView *m_tracker_view;
+
+    // Shared job state
+    std::mutex m_job_mutex;
+    std::condition_variable m_job_condition;
+    std::vector<TrackerProjectionJob> m_jobs;
+    bool m_bWorkPending;
+
+    // Results from the last processed frame
+    AtomicObject<TrackerProjectionResults> m_results;
+    const TrackerProjectionResults *m_latched_results; // main thread only, see latchResults()
+    TrackerProjectionResults m_scratch_results; // worker thread only
+    std::vector<TrackerProjectionJob> m_search_jobs; // worker thread only, the jobs processJobs() has to search the frame for
+
+    // processJobs() durations
+    VisionStageTimer m_timer;
+};
+
+/// Runs the device side of one tracker settings change (camera modes, exposure, config load/save) on its own thread.
+/// The USB control transfers and stream restarts take a good part of a second per camera,
+/// so every tracker of a rig gets its own thread and they all switch over at once.
+class TrackerSettingsChange
+{
+public:
+    TrackerSettingsChange(ITrackerInterface *device, const std::function<void(ITrackerInterface *)> &device_update, const int tracker_id)
+        : m_bIsDone(false)
+        , m_thread()
+    {
+        m_thread = std::thread([this, device, device_update, tracker_id]() {
+            char thread_name[64];
+            ServerUtility::format_string(thread_name, sizeof(thread_name), "Tracker %d Settings", tracker_id);
+            ServerTrace::set_current_thread_name(thread_name);
+
+            device_update(device);
+            m_bIsDone.store(true, std::memory_order_release);
+        });
+    }
+
+    ~TrackerSettingsChange()
+    {
+        wait();
+    }
+
+    // Called on the main thread
+    bool getIsDone() const
+    {
+        return m_bIsDone.load(std::memory_order_acquire);
+    }
+
+    // Called on the main thread
+    void wait()
+    {
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+private:
+    std::atomic_bool m_bIsDone;
+    std::thread m_thread;
+};
+
+// -- Utility Methods -----
+static glm::quat computeGLMCameraTransformQuaternion(const ITrackerInterface *tracker_device);
+static glm::mat4 computeGLMCameraTransformMatrix(const ITrackerInterface *tracker_device);
+static void computeOpenCVCameraExtrinsicMatrix(const ITrackerInterface *tracker_device,
+                                                      cv::Matx34f &extrinsicOut);
+static void computeOpenCVCameraIntrinsicMatrix(const ITrackerInterface *tracker_device,
+                                               cv::Matx33f &intrinsicOut,
+                                               cv::Matx<float, 5, 1> &distortionOut);
+static CommonDeviceScreenLocation projectCameraRelativePoint(
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &distortions,
+    const CommonDevicePosition &camera_relative_position);
+static int planSearchRegions(
+    const cv::Rect2i *rois,
+    const int roi_count,
+    cv::Rect2i *out_regions);
+static bool computeTrackerRelativeLightBarProjection(
+    const CommonDeviceTrackingShape *tracking_shape,
+    const t_opencv_float_contour &opencv_contour,
+    OpenCVLightBarFitScratch &scratch,
+    CommonDeviceTrackingProjection *out_projection);
+static bool computeTrackerRelativeLightBarPose(
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &distortions,
+    const CommonDeviceTrackingShape *tracking_shape,
+    const CommonDeviceTrackingProjection *projection,
+    const CommonDevicePose *tracker_relative_pose_guess,
+    ControllerOpticalPoseEstimation *out_pose_estimate);
+static bool computeTrackerRelativePointCloudContourPose(
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &distortions,
+    const CommonDeviceTrackingShape *tracking_shape,
+    const bool *bIsLEDVisible,
+    const t_opencv_float_contour_list &opencv_contours,
+    const CommonDevicePose *tracker_relative_pose_guess,
+    HMDOpticalPoseEstimation *out_pose_estimate);
+static int matchPointCloudProjectionToImagePoints(
+    const t_opencv_float_contour &projected_led_points,
+    const t_opencv_float_contour &image_points,
+    std::vector<int> &out_led_for_image_point,
+    float &out_mean_error_px);
+static bool refinePointCloudPose(
+    const std::vector<cv::Point3f> &object_points,
+    const t_opencv_float_contour &image_points,
+    const std::vector<int> &led_for_image_point,
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &dist_coeffs,
+    cv::Mat &rvec,
+    cv::Mat &tvec);
+static bool searchPointCloudPose(
+    const std::vector<cv::Point3f> &object_points,
+    const t_opencv_float_contour &image_points,
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &dist_coeffs,
+    std::vector<int> &out_led_for_image_point,
+    cv::Mat &rvec,
+    cv::Mat &tvec);
+static cv::Rect2i computeTrackerROIForPoseProjection(
+    const bool disabled_roi,
+    const ServerTrackerView *tracker,
+    const IPoseFilter* pose_filter,
+    const CommonDeviceTrackingProjection *prior_tracking_projection,
+    const CommonDeviceTrackingShape *tracking_shape);
+static cv::Rect2f computeDistortedSphereBounds(
+    const ServerTrackerView *tracker,
+    const CommonDevicePosition &tracker_relative_center_cm,
+    const float radius_cm);
+static cv::Rect2i computeTrackerROIForController(
+    const ServerTrackerView *tracker,
+    const ServerControllerView *tracked_controller,
+    const CommonDeviceTrackingShape *tracking_shape);
+static cv::Rect2i computeTrackerROIForHMD(
+    const ServerTrackerView *tracker,
+    const ServerHMDView *tracked_hmd,
+    const CommonDeviceTrackingShape *tracking_shape);
+static bool getUseCoarseReacquisition(const bool roi_disabled, const bool is_tracking);
+static bool getIsPoseFilterMotionless(const IPoseFilter *pose_filter, const float max_angular_velocity);
+static bool getIsPoseFilterOutsideTrackerFrustum(const ServerTrackerView *tracker, const IPoseFilter *pose_filter, const float margin_cm);
+static void predictPointCloudLEDVisibility(
+    const ServerTrackerView *tracker,
+    const IPoseFilter *pose_filter,
+    const CommonDeviceTrackingShape &tracking_shape,
+    bool *out_bIsLEDVisible);
+static bool computePoseFilterPixelLocation(const ServerTrackerView *tracker, const IPoseFilter *pose_filter, cv::Point2f &out_pixel_location);
+static OpenCVBlobSelection makeBlobSelection(const TrackerProjectionJob &job);
+static bool computeBestFitTriangleForContour(
+    const t_opencv_float_contour &opencv_hull,
+    const cv::Point2f &mass_center,
+    t_opencv_float_contour &scratch_triangle,
+    cv::Point2f &out_triangle_top,
+    cv::Point2f &out_triangle_bottom_left,
+    cv::Point2f &out_triangle_bottom_right);
+static bool computeBestFitQuadForContour(
+    const t_opencv_float_contour &opencv_hull,
+    const cv::Point2f &up_hint, 
+    const cv::Point2f &right_hint,
+    cv::Point2f &top_right,
+    cv::Point2f &top_left,
+    cv::Point2f &bottom_left,
+    cv::Point2f &bottom_right);
+static void commonDeviceOrientationToOpenCVRodrigues(
+    const CommonDeviceQuaternion &orientation,
+    cv::Mat &rvec);
+static void openCVRodriguesToAngleAxis(
+    const cv::Mat &rvec,
+    float &axis_x, float &axis_y, float &axis_z, float &radians);
+static void angleAxisVectorToEulerAngles(
+    const float axis_x, const float axis_y, const float axis_z, const float radians,
+    float &yaw, float &pitch, float &roll);
+static void angleAxisVectorToCommonDeviceOrientation(
+    const float axis_x, const float axis_y, const float axis_z, const float radians,
+    CommonDeviceQuaternion &orientation);
+
+/// Cached undistortion of tracker pixel coordinates.
+/**
+ cv::undistortPoints runs an iterative solver for every point it's given.
+ Since the camera intrinsics rarely change, we instead undistort a coarse grid of pixel
+ locations once and bilinearly interpolate between the grid nodes for every contour point.
+ The grid is rebuilt whenever the tracker's intrinsics or frame size change.
+ Only touched by the thread processing the tracker's video frames.
+ */
+class OpenCVUndistortionGrid
+{
+public:
+    OpenCVUndistortionGrid()
+        : bIsValid(false)
+        , frameWidth(0)
+        , frameHeight(0)
+        , gridColumns(0)
+        , gridRows(0)
+    {
+        memset(intrinsics, 0, sizeof(intrinsics));
+    }
+
+    // Rebuild the grid if the camera intrinsics changed since it was last built
+    void update(const ITrackerInterface *tracker_device)
+    {
+        float new_intrinsics[k_intrinsic_count];
+        tracker_device->getCameraIntrinsics(
+            new_intrinsics[0], new_intrinsics[1],
+            new_intrinsics[2], new_intrinsics[3],
+            new_intrinsics[4], new_intrinsics[5], new_intrinsics[6],
+            new_intrinsics[7], new_intrinsics[8]);
+
+        int new_frame_width= 0, new_frame_height= 0;
+        tracker_device->getVideoFrameDimensions(&new_frame_width, &new_frame_height, nullptr);
+
+        if (bIsValid && 
+            new_frame_width == frameWidth && new_frame_height == frameHeight &&
+            memcmp(new_intrinsics, intrinsics, sizeof(intrinsics)) == 0)
+        {
+            return;
+        }
+
+        memcpy(intrinsics, new_intrinsics, sizeof(intrinsics));
+        frameWidth = new_frame_width;
+        frameHeight = new_frame_height;
+        computeOpenCVCameraIntrinsicMatrix(tracker_device, cameraMatrix, distortions);
+
+        // Grid nodes every k_grid_spacing pixels, with the last row and column covering the far frame edge
+        gridColumns = std::max((frameWidth + k_grid_spacing - 1) / k_grid_spacing, 1) + 1;
+        gridRows = std::max((frameHeight + k_grid_spacing - 1) / k_grid_spacing, 1) + 1;
+
+        t_opencv_float_contour grid_pixels;
+        grid_pixels.reserve(gridColumns*gridRows);
+        for (int row = 0; row < gridRows; ++row)
+        {
+            for (int col = 0; col < gridColumns; ++col)
+            {
+                grid_pixels.push_back(cv::Point2f(
+                    static_cast<float>(col*k_grid_spacing), 
+                    static_cast<float>(row*k_grid_spacing)));
+            }
+        }
+
+        // Undistort into the normalized camera space
+        cv::undistortPoints(grid_pixels, gridNormalizedPoints, cameraMatrix, distortions);
+        bIsValid = true;
+    }
+
+    const cv::Matx33f &getCameraMatrix() const { return cameraMatrix; }
+    const cv::Matx<float, 5, 1> &getDistortions() const { return distortions; }
+
+    // Same as cv::undistortPoints(in_points, out_points, camera_matrix, distortions):
+    // the results are in normalized camera space, i.e. relative to F_PX, F_PY
+    void undistortPointsNormalized(const t_opencv_float_contour &in_points, t_opencv_float_contour &out_points) const
+    {
+        out_points.resize(in_points.size());
+
+        for (size_t point_index = 0; point_index < in_points.size(); ++point_index)
+        {
+            out_points[point_index] = lookupNormalizedPoint(in_points[point_index]);
+        }
+    }
+
+    // Same as cv::undistortPoints(in_points, out_points, camera_matrix, distortions, cv::noArray(), camera_matrix):
+    // the results are undistorted pixel locations
+    void undistortPointsPixels(const t_opencv_float_contour &in_points, t_opencv_float_contour &out_points) const
+    {
+        out_points.resize(in_points.size());
+
+        for (size_t point_index = 0; point_index < in_points.size(); ++point_index)
+        {
+            const cv::Point2f normalized = lookupNormalizedPoint(in_points[point_index]);
+
+            out_points[point_index] = cv::Point2f(
+                normalized.x*cameraMatrix(0, 0) + cameraMatrix(0, 2),
+                normalized.y*cameraMatrix(1, 1) + cameraMatrix(1, 2));
+        }
+    }
+
+private:
+    static const int k_intrinsic_count = 9;
+    static const int k_grid_spacing = 8;
+
+    cv::Point2f lookupNormalizedPoint(const cv::Point2f &pixel) const
+    {
+        const float grid_x = clampf(pixel.x / static_cast<float>(k_grid_spacing), 0.f, static_cast<float>(gridColumns - 1));
+        const float grid_y = clampf(pixel.y / static_cast<float>(k_grid_spacing), 0.f, static_cast<float>(gridRows - 1));
+        const int col = std::min(static_cast<int>(grid_x), gridColumns - 2);
+        const int row = std::min(static_cast<int>(grid_y), gridRows - 2);
+        const float u = grid_x - static_cast<float>(col);
+        const float v = grid_y - static_cast<float>(row);
+
+        const cv::Point2f &p00 = gridNormalizedPoints[row*gridColumns + col];
+        const cv::Point2f &p10 = gridNormalizedPoints[row*gridColumns + col + 1];
+        const cv::Point2f &p01 = gridNormalizedPoints[(row + 1)*gridColumns + col];
+        const cv::Point2f &p11 = gridNormalizedPoints[(row + 1)*gridColumns + col + 1];
+
+        return (1.f - v)*((1.f - u)*p00 + u*p10) + v*((1.f - u)*p01 + u*p11);
+    }
+
+    bool bIsValid;
+    float intrinsics[k_intrinsic_count]; // intrinsics the grid was built from
+    int frameWidth;
+    int frameHeight;
+    cv::Matx33f cameraMatrix;
+    cv::Matx<float, 5, 1> distortions;
+    int gridColumns;
+    int gridRows;
+    t_opencv_float_contour gridNormalizedPoints; // undistorted normalized location of each grid node, row major
+};
+
+/// Camera matrices derived from the tracker pose and intrinsics.
+/**
+ The projections, the frustum tests and the multi-camera triangulation use them several times
+ per device and frame, while the pose and intrinsics only change with a calibration or a camera mode switch.
+ The matrices get rebuilt whenever the pose or intrinsics differ from the ones they were built from.
+ Only touched by the main thread (see ServerTrackerView::startProjectionWork()).
+ */
+class TrackerCameraMatrices
+{
+public:
+    TrackerCameraMatrices()
+        : bIsValid(false)
+        , revision(0)
+    {
+        memset(&pose, 0, sizeof(pose));
+        memset(intrinsics, 0, sizeof(intrinsics));
+    }
+
+    // Rebuild the matrices if the tracker pose or intrinsics changed since they were last built
+    void update(const ITrackerInterface *tracker_device)
+    {
+        const CommonDevicePose new_pose = tracker_device->getTrackerPose();
+        float new_intrinsics[k_intrinsic_count];
+        tracker_device->getCameraIntrinsics(
+            new_intrinsics[0], new_intrinsics[1],
+            new_intrinsics[2], new_intrinsics[3],
+            new_intrinsics[4], new_intrinsics[5], new_intrinsics[6],
+            new_intrinsics[7], new_intrinsics[8]);
+
+        if (bIsValid &&
+            memcmp(&new_pose, &pose, sizeof(pose)) == 0 &&
+            memcmp(new_intrinsics, intrinsics, sizeof(intrinsics)) == 0)
+        {
+            return;
+        }
+
+        pose = new_pose;
+        memcpy(intrinsics, new_intrinsics, sizeof(intrinsics));
+
+        cameraQuaternion = computeGLMCameraTransformQuaternion(tracker_device);
+        cameraTransform = computeGLMCameraTransformMatrix(tracker_device);
+        invCameraTransform = glm::inverse(cameraTransform);
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 4; ++col)
+            {
+                worldFromTracker[row][col] = cameraTransform[col][row];
+            }
+        }
+        computeOpenCVCameraExtrinsicMatrix(tracker_device, extrinsicMatrix);
+        computeOpenCVCameraIntrinsicMatrix(tracker_device, intrinsicMatrix, distortions);
+        pinholeMatrix = intrinsicMatrix * extrinsicMatrix;
+
+        bIsValid = true;
+        ++revision;
+    }
+
+    const glm::quat &getCameraQuaternion() const { return cameraQuaternion; }
+    const glm::mat4 &getCameraTransform() const { return cameraTransform; }
+    const glm::mat4 &getInverseCameraTransform() const { return invCameraTransform; }
+    // Row major top 3 rows of getCameraTransform(), all the batched world transforms need
+    const float (&getWorldFromTracker() const)[3][4] { return worldFromTracker; }
+    const cv::Matx33f &getIntrinsicMatrix() const { return intrinsicMatrix; }
+    const cv::Matx<float, 5, 1> &getDistortions() const { return distortions; }
+    const cv::Matx34f &getPinholeMatrix() const { return pinholeMatrix; }
+    // Bumped every time the matrices get rebuilt
+    int getRevision() const { return revision; }
+
+private:
+    static const int k_intrinsic_count = 9;
+
+    bool bIsValid;
+    int revision;
+    CommonDevicePose pose; // pose the matrices were built from
+    float intrinsics[k_intrinsic_count]; // intrinsics the matrices were built from
+    glm::quat cameraQuaternion;
+    glm::mat4 cameraTransform;
+    glm::mat4 invCameraTransform;
+    float worldFromTracker[3][4];
+    cv::Matx34f extrinsicMatrix;
+    cv::Matx33f intrinsicMatrix;
+    cv::Matx<float, 5, 1> distortions;
+    cv::Matx34f pinholeMatrix;
+};
+
+//-- public implementation -----
+ServerTrackerView::ServerTrackerView(const int device_id)
+    : ServerDeviceView(device_id)
+    , m_device(nullptr)
+    , m_bIsRemoteCamera(false)
+    , m_shared_memory_accesor(nullptr)
+    , m_shared_memory_video_stream_count(0)
+    , m_bPublishVideoFrame(false)
+    , m_network_video_stream_count(0)
+    , m_bIsCaptureSuspended(false)
+    , m_network_video_settings()
+    , m_network_video_frame()
+    , m_bPublishNetworkVideoFrame(false)
+    , m_last_network_video_frame_time()
+    , m_video_frame_timestamp_us(0)
+    , m_last_video_frame_sequence_number(-1)
+    , m_last_video_frame_drop_count(0)
+    , m_dropped_video_frame_count(0)
+    , m_opencv_buffer_state(nullptr)
+    , m_undistortion_grid(new OpenCVUndistortionGrid())
+    , m_camera_matrices(new TrackerCameraMatrices())
+    , m_vision_worker(nullptr)
+    , m_last_auto_exposure_update()
+    , m_projection_work_count(0)
+    , m_camera_node_frame_sequence_number(-1)
+    , m_controller_color_presets(ControllerManager::k_max_devices)
+    , m_hmd_color_presets(HMDManager::k_max_devices)
+    , m_bIsVisionPipelined(false)
+    , m_bIsProjectionWorkInFlight(false)
+    , m_bHasRetiredProjectionWork(false)
+    , m_bPublishInFlightVideoFrame(false)
+    , m_bPublishInFlightNetworkVideoFrame(false)
+    , m_in_flight_capture_timestamp()
+    , m_in_flight_frame_drop_count(0)
+    , m_projection_capture_timestamp()
+    , m_projection_frame_drop_count(0)
+    , m_frame_ingest_timer(new VisionStageTimer())
+    , m_pipeline_stall_timer(new VisionStageTimer())
+    , m_settings_change(nullptr)
+{
+    ServerUtility::format_string(m_shared_memory_name, sizeof(m_shared_memory_name), "tracker_view_%d", device_id);
+    invalidateTrackingColorPresets();
+
+    memset(m_shared_memory_preview_scale_counts, 0, sizeof(m_shared_memory_preview_scale_counts));
+    memset(m_shared_memory_preview_format_counts, 0, sizeof(m_shared_memory_preview_format_counts));
+    m_shared_memory_preview.scale = 1;
+    m_shared_memory_preview.pixel_format = SharedVideoPixelFormat_BGR;
+}
+
+ServerTrackerView::~ServerTrackerView()
+{
+    if (m_settings_change != nullptr)
+    {
+        delete m_settings_change;
+    }
+
+    if (m_vision_worker != nullptr)
+    {
+        m_vision_worker->stopThread();
+        delete m_vision_worker;
+    }
+
+    if (m_shared_memory_accesor != nullptr)
+    {
+        delete m_shared_memory_accesor;
+    }
+
+    if (m_opencv_buffer_state != nullptr)
+    {
+        delete m_opencv_buffer_state;
+    }
+
+    delete m_undistortion_grid;
+    delete m_camera_matrices;
+    delete m_frame_ingest_timer;
+    delete m_pipeline_stall_timer;
+
+    if (m_device != nullptr)
+    {
+        delete m_device;
+    }
+}
+
+CommonDeviceState::eDeviceType
+ServerTrackerView::getTrackerDeviceType() const
+{
+    return m_device->getDeviceType();
+}
+
+ITrackerInterface::eDriverType 
+ServerTrackerView::getTrackerDriverType() const
+{
+    return m_device->getDriverType();
+}
+
+std::string
+ServerTrackerView::getUSBDevicePath() const
+{
+    return m_device->getUSBDevicePath();
+}
+
+std::string 
+ServerTrackerView::getSharedMemoryStreamName() const
+{
+    return std::string(m_shared_memory_name);
+}
+
+std::chrono::time_point<std::chrono::high_resolution_clock>
+ServerTrackerView::getLastVideoFrameCaptureTimestamp() const
+{
+    const CommonDeviceState *state = (m_device != nullptr) ? m_device->getState() : nullptr;
+
+    return (state != nullptr && state->getHasCaptureTimestamp()) 
+        ? state->CaptureTimestamp 
+        : getLastNewDataTimestamp();
+}
+
+bool ServerTrackerView::open(const class DeviceEnumerator *enumerator)
+{
+    bool bSuccess = ServerDeviceView::open(enumerator);
+
+    if (bSuccess)
+    {
+        int width, height, stride;
+
+        m_last_video_frame_sequence_number = -1;
+        m_last_video_frame_drop_count = 0;
+        m_dropped_video_frame_count = 0;
+        m_camera_node_frame_sequence_number = -1;
+        m_bIsCaptureSuspended = false;
+
+        // The tracker config just got (re)loaded
+        invalidateTrackingColorPresets();
+        m_camera_matrices->update(m_device);
+
+        // Make sure the shared memory block has been removed first
+        boost::interprocess::shared_memory_object::remove(m_shared_memory_name);
+
+        if (m_bIsRemoteCamera)
+        {
+            // The camera node searches the video frames, there's nothing to stream or search here
+            m_bIsVisionPipelined = false;
+        }
+        // Query the video frame first so that we know how big to make the buffer
+        else if (m_device->getVideoFrameDimensions(&width, &height, &stride))
+        {
+            // The shared memory video frames wait for the first video stream, see startSharedMemoryVideoStream()
+            assert(m_shared_memory_accesor == nullptr);
+            if (m_shared_memory_video_stream_count > 0)
+            {
+                allocateSharedMemoryVideoFrames();
+            }
+
+            // Allocate the OpenCV scratch buffers used for finding tracking blobs
+            m_opencv_buffer_state = new OpenCVBufferState(m_device, m_deviceID);
+
+            // Ask for raw Bayer frames so that we only demosaic the regions we search
+            if (DeviceManager::getInstance()->m_tracker_manager->getConfig().use_roi_demosaic)
+            {
+                if (!m_device->setRawBayerFrameCapture(true))
+                {
+                    SERVER_LOG_INFO("ServerTrackerView::open()") << "Tracker doesn't support raw Bayer frames. Using full frame demosaic.";
+                }
+            }
+
+            // Spin up the thread that searches the video frames for tracking blobs
+            if (m_vision_worker == nullptr)
+            {
+                char thread_name[32];
+                ServerUtility::format_string(thread_name, sizeof(thread_name), "TrackerVision_%d", getDeviceID());
+
+                m_vision_worker = new TrackerVisionWorker(this, thread_name);
+            }
+
+            const TrackerManagerConfig &trackerMgrConfig = DeviceManager::getInstance()->m_tracker_manager->getConfig();
+
+            if (trackerMgrConfig.use_vision_worker_threads)
             {
-                cv::inRange(
-                    hsvROI,
-                    cv::Scalar(hue_min, saturation_min, value_min),
-                    cv::Scalar(hue_max, saturation_max, value_max),
-                    gsLowerROI);
+                m_vision_worker->startThread();
             }
+
+            // Framesets need every tracker's results in the tick its frame arrived
+            m_bIsVisionPipelined =
+                trackerMgrConfig.use_pipelined_vision &&
+                !trackerMgrConfig.synchronize_tracker_frames &&
+                m_vision_worker->hasThreadStarted();
+            m_frame_ingest_timer->reset();
+            m_pipeline_stall_timer->reset();
         }
-        
-        //TODO: Why no blurring of the gsLowerBuffer?
+        else
+        {
+            SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to video frame dimensions";
+        }
+    }
 
-        // Find the largest convex blob in the filtered grayscale buffer
+    return bSuccess;
+}
+
+void ServerTrackerView::close()
+{
+    // The camera can't go away under its settings change
+    finishSettingsChange();
+
+    if (m_vision_worker != nullptr)
+    {
+        m_vision_worker->stopThread();
+    }
+
+    // Any work in flight is abandoned along with the worker
+    m_bIsVisionPipelined = false;
+    m_bIsProjectionWorkInFlight = false;
+    m_bHasRetiredProjectionWork = false;
+
+    freeSharedMemoryVideoFrames();
+
+    ServerDeviceView::close();
+}
+
+void ServerTrackerView::startSharedMemoryVideoStream(const TrackerVideoPreviewSettings &preview)
+{
+    ++m_shared_memory_video_stream_count;
+    ++m_shared_memory_preview_scale_counts[getPreviewScaleLevel(preview.scale)];
+    ++m_shared_memory_preview_format_counts[getPreviewPixelFormat(preview.pixel_format)];
+    updateSharedMemoryPreview();
+
+    // Every tracker's frames would take up several MB of shared memory even when nobody watches them
+    if (m_shared_memory_video_stream_count == 1)
+    {
+        allocateSharedMemoryVideoFrames();
+    }
+}
+
+void ServerTrackerView::stopSharedMemoryVideoStream(const TrackerVideoPreviewSettings &preview)
+{
+    assert(m_shared_memory_video_stream_count > 0);
+    --m_shared_memory_video_stream_count;
+    --m_shared_memory_preview_scale_counts[getPreviewScaleLevel(preview.scale)];
+    --m_shared_memory_preview_format_counts[getPreviewPixelFormat(preview.pixel_format)];
+    updateSharedMemoryPreview();
+
+    // Clients that still have the frames open keep their mapping
+    if (m_shared_memory_video_stream_count == 0)
+    {
+        freeSharedMemoryVideoFrames();
+    }
+}
+
+void ServerTrackerView::updateSharedMemoryPreview()
+{
+    // The first entry of each count is the largest scale / richest format
+    m_shared_memory_preview.scale = 1;
+    for (int level = 0; level < 3; ++level)
+    {
+        if (m_shared_memory_preview_scale_counts[level] > 0)
         {
-            struct ContourInfo
-            {
-                int contour_index;
-                double contour_area;
-            };
-            std::vector<ContourInfo> sorted_contour_list;
+            m_shared_memory_preview.scale = 1 << level;
+            break;
+        }
+    }
 
-            // Find all counters in the image buffer
-            cv::Size size; cv::Point ofs;
-            gsLowerROI.locateROI(size, ofs);
-            t_opencv_int_contour_list contours;
-            cv::findContours(gsLowerROI,
-                             contours,
-                             CV_RETR_EXTERNAL,
-                             CV_CHAIN_APPROX_SIMPLE,  //CV_CHAIN_APPROX_NONE?
-                             ofs);
+    m_shared_memory_preview.pixel_format = SharedVideoPixelFormat_BGR;
+    for (int pixel_format = 0; pixel_format < MAX_SHARED_VIDEO_PIXEL_FORMAT_COUNT; ++pixel_format)
+    {
+        if (m_shared_memory_preview_format_counts[pixel_format] > 0)
+        {
+            m_shared_memory_preview.pixel_format = pixel_format;
+            break;
+        }
+    }
+}
 
-            // Compute the area of each contour
-            int contour_index = 0;
-            for (auto it = contours.begin(); it != contours.end(); ++it) 
+void ServerTrackerView::startNetworkVideoStream(const TrackerNetworkVideoSettings &settings)
+{
+    m_network_video_settings = settings;
+    ++m_network_video_stream_count;
+}
+
+void ServerTrackerView::stopNetworkVideoStream()
+{
+    assert(m_network_video_stream_count > 0);
+    --m_network_video_stream_count;
+}
+
+bool ServerTrackerView::setCaptureSuspended(bool bSuspended)
+{
+    bool bSuccess = false;
+
+    if (bSuspended == m_bIsCaptureSuspended)
+    {
+        bSuccess = true;
+    }
+    else if (m_device != nullptr && m_device->setCaptureSuspended(bSuspended))
+    {
+        SERVER_LOG_INFO("ServerTrackerView::setCaptureSuspended") <<
+            (bSuspended ? "Stopped" : "Restarted") << " the camera stream of tracker " << getDeviceID();
+
+        m_bIsCaptureSuspended = bSuspended;
+        bSuccess = true;
+    }
+
+    return bSuccess;
+}
+
+bool ServerTrackerView::poll()
+{
+    // The tracker sits out its polls while a settings change reconfigures the camera,
+    // the first frame after it is done comes in with the new settings
+    if (pollSettingsChange())
+    {
+        return true;
+    }
+
+    SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_FrameGrab, -1, getDeviceID());
+    bool bSuccess = ServerDeviceView::poll();
+
+    // A new frame can't go into the buffers the pipelined vision worker is still searching
+    if (bSuccess)
+    {
+        finishPipelinedProjectionWork();
+    }
+
+    m_bPublishVideoFrame = false;
+    m_bPublishNetworkVideoFrame = false;
+
+    if (bSuccess && m_device != nullptr)
+    {
+        const unsigned char *bayer_buffer = m_device->getRawBayerFrameBuffer();
+        const unsigned char *buffer = m_device->getVideoFrameBuffer();
+        const long long frame_sequence_number = m_device->getVideoFrameSequenceNumber();
+
+        // Any gap in the frame numbers is frames the camera dropped before this one
+        if (frame_sequence_number >= 0 && frame_sequence_number != m_last_video_frame_sequence_number)
+        {
+            m_last_video_frame_drop_count =
+                (m_last_video_frame_sequence_number >= 0 && frame_sequence_number > m_last_video_frame_sequence_number + 1)
+                ? static_cast<int>(frame_sequence_number - m_last_video_frame_sequence_number - 1)
+                : 0;
+            m_dropped_video_frame_count += m_last_video_frame_drop_count;
+            m_last_video_frame_sequence_number = frame_sequence_number;
+        }
+
+        // Only publish the frame (and render its debug overlay) if a client is
+        // streaming video and has actually consumed the previous frame
+        m_bPublishVideoFrame =
+            (bayer_buffer != nullptr || buffer != nullptr) &&
+            m_opencv_buffer_state != nullptr &&
+            m_shared_memory_accesor != nullptr &&
+            m_shared_memory_video_stream_count > 0 &&
+            m_shared_memory_accesor->getWasLastFrameRead();
+
+        // The network video streams only encode frames at the rate they asked for
+        if ((bayer_buffer != nullptr || buffer != nullptr) &&
+            m_opencv_buffer_state != nullptr &&
+            m_network_video_stream_count > 0)
+        {
+            const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+            const int max_frame_rate = m_network_video_settings.max_frame_rate;
+
+            if (max_frame_rate <= 0 ||
+                now - m_last_network_video_frame_time >= std::chrono::microseconds(1000000 / max_frame_rate))
             {
-                const double contour_area = cv::contourArea(*it);
-                const ContourInfo contour_info = { contour_index, contour_area };
+                m_bPublishNetworkVideoFrame = true;
+                m_last_network_video_frame_time = now;
+            }
+        }
 
-                sorted_contour_list.push_back(contour_info);
-                ++contour_index;
+        if (m_bPublishVideoFrame || m_bPublishNetworkVideoFrame)
+        {
+            m_video_frame_timestamp_us =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        const long long ingest_start_us = ServerUtility::get_service_time_us();
+
+        if (bayer_buffer != nullptr)
+        {
+            // Cache the raw Bayer frame.
+            // Only demosaic the whole thing now if the frame is getting published.
+            if (m_opencv_buffer_state != nullptr)
+            {
+                m_opencv_buffer_state->writeRawBayerFrame(bayer_buffer, m_bPublishVideoFrame || m_bPublishNetworkVideoFrame);
             }
-            
-            // Sort the list of contours by area, largest to smallest
-            if (sorted_contour_list.size() > 1)
+        }
+        else if (buffer != nullptr)
+        {
+            // Cache the raw video frame
+            if (m_opencv_buffer_state != nullptr)
             {
-                std::sort(
-                    sorted_contour_list.begin(), sorted_contour_list.end(), 
-                    [](const ContourInfo &a, const ContourInfo &b) {
-                        return b.contour_area < a.contour_area;
-                });
+                int bytes_per_pixel, stride;
+
+                m_device->getVideoFrameBufferLayout(&bytes_per_pixel, &stride);
+                m_opencv_buffer_state->writeVideoFrame(
+                    buffer, bytes_per_pixel, stride, m_bPublishVideoFrame || m_bPublishNetworkVideoFrame);
             }
+        }
 
-            // Copy up to N valid contours
-            for (auto it = sorted_contour_list.begin(); 
-                it != sorted_contour_list.end() && static_cast<int>(out_biggest_N_contours.size()) < max_contour_count; 
-                ++it)
-            {
-                const ContourInfo &contour_info = *it;
-                t_opencv_int_contour &contour = contours[contour_info.contour_index];
+        if (bayer_buffer != nullptr || buffer != nullptr)
+        {
+            m_frame_ingest_timer->addFrame(ingest_start_us, ServerUtility::get_service_time_us());
+        }
 
-                if (contour.size() > min_points_in_contour)
+        // The projection work of the previous frames has finished by now
+        updateAutoExposure();
+    }
+
+    return bSuccess;
+}
+
+void ServerTrackerView::clearBlobClaims()
+{
+    if (m_opencv_buffer_state != nullptr)
+    {
+        m_opencv_buffer_state->clearBlobClaims();
+    }
+}
+
+void ServerTrackerView::startProjectionWork()
+{
+    // Picks up intrinsics that changed with the camera mode or got reported by a camera node
+    m_camera_matrices->update(m_device);
+
+    // Remote cameras get searched on their camera node
+    if (!m_bIsRemoteCamera && (m_vision_worker == nullptr || m_opencv_buffer_state == nullptr))
+    {
+        return;
+    }
+
+    const CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+    std::vector<TrackerProjectionJob> jobs;
+
+    if (camera_node_link != nullptr && camera_node_link->getIsNode())
+    {
+        // A camera node looks for the devices of its host
+        gatherCameraNodeJobs(camera_node_link->getNodeJobs(getDeviceID()), jobs);
+    }
+    else
+    {
+        gatherProjectionJobs(jobs);
+    }
+
+    if (m_bIsRemoteCamera)
+    {
+        // The results come back with the camera node's next frame (see RemoteTracker::poll())
+        sendCameraNodeJobs(jobs);
+    }
+    else if (m_bIsVisionPipelined)
+    {
+        // At most one frame in flight
+        finishPipelinedProjectionWork();
+
+        m_bIsProjectionWorkInFlight = true;
+        m_bPublishInFlightVideoFrame = m_bPublishVideoFrame;
+        m_bPublishInFlightNetworkVideoFrame = m_bPublishNetworkVideoFrame;
+        m_in_flight_capture_timestamp = getLastVideoFrameCaptureTimestamp();
+        m_in_flight_frame_drop_count = m_last_video_frame_drop_count;
+
+        m_vision_worker->postJobs(jobs);
+    }
+    else if (m_vision_worker->hasThreadStarted())
+    {
+        m_vision_worker->postJobs(jobs);
+    }
+    else
+    {
+        // Worker threads are disabled, do the work on the main thread
+        m_vision_worker->processJobs(jobs);
+        m_vision_worker->latchResults();
+    }
+}
+
+void ServerTrackerView::gatherProjectionJobs(std::vector<TrackerProjectionJob> &jobs)
+{
+    DeviceManager *device_manager = DeviceManager::getInstance();
+    TrackerManager *tracker_manager = device_manager->m_tracker_manager;
+    const TrackerManagerConfig &trackerMgrConfig = tracker_manager->getConfig();
+
+    // Devices this tracker is on fusion standby for only get searched for every unfused_tracker_search_interval frames.
+    // The tracker id staggers the standby searches of the trackers.
+    const bool bIsStandbySearchFrame =
+        trackerMgrConfig.unfused_tracker_search_interval <= 1 ||
+        (m_projection_work_count + getDeviceID()) % trackerMgrConfig.unfused_tracker_search_interval == 0;
+    // Same for the devices this tracker lost while the ticks go over the optical time budget,
+    // and for the low priority devices it still tracks (see eCommonVisionPriority)
+    const bool bIsOverloadSearchFrame =
+        !tracker_manager->getIsSheddingOpticalWork() ||
+        trackerMgrConfig.overload_search_interval <= 1 ||
+        (m_projection_work_count + getDeviceID()) % trackerMgrConfig.overload_search_interval == 0;
+    ++m_projection_work_count;
+
+    // Find every controller that wants to be optically tracked
+    for (int controller_id = 0; controller_id < device_manager->getControllerViewMaxCount(); ++controller_id)
+    {
+        ServerControllerViewPtr controller_view = device_manager->getControllerViewPtr(controller_id);
+
+        if (controller_view->getIsOpen() &&
+            controller_view->getIsTrackingEnabled() &&
+            controller_view->getControllerDeviceType() != CommonDeviceState::PSNavi &&
+            (controller_view->getIsBluetooth() || controller_view->getIsVirtualController()))
+        {
+            TrackerProjectionJob job;
+
+            job.controller_view = controller_view.get();
+            job.hmd_view = nullptr;
+            job.bIsHMD = false;
+            job.device_id = controller_id;
+            job.vision_priority = controller_view->getVisionPriority();
+            // Only controllers with a gyro can vouch for not having moved
+            job.bIsMotionless =
+                trackerMgrConfig.use_motion_gating &&
+                (controller_view->getControllerDeviceType() == CommonDeviceState::PSMove ||
+                 controller_view->getControllerDeviceType() == CommonDeviceState::PSDualShock4) &&
+                getIsPoseFilterMotionless(controller_view->getPoseFilter(), trackerMgrConfig.motion_gate_max_angular_velocity);
+            job.prior_controller_pose_estimate = *controller_view->getTrackerPoseEstimate(getDeviceID());
+            std::fill(job.bIsLEDVisible, job.bIsLEDVisible + CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT, true);
+
+            // Skip the search if this tracker lost the controller and can't see where the other trackers put it
+            const bool bIsCulled =
+                trackerMgrConfig.use_frustum_culling &&
+                !job.prior_controller_pose_estimate.bCurrentlyTracking &&
+                controller_view->getIsCurrentlyTracking() &&
+                getIsPoseFilterOutsideTrackerFrustum(this, controller_view->getPoseFilter(), trackerMgrConfig.frustum_culling_margin_cm);
+            const bool bIsOnStandby = controller_view->getIsTrackerOnFusionStandby(getDeviceID()) && !bIsStandbySearchFrame;
+            const bool bIsShed =
+                !bIsOverloadSearchFrame &&
+                getIsVisionPrioritySheddable(job.vision_priority, job.prior_controller_pose_estimate.bCurrentlyTracking);
+
+            if (!bIsCulled && !bIsOnStandby && bIsShed)
+            {
+                tracker_manager->addDeferredOpticalSearch();
+            }
+            else if (!bIsCulled && !bIsOnStandby && controller_view->getTrackingShape(job.tracking_shape))
+            {
+                job.tracking_color_id = controller_view->getTrackingColorID();
+                if (job.tracking_color_id != eCommonTrackingColorID::INVALID_COLOR)
                 {
-                    // Remove any points in contour on edge of camera/ROI
-                    // TODO: Contours touching image border will be clipped,
-                    // so this might not be necessary.
-                    t_opencv_int_contour::iterator it = contour.begin();
-                    while (it != contour.end()) 
-                    {
-                        if (it->x == 0 || it->x == (frameWidth - 1) || it->y == 0 || it->y == (frameHeight - 1))
-                        {
-                            it = contour.erase(it);
-                        }
-                        else
-                        {
-                            ++it;
-                        }
-                    }
+                    getControllerTrackingColorPreset(controller_view.get(), job.tracking_color_id, &job.hsv_color_range);
+                }
+                job.roi = computeTrackerROIForController(this, controller_view.get(), &job.tracking_shape);
+                job.bRoiDisabled = controller_view->getIsROIDisabled() || trackerMgrConfig.disable_roi;
 
-                    // Add cleaned up contour to the output list
-                    out_biggest_N_contours.push_back(contour);
-                    // Add its area to the output list too.
-                    out_contour_areas.push_back(contour_info.contour_area);
+                jobs.push_back(job);
+            }
+        }
+    }
+
+    // Find every HMD that wants to be optically tracked
+    for (int hmd_id = 0; hmd_id < device_manager->getHMDViewMaxCount(); ++hmd_id)
+    {
+        ServerHMDViewPtr hmd_view = device_manager->getHMDViewPtr(hmd_id);
+
+        if (hmd_view->getIsOpen() && hmd_view->getIsTrackingEnabled())
+        {
+            TrackerProjectionJob job;
+
+            job.controller_view = nullptr;
+            job.hmd_view = hmd_view.get();
+            job.bIsHMD = true;
+            job.device_id = hmd_id;
+            job.vision_priority = hmd_view->getVisionPriority();
+            job.bIsMotionless =
+                trackerMgrConfig.use_motion_gating &&
+                hmd_view->getHMDDeviceType() == CommonDeviceState::Morpheus &&
+                getIsPoseFilterMotionless(hmd_view->getPoseFilter(), trackerMgrConfig.motion_gate_max_angular_velocity);
+            job.prior_hmd_pose_estimate = *hmd_view->getTrackerPoseEstimate(getDeviceID());
+
+            // Skip the search if this tracker lost the HMD and can't see where the other trackers put it
+            const bool bIsCulled =
+                trackerMgrConfig.use_frustum_culling &&
+                !job.prior_hmd_pose_estimate.bCurrentlyTracking &&
+                hmd_view->getIsCurrentlyTracking() &&
+                getIsPoseFilterOutsideTrackerFrustum(this, hmd_view->getPoseFilter(), trackerMgrConfig.frustum_culling_margin_cm);
+            const bool bIsOnStandby = hmd_view->getIsTrackerOnFusionStandby(getDeviceID()) && !bIsStandbySearchFrame;
+            const bool bIsShed =
+                !bIsOverloadSearchFrame &&
+                getIsVisionPrioritySheddable(job.vision_priority, job.prior_hmd_pose_estimate.bCurrentlyTracking);
+
+            if (!bIsCulled && !bIsOnStandby && bIsShed)
+            {
+                tracker_manager->addDeferredOpticalSearch();
+            }
+            else if (!bIsCulled && !bIsOnStandby && hmd_view->getTrackingShape(job.tracking_shape))
+            {
+                job.tracking_color_id = hmd_view->getTrackingColorID();
+                if (job.tracking_color_id != eCommonTrackingColorID::INVALID_COLOR)
+                {
+                    getHMDTrackingColorPreset(hmd_view.get(), job.tracking_color_id, &job.hsv_color_range);
                 }
+                job.roi = computeTrackerROIForHMD(this, hmd_view.get(), &job.tracking_shape);
+                job.bRoiDisabled = hmd_view->getIsROIDisabled() || trackerMgrConfig.disable_roi;
+                predictPointCloudLEDVisibility(this, hmd_view->getPoseFilter(), job.tracking_shape, job.bIsLEDVisible);
+
+                jobs.push_back(job);
+            }
+        }
+    }
+
+    // Devices sharing a tracking color get told apart by where their pose filters expect them
+    for (TrackerProjectionJob &job : jobs)
+    {
+        job.shared_color_job_count = 0;
+        for (const TrackerProjectionJob &other_job : jobs)
+        {
+            if (other_job.tracking_color_id == job.tracking_color_id)
+            {
+                ++job.shared_color_job_count;
             }
         }
 
-        return (out_biggest_N_contours.size() > 0);
+        const bool bIsDeviceTracked =
+            job.controller_view != nullptr ? job.controller_view->getIsCurrentlyTracking() : job.hmd_view->getIsCurrentlyTracking();
+        const IPoseFilter *pose_filter =
+            job.controller_view != nullptr ? job.controller_view->getPoseFilter() : job.hmd_view->getPoseFilter();
+
+        job.bHasPredictedPixelLocation =
+            job.shared_color_job_count > 1 &&
+            job.tracking_color_id != eCommonTrackingColorID::INVALID_COLOR &&
+            bIsDeviceTracked &&
+            computePoseFilterPixelLocation(this, pose_filter, job.predicted_pixel_location);
     }
-    
-    void
-    draw_contour(const t_opencv_int_contour &contour)
+}
+
+void ServerTrackerView::gatherCameraNodeJobs(
+    const std::vector<CameraNodeJob> &node_jobs,
+    std::vector<TrackerProjectionJob> &jobs)
+{
+    DeviceManager *device_manager = DeviceManager::getInstance();
+    const cv::Rect2i frame_rect(0, 0, m_opencv_buffer_state->frameWidth, m_opencv_buffer_state->frameHeight);
+
+    for (const CameraNodeJob &node_job : node_jobs)
     {
-        // Draws the contour directly onto the shared mem buffer.
-        // This is useful for debugging
-        std::vector<t_opencv_int_contour> contours = {contour};
-        const cv::Point2f massCenter = computeSafeCenterOfMassForContour<t_opencv_int_contour>(contour);
-        cv::drawContours(*bgrShmemBuffer, contours, 0, cv::Scalar(255, 255, 255));
-        cv::rectangle(*bgrShmemBuffer, cv::boundingRect(contour), cv::Scalar(255, 255, 255));
-        cv::drawMarker(*bgrShmemBuffer, massCenter, cv::Scalar(255, 255, 255), 0,
-            (cv::boundingRect(contour).height < cv::boundingRect(contour).width) ?
-            cv::boundingRect(contour).height : cv::boundingRect(contour).width);
+        TrackerProjectionJob job;
+
+        job.controller_view = nullptr;
+        job.hmd_view = nullptr;
+        job.bIsHMD = node_job.is_hmd != 0;
+        job.device_id = node_job.device_id;
+        job.vision_priority = VisionPriority_Normal; // The host already shed what it had to
+
+        // The results get stored by device id, so the host can't have more devices than this service
+        const int max_device_count =
+            job.bIsHMD ? device_manager->getHMDViewMaxCount() : device_manager->getControllerViewMaxCount();
+        if (job.device_id >= max_device_count)
+        {
+            continue;
+        }
+
+        job.tracking_shape = node_job.tracking_shape;
+        job.bIsMotionless = (node_job.flags & CAMERA_NODE_JOB_FLAG_IS_MOTIONLESS) != 0;
+        job.tracking_color_id =
+            (node_job.tracking_color_id >= 0 && node_job.tracking_color_id < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)
+            ? static_cast<eCommonTrackingColorID>(node_job.tracking_color_id)
+            : eCommonTrackingColorID::INVALID_COLOR;
+        job.hsv_color_range = node_job.hsv_color_range;
+        job.roi = cv::Rect2i(node_job.roi_x, node_job.roi_y, node_job.roi_width, node_job.roi_height) & frame_rect;
+        job.bRoiDisabled = (node_job.flags & CAMERA_NODE_JOB_FLAG_ROI_DISABLED) != 0;
+        job.shared_color_job_count = std::max(static_cast<int>(node_job.shared_color_job_count), 1);
+        job.predicted_pixel_location = cv::Point2f(node_job.predicted_pixel_x, node_job.predicted_pixel_y);
+        job.bHasPredictedPixelLocation = (node_job.flags & CAMERA_NODE_JOB_FLAG_HAS_PREDICTED_PIXEL_LOCATION) != 0;
+        // The camera node doesn't know the HMD's orientation, so every LED takes part
+        std::fill(job.bIsLEDVisible, job.bIsLEDVisible + CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT, true);
+
+        // The host's estimate from this camera's last frame
+        if (job.bIsHMD)
+        {
+            job.prior_hmd_pose_estimate.clear();
+            cameraNodePoseEstimateToPoseEstimate(node_job.prior_pose_estimate, &job.prior_hmd_pose_estimate);
+        }
+        else
+        {
+            job.prior_controller_pose_estimate.clear();
+            cameraNodePoseEstimateToPoseEstimate(node_job.prior_pose_estimate, &job.prior_controller_pose_estimate);
+        }
+
+        jobs.push_back(job);
+    }
+}
+
+void ServerTrackerView::sendCameraNodeJobs(const std::vector<TrackerProjectionJob> &jobs)
+{
+    CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+
+    if (camera_node_link == nullptr)
+    {
+        return;
+    }
+
+    std::vector<CameraNodeJob> node_jobs;
+    node_jobs.reserve(jobs.size());
+
+    for (const TrackerProjectionJob &job : jobs)
+    {
+        CameraNodeJob node_job;
+        memset(&node_job, 0, sizeof(CameraNodeJob));
+
+        node_job.is_hmd = job.bIsHMD ? 1 : 0;
+        node_job.device_id = static_cast<uint8_t>(job.device_id);
+        node_job.flags =
+            (job.bIsMotionless ? CAMERA_NODE_JOB_FLAG_IS_MOTIONLESS : 0) |
+            (job.bRoiDisabled ? CAMERA_NODE_JOB_FLAG_ROI_DISABLED : 0) |
+            (job.bHasPredictedPixelLocation ? CAMERA_NODE_JOB_FLAG_HAS_PREDICTED_PIXEL_LOCATION : 0);
+        node_job.tracking_color_id = static_cast<int8_t>(job.tracking_color_id);
+        node_job.shared_color_job_count = static_cast<uint8_t>(std::min(job.shared_color_job_count, 255));
+        node_job.tracking_shape = job.tracking_shape;
+        if (job.tracking_color_id != eCommonTrackingColorID::INVALID_COLOR)
+        {
+            node_job.hsv_color_range = job.hsv_color_range;
+        }
+        node_job.roi_x = job.roi.x;
+        node_job.roi_y = job.roi.y;
+        node_job.roi_width = job.roi.width;
+        node_job.roi_height = job.roi.height;
+        if (job.bHasPredictedPixelLocation)
+        {
+            node_job.predicted_pixel_x = job.predicted_pixel_location.x;
+            node_job.predicted_pixel_y = job.predicted_pixel_location.y;
+        }
+
+        if (job.bIsHMD)
+        {
+            poseEstimateToCameraNodePoseEstimate(job.prior_hmd_pose_estimate, node_job.prior_pose_estimate);
+        }
+        else
+        {
+            poseEstimateToCameraNodePoseEstimate(job.prior_controller_pose_estimate, node_job.prior_pose_estimate);
+        }
+
+        node_jobs.push_back(node_job);
     }
-    
-    void
-    draw_pose_projection(const CommonDeviceTrackingProjection &pose_projection)
+
+    // An empty job list gets sent too, it stops the camera node's search
+    camera_node_link->sendRemoteCameraJobs(getUSBDevicePath(), node_jobs);
+}
+
+void ServerTrackerView::waitForProjectionWork()
+{
+    if (m_vision_worker != nullptr && m_vision_worker->hasThreadStarted())
     {
-        // Draw the projection of the pose onto the shared mem buffer.
-        switch (pose_projection.shape_type)
-        {
-        case eCommonTrackingProjectionType::ProjectionType_Ellipse:
-            {
-                // For the sphere, its ellipse projection parameters should already
-                // be calculated, so we can use those parameters to draw an ellipse.
+        m_vision_worker->waitForJobs();
+        m_vision_worker->latchResults();
+    }
+}
 
-                //Create cv::ellipse from pose_estimate
-                cv::Point ell_center(
-                    static_cast<int>(pose_projection.shape.ellipse.center.x),
-                    static_cast<int>(pose_projection.shape.ellipse.center.y));
-                cv::Size ell_size(
-                    static_cast<int>(pose_projection.shape.ellipse.half_x_extent),
-                    static_cast<int>(pose_projection.shape.ellipse.half_y_extent));
+bool ServerTrackerView::pollPipelinedProjectionWork()
+{
+    if (m_bIsProjectionWorkInFlight && m_vision_worker->getAreJobsDone())
+    {
+        // Finished without holding up the main thread
+        const long long now_us = ServerUtility::get_service_time_us();
 
-                //Draw ellipse on bgrShmemBuffer
-                cv::ellipse(*bgrShmemBuffer,
-                    ell_center,
-                    ell_size,
-                    pose_projection.shape.ellipse.angle,
-                    0, 360, cv::Scalar(0, 0, 255));
-                cv::drawMarker(*bgrShmemBuffer, ell_center, cv::Scalar(0, 0, 255), 0,
-                    (ell_size.height < ell_size.width) ? ell_size.height * 2 : ell_size.width * 2);
-            } break;
-        case eCommonTrackingProjectionType::ProjectionType_LightBar:
-            {
-                int prev_point_index;
+        m_pipeline_stall_timer->addFrame(now_us, now_us);
+        retireProjectionWork();
+    }
 
-                prev_point_index = CommonDeviceTrackingShape::QuadVertexCount - 1;
-                for (int point_index = 0; point_index < CommonDeviceTrackingShape::QuadVertexCount; ++point_index)
-                {
-                    cv::Point pt1(
-                        static_cast<int>(pose_projection.shape.lightbar.quad[prev_point_index].x),
-                        static_cast<int>(pose_projection.shape.lightbar.quad[prev_point_index].y));
-                    cv::Point pt2(
-                        static_cast<int>(pose_projection.shape.lightbar.quad[point_index].x),
-                        static_cast<int>(pose_projection.shape.lightbar.quad[point_index].y));
-                    cv::line(*bgrShmemBuffer, pt1, pt2, cv::Scalar(0, 0, 255));
+    const bool bHasRetiredWork = m_bHasRetiredProjectionWork;
+    m_bHasRetiredProjectionWork = false;
 
-                    prev_point_index = point_index;
-                }
+    return bHasRetiredWork;
+}
 
-                prev_point_index = CommonDeviceTrackingShape::TriVertexCount - 1;
-                for (int point_index = 0; point_index < CommonDeviceTrackingShape::TriVertexCount; ++point_index)
-                {
-                    cv::Point pt1(
-                        static_cast<int>(pose_projection.shape.lightbar.triangle[prev_point_index].x),
-                        static_cast<int>(pose_projection.shape.lightbar.triangle[prev_point_index].y));
-                    cv::Point pt2(
-                        static_cast<int>(pose_projection.shape.lightbar.triangle[point_index].x),
-                        static_cast<int>(pose_projection.shape.lightbar.triangle[point_index].y));
-                    cv::line(*bgrShmemBuffer, pt1, pt2, cv::Scalar(0, 0, 255));
+void ServerTrackerView::finishPipelinedProjectionWork()
+{
+    if (m_bIsProjectionWorkInFlight)
+    {
+        const long long start_us = ServerUtility::get_service_time_us();
 
-                    prev_point_index = point_index;
-                }
-                
-            } break;
-        case eCommonTrackingProjectionType::ProjectionType_Points:
-            {
-                for (int point_index = 0; point_index < pose_projection.shape.points.point_count; ++point_index)
-                {
-                    cv::Point pt(
-                        static_cast<int>(pose_projection.shape.points.point[point_index].x),
-                        static_cast<int>(pose_projection.shape.points.point[point_index].y));
-                    cv::drawMarker(*bgrShmemBuffer, pt, cv::Scalar(0, 0, 255));
-                }
-            } break;
-        default:
-            assert(false && "unreachable");
-            break;
-        }		
+        m_vision_worker->waitForJobs();
+        m_pipeline_stall_timer->addFrame(start_us, ServerUtility::get_service_time_us());
+        retireProjectionWork();
     }
+}
 
-    int frameWidth;
-    int frameHeight;
+void ServerTrackerView::retireProjectionWork()
+{
+    m_vision_worker->latchResults();
 
-    cv::Mat *bgrBuffer; // source video frame
-    cv::Mat *bgrShmemBuffer; //Frame onto which we draw debug lines, and transmit via shared mem.
-    cv::Mat bgrROI;
-    cv::Mat *hsvBuffer; // source frame converted to HSV color space
-    cv::Mat hsvROI;
-    cv::Mat *gsLowerBuffer; // HSV image clamped by HSV range into grayscale mask
-    cv::Mat gsLowerROI;
-    cv::Mat *gsUpperBuffer; // HSV image clamped by HSV range into grayscale mask
-    cv::Mat gsUpperROI;
-    cv::Mat *maskedBuffer; // bgr image ANDed together with grayscale mask
-    OpenCVBGRToHSVMapper *bgr2hsv; // Used to convert an rgb image to an hsv image
-};
+    m_bIsProjectionWorkInFlight = false;
+    m_bHasRetiredProjectionWork = true;
+    m_projection_capture_timestamp = m_in_flight_capture_timestamp;
+    m_projection_frame_drop_count = m_in_flight_frame_drop_count;
 
-// -- Utility Methods -----
-static glm::quat computeGLMCameraTransformQuaternion(const ITrackerInterface *tracker_device);
-static glm::mat4 computeGLMCameraTransformMatrix(const ITrackerInterface *tracker_device);
-static void computeOpenCVCameraExtrinsicMatrix(const ITrackerInterface *tracker_device,
-                                                      cv::Matx34f &extrinsicOut);
-cv::Mat cvDistCoeffs = cv::Mat(4, 1, cv::DataType<float>::type, 0.f);
-static void computeOpenCVCameraIntrinsicMatrix(const ITrackerInterface *tracker_device,
-                                               cv::Matx33f &intrinsicOut,
-                                               cv::Matx<float, 5, 1> &distortionOut);
-static cv::Matx34f computeOpenCVCameraPinholeMatrix(const ITrackerInterface *tracker_device);
-static bool computeTrackerRelativeLightBarProjection(
-    const CommonDeviceTrackingShape *tracking_shape,
-    const t_opencv_float_contour &opencv_contour,
-    CommonDeviceTrackingProjection *out_projection);
-static bool computeTrackerRelativeLightBarPose(
-    const ITrackerInterface *tracker_device,
-    const CommonDeviceTrackingShape *tracking_shape,
-    const CommonDeviceTrackingProjection *projection,
-    const CommonDevicePose *tracker_relative_pose_guess,
-    ControllerOpticalPoseEstimation *out_pose_estimate);
-static bool computeTrackerRelativePointCloudContourPose(
-    const ITrackerInterface *tracker_device,
-    const CommonDeviceTrackingShape *tracking_shape,
-    const t_opencv_float_contour_list &opencv_contours,
-    const CommonDevicePose *tracker_relative_pose_guess,
-    HMDOpticalPoseEstimation *out_pose_estimate);
-static cv::Rect2i computeTrackerROIForPoseProjection(
-    const bool disabled_roi,
-    const ServerTrackerView *tracker,
-    const IPoseFilter* pose_filter,
-    const CommonDeviceTrackingProjection *prior_tracking_projection,
-    const CommonDeviceTrackingShape *tracking_shape);
-static bool computeBestFitTriangleForContour(
-    const t_opencv_float_contour &opencv_contour,
-    cv::Point2f &out_triangle_top,
-    cv::Point2f &out_triangle_bottom_left,
-    cv::Point2f &out_triangle_bottom_right);
-static bool computeBestFitQuadForContour(
-    const t_opencv_float_contour &opencv_contour,
-    const cv::Point2f &up_hint, 
-    const cv::Point2f &right_hint,
-    cv::Point2f &top_right,
-    cv::Point2f &top_left,
-    cv::Point2f &bottom_left,
-    cv::Point2f &bottom_right);
-static void commonDeviceOrientationToOpenCVRodrigues(
-    const CommonDeviceQuaternion &orientation,
-    cv::Mat &rvec);
-static void openCVRodriguesToAngleAxis(
-    const cv::Mat &rvec,
-    float &axis_x, float &axis_y, float &axis_z, float &radians);
-static void angleAxisVectorToEulerAngles(
-    const float axis_x, const float axis_y, const float axis_z, const float radians,
-    float &yaw, float &pitch, float &roll);
-static void angleAxisVectorToCommonDeviceOrientation(
-    const float axis_x, const float axis_y, const float axis_z, const float radians,
-    CommonDeviceQuaternion &orientation);
+    // The debug overlay of the frame is complete now
+    if (m_bPublishInFlightVideoFrame && m_shared_memory_accesor != nullptr)
+    {
+        writeSharedMemoryVideoFrame();
+    }
+    if (m_bPublishInFlightNetworkVideoFrame)
+    {
+        encodeNetworkVideoFrame();
+    }
+    m_bPublishInFlightVideoFrame = false;
+    m_bPublishInFlightNetworkVideoFrame = false;
+}
 
-//-- public implementation -----
-ServerTrackerView::ServerTrackerView(const int device_id)
-    : ServerDeviceView(device_id)
-    , m_shared_memory_accesor(nullptr)
-    , m_shared_memory_video_stream_count(0)
-    , m_opencv_buffer_state(nullptr)
-    , m_device(nullptr)
+std::chrono::time_point<std::chrono::high_resolution_clock>
+ServerTrackerView::getProjectionResultCaptureTimestamp() const
 {
-    ServerUtility::format_string(m_shared_memory_name, sizeof(m_shared_memory_name), "tracker_view_%d", device_id);
+    return m_bIsVisionPipelined ? m_projection_capture_timestamp : getLastVideoFrameCaptureTimestamp();
 }
 
-ServerTrackerView::~ServerTrackerView()
+int ServerTrackerView::getProjectionResultFrameDropCount() const
 {
-    if (m_shared_memory_accesor != nullptr)
+    return m_bIsVisionPipelined ? m_projection_frame_drop_count : m_last_video_frame_drop_count;
+}
+
+bool ServerTrackerView::tryReuseProjection(
+    const TrackerProjectionJob &job,
+    const CommonDeviceTrackingProjection &projection)
+{
+    if (!job.bIsMotionless || m_opencv_buffer_state == nullptr)
     {
-        delete m_shared_memory_accesor;
+        return false;
     }
 
-    if (m_opencv_buffer_state != nullptr)
+    const TrackerManagerConfig &trackerMgrConfig = DeviceManager::getInstance()->m_tracker_manager->getConfig();
+    OpenCVMotionGate *gate = m_opencv_buffer_state->getMotionGate(job.bIsHMD, job.device_id);
+    const bool bIsUnchanged =
+        gate != nullptr &&
+        gate->bIsValid &&
+        gate->reused_frame_count < trackerMgrConfig.motion_gate_max_reused_frames &&
+        m_opencv_buffer_state->computeMotionGateDifference(*gate) <= trackerMgrConfig.motion_gate_max_pixel_difference;
+
+    if (bIsUnchanged)
     {
-        delete m_opencv_buffer_state;
+        ++gate->reused_frame_count;
+        m_opencv_buffer_state->draw_pose_projection(projection);
     }
 
-    if (m_device != nullptr)
+    return bIsUnchanged;
+}
+
+void ServerTrackerView::updateProjectionMotionGate(const TrackerProjectionJob &job, const bool bProjectionValid)
+{
+    OpenCVMotionGate *gate =
+        (m_opencv_buffer_state != nullptr)
+        ? m_opencv_buffer_state->getMotionGate(job.bIsHMD, job.device_id)
+        : nullptr;
+
+    if (gate == nullptr)
     {
-        delete m_device;
+        return;
+    }
+
+    // Only worth sampling the frame if the next one might get gated
+    gate->bIsValid = bProjectionValid && job.bIsMotionless;
+    gate->reused_frame_count = 0;
+
+    if (gate->bIsValid)
+    {
+        gate->region = m_opencv_buffer_state->currentROI;
+        m_opencv_buffer_state->computeMotionGateThumbnail(gate->region, gate->thumbnail);
     }
 }
 
-CommonDeviceState::eDeviceType
-ServerTrackerView::getTrackerDeviceType() const
+float ServerTrackerView::getProjectionWorkTimeMs() const
 {
-    return m_device->getDeviceType();
+    return (m_vision_worker != nullptr) ? m_vision_worker->getProcessingTimeMs() : 0.f;
 }
 
-ITrackerInterface::eDriverType 
-ServerTrackerView::getTrackerDriverType() const
+float ServerTrackerView::getFrameIngestOccupancy() const
 {
-    return m_device->getDriverType();
+    return m_frame_ingest_timer->getOccupancy();
 }
 
-std::string
-ServerTrackerView::getUSBDevicePath() const
+float ServerTrackerView::getProjectionWorkOccupancy() const
 {
-    return m_device->getUSBDevicePath();
+    return (m_vision_worker != nullptr) ? m_vision_worker->getOccupancy() : 0.f;
 }
 
-std::string 
-ServerTrackerView::getSharedMemoryStreamName() const
+float ServerTrackerView::getPipelineStallTimeMs() const
 {
-    return std::string(m_shared_memory_name);
+    return m_pipeline_stall_timer->getBusyTimeMs();
 }
 
-bool ServerTrackerView::open(const class DeviceEnumerator *enumerator)
+bool ServerTrackerView::fetchControllerProjectionResult(
+    int controller_id,
+    ControllerOpticalPoseEstimation *out_pose_estimate)
 {
-    bool bSuccess = ServerDeviceView::open(enumerator);
+    bool bSuccess = false;
 
-    if (bSuccess)
+    if (m_bIsRemoteCamera)
     {
-        int width, height, stride;
-
-        // Make sure the shared memory block has been removed first
-        boost::interprocess::shared_memory_object::remove(m_shared_memory_name);
+        const CameraNodePoseEstimate *pose_estimate =
+            static_cast<const RemoteTracker *>(m_device)->getProjection(false, controller_id);
 
-        // Query the video frame first so that we know how big to make the buffer
-        if (m_device->getVideoFrameDimensions(&width, &height, &stride))
+        if (pose_estimate != nullptr)
         {
-            assert(m_shared_memory_accesor == nullptr);
-            m_shared_memory_accesor = new SharedVideoFrameReadWriteAccessor();
+            cameraNodePoseEstimateToPoseEstimate(*pose_estimate, out_pose_estimate);
+            bSuccess = true;
+        }
+    }
+    else if (m_vision_worker != nullptr)
+    {
+        bSuccess = m_vision_worker->fetchControllerResult(controller_id, out_pose_estimate);
+    }
 
-            if (!m_shared_memory_accesor->initialize(m_shared_memory_name, width, height, stride))
-            {
-                delete m_shared_memory_accesor;
-                m_shared_memory_accesor = nullptr;
+    return bSuccess;
+}
 
-                SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to allocated shared memory: " << m_shared_memory_name;
-            }
+bool ServerTrackerView::fetchHMDProjectionResult(
+    int hmd_id,
+    HMDOpticalPoseEstimation *out_pose_estimate)
+{
+    bool bSuccess = false;
 
-            // Allocate the OpenCV scratch buffers used for finding tracking blobs
-            m_opencv_buffer_state = new OpenCVBufferState(m_device);
-        }
-        else
+    if (m_bIsRemoteCamera)
+    {
+        const CameraNodePoseEstimate *pose_estimate =
+            static_cast<const RemoteTracker *>(m_device)->getProjection(true, hmd_id);
+
+        if (pose_estimate != nullptr)
         {
-            SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to video frame dimensions";
+            cameraNodePoseEstimateToPoseEstimate(*pose_estimate, out_pose_estimate);
+            bSuccess = true;
         }
     }
+    else if (m_vision_worker != nullptr)
+    {
+        bSuccess = m_vision_worker->fetchHMDResult(hmd_id, out_pose_estimate);
+    }
 
     return bSuccess;
 }
 
-void ServerTrackerView::close()
+void ServerTrackerView::sendCameraNodeProjections()
 {
-    if (m_shared_memory_accesor != nullptr)
+    CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+
+    if (camera_node_link == nullptr || !camera_node_link->getIsNode() || m_device == nullptr)
     {
-        delete m_shared_memory_accesor;
-        m_shared_memory_accesor = nullptr;
+        return;
     }
 
-    ServerDeviceView::close();
-}
+    DeviceManager *device_manager = DeviceManager::getInstance();
+    CameraNodeCameraInfo camera_info;
+    float focal_length_x, focal_length_y, principal_x, principal_y;
+    float distortion_k1, distortion_k2, distortion_k3, distortion_p1, distortion_p2;
+    float hfov, vfov, z_near, z_far;
+
+    // The host's RemoteTracker takes on this camera's mode and lens calibration
+    getCameraIntrinsics(
+        focal_length_x, focal_length_y, principal_x, principal_y,
+        distortion_k1, distortion_k2, distortion_k3, distortion_p1, distortion_p2);
+    getFOV(hfov, vfov);
+    getZRange(z_near, z_far);
+
+    camera_info.frame_width = static_cast<float>(getFrameWidth());
+    camera_info.frame_height = static_cast<float>(getFrameHeight());
+    camera_info.frame_rate = static_cast<float>(getFrameRate());
+    camera_info.focal_length_x = focal_length_x;
+    camera_info.focal_length_y = focal_length_y;
+    camera_info.principal_x = principal_x;
+    camera_info.principal_y = principal_y;
+    camera_info.distortion_k1 = distortion_k1;
+    camera_info.distortion_k2 = distortion_k2;
+    camera_info.distortion_k3 = distortion_k3;
+    camera_info.distortion_p1 = distortion_p1;
+    camera_info.distortion_p2 = distortion_p2;
+    camera_info.hfov = hfov;
+    camera_info.vfov = vfov;
+    camera_info.z_near = z_near;
+    camera_info.z_far = z_far;
+
+    std::vector<CameraNodeProjection> projections;
+
+    for (int controller_id = 0; controller_id < device_manager->getControllerViewMaxCount(); ++controller_id)
+    {
+        ControllerOpticalPoseEstimation pose_estimate;
+        pose_estimate.clear();
 
-void ServerTrackerView::startSharedMemoryVideoStream()
-{
-    ++m_shared_memory_video_stream_count;
+        if (fetchControllerProjectionResult(controller_id, &pose_estimate))
+        {
+            CameraNodeProjection projection;
+
+            projection.is_hmd = 0;
+            projection.device_id = static_cast<uint8_t>(controller_id);
+            poseEstimateToCameraNodePoseEstimate(pose_estimate, projection.pose_estimate);
+            projections.push_back(projection);
+        }
+    }
+
+    for (int hmd_id = 0; hmd_id < device_manager->getHMDViewMaxCount(); ++hmd_id)
+    {
+        HMDOpticalPoseEstimation pose_estimate;
+        pose_estimate.clear();
+
+        if (fetchHMDProjectionResult(hmd_id, &pose_estimate))
+        {
+            CameraNodeProjection projection;
+
+            projection.is_hmd = 1;
+            projection.device_id = static_cast<uint8_t>(hmd_id);
+            poseEstimateToCameraNodePoseEstimate(pose_estimate, projection.pose_estimate);
+            projections.push_back(projection);
+        }
+    }
+
+    // The frames the camera dropped show up on the host as gaps in the sequence numbers
+    m_camera_node_frame_sequence_number += 1 + getProjectionResultFrameDropCount();
+
+    camera_node_link->sendNodeProjections(
+        getDeviceID(),
+        m_camera_node_frame_sequence_number,
+        getProjectionResultCaptureTimestamp(),
+        camera_info,
+        projections);
 }
 
-void ServerTrackerView::stopSharedMemoryVideoStream()
+static void projectionToSharedDeviceProjection(
+    const CommonDeviceTrackingProjection &projection,
+    SharedDeviceProjection &out_device_projection)
 {
-    assert(m_shared_memory_video_stream_count > 0);
-    --m_shared_memory_video_stream_count;
+    const CommonDeviceScreenLocation *points = nullptr;
+    int point_count = 0;
+
+    switch (projection.shape_type)
+    {
+    case eCommonTrackingProjectionType::ProjectionType_Ellipse:
+        out_device_projection.shape_type = SharedProjectionShape_Ellipse;
+        out_device_projection.ellipse_half_x_extent = projection.shape.ellipse.half_x_extent;
+        out_device_projection.ellipse_half_y_extent = projection.shape.ellipse.half_y_extent;
+        out_device_projection.ellipse_angle = projection.shape.ellipse.angle;
+        points = &projection.shape.ellipse.center;
+        point_count = 1;
+        break;
+    case eCommonTrackingProjectionType::ProjectionType_LightBar:
+        // The triangle and quad are laid out back to back
+        out_device_projection.shape_type = SharedProjectionShape_LightBar;
+        points = projection.shape.lightbar.triangle;
+        point_count =
+            CommonDeviceTrackingProjection::TRIANGLE_POINT_COUNT +
+            CommonDeviceTrackingProjection::QUAD_POINT_COUNT;
+        break;
+    case eCommonTrackingProjectionType::ProjectionType_Points:
+        out_device_projection.shape_type = SharedProjectionShape_Points;
+        points = projection.shape.points.point;
+        point_count = std::min(projection.shape.points.point_count, static_cast<int>(CommonDeviceTrackingProjection::MAX_POINT_CLOUD_POINT_COUNT));
+        break;
+    default:
+        out_device_projection.shape_type = SharedProjectionShape_None;
+        break;
+    }
+
+    for (int point_index = 0; point_index < point_count; ++point_index)
+    {
+        out_device_projection.points[point_index][0] = points[point_index].x;
+        out_device_projection.points[point_index][1] = points[point_index].y;
+    }
+
+    out_device_projection.point_count = static_cast<uint8_t>(point_count);
+    out_device_projection.screen_area = projection.screen_area;
+    out_device_projection.fit_residual = projection.fit_residual;
+    out_device_projection.flags |= SHARED_PROJECTION_FLAG_IS_FOUND;
 }
 
-bool ServerTrackerView::poll()
+void ServerTrackerView::writeSharedProjections(SharedTrackerProjectionWriter *writer)
 {
-    bool bSuccess = ServerDeviceView::poll();
-
-    if (bSuccess && m_device != nullptr)
+    DeviceManager *device_manager = DeviceManager::getInstance();
+    const cv::Rect2i frame_rect(0, 0, static_cast<int>(getFrameWidth()), static_cast<int>(getFrameHeight()));
+    SharedTrackerProjectionFrame projection_frame;
+
+    memset(&projection_frame, 0, sizeof(projection_frame));
+    projection_frame.capture_timestamp_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            getProjectionResultCaptureTimestamp().time_since_epoch()).count();
+    projection_frame.frame_width = static_cast<uint16_t>(frame_rect.width);
+    projection_frame.frame_height = static_cast<uint16_t>(frame_rect.height);
+
+    // Controllers first, then HMDs. Once the frame fills up the remaining devices get left out.
+    const int controller_count = device_manager->getControllerViewMaxCount();
+    const int device_count = controller_count + device_manager->getHMDViewMaxCount();
+
+    for (int device_index = 0;
+         device_index < device_count && projection_frame.device_count < SHARED_TRACKER_PROJECTION_MAX_DEVICES;
+         ++device_index)
     {
-        const unsigned char *buffer = m_device->getVideoFrameBuffer();
+        const bool bIsHMD = device_index >= controller_count;
+        const int device_id = bIsHMD ? device_index - controller_count : device_index;
+        SharedDeviceProjection &device_projection = projection_frame.devices[projection_frame.device_count];
+        cv::Rect2i search_roi;
+        bool bHasROI = false;
+        bool bHasDevice = false;
+
+        // Camera nodes don't report where they searched
+        if (!m_bIsRemoteCamera && m_vision_worker != nullptr && m_vision_worker->fetchSearchROI(bIsHMD, device_id, search_roi))
+        {
+            search_roi &= frame_rect;
+            bHasROI = search_roi.area() > 0;
+        }
 
-        if (buffer != nullptr)
+        if (bHasROI)
         {
-            // Cache the raw video frame
-            if (m_opencv_buffer_state != nullptr)
+            device_projection.flags |= SHARED_PROJECTION_FLAG_HAS_ROI;
+            device_projection.roi_x = static_cast<int16_t>(search_roi.x);
+            device_projection.roi_y = static_cast<int16_t>(search_roi.y);
+            device_projection.roi_width = static_cast<int16_t>(search_roi.width);
+            device_projection.roi_height = static_cast<int16_t>(search_roi.height);
+            bHasDevice = true;
+        }
+
+        if (!bIsHMD)
+        {
+            ControllerOpticalPoseEstimation pose_estimate;
+            pose_estimate.clear();
+
+            if (fetchControllerProjectionResult(device_id, &pose_estimate) && pose_estimate.bCurrentlyTracking)
+            {
+                projectionToSharedDeviceProjection(pose_estimate.projection, device_projection);
+                bHasDevice = true;
+            }
+        }
+        else
+        {
+            HMDOpticalPoseEstimation pose_estimate;
+            pose_estimate.clear();
+
+            if (fetchHMDProjectionResult(device_id, &pose_estimate) && pose_estimate.bCurrentlyTracking)
             {
-                m_opencv_buffer_state->writeVideoFrame(buffer);
+                projectionToSharedDeviceProjection(pose_estimate.projection, device_projection);
+                bHasDevice = true;
             }
         }
+
+        if (bHasDevice)
+        {
+            device_projection.device_id = static_cast<uint8_t>(device_id);
+            device_projection.flags |= bIsHMD ? SHARED_PROJECTION_FLAG_IS_HMD : 0;
+            ++projection_frame.device_count;
+        }
+        else
+        {
+            // Hand the entry to the next device
+            memset(&device_projection, 0, sizeof(device_projection));
+        }
     }
 
-    return bSuccess;
+    writer->writeTrackerProjections(getDeviceID(), projection_frame);
 }
 
 bool ServerTrackerView::allocate_device_interface(const class DeviceEnumerator *enumerator)
@@ -908,7 +4769,19 @@ bool ServerTrackerView::allocate_device_interface(const class DeviceEnumerator *
     {
     case CommonDeviceState::PS3EYE:
     {
-        m_device = new PS3EyeTracker();
+        if (DeviceInputLog::get_mode() == DeviceInputLogMode_Replaying)
+        {
+            m_device = new InputLogTracker();
+        }
+        else if (CameraNodeLink::getIsRemoteCameraPath(enumerator->get_path()))
+        {
+            m_device = new RemoteTracker();
+            m_bIsRemoteCamera = true;
+        }
+        else
+        {
+            m_device = new PS3EyeTracker();
+        }
     } break;
     default:
         break;
@@ -927,14 +4800,21 @@ void ServerTrackerView::free_device_interface()
         // for m_device.
         m_device = nullptr;
     }
+
+    m_bIsRemoteCamera = false;
 }
 
 void ServerTrackerView::publish_device_data_frame()
 {
-    // Copy the video frame to shared memory (if requested)
-    if (m_shared_memory_accesor != nullptr && m_shared_memory_video_stream_count > 0)
+    // Copy the video frame to shared memory (if requested).
+    // A frame the pipelined vision worker is still drawing the overlay of gets copied once it's retired.
+    if (m_bPublishVideoFrame && !m_bIsProjectionWorkInFlight)
+    {
+        writeSharedMemoryVideoFrame();
+    }
+    if (m_bPublishNetworkVideoFrame && !m_bIsProjectionWorkInFlight)
     {
-        m_shared_memory_accesor->writeVideoFrame(m_opencv_buffer_state->bgrShmemBuffer->data);
+        encodeNetworkVideoFrame();
     }
     
     // Tell the server request handler we want to send out tracker updates.
@@ -943,6 +4823,80 @@ void ServerTrackerView::publish_device_data_frame()
         this, &ServerTrackerView::generate_tracker_data_frame_for_stream);
 }
 
+void ServerTrackerView::writeSharedMemoryVideoFrame()
+{
+    m_shared_memory_accesor->writeVideoFrame(
+        *m_opencv_buffer_state->bgrBuffer,
+        m_opencv_buffer_state->overlayBuffer->data,
+        m_video_frame_timestamp_us,
+        m_shared_memory_preview);
+}
+
+void ServerTrackerView::encodeNetworkVideoFrame()
+{
+    const cv::Rect2i frame_rect(0, 0, m_opencv_buffer_state->frameWidth, m_opencv_buffer_state->frameHeight);
+    cv::Rect2i roi =
+        cv::Rect2i(
+            m_network_video_settings.roi_x, m_network_video_settings.roi_y,
+            m_network_video_settings.roi_width, m_network_video_settings.roi_height) & frame_rect;
+
+    if (roi.area() <= 0)
+    {
+        roi = frame_rect;
+    }
+
+    // Draw the debug overlay in, the same way the clients composite it over the shared memory frames
+    cv::Mat image = (*m_opencv_buffer_state->bgrBuffer)(roi).clone();
+    const cv::Mat overlay = (*m_opencv_buffer_state->overlayBuffer)(roi);
+
+    for (int y = 0; y < image.rows; ++y)
+    {
+        const unsigned char *overlay_row = overlay.ptr<unsigned char>(y);
+        unsigned char *bgr_row = image.ptr<unsigned char>(y);
+
+        for (int x = 0; x < image.cols; ++x)
+        {
+            if (overlay_row[x] != OverlayColor_None)
+            {
+                SharedVideoFrameHeader::getOverlayColorBGR(overlay_row[x], &bgr_row[x*3]);
+            }
+        }
+    }
+
+    if (m_network_video_settings.max_width > 0 && image.cols > m_network_video_settings.max_width)
+    {
+        const double scale = static_cast<double>(m_network_video_settings.max_width) / static_cast<double>(image.cols);
+        cv::Mat scaled_image;
+
+        cv::resize(image, scaled_image, cv::Size(), scale, scale, cv::INTER_AREA);
+        image = scaled_image;
+    }
+
+    const int quality =
+        (m_network_video_settings.quality > 0)
+        ? std::min(m_network_video_settings.quality, 100)
+        : k_network_video_default_quality;
+    const std::vector<int> encode_params = {cv::IMWRITE_JPEG_QUALITY, quality};
+
+    if (cv::imencode(".jpg", image, m_network_video_frame.jpeg_data, encode_params))
+    {
+        ++m_network_video_frame.frame_index;
+        m_network_video_frame.timestamp_us = m_video_frame_timestamp_us;
+        m_network_video_frame.frame_width = frame_rect.width;
+        m_network_video_frame.frame_height = frame_rect.height;
+        m_network_video_frame.roi_x = roi.x;
+        m_network_video_frame.roi_y = roi.y;
+        m_network_video_frame.roi_width = roi.width;
+        m_network_video_frame.roi_height = roi.height;
+        m_network_video_frame.image_width = image.cols;
+        m_network_video_frame.image_height = image.rows;
+    }
+    else
+    {
+        SERVER_LOG_ERROR("ServerTrackerView::encodeNetworkVideoFrame()") << "Failed to JPEG encode the video frame";
+    }
+}
+
 void ServerTrackerView::generate_tracker_data_frame_for_stream(
     const ServerTrackerView *tracker_view,
     const struct TrackerStreamInfo *stream_info,
@@ -954,6 +4908,7 @@ void ServerTrackerView::generate_tracker_data_frame_for_stream(
     tracker_data_frame->set_tracker_id(tracker_view->getDeviceID());
     tracker_data_frame->set_sequence_num(tracker_view->m_sequence_number);
     tracker_data_frame->set_isconnected(tracker_view->getIsOpen());
+    tracker_data_frame->set_dropped_frame_count(tracker_view->m_dropped_video_frame_count);
 
     switch (tracker_view->getTrackerDeviceType())
     {
@@ -966,6 +4921,7 @@ void ServerTrackerView::generate_tracker_data_frame_for_stream(
     }
 
     data_frame->set_device_category(PSMoveProtocol::DeviceOutputDataFrame::TRACKER);
+    data_frame->set_service_time_us(ServerUtility::get_service_time_us());
 }
 
 void ServerTrackerView::loadSettings()
@@ -973,6 +4929,55 @@ void ServerTrackerView::loadSettings()
     m_device->loadSettings();
 }
 
+bool ServerTrackerView::startSettingsChange(const std::function<void(ITrackerInterface *)> &device_update)
+{
+    if (m_device == nullptr || m_settings_change != nullptr)
+    {
+        return false;
+    }
+
+    // The camera can't change modes under the vision worker
+    finishPipelinedProjectionWork();
+    if (m_vision_worker != nullptr)
+    {
+        m_vision_worker->waitForJobs();
+    }
+
+    m_settings_change = new TrackerSettingsChange(m_device, device_update, getDeviceID());
+
+    return true;
+}
+
+void ServerTrackerView::finishSettingsChange()
+{
+    if (m_settings_change != nullptr)
+    {
+        m_settings_change->wait();
+        retireSettingsChange();
+    }
+}
+
+bool ServerTrackerView::pollSettingsChange()
+{
+    if (m_settings_change != nullptr && m_settings_change->getIsDone())
+    {
+        retireSettingsChange();
+    }
+
+    return m_settings_change != nullptr;
+}
+
+void ServerTrackerView::retireSettingsChange()
+{
+    delete m_settings_change;
+    m_settings_change = nullptr;
+
+    // Swap in the new camera mode, intrinsics and color presets before the next frame gets polled
+    reallocateVideoFrameBuffers();
+    m_camera_matrices->update(m_device);
+    invalidateTrackingColorPresets();
+}
+
 void ServerTrackerView::saveSettings()
 {
     m_device->saveSettings();
@@ -987,96 +4992,212 @@ void ServerTrackerView::setFrameWidth(double value, bool bUpdateConfig)
 {
     if (value == m_device->getFrameWidth()) return;
 
-    // close buffer
-    if (m_shared_memory_accesor != nullptr)
-    {
-        delete m_shared_memory_accesor;
-        m_shared_memory_accesor = nullptr;
-    }
-
     // change frame width
     m_device->setFrameWidth(value, bUpdateConfig);
 
-    // reopen buffer
+    reallocateVideoFrameBuffers();
+}
+
+double ServerTrackerView::getFrameHeight() const
+{
+    return m_device->getFrameHeight();
+}
+
+void ServerTrackerView::setFrameHeight(double value, bool bUpdateConfig)
+{
+    if (value == m_device->getFrameHeight()) return;
+
+    // change frame height
+    m_device->setFrameHeight(value, bUpdateConfig);
+
+    reallocateVideoFrameBuffers();
+}
+
+void ServerTrackerView::reallocateVideoFrameBuffers()
+{
     int width, height, stride;
 
-    // Make sure the shared memory block has been removed first
-    boost::interprocess::shared_memory_object::remove(m_shared_memory_name);
+    // Remote cameras have no video frames here
+    if (m_bIsRemoteCamera)
+    {
+        return;
+    }
 
     // Query the video frame first so that we know how big to make the buffer
-    if (m_device->getVideoFrameDimensions(&width, &height, &stride))
+    if (!m_device->getVideoFrameDimensions(&width, &height, &stride))
     {
-        assert(m_shared_memory_accesor == nullptr);
-        m_shared_memory_accesor = new SharedVideoFrameReadWriteAccessor();
+        SERVER_LOG_ERROR("ServerTrackerView::reallocateVideoFrameBuffers()") << "Failed to video frame dimensions";
+        return;
+    }
 
-        if (!m_shared_memory_accesor->initialize(m_shared_memory_name, width, height, stride))
-        {
-            delete m_shared_memory_accesor;
-            m_shared_memory_accesor = nullptr;
+    // Nothing to do if the camera stayed in the same mode (ex: a tracker running the high speed profile)
+    if (m_opencv_buffer_state != nullptr &&
+        m_opencv_buffer_state->frameWidth == width && m_opencv_buffer_state->frameHeight == height)
+    {
+        return;
+    }
 
-            SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to allocated shared memory: " << m_shared_memory_name;
-        }
+    // The vision worker may still be searching the old buffers
+    finishPipelinedProjectionWork();
+    if (m_vision_worker != nullptr)
+    {
+        m_vision_worker->waitForJobs();
+    }
 
-        // Allocate the OpenCV scratch buffers used for finding tracking blobs
-        m_opencv_buffer_state = new OpenCVBufferState(m_device);
+    // Resize the shared memory video frames of the streams in progress
+    if (m_shared_memory_video_stream_count > 0)
+    {
+        allocateSharedMemoryVideoFrames();
     }
-    else
+
+    // Reallocate the OpenCV scratch buffers used for finding tracking blobs
+    if (m_opencv_buffer_state != nullptr)
     {
-        SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to video frame dimensions";
+        delete m_opencv_buffer_state;
     }
+    m_opencv_buffer_state = new OpenCVBufferState(m_device, m_deviceID);
 }
 
-double ServerTrackerView::getFrameHeight() const
+void ServerTrackerView::allocateSharedMemoryVideoFrames()
 {
-    return m_device->getFrameHeight();
+    int width, height, stride;
+
+    freeSharedMemoryVideoFrames();
+
+    if (m_bIsRemoteCamera || !m_device->getVideoFrameDimensions(&width, &height, &stride))
+    {
+        return;
+    }
+
+    // Make sure the shared memory block has been removed first
+    boost::interprocess::shared_memory_object::remove(m_shared_memory_name);
+
+    m_shared_memory_accesor = new SharedVideoFrameReadWriteAccessor();
+    if (!m_shared_memory_accesor->initialize(m_shared_memory_name, width, height, stride))
+    {
+        delete m_shared_memory_accesor;
+        m_shared_memory_accesor = nullptr;
+
+        SERVER_LOG_ERROR("ServerTrackerView::allocateSharedMemoryVideoFrames()") << "Failed to allocated shared memory: " << m_shared_memory_name;
+    }
 }
 
-void ServerTrackerView::setFrameHeight(double value, bool bUpdateConfig)
+void ServerTrackerView::freeSharedMemoryVideoFrames()
 {
-    if (value == m_device->getFrameHeight()) return;
-
-    // close buffer
     if (m_shared_memory_accesor != nullptr)
     {
         delete m_shared_memory_accesor;
         m_shared_memory_accesor = nullptr;
     }
+}
 
-    // change frame height
-    m_device->setFrameHeight(value, bUpdateConfig);
+size_t ServerTrackerView::getVisionBufferBytes() const
+{
+    return (m_opencv_buffer_state != nullptr) ? m_opencv_buffer_state->getAllocatedBytes() : 0;
+}
 
-    // reopen buffer
-    int width, height, stride;
+size_t ServerTrackerView::getSharedVideoFrameBytes() const
+{
+    return (m_shared_memory_accesor != nullptr) ? m_shared_memory_accesor->getAllocatedBytes() : 0;
+}
 
-    // Make sure the shared memory block has been removed first
-    boost::interprocess::shared_memory_object::remove(m_shared_memory_name);
+size_t ServerTrackerView::getNetworkVideoFrameBytes() const
+{
+    return m_network_video_frame.jpeg_data.capacity();
+}
 
-    // Query the video frame first so that we know how big to make the buffer
-    if (m_device->getVideoFrameDimensions(&width, &height, &stride))
-    {
-        assert(m_shared_memory_accesor == nullptr);
-        m_shared_memory_accesor = new SharedVideoFrameReadWriteAccessor();
+void ServerTrackerView::getBGRToHSVTableBytes(size_t &out_private_bytes, size_t &out_mapped_bytes)
+{
+    OpenCVBGRToHSVMapper::getAllocatedBytes(out_private_bytes, out_mapped_bytes);
+}
 
-        if (!m_shared_memory_accesor->initialize(m_shared_memory_name, width, height, stride))
-        {
-            delete m_shared_memory_accesor;
-            m_shared_memory_accesor = nullptr;
+double ServerTrackerView::getFrameRate() const
+{
+    return m_device->getFrameRate();
+}
 
-            SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to allocated shared memory: " << m_shared_memory_name;
-        }
+void ServerTrackerView::updateAutoExposure()
+{
+    const TrackerManagerConfig &cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
 
-        // Allocate the OpenCV scratch buffers used for finding tracking blobs
-        m_opencv_buffer_state = new OpenCVBufferState(m_device);
+    if (!cfg.use_auto_exposure || m_opencv_buffer_state == nullptr)
+    {
+        return;
     }
-    else
+
+    const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+
+    if (now - m_last_auto_exposure_update < std::chrono::milliseconds(cfg.auto_exposure_interval_ms))
     {
-        SERVER_LOG_ERROR("ServerTrackerView::open()") << "Failed to video frame dimensions";
+        return;
     }
-}
+    m_last_auto_exposure_update = now;
 
-double ServerTrackerView::getFrameRate() const
-{
-    return m_device->getFrameRate();
+    OpenCVExposureStats &stats = m_opencv_buffer_state->exposureStats;
+
+    // Without enough blob pixels a dim blob and no blob at all look the same, so leave the camera alone
+    if (stats.sample_count >= k_auto_exposure_min_sample_count)
+    {
+        const float mean_value = static_cast<float>(stats.value_sum / stats.sample_count);
+        const float saturated_fraction = static_cast<float>(stats.saturated_count) / static_cast<float>(stats.sample_count);
+
+        // Clipped blobs bleed into their neighborhood and lose their hue, so back off first.
+        // Otherwise scale the light that reaches the sensor by how far the blobs are off the target.
+        float correction =
+            (saturated_fraction > cfg.auto_exposure_max_saturated_fraction)
+            ? 1.f / k_auto_exposure_max_step
+            : cfg.auto_exposure_target_value / std::max(mean_value, 1.f);
+        correction = clampf(correction, 1.f / k_auto_exposure_max_step, k_auto_exposure_max_step);
+
+        if (fabsf(correction - 1.f) > k_auto_exposure_dead_band)
+        {
+            const double old_exposure = getExposure();
+            const double old_gain = getGain();
+            double exposure = old_exposure;
+            double gain = old_gain;
+
+            // Brighten with exposure before gain (noise) and darken with gain before exposure,
+            // so the gain only gets used once the exposure is maxed out.
+            // Zero gain still has to be able to grow, so it scales from at least one step.
+            if (correction > 1.f)
+            {
+                exposure = std::min(std::max(exposure, 1.0)*correction, static_cast<double>(cfg.auto_exposure_max_exposure));
+
+                const double remaining = correction*std::max(old_exposure, 1.0) / std::max(exposure, 1.0);
+                if (remaining > 1.0 + k_auto_exposure_dead_band)
+                {
+                    gain = std::min(std::max(gain, 1.0)*remaining, static_cast<double>(cfg.auto_exposure_max_gain));
+                }
+            }
+            else
+            {
+                gain = std::max(gain*correction, static_cast<double>(cfg.auto_exposure_min_gain));
+
+                const double remaining = (old_gain > 0.0 && gain > 0.0) ? correction*old_gain / gain : correction;
+                if (remaining < 1.0 - k_auto_exposure_dead_band)
+                {
+                    exposure = std::max(exposure*remaining, static_cast<double>(cfg.auto_exposure_min_exposure));
+                }
+            }
+
+            // The camera settings are whole steps.
+            // Don't touch the tracker configs, the configured values are where a restart starts from.
+            exposure = std::round(exposure);
+            gain = std::round(gain);
+
+            if (exposure != std::round(old_exposure))
+            {
+                setExposure(exposure, false);
+            }
+
+            if (gain != std::round(old_gain))
+            {
+                setGain(gain, false);
+            }
+        }
+    }
+
+    stats.clear();
 }
 
 void ServerTrackerView::setFrameRate(double value, bool bUpdateConfig)
@@ -1128,6 +5249,7 @@ void ServerTrackerView::setCameraIntrinsics(
         principalX, principalY,
         distortionK1, distortionK2, distortionK3,
         distortionP1, distortionP2);
+    m_camera_matrices->update(m_device);
 }
 
 CommonDevicePose ServerTrackerView::getTrackerPose() const
@@ -1139,6 +5261,7 @@ void ServerTrackerView::setTrackerPose(
     const struct CommonDevicePose *pose)
 {
     m_device->setTrackerPose(pose);
+    m_camera_matrices->update(m_device);
 }
 
 void ServerTrackerView::getPixelDimensions(float &outWidth, float &outHeight) const
@@ -1199,98 +5322,301 @@ void ServerTrackerView::setControllerTrackingColorPreset(
     eCommonTrackingColorID color, 
     const CommonHSVColorRange *preset)
 {
-    std::string controller_id= (controller != nullptr) ? controller->getConfigIdentifier() : "";
+    std::string controller_id= (controller != nullptr) ? controller->getConfigIdentifier() : "";
+
+    m_device->setTrackingColorPreset(controller_id, color, preset);
+    invalidateTrackingColorPresets();
+}
+
+void ServerTrackerView::getControllerTrackingColorPreset(
+    const class ServerControllerView *controller,
+    eCommonTrackingColorID color,
+    CommonHSVColorRange *out_preset) const
+{
+    if (controller == nullptr || !ServerUtility::is_index_valid(controller->getDeviceID(), static_cast<int>(m_controller_color_presets.size())))
+    {
+        return m_device->getTrackingColorPreset("", color, out_preset);
+    }
+
+    TrackerColorPresetHandle &handle = m_controller_color_presets[controller->getDeviceID()];
+
+    if (!handle.bIsResolved)
+    {
+        resolveTrackingColorPresets(controller->getConfigIdentifier(), handle);
+    }
+
+    *out_preset = handle.color_presets[color];
+}
+
+void ServerTrackerView::setHMDTrackingColorPreset(
+    const class ServerHMDView *hmd,
+    eCommonTrackingColorID color,
+    const CommonHSVColorRange *preset)
+{
+    std::string hmd_id = (hmd != nullptr) ? hmd->getConfigIdentifier() : "";
+
+    m_device->setTrackingColorPreset(hmd_id, color, preset);
+    invalidateTrackingColorPresets();
+}
+
+void ServerTrackerView::getHMDTrackingColorPreset(
+    const class ServerHMDView *hmd,
+    eCommonTrackingColorID color,
+    CommonHSVColorRange *out_preset) const
+{
+    if (hmd == nullptr || !ServerUtility::is_index_valid(hmd->getDeviceID(), static_cast<int>(m_hmd_color_presets.size())))
+    {
+        return m_device->getTrackingColorPreset("", color, out_preset);
+    }
+
+    TrackerColorPresetHandle &handle = m_hmd_color_presets[hmd->getDeviceID()];
+
+    if (!handle.bIsResolved)
+    {
+        resolveTrackingColorPresets(hmd->getConfigIdentifier(), handle);
+    }
+
+    *out_preset = handle.color_presets[color];
+}
+
+void ServerTrackerView::invalidateTrackingColorPresets()
+{
+    for (TrackerColorPresetHandle &handle : m_controller_color_presets)
+    {
+        handle.bIsResolved = false;
+    }
+
+    for (TrackerColorPresetHandle &handle : m_hmd_color_presets)
+    {
+        handle.bIsResolved = false;
+    }
+}
+
+void ServerTrackerView::resolveTrackingColorPresets(
+    const std::string &device_identifier,
+    TrackerColorPresetHandle &handle) const
+{
+    for (int color_index = 0; color_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++color_index)
+    {
+        m_device->getTrackingColorPreset(
+            device_identifier, static_cast<eCommonTrackingColorID>(color_index), &handle.color_presets[color_index]);
+    }
 
-    return m_device->setTrackingColorPreset(controller_id, color, preset);
+    handle.bIsResolved = true;
 }
 
-void ServerTrackerView::getControllerTrackingColorPreset(
+bool ServerTrackerView::computeControllerTrackingColorPresetFromHistogram(
     const class ServerControllerView *controller,
     eCommonTrackingColorID color,
-    CommonHSVColorRange *out_preset) const
+    CommonHSVColorRange *out_preset)
 {
-    std::string controller_id= (controller != nullptr) ? controller->getConfigIdentifier() : "";
+    bool bSuccess = false;
 
-    return m_device->getTrackingColorPreset(controller_id, color, out_preset);
+    if (m_opencv_buffer_state != nullptr && controller != nullptr &&
+        color >= 0 && color < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)
+    {
+        CommonDeviceTrackingShape tracking_shape;
+        cv::Rect2i ROI(0, 0, m_opencv_buffer_state->frameWidth, m_opencv_buffer_state->frameHeight);
+
+        // Only look around the controller if this tracker already sees it
+        if (controller->getTrackingShape(tracking_shape))
+        {
+            ROI = computeTrackerROIForController(this, controller, &tracking_shape);
+        }
+
+        bSuccess = m_opencv_buffer_state->computeColorRangeFromHistogram(
+            ROI, k_default_color_presets[color].hue_range.center, *out_preset);
+    }
+
+    return bSuccess;
 }
 
-void ServerTrackerView::setHMDTrackingColorPreset(
+bool ServerTrackerView::computeHMDTrackingColorPresetFromHistogram(
     const class ServerHMDView *hmd,
     eCommonTrackingColorID color,
-    const CommonHSVColorRange *preset)
+    CommonHSVColorRange *out_preset)
 {
-    std::string hmd_id = (hmd != nullptr) ? hmd->getConfigIdentifier() : "";
+    bool bSuccess = false;
+
+    if (m_opencv_buffer_state != nullptr && hmd != nullptr &&
+        color >= 0 && color < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)
+    {
+        CommonDeviceTrackingShape tracking_shape;
+        cv::Rect2i ROI(0, 0, m_opencv_buffer_state->frameWidth, m_opencv_buffer_state->frameHeight);
+
+        // Only look around the HMD if this tracker already sees it
+        if (hmd->getTrackingShape(tracking_shape))
+        {
+            ROI = computeTrackerROIForHMD(this, hmd, &tracking_shape);
+        }
+
+        bSuccess = m_opencv_buffer_state->computeColorRangeFromHistogram(
+            ROI, k_default_color_presets[color].hue_range.center, *out_preset);
+    }
 
-    return m_device->setTrackingColorPreset(hmd_id, color, preset);
+    return bSuccess;
 }
 
-void ServerTrackerView::getHMDTrackingColorPreset(
-    const class ServerHMDView *hmd,
-    eCommonTrackingColorID color,
-    CommonHSVColorRange *out_preset) const
+void
+ServerTrackerView::segmentTrackingColors(const std::vector<TrackerProjectionJob> &jobs)
 {
-    std::string hmd_id = (hmd != nullptr) ? hmd->getConfigIdentifier() : "";
+    eCommonTrackingColorID color_ids[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    CommonHSVColorRange color_ranges[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    int color_count = 0;
+    cv::Rect2i search_rois[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    eCommonTrackingColorID reacquisition_color_ids[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    CommonHSVColorRange reacquisition_color_ranges[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    int reacquisition_color_count = 0;
+
+    // Gather the color and search region of every device we're going to look for.
+    // Each device has a unique tracking color, so there is at most one entry per color.
+    for (const TrackerProjectionJob &job : jobs)
+    {
+        if (color_count + reacquisition_color_count >= eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)
+        {
+            break;
+        }
+
+        const eCommonTrackingColorID color_id = job.tracking_color_id;
+
+        if (color_id == eCommonTrackingColorID::INVALID_COLOR)
+        {
+            continue;
+        }
+
+        // Lost devices get searched for in the reacquisition pyramid instead
+        const bool bIsTracking =
+            !job.bIsHMD
+            ? job.prior_controller_pose_estimate.bCurrentlyTracking
+            : job.prior_hmd_pose_estimate.bCurrentlyTracking;
+
+        if (getUseCoarseReacquisition(job.bRoiDisabled, bIsTracking))
+        {
+            reacquisition_color_ids[reacquisition_color_count] = color_id;
+            reacquisition_color_ranges[reacquisition_color_count] = job.hsv_color_range;
+            ++reacquisition_color_count;
+        }
+        else
+        {
+            color_ids[color_count] = color_id;
+            color_ranges[color_count] = job.hsv_color_range;
+            search_rois[color_count] = job.roi;
+            ++color_count;
+        }
+    }
+
+    // Only worth doing when more than one color is being searched for.
+    // Devices close to each other in the frame share a region, so their pixels only get converted and classified once.
+    if (color_count > 1)
+    {
+        cv::Rect2i search_regions[k_max_search_regions];
+        const int region_count = planSearchRegions(search_rois, color_count, search_regions);
 
-    return m_device->getTrackingColorPreset(hmd_id, color, out_preset);
+        m_opencv_buffer_state->segmentColors(search_regions, region_count, color_ids, color_ranges, color_count);
+    }
+
+    // The pyramid levels get labeled for all of the lost devices at once, the first time one of them is searched
+    m_opencv_buffer_state->setReacquisitionColors(reacquisition_color_ids, reacquisition_color_ranges, reacquisition_color_count);
 }
 
 bool
 ServerTrackerView::computeProjectionForController(
-    const ServerControllerView* tracked_controller,
-    const CommonDeviceTrackingShape *tracking_shape,
+    const TrackerProjectionJob &job,
     ControllerOpticalPoseEstimation *out_pose_estimate)
 {
-    bool bSuccess = true;
+    const CommonDeviceTrackingShape *tracking_shape = &job.tracking_shape;
 
     // Get the HSV filter used to find the tracking blob
-    CommonHSVColorRange hsvColorRange;
-    if (bSuccess)
+    const eCommonTrackingColorID tracked_color_id = job.tracking_color_id;
+    const CommonHSVColorRange &hsvColorRange = job.hsv_color_range;
+    bool bSuccess = tracked_color_id != eCommonTrackingColorID::INVALID_COLOR;
+
+    // The region of interest in the tracker buffer around where we expect to find the tracking shape
+    const TrackerManagerConfig &trackerMgrConfig= DeviceManager::getInstance()->m_tracker_manager->getConfig();
+    const bool bRoiDisabled = job.bRoiDisabled;
+    cv::Rect2i ROI= job.roi;
+
+    // If we lost track of the controller, find it in the reacquisition pyramid first
+    // rather than searching the whole frame at full resolution
+    const bool bIsTracking = job.prior_controller_pose_estimate.bCurrentlyTracking;
+    if (bSuccess && getUseCoarseReacquisition(bRoiDisabled, bIsTracking))
     {
-        eCommonTrackingColorID tracked_color_id = tracked_controller->getTrackingColorID();
+        bSuccess = 
+            m_opencv_buffer_state->computeReacquisitionROI(
+                tracked_color_id, hsvColorRange, trackerMgrConfig.reacquisition_pyramid_levels, 1, ROI);
+    }
+
+    m_opencv_buffer_state->applyROI(ROI);
 
-        if (tracked_color_id != eCommonTrackingColorID::INVALID_COLOR)
+    // Find the contour associated with the controller.
+    // A sphere only needs the boundary of the biggest blob, which is cheaper to label than to trace.
+    const OpenCVBlobSelection blob_selection = makeBlobSelection(job);
+    OpenCVContourScratch &contour_scratch = m_opencv_buffer_state->contourScratch;
+    t_opencv_int_contour_list &biggest_contours = contour_scratch.biggestContours;
+    std::vector<double> &contour_areas = contour_scratch.contourAreas;
+    OpenCVBlobInfo &biggest_blob = contour_scratch.biggestBlob;
+    if (bSuccess)
+    {
+        if (tracking_shape->shape_type == eCommonTrackingShapeType::Sphere)
         {
-            getControllerTrackingColorPreset(tracked_controller, tracked_color_id, &hsvColorRange);
+            bSuccess = m_opencv_buffer_state->computeBiggestBlob(tracked_color_id, hsvColorRange, biggest_blob, &blob_selection);
+
+            if (bSuccess)
+            {
+                m_opencv_buffer_state->accumulateExposureStats(biggest_blob.bounding_box, hsvColorRange);
+            }
         }
         else
         {
-            bSuccess = false;
-        }
-    }
+            bSuccess = 
+                m_opencv_buffer_state->computeBiggestNContours(
+                    tracked_color_id, hsvColorRange, biggest_contours, contour_areas, blob_selection.candidate_count);
 
-    // Compute a region of interest in the tracker buffer around where we expect to find the tracking shape
-    const TrackerManagerConfig &trackerMgrConfig= DeviceManager::getInstance()->m_tracker_manager->getConfig();
-    const bool bRoiDisabled = tracked_controller->getIsROIDisabled() || trackerMgrConfig.disable_roi;
+            // With a shared tracking color the light bar is one of the few biggest contours
+            if (bSuccess && blob_selection.candidate_count > 1)
+            {
+                std::vector<cv::Point2f> &contour_centers = contour_scratch.contourCenters;
+                contour_centers.clear();
+                for (const t_opencv_int_contour &contour : biggest_contours)
+                {
+                    const cv::Rect2i bounds = cv::boundingRect(contour);
 
-    const ControllerOpticalPoseEstimation *priorPoseEst= 
-        tracked_controller->getTrackerPoseEstimate(this->getDeviceID());
-    const bool bIsTracking = priorPoseEst->bCurrentlyTracking;
+                    contour_centers.push_back(cv::Point2f(bounds.x + 0.5f*bounds.width, bounds.y + 0.5f*bounds.height));
+                }
 
-    cv::Rect2i ROI= computeTrackerROIForPoseProjection(
-        bRoiDisabled,
-        this,		
-        bIsTracking ? tracked_controller->getPoseFilter() : nullptr,
-        bIsTracking ? &priorPoseEst->projection : nullptr,
-        tracking_shape);
+                const int contour_index = m_opencv_buffer_state->selectBlobCandidate(tracked_color_id, blob_selection, contour_centers);
+                if (contour_index > 0)
+                {
+                    std::swap(biggest_contours[0], biggest_contours[contour_index]);
+                    std::swap(contour_areas[0], contour_areas[contour_index]);
+                }
 
-    m_opencv_buffer_state->applyROI(ROI);
+                bSuccess = contour_index >= 0;
+            }
 
-    // Find the contour associated with the controller
-    t_opencv_int_contour_list biggest_contours;
-    std::vector<double> contour_areas;
-    if (bSuccess)
-    {
-        bSuccess = m_opencv_buffer_state->computeBiggestNContours(hsvColorRange, biggest_contours, contour_areas, 1);
+            if (bSuccess)
+            {
+                m_opencv_buffer_state->accumulateExposureStats(cv::boundingRect(biggest_contours[0]), hsvColorRange);
+            }
+        }
+
+        if (bSuccess && blob_selection.candidate_count > 1)
+        {
+            m_opencv_buffer_state->claimBlob(
+                tracked_color_id, 
+                (tracking_shape->shape_type == eCommonTrackingShapeType::Sphere) ? biggest_blob.bounding_box : cv::boundingRect(biggest_contours[0]));
+        }
     }
     
     // Process the contour for its 2D and 3D pose.
     if (bSuccess)
     {
+        SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_PoseFit, job.device_id, getDeviceID());
+
         // Get camera parameters.
         // Needed for undistortion.
-        cv::Matx33f camera_matrix;
-        cv::Matx<float, 5, 1> distortions;
-        computeOpenCVCameraIntrinsicMatrix(m_device, camera_matrix, distortions);
+        m_undistortion_grid->update(m_device);
+        const cv::Matx33f &camera_matrix = m_undistortion_grid->getCameraMatrix();
                 
         // Compute the tracker relative 3d position of the controller from the contour
         switch (tracking_shape->shape_type)
@@ -1298,44 +5624,47 @@ ServerTrackerView::computeProjectionForController(
         // For the sphere projection we can go ahead and compute the full pose estimation now
         case eCommonTrackingShapeType::Sphere:
             {
-                // Compute the convex hull of the contour
-                t_opencv_int_contour convex_contour;
-                cv::convexHull(biggest_contours[0], convex_contour);
+                // Compute the convex hull of the sampled blob boundary.
+                // Only the hull points get undistorted and fit.
+                t_opencv_int_contour &convex_contour = contour_scratch.convexContour;
+                cv::convexHull(biggest_blob.boundary_samples, convex_contour);
                 m_opencv_buffer_state->draw_contour(convex_contour);
 
                 // Convert integer to float
-                t_opencv_float_contour convex_contour_f;
-                cv::Mat(convex_contour).convertTo(convex_contour_f, cv::Mat(convex_contour_f).type());
+                t_opencv_float_contour &convex_contour_f = contour_scratch.convexContourF;
+                convex_contour_f.resize(convex_contour.size());
+                for (size_t point_index = 0; point_index < convex_contour.size(); ++point_index)
+                {
+                    convex_contour_f[point_index] = cv::Point2f(convex_contour[point_index]);
+                }
 
                 // Undistort points
-                t_opencv_float_contour undistort_contour;  //destination for undistorted contour
-                cv::undistortPoints(convex_contour_f, undistort_contour,
-                                    camera_matrix,
-                                    distortions);//,
-                                    //cv::noArray(),
-                                    //camera_matrix);
-                // Note: if we omit the last two arguments, then
-                // undistort_contour points are in 'normalized' space.
+                t_opencv_float_contour &undistort_contour = contour_scratch.undistortedContour;  //destination for undistorted contour
+                m_undistortion_grid->undistortPointsNormalized(convex_contour_f, undistort_contour);
+                // Note: undistort_contour points are in 'normalized' space.
                 // i.e., they are relative to their F_PX,F_PY
                 
-                // Compute the sphere center AND the projected ellipse
+                // Compute the sphere center AND the projected ellipse.
+                // cv::Point2f is a packed (x, y) float pair, so the contour can be fit in place.
                 Eigen::Vector3f sphere_center;
                 EigenFitEllipse ellipse_projection;
-
-                std::vector<Eigen::Vector2f> eigen_contour;
-                std::for_each(undistort_contour.begin(),
-                              undistort_contour.end(),
-                              [&eigen_contour](cv::Point2f& p) {
-                                  eigen_contour.push_back(Eigen::Vector2f(p.x, p.y));
-                              });
-                eigen_alignment_fit_focal_cone_to_sphere(eigen_contour.data(),
-                                                         static_cast<int>(eigen_contour.size()),
-                                                         tracking_shape->shape.sphere.radius_cm,
-                                                         1, //I was expecting this to be -1. Is it +1 because we're using -F_PY?
-                                                         &sphere_center,
-                                                         &ellipse_projection);
-                
-                if (ellipse_projection.area > k_real_epsilon)
+                ellipse_projection.area = 0.f;
+
+                const float fit_residual =
+                    eigen_alignment_fit_focal_cone_to_sphere_fast(reinterpret_cast<const float *>(undistort_contour.data()),
+                                                                  static_cast<int>(undistort_contour.size()),
+                                                                  tracking_shape->shape.sphere.radius_cm,
+                                                                  1, //I was expecting this to be -1. Is it +1 because we're using -F_PY?
+                                                                  &sphere_center,
+                                                                  &ellipse_projection);
+
+                // Drop frames where the blob doesn't look like a sphere (partially occluded, merged with a reflection, ...)
+                // before doing any more work with them
+                const bool bIsGoodFit =
+                    fit_residual >= 0.f &&
+                    (trackerMgrConfig.max_sphere_fit_residual <= 0.f || fit_residual <= trackerMgrConfig.max_sphere_fit_residual);
+
+                if (bIsGoodFit && ellipse_projection.area > k_real_epsilon)
                 {
                     //Save the optically-estimate 3D pose.
                     out_pose_estimate->position_cm.set(sphere_center.x(), sphere_center.y(), sphere_center.z());
@@ -1347,6 +5676,7 @@ ServerTrackerView::computeProjectionForController(
                     // Save off the projection of the sphere (an ellipse)
                     out_pose_estimate->projection.shape.ellipse.angle = ellipse_projection.angle;
                     out_pose_estimate->projection.screen_area= ellipse_projection.area;
+                    out_pose_estimate->projection.fit_residual= fit_residual;
                     //The ellipse projection is still in normalized space.
                     //i.e., it is a 2-dimensional ellipse floating somewhere.
                     //We must reproject it onto the camera.
@@ -1366,6 +5696,10 @@ ServerTrackerView::computeProjectionForController(
 
                     bSuccess = true;
                 }
+                else
+                {
+                    bSuccess = false;
+                }
             } break;
         // For the LightBar projection we only want to compute the projection shape.
         // The pose estimation is deferred until we know if we can leverage triangulation or not.
@@ -1374,23 +5708,25 @@ ServerTrackerView::computeProjectionForController(
                 // Draw the raw source contour
                 m_opencv_buffer_state->draw_contour(biggest_contours[0]);
 
+                OpenCVLightBarFitScratch &scratch = m_opencv_buffer_state->lightBarFitScratch;
+
                 // Convert integer contour to float
-                t_opencv_float_contour biggest_contour_f;
-                cv::Mat(biggest_contours[0]).convertTo(biggest_contour_f, cv::Mat(biggest_contour_f).type());
+                const t_opencv_int_contour &biggest_contour = biggest_contours[0];
+                scratch.contour.resize(biggest_contour.size());
+                for (size_t point_index = 0; point_index < biggest_contour.size(); ++point_index)
+                {
+                    scratch.contour[point_index] = cv::Point2f(biggest_contour[point_index]);
+                }
 
                 // Compute an undistorted version of the contour
-                t_opencv_float_contour undistort_contour;
-                cv::undistortPoints(biggest_contour_f, undistort_contour,
-                                    camera_matrix,
-                                    distortions,
-                                    cv::noArray(),
-                                    camera_matrix);
+                m_undistortion_grid->undistortPointsPixels(scratch.contour, scratch.undistortedContour);
 
                 // Compute the lightbar tracking projection from the undistored contour
                 bSuccess=
                     computeTrackerRelativeLightBarProjection(
                         tracking_shape,
-                        undistort_contour,
+                        scratch.undistortedContour,
+                        scratch,
                         &out_pose_estimate->projection);
 
                 //Draw results onto m_opencv_buffer_state
@@ -1419,104 +5755,128 @@ ServerTrackerView::computeProjectionForController(
 }
 
 bool ServerTrackerView::computeProjectionForHMD(
-    const class ServerHMDView* tracked_hmd,
-    const struct CommonDeviceTrackingShape *tracking_shape,
+    const TrackerProjectionJob &job,
     struct HMDOpticalPoseEstimation *out_pose_estimate)
 {
-    bool bSuccess = true;
+    const CommonDeviceTrackingShape *tracking_shape = &job.tracking_shape;
 
     // Get the HSV filter used to find the tracking blob
-    CommonHSVColorRange hsvColorRange;
-    if (bSuccess)
-    {
-        eCommonTrackingColorID tracked_color_id = tracked_hmd->getTrackingColorID();
-
-        if (tracked_color_id != eCommonTrackingColorID::INVALID_COLOR)
-        {
-            getHMDTrackingColorPreset(tracked_hmd, tracked_color_id, &hsvColorRange);
-        }
-        else
-        {
-            bSuccess = false;
-        }
-    }
+    const eCommonTrackingColorID tracked_color_id = job.tracking_color_id;
+    const CommonHSVColorRange &hsvColorRange = job.hsv_color_range;
+    bool bSuccess = tracked_color_id != eCommonTrackingColorID::INVALID_COLOR;
     
-    // Compute a region of interest in the tracker buffer around where we expect to find the tracking shape
+    // The region of interest in the tracker buffer around where we expect to find the tracking shape
     const TrackerManagerConfig &trackerMgrConfig= DeviceManager::getInstance()->m_tracker_manager->getConfig();
-    const bool bRoiDisabled = tracked_hmd->getIsROIDisabled() || trackerMgrConfig.disable_roi;
+    const bool bRoiDisabled = job.bRoiDisabled;
+    cv::Rect2i ROI = job.roi;
 
-    const HMDOpticalPoseEstimation *priorPoseEst= 
-        tracked_hmd->getTrackerPoseEstimate(this->getDeviceID());
-    const bool bIsTracking = priorPoseEst->bCurrentlyTracking;
+    // If we lost track of the HMD, find it in the reacquisition pyramid first
+    // rather than searching the whole frame at full resolution
+    const bool bIsTracking = job.prior_hmd_pose_estimate.bCurrentlyTracking;
+    if (bSuccess && getUseCoarseReacquisition(bRoiDisabled, bIsTracking))
+    {
+        bSuccess = 
+            m_opencv_buffer_state->computeReacquisitionROI(
+                tracked_color_id, hsvColorRange, trackerMgrConfig.reacquisition_pyramid_levels, 
+                CommonDeviceTrackingProjection::MAX_POINT_CLOUD_POINT_COUNT, ROI);
+    }
 
-    cv::Rect2i ROI = computeTrackerROIForPoseProjection(
-        bRoiDisabled,
-        this, 
-        bIsTracking ? tracked_hmd->getPoseFilter() : nullptr,
-        bIsTracking ? &priorPoseEst->projection : nullptr,
-        tracking_shape);
     m_opencv_buffer_state->applyROI(ROI);
 
-    // Find the N best contours associated with the HMD
-    t_opencv_int_contour_list biggest_contours;
-    std::vector<double> contour_areas;
+    // Find the N best contours associated with the HMD.
+    // A sphere only needs the boundary of the biggest blob, which is cheaper to label than to trace.
+    // Point clouds use all of the biggest contours, so only sphere HMDs can share a tracking color.
+    const OpenCVBlobSelection blob_selection = makeBlobSelection(job);
+    OpenCVContourScratch &contour_scratch = m_opencv_buffer_state->contourScratch;
+    t_opencv_int_contour_list &biggest_contours = contour_scratch.biggestContours;
+    std::vector<double> &contour_areas = contour_scratch.contourAreas;
+    OpenCVBlobInfo &biggest_blob = contour_scratch.biggestBlob;
     if (bSuccess)
     {
-        bSuccess = 
-            m_opencv_buffer_state->computeBiggestNContours(
-                hsvColorRange, biggest_contours, contour_areas, CommonDeviceTrackingProjection::MAX_POINT_CLOUD_POINT_COUNT);
+        if (tracking_shape->shape_type == eCommonTrackingShapeType::Sphere)
+        {
+            bSuccess = m_opencv_buffer_state->computeBiggestBlob(tracked_color_id, hsvColorRange, biggest_blob, &blob_selection);
+
+            if (bSuccess)
+            {
+                m_opencv_buffer_state->accumulateExposureStats(biggest_blob.bounding_box, hsvColorRange);
+
+                if (blob_selection.candidate_count > 1)
+                {
+                    m_opencv_buffer_state->claimBlob(tracked_color_id, biggest_blob.bounding_box);
+                }
+            }
+        }
+        else
+        {
+            bSuccess = 
+                m_opencv_buffer_state->computeBiggestNContours(
+                    tracked_color_id, hsvColorRange, biggest_contours, contour_areas, CommonDeviceTrackingProjection::MAX_POINT_CLOUD_POINT_COUNT);
+
+            if (bSuccess)
+            {
+                for (const t_opencv_int_contour &contour : biggest_contours)
+                {
+                    m_opencv_buffer_state->accumulateExposureStats(cv::boundingRect(contour), hsvColorRange);
+                }
+            }
+        }
     }
 
     // Compute the tracker relative 3d position of the controller from the contour
     if (bSuccess)
     {
-        cv::Matx33f camera_matrix;
-        cv::Matx<float, 5, 1> distortions;
-        computeOpenCVCameraIntrinsicMatrix(m_device, camera_matrix, distortions);
+        SERVER_TRACE_TRACKER_SCOPE(ServerTraceStage_PoseFit, job.device_id, getDeviceID());
+
+        m_undistortion_grid->update(m_device);
+        const cv::Matx33f &camera_matrix = m_undistortion_grid->getCameraMatrix();
 
         switch (tracking_shape->shape_type)
         {
         // For the sphere projection we can go ahead and compute the full pose estimation now
         case eCommonTrackingShapeType::Sphere:
             {
-                // Compute the convex hull of the contour
-                t_opencv_int_contour convex_contour;
-                cv::convexHull(biggest_contours[0], convex_contour);
+                // Compute the convex hull of the sampled blob boundary.
+                // Only the hull points get undistorted and fit.
+                t_opencv_int_contour &convex_contour = contour_scratch.convexContour;
+                cv::convexHull(biggest_blob.boundary_samples, convex_contour);
                 m_opencv_buffer_state->draw_contour(convex_contour);
 
                 // Convert integer to float
-                t_opencv_float_contour convex_contour_f;
-                cv::Mat(convex_contour).convertTo(convex_contour_f, cv::Mat(convex_contour_f).type());
+                t_opencv_float_contour &convex_contour_f = contour_scratch.convexContourF;
+                convex_contour_f.resize(convex_contour.size());
+                for (size_t point_index = 0; point_index < convex_contour.size(); ++point_index)
+                {
+                    convex_contour_f[point_index] = cv::Point2f(convex_contour[point_index]);
+                }
 
                 // Undistort points
-                t_opencv_float_contour undistorted_contour;  //destination for undistorted contour
-                cv::undistortPoints(convex_contour_f, undistorted_contour,
-                                    camera_matrix,
-                                    distortions);//,
-                                    //cv::noArray(),
-                                    //camera_matrix);
-                // Note: if we omit the last two arguments, then
-                // undistort_contour points are in 'normalized' space.
+                t_opencv_float_contour &undistorted_contour = contour_scratch.undistortedContour;  //destination for undistorted contour
+                m_undistortion_grid->undistortPointsNormalized(convex_contour_f, undistorted_contour);
+                // Note: undistort_contour points are in 'normalized' space.
                 // i.e., they are relative to their F_PX,F_PY
                 
-                // Compute the sphere center AND the projected ellipse
+                // Compute the sphere center AND the projected ellipse.
+                // cv::Point2f is a packed (x, y) float pair, so the contour can be fit in place.
                 Eigen::Vector3f sphere_center;
                 EigenFitEllipse ellipse_projection;
-
-                std::vector<Eigen::Vector2f> eigen_contour;
-                std::for_each(undistorted_contour.begin(),
-                              undistorted_contour.end(),
-                              [&eigen_contour](const cv::Point2f& p) {
-                                  eigen_contour.push_back(Eigen::Vector2f(p.x, p.y));
-                              });
-                eigen_alignment_fit_focal_cone_to_sphere(eigen_contour.data(),
-                                                         static_cast<int>(eigen_contour.size()),
-                                                         tracking_shape->shape.sphere.radius_cm,
-                                                         1, //I was expecting this to be -1. Is it +1 because we're using -F_PY?
-                                                         &sphere_center,
-                                                         &ellipse_projection);
-                
-                if (ellipse_projection.area > k_real_epsilon)
+                ellipse_projection.area = 0.f;
+
+                const float fit_residual =
+                    eigen_alignment_fit_focal_cone_to_sphere_fast(reinterpret_cast<const float *>(undistorted_contour.data()),
+                                                                  static_cast<int>(undistorted_contour.size()),
+                                                                  tracking_shape->shape.sphere.radius_cm,
+                                                                  1, //I was expecting this to be -1. Is it +1 because we're using -F_PY?
+                                                                  &sphere_center,
+                                                                  &ellipse_projection);
+
+                // Drop frames where the blob doesn't look like a sphere (partially occluded, merged with a reflection, ...)
+                // before doing any more work with them
+                const bool bIsGoodFit =
+                    fit_residual >= 0.f &&
+                    (trackerMgrConfig.max_sphere_fit_residual <= 0.f || fit_residual <= trackerMgrConfig.max_sphere_fit_residual);
+
+                if (bIsGoodFit && ellipse_projection.area > k_real_epsilon)
                 {
                     //Save the optically-estimate 3D pose.
                     out_pose_estimate->position_cm.set(sphere_center.x(), sphere_center.y(), sphere_center.z());
@@ -1528,6 +5888,7 @@ bool ServerTrackerView::computeProjectionForHMD(
                     // Save off the projection of the sphere (an ellipse)
                     out_pose_estimate->projection.shape.ellipse.angle = ellipse_projection.angle;
                     out_pose_estimate->projection.screen_area= ellipse_projection.area;
+                    out_pose_estimate->projection.fit_residual= fit_residual;
                     //The ellipse projection is still in normalized space.
                     //i.e., it is a 2-dimensional ellipse floating somewhere.
                     //We must reproject it onto the camera.
@@ -1547,39 +5908,42 @@ bool ServerTrackerView::computeProjectionForHMD(
 
                     bSuccess = true;
                 }
+                else
+                {
+                    bSuccess = false;
+                }
             } break;
         case eCommonTrackingShapeType::PointCloud:
             {
-                const HMDOpticalPoseEstimation *prior_post_est= tracked_hmd->getTrackerPoseEstimate(getDeviceID());
+                const HMDOpticalPoseEstimation *prior_post_est= &job.prior_hmd_pose_estimate;
                 CommonDevicePose tracker_pose_guess= {prior_post_est->position_cm, prior_post_est->orientation};
 
-                // Undistort the source contours
-                t_opencv_float_contour_list undistorted_contours;
-                for (auto it = biggest_contours.begin(); it != biggest_contours.end(); ++it)
+                // Convert the source contours to float.
+                // They stay distorted, the pose fit gets the distortion coefficients.
+                t_opencv_float_contour_list &float_contours = contour_scratch.floatContours;
+                float_contours.resize(biggest_contours.size());
+                for (size_t contour_index = 0; contour_index < biggest_contours.size(); ++contour_index)
                 {
-                    // Draw the source contour
-                    m_opencv_buffer_state->draw_contour(*it);
-
-                    // Convert integer contour to float
-                    t_opencv_float_contour biggest_contour_f;
-                    cv::Mat(*it).convertTo(biggest_contour_f, cv::Mat(biggest_contour_f).type());
+                    const t_opencv_int_contour &contour = biggest_contours[contour_index];
+                    t_opencv_float_contour &contour_f = float_contours[contour_index];
 
-                    // Compute an undistorted version of the contour
-                    t_opencv_float_contour undistort_contour;
-                    cv::undistortPoints(biggest_contour_f, undistort_contour,
-                        camera_matrix,
-                        distortions,
-                        cv::noArray(),
-                        camera_matrix);
+                    // Draw the source contour
+                    m_opencv_buffer_state->draw_contour(contour);
 
-                    undistorted_contours.push_back(biggest_contour_f);
+                    contour_f.resize(contour.size());
+                    for (size_t point_index = 0; point_index < contour.size(); ++point_index)
+                    {
+                        contour_f[point_index] = cv::Point2f(contour[point_index]);
+                    }
                 }
 
                 bSuccess =
                     computeTrackerRelativePointCloudContourPose(
-                        m_device,
+                        m_undistortion_grid->getCameraMatrix(),
+                        m_undistortion_grid->getDistortions(),
                         tracking_shape,
-                        undistorted_contours,
+                        job.bIsLEDVisible,
+                        float_contours,
                         prior_post_est->bCurrentlyTracking ? &tracker_pose_guess : nullptr,
                         out_pose_estimate);
 
@@ -1615,7 +5979,8 @@ ServerTrackerView::computePoseForProjection(
         {
             bSuccess =
                 computeTrackerRelativeLightBarPose(
-                    m_device,
+                    m_camera_matrices->getIntrinsicMatrix(),
+                    m_camera_matrices->getDistortions(),
                     tracking_shape,
                     projection,
                     pose_guess,
@@ -1632,40 +5997,68 @@ CommonDevicePosition
 ServerTrackerView::computeWorldPosition(
     const CommonDevicePosition *tracker_relative_position) const
 {
-    const glm::vec4 rel_pos(tracker_relative_position->x, tracker_relative_position->y, tracker_relative_position->z, 1.f);
-    const glm::mat4 cameraTransform= computeGLMCameraTransformMatrix(m_device);
-    const glm::vec4 world_pos = cameraTransform * rel_pos;
-    
+    const ServerTrackerView *tracker = this;
     CommonDevicePosition result;
-    result.set(world_pos.x, world_pos.y, world_pos.z);
+
+    computeWorldPositionsBatch(&tracker, tracker_relative_position, 1, &result);
 
     return result;
 }
 
+void
+ServerTrackerView::computeWorldPositionsBatch(
+    const ServerTrackerView * const *trackers,
+    const CommonDevicePosition *tracker_relative_positions,
+    const int count,
+    CommonDevicePosition *out_world_positions)
+{
+    for (int index = 0; index < count; ++index)
+    {
+        const float (&m)[3][4] = trackers[index]->m_camera_matrices->getWorldFromTracker();
+        const CommonDevicePosition &p = tracker_relative_positions[index];
+
+        out_world_positions[index].x = m[0][0]*p.x + m[0][1]*p.y + m[0][2]*p.z + m[0][3];
+        out_world_positions[index].y = m[1][0]*p.x + m[1][1]*p.y + m[1][2]*p.z + m[1][3];
+        out_world_positions[index].z = m[2][0]*p.x + m[2][1]*p.y + m[2][2]*p.z + m[2][3];
+    }
+}
+
 CommonDeviceQuaternion
 ServerTrackerView::computeWorldOrientation(
     const CommonDeviceQuaternion *tracker_relative_orientation) const
+{
+    const ServerTrackerView *tracker = this;
+    CommonDeviceQuaternion result;
+
+    computeWorldOrientationsBatch(&tracker, tracker_relative_orientation, 1, &result);
+
+    return result;
+}
+
+void
+ServerTrackerView::computeWorldOrientationsBatch(
+    const ServerTrackerView * const *trackers,
+    const CommonDeviceQuaternion *tracker_relative_orientations,
+    const int count,
+    CommonDeviceQuaternion *out_world_orientations)
 {
     // Compute a rotations that rotates from +X to global "forward"
     const TrackerManagerConfig &cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
     const float global_forward_yaw_radians = cfg.global_forward_degrees*k_degrees_to_radians;
     const glm::quat global_forward_quat= glm::quat(glm::vec3(0.f, global_forward_yaw_radians, 0.f));
-    
-    const glm::quat rel_orientation(
-        tracker_relative_orientation->w,
-        tracker_relative_orientation->x,
-        tracker_relative_orientation->y,
-        tracker_relative_orientation->z);    
-    const glm::quat camera_quat= computeGLMCameraTransformQuaternion(m_device);
-    const glm::quat world_quat = global_forward_quat * camera_quat * rel_orientation;
-    
-    CommonDeviceQuaternion result;
-    result.w= world_quat.w;
-    result.x= world_quat.x;
-    result.y= world_quat.y;
-    result.z= world_quat.z;
 
-    return result;
+    for (int index = 0; index < count; ++index)
+    {
+        const CommonDeviceQuaternion &q = tracker_relative_orientations[index];
+        const glm::quat rel_orientation(q.w, q.x, q.y, q.z);
+        const glm::quat world_quat =
+            global_forward_quat * trackers[index]->m_camera_matrices->getCameraQuaternion() * rel_orientation;
+
+        out_world_orientations[index].w= world_quat.w;
+        out_world_orientations[index].x= world_quat.x;
+        out_world_orientations[index].y= world_quat.y;
+        out_world_orientations[index].z= world_quat.z;
+    }
 }
 
 CommonDevicePosition 
@@ -1673,8 +6066,7 @@ ServerTrackerView::computeTrackerPosition(
     const CommonDevicePosition *world_relative_position) const
 {
     const glm::vec4 world_pos(world_relative_position->x, world_relative_position->y, world_relative_position->z, 1.f);
-    const glm::mat4 invCameraTransform= glm::inverse(computeGLMCameraTransformMatrix(m_device));
-    const glm::vec4 rel_pos = invCameraTransform * world_pos;
+    const glm::vec4 rel_pos = m_camera_matrices->getInverseCameraTransform() * world_pos;
     
     CommonDevicePosition result;
     result.set(rel_pos.x, rel_pos.y, rel_pos.z);
@@ -1691,7 +6083,7 @@ ServerTrackerView::computeTrackerOrientation(
         world_relative_orientation->x,
         world_relative_orientation->y,
         world_relative_orientation->z);    
-    const glm::quat camera_inv_quat= glm::conjugate(computeGLMCameraTransformQuaternion(m_device));
+    const glm::quat camera_inv_quat= glm::conjugate(m_camera_matrices->getCameraQuaternion());
     // combined_rotation = second_rotation * first_rotation;
     const glm::quat rel_quat = camera_inv_quat * world_orientation;
     
@@ -1762,7 +6154,7 @@ ServerTrackerView::triangulateWorldPose(
                 {
                     const CommonDevicePosition &p= world_positions[point_index];
 
-                    lightbar_points[point_index]= Eigen::Vector3f(p.x, p.y, p.z);
+                    lightbar_points[point_index]= eigen_vector3f_view(p);
                 }
             }
 
@@ -1818,16 +6210,11 @@ ServerTrackerView::triangulateWorldPose(
                         Eigen::Quaternionf::FromTwoVectors(x_axis_in_plane, right);
                     const Eigen::Quaternionf q = (align_right_rotation*align_normal_rotation).normalized();
 
-                    pose.Orientation.w= q.w();
-                    pose.Orientation.x= q.x();
-                    pose.Orientation.y= q.y();
-                    pose.Orientation.z= q.z();
+                    eigen_quaternionf_view(pose.Orientation)= q;
                 }
 
                 // Use the centroid as the world pose location
-                pose.PositionCm.x= centroid.x();
-                pose.PositionCm.y= centroid.y();
-                pose.PositionCm.z= centroid.z();
+                eigen_vector3f_view(pose.PositionCm)= centroid;
             }
             else
             {
@@ -1864,8 +6251,8 @@ ServerTrackerView::triangulateWorldPosition(
     // Compute the pinhole camera matrix for each tracker that allows you to raycast
     // from the tracker center in world space through the screen location, into the world
     // See: http://docs.opencv.org/2.4/modules/calib3d/doc/camera_calibration_and_3d_reconstruction.html
-    cv::Mat projMat1 = cv::Mat(computeOpenCVCameraPinholeMatrix(tracker->m_device));
-    cv::Mat projMat2 = cv::Mat(computeOpenCVCameraPinholeMatrix(other_tracker->m_device));
+    cv::Mat projMat1 = cv::Mat(tracker->m_camera_matrices->getPinholeMatrix());
+    cv::Mat projMat2 = cv::Mat(other_tracker->m_camera_matrices->getPinholeMatrix());
 
     // Triangulate the world position from the two cameras
     cv::Mat point3D(1, 1, CV_32FC4);
@@ -1910,8 +6297,8 @@ ServerTrackerView::triangulateWorldPositions(
     // Compute the pinhole camera matrix for each tracker that allows you to raycast
     // from the tracker center in world space through the screen location, into the world
     // See: http://docs.opencv.org/2.4/modules/calib3d/doc/camera_calibration_and_3d_reconstruction.html
-    cv::Mat projMat1 = cv::Mat(computeOpenCVCameraPinholeMatrix(tracker->m_device));
-    cv::Mat projMat2 = cv::Mat(computeOpenCVCameraPinholeMatrix(other_tracker->m_device));
+    cv::Mat projMat1 = cv::Mat(tracker->m_camera_matrices->getPinholeMatrix());
+    cv::Mat projMat2 = cv::Mat(other_tracker->m_camera_matrices->getPinholeMatrix());
 
     // Triangulate the world positions from the two cameras
     cv::Mat points3D(1, screen_location_count, CV_32FC4);
@@ -1929,13 +6316,155 @@ ServerTrackerView::triangulateWorldPositions(
     }
 }
 
+bool
+ServerTrackerView::triangulateWorldPositionFromMultipleTrackers(
+    const ServerTrackerView * const *trackers,
+    const CommonDeviceScreenLocation *screen_locations,
+    const float *weights,
+    const int tracker_count,
+    const int refinement_iterations,
+    CommonDevicePosition *out_result)
+{
+    const int camera_count = std::min(tracker_count, static_cast<int>(TrackerManager::k_max_devices));
+
+    if (camera_count < 2)
+    {
+        return false;
+    }
+
+    // Scratch space sized for the largest supported rig so nothing gets allocated per frame
+    Eigen::Matrix<double, 3, 4> pinhole_matrices[TrackerManager::k_max_devices];
+    double camera_weights[TrackerManager::k_max_devices];
+
+    double weight_sum = 0.0;
+    for (int camera_index = 0; camera_index < camera_count; ++camera_index)
+    {
+        const cv::Matx34f &cv_pinhole_matrix = trackers[camera_index]->m_camera_matrices->getPinholeMatrix();
+        Eigen::Matrix<double, 3, 4> &P = pinhole_matrices[camera_index];
+
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 4; ++col)
+            {
+                P(row, col) = static_cast<double>(cv_pinhole_matrix(row, col));
+            }
+        }
+
+        camera_weights[camera_index] = std::max(static_cast<double>(weights[camera_index]), 0.0);
+        weight_sum += camera_weights[camera_index];
+    }
+
+    // Normalize the weights, falling back to equal weights if none were given
+    for (int camera_index = 0; camera_index < camera_count; ++camera_index)
+    {
+        camera_weights[camera_index] =
+            (weight_sum > k_real64_epsilon)
+            ? camera_weights[camera_index] / weight_sum
+            : 1.0 / static_cast<double>(camera_count);
+    }
+
+    // Each camera contributes the two DLT rows [u*P3 - P1; v*P3 - P2] * [X Y Z 1]' = 0.
+    // Rather than stacking a 2Nx4 system, accumulate the 3x3 normal equations directly.
+    Eigen::Matrix3d AtA = Eigen::Matrix3d::Zero();
+    Eigen::Vector3d Atb = Eigen::Vector3d::Zero();
+    for (int camera_index = 0; camera_index < camera_count; ++camera_index)
+    {
+        const Eigen::Matrix<double, 3, 4> &P = pinhole_matrices[camera_index];
+        const double screen_coords[2] = { screen_locations[camera_index].x, screen_locations[camera_index].y };
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            Eigen::Matrix<double, 1, 4> dlt_row = screen_coords[axis] * P.row(2) - P.row(axis);
+            const double row_norm = dlt_row.head<3>().norm();
+
+            if (row_norm > k_real64_epsilon)
+            {
+                // Unit rows so that the area weights and not the camera placement decide each camera's influence
+                dlt_row /= row_norm;
+
+                const Eigen::Vector3d a = dlt_row.head<3>().transpose();
+                AtA += camera_weights[camera_index] * a * a.transpose();
+                Atb -= camera_weights[camera_index] * dlt_row(3) * a;
+            }
+        }
+    }
+
+    // Reject (nearly) parallel view rays
+    const Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eigen_solver(AtA);
+    const Eigen::Vector3d eigen_values = eigen_solver.eigenvalues();
+    if (eigen_solver.info() != Eigen::Success ||
+        eigen_values(0) <= k_real64_normal_epsilon * std::max(eigen_values(2), k_real64_epsilon))
+    {
+        return false;
+    }
+
+    Eigen::Vector3d X = eigen_solver.eigenvectors() *
+        (eigen_values.cwiseInverse().asDiagonal() * (eigen_solver.eigenvectors().transpose() * Atb));
+
+    // Refine the algebraic solution by minimizing the weighted reprojection error
+    for (int iteration = 0; iteration < refinement_iterations; ++iteration)
+    {
+        Eigen::Matrix3d JtWJ = Eigen::Matrix3d::Zero();
+        Eigen::Vector3d JtWr = Eigen::Vector3d::Zero();
+
+        for (int camera_index = 0; camera_index < camera_count; ++camera_index)
+        {
+            const Eigen::Matrix<double, 3, 4> &P = pinhole_matrices[camera_index];
+            const Eigen::Vector3d p = P.leftCols<3>() * X + P.col(3);
+
+            if (fabs(p.z()) <= k_real64_epsilon)
+            {
+                continue;
+            }
+
+            const double inv_depth = 1.0 / p.z();
+            const double projected_coords[2] = { p.x() * inv_depth, p.y() * inv_depth };
+            const double screen_coords[2] = { screen_locations[camera_index].x, screen_locations[camera_index].y };
+
+            for (int axis = 0; axis < 2; ++axis)
+            {
+                const Eigen::Vector3d J =
+                    ((P.block<1, 3>(axis, 0) - projected_coords[axis] * P.block<1, 3>(2, 0)) * inv_depth).transpose();
+                const double residual = screen_coords[axis] - projected_coords[axis];
+
+                JtWJ += camera_weights[camera_index] * J * J.transpose();
+                JtWr += camera_weights[camera_index] * residual * J;
+            }
+        }
+
+        const Eigen::Vector3d delta = JtWJ.ldlt().solve(JtWr);
+        if (!delta.allFinite())
+        {
+            break;
+        }
+
+        X += delta;
+
+        // Sub-micron updates aren't worth another pass
+        if (delta.squaredNorm() < 1e-8)
+        {
+            break;
+        }
+    }
+
+    if (!X.allFinite())
+    {
+        return false;
+    }
+
+    out_result->x = static_cast<float>(X.x());
+    out_result->y = static_cast<float>(X.y());
+    out_result->z = static_cast<float>(X.z());
+
+    return true;
+}
+
 
 std::vector<CommonDeviceScreenLocation>
 ServerTrackerView::projectTrackerRelativePositions(const std::vector<CommonDevicePosition> &objectPositions) const
 {
-    cv::Matx33f camera_matrix;
-    cv::Matx<float, 5, 1> distortions;
-    computeOpenCVCameraIntrinsicMatrix(m_device, camera_matrix, distortions);
+    const cv::Matx33f &camera_matrix = m_camera_matrices->getIntrinsicMatrix();
+    const cv::Matx<float, 5, 1> &distortions = m_camera_matrices->getDistortions();
     
     // Use the identity transform for tracker relative positions
     cv::Mat rvec(3, 1, cv::DataType<double>::type, double(0));
@@ -1971,10 +6500,29 @@ ServerTrackerView::projectTrackerRelativePositions(const std::vector<CommonDevic
 CommonDeviceScreenLocation
 ServerTrackerView::projectTrackerRelativePosition(const CommonDevicePosition *trackerRelativePosition) const
 {
-    std::vector<CommonDevicePosition> trp_vec {*trackerRelativePosition};
-    CommonDeviceScreenLocation screenLocation = projectTrackerRelativePositions(trp_vec)[0];
+    return projectCameraRelativePoint(
+        m_camera_matrices->getIntrinsicMatrix(),
+        m_camera_matrices->getDistortions(),
+        *trackerRelativePosition);
+}
+
+void
+ServerTrackerView::projectTrackerRelativePositionsBatch(
+    const ServerTrackerView * const *trackers,
+    const CommonDevicePosition *tracker_relative_positions,
+    const int count,
+    CommonDeviceScreenLocation *out_screen_locations)
+{
+    for (int index = 0; index < count; ++index)
+    {
+        const TrackerCameraMatrices *camera_matrices = trackers[index]->m_camera_matrices;
 
-    return screenLocation;
+        out_screen_locations[index] =
+            projectCameraRelativePoint(
+                camera_matrices->getIntrinsicMatrix(),
+                camera_matrices->getDistortions(),
+                tracker_relative_positions[index]);
+    }
 }
 
 
@@ -2033,36 +6581,109 @@ static void computeOpenCVCameraIntrinsicMatrix(const ITrackerInterface *tracker_
     intrinsicOut(2, 0) = 0.f;   intrinsicOut(2, 1) = 0.f;   intrinsicOut(2, 2) = 1.f;
 }
 
-static cv::Matx34f computeOpenCVCameraPinholeMatrix(const ITrackerInterface *tracker_device)
-{
-    cv::Matx34f extrinsic_matrix;
-    computeOpenCVCameraExtrinsicMatrix(tracker_device, extrinsic_matrix);
-    cv::Matx33f intrinsic_matrix;
-    cv::Matx<float, 5, 1> distortion;
-    computeOpenCVCameraIntrinsicMatrix(tracker_device, intrinsic_matrix, distortion);
-    cv::Matx34f pinhole_matrix = intrinsic_matrix * extrinsic_matrix;
+// cv::projectPoints() of a single point with an identity rvec/tvec,
+// without the temporary Mats and vectors that call needs
+static CommonDeviceScreenLocation projectCameraRelativePoint(
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &distortions,
+    const CommonDevicePosition &camera_relative_position)
+{
+    const double k1 = distortions(0, 0);
+    const double k2 = distortions(1, 0);
+    const double p1 = distortions(2, 0);
+    const double p2 = distortions(3, 0);
+    const double k3 = distortions(4, 0);
+
+    const double z = camera_relative_position.z;
+    const double inv_z = (z != 0.0) ? 1.0 / z : 1.0;
+    const double x = camera_relative_position.x * inv_z;
+    const double y = camera_relative_position.y * inv_z;
+
+    const double r2 = x*x + y*y;
+    const double r4 = r2*r2;
+    const double r6 = r4*r2;
+    const double radial = 1.0 + k1*r2 + k2*r4 + k3*r6;
+    const double xd = x*radial + 2.0*p1*x*y + p2*(r2 + 2.0*x*x);
+    const double yd = y*radial + p1*(r2 + 2.0*y*y) + 2.0*p2*x*y;
+
+    CommonDeviceScreenLocation screen_location;
+    screen_location.set(
+        static_cast<float>(camera_matrix(0, 0)*xd + camera_matrix(0, 2)),
+        static_cast<float>(camera_matrix(1, 1)*yd + camera_matrix(1, 2)));
+
+    return screen_location;
+}
+
+static int planSearchRegions(
+    const cv::Rect2i *rois,
+    const int roi_count,
+    cv::Rect2i *out_regions)
+{
+    int region_count = std::min(roi_count, k_max_search_regions);
+
+    for (int roi_index = 0; roi_index < region_count; ++roi_index)
+    {
+        out_regions[roi_index] = rois[roi_index];
+    }
+
+    // Merge any two regions that overlap, or whose bounding box is no bigger than the two of them apart,
+    // until every pixel lies in at most one region
+    bool bMerged = true;
+    while (bMerged)
+    {
+        bMerged = false;
+
+        for (int region_index = 0; !bMerged && region_index < region_count; ++region_index)
+        {
+            for (int other_index = region_index + 1; !bMerged && other_index < region_count; ++other_index)
+            {
+                const cv::Rect2i &region = out_regions[region_index];
+                const cv::Rect2i &other_region = out_regions[other_index];
+                const cv::Rect2i bounds = region | other_region;
+
+                if ((region & other_region).area() > 0 || bounds.area() <= region.area() + other_region.area())
+                {
+                    out_regions[region_index] = bounds;
+                    out_regions[other_index] = out_regions[region_count - 1];
+                    --region_count;
+                    bMerged = true;
+                }
+            }
+        }
+    }
 
-    return pinhole_matrix;
+    return region_count;
 }
 
 static bool computeTrackerRelativeLightBarProjection(
     const CommonDeviceTrackingShape *tracking_shape,
     const t_opencv_float_contour &opencv_contour,
+    OpenCVLightBarFitScratch &scratch,
     CommonDeviceTrackingProjection *out_projection)
 {
     assert(tracking_shape->shape_type == eCommonTrackingShapeType::LightBar);
 
     bool bValidTrackerProjection= true;
     float projectionArea= 0.f;
-    std::vector<cv::Point2f> cvImagePoints;
+    cv::Point2f cvImagePoints[7];
     {
         cv::Point2f tri_top, tri_bottom_left, tri_bottom_right;
         cv::Point2f quad_top_right, quad_top_left, quad_bottom_left, quad_bottom_right;
 
+        // Both fits below only depend on the convex hull of the contour,
+        // so compute it once rather than letting each of them do it on the whole contour
+        cv::convexHull(opencv_contour, scratch.hull);
+        bValidTrackerProjection= !scratch.hull.empty();
+
         // Create a best fit triangle around the contour
-        bValidTrackerProjection= computeBestFitTriangleForContour(
-            opencv_contour, 
-            tri_top, tri_bottom_left, tri_bottom_right);
+        if (bValidTrackerProjection)
+        {
+            const cv::Point2f massCenter = computeSafeCenterOfMassForContour<t_opencv_float_contour>(opencv_contour);
+
+            bValidTrackerProjection= computeBestFitTriangleForContour(
+                scratch.hull, massCenter, scratch.triangle,
+                tri_top, tri_bottom_left, tri_bottom_right);
+        }
 
         // Also create a best fit quad around the contour
         // Use the best fit triangle to define the orientation
@@ -2073,7 +6694,7 @@ static bool computeTrackerRelativeLightBarProjection(
             const cv::Point2f right_hint= tri_bottom_right - tri_bottom_left;
 
             bValidTrackerProjection= computeBestFitQuadForContour(
-                opencv_contour, 
+                scratch.hull, 
                 up_hint, right_hint, 
                 quad_top_right, quad_top_left, quad_bottom_left, quad_bottom_right);
         }
@@ -2085,13 +6706,13 @@ static bool computeTrackerRelativeLightBarProjection(
             tri_top= 0.5f*(quad_top_right + quad_top_left);
 
             // Put the image points in corresponding order with cvObjectPoints
-            cvImagePoints.push_back(tri_bottom_right);
-            cvImagePoints.push_back(tri_bottom_left);
-            cvImagePoints.push_back(tri_top);
-            cvImagePoints.push_back(quad_top_right);
-            cvImagePoints.push_back(quad_top_left);
-            cvImagePoints.push_back(quad_bottom_left);
-            cvImagePoints.push_back(quad_bottom_right);
+            cvImagePoints[0] = tri_bottom_right;
+            cvImagePoints[1] = tri_bottom_left;
+            cvImagePoints[2] = tri_top;
+            cvImagePoints[3] = quad_top_right;
+            cvImagePoints[4] = quad_top_left;
+            cvImagePoints[5] = quad_bottom_left;
+            cvImagePoints[6] = quad_bottom_right;
 
             // The projection area is the size of the best fit quad
             projectionArea= 
@@ -2121,13 +6742,15 @@ static bool computeTrackerRelativeLightBarProjection(
         }
 
         out_projection->screen_area= projectionArea;
+        out_projection->fit_residual = 0.f;
     }
 
     return bValidTrackerProjection;
 }
 
 static bool computeTrackerRelativeLightBarPose(
-    const ITrackerInterface *tracker_device,
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &distortions,
     const CommonDeviceTrackingShape *tracking_shape,
     const CommonDeviceTrackingProjection *projection,
     const CommonDevicePose *tracker_relative_pose_guess,
@@ -2137,20 +6760,20 @@ static bool computeTrackerRelativeLightBarPose(
     assert(projection->shape_type == eCommonTrackingProjectionType::ProjectionType_LightBar);
 
     bool bValidTrackerPose= true;
-    std::vector<cv::Point2f> cvImagePoints;
+    cv::Point2f cvImagePoints[7];
 
     for (int vertex_index = 0; vertex_index < 3; ++vertex_index)
     {
         const CommonDeviceScreenLocation &screenLocation= projection->shape.lightbar.triangle[vertex_index];
 
-        cvImagePoints.push_back(cv::Point2f(screenLocation.x, screenLocation.y));
+        cvImagePoints[vertex_index] = cv::Point2f(screenLocation.x, screenLocation.y);
     }
 
     for (int vertex_index = 0; vertex_index < 4; ++vertex_index)
     {
         const CommonDeviceScreenLocation &screenLocation = projection->shape.lightbar.quad[vertex_index];
 
-        cvImagePoints.push_back(cv::Point2f(screenLocation.x, screenLocation.y));
+        cvImagePoints[vertex_index + 3] = cv::Point2f(screenLocation.x, screenLocation.y);
     }
 
     // Solve the tracking position using solvePnP
@@ -2160,31 +6783,32 @@ static bool computeTrackerRelativeLightBarPose(
         // Assumed vertex order is:
         // triangle - right, left, bottom
         // quad - top right, top left, bottom left, bottom right
-        std::vector<cv::Point3f> cvObjectPoints;
+        cv::Point3f cvObjectPoints[7];
 
         for (int corner_index= 0; corner_index < 3; ++corner_index)
         {        
             const CommonDevicePosition &corner = tracking_shape->shape.light_bar.triangle[corner_index];
 
-            cvObjectPoints.push_back(cv::Point3f(corner.x, corner.y, corner.z));
+            cvObjectPoints[corner_index] = cv::Point3f(corner.x, corner.y, corner.z);
         }
 
         for (int corner_index= 0; corner_index < 4; ++corner_index)
         {        
             const CommonDevicePosition &corner = tracking_shape->shape.light_bar.quad[corner_index];
 
-            cvObjectPoints.push_back(cv::Point3f(corner.x, corner.y, corner.z));
+            cvObjectPoints[corner_index + 3] = cv::Point3f(corner.x, corner.y, corner.z);
         }
 
         // Get the tracker "intrinsic" matrix that encodes the camera FOV
-        cv::Matx33f cvCameraMatrix;
-        cv::Matx<float, 5, 1> cvDistCoeffs;
-        computeOpenCVCameraIntrinsicMatrix(tracker_device, cvCameraMatrix, cvDistCoeffs);
+        const cv::Matx33f &cvCameraMatrix = camera_matrix;
+        const cv::Matx<float, 5, 1> &cvDistCoeffs = distortions;
 
         // Fill out the initial guess in OpenCV format for the contour pose
         // if a guess pose was provided
-        cv::Mat rvec(3, 1, cv::DataType<double>::type);
-        cv::Mat tvec(3, 1, cv::DataType<double>::type);
+        // Backed by the stack, solvePnP() writes into them in place
+        double rvec_data[3], tvec_data[3];
+        cv::Mat rvec(3, 1, cv::DataType<double>::type, rvec_data);
+        cv::Mat tvec(3, 1, cv::DataType<double>::type, tvec_data);
 
         bool bUseExtrinsicGuess= false;
         if (tracker_relative_pose_guess != nullptr)
@@ -2213,7 +6837,7 @@ static bool computeTrackerRelativeLightBarPose(
         // solve for the object position and orientation that would allow
         // us to re-project the 3D points back onto the 2D pixel locations
         if (cv::solvePnP(
-                cvObjectPoints, cvImagePoints, 
+                cv::Mat(7, 1, CV_32FC3, cvObjectPoints), cv::Mat(7, 1, CV_32FC2, cvImagePoints), 
                 cvCameraMatrix, cvDistCoeffs, 
                 rvec, tvec, 
                 bUseExtrinsicGuess, cv::SOLVEPNP_ITERATIVE))
@@ -2262,16 +6886,19 @@ static bool computeTrackerRelativeLightBarPose(
 }
 
 static bool computeTrackerRelativePointCloudContourPose(
-    const ITrackerInterface *tracker_device,
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &distortions,
     const CommonDeviceTrackingShape *tracking_shape,
+    const bool *bIsLEDVisible,
     const t_opencv_float_contour_list &opencv_contours,
     const CommonDevicePose *tracker_relative_pose_guess,
     HMDOpticalPoseEstimation *out_pose_estimate)
 {
     assert(tracking_shape->shape_type == eCommonTrackingShapeType::PointCloud);
 
-    bool bValidTrackerPose = true;
+    bool bValidTrackerPose = false;
     float projectionArea = 0.f;
+    std::vector<int> led_for_image_point;
 
     // Compute centers of mass for the contours
     t_opencv_float_contour cvImagePoints;
@@ -2280,22 +6907,98 @@ static bool computeTrackerRelativePointCloudContourPose(
         cv::Point2f massCenter= computeSafeCenterOfMassForContour<t_opencv_float_contour>(*it);
 
         cvImagePoints.push_back(massCenter);
+        projectionArea += static_cast<float>(cv::contourArea(*it));
     }
 
-    if (cvImagePoints.size() >= 3)
+    if (static_cast<int>(cvImagePoints.size()) >= k_point_cloud_min_correspondences)
     {
-        //###HipsterSloth $TODO Solve the pose using SoftPOSIT
-        out_pose_estimate->position_cm.clear();
-        out_pose_estimate->orientation.clear();
-        out_pose_estimate->bOrientationValid = false;
-        bValidTrackerPose = true;
+        // Only the LEDs that may face the tracker get matched against the blobs,
+        // model_led_index maps them back to the LEDs of the tracking shape
+        std::vector<cv::Point3f> cvObjectPoints;
+        int model_led_index[CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT];
+        for (int point_index = 0; point_index < tracking_shape->shape.point_cloud.point_count; ++point_index)
+        {
+            if (bIsLEDVisible[point_index])
+            {
+                const CommonDevicePosition &point = tracking_shape->shape.point_cloud.point[point_index];
+
+                model_led_index[cvObjectPoints.size()] = point_index;
+                cvObjectPoints.push_back(cv::Point3f(point.x, point.y, point.z));
+            }
+        }
+
+        // Get the tracker "intrinsic" matrix that encodes the camera FOV
+        const cv::Matx33f &cvCameraMatrix = camera_matrix;
+        const cv::Matx<float, 5, 1> &cvDistCoeffs = distortions;
+
+        cv::Mat rvec(3, 1, cv::DataType<double>::type);
+        cv::Mat tvec(3, 1, cv::DataType<double>::type);
+
+        // While tracking, the LED correspondences carry over from the last frame:
+        // project the LEDs with last frame's pose and pair every blob with the closest projection
+        if (tracker_relative_pose_guess != nullptr)
+        {
+            commonDeviceOrientationToOpenCVRodrigues(tracker_relative_pose_guess->Orientation, rvec);
+            tvec.at<double>(0)= tracker_relative_pose_guess->PositionCm.x;
+            tvec.at<double>(1)= tracker_relative_pose_guess->PositionCm.y;
+            tvec.at<double>(2)= tracker_relative_pose_guess->PositionCm.z;
+
+            if (tvec.at<double>(2) > 0.0)
+            {
+                t_opencv_float_contour cvProjectedPoints;
+                cv::projectPoints(cvObjectPoints, rvec, tvec, cvCameraMatrix, cvDistCoeffs, cvProjectedPoints);
+
+                float mean_error_px;
+                const int match_count =
+                    matchPointCloudProjectionToImagePoints(
+                        cvProjectedPoints, cvImagePoints, led_for_image_point, mean_error_px);
+
+                bValidTrackerPose =
+                    match_count >= k_point_cloud_min_correspondences &&
+                    refinePointCloudPose(
+                        cvObjectPoints, cvImagePoints, led_for_image_point,
+                        cvCameraMatrix, cvDistCoeffs,
+                        rvec, tvec);
+            }
+        }
+
+        // Lost track (or never had it): search the correspondences from scratch
+        if (!bValidTrackerPose)
+        {
+            bValidTrackerPose =
+                searchPointCloudPose(
+                    cvObjectPoints, cvImagePoints,
+                    cvCameraMatrix, cvDistCoeffs,
+                    led_for_image_point,
+                    rvec, tvec);
+        }
+
+        if (bValidTrackerPose)
+        {
+            float axis_x, axis_y, axis_z, axis_theta;
+
+            // Convert the solution Rodrigues vector into a CommonDeviceOrientation
+            openCVRodriguesToAngleAxis(rvec, axis_x, axis_y, axis_z, axis_theta);
+            angleAxisVectorToCommonDeviceOrientation(axis_x, axis_y, axis_z, axis_theta, out_pose_estimate->orientation);
+            out_pose_estimate->bOrientationValid = true;
+
+            out_pose_estimate->position_cm.x = static_cast<float>(tvec.at<double>(0));
+            out_pose_estimate->position_cm.y = static_cast<float>(tvec.at<double>(1));
+            out_pose_estimate->position_cm.z = static_cast<float>(tvec.at<double>(2));
+
+            for (int &led_index : led_for_image_point)
+            {
+                led_index = (led_index >= 0) ? model_led_index[led_index] : -1;
+            }
+        }
     }
 
     // Return the projection of the tracking shape
     if (bValidTrackerPose)
     {
         CommonDeviceTrackingProjection *out_projection = &out_pose_estimate->projection;
-        const int imagePointCount = static_cast<int>(cvImagePoints.size());
+        const int imagePointCount =
+            std::min(static_cast<int>(cvImagePoints.size()), static_cast<int>(CommonDeviceTrackingProjection::MAX_POINT_CLOUD_POINT_COUNT));
 
         out_projection->shape_type = eCommonTrackingProjectionType::ProjectionType_Points;
 
@@ -2304,15 +7007,273 @@ static bool computeTrackerRelativePointCloudContourPose(
             const cv::Point2f &cvPoint = cvImagePoints[vertex_index];
 
             out_projection->shape.points.point[vertex_index] = {cvPoint.x, cvPoint.y};
+            out_projection->shape.points.shape_point_index[vertex_index] = led_for_image_point[vertex_index];
         }
 
         out_projection->shape.points.point_count = imagePointCount;
         out_projection->screen_area = projectionArea;
+        out_projection->fit_residual = 0.f;
     }
 
     return bValidTrackerPose;
 }
 
+// Pairs every image point with the closest projected LED within the match gate,
+// closest pairs first, each LED used at most once.
+// out_led_for_image_point gets -1 for image points left unmatched.
+// Returns the number of matched image points.
+static int matchPointCloudProjectionToImagePoints(
+    const t_opencv_float_contour &projected_led_points,
+    const t_opencv_float_contour &image_points,
+    std::vector<int> &out_led_for_image_point,
+    float &out_mean_error_px)
+{
+    const int led_count = static_cast<int>(projected_led_points.size());
+    const int image_point_count = static_cast<int>(image_points.size());
+    const float gate_sqr = k_point_cloud_match_gate_px*k_point_cloud_match_gate_px;
+    bool bLEDUsed[CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT] = { false };
+    int match_count = 0;
+    float error_sum = 0.f;
+
+    out_led_for_image_point.assign(image_point_count, -1);
+
+    // Only a handful of LEDs and blobs, so just keep taking the closest remaining pair
+    while (match_count < led_count && match_count < image_point_count)
+    {
+        int best_led_index = -1;
+        int best_image_index = -1;
+        float best_dist_sqr = gate_sqr;
+
+        for (int image_index = 0; image_index < image_point_count; ++image_index)
+        {
+            if (out_led_for_image_point[image_index] != -1)
+            {
+                continue;
+            }
+
+            for (int led_index = 0; led_index < led_count; ++led_index)
+            {
+                if (bLEDUsed[led_index])
+                {
+                    continue;
+                }
+
+                const cv::Point2f delta = image_points[image_index] - projected_led_points[led_index];
+                const float dist_sqr = delta.dot(delta);
+
+                if (dist_sqr < best_dist_sqr)
+                {
+                    best_dist_sqr = dist_sqr;
+                    best_led_index = led_index;
+                    best_image_index = image_index;
+                }
+            }
+        }
+
+        if (best_led_index == -1)
+        {
+            break;
+        }
+
+        out_led_for_image_point[best_image_index] = best_led_index;
+        bLEDUsed[best_led_index] = true;
+        error_sum += sqrtf(best_dist_sqr);
+        ++match_count;
+    }
+
+    out_mean_error_px = (match_count > 0) ? error_sum / static_cast<float>(match_count) : 0.f;
+
+    return match_count;
+}
+
+// Solves the pose from the matched LEDs, starting from the pose in rvec/tvec.
+// Fails if the solution doesn't reproject the matched LEDs onto their blobs.
+static bool refinePointCloudPose(
+    const std::vector<cv::Point3f> &object_points,
+    const t_opencv_float_contour &image_points,
+    const std::vector<int> &led_for_image_point,
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &dist_coeffs,
+    cv::Mat &rvec,
+    cv::Mat &tvec)
+{
+    std::vector<cv::Point3f> matched_object_points;
+    t_opencv_float_contour matched_image_points;
+    for (size_t image_index = 0; image_index < image_points.size(); ++image_index)
+    {
+        const int led_index = led_for_image_point[image_index];
+
+        if (led_index != -1)
+        {
+            matched_object_points.push_back(object_points[led_index]);
+            matched_image_points.push_back(image_points[image_index]);
+        }
+    }
+
+    if (static_cast<int>(matched_object_points.size()) < k_point_cloud_min_correspondences ||
+        !cv::solvePnP(
+            matched_object_points, matched_image_points,
+            camera_matrix, dist_coeffs,
+            rvec, tvec,
+            true, cv::SOLVEPNP_ITERATIVE) ||
+        tvec.at<double>(2) <= 0.0)
+    {
+        return false;
+    }
+
+    t_opencv_float_contour reprojected_points;
+    cv::projectPoints(matched_object_points, rvec, tvec, camera_matrix, dist_coeffs, reprojected_points);
+
+    float error_sqr_sum = 0.f;
+    for (size_t point_index = 0; point_index < reprojected_points.size(); ++point_index)
+    {
+        const cv::Point2f delta = reprojected_points[point_index] - matched_image_points[point_index];
+
+        error_sqr_sum += delta.dot(delta);
+    }
+
+    const float rms_error_px = sqrtf(error_sqr_sum / static_cast<float>(reprojected_points.size()));
+
+    return rms_error_px <= k_point_cloud_max_reprojection_error_px;
+}
+
+// Full correspondence search, used when there is no pose to carry the correspondences over from.
+// Tries every assignment of LEDs to the first (biggest) three blobs, keeps the P3P pose
+// that lands the most LEDs on blobs and refines it with all of its matches.
+// The blobs get undistorted once up front, so every hypothesis is an allocation free
+// P3P solve against the same bearings plus a pinhole projection of the LEDs
+// (9*8*7 solves with up to four poses each for the Morpheus).
+// Still only runs on loss of tracking.
+static bool searchPointCloudPose(
+    const std::vector<cv::Point3f> &object_points,
+    const t_opencv_float_contour &image_points,
+    const cv::Matx33f &camera_matrix,
+    const cv::Matx<float, 5, 1> &dist_coeffs,
+    std::vector<int> &out_led_for_image_point,
+    cv::Mat &rvec,
+    cv::Mat &tvec)
+{
+    const int led_count = static_cast<int>(object_points.size());
+
+    if (led_count < k_point_cloud_min_correspondences ||
+        led_count > CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT ||
+        static_cast<int>(image_points.size()) < k_point_cloud_min_correspondences)
+    {
+        return false;
+    }
+
+    const float fx = camera_matrix(0, 0);
+    const float fy = camera_matrix(1, 1);
+    const float cx = camera_matrix(0, 2);
+    const float cy = camera_matrix(1, 2);
+
+    // Hypotheses get scored in undistorted pixels, same match gate as the distorted ones
+    t_opencv_float_contour undistorted_image_points;
+    cv::undistortPoints(image_points, undistorted_image_points, camera_matrix, dist_coeffs, cv::noArray(), camera_matrix);
+
+    Eigen::Vector2f seed_image_points[3];
+    for (int point_index = 0; point_index < 3; ++point_index)
+    {
+        const cv::Point2f &point = undistorted_image_points[point_index];
+
+        seed_image_points[point_index] = Eigen::Vector2f((point.x - cx) / fx, (point.y - cy) / fy);
+    }
+
+    EigenP3PBearings seed_bearings;
+    seed_bearings.set(seed_image_points);
+
+    Eigen::Vector3f led_points[CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT];
+    for (int led_index = 0; led_index < led_count; ++led_index)
+    {
+        const cv::Point3f &point = object_points[led_index];
+
+        led_points[led_index] = Eigen::Vector3f(point.x, point.y, point.z);
+    }
+
+    t_opencv_float_contour projected_points(led_count);
+    std::vector<int> led_for_image_point;
+    led_for_image_point.reserve(image_points.size());
+
+    int best_match_count = 0;
+    float best_mean_error_px = k_real_max;
+    Eigen::Matrix3f best_rotation = Eigen::Matrix3f::Identity();
+    Eigen::Vector3f best_translation = Eigen::Vector3f::Zero();
+
+    for (int a = 0; a < led_count; ++a)
+    {
+        for (int b = 0; b < led_count; ++b)
+        {
+            if (b == a)
+                continue;
+
+            for (int c = 0; c < led_count; ++c)
+            {
+                if (c == a || c == b)
+                    continue;
+
+                const Eigen::Vector3f seed_object_points[3] = { led_points[a], led_points[b], led_points[c] };
+                Eigen::Matrix3f rotations[4];
+                Eigen::Vector3f translations[4];
+                const int solution_count =
+                    eigen_alignment_solve_p3p(seed_bearings, seed_object_points, rotations, translations);
+
+                for (int solution_index = 0; solution_index < solution_count; ++solution_index)
+                {
+                    const Eigen::Matrix3f &rotation = rotations[solution_index];
+                    const Eigen::Vector3f &translation = translations[solution_index];
+
+                    for (int led_index = 0; led_index < led_count; ++led_index)
+                    {
+                        const Eigen::Vector3f camera_point = rotation*led_points[led_index] + translation;
+
+                        // LEDs behind the camera land well outside the match gate
+                        projected_points[led_index] =
+                            (camera_point.z() > k_real_epsilon)
+                            ? cv::Point2f(fx*camera_point.x() / camera_point.z() + cx, fy*camera_point.y() / camera_point.z() + cy)
+                            : cv::Point2f(-k_real_max, -k_real_max);
+                    }
+
+                    float mean_error_px;
+                    const int match_count =
+                        matchPointCloudProjectionToImagePoints(
+                            projected_points, undistorted_image_points, led_for_image_point, mean_error_px);
+
+                    if (match_count > best_match_count ||
+                        (match_count == best_match_count && mean_error_px < best_mean_error_px))
+                    {
+                        best_match_count = match_count;
+                        best_mean_error_px = mean_error_px;
+                        out_led_for_image_point = led_for_image_point;
+                        best_rotation = rotation;
+                        best_translation = translation;
+                    }
+                }
+            }
+        }
+    }
+
+    if (best_match_count < k_point_cloud_min_correspondences)
+    {
+        return false;
+    }
+
+    // Refine against the distorted blobs with the full camera model
+    const cv::Matx33d cvRotation(
+        best_rotation(0, 0), best_rotation(0, 1), best_rotation(0, 2),
+        best_rotation(1, 0), best_rotation(1, 1), best_rotation(1, 2),
+        best_rotation(2, 0), best_rotation(2, 1), best_rotation(2, 2));
+    cv::Rodrigues(cvRotation, rvec);
+    tvec.at<double>(0) = best_translation.x();
+    tvec.at<double>(1) = best_translation.y();
+    tvec.at<double>(2) = best_translation.z();
+
+    return
+        refinePointCloudPose(
+            object_points, image_points, out_led_for_image_point,
+            camera_matrix, dist_coeffs,
+            rvec, tvec);
+}
+
 static cv::Rect2i computeTrackerROIForPoseProjection(
     const bool roi_disabled,
     const ServerTrackerView *tracker,
@@ -2339,41 +7300,25 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
         // Get the (predicted) position in tracker-local space.
         CommonDevicePosition tracker_position_cm = tracker->computeTrackerPosition(&world_position_cm);
 
-        // Project the state computed position +/- object extents onto the image.
-        CommonDevicePosition tl, br;
+        // Compute the bounding radius of the tracking shape
+        float shape_radius = 1.f;
         switch (tracking_shape->shape_type)
         {
         case eCommonTrackingShapeType::Sphere:
             {
-                // Simply: center - radius, center + radius.
-                tl.set(tracker_position_cm.x - tracking_shape->shape.sphere.radius_cm,
-                    tracker_position_cm.y + tracking_shape->shape.sphere.radius_cm,
-                    tracker_position_cm.z);
-                br.set(tracker_position_cm.x + tracking_shape->shape.sphere.radius_cm,
-                    tracker_position_cm.y - tracking_shape->shape.sphere.radius_cm,
-                    tracker_position_cm.z);
+                shape_radius = tracking_shape->shape.sphere.radius_cm;
             } break;
 
         case eCommonTrackingShapeType::LightBar:
             {
-                // Compute the bounding radius of the lightbar tracking shape
                 const auto &shape_tl = tracking_shape->shape.light_bar.quad[CommonDeviceTrackingShape::QuadVertexUpperLeft];
                 const auto &shape_br = tracking_shape->shape.light_bar.quad[CommonDeviceTrackingShape::QuadVertexLowerRight];
                 const CommonDeviceVector half_vec = { (shape_tl.x - shape_br.x)*0.5f, (shape_tl.y - shape_br.y)*0.5f, (shape_tl.z - shape_br.z)*0.5f };
-                const auto shape_radius = fmaxf(sqrtf(half_vec.i*half_vec.i + half_vec.j*half_vec.j + half_vec.k*half_vec.k), 1.f);
-
-                // Simply: center - shape_radius, center + shape_radius.
-                tl.set(tracker_position_cm.x - shape_radius,
-                    tracker_position_cm.y + shape_radius,
-                    tracker_position_cm.z);
-                br.set(tracker_position_cm.x + shape_radius,
-                    tracker_position_cm.y - shape_radius,
-                    tracker_position_cm.z);
+                shape_radius = fmaxf(sqrtf(half_vec.i*half_vec.i + half_vec.j*half_vec.j + half_vec.k*half_vec.k), 1.f);
             } break;
 
         case eCommonTrackingShapeType::PointCloud:
             {
-                // Compute the bounding radius of the point cloud
                 CommonDevicePosition shape_tl = tracking_shape->shape.point_cloud.point[0];
                 CommonDevicePosition shape_br = tracking_shape->shape.point_cloud.point[0];
                 for (int point_index = 1; point_index < tracking_shape->shape.point_cloud.point_count; ++point_index)
@@ -2383,15 +7328,7 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
                     shape_br.set(fminf(shape_br.x, point.x), fminf(shape_br.y, point.y), fminf(shape_br.z, point.z));
                 }
                 const CommonDeviceVector half_vec = { (shape_tl.x - shape_br.x)*0.5f, (shape_tl.y - shape_br.y)*0.5f, (shape_tl.z - shape_br.z)*0.5f };
-                const auto shape_radius = fmaxf(sqrtf(half_vec.i*half_vec.i + half_vec.j*half_vec.j + half_vec.k*half_vec.k), 1.f);
-
-                // Simply: center - shape_radius, center + shape_radius.
-                tl.set(tracker_position_cm.x - shape_radius,
-                    tracker_position_cm.y + shape_radius,
-                    tracker_position_cm.z);
-                br.set(tracker_position_cm.x + shape_radius,
-                    tracker_position_cm.y - shape_radius,
-                    tracker_position_cm.z);
+                shape_radius = fmaxf(sqrtf(half_vec.i*half_vec.i + half_vec.j*half_vec.j + half_vec.k*half_vec.k), 1.f);
             } break;
 
         default:
@@ -2400,6 +7337,22 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
             } break;
         }
 
+        // Where the filter expects the object to be by the time the next video frame gets processed
+        const double frame_rate = tracker->getFrameRate();
+        const float frame_time = (frame_rate > 0.0) ? static_cast<float>(1.0 / frame_rate) : 0.f;
+        const Eigen::Vector3f predicted_position_cm = pose_filter->getPositionCm(frame_time);
+        CommonDevicePosition predicted_world_position_cm;
+        predicted_world_position_cm.set(predicted_position_cm.x(), predicted_position_cm.y(), predicted_position_cm.z());
+        const CommonDevicePosition predicted_tracker_position_cm = tracker->computeTrackerPosition(&predicted_world_position_cm);
+
+        // The prediction can be off by the unmodeled change in velocity over the frame,
+        // so widen the search window by a bound on how far that can carry the object
+        const float speed_cm_per_sec = pose_filter->getVelocityCmPerSec().norm();
+        const float accel_cm_per_sec_sqr = pose_filter->getAccelerationCmPerSecSqr().norm();
+        const float motion_margin_cm =
+            k_roi_velocity_uncertainty*speed_cm_per_sec*frame_time + 
+            0.5f*accel_cm_per_sec_sqr*frame_time*frame_time;
+
         // Extract the pixel projection center from the previous frame's projection.
         CommonDeviceScreenLocation projection_pixel_center;
         projection_pixel_center.clear();
@@ -2442,47 +7395,313 @@ static cv::Rect2i computeTrackerROIForPoseProjection(
             } break;
         }
 
-        // The center of the ROI is the pixel projection center from last frame
-        // The size of the ROI computed by projecting the bounding box 
+        // The ROI covers the bounding sphere's silhouette where the object is now
+        // and where it is predicted to be next frame (grown by the motion margin),
+        // padded by half the object's size on every side.
+        // The silhouettes get projected through the lens distortion, like the blobs in the video frame,
+        // so the ROI stays tight and on target out to the frame edges of wide angle lenses.
         {
-            std::vector<CommonDevicePosition> trps{ tl, br };
-            std::vector<CommonDeviceScreenLocation> screen_locs = tracker->projectTrackerRelativePositions(trps);
+            const cv::Rect2f current_bounds = 
+                computeDistortedSphereBounds(tracker, tracker_position_cm, shape_radius);
+            const cv::Rect2f predicted_bounds = 
+                computeDistortedSphereBounds(tracker, predicted_tracker_position_cm, shape_radius + motion_margin_cm);
+
+            // The filter position is off from where the object showed up last frame by the filter error,
+            // so line the projections up with the pixel projection center from last frame
+            const CommonDeviceScreenLocation filter_pixel_center = 
+                tracker->projectTrackerRelativePosition(&tracker_position_cm);
+            const cv::Point2f pixel_correction(
+                projection_pixel_center.x - filter_pixel_center.x,
+                projection_pixel_center.y - filter_pixel_center.y);
+
+            cv::Rect2f roi_bounds = (current_bounds | predicted_bounds) + pixel_correction;
+            const float padding_x = 0.5f*current_bounds.width;
+            const float padding_y = 0.5f*current_bounds.height;
+            roi_bounds.x -= padding_x;
+            roi_bounds.y -= padding_y;
+            roi_bounds.width += 2.f*padding_x;
+            roi_bounds.height += 2.f*padding_y;
+
+            const float min_roi_size = static_cast<float>(computeMinROISize(static_cast<int>(tracker->getFrameWidth())));
+            const float roi_center_x = roi_bounds.x + 0.5f*roi_bounds.width;
+            const float roi_center_y = roi_bounds.y + 0.5f*roi_bounds.height;
+            const float roi_half_width = std::max(0.5f*roi_bounds.width, min_roi_size);
+            const float roi_half_height = std::max(0.5f*roi_bounds.height, min_roi_size);
+
+            const cv::Point2i roi_top_left(
+                static_cast<int>(floorf(roi_center_x - roi_half_width)),
+                static_cast<int>(floorf(roi_center_y - roi_half_height)));
+            const cv::Point2i roi_bottom_right(
+                static_cast<int>(ceilf(roi_center_x + roi_half_width)),
+                static_cast<int>(ceilf(roi_center_y + roi_half_height)));
+
+            ROI = cv::Rect2i(roi_top_left, roi_bottom_right);
+        }
+    }
+
+    return ROI;
+}
+
+// Pixel bounding box of a sphere as the tracker sees it.
+// Samples the circle on the sphere facing the camera, which is the sphere's silhouette,
+// and projects each sample through the tracker's cached camera intrinsics and lens distortion.
+// The distortion squashes and shifts the silhouette the further it is from the image center,
+// more than a box around the undistorted center and radius can follow.
+static cv::Rect2f computeDistortedSphereBounds(
+    const ServerTrackerView *tracker,
+    const CommonDevicePosition &tracker_relative_center_cm,
+    const float radius_cm)
+{
+    // The silhouette circle lies in the plane facing the camera, spanned by the basis u, v
+    const Eigen::Vector3f center(tracker_relative_center_cm.x, tracker_relative_center_cm.y, tracker_relative_center_cm.z);
+    const float center_distance = center.norm();
+    const Eigen::Vector3f view_direction = 
+        (center_distance > k_real_epsilon) ? Eigen::Vector3f(center / center_distance) : Eigen::Vector3f(0.f, 0.f, 1.f);
+    Eigen::Vector3f u = view_direction.cross(Eigen::Vector3f(0.f, 1.f, 0.f));
+    if (u.squaredNorm() < k_real_epsilon)
+    {
+        u = view_direction.cross(Eigen::Vector3f(1.f, 0.f, 0.f));
+    }
+    u.normalize();
+    const Eigen::Vector3f v = view_direction.cross(u);
+
+    float min_x = k_real_max, min_y = k_real_max;
+    float max_x = -k_real_max, max_y = -k_real_max;
+    for (int sample_index = 0; sample_index < k_roi_silhouette_sample_count; ++sample_index)
+    {
+        const float angle = k_real_two_pi*static_cast<float>(sample_index) / static_cast<float>(k_roi_silhouette_sample_count);
+        const Eigen::Vector3f point = center + radius_cm*(cosf(angle)*u + sinf(angle)*v);
+
+        CommonDevicePosition silhouette_point;
+        silhouette_point.set(point.x(), point.y(), point.z());
+        const CommonDeviceScreenLocation pixel = tracker->projectTrackerRelativePosition(&silhouette_point);
+
+        min_x = fminf(min_x, pixel.x);
+        min_y = fminf(min_y, pixel.y);
+        max_x = fmaxf(max_x, pixel.x);
+        max_y = fmaxf(max_y, pixel.y);
+    }
+
+    return cv::Rect2f(min_x, min_y, max_x - min_x, max_y - min_y);
+}
+
+static cv::Rect2i computeTrackerROIForController(
+    const ServerTrackerView *tracker,
+    const ServerControllerView *tracked_controller,
+    const CommonDeviceTrackingShape *tracking_shape)
+{
+    const TrackerManagerConfig &trackerMgrConfig= DeviceManager::getInstance()->m_tracker_manager->getConfig();
+    const bool bRoiDisabled = tracked_controller->getIsROIDisabled() || trackerMgrConfig.disable_roi;
+
+    const ControllerOpticalPoseEstimation *priorPoseEst= 
+        tracked_controller->getTrackerPoseEstimate(tracker->getDeviceID());
+    const bool bIsTracking = priorPoseEst->bCurrentlyTracking;
+
+    return computeTrackerROIForPoseProjection(
+        bRoiDisabled,
+        tracker,
+        bIsTracking ? tracked_controller->getPoseFilter() : nullptr,
+        bIsTracking ? &priorPoseEst->projection : nullptr,
+        tracking_shape);
+}
+
+static cv::Rect2i computeTrackerROIForHMD(
+    const ServerTrackerView *tracker,
+    const ServerHMDView *tracked_hmd,
+    const CommonDeviceTrackingShape *tracking_shape)
+{
+    const TrackerManagerConfig &trackerMgrConfig= DeviceManager::getInstance()->m_tracker_manager->getConfig();
+    const bool bRoiDisabled = tracked_hmd->getIsROIDisabled() || trackerMgrConfig.disable_roi;
+
+    const HMDOpticalPoseEstimation *priorPoseEst= 
+        tracked_hmd->getTrackerPoseEstimate(tracker->getDeviceID());
+    const bool bIsTracking = priorPoseEst->bCurrentlyTracking;
+
+    return computeTrackerROIForPoseProjection(
+        bRoiDisabled,
+        tracker, 
+        bIsTracking ? tracked_hmd->getPoseFilter() : nullptr,
+        bIsTracking ? &priorPoseEst->projection : nullptr,
+        tracking_shape);
+}
+
+static bool getUseCoarseReacquisition(const bool roi_disabled, const bool is_tracking)
+{
+    const TrackerManagerConfig &trackerMgrConfig= DeviceManager::getInstance()->m_tracker_manager->getConfig();
+
+    return !roi_disabled && !is_tracking && trackerMgrConfig.reacquisition_pyramid_levels > 0;
+}
+
+static bool getIsPoseFilterMotionless(const IPoseFilter *pose_filter, const float max_angular_velocity)
+{
+    return
+        pose_filter != nullptr &&
+        pose_filter->getIsOrientationStateValid() &&
+        pose_filter->getAngularVelocityRadPerSec().norm() <= max_angular_velocity;
+}
+
+static bool getIsPoseFilterOutsideTrackerFrustum(const ServerTrackerView *tracker, const IPoseFilter *pose_filter, const float margin_cm)
+{
+    if (pose_filter == nullptr || !pose_filter->getIsPositionStateValid())
+    {
+        return false;
+    }
+
+    // Where the filter expects the device by the time the next video frame gets processed (same as the ROI)
+    const double frame_rate = tracker->getFrameRate();
+    const float frame_time = (frame_rate > 0.0) ? static_cast<float>(1.0 / frame_rate) : 0.f;
+    const Eigen::Vector3f predicted_position_cm = pose_filter->getPositionCm(frame_time);
+    CommonDevicePosition world_position_cm;
+    world_position_cm.set(predicted_position_cm.x(), predicted_position_cm.y(), predicted_position_cm.z());
+    const CommonDevicePosition tracker_position_cm = tracker->computeTrackerPosition(&world_position_cm);
+
+    // Grow the frustum by how far off the prediction can be over the frame
+    const float slack_cm = margin_cm + pose_filter->getVelocityCmPerSec().norm()*frame_time;
+
+    float hfov_degrees, vfov_degrees;
+    float z_near, z_far;
+    tracker->getFOV(hfov_degrees, vfov_degrees);
+    tracker->getZRange(z_near, z_far);
+
+    // The tracker looks down its +Z axis
+    const float half_width = tracker_position_cm.z*tanf(hfov_degrees*k_degrees_to_radians*0.5f) + slack_cm;
+    const float half_height = tracker_position_cm.z*tanf(vfov_degrees*k_degrees_to_radians*0.5f) + slack_cm;
+
+    return
+        tracker_position_cm.z < z_near - slack_cm ||
+        tracker_position_cm.z > z_far + slack_cm ||
+        fabsf(tracker_position_cm.x) > half_width ||
+        fabsf(tracker_position_cm.y) > half_height;
+}
+
+static void predictPointCloudLEDVisibility(
+    const ServerTrackerView *tracker,
+    const IPoseFilter *pose_filter,
+    const CommonDeviceTrackingShape &tracking_shape,
+    bool *out_bIsLEDVisible)
+{
+    std::fill(out_bIsLEDVisible, out_bIsLEDVisible + CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT, true);
 
-            const int proj_min_x = static_cast<int>(std::min(screen_locs[0].x, screen_locs[1].x));
-            const int proj_max_x = static_cast<int>(std::max(screen_locs[0].x, screen_locs[1].x));
-            const int proj_min_y = static_cast<int>(std::min(screen_locs[0].y, screen_locs[1].y));
-            const int proj_max_y = static_cast<int>(std::max(screen_locs[0].y, screen_locs[1].y));
+    if (tracking_shape.shape_type != eCommonTrackingShapeType::PointCloud ||
+        pose_filter == nullptr || !pose_filter->getIsStateValid())
+    {
+        return;
+    }
 
-            const int proj_width = proj_max_x - proj_min_x;
-            const int proj_height = proj_max_y - proj_min_y;
+    const int led_count = tracking_shape.shape.point_cloud.point_count;
 
-            const cv::Point2i roi_center(static_cast<int>(projection_pixel_center.x), static_cast<int>(projection_pixel_center.y));
+    // Where the filter expects the HMD by the time the next video frame gets processed (same as the ROI)
+    const double frame_rate = tracker->getFrameRate();
+    const float frame_time = (frame_rate > 0.0) ? static_cast<float>(1.0 / frame_rate) : 0.f;
 
-            const int safe_proj_width = std::max(proj_width, k_min_roi_size);
-            const int safe_proj_height = std::max(proj_height, k_min_roi_size);
+    // Tracker relative orientation, in the same frame the point cloud pose gets solved in
+    // (the inverse of computeWorldOrientation())
+    CommonDeviceQuaternion identity;
+    identity.clear();
+    const CommonDeviceQuaternion tracker_to_world = tracker->computeWorldOrientation(&identity);
+    const Eigen::Quaternionf orientation =
+        eigen_quaternionf_view(tracker_to_world).conjugate() * pose_filter->getOrientation(frame_time);
 
-            const cv::Point2i roi_top_left = roi_center + cv::Point2i(-safe_proj_width, -safe_proj_height);
-            const cv::Size roi_size(2*safe_proj_width, 2*safe_proj_height);
+    Eigen::Vector3f position_cm(0.f, 0.f, k_point_cloud_led_visibility_default_distance_cm);
+    if (pose_filter->getIsPositionStateValid())
+    {
+        const Eigen::Vector3f predicted_position_cm = pose_filter->getPositionCm(frame_time);
+        CommonDevicePosition world_position_cm;
+        world_position_cm.set(predicted_position_cm.x(), predicted_position_cm.y(), predicted_position_cm.z());
+        const CommonDevicePosition tracker_position_cm = tracker->computeTrackerPosition(&world_position_cm);
 
-            ROI = cv::Rect2i(roi_top_left, roi_size);
+        if (tracker_position_cm.z > k_real_epsilon)
+        {
+            position_cm = eigen_vector3f_view(tracker_position_cm);
         }
     }
 
-    return ROI;
+    // The LEDs sit on the outside of the HMD, so each one faces away from the middle of the point cloud
+    Eigen::Vector3f centroid = Eigen::Vector3f::Zero();
+    for (int led_index = 0; led_index < led_count; ++led_index)
+    {
+        centroid += eigen_vector3f_view(tracking_shape.shape.point_cloud.point[led_index]);
+    }
+    centroid /= static_cast<float>(std::max(led_count, 1));
+
+    int visible_led_count = 0;
+    for (int led_index = 0; led_index < led_count; ++led_index)
+    {
+        const Eigen::Vector3f model_point = eigen_vector3f_view(tracking_shape.shape.point_cloud.point[led_index]);
+        const Eigen::Vector3f led_direction = orientation*(model_point - centroid);
+        const Eigen::Vector3f line_of_sight = -(orientation*model_point + position_cm);
+        const float length_product = led_direction.norm()*line_of_sight.norm();
+
+        out_bIsLEDVisible[led_index] =
+            length_product <= k_real_epsilon ||
+            led_direction.dot(line_of_sight) >= k_point_cloud_led_visibility_min_cos*length_product;
+
+        if (out_bIsLEDVisible[led_index])
+        {
+            ++visible_led_count;
+        }
+    }
+
+    // Not enough LEDs left to solve a pose from, the orientation is probably off
+    if (visible_led_count < k_point_cloud_min_correspondences)
+    {
+        std::fill(out_bIsLEDVisible, out_bIsLEDVisible + CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT, true);
+    }
+}
+
+static bool computePoseFilterPixelLocation(const ServerTrackerView *tracker, const IPoseFilter *pose_filter, cv::Point2f &out_pixel_location)
+{
+    if (pose_filter == nullptr || !pose_filter->getIsPositionStateValid())
+    {
+        return false;
+    }
+
+    // Where the filter expects the device by the time the next video frame gets processed (same as the ROI)
+    const double frame_rate = tracker->getFrameRate();
+    const float frame_time = (frame_rate > 0.0) ? static_cast<float>(1.0 / frame_rate) : 0.f;
+    const Eigen::Vector3f predicted_position_cm = pose_filter->getPositionCm(frame_time);
+    CommonDevicePosition world_position_cm;
+    world_position_cm.set(predicted_position_cm.x(), predicted_position_cm.y(), predicted_position_cm.z());
+    const CommonDevicePosition tracker_position_cm = tracker->computeTrackerPosition(&world_position_cm);
+
+    // Nothing to project behind the camera
+    if (tracker_position_cm.z <= k_real_epsilon)
+    {
+        return false;
+    }
+
+    const CommonDeviceScreenLocation screen_location = tracker->projectTrackerRelativePosition(&tracker_position_cm);
+    out_pixel_location = cv::Point2f(screen_location.x, screen_location.y);
+
+    return true;
+}
+
+static OpenCVBlobSelection makeBlobSelection(const TrackerProjectionJob &job)
+{
+    OpenCVBlobSelection selection;
+
+    selection.candidate_count = job.shared_color_job_count;
+    selection.bHasPredictedLocation = job.bHasPredictedPixelLocation;
+    selection.predicted_location = job.predicted_pixel_location;
+
+    return selection;
 }
 
 static bool computeBestFitTriangleForContour(
-    const t_opencv_float_contour &opencv_contour,
+    const t_opencv_float_contour &opencv_hull,
+    const cv::Point2f &mass_center,
+    t_opencv_float_contour &scratch_triangle,
     cv::Point2f &out_triangle_top,
     cv::Point2f &out_triangle_bottom_left,
     cv::Point2f &out_triangle_bottom_right)
 {
-    // Compute the tightest possible bounding triangle for the given contour
-    t_opencv_float_contour cv_min_triangle;
+    // Compute the tightest possible bounding triangle for the given contour.
+    // Only its convex hull matters, which the caller already has.
+    t_opencv_float_contour &cv_min_triangle = scratch_triangle;
 
     try
     {
-        cv::minEnclosingTriangle(opencv_contour, cv_min_triangle);
+        cv::minEnclosingTriangle(opencv_hull, cv_min_triangle);
     }
     catch( cv::Exception& e )
     {
@@ -2495,25 +7714,21 @@ static bool computeBestFitTriangleForContour(
         return false;
     }
 
-    cv::Point2f best_fit_origin_01 = (cv_min_triangle[0] + cv_min_triangle[1]) / 2.f;
-    cv::Point2f best_fit_origin_12 = (cv_min_triangle[1] + cv_min_triangle[2]) / 2.f;
-    cv::Point2f best_fit_origin_20 = (cv_min_triangle[2] + cv_min_triangle[0]) / 2.f;
-
-    t_opencv_float_contour cv_midpoint_triangle;
-    cv_midpoint_triangle.push_back(best_fit_origin_01);
-    cv_midpoint_triangle.push_back(best_fit_origin_12);
-    cv_midpoint_triangle.push_back(best_fit_origin_20);
+    const cv::Point2f cv_midpoint_triangle[3] = {
+        (cv_min_triangle[0] + cv_min_triangle[1]) / 2.f,
+        (cv_min_triangle[1] + cv_min_triangle[2]) / 2.f,
+        (cv_min_triangle[2] + cv_min_triangle[0]) / 2.f
+    };
 
     // Find the corner closest to the center of mass.
     // This is the bottom of the triangle.
     int topCornerIndex = -1;
     {
-        const cv::Point2f massCenter = computeSafeCenterOfMassForContour<t_opencv_float_contour>(opencv_contour);
-
-        double bestDistance = k_real_max;
+        float bestDistance = k_real_max;
         for (int cornerIndex = 0; cornerIndex < 3; ++cornerIndex)
         {
-            const double testDistance = cv::norm(cv_midpoint_triangle[cornerIndex] - massCenter);
+            const cv::Point2f toMassCenter = cv_midpoint_triangle[cornerIndex] - mass_center;
+            const float testDistance = toMassCenter.dot(toMassCenter); // squared, only compared
 
             if (testDistance < bestDistance)
             {
@@ -2564,7 +7779,7 @@ static bool computeBestFitTriangleForContour(
 }
 
 static bool computeBestFitQuadForContour(
-    const t_opencv_float_contour &opencv_contour,
+    const t_opencv_float_contour &opencv_hull,
     const cv::Point2f &up_hint, 
     const cv::Point2f &right_hint,
     cv::Point2f &top_right,
@@ -2572,8 +7787,8 @@ static bool computeBestFitQuadForContour(
     cv::Point2f &bottom_left,
     cv::Point2f &bottom_right)
 {
-    // Compute the tightest possible bounding triangle for the given contour
-    cv::RotatedRect cv_min_box= cv::minAreaRect(opencv_contour);
+    // Compute the tightest possible bounding box for the given contour (the same one its convex hull has)
+    cv::RotatedRect cv_min_box= cv::minAreaRect(opencv_hull);
 
     if (cv_min_box.size.width <= k_real_epsilon || cv_min_box.size.height <= k_real_epsilon)
     {
@@ -2770,3 +7985,23 @@ static void angleAxisVectorToCommonDeviceOrientation(
         orientation.clear();
     }
 }
+
+template<typename t_pose_estimate_type>
+void poseEstimateToCameraNodePoseEstimate(const t_pose_estimate_type &pose_estimate, CameraNodePoseEstimate &out_pose_estimate)
+{
+    out_pose_estimate.position_cm = pose_estimate.position_cm;
+    out_pose_estimate.projection = pose_estimate.projection;
+    out_pose_estimate.orientation = pose_estimate.orientation;
+    out_pose_estimate.is_currently_tracking = pose_estimate.bCurrentlyTracking ? 1 : 0;
+    out_pose_estimate.is_orientation_valid = pose_estimate.bOrientationValid ? 1 : 0;
+}
+
+template<typename t_pose_estimate_type>
+void cameraNodePoseEstimateToPoseEstimate(const CameraNodePoseEstimate &pose_estimate, t_pose_estimate_type *out_pose_estimate)
+{
+    out_pose_estimate->position_cm = pose_estimate.position_cm;
+    out_pose_estimate->projection = pose_estimate.projection;
+    out_pose_estimate->orientation = pose_estimate.orientation;
+    out_pose_estimate->bCurrentlyTracking = pose_estimate.is_currently_tracking != 0;
+    out_pose_estimate->bOrientationValid = pose_estimate.is_orientation_valid != 0;
+}
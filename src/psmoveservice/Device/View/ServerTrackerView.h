@@ -4,6 +4,7 @@
 //-- includes -----
 #include "ServerDeviceView.h"
 #include "PSMoveProtocolInterface.h"
+#include <functional>
 #include <vector>
 
 // -- pre-declarations -----
@@ -14,6 +15,50 @@ namespace PSMoveProtocol
 };
 
 // -- declarations -----
+/// Encoder settings of a tracker's network video stream (see RequestStartTrackerDataStream)
+struct TrackerNetworkVideoSettings
+{
+    int max_frame_rate; // 0 = as fast as frames arrive
+    int quality; // JPEG quality 1-100
+    int max_width; // 0 = full size
+    // Region of the video frame to send, empty = the whole frame
+    int roi_x;
+    int roi_y;
+    int roi_width;
+    int roi_height;
+};
+
+/// What a shared memory video stream wants written into the shared memory
+struct TrackerVideoPreviewSettings
+{
+    int scale; // 1 = full size, 2 = half, 4 = quarter width and height
+    int pixel_format; // eSharedVideoPixelFormat
+};
+
+/// The latest JPEG encoded frame of a tracker's network video stream
+struct TrackerNetworkVideoFrame
+{
+    int frame_index; // 0 = none encoded yet
+    long long timestamp_us; // same clock as the shared memory video frame timestamps
+    int frame_width;
+    int frame_height;
+    int roi_x;
+    int roi_y;
+    int roi_width;
+    int roi_height;
+    int image_width;
+    int image_height;
+    std::vector<unsigned char> jpeg_data;
+};
+
+/// A controller's or HMD's color presets for one tracker, looked up by the device's config identifier once
+/// so the per-frame searches don't have to (see ServerTrackerView::invalidateTrackingColorPresets())
+struct TrackerColorPresetHandle
+{
+    CommonHSVColorRange color_presets[eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES];
+    bool bIsResolved;
+};
+
 class ServerTrackerView : public ServerDeviceView
 {
 public:
@@ -25,8 +70,32 @@ public:
 
     // Starts or stops streaming of the video feed to the shared memory buffer.
     // Keep a ref count of how many clients are following the stream.
-    void startSharedMemoryVideoStream();
-    void stopSharedMemoryVideoStream();
+    // The frames get written at the largest scale and richest pixel format any of the streams asked for.
+    void startSharedMemoryVideoStream(const TrackerVideoPreviewSettings &preview);
+    void stopSharedMemoryVideoStream(const TrackerVideoPreviewSettings &preview);
+
+    // Starts or stops JPEG encoding the video feed for clients streaming it over the network.
+    // Ref counted like the shared memory stream, the last stream started picks the encoder settings.
+    void startNetworkVideoStream(const TrackerNetworkVideoSettings &settings);
+    void stopNetworkVideoStream();
+    inline const TrackerNetworkVideoFrame &getNetworkVideoFrame() const
+    {
+        return m_network_video_frame;
+    }
+
+    // True while any client follows the shared memory or network video stream
+    inline bool getHasActiveVideoStream() const
+    {
+        return m_shared_memory_video_stream_count > 0 || m_network_video_stream_count > 0;
+    }
+
+    // Stops or restarts the camera stream while the tracker stays open (see TrackerManager::updateCaptureSuspension()).
+    // Returns false if the camera can't stop its stream.
+    bool setCaptureSuspended(bool bSuspended);
+    inline bool getIsCaptureSuspended() const
+    {
+        return m_bIsCaptureSuspended;
+    }
 
     // Fetch the next video frame and copy to shared memory
     bool poll() override;
@@ -44,10 +113,40 @@ public:
 
     // Returns the name of the shared memory block video frames are written to
     std::string getSharedMemoryStreamName() const;
+
+    // Returns the time the latest video frame was captured,
+    // or the time it was polled if the tracker doesn't timestamp its frames
+    std::chrono::time_point<std::chrono::high_resolution_clock> getLastVideoFrameCaptureTimestamp() const;
+
+    // Video frames the camera dropped right before the latest video frame.
+    // Device motion can't be measured across that frame and the one before it.
+    inline int getLastVideoFrameDropCount() const
+    {
+        return m_last_video_frame_drop_count;
+    }
+
+    // Video frames the camera dropped since the tracker opened
+    inline long long getDroppedVideoFrameCount() const
+    {
+        return m_dropped_video_frame_count;
+    }
     
     void loadSettings();
     void saveSettings();
 
+    // Runs device_update (the part of a settings change that talks to the camera and its config)
+    // on a thread of its own, so the trackers of a rig can all reconfigure at once without holding up the main loop.
+    // The tracker sits out its polls until it's done, then the new settings get swapped in at the next frame.
+    // Returns false if the tracker is closed or another change is still in flight.
+    bool startSettingsChange(const std::function<void(ITrackerInterface *)> &device_update);
+    // Blocks until the settings change in flight (if any) is done and swaps it in.
+    // Anything else on the main thread touching the camera or its config has to call this first.
+    void finishSettingsChange();
+    inline bool getIsSettingsChangeInFlight() const
+    {
+        return m_settings_change != nullptr;
+    }
+
 	double getFrameWidth() const;
 	void setFrameWidth(double value, bool bUpdateConfig);
 
@@ -63,13 +162,80 @@ public:
     double getGain() const;
     void setGain(double value, bool bUpdateConfig);
     
+    // Queue up the blob search for every optically tracked controller and HMD in the latest video frame.
+    // Runs on this tracker's vision worker thread unless worker threads are disabled in the config.
+    void startProjectionWork();
+    // Blocks until the work queued by startProjectionWork() has finished
+    void waitForProjectionWork();
+
+    // True if the vision worker searches a frame while the main loop moves on (see TrackerManagerConfig::use_pipelined_vision).
+    // Then there is no waitForProjectionWork(): the work gets retired by one of the calls below,
+    // which makes its results the ones the fetch*ProjectionResult() calls return.
+    inline bool getIsVisionPipelined() const
+    {
+        return m_bIsVisionPipelined;
+    }
+    // Returns true if work got retired since the last call. Doesn't block.
+    bool pollPipelinedProjectionWork();
+    // Blocks until the work in flight (if any) is retired.
+    // Anything else on the main thread touching the video frame buffers or the camera has to call this first.
+    void finishPipelinedProjectionWork();
+
+    // Capture time (and the frames dropped right before) of the video frame the current projection results came from.
+    // Only differs from the latest video frame with pipelined vision.
+    std::chrono::time_point<std::chrono::high_resolution_clock> getProjectionResultCaptureTimestamp() const;
+    int getProjectionResultFrameDropCount() const;
+
+    // Smoothed time the projection work takes per video frame
+    float getProjectionWorkTimeMs() const;
+    // Smoothed fraction of the frame period the frame ingest (main thread) and the projection work (vision worker) keep their thread busy
+    float getFrameIngestOccupancy() const;
+    float getProjectionWorkOccupancy() const;
+    // Smoothed time the main thread waited per frame for pipelined projection work to finish
+    float getPipelineStallTimeMs() const;
+
+    // Memory held by the tracker's vision buffers, its shared memory video frames and its network video frame
+    size_t getVisionBufferBytes() const;
+    size_t getSharedVideoFrameBytes() const;
+    size_t getNetworkVideoFrameBytes() const;
+    // The BGR->HSV table all of the trackers share, see TrackerManagerConfig::use_bgr_to_hsv_lookup_table
+    static void getBGRToHSVTableBytes(size_t &out_private_bytes, size_t &out_mapped_bytes);
+
+    // Fetch the projection found in the latest video frame for the given controller or HMD.
+    // Returns false if the device wasn't found in the frame.
+    bool fetchControllerProjectionResult(int controller_id, struct ControllerOpticalPoseEstimation *out_pose_estimate);
+    bool fetchHMDProjectionResult(int hmd_id, struct HMDOpticalPoseEstimation *out_pose_estimate);
+
+    // Camera nodes only: send the projections found in the latest video frame to the host (see CameraNodeLink)
+    void sendCameraNodeProjections();
+    // Publish where the latest video frame got searched for each device and what was found there (see SharedTrackerProjections.h)
+    void writeSharedProjections(class SharedTrackerProjectionWriter *writer);
+    // True for the trackers that are cameras on a camera node (see RemoteTracker)
+    inline bool getIsRemoteCamera() const
+    {
+        return m_bIsRemoteCamera;
+    }
+
+    // Classify the latest video frame against the tracking colors of all of the given jobs in one pass.
+    // computeProjectionForController/HMD then reuse the resulting label image.
+    void segmentTrackingColors(const std::vector<struct TrackerProjectionJob> &jobs);
+
+    // Forget which blobs got handed out to the devices sharing a tracking color, before searching the latest video frame
+    void clearBlobClaims();
+
+    // Motion gating (see TrackerManagerConfig::use_motion_gating).
+    // Returns true if the job's device can keep its previous projection for the latest video frame:
+    // its gyro reads still and the region the projection got found in hasn't changed since.
+    bool tryReuseProjection(const struct TrackerProjectionJob &job, const struct CommonDeviceTrackingProjection &projection);
+    // Remember the region the job's device projection just got computed from (forgotten if none was found)
+    void updateProjectionMotionGate(const struct TrackerProjectionJob &job, bool bProjectionValid);
+
+    // Search the latest video frame for the job's controller or HMD
     bool computeProjectionForController(
-        const class ServerControllerView* tracked_controller, 
-		const struct CommonDeviceTrackingShape *tracking_shape,
+        const struct TrackerProjectionJob &job,
         struct ControllerOpticalPoseEstimation *out_pose_estimate);
     bool computeProjectionForHMD(
-		const class ServerHMDView* tracked_hmd,
-		const struct CommonDeviceTrackingShape *tracking_shape,
+        const struct TrackerProjectionJob &job,
 		struct HMDOpticalPoseEstimation *out_pose_estimate);
     bool computePoseForProjection(
 		const struct CommonDeviceTrackingProjection *projection,
@@ -88,6 +254,27 @@ public:
     CommonDevicePosition computeTrackerPosition(const CommonDevicePosition *world_relative_position) const;
     CommonDeviceQuaternion computeTrackerOrientation(const CommonDeviceQuaternion *world_relative_orientation) const;
 
+    /// Batched computeWorldPosition(), computeWorldOrientation() and projectTrackerRelativePosition()
+    /**
+     Entry i gets transformed by trackers[i]. The multi-tracker fusion hands every tracker
+     relative estimate of a tick over in one call, which only reads the cached camera matrices.
+     */
+    static void computeWorldPositionsBatch(
+        const ServerTrackerView * const *trackers,
+        const CommonDevicePosition *tracker_relative_positions,
+        const int count,
+        CommonDevicePosition *out_world_positions);
+    static void computeWorldOrientationsBatch(
+        const ServerTrackerView * const *trackers,
+        const CommonDeviceQuaternion *tracker_relative_orientations,
+        const int count,
+        CommonDeviceQuaternion *out_world_orientations);
+    static void projectTrackerRelativePositionsBatch(
+        const ServerTrackerView * const *trackers,
+        const CommonDevicePosition *tracker_relative_positions,
+        const int count,
+        CommonDeviceScreenLocation *out_screen_locations);
+
     /// Given a single screen location on two different trackers, compute the triangulated world space location
     static CommonDevicePosition triangulateWorldPosition(
         const ServerTrackerView *tracker, const CommonDeviceScreenLocation *screen_location,
@@ -102,6 +289,18 @@ public:
 		const int screen_location_count,
 		CommonDevicePosition *out_result);
 
+    /// Given a single screen location on N different trackers, compute the triangulated world space location.
+    /// Solves one weighted linear (DLT) system across all trackers, so the cost is linear in tracker count.
+    /// The weights are typically the projection areas. Optionally refines the result with a few
+    /// Gauss-Newton steps on the weighted reprojection error. Returns false if the system is degenerate.
+    static bool triangulateWorldPositionFromMultipleTrackers(
+        const ServerTrackerView * const *trackers,
+        const CommonDeviceScreenLocation *screen_locations,
+        const float *weights,
+        const int tracker_count,
+        const int refinement_iterations,
+        CommonDevicePosition *out_result);
+
     /// Given screen projections on two different trackers, compute the triangulated world space location
     static CommonDevicePose triangulateWorldPose(
         const ServerTrackerView *tracker, const CommonDeviceTrackingProjection *tracker_relative_projection,
@@ -138,6 +337,17 @@ public:
 	void setHMDTrackingColorPreset(const class ServerHMDView *controller, eCommonTrackingColorID color, const CommonHSVColorRange *preset);
 	void getHMDTrackingColorPreset(const class ServerHMDView *controller, eCommonTrackingColorID color, CommonHSVColorRange *out_preset) const;
 
+    // Drop the resolved color presets of every controller and HMD.
+    // Called whenever a preset changes or a device slot may have been handed to another device.
+    void invalidateTrackingColorPresets();
+
+    // Pick the color range of the color the controller or HMD is lit with from the
+    // hue/saturation/value histograms of the latest video frame (doesn't assign it).
+    // Looks around the device's last projection if this tracker sees it, otherwise at the whole frame.
+    // Returns false if too few pixels look like the LED.
+    bool computeControllerTrackingColorPresetFromHistogram(const class ServerControllerView *controller, eCommonTrackingColorID color, CommonHSVColorRange *out_preset);
+    bool computeHMDTrackingColorPresetFromHistogram(const class ServerHMDView *hmd, eCommonTrackingColorID color, CommonHSVColorRange *out_preset);
+
 protected:
     bool allocate_device_interface(const class DeviceEnumerator *enumerator) override;
     void free_device_interface() override;
@@ -146,12 +356,91 @@ protected:
         const ServerTrackerView *tracker_view, const struct TrackerStreamInfo *stream_info,
         DeviceOutputDataFramePtr &data_frame);
 
+    // Allocated by allocate_device_interface()
+    ITrackerInterface *m_device;
+    bool m_bIsRemoteCamera;
+
 private:
+    // Resizes the shared memory video frame and the OpenCV buffers after the camera mode changed
+    void reallocateVideoFrameBuffers();
+
+    // The shared memory video frames only exist while a client streams video from the tracker
+    void allocateSharedMemoryVideoFrames();
+    void freeSharedMemoryVideoFrames();
+
+    // Collect the devices startProjectionWork() searches the latest video frame for
+    void gatherProjectionJobs(std::vector<struct TrackerProjectionJob> &jobs);
+    // Camera nodes only: turn the host's jobs for this camera into local ones
+    void gatherCameraNodeJobs(const std::vector<struct CameraNodeJob> &node_jobs, std::vector<struct TrackerProjectionJob> &jobs);
+    // Remote cameras only: hand the jobs to the camera node
+    void sendCameraNodeJobs(const std::vector<struct TrackerProjectionJob> &jobs);
+
+    // Look up every color preset of the device once (main thread only)
+    void resolveTrackingColorPresets(const std::string &device_identifier, TrackerColorPresetHandle &handle) const;
+
+    // Nudges the exposure and gain towards the configured blob brightness, see TrackerManagerConfig::use_auto_exposure
+    void updateAutoExposure();
+
+    // Latch the results of the pipelined work in flight and publish its video frame
+    void retireProjectionWork();
+
+    // Retires the settings change in flight if it's done, returns true while one is still running
+    bool pollSettingsChange();
+    void retireSettingsChange();
+
+    // Copy the latest video frame and its debug overlay to shared memory
+    void writeSharedMemoryVideoFrame();
+    // Pick the preview the shared memory frames get written as from the streams' requests
+    void updateSharedMemoryPreview();
+
+    // JPEG encode the latest video frame with its debug overlay drawn in, for the network video streams
+    void encodeNetworkVideoFrame();
+
     char m_shared_memory_name[256];
     class SharedVideoFrameReadWriteAccessor *m_shared_memory_accesor;
     int m_shared_memory_video_stream_count;
+    int m_shared_memory_preview_scale_counts[3]; // Streams asking for scale 1, 2 and 4
+    int m_shared_memory_preview_format_counts[3]; // Streams asking for each eSharedVideoPixelFormat
+    TrackerVideoPreviewSettings m_shared_memory_preview; // What the frames get written as
+    bool m_bPublishVideoFrame;
+    int m_network_video_stream_count;
+    bool m_bIsCaptureSuspended;
+    TrackerNetworkVideoSettings m_network_video_settings;
+    TrackerNetworkVideoFrame m_network_video_frame;
+    bool m_bPublishNetworkVideoFrame;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_network_video_frame_time;
+    long long m_video_frame_timestamp_us;
+    long long m_last_video_frame_sequence_number;
+    int m_last_video_frame_drop_count;
+    long long m_dropped_video_frame_count;
     class OpenCVBufferState *m_opencv_buffer_state;
-    ITrackerInterface *m_device;
+    class OpenCVUndistortionGrid *m_undistortion_grid;
+    class TrackerCameraMatrices *m_camera_matrices;
+    class TrackerVisionWorker *m_vision_worker;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_last_auto_exposure_update;
+    long long m_projection_work_count; // startProjectionWork() calls, paces the fusion standby searches
+    long long m_camera_node_frame_sequence_number; // Camera nodes only: the frames sendCameraNodeProjections() reported
+
+    // Resolved color presets, indexed by controller and HMD id (see getControllerTrackingColorPreset())
+    mutable std::vector<TrackerColorPresetHandle> m_controller_color_presets;
+    mutable std::vector<TrackerColorPresetHandle> m_hmd_color_presets;
+
+    // Pipelined vision state, see getIsVisionPipelined()
+    bool m_bIsVisionPipelined;
+    bool m_bIsProjectionWorkInFlight;
+    bool m_bHasRetiredProjectionWork;
+    bool m_bPublishInFlightVideoFrame;
+    bool m_bPublishInFlightNetworkVideoFrame;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_in_flight_capture_timestamp;
+    int m_in_flight_frame_drop_count;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_projection_capture_timestamp;
+    int m_projection_frame_drop_count;
+
+    class VisionStageTimer *m_frame_ingest_timer;
+    class VisionStageTimer *m_pipeline_stall_timer;
+
+    // See startSettingsChange()
+    class TrackerSettingsChange *m_settings_change;
 };
 
 #endif // SERVER_TRACKER_VIEW_H
@@ -62,6 +62,17 @@ void CompoundPoseFilter::allocate_filters(
 {
 	dispose_filters();
 
+	m_orientation_filter_uses_optical=
+		orientationFilterType == OrientationFilterTypePassThru ||
+		orientationFilterType == OrientationFilterTypeComplementaryOpticalARG ||
+		orientationFilterType == OrientationFilterTypeKalman;
+	m_position_filter_uses_imu=
+		positionFilterType == PositionFilterTypeLowPassIMU ||
+		positionFilterType == PositionFilterTypeComplimentaryOpticalIMU ||
+		positionFilterType == PositionFilterTypeKalman;
+	m_orientation_skipped_time_delta= 0.f;
+	m_position_skipped_time_delta= 0.f;
+
 	switch(orientationFilterType)
 	{
     case OrientationFilterTypeNone:
@@ -124,6 +135,9 @@ void CompoundPoseFilter::allocate_filters(
 	case PositionFilterTypeKalman:
 		m_position_filter = new KalmanPositionFilter;
 		break;
+	case PositionFilterTypeOneEuro:
+		m_position_filter = new PositionFilterOneEuro;
+		break;
 	default:
 		assert(0 && "unreachable");
 	}
@@ -144,21 +158,109 @@ void CompoundPoseFilter::update(
 	const float delta_time,
 	const PoseFilterPacket &orientation_filter_packet)
 {
+	// Update the orientation filter first
+	float orientation_time_delta;
+	if (take_orientation_filter_time_delta(delta_time, orientation_filter_packet, orientation_time_delta))
+	{
+		m_orientation_filter->update(orientation_time_delta, orientation_filter_packet);
+	}
+
+	update_position_filter(delta_time, orientation_filter_packet);
+}
+
+OrientationFilterBatchKernel CompoundPoseFilter::getBatchKernel() const
+{
+	// The orientation filter only gets updated alongside a position filter
+	return (m_orientation_filter != nullptr && m_position_filter != nullptr)
+		? m_orientation_filter->getBatchKernel()
+		: OrientationFilterBatchKernel_None;
+}
+
+int CompoundPoseFilter::beginBatchUpdate(
+	const float delta_time,
+	const PoseFilterPacket &orientation_filter_packet,
+	OrientationFilterBatchLanes &lanes)
+{
+	int lane= -1;
+
+	float orientation_time_delta;
+	if (take_orientation_filter_time_delta(delta_time, orientation_filter_packet, orientation_time_delta))
+	{
+		lane= m_orientation_filter->beginBatchUpdate(orientation_time_delta, orientation_filter_packet, lanes);
+	}
+
+	return lane;
+}
+
+void CompoundPoseFilter::endBatchUpdate(
+	const float delta_time,
+	const PoseFilterPacket &orientation_filter_packet,
+	const OrientationFilterBatchLanes &lanes,
+	const int lane)
+{
+	if (lane >= 0)
+	{
+		m_orientation_filter->endBatchUpdate(orientation_filter_packet, lanes, lane);
+	}
+
+	update_position_filter(delta_time, orientation_filter_packet);
+}
+
+bool CompoundPoseFilter::take_orientation_filter_time_delta(
+	const float delta_time,
+	const PoseFilterPacket &orientation_filter_packet,
+	float &out_time_delta)
+{
+	bool bTakesPacket= false;
+
+	if (m_orientation_filter != nullptr && m_position_filter != nullptr)
+	{
+		const bool bHasIMU= orientation_filter_packet.has_imu_measurements();
+		const bool bHasOptical= orientation_filter_packet.has_optical_measurement();
+
+		if (bHasIMU || (bHasOptical && m_orientation_filter_uses_optical))
+		{
+			out_time_delta= m_orientation_skipped_time_delta + delta_time;
+			m_orientation_skipped_time_delta= 0.f;
+			bTakesPacket= true;
+		}
+		else
+		{
+			m_orientation_skipped_time_delta+= delta_time;
+		}
+	}
+
+	return bTakesPacket;
+}
+
+void CompoundPoseFilter::update_position_filter(
+	const float delta_time,
+	const PoseFilterPacket &orientation_filter_packet)
+{
+	const bool bHasIMU= orientation_filter_packet.has_imu_measurements();
+	const bool bHasOptical= orientation_filter_packet.has_optical_measurement();
+
     Eigen::Quaternionf filtered_orientation= Eigen::Quaternionf::Identity();
 	if (m_orientation_filter != nullptr && m_position_filter != nullptr)
 	{
-		// Update the orientation filter first
-		m_orientation_filter->update(delta_time, orientation_filter_packet);
         filtered_orientation= m_orientation_filter->getOrientation();
     }
 
     if (m_position_filter != nullptr)
     {
-		// Update the position filter using the latest orientation
-		PoseFilterPacket position_filter_packet= orientation_filter_packet;
-		position_filter_packet.current_orientation= filtered_orientation;
+		if (bHasOptical || (bHasIMU && m_position_filter_uses_imu))
+		{
+			// Update the position filter using the latest orientation
+			PoseFilterPacket position_filter_packet= orientation_filter_packet;
+			position_filter_packet.current_orientation= filtered_orientation;
 
-		m_position_filter->update(delta_time, position_filter_packet);
+			m_position_filter->update(m_position_skipped_time_delta + delta_time, position_filter_packet);
+			m_position_skipped_time_delta= 0.f;
+		}
+		else
+		{
+			m_position_skipped_time_delta+= delta_time;
+		}
 	}
 
     if (m_orientation_filter != nullptr || m_position_filter != nullptr)
@@ -173,6 +275,8 @@ void CompoundPoseFilter::resetState()
 	{
 		m_orientation_filter->resetState();
 		m_position_filter->resetState();
+		m_orientation_skipped_time_delta= 0.f;
+		m_position_skipped_time_delta= 0.f;
         m_time= 0.0;
 	}
 }
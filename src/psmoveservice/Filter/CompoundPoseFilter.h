@@ -24,6 +24,7 @@ enum PositionFilterType {
     PositionFilterTypeComplimentaryOpticalIMU,
 	PositionFilterTypeLowPassExponential,
 	PositionFilterTypeKalman,
+	PositionFilterTypeOneEuro,
 };
 
 // -- definitions --
@@ -33,6 +34,11 @@ public:
     CompoundPoseFilter() 
         : m_position_filter(nullptr)
         , m_orientation_filter(nullptr)
+        , m_orientation_filter_uses_optical(false)
+        , m_position_filter_uses_imu(false)
+        , m_orientation_skipped_time_delta(0.f)
+        , m_position_skipped_time_delta(0.f)
+        , m_time(0.0)
     {}
     virtual ~CompoundPoseFilter()
     { dispose_filters(); }
@@ -66,6 +72,13 @@ public:
     Eigen::Vector3f getPositionCm(float time = 0.f) const override;
     Eigen::Vector3f getVelocityCmPerSec() const override;
     Eigen::Vector3f getAccelerationCmPerSecSqr() const override;
+    OrientationFilterBatchKernel getBatchKernel() const override;
+    int beginBatchUpdate(const float delta_time, const PoseFilterPacket &packet, OrientationFilterBatchLanes &lanes) override;
+    void endBatchUpdate(
+        const float delta_time,
+        const PoseFilterPacket &packet,
+        const OrientationFilterBatchLanes &lanes,
+        const int lane) override;
 
 protected:
 	void allocate_filters(
@@ -75,8 +88,22 @@ protected:
 		const PoseFilterConstants &constant);
     void dispose_filters();
 
+    // Whether the orientation filter takes the packet, along with the time delta it takes it with
+    bool take_orientation_filter_time_delta(const float delta_time, const PoseFilterPacket &packet, float &out_time_delta);
+    // Everything update() does after the orientation filter update
+    void update_position_filter(const float delta_time, const PoseFilterPacket &packet);
+
     IPositionFilter *m_position_filter;
     IOrientationFilter *m_orientation_filter;
+
+    // Which packet kinds each sub-filter consumes.
+    // Orientation filters always take IMU packets and position filters always take optical packets,
+    // everything else would only advance their clocks, so it gets folded into the next packet they do take.
+    bool m_orientation_filter_uses_optical;
+    bool m_position_filter_uses_imu;
+    float m_orientation_skipped_time_delta;
+    float m_position_skipped_time_delta;
+
     double m_time;
 };
 
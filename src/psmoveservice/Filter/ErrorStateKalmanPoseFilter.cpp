@@ -0,0 +1,637 @@
+//-- includes --
+#include "ErrorStateKalmanPoseFilter.h"
+#include "CircularBuffer.h"
+#include "MathAlignment.h"
+
+//-- constants --
+// Number of applied packets a late optical measurement can be rewound across (same as the SR-UKF pose filter)
+#define ERROR_STATE_FILTER_HISTORY_CAPACITY 64
+
+// Smallest measurement variance we let through, keeps the innovation covariance invertible
+#define ERROR_STATE_R_MIN 1.0e-06f
+
+enum ErrorStateEnum
+{
+    ERROR_STATE_POSITION = 0, // meters
+    ERROR_STATE_LINEAR_VELOCITY = 3, // meters / s
+    ERROR_STATE_ORIENTATION = 6, // rotation vector in controller space, radians
+    ERROR_STATE_GYRO_BIAS = 9, // rad / s
+
+    ERROR_STATE_PARAMETER_COUNT = 12
+};
+
+// The constant velocity model doesn't know how the controller gets swung around,
+// this is the variance of the linear acceleration we allow it per second ((m/s^2)^2 * s)
+static const float k_linear_acceleration_variance = 25.f;
+
+// How far the gyro bias is allowed to wander per second ((rad/s)^2 / s)
+static const float k_gyro_bias_variance = 1.0e-7f;
+
+// Uncertainty of the error state before any measurement came in
+static const float k_initial_position_variance = 1.f; // m^2
+static const float k_initial_linear_velocity_variance = 1.f; // (m/s)^2
+static const float k_initial_orientation_variance = 1.f; // rad^2
+static const float k_initial_gyro_bias_variance = 1.0e-4f; // (rad/s)^2
+
+//-- private definitions --
+typedef Eigen::Matrix<float, ERROR_STATE_PARAMETER_COUNT, 1> ErrorStateVector;
+typedef Eigen::Matrix<float, ERROR_STATE_PARAMETER_COUNT, ERROR_STATE_PARAMETER_COUNT> ErrorStateCovariance;
+typedef Eigen::Matrix<float, ERROR_STATE_PARAMETER_COUNT, 3> ErrorStateGain;
+
+//-- private methods --
+static Eigen::Matrix3f skew_symmetric_matrix(const Eigen::Vector3f &v);
+static bool compute_orientation_from_gravity_and_magnetometer(
+    const Eigen::Vector3f &identity_gravity_direction, const Eigen::Vector3f &identity_magnetometer_direction,
+    const Eigen::Vector3f &local_gravity_direction, const Eigen::Vector3f &local_magnetometer_direction,
+    Eigen::Quaternionf &out_orientation);
+
+class ErrorStateKalmanPoseFilterImpl
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    /// Everything the filter carries from one packet to the next
+    struct State
+    {
+        /// Is the current fusion state valid
+        bool bIsValid;
+
+        /// True if we have seen a valid position measurement (>0 position quality)
+        bool bSeenPositionMeasurement;
+
+        /// True if we have seen an absolute orientation measurement
+        bool bSeenOrientationMeasurement;
+
+        /// The duration the filter has been running
+        double time;
+
+        // Nominal state
+        Eigen::Vector3f position_meters;
+        Eigen::Vector3f linear_velocity_m_per_sec;
+        Eigen::Quaternionf orientation; // controller space -> world space
+        Eigen::Vector3f gyro_bias_rad_per_sec;
+
+        /// Bias corrected gyro reading from the last IMU packet (controller space)
+        Eigen::Vector3f angular_velocity_rad_per_sec;
+
+        /// Covariance of the error state (see ErrorStateEnum)
+        ErrorStateCovariance covariance;
+    };
+    State state;
+
+    /// A packet that was applied to the filter along with the filter state from just before.
+    /// Lets a late optical measurement rewind to its capture time and replay what came after.
+    struct HistoryEntry
+    {
+        PoseFilterPacket packet;
+        float delta_time;
+        State state;
+    };
+    CircularBuffer<HistoryEntry, ERROR_STATE_FILTER_HISTORY_CAPACITY> history;
+
+    /// Scratch space for the packets replayed after a late optical measurement
+    PoseFilterPacket replay_packets[ERROR_STATE_FILTER_HISTORY_CAPACITY];
+    float replay_delta_times[ERROR_STATE_FILTER_HISTORY_CAPACITY];
+
+    void init(const PoseFilterConstants &constants)
+    {
+        state.bIsValid = false;
+        state.bSeenPositionMeasurement = false;
+        state.bSeenOrientationMeasurement = false;
+        state.time = 0.0;
+
+        state.position_meters = Eigen::Vector3f::Zero();
+        state.linear_velocity_m_per_sec = Eigen::Vector3f::Zero();
+        state.orientation = Eigen::Quaternionf::Identity();
+        state.gyro_bias_rad_per_sec = constants.orientation_constants.gyro_drift;
+        state.angular_velocity_rad_per_sec = Eigen::Vector3f::Zero();
+
+        state.covariance = ErrorStateCovariance::Zero();
+        state.covariance.diagonal().segment<3>(ERROR_STATE_POSITION).setConstant(k_initial_position_variance);
+        state.covariance.diagonal().segment<3>(ERROR_STATE_LINEAR_VELOCITY).setConstant(k_initial_linear_velocity_variance);
+        state.covariance.diagonal().segment<3>(ERROR_STATE_ORIENTATION).setConstant(k_initial_orientation_variance);
+        state.covariance.diagonal().segment<3>(ERROR_STATE_GYRO_BIAS).setConstant(k_initial_gyro_bias_variance);
+
+        history.clear();
+    }
+
+    void init(
+        const PoseFilterConstants &constants,
+        const Eigen::Vector3f &initial_position_cm,
+        const Eigen::Quaternionf &initial_orientation)
+    {
+        init(constants);
+
+        state.bIsValid = true;
+        state.bSeenPositionMeasurement = true;
+        state.bSeenOrientationMeasurement = true;
+        state.position_meters = initial_position_cm * k_centimeters_to_meters;
+        state.orientation = initial_orientation.normalized();
+    }
+
+    // -- Prediction --
+    /// Integrates the gyroscope into the nominal orientation and the velocity into the nominal position,
+    /// then propagates the error covariance across the step
+    void predict(const PoseFilterConstants &constants, const float delta_time, const PoseFilterPacket &packet)
+    {
+        // Packets without an IMU reading (optical only) keep turning at the last known rate
+        if (packet.has_gyroscope_measurement)
+        {
+            state.angular_velocity_rad_per_sec = packet.imu_gyroscope_rad_per_sec - state.gyro_bias_rad_per_sec;
+        }
+
+        const float dT = fmaxf(delta_time, 0.f);
+        const Eigen::Quaternionf q_step = eigen_angle_axis_to_quaternion(state.angular_velocity_rad_per_sec * dT);
+
+        state.orientation = (state.orientation * q_step).normalized();
+        state.position_meters += state.linear_velocity_m_per_sec * dT;
+
+        // Error state transition:
+        //  d_pos' = d_pos + d_vel*dT
+        //  d_theta' = R(omega*dT)^T * d_theta - d_bias*dT
+        ErrorStateCovariance F = ErrorStateCovariance::Identity();
+        F.block<3, 3>(ERROR_STATE_POSITION, ERROR_STATE_LINEAR_VELOCITY) = Eigen::Matrix3f::Identity() * dT;
+        F.block<3, 3>(ERROR_STATE_ORIENTATION, ERROR_STATE_ORIENTATION) = q_step.toRotationMatrix().transpose();
+        F.block<3, 3>(ERROR_STATE_ORIENTATION, ERROR_STATE_GYRO_BIAS) = -Eigen::Matrix3f::Identity() * dT;
+
+        // Process noise: white noise linear acceleration, gyro noise and a gyro bias random walk
+        const float dT_2 = dT*dT;
+        const float dT_3 = dT_2*dT;
+        ErrorStateCovariance Q = ErrorStateCovariance::Zero();
+        Q.block<3, 3>(ERROR_STATE_POSITION, ERROR_STATE_POSITION) =
+            Eigen::Matrix3f::Identity() * (k_linear_acceleration_variance * dT_3 / 3.f);
+        Q.block<3, 3>(ERROR_STATE_POSITION, ERROR_STATE_LINEAR_VELOCITY) =
+            Eigen::Matrix3f::Identity() * (k_linear_acceleration_variance * dT_2 * 0.5f);
+        Q.block<3, 3>(ERROR_STATE_LINEAR_VELOCITY, ERROR_STATE_POSITION) =
+            Q.block<3, 3>(ERROR_STATE_POSITION, ERROR_STATE_LINEAR_VELOCITY);
+        Q.block<3, 3>(ERROR_STATE_LINEAR_VELOCITY, ERROR_STATE_LINEAR_VELOCITY) =
+            Eigen::Matrix3f::Identity() * (k_linear_acceleration_variance * dT);
+        Q.diagonal().segment<3>(ERROR_STATE_ORIENTATION) = constants.orientation_constants.gyro_variance * dT_2;
+        Q.diagonal().segment<3>(ERROR_STATE_GYRO_BIAS).setConstant(k_gyro_bias_variance * dT);
+
+        state.covariance = F * state.covariance * F.transpose() + Q;
+    }
+
+    // -- Measurements --
+    void fuse_optical_position(const PoseFilterConstants &constants, const PoseFilterPacket &packet)
+    {
+        const float position_variance_cm_sqr =
+            packet.get_optical_position_variance_cm_sqr(constants.position_constants.position_variance_curve);
+        const float position_variance_m_sqr =
+            fmaxf(k_centimeters_to_meters*k_centimeters_to_meters*position_variance_cm_sqr, ERROR_STATE_R_MIN);
+
+        fuse_measurement(
+            packet.get_optical_position_in_meters() - state.position_meters,
+            ERROR_STATE_POSITION,
+            Eigen::Matrix3f::Identity(),
+            Eigen::Matrix3f::Identity() * position_variance_m_sqr);
+    }
+
+    void fuse_optical_orientation(const PoseFilterConstants &constants, const PoseFilterPacket &packet)
+    {
+        // Rotation from the filter orientation to the measured one, in controller space
+        Eigen::Quaternionf error_quaternion = state.orientation.conjugate() * packet.optical_orientation.normalized();
+        if (error_quaternion.w() < 0.f)
+        {
+            error_quaternion.coeffs() = -error_quaternion.coeffs();
+        }
+
+        // The variance curve is fit to the quaternion components, the rotation vector is about twice their size
+        const float orientation_variance =
+            constants.orientation_constants.orientation_variance_curve.evaluate(packet.tracking_projection_area_px_sqr);
+        const float rotation_variance = fmaxf(4.f*orientation_variance, ERROR_STATE_R_MIN);
+
+        fuse_measurement(
+            2.f*error_quaternion.vec(),
+            ERROR_STATE_ORIENTATION,
+            Eigen::Matrix3f::Identity(),
+            Eigen::Matrix3f::Identity() * rotation_variance);
+    }
+
+    void fuse_accelerometer(const PoseFilterConstants &constants, const PoseFilterPacket &packet)
+    {
+        const Eigen::Vector3f &accelerometer = packet.imu_accelerometer_g_units;
+        const Eigen::Vector3f predicted_gravity =
+            eigen_vector3f_clockwise_rotate(state.orientation, constants.orientation_constants.gravity_calibration_direction);
+
+        // The accelerometer only measures gravity while the controller isn't accelerating.
+        // Trust it less the further the reading is from 1g.
+        const float linear_accel_g_units = accelerometer.norm() - 1.f;
+        Eigen::Matrix3f R = Eigen::Matrix3f::Identity() * (linear_accel_g_units*linear_accel_g_units);
+        R.diagonal() += constants.orientation_constants.accelerometer_variance.cwiseMax(ERROR_STATE_R_MIN);
+
+        fuse_measurement(
+            accelerometer - predicted_gravity,
+            ERROR_STATE_ORIENTATION,
+            skew_symmetric_matrix(predicted_gravity),
+            R);
+    }
+
+    void fuse_magnetometer(const PoseFilterConstants &constants, const PoseFilterPacket &packet)
+    {
+        const Eigen::Vector3f predicted_magnetometer =
+            eigen_vector3f_clockwise_rotate(state.orientation, constants.orientation_constants.magnetometer_calibration_direction);
+        const Eigen::Matrix3f R =
+            constants.orientation_constants.magnetometer_variance.cwiseMax(ERROR_STATE_R_MIN).asDiagonal();
+
+        fuse_measurement(
+            packet.imu_magnetometer_unit - predicted_magnetometer,
+            ERROR_STATE_ORIENTATION,
+            skew_symmetric_matrix(predicted_magnetometer),
+            R);
+    }
+
+    // -- Absolute orientation --
+    /// Snaps the orientation to the one the gravity and magnetic field readings line up with
+    bool snap_orientation_to_gravity_and_magnetometer(const PoseFilterConstants &constants, const PoseFilterPacket &packet)
+    {
+        return compute_orientation_from_gravity_and_magnetometer(
+            constants.orientation_constants.gravity_calibration_direction,
+            constants.orientation_constants.magnetometer_calibration_direction,
+            packet.imu_accelerometer_g_units,
+            packet.imu_magnetometer_unit,
+            state.orientation);
+    }
+
+    // -- History --
+    void push_history_entry(const float delta_time, const PoseFilterPacket &packet)
+    {
+        HistoryEntry entry;
+        entry.packet = packet;
+        entry.delta_time = delta_time;
+        entry.state = state;
+
+        history.push_back(entry);
+    }
+
+    void restore_history_entry(const HistoryEntry &entry)
+    {
+        state = entry.state;
+    }
+
+private:
+    /// EKF update for a 3D measurement that only depends on one 3 element block of the error state,
+    /// followed by folding the error back into the nominal state
+    void fuse_measurement(
+        const Eigen::Vector3f &residual,
+        const int error_index,
+        const Eigen::Matrix3f &H,
+        const Eigen::Matrix3f &R)
+    {
+        // P*H^T, and H*P*H^T + R, only touch the columns (and rows) of the measured block
+        const ErrorStateGain PHt = state.covariance.middleCols<3>(error_index) * H.transpose();
+        const Eigen::Matrix3f S = H * PHt.middleRows<3>(error_index) + R;
+        const ErrorStateGain K = PHt * S.inverse();
+        const ErrorStateVector error = K * residual;
+
+        // P = (I - K*H)*P, kept symmetric against float round off
+        state.covariance -= K * PHt.transpose();
+        state.covariance = 0.5f*(state.covariance + state.covariance.transpose());
+
+        // Inject the error into the nominal state. The error state is zero again afterwards.
+        state.position_meters += error.segment<3>(ERROR_STATE_POSITION);
+        state.linear_velocity_m_per_sec += error.segment<3>(ERROR_STATE_LINEAR_VELOCITY);
+        state.orientation =
+            (state.orientation * eigen_angle_axis_to_quaternion(error.segment<3>(ERROR_STATE_ORIENTATION))).normalized();
+        state.gyro_bias_rad_per_sec += error.segment<3>(ERROR_STATE_GYRO_BIAS);
+    }
+};
+
+//-- public interface --
+//-- ErrorStateKalmanPoseFilter --
+ErrorStateKalmanPoseFilter::ErrorStateKalmanPoseFilter()
+    : m_filter(new ErrorStateKalmanPoseFilterImpl())
+{
+    memset(&m_constants, 0, sizeof(PoseFilterConstants));
+    m_filter->init(m_constants);
+}
+
+ErrorStateKalmanPoseFilter::~ErrorStateKalmanPoseFilter()
+{
+    delete m_filter;
+}
+
+bool ErrorStateKalmanPoseFilter::init(const PoseFilterConstants &constants)
+{
+    m_constants = constants;
+    m_filter->init(constants);
+
+    return true;
+}
+
+bool ErrorStateKalmanPoseFilter::init(
+    const PoseFilterConstants &constants,
+    const Eigen::Vector3f &initial_position,
+    const Eigen::Quaternionf &initial_orientation)
+{
+    m_constants = constants;
+    m_filter->init(constants, initial_position, initial_orientation);
+
+    return true;
+}
+
+bool ErrorStateKalmanPoseFilter::getIsStateValid() const
+{
+    return m_filter->state.bIsValid;
+}
+
+bool ErrorStateKalmanPoseFilter::getIsPositionStateValid() const
+{
+    return getIsStateValid();
+}
+
+bool ErrorStateKalmanPoseFilter::getIsOrientationStateValid() const
+{
+    return getIsStateValid();
+}
+
+double ErrorStateKalmanPoseFilter::getTimeInSeconds() const
+{
+    return m_filter->state.time;
+}
+
+void ErrorStateKalmanPoseFilter::resetState()
+{
+    m_filter->init(m_constants);
+}
+
+void ErrorStateKalmanPoseFilter::recenterOrientation(const Eigen::Quaternionf& q_pose)
+{
+    m_filter->state.orientation = q_pose;
+
+    // The recorded states are relative to the old orientation
+    m_filter->history.clear();
+}
+
+Eigen::Quaternionf ErrorStateKalmanPoseFilter::getOrientation(float time) const
+{
+    Eigen::Quaternionf result = Eigen::Quaternionf::Identity();
+
+    if (m_filter->state.bIsValid)
+    {
+        result = m_filter->state.orientation;
+
+        if (fabsf(time) > k_real_epsilon)
+        {
+            const Eigen::Quaternionf q_step =
+                eigen_angle_axis_to_quaternion(m_filter->state.angular_velocity_rad_per_sec * time);
+
+            result = (result * q_step).normalized();
+        }
+    }
+
+    return result;
+}
+
+Eigen::Vector3f ErrorStateKalmanPoseFilter::getAngularVelocityRadPerSec() const
+{
+    return m_filter->state.orientation._transformVector(m_filter->state.angular_velocity_rad_per_sec);
+}
+
+Eigen::Vector3f ErrorStateKalmanPoseFilter::getAngularAccelerationRadPerSecSqr() const
+{
+    return Eigen::Vector3f::Zero();
+}
+
+Eigen::Vector3f ErrorStateKalmanPoseFilter::getPositionCm(float time) const
+{
+    Eigen::Vector3f result = Eigen::Vector3f::Zero();
+
+    if (m_filter->state.bIsValid)
+    {
+        const Eigen::Vector3f &state_position_meters = m_filter->state.position_meters;
+        const Eigen::Vector3f &state_velocity_m_per_sec = m_filter->state.linear_velocity_m_per_sec;
+        const Eigen::Vector3f predicted_position =
+            is_nearly_zero(time)
+            ? state_position_meters
+            : state_position_meters + state_velocity_m_per_sec * time;
+
+        result = predicted_position * k_meters_to_centimeters;
+    }
+
+    return result;
+}
+
+Eigen::Vector3f ErrorStateKalmanPoseFilter::getVelocityCmPerSec() const
+{
+    return m_filter->state.linear_velocity_m_per_sec * k_meters_to_centimeters;
+}
+
+Eigen::Vector3f ErrorStateKalmanPoseFilter::getAccelerationCmPerSecSqr() const
+{
+    // Constant velocity model
+    return Eigen::Vector3f::Zero();
+}
+
+void ErrorStateKalmanPoseFilter::update(const float delta_time, const PoseFilterPacket &packet)
+{
+    const std::chrono::time_point<std::chrono::high_resolution_clock> k_no_timestamp;
+    const int history_size = m_filter->history.size();
+
+    // Count the already applied packets that were captured after this one.
+    // Only optical measurements show up late (they wait on the camera and the blob search),
+    // IMU packets always arrive in capture order.
+    int newer_count = 0;
+    if (packet.timestamp != k_no_timestamp &&
+        packet.has_optical_measurement() && !packet.has_imu_measurements())
+    {
+        while (newer_count < history_size &&
+               m_filter->history.getFromNewest(newer_count)->packet.timestamp > packet.timestamp)
+        {
+            ++newer_count;
+        }
+    }
+
+    if (newer_count == 0)
+    {
+        // In order
+        m_filter->push_history_entry(delta_time, packet);
+        updateFilter(delta_time, packet);
+    }
+    else if (newer_count >= history_size)
+    {
+        // Older than anything we can rewind to, fuse it as if it were current.
+        // Stamp the history copy with the newest time so the history stays sorted.
+        PoseFilterPacket clamped_packet = packet;
+        clamped_packet.timestamp = m_filter->history.getFromNewest(0)->packet.timestamp;
+
+        m_filter->push_history_entry(delta_time, clamped_packet);
+        updateFilter(delta_time, packet);
+    }
+    else
+    {
+        // Stash the packets we have to replay (oldest first) and drop them from the history
+        for (int replay_index = 0; replay_index < newer_count; ++replay_index)
+        {
+            const ErrorStateKalmanPoseFilterImpl::HistoryEntry *entry =
+                m_filter->history.getFromNewest(newer_count - replay_index - 1);
+
+            m_filter->replay_packets[replay_index] = entry->packet;
+            m_filter->replay_delta_times[replay_index] = entry->delta_time;
+        }
+
+        // Rewind to the state from just before the oldest packet captured after this one
+        m_filter->restore_history_entry(*m_filter->history.getFromNewest(newer_count - 1));
+        for (int pop_index = 0; pop_index < newer_count; ++pop_index)
+        {
+            m_filter->history.pop_back();
+        }
+
+        // Split the time step of that packet around the capture time of the late one
+        const std::chrono::duration<float> capture_gap =
+            m_filter->replay_packets[0].timestamp - packet.timestamp;
+        const float late_delta_time = fmaxf(m_filter->replay_delta_times[0] - capture_gap.count(), 0.f);
+        m_filter->replay_delta_times[0] = fminf(capture_gap.count(), m_filter->replay_delta_times[0]);
+
+        // Apply the late measurement at its capture time, then re-propagate everything after it
+        m_filter->push_history_entry(late_delta_time, packet);
+        updateFilter(late_delta_time, packet);
+
+        for (int replay_index = 0; replay_index < newer_count; ++replay_index)
+        {
+            const PoseFilterPacket &replay_packet = m_filter->replay_packets[replay_index];
+            const float replay_delta_time = m_filter->replay_delta_times[replay_index];
+
+            m_filter->push_history_entry(replay_delta_time, replay_packet);
+            updateFilter(replay_delta_time, replay_packet);
+        }
+    }
+}
+
+//-- ErrorStateKalmanPoseFilterPSMove --
+void ErrorStateKalmanPoseFilterPSMove::updateFilter(const float delta_time, const PoseFilterPacket &packet)
+{
+    ErrorStateKalmanPoseFilterImpl::State &state = m_filter->state;
+
+    // If this is the first time we have seen the position, snap the position state
+    if (packet.has_optical_measurement() && !state.bSeenPositionMeasurement)
+    {
+        state.position_meters = packet.get_optical_position_in_meters();
+        state.bSeenPositionMeasurement = true;
+    }
+
+    // The PSMove has no optical orientation, start from the orientation gravity and the magnetic field agree on
+    if (packet.has_accelerometer_measurement && packet.has_magnetometer_measurement &&
+        !state.bSeenOrientationMeasurement)
+    {
+        state.bSeenOrientationMeasurement =
+            m_filter->snap_orientation_to_gravity_and_magnetometer(m_constants, packet);
+    }
+
+    m_filter->predict(m_constants, delta_time, packet);
+
+    if (packet.has_optical_measurement())
+    {
+        m_filter->fuse_optical_position(m_constants, packet);
+    }
+
+    if (packet.has_accelerometer_measurement)
+    {
+        m_filter->fuse_accelerometer(m_constants, packet);
+    }
+
+    if (packet.has_magnetometer_measurement)
+    {
+        m_filter->fuse_magnetometer(m_constants, packet);
+    }
+
+    state.time += (double)delta_time;
+    state.bIsValid = true;
+}
+
+//-- ErrorStateKalmanPoseFilterDS4 --
+void ErrorStateKalmanPoseFilterDS4::updateFilter(const float delta_time, const PoseFilterPacket &packet)
+{
+    ErrorStateKalmanPoseFilterImpl::State &state = m_filter->state;
+
+    // Snap filter state if we haven't seen an optical measurement before
+    if (packet.has_optical_measurement())
+    {
+        if (!state.bSeenPositionMeasurement)
+        {
+            state.position_meters = packet.get_optical_position_in_meters();
+            state.bSeenPositionMeasurement = true;
+        }
+
+        if (!state.bSeenOrientationMeasurement)
+        {
+            state.orientation = packet.optical_orientation.normalized();
+            state.bSeenOrientationMeasurement = true;
+        }
+    }
+
+    m_filter->predict(m_constants, delta_time, packet);
+
+    if (packet.has_optical_measurement())
+    {
+        m_filter->fuse_optical_position(m_constants, packet);
+        m_filter->fuse_optical_orientation(m_constants, packet);
+    }
+
+    if (packet.has_accelerometer_measurement)
+    {
+        m_filter->fuse_accelerometer(m_constants, packet);
+    }
+
+    state.time += (double)delta_time;
+    state.bIsValid = true;
+}
+
+//-- private methods --
+static Eigen::Matrix3f
+skew_symmetric_matrix(const Eigen::Vector3f &v)
+{
+    Eigen::Matrix3f m;
+
+    m <<
+        0.f, -v.z(), v.y(),
+        v.z(), 0.f, -v.x(),
+        -v.y(), v.x(), 0.f;
+
+    return m;
+}
+
+// Builds an orthonormal frame out of the gravity direction and the part of the magnetic field orthogonal to it
+static bool
+compute_gravity_magnetometer_frame(
+    const Eigen::Vector3f &gravity_direction,
+    const Eigen::Vector3f &magnetometer_direction,
+    Eigen::Matrix3f &out_frame)
+{
+    bool bSuccess = false;
+    Eigen::Vector3f up = gravity_direction;
+    Eigen::Vector3f side = gravity_direction.cross(magnetometer_direction);
+
+    if (eigen_vector3f_normalize_with_default(up, Eigen::Vector3f::Zero()) > k_normal_epsilon &&
+        eigen_vector3f_normalize_with_default(side, Eigen::Vector3f::Zero()) > k_normal_epsilon)
+    {
+        out_frame.col(0) = up;
+        out_frame.col(1) = side;
+        out_frame.col(2) = up.cross(side);
+        bSuccess = true;
+    }
+
+    return bSuccess;
+}
+
+// The controller to world rotation that maps the measured gravity and magnetic field directions
+// onto their directions in the identity pose
+static bool
+compute_orientation_from_gravity_and_magnetometer(
+    const Eigen::Vector3f &identity_gravity_direction, const Eigen::Vector3f &identity_magnetometer_direction,
+    const Eigen::Vector3f &local_gravity_direction, const Eigen::Vector3f &local_magnetometer_direction,
+    Eigen::Quaternionf &out_orientation)
+{
+    Eigen::Matrix3f world_frame;
+    Eigen::Matrix3f local_frame;
+    bool bSuccess = false;
+
+    if (compute_gravity_magnetometer_frame(identity_gravity_direction, identity_magnetometer_direction, world_frame) &&
+        compute_gravity_magnetometer_frame(local_gravity_direction, local_magnetometer_direction, local_frame))
+    {
+        out_orientation = Eigen::Quaternionf(Eigen::Matrix3f(world_frame * local_frame.transpose())).normalized();
+        bSuccess = true;
+    }
+
+    return bSuccess;
+}
@@ -0,0 +1,84 @@
+#ifndef ERROR_STATE_KALMAN_POSE_FILTER_H
+#define ERROR_STATE_KALMAN_POSE_FILTER_H
+
+#include "PoseFilterInterface.h"
+
+class ErrorStateKalmanPoseFilterImpl;
+
+/// Base multiplicative error-state Kalman pose filter
+/**
+ A cheaper alternative to the SR-UKF in KalmanPoseFilterT.
+ The filter carries a nominal pose (position, velocity, orientation quaternion, gyro bias)
+ and a 12 element error state (position, velocity, local rotation vector, gyro bias) with its covariance.
+ The gyroscope drives the nominal orientation forward, every measurement is a linearized EKF update
+ of the error state that gets folded back into the nominal state right away.
+ Everything is stored in fixed size float matrices, so an update is a handful of 12x12 and 12x3 products
+ with no sigma points and no Cholesky updates.
+ */
+class ErrorStateKalmanPoseFilter : public IPoseFilter
+{
+public:
+	ErrorStateKalmanPoseFilter();
+	virtual ~ErrorStateKalmanPoseFilter();
+
+	virtual bool init(const PoseFilterConstants &constant);
+	virtual bool init(const PoseFilterConstants &constant,
+		const Eigen::Vector3f &initial_position,
+		const Eigen::Quaternionf &initial_orientation);
+
+	// -- IStateFilter --
+	bool getIsStateValid() const override;
+	/// Applies the packet, rewinding and re-propagating the filter first if it is a late optical packet
+	void update(const float delta_time, const PoseFilterPacket &packet) override;
+	double getTimeInSeconds() const override;
+	void resetState() override;
+	void recenterOrientation(const Eigen::Quaternionf& q_pose) override;
+
+	// -- IPoseFilter ---
+	/// Not true until the filter has updated at least once
+	bool getIsPositionStateValid() const override;
+
+	/// Not true until the filter has updated at least once
+	bool getIsOrientationStateValid() const override;
+
+	/// Estimate the current orientation of the filter given a time offset into the future
+	Eigen::Quaternionf getOrientation(float time = 0.f) const override;
+
+	/// Get the current world space angular velocity of the filter state (rad/s)
+	Eigen::Vector3f getAngularVelocityRadPerSec() const override;
+
+	/// Get the current world space angular acceleration of the filter state (rad/s^2)
+	Eigen::Vector3f getAngularAccelerationRadPerSecSqr() const override;
+
+	/// Estimate the current position of the filter state given a time offset into the future (centimeters)
+	Eigen::Vector3f getPositionCm(float time = 0.f) const override;
+
+	/// Get the current velocity of the filter state (cm/s)
+	Eigen::Vector3f getVelocityCmPerSec() const override;
+
+	/// Get the current velocity of the filter state (cm/s^2)
+	Eigen::Vector3f getAccelerationCmPerSecSqr() const override;
+
+protected:
+	/// Steps the filter state with one packet, in capture order
+	virtual void updateFilter(const float delta_time, const PoseFilterPacket &packet) = 0;
+
+	PoseFilterConstants m_constants;
+	ErrorStateKalmanPoseFilterImpl *m_filter;
+};
+
+/// Error-state Kalman pose filter for Optical Position + Magnetometer + Angular Rate(Gyroscope) + Gravity(Accelerometer)
+class ErrorStateKalmanPoseFilterPSMove : public ErrorStateKalmanPoseFilter
+{
+protected:
+	void updateFilter(const float delta_time, const PoseFilterPacket &packet) override;
+};
+
+/// Error-state Kalman pose filter for Optical Pose + Angular Rate(Gyroscope) + Gravity(Accelerometer)
+class ErrorStateKalmanPoseFilterDS4 : public ErrorStateKalmanPoseFilter
+{
+protected:
+	void updateFilter(const float delta_time, const PoseFilterPacket &packet) override;
+};
+
+#endif // ERROR_STATE_KALMAN_POSE_FILTER_H
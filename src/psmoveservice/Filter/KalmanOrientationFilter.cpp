@@ -7,6 +7,8 @@
 #include <kalman/SquareRootBase.hpp>
 #include <kalman/SquareRootUnscentedKalmanFilter.hpp>
 
+#include <algorithm>
+
 // The kalman filter runs way to slow in a fully unoptimized build.
 // But if we just unoptimize this file in a release build it seems to run ok.
 #if defined(_MSC_VER) && defined(UNOPTIMIZE_KALMAN_FILTERS)
@@ -72,6 +74,17 @@ enum OpticalMeasurementEnum
 #define k_ukf_kappa -1.0 // 3 - STATE_PARAMETER_COUNT
 #define k_ukf_alpha 0.01
 
+// Online gyro bias estimation.
+// While the controller sits still the residual gyro rate is pure bias, so the bias estimate
+// slowly tracks it. This follows the temperature drift away from the calibrated gyro drift.
+#define k_stationary_gyro_rate_limit 0.05 // rad/s, residual rate above which the controller is moving
+#define k_stationary_accelerometer_tolerance 0.05 // g-units, allowed jitter around the low passed accelerometer
+#define k_stationary_gravity_tolerance 0.1 // g-units, allowed deviation of the accelerometer from 1g
+#define k_stationary_settle_time 0.5 // seconds the controller has to be still before the bias estimate moves
+#define k_accelerometer_lowpass_time_constant 0.1 // seconds
+#define k_gyro_bias_time_constant 5.0 // seconds
+#define k_max_gyro_bias_correction 0.1 // rad/s, furthest the estimate can wander from the calibrated drift
+
 //-- private definitions --
 template<typename T>
 class OrientationStateVector : public Kalman::Vector<T, STATE_PARAMETER_COUNT>
@@ -141,6 +154,8 @@ public:
 		update_process_noise(constants, 0.f);
 	}
 
+	inline void set_gyro_bias(const Eigen::Vector3d &gyro_bias) { m_gyro_bias = gyro_bias; }
+
 	void update_process_noise(const OrientationFilterConstants &constants, float tracking_projection_area)
 	{
 		// Only update the covariance when there is more than a 10px change in position quality
@@ -496,6 +511,70 @@ public:
 	Eigen::Quaterniond m_last_world_orientation;
 };
 
+/// Incremental estimate of the gyro bias, only moves while the controller is stationary
+class GyroBiasEstimator
+{
+public:
+	Eigen::Vector3d gyro_bias; // rad/s
+
+	void init(const OrientationFilterConstants &constants)
+	{
+		m_calibrated_gyro_bias = constants.gyro_drift.cast<double>();
+		m_lowpass_accelerometer = Eigen::Vector3d::Zero();
+		m_stationary_time = 0.0;
+		m_bHasLowpassAccelerometer = false;
+		gyro_bias = m_calibrated_gyro_bias;
+	}
+
+	void update(const double delta_time, const PoseFilterPacket &packet)
+	{
+		if (!packet.has_gyroscope_measurement || !packet.has_accelerometer_measurement || delta_time <= 0.0)
+		{
+			return;
+		}
+
+		const Eigen::Vector3d gyroscope = packet.imu_gyroscope_rad_per_sec.cast<double>();
+		const Eigen::Vector3d accelerometer = packet.imu_accelerometer_g_units.cast<double>();
+
+		if (m_bHasLowpassAccelerometer)
+		{
+			const double alpha = std::min(delta_time / k_accelerometer_lowpass_time_constant, 1.0);
+
+			m_lowpass_accelerometer += (accelerometer - m_lowpass_accelerometer)*alpha;
+		}
+		else
+		{
+			m_lowpass_accelerometer = accelerometer;
+			m_bHasLowpassAccelerometer = true;
+		}
+
+		const bool bIsStationary =
+			(gyroscope - gyro_bias).cwiseAbs().maxCoeff() < k_stationary_gyro_rate_limit &&
+			(accelerometer - m_lowpass_accelerometer).norm() < k_stationary_accelerometer_tolerance &&
+			fabs(accelerometer.norm() - 1.0) < k_stationary_gravity_tolerance;
+
+		m_stationary_time = bIsStationary ? m_stationary_time + delta_time : 0.0;
+
+		if (m_stationary_time >= k_stationary_settle_time)
+		{
+			// Blend toward the current reading, but never far from the calibration
+			const double alpha = std::min(delta_time / k_gyro_bias_time_constant, 1.0);
+			const Eigen::Vector3d new_gyro_bias = gyro_bias + (gyroscope - gyro_bias)*alpha;
+			const Eigen::Vector3d correction = new_gyro_bias - m_calibrated_gyro_bias;
+
+			gyro_bias =
+				m_calibrated_gyro_bias +
+				correction.cwiseMax(-k_max_gyro_bias_correction).cwiseMin(k_max_gyro_bias_correction);
+		}
+	}
+
+private:
+	Eigen::Vector3d m_calibrated_gyro_bias;
+	Eigen::Vector3d m_lowpass_accelerometer;
+	double m_stationary_time;
+	bool m_bHasLowpassAccelerometer;
+};
+
 class KalmanOrientationFilterImpl
 {
 public:
@@ -508,6 +587,9 @@ public:
     /// Used to model how the physics of the controller evolves
     OrientationSystemModel system_model;
 
+	/// Tracks the gyro bias drift the system model subtracts from the gyro readings
+	GyroBiasEstimator gyro_bias_estimator;
+
     /// Unscented Kalman Filter instance
 	OrientationSRUKF ukf;
 
@@ -537,6 +619,7 @@ public:
 		world_orientation = Eigen::Quaterniond::Identity();
 
         system_model.init(constants);
+		gyro_bias_estimator.init(constants);
         ukf.init(OrientationStateVectord::Identity());
     }
 
@@ -550,10 +633,17 @@ public:
 		world_orientation = orientation.cast<double>();
 
 		system_model.init(constants);
+		gyro_bias_estimator.init(constants);
 		ukf.init(OrientationStateVectord::Identity());
 		apply_error_to_world_quaternion();
 	}
 
+	void update_gyro_bias(const float delta_time, const PoseFilterPacket &packet)
+	{
+		gyro_bias_estimator.update(static_cast<double>(delta_time), packet);
+		system_model.set_gyro_bias(gyro_bias_estimator.gyro_bias);
+	}
+
 	// -- World Quaternion Accessors --
 	inline Eigen::Quaterniond compute_net_world_quaternion() const
 	{
@@ -793,6 +883,9 @@ void KalmanOrientationFilterPSVR::update(const float delta_time, const PoseFilte
 		OpticalOrientationMeasurementModel &optical_measurement_model = filter->optical_measurement_model;
 		GravMeasurementModel &imu_measurement_model= filter->imu_measurement_model;
 
+		// Track the gyro bias while the controller is still
+		filter->update_gyro_bias(delta_time, packet);
+
         // Predict state for current time-step using the filters
 		filter->system_model.set_time_step(delta_time);
 
@@ -888,6 +981,9 @@ void KalmanOrientationFilterDS4::update(const float delta_time, const PoseFilter
 		OpticalOrientationMeasurementModel &optical_measurement_model = filter->optical_measurement_model;
 		GravMeasurementModel &imu_measurement_model= filter->imu_measurement_model;
 
+		// Track the gyro bias while the controller is still
+		filter->update_gyro_bias(delta_time, packet);
+
         // Predict state for current time-step using the filters
 		filter->system_model.set_time_step(delta_time);
 
@@ -983,6 +1079,9 @@ void KalmanOrientationFilterPSMove::update(const float delta_time, const PoseFil
 		OpticalOrientationMeasurementModel &optical_measurement_model = filter->optical_measurement_model;
 		MagGravMeasurementModel &imu_measurement_model= filter->imu_measurement_model;
 
+		// Track the gyro bias while the controller is still
+		filter->update_gyro_bias(delta_time, packet);
+
         // Predict state for current time-step using the filters
 		filter->system_model.set_time_step(delta_time);
 
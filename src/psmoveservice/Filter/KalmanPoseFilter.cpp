@@ -1,5 +1,6 @@
 //-- includes --
 #include "KalmanPoseFilter.h"
+#include "CircularBuffer.h"
 #include "MathAlignment.h"
 
 #include <kalman/MeasurementModel.hpp>
@@ -18,6 +19,10 @@
 //-- constants --
 #define MEASUREMENT_LED_COUNT   9
 
+// Number of applied packets a late optical measurement can be rewound across.
+// At 1kHz IMU rates that covers a bit more than one 60fps camera frame plus processing time.
+#define POSE_FILTER_HISTORY_CAPACITY 64
+
 enum PoseFilterStateEnum
 {
     // Position State
@@ -105,6 +110,54 @@ template <class StateType>
 void Q_discrete_3rd_order_white_noise(const double dT, const double var, const int state_index, Kalman::Covariance<StateType> &Q);
 
 //-- private definitions --
+template <typename T>
+using PoseVector3 = Eigen::Matrix<T, 3, 1>;
+
+// Per scalar type filter tuning.
+// With alpha=0.01 the sigma points sit very close to the mean and the mean weights
+// end up in the tens of thousands with mixed signs. That's fine in double precision
+// but cancels away most of a float mantissa, so the float filter spreads the
+// sigma points out further (alpha=1 keeps the weights around 1).
+template <typename T>
+struct KalmanPoseFilterPrecision;
+
+template <>
+struct KalmanPoseFilterPrecision<double>
+{
+    static double ukf_alpha() { return k_ukf_alpha; }
+};
+
+template <>
+struct KalmanPoseFilterPrecision<float>
+{
+    static float ukf_alpha() { return 1.f; }
+};
+
+// Overloads so the templated models can pick the float or double math helpers
+static inline Eigen::Vector3f
+pose_vector3_clockwise_rotate(const Eigen::Quaternionf &q, const Eigen::Vector3f &v)
+{
+    return eigen_vector3f_clockwise_rotate(q, v);
+}
+
+static inline Eigen::Vector3d
+pose_vector3_clockwise_rotate(const Eigen::Quaterniond &q, const Eigen::Vector3d &v)
+{
+    return eigen_vector3d_clockwise_rotate(q, v);
+}
+
+static inline Eigen::Quaternionf
+pose_angular_velocity_to_quaternion_derivative(const Eigen::Quaternionf &q, const Eigen::Vector3f &ang_vel)
+{
+    return eigen_angular_velocity_to_quaternion_derivative(q, ang_vel);
+}
+
+static inline Eigen::Quaterniond
+pose_angular_velocity_to_quaternion_derivative(const Eigen::Quaterniond &q, const Eigen::Vector3d &ang_vel)
+{
+    return eigen_angular_velocity_to_quaterniond_derivative(q, ang_vel);
+}
+
 template<typename T>
 class PoseStateVector : public Kalman::Vector<T, POSE_STATE_PARAMETER_COUNT>
 {
@@ -121,37 +174,36 @@ public:
     }
 
     // Accessors
-    Eigen::Vector3d get_position_meters() const { 
-        return Eigen::Vector3d((*this)[POSE_POSITION_X], (*this)[POSE_POSITION_Y], (*this)[POSE_POSITION_Z]); 
+    PoseVector3<T> get_position_meters() const { 
+        return PoseVector3<T>((*this)[POSE_POSITION_X], (*this)[POSE_POSITION_Y], (*this)[POSE_POSITION_Z]); 
     }
-    Eigen::Vector3d get_linear_velocity_m_per_sec() const {
-        return Eigen::Vector3d((*this)[POSE_LINEAR_VELOCITY_X], (*this)[POSE_LINEAR_VELOCITY_Y], (*this)[POSE_LINEAR_VELOCITY_Z]);
+    PoseVector3<T> get_linear_velocity_m_per_sec() const {
+        return PoseVector3<T>((*this)[POSE_LINEAR_VELOCITY_X], (*this)[POSE_LINEAR_VELOCITY_Y], (*this)[POSE_LINEAR_VELOCITY_Z]);
     }
-    Eigen::Vector3d get_linear_acceleration_m_per_sec_sqr() const {
-        return Eigen::Vector3d((*this)[POSE_LINEAR_ACCELERATION_X], (*this)[POSE_LINEAR_ACCELERATION_Y], (*this)[POSE_LINEAR_ACCELERATION_Z]);
+    PoseVector3<T> get_linear_acceleration_m_per_sec_sqr() const {
+        return PoseVector3<T>((*this)[POSE_LINEAR_ACCELERATION_X], (*this)[POSE_LINEAR_ACCELERATION_Y], (*this)[POSE_LINEAR_ACCELERATION_Z]);
     }
-    Eigen::Quaterniond get_error_quaterniond() const {
-        return Eigen::Quaterniond((*this)[POSE_ERROR_QUATERNION_W], (*this)[POSE_ERROR_QUATERNION_X], (*this)[POSE_ERROR_QUATERNION_Y], (*this)[POSE_ERROR_QUATERNION_Z]);
+    Eigen::Quaternion<T> get_error_quaterniond() const {
+        return Eigen::Quaternion<T>((*this)[POSE_ERROR_QUATERNION_W], (*this)[POSE_ERROR_QUATERNION_X], (*this)[POSE_ERROR_QUATERNION_Y], (*this)[POSE_ERROR_QUATERNION_Z]);
     }
 
     // Mutators
-    void set_position_meters(const Eigen::Vector3d &p) {
+    void set_position_meters(const PoseVector3<T> &p) {
         (*this)[POSE_POSITION_X] = p.x(); (*this)[POSE_POSITION_Y] = p.y(); (*this)[POSE_POSITION_Z] = p.z();
     }
-    void set_linear_velocity_m_per_sec(const Eigen::Vector3d &v) {
+    void set_linear_velocity_m_per_sec(const PoseVector3<T> &v) {
         (*this)[POSE_LINEAR_VELOCITY_X] = v.x(); (*this)[POSE_LINEAR_VELOCITY_Y] = v.y(); (*this)[POSE_LINEAR_VELOCITY_Z] = v.z();
     }
-    void set_linear_acceleration_m_per_sec_sqr(const Eigen::Vector3d &a) {
+    void set_linear_acceleration_m_per_sec_sqr(const PoseVector3<T> &a) {
         (*this)[POSE_LINEAR_ACCELERATION_X] = a.x(); (*this)[POSE_LINEAR_ACCELERATION_Y] = a.y(); (*this)[POSE_LINEAR_ACCELERATION_Z] = a.z();
     }
-    void set_error_quaterniond(const Eigen::Quaterniond &q) {
+    void set_error_quaterniond(const Eigen::Quaternion<T> &q) {
         (*this)[POSE_ERROR_QUATERNION_W] = q.w();
         (*this)[POSE_ERROR_QUATERNION_X] = q.x();
         (*this)[POSE_ERROR_QUATERNION_Y] = q.y();
         (*this)[POSE_ERROR_QUATERNION_Z] = q.z();
     }
 };
-typedef PoseStateVector<double> PoseStateVectord;
 
 template<typename T>
 class PoseControlVector : public Kalman::Vector<T, POSE_CONTROL_PARAMETER_COUNT>
@@ -160,18 +212,17 @@ public:
 	KALMAN_VECTOR(PoseControlVector, T, POSE_CONTROL_PARAMETER_COUNT)
 
 	// Accessors
-	Eigen::Vector3d get_angular_rates() const {
-		return Eigen::Vector3d((*this)[POSE_CONTROL_GYROSCOPE_PITCH], (*this)[POSE_CONTROL_GYROSCOPE_YAW], (*this)[POSE_CONTROL_GYROSCOPE_ROLL]);
+	PoseVector3<T> get_angular_rates() const {
+		return PoseVector3<T>((*this)[POSE_CONTROL_GYROSCOPE_PITCH], (*this)[POSE_CONTROL_GYROSCOPE_YAW], (*this)[POSE_CONTROL_GYROSCOPE_ROLL]);
 	}
 
 	// Mutators
-	void set_angular_rates(const Eigen::Vector3d &v) {
+	void set_angular_rates(const PoseVector3<T> &v) {
 		(*this)[POSE_CONTROL_GYROSCOPE_PITCH] = v.x();
 		(*this)[POSE_CONTROL_GYROSCOPE_YAW] = v.y();
 		(*this)[POSE_CONTROL_GYROSCOPE_ROLL] = v.z();
 	}
 };
-typedef PoseControlVector<double> PoseControlVectord;
 
 /**
 * @brief System model for a controller
@@ -179,16 +230,17 @@ typedef PoseControlVector<double> PoseControlVectord;
 * This is the system model defining how a controller advances from one
 * time-step to the next, i.e. how the system state evolves over time.
 */
-class PoseSystemModel : public Kalman::SystemModel<PoseStateVectord, PoseControlVectord, Kalman::SquareRootBase>
+template<typename T>
+class PoseSystemModel : public Kalman::SystemModel<PoseStateVector<T>, PoseControlVector<T>, Kalman::SquareRootBase>
 {
 public:
-    inline void set_time_step(const double dt) { m_time_step = dt; }
+    inline void set_time_step(const double dt) { m_time_step = static_cast<T>(dt); }
 
     void init(const PoseFilterConstants &constants)
     {
         use_linear_acceleration = constants.position_constants.use_linear_acceleration;
         m_last_tracking_projection_area_px_sqr = -1.f;
-		m_gyro_bias = constants.orientation_constants.gyro_drift.cast<double>();
+		m_gyro_bias = constants.orientation_constants.gyro_drift.template cast<T>();
         update_process_noise(constants, 0.f);
     }
 
@@ -220,15 +272,15 @@ public:
                 k_centimeters_to_meters*k_centimeters_to_meters*position_variance_cm_sqr;
 
             // Initialize the process covariance matrix Q
-            Kalman::Covariance<PoseStateVectord> Q = Kalman::Covariance<PoseStateVectord>::Zero();
-            Q_discrete_3rd_order_white_noise<PoseStateVectord>(mean_position_dT, position_variance_m_sqr, POSE_POSITION_X, Q);
-            Q_discrete_3rd_order_white_noise<PoseStateVectord>(mean_position_dT, position_variance_m_sqr, POSE_POSITION_Y, Q);
-            Q_discrete_3rd_order_white_noise<PoseStateVectord>(mean_position_dT, position_variance_m_sqr, POSE_POSITION_Z, Q);
-			Q_discrete_1st_order_white_noise<PoseStateVectord>(mean_orientation_dT, orientation_variance, POSE_ERROR_QUATERNION_W, Q);
-			Q_discrete_1st_order_white_noise<PoseStateVectord>(mean_orientation_dT, orientation_variance, POSE_ERROR_QUATERNION_X, Q);
-			Q_discrete_1st_order_white_noise<PoseStateVectord>(mean_orientation_dT, orientation_variance, POSE_ERROR_QUATERNION_Y, Q);
-			Q_discrete_1st_order_white_noise<PoseStateVectord>(mean_orientation_dT, orientation_variance, POSE_ERROR_QUATERNION_Z, Q);
-            setCovariance(Q);
+            Kalman::Covariance<PoseStateVector<T>> Q = Kalman::Covariance<PoseStateVector<T>>::Zero();
+            Q_discrete_3rd_order_white_noise<PoseStateVector<T>>(mean_position_dT, position_variance_m_sqr, POSE_POSITION_X, Q);
+            Q_discrete_3rd_order_white_noise<PoseStateVector<T>>(mean_position_dT, position_variance_m_sqr, POSE_POSITION_Y, Q);
+            Q_discrete_3rd_order_white_noise<PoseStateVector<T>>(mean_position_dT, position_variance_m_sqr, POSE_POSITION_Z, Q);
+			Q_discrete_1st_order_white_noise<PoseStateVector<T>>(mean_orientation_dT, orientation_variance, POSE_ERROR_QUATERNION_W, Q);
+			Q_discrete_1st_order_white_noise<PoseStateVector<T>>(mean_orientation_dT, orientation_variance, POSE_ERROR_QUATERNION_X, Q);
+			Q_discrete_1st_order_white_noise<PoseStateVector<T>>(mean_orientation_dT, orientation_variance, POSE_ERROR_QUATERNION_Y, Q);
+			Q_discrete_1st_order_white_noise<PoseStateVector<T>>(mean_orientation_dT, orientation_variance, POSE_ERROR_QUATERNION_Z, Q);
+            this->setCovariance(Q);
 
             // Keep track last tracking projection area we built the covariance matrix for
             m_last_tracking_projection_area_px_sqr = tracking_projection_area_px_sqr;
@@ -247,25 +299,25 @@ public:
     * @param [in] u The control vector input
     * @returns The (predicted) system state in the next time-step
     */
-    PoseStateVectord f(const PoseStateVectord& old_state, const PoseControlVectord& control) const
+    PoseStateVector<T> f(const PoseStateVector<T>& old_state, const PoseControlVector<T>& control) const
     {
         // Predicted state vector after transition
-        PoseStateVectord new_state;
+        PoseStateVector<T> new_state;
 
         // Extract parameters from the old state
-        const Eigen::Vector3d old_position_meters = old_state.get_position_meters();
-        const Eigen::Vector3d old_linear_velocity_m_per_sec = old_state.get_linear_velocity_m_per_sec();
-        const Eigen::Vector3d old_linear_acceleration_m_per_sec_sqr = old_state.get_linear_acceleration_m_per_sec_sqr();
+        const PoseVector3<T> old_position_meters = old_state.get_position_meters();
+        const PoseVector3<T> old_linear_velocity_m_per_sec = old_state.get_linear_velocity_m_per_sec();
+        const PoseVector3<T> old_linear_acceleration_m_per_sec_sqr = old_state.get_linear_acceleration_m_per_sec_sqr();
 
         // Extract parameters from the old state
-        const Eigen::Quaterniond error_q_old = old_state.get_error_quaterniond();
+        const Eigen::Quaternion<T> error_q_old = old_state.get_error_quaterniond();
 
 		// Compute the true angular rate from the control vector
-		const Eigen::Vector3d omega = control - m_gyro_bias;
+		const PoseVector3<T> omega = control - m_gyro_bias;
 
         // Compute the position state update
-        Eigen::Vector3d new_position_meters;
-        Eigen::Vector3d new_linear_velocity_m_per_sec;
+        PoseVector3<T> new_position_meters;
+        PoseVector3<T> new_linear_velocity_m_per_sec;
         if (use_linear_acceleration)
         {
             new_position_meters =
@@ -287,13 +339,13 @@ public:
                 : old_linear_velocity_m_per_sec;
         }
 
-        const Eigen::Vector3d &new_linear_acceleration_m_per_sec_sqr = old_linear_acceleration_m_per_sec_sqr;
+        const PoseVector3<T> &new_linear_acceleration_m_per_sec_sqr = old_linear_acceleration_m_per_sec_sqr;
 
 		// Compute the quaternion derivative of the current state
 		// q_new= q + q_dot*dT
-		const Eigen::Quaterniond q_dot = eigen_angular_velocity_to_quaterniond_derivative(error_q_old, omega);
-		const Eigen::Quaterniond error_q_step = Eigen::Quaterniond(q_dot.coeffs() * m_time_step);
-		const Eigen::Quaterniond error_q_new = Eigen::Quaterniond(error_q_old.coeffs() + error_q_step.coeffs());
+		const Eigen::Quaternion<T> q_dot = pose_angular_velocity_to_quaternion_derivative(error_q_old, omega);
+		const Eigen::Quaternion<T> error_q_step = Eigen::Quaternion<T>(q_dot.coeffs() * m_time_step);
+		const Eigen::Quaternion<T> error_q_new = Eigen::Quaternion<T>(error_q_old.coeffs() + error_q_step.coeffs());
 
         // Save results to the new state
         new_state.set_position_meters(new_position_meters);
@@ -308,22 +360,23 @@ public:
 
 protected:
     bool use_linear_acceleration;
-    double m_time_step;
+    T m_time_step;
     float m_last_tracking_projection_area_px_sqr;
-	Eigen::Vector3d m_gyro_bias;
+	PoseVector3<T> m_gyro_bias;
 };
 
-class PoseSRUKF : public Kalman::SquareRootUnscentedKalmanFilter<PoseStateVectord>
+template<typename T>
+class PoseSRUKF : public Kalman::SquareRootUnscentedKalmanFilter<PoseStateVector<T>>
 {
 public:
-    PoseSRUKF(double alpha = 1.0, double beta = 2.0, double kappa = 0.0)
-        : Kalman::SquareRootUnscentedKalmanFilter<PoseStateVectord>(alpha, beta, kappa)
+    PoseSRUKF(T alpha = 1.0, T beta = 2.0, T kappa = 0.0)
+        : Kalman::SquareRootUnscentedKalmanFilter<PoseStateVector<T>>(alpha, beta, kappa)
     {
     }
 
-    State& getStateMutable()
+    typename Kalman::SquareRootUnscentedKalmanFilter<PoseStateVector<T>>::State& getStateMutable()
     {
-        return x;
+        return this->x;
     }
 };
 
@@ -334,35 +387,35 @@ public:
 	KALMAN_VECTOR(PoseGravMeasurementVector, T, POSE_G_MEASUREMENT_PARAMETER_COUNT)
 
 		// Accessors
-		Eigen::Vector3d get_accelerometer() const {
-		return Eigen::Vector3d((*this)[POSE_ACCELEROMETER_X], (*this)[POSE_ACCELEROMETER_Y], (*this)[POSE_ACCELEROMETER_Z]);
+		PoseVector3<T> get_accelerometer() const {
+		return PoseVector3<T>((*this)[POSE_ACCELEROMETER_X], (*this)[POSE_ACCELEROMETER_Y], (*this)[POSE_ACCELEROMETER_Z]);
 	}
 
 	// Mutators
-	void set_accelerometer(const Eigen::Vector3d &a) {
+	void set_accelerometer(const PoseVector3<T> &a) {
 		(*this)[POSE_ACCELEROMETER_X] = a.x(); (*this)[POSE_ACCELEROMETER_Y] = a.y(); (*this)[POSE_ACCELEROMETER_Z] = a.z();
 	}
 };
-typedef PoseGravMeasurementVector<double> PoseGravMeasurementVectord;
 
+template<typename T>
 class PoseGravMeasurementModel :
-	public Kalman::MeasurementModel<PoseStateVectord, PoseGravMeasurementVectord, Kalman::SquareRootBase>
+	public Kalman::MeasurementModel<PoseStateVector<T>, PoseGravMeasurementVector<T>, Kalman::SquareRootBase>
 {
 public:
-	void init(const OrientationFilterConstants &constants, const Eigen::Quaterniond *last_world_orientation_ptr)
+	void init(const OrientationFilterConstants &constants, const Eigen::Quaternion<T> *last_world_orientation_ptr)
 	{
 		// Update the measurement covariance R
-		Kalman::Covariance<PoseGravMeasurementVectord> R =
-			Kalman::Covariance<PoseGravMeasurementVectord>::Zero();
+		Kalman::Covariance<PoseGravMeasurementVector<T>> R =
+			Kalman::Covariance<PoseGravMeasurementVector<T>>::Zero();
 
 		// Only diagonals used so no need to compute Cholesky
 		static float r_accelerometer_scale = R_SCALE;
 		R(POSE_ACCELEROMETER_X, POSE_ACCELEROMETER_X) = r_accelerometer_scale*constants.accelerometer_variance.x();
 		R(POSE_ACCELEROMETER_Y, POSE_ACCELEROMETER_Y) = r_accelerometer_scale*constants.accelerometer_variance.y();
 		R(POSE_ACCELEROMETER_Z, POSE_ACCELEROMETER_Z) = r_accelerometer_scale*constants.accelerometer_variance.z();
-		setCovariance(R);
+		this->setCovariance(R);
 
-		identity_gravity_direction = constants.gravity_calibration_direction.cast<double>();
+		identity_gravity_direction = constants.gravity_calibration_direction.template cast<T>();
 		m_last_world_orientation_ptr = last_world_orientation_ptr;
 	}
 
@@ -376,25 +429,25 @@ public:
 	* @param [in] x The system state in current time-step
 	* @returns The (predicted) sensor measurement for the system state
 	*/
-	PoseGravMeasurementVectord h(const PoseStateVectord& x) const
+	PoseGravMeasurementVector<T> h(const PoseStateVector<T>& x) const
 	{
-		PoseGravMeasurementVectord predicted_measurement;
+		PoseGravMeasurementVector<T> predicted_measurement;
 
 		// Use the orientation + linear acceleration state from the state for prediction
-		const Eigen::Quaterniond error_orientation = x.get_error_quaterniond();
-		const Eigen::Quaterniond world_to_local_orientation = 
+		const Eigen::Quaternion<T> error_orientation = x.get_error_quaterniond();
+		const Eigen::Quaternion<T> world_to_local_orientation = 
 			eigen_quaternion_concatenate(*m_last_world_orientation_ptr, error_orientation).normalized();
 
 		// Convert the world space linear acceleration in the state into a local space predicted measurement in the accelerometer 
-		const Eigen::Vector3d world_linear_accel_g_units = x.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
-		const Eigen::Vector3d local_linear_accel_g_units = eigen_vector3d_clockwise_rotate(world_to_local_orientation, world_linear_accel_g_units);
+		const PoseVector3<T> world_linear_accel_g_units = x.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
+		const PoseVector3<T> local_linear_accel_g_units = pose_vector3_clockwise_rotate(world_to_local_orientation, world_linear_accel_g_units);
 
 		// Convert the world space gravitational acceleration in the state into a local space predicted measurement in the accelerometer 
-		const Eigen::Vector3d &world_gravity_accel_g_units = identity_gravity_direction;
-		const Eigen::Vector3d local_gravity_accel_g_units = eigen_vector3d_clockwise_rotate(world_to_local_orientation, world_gravity_accel_g_units);
+		const PoseVector3<T> &world_gravity_accel_g_units = identity_gravity_direction;
+		const PoseVector3<T> local_gravity_accel_g_units = pose_vector3_clockwise_rotate(world_to_local_orientation, world_gravity_accel_g_units);
 		
 		// Combine the linear and gravitational accelerometer predictions into the final predicted accelerometer reading
-		const Eigen::Vector3d accel_local = local_linear_accel_g_units + local_gravity_accel_g_units;
+		const PoseVector3<T> accel_local = local_linear_accel_g_units + local_gravity_accel_g_units;
 
 		// Save the predictions into the measurement vector
 		predicted_measurement.set_accelerometer(accel_local);
@@ -403,8 +456,8 @@ public:
 	}
 
 public:
-	Eigen::Vector3d identity_gravity_direction;
-	const Eigen::Quaterniond *m_last_world_orientation_ptr;
+	PoseVector3<T> identity_gravity_direction;
+	const Eigen::Quaternion<T> *m_last_world_orientation_ptr;
 };
 
 template<typename T>
@@ -414,32 +467,32 @@ public:
 	KALMAN_VECTOR(PoseMagGravMeasurementVector, T, POSE_MG_MEASUREMENT_PARAMETER_COUNT)
 
 	// Accessors
-	Eigen::Vector3d get_accelerometer() const {
-		return Eigen::Vector3d((*this)[POSE_ACCELEROMETER_X], (*this)[POSE_ACCELEROMETER_Y], (*this)[POSE_ACCELEROMETER_Z]);
+	PoseVector3<T> get_accelerometer() const {
+		return PoseVector3<T>((*this)[POSE_ACCELEROMETER_X], (*this)[POSE_ACCELEROMETER_Y], (*this)[POSE_ACCELEROMETER_Z]);
 	}
-	Eigen::Vector3d get_magnetometer() const {
-		return Eigen::Vector3d((*this)[POSE_MAGNETOMETER_X], (*this)[POSE_MAGNETOMETER_Y], (*this)[POSE_MAGNETOMETER_Z]);
+	PoseVector3<T> get_magnetometer() const {
+		return PoseVector3<T>((*this)[POSE_MAGNETOMETER_X], (*this)[POSE_MAGNETOMETER_Y], (*this)[POSE_MAGNETOMETER_Z]);
 	}
 
 	// Mutators
-	void set_accelerometer(const Eigen::Vector3d &a) {
+	void set_accelerometer(const PoseVector3<T> &a) {
 		(*this)[POSE_ACCELEROMETER_X] = a.x(); (*this)[POSE_ACCELEROMETER_Y] = a.y(); (*this)[POSE_ACCELEROMETER_Z] = a.z();
 	}
-	void set_magnetometer(const Eigen::Vector3d &m) {
+	void set_magnetometer(const PoseVector3<T> &m) {
 		(*this)[POSE_MAGNETOMETER_X] = m.x(); (*this)[POSE_MAGNETOMETER_Y] = m.y(); (*this)[POSE_MAGNETOMETER_Z] = m.z();
 	}
 };
-typedef PoseMagGravMeasurementVector<double> PoseMagGravMeasurementVectord;
 
+template<typename T>
 class PoseMagGravMeasurementModel :
-	public Kalman::MeasurementModel<PoseStateVectord, PoseMagGravMeasurementVectord, Kalman::SquareRootBase>
+	public Kalman::MeasurementModel<PoseStateVector<T>, PoseMagGravMeasurementVector<T>, Kalman::SquareRootBase>
 {
 public:
-	void init(const OrientationFilterConstants &constants, const Eigen::Quaterniond *last_world_orientation_ptr)
+	void init(const OrientationFilterConstants &constants, const Eigen::Quaternion<T> *last_world_orientation_ptr)
 	{
 		// Update the measurement covariance R
-		Kalman::Covariance<PoseMagGravMeasurementVectord> R =
-			Kalman::Covariance<PoseMagGravMeasurementVectord>::Zero();
+		Kalman::Covariance<PoseMagGravMeasurementVector<T>> R =
+			Kalman::Covariance<PoseMagGravMeasurementVector<T>>::Zero();
 
 		// Only diagonals used so no need to compute Cholesky
 		static float r_accelerometer_scale = R_SCALE;
@@ -450,10 +503,10 @@ public:
 		R(POSE_MAGNETOMETER_X, POSE_MAGNETOMETER_X) = r_magnetometer_scale*constants.magnetometer_variance.x();
 		R(POSE_MAGNETOMETER_Y, POSE_MAGNETOMETER_Y) = r_magnetometer_scale*constants.magnetometer_variance.y();
 		R(POSE_MAGNETOMETER_Z, POSE_MAGNETOMETER_Z) = r_magnetometer_scale*constants.magnetometer_variance.z();
-		setCovariance(R);
+		this->setCovariance(R);
 
-		identity_gravity_direction = constants.gravity_calibration_direction.cast<double>();
-		identity_magnetometer_direction = constants.magnetometer_calibration_direction.cast<double>();
+		identity_gravity_direction = constants.gravity_calibration_direction.template cast<T>();
+		identity_magnetometer_direction = constants.magnetometer_calibration_direction.template cast<T>();
 		m_last_world_orientation_ptr = last_world_orientation_ptr;
 	}
 
@@ -467,30 +520,30 @@ public:
 	* @param [in] x The system state in current time-step
 	* @returns The (predicted) sensor measurement for the system state
 	*/
-	PoseMagGravMeasurementVectord h(const PoseStateVectord& x) const
+	PoseMagGravMeasurementVector<T> h(const PoseStateVector<T>& x) const
 	{
-		PoseMagGravMeasurementVectord predicted_measurement;
+		PoseMagGravMeasurementVector<T> predicted_measurement;
 
 		// Use the orientation + linear acceleration state from the state for prediction
-		const Eigen::Quaterniond error_orientation = x.get_error_quaterniond();
-		const Eigen::Quaterniond world_to_local_orientation = 
+		const Eigen::Quaternion<T> error_orientation = x.get_error_quaterniond();
+		const Eigen::Quaternion<T> world_to_local_orientation = 
 			eigen_quaternion_concatenate(*m_last_world_orientation_ptr, error_orientation).normalized();
 
 		// Convert the world space linear acceleration in the state into a local space predicted measurement in the accelerometer 
-		const Eigen::Vector3d world_linear_accel_g_units = x.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
-		const Eigen::Vector3d local_linear_accel_g_units = eigen_vector3d_clockwise_rotate(world_to_local_orientation, world_linear_accel_g_units);
+		const PoseVector3<T> world_linear_accel_g_units = x.get_linear_acceleration_m_per_sec_sqr() * k_ms2_to_g_units;
+		const PoseVector3<T> local_linear_accel_g_units = pose_vector3_clockwise_rotate(world_to_local_orientation, world_linear_accel_g_units);
 
 		// Convert the world space gravitational acceleration in the state into a local space predicted measurement in the accelerometer 
-		const Eigen::Vector3d &world_gravity_accel_g_units = identity_gravity_direction;
-		const Eigen::Vector3d local_gravity_accel_g_units = eigen_vector3d_clockwise_rotate(world_to_local_orientation, world_gravity_accel_g_units);
+		const PoseVector3<T> &world_gravity_accel_g_units = identity_gravity_direction;
+		const PoseVector3<T> local_gravity_accel_g_units = pose_vector3_clockwise_rotate(world_to_local_orientation, world_gravity_accel_g_units);
 
 		// Combine the linear and gravitational accelerometer predictions into the final predicted accelerometer reading
-		const Eigen::Vector3d accel_local = local_linear_accel_g_units + local_gravity_accel_g_units;
+		const PoseVector3<T> accel_local = local_linear_accel_g_units + local_gravity_accel_g_units;
 
 		// Use the orientation from the state to predict
 		// what the magnetometer reading should be (in the space of the controller)
-		const Eigen::Vector3d &mag_world = identity_magnetometer_direction;
-		const Eigen::Vector3d mag_local = eigen_vector3d_clockwise_rotate(world_to_local_orientation, mag_world);
+		const PoseVector3<T> &mag_world = identity_magnetometer_direction;
+		const PoseVector3<T> mag_local = pose_vector3_clockwise_rotate(world_to_local_orientation, mag_world);
 
 		// Save the predictions into the measurement vector
 		predicted_measurement.set_accelerometer(accel_local);
@@ -500,10 +553,10 @@ public:
 	}
 
 public:
-	Eigen::Vector3d identity_gravity_direction;
-	Eigen::Vector3d identity_magnetometer_direction;
-	const Eigen::Quaterniond *m_last_world_orientation_ptr;
-	//Eigen::Vector3d m_last_world_linear_acceleration_m_per_sec_sqr;
+	PoseVector3<T> identity_gravity_direction;
+	PoseVector3<T> identity_magnetometer_direction;
+	const Eigen::Quaternion<T> *m_last_world_orientation_ptr;
+	//PoseVector3<T> m_last_world_linear_acceleration_m_per_sec_sqr;
 };
 
 template<typename T>
@@ -513,21 +566,20 @@ public:
     KALMAN_VECTOR(PoseLEDMeasurementVector, T, POSE_LED_MEASUREMENT_PARAMETER_COUNT)
 
     // Accessors
-    Eigen::Vector3d get_LED_position_meters() const {
-        return Eigen::Vector3d(
+    PoseVector3<T> get_LED_position_meters() const {
+        return PoseVector3<T>(
                 (*this)[POSE_LED_POSITION_X], 
                 (*this)[POSE_LED_POSITION_Y],
                 (*this)[POSE_LED_POSITION_Z]);
     }
 
     // Mutators
-    void set_LED_position_meters(const Eigen::Vector3d &p) {
+    void set_LED_position_meters(const PoseVector3<T> &p) {
         (*this)[POSE_LED_POSITION_X] = p.x();
 		(*this)[POSE_LED_POSITION_Y] = p.y();
 		(*this)[POSE_LED_POSITION_Z] = p.z();
     }
 };
-typedef PoseLEDMeasurementVector<double> PoseLEDMeasurementVectord;
 
 /**
 * @brief LED Measurement model for measuring PSVR controller
@@ -535,11 +587,12 @@ typedef PoseLEDMeasurementVector<double> PoseLEDMeasurementVectord;
 * This is the measurement model for measuring the position and magnetometer of the PSVR controller.
 * The measurement is given by the optical trackers.
 */
+template<typename T>
 class PoseLEDMeasurementModel : 
-    public Kalman::MeasurementModel<PoseStateVectord, PoseLEDMeasurementVectord, Kalman::SquareRootBase>
+    public Kalman::MeasurementModel<PoseStateVector<T>, PoseLEDMeasurementVector<T>, Kalman::SquareRootBase>
 {
 public:
-    void init(const PoseFilterConstants &constants, int led_index, const Eigen::Quaterniond *last_world_orientation)
+    void init(const PoseFilterConstants &constants, int led_index, const Eigen::Quaternion<T> *last_world_orientation)
     {
         m_last_world_orientation_ptr = last_world_orientation;
 		m_last_tracking_projection_area_px_sqr = -1.f;
@@ -551,10 +604,10 @@ public:
 
 		// LED model is in centimeters while filter is in meters
         m_LED_model_vertex= 
-			Eigen::Vector3d(
-				static_cast<double>(p.x * k_centimeters_to_meters),
-				static_cast<double>(p.y * k_centimeters_to_meters),
-				static_cast<double>(p.z * k_centimeters_to_meters));
+			PoseVector3<T>(
+				static_cast<T>(p.x * k_centimeters_to_meters),
+				static_cast<T>(p.y * k_centimeters_to_meters),
+				static_cast<T>(p.z * k_centimeters_to_meters));
     }
 
 	void updateMeasurementCovariance(
@@ -577,11 +630,11 @@ public:
 			// Update the measurement covariance R
             // Only diagonals used so no need to compute Cholesky
             static float r_position_scale = R_SCALE;
-			Kalman::Covariance<PoseLEDMeasurementVectord> R = Kalman::Covariance<PoseLEDMeasurementVectord>::Zero();
+			Kalman::Covariance<PoseLEDMeasurementVector<T>> R = Kalman::Covariance<PoseLEDMeasurementVector<T>>::Zero();
 			R(POSE_LED_POSITION_X, POSE_LED_POSITION_X) = fmax(r_position_scale*position_variance_m_sqr, R_MIN);
 			R(POSE_LED_POSITION_Y, POSE_LED_POSITION_Y) = fmax(r_position_scale*position_variance_m_sqr, R_MIN);
 			R(POSE_LED_POSITION_Z, POSE_LED_POSITION_Z) = fmax(r_position_scale*position_variance_m_sqr, R_MIN);
-			setCovariance(R);
+			this->setCovariance(R);
 
 			// Keep track last position quality we built the covariance matrix for
 			m_last_tracking_projection_area_px_sqr = tracking_projection_area_px_sqr;
@@ -598,29 +651,23 @@ public:
     * @param [in] x The system state in current time-step
     * @returns The (predicted) sensor measurement for the system state
     */
-    PoseLEDMeasurementVectord h(const PoseStateVectord& x) const
+    PoseLEDMeasurementVector<T> h(const PoseStateVector<T>& x) const
     {
-		PoseLEDMeasurementVectord predicted_measurement;
+		PoseLEDMeasurementVector<T> predicted_measurement;
 
         // Use the position and orientation from the state for predictions
-        const Eigen::Vector3d position_meters= x.get_position_meters();
-        const Eigen::Quaterniond error_orientation = x.get_error_quaterniond();
-        const Eigen::Quaterniond local_to_world_orientation = 
+        const PoseVector3<T> position_meters= x.get_position_meters();
+        const Eigen::Quaternion<T> error_orientation = x.get_error_quaterniond();
+        const Eigen::Quaternion<T> local_to_world_orientation = 
 			eigen_quaternion_concatenate(*m_last_world_orientation_ptr, error_orientation).normalized();
 
 		//predicted_measurement.set_optical_orientation(local_to_world_orientation);
 		//predicted_measurement.set_optical_position_meters(position_meters);
-        // Compute where we expect to find the tracking LEDs
-        Eigen::Affine3d local_to_world= Eigen::Affine3d::Identity();
-        local_to_world.linear()= local_to_world_orientation.toRotationMatrix();
-        local_to_world.translation()= x.get_position_meters();
-
-		const Eigen::Vector3d led_model_vertex=
-			Eigen::Vector3d(
-				m_LED_model_vertex.x(),
-				m_LED_model_vertex.y(),
-				m_LED_model_vertex.z());
-        const Eigen::Vector3d predicted_led_position= local_to_world * led_model_vertex;
+        // Compute where we expect to find the tracking LED.
+        // This runs once per sigma point for every LED seen by every tracker, so rotate the
+        // vertex by the quaternion directly rather than building an affine transform each time.
+        const PoseVector3<T> predicted_led_position=
+			local_to_world_orientation._transformVector(m_LED_model_vertex) + position_meters;
 
         predicted_measurement.set_LED_position_meters(predicted_led_position);
 
@@ -628,8 +675,8 @@ public:
     }
 
 public:
-    Eigen::Vector3d m_LED_model_vertex; // in meters!
-    const Eigen::Quaterniond *m_last_world_orientation_ptr;
+    PoseVector3<T> m_LED_model_vertex; // in meters!
+    const Eigen::Quaternion<T> *m_last_world_orientation_ptr;
     double m_time_step;
 	float m_last_tracking_projection_area_px_sqr;
 };
@@ -641,8 +688,8 @@ public:
 	KALMAN_VECTOR(PoseOrientationMeasurementVector, T, POSE_OPTICAL_MEASUREMENT_PARAMETER_COUNT)
 
     // Accessors
-	Eigen::Quaterniond get_optical_quaterniond() const {
-		return Eigen::Quaterniond(
+	Eigen::Quaternion<T> get_optical_quaterniond() const {
+		return Eigen::Quaternion<T>(
 			(*this)[POSE_OPTICAL_QUATERNION_W], 
 			(*this)[POSE_OPTICAL_QUATERNION_X],
 			(*this)[POSE_OPTICAL_QUATERNION_Y], 
@@ -650,20 +697,20 @@ public:
 	}
 
     // Mutators
-	void set_optical_quaterniond(const Eigen::Quaterniond &q) {
+	void set_optical_quaterniond(const Eigen::Quaternion<T> &q) {
 		(*this)[POSE_OPTICAL_QUATERNION_W] = q.w();
 		(*this)[POSE_OPTICAL_QUATERNION_X] = q.x();
 		(*this)[POSE_OPTICAL_QUATERNION_Y] = q.y();
 		(*this)[POSE_OPTICAL_QUATERNION_Z] = q.z();
 	}
 };
-typedef PoseOrientationMeasurementVector<double> PoseOrientationMeasurementVectord;
 
+template<typename T>
 class PoseOrientationMeasurementModel
-	: public Kalman::MeasurementModel<PoseStateVectord, PoseOrientationMeasurementVectord, Kalman::SquareRootBase>
+	: public Kalman::MeasurementModel<PoseStateVector<T>, PoseOrientationMeasurementVector<T>, Kalman::SquareRootBase>
 {
 public:
-	void init(const OrientationFilterConstants &constants, const Eigen::Quaterniond *last_world_orientation)
+	void init(const OrientationFilterConstants &constants, const Eigen::Quaternion<T> *last_world_orientation)
 	{
 		m_last_tracking_projection_area = -1.f;
 		m_last_world_orientation_ptr= last_world_orientation;
@@ -679,8 +726,8 @@ public:
 			!is_nearly_equal(tracking_projection_area, m_last_tracking_projection_area, 10.f))
 		{
 			// Update the measurement covariance R
-			Kalman::Covariance<PoseOrientationMeasurementVectord> R =
-				Kalman::Covariance<PoseOrientationMeasurementVectord>::Zero();
+			Kalman::Covariance<PoseOrientationMeasurementVector<T>> R =
+				Kalman::Covariance<PoseOrientationMeasurementVector<T>>::Zero();
 			const float orientation_variance = constants.orientation_variance_curve.evaluate(tracking_projection_area);
 
 			static float r_scale = R_SCALE;
@@ -688,7 +735,7 @@ public:
 			R(POSE_OPTICAL_QUATERNION_X, POSE_OPTICAL_QUATERNION_X) = r_scale*orientation_variance;
 			R(POSE_OPTICAL_QUATERNION_Y, POSE_OPTICAL_QUATERNION_Y) = r_scale*orientation_variance;
 			R(POSE_OPTICAL_QUATERNION_Z, POSE_OPTICAL_QUATERNION_Z) = r_scale*orientation_variance;
-			setCovariance(R);
+			this->setCovariance(R);
 
 			// Keep track last tracking projection area we built the covariance matrix for
 			m_last_tracking_projection_area = tracking_projection_area;
@@ -705,13 +752,13 @@ public:
 	* @param [in] x The system state in current time-step
 	* @returns The (predicted) sensor measurement for the system state
 	*/
-	PoseOrientationMeasurementVectord h(const PoseStateVectord& x) const
+	PoseOrientationMeasurementVector<T> h(const PoseStateVector<T>& x) const
 	{
-		PoseOrientationMeasurementVectord predicted_measurement;
+		PoseOrientationMeasurementVector<T> predicted_measurement;
 
 		// Use the orientation from the state for prediction
-		const Eigen::Quaterniond error_orientation = x.get_error_quaterniond();
-		const Eigen::Quaterniond world_to_local_orientation = 
+		const Eigen::Quaternion<T> error_orientation = x.get_error_quaterniond();
+		const Eigen::Quaternion<T> world_to_local_orientation = 
 			eigen_quaternion_concatenate(*m_last_world_orientation_ptr, error_orientation).normalized();
 
 		// Save the predictions into the measurement vector
@@ -722,10 +769,11 @@ public:
 
 public:
 	float m_last_tracking_projection_area;
-	const Eigen::Quaterniond *m_last_world_orientation_ptr;
+	const Eigen::Quaternion<T> *m_last_world_orientation_ptr;
 };
 
 
+template<typename T>
 class KalmanPoseFilterImpl
 {
 public:
@@ -742,10 +790,10 @@ public:
     Eigen::Vector3f origin_position_meters; // meters
 
     /// Used to model how the physics of the controller evolves
-    PoseSystemModel system_model;
+    PoseSystemModel<T> system_model;
 
     /// Unscented Kalman Filter instance
-    PoseSRUKF ukf;
+    PoseSRUKF<T> ukf;
 
     /// The duration the filter has been running
     double time;
@@ -754,14 +802,33 @@ public:
     /// This isn't part of the UKF state vector because it's non-linear.
     /// Instead we store an "error quaternion" in the UKF state vector and then apply it 
     /// to this quaternion after a time step and then zero out the error.
-    Eigen::Quaterniond world_orientation;
+    Eigen::Quaternion<T> world_orientation;
+
+    /// A packet that was applied to the filter along with the filter state from just before.
+    /// Lets a late optical measurement rewind to its capture time and replay what came after.
+    struct HistoryEntry
+    {
+        PoseFilterPacket packet;
+        float delta_time;
+        PoseSRUKF<T> ukf;
+        Eigen::Quaternion<T> world_orientation;
+        double time;
+        bool bIsValid;
+        bool bSeenPositionMeasurement;
+        bool bSeenOrientationMeasurement;
+    };
+    CircularBuffer<HistoryEntry, POSE_FILTER_HISTORY_CAPACITY> history;
+
+    /// Scratch space for the packets replayed after a late optical measurement
+    PoseFilterPacket replay_packets[POSE_FILTER_HISTORY_CAPACITY];
+    float replay_delta_times[POSE_FILTER_HISTORY_CAPACITY];
 
     KalmanPoseFilterImpl()
         : bIsValid(false)
         , bSeenOrientationMeasurement(false)
         , system_model()
-        , ukf(k_ukf_alpha, k_ukf_beta, k_ukf_kappa)
-        , world_orientation(Eigen::Quaternionf::Identity())
+        , ukf(KalmanPoseFilterPrecision<T>::ukf_alpha(), k_ukf_beta, k_ukf_kappa)
+        , world_orientation(Eigen::Quaternion<T>::Identity())
         , time(0.0)
     {
     }
@@ -772,11 +839,12 @@ public:
         bSeenOrientationMeasurement = false;
         bSeenPositionMeasurement= false;
 
-        world_orientation = Eigen::Quaterniond::Identity();
+        world_orientation = Eigen::Quaternion<T>::Identity();
         origin_position_meters = Eigen::Vector3f::Zero();
 
         system_model.init(constants);
-        ukf.init(PoseStateVectord::Identity());
+        ukf.init(PoseStateVector<T>::Identity());
+        history.clear();
     }
 
     virtual void init(
@@ -789,38 +857,66 @@ public:
         bSeenPositionMeasurement= true;
 
         origin_position_meters = Eigen::Vector3f::Zero();
-        world_orientation = orientation.cast<double>();
+        world_orientation = orientation.template cast<T>();
 
-        PoseStateVectord state_vector = PoseStateVectord::Identity();
-        state_vector.set_position_meters(initial_position_meters.cast<double>());
+        PoseStateVector<T> state_vector = PoseStateVector<T>::Identity();
+        state_vector.set_position_meters(initial_position_meters.template cast<T>());
 
         system_model.init(constants);
-        ukf.init(PoseStateVectord::Identity());
+        ukf.init(PoseStateVector<T>::Identity());
         apply_error_to_world_quaternion();
+        history.clear();
     }
 
     // -- World Quaternion Accessors --
-    inline Eigen::Quaterniond compute_net_world_quaternion() const
+    inline Eigen::Quaternion<T> compute_net_world_quaternion() const
     {
-        const Eigen::Quaterniond error_quaternion= ukf.getState().get_error_quaterniond();
-        const Eigen::Quaterniond output_quaternion = eigen_quaternion_concatenate(world_orientation, error_quaternion).normalized();
+        const Eigen::Quaternion<T> error_quaternion= ukf.getState().get_error_quaterniond();
+        const Eigen::Quaternion<T> output_quaternion = eigen_quaternion_concatenate(world_orientation, error_quaternion).normalized();
         return output_quaternion;
     }
 
     // -- World Quaternion Mutators --
-    inline void set_world_quaternion(const Eigen::Quaterniond &orientation)
+    inline void set_world_quaternion(const Eigen::Quaternion<T> &orientation)
     {
         world_orientation = orientation;
-        ukf.getStateMutable().set_error_quaterniond(Eigen::Quaterniond::Identity());
+        ukf.getStateMutable().set_error_quaterniond(Eigen::Quaternion<T>::Identity());
     }
 
     void apply_error_to_world_quaternion()
     {
         set_world_quaternion(compute_net_world_quaternion());
     }
+
+    // -- History --
+    void push_history_entry(const float delta_time, const PoseFilterPacket &packet)
+    {
+        HistoryEntry entry;
+        entry.packet = packet;
+        entry.delta_time = delta_time;
+        entry.ukf = ukf;
+        entry.world_orientation = world_orientation;
+        entry.time = time;
+        entry.bIsValid = bIsValid;
+        entry.bSeenPositionMeasurement = bSeenPositionMeasurement;
+        entry.bSeenOrientationMeasurement = bSeenOrientationMeasurement;
+
+        history.push_back(entry);
+    }
+
+    void restore_history_entry(const HistoryEntry &entry)
+    {
+        ukf = entry.ukf;
+        world_orientation = entry.world_orientation;
+        time = entry.time;
+        bIsValid = entry.bIsValid;
+        bSeenPositionMeasurement = entry.bSeenPositionMeasurement;
+        bSeenOrientationMeasurement = entry.bSeenOrientationMeasurement;
+    }
 };
 
-class PointCloudKalmanPoseFilterImpl : public KalmanPoseFilterImpl
+template<typename T>
+class PointCloudKalmanPoseFilterImpl : public KalmanPoseFilterImpl<T>
 {
 public:
 	virtual ~PointCloudKalmanPoseFilterImpl()
@@ -828,22 +924,22 @@ public:
 		cleanup();
 	}
 
-    std::vector<PoseLEDMeasurementModel *> led_measurement_models;
-	PoseOrientationMeasurementModel optical_measurement_model;
+    std::vector<PoseLEDMeasurementModel<T> *> led_measurement_models;
+	PoseOrientationMeasurementModel<T> optical_measurement_model;
 
     void init(const PoseFilterConstants &constants) override
     {
 		cleanup();
 
-        KalmanPoseFilterImpl::init(constants);
+        KalmanPoseFilterImpl<T>::init(constants);
 		for (int led_index = 0; led_index < constants.shape.shape.point_cloud.point_count; ++led_index)
 		{
-			PoseLEDMeasurementModel*led_model = new PoseLEDMeasurementModel();
+			PoseLEDMeasurementModel<T>*led_model = new PoseLEDMeasurementModel<T>();
 
-			led_model->init(constants, led_index, &world_orientation);
+			led_model->init(constants, led_index, &this->world_orientation);
 			led_measurement_models.push_back(led_model);
 		}
-		optical_measurement_model.init(constants.orientation_constants, &world_orientation);
+		optical_measurement_model.init(constants.orientation_constants, &this->world_orientation);
     }
 
     void init(
@@ -853,20 +949,20 @@ public:
     {
 		cleanup();
 
-        KalmanPoseFilterImpl::init(constants, position, orientation);
+        KalmanPoseFilterImpl<T>::init(constants, position, orientation);
 		for (int led_index = 0; led_index < constants.shape.shape.point_cloud.point_count; ++led_index)
 		{
-			PoseLEDMeasurementModel*led_model = new PoseLEDMeasurementModel();
+			PoseLEDMeasurementModel<T>*led_model = new PoseLEDMeasurementModel<T>();
 
-			led_model->init(constants, led_index, &world_orientation);
+			led_model->init(constants, led_index, &this->world_orientation);
 			led_measurement_models.push_back(led_model);
 		}
-		optical_measurement_model.init(constants.orientation_constants, &world_orientation);
+		optical_measurement_model.init(constants.orientation_constants, &this->world_orientation);
     }
 
 	void cleanup()
 	{
-		for (PoseLEDMeasurementModel *model : led_measurement_models)
+		for (PoseLEDMeasurementModel<T> *model : led_measurement_models)
 		{
 			delete model;
 		}
@@ -874,7 +970,8 @@ public:
 	}
 };
 
-class MorpheusKalmanPoseFilterImpl : public KalmanPoseFilterImpl
+template<typename T>
+class MorpheusKalmanPoseFilterImpl : public KalmanPoseFilterImpl<T>
 {
 public:
 	virtual ~MorpheusKalmanPoseFilterImpl()
@@ -882,22 +979,22 @@ public:
 		cleanup();
 	}
 
-	PoseGravMeasurementModel imu_measurement_model;
-	std::vector<PoseLEDMeasurementModel *> led_measurement_models;
-	PoseOrientationMeasurementModel optical_measurement_model;
+	PoseGravMeasurementModel<T> imu_measurement_model;
+	std::vector<PoseLEDMeasurementModel<T> *> led_measurement_models;
+	PoseOrientationMeasurementModel<T> optical_measurement_model;
 
     void init(const PoseFilterConstants &constants) override
     {
-        KalmanPoseFilterImpl::init(constants);
-		imu_measurement_model.init(constants.orientation_constants, &world_orientation);
+        KalmanPoseFilterImpl<T>::init(constants);
+		imu_measurement_model.init(constants.orientation_constants, &this->world_orientation);
 		for (int led_index = 0; led_index < constants.shape.shape.point_cloud.point_count; ++led_index)
 		{
-			PoseLEDMeasurementModel*led_model = new PoseLEDMeasurementModel();
+			PoseLEDMeasurementModel<T>*led_model = new PoseLEDMeasurementModel<T>();
 
-			led_model->init(constants, led_index, &world_orientation);
+			led_model->init(constants, led_index, &this->world_orientation);
 			led_measurement_models.push_back(led_model);
 		}
-		optical_measurement_model.init(constants.orientation_constants, &world_orientation);
+		optical_measurement_model.init(constants.orientation_constants, &this->world_orientation);
 	}
 
     void init(
@@ -905,21 +1002,21 @@ public:
         const Eigen::Vector3f &position,
         const Eigen::Quaternionf &orientation) override
     {
-        KalmanPoseFilterImpl::init(constants, position, orientation);
-		imu_measurement_model.init(constants.orientation_constants, &world_orientation);
+        KalmanPoseFilterImpl<T>::init(constants, position, orientation);
+		imu_measurement_model.init(constants.orientation_constants, &this->world_orientation);
 		for (int led_index = 0; led_index < constants.shape.shape.point_cloud.point_count; ++led_index)
 		{
-			PoseLEDMeasurementModel*led_model = new PoseLEDMeasurementModel();
+			PoseLEDMeasurementModel<T>*led_model = new PoseLEDMeasurementModel<T>();
 
-			led_model->init(constants, led_index, &world_orientation);
+			led_model->init(constants, led_index, &this->world_orientation);
 			led_measurement_models.push_back(led_model);
 		}
-		optical_measurement_model.init(constants.orientation_constants, &world_orientation);
+		optical_measurement_model.init(constants.orientation_constants, &this->world_orientation);
 	}
 
 	void cleanup()
 	{
-		for (PoseLEDMeasurementModel *model : led_measurement_models)
+		for (PoseLEDMeasurementModel<T> *model : led_measurement_models)
 		{
 			delete model;
 		}
@@ -927,18 +1024,19 @@ public:
 	}
 };
 
-class DS4KalmanPoseFilterImpl : public KalmanPoseFilterImpl
+template<typename T>
+class DS4KalmanPoseFilterImpl : public KalmanPoseFilterImpl<T>
 {
 public:
-	PoseGravMeasurementModel imu_measurement_model;
-	PoseOrientationMeasurementModel optical_measurement_model;
+	PoseGravMeasurementModel<T> imu_measurement_model;
+	PoseOrientationMeasurementModel<T> optical_measurement_model;
 
 	void init(
 		const PoseFilterConstants &constants) override
 	{
-        KalmanPoseFilterImpl::init(constants);
-		imu_measurement_model.init(constants.orientation_constants, &world_orientation);
-		optical_measurement_model.init(constants.orientation_constants, &world_orientation);
+        KalmanPoseFilterImpl<T>::init(constants);
+		imu_measurement_model.init(constants.orientation_constants, &this->world_orientation);
+		optical_measurement_model.init(constants.orientation_constants, &this->world_orientation);
 	}
 
 	void init(
@@ -946,24 +1044,25 @@ public:
 		const Eigen::Vector3f &position,
 		const Eigen::Quaternionf &orientation) override
 	{
-        KalmanPoseFilterImpl::init(constants, position, orientation);
-		imu_measurement_model.init(constants.orientation_constants, &world_orientation);
-		optical_measurement_model.init(constants.orientation_constants, &world_orientation);
+        KalmanPoseFilterImpl<T>::init(constants, position, orientation);
+		imu_measurement_model.init(constants.orientation_constants, &this->world_orientation);
+		optical_measurement_model.init(constants.orientation_constants, &this->world_orientation);
 	}
 };
 
-class PSMoveKalmanPoseFilterImpl : public KalmanPoseFilterImpl
+template<typename T>
+class PSMoveKalmanPoseFilterImpl : public KalmanPoseFilterImpl<T>
 {
 public:
-	PoseMagGravMeasurementModel imu_measurement_model;
-	PoseOrientationMeasurementModel optical_measurement_model;
+	PoseMagGravMeasurementModel<T> imu_measurement_model;
+	PoseOrientationMeasurementModel<T> optical_measurement_model;
 
 	void init(
 		const PoseFilterConstants &constants) override
 	{
-        KalmanPoseFilterImpl::init(constants);
-		imu_measurement_model.init(constants.orientation_constants, &world_orientation);
-		optical_measurement_model.init(constants.orientation_constants, &world_orientation);
+        KalmanPoseFilterImpl<T>::init(constants);
+		imu_measurement_model.init(constants.orientation_constants, &this->world_orientation);
+		optical_measurement_model.init(constants.orientation_constants, &this->world_orientation);
 	}
 
 	void init(
@@ -971,21 +1070,23 @@ public:
 		const Eigen::Vector3f &position,
 		const Eigen::Quaternionf &orientation) override
 	{
-        KalmanPoseFilterImpl::init(constants, position, orientation);
-		imu_measurement_model.init(constants.orientation_constants, &world_orientation);
-		optical_measurement_model.init(constants.orientation_constants, &world_orientation);
+        KalmanPoseFilterImpl<T>::init(constants, position, orientation);
+		imu_measurement_model.init(constants.orientation_constants, &this->world_orientation);
+		optical_measurement_model.init(constants.orientation_constants, &this->world_orientation);
 	}
 };
 
 //-- public interface --
 //-- KalmanPoseFilter --
-KalmanPoseFilter::KalmanPoseFilter()
+template <typename T>
+KalmanPoseFilterT<T>::KalmanPoseFilterT()
     : m_filter(nullptr)
 {
     memset(&m_constants, 0, sizeof(PoseFilterConstants));
 }
 
-KalmanPoseFilter::~KalmanPoseFilter()
+template <typename T>
+KalmanPoseFilterT<T>::~KalmanPoseFilterT()
 {
     if (m_filter != nullptr)
     {
@@ -994,7 +1095,8 @@ KalmanPoseFilter::~KalmanPoseFilter()
     }
 }
 
-bool KalmanPoseFilter::init(const PoseFilterConstants &constants)
+template <typename T>
+bool KalmanPoseFilterT<T>::init(const PoseFilterConstants &constants)
 {
     m_constants = constants;
 
@@ -1006,14 +1108,15 @@ bool KalmanPoseFilter::init(const PoseFilterConstants &constants)
     }
 
     // Create and initialize the private filter implementation
-    KalmanPoseFilterImpl *filter = new KalmanPoseFilterImpl();
+    KalmanPoseFilterImpl<T> *filter = new KalmanPoseFilterImpl<T>();
     filter->init(constants);
     m_filter = filter;
 
     return true;
 }
 
-bool KalmanPoseFilter::init(
+template <typename T>
+bool KalmanPoseFilterT<T>::init(
     const PoseFilterConstants &constants,
     const Eigen::Vector3f &position,
     const Eigen::Quaternionf &orientation)
@@ -1028,51 +1131,61 @@ bool KalmanPoseFilter::init(
     }
 
     // Create and initialize the private filter implementation
-    KalmanPoseFilterImpl *filter = new KalmanPoseFilterImpl();
+    KalmanPoseFilterImpl<T> *filter = new KalmanPoseFilterImpl<T>();
     filter->init(constants, position, orientation);
     m_filter = filter;
 
     return true;
 }
 
-bool KalmanPoseFilter::getIsStateValid() const
+template <typename T>
+bool KalmanPoseFilterT<T>::getIsStateValid() const
 {
     return m_filter->bIsValid;
 }
 
-bool KalmanPoseFilter::getIsPositionStateValid() const
+template <typename T>
+bool KalmanPoseFilterT<T>::getIsPositionStateValid() const
 {
 	return getIsStateValid();
 }
 
-bool KalmanPoseFilter::getIsOrientationStateValid() const
+template <typename T>
+bool KalmanPoseFilterT<T>::getIsOrientationStateValid() const
 {
 	return getIsStateValid();
 }
 
-double KalmanPoseFilter::getTimeInSeconds() const
+template <typename T>
+double KalmanPoseFilterT<T>::getTimeInSeconds() const
 {
     return m_filter->time;
 }
 
-void KalmanPoseFilter::resetState()
+template <typename T>
+void KalmanPoseFilterT<T>::resetState()
 {
     m_filter->init(m_constants);
 }
 
-void KalmanPoseFilter::recenterOrientation(const Eigen::Quaternionf& q_pose)
+template <typename T>
+void KalmanPoseFilterT<T>::recenterOrientation(const Eigen::Quaternionf& q_pose)
 {
-    m_filter->world_orientation = q_pose.cast<double>();
-    m_filter->ukf.init(PoseStateVectord::Identity());
+    m_filter->world_orientation = q_pose.template cast<T>();
+    m_filter->ukf.init(PoseStateVector<T>::Identity());
+
+    // The recorded states are relative to the old world orientation
+    m_filter->history.clear();
 }
 
-Eigen::Quaternionf KalmanPoseFilter::getOrientation(float time) const
+template <typename T>
+Eigen::Quaternionf KalmanPoseFilterT<T>::getOrientation(float time) const
 {
     Eigen::Quaternionf result = Eigen::Quaternionf::Identity();
 
     if (m_filter->bIsValid)
     {
-        const Eigen::Quaternionf state_orientation = m_filter->compute_net_world_quaternion().cast<float>();
+        const Eigen::Quaternionf state_orientation = m_filter->compute_net_world_quaternion().template cast<float>();
         Eigen::Quaternionf predicted_orientation = state_orientation;
 
         if (fabsf(time) > k_real_epsilon)
@@ -1091,26 +1204,29 @@ Eigen::Quaternionf KalmanPoseFilter::getOrientation(float time) const
     return result;
 }
 
-Eigen::Vector3f KalmanPoseFilter::getAngularVelocityRadPerSec() const
+template <typename T>
+Eigen::Vector3f KalmanPoseFilterT<T>::getAngularVelocityRadPerSec() const
 {
-	Eigen::Vector3d ang_vel = Eigen::Vector3d::Zero(); //m_filter->ukf.getState().get_angular_velocity_rad_per_sec();
+	PoseVector3<T> ang_vel = PoseVector3<T>::Zero(); //m_filter->ukf.getState().get_angular_velocity_rad_per_sec();
 
-    return ang_vel.cast<float>();
+    return ang_vel.template cast<float>();
 }
 
-Eigen::Vector3f KalmanPoseFilter::getAngularAccelerationRadPerSecSqr() const
+template <typename T>
+Eigen::Vector3f KalmanPoseFilterT<T>::getAngularAccelerationRadPerSecSqr() const
 {
     return Eigen::Vector3f::Zero();
 }
 
-Eigen::Vector3f KalmanPoseFilter::getPositionCm(float time) const
+template <typename T>
+Eigen::Vector3f KalmanPoseFilterT<T>::getPositionCm(float time) const
 {
     Eigen::Vector3f result = Eigen::Vector3f::Zero();
 
     if (m_filter->bIsValid)
     {
-        Eigen::Vector3f state_position_meters= m_filter->ukf.getState().get_position_meters().cast<float>();
-		Eigen::Vector3f state_velocity_m_per_sec = m_filter->ukf.getState().get_linear_velocity_m_per_sec().cast<float>();
+        Eigen::Vector3f state_position_meters= m_filter->ukf.getState().get_position_meters().template cast<float>();
+		Eigen::Vector3f state_velocity_m_per_sec = m_filter->ukf.getState().get_linear_velocity_m_per_sec().template cast<float>();
         Eigen::Vector3f predicted_position =
             is_nearly_zero(time)
             ? state_position_meters
@@ -1122,56 +1238,137 @@ Eigen::Vector3f KalmanPoseFilter::getPositionCm(float time) const
     return result;
 }
 
-Eigen::Vector3f KalmanPoseFilter::getVelocityCmPerSec() const
+template <typename T>
+Eigen::Vector3f KalmanPoseFilterT<T>::getVelocityCmPerSec() const
+{
+	PoseVector3<T> vel= m_filter->ukf.getState().get_linear_velocity_m_per_sec() * k_meters_to_centimeters;
+
+    return vel.template cast<float>();
+}
+
+template <typename T>
+Eigen::Vector3f KalmanPoseFilterT<T>::getAccelerationCmPerSecSqr() const
 {
-	Eigen::Vector3d vel= m_filter->ukf.getState().get_linear_velocity_m_per_sec() * k_meters_to_centimeters;
+    PoseVector3<T> accel= m_filter->ukf.getState().get_linear_acceleration_m_per_sec_sqr() * k_meters_to_centimeters;
 
-    return vel.cast<float>();
+	return accel.template cast<float>();
 }
 
-Eigen::Vector3f KalmanPoseFilter::getAccelerationCmPerSecSqr() const
+template <typename T>
+void KalmanPoseFilterT<T>::update(const float delta_time, const PoseFilterPacket &packet)
 {
-    Eigen::Vector3d accel= m_filter->ukf.getState().get_linear_acceleration_m_per_sec_sqr() * k_meters_to_centimeters;
+    const std::chrono::time_point<std::chrono::high_resolution_clock> k_no_timestamp;
+    const int history_size = m_filter->history.size();
+
+    // Count the already applied packets that were captured after this one.
+    // Only optical measurements show up late (they wait on the camera and the blob search),
+    // IMU packets always arrive in capture order.
+    int newer_count = 0;
+    if (packet.timestamp != k_no_timestamp &&
+        packet.has_optical_measurement() && !packet.has_imu_measurements())
+    {
+        while (newer_count < history_size &&
+               m_filter->history.getFromNewest(newer_count)->packet.timestamp > packet.timestamp)
+        {
+            ++newer_count;
+        }
+    }
+
+    if (newer_count == 0)
+    {
+        // In order
+        m_filter->push_history_entry(delta_time, packet);
+        updateFilter(delta_time, packet);
+    }
+    else if (newer_count >= history_size)
+    {
+        // Older than anything we can rewind to, fuse it as if it were current.
+        // Stamp the history copy with the newest time so the history stays sorted.
+        PoseFilterPacket clamped_packet = packet;
+        clamped_packet.timestamp = m_filter->history.getFromNewest(0)->packet.timestamp;
+
+        m_filter->push_history_entry(delta_time, clamped_packet);
+        updateFilter(delta_time, packet);
+    }
+    else
+    {
+        // Stash the packets we have to replay (oldest first) and drop them from the history
+        for (int replay_index = 0; replay_index < newer_count; ++replay_index)
+        {
+            const typename KalmanPoseFilterImpl<T>::HistoryEntry *entry =
+                m_filter->history.getFromNewest(newer_count - replay_index - 1);
 
-	return accel.cast<float>();
+            m_filter->replay_packets[replay_index] = entry->packet;
+            m_filter->replay_delta_times[replay_index] = entry->delta_time;
+        }
+
+        // Rewind to the state from just before the oldest packet captured after this one
+        m_filter->restore_history_entry(*m_filter->history.getFromNewest(newer_count - 1));
+        for (int pop_index = 0; pop_index < newer_count; ++pop_index)
+        {
+            m_filter->history.pop_back();
+        }
+
+        // Split the time step of that packet around the capture time of the late one
+        const std::chrono::duration<float> capture_gap =
+            m_filter->replay_packets[0].timestamp - packet.timestamp;
+        const float late_delta_time = fmaxf(m_filter->replay_delta_times[0] - capture_gap.count(), 0.f);
+        m_filter->replay_delta_times[0] = fminf(capture_gap.count(), m_filter->replay_delta_times[0]);
+
+        // Apply the late measurement at its capture time, then re-propagate everything after it
+        m_filter->push_history_entry(late_delta_time, packet);
+        updateFilter(late_delta_time, packet);
+
+        for (int replay_index = 0; replay_index < newer_count; ++replay_index)
+        {
+            const PoseFilterPacket &replay_packet = m_filter->replay_packets[replay_index];
+            const float replay_delta_time = m_filter->replay_delta_times[replay_index];
+
+            m_filter->push_history_entry(replay_delta_time, replay_packet);
+            updateFilter(replay_delta_time, replay_packet);
+        }
+    }
 }
 
 //-- KalmanPoseFilterPointCloud --
-bool KalmanPoseFilterPointCloud::init(const PoseFilterConstants &constants)
+template <typename T>
+bool KalmanPoseFilterPointCloudT<T>::init(const PoseFilterConstants &constants)
 {
-    KalmanPoseFilter::init(constants);
+    KalmanPoseFilterT<T>::init(constants);
 
-    PointCloudKalmanPoseFilterImpl *filter = new PointCloudKalmanPoseFilterImpl();
+    PointCloudKalmanPoseFilterImpl<T> *filter = new PointCloudKalmanPoseFilterImpl<T>();
     filter->init(constants);
-    m_filter = filter;
+    this->m_filter = filter;
 
     return true;
 }
 
-bool KalmanPoseFilterPointCloud::init(
+template <typename T>
+bool KalmanPoseFilterPointCloudT<T>::init(
     const PoseFilterConstants &constants,
     const Eigen::Vector3f &position,
     const Eigen::Quaternionf &orientation)
 {
-    KalmanPoseFilter::init(constants);
+    KalmanPoseFilterT<T>::init(constants);
 
-    PointCloudKalmanPoseFilterImpl *filter = new PointCloudKalmanPoseFilterImpl();
+    PointCloudKalmanPoseFilterImpl<T> *filter = new PointCloudKalmanPoseFilterImpl<T>();
     filter->init(constants, position, orientation);
-    m_filter = filter;
+    this->m_filter = filter;
 
     return true;
 }
 
-void KalmanPoseFilterPointCloud::update(const float delta_time, const PoseFilterPacket &packet)
+template <typename T>
+void KalmanPoseFilterPointCloudT<T>::updateFilter(const float delta_time, const PoseFilterPacket &packet)
 {
-    if (m_filter->bIsValid)
+    if (this->m_filter->bIsValid)
     {
-        PointCloudKalmanPoseFilterImpl *filter = static_cast<PointCloudKalmanPoseFilterImpl *>(m_filter);
-		PoseOrientationMeasurementModel &optical_measurement_model = filter->optical_measurement_model;
+        PointCloudKalmanPoseFilterImpl<T> *filter = static_cast<PointCloudKalmanPoseFilterImpl<T> *>(this->m_filter);
+		PoseOrientationMeasurementModel<T> &optical_measurement_model = filter->optical_measurement_model;
 
         // Adjust the amount we trust the process model based on the total tracking projection area
         filter->system_model.update_process_noise(
-			m_constants, 
+			this->m_constants, 
 			packet.tracking_projection_area_px_sqr);
 
         // Predict state for current time-step using the filters
@@ -1183,29 +1380,29 @@ void KalmanPoseFilterPointCloud::update(const float delta_time, const PoseFilter
 			assert(packet.tracking_projection_area_px_sqr > 0.f);
 
 			// If this is the first time we have seen the position, snap the position state
-			if (!m_filter->bSeenPositionMeasurement)
+			if (!this->m_filter->bSeenPositionMeasurement)
 			{
-				const Eigen::Vector3d optical_position_meters = packet.get_optical_position_in_meters().cast<double>();
+				const PoseVector3<T> optical_position_meters = packet.get_optical_position_in_meters().template cast<T>();
 
-				m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters);
-				m_filter->bSeenPositionMeasurement = true;
+				this->m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters);
+				this->m_filter->bSeenPositionMeasurement = true;
 			}
 
 			// If this is the first time we have seen the orientation, snap the orientation state
-			if (!m_filter->bSeenOrientationMeasurement)
+			if (!this->m_filter->bSeenOrientationMeasurement)
 			{
-				const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
+				const Eigen::Quaternion<T> world_quaternion = packet.optical_orientation.template cast<T>();
 
 				filter->set_world_quaternion(world_quaternion);
-				m_filter->bSeenOrientationMeasurement = true;
+				this->m_filter->bSeenOrientationMeasurement = true;
 			}
 		}
 
 		// Apply a physics update to the filter state
 		if (packet.has_imu_measurements())
 		{
-			PoseControlVectord control;
-			control.set_angular_rates(packet.imu_gyroscope_rad_per_sec.cast<double>());
+			PoseControlVector<T> control;
+			control.set_angular_rates(packet.imu_gyroscope_rad_per_sec.template cast<T>());
 
 			filter->ukf.predict(filter->system_model, control);
 		}
@@ -1218,7 +1415,7 @@ void KalmanPoseFilterPointCloud::update(const float delta_time, const PoseFilter
 		if (packet.has_optical_measurement())
 		{
 			assert(packet.tracking_projection_area_px_sqr > 0.f);
-			const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
+			const Eigen::Quaternion<T> world_quaternion = packet.optical_orientation.template cast<T>();
 
 			//TODO: Port over point area and shape point index
 			//for (int model_led_index = 0; model_led_index < packet.optical_tracking_shape_cm.shape.pointcloud.point_count; ++model_led_index)
@@ -1232,11 +1429,11 @@ void KalmanPoseFilterPointCloud::update(const float delta_time, const PoseFilter
 			//		const PSVRVector3f &p = packet.optical_tracking_shape_cm.shape.pointcloud.points[model_led_index];
 			//		
 			//		PoseLEDMeasurementModel *led_model= filter->led_measurement_models[model_led_index];
-			//		led_model->updateMeasurementCovariance(m_constants, led_screen_area);
+			//		led_model->updateMeasurementCovariance(this->m_constants, led_screen_area);
 
-			//		PoseLEDMeasurementVectord led_measurement = PoseLEDMeasurementVectord::Zero();
+			//		PoseLEDMeasurementVector<T> led_measurement = PoseLEDMeasurementVector<T>::Zero();
 			//		led_measurement.set_LED_position_meters(
-			//			Eigen::Vector3d(
+			//			PoseVector3<T>(
 			//				static_cast<double>(p.x * k_centimeters_to_meters), 
 			//				static_cast<double>(p.y * k_centimeters_to_meters),
 			//				static_cast<double>(p.z * k_centimeters_to_meters)));
@@ -1245,7 +1442,7 @@ void KalmanPoseFilterPointCloud::update(const float delta_time, const PoseFilter
 			//	}
 			//}
 
-			PoseOrientationMeasurementVectord measurement = PoseOrientationMeasurementVectord::Zero();
+			PoseOrientationMeasurementVector<T> measurement = PoseOrientationMeasurementVector<T>::Zero();
 			measurement.set_optical_quaterniond(world_quaternion);
 			filter->ukf.update(optical_measurement_model, measurement);
 		}
@@ -1258,49 +1455,52 @@ void KalmanPoseFilterPointCloud::update(const float delta_time, const PoseFilter
     }
     else
     {
-        m_filter->ukf.init(PoseStateVectord::Identity());
-        m_filter->time= 0.0;
-        m_filter->bIsValid = true;
+        this->m_filter->ukf.init(PoseStateVector<T>::Identity());
+        this->m_filter->time= 0.0;
+        this->m_filter->bIsValid = true;
     }
 }
 
 //-- KalmanPoseFilterMorpheus --
-bool KalmanPoseFilterMorpheus::init(const PoseFilterConstants &constants)
+template <typename T>
+bool KalmanPoseFilterMorpheusT<T>::init(const PoseFilterConstants &constants)
 {
-    KalmanPoseFilter::init(constants);
+    KalmanPoseFilterT<T>::init(constants);
 
-    MorpheusKalmanPoseFilterImpl *filter = new MorpheusKalmanPoseFilterImpl();
+    MorpheusKalmanPoseFilterImpl<T> *filter = new MorpheusKalmanPoseFilterImpl<T>();
     filter->init(constants);
-    m_filter = filter;
+    this->m_filter = filter;
 
     return true;
 }
 
-bool KalmanPoseFilterMorpheus::init(
+template <typename T>
+bool KalmanPoseFilterMorpheusT<T>::init(
     const PoseFilterConstants &constants,
     const Eigen::Vector3f &position,
     const Eigen::Quaternionf &orientation)
 {
-    KalmanPoseFilter::init(constants);
+    KalmanPoseFilterT<T>::init(constants);
 
-    MorpheusKalmanPoseFilterImpl *filter = new MorpheusKalmanPoseFilterImpl();
+    MorpheusKalmanPoseFilterImpl<T> *filter = new MorpheusKalmanPoseFilterImpl<T>();
     filter->init(constants, position, orientation);
-    m_filter = filter;
+    this->m_filter = filter;
 
     return true;
 }
 
-void KalmanPoseFilterMorpheus::update(const float delta_time, const PoseFilterPacket &packet)
+template <typename T>
+void KalmanPoseFilterMorpheusT<T>::updateFilter(const float delta_time, const PoseFilterPacket &packet)
 {
-	if (m_filter->bIsValid)
+	if (this->m_filter->bIsValid)
 	{
-		MorpheusKalmanPoseFilterImpl *filter = static_cast<MorpheusKalmanPoseFilterImpl *>(m_filter);
-		PoseOrientationMeasurementModel &optical_measurement_model = filter->optical_measurement_model;
-		PoseGravMeasurementModel &imu_measurement_model= filter->imu_measurement_model;
+		MorpheusKalmanPoseFilterImpl<T> *filter = static_cast<MorpheusKalmanPoseFilterImpl<T> *>(this->m_filter);
+		PoseOrientationMeasurementModel<T> &optical_measurement_model = filter->optical_measurement_model;
+		PoseGravMeasurementModel<T> &imu_measurement_model= filter->imu_measurement_model;
 
 		// Adjust the amount we trust the process model based on the tracking projection area
 		filter->system_model.update_process_noise(
-			m_constants,
+			this->m_constants,
 			packet.tracking_projection_area_px_sqr);
 
 		// Predict state for current time-step using the filters
@@ -1312,29 +1512,29 @@ void KalmanPoseFilterMorpheus::update(const float delta_time, const PoseFilterPa
 			assert(packet.tracking_projection_area_px_sqr > 0.f);
 
 			// If this is the first time we have seen the position, snap the position state
-			if (!m_filter->bSeenPositionMeasurement)
+			if (!this->m_filter->bSeenPositionMeasurement)
 			{
-				const Eigen::Vector3d optical_position_meters = packet.get_optical_position_in_meters().cast<double>();
+				const PoseVector3<T> optical_position_meters = packet.get_optical_position_in_meters().template cast<T>();
 
-				m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters);
-				m_filter->bSeenPositionMeasurement = true;
+				this->m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters);
+				this->m_filter->bSeenPositionMeasurement = true;
 			}
 
 			// If this is the first time we have seen the orientation, snap the orientation state
-			if (!m_filter->bSeenOrientationMeasurement)
+			if (!this->m_filter->bSeenOrientationMeasurement)
 			{
-				const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
+				const Eigen::Quaternion<T> world_quaternion = packet.optical_orientation.template cast<T>();
 
 				filter->set_world_quaternion(world_quaternion);
-				m_filter->bSeenOrientationMeasurement = true;
+				this->m_filter->bSeenOrientationMeasurement = true;
 			}
 		}
 
 		// Apply a physics update to the filter state
 		if (packet.has_imu_measurements())
 		{
-			PoseControlVectord control;
-			control.set_angular_rates(packet.imu_gyroscope_rad_per_sec.cast<double>());
+			PoseControlVector<T> control;
+			control.set_angular_rates(packet.imu_gyroscope_rad_per_sec.template cast<T>());
 
 			filter->ukf.predict(filter->system_model, control);
 		}
@@ -1347,7 +1547,7 @@ void KalmanPoseFilterMorpheus::update(const float delta_time, const PoseFilterPa
 		if (packet.has_optical_measurement())
 		{
 			assert(packet.tracking_projection_area_px_sqr > 0.f);
-			const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
+			const Eigen::Quaternion<T> world_quaternion = packet.optical_orientation.template cast<T>();
 
 			//TODO: Port over point area and shape point index
 			//for (int model_led_index = 0; model_led_index < packet.optical_tracking_shape_cm.shape.pointcloud.point_count; ++model_led_index)
@@ -1362,11 +1562,11 @@ void KalmanPoseFilterMorpheus::update(const float delta_time, const PoseFilterPa
 
 			//		// Update parameters on the LED model before applying the measurement
 			//		PoseLEDMeasurementModel *led_model = filter->led_measurement_models[model_led_index];
-			//		led_model->updateMeasurementCovariance(m_constants, led_screen_area);
+			//		led_model->updateMeasurementCovariance(this->m_constants, led_screen_area);
 
-			//		PoseLEDMeasurementVectord led_measurement = PoseLEDMeasurementVectord::Zero();
+			//		PoseLEDMeasurementVector<T> led_measurement = PoseLEDMeasurementVector<T>::Zero();
 			//		led_measurement.set_LED_position_meters(
-			//			Eigen::Vector3d(
+			//			PoseVector3<T>(
 			//				static_cast<double>(p.x * k_centimeters_to_meters),
 			//				static_cast<double>(p.y * k_centimeters_to_meters),
 			//				static_cast<double>(p.z * k_centimeters_to_meters)));
@@ -1375,7 +1575,7 @@ void KalmanPoseFilterMorpheus::update(const float delta_time, const PoseFilterPa
 			//	}
 			//}
 
-			PoseOrientationMeasurementVectord measurement = PoseOrientationMeasurementVectord::Zero();
+			PoseOrientationMeasurementVector<T> measurement = PoseOrientationMeasurementVector<T>::Zero();
 			measurement.set_optical_quaterniond(world_quaternion);
 			filter->ukf.update(optical_measurement_model, measurement);
 		}
@@ -1385,8 +1585,8 @@ void KalmanPoseFilterMorpheus::update(const float delta_time, const PoseFilterPa
 		{
 			assert(packet.has_accelerometer_measurement);
 
-			PoseGravMeasurementVectord measurement = PoseGravMeasurementVectord::Zero();
-			measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<double>());
+			PoseGravMeasurementVector<T> measurement = PoseGravMeasurementVector<T>::Zero();
+			measurement.set_accelerometer(packet.imu_accelerometer_g_units.template cast<T>());
 			filter->ukf.update(filter->imu_measurement_model, measurement);
 		}
 
@@ -1397,50 +1597,53 @@ void KalmanPoseFilterMorpheus::update(const float delta_time, const PoseFilterPa
 	}
 	else
 	{
-		m_filter->ukf.init(PoseStateVectord::Identity());
-		m_filter->time = 0.0;
-		m_filter->bIsValid = true;
+		this->m_filter->ukf.init(PoseStateVector<T>::Identity());
+		this->m_filter->time = 0.0;
+		this->m_filter->bIsValid = true;
 	}
 }
 
 //-- KalmanPoseFilterDS4 --
-bool KalmanPoseFilterDS4::init(
+template <typename T>
+bool KalmanPoseFilterDS4T<T>::init(
 	const PoseFilterConstants &constants)
 {
-	KalmanPoseFilter::init(constants);
+	KalmanPoseFilterT<T>::init(constants);
 
-	DS4KalmanPoseFilterImpl *filter = new DS4KalmanPoseFilterImpl();
+	DS4KalmanPoseFilterImpl<T> *filter = new DS4KalmanPoseFilterImpl<T>();
 	filter->init(constants);
-	m_filter = filter;
+	this->m_filter = filter;
 
 	return true;
 }
 
-bool KalmanPoseFilterDS4::init(
+template <typename T>
+bool KalmanPoseFilterDS4T<T>::init(
 	const PoseFilterConstants &constants,
 	const Eigen::Vector3f &position, 
 	const Eigen::Quaternionf &orientation)
 {
-    KalmanPoseFilter::init(constants, position, orientation);
+    KalmanPoseFilterT<T>::init(constants, position, orientation);
 
-    DS4KalmanPoseFilterImpl *filter = new DS4KalmanPoseFilterImpl();
+    DS4KalmanPoseFilterImpl<T> *filter = new DS4KalmanPoseFilterImpl<T>();
     filter->init(constants, position, orientation);
-    m_filter = filter;
+    this->m_filter = filter;
 
     return true;
 }
 
-void KalmanPoseFilterDS4::update(const float delta_time, const PoseFilterPacket &packet)
+template <typename T>
+void KalmanPoseFilterDS4T<T>::updateFilter(const float delta_time, const PoseFilterPacket &packet)
 {
-	if (m_filter->bIsValid)
+	if (this->m_filter->bIsValid)
 	{
-		DS4KalmanPoseFilterImpl *filter = static_cast<DS4KalmanPoseFilterImpl *>(m_filter);
-		PoseOrientationMeasurementModel &optical_measurement_model = filter->optical_measurement_model;
-		PoseGravMeasurementModel &imu_measurement_model= filter->imu_measurement_model;
+		DS4KalmanPoseFilterImpl<T> *filter = static_cast<DS4KalmanPoseFilterImpl<T> *>(this->m_filter);
+		PoseOrientationMeasurementModel<T> &optical_measurement_model = filter->optical_measurement_model;
+		PoseGravMeasurementModel<T> &imu_measurement_model= filter->imu_measurement_model;
 
 		// Adjust the amount we trust the process model based on the tracking projection area
 		filter->system_model.update_process_noise(
-			m_constants,
+			this->m_constants,
 			packet.tracking_projection_area_px_sqr);
 
 		// Predict state for current time-step using the filters
@@ -1452,29 +1655,29 @@ void KalmanPoseFilterDS4::update(const float delta_time, const PoseFilterPacket
 			assert(packet.tracking_projection_area_px_sqr > 0.f);
 
 			// If this is the first time we have seen the position, snap the position state
-			if (!m_filter->bSeenPositionMeasurement)
+			if (!this->m_filter->bSeenPositionMeasurement)
 			{
-				const Eigen::Vector3d optical_position_meters = packet.get_optical_position_in_meters().cast<double>();
+				const PoseVector3<T> optical_position_meters = packet.get_optical_position_in_meters().template cast<T>();
 
-				m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters);
-				m_filter->bSeenPositionMeasurement = true;
+				this->m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters);
+				this->m_filter->bSeenPositionMeasurement = true;
 			}
 
 			// If this is the first time we have seen the orientation, snap the orientation state
-			if (!m_filter->bSeenOrientationMeasurement)
+			if (!this->m_filter->bSeenOrientationMeasurement)
 			{
-				const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
+				const Eigen::Quaternion<T> world_quaternion = packet.optical_orientation.template cast<T>();
 
 				filter->set_world_quaternion(world_quaternion);
-				m_filter->bSeenOrientationMeasurement = true;
+				this->m_filter->bSeenOrientationMeasurement = true;
 			}
 		}
 
 		// Apply a physics update to the filter state
 		if (packet.has_imu_measurements())
 		{
-			PoseControlVectord control;
-			control.set_angular_rates(packet.imu_gyroscope_rad_per_sec.cast<double>());
+			PoseControlVector<T> control;
+			control.set_angular_rates(packet.imu_gyroscope_rad_per_sec.template cast<T>());
 
 			filter->ukf.predict(filter->system_model, control);
 		}
@@ -1487,8 +1690,8 @@ void KalmanPoseFilterDS4::update(const float delta_time, const PoseFilterPacket
 		if (packet.has_optical_measurement())
 		{
 			assert(packet.tracking_projection_area_px_sqr > 0.f);
-			const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
-			PoseOrientationMeasurementVectord measurement = PoseOrientationMeasurementVectord::Zero();
+			const Eigen::Quaternion<T> world_quaternion = packet.optical_orientation.template cast<T>();
+			PoseOrientationMeasurementVector<T> measurement = PoseOrientationMeasurementVector<T>::Zero();
 			measurement.set_optical_quaterniond(world_quaternion);
 			filter->ukf.update(optical_measurement_model, measurement);
 		}
@@ -1498,8 +1701,8 @@ void KalmanPoseFilterDS4::update(const float delta_time, const PoseFilterPacket
 		{
 			assert(packet.has_accelerometer_measurement);
 
-			PoseGravMeasurementVectord measurement = PoseGravMeasurementVectord::Zero();
-			measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<double>());
+			PoseGravMeasurementVector<T> measurement = PoseGravMeasurementVector<T>::Zero();
+			measurement.set_accelerometer(packet.imu_accelerometer_g_units.template cast<T>());
 			filter->ukf.update(filter->imu_measurement_model, measurement);
 		}
 
@@ -1510,50 +1713,53 @@ void KalmanPoseFilterDS4::update(const float delta_time, const PoseFilterPacket
 	}
 	else
 	{
-		m_filter->ukf.init(PoseStateVectord::Identity());
-		m_filter->time = 0.0;
-		m_filter->bIsValid = true;
+		this->m_filter->ukf.init(PoseStateVector<T>::Identity());
+		this->m_filter->time = 0.0;
+		this->m_filter->bIsValid = true;
 	}
 }
 
 //-- PSMovePoseKalmanFilter --
-bool KalmanPoseFilterPSMove::init(
+template <typename T>
+bool KalmanPoseFilterPSMoveT<T>::init(
 	const PoseFilterConstants &constants)
 {
-	KalmanPoseFilter::init(constants);
+	KalmanPoseFilterT<T>::init(constants);
 
-	PSMoveKalmanPoseFilterImpl *filter = new PSMoveKalmanPoseFilterImpl();
+	PSMoveKalmanPoseFilterImpl<T> *filter = new PSMoveKalmanPoseFilterImpl<T>();
 	filter->init(constants);
-	m_filter = filter;
+	this->m_filter = filter;
 
 	return true;
 }
 
-bool KalmanPoseFilterPSMove::init(
+template <typename T>
+bool KalmanPoseFilterPSMoveT<T>::init(
 	const PoseFilterConstants &constants,
 	const Eigen::Vector3f &position,
 	const Eigen::Quaternionf &orientation)
 {
-    KalmanPoseFilter::init(constants, position, orientation);
+    KalmanPoseFilterT<T>::init(constants, position, orientation);
 
-    PSMoveKalmanPoseFilterImpl *filter = new PSMoveKalmanPoseFilterImpl();
+    PSMoveKalmanPoseFilterImpl<T> *filter = new PSMoveKalmanPoseFilterImpl<T>();
     filter->init(constants, position, orientation);
-    m_filter = filter;
+    this->m_filter = filter;
 
     return true;
 }
 
-void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPacket &packet)
+template <typename T>
+void KalmanPoseFilterPSMoveT<T>::updateFilter(const float delta_time, const PoseFilterPacket &packet)
 {
-	if (m_filter->bIsValid)
+	if (this->m_filter->bIsValid)
 	{
-		PSMoveKalmanPoseFilterImpl *filter = static_cast<PSMoveKalmanPoseFilterImpl *>(m_filter);
-		PoseOrientationMeasurementModel &optical_measurement_model = filter->optical_measurement_model;
-		PoseMagGravMeasurementModel &imu_measurement_model= filter->imu_measurement_model;
+		PSMoveKalmanPoseFilterImpl<T> *filter = static_cast<PSMoveKalmanPoseFilterImpl<T> *>(this->m_filter);
+		PoseOrientationMeasurementModel<T> &optical_measurement_model = filter->optical_measurement_model;
+		PoseMagGravMeasurementModel<T> &imu_measurement_model= filter->imu_measurement_model;
 
 		// Adjust the amount we trust the process model based on the tracking projection area
 		filter->system_model.update_process_noise(
-			m_constants,
+			this->m_constants,
 			packet.tracking_projection_area_px_sqr);
 
 		// Predict state for current time-step using the filters
@@ -1565,29 +1771,29 @@ void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPack
 			assert(packet.tracking_projection_area_px_sqr > 0.f);
 
 			// If this is the first time we have seen the position, snap the position state
-			if (!m_filter->bSeenPositionMeasurement)
+			if (!this->m_filter->bSeenPositionMeasurement)
 			{
-				const Eigen::Vector3d optical_position_meters = packet.get_optical_position_in_meters().cast<double>();
+				const PoseVector3<T> optical_position_meters = packet.get_optical_position_in_meters().template cast<T>();
 
-				m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters);
-				m_filter->bSeenPositionMeasurement = true;
+				this->m_filter->ukf.getStateMutable().set_position_meters(optical_position_meters);
+				this->m_filter->bSeenPositionMeasurement = true;
 			}
 
 			// If this is the first time we have seen the orientation, snap the orientation state
-			if (!m_filter->bSeenOrientationMeasurement)
+			if (!this->m_filter->bSeenOrientationMeasurement)
 			{
-				const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
+				const Eigen::Quaternion<T> world_quaternion = packet.optical_orientation.template cast<T>();
 
 				filter->set_world_quaternion(world_quaternion);
-				m_filter->bSeenOrientationMeasurement = true;
+				this->m_filter->bSeenOrientationMeasurement = true;
 			}
 		}
 
 		// Apply a physics update to the filter state
 		if (packet.has_imu_measurements())
 		{
-			PoseControlVectord control;
-			control.set_angular_rates(packet.imu_gyroscope_rad_per_sec.cast<double>());
+			PoseControlVector<T> control;
+			control.set_angular_rates(packet.imu_gyroscope_rad_per_sec.template cast<T>());
 
 			filter->ukf.predict(filter->system_model, control);
 		}
@@ -1600,8 +1806,8 @@ void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPack
 		if (packet.has_optical_measurement())
 		{
 			assert(packet.tracking_projection_area_px_sqr > 0.f);
-			const Eigen::Quaterniond world_quaternion = packet.optical_orientation.cast<double>();
-			PoseOrientationMeasurementVectord measurement = PoseOrientationMeasurementVectord::Zero();
+			const Eigen::Quaternion<T> world_quaternion = packet.optical_orientation.template cast<T>();
+			PoseOrientationMeasurementVector<T> measurement = PoseOrientationMeasurementVector<T>::Zero();
 			measurement.set_optical_quaterniond(world_quaternion);
 			filter->ukf.update(optical_measurement_model, measurement);
 		}
@@ -1611,9 +1817,9 @@ void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPack
 		{
 			assert(packet.has_accelerometer_measurement);
 
-			PoseMagGravMeasurementVectord measurement = PoseMagGravMeasurementVectord::Zero();
-			measurement.set_accelerometer(packet.imu_accelerometer_g_units.cast<double>());
-			measurement.set_magnetometer(packet.imu_magnetometer_unit.cast<double>());
+			PoseMagGravMeasurementVector<T> measurement = PoseMagGravMeasurementVector<T>::Zero();
+			measurement.set_accelerometer(packet.imu_accelerometer_g_units.template cast<T>());
+			measurement.set_magnetometer(packet.imu_magnetometer_unit.template cast<T>());
 			filter->ukf.update(filter->imu_measurement_model, measurement);
 		}
 
@@ -1624,12 +1830,25 @@ void KalmanPoseFilterPSMove::update(const float delta_time, const PoseFilterPack
 	}
 	else
 	{
-		m_filter->ukf.init(PoseStateVectord::Identity());
-		m_filter->time = 0.0;
-		m_filter->bIsValid = true;
+		this->m_filter->ukf.init(PoseStateVector<T>::Identity());
+		this->m_filter->time = 0.0;
+		this->m_filter->bIsValid = true;
 	}
 }
 
+//-- explicit instantiations --
+template class KalmanPoseFilterT<double>;
+template class KalmanPoseFilterPointCloudT<double>;
+template class KalmanPoseFilterMorpheusT<double>;
+template class KalmanPoseFilterDS4T<double>;
+template class KalmanPoseFilterPSMoveT<double>;
+
+template class KalmanPoseFilterT<float>;
+template class KalmanPoseFilterPointCloudT<float>;
+template class KalmanPoseFilterMorpheusT<float>;
+template class KalmanPoseFilterDS4T<float>;
+template class KalmanPoseFilterPSMoveT<float>;
+
 //-- Private functions --
 // Sets the Q matrix entry with 1st order Discrete Constant White Noise
 // - dT is the time step
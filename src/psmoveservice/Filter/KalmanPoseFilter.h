@@ -3,12 +3,20 @@
 
 #include "PoseFilterInterface.h"
 
+template <typename T> class KalmanPoseFilterImpl;
+
 /// Base Kalman Pose filter
-class KalmanPoseFilter : public IPoseFilter
+/**
+ T is the scalar type the filter state is stored and updated in.
+ Only the double and float instantiations exist (see the typedefs at the bottom).
+ The float filters are cheaper per update, which matters for the 1kHz IMU devices.
+ */
+template <typename T>
+class KalmanPoseFilterT : public IPoseFilter
 {
 public:
-	KalmanPoseFilter();
-	virtual ~KalmanPoseFilter();
+	KalmanPoseFilterT();
+	virtual ~KalmanPoseFilterT();
 
     virtual bool init(const PoseFilterConstants &constant);
 	virtual bool init(const PoseFilterConstants &constant, 
@@ -17,6 +25,8 @@ public:
 
 	// -- IStateFilter --
 	bool getIsStateValid() const override;
+	/// Applies the packet, rewinding and re-propagating the filter first if it is a late optical packet
+	void update(const float delta_time, const PoseFilterPacket &packet) override;
     double getTimeInSeconds() const override;
 	void resetState() override;
 	void recenterOrientation(const Eigen::Quaternionf& q_pose) override;
@@ -47,48 +57,75 @@ public:
     Eigen::Vector3f getAccelerationCmPerSecSqr() const override;
 
 protected:
+	/// Steps the filter state with one packet, in capture order
+	virtual void updateFilter(const float delta_time, const PoseFilterPacket &packet) = 0;
+
 	PoseFilterConstants m_constants;
-	class KalmanPoseFilterImpl *m_filter;
+	KalmanPoseFilterImpl<T> *m_filter;
 };
 
 /// Kalman Pose filter for Optical Point Cloud
-class KalmanPoseFilterPointCloud : public KalmanPoseFilter
+template <typename T>
+class KalmanPoseFilterPointCloudT : public KalmanPoseFilterT<T>
 {
 public:
 	bool init(const PoseFilterConstants &constant) override;
 	bool init(const PoseFilterConstants &constant, 
               const Eigen::Vector3f &initial_position,
               const Eigen::Quaternionf &initial_orientation) override;
-	void update(const float delta_time, const PoseFilterPacket &packet) override;
+
+protected:
+	void updateFilter(const float delta_time, const PoseFilterPacket &packet) override;
 };
 
 /// Kalman Pose filter for Optical Point Cloud + Angular Rate(Gyroscope) + Gravity(Accelerometer)
-class KalmanPoseFilterMorpheus : public KalmanPoseFilter
+template <typename T>
+class KalmanPoseFilterMorpheusT : public KalmanPoseFilterT<T>
 {
 public:
 	bool init(const PoseFilterConstants &constant) override;
 	bool init(const PoseFilterConstants &constant, 
               const Eigen::Vector3f &initial_position,
               const Eigen::Quaternionf &initial_orientation) override;
-	void update(const float delta_time, const PoseFilterPacket &packet) override;
+
+protected:
+	void updateFilter(const float delta_time, const PoseFilterPacket &packet) override;
 };
 
 /// Kalman Pose filter for Optical Pose + Angular Rate(Gyroscope) + Gravity(Accelerometer)
-class KalmanPoseFilterDS4 : public KalmanPoseFilter
+template <typename T>
+class KalmanPoseFilterDS4T : public KalmanPoseFilterT<T>
 {
 public:
 	bool init(const PoseFilterConstants &constant) override;
 	bool init(const PoseFilterConstants &constant, const Eigen::Vector3f &position, const Eigen::Quaternionf &orientation) override;
-	void update(const float delta_time, const PoseFilterPacket &packet) override;
+
+protected:
+	void updateFilter(const float delta_time, const PoseFilterPacket &packet) override;
 };
 
 /// Kalman Pose filter for Optical Position + Magnetometer + Angular Rate(Gyroscope) + Gravity(Accelerometer)
-class KalmanPoseFilterPSMove : public KalmanPoseFilter
+template <typename T>
+class KalmanPoseFilterPSMoveT : public KalmanPoseFilterT<T>
 {
 public:
 	bool init(const PoseFilterConstants &constant) override;
 	bool init(const PoseFilterConstants &constant, const Eigen::Vector3f &position, const Eigen::Quaternionf &orientation) override;
-	void update(const float delta_time, const PoseFilterPacket &packet) override;
+
+protected:
+	void updateFilter(const float delta_time, const PoseFilterPacket &packet) override;
 };
 
+typedef KalmanPoseFilterT<double> KalmanPoseFilter;
+typedef KalmanPoseFilterPointCloudT<double> KalmanPoseFilterPointCloud;
+typedef KalmanPoseFilterMorpheusT<double> KalmanPoseFilterMorpheus;
+typedef KalmanPoseFilterDS4T<double> KalmanPoseFilterDS4;
+typedef KalmanPoseFilterPSMoveT<double> KalmanPoseFilterPSMove;
+
+typedef KalmanPoseFilterT<float> KalmanPoseFilterf;
+typedef KalmanPoseFilterPointCloudT<float> KalmanPoseFilterPointCloudf;
+typedef KalmanPoseFilterMorpheusT<float> KalmanPoseFilterMorpheusf;
+typedef KalmanPoseFilterDS4T<float> KalmanPoseFilterDS4f;
+typedef KalmanPoseFilterPSMoveT<float> KalmanPoseFilterPSMovef;
+
 #endif // KALMAN_POSE_FILTER_H
\ No newline at end of file
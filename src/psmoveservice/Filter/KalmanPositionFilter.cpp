@@ -251,8 +251,8 @@ class PositionMeasurementModel : public Kalman::MeasurementModel<PositionStateVe
 public:
     void init(const PositionFilterConstants &constants)
     {
-		m_last_tracking_projection_area_px_sqr = -1.f;
-		update_measurement_covariance(constants, 0.f);
+		m_last_position_variance_cm_sqr = -1.f;
+		update_measurement_covariance(constants, constants.position_variance_curve.evaluate(0.f));
         
 		m_identity_gravity_direction= constants.gravity_calibration_direction.cast<double>();
     }
@@ -264,14 +264,14 @@ public:
 
 	void update_measurement_covariance(
 		const PositionFilterConstants &constants,
-		const float tracking_projection_area_px_sqr)
+		const float optical_position_variance_cm_sqr)
 	{
-		// Only update the covariance when there is more than a 10px change in position quality
-		if (m_last_tracking_projection_area_px_sqr < 0.f ||
-			!is_nearly_equal(tracking_projection_area_px_sqr, m_last_tracking_projection_area_px_sqr, 10.f))
+		// Only update the covariance when the position quality changed by more than 1%
+		if (m_last_position_variance_cm_sqr < 0.f ||
+			!is_nearly_equal(optical_position_variance_cm_sqr, m_last_position_variance_cm_sqr, 0.01f*m_last_position_variance_cm_sqr))
 		{
 			const Eigen::Vector3f &accelerometer_variance = constants.accelerometer_variance;
-			const double position_variance_cm_sqr = static_cast<double>(constants.position_variance_curve.evaluate(tracking_projection_area_px_sqr));
+			const double position_variance_cm_sqr = static_cast<double>(optical_position_variance_cm_sqr);
 			// variance_meters = variance_cm * (0.01)^2 because ...
 			// var(k*x) = sum(k*x_i - k*mu)^2/(N-1) = k^2*sum(x_i - mu)^2/(N-1)
 			// where k = k_centimeters_to_meters = 0.01
@@ -291,7 +291,7 @@ public:
 			setCovariance(R);
 
 			// Keep track last position quality we built the covariance matrix for
-			m_last_tracking_projection_area_px_sqr = tracking_projection_area_px_sqr;
+			m_last_position_variance_cm_sqr = optical_position_variance_cm_sqr;
 		}
 	}
 
@@ -331,7 +331,7 @@ public:
 protected:
     Eigen::Vector3d m_identity_gravity_direction;
 	Eigen::Quaterniond m_current_orientation;
-	float m_last_tracking_projection_area_px_sqr;
+	float m_last_position_variance_cm_sqr;
 };
 
 class KalmanPositionFilterImpl
@@ -510,10 +510,10 @@ void KalmanPositionFilter::update(const float delta_time, const PoseFilterPacket
 		// Accelerometer and gyroscope measurements are always available
 		measurement.set_accelerometer_g_units(accelerometer);
 
-		// Adjust the amount we trust the optical measurements based on the tracking projection area
+		// Adjust the amount we trust the optical measurements based on the quality of the projection
 		measurement_model.update_measurement_covariance(
 			m_constants,
-			packet.tracking_projection_area_px_sqr);
+			packet.get_optical_position_variance_cm_sqr(m_constants.position_variance_curve));
 
         if (packet.tracking_projection_area_px_sqr > 0.f)
         {
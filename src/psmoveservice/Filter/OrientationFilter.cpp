@@ -61,7 +61,7 @@ struct OrientationFilterState
         }
         else
         {
-            SERVER_LOG_WARNING("OrientationFilter") << "Orientation is NaN!";
+            SERVER_MT_LOG_WARNING("OrientationFilter") << "Orientation is NaN!";
         }
 
         if (eigen_vector3f_is_valid(new_angular_velocity))
@@ -70,7 +70,7 @@ struct OrientationFilterState
         }
         else
         {
-            SERVER_LOG_WARNING("OrientationFilter") << "Angular Velocity is NaN!";
+            SERVER_MT_LOG_WARNING("OrientationFilter") << "Angular Velocity is NaN!";
         }
 
         if (eigen_vector3f_is_valid(new_angular_acceleration))
@@ -79,7 +79,7 @@ struct OrientationFilterState
         }
         else
         {
-            SERVER_LOG_WARNING("OrientationFilter") << "Angular Acceleration is NaN!";
+            SERVER_MT_LOG_WARNING("OrientationFilter") << "Angular Acceleration is NaN!";
         }
 
 		if (is_valid_float(delta_time))
@@ -89,7 +89,7 @@ struct OrientationFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "time delta is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "time delta is NaN!";
 		}
 
         // state is valid now that we have had an update
@@ -106,7 +106,7 @@ struct OrientationFilterState
         }
         else
         {
-            SERVER_LOG_WARNING("OrientationFilter") << "Orientation is NaN!";
+            SERVER_MT_LOG_WARNING("OrientationFilter") << "Orientation is NaN!";
         }
 
 		if (is_valid_float(delta_time))
@@ -116,7 +116,7 @@ struct OrientationFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "time delta is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "time delta is NaN!";
 		}
 
         // state is valid now that we have had an update
@@ -131,7 +131,7 @@ struct OrientationFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "optical time delta is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "optical time delta is NaN!";
 		}
 	}
 
@@ -143,12 +143,232 @@ struct OrientationFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "imu time delta is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "imu time delta is NaN!";
 		}
 	}
 };
 
+// -- private methods -----
+// Adds J(q; d)*f(q; d, s) for one field to the gradient, where f(q; d, s)= (q^-1 * d * q) - s.
+// Same objective as eigen_alignment_compute_objective_vector/jacobian, expanded on scalars.
+static inline void madgwick_accumulate_field_gradient(
+	const float qw, const float qx, const float qy, const float qz,
+	const float dx, const float dy, const float dz,
+	const float sx, const float sy, const float sz,
+	const float weight,
+	float gradient[4])
+{
+	// Clockwise rotate d by q (transpose of q's rotation matrix)
+	const float fx = (1.f - 2.f*(qy*qy + qz*qz))*dx + 2.f*(qx*qy + qw*qz)*dy + 2.f*(qx*qz - qw*qy)*dz - sx;
+	const float fy = 2.f*(qx*qy - qw*qz)*dx + (1.f - 2.f*(qx*qx + qz*qz))*dy + 2.f*(qy*qz + qw*qx)*dz - sy;
+	const float fz = 2.f*(qx*qz + qw*qy)*dx + 2.f*(qy*qz - qw*qx)*dy + (1.f - 2.f*(qx*qx + qy*qy))*dz - sz;
+
+	const float two_dxq1 = 2.f*dx*qw, two_dxq2 = 2.f*dx*qx, two_dxq3 = 2.f*dx*qy, two_dxq4 = 2.f*dx*qz;
+	const float two_dyq1 = 2.f*dy*qw, two_dyq2 = 2.f*dy*qx, two_dyq3 = 2.f*dy*qy, two_dyq4 = 2.f*dy*qz;
+	const float two_dzq1 = 2.f*dz*qw, two_dzq2 = 2.f*dz*qx, two_dzq3 = 2.f*dz*qy, two_dzq4 = 2.f*dz*qz;
+
+	gradient[0] += weight*(
+		(two_dyq4 - two_dzq3)*fx +
+		(-two_dxq4 + two_dzq2)*fy +
+		(two_dxq3 - two_dyq2)*fz);
+	gradient[1] += weight*(
+		(two_dyq3 + two_dzq4)*fx +
+		(two_dxq3 - 2.f*two_dyq2 + two_dzq1)*fy +
+		(two_dxq4 - two_dyq1 - 2.f*two_dzq2)*fz);
+	gradient[2] += weight*(
+		(-2.f*two_dxq3 + two_dyq2 - two_dzq1)*fx +
+		(two_dxq2 + two_dzq4)*fy +
+		(two_dxq1 + two_dyq4 - 2.f*two_dzq3)*fz);
+	gradient[3] += weight*(
+		(-2.f*two_dxq4 + two_dyq1 + two_dzq2)*fx +
+		(-two_dxq1 - 2.f*two_dyq4 + two_dzq3)*fy +
+		(two_dxq2 + two_dyq3)*fz);
+}
+
+// One Madgwick step per lane, fused into a single pass over scalars: gyro integration (Eqn 12, 42),
+// the normalized gradient descent correction (Eqn 34, 43) and, with t_use_magnetometer,
+// the gyro bias estimate (Eqn 47-49) of the MARG variant.
+// Samples without a usable gravity (or magnetic field) vector fall back to the update
+// the filters always did for them, but through weights instead of branches:
+// no gravity only integrates the gyro, no magnetic field is the plain ARG update.
+// Branch free, so the lane loop vectorizes across the devices of a batch.
+template <bool t_use_magnetometer>
+static void madgwick_fused_update(OrientationFilterBatchLanes &lanes)
+{
+	const int lane_count = lanes.lane_count;
+
+	for (int lane = 0; lane < lane_count; ++lane)
+	{
+		const float qw = lanes.q_w[lane], qx = lanes.q_x[lane], qy = lanes.q_y[lane], qz = lanes.q_z[lane];
+		const float delta_time = lanes.step_time[lane];
+
+		// Normalize the field vectors, zero length ones get no weight.
+		// Zero length divisors get padded rather than the divisions skipped, a conditional division keeps the loop scalar.
+		const float ax = lanes.accelerometer_x[lane], ay = lanes.accelerometer_y[lane], az = lanes.accelerometer_z[lane];
+		const float g_length = sqrtf(ax*ax + ay*ay + az*az);
+		const float g_weight = (g_length > k_normal_epsilon) ? 1.f : 0.f;
+		const float g_scale = g_weight / (g_length + (1.f - g_weight)*k_normal_epsilon);
+		const float gx = ax*g_scale, gy = ay*g_scale, gz = az*g_scale;
+
+		float m_weight = 0.f;
+		float mx = 0.f, my = 0.f, mz = 0.f;
+		if (t_use_magnetometer)
+		{
+			const float rx = lanes.magnetometer_x[lane], ry = lanes.magnetometer_y[lane], rz = lanes.magnetometer_z[lane];
+			const float m_length = sqrtf(rx*rx + ry*ry + rz*rz);
+			const float m_valid = (m_length > k_normal_epsilon) ? 1.f : 0.f;
+			const float m_scale = m_valid / (m_length + (1.f - m_valid)*k_normal_epsilon);
+
+			m_weight = m_valid*g_weight;
+			mx = rx*m_scale; my = ry*m_scale; mz = rz*m_scale;
+		}
+
+		// Eqn 34) gradient_F= J_gb(SEq, Eb)*f(SEq, Sa, Eb, Sm), normalized
+		float gradient[4] = { 0.f, 0.f, 0.f, 0.f };
+		madgwick_accumulate_field_gradient(
+			qw, qx, qy, qz,
+			lanes.gravity_direction_x[lane], lanes.gravity_direction_y[lane], lanes.gravity_direction_z[lane],
+			gx, gy, gz, g_weight, gradient);
+		if (t_use_magnetometer)
+		{
+			madgwick_accumulate_field_gradient(
+				qw, qx, qy, qz,
+				lanes.magnetometer_direction_x[lane], lanes.magnetometer_direction_y[lane], lanes.magnetometer_direction_z[lane],
+				mx, my, mz, m_weight, gradient);
+		}
+
+		const float gradient_length =
+			sqrtf(gradient[0]*gradient[0] + gradient[1]*gradient[1] + gradient[2]*gradient[2] + gradient[3]*gradient[3]);
+		const float gradient_valid = (gradient_length > k_real_epsilon) ? 1.f : 0.f;
+		const float gradient_scale = gradient_valid / (gradient_length + (1.f - gradient_valid)*k_real_epsilon);
+		const float hw = gradient[0]*gradient_scale, hx = gradient[1]*gradient_scale;
+		const float hy = gradient[2]*gradient_scale, hz = gradient[3]*gradient_scale;
+
+		const float beta = lanes.beta[lane];
+
+		// Eqn 49) omega_corrected = omega - net_omega_bias, the bias only applies to full MARG samples
+		float cw = 0.f, cx = lanes.gyroscope_x[lane], cy = lanes.gyroscope_y[lane], cz = lanes.gyroscope_z[lane];
+		if (t_use_magnetometer)
+		{
+			// Eqn 47, 48) net_omega_bias+= zeta*(2*SEq*SEqHatDot)*delta_t
+			const float zeta_dt = m_weight*beta*delta_time;
+			const float ew = 2.f*(qw*hw - qx*hx - qy*hy - qz*hz);
+			const float ex = 2.f*(qw*hx + qx*hw + qy*hz - qz*hy);
+			const float ey = 2.f*(qw*hy - qx*hz + qy*hw + qz*hx);
+			const float ez = 2.f*(qw*hz + qx*hy - qy*hx + qz*hw);
+			const float bias_x = lanes.omega_bias_x[lane] + ex*zeta_dt;
+			const float bias_y = lanes.omega_bias_y[lane] + ey*zeta_dt;
+			const float bias_z = lanes.omega_bias_z[lane] + ez*zeta_dt;
+
+			lanes.omega_bias_x[lane] = bias_x;
+			lanes.omega_bias_y[lane] = bias_y;
+			lanes.omega_bias_z[lane] = bias_z;
+
+			// The bias quaternion's w term only lives for this step
+			cw = -ew*zeta_dt;
+			cx -= m_weight*bias_x;
+			cy -= m_weight*bias_y;
+			cz -= m_weight*bias_z;
+		}
+
+		// Eqn 12) q_dot = 0.5*q*omega
+		// Eqn 43) SEq_est = SEqDot_omega - beta*SEqHatDot
+		const float correction = g_weight*beta;
+		const float dw = 0.5f*(qw*cw - qx*cx - qy*cy - qz*cz) - correction*hw;
+		const float dx = 0.5f*(qw*cx + qx*cw + qy*cz - qz*cy) - correction*hx;
+		const float dy = 0.5f*(qw*cy - qx*cz + qy*cw + qz*cx) - correction*hy;
+		const float dz = 0.5f*(qw*cz + qx*cy - qy*cx + qz*cw) - correction*hz;
+
+		// Eqn 42) SEq_new = SEq + SEqDot_est*delta_t, kept a pure rotation
+		const float nw = qw + dw*delta_time, nx = qx + dx*delta_time;
+		const float ny = qy + dy*delta_time, nz = qz + dz*delta_time;
+		const float n_scale = 1.f / sqrtf(nw*nw + nx*nx + ny*ny + nz*nz);
+
+		lanes.q_w[lane] = nw*n_scale;
+		lanes.q_x[lane] = nx*n_scale;
+		lanes.q_y[lane] = ny*n_scale;
+		lanes.q_z[lane] = nz*n_scale;
+	}
+}
+
+// Gyro only integration step of each lane: q_new= normalize(q + 0.5*q*omega*dT)
+static void angular_rate_update(OrientationFilterBatchLanes &lanes)
+{
+	const int lane_count = lanes.lane_count;
+
+	for (int lane = 0; lane < lane_count; ++lane)
+	{
+		const float qw = lanes.q_w[lane], qx = lanes.q_x[lane], qy = lanes.q_y[lane], qz = lanes.q_z[lane];
+		const float ox = lanes.gyroscope_x[lane], oy = lanes.gyroscope_y[lane], oz = lanes.gyroscope_z[lane];
+		const float half_dt = 0.5f*lanes.step_time[lane];
+
+		// q_dot = 0.5*q*omega
+		const float nw = qw + (-qx*ox - qy*oy - qz*oz)*half_dt;
+		const float nx = qx + (qw*ox + qy*oz - qz*oy)*half_dt;
+		const float ny = qy + (qw*oy - qx*oz + qz*ox)*half_dt;
+		const float nz = qz + (qw*oz + qx*oy - qy*ox)*half_dt;
+		const float n_squared = nw*nw + nx*nx + ny*ny + nz*nz;
+		// A zero step stays zero whatever the scale, so only the divisor needs the guard
+		const float n_scale = 1.f / sqrtf(n_squared + ((n_squared > 0.f) ? 0.f : FLT_MIN));
+
+		lanes.q_w[lane] = nw*n_scale;
+		lanes.q_x[lane] = nx*n_scale;
+		lanes.q_y[lane] = ny*n_scale;
+		lanes.q_z[lane] = nz*n_scale;
+	}
+}
+
+// Fills in the lane inputs every kernel shares
+static int add_orientation_filter_lane(
+	const OrientationFilterConstants &constants,
+	const Eigen::Quaternionf &orientation,
+	const PoseFilterPacket &packet,
+	const float step_time,
+	const float delta_time,
+	OrientationFilterBatchLanes &lanes)
+{
+	const int lane = lanes.add_lane();
+
+	lanes.q_w[lane] = orientation.w();
+	lanes.q_x[lane] = orientation.x();
+	lanes.q_y[lane] = orientation.y();
+	lanes.q_z[lane] = orientation.z();
+	lanes.gyroscope_x[lane] = packet.imu_gyroscope_rad_per_sec.x();
+	lanes.gyroscope_y[lane] = packet.imu_gyroscope_rad_per_sec.y();
+	lanes.gyroscope_z[lane] = packet.imu_gyroscope_rad_per_sec.z();
+	lanes.accelerometer_x[lane] = packet.imu_accelerometer_g_units.x();
+	lanes.accelerometer_y[lane] = packet.imu_accelerometer_g_units.y();
+	lanes.accelerometer_z[lane] = packet.imu_accelerometer_g_units.z();
+	lanes.gravity_direction_x[lane] = constants.gravity_calibration_direction.x();
+	lanes.gravity_direction_y[lane] = constants.gravity_calibration_direction.y();
+	lanes.gravity_direction_z[lane] = constants.gravity_calibration_direction.z();
+	lanes.beta[lane] =
+		sqrtf(3.0f / 4.0f) * fmaxf(fmaxf(constants.gyro_variance.x(), constants.gyro_variance.y()), constants.gyro_variance.z());
+	lanes.step_time[lane] = step_time;
+	lanes.delta_time[lane] = delta_time;
+
+	return lane;
+}
+
 // -- public interface -----
+void orientation_filter_batch_run_kernel(const OrientationFilterBatchKernel kernel, OrientationFilterBatchLanes &lanes)
+{
+	switch (kernel)
+	{
+	case OrientationFilterBatchKernel_MadgwickARG:
+		madgwick_fused_update<false>(lanes);
+		break;
+	case OrientationFilterBatchKernel_MadgwickMARG:
+		madgwick_fused_update<true>(lanes);
+		break;
+	case OrientationFilterBatchKernel_AngularRate:
+		angular_rate_update(lanes);
+		break;
+	default:
+		assert(0 && "unreachable");
+	}
+}
+
 //-- Orientation Filter --
 OrientationFilter::OrientationFilter() :
     m_state(new OrientationFilterState)
@@ -237,6 +457,19 @@ Eigen::Vector3f OrientationFilter::getAngularAccelerationRadPerSecSqr() const
     return m_state->bIsValid ? m_state->angular_acceleration : Eigen::Vector3f::Zero();
 }
 
+void OrientationFilter::updateSingleLane(const float delta_time, const PoseFilterPacket &packet)
+{
+	OrientationFilterBatchLanes lanes;
+	lanes.clear();
+
+	const int lane= beginBatchUpdate(delta_time, packet, lanes);
+	if (lane >= 0)
+	{
+		orientation_filter_batch_run_kernel(getBatchKernel(), lanes);
+		endBatchUpdate(packet, lanes, lane);
+	}
+}
+
 // -- OrientationFilterPassThru --
 void OrientationFilterPassThru::update(const float delta_time, const PoseFilterPacket &packet)
 {
@@ -258,86 +491,54 @@ void OrientationFilterPassThru::update(const float delta_time, const PoseFilterP
 // https://www.samba.org/tridge/UAV/madgwick_internal_report.pdf
 void OrientationFilterMadgwickARG::update(const float delta_time, const PoseFilterPacket &packet)
 {
+	updateSingleLane(delta_time, packet);
+}
+
+OrientationFilterBatchKernel OrientationFilterMadgwickARG::getBatchKernel() const
+{
+	return OrientationFilterBatchKernel_MadgwickARG;
+}
+
+int OrientationFilterMadgwickARG::beginBatchUpdate(
+	const float delta_time,
+	const PoseFilterPacket &packet,
+	OrientationFilterBatchLanes &lanes)
+{
+	int lane = -1;
+
 	if (packet.has_imu_measurements())
 	{
 		// Time delta used for filter update is time delta passed in
 		// plus the accumulated time since the packet hasn't has an IMU measurement
 		const float total_delta_time= (float)m_state->accumulated_imu_time_delta + delta_time;
 
-		const Eigen::Vector3f &current_omega= packet.imu_gyroscope_rad_per_sec;
-
-		Eigen::Vector3f current_g= packet.imu_accelerometer_g_units;
-		eigen_vector3f_normalize_with_default(current_g, Eigen::Vector3f::Zero());
-
 		// Current orientation from earth frame to sensor frame
-		const Eigen::Quaternionf SEq = m_state->orientation;
-		Eigen::Quaternionf SEq_new = SEq;
-
-		// Compute the quaternion derivative measured by gyroscopes
-		// Eqn 12) q_dot = 0.5*q*omega
-		Eigen::Quaternionf omega = Eigen::Quaternionf(0.f, current_omega.x(), current_omega.y(), current_omega.z());
-		Eigen::Quaternionf SEqDot_omega = Eigen::Quaternionf(SEq.coeffs() * 0.5f) *omega;
-
-		if (!current_g.isApprox(Eigen::Vector3f::Zero(), k_normal_epsilon))
-		{
-			// Get the direction of the gravitational fields in the identity pose		
-			Eigen::Vector3f k_identity_g_direction = m_constants.gravity_calibration_direction;
-
-			// Eqn 15) Applied to the gravity vector
-			// Fill in the 3x1 objective function matrix f(SEq, Sa) =|f_g|
-			Eigen::Matrix<float, 3, 1> f_g;
-			eigen_alignment_compute_objective_vector(SEq, k_identity_g_direction, current_g, f_g, NULL);
-
-			// Eqn 21) Applied to the gravity vector
-			// Fill in the 4x3 objective function Jacobian matrix: J_gb(SEq)= [J_g]
-			Eigen::Matrix<float, 4, 3> J_g;
-			eigen_alignment_compute_objective_jacobian(SEq, k_identity_g_direction, J_g);
-
-			// Eqn 34) gradient_F= J_g(SEq)*f(SEq, Sa)
-			// Compute the gradient of the objective function
-			Eigen::Matrix<float, 4, 1> gradient_f = J_g * f_g;
-			Eigen::Quaternionf SEqHatDot =
-				Eigen::Quaternionf(gradient_f(0, 0), gradient_f(1, 0), gradient_f(2, 0), gradient_f(3, 0));
-
-			// normalize the gradient
-			eigen_quaternion_normalize_with_default(SEqHatDot, *k_eigen_quaternion_zero);
-
-			// Compute the estimated quaternion rate of change
-			// Eqn 43) SEq_est = SEqDot_omega - beta*SEqHatDot
-			const float beta= sqrtf(3.0f / 4.0f) * fmaxf(fmaxf(m_constants.gyro_variance.x(), m_constants.gyro_variance.y()), m_constants.gyro_variance.z());
-			Eigen::Quaternionf SEqDot_est = Eigen::Quaternionf(SEqDot_omega.coeffs() - SEqHatDot.coeffs()*beta);
-
-			// Compute then integrate the estimated quaternion rate
-			// Eqn 42) SEq_new = SEq + SEqDot_est*total_delta_time
-			SEq_new = Eigen::Quaternionf(SEq.coeffs() + SEqDot_est.coeffs()*total_delta_time);
-		}
-		else
-		{
-			SEq_new = Eigen::Quaternionf(SEq.coeffs() + SEqDot_omega.coeffs()*total_delta_time);
-		}
-
-		// Make sure the net quaternion is a pure rotation quaternion
-		SEq_new.normalize();
-
-		// Save the new quaternion and first derivative back into the orientation state
-		// Derive the second derivative
-		{
-			const Eigen::Quaternionf &new_orientation = SEq_new;
-			const Eigen::Vector3f new_angular_velocity= Eigen::Vector3f::Zero(); // current_omega;
-			const Eigen::Vector3f new_angular_acceleration= Eigen::Vector3f::Zero(); // (current_omega - m_state->angular_velocity) / delta_time;
-
-			m_state->apply_imu_state(new_orientation, new_angular_velocity, new_angular_acceleration, delta_time);
-		}
+		lane = add_orientation_filter_lane(m_constants, m_state->orientation, packet, total_delta_time, delta_time, lanes);
 	}
 	else
 	{
 		m_state->accumulate_imu_delta_time(delta_time);
 	}
+
+	return lane;
+}
+
+void OrientationFilterMadgwickARG::endBatchUpdate(
+	const PoseFilterPacket &/*packet*/,
+	const OrientationFilterBatchLanes &lanes,
+	const int lane)
+{
+	// Save the new quaternion back into the orientation state
+	const Eigen::Quaternionf new_orientation(lanes.q_w[lane], lanes.q_x[lane], lanes.q_y[lane], lanes.q_z[lane]);
+	const Eigen::Vector3f new_angular_velocity= Eigen::Vector3f::Zero(); // current_omega;
+	const Eigen::Vector3f new_angular_acceleration= Eigen::Vector3f::Zero(); // (current_omega - m_state->angular_velocity) / delta_time;
+
+	m_state->apply_imu_state(new_orientation, new_angular_velocity, new_angular_acceleration, lanes.delta_time[lane]);
 }
 
 // -- OrientationFilterMadgwickMARG --
 // This algorithm comes from Sebastian O.H. Madgwick's 2010 paper:
-// "An efficient orientation filter for inertial and inertial/magnetic sensor arrays"
+// "An efficient orientation filter for inertial and inertial/magnetic sensor arrays"
 // https://www.samba.org/tridge/UAV/madgwick_internal_report.pdf
 void OrientationFilterMadgwickMARG::resetState()
 {
@@ -347,125 +548,62 @@ void OrientationFilterMadgwickMARG::resetState()
 
 void OrientationFilterMadgwickMARG::update(const float delta_time, const PoseFilterPacket &packet)
 {
-	if (packet.has_imu_measurements())
-	{
-		// Time delta used for filter update is time delta passed in
-		// plus the accumulated time since the packet hasn't has an IMU measurement
-		const float total_delta_time= (float)m_state->accumulated_imu_time_delta + delta_time;
-
-		const Eigen::Vector3f &current_omega= packet.imu_gyroscope_rad_per_sec;
-
-		Eigen::Vector3f current_g= packet.imu_accelerometer_g_units;
-		eigen_vector3f_normalize_with_default(current_g, Eigen::Vector3f::Zero());
-
-		Eigen::Vector3f current_m= packet.imu_magnetometer_unit;
-		eigen_vector3f_normalize_with_default(current_m, Eigen::Vector3f::Zero());
-
-		// If there isn't a valid magnetometer or accelerometer vector, fall back to the IMU style update
-		if (current_g.isZero(k_normal_epsilon) || current_m.isZero(k_normal_epsilon))
-		{
-			OrientationFilterMadgwickARG::update(delta_time, packet);
-			return;
-		}
+	updateSingleLane(delta_time, packet);
+}
 
-		// Current orientation from earth frame to sensor frame
-		const Eigen::Quaternionf SEq = m_state->orientation;
-
-		// Get the direction of the magnetic fields in the identity pose.	
-		// NOTE: In the original paper we converge on this vector over time automatically (See Eqn 45 & 46)
-		// but since we've already done the work in calibration to get this vector, let's just use it.
-		// This also removes the last assumption in this function about what 
-		// the orientation of the identity-pose is (handled by the sensor transform).
-		Eigen::Vector3f k_identity_m_direction = m_constants.magnetometer_calibration_direction;
-
-		// Get the direction of the gravitational fields in the identity pose
-		Eigen::Vector3f k_identity_g_direction = m_constants.gravity_calibration_direction;
-
-		// Eqn 15) Applied to the gravity and magnetometer vectors
-		// Fill in the 6x1 objective function matrix f(SEq, Sa, Eb, Sm) =|f_g|
-		//                                                               |f_b|
-		Eigen::Matrix<float, 3, 1> f_g;
-		eigen_alignment_compute_objective_vector(SEq, k_identity_g_direction, current_g, f_g, NULL);
-
-		Eigen::Matrix<float, 3, 1> f_m;
-		eigen_alignment_compute_objective_vector(SEq, k_identity_m_direction, current_m, f_m, NULL);
-
-		Eigen::Matrix<float, 6, 1> f_gb;
-		f_gb.block<3, 1>(0, 0) = f_g;
-		f_gb.block<3, 1>(3, 0) = f_m;
-
-		// Eqn 21) Applied to the gravity and magnetometer vectors
-		// Fill in the 4x6 objective function Jacobian matrix: J_gb(SEq, Eb)= [J_g|J_b]
-		Eigen::Matrix<float, 4, 3> J_g;
-		eigen_alignment_compute_objective_jacobian(SEq, k_identity_g_direction, J_g);
-
-		Eigen::Matrix<float, 4, 3> J_m;
-		eigen_alignment_compute_objective_jacobian(SEq, k_identity_m_direction, J_m);
-
-		Eigen::Matrix<float, 4, 6> J_gb;
-		J_gb.block<4, 3>(0, 0) = J_g; J_gb.block<4, 3>(0, 3) = J_m;
-
-		// Eqn 34) gradient_F= J_gb(SEq, Eb)*f(SEq, Sa, Eb, Sm)
-		// Compute the gradient of the objective function
-		Eigen::Matrix<float, 4, 1> gradient_f = J_gb*f_gb;
-		Eigen::Quaternionf SEqHatDot =
-			Eigen::Quaternionf(gradient_f(0, 0), gradient_f(1, 0), gradient_f(2, 0), gradient_f(3, 0));
-
-		// normalize the gradient to estimate direction of the gyroscope error
-		eigen_quaternion_normalize_with_default(SEqHatDot, *k_eigen_quaternion_zero);
-
-		// Eqn 47) omega_err= 2*SEq*SEqHatDot
-		// compute angular estimated direction of the gyroscope error
-		Eigen::Quaternionf omega_err = Eigen::Quaternionf(SEq.coeffs()*2.f) * SEqHatDot;
-
-		// Eqn 48) net_omega_bias+= zeta*omega_err
-		// Compute the net accumulated gyroscope bias
-		const float zeta= sqrtf(3.0f / 4.0f) * fmaxf(fmaxf(m_constants.gyro_variance.x(), m_constants.gyro_variance.y()), m_constants.gyro_variance.z());
-		Eigen::Quaternionf omega_bias(0.f, m_omega_bias_x, m_omega_bias_y, m_omega_bias_z);
-		omega_bias = Eigen::Quaternionf(omega_bias.coeffs() + omega_err.coeffs()*zeta*total_delta_time);
-		m_omega_bias_x= omega_bias.x();
-		m_omega_bias_y= omega_bias.y();
-		m_omega_bias_z= omega_bias.z();
-
-		// Eqn 49) omega_corrected = omega - net_omega_bias
-		Eigen::Quaternionf omega = Eigen::Quaternionf(0.f, current_omega.x(), current_omega.y(), current_omega.z());
-		Eigen::Quaternionf corrected_omega = Eigen::Quaternionf(omega.coeffs() - omega_bias.coeffs());
-
-		// Compute the rate of change of the orientation purely from the gyroscope
-		// Eqn 12) q_dot = 0.5*q*omega
-		Eigen::Quaternionf SEqDot_omega = Eigen::Quaternionf(SEq.coeffs() * 0.5f) * corrected_omega;
+OrientationFilterBatchKernel OrientationFilterMadgwickMARG::getBatchKernel() const
+{
+	return OrientationFilterBatchKernel_MadgwickMARG;
+}
 
-		// Compute the estimated quaternion rate of change
-		// Eqn 43) SEq_est = SEqDot_omega - beta*SEqHatDot
-		const float beta= sqrtf(3.0f / 4.0f) * fmaxf(fmaxf(m_constants.gyro_variance.x(), m_constants.gyro_variance.y()), m_constants.gyro_variance.z());
-		Eigen::Quaternionf SEqDot_est = Eigen::Quaternionf(SEqDot_omega.coeffs() - SEqHatDot.coeffs()*beta);
+int OrientationFilterMadgwickMARG::beginBatchUpdate(
+	const float delta_time,
+	const PoseFilterPacket &packet,
+	OrientationFilterBatchLanes &lanes)
+{
+	const int lane = OrientationFilterMadgwickARG::beginBatchUpdate(delta_time, packet, lanes);
 
-		// Compute then integrate the estimated quaternion rate
-		// Eqn 42) SEq_new = SEq + SEqDot_est*delta_t
-		Eigen::Quaternionf SEq_new = Eigen::Quaternionf(SEq.coeffs() + SEqDot_est.coeffs()*total_delta_time);
+	if (lane >= 0)
+	{
+		// NOTE: In the original paper we converge on the magnetic field direction over time (See Eqn 45 & 46)
+		// but since we've already done the work in calibration to get this vector, the kernel just uses it.
+		lanes.magnetometer_x[lane] = packet.imu_magnetometer_unit.x();
+		lanes.magnetometer_y[lane] = packet.imu_magnetometer_unit.y();
+		lanes.magnetometer_z[lane] = packet.imu_magnetometer_unit.z();
+		lanes.magnetometer_direction_x[lane] = m_constants.magnetometer_calibration_direction.x();
+		lanes.magnetometer_direction_y[lane] = m_constants.magnetometer_calibration_direction.y();
+		lanes.magnetometer_direction_z[lane] = m_constants.magnetometer_calibration_direction.z();
+		lanes.omega_bias_x[lane] = m_omega_bias_x;
+		lanes.omega_bias_y[lane] = m_omega_bias_y;
+		lanes.omega_bias_z[lane] = m_omega_bias_z;
+	}
 
-		// Make sure the net quaternion is a pure rotation quaternion
-		SEq_new.normalize();
+	return lane;
+}
 
-		// Save the new quaternion and first derivative back into the orientation state
-		// Derive the second derivative
-		{
-			const Eigen::Quaternionf &new_orientation = SEq_new;
-			const Eigen::Vector3f new_angular_velocity = Eigen::Vector3f::Zero(); //(corrected_omega.x(), corrected_omega.y(), corrected_omega.z());
-			const Eigen::Vector3f new_angular_acceleration = Eigen::Vector3f::Zero(); //(new_angular_velocity - m_state->angular_velocity) / delta_time;
+void OrientationFilterMadgwickMARG::endBatchUpdate(
+	const PoseFilterPacket &packet,
+	const OrientationFilterBatchLanes &lanes,
+	const int lane)
+{
+	m_omega_bias_x= lanes.omega_bias_x[lane];
+	m_omega_bias_y= lanes.omega_bias_y[lane];
+	m_omega_bias_z= lanes.omega_bias_z[lane];
 
-			m_state->apply_imu_state(new_orientation, new_angular_velocity, new_angular_acceleration, delta_time);
-		}
-	}
-	else
-	{
-		m_state->accumulate_imu_delta_time(delta_time);
-	}
+	OrientationFilterMadgwickARG::endBatchUpdate(packet, lanes, lane);
 }
 
 // -- OrientationFilterComplementaryOpticalARG --
 #define COMPLEMENTARY_FILTER_YAW_ONLY_BLEND 0
 void OrientationFilterComplementaryOpticalARG::update(const float delta_time, const PoseFilterPacket &packet)
+{
+	updateSingleLane(delta_time, packet);
+}
+
+int OrientationFilterComplementaryOpticalARG::beginBatchUpdate(
+	const float delta_time,
+	const PoseFilterPacket &packet,
+	OrientationFilterBatchLanes &lanes)
 {
 	// Blend with optical yaw
 	if (packet.has_optical_measurement())
@@ -510,7 +648,7 @@ void OrientationFilterComplementaryOpticalARG::update(const float delta_time, co
 
 					// Use the positional variance as the quality measure
 					const float optical_variance= 
-						m_constants.position_variance_curve.evaluate(packet.tracking_projection_area_px_sqr);
+						packet.get_optical_position_variance_cm_sqr(m_constants.position_variance_curve);
 					const float fraction_of_max_orientation_variance =
 						safe_divide_with_default(
 							optical_variance,
@@ -586,7 +724,8 @@ void OrientationFilterComplementaryOpticalARG::update(const float delta_time, co
 		m_state->accumulate_optical_delta_time(delta_time);
 	}
 
-    OrientationFilterMadgwickARG::update(delta_time, packet);
+    // The IMU step is the Madgwick ARG kernel step
+    return OrientationFilterMadgwickARG::beginBatchUpdate(delta_time, packet, lanes);
 }
 
 // -- OrientationFilterComplementaryMARG --
@@ -598,75 +737,91 @@ void OrientationFilterComplementaryMARG::resetState()
 
 void OrientationFilterComplementaryMARG::update(const float delta_time, const PoseFilterPacket &packet)
 {
+	updateSingleLane(delta_time, packet);
+}
+
+OrientationFilterBatchKernel OrientationFilterComplementaryMARG::getBatchKernel() const
+{
+	return OrientationFilterBatchKernel_AngularRate;
+}
+
+int OrientationFilterComplementaryMARG::beginBatchUpdate(
+	const float delta_time,
+	const PoseFilterPacket &packet,
+	OrientationFilterBatchLanes &lanes)
+{
+	int lane = -1;
+
 	if (packet.has_imu_measurements())
 	{
 		// Time delta used for filter update is time delta passed in
 		// plus the accumulated time since the packet hasn't has an IMU measurement
 		const float total_delta_time= (float)m_state->accumulated_imu_time_delta + delta_time;
 
-		const Eigen::Vector3f &current_omega= packet.imu_gyroscope_rad_per_sec;
-
-		Eigen::Vector3f current_g= packet.imu_accelerometer_g_units;
-		eigen_vector3f_normalize_with_default(current_g, Eigen::Vector3f::Zero());
-
-		Eigen::Vector3f current_m= packet.imu_magnetometer_unit;
-		eigen_vector3f_normalize_with_default(current_m, Eigen::Vector3f::Zero());
-
-		// Get the direction of the magnetic fields in the identity pose.	
-		Eigen::Vector3f k_identity_m_direction = m_constants.magnetometer_calibration_direction;
-
-		// Get the direction of the gravitational fields in the identity pose
-		Eigen::Vector3f k_identity_g_direction = m_constants.gravity_calibration_direction;
-
 		// Angular Rotation (AR) Update
 		//-----------------------------
-		// Compute the rate of change of the orientation purely from the gyroscope
+		// The kernel integrates the rate of change of the orientation purely from the gyroscope
 		// q_dot = 0.5*q*omega
-		Eigen::Quaternionf q_current= m_state->orientation;
-
-		Eigen::Quaternionf q_omega = Eigen::Quaternionf(0.f, current_omega.x(), current_omega.y(), current_omega.z());
-		Eigen::Quaternionf q_derivative = Eigen::Quaternionf(q_current.coeffs()*0.5f) * q_omega;
-
-		// Integrate the rate of change to get a new orientation
 		// q_new= q + q_dot*dT
-		Eigen::Quaternionf q_step = Eigen::Quaternionf(q_derivative.coeffs() * total_delta_time);
-		Eigen::Quaternionf ar_orientation = Eigen::Quaternionf(q_current.coeffs() + q_step.coeffs());
-
-		// Make sure the resulting quaternion is normalized
-		ar_orientation.normalize();
-
-		// Magnetic/Gravity (MG) Update
-		//-----------------------------
-		const Eigen::Vector3f* mg_from[2] = { &k_identity_g_direction, &k_identity_m_direction };
-		const Eigen::Vector3f* mg_to[2] = { &current_g, &current_m };
-		Eigen::Quaternionf mg_orientation;
-
-		// Always attempt to align with the identity_mg, even if we don't get within the alignment tolerance.
-		// More often then not we'll be better off moving forward with what we have and trying to refine
-		// the alignment next frame.
-		eigen_alignment_quaternion_between_vector_frames(
-			mg_from, mg_to, 0.1f, q_current, mg_orientation);
-
-		// Blending Update
-		//----------------
-		// Save the new quaternion and first derivative back into the orientation state
-		// Derive the second derivative
-		{
-			// The final rotation is a blend between the integrated orientation and absolute rotation from the earth-frame
-			const Eigen::Quaternionf new_orientation = 
-				eigen_quaternion_normalized_lerp(ar_orientation, mg_orientation, mg_weight);            
-			const Eigen::Vector3f new_angular_velocity= Eigen::Vector3f::Zero(); // current_omega;
-			const Eigen::Vector3f new_angular_acceleration = Eigen::Vector3f::Zero(); // (current_omega - m_state->angular_velocity) / delta_time;
-
-			m_state->apply_imu_state(new_orientation, new_angular_velocity, new_angular_acceleration, delta_time);
-		}
-
-		// Update the blend weight
-		// -- Exponential blend the MG weight from 1 down to k_base_earth_frame_align_weight
-		mg_weight = lerp_clampf(mg_weight, k_base_earth_frame_align_weight, 0.9f);
+		lane = add_orientation_filter_lane(m_constants, m_state->orientation, packet, total_delta_time, delta_time, lanes);
 	}
 	else
 	{
 		m_state->accumulate_imu_delta_time(delta_time);
 	}
+
+	return lane;
+}
+
+void OrientationFilterComplementaryMARG::endBatchUpdate(
+	const PoseFilterPacket &packet,
+	const OrientationFilterBatchLanes &lanes,
+	const int lane)
+{
+	// The normalized integrated orientation
+	const Eigen::Quaternionf ar_orientation(lanes.q_w[lane], lanes.q_x[lane], lanes.q_y[lane], lanes.q_z[lane]);
+
+	Eigen::Vector3f current_g= packet.imu_accelerometer_g_units;
+	eigen_vector3f_normalize_with_default(current_g, Eigen::Vector3f::Zero());
+
+	Eigen::Vector3f current_m= packet.imu_magnetometer_unit;
+	eigen_vector3f_normalize_with_default(current_m, Eigen::Vector3f::Zero());
+
+	// Get the direction of the magnetic fields in the identity pose.	
+	Eigen::Vector3f k_identity_m_direction = m_constants.magnetometer_calibration_direction;
+
+	// Get the direction of the gravitational fields in the identity pose
+	Eigen::Vector3f k_identity_g_direction = m_constants.gravity_calibration_direction;
+
+	// Magnetic/Gravity (MG) Update
+	//-----------------------------
+	// An iterative per device solve, so it stays out of the kernel
+	const Eigen::Quaternionf q_current= m_state->orientation;
+	const Eigen::Vector3f* mg_from[2] = { &k_identity_g_direction, &k_identity_m_direction };
+	const Eigen::Vector3f* mg_to[2] = { &current_g, &current_m };
+	Eigen::Quaternionf mg_orientation;
+
+	// Always attempt to align with the identity_mg, even if we don't get within the alignment tolerance.
+	// More often then not we'll be better off moving forward with what we have and trying to refine
+	// the alignment next frame.
+	eigen_alignment_quaternion_between_vector_frames(
+		mg_from, mg_to, 0.1f, q_current, mg_orientation);
+
+	// Blending Update
+	//----------------
+	// Save the new quaternion and first derivative back into the orientation state
+	// Derive the second derivative
+	{
+		// The final rotation is a blend between the integrated orientation and absolute rotation from the earth-frame
+		const Eigen::Quaternionf new_orientation =
+			eigen_quaternion_normalized_lerp(ar_orientation, mg_orientation, mg_weight);
+		const Eigen::Vector3f new_angular_velocity= Eigen::Vector3f::Zero(); // current_omega;
+		const Eigen::Vector3f new_angular_acceleration = Eigen::Vector3f::Zero(); // (current_omega - m_state->angular_velocity) / delta_time;
+
+		m_state->apply_imu_state(new_orientation, new_angular_velocity, new_angular_acceleration, lanes.delta_time[lane]);
+	}
+
+	// Update the blend weight
+	// -- Exponential blend the MG weight from 1 down to k_base_earth_frame_align_weight
+	mg_weight = lerp_clampf(mg_weight, k_base_earth_frame_align_weight, 0.9f);
 }
\ No newline at end of file
@@ -4,6 +4,10 @@
 //-- includes -----
 #include "PoseFilterInterface.h"
 
+//-- interface --
+/// Runs one step of the given kernel over every lane
+void orientation_filter_batch_run_kernel(const OrientationFilterBatchKernel kernel, OrientationFilterBatchLanes &lanes);
+
 //-- definitions --
 /// Abstract base class for all orientation only filters
 class OrientationFilter : public IOrientationFilter
@@ -26,6 +30,9 @@ public:
     Eigen::Vector3f getAngularAccelerationRadPerSecSqr() const override;
 
 protected:
+    // update() for filters with a batch kernel: a batched update of a single lane
+    void updateSingleLane(const float delta_time, const PoseFilterPacket &packet);
+
     OrientationFilterConstants m_constants;
     struct OrientationFilterState *m_state;
 };
@@ -42,6 +49,10 @@ class OrientationFilterMadgwickARG : public OrientationFilter
 {
 public:
     void update(const float delta_time, const PoseFilterPacket &packet) override;
+
+    OrientationFilterBatchKernel getBatchKernel() const override;
+    int beginBatchUpdate(const float delta_time, const PoseFilterPacket &packet, OrientationFilterBatchLanes &lanes) override;
+    void endBatchUpdate(const PoseFilterPacket &packet, const OrientationFilterBatchLanes &lanes, const int lane) override;
 };
 
 /// Magnetic, Angular Rate, and Gravity fusion algorithm from Madgwick
@@ -58,6 +69,10 @@ public:
     void resetState() override;
     void update(const float delta_time, const PoseFilterPacket &packet) override;
 
+    OrientationFilterBatchKernel getBatchKernel() const override;
+    int beginBatchUpdate(const float delta_time, const PoseFilterPacket &packet, OrientationFilterBatchLanes &lanes) override;
+    void endBatchUpdate(const PoseFilterPacket &packet, const OrientationFilterBatchLanes &lanes, const int lane) override;
+
 protected:
     float m_omega_bias_x;
     float m_omega_bias_y;
@@ -70,6 +85,8 @@ class OrientationFilterComplementaryOpticalARG : public OrientationFilterMadgwic
 {
 public:
     void update(const float delta_time, const PoseFilterPacket &packet) override;
+
+    int beginBatchUpdate(const float delta_time, const PoseFilterPacket &packet, OrientationFilterBatchLanes &lanes) override;
 };
 
 /// Magnetic, Angular Rate, Gravity and fusion algorithm (hybrid Madgwick)
@@ -85,6 +102,10 @@ public:
     void resetState() override;
     void update(const float delta_time, const PoseFilterPacket &packet) override;
 
+    OrientationFilterBatchKernel getBatchKernel() const override;
+    int beginBatchUpdate(const float delta_time, const PoseFilterPacket &packet, OrientationFilterBatchLanes &lanes) override;
+    void endBatchUpdate(const PoseFilterPacket &packet, const OrientationFilterBatchLanes &lanes, const int lane) override;
+
 protected:
     float mg_weight;
 };
@@ -0,0 +1,106 @@
+// -- includes --
+#include "PoseFilterBatch.h"
+#include "OrientationFilter.h"
+
+#include <algorithm>
+
+// -- public interface --
+PoseFilterBatch::PoseFilterBatch()
+    : m_filter_count(0)
+{
+	for (int kernel_index = 0; kernel_index < OrientationFilterBatchKernel_COUNT; ++kernel_index)
+	{
+		m_kernel_lanes[kernel_index].clear();
+	}
+}
+
+void PoseFilterBatch::clear()
+{
+	m_filter_count= 0;
+}
+
+bool PoseFilterBatch::addFilter(
+	IPoseFilter *filter,
+	const PoseFilterSpace *filterSpace,
+	const PoseSensorPacket *sensorPackets,
+	const float *deltaTimes,
+	const int packetCount)
+{
+	const OrientationFilterBatchKernel kernel= filter->getBatchKernel();
+
+	if (kernel == OrientationFilterBatchKernel_None || m_filter_count >= k_orientation_filter_batch_max_lanes)
+	{
+		return false;
+	}
+
+	BatchedFilter &entry= m_filters[m_filter_count];
+	entry.filter= filter;
+	entry.filter_space= filterSpace;
+	entry.sensor_packets= sensorPackets;
+	entry.delta_times= deltaTimes;
+	entry.packet_count= packetCount;
+	entry.kernel= kernel;
+	entry.lane= -1;
+	++m_filter_count;
+
+	return true;
+}
+
+void PoseFilterBatch::update()
+{
+	int max_packet_count= 0;
+	for (int filter_index = 0; filter_index < m_filter_count; ++filter_index)
+	{
+		max_packet_count= std::max(max_packet_count, m_filters[filter_index].packet_count);
+	}
+
+	// The devices step in lock-step, packet_index'th packet of each device per pass.
+	// A device that runs out of packets just sits out the rest of the passes.
+	for (int packet_index = 0; packet_index < max_packet_count; ++packet_index)
+	{
+		for (int kernel_index = 0; kernel_index < OrientationFilterBatchKernel_COUNT; ++kernel_index)
+		{
+			m_kernel_lanes[kernel_index].clear();
+		}
+
+		// Each filter packet gets moved into filter space against the state the device's previous packet left behind
+		for (int filter_index = 0; filter_index < m_filter_count; ++filter_index)
+		{
+			BatchedFilter &entry= m_filters[filter_index];
+
+			if (packet_index < entry.packet_count)
+			{
+				PoseFilterPacket &filter_packet= m_filter_packets[filter_index];
+
+				filter_packet.clear();
+				entry.filter_space->createFilterPacket(entry.sensor_packets[packet_index], entry.filter, filter_packet);
+
+				entry.lane=
+					entry.filter->beginBatchUpdate(
+						entry.delta_times[packet_index], filter_packet, m_kernel_lanes[entry.kernel]);
+			}
+		}
+
+		// One pass over all the devices per kernel
+		for (int kernel_index = 0; kernel_index < OrientationFilterBatchKernel_COUNT; ++kernel_index)
+		{
+			OrientationFilterBatchLanes &lanes= m_kernel_lanes[kernel_index];
+
+			if (lanes.lane_count > 0)
+			{
+				orientation_filter_batch_run_kernel(static_cast<OrientationFilterBatchKernel>(kernel_index), lanes);
+			}
+		}
+
+		for (int filter_index = 0; filter_index < m_filter_count; ++filter_index)
+		{
+			BatchedFilter &entry= m_filters[filter_index];
+
+			if (packet_index < entry.packet_count)
+			{
+				entry.filter->endBatchUpdate(
+					entry.delta_times[packet_index], m_filter_packets[filter_index], m_kernel_lanes[entry.kernel], entry.lane);
+			}
+		}
+	}
+}
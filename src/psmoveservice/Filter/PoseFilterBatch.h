@@ -0,0 +1,58 @@
+#ifndef POSE_FILTER_BATCH_H
+#define POSE_FILTER_BATCH_H
+
+//-- includes -----
+#include "PoseFilterInterface.h"
+
+//-- definitions -----
+/// Steps the pose filters of many devices together, one packet of every device per pass.
+/// Within a pass the IMU steps of the Madgwick and complementary orientation filters run as
+/// structure of arrays kernels over all the devices (see OrientationFilterBatchLanes),
+/// the rest of each filter update runs one device at a time as usual.
+/// The filters keep their own state, so the results read back through the IPoseFilter accessors.
+class PoseFilterBatch
+{
+public:
+    PoseFilterBatch();
+
+    /// Drops the filters added since the last clear()
+    void clear();
+
+    /// Adds a filter along with its time ordered packets (see IPoseFilter::updateBatch()).
+    /// The packets and time deltas have to stay valid until update() returns.
+    /// Returns false if the filter has no batch kernel or all k_orientation_filter_batch_max_lanes slots are taken.
+    bool addFilter(
+        IPoseFilter *filter,
+        const PoseFilterSpace *filterSpace,
+        const PoseSensorPacket *sensorPackets,
+        const float *deltaTimes,
+        const int packetCount);
+
+    inline int getFilterCount() const { return m_filter_count; }
+
+    /// Integrates every packet of every added filter.
+    /// Each filter ends up as if IPoseFilter::updateBatch() had been called on it.
+    void update();
+
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+private:
+    struct BatchedFilter
+    {
+        IPoseFilter *filter;
+        const PoseFilterSpace *filter_space;
+        const PoseSensorPacket *sensor_packets;
+        const float *delta_times;
+        int packet_count;
+        OrientationFilterBatchKernel kernel;
+        int lane; // lane of the current packet in the kernel's lanes, -1 if it didn't need one
+    };
+
+    BatchedFilter m_filters[k_orientation_filter_batch_max_lanes];
+    PoseFilterPacket m_filter_packets[k_orientation_filter_batch_max_lanes]; // current packet of each filter
+    OrientationFilterBatchLanes m_kernel_lanes[OrientationFilterBatchKernel_COUNT];
+    int m_filter_count;
+};
+
+#endif // POSE_FILTER_BATCH_H
@@ -67,6 +67,8 @@ void PoseFilterSpace::createFilterPacket(
     outFilterPacket.optical_orientation = sensorPacket.optical_orientation;
     outFilterPacket.optical_position_cm = sensorPacket.optical_position_cm;
 	outFilterPacket.tracking_projection_area_px_sqr= sensorPacket.tracking_projection_area_px_sqr;
+	outFilterPacket.optical_position_variance_cm_sqr= sensorPacket.optical_position_variance_cm_sqr;
+	outFilterPacket.optical_follows_frame_gap= sensorPacket.optical_follows_frame_gap;
 
 	if (sensorPacket.has_gyroscope_measurement)
 	{
@@ -88,4 +90,74 @@ void PoseFilterSpace::createFilterPacket(
         
 	outFilterPacket.world_accelerometer=
 		eigen_vector3f_clockwise_rotate(outFilterPacket.current_orientation, outFilterPacket.imu_accelerometer_g_units);
-}
\ No newline at end of file
+}
+
+//-- Pose Filter -----
+void IPoseFilter::updateBatch(
+    const PoseFilterSpace *filterSpace,
+    const PoseSensorPacket *sensorPackets,
+    const float *deltaTimes,
+    const int packetCount)
+{
+	PoseFilterPacket filterPacket;
+
+	for (int packetIndex = 0; packetIndex < packetCount; ++packetIndex)
+	{
+		filterPacket.clear();
+
+		// Create a filter input packet from the sensor data 
+		// and the filter's previous orientation and position
+		filterSpace->createFilterPacket(sensorPackets[packetIndex], this, filterPacket);
+
+		// Process the filter packet
+		update(deltaTimes[packetIndex], filterPacket);
+	}
+}
+
+OrientationFilterBatchKernel IPoseFilter::getBatchKernel() const
+{
+	return OrientationFilterBatchKernel_None;
+}
+
+int IPoseFilter::beginBatchUpdate(
+	const float delta_time,
+	const PoseFilterPacket &packet,
+	OrientationFilterBatchLanes &/*lanes*/)
+{
+	// Without a kernel the whole update happens up front
+	update(delta_time, packet);
+
+	return -1;
+}
+
+void IPoseFilter::endBatchUpdate(
+	const float /*delta_time*/,
+	const PoseFilterPacket &/*packet*/,
+	const OrientationFilterBatchLanes &/*lanes*/,
+	const int /*lane*/)
+{
+}
+
+//-- Orientation Filter -----
+OrientationFilterBatchKernel IOrientationFilter::getBatchKernel() const
+{
+	return OrientationFilterBatchKernel_None;
+}
+
+int IOrientationFilter::beginBatchUpdate(
+	const float delta_time,
+	const PoseFilterPacket &packet,
+	OrientationFilterBatchLanes &/*lanes*/)
+{
+	// Without a kernel the whole update happens up front
+	update(delta_time, packet);
+
+	return -1;
+}
+
+void IOrientationFilter::endBatchUpdate(
+	const PoseFilterPacket &/*packet*/,
+	const OrientationFilterBatchLanes &/*lanes*/,
+	const int /*lane*/)
+{
+}
@@ -4,6 +4,7 @@
 //-- includes -----
 #include "DeviceInterface.h"
 #include "MathEigen.h"
+#include <assert.h>
 #include <chrono>
 
 //-- constants -----
@@ -23,6 +24,9 @@ extern const Eigen::Matrix3f *k_eigen_sensor_transform_opengl;
 #define k_meters_to_centimeters  100.f
 #define k_centimeters_to_meters  0.01f
 
+// Most devices a batched orientation filter kernel steps in one pass (ControllerManager::k_max_devices)
+#define k_orientation_filter_batch_max_lanes 32
+
 //-- declarations -----
 struct ExponentialCurve
 {
@@ -53,6 +57,13 @@ struct PoseSensorPacket
     Eigen::Vector3f optical_position_cm;
     Eigen::Quaternionf optical_orientation;
 	float tracking_projection_area_px_sqr; // pixels^2
+	// Variance of the optical position derived from the live projection (sphere fit residual, tracker count).
+	// 0 if the filter should look it up on its position variance curve from the projection area instead.
+	float optical_position_variance_cm_sqr; // cm^2
+	// The optical reading doesn't come from the video frames right after the previous reading's
+	// (the cameras dropped frames in between, or the reading got held over from an older frame),
+	// so the filters shouldn't derive a velocity from the difference between the two
+	bool optical_follows_frame_gap;
 
     // Sensor readings in the controller's reference frame
 	CommonRawDeviceVector raw_imu_accelerometer;
@@ -71,6 +82,8 @@ struct PoseSensorPacket
 		optical_position_cm= Eigen::Vector3f::Zero();
 		optical_orientation= Eigen::Quaternionf::Identity();
 		tracking_projection_area_px_sqr= 0.f;
+		optical_position_variance_cm_sqr= 0.f;
+		optical_follows_frame_gap= false;
 
 		raw_imu_accelerometer.clear();
 		raw_imu_magnetometer.clear();
@@ -88,6 +101,13 @@ struct PoseSensorPacket
 		return optical_position_cm * k_centimeters_to_meters;
 	}
 
+	inline float get_optical_position_variance_cm_sqr(const ExponentialCurve &position_variance_curve) const
+	{
+		return (optical_position_variance_cm_sqr > 0.f)
+			? optical_position_variance_cm_sqr
+			: position_variance_curve.evaluate(tracking_projection_area_px_sqr);
+	}
+
 	inline bool has_imu_measurements() const
 	{
 		return has_accelerometer_measurement || has_magnetometer_measurement || has_gyroscope_measurement;
@@ -288,6 +308,70 @@ struct PoseFilterConstants
 	}
 };
 
+/// The structure of arrays kernels that batched orientation filter updates share (see PoseFilterBatch)
+enum OrientationFilterBatchKernel
+{
+	OrientationFilterBatchKernel_None= -1,
+
+	OrientationFilterBatchKernel_MadgwickARG,
+	OrientationFilterBatchKernel_MadgwickMARG,
+	OrientationFilterBatchKernel_AngularRate,
+
+	OrientationFilterBatchKernel_COUNT
+};
+
+/// Inputs and outputs of one orientation filter kernel step, laid out as structure of arrays.
+/// Each lane is one device's filter taking one packet, so the kernel math vectorizes across the devices.
+struct OrientationFilterBatchLanes
+{
+	int lane_count;
+
+	// Filter state, in and out. q is (w, x, y, z) from earth frame to sensor frame.
+	float q_w[k_orientation_filter_batch_max_lanes];
+	float q_x[k_orientation_filter_batch_max_lanes];
+	float q_y[k_orientation_filter_batch_max_lanes];
+	float q_z[k_orientation_filter_batch_max_lanes];
+	float omega_bias_x[k_orientation_filter_batch_max_lanes]; // rad/s
+	float omega_bias_y[k_orientation_filter_batch_max_lanes];
+	float omega_bias_z[k_orientation_filter_batch_max_lanes];
+
+	// Filter space sensor readings of the packet
+	float gyroscope_x[k_orientation_filter_batch_max_lanes]; // rad/s
+	float gyroscope_y[k_orientation_filter_batch_max_lanes];
+	float gyroscope_z[k_orientation_filter_batch_max_lanes];
+	float accelerometer_x[k_orientation_filter_batch_max_lanes]; // g-units
+	float accelerometer_y[k_orientation_filter_batch_max_lanes];
+	float accelerometer_z[k_orientation_filter_batch_max_lanes];
+	float magnetometer_x[k_orientation_filter_batch_max_lanes]; // unit vector
+	float magnetometer_y[k_orientation_filter_batch_max_lanes];
+	float magnetometer_z[k_orientation_filter_batch_max_lanes];
+
+	// Orientation filter constants of the lane's device
+	float gravity_direction_x[k_orientation_filter_batch_max_lanes];
+	float gravity_direction_y[k_orientation_filter_batch_max_lanes];
+	float gravity_direction_z[k_orientation_filter_batch_max_lanes];
+	float magnetometer_direction_x[k_orientation_filter_batch_max_lanes];
+	float magnetometer_direction_y[k_orientation_filter_batch_max_lanes];
+	float magnetometer_direction_z[k_orientation_filter_batch_max_lanes];
+	float beta[k_orientation_filter_batch_max_lanes]; // Madgwick gradient descent gain
+
+	// The time step of the kernel (including the time skipped since the last IMU packet)
+	// and the time delta the filter got the packet with
+	float step_time[k_orientation_filter_batch_max_lanes]; // seconds
+	float delta_time[k_orientation_filter_batch_max_lanes]; // seconds
+
+	inline void clear()
+	{
+		lane_count= 0;
+	}
+
+	inline int add_lane()
+	{
+		assert(lane_count < k_orientation_filter_batch_max_lanes);
+		return lane_count++;
+	}
+};
+
 /// Common interface to all state filters
 class IStateFilter
 {
@@ -323,6 +407,18 @@ public:
 
     /// Get the current world space angular acceleration of the filter state (rad/s^2)
     virtual Eigen::Vector3f getAngularAccelerationRadPerSecSqr() const = 0;
+
+    /// The kernel that runs the IMU steps of the filter when it gets updated in a batch,
+    /// OrientationFilterBatchKernel_None if the filter only updates one device at a time
+    virtual OrientationFilterBatchKernel getBatchKernel() const;
+
+    /// First half of a batched update(): everything up to the kernel step.
+    /// Returns the lane of the packet in the lanes of getBatchKernel(),
+    /// or -1 if the packet doesn't need a kernel step (the update is complete then).
+    virtual int beginBatchUpdate(const float delta_time, const PoseFilterPacket &packet, OrientationFilterBatchLanes &lanes);
+
+    /// Second half of a batched update(): takes the kernel step results of the lane beginBatchUpdate() returned
+    virtual void endBatchUpdate(const PoseFilterPacket &packet, const OrientationFilterBatchLanes &lanes, const int lane);
 };
 
 /// Common interface to all position filters
@@ -369,6 +465,31 @@ public:
 
     /// Get the current velocity of the filter state (cm/s^2)
     virtual Eigen::Vector3f getAccelerationCmPerSecSqr() const = 0;
+
+    /// Integrate a time ordered run of sensor packets (e.g. every IMU sub-frame drained since the last update).
+    /// Each packet is moved into filter space against the state the previous packet left behind,
+    /// so the result matches calling update() once per packet.
+    virtual void updateBatch(
+        const PoseFilterSpace *filterSpace,
+        const PoseSensorPacket *sensorPackets,
+        const float *deltaTimes,
+        const int packetCount);
+
+    /// The orientation kernel that runs the IMU steps of the filter when it gets updated in a batch
+    /// (see PoseFilterBatch), OrientationFilterBatchKernel_None if the filter only updates one device at a time
+    virtual OrientationFilterBatchKernel getBatchKernel() const;
+
+    /// First half of a batched update(): everything up to the orientation kernel step.
+    /// Returns the lane of the packet in the lanes of getBatchKernel(), or -1 if the packet doesn't need a kernel step.
+    virtual int beginBatchUpdate(const float delta_time, const PoseFilterPacket &packet, OrientationFilterBatchLanes &lanes);
+
+    /// Second half of a batched update(): takes the kernel step results
+    /// of the lane beginBatchUpdate() returned (if any) and finishes the update
+    virtual void endBatchUpdate(
+        const float delta_time,
+        const PoseFilterPacket &packet,
+        const OrientationFilterBatchLanes &lanes,
+        const int lane);
 };
 
 #endif // POSE_FILTER_INTERFACE_H
\ No newline at end of file
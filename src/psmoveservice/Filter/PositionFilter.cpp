@@ -26,6 +26,11 @@
 // IMU extrapolation of an unseen controller
 #define k_max_unseen_position_timeout 10000.f // ms
 
+// One Euro filter tuning: the position cutoff is min_cutoff + beta*speed
+#define k_one_euro_min_cutoff 1.0f // Hz
+#define k_one_euro_beta 10.f // Hz per m/s
+#define k_one_euro_derivative_cutoff 1.0f // Hz
+
 // -- private definitions -----
 struct PositionFilterState
 {
@@ -83,7 +88,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "Position is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "Position is NaN!";
 		}
 
 		if (eigen_vector3f_is_valid(new_velocity_m_per_sec))
@@ -92,7 +97,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "Velocity is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "Velocity is NaN!";
 		}
 
 		if (eigen_vector3f_is_valid(new_acceleration_m_per_sec_sqr))
@@ -101,7 +106,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "Acceleration is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "Acceleration is NaN!";
 		}
 
 		if (eigen_vector3f_is_valid(new_accelerometer_g_units))
@@ -110,7 +115,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "Accelerometer is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "Accelerometer is NaN!";
 		}
 
 		if (eigen_vector3f_is_valid(new_accelerometer_derivative_g_per_sec))
@@ -119,7 +124,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "AccelerometerDerivative is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "AccelerometerDerivative is NaN!";
 		}
 
 		if (is_valid_float(delta_time))
@@ -129,7 +134,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "time delta is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "time delta is NaN!";
 		}
 
         // state is valid now that we have had an update
@@ -154,7 +159,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "Position is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "Position is NaN!";
 		}
 
 		if (eigen_vector3f_is_valid(new_velocity_m_per_sec))
@@ -163,7 +168,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "Velocity is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "Velocity is NaN!";
 		}
 
 		if (is_valid_float(delta_time))
@@ -173,7 +178,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "time delta is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "time delta is NaN!";
 		}
 
         // state is valid now that we have had an update
@@ -188,7 +193,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "optical time delta is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "optical time delta is NaN!";
 		}
 	}
 
@@ -200,7 +205,7 @@ struct PositionFilterState
 		}
 		else
 		{
-			SERVER_LOG_WARNING("PositionFilter") << "imu time delta is NaN!";
+			SERVER_MT_LOG_WARNING("PositionFilter") << "imu time delta is NaN!";
 		}
 	}
 };
@@ -472,7 +477,16 @@ void PositionFilterLowPassExponential::update(const float delta_time, const Pose
 		Eigen::Vector3f new_position_meters;
 		Eigen::Vector3f new_velocity_m_per_sec= Eigen::Vector3f::Zero();
 
-        if (m_state->bIsValid)
+        if (m_state->bIsValid && packet.optical_follows_frame_gap)
+        {
+			// Can't tell how the controller moved across the gap, so keep the last velocity
+			// and fold the time into the newest history entry instead of recording this position
+			new_position_meters = lowpass_filter_optical_position_using_distance(&packet, m_state);
+			new_velocity_m_per_sec = m_state->velocity_m_per_sec;
+
+			deltaTimeHistory.back() += delta_time;
+        }
+        else if (m_state->bIsValid)
         {
 			// Blend the latest position against the last position in the filter state ...
             Eigen::Vector3f lowpass_position_meters = 
@@ -528,6 +542,49 @@ void PositionFilterLowPassExponential::update(const float delta_time, const Pose
 	}
 }
 
+// -- PositionFilterOneEuro --
+void PositionFilterOneEuro::update(const float delta_time, const PoseFilterPacket &packet)
+{
+	if (packet.has_optical_measurement())
+	{
+		const Eigen::Vector3f optical_position_meters = packet.get_optical_position_in_meters();
+
+		if (!m_state->bIsValid)
+		{
+			// If this is the first filter packet, just accept the position as gospel
+			m_state->apply_optical_state(optical_position_meters, delta_time);
+		}
+		else if (delta_time > k_real_epsilon)
+		{
+			static float g_min_cutoff = k_one_euro_min_cutoff;
+			static float g_beta = k_one_euro_beta;
+			static float g_derivative_cutoff = k_one_euro_derivative_cutoff;
+
+			// The filtered velocity is the only extra state, and doubles as the prediction velocity.
+			// Differencing across a frame gap would measure the gap, not the motion, so keep the last one.
+			const Eigen::Vector3f new_velocity_m_per_sec =
+				packet.optical_follows_frame_gap
+				? m_state->velocity_m_per_sec
+				: lowpass_filter_vector3f(
+					delta_time, g_derivative_cutoff,
+					m_state->velocity_m_per_sec,
+					Eigen::Vector3f((optical_position_meters - m_state->position_meters) / delta_time));
+
+			const float cutoff = g_min_cutoff + g_beta * new_velocity_m_per_sec.norm();
+			const Eigen::Vector3f new_position_meters =
+				lowpass_filter_vector3f(
+					delta_time, cutoff,
+					m_state->position_meters, optical_position_meters);
+
+			m_state->apply_optical_state(new_position_meters, new_velocity_m_per_sec, delta_time);
+		}
+	}
+	else
+	{
+		m_state->accumulate_optical_delta_time(delta_time);
+	}
+}
+
 //-- helper functions ---
 static Eigen::Vector3f threshold_vector3f(const Eigen::Vector3f &vector, const float min_length)
 {
@@ -599,9 +656,9 @@ static Eigen::Vector3f lowpass_filter_optical_position_using_variance(
     assert(state->bIsValid);
 	assert(packet->has_optical_measurement());
 
-	// Compute the amount of variance in position we expect to see for the given screen area
+	// Compute the amount of variance in position we expect to see for the given projection
 	const float position_variance= 
-		position_variance_curve.evaluate(packet->tracking_projection_area_px_sqr);
+		packet->get_optical_position_variance_cm_sqr(position_variance_curve);
 
 	// Compute the percentage of maximum variance
 	const float max_variance_fraction=
@@ -65,4 +65,13 @@ public:
     void update(const float delta_time, const PoseFilterPacket &packet) override;
 };
 
+/// One Euro filter on the optical position (Casiez et al. 2012).
+/// The low pass cutoff rises with the filtered speed, so a resting controller gets
+/// heavy smoothing and a fast moving one gets little lag. Constant size state.
+class PositionFilterOneEuro : public PositionFilter
+{
+public:
+    void update(const float delta_time, const PoseFilterPacket &packet) override;
+};
+
 #endif // POSITION_FILTER_H
\ No newline at end of file
@@ -1,5 +1,6 @@
 //-- includes -----
 #include "MorpheusHMD.h"
+#include "DeviceInputLog.h"
 #include "DeviceInterface.h"
 #include "DeviceManager.h"
 #include "HMDDeviceEnumerator.h"
@@ -7,8 +8,12 @@
 #include "MathUtility.h"
 #include "ServerLog.h"
 #include "ServerUtility.h"
+#include "AtomicPrimitives.h"
+#include "WakeupSignal.h"
+#include "WorkerThread.h"
 #include "hidapi.h"
 #include "libusb.h"
+#include <algorithm>
 #include <vector>
 #include <cstdlib>
 #ifdef _WIN32
@@ -33,9 +38,14 @@
 #define MORPHEUS_COMMAND_MAGIC 0xAA
 #define MORPHEUS_COMMAND_MAX_PAYLOAD_LEN 60
 
-#define MORPHEUS_HMD_STATE_BUFFER_MAX 4
 #define METERS_TO_CENTIMETERS 100
 
+// How long the sensor thread blocks on a read before checking if it should exit
+#define MORPHEUS_SENSOR_READ_TIMEOUT_MS 100
+// Number of sensor reports the sensor thread can get ahead of the main thread.
+// Matches the state history so one poll can always drain the whole queue.
+#define MORPHEUS_SENSOR_QUEUE_SIZE MORPHEUS_HMD_STATE_BUFFER_MAX
+
 enum eMorpheusRequestType
 {
 	Morpheus_Req_EnableTracking= 0x11,
@@ -178,6 +188,102 @@ struct MorpheusCommand
 };
 #pragma pack()
 
+struct MorpheusSensorPacket
+{
+	MorpheusSensorData data;
+	std::chrono::time_point<std::chrono::high_resolution_clock> capture_timestamp;
+};
+
+// Reads sensor reports off the HID interface on its own thread
+// so that a stalled read never holds up the main loop polling every other device.
+// Raw reports are queued rather than parsed here so the main thread
+// always applies the current calibration when it parses them.
+class MorpheusHidPacketProcessor : public WorkerThread
+{
+public:
+	MorpheusHidPacketProcessor()
+		: WorkerThread("MorpheusSensorProcessor")
+		, m_hidDevice(nullptr)
+		, m_droppedPacketCount({ 0 })
+	{
+	}
+
+	bool fetchNextSensorPacket(MorpheusSensorPacket &out_packet)
+	{
+		return m_sensorPacketQueue.tryDequeue(out_packet);
+	}
+
+	int consumeDroppedPacketCount()
+	{
+		return m_droppedPacketCount.exchange(0);
+	}
+
+	void start(hid_device *in_hid_device)
+	{
+		if (!hasThreadStarted())
+		{
+			m_hidDevice= in_hid_device;
+
+			// Perform blocking reads on the worker thread
+			logged_hid_set_nonblocking(m_hidDevice, 0);
+
+			// Fire up the worker thread
+			WorkerThread::startThread();
+		}
+	}
+
+	void stop()
+	{
+		WorkerThread::stopThread();
+	}
+
+protected:
+	virtual bool doWork() override
+	{
+		MorpheusSensorPacket packet;
+		int res = logged_hid_read_timeout(
+			m_hidDevice, (unsigned char*)&packet.data, sizeof(MorpheusSensorData), MORPHEUS_SENSOR_READ_TIMEOUT_MS);
+
+		if (res > 0)
+		{
+			// Stamp the report as soon as the read completes
+			packet.capture_timestamp= std::chrono::high_resolution_clock::now();
+
+			if (m_sensorPacketQueue.tryEnqueue(packet))
+			{
+				WakeupSignal::notifyMainLoop();
+			}
+			else
+			{
+				// The main thread has fallen far behind. Drop the newest report and let it catch up.
+				++m_droppedPacketCount;
+			}
+		}
+		else if (res < 0)
+		{
+			char hidapi_err_mbs[256];
+			bool valid_error_mesg = 
+				ServerUtility::convert_wcs_to_mbs(logged_hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
+
+			// Device no longer in valid state.
+			if (valid_error_mesg)
+			{
+				SERVER_MT_LOG_ERROR("MorpheusSensorProcessor::doWork") << "HID ERROR: " << hidapi_err_mbs;
+			}
+
+			// halt the worker thread
+			return false;
+		}
+
+		return true;
+	}
+
+	// Multi-threaded state
+	hid_device *m_hidDevice;
+	AtomicQueue<MorpheusSensorPacket, MORPHEUS_SENSOR_QUEUE_SIZE> m_sensorPacketQueue;
+	std::atomic_int m_droppedPacketCount;
+};
+
 // -- private methods
 static bool morpheus_open_usb_device(MorpheusUSBContext *morpheus_context);
 static void morpheus_close_usb_device(MorpheusUSBContext *morpheus_context);
@@ -237,6 +343,7 @@ MorpheusHMDConfig::config2ptree()
 	pt.put("PositionFilter.MaxVelocity", max_velocity);
 
 	pt.put("prediction_time", prediction_time);
+	writeVisionPriority(pt, vision_priority);
 	pt.put("max_poll_failure_count", max_poll_failure_count);
 
 	writeTrackingColor(pt, tracking_color_id);
@@ -256,6 +363,7 @@ MorpheusHMDConfig::ptree2config(const boost::property_tree::ptree &pt)
 		disable_command_interface= pt.get<bool>("disable_command_interface", disable_command_interface);
 
 		prediction_time = pt.get<float>("prediction_time", 0.f);
+		vision_priority = static_cast<eCommonVisionPriority>(readVisionPriority(pt, VisionPriority_High));
 		max_poll_failure_count = pt.get<long>("max_poll_failure_count", 100);
 
 		// Use the current accelerometer values (constructor defaults) as the default values
@@ -305,71 +413,82 @@ MorpheusHMDConfig::ptree2config(const boost::property_tree::ptree &pt)
     }
 }
 
-// -- Morpheus HMD Sensor Frame -----
-void MorpheusHMDSensorFrame::parse_data_input(
-	const MorpheusHMDConfig *config,
-	const MorpheusRawSensorFrame *data_input)
+void
+MorpheusHMDConfig::getIMUDecoder(IMUPacketDecoder *out_decoder) const
 {
-	short raw_seq = static_cast<short>((data_input->seq_frame[1] << 8) | data_input->seq_frame[0]);
-
 	// Piece together the 12-bit accelerometer data 
 	// rotate data 90degrees about Z so that sensor Y is up, flip X and Z)
 	// +X - goes out the left of the headset
 	// +Y - goes out the top of the headset
 	// +Z - goes out the back of the headset
-	short raw_accelX = static_cast<short>(((data_input->accel_y[1] << 8) | data_input->accel_y[0])) >> 4;						
-	short raw_accelY = static_cast<short>(((data_input->accel_x[1] << 8) | data_input->accel_x[0])) >> 4;
-	short raw_accelZ = -(static_cast<short>(((data_input->accel_z[1] << 8) | data_input->accel_z[0])) >> 4);
+	out_decoder->accelerometer.setLayout(
+		IMURawEncoding_Signed12High,
+		offsetof(MorpheusRawSensorFrame, accel_y), offsetof(MorpheusRawSensorFrame, accel_x), offsetof(MorpheusRawSensorFrame, accel_z));
+	out_decoder->accelerometer.setAxisSign(2, -1);
 
-	// Piece together the 16-bit gyroscope data
-	short raw_gyroYaw = static_cast<short>((data_input->gyro_yaw[1] << 8) | data_input->gyro_yaw[0]);
-	short raw_gyroPitch = static_cast<short>((data_input->gyro_pitch[1] << 8) | data_input->gyro_pitch[0]);
-	short raw_gyroRoll = -static_cast<short>((data_input->gyro_roll[1] << 8) | data_input->gyro_roll[0]);
+	// The 16-bit gyroscope data, as pitch, yaw and flipped roll
+	out_decoder->gyroscope.setLayout(
+		IMURawEncoding_Signed16,
+		offsetof(MorpheusRawSensorFrame, gyro_pitch), offsetof(MorpheusRawSensorFrame, gyro_yaw), offsetof(MorpheusRawSensorFrame, gyro_roll));
+	out_decoder->gyroscope.setAxisSign(2, -1);
 
-	// Save the sequence number
-	SequenceNumber = static_cast<int>(raw_seq);
+	// calibrated_acc= (raw_acc - acc_bias) * acc_gain
+	out_decoder->accelerometer.setAxisCalibration(0, accelerometer_gain.i, -raw_accelerometer_bias.i*accelerometer_gain.i);
+	out_decoder->accelerometer.setAxisCalibration(1, accelerometer_gain.j, -raw_accelerometer_bias.j*accelerometer_gain.j);
+	out_decoder->accelerometer.setAxisCalibration(2, accelerometer_gain.k, -raw_accelerometer_bias.k*accelerometer_gain.k);
+
+	// calibrated_gyro= (raw_gyro - gyro_bias) * gyro_gain
+	out_decoder->gyroscope.setAxisCalibration(0, gyro_gain.i, -raw_gyro_bias.i*gyro_gain.i);
+	out_decoder->gyroscope.setAxisCalibration(1, gyro_gain.j, -raw_gyro_bias.j*gyro_gain.j);
+	out_decoder->gyroscope.setAxisCalibration(2, gyro_gain.k, -raw_gyro_bias.k*gyro_gain.k);
 
-	// Save the raw accelerometer values
-	RawAccel.i = static_cast<int>(raw_accelX);
-	RawAccel.j = static_cast<int>(raw_accelY);
-	RawAccel.k = static_cast<int>(raw_accelZ);
+	// Two IMU frames per report, imu_frame_0 and imu_frame_1
+	out_decoder->frame_count= 2;
+	out_decoder->frame_stride= offsetof(MorpheusSensorData, imu_frame_1) - offsetof(MorpheusSensorData, imu_frame_0);
+}
 
-	// Save the raw gyro values
-	RawGyro.i = static_cast<int>(raw_gyroPitch);
-	RawGyro.j = static_cast<int>(raw_gyroYaw);
-	RawGyro.k = static_cast<int>(raw_gyroRoll);
+// -- Morpheus HMD Sensor Frame -----
+void MorpheusHMDSensorFrame::parse_data_input(
+	const IMUPacketDecoder *decoder,
+	const MorpheusSensorData *data_input,
+	const int frame_index)
+{
+	const MorpheusRawSensorFrame *imu_frame = (frame_index == 0) ? &data_input->imu_frame_0 : &data_input->imu_frame_1;
+	short raw_seq = static_cast<short>((imu_frame->seq_frame[1] << 8) | imu_frame->seq_frame[0]);
 
-	// calibrated_acc= (raw_acc - acc_bias) * acc_gain
-	CalibratedAccel.i = (static_cast<float>(raw_accelX) - config->raw_accelerometer_bias.i) * config->accelerometer_gain.i;
-	CalibratedAccel.j = (static_cast<float>(raw_accelY) - config->raw_accelerometer_bias.j) * config->accelerometer_gain.j;
-	CalibratedAccel.k = (static_cast<float>(raw_accelZ) - config->raw_accelerometer_bias.k) * config->accelerometer_gain.k;
+	// Save the sequence number
+	SequenceNumber = static_cast<int>(raw_seq);
 
-	// calibrated_gyro= (raw_gyro - gyro_bias) * gyro_gain
-	CalibratedGyro.i = (static_cast<float>(raw_gyroPitch) - config->raw_gyro_bias.i) * config->gyro_gain.i;
-	CalibratedGyro.j = (static_cast<float>(raw_gyroYaw) - config->raw_gyro_bias.j) * config->gyro_gain.j;
-	CalibratedGyro.k = (static_cast<float>(raw_gyroRoll) - config->raw_gyro_bias.k) * config->gyro_gain.k;
+	// Raw and calibrated accelerometer and gyro values, already rotated into the headset's space
+	decoder->decodeFrame(
+		&data_input->imu_frame_0, frame_index,
+		&RawAccel.i, &CalibratedAccel.i,
+		&RawGyro.i, &CalibratedGyro.i);
 }
 
 // -- Morpheus HMD State -----
 void MorpheusHMDState::parse_data_input(
-	const MorpheusHMDConfig *config, 
+	const IMUPacketDecoder *decoder, 
 	const struct MorpheusSensorData *data_input)
 {
-	SensorFrames[0].parse_data_input(config, &data_input->imu_frame_0);
-	SensorFrames[1].parse_data_input(config, &data_input->imu_frame_1);
+	for (int frame_index = 0; frame_index < decoder->frame_count; ++frame_index)
+	{
+		SensorFrames[frame_index].parse_data_input(decoder, data_input, frame_index);
+	}
 }
 
 // -- Morpheus HMD -----
 MorpheusHMD::MorpheusHMD()
     : cfg()
     , USBContext(nullptr)
+    , m_HIDPacketProcessor(nullptr)
     , NextPollSequenceNumber(0)
-    , InData(nullptr)
     , HMDStates()
+    , LastPollSensorBacklog(0)
+    , MaxPollSensorBacklog(0)
 	, bIsTracking(false)
 {
     USBContext = new MorpheusUSBContext;
-    InData = new MorpheusSensorData;
 
     HMDStates.clear();
 }
@@ -381,7 +500,11 @@ MorpheusHMD::~MorpheusHMD()
         SERVER_LOG_ERROR("~MorpheusHMD") << "HMD deleted without calling close() first!";
     }
 
-    delete InData;
+    if (m_HIDPacketProcessor != nullptr)
+    {
+        delete m_HIDPacketProcessor;
+    }
+
     delete USBContext;
 }
 
@@ -419,11 +542,7 @@ bool MorpheusHMD::open(
 
 		// Open the sensor interface using HIDAPI
 		USBContext->sensor_device_path = pEnum->get_hid_hmd_enumerator()->get_interface_path(MORPHEUS_SENSOR_INTERFACE);
-		USBContext->sensor_device_handle = hid_open_path(USBContext->sensor_device_path.c_str());
-		if (USBContext->sensor_device_handle != nullptr)
-		{
-			hid_set_nonblocking(USBContext->sensor_device_handle, 1);
-		}
+		USBContext->sensor_device_handle = logged_hid_open_path(USBContext->sensor_device_path.c_str());
 
 		// Open the command interface using libusb.
 		// NOTE: Ideally we would use one usb library for both interfaces, but there are some complications.
@@ -460,6 +579,12 @@ bool MorpheusHMD::open(
 
             // Reset the polling sequence counter
             NextPollSequenceNumber = 0;
+            LastPollSensorBacklog = 0;
+            MaxPollSensorBacklog = 0;
+
+			// Start reading sensor reports on a worker thread
+			m_HIDPacketProcessor = new MorpheusHidPacketProcessor();
+			m_HIDPacketProcessor->start(USBContext->sensor_device_handle);
 
 			success = true;
         }
@@ -477,10 +602,18 @@ void MorpheusHMD::close()
 {
     if (USBContext->sensor_device_handle != nullptr || USBContext->usb_device_handle != nullptr)
     {
+		// Stop the sensor thread before closing the device it reads from
+		if (m_HIDPacketProcessor != nullptr)
+		{
+			m_HIDPacketProcessor->stop();
+			delete m_HIDPacketProcessor;
+			m_HIDPacketProcessor = nullptr;
+		}
+
 		if (USBContext->sensor_device_handle != nullptr)
 		{
 			SERVER_LOG_INFO("MorpheusHMD::close") << "Closing MorpheusHMD sensor interface(" << USBContext->sensor_device_path << ")";
-			hid_close(USBContext->sensor_device_handle);
+			logged_hid_close(USBContext->sensor_device_handle);
 		}
 
 		if (USBContext->usb_device_handle != nullptr)
@@ -491,7 +624,6 @@ void MorpheusHMD::close()
 		}
 
         USBContext->Reset();
-        InData->Reset();
     }
     else
     {
@@ -546,47 +678,21 @@ MorpheusHMD::poll()
 {
 	IHMDInterface::ePollResult result = IHMDInterface::_PollResultFailure;
 
-	if (getIsOpen())
+	if (getIsOpen() && m_HIDPacketProcessor != nullptr && !m_HIDPacketProcessor->hasThreadEnded())
 	{
-		static const int k_max_iterations = 32;
-
-		for (int iteration = 0; iteration < k_max_iterations; ++iteration)
+		result = IHMDInterface::_PollResultSuccessNoData;
+
+		// Drain every report the sensor thread queued up since the last poll.
+		// The state history holds a full queue, so the HMD view gets to hand all of their
+		// IMU frames to the pose filter in one batch instead of the backlog carrying over.
+		// The calibration can change from one poll to the next (config tool), so fold it in once per poll
+		IMUPacketDecoder decoder;
+		cfg.getIMUDecoder(&decoder);
+
+		MorpheusSensorPacket packet;
+		int packet_count = 0;
+		while (m_HIDPacketProcessor->fetchNextSensorPacket(packet))
 		{
-			// Attempt to read the next update packet from the controller
-			int res = hid_read(USBContext->sensor_device_handle, (unsigned char*)InData, sizeof(MorpheusSensorData));
-
-			if (res == 0)
-			{
-				// Device still in valid state
-				result = (iteration == 0)
-					? IHMDInterface::_PollResultSuccessNoData
-					: IHMDInterface::_PollResultSuccessNewData;
-
-				// No more data available. Stop iterating.
-				break;
-			}
-			else if (res < 0)
-			{
-				char hidapi_err_mbs[256];
-				bool valid_error_mesg = 
-					ServerUtility::convert_wcs_to_mbs(hid_error(USBContext->sensor_device_handle), hidapi_err_mbs, sizeof(hidapi_err_mbs));
-
-				// Device no longer in valid state.
-				if (valid_error_mesg)
-				{
-					SERVER_LOG_ERROR("PSMoveController::readDataIn") << "HID ERROR: " << hidapi_err_mbs;
-				}
-				result = IHMDInterface::_PollResultFailure;
-
-				// No more data available. Stop iterating.
-				break;
-			}
-			else
-			{
-				// New data available. Keep iterating.
-				result = IHMDInterface::_PollResultSuccessNewData;
-			}
-
 			// https://github.com/hrl7/node-psvr/blob/master/lib/psvr.js
 			MorpheusHMDState newState;
 
@@ -595,15 +701,23 @@ MorpheusHMD::poll()
 			++NextPollSequenceNumber;
 
 			// Processes the IMU data
-			newState.parse_data_input(&cfg, InData);
-
-			// Make room for new entry if at the max queue size
-			if (HMDStates.size() >= MORPHEUS_HMD_STATE_BUFFER_MAX)
-			{
-				HMDStates.erase(HMDStates.begin(), HMDStates.begin() + HMDStates.size() - MORPHEUS_HMD_STATE_BUFFER_MAX);
-			}
+			newState.parse_data_input(&decoder, &packet.data);
+			newState.CaptureTimestamp= packet.capture_timestamp;
 
+			// Overwrites the oldest entry once the history is full
 			HMDStates.push_back(newState);
+
+			result = IHMDInterface::_PollResultSuccessNewData;
+			++packet_count;
+		}
+
+		LastPollSensorBacklog = packet_count;
+		MaxPollSensorBacklog = std::max(MaxPollSensorBacklog, packet_count);
+
+		const int dropped_packet_count = m_HIDPacketProcessor->consumeDroppedPacketCount();
+		if (dropped_packet_count > 0)
+		{
+			SERVER_LOG_WARNING("MorpheusHMD::poll") << "Sensor queue full, dropped " << dropped_packet_count << " reports";
 		}
 	}
 
@@ -647,15 +761,29 @@ MorpheusHMD::getPredictionTime() const
 	return getConfig()->prediction_time;
 }
 
+eCommonVisionPriority
+MorpheusHMD::getVisionPriority() const
+{
+	return getConfig()->vision_priority;
+}
+
+int
+MorpheusHMD::getLastPollSensorBacklog() const
+{
+	return LastPollSensorBacklog;
+}
+
+int
+MorpheusHMD::getMaxPollSensorBacklog() const
+{
+	return MaxPollSensorBacklog;
+}
+
 const CommonDeviceState *
 MorpheusHMD::getState(
     int lookBack) const
 {
-    const int queueSize = static_cast<int>(HMDStates.size());
-    const CommonDeviceState * result =
-        (lookBack < queueSize) ? &HMDStates.at(queueSize - lookBack - 1) : nullptr;
-
-    return result;
+    return HMDStates.getFromNewest(lookBack);
 }
 
 long MorpheusHMD::getMaxPollFailureCount() const
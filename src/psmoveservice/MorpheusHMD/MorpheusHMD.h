@@ -4,12 +4,17 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "DeviceSensorDecoder.h"
+#include "CircularBuffer.h"
 #include "MathUtility.h"
 #include <string>
 #include <vector>
-#include <deque>
 #include <array>
 
+// -- constants -----
+// Large enough to take a full sensor queue in a single poll
+#define MORPHEUS_HMD_STATE_BUFFER_MAX 64
+
 // The angle the accelerometer reading will be pitched by
 // if the Morpheus is held such that the face plate is perpendicular to the ground
 // i.e. where what we consider the "identity" pose
@@ -37,6 +42,7 @@ public:
 		, orientation_variance(0.005f)
         , max_poll_failure_count(100)
         , prediction_time(0.f)
+        , vision_priority(VisionPriority_High)
 		, tracking_color_id(eCommonTrackingColorID::Blue)
     {
 		// The Morpheus uses the BMI055 IMU Chip: 
@@ -94,6 +100,9 @@ public:
     virtual const boost::property_tree::ptree config2ptree();
     virtual void ptree2config(const boost::property_tree::ptree &pt);
 
+    // Folds the accelerometer and gyro calibration into the sensor report decoder
+    void getIMUDecoder(IMUPacketDecoder *out_decoder) const;
+
     bool is_valid;
     long version;
 
@@ -158,6 +167,8 @@ public:
 
     long max_poll_failure_count;
 	float prediction_time;
+	// How the vision scheduler ranks this HMD against the other tracked devices
+	eCommonVisionPriority vision_priority;
 
 	eCommonTrackingColorID tracking_color_id;
 };
@@ -181,7 +192,7 @@ struct MorpheusHMDSensorFrame
 		CalibratedGyro.clear();
 	}
 
-	void parse_data_input(const MorpheusHMDConfig *config, const struct MorpheusRawSensorFrame *data_input);
+	void parse_data_input(const IMUPacketDecoder *decoder, const struct MorpheusSensorData *data_input, int frame_index);
 };
 
 struct MorpheusHMDState : public CommonHMDState
@@ -202,7 +213,7 @@ struct MorpheusHMDState : public CommonHMDState
 		SensorFrames[1].clear();
     }
 
-	void parse_data_input(const MorpheusHMDConfig *config, const struct MorpheusSensorData *data_input);
+	void parse_data_input(const IMUPacketDecoder *decoder, const struct MorpheusSensorData *data_input);
 };
 
 class MorpheusHMD : public IHMDInterface 
@@ -238,6 +249,9 @@ public:
 	bool setTrackingColorID(const eCommonTrackingColorID tracking_color_id) override;
 	bool getTrackingColorID(eCommonTrackingColorID &out_tracking_color_id) const override;
 	float getPredictionTime() const override;
+	eCommonVisionPriority getVisionPriority() const override;
+	int getLastPollSensorBacklog() const override;
+	int getMaxPollSensorBacklog() const override;
 
     // -- Getters
     inline const MorpheusHMDConfig *getConfig() const
@@ -256,11 +270,13 @@ private:
     // Constant while the HMD is open
     MorpheusHMDConfig cfg;
     class MorpheusUSBContext *USBContext;                    // Buffer that holds static MorpheusAPI HMD description
+    class MorpheusHidPacketProcessor *m_HIDPacketProcessor;  // Reads sensor reports on a worker thread
 
     // Read HMD State
     int NextPollSequenceNumber;
-    struct MorpheusSensorData *InData;                        // Buffer to hold most recent MorpheusAPI tracking state
-    std::deque<MorpheusHMDState> HMDStates;
+    CircularBuffer<MorpheusHMDState, MORPHEUS_HMD_STATE_BUFFER_MAX> HMDStates;
+    int LastPollSensorBacklog;
+    int MaxPollSensorBacklog;
 
 	bool bIsTracking;
 };
@@ -2,9 +2,12 @@
 #include "AtomicPrimitives.h"
 #include "PSDualShock4Controller.h"
 #include "ControllerDeviceEnumerator.h"
+#include "DeviceInputLog.h"
 #include "MathUtility.h"
 #include "ServerLog.h"
+#include "ServerTrace.h"
 #include "ServerUtility.h"
+#include "CoalescedOutputWriter.h"
 #include "WorkerThread.h"
 #include "BluetoothQueries.h"
 #include <algorithm>
@@ -46,8 +49,9 @@
 #define PSDS4_CALIBRATION_SIZE 49 /* Buffer size for calibration data */
 #define PSDS4_CALIBRATION_BLOB_SIZE (PSDS4_CALIBRATION_SIZE*3 - 2*2) /* Three blocks, minus header (2 bytes) for blocks 2,3 */
 
+#define PSDS4_MAX_SENSOR_DECIMATION_FACTOR 16
+
 /* Minimum time (in milliseconds) psmove write updates */
-#define PSDS4_WRITE_DATA_INTERVAL_MS 120
 
 enum eDualShock4_RequestType {
     DualShock4_BTReport_Input = 0x00,
@@ -254,6 +258,26 @@ struct DualShock4DataOutput
     unsigned char crc32[4];                 // byte 74-77, CRC-32 of the first 75 bytes
 };
 
+static int write_output_hid_packet(hid_device *device, const DualShock4DataOutput &data_out)
+{
+	// Unfortunately in windows simply writing to the HID device, via WriteFile() internally, 
+	// doesn't appear to actually set the data on the controller (despite returning successfully).
+	// In the DS4 implementation they use the HidD_SetOutputReport() Win32 API call instead. 
+	// Unfortunately HIDAPI doesn't have any equivalent call, so we have to make our own.
+	#ifdef _WIN32
+	// hid_set_output_report() pokes at the hidapi device internals, so it needs the real handle
+	// (there is none when replaying a device input log, the packet just gets dropped then)
+	hid_device *hidapi_device = logged_hid_get_hidapi_device(device);
+	int res = (hidapi_device != nullptr)
+		? hid_set_output_report(hidapi_device, (unsigned char*)&data_out, sizeof(DualShock4DataOutput))
+		: static_cast<int>(sizeof(DualShock4DataOutput));
+	#else
+	int res = logged_hid_write(device, (unsigned char*)&data_out, sizeof(DualShock4DataOutput));
+	#endif
+
+	return res;
+}
+
 // -- Dualshock4HidPacketProcessor --
 class DualShock4HidPacketProcessor : public WorkerThread
 {
@@ -264,19 +288,24 @@ public:
 		, m_controllerListener(nullptr)
 		, m_bSupportsMagnetometer(false)
 		, m_nextPollSequenceNumber(0)
+		, m_mergedReportCount(0)
 	{
+		clearMergedSensorSums();
 		setConfig(cfg);
 		memset(&m_previousHIDInputPacket, 0, sizeof(DualShock4DataInput));
 		memset(&m_currentHIDInputPacket, 0, sizeof(DualShock4DataInput));
 		m_previousHIDInputPacket.hid_protocol_code = DualShock4_BTReport_Input;
 		m_currentHIDInputPacket.hid_protocol_code = DualShock4_BTReport_Input;
 
-		memset(&m_previousOutputState, 0, sizeof(DualShock4ControllerOutputState));
 	}
 
 	void setConfig(const PSDualShock4ControllerConfig &cfg)
 	{
+		IMUPacketDecoder decoder;
+		cfg.getIMUDecoder(&decoder);
+
 		m_cfg.storeValue(cfg);
+		m_decoder.storeValue(decoder);
 	}
 
 	void fetchLatestInputData(DualShock4ControllerInputState &input_state)
@@ -284,11 +313,6 @@ public:
 		m_currentInputState.fetchValue(input_state);
 	}
 
-	void postOutputState(const DualShock4ControllerOutputState &output_state)
-	{
-		m_currentOutputState.storeValue(output_state);
-	}
-
     void start(hid_device *in_hid_device, IControllerListener *controller_listener)
     {
 		if (!hasThreadStarted())
@@ -297,7 +321,7 @@ public:
 			m_controllerListener= controller_listener;
 
 			// Perform blocking reads on the worker thread
-			hid_set_nonblocking(m_hidDevice, 0);
+			logged_hid_set_nonblocking(m_hidDevice, 0);
 
 			// Fire up the worker thread
 			WorkerThread::startThread();
@@ -319,45 +343,62 @@ protected:
 		data_out._unknown1[1] = 0x00;
 		data_out.rumbleFlags = PSDS4_RUMBLE_ENABLED;
 
-		writeOutputHidPacket(data_out);
+		write_output_hid_packet(m_hidDevice, data_out);
 	}
 
 	virtual bool doWork() override
     {
-		// Attempt to read the next sensor update packet from the HMD
-		memcpy(&m_previousHIDInputPacket, &m_currentHIDInputPacket, sizeof(DualShock4DataInput));
-		int res = hid_read(m_hidDevice, (unsigned char*)&m_currentHIDInputPacket, sizeof(DualShock4DataInput));
+		// Attempt to read the next sensor update packet from the controller
+		int res = -1;
+		{
+			SERVER_TRACE_SCOPE(ServerTraceStage_HIDRead);
+			res = logged_hid_read(m_hidDevice, (unsigned char*)&m_currentHIDInputPacket, sizeof(DualShock4DataInput));
+		}
 
 		if (res > 0)
 		{
+			// Stamp the packet as soon as the read completes so main loop jitter doesn't leak into the filter
+			const std::chrono::time_point<std::chrono::high_resolution_clock> capture_time= std::chrono::high_resolution_clock::now();
+
 			PSDualShock4ControllerConfig cfg;
 			m_cfg.fetchValue(cfg);
 
+			IMUPacketDecoder decoder;
+			m_decoder.fetchValue(decoder);
+
 			// https://github.com/hrl7/node-psvr/blob/master/lib/psvr.js
 			DualShock4ControllerInputState newState;
 
-			// Increment the sequence for every new polling packet
-			newState.PollSequenceNumber = m_nextPollSequenceNumber;
-			++m_nextPollSequenceNumber;
+			// Processes the IMU data.
+			// Button transitions are relative to the last forwarded report,
+			// so a press landing on a merged report still shows up as pressed.
+			newState.parseDataInput(&decoder, &m_previousHIDInputPacket, &m_currentHIDInputPacket);
+			newState.CaptureTimestamp= capture_time;
 
-			// Processes the IMU data
-			newState.parseDataInput(&cfg, &m_previousHIDInputPacket, &m_currentHIDInputPacket);
+			if (mergeSensorReport(cfg, newState))
+			{
+				memcpy(&m_previousHIDInputPacket, &m_currentHIDInputPacket, sizeof(DualShock4DataInput));
 
-			// Store a copy of the parsed input date for functions
-			// that want to query input state off of the worker thread
-			m_currentInputState.storeValue(newState);
+				// Increment the sequence for every packet sent on to the filter
+				newState.PollSequenceNumber = m_nextPollSequenceNumber;
+				++m_nextPollSequenceNumber;
 
-			// Send the sensor data for processing by filter
-			if (m_controllerListener != nullptr)
-			{
-				m_controllerListener->notifySensorDataReceived(&newState);
+				// Store a copy of the parsed input date for functions
+				// that want to query input state off of the worker thread
+				m_currentInputState.storeValue(newState);
+
+				// Send the sensor data for processing by filter
+				if (m_controllerListener != nullptr)
+				{
+					m_controllerListener->notifySensorDataReceived(&newState);
+				}
 			}
 		}
 		else if (res < 0)
 		{
 			char hidapi_err_mbs[256];
 			bool valid_error_mesg = 
-				ServerUtility::convert_wcs_to_mbs(hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
+				ServerUtility::convert_wcs_to_mbs(logged_hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
 
 			// Device no longer in valid state.
 			if (valid_error_mesg)
@@ -369,79 +410,73 @@ protected:
 			return false;
 		}
 
-        // Don't send output writes too frequently
-        {
-            std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+		return true;
+    }
 
-            // See if it's time to update the LED/rumble state
-            std::chrono::duration<double, std::milli> led_update_diff = now - m_lastHIDOutputTimestamp;
-            if (led_update_diff.count() >= PSDS4_WRITE_DATA_INTERVAL_MS)
-            {
-				DualShock4ControllerOutputState output_state;
-				m_currentOutputState.fetchValue(output_state);
-
-				if (output_state.r != m_previousOutputState.r ||
-					output_state.g != m_previousOutputState.g ||
-					output_state.b != m_previousOutputState.b ||
-					output_state.rumble_left != m_previousOutputState.rumble_left ||
-					output_state.rumble_right != m_previousOutputState.rumble_right)
-				{
-					DualShock4DataOutput data_out;
-					memset(&data_out, 0, sizeof(DualShock4DataOutput));
-					data_out.hid_protocol_code= DualShock4_BTReport_Output;
-					data_out._unknown1[0]= 0x80; // Unknown why this this is needed, copied from DS4Windows
-					data_out._unknown1[1] = 0x00;
-					data_out.rumbleFlags = PSDS4_RUMBLE_ENABLED;
-					data_out.led_r = output_state.r;
-					data_out.led_g = output_state.g;
-					data_out.led_b = output_state.b;
-					// a.k.a Soft Rumble Motor
-					data_out.rumble_right = output_state.rumble_right;
-					// a.k.a Hard Rumble Motor
-					data_out.rumble_left = output_state.rumble_left;
-					// Set off interval to 0% and the on interval to 100%. 
-					// There are no discos in PSMoveService.
-					data_out.led_flash_on = (output_state.r != 0 || output_state.g != 0 || output_state.b != 0) ? 0xff : 0x00;
-					data_out.led_flash_off = 0x00; 
-
-					int res= writeOutputHidPacket(data_out);
-					if (res > 0)
-					{
-						m_previousOutputState= output_state;
-						m_lastHIDOutputTimestamp = now;
-					}
-					else
-					{
-						char hidapi_err_mbs[256];
-						bool valid_error_mesg = 
-							ServerUtility::convert_wcs_to_mbs(hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
-
-						// Device no longer in valid state.
-						if (valid_error_mesg)
-						{
-							SERVER_MT_LOG_ERROR("PSMoveSensorProcessor::doWork") << "HID ERROR: " << hidapi_err_mbs;
-						}
-					}
-				}
-            }
-        }
+	// Folds a freshly parsed report into the pending sensor packet.
+	// Returns true (with the merged packet in inout_state) once enough reports have been merged.
+	bool mergeSensorReport(const PSDualShock4ControllerConfig &cfg, DualShock4ControllerInputState &inout_state)
+	{
+		const int decimation_factor=
+			std::max(1, std::min(cfg.sensor_decimation_factor, PSDS4_MAX_SENSOR_DECIMATION_FACTOR));
+		const bool bAverage= cfg.sensor_decimation_policy != "latest";
+
+		if (decimation_factor <= 1)
+		{
+			m_mergedReportCount= 0;
+			clearMergedSensorSums();
+			return true;
+		}
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			m_rawAccelerometerSum[axis]+= inout_state.RawAccelerometer[axis];
+			m_rawGyroSum[axis]+= inout_state.RawGyro[axis];
+		}
+		m_calibratedAccelerometerSum.i+= inout_state.CalibratedAccelerometer.i;
+		m_calibratedAccelerometerSum.j+= inout_state.CalibratedAccelerometer.j;
+		m_calibratedAccelerometerSum.k+= inout_state.CalibratedAccelerometer.k;
+		m_calibratedGyroSum.i+= inout_state.CalibratedGyro.i;
+		m_calibratedGyroSum.j+= inout_state.CalibratedGyro.j;
+		m_calibratedGyroSum.k+= inout_state.CalibratedGyro.k;
+
+		++m_mergedReportCount;
+		if (m_mergedReportCount < decimation_factor)
+		{
+			return false;
+		}
+
+		if (bAverage)
+		{
+			// The mean angular velocity over the merged reports times the packet's time delta
+			// is the same rotation as integrating every report
+			const float scale= 1.f / static_cast<float>(m_mergedReportCount);
+
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				inout_state.RawAccelerometer[axis]= static_cast<int>(m_rawAccelerometerSum[axis] / m_mergedReportCount);
+				inout_state.RawGyro[axis]= static_cast<int>(m_rawGyroSum[axis] / m_mergedReportCount);
+			}
+			inout_state.CalibratedAccelerometer.i= m_calibratedAccelerometerSum.i * scale;
+			inout_state.CalibratedAccelerometer.j= m_calibratedAccelerometerSum.j * scale;
+			inout_state.CalibratedAccelerometer.k= m_calibratedAccelerometerSum.k * scale;
+			inout_state.CalibratedGyro.i= m_calibratedGyroSum.i * scale;
+			inout_state.CalibratedGyro.j= m_calibratedGyroSum.j * scale;
+			inout_state.CalibratedGyro.k= m_calibratedGyroSum.k * scale;
+		}
+
+		m_mergedReportCount= 0;
+		clearMergedSensorSums();
 
 		return true;
-    }
+	}
 
-	int writeOutputHidPacket(const DualShock4DataOutput &data_out)
+	void clearMergedSensorSums()
 	{
-		// Unfortunately in windows simply writing to the HID device, via WriteFile() internally, 
-		// doesn't appear to actually set the data on the controller (despite returning successfully).
-		// In the DS4 implementation they use the HidD_SetOutputReport() Win32 API call instead. 
-		// Unfortunately HIDAPI doesn't have any equivalent call, so we have to make our own.
-		#ifdef _WIN32
-		int res = hid_set_output_report(m_hidDevice, (unsigned char*)&data_out, sizeof(DualShock4DataOutput));
-		#else
-		int res = hid_write(m_hidDevice, (unsigned char*)&data_out, sizeof(DualShock4DataOutput));
-		#endif
-
-		return res;
+		memset(m_rawAccelerometerSum, 0, sizeof(m_rawAccelerometerSum));
+		memset(m_rawGyroSum, 0, sizeof(m_rawGyroSum));
+		m_calibratedAccelerometerSum.clear();
+		m_calibratedGyroSum.clear();
 	}
 
     // Multi-threaded state
@@ -449,15 +484,91 @@ protected:
 	IControllerListener *m_controllerListener;
 	bool m_bSupportsMagnetometer;
 	AtomicObject<DualShock4ControllerInputState> m_currentInputState;
-	AtomicObject<DualShock4ControllerOutputState> m_currentOutputState;
 	AtomicObject<PSDualShock4ControllerConfig> m_cfg;
+	AtomicObject<IMUPacketDecoder> m_decoder;
 
     // Worker thread state
     int m_nextPollSequenceNumber;
-	DualShock4DataInput m_previousHIDInputPacket;
+	DualShock4DataInput m_previousHIDInputPacket; // last report forwarded to the filter
     DualShock4DataInput m_currentHIDInputPacket;
-	std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHIDOutputTimestamp;
-	DualShock4ControllerOutputState m_previousOutputState;
+	int m_mergedReportCount;
+	long long m_rawAccelerometerSum[3];
+	long long m_rawGyroSum[3];
+	CommonDeviceVector m_calibratedAccelerometerSum;
+	CommonDeviceVector m_calibratedGyroSum;
+};
+
+// Sends the LED/rumble output reports on their own thread so they never hold up the sensor reads
+class DualShock4HidOutputWriter : public CoalescedOutputWriter<DualShock4ControllerOutputState>
+{
+public:
+	DualShock4HidOutputWriter()
+		: CoalescedOutputWriter<DualShock4ControllerOutputState>("DS4OutputWriter")
+		, m_hidDevice(nullptr)
+	{
+	}
+
+	void setConfig(const PSDualShock4ControllerConfig &cfg)
+	{
+		// The DS4 holds its output state, so it only needs to hear about changes
+		setIntervals(cfg.output_write_interval_ms, 0);
+	}
+
+	void start(hid_device *in_hid_device)
+	{
+		if (!hasThreadStarted())
+		{
+			m_hidDevice= in_hid_device;
+
+			WorkerThread::startThread();
+		}
+	}
+
+	void stop()
+	{
+		WorkerThread::stopThread();
+	}
+
+protected:
+	virtual bool writeOutputState(const DualShock4ControllerOutputState &output_state) override
+	{
+		DualShock4DataOutput data_out;
+		memset(&data_out, 0, sizeof(DualShock4DataOutput));
+		data_out.hid_protocol_code= DualShock4_BTReport_Output;
+		data_out._unknown1[0]= 0x80; // Unknown why this this is needed, copied from DS4Windows
+		data_out._unknown1[1] = 0x00;
+		data_out.rumbleFlags = PSDS4_RUMBLE_ENABLED;
+		data_out.led_r = output_state.r;
+		data_out.led_g = output_state.g;
+		data_out.led_b = output_state.b;
+		// a.k.a Soft Rumble Motor
+		data_out.rumble_right = output_state.rumble_right;
+		// a.k.a Hard Rumble Motor
+		data_out.rumble_left = output_state.rumble_left;
+		// Set off interval to 0% and the on interval to 100%. 
+		// There are no discos in PSMoveService.
+		data_out.led_flash_on = (output_state.r != 0 || output_state.g != 0 || output_state.b != 0) ? 0xff : 0x00;
+		data_out.led_flash_off = 0x00; 
+
+		const int res= write_output_hid_packet(m_hidDevice, data_out);
+		if (res <= 0)
+		{
+			char hidapi_err_mbs[256];
+			bool valid_error_mesg = 
+				ServerUtility::convert_wcs_to_mbs(logged_hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
+
+			// Device no longer in valid state.
+			if (valid_error_mesg)
+			{
+				SERVER_MT_LOG_ERROR("DS4OutputWriter::writeOutputState") << "HID ERROR: " << hidapi_err_mbs;
+			}
+		}
+
+		return res > 0;
+	}
+
+	// Multi-threaded state
+	hid_device *m_hidDevice;
 };
 
 // -- public methods
@@ -506,7 +617,11 @@ PSDualShock4ControllerConfig::config2ptree()
 	pt.put("PoseFilter.MinScreenProjectionArea", min_screen_projection_area);
 
     pt.put("prediction_time", prediction_time);
+    writeVisionPriority(pt, vision_priority);
     pt.put("max_poll_failure_count", max_poll_failure_count);
+    pt.put("output_write_interval_ms", output_write_interval_ms);
+    pt.put("sensor_decimation_factor", sensor_decimation_factor);
+    pt.put("sensor_decimation_policy", sensor_decimation_policy);
 
 	pt.put("hand", hand);
 
@@ -524,7 +639,11 @@ PSDualShock4ControllerConfig::ptree2config(const boost::property_tree::ptree &pt
     {
         is_valid = pt.get<bool>("is_valid", false);
         prediction_time = pt.get<float>("prediction_time", 0.f);
+        vision_priority = static_cast<eCommonVisionPriority>(readVisionPriority(pt, VisionPriority_Normal));
         max_poll_failure_count = pt.get<long>("max_poll_failure_count", 100);
+        output_write_interval_ms = pt.get<int>("output_write_interval_ms", 120);
+        sensor_decimation_factor = pt.get<int>("sensor_decimation_factor", sensor_decimation_factor);
+        sensor_decimation_policy = pt.get<std::string>("sensor_decimation_policy", sensor_decimation_policy);
 
         // Use the current accelerometer values (constructor defaults) as the default values
         accelerometer_gain.i = pt.get<float>("Calibration.Accel.X.k", accelerometer_gain.i);
@@ -577,6 +696,33 @@ PSDualShock4ControllerConfig::ptree2config(const boost::property_tree::ptree &pt
     }
 }
 
+void
+PSDualShock4ControllerConfig::getIMUDecoder(IMUPacketDecoder *out_decoder) const
+{
+    // The accelerometer is 12-bit, in the top bits of its 16-bit fields
+    out_decoder->accelerometer.setLayout(
+        IMURawEncoding_Signed12High,
+        offsetof(DualShock4DataInput, accel_x), offsetof(DualShock4DataInput, accel_y), offsetof(DualShock4DataInput, accel_z));
+    out_decoder->gyroscope.setLayout(
+        IMURawEncoding_Signed16,
+        offsetof(DualShock4DataInput, gyro_x), offsetof(DualShock4DataInput, gyro_y), offsetof(DualShock4DataInput, gyro_z));
+
+    // calibrated_acc= raw_acc*acc_gain + acc_bias
+    out_decoder->accelerometer.setAxisCalibration(0, accelerometer_gain.i, accelerometer_bias.i);
+    out_decoder->accelerometer.setAxisCalibration(1, accelerometer_gain.j, accelerometer_bias.j);
+    out_decoder->accelerometer.setAxisCalibration(2, accelerometer_gain.k, accelerometer_bias.k);
+
+    // calibrated_gyro= raw_gyro*gyro_gain
+    for (int axis_index = 0; axis_index < 3; ++axis_index)
+    {
+        out_decoder->gyroscope.setAxisCalibration(axis_index, gyro_gain, 0.f);
+    }
+
+    // One IMU frame per report
+    out_decoder->frame_count= 1;
+    out_decoder->frame_stride= 0;
+}
+
 // -- DualShock4ControllerInputState --
 DualShock4ControllerInputState::DualShock4ControllerInputState()
 {
@@ -630,7 +776,7 @@ void DualShock4ControllerInputState::clear()
 }
 
 void DualShock4ControllerInputState::parseDataInput(
-	const PSDualShock4ControllerConfig *config,
+	const IMUPacketDecoder *decoder,
 	const struct DualShock4DataInput *previous_hid_packet,
 	const struct DualShock4DataInput *current_hid_input)
 {
@@ -714,44 +860,11 @@ void DualShock4ControllerInputState::parseDataInput(
     LeftTrigger = static_cast<float>(current_hid_input->left_trigger) / 255.f;
     RightTrigger = static_cast<float>(current_hid_input->right_trigger) / 255.f;
 
-    // Processes the IMU data
-    {
-        // Piece together the 12-bit accelerometer data
-        short raw_accelX = static_cast<short>((current_hid_input->accel_x[1] << 8) | current_hid_input->accel_x[0]) >> 4;
-        short raw_accelY = static_cast<short>((current_hid_input->accel_y[1] << 8) | current_hid_input->accel_y[0]) >> 4;
-        short raw_accelZ = static_cast<short>((current_hid_input->accel_z[1] << 8) | current_hid_input->accel_z[0]) >> 4;
-
-        // Piece together the 16-bit gyroscope data
-        short raw_gyroX = static_cast<short>((current_hid_input->gyro_x[1] << 8) | current_hid_input->gyro_x[0]);
-        short raw_gyroY = static_cast<short>((current_hid_input->gyro_y[1] << 8) | current_hid_input->gyro_y[0]);
-        short raw_gyroZ = static_cast<short>((current_hid_input->gyro_z[1] << 8) | current_hid_input->gyro_z[0]);
-
-        // Save the raw accelerometer values
-        RawAccelerometer[0] = static_cast<int>(raw_accelX);
-        RawAccelerometer[1] = static_cast<int>(raw_accelY);
-        RawAccelerometer[2] = static_cast<int>(raw_accelZ);
-
-        // Save the raw gyro values
-        RawGyro[0] = static_cast<int>(raw_gyroX);
-        RawGyro[1] = static_cast<int>(raw_gyroY);
-        RawGyro[2] = static_cast<int>(raw_gyroZ);
-
-        // calibrated_acc= raw_acc*acc_gain + acc_bias
-        CalibratedAccelerometer.i = 
-            static_cast<float>(RawAccelerometer[0]) * config->accelerometer_gain.i 
-            + config->accelerometer_bias.i;
-        CalibratedAccelerometer.j =
-            static_cast<float>(RawAccelerometer[1]) * config->accelerometer_gain.j
-            + config->accelerometer_bias.j;
-        CalibratedAccelerometer.k =
-            static_cast<float>(RawAccelerometer[2]) * config->accelerometer_gain.k
-            + config->accelerometer_bias.k;
-
-        // calibrated_gyro= raw_gyro*gyro_gain + gyro_bias
-        CalibratedGyro.i = static_cast<float>(RawGyro[0]) * config->gyro_gain;
-        CalibratedGyro.j = static_cast<float>(RawGyro[1]) * config->gyro_gain;
-        CalibratedGyro.k = static_cast<float>(RawGyro[2]) * config->gyro_gain;
-    }
+    // Processes the IMU data (12-bit accelerometer, 16-bit gyroscope)
+    decoder->decodeFrame(
+        current_hid_input, 0,
+        RawAccelerometer, &CalibratedAccelerometer.i,
+        RawGyro, &CalibratedGyro.i);
 
     // Sequence and timestamp
     RawSequence = current_hid_input->buttons3.state.counter;
@@ -804,6 +917,7 @@ void DualShock4ControllerOutputState::clear()
 // -- DualShock4 Controller -----
 PSDualShock4Controller::PSDualShock4Controller()
     : m_HIDPacketProcessor(nullptr)
+	, m_HIDOutputWriter(nullptr)
 	, m_controllerListener(nullptr)
 
 {
@@ -825,6 +939,11 @@ PSDualShock4Controller::~PSDualShock4Controller()
 	{
 		delete m_HIDPacketProcessor;
 	}
+
+	if (m_HIDOutputWriter)
+	{
+		delete m_HIDOutputWriter;
+	}
 }
 
 bool PSDualShock4Controller::open()
@@ -873,7 +992,7 @@ bool PSDualShock4Controller::open(
 		HIDDetails.vendor_id = pEnum->get_vendor_id();
 		HIDDetails.product_id = pEnum->get_product_id();
         HIDDetails.Device_path = cur_dev_path;
-        HIDDetails.Handle = hid_open_path(HIDDetails.Device_path.c_str());
+        HIDDetails.Handle = logged_hid_open_path(HIDDetails.Device_path.c_str());
 
         if (HIDDetails.Handle != nullptr)  // Controller was opened and has an index
         {             
@@ -954,6 +1073,11 @@ bool PSDualShock4Controller::open(
 				// Save it back out again in case any defaults changed
 				cfg.save();
             }
+
+			// Create the LED/rumble output thread
+			m_HIDOutputWriter= new DualShock4HidOutputWriter();
+			m_HIDOutputWriter->setConfig(cfg);
+			m_HIDOutputWriter->start(HIDDetails.Handle);
         }
         else
         {
@@ -979,9 +1103,17 @@ void PSDualShock4Controller::close()
 			m_HIDPacketProcessor= nullptr;
 		}
 
+		if (m_HIDOutputWriter != nullptr)
+		{
+			// halt the LED/rumble output thread
+			m_HIDOutputWriter->stop();
+			delete m_HIDOutputWriter;
+			m_HIDOutputWriter= nullptr;
+		}
+
         if (HIDDetails.Handle != nullptr)
         {
-            hid_close(HIDDetails.Handle);
+            logged_hid_close(HIDDetails.Handle);
             HIDDetails.Handle = nullptr;
         }
     }
@@ -1015,7 +1147,7 @@ PSDualShock4Controller::setHostBluetoothAddress(const std::string &new_host_bt_a
         }
 
         /* _WIN32 only has move->handle_addr for getting bluetooth address. */
-        res = hid_send_feature_report(HIDDetails.Handle, bts, sizeof(bts));
+        res = logged_hid_send_feature_report(HIDDetails.Handle, bts, sizeof(bts));
 
         if (res == sizeof(bts))
         {
@@ -1099,6 +1231,14 @@ PSDualShock4Controller::getMaxPollFailureCount() const
 	return cfg.max_poll_failure_count;
 }
 
+int
+PSDualShock4Controller::getPollIntervalMs() const
+{
+	// Over USB the controller sends an input report every 4ms,
+	// polling any faster only finds nothing new
+	return IsBluetooth ? -1 : 4;
+}
+
 IDeviceInterface::ePollResult 
 PSDualShock4Controller::poll()
 {
@@ -1171,7 +1311,7 @@ PSDualShock4Controller::getBTAddressesViaUSB(std::string& host, std::string& con
 
     memset(btg, 0, sizeof(btg));
     btg[0] = DualShock4_USBReport_GetBTAddr;
-    res = hid_get_feature_report(HIDDetails.Handle, btg, sizeof(btg));
+    res = logged_hid_get_feature_report(HIDDetails.Handle, btg, sizeof(btg));
 
     if (res == sizeof(btg))
     {
@@ -1274,6 +1414,11 @@ float PSDualShock4Controller::getPredictionTime() const
 	return getConfig()->prediction_time;
 }
 
+eCommonVisionPriority PSDualShock4Controller::getVisionPriority() const
+{
+	return getConfig()->vision_priority;
+}
+
 bool PSDualShock4Controller::getWasSystemButtonPressed() const
 {
     const DualShock4ControllerInputState *ds4_state= static_cast<const DualShock4ControllerInputState *>(getState());
@@ -1297,6 +1442,11 @@ PSDualShock4Controller::setConfig(const PSDualShock4ControllerConfig *config)
 		m_HIDPacketProcessor->setConfig(*config);
 	}
 
+	if (m_HIDOutputWriter != nullptr)
+	{
+		m_HIDOutputWriter->setConfig(*config);
+	}
+
 	cfg.save();
 }
 
@@ -1305,13 +1455,13 @@ PSDualShock4Controller::setLED(unsigned char r, unsigned char g, unsigned char b
 {
     bool success = true;
 
-    if (m_HIDPacketProcessor != nullptr &&
-		(m_cachedOutputState.r != r) || (m_cachedOutputState.g != g) || (m_cachedOutputState.b != b))
+    if (m_HIDOutputWriter != nullptr &&
+		((m_cachedOutputState.r != r) || (m_cachedOutputState.g != g) || (m_cachedOutputState.b != b)))
     {
         m_cachedOutputState.r = r;
         m_cachedOutputState.g = g;
         m_cachedOutputState.b = b;
-		m_HIDPacketProcessor->postOutputState(m_cachedOutputState);
+		m_HIDOutputWriter->postOutputState(m_cachedOutputState);
         
 		success= true;
     }
@@ -1324,10 +1474,10 @@ PSDualShock4Controller::setLeftRumbleIntensity(unsigned char value)
 {
     bool success = true;
 
-    if (m_cachedOutputState.rumble_left != value)
+    if (m_HIDOutputWriter != nullptr && m_cachedOutputState.rumble_left != value)
     {
         m_cachedOutputState.rumble_left = value;
-		m_HIDPacketProcessor->postOutputState(m_cachedOutputState);
+		m_HIDOutputWriter->postOutputState(m_cachedOutputState);
 
         success = true;
     }
@@ -1340,10 +1490,10 @@ PSDualShock4Controller::setRightRumbleIntensity(unsigned char value)
 {
     bool success = true;
 
-    if (m_cachedOutputState.rumble_right != value)
+    if (m_HIDOutputWriter != nullptr && m_cachedOutputState.rumble_right != value)
     {
         m_cachedOutputState.rumble_right = value;
-		m_HIDPacketProcessor->postOutputState(m_cachedOutputState);
+		m_HIDOutputWriter->postOutputState(m_cachedOutputState);
 
         success = true;
     }
@@ -1374,7 +1524,7 @@ make_dualshock4_button_bitmask(const DualShock4DataInput *hid_packet)
 
 inline bool hid_error_mbs(hid_device *dev, char *out_mb_error, size_t mb_buffer_size)
 {
-    return ServerUtility::convert_wcs_to_mbs(hid_error(dev), out_mb_error, mb_buffer_size);
+    return ServerUtility::convert_wcs_to_mbs(logged_hid_error(dev), out_mb_error, mb_buffer_size);
 }
 
 #ifdef _WIN32
@@ -1437,7 +1587,7 @@ static int hid_set_output_report(hid_device *dev, const unsigned char *data, siz
                 NULL);
 
             /* Store the message off in the Device entry so that
-            the hid_error() function can pick it up. */
+            the logged_hid_error() function can pick it up. */
             LocalFree(dev_internal->last_error_str);
             dev_internal->last_error_str = error_msg;
 
@@ -4,6 +4,7 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "DeviceSensorDecoder.h"
 #include "MathUtility.h"
 #include "hidapi.h"
 #include <string>
@@ -46,7 +47,11 @@ public:
 		, position_filter_type("ComplimentaryOpticalIMU")
 		, orientation_filter_type("ComplementaryOpticalARG")
         , max_poll_failure_count(100)
+        , output_write_interval_ms(120)
+        , sensor_decimation_factor(1)
+        , sensor_decimation_policy("average")
         , prediction_time(0.f)
+        , vision_priority(VisionPriority_Normal)
         , accelerometer_noise_radius(0.015f) // rounded value from config tool measurement (g-units)
 		, accelerometer_variance(1.45e-05f) // rounded value from config tool measurement (g-units^2)
         , max_velocity(1.f)
@@ -107,6 +112,9 @@ public:
     virtual const boost::property_tree::ptree config2ptree();
     virtual void ptree2config(const boost::property_tree::ptree &pt);
 
+    // Folds the accelerometer and gyro calibration into the report decoder
+    void getIMUDecoder(IMUPacketDecoder *out_decoder) const;
+
     bool is_valid;
     long version;
 
@@ -118,9 +126,20 @@ public:
 
 	// The max number of polling failures before we consider the controller disconnected
     long max_poll_failure_count;
+	// Minimum time between LED/rumble output reports, changes made in between get merged
+	int output_write_interval_ms;
+	// Number of consecutive input reports merged into each sensor packet sent to the pose filter.
+	// 1 filters every report the controller sends (up to 1kHz over USB).
+	int sensor_decimation_factor;
+	// How the merged reports are combined: "average" averages the IMU readings
+	// (integrating the gyro over every report), "latest" only keeps the newest report
+	std::string sensor_decimation_policy;
 	// The amount of prediction to apply to the controller pose after filtering
     float prediction_time;
 
+	// How the vision scheduler ranks this controller against the other tracked devices
+	eCommonVisionPriority vision_priority;
+
     // calibrated_acc= raw_acc*acc_gain + acc_bias
     CommonDeviceVector accelerometer_gain;
     CommonDeviceVector accelerometer_bias;
@@ -224,7 +243,7 @@ struct DualShock4ControllerInputState : public CommonControllerState
 
     void clear();
 	void parseDataInput(
-		const PSDualShock4ControllerConfig *config, 
+		const IMUPacketDecoder *decoder, 
 		const struct DualShock4DataInput *previous_hid_packet,
 		const struct DualShock4DataInput *new_hid_packet);
 };
@@ -259,6 +278,7 @@ public:
     virtual IDeviceInterface::ePollResult poll() override;
     virtual void close() override;
 	virtual long getMaxPollFailureCount() const override;
+	virtual int getPollIntervalMs() const override;
     CommonDeviceState::eDeviceType getDeviceType() const override
     {
         return CommonDeviceState::PSDualShock4;
@@ -283,6 +303,7 @@ public:
 	virtual bool getTrackingColorID(eCommonTrackingColorID &out_tracking_color_id) const override;
 	virtual float getIdentityForwardDegrees() const override;
 	virtual float getPredictionTime() const override;
+	virtual eCommonVisionPriority getVisionPriority() const override;
     virtual bool getWasSystemButtonPressed() const override;
 
     // -- Getters
@@ -312,6 +333,7 @@ private:
 
     // HID Packet Processing
 	class DualShock4HidPacketProcessor* m_HIDPacketProcessor;
+	class DualShock4HidOutputWriter* m_HIDOutputWriter;
 	IControllerListener* m_controllerListener;
 
 };
@@ -1,11 +1,26 @@
 #include "PSMoveConfig.h"
+#include "DeviceInputLog.h"
 #include "DeviceInterface.h"
+#include "ServerLog.h"
+#include "ServerTrace.h"
 #include "ServerUtility.h"
+#include <boost/crc.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 // Format: {hue center, hue range}, {sat center, sat range}, {val center, val range}
 // All hue angles are 60 degrees apart to maximize hue separation for 6 max tracked colors.
@@ -21,14 +36,461 @@ const CommonHSVColorRange g_default_color_presets[] = {
 };
 const CommonHSVColorRange *k_default_color_presets = g_default_color_presets;
 
+static std::string g_config_directory_override;
+
+// How long a queued save waits for more changes to the same config before it gets written.
+// Dragging a slider in the config tool re-saves a config many times a second.
+#define k_config_save_debounce_ms 500
+
+// Config snapshots live in this sub directory of the config directory, one <config name>.bin per config
+#define k_config_snapshot_directory_name "ConfigCache"
+#define k_config_snapshot_magic 0x434D5350 // "PSMC"
+// Bump whenever the layout of a snapshot file changes
+#define k_config_snapshot_version 1
+// Deeper property trees than this get treated as corrupt snapshots
+#define k_config_snapshot_max_depth 32
+
+//-- private definitions -----
+/// Start of a config snapshot file, followed by payload_size bytes of serialized property tree.
+/**
+ A snapshot is the parsed form of a config file, so loading a config skips the JSON parse.
+ It only gets used while the JSON file still has the size and modification time it was taken from,
+ so hand edits of the JSON always win.
+ */
+struct ConfigSnapshotHeader
+{
+    uint32_t magic;          // k_config_snapshot_magic
+    uint32_t version;        // k_config_snapshot_version
+    uint64_t json_file_size;
+    int64_t json_write_time; // Modification time of the JSON file (time_t)
+    uint32_t payload_size;
+    uint32_t payload_crc32;
+};
+
+static std::string make_config_snapshot_path(const std::string &config_file_base)
+{
+    boost::filesystem::path snapshot_path(PSMoveConfig::getConfigDirectoryPath());
+    snapshot_path /= k_config_snapshot_directory_name;
+    snapshot_path /= config_file_base + ".bin";
+    return snapshot_path.string();
+}
+
+static bool get_config_file_stamp(const std::string &config_path, uint64_t &out_file_size, int64_t &out_write_time)
+{
+    boost::system::error_code error;
+
+    out_file_size = static_cast<uint64_t>(boost::filesystem::file_size(config_path, error));
+    if (!error)
+    {
+        out_write_time = static_cast<int64_t>(boost::filesystem::last_write_time(config_path, error));
+    }
+
+    return !error;
+}
+
+static void append_snapshot_string(const std::string &value, std::string &out_payload)
+{
+    const uint32_t length = static_cast<uint32_t>(value.size());
+
+    out_payload.append(reinterpret_cast<const char *>(&length), sizeof(length));
+    out_payload.append(value);
+}
+
+// Node layout: value string, child count, then key string + node for each child (in order)
+static void append_snapshot_node(const boost::property_tree::ptree &node, std::string &out_payload)
+{
+    const uint32_t child_count = static_cast<uint32_t>(node.size());
+
+    append_snapshot_string(node.data(), out_payload);
+    out_payload.append(reinterpret_cast<const char *>(&child_count), sizeof(child_count));
+
+    for (const boost::property_tree::ptree::value_type &child : node)
+    {
+        append_snapshot_string(child.first, out_payload);
+        append_snapshot_node(child.second, out_payload);
+    }
+}
+
+static bool read_snapshot_uint32(const char *&cursor, const char *end, uint32_t &out_value)
+{
+    if (end - cursor < static_cast<ptrdiff_t>(sizeof(uint32_t)))
+    {
+        return false;
+    }
+
+    memcpy(&out_value, cursor, sizeof(uint32_t));
+    cursor += sizeof(uint32_t);
+
+    return true;
+}
+
+static bool read_snapshot_string(const char *&cursor, const char *end, std::string &out_value)
+{
+    uint32_t length;
+
+    if (!read_snapshot_uint32(cursor, end, length) || 
+        end - cursor < static_cast<ptrdiff_t>(length))
+    {
+        return false;
+    }
+
+    out_value.assign(cursor, length);
+    cursor += length;
+
+    return true;
+}
+
+static bool read_snapshot_node(const char *&cursor, const char *end, int depth, boost::property_tree::ptree &out_node)
+{
+    std::string value;
+    uint32_t child_count;
+
+    if (depth > k_config_snapshot_max_depth ||
+        !read_snapshot_string(cursor, end, value) ||
+        !read_snapshot_uint32(cursor, end, child_count))
+    {
+        return false;
+    }
+
+    out_node.data() = value;
+
+    for (uint32_t child_index = 0; child_index < child_count; ++child_index)
+    {
+        std::string key;
+
+        if (!read_snapshot_string(cursor, end, key))
+        {
+            return false;
+        }
+
+        boost::property_tree::ptree &child = out_node.push_back(std::make_pair(key, boost::property_tree::ptree()))->second;
+
+        if (!read_snapshot_node(cursor, end, depth + 1, child))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Snapshots are only a cache of the JSON file, so failing to write one is never an error
+static void write_config_snapshot(
+    const std::string &config_file_base, 
+    const std::string &config_path, 
+    const boost::property_tree::ptree &pt)
+{
+    ConfigSnapshotHeader header;
+
+    if (!get_config_file_stamp(config_path, header.json_file_size, header.json_write_time))
+    {
+        return;
+    }
+
+    std::string payload;
+    append_snapshot_node(pt, payload);
+
+    boost::crc_32_type crc;
+    crc.process_bytes(payload.data(), payload.size());
+
+    header.magic = k_config_snapshot_magic;
+    header.version = k_config_snapshot_version;
+    header.payload_size = static_cast<uint32_t>(payload.size());
+    header.payload_crc32 = crc.checksum();
+
+    const std::string snapshot_path = make_config_snapshot_path(config_file_base);
+    const boost::filesystem::path temp_path = snapshot_path + "." + boost::filesystem::unique_path().string();
+    boost::system::error_code error;
+    bool bSuccess = false;
+
+    boost::filesystem::create_directories(boost::filesystem::path(snapshot_path).parent_path(), error);
+
+    if (!error)
+    {
+        std::ofstream snapshot_file(temp_path.string(), std::ios::binary | std::ios::trunc);
+
+        snapshot_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        snapshot_file.write(payload.data(), payload.size());
+        snapshot_file.close();
+        bSuccess = !snapshot_file.fail();
+    }
+
+    if (bSuccess)
+    {
+        boost::filesystem::rename(temp_path, snapshot_path, error);
+        bSuccess = !error;
+    }
+
+    if (!bSuccess)
+    {
+        SERVER_MT_LOG_WARNING("PSMoveConfig") << "Failed to write config snapshot " << snapshot_path;
+        boost::filesystem::remove(temp_path, error);
+    }
+}
+
+// Fails on a missing, corrupt or outdated snapshot, in which case the JSON gets parsed
+static bool read_config_snapshot(
+    const std::string &config_file_base, 
+    const std::string &config_path, 
+    boost::property_tree::ptree &out_pt)
+{
+    const std::string snapshot_path = make_config_snapshot_path(config_file_base);
+    std::ifstream snapshot_file(snapshot_path, std::ios::binary);
+    ConfigSnapshotHeader header;
+    uint64_t json_file_size;
+    int64_t json_write_time;
+
+    if (!snapshot_file.is_open() ||
+        !snapshot_file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        header.magic != k_config_snapshot_magic ||
+        header.version != k_config_snapshot_version ||
+        !get_config_file_stamp(config_path, json_file_size, json_write_time) ||
+        header.json_file_size != json_file_size ||
+        header.json_write_time != json_write_time)
+    {
+        return false;
+    }
+
+    const std::string payload((std::istreambuf_iterator<char>(snapshot_file)), std::istreambuf_iterator<char>());
+
+    if (payload.size() != header.payload_size)
+    {
+        return false;
+    }
+
+    boost::crc_32_type crc;
+    crc.process_bytes(payload.data(), payload.size());
+
+    if (crc.checksum() != header.payload_crc32)
+    {
+        SERVER_MT_LOG_WARNING("PSMoveConfig") << "Ignoring corrupt config snapshot " << snapshot_path;
+        return false;
+    }
+
+    const char *cursor = payload.data();
+    const char *end = cursor + payload.size();
+    boost::property_tree::ptree pt;
+
+    if (!read_snapshot_node(cursor, end, 0, pt) || cursor != end)
+    {
+        SERVER_MT_LOG_WARNING("PSMoveConfig") << "Ignoring malformed config snapshot " << snapshot_path;
+        return false;
+    }
+
+    out_pt.swap(pt);
+
+    return true;
+}
+
+static std::string make_config_path(const std::string &config_file_base)
+{
+    boost::filesystem::path configpath(PSMoveConfig::getConfigDirectoryPath());
+    configpath /= config_file_base + ".json";
+    std::cout << "Config file name: " << configpath << std::endl;
+    return configpath.string();
+}
+
+static bool write_config_file(const std::string &config_file_base, const boost::property_tree::ptree &pt)
+{
+    const std::string config_path = make_config_path(config_file_base);
+    const boost::filesystem::path temp_path = config_path + "." + boost::filesystem::unique_path().string();
+    boost::system::error_code error;
+    bool bSuccess = false;
+
+    // Write to a temp file first so a load never sees a partially written config
+    try
+    {
+        boost::property_tree::write_json(temp_path.string(), pt);
+        bSuccess = true;
+    }
+    catch (boost::property_tree::json_parser_error &ex)
+    {
+        SERVER_MT_LOG_ERROR("PSMoveConfig::save") << "Failed to write config " << config_path << ": " << ex.what();
+    }
+
+    if (bSuccess)
+    {
+        boost::filesystem::rename(temp_path, config_path, error);
+        bSuccess = !error;
+
+        if (bSuccess)
+        {
+            // The next load of this config can skip the JSON parse
+            write_config_snapshot(config_file_base, config_path, pt);
+        }
+        else
+        {
+            SERVER_MT_LOG_ERROR("PSMoveConfig::save") << "Failed to replace config " << config_path << ": " << error.message();
+        }
+    }
+
+    if (!bSuccess)
+    {
+        boost::filesystem::remove(temp_path, error);
+    }
+
+    return bSuccess;
+}
+
+/// Writes config files on a background thread in the order they got saved.
+/**
+ A save waits k_config_save_debounce_ms before it gets written and repeated saves of the same config
+ in the meantime collapse into one write of the latest state, so a config hits the disk at most
+ that often however fast it changes. Until a queued save has hit the disk, loading that config
+ reads the queued state instead of the stale file. Exiting writes everything still queued right away.
+ */
+class ConfigSaveThread
+{
+public:
+    ConfigSaveThread()
+        : m_bExitRequested(false)
+        , m_bIsWriting(false)
+    {
+        m_thread = std::thread(&ConfigSaveThread::thread_func, this);
+    }
+
+    ~ConfigSaveThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_bExitRequested = true;
+        }
+        m_condition.notify_all();
+
+        // The thread writes out everything still queued before exiting
+        m_thread.join();
+    }
+
+    void queue_save(const std::string &config_file_base, const boost::property_tree::ptree &pt)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            PendingSave *pending_save = find_queued_save(config_file_base);
+
+            if (pending_save != nullptr)
+            {
+                pending_save->pt = pt;
+            }
+            else
+            {
+                // Due times only ever grow, so the front of the queue is always the next one due
+                m_queued_saves.push_back(PendingSave());
+                m_queued_saves.back().config_file_base = config_file_base;
+                m_queued_saves.back().pt = pt;
+                m_queued_saves.back().due_time =
+                    std::chrono::steady_clock::now() + std::chrono::milliseconds(k_config_save_debounce_ms);
+            }
+        }
+        m_condition.notify_one();
+    }
+
+    bool try_get_unwritten_config(const std::string &config_file_base, boost::property_tree::ptree &out_pt)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const PendingSave *pending_save = find_queued_save(config_file_base);
+
+        if (pending_save == nullptr && m_bIsWriting && m_writing_save.config_file_base == config_file_base)
+        {
+            pending_save = &m_writing_save;
+        }
+
+        if (pending_save != nullptr)
+        {
+            out_pt = pending_save->pt;
+        }
+
+        return pending_save != nullptr;
+    }
+
+private:
+    struct PendingSave
+    {
+        std::string config_file_base;
+        boost::property_tree::ptree pt;
+        std::chrono::steady_clock::time_point due_time;
+    };
+
+    PendingSave *find_queued_save(const std::string &config_file_base)
+    {
+        for (PendingSave &pending_save : m_queued_saves)
+        {
+            if (pending_save.config_file_base == config_file_base)
+            {
+                return &pending_save;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void thread_func()
+    {
+        ServerUtility::set_current_thread_name("Config Save Thread");
+        ServerTrace::set_current_thread_name("Config Save Thread");
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        for (;;)
+        {
+            m_condition.wait(lock, [this]() { return m_bExitRequested || !m_queued_saves.empty(); });
+
+            if (m_queued_saves.empty())
+            {
+                break;
+            }
+
+            // Give the config a chance to change some more before writing it
+            if (!m_bExitRequested)
+            {
+                const std::chrono::steady_clock::time_point due_time = m_queued_saves.front().due_time;
+
+                m_condition.wait_until(lock, due_time, [this]() { return m_bExitRequested; });
+            }
+
+            m_writing_save.config_file_base.swap(m_queued_saves.front().config_file_base);
+            m_writing_save.pt.swap(m_queued_saves.front().pt);
+            m_queued_saves.pop_front();
+            m_bIsWriting = true;
+
+            lock.unlock();
+            write_config_file(m_writing_save.config_file_base, m_writing_save.pt);
+            lock.lock();
+
+            m_bIsWriting = false;
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<PendingSave> m_queued_saves;
+    PendingSave m_writing_save;
+    bool m_bExitRequested;
+    bool m_bIsWriting;
+    std::thread m_thread;
+};
+
+// Only ever started, stopped and saved to from the main thread
+static ConfigSaveThread *g_config_save_thread = nullptr;
+
+// Configs saved during the open save batch (main thread only)
+static int g_save_batch_depth = 0;
+static std::vector<PSMoveConfig *> g_batched_save_configs;
+
 PSMoveConfig::PSMoveConfig(const std::string &fnamebase)
 : ConfigFileBase(fnamebase)
 {
 }
 
 const std::string
-PSMoveConfig::getConfigPath()
+PSMoveConfig::getConfigDirectoryPath()
 {
+    if (!g_config_directory_override.empty())
+    {
+        boost::filesystem::create_directories(g_config_directory_override);
+
+        return g_config_directory_override;
+    }
+
     const char *homedir;
 #ifdef _WIN32
     size_t homedir_buffer_req_size;
@@ -47,15 +509,108 @@ PSMoveConfig::getConfigPath()
     boost::filesystem::path configpath(homedir);
     configpath /= "PSMoveService";
     boost::filesystem::create_directory(configpath);
-    configpath /= ConfigFileBase + ".json";
-    std::cout << "Config file name: " << configpath << std::endl;
+
     return configpath.string();
 }
 
+void
+PSMoveConfig::setConfigDirectoryOverride(const std::string &directory_path)
+{
+    g_config_directory_override = directory_path;
+}
+
+void
+PSMoveConfig::startAsyncSaves()
+{
+    if (g_config_save_thread == nullptr)
+    {
+        g_config_save_thread = new ConfigSaveThread();
+    }
+}
+
+void
+PSMoveConfig::stopAsyncSaves()
+{
+    if (g_config_save_thread != nullptr)
+    {
+        delete g_config_save_thread;
+        g_config_save_thread = nullptr;
+    }
+}
+
+const std::string
+PSMoveConfig::getConfigPath()
+{
+    return make_config_path(ConfigFileBase);
+}
+
+void
+PSMoveConfig::beginSaveBatch()
+{
+    ++g_save_batch_depth;
+}
+
+void
+PSMoveConfig::endSaveBatch()
+{
+    assert(g_save_batch_depth > 0);
+
+    if (--g_save_batch_depth == 0)
+    {
+        std::vector<PSMoveConfig *> batched_configs;
+        batched_configs.swap(g_batched_save_configs);
+
+        for (PSMoveConfig *config : batched_configs)
+        {
+            config->saveNow();
+        }
+    }
+}
+
+bool
+PSMoveConfig::getIsSaveBatchOpen()
+{
+    return g_save_batch_depth > 0;
+}
+
 void
 PSMoveConfig::save()
 {
-    boost::property_tree::write_json(getConfigPath(), config2ptree());
+    if (g_save_batch_depth > 0)
+    {
+        if (std::find(g_batched_save_configs.begin(), g_batched_save_configs.end(), this) == g_batched_save_configs.end())
+        {
+            g_batched_save_configs.push_back(this);
+        }
+    }
+    else
+    {
+        saveNow();
+    }
+}
+
+void
+PSMoveConfig::saveNow()
+{
+    const boost::property_tree::ptree pt = config2ptree();
+
+    if (g_config_save_thread != nullptr)
+    {
+        g_config_save_thread->queue_save(ConfigFileBase, pt);
+    }
+    else
+    {
+        write_config_file(ConfigFileBase, pt);
+    }
+
+    // Configs first written after a recording started still need to end up in the log
+    if (DeviceInputLog::get_mode() == DeviceInputLogMode_Recording)
+    {
+        std::ostringstream json;
+
+        boost::property_tree::write_json(json, pt);
+        DeviceInputLog::record_config_file(ConfigFileBase, json.str());
+    }
 }
 
 bool
@@ -63,14 +618,40 @@ PSMoveConfig::load()
 {
     bool bLoadedOk = false;
     boost::property_tree::ptree pt;
-    std::string configPath = getConfigPath();
 
-    if ( boost::filesystem::exists( configPath ) )
+    // Don't read back around a save the open batch is still holding on to
+    std::vector<PSMoveConfig *>::iterator batched_config =
+        std::find(g_batched_save_configs.begin(), g_batched_save_configs.end(), this);
+    if (batched_config != g_batched_save_configs.end())
+    {
+        g_batched_save_configs.erase(batched_config);
+        saveNow();
+    }
+
+    // A save that hasn't made it to disk yet is newer than the file
+    if (g_config_save_thread != nullptr && g_config_save_thread->try_get_unwritten_config(ConfigFileBase, pt))
     {
-        boost::property_tree::read_json(configPath, pt);
         ptree2config(pt);
         bLoadedOk = true;
     }
+    else
+    {
+        std::string configPath = getConfigPath();
+
+        if ( boost::filesystem::exists( configPath ) )
+        {
+            // Parsing the JSON of a config with lots of color tables is slow,
+            // the snapshot taken the last time the file got loaded or saved holds the same tree
+            if (!read_config_snapshot(ConfigFileBase, configPath, pt))
+            {
+                boost::property_tree::read_json(configPath, pt);
+                write_config_snapshot(ConfigFileBase, configPath, pt);
+            }
+
+            ptree2config(pt);
+            bLoadedOk = true;
+        }
+    }
 
     return bLoadedOk;
 }
@@ -173,6 +754,51 @@ PSMoveConfig::readTrackingColor(
 	return tracking_color_id;
 }
 
+void
+PSMoveConfig::writeVisionPriority(
+	boost::property_tree::ptree &pt,
+	int vision_priority)
+{
+	switch (vision_priority)
+	{
+	case eCommonVisionPriority::VisionPriority_Low:
+		pt.put("vision_priority", "low");
+		break;
+	case eCommonVisionPriority::VisionPriority_Normal:
+		pt.put("vision_priority", "normal");
+		break;
+	case eCommonVisionPriority::VisionPriority_High:
+		pt.put("vision_priority", "high");
+		break;
+	default:
+		assert(false && "unreachable");
+	}
+}
+
+int
+PSMoveConfig::readVisionPriority(
+	const boost::property_tree::ptree &pt,
+	int default_vision_priority)
+{
+	std::string vision_priority_string = pt.get<std::string>("vision_priority", "");
+	int vision_priority = default_vision_priority;
+
+	if (vision_priority_string == "low")
+	{
+		vision_priority = eCommonVisionPriority::VisionPriority_Low;
+	}
+	else if (vision_priority_string == "normal")
+	{
+		vision_priority = eCommonVisionPriority::VisionPriority_Normal;
+	}
+	else if (vision_priority_string == "high")
+	{
+		vision_priority = eCommonVisionPriority::VisionPriority_High;
+	}
+
+	return vision_priority;
+}
+
 static void
 writeColorPropertyPreset(
     boost::property_tree::ptree &pt,
@@ -42,8 +42,35 @@ public:
 	static void writeTrackingColor(boost::property_tree::ptree &pt, int tracking_color_id);
 	static int readTrackingColor(const boost::property_tree::ptree &pt);
 
+	// Stored as "low", "normal" or "high" (see eCommonVisionPriority)
+	static void writeVisionPriority(boost::property_tree::ptree &pt, int vision_priority);
+	static int readVisionPriority(const boost::property_tree::ptree &pt, int default_vision_priority);
+
+    // The directory all of the service config files (and other cached data) live in
+    static const std::string getConfigDirectoryPath();
+
+    // Point every config at another directory (empty restores the default).
+    // Used by tools that must not touch the user's service config.
+    static void setConfigDirectoryOverride(const std::string &directory_path);
+
+    // Hand the file writes of save() to a background thread so saving a config
+    // never stalls the main loop. Bursts of saves to one config get written once, shortly after.
+    // Until started (tools, tests) save() writes the file before returning.
+    static void startAsyncSaves();
+
+    // Writes out whatever saves are still queued and stops the save thread
+    static void stopAsyncSaves();
+
+    // Between these, save() only notes the config down and each noted config
+    // gets saved once when the outermost batch ends. Main thread only.
+    static void beginSaveBatch();
+    static void endSaveBatch();
+    // Configs may only get loaded or saved off the main thread while no batch is open
+    static bool getIsSaveBatchOpen();
+
 private:
     const std::string getConfigPath();
+    void saveNow();
 };
 /*
 Note that PSMoveConfig is an abstract class because it has 2 pure virtual functions.
@@ -37,10 +37,13 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "AtomicPrimitives.h"
 #include "PSMoveController.h"
 #include "ControllerDeviceEnumerator.h"
+#include "DeviceInputLog.h"
 #include "ServerLog.h"
+#include "ServerTrace.h"
 #include "ServerUtility.h"
 #include "BluetoothQueries.h"
 #include "MathAlignment.h"
+#include "CoalescedOutputWriter.h"
 #include "WorkerThread.h"
 
 #include <iostream>
@@ -56,6 +59,8 @@ POSSIBILITY OF SUCH DAMAGE.
 #endif
 #include <math.h>
 
+#include <boost/crc.hpp>
+
 //-- constants -----
 #define PSMOVE_BUFFER_SIZE 49 /* Buffer size for writing LEDs and reading sensor data */
 #define PSMOVE_EXT_DATA_BUF_SIZE 5
@@ -74,7 +79,6 @@ POSSIBILITY OF SUCH DAMAGE.
 #define PSMOVE_TRACKING_BULB_OFFSET  9.f   // The offset of the psmove tracking bulb from center of the controller in cm
 
 /* Minimum time (in milliseconds) psmove write updates */
-#define PSMOVE_WRITE_DATA_INTERVAL_MS 120
 
 /* Decode 12-bit signed value (assuming two's complement) */
 #define TWELVE_BIT_SIGNED(x) (((x) & 0x800)?(-(((~(x)) & 0xFFF) + 1)):(x))
@@ -269,12 +273,15 @@ public:
 
 		}
 
-		memset(&m_previousOutputState, 0, sizeof(PSMoveControllerOutputState));
 	}
 
 	void setConfig(const PSMoveControllerConfig &cfg)
 	{
+		PSMoveSensorDecoder decoder;
+		cfg.getSensorDecoder(m_model, &decoder);
+
 		m_cfg.storeValue(cfg);
+		m_decoder.storeValue(decoder);
 	}
 
 	bool getSupportsMagnetometer() const
@@ -287,11 +294,6 @@ public:
 		m_currentInputState.fetchValue(input_state);
 	}
 
-	void postOutputState(const PSMoveControllerOutputState &output_state)
-	{
-		m_currentOutputState.storeValue(output_state);
-	}
-
     void start(hid_device *in_hid_device, IControllerListener *controller_listener)
     {
 		if (!hasThreadStarted())
@@ -300,13 +302,13 @@ public:
 			m_controllerListener= controller_listener;
 
 			// Perform non-blocking reads during this phase
-			hid_set_nonblocking(m_hidDevice, 1);
+			logged_hid_set_nonblocking(m_hidDevice, 1);
 
 			// See if this controller has a functional magnetometer
 			testMagnetometer();
 
 			// Perform blocking reads on the worker thread
-			hid_set_nonblocking(m_hidDevice, 0);
+			logged_hid_set_nonblocking(m_hidDevice, 0);
 
 			// Fire up the worker thread
 			WorkerThread::startThread();
@@ -326,18 +328,18 @@ protected:
 			const int k_max_poll_attempts = 10;
 			int poll_count = 0;
 
-			PSMoveControllerConfig cfg;
-			m_cfg.fetchValue(cfg);
+			PSMoveSensorDecoder decoder;
+			m_decoder.fetchValue(decoder);
 
 			for (poll_count = 0; poll_count < k_max_poll_attempts; ++poll_count)
 			{
 				PSMoveDataInput rawHIDPacket;
-				int res = hid_read(m_hidDevice, (unsigned char*)&rawHIDPacket.data.zcm1, sizeof(PSMoveDataInputZCM1));
+				int res = logged_hid_read(m_hidDevice, (unsigned char*)&rawHIDPacket.data.zcm1, sizeof(PSMoveDataInputZCM1));
 
 				if (res > 0)
 				{
 					PSMoveControllerInputState newState;
-					newState.parseDataInput(&cfg, nullptr, &rawHIDPacket.data.zcm1);
+					newState.parseDataInput(&decoder, nullptr, &rawHIDPacket.data.zcm1);
 
 					// See if we are getting valid magnetometer data
 					m_bSupportsMagnetometer = 
@@ -364,21 +366,31 @@ protected:
 		PSMoveControllerConfig cfg;
 		m_cfg.fetchValue(cfg);
 
+		PSMoveSensorDecoder decoder;
+		m_decoder.fetchValue(decoder);
+
 		// Attempt to read the next sensor update packet from the HMD
         int res = -1;
-		if (m_model == _psmove_controller_ZCM2)
-		{
-			memcpy(&m_previousHIDInputPacket.data.zcm2, &m_currentHIDInputPacket.data.zcm2, sizeof(PSMoveDataInputZCM2));
-			res= hid_read_timeout(m_hidDevice, (unsigned char*)&m_currentHIDInputPacket.data.zcm2, sizeof(PSMoveDataInputZCM2), cfg.poll_timeout_ms);
-		}
-		else
 		{
-			memcpy(&m_previousHIDInputPacket.data.zcm1, &m_currentHIDInputPacket.data.zcm1, sizeof(PSMoveDataInputZCM1));
-			res= hid_read_timeout(m_hidDevice, (unsigned char*)&m_currentHIDInputPacket.data.zcm1, sizeof(PSMoveDataInputZCM1), cfg.poll_timeout_ms);
+			SERVER_TRACE_SCOPE(ServerTraceStage_HIDRead);
+
+			if (m_model == _psmove_controller_ZCM2)
+			{
+				memcpy(&m_previousHIDInputPacket.data.zcm2, &m_currentHIDInputPacket.data.zcm2, sizeof(PSMoveDataInputZCM2));
+				res= logged_hid_read_timeout(m_hidDevice, (unsigned char*)&m_currentHIDInputPacket.data.zcm2, sizeof(PSMoveDataInputZCM2), cfg.poll_timeout_ms);
+			}
+			else
+			{
+				memcpy(&m_previousHIDInputPacket.data.zcm1, &m_currentHIDInputPacket.data.zcm1, sizeof(PSMoveDataInputZCM1));
+				res= logged_hid_read_timeout(m_hidDevice, (unsigned char*)&m_currentHIDInputPacket.data.zcm1, sizeof(PSMoveDataInputZCM1), cfg.poll_timeout_ms);
+			}
 		}
 
 		if (res > 0)
 		{
+			// Stamp the packet as soon as the read completes so main loop jitter doesn't leak into the filter
+			const std::chrono::time_point<std::chrono::high_resolution_clock> capture_time= std::chrono::high_resolution_clock::now();
+
 			// https://github.com/hrl7/node-psvr/blob/master/lib/psvr.js
 			PSMoveControllerInputState newState;
 
@@ -388,9 +400,10 @@ protected:
 
 			// Processes the IMU data
 			if (m_model == _psmove_controller_ZCM2)
-				newState.parseDataInput(&cfg, &m_previousHIDInputPacket.data.zcm2, &m_currentHIDInputPacket.data.zcm2);
+				newState.parseDataInput(&decoder, &m_previousHIDInputPacket.data.zcm2, &m_currentHIDInputPacket.data.zcm2);
 			else
-				newState.parseDataInput(&cfg, &m_previousHIDInputPacket.data.zcm1, &m_currentHIDInputPacket.data.zcm1);
+				newState.parseDataInput(&decoder, &m_previousHIDInputPacket.data.zcm1, &m_currentHIDInputPacket.data.zcm1);
+			newState.CaptureTimestamp= capture_time;
 
 			// Store a copy of the parsed input date for functions
 			// that want to query input state off of the worker thread
@@ -406,7 +419,7 @@ protected:
 		{
 			char hidapi_err_mbs[256];
 			bool valid_error_mesg = 
-				ServerUtility::convert_wcs_to_mbs(hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
+				ServerUtility::convert_wcs_to_mbs(logged_hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
 
 			// Device no longer in valid state.
 			if (valid_error_mesg)
@@ -418,61 +431,6 @@ protected:
 			return false;
 		}
 
-        // Don't send output writes too frequently
-        {
-            std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
-
-            // See if it's time to update the LED/rumble state
-            std::chrono::duration<double, std::milli> led_update_diff = now - m_lastHIDOutputTimestamp;
-            if (led_update_diff.count() >= PSMOVE_WRITE_DATA_INTERVAL_MS)
-            {
-				PSMoveControllerOutputState output_state;
-				m_currentOutputState.fetchValue(output_state);
-
-				const bool bWriteStateChanged=
-					output_state.r != m_previousOutputState.r ||
-					output_state.g != m_previousOutputState.g ||
-					output_state.b != m_previousOutputState.b ||
-					output_state.rumble != m_previousOutputState.rumble;
-				const bool bWriteStateNonZero=
-					output_state.r != 0 ||
-					output_state.g != 0 ||
-					output_state.b != 0 ||
-					output_state.rumble != 0;
-
-				if (bWriteStateChanged || bWriteStateNonZero)
-				{
-					PSMoveDataOutput data_out;
-					memset(&data_out, 0, sizeof(PSMoveDataOutput));
-					data_out.type = PSMove_Req_SetLEDs;
-					data_out.r = output_state.r;
-					data_out.g = output_state.g;
-					data_out.b = output_state.b;
-					data_out.rumble = output_state.rumble;
-					data_out.rumble2 = 0x00;
-
-					res = hid_write(m_hidDevice, (unsigned char*)(&data_out), sizeof(data_out));
-					if (res > 0)
-					{
-						m_previousOutputState= output_state;
-						m_lastHIDOutputTimestamp = now;
-					}
-					else
-					{
-						char hidapi_err_mbs[256];
-						bool valid_error_mesg = 
-							ServerUtility::convert_wcs_to_mbs(hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
-
-						// Device no longer in valid state.
-						if (valid_error_mesg)
-						{
-							SERVER_MT_LOG_ERROR("PSMoveSensorProcessor::doWork") << "HID ERROR: " << hidapi_err_mbs;
-						}
-					}
-				}
-            }
-        }
-
 		return true;
     }
 
@@ -482,15 +440,85 @@ protected:
 	IControllerListener *m_controllerListener;
 	bool m_bSupportsMagnetometer;
 	AtomicObject<PSMoveControllerInputState> m_currentInputState;
-	AtomicObject<PSMoveControllerOutputState> m_currentOutputState;
 	AtomicObject<PSMoveControllerConfig> m_cfg;
+	AtomicObject<PSMoveSensorDecoder> m_decoder;
 
     // Worker thread state
     int m_nextPollSequenceNumber;
 	PSMoveDataInput m_previousHIDInputPacket;
     PSMoveDataInput m_currentHIDInputPacket;
-	std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHIDOutputTimestamp;
-	PSMoveControllerOutputState m_previousOutputState;
+};
+
+// Sends the LED/rumble output reports on their own thread so they never hold up the sensor reads
+class PSMoveHidOutputWriter : public CoalescedOutputWriter<PSMoveControllerOutputState>
+{
+public:
+	PSMoveHidOutputWriter()
+		: CoalescedOutputWriter<PSMoveControllerOutputState>("PSMoveOutputWriter")
+		, m_hidDevice(nullptr)
+	{
+	}
+
+	void setConfig(const PSMoveControllerConfig &cfg)
+	{
+		setIntervals(cfg.output_write_interval_ms, cfg.led_keepalive_interval_ms);
+	}
+
+	void start(hid_device *in_hid_device)
+	{
+		if (!hasThreadStarted())
+		{
+			m_hidDevice= in_hid_device;
+
+			WorkerThread::startThread();
+		}
+	}
+
+	void stop()
+	{
+		WorkerThread::stopThread();
+	}
+
+protected:
+	virtual bool getNeedsKeepalive(const PSMoveControllerOutputState &output_state) const override
+	{
+		return 
+			output_state.r != 0 ||
+			output_state.g != 0 ||
+			output_state.b != 0 ||
+			output_state.rumble != 0;
+	}
+
+	virtual bool writeOutputState(const PSMoveControllerOutputState &output_state) override
+	{
+		PSMoveDataOutput data_out;
+		memset(&data_out, 0, sizeof(PSMoveDataOutput));
+		data_out.type = PSMove_Req_SetLEDs;
+		data_out.r = output_state.r;
+		data_out.g = output_state.g;
+		data_out.b = output_state.b;
+		data_out.rumble = output_state.rumble;
+		data_out.rumble2 = 0x00;
+
+		const int res = logged_hid_write(m_hidDevice, (unsigned char*)(&data_out), sizeof(data_out));
+		if (res <= 0)
+		{
+			char hidapi_err_mbs[256];
+			bool valid_error_mesg = 
+				ServerUtility::convert_wcs_to_mbs(logged_hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
+
+			// Device no longer in valid state.
+			if (valid_error_mesg)
+			{
+				SERVER_MT_LOG_ERROR("PSMoveOutputWriter::writeOutputState") << "HID ERROR: " << hidapi_err_mbs;
+			}
+		}
+
+		return res > 0;
+	}
+
+	// Multi-threaded state
+	hid_device *m_hidDevice;
 };
 
 // -- private prototypes -----
@@ -498,7 +526,6 @@ static std::string PSMoveBTAddrUcharToString(const unsigned char* addr_buff);
 static bool stringToPSMoveBTAddrUchar(const std::string &addr, unsigned char *addr_buff, const int addr_buf_size);
 static short decode16bitSigned(char *data, int offset);
 static int decode16bitUnsignedToSigned(char *data, int offset);
-static int decode16bitTwosCompliment(char *data, int offset);
 inline enum CommonControllerState::ButtonState getButtonState(unsigned int buttons, unsigned int lastButtons, int buttonMask);
 inline unsigned int make_psmove_button_bitmask(const PSMoveDataInputZCM1 *hid_packet);
 inline unsigned int make_psmove_button_bitmask(const PSMoveDataInputZCM2 *hid_packet);
@@ -524,8 +551,11 @@ PSMoveControllerConfig::config2ptree()
 	pt.put("firmware_revision", firmware_revision);
 
     pt.put("prediction_time", prediction_time);
+    writeVisionPriority(pt, vision_priority);
 	pt.put("max_poll_failure_count", max_poll_failure_count);
     pt.put("poll_timeout_ms", poll_timeout_ms);
+    pt.put("output_write_interval_ms", output_write_interval_ms);
+    pt.put("led_keepalive_interval_ms", led_keepalive_interval_ms);
     
     pt.put("Calibration.Accel.X.k", cal_ag_xyz_kbd[0][0][0]);
     pt.put("Calibration.Accel.X.b", cal_ag_xyz_kbd[0][0][1]);
@@ -546,6 +576,9 @@ PSMoveControllerConfig::config2ptree()
     pt.put("Calibration.Gyro.Z.k", cal_ag_xyz_kbd[1][2][0]);
     pt.put("Calibration.Gyro.Z.b", cal_ag_xyz_kbd[1][2][1]);
 	pt.put("Calibration.Gyro.Z.d", cal_ag_xyz_kbd[1][2][2]);
+    pt.put("Calibration.UseCachedBlob", use_cached_calibration_blob);
+    pt.put("Calibration.Blob", calibration_blob);
+    pt.put("Calibration.BlobCRC32", calibration_blob_crc32);
 
     pt.put("Calibration.Gyro.Variance", gyro_variance);
     pt.put("Calibration.Gyro.Drift", gyro_drift);
@@ -608,8 +641,11 @@ PSMoveControllerConfig::ptree2config(const boost::property_tree::ptree &pt)
 		firmware_revision = pt.get<unsigned short>("firmware_revision", 0);
 
         prediction_time = pt.get<float>("prediction_time", 0.f);
+        vision_priority = static_cast<eCommonVisionPriority>(readVisionPriority(pt, VisionPriority_Normal));
 		max_poll_failure_count = pt.get<long>("max_poll_failure_count", 100);
         poll_timeout_ms = pt.get<long>("poll_timeout_ms", 1000);
+        output_write_interval_ms = pt.get<int>("output_write_interval_ms", 120);
+        led_keepalive_interval_ms = pt.get<int>("led_keepalive_interval_ms", 2000);
 
         cal_ag_xyz_kbd[0][0][0] = pt.get<float>("Calibration.Accel.X.k", 1.0f);
         cal_ag_xyz_kbd[0][0][1] = pt.get<float>("Calibration.Accel.X.b", 0.0f);
@@ -633,6 +669,9 @@ PSMoveControllerConfig::ptree2config(const boost::property_tree::ptree &pt)
         cal_ag_xyz_kbd[1][2][0] = pt.get<float>("Calibration.Gyro.Z.k", 1.0f);
         cal_ag_xyz_kbd[1][2][1] = pt.get<float>("Calibration.Gyro.Z.b", 0.0f);
 		cal_ag_xyz_kbd[1][2][2] = pt.get<float>("Calibration.Gyro.Z.d", 0.0f);
+        use_cached_calibration_blob = pt.get<bool>("Calibration.UseCachedBlob", use_cached_calibration_blob);
+        calibration_blob = pt.get<std::string>("Calibration.Blob", "");
+        calibration_blob_crc32 = pt.get<unsigned int>("Calibration.BlobCRC32", 0);
 
         gyro_variance= pt.get<float>("Calibration.Gyro.Variance", gyro_variance);
         gyro_drift= pt.get<float>("Calibration.Gyro.Drift", gyro_drift);
@@ -704,6 +743,111 @@ PSMoveControllerConfig::getMagnetometerEllipsoid(struct EigenFitEllipsoid *out_e
     out_ellipsoid->error= magnetometer_fit_error;
 }
 
+void
+PSMoveControllerConfig::getSensorDecoder(PSMoveControllerModelPID model, PSMoveSensorDecoder *out_decoder) const
+{
+    IMUSensorDecoder *sensor_decoders[2]= { &out_decoder->imu.accelerometer, &out_decoder->imu.gyroscope };
+
+    if (model == _psmove_controller_ZCM2)
+    {
+        // One frame of two's complement values
+        const int sensor_offsets[2]= { offsetof(PSMoveDataInputZCM2, aXlow), offsetof(PSMoveDataInputZCM2, gXlow) };
+
+        for (int s_ix = 0; s_ix < 2; ++s_ix)
+        {
+            sensor_decoders[s_ix]->setLayout(
+                IMURawEncoding_Signed16, sensor_offsets[s_ix], sensor_offsets[s_ix] + 2, sensor_offsets[s_ix] + 4);
+        }
+
+        out_decoder->imu.frame_count= 1;
+        out_decoder->imu.frame_stride= 0;
+    }
+    else
+    {
+        // Two frames (older, newer) of offset binary values, 6 bytes apart
+        const int sensor_offsets[2]= { offsetof(PSMoveDataInputZCM1, aXlow), offsetof(PSMoveDataInputZCM1, gXlow) };
+
+        for (int s_ix = 0; s_ix < 2; ++s_ix)
+        {
+            sensor_decoders[s_ix]->setLayout(
+                IMURawEncoding_Unsigned16, sensor_offsets[s_ix], sensor_offsets[s_ix] + 2, sensor_offsets[s_ix] + 4);
+        }
+
+        out_decoder->imu.frame_count= 2;
+        out_decoder->imu.frame_stride= 6;
+    }
+
+    // calibrated= (raw - drift)*scale + offset = raw*scale + (offset - drift*scale)
+    for (int s_ix = 0; s_ix < 2; ++s_ix)
+    {
+        for (int d_ix = 0; d_ix < 3; ++d_ix)
+        {
+            const float k = cal_ag_xyz_kbd[s_ix][d_ix][0]; // calibration scale
+            const float b = cal_ag_xyz_kbd[s_ix][d_ix][1]; // calibration offset
+            const float d = cal_ag_xyz_kbd[s_ix][d_ix][2]; // calibration drift
+
+            sensor_decoders[s_ix]->setAxisCalibration(d_ix, k, b - d*k);
+        }
+    }
+
+    EigenFitEllipsoid ellipsoid;
+    getMagnetometerEllipsoid(&ellipsoid);
+    out_decoder->magnetometer.setFromEllipsoid(ellipsoid.center, ellipsoid.basis, ellipsoid.extents);
+}
+
+bool
+PSMoveControllerConfig::getCachedCalibrationBlob(unsigned char *out_blob, size_t blob_size) const
+{
+    bool bSuccess= false;
+
+    if (use_cached_calibration_blob && calibration_blob.length() == blob_size*2)
+    {
+        bSuccess= true;
+
+        for (size_t byte_index= 0; bSuccess && byte_index < blob_size; ++byte_index)
+        {
+            char *end= nullptr;
+            const char hex_byte[3]= { calibration_blob[byte_index*2], calibration_blob[byte_index*2+1], '\0' };
+            const long value= strtol(hex_byte, &end, 16);
+
+            if (end == hex_byte + 2)
+            {
+                out_blob[byte_index]= static_cast<unsigned char>(value);
+            }
+            else
+            {
+                bSuccess= false;
+            }
+        }
+
+        if (bSuccess)
+        {
+            boost::crc_32_type crc;
+            crc.process_bytes(out_blob, blob_size);
+
+            bSuccess= (crc.checksum() == calibration_blob_crc32);
+        }
+    }
+
+    return bSuccess;
+}
+
+void
+PSMoveControllerConfig::setCachedCalibrationBlob(const unsigned char *blob, size_t blob_size)
+{
+    std::stringstream hex_stream;
+    for (size_t byte_index= 0; byte_index < blob_size; ++byte_index)
+    {
+        hex_stream << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(blob[byte_index]);
+    }
+
+    boost::crc_32_type crc;
+    crc.process_bytes(blob, blob_size);
+
+    calibration_blob= hex_stream.str();
+    calibration_blob_crc32= crc.checksum();
+}
+
 // -- PSMoveControllerInputState -----
 PSMoveControllerInputState::PSMoveControllerInputState()
 {
@@ -745,7 +889,7 @@ void PSMoveControllerInputState::clear()
 }
 
 void PSMoveControllerInputState::parseDataInput(
-	const PSMoveControllerConfig *config,
+	const PSMoveSensorDecoder *decoder,
 	const PSMoveDataInputZCM1 *previous_hid_packet,
 	const PSMoveDataInputZCM1 *current_hid_input)
 {
@@ -767,64 +911,17 @@ void PSMoveControllerInputState::parseDataInput(
 	TriggerValue = (current_hid_input->trigger + current_hid_input->trigger2) / 2; // TODO: store each frame separately
     BatteryValue = (current_hid_input->battery);
 
-    // Update raw and calibrated accelerometer and gyroscope state
+    // Update raw and calibrated accelerometer and gyroscope state (older frame, then newer frame)
+    for (int f_ix = 0; f_ix < decoder->imu.frame_count; f_ix++)
     {
-        // Access raw Accel and Gyro state from the DataInput struct as a byte array
-        char* data = (char *)current_hid_input;
-
-        // Extract Accelerometer and Gyroscope readings into in a set of two update frames.
-        // Note: The double brackets are an oddity of C++11 static array initialization.
-        std::array<std::array<std::array<int, 3>, 2>, 2> ag_raw_xyz = {{
-            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }},
-            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }}
-        }};
-        std::array<std::array<std::array<float, 3>, 2>, 2> ag_calibrated_xyz = {{
-            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }},
-            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }}
-        }};
-        std::array<int, 2> sensorOffsets = {{
-            offsetof(PSMoveDataInputZCM1, aXlow),
-            offsetof(PSMoveDataInputZCM1, gXlow)
-        }};
-
-	    std::array<int, 2> frameOffsets = {{ 0, 6 }};
-		for (std::array<int, 2>::size_type s_ix = 0; s_ix != sensorOffsets.size(); s_ix++) //accel, gyro
-		{
-			for (std::array<int, 2>::size_type f_ix = 0; f_ix != frameOffsets.size(); f_ix++) //older, newer
-			{
-				for (int d_ix = 0; d_ix < 3; d_ix++)  //x, y, z
-				{
-					// Offset into PSMoveDataInput
-					const int totalOffset = sensorOffsets[s_ix] + frameOffsets[f_ix] + 2 * d_ix;
-
-					// Extract the raw signed 16-bit sensor value from the PSMoveDataInput packet
-					const int raw_val = decode16bitUnsignedToSigned(data, totalOffset);
-
-					// Get the calibration parameters for this sensor value
-					const float k = config->cal_ag_xyz_kbd[s_ix][d_ix][0]; // calibration scale
-					const float b = config->cal_ag_xyz_kbd[s_ix][d_ix][1]; // calibration offset
-					const float d = config->cal_ag_xyz_kbd[s_ix][d_ix][2]; // calibration drift
-					const float calibrated_val= (static_cast<float>(raw_val) - d)*k + b;
-
-					// Save the raw sensor value
-					ag_raw_xyz[s_ix][f_ix][d_ix] = raw_val;
-
-					// Compute the calibrated sensor value
-					ag_calibrated_xyz[s_ix][f_ix][d_ix] = calibrated_val;
-				}
-			}
-		}
-
-        RawAccel = ag_raw_xyz[0];
-        RawGyro = ag_raw_xyz[1];
-
-        CalibratedAccel = ag_calibrated_xyz[0];
-        CalibratedGyro = ag_calibrated_xyz[1];
+        decoder->imu.decodeFrame(
+            current_hid_input, f_ix,
+            RawAccel[f_ix].data(), CalibratedAccel[f_ix].data(),
+            RawGyro[f_ix].data(), CalibratedGyro[f_ix].data());
     }
 
     {
         Eigen::Vector3f raw_mag, calibrated_mag;
-        EigenFitEllipsoid ellipsoid;
 
         // Save the Raw Magnetometer sensor value (signed 12-bit values)
         RawMag[0] = TWELVE_BIT_SIGNED(((current_hid_input->templow_mXhigh & 0x0F) << 8) | current_hid_input->mXlow);
@@ -837,8 +934,7 @@ void PSMoveControllerInputState::parseDataInput(
         raw_mag = 
             Eigen::Vector3f(
                 static_cast<float>(RawMag[0]), static_cast<float>(RawMag[1]), static_cast<float>(RawMag[2]));
-        config->getMagnetometerEllipsoid(&ellipsoid);
-        calibrated_mag= eigen_alignment_project_point_on_ellipsoid_basis(raw_mag, ellipsoid);
+        calibrated_mag= decoder->magnetometer.apply(raw_mag);
 
         // Normalize the projected measurement (any deviation from unit length is error)
 		eigen_vector3f_normalize_with_default(calibrated_mag, Eigen::Vector3f(0.f, 1.f, 0.f));
@@ -857,7 +953,7 @@ void PSMoveControllerInputState::parseDataInput(
 }
 
 void PSMoveControllerInputState::parseDataInput(
-	const PSMoveControllerConfig *config,
+	const PSMoveSensorDecoder *decoder,
 	const PSMoveDataInputZCM2 *previous_hid_packet,
 	const PSMoveDataInputZCM2 *current_hid_input)
 {
@@ -880,60 +976,15 @@ void PSMoveControllerInputState::parseDataInput(
     BatteryValue = (current_hid_input->battery);
 
     // Update raw and calibrated accelerometer and gyroscope state
-    {
-        // Access raw Accel and Gyro state from the DataInput struct as a byte array
-        char* data = (char *)current_hid_input;
-
-        // Extract Accelerometer and Gyroscope readings into in a set of two update frames.
-        // Note: The double brackets are an oddity of C++11 static array initialization.
-        std::array<std::array<std::array<int, 3>, 2>, 2> ag_raw_xyz = {{
-            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }},
-            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }}
-        }};
-        std::array<std::array<std::array<float, 3>, 2>, 2> ag_calibrated_xyz = {{
-            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }},
-            {{ {{ 0, 0, 0 }}, {{ 0, 0, 0 }} }}
-        }};
-        std::array<int, 2> sensorOffsets = {{
-            offsetof(PSMoveDataInputZCM2, aXlow),
-            offsetof(PSMoveDataInputZCM2, gXlow)
-        }};
-
-		for (std::array<int, 2>::size_type s_ix = 0; s_ix != sensorOffsets.size(); s_ix++) //accel, gyro
-		{
-			for (int d_ix = 0; d_ix < 3; d_ix++)  //x, y, z
-			{
-				// Offset into PSMoveDataInput
-				const int totalOffset = sensorOffsets[s_ix] + 2 * d_ix;
-
-				// Extract the raw signed 16-bit sensor value from the PSMoveDataInput packet
-				const int raw_val = decode16bitTwosCompliment(data, totalOffset);
-
-				// Get the calibration parameters for this sensor value
-				const float k = config->cal_ag_xyz_kbd[s_ix][d_ix][0]; // calibration scale
-				const float b = config->cal_ag_xyz_kbd[s_ix][d_ix][1]; // calibration offset
-				const float d = config->cal_ag_xyz_kbd[s_ix][d_ix][2]; // calibration drift
-				const float calibrated_val= (static_cast<float>(raw_val) - d)*k + b;
-
-				// Save the raw sensor value
-				// Frame 0 and Frame 1 are the same
-				ag_raw_xyz[s_ix][0][d_ix] = raw_val;
-				ag_raw_xyz[s_ix][1][d_ix] = raw_val;
-
-				// Compute the calibrated sensor value
-				// Frame 0 and Frame 1 are the same
-				ag_calibrated_xyz[s_ix][0][d_ix] = calibrated_val;
-				ag_calibrated_xyz[s_ix][1][d_ix] = calibrated_val;
-			}
-		}
-
-
-        RawAccel = ag_raw_xyz[0];
-        RawGyro = ag_raw_xyz[1];
-
-        CalibratedAccel = ag_calibrated_xyz[0];
-        CalibratedGyro = ag_calibrated_xyz[1];
-    }
+    // ZCM2 only sends one frame, Frame 0 and Frame 1 are the same
+    decoder->imu.decodeFrame(
+        current_hid_input, 0,
+        RawAccel[0].data(), CalibratedAccel[0].data(),
+        RawGyro[0].data(), CalibratedGyro[0].data());
+    RawAccel[1] = RawAccel[0];
+    RawGyro[1] = RawGyro[0];
+    CalibratedAccel[1] = CalibratedAccel[0];
+    CalibratedGyro[1] = CalibratedGyro[0];
 
 	// ZCM2 - Doesn't have a magnetometer
 	RawMag[0] = RawMag[1] = RawMag[2]= 0;
@@ -961,6 +1012,7 @@ void PSMoveControllerOutputState::clear()
 // -- PSMove Controller -----
 PSMoveController::PSMoveController()
     : m_HIDPacketProcessor(nullptr)
+	, m_HIDOutputWriter(nullptr)
 	, m_controllerListener(nullptr)
 {
 	HIDDetails.vendor_id = -1;
@@ -982,6 +1034,11 @@ PSMoveController::~PSMoveController()
 	{
 		delete m_HIDPacketProcessor;
 	}
+
+	if (m_HIDOutputWriter)
+	{
+		delete m_HIDOutputWriter;
+	}
 }
 
 bool PSMoveController::open()
@@ -1057,10 +1114,10 @@ bool PSMoveController::open(
         HIDDetails.Device_path_addr.replace(HIDDetails.Device_path_addr.find("&col01#"), 7, "&col02#");
 		//HIDDetails.Device_path_addr.replace(HIDDetails.Device_path_addr.find("&Col01#"), 7, "&Col02#");
         HIDDetails.Device_path_addr.replace(HIDDetails.Device_path_addr.find("&0000#"), 6, "&0001#");
-        HIDDetails.Handle_addr = hid_open_path(HIDDetails.Device_path_addr.c_str());
-        hid_set_nonblocking(HIDDetails.Handle_addr, 1);
+        HIDDetails.Handle_addr = logged_hid_open_path(HIDDetails.Device_path_addr.c_str());
+        logged_hid_set_nonblocking(HIDDetails.Handle_addr, 1);
     #endif
-        HIDDetails.Handle = hid_open_path(HIDDetails.Device_path.c_str());
+        HIDDetails.Handle = logged_hid_open_path(HIDDetails.Device_path.c_str());
          
         // On my Mac, using bluetooth,
         // cur_dev->path = Bluetooth_054c_03d5_779732e8
@@ -1137,6 +1194,11 @@ bool PSMoveController::open(
 			m_HIDPacketProcessor= new PSMoveHidPacketProcessor(cfg, (PSMoveControllerModelPID)HIDDetails.product_id);
 			m_HIDPacketProcessor->start(HIDDetails.Handle, m_controllerListener);
 
+			// Create the LED/rumble output thread
+			m_HIDOutputWriter= new PSMoveHidOutputWriter();
+			m_HIDOutputWriter->setConfig(cfg);
+			m_HIDOutputWriter->start(HIDDetails.Handle);
+
 			if (bSaveConfig)
 			{
 				cfg.save();
@@ -1166,15 +1228,23 @@ void PSMoveController::close()
 			m_HIDPacketProcessor= nullptr;
 		}
 
+		if (m_HIDOutputWriter != nullptr)
+		{
+			// halt the LED/rumble output thread
+			m_HIDOutputWriter->stop();
+			delete m_HIDOutputWriter;
+			m_HIDOutputWriter= nullptr;
+		}
+
         if (HIDDetails.Handle != nullptr)
         {
-            hid_close(HIDDetails.Handle);
+            logged_hid_close(HIDDetails.Handle);
             HIDDetails.Handle= nullptr;
         }
 
         if (HIDDetails.Handle_addr != nullptr)
         {
-            hid_close(HIDDetails.Handle_addr);
+            logged_hid_close(HIDDetails.Handle_addr);
             HIDDetails.Handle_addr= nullptr;
         }
     }
@@ -1204,11 +1274,11 @@ PSMoveController::setHostBluetoothAddress(const std::string &new_host_bt_addr)
         /* _WIN32 only has move->handle_addr for getting bluetooth address. */
         if (HIDDetails.Handle_addr) 
         {
-            res = hid_send_feature_report(HIDDetails.Handle_addr, bts, sizeof(bts));
+            res = logged_hid_send_feature_report(HIDDetails.Handle_addr, bts, sizeof(bts));
         } 
         else 
         {
-            res = hid_send_feature_report(HIDDetails.Handle, bts, sizeof(bts));
+            res = logged_hid_send_feature_report(HIDDetails.Handle, bts, sizeof(bts));
         }
 
         if (res == sizeof(bts))
@@ -1405,10 +1475,10 @@ PSMoveController::getBTAddress(std::string& host, std::string& controller)
         
         /* _WIN32 only has move->handle_addr for getting bluetooth address. */
         if (HIDDetails.Handle_addr) {
-            res = hid_get_feature_report(HIDDetails.Handle_addr, btg, expected_res+1);
+            res = logged_hid_get_feature_report(HIDDetails.Handle_addr, btg, expected_res+1);
         }
         else {
-            res = hid_get_feature_report(HIDDetails.Handle, btg, expected_res+1);
+            res = logged_hid_get_feature_report(HIDDetails.Handle, btg, expected_res+1);
         }
         
         if (res > 0)
@@ -1463,10 +1533,17 @@ PSMoveController::loadCalibrationZCM1()
             {{ {{ 1, 0, 0 }}, {{ 1, 0, 0 }}, {{ 1, 0, 0 }} }} 
         }};
 
-    // Load the calibration from the controller itself.
+    // Load the calibration from the controller itself,
+    // unless we already have a copy of it from a previous connection
     unsigned char hid_cal[PSMOVE_ZCM1_CALIBRATION_BLOB_SIZE];
+    const bool bUsedCachedBlob= cfg.getCachedCalibrationBlob(hid_cal, sizeof(hid_cal));
+
+    if (bUsedCachedBlob)
+    {
+        SERVER_LOG_INFO("PSMoveController::loadCalibration") << "Using cached calibration blob for " << HIDDetails.Bt_addr;
+    }
 
-    for (int block_index=0; is_valid && block_index<3; block_index++) 
+    for (int block_index=0; !bUsedCachedBlob && is_valid && block_index<3; block_index++) 
     {
         unsigned char cal[PSMOVE_CALIBRATION_SIZE+1]; // +1 for report id at start
         int dest_offset;
@@ -1479,7 +1556,7 @@ PSMoveController::loadCalibrationZCM1()
         memset(cal, 0, sizeof(cal));
         cal[0] = PSMove_Req_GetCalibration;
 
-        int res = hid_get_feature_report(HIDDetails.Handle, cal, sizeof(cal));
+        int res = logged_hid_get_feature_report(HIDDetails.Handle, cal, sizeof(cal));
 
         if (res == expected_res)
         {
@@ -1529,6 +1606,11 @@ PSMoveController::loadCalibrationZCM1()
         }
     }
 
+    if (is_valid && !bUsedCachedBlob)
+    {
+        cfg.setCachedCalibrationBlob(hid_cal, sizeof(hid_cal));
+    }
+
     if (is_valid)
     {
         memcpy(usb_calibration, hid_cal, PSMOVE_ZCM1_CALIBRATION_BLOB_SIZE);
@@ -1581,10 +1663,17 @@ PSMoveController::loadCalibrationZCM2()
             {{ {{ 1, 0, 0 }}, {{ 1, 0, 0 }}, {{ 1, 0, 0 }} }} 
         }};
 
-    // Load the calibration from the controller itself.
+    // Load the calibration from the controller itself,
+    // unless we already have a copy of it from a previous connection
     unsigned char hid_cal[PSMOVE_ZCM2_CALIBRATION_BLOB_SIZE];
+    const bool bUsedCachedBlob= cfg.getCachedCalibrationBlob(hid_cal, sizeof(hid_cal));
+
+    if (bUsedCachedBlob)
+    {
+        SERVER_LOG_INFO("PSMoveController::loadCalibration") << "Using cached calibration blob for " << HIDDetails.Bt_addr;
+    }
 
-    for (int block_index=0; is_valid && block_index<2; block_index++) 
+    for (int block_index=0; !bUsedCachedBlob && is_valid && block_index<2; block_index++) 
     {
         unsigned char cal[PSMOVE_CALIBRATION_SIZE+1]; // +1 for report id at start
         int dest_offset;
@@ -1597,7 +1686,7 @@ PSMoveController::loadCalibrationZCM2()
         memset(cal, 0, sizeof(cal));
         cal[0] = PSMove_Req_GetCalibration;
 
-        int res = hid_get_feature_report(HIDDetails.Handle, cal, sizeof(cal));
+        int res = logged_hid_get_feature_report(HIDDetails.Handle, cal, sizeof(cal));
 
         if (res == expected_res)
         {
@@ -1641,6 +1730,11 @@ PSMoveController::loadCalibrationZCM2()
         }
     }
 
+    if (is_valid && !bUsedCachedBlob)
+    {
+        cfg.setCachedCalibrationBlob(hid_cal, sizeof(hid_cal));
+    }
+
     if (is_valid)
     {
         memcpy(usb_calibration, hid_cal, PSMOVE_ZCM2_CALIBRATION_BLOB_SIZE);
@@ -1750,7 +1844,7 @@ PSMoveController::loadFirmwareInfo()
         memset(buf, 0, sizeof(buf));
         buf[0] = PSMove_Req_GetFirmwareInfo;
 
-        res = hid_get_feature_report(HIDDetails.Handle, buf, sizeof(buf));
+        res = logged_hid_get_feature_report(HIDDetails.Handle, buf, sizeof(buf));
 
         /**
         * The Bluetooth report contains the Report ID as additional first byte
@@ -1795,7 +1889,7 @@ PSMoveController::enableDFUMode()
 	memset(buf, 0, sizeof(buf));
 	buf[0] = PSMove_Req_SetDFUMode;
 	buf[1] = mode_magic_val;
-	res = hid_send_feature_report(HIDDetails.Handle, buf, sizeof(buf));
+	res = logged_hid_send_feature_report(HIDDetails.Handle, buf, sizeof(buf));
 
 	return (res == sizeof(buf));
 }
@@ -1853,6 +1947,11 @@ float PSMoveController::getPredictionTime() const
 	return getConfig()->prediction_time;
 }
 
+eCommonVisionPriority PSMoveController::getVisionPriority() const
+{
+	return getConfig()->vision_priority;
+}
+
 bool PSMoveController::getWasSystemButtonPressed() const
 {
     const PSMoveControllerInputState *psmove_state= static_cast<const PSMoveControllerInputState *>(getState());
@@ -1915,6 +2014,11 @@ PSMoveController::setConfig(const PSMoveControllerConfig *config)
 		m_HIDPacketProcessor->setConfig(*config);
 	}
 
+	if (m_HIDOutputWriter != nullptr)
+	{
+		m_HIDOutputWriter->setConfig(*config);
+	}
+
 	cfg.save();
 }
 
@@ -1923,13 +2027,13 @@ PSMoveController::setLED(unsigned char r, unsigned char g, unsigned char b)
 {
     bool success = true;
 
-    if (m_HIDPacketProcessor != nullptr &&
-		(m_cachedOutputState.r != r) || (m_cachedOutputState.g != g) || (m_cachedOutputState.b != b))
+    if (m_HIDOutputWriter != nullptr &&
+		((m_cachedOutputState.r != r) || (m_cachedOutputState.g != g) || (m_cachedOutputState.b != b)))
     {
         m_cachedOutputState.r = r;
         m_cachedOutputState.g = g;
         m_cachedOutputState.b = b;
-		m_HIDPacketProcessor->postOutputState(m_cachedOutputState);
+		m_HIDOutputWriter->postOutputState(m_cachedOutputState);
         
 		success= true;
     }
@@ -1941,10 +2045,10 @@ bool
 PSMoveController::setRumbleIntensity(unsigned char value)
 {
     bool success = true;
-    if (m_cachedOutputState.rumble != value)
+    if (m_HIDOutputWriter != nullptr && m_cachedOutputState.rumble != value)
     {
         m_cachedOutputState.rumble = value;
-		m_HIDPacketProcessor->postOutputState(m_cachedOutputState);
+		m_HIDOutputWriter->postOutputState(m_cachedOutputState);
 
         success = true;
     }
@@ -1968,7 +2072,7 @@ PSMoveController::setLEDPWMFrequency(unsigned long freq)
         buf[4] = (freq >> 8) & 0xFF;
         buf[5] = (freq >> 16) & 0xFF;
         buf[6] = (freq >> 24) & 0xFF;
-        int res = hid_send_feature_report(HIDDetails.Handle, buf, sizeof(buf));
+        int res = logged_hid_send_feature_report(HIDDetails.Handle, buf, sizeof(buf));
         success = (res == sizeof(buf));
         LedPWMF = freq;
     }
@@ -2041,16 +2145,6 @@ decode16bitUnsignedToSigned(char *data, int offset)
     return (low | (high << 8)) - 0x8000;
 }
 
-static int
-decode16bitTwosCompliment(char *data, int offset)
-{
-    unsigned char low = data[offset] & 0xFF;
-    unsigned char high = (data[offset+1]) & 0xFF;
-    int value= (low | (high << 8));
-
-	return (value & 0x8000) ? (-(~value & 0xFFFF) + 1) : value;
-}
-
 inline enum CommonControllerState::ButtonState
 getButtonState(unsigned int buttons, unsigned int lastButtons, int buttonMask)
 {
@@ -2075,5 +2169,5 @@ make_psmove_button_bitmask(const PSMoveDataInputZCM2 *hid_packet)
 
 inline bool hid_error_mbs(hid_device *dev, char *out_mb_error, size_t mb_buffer_size)
 {
-    return ServerUtility::convert_wcs_to_mbs(hid_error(dev), out_mb_error, mb_buffer_size);
+    return ServerUtility::convert_wcs_to_mbs(logged_hid_error(dev), out_mb_error, mb_buffer_size);
 }
@@ -4,6 +4,7 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "DeviceSensorDecoder.h"
 #include "MathUtility.h"
 #include "hidapi.h"
 #include <string>
@@ -42,13 +43,18 @@ public:
 		, firmware_revision(0)
 		, max_poll_failure_count(100)
         , poll_timeout_ms(1000) 
+        , output_write_interval_ms(120)
+        , led_keepalive_interval_ms(2000)
         , prediction_time(0.f)
+        , vision_priority(VisionPriority_Normal)
 		, position_filter_type("LowPassExponential")
 		, orientation_filter_type("ComplementaryMARG")
         , cal_ag_xyz_kbd({{ 
             {{ {{0, 0, 0}}, {{0, 0, 0}}, {{0, 0, 0}} }},
             {{ {{0, 0, 0}}, {{0, 0, 0}}, {{0, 0, 0}} }} 
         }})
+        , use_cached_calibration_blob(true)
+        , calibration_blob_crc32(0)
         , magnetometer_fit_error(0.f)
 		, magnetometer_variance(0.00059f) // rounded value from config tool measurement
 		, accelerometer_variance(7.2e-06f) // rounded value from config tool measurement
@@ -77,6 +83,13 @@ public:
 
     void getMagnetometerEllipsoid(struct EigenFitEllipsoid *out_ellipsoid) const;
 
+    // Folds the IMU calibration and the magnetometer ellipsoid into the report decoder for the given model
+    void getSensorDecoder(PSMoveControllerModelPID model, struct PSMoveSensorDecoder *out_decoder) const;
+
+    // Copies the cached calibration blob into out_blob if it has the expected size and checksum
+    bool getCachedCalibrationBlob(unsigned char *out_blob, size_t blob_size) const;
+    void setCachedCalibrationBlob(const unsigned char *blob, size_t blob_size);
+
     bool is_valid;
     long version;
 
@@ -94,9 +107,19 @@ public:
 
 	long poll_timeout_ms;
 
+	// Minimum time between LED/rumble output reports, changes made in between get merged
+	int output_write_interval_ms;
+
+	// The controller turns the LED and rumble off when it hasn't been sent an output report
+	// for a few seconds, so an unchanged non-zero state gets resent this often
+	int led_keepalive_interval_ms;
+
 	// The amount of prediction to apply to the controller pose after filtering
     float prediction_time;
 
+	// How the vision scheduler ranks this controller against the other tracked devices
+	eCommonVisionPriority vision_priority;
+
 	// The type of position filter to use
 	std::string position_filter_type;
 
@@ -106,6 +129,16 @@ public:
 	// The accelerometer and gyroscope scale/bias/drift values read from the USB calibration packet
     std::array<std::array<std::array<float, 3>, 3>, 2> cal_ag_xyz_kbd;
 
+    // Decode the calibration from the blob cached below instead of
+    // reading it from the controller again (saves several HID feature reads per open)
+    bool use_cached_calibration_blob;
+
+    // The raw USB calibration packet last read from the controller (hex encoded)
+    std::string calibration_blob;
+
+    // CRC32 of the raw calibration packet, a mismatch means the cached blob is ignored
+    unsigned int calibration_blob_crc32;
+
 	// The direction of the magnetometer when in the identity pose
     CommonDeviceVector magnetometer_identity;
 
@@ -177,6 +210,13 @@ public:
 	std::string hand;
 };
 
+// Raw report -> calibrated sensor transforms of one controller, rebuilt when its config changes
+struct PSMoveSensorDecoder
+{
+    IMUPacketDecoder imu;
+    IMUAffineCalibration magnetometer;
+};
+
 struct PSMoveControllerInputState : public CommonControllerState
 {
     int RawSequence;                            // 4-bit (1..16).
@@ -207,18 +247,16 @@ struct PSMoveControllerInputState : public CommonControllerState
     std::array<float, 3> CalibratedMag;                       // One frame of 3 dimensions
 
     int TempRaw;
-
-    //TODO: high-precision timestamp. Need to do in hidapi?
     
     PSMoveControllerInputState();
 
     void clear();
 	void parseDataInput(
-		const PSMoveControllerConfig *config, 
+		const PSMoveSensorDecoder *decoder, 
 		const struct PSMoveDataInputZCM1 *previous_hid_packet,
 		const struct PSMoveDataInputZCM1 *new_hid_packet);
 	void parseDataInput(
-		const PSMoveControllerConfig *config, 
+		const PSMoveSensorDecoder *decoder, 
 		const struct PSMoveDataInputZCM2 *previous_hid_packet,
 		const struct PSMoveDataInputZCM2 *new_hid_packet);
 };
@@ -277,6 +315,7 @@ public:
 	virtual bool getTrackingColorID(eCommonTrackingColorID &out_tracking_color_id) const override;
 	virtual float getIdentityForwardDegrees() const override;
 	virtual float getPredictionTime() const override;
+	virtual eCommonVisionPriority getVisionPriority() const override;
     virtual bool getWasSystemButtonPressed() const override;
 
     // -- Getters
@@ -316,6 +355,7 @@ private:
 
     // HID Packet Processing
 	class PSMoveHidPacketProcessor* m_HIDPacketProcessor;
+	class PSMoveHidOutputWriter* m_HIDOutputWriter;
 	IControllerListener* m_controllerListener;
 
 };
@@ -0,0 +1,279 @@
+// -- includes -----
+#include "InputLogTracker.h"
+#include "InputLogTrackerEnumerator.h"
+#include "ServerLog.h"
+
+// -- InputLogTracker
+InputLogTracker::InputLogTracker()
+    : PS3EyeTracker()
+    , ReplayStreamID(0)
+    , CurrentFrame()
+    , CurrentFrameTimestamp()
+    , CurrentFrameSequenceNumber(-1)
+{
+    CurrentFrame.buffer = nullptr;
+}
+
+InputLogTracker::~InputLogTracker()
+{
+    if (getIsOpen())
+    {
+        SERVER_LOG_ERROR("~InputLogTracker") << "Tracker deleted without calling close() first!";
+    }
+}
+
+// -- IDeviceInterface
+bool InputLogTracker::matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const
+{
+    bool matches = false;
+
+    if (enumerator->get_device_type() == CommonControllerState::PS3EYE)
+    {
+        std::string enumerator_path = enumerator->get_path();
+
+        matches = (enumerator_path == USBDevicePath);
+    }
+
+    return matches;
+}
+
+bool InputLogTracker::open(const DeviceEnumerator *enumerator)
+{
+    const InputLogTrackerEnumerator *tracker_enumerator = static_cast<const InputLogTrackerEnumerator *>(enumerator);
+    const char *cur_dev_path = tracker_enumerator->get_path();
+
+    bool bSuccess = false;
+
+    if (getIsOpen())
+    {
+        SERVER_LOG_WARNING("InputLogTracker::open") << "InputLogTracker(" << cur_dev_path << ") already open. Ignoring request.";
+        bSuccess = true;
+    }
+    else
+    {
+        std::string config_name;
+
+        SERVER_LOG_INFO("InputLogTracker::open") << "Opening InputLogTracker(" << cur_dev_path << ", camera_index=" << tracker_enumerator->get_camera_index() << ")";
+
+        ReplayStreamID = DeviceInputLog::open_replay_tracker(cur_dev_path, config_name);
+
+        if (ReplayStreamID > 0)
+        {
+            USBDevicePath = cur_dev_path;
+            CurrentFrame.buffer = nullptr;
+
+            // The config got extracted from the log when the replay started
+            cfg = PS3EyeTrackerConfig(config_name);
+            cfg.load();
+
+            bSuccess = true;
+        }
+        else
+        {
+            SERVER_LOG_ERROR("InputLogTracker::open") << "Device input log has no (more) recordings of tracker " << cur_dev_path;
+        }
+    }
+
+    return bSuccess;
+}
+
+bool InputLogTracker::getIsOpen() const
+{
+    return ReplayStreamID > 0;
+}
+
+bool InputLogTracker::getIsReadyToPoll() const
+{
+    return getIsOpen();
+}
+
+IDeviceInterface::ePollResult InputLogTracker::poll()
+{
+    IDeviceInterface::ePollResult result = IDeviceInterface::_PollResultFailure;
+
+    if (getIsOpen())
+    {
+        if (DeviceInputLog::fetch_replay_tracker_frame(ReplayStreamID, CurrentFrame))
+        {
+            CurrentFrameTimestamp = std::chrono::high_resolution_clock::now();
+            CurrentFrameSequenceNumber = CurrentFrame.sequence_number;
+            result = IDeviceInterface::_PollResultSuccessNewData;
+        }
+        else
+        {
+            // No frame due yet, or the recording ran out
+            result = IDeviceInterface::_PollResultSuccessNoData;
+        }
+
+        {
+            PS3EyeTrackerState newState;
+
+            newState.CaptureTimestamp = CurrentFrameTimestamp;
+            newState.PollSequenceNumber = NextPollSequenceNumber;
+            ++NextPollSequenceNumber;
+
+            TrackerStates.push_back(newState);
+        }
+    }
+
+    return result;
+}
+
+void InputLogTracker::close()
+{
+    ReplayStreamID = 0;
+    CurrentFrame.buffer = nullptr;
+    CurrentFrameSequenceNumber = -1;
+    bCaptureRawBayerFrames = false;
+}
+
+// -- ITrackerInterface
+bool InputLogTracker::getVideoFrameDimensions(
+    int *out_width,
+    int *out_height,
+    int *out_stride) const
+{
+    const int width = static_cast<int>(getFrameWidth());
+
+    if (out_width != nullptr)
+    {
+        *out_width = width;
+    }
+
+    if (out_height != nullptr)
+    {
+        *out_height = static_cast<int>(getFrameHeight());
+    }
+
+    // Dimensions of the BGR frame, like the PS3Eye reports even when capturing raw Bayer frames
+    if (out_stride != nullptr)
+    {
+        *out_stride = width*3;
+    }
+
+    return true;
+}
+
+const unsigned char *InputLogTracker::getVideoFrameBuffer() const
+{
+    return (CurrentFrame.buffer != nullptr && !CurrentFrame.bIsRawBayer) ? CurrentFrame.buffer : nullptr;
+}
+
+void InputLogTracker::getVideoFrameBufferLayout(
+    int *out_bytes_per_pixel,
+    int *out_stride) const
+{
+    int bytes_per_pixel = 3;
+    int stride = static_cast<int>(getFrameWidth())*3;
+
+    // Frames get recorded the way the camera delivered them (BGR or CL Eye Multicam BGRA)
+    if (CurrentFrame.buffer != nullptr && !CurrentFrame.bIsRawBayer && CurrentFrame.width > 0)
+    {
+        bytes_per_pixel = (CurrentFrame.stride >= CurrentFrame.width*4) ? 4 : 3;
+        stride = CurrentFrame.stride;
+    }
+
+    if (out_bytes_per_pixel != nullptr)
+    {
+        *out_bytes_per_pixel = bytes_per_pixel;
+    }
+
+    if (out_stride != nullptr)
+    {
+        *out_stride = stride;
+    }
+}
+
+const unsigned char *InputLogTracker::getRawBayerFrameBuffer() const
+{
+    return (CurrentFrame.buffer != nullptr && CurrentFrame.bIsRawBayer) ? CurrentFrame.buffer : nullptr;
+}
+
+long long InputLogTracker::getVideoFrameSequenceNumber() const
+{
+    return (CurrentFrame.buffer != nullptr) ? CurrentFrameSequenceNumber : -1;
+}
+
+bool InputLogTracker::setRawBayerFrameCapture(bool bEnable)
+{
+    // The recording decides the frame format, the frame buffer getters report which one it is
+    bCaptureRawBayerFrames = bEnable;
+
+    return true;
+}
+
+bool InputLogTracker::setCaptureSuspended(bool bSuspended)
+{
+    // The replay runs at its own pace
+    return !bSuspended;
+}
+
+void InputLogTracker::loadSettings()
+{
+    cfg.load();
+}
+
+void InputLogTracker::setFrameWidth(double value, bool bUpdateConfig)
+{
+	if (bUpdateConfig)
+	{
+		cfg.frame_width = value;
+	}
+}
+
+double InputLogTracker::getFrameWidth() const
+{
+	return (CurrentFrame.buffer != nullptr) ? static_cast<double>(CurrentFrame.width) : cfg.frame_width;
+}
+
+void InputLogTracker::setFrameHeight(double value, bool bUpdateConfig)
+{
+	if (bUpdateConfig)
+	{
+		cfg.frame_height = value;
+	}
+}
+
+double InputLogTracker::getFrameHeight() const
+{
+	return (CurrentFrame.buffer != nullptr) ? static_cast<double>(CurrentFrame.height) : cfg.frame_height;
+}
+
+void InputLogTracker::setFrameRate(double value, bool bUpdateConfig)
+{
+	if (bUpdateConfig)
+	{
+		cfg.frame_rate = value;
+	}
+}
+
+double InputLogTracker::getFrameRate() const
+{
+	return cfg.frame_rate;
+}
+
+void InputLogTracker::setExposure(double value, bool bUpdateConfig)
+{
+	if (bUpdateConfig)
+	{
+		cfg.exposure = value;
+	}
+}
+
+double InputLogTracker::getExposure() const
+{
+	return cfg.exposure;
+}
+
+void InputLogTracker::setGain(double value, bool bUpdateConfig)
+{
+	if (bUpdateConfig)
+	{
+		cfg.gain = value;
+	}
+}
+
+double InputLogTracker::getGain() const
+{
+	return cfg.gain;
+}
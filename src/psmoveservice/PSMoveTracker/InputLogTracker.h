@@ -0,0 +1,56 @@
+#ifndef INPUT_LOG_TRACKER_H
+#define INPUT_LOG_TRACKER_H
+
+// -- includes -----
+#include "PS3EyeTracker.h"
+#include "DeviceInputLog.h"
+
+// -- definitions -----
+/// PS3Eye tracker that plays back the video frames recorded in a device input log.
+/**
+ Uses the recorded PS3EyeTrackerConfig of the camera, so the intrinsics, pose and
+ color presets match the recording. Frames come straight out of the mapped log
+ in whatever format (BGR or raw Bayer) they were recorded in.
+ */
+class InputLogTracker : public PS3EyeTracker
+{
+public:
+    InputLogTracker();
+    virtual ~InputLogTracker();
+
+    // -- IDeviceInterface
+    bool matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const override;
+    bool open(const DeviceEnumerator *enumerator) override;
+    bool getIsOpen() const override;
+    bool getIsReadyToPoll() const override;
+    IDeviceInterface::ePollResult poll() override;
+    void close() override;
+
+    // -- ITrackerInterface
+    bool getVideoFrameDimensions(int *out_width, int *out_height, int *out_stride) const override;
+    const unsigned char *getVideoFrameBuffer() const override;
+    void getVideoFrameBufferLayout(int *out_bytes_per_pixel, int *out_stride) const override;
+    const unsigned char *getRawBayerFrameBuffer() const override;
+    long long getVideoFrameSequenceNumber() const override;
+    bool setRawBayerFrameCapture(bool bEnable) override;
+    bool setCaptureSuspended(bool bSuspended) override;
+    void loadSettings() override;
+	void setFrameWidth(double value, bool bUpdateConfig) override;
+	double getFrameWidth() const override;
+	void setFrameHeight(double value, bool bUpdateConfig) override;
+	double getFrameHeight() const override;
+	void setFrameRate(double value, bool bUpdateConfig) override;
+	double getFrameRate() const override;
+    void setExposure(double value, bool bUpdateConfig) override;
+    double getExposure() const override;
+	void setGain(double value, bool bUpdateConfig) override;
+	double getGain() const override;
+
+private:
+    int ReplayStreamID;
+    DeviceInputLogTrackerFrame CurrentFrame;
+    long long CurrentFrameSequenceNumber;
+    std::chrono::time_point<std::chrono::high_resolution_clock> CurrentFrameTimestamp;
+};
+
+#endif // INPUT_LOG_TRACKER_H
@@ -1,31 +1,253 @@
 // -- includes -----
 #include "PS3EyeTracker.h"
+#include "AtomicPrimitives.h"
+#include "DeviceInputLog.h"
+#include "DeviceManager.h"
 #include "ServerLog.h"
 #include "ServerUtility.h"
 #include "PSEyeVideoCapture.h"
 #include "PSMoveProtocol.pb.h"
 #include "TrackerDeviceEnumerator.h"
 #include "TrackerManager.h"
+#include "WakeupSignal.h"
+#include "WorkerThread.h"
 #include "opencv2/opencv.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 // -- constants -----
-#define PS3EYE_STATE_BUFFER_MAX 16
+#define PS3EYE_FRAME_RING_SIZE 2
 
 static const char *OPTION_FOV_SETTING = "FOV Setting";
 static const char *OPTION_FOV_RED_DOT = "Red Dot";
 static const char *OPTION_FOV_BLUE_DOT = "Blue Dot";
 
+// Camera mode of PS3EyeTrackerConfig::high_speed_profile, the fastest the PS3Eye goes.
+// The driver picks the 240 line mode from the width.
+static const double k_high_speed_frame_width = 320.0;
+static const double k_high_speed_frame_rate = 187.0;
+
 // -- private definitions -----
+// The driver doesn't number the frames, so count the frame periods since the last one
+// (rounded, since a frame can wait for its pickup up to half a period)
+static long long next_frame_sequence_number(
+    const long long last_sequence_number,
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &last_timestamp,
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &timestamp,
+    const double frame_rate)
+{
+    long long frame_count = 1;
+
+    if (last_sequence_number < 0)
+    {
+        return 0;
+    }
+
+    if (frame_rate > 0.0)
+    {
+        const std::chrono::duration<double> elapsed = timestamp - last_timestamp;
+
+        frame_count = std::max(static_cast<long long>(elapsed.count()*frame_rate + 0.5), 1LL);
+    }
+
+    return last_sequence_number + frame_count;
+}
+
+// A frame retrieved on the capture thread
+struct PSEyeCaptureFrame
+{
+    cv::Mat image;
+    std::chrono::time_point<std::chrono::high_resolution_clock> timestamp;
+    long long sequence_number;
+    // Bumped every time the capture thread restarts, so frames from before a mode change get ignored
+    int generation;
+
+    PSEyeCaptureFrame()
+        : image()
+        , timestamp()
+        , sequence_number(-1)
+        , generation(-1)
+    {
+    }
+};
+
+// Triple buffer of captured frames: the capture thread always has a slot no one reads to retrieve into,
+// and the frame the main thread fetched stays untouched until its next fetch.
+class PSEyeCaptureFrameBuffer : public AtomicObject<PSEyeCaptureFrame>
+{
+public:
+    using AtomicObject<PSEyeCaptureFrame>::writeBegin;
+    using AtomicObject<PSEyeCaptureFrame>::writeEnd;
+    using AtomicObject<PSEyeCaptureFrame>::writeCancel;
+};
+
+// Grabs and debayers the camera frames on its own thread
+// so that waiting on the camera and converting its frames never holds up the main loop.
+// The main thread only ever picks up the newest finished frame.
+class PSEyeCaptureThread : public WorkerThread
+{
+public:
+    PSEyeCaptureThread(PSEyeVideoCapture *video_capture)
+        : WorkerThread("PSEyeCapture")
+        , m_videoCapture(video_capture)
+        , m_retrieveChannel(cv::CAP_OPENNI_BGR_IMAGE)
+        , m_frameRate(0.0)
+        , m_generation(-1)
+        , m_lastSequenceNumber(-1)
+        , m_lastTimestamp()
+    {
+    }
+
+    inline int getGeneration() const
+    {
+        return m_generation;
+    }
+
+    // Main thread only. The frame stays valid until the next fetch.
+    const PSEyeCaptureFrame &fetchLatestFrame()
+    {
+        return m_frames.fetchValueRef();
+    }
+
+    // Main thread only. Settings can only change while the thread is stopped.
+    void start(const int retrieve_channel, const double frame_rate)
+    {
+        if (!hasThreadStarted())
+        {
+            m_retrieveChannel = retrieve_channel;
+            m_frameRate = frame_rate;
+            ++m_generation;
+
+            WorkerThread::startThread();
+        }
+    }
+
+    void stop()
+    {
+        WorkerThread::stopThread();
+    }
+
+protected:
+    virtual bool doWork() override
+    {
+        if (!m_videoCapture->grab())
+        {
+            // Camera not streaming (yet), don't spin on it
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return true;
+        }
+
+        PSEyeCaptureFrame *frame = m_frames.writeBegin();
+
+        // Blocks until the camera has a new frame
+        if (m_videoCapture->retrieve(frame->image, m_retrieveChannel))
+        {
+            // Stamp the frame as soon as it arrives rather than when the main loop gets to it
+            const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+
+            // Restarting the thread doesn't count the pause as dropped frames
+            m_lastSequenceNumber =
+                (m_lastTimestamp == std::chrono::time_point<std::chrono::high_resolution_clock>())
+                ? m_lastSequenceNumber + 1
+                : next_frame_sequence_number(m_lastSequenceNumber, m_lastTimestamp, now, m_frameRate);
+            m_lastTimestamp = now;
+
+            frame->timestamp = now;
+            frame->sequence_number = m_lastSequenceNumber;
+            frame->generation = m_generation;
+            m_frames.writeEnd();
+
+            WakeupSignal::notifyMainLoop();
+        }
+        else
+        {
+            m_frames.writeCancel();
+        }
+
+        return true;
+    }
+
+    virtual void onThreadHaltComplete() override
+    {
+        // The first frame after a restart follows straight on from the last one
+        m_lastTimestamp = std::chrono::time_point<std::chrono::high_resolution_clock>();
+    }
+
+    // Only changes while the thread is stopped
+    PSEyeVideoCapture *m_videoCapture;
+    int m_retrieveChannel;
+    double m_frameRate;
+    int m_generation;
+
+    // Capture thread state
+    long long m_lastSequenceNumber;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastTimestamp;
+    PSEyeCaptureFrameBuffer m_frames;
+};
+
+// Ring of capture buffers owned by the tracker.
+// Frames are retrieved into the next slot in the ring so the last published frame
+// stays untouched (and can be referenced without a copy) until the following poll.
+// With a capture thread the current frame is the one last fetched from it instead.
 class PSEyeCaptureData
 {
 public:
     PSEyeCaptureData()
-        : frame()
+        : frames()
+        , current_frame_index(-1)
+        , captured_frame(nullptr)
+        , current_frame_timestamp()
+        , current_frame_sequence_number(-1)
+    {
+
+    }
+
+    cv::Mat &getNextFrameMutable()
+    {
+        return frames[(current_frame_index + 1) % PS3EYE_FRAME_RING_SIZE];
+    }
+
+    void publishNextFrame(
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &timestamp,
+        const double frame_rate)
+    {
+        current_frame_index = (current_frame_index + 1) % PS3EYE_FRAME_RING_SIZE;
+        current_frame_sequence_number =
+            next_frame_sequence_number(current_frame_sequence_number, current_frame_timestamp, timestamp, frame_rate);
+        current_frame_timestamp = timestamp;
+    }
+
+    void publishCapturedFrame(const PSEyeCaptureFrame &frame)
+    {
+        captured_frame = &frame.image;
+        current_frame_sequence_number = frame.sequence_number;
+        current_frame_timestamp = frame.timestamp;
+    }
+
+    // Don't hand out the last frame any more (ex: it is in a format we no longer capture in)
+    void clearCurrentFrame()
     {
+        current_frame_index = -1;
+        captured_frame = nullptr;
+    }
+
+    const cv::Mat *getCurrentFrame() const
+    {
+        if (captured_frame != nullptr)
+        {
+            return captured_frame;
+        }
 
+        return (current_frame_index != -1) ? &frames[current_frame_index] : nullptr;
     }
 
-    cv::Mat frame;
+    cv::Mat frames[PS3EYE_FRAME_RING_SIZE];
+    int current_frame_index;
+    const cv::Mat *captured_frame;
+    std::chrono::time_point<std::chrono::high_resolution_clock> current_frame_timestamp;
+    long long current_frame_sequence_number;
 };
 
 // -- public methods
@@ -40,6 +262,7 @@ PS3EyeTrackerConfig::PS3EyeTrackerConfig(const std::string &fnamebase)
 	, frame_width(640)
 	, frame_height(480)
 	, frame_rate(40)
+    , high_speed_profile(false)
     , exposure(32)
     , gain(32)
     , focalLengthX(554.2563) // pixels
@@ -78,6 +301,7 @@ PS3EyeTrackerConfig::config2ptree()
 	pt.put("frame_width", frame_width);
 	pt.put("frame_height", frame_height);
 	pt.put("frame_rate", frame_rate);
+	pt.put("high_speed_profile", high_speed_profile);
     pt.put("exposure", exposure);
 	pt.put("gain", gain);
     pt.put("focalLengthX", focalLengthX);
@@ -124,6 +348,7 @@ PS3EyeTrackerConfig::ptree2config(const boost::property_tree::ptree &pt)
 		frame_width = pt.get<double>("frame_width", 640);
 		frame_height = pt.get<double>("frame_height", 480);
 		frame_rate = pt.get<double>("frame_rate", 40);
+		high_speed_profile = pt.get<bool>("high_speed_profile", high_speed_profile);
         exposure = pt.get<double>("exposure", 32);
 		gain = pt.get<double>("gain", 32);
         hfov = pt.get<double>("hfov", 60.0);
@@ -258,11 +483,16 @@ PS3EyeTrackerConfig::getOrAddColorRangeTable(const std::string &table_name)
 PS3EyeTracker::PS3EyeTracker()
     : cfg()
     , USBDevicePath()
+    , bCaptureRawBayerFrames(false)
+    , bCaptureNativeBGRAFrames(false)
+    , bCaptureSuspended(false)
+    , NextPollSequenceNumber(0)
+    , TrackerStates()
     , VideoCapture(nullptr)
     , CaptureData(nullptr)
+    , CaptureThread(nullptr)
     , DriverType(PS3EyeTracker::Libusb)
-    , NextPollSequenceNumber(0)
-    , TrackerStates()
+    , InputLogStreamID(0)
 {
 }
 
@@ -336,6 +566,9 @@ bool PS3EyeTracker::open(const DeviceEnumerator *enumerator)
         {
             CaptureData = new PSEyeCaptureData;
             USBDevicePath = enumerator->get_path();
+            // The tracker pipeline reads BGRA frames directly,
+            // so skip the per frame conversion to BGR in the driver
+            bCaptureNativeBGRAFrames = VideoCapture->getIsNativeBGRASupported();
             bSuccess = true;
         }
         else
@@ -359,10 +592,21 @@ bool PS3EyeTracker::open(const DeviceEnumerator *enumerator)
 		// Save the config back out again in case defaults changed
 		cfg.save();
 
-		VideoCapture->set(cv::CAP_PROP_FRAME_WIDTH, cfg.frame_width);
+		InputLogStreamID = DeviceInputLog::record_tracker_opened(USBDevicePath, cfg.ConfigFileBase);
+
+		VideoCapture->set(cv::CAP_PROP_FRAME_WIDTH, getModeFrameWidth());
 		VideoCapture->set(cv::CAP_PROP_EXPOSURE, cfg.exposure);
 		VideoCapture->set(cv::CAP_PROP_GAIN, cfg.gain);
-		VideoCapture->set(cv::CAP_PROP_FPS, cfg.frame_rate);
+		VideoCapture->set(cv::CAP_PROP_FPS, getModeFrameRate());
+
+        const DeviceManager *device_manager = DeviceManager::getInstance();
+
+        if (device_manager != nullptr && device_manager->m_tracker_manager != nullptr &&
+            device_manager->m_tracker_manager->getConfig().use_camera_capture_threads)
+        {
+            CaptureThread = new PSEyeCaptureThread(VideoCapture);
+            resumeCaptureThread(true);
+        }
     }
 
     return bSuccess;
@@ -384,8 +628,46 @@ IDeviceInterface::ePollResult PS3EyeTracker::poll()
 
     if (getIsOpen())
     {
-        if (!VideoCapture->grab() || 
-            !VideoCapture->retrieve(CaptureData->frame, cv::CAP_OPENNI_BGR_IMAGE))
+        bool bHasNewFrame;
+
+        if (CaptureThread != nullptr)
+        {
+            // Just pick up the newest frame the capture thread finished, if there is one
+            const PSEyeCaptureFrame &frame = CaptureThread->fetchLatestFrame();
+
+            if (frame.generation != CaptureThread->getGeneration())
+            {
+                // Nothing captured since the thread restarted. The frame we held may get overwritten from now on.
+                CaptureData->clearCurrentFrame();
+                bHasNewFrame = false;
+            }
+            else
+            {
+                // The capture thread numbers every frame, so the same number means the same frame
+                bHasNewFrame =
+                    CaptureData->getCurrentFrame() == nullptr ||
+                    frame.sequence_number != CaptureData->current_frame_sequence_number;
+
+                if (bHasNewFrame)
+                {
+                    CaptureData->publishCapturedFrame(frame);
+                }
+            }
+        }
+        else
+        {
+            // Debayer (or copy the raw Bayer frame) straight into the next free slot of the frame ring
+            bHasNewFrame =
+                VideoCapture->grab() &&
+                VideoCapture->retrieve(CaptureData->getNextFrameMutable(), getRetrieveChannel());
+
+            if (bHasNewFrame)
+            {
+                CaptureData->publishNextFrame(std::chrono::high_resolution_clock::now(), getModeFrameRate());
+            }
+        }
+
+        if (!bHasNewFrame)
         {
             // Device still in valid state
             result = IControllerInterface::_PollResultSuccessNoData;
@@ -394,24 +676,34 @@ IDeviceInterface::ePollResult PS3EyeTracker::poll()
         {
             // New data available. Keep iterating.
             result = IControllerInterface::_PollResultSuccessNewData;
+
+            if (InputLogStreamID > 0)
+            {
+                const cv::Mat *frame = CaptureData->getCurrentFrame();
+                DeviceInputLogTrackerFrame log_frame;
+
+                log_frame.buffer = frame->data;
+                log_frame.width = frame->cols;
+                log_frame.height = frame->rows;
+                log_frame.stride = static_cast<int>(frame->step);
+                log_frame.bIsRawBayer = bCaptureRawBayerFrames;
+                DeviceInputLog::record_tracker_frame(InputLogStreamID, log_frame);
+            }
         }
 
         {
             PS3EyeTrackerState newState;
 
+            // The state refers to the latest retrieved frame, not the time of this poll
+            newState.CaptureTimestamp = CaptureData->current_frame_timestamp;
+
             // TODO: Process the frame and extract the blobs
 
             // Increment the sequence for every new polling packet
             newState.PollSequenceNumber = NextPollSequenceNumber;
             ++NextPollSequenceNumber;
 
-            // Make room for new entry if at the max queue size
-            //###bwalker $TODO Make this a fixed size circular buffer
-            if (TrackerStates.size() >= PS3EYE_STATE_BUFFER_MAX)
-            {
-                TrackerStates.erase(TrackerStates.begin(), TrackerStates.begin() + TrackerStates.size() - PS3EYE_STATE_BUFFER_MAX);
-            }
-
+            // Overwrites the oldest entry once the history is full
             TrackerStates.push_back(newState);
         }
     }
@@ -421,12 +713,25 @@ IDeviceInterface::ePollResult PS3EyeTracker::poll()
 
 void PS3EyeTracker::close()
 {
+    // Stop reading from the camera before it goes away
+    if (CaptureThread != nullptr)
+    {
+        CaptureThread->stop();
+        delete CaptureThread;
+        CaptureThread = nullptr;
+    }
+
     if (CaptureData != nullptr)
     {
         delete CaptureData;
         CaptureData = nullptr;
     }
 
+    bCaptureRawBayerFrames = false;
+    bCaptureNativeBGRAFrames = false;
+    bCaptureSuspended = false;
+    InputLogStreamID = 0;
+
     if (VideoCapture != nullptr)
     {
         delete VideoCapture;
@@ -439,6 +744,14 @@ long PS3EyeTracker::getMaxPollFailureCount() const
     return cfg.max_poll_failure_count;
 }
 
+int PS3EyeTracker::getPollIntervalMs() const
+{
+    // Twice per frame, so a new frame waits at most half a frame period for its poll
+    const double frame_rate = getModeFrameRate();
+
+    return (frame_rate > 0.0) ? std::max(static_cast<int>(500.0 / frame_rate), 1) : -1;
+}
+
 CommonDeviceState::eDeviceType PS3EyeTracker::getDeviceType() const
 {
     return CommonDeviceState::PS3EYE;
@@ -446,11 +759,7 @@ CommonDeviceState::eDeviceType PS3EyeTracker::getDeviceType() const
 
 const CommonDeviceState *PS3EyeTracker::getState(int lookBack) const
 {
-    const int queueSize = static_cast<int>(TrackerStates.size());
-    const CommonDeviceState * result =
-        (lookBack < queueSize) ? &TrackerStates.at(queueSize - lookBack - 1) : nullptr;
-
-    return result;
+    return TrackerStates.getFromNewest(lookBack);
 }
 
 ITrackerInterface::eDriverType PS3EyeTracker::getDriverType() const
@@ -526,14 +835,126 @@ const unsigned char *PS3EyeTracker::getVideoFrameBuffer() const
 {
     const unsigned char *result = nullptr;
 
-    if (CaptureData != nullptr)
+    if (CaptureData != nullptr && !bCaptureRawBayerFrames)
     {
-        return static_cast<const unsigned char *>(CaptureData->frame.data);
+        const cv::Mat *frame = CaptureData->getCurrentFrame();
+
+        if (frame != nullptr)
+        {
+            result = static_cast<const unsigned char *>(frame->data);
+        }
     }
 
     return result;
 }
 
+void PS3EyeTracker::getVideoFrameBufferLayout(
+    int *out_bytes_per_pixel,
+    int *out_stride) const
+{
+    const cv::Mat *frame = (CaptureData != nullptr) ? CaptureData->getCurrentFrame() : nullptr;
+    int bytes_per_pixel;
+    int stride;
+
+    if (frame != nullptr && !bCaptureRawBayerFrames)
+    {
+        bytes_per_pixel = static_cast<int>(frame->elemSize());
+        stride = static_cast<int>(frame->step);
+    }
+    else
+    {
+        int width = 0;
+
+        getVideoFrameDimensions(&width, nullptr, nullptr);
+        bytes_per_pixel = bCaptureNativeBGRAFrames ? 4 : 3;
+        stride = bytes_per_pixel * width;
+    }
+
+    if (out_bytes_per_pixel != nullptr)
+    {
+        *out_bytes_per_pixel = bytes_per_pixel;
+    }
+
+    if (out_stride != nullptr)
+    {
+        *out_stride = stride;
+    }
+}
+
+const unsigned char *PS3EyeTracker::getRawBayerFrameBuffer() const
+{
+    const unsigned char *result = nullptr;
+
+    if (CaptureData != nullptr && bCaptureRawBayerFrames)
+    {
+        const cv::Mat *frame = CaptureData->getCurrentFrame();
+
+        if (frame != nullptr)
+        {
+            result = static_cast<const unsigned char *>(frame->data);
+        }
+    }
+
+    return result;
+}
+
+long long PS3EyeTracker::getVideoFrameSequenceNumber() const
+{
+    return (CaptureData != nullptr) ? CaptureData->current_frame_sequence_number : -1;
+}
+
+bool PS3EyeTracker::setRawBayerFrameCapture(bool bEnable)
+{
+    bool bSuccess = false;
+
+    if (!bEnable || (VideoCapture != nullptr && VideoCapture->getIsRawBayerSupported()))
+    {
+        if (bEnable != bCaptureRawBayerFrames)
+        {
+            const bool bWasCapturing = pauseCaptureThread();
+
+            bCaptureRawBayerFrames = bEnable;
+
+            // Don't hand out the last frame in the old format
+            if (CaptureData != nullptr)
+            {
+                CaptureData->clearCurrentFrame();
+            }
+
+            resumeCaptureThread(bWasCapturing);
+        }
+
+        bSuccess = true;
+    }
+
+    return bSuccess;
+}
+
+bool PS3EyeTracker::setCaptureSuspended(bool bSuspended)
+{
+    bool bSuccess = false;
+
+    if (bSuspended == bCaptureSuspended)
+    {
+        bSuccess = true;
+    }
+    else if (getIsOpen() && VideoCapture->getIsStreamingControlSupported())
+    {
+        // The capture thread would block on a stopped stream
+        const bool bWasCapturing = bSuspended ? pauseCaptureThread() : (CaptureThread != nullptr);
+
+        if (VideoCapture->setStreaming(!bSuspended))
+        {
+            bCaptureSuspended = bSuspended;
+            bSuccess = true;
+        }
+
+        resumeCaptureThread(bWasCapturing && !bCaptureSuspended);
+    }
+
+    return bSuccess;
+}
+
 void PS3EyeTracker::loadSettings()
 {
 	const double currentFrameWidth = VideoCapture->get(cv::CAP_PROP_FRAME_WIDTH);
@@ -543,9 +964,9 @@ void PS3EyeTracker::loadSettings()
 
     cfg.load();
 
-	if (currentFrameWidth != cfg.frame_width)
+	if (currentFrameWidth != getModeFrameWidth())
 	{
-		VideoCapture->set(cv::CAP_PROP_FRAME_WIDTH, cfg.frame_width);
+		setVideoCaptureMode(cv::CAP_PROP_FRAME_WIDTH, getModeFrameWidth());
 	}
 
     if (currentExposure != cfg.exposure)
@@ -558,9 +979,9 @@ void PS3EyeTracker::loadSettings()
         VideoCapture->set(cv::CAP_PROP_GAIN, cfg.gain);
     }
 
-	if (currentFrameRate != cfg.frame_rate)
+	if (currentFrameRate != getModeFrameRate())
 	{
-		VideoCapture->set(cv::CAP_PROP_FPS, cfg.frame_rate);
+		setVideoCaptureMode(cv::CAP_PROP_FPS, getModeFrameRate());
 	}
 }
 
@@ -571,7 +992,11 @@ void PS3EyeTracker::saveSettings()
 
 void PS3EyeTracker::setFrameWidth(double value, bool bUpdateConfig)
 {
-	VideoCapture->set(cv::CAP_PROP_FRAME_WIDTH, value);
+	// The high speed profile owns the camera mode, the setting applies once it gets turned off
+	if (!cfg.high_speed_profile)
+	{
+		setVideoCaptureMode(cv::CAP_PROP_FRAME_WIDTH, value);
+	}
 
 	if (bUpdateConfig)
 	{
@@ -586,7 +1011,10 @@ double PS3EyeTracker::getFrameWidth() const
 
 void PS3EyeTracker::setFrameHeight(double value, bool bUpdateConfig)
 {
-	VideoCapture->set(cv::CAP_PROP_FRAME_HEIGHT, value);
+	if (!cfg.high_speed_profile)
+	{
+		setVideoCaptureMode(cv::CAP_PROP_FRAME_HEIGHT, value);
+	}
 
 	if (bUpdateConfig)
 	{
@@ -601,7 +1029,10 @@ double PS3EyeTracker::getFrameHeight() const
 
 void PS3EyeTracker::setFrameRate(double value, bool bUpdateConfig)
 {
-	VideoCapture->set(cv::CAP_PROP_FPS, value);
+	if (!cfg.high_speed_profile)
+	{
+		setVideoCaptureMode(cv::CAP_PROP_FPS, value);
+	}
 
 	if (bUpdateConfig)
 	{
@@ -650,10 +1081,12 @@ void PS3EyeTracker::getCameraIntrinsics(
     float &outDistortionK1, float &outDistortionK2, float &outDistortionK3,
     float &outDistortionP1, float &outDistortionP2) const
 {
-    outFocalLengthX = static_cast<float>(cfg.focalLengthX);
-    outFocalLengthY = static_cast<float>(cfg.focalLengthY);
-    outPrincipalX = static_cast<float>(cfg.principalX);
-    outPrincipalY = static_cast<float>(cfg.principalY);
+    const double scale = getIntrinsicsScale();
+
+    outFocalLengthX = static_cast<float>(cfg.focalLengthX*scale);
+    outFocalLengthY = static_cast<float>(cfg.focalLengthY*scale);
+    outPrincipalX = static_cast<float>(cfg.principalX*scale);
+    outPrincipalY = static_cast<float>(cfg.principalY*scale);
     outDistortionK1 = static_cast<float>(cfg.distortionK1);
     outDistortionK2 = static_cast<float>(cfg.distortionK2);
     outDistortionK3 = static_cast<float>(cfg.distortionK3);
@@ -667,10 +1100,12 @@ void PS3EyeTracker::setCameraIntrinsics(
     float distortionK1, float distortionK2, float distortionK3,
     float distortionP1, float distortionP2)
 {
-    cfg.focalLengthX = focalLengthX;
-    cfg.focalLengthY = focalLengthY;
-    cfg.principalX = principalX;
-    cfg.principalY = principalY;
+    const double scale = getIntrinsicsScale();
+
+    cfg.focalLengthX = focalLengthX / scale;
+    cfg.focalLengthY = focalLengthY / scale;
+    cfg.principalX = principalX / scale;
+    cfg.principalY = principalY / scale;
     cfg.distortionK1 = distortionK1;
     cfg.distortionK2 = distortionK2;
     cfg.distortionK3 = distortionK3;
@@ -678,6 +1113,71 @@ void PS3EyeTracker::setCameraIntrinsics(
     cfg.distortionP2 = distortionP2;
 }
 
+double PS3EyeTracker::getModeFrameWidth() const
+{
+    return cfg.high_speed_profile ? k_high_speed_frame_width : cfg.frame_width;
+}
+
+double PS3EyeTracker::getModeFrameRate() const
+{
+    return cfg.high_speed_profile ? k_high_speed_frame_rate : cfg.frame_rate;
+}
+
+double PS3EyeTracker::getIntrinsicsScale() const
+{
+    // The QVGA modes bin the full sensor, so the field of view stays the same and only the pixel size changes
+    return (cfg.high_speed_profile && cfg.frame_width > 0.0) ? k_high_speed_frame_width / cfg.frame_width : 1.0;
+}
+
+int PS3EyeTracker::getRetrieveChannel() const
+{
+    return
+        bCaptureRawBayerFrames ? PSEYE_RAW_BAYER_IMAGE
+        : bCaptureNativeBGRAFrames ? PSEYE_NATIVE_BGRA_IMAGE
+        : cv::CAP_OPENNI_BGR_IMAGE;
+}
+
+bool PS3EyeTracker::pauseCaptureThread()
+{
+    bool bWasRunning = false;
+
+    if (CaptureThread != nullptr && CaptureThread->hasThreadStarted())
+    {
+        // Waits for the retrieve in flight (at most a frame period)
+        CaptureThread->stop();
+        bWasRunning = true;
+    }
+
+    return bWasRunning;
+}
+
+void PS3EyeTracker::resumeCaptureThread(bool bWasRunning)
+{
+    if (bWasRunning && CaptureThread != nullptr)
+    {
+        // The camera's rate rather than the config's, which may not have caught up with a mode change yet
+        const double frame_rate = VideoCapture->get(cv::CAP_PROP_FPS);
+
+        CaptureThread->start(getRetrieveChannel(), (frame_rate > 0.0) ? frame_rate : getModeFrameRate());
+    }
+}
+
+void PS3EyeTracker::setVideoCaptureMode(int property_id, double value)
+{
+    // Changing the mode restarts the camera stream, which can't race a retrieve on the capture thread
+    const bool bWasCapturing = pauseCaptureThread();
+
+    VideoCapture->set(property_id, value);
+
+    // The driver restarts the stream after a mode change
+    if (bCaptureSuspended)
+    {
+        VideoCapture->setStreaming(false);
+    }
+
+    resumeCaptureThread(bWasCapturing);
+}
+
 CommonDevicePose PS3EyeTracker::getTrackerPose() const
 {
     return cfg.pose;
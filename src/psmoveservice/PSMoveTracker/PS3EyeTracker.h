@@ -5,9 +5,12 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "CircularBuffer.h"
 #include <string>
 #include <vector>
-#include <deque>
+
+// -- constants -----
+#define PS3EYE_STATE_BUFFER_MAX 16
 
 // -- pre-declarations -----
 namespace PSMoveProtocol
@@ -40,6 +43,9 @@ public:
 	double frame_width;
 	double frame_height;
 	double frame_rate;
+    // Run the camera at 320x240@187fps whatever frame_width/frame_height/frame_rate say.
+    // The lens calibration stays in frame_width pixels and gets scaled to the smaller frame.
+    bool high_speed_profile;
     double exposure;
 	double gain;
     double focalLengthX;
@@ -95,6 +101,7 @@ public:
     IDeviceInterface::ePollResult poll() override;
     void close() override;
     long getMaxPollFailureCount() const override;
+    int getPollIntervalMs() const override;
     static CommonDeviceState::eDeviceType getDeviceTypeStatic()
     { return CommonDeviceState::PS3EYE; }
     CommonDeviceState::eDeviceType getDeviceType() const override;
@@ -105,6 +112,11 @@ public:
     std::string getUSBDevicePath() const override;
     bool getVideoFrameDimensions(int *out_width, int *out_height, int *out_stride) const override;
     const unsigned char *getVideoFrameBuffer() const override;
+    void getVideoFrameBufferLayout(int *out_bytes_per_pixel, int *out_stride) const override;
+    const unsigned char *getRawBayerFrameBuffer() const override;
+    long long getVideoFrameSequenceNumber() const override;
+    bool setRawBayerFrameCapture(bool bEnable) override;
+    bool setCaptureSuspended(bool bSuspended) override;
     void loadSettings() override;
     void saveSettings() override;
 	void setFrameWidth(double value, bool bUpdateConfig) override;
@@ -142,15 +154,39 @@ public:
     inline const PS3EyeTrackerConfig &getConfig() const
     { return cfg; }
 
-private:
+protected:
     PS3EyeTrackerConfig cfg;
     std::string USBDevicePath;
-    class PSEyeVideoCapture *VideoCapture;
-    class PSEyeCaptureData *CaptureData;
-    ITrackerInterface::eDriverType DriverType;    
+    bool bCaptureRawBayerFrames;
+    bool bCaptureNativeBGRAFrames; // CL Eye Multicam: take the driver's BGRA frames as they come
+    bool bCaptureSuspended; // See setCaptureSuspended()
     
     // Read Controller State
     int NextPollSequenceNumber;
-    std::deque<PS3EyeTrackerState> TrackerStates;
+    CircularBuffer<PS3EyeTrackerState, PS3EYE_STATE_BUFFER_MAX> TrackerStates;
+
+private:
+    class PSEyeVideoCapture *VideoCapture;
+    class PSEyeCaptureData *CaptureData;
+    // Null unless TrackerManagerConfig::use_camera_capture_threads is set
+    class PSEyeCaptureThread *CaptureThread;
+    ITrackerInterface::eDriverType DriverType;    
+
+    // Stream the frames get recorded with while the device input log is recording
+    int InputLogStreamID;
+
+    // Camera mode the tracker runs in: the high speed profile or the configured one
+    double getModeFrameWidth() const;
+    double getModeFrameRate() const;
+    // Pixel scale from the resolution the lens calibration is in to the current camera mode
+    double getIntrinsicsScale() const;
+
+    // Which frame format retrieve() gets asked for
+    int getRetrieveChannel() const;
+    // Camera mode and frame format changes have to wait for the capture thread to stop.
+    // Returns true if it was running.
+    bool pauseCaptureThread();
+    void resumeCaptureThread(bool bWasRunning);
+    void setVideoCaptureMode(int property_id, double value);
 };
 #endif // PS3EYE_TRACKER_H
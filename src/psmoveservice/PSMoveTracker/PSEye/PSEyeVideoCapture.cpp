@@ -73,7 +73,7 @@ class PSEYECaptureCAM_CLMULTI : public cv::IVideoCapture
 public:
     PSEYECaptureCAM_CLMULTI(int _index)
         : m_index(-1), m_width(-1), m_height(-1),
-        m_frame(NULL), m_frame4ch(NULL)
+        m_frame(NULL), m_frame4ch(NULL), m_bStreaming(false)
     {
         open(_index);
     }
@@ -123,6 +123,16 @@ public:
         }
         switch (property_id)
         {
+        case PSEYE_CAP_PROP_STREAMING:
+            if ((value != 0) != m_bStreaming)
+            {
+                m_bStreaming = (value != 0);
+                if (m_bStreaming)
+                    CLEyeCameraStart(m_eye);
+                else
+                    CLEyeCameraStop(m_eye);
+            }
+            return true;
         case CV_CAP_PROP_BRIGHTNESS:
             // [-500, 500]
             CLEyeSetCameraParameter(m_eye, CLEYE_LENSBRIGHTNESS, (int)value);
@@ -160,12 +170,29 @@ public:
 
     bool grabFrame()
     {
-        cvGetRawData(m_frame4ch, &pCapBuffer, 0, 0);
-        return true;
+        // Don't wait out the frame timeout on a stopped camera
+        return m_bStreaming;
     }
 
-    bool retrieveFrame(int channel, cv::OutputArray outArray)
+    bool retrieveFrame(int outputType, cv::OutputArray outArray)
     {
+        if (outputType == PSEYE_NATIVE_BGRA_IMAGE)
+        {
+            // The driver fills the caller's buffer directly, no intermediate frame or channel shuffle
+            outArray.create(cv::Size(m_width, m_height), CV_8UC4);
+            cv::Mat bgraFrame = outArray.getMat();
+
+            return CLEyeCameraGetFrame(m_eye, bgraFrame.data, 33);
+        }
+
+        // Only allocate the conversion buffers if someone actually asks for BGR frames
+        if (m_frame4ch == NULL)
+        {
+            m_frame4ch = cvCreateImage(cvSize(m_width, m_height), IPL_DEPTH_8U, 4);
+            m_frame = cvCreateImage(cvSize(m_width, m_height), IPL_DEPTH_8U, 3);
+        }
+
+        cvGetRawData(m_frame4ch, &pCapBuffer, 0, 0);
         CLEyeCameraGetFrame(m_eye, pCapBuffer, 33);
         const int from_to[] = { 0, 0, 1, 1, 2, 2 };
         const CvArr** src = (const CvArr**)&m_frame4ch;
@@ -222,10 +249,8 @@ protected:
             m_eye = CLEyeCreateCamera(guid, CLEYE_COLOR_PROCESSED, CLEYE_VGA, 75);
             CLEyeCameraGetFrameDimensions(m_eye, m_width, m_height);
             
-            m_frame4ch = cvCreateImage(cvSize(m_width, m_height), IPL_DEPTH_8U, 4);
-            m_frame = cvCreateImage(cvSize(m_width, m_height), IPL_DEPTH_8U, 3);
-            
             CLEyeCameraStart(m_eye);
+            m_bStreaming = true;
             CLEyeSetCameraParameter(m_eye, CLEYE_AUTO_EXPOSURE, false);
             CLEyeSetCameraParameter(m_eye, CLEYE_AUTO_GAIN, false);
             m_index = _index;
@@ -237,9 +262,11 @@ protected:
     {
         if (isOpened())
         {
-            CLEyeCameraStop(m_eye);
+            if (m_bStreaming)
+                CLEyeCameraStop(m_eye);
             CLEyeDestroyCamera(m_eye);
         }
+        m_bStreaming = false;
         cvReleaseImage(&m_frame);
         cvReleaseImage(&m_frame4ch);
         m_index = -1;
@@ -251,6 +278,7 @@ protected:
     IplImage* m_frame;
     IplImage* m_frame4ch;
     CLEyeCameraInstance m_eye;
+    bool m_bStreaming;
 };
 
 // We don't need an implementation for CL EYE Driver because
@@ -313,6 +341,15 @@ public:
         }
         switch (property_id)
         {
+        case PSEYE_CAP_PROP_STREAMING:
+            if ((value != 0) != eye->isStreaming())
+            {
+                if (value != 0)
+                    eye->start();
+                else
+                    eye->stop();
+            }
+            return true;
         case CV_CAP_PROP_BRIGHTNESS:
             // [0, 255] [20]
             eye->setBrightness((int)round(value));
@@ -370,6 +407,16 @@ public:
 
     bool retrieveFrame(int outputType, cv::OutputArray outArray)
     {
+        if (outputType == PSEYE_RAW_BAYER_IMAGE)
+        {
+            // Hand out the raw frame without going through the intermediate Bayer buffer
+            outArray.create(cv::Size(m_width, m_height), CV_8UC1);
+            cv::Mat bayerFrame = outArray.getMat();
+
+            eye->getFrame(bayerFrame.data);
+            return true;
+        }
+
         eye->getFrame(m_MatBayer.data);
 
         cv::cvtColor(m_MatBayer, outArray, CV_BayerGB2BGR);
@@ -620,6 +667,35 @@ std::string PSEyeVideoCapture::getUniqueIndentifier() const
     return m_indentifier;
 }
 
+bool PSEyeVideoCapture::getIsRawBayerSupported() const
+{
+#ifdef HAVE_PS3EYE
+    return !icap.empty() && icap->getCaptureDomain() == PSEYE_CAP_PS3EYE;
+#else
+    return false;
+#endif
+}
+
+bool PSEyeVideoCapture::getIsNativeBGRASupported() const
+{
+#ifdef HAVE_CLEYE
+    return !icap.empty() && icap->getCaptureDomain() == PSEYE_CAP_CLMULTI;
+#else
+    return false;
+#endif
+}
+
+bool PSEyeVideoCapture::getIsStreamingControlSupported() const
+{
+    // Same capture domains: our PS3EYEDriver and CL Eye MultiCam captures
+    return getIsRawBayerSupported() || getIsNativeBGRASupported();
+}
+
+bool PSEyeVideoCapture::setStreaming(bool bStreaming)
+{
+    return getIsStreamingControlSupported() && icap->setProperty(PSEYE_CAP_PROP_STREAMING, bStreaming ? 1.0 : 0.0);
+}
+
 cv::Ptr<cv::IVideoCapture> PSEyeVideoCapture::pseyeVideoCapture_create(int index)
 {
     // https://github.com/Itseez/opencv/blob/09e6c82190b558e74e2e6a53df09844665443d6d/modules/videoio/src/cap.cpp#L432
@@ -3,6 +3,19 @@
 
 #include <opencv2/videoio.hpp>
 
+enum
+{
+    /// Pass to retrieve() to get the raw (GB pattern) Bayer frame rather than BGR.
+    /// Only supported when \ref PSEyeVideoCapture::getIsRawBayerSupported() is true.
+    PSEYE_RAW_BAYER_IMAGE = 1000,
+    /// Pass to retrieve() to get the frame in the driver's native 4 channel BGRA layout
+    /// rather than having it converted to BGR. Only supported when \ref PSEyeVideoCapture::getIsNativeBGRASupported() is true.
+    PSEYE_NATIVE_BGRA_IMAGE = 1001,
+    /// Pass to cv::IVideoCapture::setProperty() to stop (0) or restart (1) the camera stream.
+    /// See \ref PSEyeVideoCapture::setStreaming().
+    PSEYE_CAP_PROP_STREAMING = 1002
+};
+
 /// Video capture class that prioritizes PS3 Eye devices.
 /**
 Device opening priority:
@@ -48,6 +61,19 @@ public:
 
     /// Get the unique identifier for the camera
     std::string getUniqueIndentifier() const;
+
+    /// True if retrieve() can hand out raw Bayer frames (PS3EYEDriver only)
+    bool getIsRawBayerSupported() const;
+
+    /// True if retrieve() can hand out the driver's native BGRA frames (CL Eye MultiCam only)
+    bool getIsNativeBGRASupported() const;
+
+    /// True if setStreaming() works (CL Eye MultiCam and PS3EYEDriver only)
+    bool getIsStreamingControlSupported() const;
+
+    /// Stop or restart the camera stream without closing the camera, which frees its USB bandwidth.
+    /// grab() fails while the stream is stopped. Returns false if the driver can't stop the stream.
+    bool setStreaming(bool bStreaming);
     
 protected:
     int m_index; /**< Keep track of index. Necessary for PSEYE_CLEYE_DRIVER */
@@ -0,0 +1,312 @@
+// -- includes -----
+#include "RemoteTracker.h"
+#include "ServerLog.h"
+#include <cctype>
+
+// -- RemoteTracker
+RemoteTracker::RemoteTracker()
+    : PS3EyeTracker()
+    , bIsOpen(false)
+    , CurrentProjections()
+    , CurrentFrameSequenceNumber(-1)
+    , CurrentFrameTimestamp()
+{
+}
+
+RemoteTracker::~RemoteTracker()
+{
+    if (getIsOpen())
+    {
+        SERVER_LOG_ERROR("~RemoteTracker") << "Tracker deleted without calling close() first!";
+    }
+}
+
+// -- IDeviceInterface
+bool RemoteTracker::matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const
+{
+    bool matches = false;
+
+    if (enumerator->get_device_type() == CommonControllerState::PS3EYE)
+    {
+        std::string enumerator_path = enumerator->get_path();
+
+        matches = (enumerator_path == USBDevicePath);
+    }
+
+    return matches;
+}
+
+bool RemoteTracker::open(const DeviceEnumerator *enumerator)
+{
+    const char *cur_dev_path = enumerator->get_path();
+    const CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+    CameraNodeCameraInfo camera_info;
+
+    bool bSuccess = false;
+
+    if (getIsOpen())
+    {
+        SERVER_LOG_WARNING("RemoteTracker::open") << "RemoteTracker(" << cur_dev_path << ") already open. Ignoring request.";
+        bSuccess = true;
+    }
+    else if (camera_node_link != nullptr && camera_node_link->getRemoteCameraInfo(cur_dev_path, camera_info))
+    {
+        SERVER_LOG_INFO("RemoteTracker::open") << "Opening RemoteTracker(" << cur_dev_path << ")";
+
+        // One config per camera node address and node tracker id
+        std::string config_name = "PS3EyeTrackerConfig_";
+        for (const char *c = cur_dev_path; *c != '\0'; ++c)
+        {
+            config_name.push_back(isalnum(static_cast<unsigned char>(*c)) ? *c : '_');
+        }
+
+        USBDevicePath = cur_dev_path;
+        CurrentProjections.clear();
+        CurrentFrameSequenceNumber = -1;
+
+        cfg = PS3EyeTrackerConfig(config_name);
+        cfg.load();
+        applyCameraInfo(camera_info);
+        cfg.save();
+
+        bIsOpen = true;
+        bSuccess = true;
+    }
+    else
+    {
+        SERVER_LOG_ERROR("RemoteTracker::open") << "Camera node stopped sending the projections of " << cur_dev_path;
+    }
+
+    return bSuccess;
+}
+
+bool RemoteTracker::getIsOpen() const
+{
+    return bIsOpen;
+}
+
+bool RemoteTracker::getIsReadyToPoll() const
+{
+    return getIsOpen();
+}
+
+IDeviceInterface::ePollResult RemoteTracker::poll()
+{
+    IDeviceInterface::ePollResult result = IDeviceInterface::_PollResultFailure;
+    const CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+
+    if (getIsOpen() && camera_node_link != nullptr)
+    {
+        CameraNodeCameraInfo camera_info;
+
+        if (camera_node_link->fetchRemoteCameraProjections(
+                USBDevicePath, CurrentFrameSequenceNumber,
+                CurrentFrameSequenceNumber, CurrentFrameTimestamp, CurrentProjections))
+        {
+            // Follows camera mode changes and lens recalibrations on the camera node
+            if (camera_node_link->getRemoteCameraInfo(USBDevicePath, camera_info))
+            {
+                applyCameraInfo(camera_info);
+            }
+
+            result = IDeviceInterface::_PollResultSuccessNewData;
+        }
+        else
+        {
+            // No frame processed on the camera node since the last poll.
+            // A camera node that went quiet drops out of the tracker list (see CameraNodeLink::update()).
+            result = IDeviceInterface::_PollResultSuccessNoData;
+        }
+
+        {
+            PS3EyeTrackerState newState;
+
+            newState.CaptureTimestamp = CurrentFrameTimestamp;
+            newState.PollSequenceNumber = NextPollSequenceNumber;
+            ++NextPollSequenceNumber;
+
+            TrackerStates.push_back(newState);
+        }
+    }
+
+    return result;
+}
+
+void RemoteTracker::close()
+{
+    bIsOpen = false;
+    CurrentProjections.clear();
+    CurrentFrameSequenceNumber = -1;
+}
+
+// -- ITrackerInterface
+bool RemoteTracker::getVideoFrameDimensions(
+    int *out_width,
+    int *out_height,
+    int *out_stride) const
+{
+    const int width = static_cast<int>(getFrameWidth());
+
+    if (out_width != nullptr)
+    {
+        *out_width = width;
+    }
+
+    if (out_height != nullptr)
+    {
+        *out_height = static_cast<int>(getFrameHeight());
+    }
+
+    if (out_stride != nullptr)
+    {
+        *out_stride = width*3;
+    }
+
+    return true;
+}
+
+const unsigned char *RemoteTracker::getVideoFrameBuffer() const
+{
+    // The frames stay on the camera node
+    return nullptr;
+}
+
+void RemoteTracker::getVideoFrameBufferLayout(
+    int *out_bytes_per_pixel,
+    int *out_stride) const
+{
+    if (out_bytes_per_pixel != nullptr)
+    {
+        *out_bytes_per_pixel = 3;
+    }
+
+    if (out_stride != nullptr)
+    {
+        *out_stride = static_cast<int>(getFrameWidth())*3;
+    }
+}
+
+const unsigned char *RemoteTracker::getRawBayerFrameBuffer() const
+{
+    return nullptr;
+}
+
+long long RemoteTracker::getVideoFrameSequenceNumber() const
+{
+    return CurrentFrameSequenceNumber;
+}
+
+bool RemoteTracker::setRawBayerFrameCapture(bool bEnable)
+{
+    return !bEnable;
+}
+
+bool RemoteTracker::setCaptureSuspended(bool bSuspended)
+{
+    // The camera node runs its cameras
+    return !bSuspended;
+}
+
+void RemoteTracker::loadSettings()
+{
+    const CameraNodeLink *camera_node_link = CameraNodeLink::get_instance();
+    CameraNodeCameraInfo camera_info;
+
+    cfg.load();
+
+    if (camera_node_link != nullptr && camera_node_link->getRemoteCameraInfo(USBDevicePath, camera_info))
+    {
+        applyCameraInfo(camera_info);
+    }
+}
+
+// The camera mode gets set on the camera node
+void RemoteTracker::setFrameWidth(double value, bool bUpdateConfig)
+{
+}
+
+double RemoteTracker::getFrameWidth() const
+{
+	return cfg.frame_width;
+}
+
+void RemoteTracker::setFrameHeight(double value, bool bUpdateConfig)
+{
+}
+
+double RemoteTracker::getFrameHeight() const
+{
+	return cfg.frame_height;
+}
+
+void RemoteTracker::setFrameRate(double value, bool bUpdateConfig)
+{
+}
+
+double RemoteTracker::getFrameRate() const
+{
+	return cfg.frame_rate;
+}
+
+// The camera node runs the exposure of its cameras, these only go in the config
+void RemoteTracker::setExposure(double value, bool bUpdateConfig)
+{
+	if (bUpdateConfig)
+	{
+		cfg.exposure = value;
+	}
+}
+
+double RemoteTracker::getExposure() const
+{
+	return cfg.exposure;
+}
+
+void RemoteTracker::setGain(double value, bool bUpdateConfig)
+{
+	if (bUpdateConfig)
+	{
+		cfg.gain = value;
+	}
+}
+
+double RemoteTracker::getGain() const
+{
+	return cfg.gain;
+}
+
+// -- RemoteTracker
+const CameraNodePoseEstimate *RemoteTracker::getProjection(bool bIsHMD, int device_id) const
+{
+    for (const CameraNodeProjection &projection : CurrentProjections)
+    {
+        if ((projection.is_hmd != 0) == bIsHMD && projection.device_id == device_id)
+        {
+            return &projection.pose_estimate;
+        }
+    }
+
+    return nullptr;
+}
+
+void RemoteTracker::applyCameraInfo(const CameraNodeCameraInfo &camera_info)
+{
+    // The camera node reports its intrinsics in the current camera mode
+    cfg.high_speed_profile = false;
+    cfg.frame_width = camera_info.frame_width;
+    cfg.frame_height = camera_info.frame_height;
+    cfg.frame_rate = camera_info.frame_rate;
+    cfg.focalLengthX = camera_info.focal_length_x;
+    cfg.focalLengthY = camera_info.focal_length_y;
+    cfg.principalX = camera_info.principal_x;
+    cfg.principalY = camera_info.principal_y;
+    cfg.distortionK1 = camera_info.distortion_k1;
+    cfg.distortionK2 = camera_info.distortion_k2;
+    cfg.distortionK3 = camera_info.distortion_k3;
+    cfg.distortionP1 = camera_info.distortion_p1;
+    cfg.distortionP2 = camera_info.distortion_p2;
+    cfg.hfov = camera_info.hfov;
+    cfg.vfov = camera_info.vfov;
+    cfg.zNear = camera_info.z_near;
+    cfg.zFar = camera_info.z_far;
+}
@@ -0,0 +1,64 @@
+#ifndef REMOTE_TRACKER_H
+#define REMOTE_TRACKER_H
+
+// -- includes -----
+#include "PS3EyeTracker.h"
+#include "CameraNodeLink.h"
+
+// -- definitions -----
+/// PS3Eye tracker on a camera node, see CameraNodeLink.
+/**
+ Has no video frames of its own: the camera node searches them and the tracker hands out
+ the projections it sent back (through ServerTrackerView::fetch*ProjectionResult()).
+ The camera mode and lens calibration come from the camera node, the pose and color presets
+ live in a PS3EyeTrackerConfig on this end like for any local camera.
+ */
+class RemoteTracker : public PS3EyeTracker
+{
+public:
+    RemoteTracker();
+    virtual ~RemoteTracker();
+
+    // -- IDeviceInterface
+    bool matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const override;
+    bool open(const DeviceEnumerator *enumerator) override;
+    bool getIsOpen() const override;
+    bool getIsReadyToPoll() const override;
+    IDeviceInterface::ePollResult poll() override;
+    void close() override;
+
+    // -- ITrackerInterface
+    bool getVideoFrameDimensions(int *out_width, int *out_height, int *out_stride) const override;
+    const unsigned char *getVideoFrameBuffer() const override;
+    void getVideoFrameBufferLayout(int *out_bytes_per_pixel, int *out_stride) const override;
+    const unsigned char *getRawBayerFrameBuffer() const override;
+    long long getVideoFrameSequenceNumber() const override;
+    bool setRawBayerFrameCapture(bool bEnable) override;
+    bool setCaptureSuspended(bool bSuspended) override;
+    void loadSettings() override;
+	void setFrameWidth(double value, bool bUpdateConfig) override;
+	double getFrameWidth() const override;
+	void setFrameHeight(double value, bool bUpdateConfig) override;
+	double getFrameHeight() const override;
+	void setFrameRate(double value, bool bUpdateConfig) override;
+	double getFrameRate() const override;
+    void setExposure(double value, bool bUpdateConfig) override;
+    double getExposure() const override;
+	void setGain(double value, bool bUpdateConfig) override;
+	double getGain() const override;
+
+    // -- RemoteTracker
+    /// The device's projection in the camera node's latest frame, or null if it wasn't found
+    const CameraNodePoseEstimate *getProjection(bool bIsHMD, int device_id) const;
+
+private:
+    // Takes the camera node's camera mode and lens calibration
+    void applyCameraInfo(const CameraNodeCameraInfo &camera_info);
+
+    bool bIsOpen;
+    std::vector<CameraNodeProjection> CurrentProjections;
+    long long CurrentFrameSequenceNumber;
+    std::chrono::time_point<std::chrono::high_resolution_clock> CurrentFrameTimestamp;
+};
+
+#endif // REMOTE_TRACKER_H
@@ -5,6 +5,7 @@
 #include "ControllerUSBDeviceEnumerator.h"
 #include "ControllerHidDeviceEnumerator.h"
 #include "ControllerGamepadEnumerator.h"
+#include "DeviceInputLog.h"
 #include "ServerLog.h"
 #include "ServerUtility.h"
 #include "USBDeviceManager.h"
@@ -12,7 +13,7 @@
 
 #include "hidapi.h"
 
-#include "gamepad/Gamepad.h"
+#include "GamepadPoller.h"
 
 #include <iostream>
 #include <sstream>
@@ -207,7 +208,7 @@ public:
 			m_hidDevice= in_hid_device;
 
 			// Perform blocking reads on the worker thread
-			hid_set_nonblocking(m_hidDevice, 0);
+			logged_hid_set_nonblocking(m_hidDevice, 0);
 
 			// Fire up the worker thread
 			WorkerThread::startThread();
@@ -225,7 +226,7 @@ protected:
 		// Attempt to read the next sensor update packet from 
 		PSNaviDataInputHID rawHIDPacket;
 		memset(&rawHIDPacket, 0, sizeof(PSNaviDataInputHID));
-		int res = hid_read_timeout(m_hidDevice, (unsigned char*)&rawHIDPacket, sizeof(PSNaviDataInputHID), HID_READ_TIMEOUT);
+		int res = logged_hid_read_timeout(m_hidDevice, (unsigned char*)&rawHIDPacket, sizeof(PSNaviDataInputHID), HID_READ_TIMEOUT);
 
 		if (res > 0)
 		{
@@ -236,7 +237,7 @@ protected:
 		{
 			char hidapi_err_mbs[256];
 			bool valid_error_mesg = 
-				ServerUtility::convert_wcs_to_mbs(hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
+				ServerUtility::convert_wcs_to_mbs(logged_hid_error(m_hidDevice), hidapi_err_mbs, sizeof(hidapi_err_mbs));
 
 			// Device no longer in valid state.
 			if (valid_error_mesg)
@@ -361,7 +362,7 @@ bool PSNaviController::open(
 			APIContext->product_id = pEnum->get_product_id();
 			APIContext->hid_device_path= pEnum->get_path();
 			APIContext->hid_interface_number= hidEnum->get_interface_number();
-			APIContext->hid_device_handle = hid_open_path(APIContext->hid_device_path.c_str());
+			APIContext->hid_device_handle = logged_hid_open_path(APIContext->hid_device_path.c_str());
 
 			char szSerialNo[64];
 			if (hidEnum->get_serial_number(szSerialNo, sizeof(szSerialNo)))
@@ -394,12 +395,12 @@ bool PSNaviController::open(
 
 			if (gamepad_index != -1)
 			{
-				const Gamepad_device * gamepad = Gamepad_deviceAtIndex(static_cast<unsigned int>(gamepad_index));
+				GamepadState gamepad;
 
-				if (gamepad != nullptr)
+				if (GamepadPoller::fetchGamepadState(gamepad_index, gamepad))
 				{
 					char device_path[255];
-					ServerUtility::format_string(device_path, sizeof(device_path), "%s #%d", gamepad->description, gamepad_index);
+					ServerUtility::format_string(device_path, sizeof(device_path), "%s #%d", gamepad.description, gamepad_index);
 
 					SERVER_LOG_INFO("PSNaviController::open") << "  Successfully opened gamepad: " << device_path;
 					APIContext->gamepad_index = gamepad_index;
@@ -527,7 +528,7 @@ void PSNaviController::close()
 				m_HIDPacketProcessor= nullptr;
 			}
 
-			hid_close(APIContext->hid_device_handle);
+			logged_hid_close(APIContext->hid_device_handle);
 			APIContext->hid_device_handle = nullptr;
 		}
 		else if (APIContext->gamepad_index != -1)
@@ -881,10 +882,10 @@ PSNaviController::pollGamepad()
 {
 	assert(getIsOpen());
 
-	const Gamepad_device * gamepad = Gamepad_deviceAtIndex(static_cast<unsigned int>(APIContext->gamepad_index));
+	GamepadState gamepad;
 	IControllerInterface::ePollResult result= IControllerInterface::_PollResultSuccessNewData;
 
-	if (gamepad != nullptr)
+	if (GamepadPoller::fetchGamepadState(APIContext->gamepad_index, gamepad))
 	{
 		PSNaviControllerInputState newState;
 
@@ -893,16 +894,16 @@ PSNaviController::pollGamepad()
 		++NextPollSequenceNumber;
 
 		// New Button State
-		bool bIsDPadUpPressed= gamepad->buttonStates[0];
-		bool bIsDPadDownPressed= gamepad->buttonStates[1];
-		bool bIsDPadLeftPressed= gamepad->buttonStates[2];
-		bool bIsDPadRightPressed= gamepad->buttonStates[3];
-		bool bIsL2Pressed= gamepad->axisStates[4] >= .9f;
-		bool bIsL3Pressed= gamepad->buttonStates[6];
-		bool bIsL1Pressed= gamepad->buttonStates[8];
-		bool bIsCrossPressed= gamepad->buttonStates[10];
-		bool bIsCirclePressed= gamepad->buttonStates[11];
-		bool bIsPSPressed = gamepad->buttonStates[14];
+		bool bIsDPadUpPressed= gamepad.buttonStates[0];
+		bool bIsDPadDownPressed= gamepad.buttonStates[1];
+		bool bIsDPadLeftPressed= gamepad.buttonStates[2];
+		bool bIsDPadRightPressed= gamepad.buttonStates[3];
+		bool bIsL2Pressed= gamepad.axisStates[4] >= .9f;
+		bool bIsL3Pressed= gamepad.buttonStates[6];
+		bool bIsL1Pressed= gamepad.buttonStates[8];
+		bool bIsCrossPressed= gamepad.buttonStates[10];
+		bool bIsCirclePressed= gamepad.buttonStates[11];
+		bool bIsPSPressed = gamepad.buttonStates[14];
 
 		newState.AllButtons = 0;
 		setButtonBit(newState.AllButtons, Btn_UP, bIsDPadUpPressed);
@@ -930,9 +931,9 @@ PSNaviController::pollGamepad()
 		newState.L3 = getButtonState(newState.AllButtons, lastButtons, Btn_L3);
 
 		// Analog triggers
-		newState.Stick_XAxis = static_cast<unsigned char>((gamepad->axisStates[0] + 1.f) * 127.f);
-		newState.Stick_YAxis = static_cast<unsigned char>((gamepad->axisStates[1] + 1.f) * 127.f);
-		newState.Trigger = static_cast<unsigned char>((gamepad->axisStates[4] + 1.f) * 127.f);
+		newState.Stick_XAxis = static_cast<unsigned char>((gamepad.axisStates[0] + 1.f) * 127.f);
+		newState.Stick_YAxis = static_cast<unsigned char>((gamepad.axisStates[1] + 1.f) * 127.f);
+		newState.Trigger = static_cast<unsigned char>((gamepad.axisStates[4] + 1.f) * 127.f);
 
 		// Can't report the true battery state
 		newState.Battery = CommonControllerState::Batt_MAX;
@@ -1055,6 +1056,11 @@ float PSNaviController::getPredictionTime() const
 	return 0.f; // No state prediction on the psnavi
 }
 
+eCommonVisionPriority PSNaviController::getVisionPriority() const
+{
+	return VisionPriority_Normal; // Never optically tracked
+}
+
 bool PSNaviController::getWasSystemButtonPressed() const
 {
     const PSNaviControllerInputState *psnavi_state= static_cast<const PSNaviControllerInputState *>(getState());
@@ -112,6 +112,7 @@ public:
 	virtual bool getTrackingColorID(eCommonTrackingColorID &out_tracking_color_id) const override;
 	virtual float getIdentityForwardDegrees() const override;
 	virtual float getPredictionTime() const override;
+	virtual eCommonVisionPriority getVisionPriority() const override;
     virtual bool getWasSystemButtonPressed() const override;
         
 private:    
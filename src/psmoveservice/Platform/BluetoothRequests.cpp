@@ -2,9 +2,12 @@
 #include "BluetoothRequests.h"
 #include "DeviceManager.h"
 
-AsyncBluetoothRequest::AsyncBluetoothRequest(int connectionId)
+AsyncBluetoothRequest::AsyncBluetoothRequest(int connectionId, int timeoutMs)
     : m_connectionId(connectionId)
     , m_status(preflight)
+    , m_timeoutMs(timeoutMs)
+    , m_bTimedOut(false)
+    , m_startTimestamp(std::chrono::high_resolution_clock::now())
 {
 	// Tell the platform layer to stop listening to bluetooth device connection changes
 	// while bluetooth device pairing is in progress
@@ -15,4 +18,23 @@ AsyncBluetoothRequest::~AsyncBluetoothRequest()
 {
 	// Tell the platform layer to resume listening to bluetooth device connection changes
 	DeviceManager::getInstance()->handle_bluetooth_request_finished();
-}
\ No newline at end of file
+}
+
+bool AsyncBluetoothRequest::pollTimeout()
+{
+    bool bJustTimedOut= false;
+
+    if (!m_bTimedOut && m_status == running && m_timeoutMs > 0)
+    {
+        const std::chrono::duration<double, std::milli> elapsed=
+            std::chrono::high_resolution_clock::now() - m_startTimestamp;
+
+        if (elapsed.count() >= static_cast<double>(m_timeoutMs))
+        {
+            m_bTimedOut= true;
+            bJustTimedOut= true;
+        }
+    }
+
+    return bJustTimedOut;
+}
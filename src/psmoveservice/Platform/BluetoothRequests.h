@@ -2,9 +2,15 @@
 #define BLUETOOTH_REQUESTS_H
 
 //-- includes -----
+#include <chrono>
 #include <memory>
 #include <string>
 
+//-- constants -----
+// The device scan retries until it finds the controller, so pairing needs an upper bound
+#define BLUETOOTH_PAIR_REQUEST_TIMEOUT_MS 120000
+#define BLUETOOTH_UNPAIR_REQUEST_TIMEOUT_MS 30000
+
 //-- typedefs -----
 class ServerControllerView;
 typedef std::shared_ptr<ServerControllerView> ServerControllerViewPtr;
@@ -28,7 +34,7 @@ public:
         connectionClosed
     };
 
-    AsyncBluetoothRequest(int connectionId);
+    AsyncBluetoothRequest(int connectionId, int timeoutMs);
     virtual ~AsyncBluetoothRequest();
 
     virtual bool start()= 0;
@@ -38,9 +44,16 @@ public:
     virtual eStatusCode getStatusCode()= 0;
     virtual std::string getDescription()= 0;
 
+    // Main thread. Returns true once when a running request passes its timeout.
+    // The caller is expected to cancel it and keep updating it until the worker thread finishes.
+    bool pollTimeout();
+
 protected:
     int m_connectionId;
     eStatusCode m_status;
+    int m_timeoutMs;
+    bool m_bTimedOut;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_startTimestamp;
 };
 
 class AsyncBluetoothUnpairDeviceRequest : public AsyncBluetoothRequest
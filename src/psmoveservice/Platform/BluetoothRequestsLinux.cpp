@@ -244,7 +244,7 @@ public:
 AsyncBluetoothUnpairDeviceRequest::AsyncBluetoothUnpairDeviceRequest(
     int connectionId,
     ServerControllerViewPtr controllerView)
-    : AsyncBluetoothRequest(connectionId)
+    : AsyncBluetoothRequest(connectionId, BLUETOOTH_UNPAIR_REQUEST_TIMEOUT_MS)
     , m_controllerView(controllerView)
     , m_internal_state(nullptr)
 {
@@ -305,7 +305,7 @@ AsyncBluetoothUnpairDeviceRequest::getDescription()
 AsyncBluetoothPairDeviceRequest::AsyncBluetoothPairDeviceRequest(
     int connectionId,
     ServerControllerViewPtr controllerView)
-    : AsyncBluetoothRequest(connectionId)
+    : AsyncBluetoothRequest(connectionId, BLUETOOTH_PAIR_REQUEST_TIMEOUT_MS)
     , m_controllerView(controllerView)
     , m_internal_state(nullptr)
 {
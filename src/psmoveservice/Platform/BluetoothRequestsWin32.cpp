@@ -333,7 +333,7 @@ static void send_progress_notification_to_client(int connectionID, int controlle
 AsyncBluetoothUnpairDeviceRequest::AsyncBluetoothUnpairDeviceRequest(
     int connectionId,
     ServerControllerViewPtr controllerView)
-    : AsyncBluetoothRequest(connectionId)
+    : AsyncBluetoothRequest(connectionId, BLUETOOTH_UNPAIR_REQUEST_TIMEOUT_MS)
     , m_controllerView(controllerView)
     , m_internal_state(nullptr)
 {
@@ -534,7 +534,7 @@ AsyncBluetoothUnpairDeviceRequest::getDescription()
 AsyncBluetoothPairDeviceRequest::AsyncBluetoothPairDeviceRequest(
     int connectionId,
     ServerControllerViewPtr controllerView)
-    : AsyncBluetoothRequest(connectionId)
+    : AsyncBluetoothRequest(connectionId, BLUETOOTH_PAIR_REQUEST_TIMEOUT_MS)
     , m_controllerView(controllerView)
     , m_internal_state(nullptr)
 {
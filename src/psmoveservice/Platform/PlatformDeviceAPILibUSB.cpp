@@ -0,0 +1,288 @@
+// -- include -----
+#include "PlatformDeviceAPILibUSB.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+
+#include "libusb.h"
+
+#if defined(__linux__)
+#include <libudev.h>
+#include <poll.h>
+#endif
+
+#include <string>
+#include <string.h>
+
+//-- constants -----
+// Cameras get told apart from everything else so a USB controller plugged in
+// doesn't make the tracker manager enumerate the cameras again (and vice versa).
+// Keep in sync with k_supported_tracker_infos in TrackerDeviceEnumerator.cpp.
+static const uint16_t k_ps3eye_vendor_id = 0x1415;
+static const uint16_t k_ps3eye_product_id = 0x2000;
+
+//-- private definitions -----
+struct PlatformDeviceAPILibUSBState
+{
+	IDeviceHotplugListener *broadcaster;
+
+	libusb_context *usb_context;
+	libusb_hotplug_callback_handle usb_hotplug_handle;
+	bool bHasUSBHotplug;
+
+#if defined(__linux__)
+	struct udev *udev_context;
+	struct udev_monitor *hidraw_monitor;
+#endif
+};
+
+//-- private prototypes -----
+static int LIBUSB_CALL usb_hotplug_callback(
+	libusb_context *ctx, libusb_device *device, libusb_hotplug_event event, void *user_data);
+static DeviceClass get_usb_device_class(const struct libusb_device_descriptor &dev_desc);
+
+#if defined(__linux__)
+static void poll_hidraw_monitor(PlatformDeviceAPILibUSBState *state);
+#endif
+
+// -- definitions -----
+PlatformDeviceAPILibUSB::PlatformDeviceAPILibUSB()
+	: m_state(new PlatformDeviceAPILibUSBState)
+{
+	memset(m_state, 0, sizeof(PlatformDeviceAPILibUSBState));
+}
+
+PlatformDeviceAPILibUSB::~PlatformDeviceAPILibUSB()
+{
+	shutdown();
+	delete m_state;
+}
+
+// System
+bool PlatformDeviceAPILibUSB::startup(IDeviceHotplugListener *broadcaster)
+{
+	m_state->broadcaster = broadcaster;
+
+	// Missing hotplug support isn't fatal,
+	// the device managers just keep enumerating the devices it can't report
+	if (libusb_init(&m_state->usb_context) == LIBUSB_SUCCESS)
+	{
+		if (libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG) != 0)
+		{
+			const int result =
+				libusb_hotplug_register_callback(
+					m_state->usb_context,
+					static_cast<libusb_hotplug_event>(LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT),
+					static_cast<libusb_hotplug_flag>(0),
+					LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY,
+					usb_hotplug_callback,
+					m_state,
+					&m_state->usb_hotplug_handle);
+
+			m_state->bHasUSBHotplug = (result == LIBUSB_SUCCESS);
+		}
+
+		if (!m_state->bHasUSBHotplug)
+		{
+			SERVER_LOG_WARNING("PlatformDeviceAPILibUSB::startup") << "libusb hotplug unavailable, USB devices will be polled";
+		}
+	}
+	else
+	{
+		SERVER_LOG_WARNING("PlatformDeviceAPILibUSB::startup") << "Failed to create libusb context, USB devices will be polled";
+		m_state->usb_context = nullptr;
+	}
+
+#if defined(__linux__)
+	m_state->udev_context = udev_new();
+	if (m_state->udev_context != nullptr)
+	{
+		m_state->hidraw_monitor = udev_monitor_new_from_netlink(m_state->udev_context, "udev");
+
+		if (m_state->hidraw_monitor != nullptr &&
+			(udev_monitor_filter_add_match_subsystem_devtype(m_state->hidraw_monitor, "hidraw", nullptr) < 0 ||
+			 udev_monitor_enable_receiving(m_state->hidraw_monitor) < 0))
+		{
+			udev_monitor_unref(m_state->hidraw_monitor);
+			m_state->hidraw_monitor = nullptr;
+		}
+	}
+
+	if (m_state->hidraw_monitor == nullptr)
+	{
+		SERVER_LOG_WARNING("PlatformDeviceAPILibUSB::startup") << "udev hidraw monitor unavailable, HID devices will be polled";
+	}
+#endif
+
+	return true;
+}
+
+void PlatformDeviceAPILibUSB::poll()
+{
+	if (m_state->bHasUSBHotplug)
+	{
+		struct timeval tv;
+		tv.tv_sec = 0;
+		tv.tv_usec = 0;
+
+		// Runs any pending hotplug callback, returns right away otherwise
+		libusb_handle_events_timeout_completed(m_state->usb_context, &tv, NULL);
+	}
+
+#if defined(__linux__)
+	if (m_state->hidraw_monitor != nullptr)
+	{
+		poll_hidraw_monitor(m_state);
+	}
+#endif
+}
+
+void PlatformDeviceAPILibUSB::shutdown()
+{
+#if defined(__linux__)
+	if (m_state->hidraw_monitor != nullptr)
+	{
+		udev_monitor_unref(m_state->hidraw_monitor);
+		m_state->hidraw_monitor = nullptr;
+	}
+
+	if (m_state->udev_context != nullptr)
+	{
+		udev_unref(m_state->udev_context);
+		m_state->udev_context = nullptr;
+	}
+#endif
+
+	if (m_state->usb_context != nullptr)
+	{
+		if (m_state->bHasUSBHotplug)
+		{
+			libusb_hotplug_deregister_callback(m_state->usb_context, m_state->usb_hotplug_handle);
+			m_state->bHasUSBHotplug = false;
+		}
+
+		libusb_exit(m_state->usb_context);
+		m_state->usb_context = nullptr;
+	}
+
+	m_state->broadcaster = nullptr;
+}
+
+// Queries
+bool PlatformDeviceAPILibUSB::get_is_hotplug_supported(const DeviceClass deviceClass) const
+{
+	bool bSupported = false;
+
+	switch (deviceClass)
+	{
+	case DeviceClass::DeviceClass_Camera:
+		bSupported = m_state->bHasUSBHotplug;
+		break;
+	case DeviceClass::DeviceClass_HID:
+		// Bluetooth controllers only show up as hidraw nodes
+#if defined(__linux__)
+		bSupported = m_state->bHasUSBHotplug && m_state->hidraw_monitor != nullptr;
+#endif
+		break;
+	default:
+		break;
+	}
+
+	return bSupported;
+}
+
+bool PlatformDeviceAPILibUSB::get_device_property(
+	const DeviceClass deviceClass,
+	const int vendor_id,
+	const int product_id,
+	const char *property_name,
+	char *buffer,
+	const int buffer_size)
+{
+	// Driver properties only exist in the Windows registry
+	return false;
+}
+
+//-- private helper methods -----
+static int LIBUSB_CALL usb_hotplug_callback(
+	libusb_context *ctx,
+	libusb_device *device,
+	libusb_hotplug_event event,
+	void *user_data)
+{
+	PlatformDeviceAPILibUSBState *state = reinterpret_cast<PlatformDeviceAPILibUSBState *>(user_data);
+	struct libusb_device_descriptor dev_desc;
+
+	if (state->broadcaster != nullptr &&
+		libusb_get_device_descriptor(device, &dev_desc) == LIBUSB_SUCCESS)
+	{
+		char device_path[64];
+
+		ServerUtility::format_string(
+			device_path, sizeof(device_path),
+			"USB\\VID_%04X&PID_%04X\\b%d_d%d",
+			dev_desc.idVendor, dev_desc.idProduct,
+			libusb_get_bus_number(device), libusb_get_device_address(device));
+
+		const DeviceClass device_class = get_usb_device_class(dev_desc);
+
+		if (event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED)
+		{
+			state->broadcaster->handle_device_connected(device_class, device_path);
+		}
+		else if (event == LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT)
+		{
+			state->broadcaster->handle_device_disconnected(device_class, device_path);
+		}
+	}
+
+	// Stay registered
+	return 0;
+}
+
+static DeviceClass get_usb_device_class(const struct libusb_device_descriptor &dev_desc)
+{
+	const bool bIsCamera =
+		(dev_desc.idVendor == k_ps3eye_vendor_id && dev_desc.idProduct == k_ps3eye_product_id) ||
+		dev_desc.bDeviceClass == LIBUSB_CLASS_VIDEO;
+
+	return bIsCamera ? DeviceClass::DeviceClass_Camera : DeviceClass::DeviceClass_HID;
+}
+
+#if defined(__linux__)
+static void poll_hidraw_monitor(PlatformDeviceAPILibUSBState *state)
+{
+	struct pollfd monitor_fd;
+	monitor_fd.fd = udev_monitor_get_fd(state->hidraw_monitor);
+	monitor_fd.events = POLLIN;
+	monitor_fd.revents = 0;
+
+	// Drain whatever arrived since the last poll without waiting for more
+	while (::poll(&monitor_fd, 1, 0) > 0 && (monitor_fd.revents & POLLIN) != 0)
+	{
+		struct udev_device *device = udev_monitor_receive_device(state->hidraw_monitor);
+
+		if (device == nullptr)
+		{
+			break;
+		}
+
+		const char *action = udev_device_get_action(device);
+		const char *devnode = udev_device_get_devnode(device);
+		const std::string device_path = (devnode != nullptr) ? devnode : "";
+
+		if (action != nullptr && state->broadcaster != nullptr)
+		{
+			if (strcmp(action, "add") == 0)
+			{
+				state->broadcaster->handle_device_connected(DeviceClass::DeviceClass_HID, device_path);
+			}
+			else if (strcmp(action, "remove") == 0)
+			{
+				state->broadcaster->handle_device_disconnected(DeviceClass::DeviceClass_HID, device_path);
+			}
+		}
+
+		udev_device_unref(device);
+	}
+}
+#endif
@@ -0,0 +1,40 @@
+#ifndef PLATFORM_DEVICE_API_LIBUSB_H
+#define PLATFORM_DEVICE_API_LIBUSB_H
+
+// -- include -----
+#include "DevicePlatformInterface.h"
+
+// -- definitions -----
+/// Hotplug events on Linux and macOS.
+/**
+ USB arrivals and removals come from a libusb hotplug callback on a libusb context of its own.
+ On Linux a udev monitor on the hidraw subsystem also reports the controllers
+ connecting over Bluetooth, which libusb never sees.
+ Both are serviced without blocking from poll(), so the events reach the listeners on the main thread.
+ */
+class PlatformDeviceAPILibUSB : public IPlatformDeviceAPI
+{
+public:
+	PlatformDeviceAPILibUSB();
+	virtual ~PlatformDeviceAPILibUSB();
+
+	// System
+	bool startup(IDeviceHotplugListener *broadcaster) override;
+	void poll() override;
+	void shutdown() override;
+
+	// Queries
+	bool get_is_hotplug_supported(const DeviceClass deviceClass) const override;
+	bool get_device_property(
+		const DeviceClass deviceClass,
+		const int vendor_id,
+		const int product_id,
+		const char *property_name,
+		char *buffer,
+		const int buffer_size) override;
+
+private:
+	struct PlatformDeviceAPILibUSBState *m_state;
+};
+
+#endif // PLATFORM_DEVICE_API_LIBUSB_H
@@ -0,0 +1,665 @@
+//-- includes -----
+#include "CameraNodeLink.h"
+#include "DeviceManager.h"
+#include "ServerLog.h"
+#include "TrackerManager.h"
+#include <algorithm>
+#include <cstring>
+#include <boost/array.hpp>
+#include <boost/asio.hpp>
+#include <boost/bind.hpp>
+
+//-- pre-declarations -----
+namespace asio = boost::asio;
+using asio::ip::udp;
+
+//-- constants -----
+const int CAMERA_NODE_DEFAULT_HOST_PORT = 9514;
+const char *CAMERA_NODE_REMOTE_CAMERA_PATH_PREFIX = "camera_node://";
+
+// Job entries are the bigger ones, and projection datagrams also carry the camera info
+static_assert(sizeof(CameraNodeJob) >= sizeof(CameraNodeProjection), "k_max_camera_node_datagram_size assumes jobs are the biggest entries");
+static const size_t k_max_camera_node_datagram_size =
+    sizeof(CameraNodeDatagramHeader) + sizeof(CameraNodeCameraInfo) + CAMERA_NODE_MAX_DATAGRAM_ENTRIES*sizeof(CameraNodeJob);
+
+static_assert(sizeof(CameraNodeDatagramHeader) == 24, "CameraNodeDatagramHeader must stay 24 bytes");
+
+//-- Camera Node Link Config -----
+const int CameraNodeLinkConfig::CONFIG_VERSION = 1;
+
+CameraNodeLinkConfig::CameraNodeLinkConfig(const std::string &fnamebase)
+    : PSMoveConfig(fnamebase)
+    , version(CONFIG_VERSION)
+    , host_enabled(false)
+    , host_port(CAMERA_NODE_DEFAULT_HOST_PORT)
+    , remote_camera_timeout_ms(2000)
+    , node_job_timeout_ms(500)
+{
+}
+
+const boost::property_tree::ptree
+CameraNodeLinkConfig::config2ptree()
+{
+    boost::property_tree::ptree pt;
+
+    pt.put("version", CameraNodeLinkConfig::CONFIG_VERSION);
+    pt.put("host_enabled", host_enabled);
+    pt.put("host_port", host_port);
+    pt.put("remote_camera_timeout_ms", remote_camera_timeout_ms);
+    pt.put("node_job_timeout_ms", node_job_timeout_ms);
+
+    return pt;
+}
+
+void
+CameraNodeLinkConfig::ptree2config(const boost::property_tree::ptree &pt)
+{
+    version = pt.get<int>("version", 0);
+
+    if (version == CameraNodeLinkConfig::CONFIG_VERSION)
+    {
+        host_enabled = pt.get<bool>("host_enabled", host_enabled);
+        host_port = pt.get<int>("host_port", host_port);
+        remote_camera_timeout_ms = pt.get<int>("remote_camera_timeout_ms", remote_camera_timeout_ms);
+        node_job_timeout_ms = pt.get<int>("node_job_timeout_ms", node_job_timeout_ms);
+    }
+    else
+    {
+        SERVER_LOG_WARNING("CameraNodeLinkConfig") <<
+            "Config version " << version << " does not match expected version " <<
+            CameraNodeLinkConfig::CONFIG_VERSION << ", Using defaults.";
+    }
+}
+
+//-- private implementation -----
+// A camera on a camera node, as seen by the host
+struct RemoteCamera
+{
+    std::string device_path;
+    udp::endpoint node_endpoint;
+    int node_tracker_id;
+    CameraNodeCameraInfo camera_info;
+    // Host side count of the camera's frames, keeps going up when the camera node restarts
+    long long frame_sequence_number;
+    long long node_frame_sequence_number;
+    std::chrono::time_point<std::chrono::high_resolution_clock> capture_timestamp;
+    std::chrono::time_point<std::chrono::high_resolution_clock> last_receive_time;
+    std::vector<CameraNodeProjection> projections;
+};
+
+// The jobs the host last sent for one of the camera node's cameras
+struct CameraNodeJobList
+{
+    std::vector<CameraNodeJob> jobs;
+    std::chrono::time_point<std::chrono::high_resolution_clock> receive_time;
+};
+
+class CameraNodeLinkImpl
+{
+public:
+    CameraNodeLinkImpl(asio::io_service &io_service, const CameraNodeLinkConfig &cfg)
+        : m_cfg(cfg)
+        , m_io_service(io_service)
+        , m_socket(io_service)
+        , m_host_endpoint()
+        , m_receive_endpoint()
+        , m_bIsHost(false)
+        , m_bIsNode(false)
+        , m_remote_cameras()
+        , m_node_job_lists()
+        , m_no_jobs()
+    {
+    }
+
+    bool open_host()
+    {
+        boost::system::error_code error;
+        const udp::endpoint endpoint(udp::v4(), static_cast<unsigned short>(m_cfg.host_port));
+
+        m_socket.open(endpoint.protocol(), error);
+
+        if (!error)
+        {
+            m_socket.bind(endpoint, error);
+        }
+
+        if (!error)
+        {
+            m_socket.non_blocking(true, error);
+        }
+
+        if (!error)
+        {
+            SERVER_LOG_INFO("CameraNodeLink::open_host") << "Accepting camera nodes on port " << m_cfg.host_port;
+            m_bIsHost = true;
+            start_receive();
+        }
+        else
+        {
+            SERVER_LOG_ERROR("CameraNodeLink::open_host") << "Can't accept camera nodes on port " << m_cfg.host_port << ": " << error.message();
+            close();
+        }
+
+        return m_bIsHost;
+    }
+
+    bool open_node(const std::string &host_address)
+    {
+        boost::system::error_code error;
+        std::string host_name = host_address;
+        std::string host_port = std::to_string(CAMERA_NODE_DEFAULT_HOST_PORT);
+        const size_t port_separator = host_address.rfind(':');
+
+        if (port_separator != std::string::npos)
+        {
+            host_name = host_address.substr(0, port_separator);
+            host_port = host_address.substr(port_separator + 1);
+        }
+
+        udp::resolver resolver(m_io_service);
+        const udp::resolver::iterator endpoint_iter = resolver.resolve(udp::resolver::query(udp::v4(), host_name, host_port), error);
+
+        if (!error)
+        {
+            m_host_endpoint = *endpoint_iter;
+            m_socket.open(udp::v4(), error);
+        }
+
+        if (!error)
+        {
+            // Any local port will do, the host answers whoever sent the projections
+            m_socket.bind(udp::endpoint(udp::v4(), 0), error);
+        }
+
+        if (!error)
+        {
+            m_socket.non_blocking(true, error);
+        }
+
+        if (!error)
+        {
+            SERVER_LOG_INFO("CameraNodeLink::open_node") << "Running as a camera node of " << m_host_endpoint;
+            m_bIsNode = true;
+            start_receive();
+        }
+        else
+        {
+            SERVER_LOG_ERROR("CameraNodeLink::open_node") << "Can't stream to camera node host " << host_address << ": " << error.message();
+            close();
+        }
+
+        return m_bIsNode;
+    }
+
+    void close()
+    {
+        if (m_socket.is_open())
+        {
+            boost::system::error_code error;
+            m_socket.close(error);
+        }
+
+        m_bIsHost = false;
+        m_bIsNode = false;
+        m_remote_cameras.clear();
+        m_node_job_lists.clear();
+    }
+
+    inline bool get_is_host() const
+    {
+        return m_bIsHost;
+    }
+
+    inline bool get_is_node() const
+    {
+        return m_bIsNode;
+    }
+
+    void update()
+    {
+        if (!m_bIsHost)
+        {
+            return;
+        }
+
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+        const std::chrono::milliseconds timeout(m_cfg.remote_camera_timeout_ms);
+        const size_t old_camera_count = m_remote_cameras.size();
+
+        m_remote_cameras.erase(
+            std::remove_if(
+                m_remote_cameras.begin(), m_remote_cameras.end(),
+                [now, timeout](const RemoteCamera &camera) {
+                    if (now - camera.last_receive_time < timeout)
+                    {
+                        return false;
+                    }
+
+                    SERVER_LOG_WARNING("CameraNodeLink::update") << "Lost remote camera " << camera.device_path;
+                    return true;
+                }),
+            m_remote_cameras.end());
+
+        if (m_remote_cameras.size() != old_camera_count)
+        {
+            DeviceManager::getInstance()->m_tracker_manager->handleRemoteCameraListChanged();
+        }
+    }
+
+    void get_remote_camera_paths(std::vector<std::string> &out_device_paths) const
+    {
+        for (const RemoteCamera &camera : m_remote_cameras)
+        {
+            out_device_paths.push_back(camera.device_path);
+        }
+    }
+
+    const RemoteCamera *find_remote_camera(const std::string &device_path) const
+    {
+        for (const RemoteCamera &camera : m_remote_cameras)
+        {
+            if (camera.device_path == device_path)
+            {
+                return &camera;
+            }
+        }
+
+        return nullptr;
+    }
+
+    RemoteCamera *find_remote_camera(const std::string &device_path)
+    {
+        return const_cast<RemoteCamera *>(static_cast<const CameraNodeLinkImpl *>(this)->find_remote_camera(device_path));
+    }
+
+    void send_remote_camera_jobs(const std::string &device_path, const std::vector<CameraNodeJob> &jobs)
+    {
+        const RemoteCamera *camera = find_remote_camera(device_path);
+
+        if (m_bIsHost && camera != nullptr)
+        {
+            const size_t job_count = std::min(jobs.size(), static_cast<size_t>(CAMERA_NODE_MAX_DATAGRAM_ENTRIES));
+            CameraNodeDatagramHeader header;
+
+            init_header(header, CameraNodeDatagram_Jobs, camera->node_tracker_id, job_count, sizeof(CameraNodeJob));
+            send_datagram(camera->node_endpoint, header, nullptr, 0, jobs.data(), job_count*sizeof(CameraNodeJob));
+        }
+    }
+
+    const std::vector<CameraNodeJob> &get_node_jobs(int node_tracker_id) const
+    {
+        if (node_tracker_id >= 0 && node_tracker_id < static_cast<int>(m_node_job_lists.size()))
+        {
+            const CameraNodeJobList &job_list = m_node_job_lists[node_tracker_id];
+            const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+
+            // The host stopped asking (went idle or away)
+            if (now - job_list.receive_time < std::chrono::milliseconds(m_cfg.node_job_timeout_ms))
+            {
+                return job_list.jobs;
+            }
+        }
+
+        return m_no_jobs;
+    }
+
+    void send_node_projections(
+        int node_tracker_id,
+        const long long frame_sequence_number,
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &capture_timestamp,
+        const CameraNodeCameraInfo &camera_info,
+        const std::vector<CameraNodeProjection> &projections)
+    {
+        if (!m_bIsNode)
+        {
+            return;
+        }
+
+        const size_t projection_count = std::min(projections.size(), static_cast<size_t>(CAMERA_NODE_MAX_DATAGRAM_ENTRIES));
+        CameraNodeDatagramHeader header;
+
+        init_header(header, CameraNodeDatagram_Projections, node_tracker_id, projection_count, sizeof(CameraNodeProjection));
+        header.frame_sequence_number = frame_sequence_number;
+        header.frame_age_us =
+            std::max(
+                static_cast<int64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - capture_timestamp).count()),
+                static_cast<int64_t>(0));
+
+        send_datagram(
+            m_host_endpoint, header,
+            &camera_info, sizeof(camera_info),
+            projections.data(), projection_count*sizeof(CameraNodeProjection));
+    }
+
+private:
+    static void init_header(
+        CameraNodeDatagramHeader &header,
+        eCameraNodeDatagramType datagram_type,
+        int node_tracker_id,
+        size_t entry_count,
+        size_t entry_size)
+    {
+        header.marker = CAMERA_NODE_DATAGRAM_MARKER;
+        header.version = CAMERA_NODE_DATAGRAM_VERSION;
+        header.datagram_type = static_cast<uint8_t>(datagram_type);
+        header.node_tracker_id = static_cast<uint8_t>(node_tracker_id);
+        header.entry_count = static_cast<uint16_t>(entry_count);
+        header.entry_size = static_cast<uint16_t>(entry_size);
+        header.frame_sequence_number = 0;
+        header.frame_age_us = 0;
+    }
+
+    void send_datagram(
+        const udp::endpoint &endpoint,
+        const CameraNodeDatagramHeader &header,
+        const void *camera_info, size_t camera_info_size,
+        const void *entries, size_t entries_size)
+    {
+        const boost::array<asio::const_buffer, 3> buffers = {{
+            asio::buffer(&header, sizeof(header)),
+            asio::buffer(camera_info, camera_info_size),
+            asio::buffer(entries, entries_size)
+        }};
+
+        boost::system::error_code error;
+        m_socket.send_to(buffers, endpoint, 0, error);
+
+        if (error == asio::error::would_block)
+        {
+            SERVER_LOG_TRACE("CameraNodeLink::send_datagram") << "Socket busy, dropped datagram to " << endpoint;
+        }
+        else if (error)
+        {
+            SERVER_LOG_ERROR("CameraNodeLink::send_datagram") << "Failed to send datagram to " << endpoint << ": " << error.message();
+        }
+    }
+
+    void start_receive()
+    {
+        m_socket.async_receive_from(
+            asio::buffer(m_receive_buffer, sizeof(m_receive_buffer)),
+            m_receive_endpoint,
+            boost::bind(&CameraNodeLinkImpl::handle_receive, this, asio::placeholders::error, asio::placeholders::bytes_transferred));
+    }
+
+    void handle_receive(const boost::system::error_code &error, std::size_t bytes_received)
+    {
+        if (error == asio::error::operation_aborted || !m_socket.is_open())
+        {
+            // Closed
+            return;
+        }
+
+        if (!error && bytes_received >= sizeof(CameraNodeDatagramHeader))
+        {
+            CameraNodeDatagramHeader header;
+            memcpy(&header, m_receive_buffer, sizeof(header));
+
+            if (header.marker == CAMERA_NODE_DATAGRAM_MARKER && header.version == CAMERA_NODE_DATAGRAM_VERSION)
+            {
+                const unsigned char *payload = m_receive_buffer + sizeof(header);
+                const size_t payload_size = bytes_received - sizeof(header);
+
+                if (m_bIsNode && header.datagram_type == CameraNodeDatagram_Jobs)
+                {
+                    handle_jobs(header, payload, payload_size);
+                }
+                else if (m_bIsHost && header.datagram_type == CameraNodeDatagram_Projections)
+                {
+                    handle_projections(header, payload, payload_size);
+                }
+            }
+            else
+            {
+                SERVER_LOG_WARNING("CameraNodeLink::handle_receive") << "Dropped datagram from " << m_receive_endpoint << " (not a camera node datagram of this version)";
+            }
+        }
+        else if (error)
+        {
+            // Typically an ICMP port unreachable reported by the previous send, the other end isn't up (yet)
+            SERVER_LOG_TRACE("CameraNodeLink::handle_receive") << "Receive failed: " << error.message();
+        }
+
+        start_receive();
+    }
+
+    void handle_jobs(const CameraNodeDatagramHeader &header, const unsigned char *payload, size_t payload_size)
+    {
+        if (m_receive_endpoint.address() != m_host_endpoint.address() ||
+            header.entry_size != sizeof(CameraNodeJob) ||
+            header.entry_count > CAMERA_NODE_MAX_DATAGRAM_ENTRIES ||
+            payload_size != header.entry_count*sizeof(CameraNodeJob))
+        {
+            SERVER_LOG_WARNING("CameraNodeLink::handle_jobs") << "Dropped malformed jobs datagram from " << m_receive_endpoint;
+            return;
+        }
+
+        if (header.node_tracker_id >= m_node_job_lists.size())
+        {
+            m_node_job_lists.resize(header.node_tracker_id + 1);
+        }
+
+        CameraNodeJobList &job_list = m_node_job_lists[header.node_tracker_id];
+        job_list.jobs.resize(header.entry_count);
+        memcpy(job_list.jobs.data(), payload, payload_size);
+        job_list.receive_time = std::chrono::high_resolution_clock::now();
+    }
+
+    void handle_projections(const CameraNodeDatagramHeader &header, const unsigned char *payload, size_t payload_size)
+    {
+        if (header.entry_size != sizeof(CameraNodeProjection) ||
+            header.entry_count > CAMERA_NODE_MAX_DATAGRAM_ENTRIES ||
+            payload_size != sizeof(CameraNodeCameraInfo) + header.entry_count*sizeof(CameraNodeProjection))
+        {
+            SERVER_LOG_WARNING("CameraNodeLink::handle_projections") << "Dropped malformed projections datagram from " << m_receive_endpoint;
+            return;
+        }
+
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+        const std::string device_path =
+            std::string(CAMERA_NODE_REMOTE_CAMERA_PATH_PREFIX) + m_receive_endpoint.address().to_string() +
+            "/" + std::to_string(header.node_tracker_id);
+        RemoteCamera *camera = find_remote_camera(device_path);
+
+        if (camera == nullptr)
+        {
+            SERVER_LOG_INFO("CameraNodeLink::handle_projections") << "Found remote camera " << device_path;
+
+            m_remote_cameras.push_back(RemoteCamera());
+            camera = &m_remote_cameras.back();
+            camera->device_path = device_path;
+            camera->node_tracker_id = header.node_tracker_id;
+            camera->frame_sequence_number = 0;
+            camera->node_frame_sequence_number = header.frame_sequence_number - 1;
+
+            DeviceManager::getInstance()->m_tracker_manager->handleRemoteCameraListChanged();
+        }
+
+        if (header.frame_sequence_number == camera->node_frame_sequence_number)
+        {
+            // Duplicate
+            return;
+        }
+
+        // A gap is frames the node dropped (or datagrams that got lost on the way).
+        // Going backwards means the camera node restarted.
+        camera->frame_sequence_number +=
+            (header.frame_sequence_number > camera->node_frame_sequence_number)
+            ? header.frame_sequence_number - camera->node_frame_sequence_number
+            : 1;
+        camera->node_frame_sequence_number = header.frame_sequence_number;
+        camera->node_endpoint = m_receive_endpoint;
+        camera->last_receive_time = now;
+        camera->capture_timestamp = now - std::chrono::microseconds(header.frame_age_us);
+        memcpy(&camera->camera_info, payload, sizeof(CameraNodeCameraInfo));
+        camera->projections.resize(header.entry_count);
+        memcpy(camera->projections.data(), payload + sizeof(CameraNodeCameraInfo), header.entry_count*sizeof(CameraNodeProjection));
+    }
+
+    const CameraNodeLinkConfig &m_cfg;
+    asio::io_service &m_io_service;
+    udp::socket m_socket;
+    udp::endpoint m_host_endpoint; // node only
+    udp::endpoint m_receive_endpoint; // sender of the datagram being received
+    unsigned char m_receive_buffer[k_max_camera_node_datagram_size];
+    bool m_bIsHost;
+    bool m_bIsNode;
+
+    // Host state
+    std::vector<RemoteCamera> m_remote_cameras;
+
+    // Node state, indexed by node tracker id
+    std::vector<CameraNodeJobList> m_node_job_lists;
+    std::vector<CameraNodeJob> m_no_jobs;
+};
+
+//-- public interface -----
+CameraNodeLink *CameraNodeLink::m_instance = nullptr;
+
+CameraNodeLink::CameraNodeLink()
+    : m_cfg()
+    , implementation_ptr(nullptr)
+{
+}
+
+CameraNodeLink::~CameraNodeLink()
+{
+    if (m_instance != nullptr)
+    {
+        SERVER_LOG_ERROR("~CameraNodeLink()") << "Camera node link deleted without shutdown() getting called first";
+    }
+
+    if (implementation_ptr != nullptr)
+    {
+        delete implementation_ptr;
+        implementation_ptr = nullptr;
+    }
+}
+
+bool CameraNodeLink::startup(boost::asio::io_service *io_service, const std::string &node_host_address)
+{
+    m_cfg.load();
+
+    // Save the config back out in case it doesn't exist
+    m_cfg.save();
+
+    m_instance = this;
+    implementation_ptr = new CameraNodeLinkImpl(*io_service, m_cfg);
+
+    bool bSuccess = true;
+
+    if (!node_host_address.empty())
+    {
+        // A camera node that can't reach its host has nothing to do
+        bSuccess = implementation_ptr->open_node(node_host_address);
+    }
+    else if (m_cfg.host_enabled)
+    {
+        // The local devices still work without the camera nodes
+        implementation_ptr->open_host();
+    }
+
+    return bSuccess;
+}
+
+void CameraNodeLink::update()
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->update();
+    }
+}
+
+void CameraNodeLink::shutdown()
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->close();
+    }
+
+    m_instance = nullptr;
+}
+
+bool CameraNodeLink::getIsHost() const
+{
+    return implementation_ptr != nullptr && implementation_ptr->get_is_host();
+}
+
+bool CameraNodeLink::getIsNode() const
+{
+    return implementation_ptr != nullptr && implementation_ptr->get_is_node();
+}
+
+bool CameraNodeLink::getIsRemoteCameraPath(const std::string &device_path)
+{
+    return device_path.compare(0, strlen(CAMERA_NODE_REMOTE_CAMERA_PATH_PREFIX), CAMERA_NODE_REMOTE_CAMERA_PATH_PREFIX) == 0;
+}
+
+void CameraNodeLink::getRemoteCameraPaths(std::vector<std::string> &out_device_paths) const
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->get_remote_camera_paths(out_device_paths);
+    }
+}
+
+bool CameraNodeLink::getRemoteCameraInfo(const std::string &device_path, CameraNodeCameraInfo &out_camera_info) const
+{
+    const RemoteCamera *camera = (implementation_ptr != nullptr) ? implementation_ptr->find_remote_camera(device_path) : nullptr;
+
+    if (camera != nullptr)
+    {
+        out_camera_info = camera->camera_info;
+    }
+
+    return camera != nullptr;
+}
+
+bool CameraNodeLink::fetchRemoteCameraProjections(
+    const std::string &device_path,
+    const long long last_frame_sequence_number,
+    long long &out_frame_sequence_number,
+    std::chrono::time_point<std::chrono::high_resolution_clock> &out_capture_timestamp,
+    std::vector<CameraNodeProjection> &out_projections) const
+{
+    const RemoteCamera *camera = (implementation_ptr != nullptr) ? implementation_ptr->find_remote_camera(device_path) : nullptr;
+    const bool bHasNewFrame = camera != nullptr && camera->frame_sequence_number > last_frame_sequence_number;
+
+    if (bHasNewFrame)
+    {
+        out_frame_sequence_number = camera->frame_sequence_number;
+        out_capture_timestamp = camera->capture_timestamp;
+        out_projections = camera->projections;
+    }
+
+    return bHasNewFrame;
+}
+
+void CameraNodeLink::sendRemoteCameraJobs(const std::string &device_path, const std::vector<CameraNodeJob> &jobs)
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->send_remote_camera_jobs(device_path, jobs);
+    }
+}
+
+const std::vector<CameraNodeJob> &CameraNodeLink::getNodeJobs(int node_tracker_id) const
+{
+    static const std::vector<CameraNodeJob> k_no_jobs;
+
+    return (implementation_ptr != nullptr) ? implementation_ptr->get_node_jobs(node_tracker_id) : k_no_jobs;
+}
+
+void CameraNodeLink::sendNodeProjections(
+    int node_tracker_id,
+    const long long frame_sequence_number,
+    const std::chrono::time_point<std::chrono::high_resolution_clock> &capture_timestamp,
+    const CameraNodeCameraInfo &camera_info,
+    const std::vector<CameraNodeProjection> &projections)
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->send_node_projections(node_tracker_id, frame_sequence_number, capture_timestamp, camera_info, projections);
+    }
+}
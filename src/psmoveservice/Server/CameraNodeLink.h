@@ -0,0 +1,211 @@
+#ifndef CAMERA_NODE_LINK_H
+#define CAMERA_NODE_LINK_H
+
+//-- includes -----
+#include "PSMoveConfig.h"
+#include "DeviceInterface.h"
+#include <chrono>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//-- pre-declarations -----
+namespace boost {
+    namespace asio {
+        class io_service;
+    }
+}
+
+//-- constants -----
+#define CAMERA_NODE_DATAGRAM_MARKER     0xCE
+
+// Bump this whenever the layout of any of the CameraNode* wire structs changes
+#define CAMERA_NODE_DATAGRAM_VERSION    2
+
+// Most job or projection entries a single datagram carries
+#define CAMERA_NODE_MAX_DATAGRAM_ENTRIES    32
+
+// Bits in CameraNodeJob::flags
+#define CAMERA_NODE_JOB_FLAG_IS_MOTIONLESS                  0x01
+#define CAMERA_NODE_JOB_FLAG_ROI_DISABLED                   0x02
+#define CAMERA_NODE_JOB_FLAG_HAS_PREDICTED_PIXEL_LOCATION   0x04
+
+//-- definitions -----
+enum eCameraNodeDatagramType
+{
+    CameraNodeDatagram_Jobs,        // host -> node: the devices to look for in the next frame
+    CameraNodeDatagram_Projections, // node -> host: the devices found in a frame
+};
+
+/// Wire format between a camera node and its host.
+/**
+ Every datagram is a CameraNodeDatagramHeader followed by entry_count entries of entry_size bytes
+ (projection datagrams put a CameraNodeCameraInfo in between).
+ The structs embed the service's Common* device structs as they are laid out in memory,
+ so both ends have to run the same build. Datagrams with a different version or entry size get dropped.
+ */
+#pragma pack(push, 1)
+struct CameraNodeDatagramHeader
+{
+    uint8_t marker;                 // CAMERA_NODE_DATAGRAM_MARKER
+    uint8_t version;                // CAMERA_NODE_DATAGRAM_VERSION
+    uint8_t datagram_type;          // eCameraNodeDatagramType
+    uint8_t node_tracker_id;        // Tracker id of the camera on the camera node
+    uint16_t entry_count;
+    uint16_t entry_size;
+    // Projections only: counts the node's video frames, so the host sees dropped frames (and datagrams) as gaps
+    int64_t frame_sequence_number;
+    // Projections only: how long before the send the frame got captured
+    int64_t frame_age_us;
+};
+
+/// What the host needs to know to treat a camera node's camera like one of its own
+struct CameraNodeCameraInfo
+{
+    float frame_width;
+    float frame_height;
+    float frame_rate;
+    float focal_length_x;
+    float focal_length_y;
+    float principal_x;
+    float principal_y;
+    float distortion_k1;
+    float distortion_k2;
+    float distortion_k3;
+    float distortion_p1;
+    float distortion_p2;
+    float hfov;
+    float vfov;
+    float z_near;
+    float z_far;
+};
+
+/// The tracker relative part of a Controller/HMDOpticalPoseEstimation
+struct CameraNodePoseEstimate
+{
+    CommonDevicePosition position_cm;
+    CommonDeviceTrackingProjection projection;
+    CommonDeviceQuaternion orientation;
+    uint8_t is_currently_tracking;
+    uint8_t is_orientation_valid;
+};
+
+/// A device the host wants the camera node to look for (see TrackerProjectionJob)
+struct CameraNodeJob
+{
+    uint8_t is_hmd;
+    uint8_t device_id;
+    uint8_t flags;                  // CAMERA_NODE_JOB_FLAG_* bits
+    int8_t tracking_color_id;       // eCommonTrackingColorID
+    uint8_t shared_color_job_count;
+    CommonDeviceTrackingShape tracking_shape;
+    CommonHSVColorRange hsv_color_range;
+    int32_t roi_x;
+    int32_t roi_y;
+    int32_t roi_width;
+    int32_t roi_height;
+    float predicted_pixel_x;
+    float predicted_pixel_y;
+    CameraNodePoseEstimate prior_pose_estimate;
+};
+
+/// A device the camera node found in its frame
+struct CameraNodeProjection
+{
+    uint8_t is_hmd;
+    uint8_t device_id;
+    CameraNodePoseEstimate pose_estimate;
+};
+#pragma pack(pop)
+
+class CameraNodeLinkConfig : public PSMoveConfig
+{
+public:
+    static const int CONFIG_VERSION;
+
+    CameraNodeLinkConfig(const std::string &fnamebase = "CameraNodeLinkConfig");
+
+    virtual const boost::property_tree::ptree config2ptree();
+    virtual void ptree2config(const boost::property_tree::ptree &pt);
+
+    long version;
+
+    // Accept the projections of camera nodes (see the --camera_node option) on host_port
+    bool host_enabled;
+    int host_port;
+    // A remote camera that sent nothing for this long drops out of the tracker list
+    int remote_camera_timeout_ms;
+    // Camera nodes stop searching for the devices the host asked for once it asked this long ago
+    int node_job_timeout_ms;
+};
+
+/// Streams tracker projections from camera nodes to the service that fuses them.
+/**
+ A camera node is a PSMoveService started with --camera_node host[:port]. It captures and searches
+ the frames of its own cameras but has no devices to track: every frame its host sends it the devices
+ to look for (tracking shape and color, ROI, prior projection), and it answers with what it found.
+ Its cameras show up on the host as RemoteTrackers, which feed the projections into the usual multi-camera fusion.
+ Both ends use one non-blocking UDP socket serviced by the main loop's io_service, so everything runs on the main thread.
+ A datagram the socket can't take right away gets dropped, the sequence numbers make the loss visible.
+ */
+class CameraNodeLink
+{
+public:
+    CameraNodeLink();
+    virtual ~CameraNodeLink();
+
+    static CameraNodeLink *get_instance() { return m_instance; }
+
+    /// Called by PSMoveService::startup() before the device manager starts.
+    /// A non-empty node_host_address ("host[:port]") runs the service as a camera node,
+    /// otherwise it listens for camera nodes if the config enables it.
+    bool startup(boost::asio::io_service *io_service, const std::string &node_host_address);
+
+    /// Called by PSMoveService::update() before the device manager update.
+    /// Drops remote cameras that went quiet.
+    void update();
+
+    /// Called by PSMoveService::shutdown() after the device manager shutdown
+    void shutdown();
+
+    bool getIsHost() const;
+    bool getIsNode() const;
+
+    /// True for device paths of cameras on camera nodes ("camera_node://<address>/<node tracker id>")
+    static bool getIsRemoteCameraPath(const std::string &device_path);
+
+    // -- Host
+    /// Device paths of the remote cameras currently sending projections
+    void getRemoteCameraPaths(std::vector<std::string> &out_device_paths) const;
+    bool getRemoteCameraInfo(const std::string &device_path, CameraNodeCameraInfo &out_camera_info) const;
+    /// Copies out the latest projections of the remote camera if they are newer than last_frame_sequence_number
+    bool fetchRemoteCameraProjections(
+        const std::string &device_path,
+        const long long last_frame_sequence_number,
+        long long &out_frame_sequence_number,
+        std::chrono::time_point<std::chrono::high_resolution_clock> &out_capture_timestamp,
+        std::vector<CameraNodeProjection> &out_projections) const;
+    void sendRemoteCameraJobs(const std::string &device_path, const std::vector<CameraNodeJob> &jobs);
+
+    // -- Node
+    /// The devices the host last asked the camera to look for (empty once they time out)
+    const std::vector<CameraNodeJob> &getNodeJobs(int node_tracker_id) const;
+    void sendNodeProjections(
+        int node_tracker_id,
+        const long long frame_sequence_number,
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &capture_timestamp,
+        const CameraNodeCameraInfo &camera_info,
+        const std::vector<CameraNodeProjection> &projections);
+
+private:
+    CameraNodeLinkConfig m_cfg;
+
+    // private implementation - same lifetime as the CameraNodeLink
+    class CameraNodeLinkImpl *implementation_ptr;
+
+    // Singleton instance of the class
+    // Assigned in startup, cleared in shutdown
+    static CameraNodeLink *m_instance;
+};
+
+#endif // CAMERA_NODE_LINK_H
@@ -2,18 +2,25 @@
 #define BOOST_LIB_DIAGNOSTIC
 
 #include "PSMoveService.h"
+#include "CameraNodeLink.h"
 #include "ServerNetworkManager.h"
 #include "ServerRequestHandler.h"
+#include "DeviceInputLog.h"
 #include "DeviceManager.h"
 #include "ProtocolVersion.h"
+#include "PSMoveConfig.h"
 #include "ServerLog.h"
+#include "ServerMetrics.h"
+#include "ServerTrace.h"
 #include "SharedTrackerState.h"
 #include "TrackerManager.h"
 #include "USBDeviceManager.h"
+#include "WakeupSignal.h"
 
 #include <boost/asio.hpp>
 #include <boost/application.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <fstream>
 #include <cstdio>
 #include <string>
@@ -32,6 +39,9 @@
 #define DAEMON_LOCK_FILE	"psmoveserviced.lock"
 #endif // defined(BOOST_POSIX_API)
 
+// Longest the main loop sleeps with nothing due (request handlers and the network still get serviced)
+#define k_max_main_loop_sleep_ms	100
+
 //-- definitions -----
 class PSMoveServiceImpl
 {
@@ -39,10 +49,13 @@ public:
     PSMoveServiceImpl()
         : m_io_service()
         , m_signals(m_io_service)
+        , m_wakeup_signal()
+        , m_camera_node_link()
         , m_usb_device_manager()
         , m_device_manager()
         , m_request_handler(&m_device_manager)
         , m_network_manager()
+        , m_metrics_exporter()
         , m_status()
     {
         // Register to handle the signals that indicate when the server should exit.
@@ -65,17 +78,54 @@ public:
             if (startup())
             {
                 m_status = context.find<boost::application::status>();
+                ServerTrace::set_current_thread_name("Main Thread");
 
 				const TrackerManagerConfig &cfg = DeviceManager::getInstance()->m_tracker_manager->getConfig();
 
+				if (!ServerUtility::set_current_thread_cpu_affinity(cfg.main_thread_cpu_cores))
+				{
+					SERVER_LOG_WARNING("PSMoveService") << "Failed to pin the main thread to cores: " << cfg.main_thread_cpu_cores;
+				}
+				if (!ServerUtility::set_current_thread_priority(cfg.main_thread_priority))
+				{
+					SERVER_LOG_WARNING("PSMoveService") << "Failed to set the main thread priority: " << cfg.main_thread_priority;
+				}
+
                 while (m_status->state() != boost::application::status::stoped)
                 {
                     if (m_status->state() != boost::application::status::paused)
                     {
                         update();
+
+                        if (cfg.sleep_until_next_device_poll)
+                        {
+                            // Sleep until a device or a client has new data for us,
+                            // or until the next device poll is due
+                            const std::chrono::time_point<std::chrono::high_resolution_clock> now =
+                                std::chrono::high_resolution_clock::now();
+                            const std::chrono::time_point<std::chrono::high_resolution_clock> deadline =
+                                getNextFixedRateOutputDeadline(
+                                    std::min(
+                                        m_device_manager.getNextUpdateDeadline(now),
+                                        now + std::chrono::milliseconds(k_max_main_loop_sleep_ms)));
+
+                            m_wakeup_signal.waitForWorkUntil(deadline);
+                            continue;
+                        }
                     }
 
-					std::this_thread::sleep_for(std::chrono::milliseconds(cfg.tracker_sleep_ms));
+					// Sleep until a device or a client has new data for us,
+					// but no longer than tracker_sleep_ms (or until a fixed rate stream output is due)
+					if (m_request_handler.get_next_fixed_rate_output_time_us() >= 0)
+					{
+						m_wakeup_signal.waitForWorkUntil(
+							getNextFixedRateOutputDeadline(
+								std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(cfg.tracker_sleep_ms)));
+					}
+					else
+					{
+						m_wakeup_signal.waitForWork(cfg.tracker_sleep_ms);
+					}
                 }
             }
             else
@@ -154,6 +204,31 @@ private:
 		}
 		#endif // BOOST_INTERPROCESS_SHARED_DIR_PATH       
 
+        /** Keep config file writes from requests off the main loop */
+        PSMoveConfig::startAsyncSaves();
+
+        /** Setup the main loop wakeup signal before any device threads can start posting data */
+        if (success)
+        {
+            if (!m_wakeup_signal.startup(&m_io_service))
+            {
+                SERVER_LOG_FATAL("PSMoveService") << "Failed to initialize the main loop wakeup signal";
+                success = false;
+            }
+        }
+
+        /** Connect to the host or start listening for camera nodes before the trackers get enumerated */
+        if (success)
+        {
+            const std::string &camera_node_host = PSMoveService::getInstance()->getProgramSettings()->camera_node_host;
+
+            if (!m_camera_node_link.startup(&m_io_service, camera_node_host))
+            {
+                SERVER_LOG_FATAL("PSMoveService") << "Failed to initialize the camera node link";
+                success = false;
+            }
+        }
+
         /** Setup the usb async transfer thread before we attempt to initialize the trackers */
         if (success)
         {
@@ -186,6 +261,16 @@ private:
             }
         }
 
+        /** Export the latency histograms once the network manager polls the io_service */
+        if (success)
+        {
+            if (!m_metrics_exporter.startup(&m_io_service))
+            {
+                SERVER_LOG_FATAL("PSMoveService") << "Failed to initialize the metrics exporter";
+                success= false;
+            }
+        }
+
         /** Setup the request handler */
         if (success)
         {
@@ -199,23 +284,54 @@ private:
         return success;
     }
 
+    /// The earlier of the given deadline and the next fixed rate stream output
+    std::chrono::time_point<std::chrono::high_resolution_clock> getNextFixedRateOutputDeadline(
+        const std::chrono::time_point<std::chrono::high_resolution_clock> &deadline) const
+    {
+        const long long output_time_us= m_request_handler.get_next_fixed_rate_output_time_us();
+
+        if (output_time_us >= 0)
+        {
+            const std::chrono::time_point<std::chrono::high_resolution_clock> output_deadline(
+                std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::microseconds(output_time_us)));
+
+            return std::min(deadline, output_deadline);
+        }
+
+        return deadline;
+    }
+
     /// Called in the application loop.
     void update()
     {
+        SERVER_TRACE_SCOPE(ServerTraceStage_Tick);
+        const long long tick_start_us= ServerUtility::get_service_time_us();
+
         /** Update an async requests still waiting to complete */
         m_request_handler.update();
 
         /** Process any async results from the USB transfer thread */
         m_usb_device_manager.update();
 
+        /** Drop the remote cameras that stopped sending */
+        m_camera_node_link.update();
+
         /**
          Update the list of active tracked controllers
          Send controller updates to the client
          */
         m_device_manager.update();
 
+        /** Send the fixed rate controller streams whose output is due, extrapolated from the state just published */
+        m_request_handler.publish_fixed_rate_controller_streams();
+
         /** Process incoming/outgoing networking requests */
         m_network_manager.update();
+
+        /** Push the latency histograms to statsd when due */
+        m_metrics_exporter.update();
+
+        ServerMetrics::record(ServerMetric_TickTime, 0, ServerUtility::get_service_time_us() - tick_start_us);
     }
 
     void shutdown()
@@ -223,6 +339,10 @@ private:
         // Kill any pending request state
         m_request_handler.shutdown();
 
+        // Stop exporting metrics
+        // Must be before the network manager since it polls the io_service the exporter runs on
+        m_metrics_exporter.shutdown();
+
         // Close all active network connections 
         // Must be before device manager since closing a connection can modify device state
         m_network_manager.shutdown();
@@ -233,6 +353,18 @@ private:
         // Shutdown the usb async request thread
         // Must be after device manager since devices can have an active usb connection
         m_usb_device_manager.shutdown();
+
+        // Close the camera node socket
+        // Must be after the device manager since the remote cameras read from it
+        m_camera_node_link.shutdown();
+
+        // Stop accepting wakeup notifications
+        // Must be after the usb and device managers since their threads post wakeups
+        m_wakeup_signal.shutdown();
+
+        // Write out any queued config saves
+        // Must be after the device manager since disconnecting devices can save their configs
+        PSMoveConfig::stopAsyncSaves();
     }
 
     void handle_termination_signal()
@@ -249,6 +381,12 @@ private:
     // The signal_set is used to register for process termination notifications.
     boost::asio::signal_set m_signals;
 
+    // Wakes up the main loop as soon as devices or clients have new data
+    WakeupSignal m_wakeup_signal;
+
+    // Streams tracker projections between camera nodes and their host
+    CameraNodeLink m_camera_node_link;
+
     // Manages all control and bulk transfer requests in another thread
     USBDeviceManager m_usb_device_manager;
 
@@ -261,6 +399,9 @@ private:
     // Manages all TCP and UDP client connections
     ServerNetworkManager m_network_manager;
 
+    // Pushes the latency histograms to statsd and/or serves them on /metrics
+    ServerMetricsExporter m_metrics_exporter;
+
     // Whether the application should keep running or not
     std::shared_ptr<boost::application::status> m_status;
 };
@@ -295,6 +436,26 @@ static void parse_program_settings(
 	{
 		settings.working_directory.clear();
 	}
+
+    if (options_map.count("replay"))
+    {
+        settings.replay_path= options_map["replay"].as<std::string>();
+    }
+    else
+    {
+        settings.replay_path.clear();
+    }
+
+    settings.bReplayAtMaxSpeed= options_map.count("replay_max_speed") > 0;
+
+    if (options_map.count("camera_node"))
+    {
+        settings.camera_node_host= options_map["camera_node"].as<std::string>();
+    }
+    else
+    {
+        settings.camera_node_host.clear();
+    }
 }
 
 #if defined(BOOST_WINDOWS_API) 
@@ -507,6 +668,9 @@ int PSMoveService::exec(int argc, char *argv[])
         ("log_level,l", boost::program_options::value<std::string>(), "The level of logging to use: trace, debug, info, warning, error, fatal")
         ("admin_password,p", boost::program_options::value<std::string>(), "Remember the admin password for this machine (optional)")
 		("working_directory", boost::program_options::value<std::string>(), "service working directory (optional)")
+        ("replay", boost::program_options::value<std::string>(), "simulate the devices from a recorded device input log (optional)")
+        ("replay_max_speed", "replay the device input log as fast as possible rather than at the recorded pace")
+        ("camera_node", boost::program_options::value<std::string>(), "run as a camera node streaming tracker projections to the service at host[:port] (optional)")
 #if defined(BOOST_WINDOWS_API)
         (",i", "install service")
         (",u", "uninstall service")
@@ -573,6 +737,24 @@ int PSMoveService::exec(int argc, char *argv[])
     // initialize logging system
     log_init(this->getProgramSettings()->log_level, "PSMoveService.log");
 
+    // Route the devices to a recorded input log if requested.
+    // This must happen before the managers get constructed since they load their configs then.
+    if (!this->getProgramSettings()->replay_path.empty())
+    {
+        const std::string replay_config_path=
+            (boost::filesystem::path(PSMoveConfig::getConfigDirectoryPath()) / "Replay").string();
+
+        if (!DeviceInputLog::start_replay(
+                this->getProgramSettings()->replay_path,
+                replay_config_path,
+                this->getProgramSettings()->bReplayAtMaxSpeed))
+        {
+            SERVER_LOG_FATAL("main") << "Failed to load device input log: " << this->getProgramSettings()->replay_path;
+            log_dispose();
+            return -1;
+        }
+    }
+
     // Start the service app
     SERVER_LOG_INFO("main") << "Starting PSMoveService v" << PSM_RELEASE_VERSION_STRING << " (protocol v" << PSM_PROTOCOL_VERSION_STRING << ")";
     try
@@ -13,6 +13,9 @@ public:
         std::string log_level;
         std::string admin_password;
 		std::string working_directory;
+        std::string replay_path;
+        bool bReplayAtMaxSpeed;
+        std::string camera_node_host;
     };
 
     PSMoveService();
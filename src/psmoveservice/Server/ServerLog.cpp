@@ -1,22 +1,526 @@
 //-- includes -----
 #include "ServerLog.h"
 
-#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <mutex>
-#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include <string.h>
 
 #ifdef _MSC_VER
 #pragma warning (disable: 4996) // 'This function or variable may be unsafe': localtime
 #endif
 
+//-- constants -----
+// Text stored in one ring record, longer lines get split across consecutive records
+#define k_log_record_text_size 240
+// Records per thread ring (~64KB per logging thread)
+#define k_log_ring_capacity 256
+// Characters a line can hold before its formatting buffer spills onto the heap
+#define k_log_line_buffer_size 1024
+// How long the writer sleeps between ring sweeps when nothing urgent got logged
+#define k_log_writer_poll_ms 10
+// Identical lines from one thread inside this window only bump a repeat count
+#define k_log_repeat_window_seconds 1.0
+// Longest log_flush() will wait on the writer thread
+#define k_log_flush_timeout_ms 250
+
+//-- private definitions -----
+struct LogRecord
+{
+	std::chrono::system_clock::time_point timestamp;
+	// >0: "last message repeated N times" marker, the text is unused
+	unsigned int repeat_count;
+	unsigned short length;
+	// set on every chunk of a split line but the last one
+	bool bContinued;
+	char text[k_log_record_text_size];
+};
+
+// Single producer (the logging thread) single consumer (the writer thread) record ring
+struct LogThreadRing
+{
+	LogRecord records[k_log_ring_capacity];
+	std::atomic<unsigned long long> write_count;
+	std::atomic<unsigned long long> read_count;
+	std::atomic<unsigned int> dropped_line_count;
+	std::atomic<bool> bRetired;
+
+	// Only touched by the producing thread
+	unsigned long long last_line_hash;
+	std::chrono::system_clock::time_point last_line_timestamp;
+	unsigned int pending_repeat_count;
+
+	LogThreadRing()
+		: write_count(0)
+		, read_count(0)
+		, dropped_line_count(0)
+		, bRetired(false)
+		, last_line_hash(0)
+		, pending_repeat_count(0)
+	{
+	}
+};
+
+// Formats a line into a fixed buffer, only falling back to the heap for unusually long lines
+class LogLineBuffer : public std::streambuf
+{
+public:
+	LogLineBuffer()
+		: m_stream(this)
+	{
+		reset();
+	}
+
+	std::ostream &stream()
+	{
+		return m_stream;
+	}
+
+	void reset()
+	{
+		m_overflow.clear();
+		setp(m_buffer, m_buffer + k_log_line_buffer_size);
+
+		// A reused stream must not leak std::hex, std::setprecision, etc into the next line
+		m_stream.clear();
+		m_stream.flags(std::ios_base::dec | std::ios_base::skipws);
+		m_stream.precision(6);
+		m_stream.width(0);
+		m_stream.fill(' ');
+	}
+
+	const char *data()
+	{
+		if (!m_overflow.empty())
+		{
+			spill();
+			return m_overflow.data();
+		}
+
+		return m_buffer;
+	}
+
+	size_t length()
+	{
+		if (!m_overflow.empty())
+		{
+			spill();
+			return m_overflow.length();
+		}
+
+		return static_cast<size_t>(pptr() - pbase());
+	}
+
+protected:
+	int_type overflow(int_type c) override
+	{
+		spill();
+
+		if (!traits_type::eq_int_type(c, traits_type::eof()))
+		{
+			m_overflow.push_back(traits_type::to_char_type(c));
+		}
+
+		return traits_type::not_eof(c);
+	}
+
+	void spill()
+	{
+		m_overflow.append(pbase(), pptr());
+		setp(m_buffer, m_buffer + k_log_line_buffer_size);
+	}
+
+private:
+	char m_buffer[k_log_line_buffer_size];
+	std::string m_overflow;
+	std::ostream m_stream;
+};
+
+struct LogRingRegistry
+{
+	std::mutex mutex;
+	std::vector< std::shared_ptr<LogThreadRing> > rings;
+};
+
+// Retires the thread's ring when the thread exits, the writer frees it once drained
+struct LogThreadState
+{
+	std::shared_ptr<LogThreadRing> ring;
+	LogLineBuffer line_buffer;
+	bool bLineBufferInUse;
+
+	LogThreadState()
+		: bLineBufferInUse(false)
+	{
+	}
+
+	~LogThreadState();
+};
+
+// Plain flags stay usable while and after the thread's other thread_locals are destroyed
+static thread_local bool t_bLogThreadStateDisposed = false;
+static thread_local bool t_bIsLogWriterThread = false;
+
+LogThreadState::~LogThreadState()
+{
+	t_bLogThreadStateDisposed = true;
+
+	if (ring)
+	{
+		ring->bRetired.store(true, std::memory_order_release);
+	}
+}
+
+//-- prototypes -----
+static void log_writer_thread_func();
+
 //-- globals -----
 e_log_severity_level g_min_log_level= _log_severity_level_info;
 std::ostream *g_console_stream= nullptr;
 std::ostream *g_file_stream = nullptr;
-std::mutex *g_logger_mutex = nullptr;
+
+static std::thread *g_log_writer_thread = nullptr;
+static std::atomic<bool> g_log_writer_running(false);
+static std::mutex g_log_writer_mutex;
+static std::condition_variable g_log_writer_wake_cv;
+static std::condition_variable g_log_writer_drained_cv;
+static bool g_log_writer_wake_requested = false;
+static unsigned long long g_log_writer_drain_count = 0;
+
+static thread_local LogThreadState t_log_thread_state;
+
+//-- private methods -----
+static LogRingRegistry &get_log_ring_registry()
+{
+	// Function local so it outlives any static object that logs during shutdown
+	static LogRingRegistry *s_registry = new LogRingRegistry();
+
+	return *s_registry;
+}
+
+static LogThreadRing *get_thread_log_ring()
+{
+	LogThreadState &state = t_log_thread_state;
+
+	if (!state.ring)
+	{
+		LogRingRegistry &registry = get_log_ring_registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		state.ring = std::make_shared<LogThreadRing>();
+		registry.rings.push_back(state.ring);
+	}
+
+	return state.ring.get();
+}
+
+static unsigned long long hash_log_line(int level, const char *text, size_t length)
+{
+	// FNV-1a
+	unsigned long long hash = 14695981039346656037ULL ^ static_cast<unsigned long long>(level);
+
+	for (size_t index = 0; index < length; ++index)
+	{
+		hash ^= static_cast<unsigned char>(text[index]);
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+static bool push_repeat_record(
+	LogThreadRing *ring,
+	const std::chrono::system_clock::time_point &timestamp,
+	unsigned int repeat_count)
+{
+	const unsigned long long write_count = ring->write_count.load(std::memory_order_relaxed);
+	const unsigned long long read_count = ring->read_count.load(std::memory_order_acquire);
+
+	if (write_count - read_count >= k_log_ring_capacity)
+	{
+		return false;
+	}
+
+	LogRecord &record = ring->records[write_count % k_log_ring_capacity];
+	record.timestamp = timestamp;
+	record.repeat_count = repeat_count;
+	record.length = 0;
+	record.bContinued = false;
+
+	ring->write_count.store(write_count + 1, std::memory_order_release);
+
+	return true;
+}
+
+static bool push_line_records(
+	LogThreadRing *ring,
+	const std::chrono::system_clock::time_point &timestamp,
+	const char *text,
+	size_t length,
+	bool &out_bCrossedHalfFull)
+{
+	const size_t record_count = std::max<size_t>((length + k_log_record_text_size - 1) / k_log_record_text_size, 1);
+	const unsigned long long write_count = ring->write_count.load(std::memory_order_relaxed);
+	const unsigned long long read_count = ring->read_count.load(std::memory_order_acquire);
+
+	// All or nothing so the writer never sees half a line
+	if (write_count - read_count + record_count > k_log_ring_capacity)
+	{
+		return false;
+	}
+
+	for (size_t record_index = 0; record_index < record_count; ++record_index)
+	{
+		const size_t offset = record_index * k_log_record_text_size;
+		const size_t chunk_length = std::min<size_t>(length - offset, k_log_record_text_size);
+		LogRecord &record = ring->records[(write_count + record_index) % k_log_ring_capacity];
+
+		record.timestamp = timestamp;
+		record.repeat_count = 0;
+		record.length = static_cast<unsigned short>(chunk_length);
+		record.bContinued = (record_index + 1 < record_count);
+		memcpy(record.text, text + offset, chunk_length);
+	}
+
+	ring->write_count.store(write_count + record_count, std::memory_order_release);
+
+	const unsigned long long used_before = write_count - read_count;
+	out_bCrossedHalfFull =
+		used_before < k_log_ring_capacity / 2 && used_before + record_count >= k_log_ring_capacity / 2;
+
+	return true;
+}
+
+static void enqueue_log_line(
+	e_log_severity_level level,
+	const std::chrono::system_clock::time_point &timestamp,
+	const char *text,
+	size_t length)
+{
+	LogThreadRing *ring = get_thread_log_ring();
+	const unsigned long long line_hash = hash_log_line(level, text, length);
+	const double seconds_since_last_line =
+		std::chrono::duration<double>(timestamp - ring->last_line_timestamp).count();
+
+	// Collapse a line spammed by this thread (e.g. a failing poll) into a repeat count
+	if (line_hash == ring->last_line_hash &&
+		seconds_since_last_line >= 0.0 &&
+		seconds_since_last_line < k_log_repeat_window_seconds)
+	{
+		++ring->pending_repeat_count;
+		return;
+	}
+
+	if (ring->pending_repeat_count > 0)
+	{
+		if (!push_repeat_record(ring, timestamp, ring->pending_repeat_count))
+		{
+			ring->dropped_line_count.fetch_add(ring->pending_repeat_count, std::memory_order_relaxed);
+		}
+		ring->pending_repeat_count = 0;
+	}
+
+	bool bCrossedHalfFull = false;
+	if (push_line_records(ring, timestamp, text, length, bCrossedHalfFull))
+	{
+		ring->last_line_hash = line_hash;
+		ring->last_line_timestamp = timestamp;
+	}
+	else
+	{
+		ring->dropped_line_count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Don't let a problem report sit in the ring for a whole poll interval,
+	// nor let a burst of lines fill the ring before the next sweep comes around
+	if (level >= _log_severity_level_error || bCrossedHalfFull)
+	{
+		{
+			std::lock_guard<std::mutex> lock(g_log_writer_mutex);
+			g_log_writer_wake_requested = true;
+		}
+		g_log_writer_wake_cv.notify_one();
+	}
+}
+
+static void format_timestamp_prefix(std::ostream &out, const std::chrono::system_clock::time_point &timestamp)
+{
+    auto seconds = std::chrono::time_point_cast<std::chrono::seconds>(timestamp);
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(timestamp - seconds);
+    time_t in_time_t = std::chrono::system_clock::to_time_t(timestamp);
+
+    out << "[" << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d %H:%M:%S") << "." << milliseconds.count() << "]: ";
+}
+
+struct LogWriterLine
+{
+	std::chrono::system_clock::time_point timestamp;
+	std::string text;
+};
+
+static void write_log_output(const std::string &text)
+{
+	if (g_console_stream != nullptr)
+	{
+		g_console_stream->write(text.data(), text.length());
+	}
+
+	if (g_file_stream != nullptr)
+	{
+		g_file_stream->write(text.data(), text.length());
+	}
+}
+
+static void drain_log_rings(
+	std::vector< std::shared_ptr<LogThreadRing> > &rings,
+	std::vector<LogWriterLine> &lines)
+{
+	{
+		LogRingRegistry &registry = get_log_ring_registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		rings = registry.rings;
+	}
+
+	lines.clear();
+
+	std::ostringstream line;
+	bool bAnyRetired = false;
+	for (auto &ring : rings)
+	{
+		// Read before draining so a ring retired mid sweep gets one more pass
+		const bool bRetired = ring->bRetired.load(std::memory_order_acquire);
+		const unsigned long long write_count = ring->write_count.load(std::memory_order_acquire);
+		unsigned long long read_count = ring->read_count.load(std::memory_order_relaxed);
+		bool bLineStarted = false;
+
+		while (read_count < write_count)
+		{
+			const LogRecord &record = ring->records[read_count % k_log_ring_capacity];
+
+			if (!bLineStarted)
+			{
+				line.str(std::string());
+				format_timestamp_prefix(line, record.timestamp);
+				bLineStarted = true;
+			}
+
+			if (record.repeat_count > 0)
+			{
+				line << "last message repeated " << record.repeat_count << " times";
+			}
+			else
+			{
+				line.write(record.text, record.length);
+			}
+			++read_count;
+
+			if (!record.bContinued)
+			{
+				line << '\n';
+				lines.push_back({ record.timestamp, line.str() });
+				bLineStarted = false;
+			}
+		}
+
+		ring->read_count.store(read_count, std::memory_order_release);
+
+		const unsigned int dropped_line_count = ring->dropped_line_count.exchange(0, std::memory_order_relaxed);
+		if (dropped_line_count > 0)
+		{
+			const auto now = std::chrono::system_clock::now();
+
+			line.str(std::string());
+			format_timestamp_prefix(line, now);
+			line << "log_writer - dropped " << dropped_line_count << " lines from a thread logging faster than they could be written\n";
+			lines.push_back({ now, line.str() });
+		}
+
+		bAnyRetired |= bRetired;
+	}
+
+	// Merge the per thread rings back into roughly chronological order
+	std::stable_sort(
+		lines.begin(), lines.end(),
+		[](const LogWriterLine &a, const LogWriterLine &b) { return a.timestamp < b.timestamp; });
+
+	for (const LogWriterLine &line : lines)
+	{
+		write_log_output(line.text);
+	}
+
+	// One flush per sweep instead of one per line
+	if (!lines.empty())
+	{
+		if (g_console_stream != nullptr)
+		{
+			g_console_stream->flush();
+		}
+
+		if (g_file_stream != nullptr)
+		{
+			g_file_stream->flush();
+		}
+	}
+
+	// Free the rings of threads that have exited and been fully drained
+	if (bAnyRetired)
+	{
+		LogRingRegistry &registry = get_log_ring_registry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		registry.rings.erase(
+			std::remove_if(
+				registry.rings.begin(), registry.rings.end(),
+				[](const std::shared_ptr<LogThreadRing> &ring) {
+					return ring->bRetired.load(std::memory_order_acquire) &&
+						ring->read_count.load(std::memory_order_relaxed) == ring->write_count.load(std::memory_order_acquire);
+				}),
+			registry.rings.end());
+	}
+
+	rings.clear();
+}
+
+static void log_writer_thread_func()
+{
+	std::vector< std::shared_ptr<LogThreadRing> > rings;
+	std::vector<LogWriterLine> lines;
+	bool bRunning = true;
+
+	t_bIsLogWriterThread = true;
+
+	while (bRunning)
+	{
+		{
+			std::unique_lock<std::mutex> lock(g_log_writer_mutex);
+
+			g_log_writer_wake_cv.wait_for(
+				lock, std::chrono::milliseconds(k_log_writer_poll_ms),
+				[] { return g_log_writer_wake_requested || !g_log_writer_running.load(); });
+			g_log_writer_wake_requested = false;
+			bRunning = g_log_writer_running.load();
+		}
+
+		drain_log_rings(rings, lines);
+
+		{
+			std::lock_guard<std::mutex> lock(g_log_writer_mutex);
+			++g_log_writer_drain_count;
+		}
+		g_log_writer_drained_cv.notify_all();
+	}
+}
 
 //-- public implementation -----
 void log_init(const std::string &log_level, const std::string &log_filename)
@@ -55,11 +559,28 @@ void log_init(const std::string &log_level, const std::string &log_filename)
 	{
 		g_file_stream = new std::ofstream(log_filename, std::ofstream::out);
 	}
-	g_logger_mutex = new std::mutex();
+
+	// Only the writer thread touches the output streams from here on
+	g_log_writer_running.store(true);
+	g_log_writer_thread = new std::thread(log_writer_thread_func);
 }
 
 void log_dispose()
 {
+	if (g_log_writer_thread != nullptr)
+	{
+		// The writer does one last sweep of the rings on the way out
+		{
+			std::lock_guard<std::mutex> lock(g_log_writer_mutex);
+			g_log_writer_running.store(false);
+		}
+		g_log_writer_wake_cv.notify_one();
+
+		g_log_writer_thread->join();
+		delete g_log_writer_thread;
+		g_log_writer_thread = nullptr;
+	}
+
 	if (g_console_stream != nullptr)
 	{
 		g_console_stream->flush();
@@ -69,16 +590,10 @@ void log_dispose()
 
 	if (g_file_stream != nullptr)
 	{
-		g_console_stream->flush();
+		g_file_stream->flush();
 		delete g_file_stream;
 		g_file_stream = nullptr;
 	}
-
-	if (g_logger_mutex != nullptr)
-	{
-		delete g_logger_mutex;
-		g_logger_mutex = nullptr;
-	}
 }
 
 bool log_can_emit_level(e_log_severity_level level)
@@ -88,54 +603,93 @@ bool log_can_emit_level(e_log_severity_level level)
 
 std::string log_get_timestamp_prefix()
 {
-    auto now = std::chrono::system_clock::now();
-    auto seconds = std::chrono::time_point_cast<std::chrono::seconds>(now);
-    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - seconds);
-    time_t in_time_t = std::chrono::system_clock::to_time_t(now);
-
     std::stringstream ss;
-    ss << "[" << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d %H:%M:%S") << "." << milliseconds.count() << "]: ";
+    format_timestamp_prefix(ss, std::chrono::system_clock::now());
 
     return ss.str();
 }
 
+void log_flush()
+{
+	if (!g_log_writer_running.load() || t_bIsLogWriterThread)
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(g_log_writer_mutex);
+
+	// The sweep in progress may have started before our lines were queued, so wait for the one after it
+	const unsigned long long target_drain_count = g_log_writer_drain_count + 2;
+
+	g_log_writer_wake_requested = true;
+	g_log_writer_wake_cv.notify_one();
+	g_log_writer_drained_cv.wait_for(
+		lock, std::chrono::milliseconds(k_log_flush_timeout_ms),
+		[target_drain_count] { return g_log_writer_drain_count >= target_drain_count || !g_log_writer_running.load(); });
+}
+
 //-- member functions -----
-LoggerStream::LoggerStream(bool bEmit) :
-	m_bEmitLine(bEmit)
+LoggerStream::LoggerStream(bool bEmit, e_log_severity_level level)
+	: m_lineBuffer(nullptr)
+	, m_ownedLineBuffer(nullptr)
+	, m_level(level)
+	, m_bEmitLine(bEmit && g_log_writer_running.load(std::memory_order_relaxed) && !t_bLogThreadStateDisposed)
 {
+	if (m_bEmitLine)
+	{
+		LogThreadState &state = t_log_thread_state;
+
+		m_timestamp = std::chrono::system_clock::now();
+
+		if (!state.bLineBufferInUse)
+		{
+			// Common case: reuse this thread's formatting buffer
+			state.bLineBufferInUse = true;
+			state.line_buffer.reset();
+			m_lineBuffer = &state.line_buffer.stream();
+		}
+		else
+		{
+			// Logging from inside an operator<< of another log line
+			m_ownedLineBuffer = new LogLineBuffer();
+			m_lineBuffer = &m_ownedLineBuffer->stream();
+		}
+	}
 }
 
 LoggerStream::~LoggerStream()
 {
 	write_line();
+
+	if (m_ownedLineBuffer != nullptr)
+	{
+		delete m_ownedLineBuffer;
+	}
+	else if (m_lineBuffer != nullptr)
+	{
+		t_log_thread_state.bLineBufferInUse = false;
+	}
 }
 
 void LoggerStream::write_line()
 {
 	if (m_bEmitLine)
 	{
-		const std::string line = m_lineBuffer.str();
+		LogLineBuffer &line_buffer =
+			(m_ownedLineBuffer != nullptr) ? *m_ownedLineBuffer : t_log_thread_state.line_buffer;
 
-		if (g_console_stream != nullptr)
-		{
-			*g_console_stream << line << std::endl;
-		}
+		enqueue_log_line(m_level, m_timestamp, line_buffer.data(), line_buffer.length());
+		m_bEmitLine = false;
 
-		if (g_file_stream != nullptr)
+		if (m_level >= _log_severity_level_fatal)
 		{
-			*g_file_stream << line << std::endl;
+			// The process may well be about to go down, make sure this line makes it out
+			log_flush();
 		}
 	}
 }
 
-ThreadSafeLoggerStream::ThreadSafeLoggerStream(bool bEmit) :
-	LoggerStream(bEmit)
+ThreadSafeLoggerStream::ThreadSafeLoggerStream(bool bEmit, e_log_severity_level level)
+	: LoggerStream(bEmit, level)
 {
 }
-
-void ThreadSafeLoggerStream::write_line()
-{
-	std::lock_guard<std::mutex> lock(*g_logger_mutex);
-
-	LoggerStream::write_line();
-}
\ No newline at end of file
@@ -2,8 +2,9 @@
 #define SERVER_LOG_H
 
 //-- includes -----
+#include <chrono>
+#include <ostream>
 #include <string>
-#include <sstream>
 
 //-- constants -----
 enum e_log_severity_level
@@ -17,14 +18,24 @@ enum e_log_severity_level
 };
 
 //-- includes -----
+/// Builds one log line and hands it to the background log writer.
+/**
+ The line gets formatted into a buffer owned by the calling thread and copied into that
+ thread's log record ring, the timestamp prefix and the console/file I/O happen on the writer thread.
+ Logging never blocks: a thread that outruns the writer drops lines (and the writer reports how many),
+ and identical lines repeated by a thread within a second are collapsed into a repeat count.
+ */
 class LoggerStream
 {
 protected:
-	std::ostringstream m_lineBuffer;
+	std::ostream *m_lineBuffer;
+	class LogLineBuffer *m_ownedLineBuffer; // Only when the thread's buffer is already in use
+	std::chrono::system_clock::time_point m_timestamp;
+	e_log_severity_level m_level;
 	bool m_bEmitLine;
 
 public:
-	LoggerStream(bool bEmit);
+	LoggerStream(bool bEmit, e_log_severity_level level= _log_severity_level_info);
 	virtual ~LoggerStream();
 
 	// accepts just about anything
@@ -33,7 +44,7 @@ public:
 	{
 		if (m_bEmitLine)
 		{
-			m_lineBuffer << x;
+			*m_lineBuffer << x;
 		}
 
 		return *this;
@@ -43,13 +54,11 @@ protected:
 	virtual void write_line();
 };
 
+/// Every LoggerStream is thread safe now, this is kept for the SERVER_MT_LOG_* call sites
 class ThreadSafeLoggerStream : public LoggerStream
 {
 public:
-	ThreadSafeLoggerStream(bool bEmit);
-
-protected:
-	void write_line() override;
+	ThreadSafeLoggerStream(bool bEmit, e_log_severity_level level= _log_severity_level_info);
 };
 
 //-- interface -----
@@ -57,29 +66,29 @@ void log_init(const std::string &log_level, const std::string &log_filename="");
 void log_dispose();
 bool log_can_emit_level(e_log_severity_level level);
 std::string log_get_timestamp_prefix();
+/// Blocks (briefly) until the writer thread has written out everything logged so far
+void log_flush();
 
 //-- macros -----
-#define SELECT_LOG_STREAM(level) LoggerStream(log_can_emit_level(level))
-#define SELECT_MT_LOG_STREAM(level) ThreadSafeLoggerStream(log_can_emit_level(level))
+#define SELECT_LOG_STREAM(level) LoggerStream(log_can_emit_level(level), level)
+#define SELECT_MT_LOG_STREAM(level) ThreadSafeLoggerStream(log_can_emit_level(level), level)
 
-// Non Thread Safe Logger Macros
-// Almost everything is on the main thread, so you almost always want to use these
-#define SERVER_LOG_TRACE(function_name) SELECT_LOG_STREAM(_log_severity_level_trace) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_LOG_DEBUG(function_name) SELECT_LOG_STREAM(_log_severity_level_debug) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_LOG_INFO(function_name) SELECT_LOG_STREAM(_log_severity_level_info) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_LOG_WARNING(function_name) SELECT_LOG_STREAM(_log_severity_level_warning) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_LOG_ERROR(function_name) SELECT_LOG_STREAM(_log_severity_level_error) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_LOG_FATAL(function_name) SELECT_LOG_STREAM(_log_severity_level_fatal) << log_get_timestamp_prefix() << function_name << " - "
+// Logger Macros
+// The timestamp prefix gets added by the log writer thread
+#define SERVER_LOG_TRACE(function_name) SELECT_LOG_STREAM(_log_severity_level_trace) << function_name << " - "
+#define SERVER_LOG_DEBUG(function_name) SELECT_LOG_STREAM(_log_severity_level_debug) << function_name << " - "
+#define SERVER_LOG_INFO(function_name) SELECT_LOG_STREAM(_log_severity_level_info) << function_name << " - "
+#define SERVER_LOG_WARNING(function_name) SELECT_LOG_STREAM(_log_severity_level_warning) << function_name << " - "
+#define SERVER_LOG_ERROR(function_name) SELECT_LOG_STREAM(_log_severity_level_error) << function_name << " - "
+#define SERVER_LOG_FATAL(function_name) SELECT_LOG_STREAM(_log_severity_level_fatal) << function_name << " - "
 
 // Thread Safe Logger Macros
-// Uses thread safe locking before appending data to the logging stream
-// Only use this when logging from other threads
-#define SERVER_MT_LOG_TRACE(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_trace) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_MT_LOG_DEBUG(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_debug) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_MT_LOG_INFO(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_info) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_MT_LOG_WARNING(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_warning) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_MT_LOG_ERROR(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_error) << log_get_timestamp_prefix() << function_name << " - "
-#define SERVER_MT_LOG_FATAL(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_fatal) << log_get_timestamp_prefix() << function_name << " - "
- 
-#endif  // SERVER_LOG_H
+// Same as the ones above now that every thread logs into its own record ring
+#define SERVER_MT_LOG_TRACE(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_trace) << function_name << " - "
+#define SERVER_MT_LOG_DEBUG(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_debug) << function_name << " - "
+#define SERVER_MT_LOG_INFO(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_info) << function_name << " - "
+#define SERVER_MT_LOG_WARNING(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_warning) << function_name << " - "
+#define SERVER_MT_LOG_ERROR(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_error) << function_name << " - "
+#define SERVER_MT_LOG_FATAL(function_name) SELECT_MT_LOG_STREAM(_log_severity_level_fatal) << function_name << " - "
 
+#endif  // SERVER_LOG_H
@@ -0,0 +1,819 @@
+//-- includes -----
+#include "ServerMetrics.h"
+#include "ServerLog.h"
+#include "ServerUtility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/bind.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/shared_ptr.hpp>
+
+//-- pre-declarations -----
+namespace asio = boost::asio;
+using asio::ip::tcp;
+using asio::ip::udp;
+
+//-- constants -----
+static const char *k_metric_names[ServerMetric_COUNT] = {
+    "controller_pose_latency",
+    "hmd_pose_latency",
+    "tracker_vision_time",
+    "tick_time",
+    "udp_send_time",
+};
+
+static const char *k_metric_slot_labels[ServerMetric_COUNT] = {
+    "controller",
+    "hmd",
+    "tracker",
+    nullptr,
+    nullptr,
+};
+
+// Matches the device limits of the ControllerManager, HMDManager and TrackerManager
+static const int k_metric_slot_counts[ServerMetric_COUNT] = {
+    32,
+    16,
+    16,
+    1,
+    1,
+};
+
+// Keep statsd datagrams under a typical ethernet MTU
+static const size_t k_max_statsd_datagram_size = 1432;
+
+// /metrics requests are a request line and a few headers, anything bigger gets dropped
+static const size_t k_max_http_request_size = 8192;
+
+// The Prometheus buckets are every power of two from 2^k_first_prometheus_bucket_exponent us (64us)
+// up to the last one the histograms can tell apart
+static const int k_first_prometheus_bucket_exponent = 6;
+
+//-- private definitions -----
+// Buckets are only ever added to, so a snapshot taken while another thread records
+// may be off by the values in flight but never torn
+struct ServerMetricHistogram
+{
+    ServerMetricHistogram()
+    {
+        for (int bucket_index = 0; bucket_index < SERVER_METRICS_BUCKET_COUNT; ++bucket_index)
+        {
+            bucket_counts[bucket_index].store(0, std::memory_order_relaxed);
+        }
+        sum_us.store(0, std::memory_order_relaxed);
+        max_us.store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> bucket_counts[SERVER_METRICS_BUCKET_COUNT];
+    std::atomic<uint64_t> sum_us;
+    std::atomic<uint64_t> max_us;
+};
+
+static int get_metric_slot_offset(eServerMetric metric)
+{
+    int slot_offset = 0;
+
+    for (int metric_index = 0; metric_index < metric; ++metric_index)
+    {
+        slot_offset += k_metric_slot_counts[metric_index];
+    }
+
+    return slot_offset;
+}
+
+static int get_total_slot_count()
+{
+    return get_metric_slot_offset(ServerMetric_COUNT);
+}
+
+static ServerMetricHistogram *get_histogram(eServerMetric metric, int slot)
+{
+    static ServerMetricHistogram *g_histograms = new ServerMetricHistogram[get_total_slot_count()];
+
+    if (metric < 0 || metric >= ServerMetric_COUNT || slot < 0 || slot >= k_metric_slot_counts[metric])
+    {
+        return nullptr;
+    }
+
+    return &g_histograms[get_metric_slot_offset(metric) + slot];
+}
+
+static int floor_log2(uint64_t value)
+{
+    int exponent = 0;
+
+    while (value >>= 1)
+    {
+        ++exponent;
+    }
+
+    return exponent;
+}
+
+//-- ServerMetricSnapshot -----
+void ServerMetricSnapshot::clear()
+{
+    std::fill(bucket_counts, bucket_counts + SERVER_METRICS_BUCKET_COUNT, 0);
+    count = 0;
+    sum_us = 0;
+    max_us = 0;
+}
+
+void ServerMetricSnapshot::subtract(const ServerMetricSnapshot &earlier)
+{
+    int highest_bucket_index = -1;
+
+    for (int bucket_index = 0; bucket_index < SERVER_METRICS_BUCKET_COUNT; ++bucket_index)
+    {
+        bucket_counts[bucket_index] -= earlier.bucket_counts[bucket_index];
+
+        if (bucket_counts[bucket_index] > 0)
+        {
+            highest_bucket_index = bucket_index;
+        }
+    }
+
+    count -= earlier.count;
+    sum_us -= earlier.sum_us;
+    max_us =
+        (highest_bucket_index >= 0)
+        ? std::min(max_us, ServerMetrics::get_bucket_upper_bound_us(highest_bucket_index) - 1)
+        : 0;
+}
+
+uint64_t ServerMetricSnapshot::getPercentileUs(double fraction) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const uint64_t rank =
+        std::max<uint64_t>(static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count))), 1);
+    uint64_t running_count = 0;
+
+    for (int bucket_index = 0; bucket_index < SERVER_METRICS_BUCKET_COUNT; ++bucket_index)
+    {
+        running_count += bucket_counts[bucket_index];
+
+        if (running_count >= rank)
+        {
+            const uint64_t lower_bound_us = ServerMetrics::get_bucket_lower_bound_us(bucket_index);
+            const uint64_t upper_bound_us = ServerMetrics::get_bucket_upper_bound_us(bucket_index);
+
+            // Middle of the bucket, but never past the largest value actually seen
+            return std::min(lower_bound_us + (upper_bound_us - lower_bound_us) / 2, max_us);
+        }
+    }
+
+    return max_us;
+}
+
+//-- ServerMetrics -----
+namespace ServerMetrics
+{
+    void record(eServerMetric metric, int slot, long long value_us)
+    {
+        ServerMetricHistogram *histogram = get_histogram(metric, slot);
+
+        if (histogram != nullptr)
+        {
+            const uint64_t value = static_cast<uint64_t>(std::max(value_us, 0LL));
+
+            histogram->bucket_counts[get_bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+            histogram->sum_us.fetch_add(value, std::memory_order_relaxed);
+
+            uint64_t max_us = histogram->max_us.load(std::memory_order_relaxed);
+            while (value > max_us &&
+                   !histogram->max_us.compare_exchange_weak(max_us, value, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
+    bool take_snapshot(eServerMetric metric, int slot, ServerMetricSnapshot &out_snapshot)
+    {
+        const ServerMetricHistogram *histogram = get_histogram(metric, slot);
+
+        if (histogram == nullptr)
+        {
+            return false;
+        }
+
+        out_snapshot.count = 0;
+        for (int bucket_index = 0; bucket_index < SERVER_METRICS_BUCKET_COUNT; ++bucket_index)
+        {
+            out_snapshot.bucket_counts[bucket_index] = histogram->bucket_counts[bucket_index].load(std::memory_order_relaxed);
+            out_snapshot.count += out_snapshot.bucket_counts[bucket_index];
+        }
+        out_snapshot.sum_us = histogram->sum_us.load(std::memory_order_relaxed);
+        out_snapshot.max_us = histogram->max_us.load(std::memory_order_relaxed);
+
+        return true;
+    }
+
+    int get_slot_count(eServerMetric metric)
+    {
+        return (metric >= 0 && metric < ServerMetric_COUNT) ? k_metric_slot_counts[metric] : 0;
+    }
+
+    const char *get_metric_name(eServerMetric metric)
+    {
+        return (metric >= 0 && metric < ServerMetric_COUNT) ? k_metric_names[metric] : "unknown";
+    }
+
+    const char *get_slot_label(eServerMetric metric)
+    {
+        return (metric >= 0 && metric < ServerMetric_COUNT) ? k_metric_slot_labels[metric] : nullptr;
+    }
+
+    int get_bucket_index(uint64_t value_us)
+    {
+        if (value_us < SERVER_METRICS_SUB_BUCKET_COUNT)
+        {
+            return static_cast<int>(value_us);
+        }
+
+        const int exponent = floor_log2(value_us);
+
+        if (exponent > SERVER_METRICS_MAX_VALUE_EXPONENT)
+        {
+            return SERVER_METRICS_BUCKET_COUNT - 1;
+        }
+
+        // The top SERVER_METRICS_SUB_BUCKET_BITS+1 bits of the value, less the leading one
+        const int shift = exponent - SERVER_METRICS_SUB_BUCKET_BITS;
+        const int sub_bucket = static_cast<int>(value_us >> shift) - SERVER_METRICS_SUB_BUCKET_COUNT;
+
+        return SERVER_METRICS_SUB_BUCKET_COUNT + shift*SERVER_METRICS_SUB_BUCKET_COUNT + sub_bucket;
+    }
+
+    uint64_t get_bucket_lower_bound_us(int bucket_index)
+    {
+        if (bucket_index < SERVER_METRICS_SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint64_t>(std::max(bucket_index, 0));
+        }
+
+        const int shift = (bucket_index - SERVER_METRICS_SUB_BUCKET_COUNT) / SERVER_METRICS_SUB_BUCKET_COUNT;
+        const int sub_bucket = (bucket_index - SERVER_METRICS_SUB_BUCKET_COUNT) % SERVER_METRICS_SUB_BUCKET_COUNT;
+
+        return static_cast<uint64_t>(SERVER_METRICS_SUB_BUCKET_COUNT + sub_bucket) << shift;
+    }
+
+    uint64_t get_bucket_upper_bound_us(int bucket_index)
+    {
+        if (bucket_index < SERVER_METRICS_SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint64_t>(std::max(bucket_index, 0)) + 1;
+        }
+
+        const int shift = (bucket_index - SERVER_METRICS_SUB_BUCKET_COUNT) / SERVER_METRICS_SUB_BUCKET_COUNT;
+        const int sub_bucket = (bucket_index - SERVER_METRICS_SUB_BUCKET_COUNT) % SERVER_METRICS_SUB_BUCKET_COUNT;
+
+        return static_cast<uint64_t>(SERVER_METRICS_SUB_BUCKET_COUNT + sub_bucket + 1) << shift;
+    }
+};
+
+//-- Metrics Config -----
+const int MetricsConfig::CONFIG_VERSION = 1;
+
+MetricsConfig::MetricsConfig(const std::string &fnamebase)
+    : PSMoveConfig(fnamebase)
+    , version(CONFIG_VERSION)
+    , metric_prefix("psmoveservice")
+    , statsd_enabled(false)
+    , statsd_address("127.0.0.1")
+    , statsd_port(8125)
+    , statsd_interval_ms(10000)
+    , prometheus_enabled(false)
+    , prometheus_address("0.0.0.0")
+    , prometheus_port(9464)
+{
+}
+
+const boost::property_tree::ptree
+MetricsConfig::config2ptree()
+{
+    boost::property_tree::ptree pt;
+
+    pt.put("version", MetricsConfig::CONFIG_VERSION);
+    pt.put("metric_prefix", metric_prefix);
+    pt.put("statsd_enabled", statsd_enabled);
+    pt.put("statsd_address", statsd_address);
+    pt.put("statsd_port", statsd_port);
+    pt.put("statsd_interval_ms", statsd_interval_ms);
+    pt.put("prometheus_enabled", prometheus_enabled);
+    pt.put("prometheus_address", prometheus_address);
+    pt.put("prometheus_port", prometheus_port);
+
+    return pt;
+}
+
+void
+MetricsConfig::ptree2config(const boost::property_tree::ptree &pt)
+{
+    version = pt.get<int>("version", 0);
+
+    if (version == MetricsConfig::CONFIG_VERSION)
+    {
+        metric_prefix = pt.get<std::string>("metric_prefix", metric_prefix);
+        statsd_enabled = pt.get<bool>("statsd_enabled", statsd_enabled);
+        statsd_address = pt.get<std::string>("statsd_address", statsd_address);
+        statsd_port = pt.get<int>("statsd_port", statsd_port);
+        statsd_interval_ms = pt.get<int>("statsd_interval_ms", statsd_interval_ms);
+        prometheus_enabled = pt.get<bool>("prometheus_enabled", prometheus_enabled);
+        prometheus_address = pt.get<std::string>("prometheus_address", prometheus_address);
+        prometheus_port = pt.get<int>("prometheus_port", prometheus_port);
+    }
+    else
+    {
+        SERVER_LOG_WARNING("MetricsConfig") <<
+            "Config version " << version << " does not match expected version " <<
+            MetricsConfig::CONFIG_VERSION << ", Using defaults.";
+    }
+}
+
+//-- private implementation -----
+static void append_prometheus_histogram(
+    const std::string &metric_prefix,
+    eServerMetric metric,
+    int slot,
+    const ServerMetricSnapshot &snapshot,
+    std::ostringstream &out_text)
+{
+    const char *slot_label = ServerMetrics::get_slot_label(metric);
+    const std::string metric_name =
+        metric_prefix + "_" + ServerMetrics::get_metric_name(metric) + "_seconds";
+
+    std::ostringstream labels;
+    if (slot_label != nullptr)
+    {
+        labels << slot_label << "=\"" << slot << "\",";
+    }
+
+    // Every SERVER_METRICS_SUB_BUCKET_COUNT buckets end on a power of two.
+    // The last bucket also holds the clamped values, so it only goes into +Inf.
+    uint64_t cumulative_count = 0;
+    int bucket_index = 0;
+
+    for (int exponent = 0; exponent <= SERVER_METRICS_MAX_VALUE_EXPONENT; ++exponent)
+    {
+        const uint64_t bound_us = 1ULL << exponent;
+
+        while (bucket_index < SERVER_METRICS_BUCKET_COUNT &&
+               ServerMetrics::get_bucket_upper_bound_us(bucket_index) <= bound_us)
+        {
+            cumulative_count += snapshot.bucket_counts[bucket_index];
+            ++bucket_index;
+        }
+
+        if (exponent >= k_first_prometheus_bucket_exponent)
+        {
+            char le[32];
+            snprintf(le, sizeof(le), "%g", static_cast<double>(bound_us) / 1000000.0);
+
+            out_text << metric_name << "_bucket{" << labels.str() << "le=\"" << le << "\"} " << cumulative_count << "\n";
+        }
+    }
+
+    std::string sample_labels = labels.str();
+    if (!sample_labels.empty())
+    {
+        sample_labels = "{" + sample_labels.substr(0, sample_labels.size() - 1) + "}";
+    }
+
+    out_text << metric_name << "_bucket{" << labels.str() << "le=\"+Inf\"} " << snapshot.count << "\n";
+    out_text << metric_name << "_sum" << sample_labels << " " << static_cast<double>(snapshot.sum_us) / 1000000.0 << "\n";
+    out_text << metric_name << "_count" << sample_labels << " " << snapshot.count << "\n";
+}
+
+// Writes every histogram that has seen a value in the Prometheus text exposition format
+static std::string build_prometheus_text(const std::string &metric_prefix)
+{
+    std::ostringstream text;
+    ServerMetricSnapshot snapshot;
+
+    for (int metric_index = 0; metric_index < ServerMetric_COUNT; ++metric_index)
+    {
+        const eServerMetric metric = static_cast<eServerMetric>(metric_index);
+        bool bWroteHeader = false;
+
+        for (int slot = 0; slot < ServerMetrics::get_slot_count(metric); ++slot)
+        {
+            if (!ServerMetrics::take_snapshot(metric, slot, snapshot) || snapshot.count == 0)
+            {
+                continue;
+            }
+
+            if (!bWroteHeader)
+            {
+                text << "# TYPE " << metric_prefix << "_" << ServerMetrics::get_metric_name(metric) << "_seconds histogram\n";
+                bWroteHeader = true;
+            }
+
+            append_prometheus_histogram(metric_prefix, metric, slot, snapshot, text);
+        }
+    }
+
+    return text.str();
+}
+
+// Answers one HTTP request and closes the connection
+class MetricsHttpConnection : public boost::enable_shared_from_this<MetricsHttpConnection>
+{
+public:
+    MetricsHttpConnection(asio::io_service &io_service, const std::string &metric_prefix)
+        : m_socket(io_service)
+        , m_request_buffer(k_max_http_request_size)
+        , m_response()
+        , m_metric_prefix(metric_prefix)
+    {
+    }
+
+    tcp::socket &get_socket()
+    {
+        return m_socket;
+    }
+
+    void start()
+    {
+        asio::async_read_until(
+            m_socket, m_request_buffer, "\r\n\r\n",
+            boost::bind(&MetricsHttpConnection::handle_read_request, shared_from_this(), asio::placeholders::error));
+    }
+
+private:
+    void handle_read_request(const boost::system::error_code &ec)
+    {
+        if (ec)
+        {
+            // Client went away or sent an oversized request
+            return;
+        }
+
+        std::istream request_stream(&m_request_buffer);
+        std::string method, target;
+        request_stream >> method >> target;
+
+        std::ostringstream response;
+        if (method == "GET" && (target == "/metrics" || target.compare(0, 9, "/metrics?") == 0))
+        {
+            const std::string body = build_prometheus_text(m_metric_prefix);
+
+            response
+                << "HTTP/1.1 200 OK\r\n"
+                << "Content-Type: text/plain; version=0.0.4\r\n"
+                << "Content-Length: " << body.size() << "\r\n"
+                << "Connection: close\r\n\r\n"
+                << body;
+        }
+        else
+        {
+            response
+                << "HTTP/1.1 404 Not Found\r\n"
+                << "Content-Length: 0\r\n"
+                << "Connection: close\r\n\r\n";
+        }
+        m_response = response.str();
+
+        asio::async_write(
+            m_socket, asio::buffer(m_response),
+            boost::bind(&MetricsHttpConnection::handle_write_response, shared_from_this(), asio::placeholders::error));
+    }
+
+    void handle_write_response(const boost::system::error_code &ec)
+    {
+        boost::system::error_code ignored_error;
+
+        m_socket.shutdown(tcp::socket::shutdown_both, ignored_error);
+        m_socket.close(ignored_error);
+    }
+
+    tcp::socket m_socket;
+    asio::streambuf m_request_buffer;
+    std::string m_response;
+    const std::string m_metric_prefix;
+};
+typedef boost::shared_ptr<MetricsHttpConnection> MetricsHttpConnectionPtr;
+
+class ServerMetricsExporterImpl
+{
+public:
+    ServerMetricsExporterImpl(asio::io_service &io_service, const MetricsConfig &cfg)
+        : m_cfg(cfg)
+        , m_io_service(io_service)
+        , m_statsd_socket(io_service)
+        , m_statsd_endpoint()
+        , m_bStatsdOpen(false)
+        , m_last_statsd_push_us(0)
+        , m_statsd_baselines()
+        , m_acceptor(io_service)
+        , m_bAcceptorOpen(false)
+    {
+    }
+
+    bool open_statsd()
+    {
+        boost::system::error_code error;
+        const asio::ip::address address = asio::ip::address::from_string(m_cfg.statsd_address, error);
+
+        if (!error)
+        {
+            m_statsd_endpoint = udp::endpoint(address, static_cast<unsigned short>(m_cfg.statsd_port));
+            m_statsd_socket.open(m_statsd_endpoint.protocol(), error);
+        }
+
+        if (!error)
+        {
+            m_statsd_socket.non_blocking(true, error);
+        }
+
+        if (!error)
+        {
+            SERVER_LOG_INFO("ServerMetricsExporter::open_statsd") <<
+                "Pushing metrics to statsd at " << m_cfg.statsd_address << ":" << m_cfg.statsd_port <<
+                " every " << m_cfg.statsd_interval_ms << "ms";
+
+            // Start counting from what got recorded before the exporter started
+            m_statsd_baselines.resize(get_total_slot_count());
+            for_each_histogram_snapshot(
+                [this](eServerMetric metric, int slot, const ServerMetricSnapshot &snapshot) {
+                    m_statsd_baselines[get_metric_slot_offset(metric) + slot] = snapshot;
+                });
+            m_last_statsd_push_us = ServerUtility::get_service_time_us();
+            m_bStatsdOpen = true;
+        }
+        else
+        {
+            SERVER_LOG_ERROR("ServerMetricsExporter::open_statsd") <<
+                "Can't push metrics to statsd at " << m_cfg.statsd_address << ":" << m_cfg.statsd_port << ": " << error.message();
+            close_statsd();
+        }
+
+        return m_bStatsdOpen;
+    }
+
+    bool open_prometheus()
+    {
+        boost::system::error_code error;
+        const asio::ip::address address = asio::ip::address::from_string(m_cfg.prometheus_address, error);
+        tcp::endpoint endpoint;
+
+        if (!error)
+        {
+            endpoint = tcp::endpoint(address, static_cast<unsigned short>(m_cfg.prometheus_port));
+            m_acceptor.open(endpoint.protocol(), error);
+        }
+
+        if (!error)
+        {
+            m_acceptor.set_option(tcp::acceptor::reuse_address(true), error);
+        }
+
+        if (!error)
+        {
+            m_acceptor.bind(endpoint, error);
+        }
+
+        if (!error)
+        {
+            m_acceptor.listen(asio::socket_base::max_connections, error);
+        }
+
+        if (!error)
+        {
+            SERVER_LOG_INFO("ServerMetricsExporter::open_prometheus") <<
+                "Serving metrics on http://" << m_cfg.prometheus_address << ":" << m_cfg.prometheus_port << "/metrics";
+            m_bAcceptorOpen = true;
+            start_accept();
+        }
+        else
+        {
+            SERVER_LOG_ERROR("ServerMetricsExporter::open_prometheus") <<
+                "Can't serve metrics on port " << m_cfg.prometheus_port << ": " << error.message();
+            close_prometheus();
+        }
+
+        return m_bAcceptorOpen;
+    }
+
+    void update()
+    {
+        if (m_bStatsdOpen)
+        {
+            const long long now_us = ServerUtility::get_service_time_us();
+
+            if (now_us - m_last_statsd_push_us >= static_cast<long long>(m_cfg.statsd_interval_ms) * 1000)
+            {
+                push_statsd();
+                m_last_statsd_push_us = now_us;
+            }
+        }
+    }
+
+    void close()
+    {
+        close_statsd();
+        close_prometheus();
+    }
+
+private:
+    template <typename t_visitor>
+    void for_each_histogram_snapshot(t_visitor visitor)
+    {
+        ServerMetricSnapshot snapshot;
+
+        for (int metric_index = 0; metric_index < ServerMetric_COUNT; ++metric_index)
+        {
+            const eServerMetric metric = static_cast<eServerMetric>(metric_index);
+
+            for (int slot = 0; slot < ServerMetrics::get_slot_count(metric); ++slot)
+            {
+                if (ServerMetrics::take_snapshot(metric, slot, snapshot))
+                {
+                    visitor(metric, slot, snapshot);
+                }
+            }
+        }
+    }
+
+    // Sends what every histogram recorded since the last push, packed into as few datagrams as fit
+    void push_statsd()
+    {
+        std::string datagram;
+
+        for_each_histogram_snapshot(
+            [this, &datagram](eServerMetric metric, int slot, const ServerMetricSnapshot &snapshot) {
+                ServerMetricSnapshot &baseline = m_statsd_baselines[get_metric_slot_offset(metric) + slot];
+                ServerMetricSnapshot delta = snapshot;
+
+                delta.subtract(baseline);
+                baseline = snapshot;
+
+                if (delta.count == 0)
+                {
+                    return;
+                }
+
+                std::ostringstream name;
+                name << m_cfg.metric_prefix << "." << ServerMetrics::get_metric_name(metric);
+                if (ServerMetrics::get_slot_label(metric) != nullptr)
+                {
+                    name << "." << ServerMetrics::get_slot_label(metric) << "." << slot;
+                }
+
+                char lines[512];
+                snprintf(lines, sizeof(lines),
+                    "%s.count:%llu|c\n%s.p50:%.3f|g\n%s.p90:%.3f|g\n%s.p99:%.3f|g\n%s.max:%.3f|g\n",
+                    name.str().c_str(), static_cast<unsigned long long>(delta.count),
+                    name.str().c_str(), static_cast<double>(delta.getPercentileUs(0.5)) / 1000.0,
+                    name.str().c_str(), static_cast<double>(delta.getPercentileUs(0.9)) / 1000.0,
+                    name.str().c_str(), static_cast<double>(delta.getPercentileUs(0.99)) / 1000.0,
+                    name.str().c_str(), static_cast<double>(delta.max_us) / 1000.0);
+
+                if (!datagram.empty() && datagram.size() + strlen(lines) > k_max_statsd_datagram_size)
+                {
+                    send_statsd_datagram(datagram);
+                    datagram.clear();
+                }
+                datagram += lines;
+            });
+
+        if (!datagram.empty())
+        {
+            send_statsd_datagram(datagram);
+        }
+    }
+
+    void send_statsd_datagram(std::string &datagram)
+    {
+        boost::system::error_code error;
+
+        // Drop the trailing newline
+        datagram.resize(datagram.size() - 1);
+        m_statsd_socket.send_to(asio::buffer(datagram), m_statsd_endpoint, 0, error);
+
+        if (error && error != asio::error::would_block)
+        {
+            SERVER_LOG_WARNING("ServerMetricsExporter::push_statsd") << "Failed to send statsd metrics: " << error.message();
+        }
+    }
+
+    void start_accept()
+    {
+        MetricsHttpConnectionPtr connection(new MetricsHttpConnection(m_io_service, m_cfg.metric_prefix));
+
+        m_acceptor.async_accept(
+            connection->get_socket(),
+            boost::bind(&ServerMetricsExporterImpl::handle_accept, this, connection, asio::placeholders::error));
+    }
+
+    void handle_accept(MetricsHttpConnectionPtr connection, const boost::system::error_code &ec)
+    {
+        if (!m_bAcceptorOpen)
+        {
+            return;
+        }
+
+        if (!ec)
+        {
+            connection->start();
+        }
+
+        start_accept();
+    }
+
+    void close_statsd()
+    {
+        boost::system::error_code ignored_error;
+
+        m_statsd_socket.close(ignored_error);
+        m_bStatsdOpen = false;
+    }
+
+    void close_prometheus()
+    {
+        boost::system::error_code ignored_error;
+
+        m_bAcceptorOpen = false;
+        m_acceptor.close(ignored_error);
+    }
+
+    const MetricsConfig &m_cfg;
+    asio::io_service &m_io_service;
+
+    udp::socket m_statsd_socket;
+    udp::endpoint m_statsd_endpoint;
+    bool m_bStatsdOpen;
+    long long m_last_statsd_push_us;
+    // What each histogram held at the last push, indexed like the histograms
+    std::vector<ServerMetricSnapshot> m_statsd_baselines;
+
+    tcp::acceptor m_acceptor;
+    bool m_bAcceptorOpen;
+};
+
+//-- public interface -----
+ServerMetricsExporter::ServerMetricsExporter()
+    : m_cfg()
+    , implementation_ptr(nullptr)
+{
+}
+
+ServerMetricsExporter::~ServerMetricsExporter()
+{
+    if (implementation_ptr != nullptr)
+    {
+        delete implementation_ptr;
+        implementation_ptr = nullptr;
+    }
+}
+
+bool ServerMetricsExporter::startup(boost::asio::io_service *io_service)
+{
+    m_cfg.load();
+
+    // Save the config back out in case it doesn't exist
+    m_cfg.save();
+
+    implementation_ptr = new ServerMetricsExporterImpl(*io_service, m_cfg);
+
+    // The service runs fine without its monitoring, so failing to open an exporter isn't fatal
+    if (m_cfg.statsd_enabled)
+    {
+        implementation_ptr->open_statsd();
+    }
+
+    if (m_cfg.prometheus_enabled)
+    {
+        implementation_ptr->open_prometheus();
+    }
+
+    return true;
+}
+
+void ServerMetricsExporter::update()
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->update();
+    }
+}
+
+void ServerMetricsExporter::shutdown()
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->close();
+    }
+}
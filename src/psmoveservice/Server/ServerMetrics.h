@@ -0,0 +1,145 @@
+#ifndef SERVER_METRICS_H
+#define SERVER_METRICS_H
+
+//-- includes -----
+#include "PSMoveConfig.h"
+
+#include <stdint.h>
+#include <string>
+
+//-- pre-declarations -----
+namespace boost {
+    namespace asio {
+        class io_service;
+    }
+}
+
+//-- constants -----
+// Each power of two range of values gets split into 2^SERVER_METRICS_SUB_BUCKET_BITS linear buckets,
+// so a bucket is never wider than 1/8th of the values it holds (values below 8us get a bucket each)
+#define SERVER_METRICS_SUB_BUCKET_BITS 3
+#define SERVER_METRICS_SUB_BUCKET_COUNT (1 << SERVER_METRICS_SUB_BUCKET_BITS)
+
+// Values from 2^SERVER_METRICS_MAX_VALUE_EXPONENT+1 us (~33s) up all land in the last bucket
+#define SERVER_METRICS_MAX_VALUE_EXPONENT 24
+#define SERVER_METRICS_BUCKET_COUNT \
+    (SERVER_METRICS_SUB_BUCKET_COUNT + (SERVER_METRICS_MAX_VALUE_EXPONENT - SERVER_METRICS_SUB_BUCKET_BITS + 1)*SERVER_METRICS_SUB_BUCKET_COUNT)
+
+enum eServerMetric
+{
+    ServerMetric_ControllerPoseLatency, // Capture of the newest sample a controller pose used -> publish, one per controller id
+    ServerMetric_HMDPoseLatency,        // Same for the HMDs, one per HMD id
+    ServerMetric_TrackerVisionTime,     // Searching a video frame for every device, one per tracker id
+    ServerMetric_TickTime,              // One iteration of the service main loop
+    ServerMetric_UDPSendTime,           // Data frame datagram handed to the socket -> send completed
+
+    ServerMetric_COUNT
+};
+
+//-- definitions -----
+/// A copy of one histogram taken at some point in time
+struct ServerMetricSnapshot
+{
+    uint64_t bucket_counts[SERVER_METRICS_BUCKET_COUNT];
+    uint64_t count;
+    uint64_t sum_us;
+    uint64_t max_us;
+
+    void clear();
+
+    /// Turns a snapshot into the values recorded since the earlier one.
+    /// max_us can't be undone, it becomes the top of the highest bucket that got new values (or the max, if lower).
+    void subtract(const ServerMetricSnapshot &earlier);
+
+    /// Value at the given fraction (0..1) of the recorded values, accurate to the width of its bucket
+    uint64_t getPercentileUs(double fraction) const;
+};
+
+//-- interface -----
+/// Latency histograms of the service pipeline, for long term monitoring.
+/**
+ Unlike ServerTrace, which keeps the last few thousand events for a close look at one run,
+ these keep counting forever in fixed size log-linear (HDR style) buckets.
+ Recording is a handful of relaxed atomic adds on a preallocated histogram,
+ so any thread can record from its hot path without taking a lock.
+ ServerMetricsExporter pushes them to statsd and/or serves them to Prometheus.
+ */
+namespace ServerMetrics
+{
+    /// Adds a value to the histogram of the given metric and slot (device, tracker id or 0).
+    /// Slots past get_slot_count() get dropped.
+    void record(eServerMetric metric, int slot, long long value_us);
+
+    /// Copies out a histogram, returns false for an invalid metric or slot
+    bool take_snapshot(eServerMetric metric, int slot, ServerMetricSnapshot &out_snapshot);
+
+    /// Histograms a metric keeps, one for each device or tracker id
+    int get_slot_count(eServerMetric metric);
+
+    /// e.g. "controller_pose_latency"
+    const char *get_metric_name(eServerMetric metric);
+    /// What the slots of a metric stand for ("controller", "hmd", "tracker"), nullptr for single slot metrics
+    const char *get_slot_label(eServerMetric metric);
+
+    int get_bucket_index(uint64_t value_us);
+    uint64_t get_bucket_lower_bound_us(int bucket_index);
+    /// First value past the bucket
+    uint64_t get_bucket_upper_bound_us(int bucket_index);
+};
+
+class MetricsConfig : public PSMoveConfig
+{
+public:
+    static const int CONFIG_VERSION;
+
+    MetricsConfig(const std::string &fnamebase = "MetricsConfig");
+
+    virtual const boost::property_tree::ptree config2ptree();
+    virtual void ptree2config(const boost::property_tree::ptree &pt);
+
+    long version;
+
+    // Leading part of every exported metric name
+    std::string metric_prefix;
+
+    // Push the changes of the histograms as statsd counters and gauges every statsd_interval_ms
+    bool statsd_enabled;
+    std::string statsd_address; // IPv4 or IPv6 address of the statsd daemon
+    int statsd_port;
+    int statsd_interval_ms;
+
+    // Serve the histograms in the Prometheus text format on http://<prometheus_address>:<prometheus_port>/metrics
+    bool prometheus_enabled;
+    std::string prometheus_address;
+    int prometheus_port;
+};
+
+/// Exports the ServerMetrics histograms for production monitoring.
+/**
+ Everything runs on the main loop's io_service: statsd datagrams get sent from update()
+ on a non-blocking UDP socket (what the socket can't take right away gets dropped),
+ the /metrics endpoint answers each HTTP request with a fresh snapshot and closes the connection.
+ */
+class ServerMetricsExporter
+{
+public:
+    ServerMetricsExporter();
+    virtual ~ServerMetricsExporter();
+
+    /// Called by PSMoveService::startup() after the network manager started
+    bool startup(boost::asio::io_service *io_service);
+
+    /// Called by PSMoveService::update(), pushes to statsd when the interval is up
+    void update();
+
+    /// Called by PSMoveService::shutdown() before the network manager shutdown
+    void shutdown();
+
+private:
+    MetricsConfig m_cfg;
+
+    // private implementation - same lifetime as the ServerMetricsExporter
+    class ServerMetricsExporterImpl *implementation_ptr;
+};
+
+#endif // SERVER_METRICS_H
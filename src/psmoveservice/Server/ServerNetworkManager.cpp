@@ -1,16 +1,24 @@
 //-- includes -----
 #include "ServerNetworkManager.h"
 #include "ServerRequestHandler.h"
+#include "CompactDataFrame.h"
 #include "ServerLog.h"
+#include "ServerMetrics.h"
+#include "ServerTrace.h"
+#include "ServerUtility.h"
 #include "PackedMessage.h"
 #include "PSMoveProtocolInterface.h"
 #include "PSMoveProtocol.pb.h"
+#include "SharedConstants.h"
 #include <cassert>
+#include <cstdio>
 #include <iostream>
 #include <string>
 #include <sstream>
 #include <vector>
 #include <deque>
+#include <unordered_map>
+#include <boost/array.hpp>
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 #include <boost/shared_ptr.hpp>
@@ -24,16 +32,43 @@ using asio::ip::tcp;
 using asio::ip::udp;
 using boost::uint8_t;
 
+// Requests go over TCP, or a unix domain socket for clients on the same machine (data frames likewise over UDP or a
+// unix datagram socket). The generic protocols let a connection hold either kind of socket.
+typedef asio::generic::stream_protocol::socket t_request_socket;
+typedef asio::generic::datagram_protocol::socket t_data_frame_socket;
+typedef asio::generic::datagram_protocol::endpoint t_data_frame_endpoint;
+
 class ClientConnection;
 typedef boost::shared_ptr<ClientConnection> ClientConnectionPtr;
 
-typedef map<int, ClientConnectionPtr> t_client_connection_map;
-typedef map<int, ClientConnectionPtr>::iterator t_client_connection_map_iter;
+// Looked up by connection id for every data frame sent, so hashed rather than ordered
+typedef unordered_map<int, ClientConnectionPtr> t_client_connection_map;
+typedef unordered_map<int, ClientConnectionPtr>::iterator t_client_connection_map_iter;
+typedef unordered_map<int, ClientConnectionPtr>::const_iterator t_client_connection_map_const_iter;
 typedef std::pair<int, ClientConnectionPtr> t_id_client_connection_pair;
 
 //-- constants -----
 const int PSMOVE_SERVER_PORT = 9512;
 
+// Defaults for the optional LAN pose multicast (an organization-local scope group)
+const char *PSMOVE_MULTICAST_POSE_STREAM_ADDRESS = "239.255.95.12";
+const int PSMOVE_MULTICAST_POSE_STREAM_PORT = 9513;
+
+// Max number of data frames waiting to go out on a connection before new ones get dropped
+const int k_max_pending_data_frames = 32;
+
+// Most responses gathered into one TCP write, and the byte budget that stops
+// a batch from growing once it already has a response in it
+const int k_max_batched_responses = 16;
+const size_t k_max_batched_response_bytes = 64*1024;
+
+// Every data frame packet must fit in a batched datagram on its own
+static_assert(DEVICE_OUTPUT_DATA_FRAME_PACKET_SIZE <= MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE,
+    "MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE can't hold a full data frame packet");
+
+static_assert(DEVICE_OUTPUT_DATA_FRAME_PACKET_SIZE == HEADER_SIZE + MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE,
+    "DEVICE_OUTPUT_DATA_FRAME_PACKET_SIZE out of sync with PackedMessage HEADER_SIZE");
+
 //-- private implementation -----
 class IServerNetworkEventListener
 {
@@ -48,6 +83,12 @@ NetworkManagerConfig::NetworkManagerConfig(const std::string &fnamebase)
     : PSMoveConfig(fnamebase)
 {
 	server_port= PSMOVE_SERVER_PORT;
+    local_socket_enabled= true;
+    local_socket_path= PSMOVESERVICE_DEFAULT_LOCAL_SOCKET_PATH;
+    multicast_pose_stream_enabled= false;
+    multicast_pose_stream_address= PSMOVE_MULTICAST_POSE_STREAM_ADDRESS;
+    multicast_pose_stream_port= PSMOVE_MULTICAST_POSE_STREAM_PORT;
+    multicast_pose_stream_ttl= 1;
 };
 
 const boost::property_tree::ptree
@@ -57,6 +98,12 @@ NetworkManagerConfig::config2ptree()
 
     pt.put("version", NetworkManagerConfig::CONFIG_VERSION);
 	pt.put("server_port", server_port);
+    pt.put("local_socket_enabled", local_socket_enabled);
+    pt.put("local_socket_path", local_socket_path);
+    pt.put("multicast_pose_stream_enabled", multicast_pose_stream_enabled);
+    pt.put("multicast_pose_stream_address", multicast_pose_stream_address);
+    pt.put("multicast_pose_stream_port", multicast_pose_stream_port);
+    pt.put("multicast_pose_stream_ttl", multicast_pose_stream_ttl);
 
     return pt;
 }
@@ -69,6 +116,12 @@ NetworkManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
     if (version == NetworkManagerConfig::CONFIG_VERSION)
     {
 		server_port = pt.get<int>("server_port", server_port);
+        local_socket_enabled = pt.get<bool>("local_socket_enabled", local_socket_enabled);
+        local_socket_path = pt.get<std::string>("local_socket_path", local_socket_path);
+        multicast_pose_stream_enabled = pt.get<bool>("multicast_pose_stream_enabled", multicast_pose_stream_enabled);
+        multicast_pose_stream_address = pt.get<std::string>("multicast_pose_stream_address", multicast_pose_stream_address);
+        multicast_pose_stream_port = pt.get<int>("multicast_pose_stream_port", multicast_pose_stream_port);
+        multicast_pose_stream_ttl = pt.get<int>("multicast_pose_stream_ttl", multicast_pose_stream_ttl);
     }
     else
     {
@@ -78,6 +131,15 @@ NetworkManagerConfig::ptree2config(const boost::property_tree::ptree &pt)
     }
 }
 
+// Order in which a connection sends queued responses (see ClientConnection::get_response_priority)
+enum eResponsePriority
+{
+    k_response_priority_urgent= 0,
+    k_response_priority_normal,
+
+    k_response_priority_count
+};
+
 // -ClientConnection-
 /**
  * Maintains TCP and UDP connection state to a single client.
@@ -99,7 +161,8 @@ public:
     static ClientConnectionPtr create(
         IServerNetworkEventListener* network_event_listener,
         asio::io_service& io_service_ref,
-        udp::socket& udp_socket_ref, 
+        t_data_frame_socket& udp_socket_ref, 
+        bool is_local_connection,
         ServerRequestHandler &request_handler_ref)
     {
         return ClientConnectionPtr(
@@ -107,6 +170,7 @@ public:
                 network_event_listener, 
                 io_service_ref, 
                 udp_socket_ref, 
+                is_local_connection,
                 request_handler_ref));
     }
 
@@ -115,11 +179,17 @@ public:
         return m_connection_id;
     }
 
-    tcp::socket& get_tcp_socket()
+    t_request_socket& get_tcp_socket()
     {
         return m_tcp_socket;
     }
 
+    // True for clients connected through the unix domain sockets
+    bool get_is_local_connection() const
+    {
+        return m_is_local_connection;
+    }
+
     void start()
     {
         SERVER_LOG_INFO("ClientConnection::start") << "Starting client connection id " << m_connection_id;
@@ -127,6 +197,18 @@ public:
         m_connection_started= true;
         m_connection_stopped= false;
 
+        // Responses are usually small and the client is waiting on them, so don't let Nagle hold them back
+        if (!m_is_local_connection)
+        {
+            boost::system::error_code option_error;
+            m_tcp_socket.set_option(tcp::no_delay(true), option_error);
+            if (option_error)
+            {
+                SERVER_LOG_WARNING("ClientConnection::start") << "Unable to disable Nagle on connection " 
+                    << m_connection_id << ": " << option_error.message();
+            }
+        }
+
         // Send the connection ID to the client 
         // so that it can send it back to us to establish a UDP connection
         send_connection_info();
@@ -171,15 +253,15 @@ public:
         }
     }
 
-    void bind_udp_remote_endpoint(const udp::endpoint &connecting_remote_endpoint)
+    void bind_udp_remote_endpoint(const t_data_frame_endpoint &connecting_remote_endpoint, bool supports_batched_data_frames)
     {
         SERVER_LOG_DEBUG("ClientConnection::bind_udp_remote_endpoint") << "Binding connection_id " 
-            << m_connection_id << " to UDP remote endpoint " 
-            << connecting_remote_endpoint.address().to_string() << ":"
-            << connecting_remote_endpoint.port();
+            << m_connection_id << (m_is_local_connection ? " to local datagram endpoint" : " to UDP remote endpoint")
+            << (supports_batched_data_frames ? " (batched data frames)" : "");
 
         m_udp_remote_endpoint= connecting_remote_endpoint;
         m_is_udp_remote_endpoint_bound = true;
+        m_supports_batched_data_frames = supports_batched_data_frames;
     }
 
     bool is_udp_remote_endpoint_bound() const
@@ -199,12 +281,52 @@ public:
 
     bool has_queued_controller_data_frames() const
     {
-        return m_connection_started && m_pending_dataframes.size() > 0;
+        return m_connection_started && m_pending_dataframe_count > 0;
+    }
+
+    bool has_queued_responses() const
+    {
+        bool has_queued= m_has_pending_tcp_write;
+
+        for (int priority= 0; !has_queued && priority < k_response_priority_count; ++priority)
+        {
+            has_queued= !m_pending_responses[priority].empty();
+        }
+
+        return has_queued;
+    }
+
+    bool get_is_started() const
+    {
+        return m_connection_started && !m_connection_stopped;
+    }
+
+    // Set while the connection sits in the network manager's dirty connection queue
+    bool get_is_in_dirty_queue() const
+    {
+        return m_is_in_dirty_queue;
+    }
+
+    void set_is_in_dirty_queue(bool bInQueue)
+    {
+        m_is_in_dirty_queue= bInQueue;
+    }
+
+    void gather_statistics(PSMoveProtocol::Response_ResultServiceStats_ConnectionStats *stats)
+    {
+        stats->set_connection_id(m_connection_id);
+        stats->set_udp_datagrams_per_second(m_udp_datagram_rate.getRatePerSecond());
+        stats->set_udp_data_frames_per_second(m_udp_dataframe_rate.getRatePerSecond());
+        stats->set_queued_data_frame_count(m_pending_dataframe_count);
+        stats->set_max_queued_data_frame_count(k_max_pending_data_frames);
+        stats->set_dropped_data_frame_count(m_dropped_dataframe_count);
     }
 
     void add_tcp_response_to_write_queue(ResponsePtr response)
     {
-        m_pending_responses.push_back(response);
+        const eResponsePriority priority= get_response_priority(response);
+
+        m_pending_responses[priority].push_back(response);
     }
 
     bool start_tcp_write_queued_response()
@@ -215,27 +337,48 @@ public:
         {
             if (!m_has_pending_tcp_write)
             {
-                if (m_pending_responses.size() > 0)
+                size_t batch_size= 0;
+                int batch_count= 0;
+
+                m_tcp_write_buffers.clear();
+
+                // Urgent responses go first, then as many normal ones as fit in the batch.
+                // Responses carry their request id, so the client doesn't care about the order.
+                for (int priority= 0; priority < k_response_priority_count; ++priority)
                 {
-                    ResponsePtr response= m_pending_responses.front();
+                    deque<ResponsePtr> &pending_responses= m_pending_responses[priority];
+
+                    while (!pending_responses.empty() &&
+                           batch_count < k_max_batched_responses &&
+                           (batch_count == 0 || batch_size < k_max_batched_response_bytes))
+                    {
+                        vector<uint8_t> &write_buffer= m_response_write_buffers[batch_count];
+
+                        m_packed_response.set_msg(pending_responses.front());
+                        m_packed_response.pack(write_buffer);
+                        pending_responses.pop_front();
 
-                    m_packed_response.set_msg(response);
-                    m_packed_response.pack(m_response_write_buffer);
+                        m_tcp_write_buffers.push_back(boost::asio::buffer(write_buffer));
+                        batch_size+= write_buffer.size();
+                        ++batch_count;
+                    }
+                }
 
-                    SERVER_LOG_DEBUG("ClientConnection::start_tcp_write_queued_response") << "Sending TCP response";
-                    SERVER_LOG_DEBUG("   ") << show_hex(m_response_write_buffer);
-                    SERVER_LOG_DEBUG("   ") << m_packed_response.get_msg()->ByteSize() << " bytes";
+                if (batch_count > 0)
+                {
+                    SERVER_LOG_DEBUG("ClientConnection::start_tcp_write_queued_response") 
+                        << "Sending TCP responses (" << batch_count << " responses, " << batch_size << " bytes)";
 
-                    // The queue should prevent us from writing more than one request as once
+                    // The queue should prevent us from writing more than one batch as once
                     assert(!m_has_pending_tcp_write);
                     m_has_pending_tcp_write= true;
                     write_in_progress= true;
 
-                    // Start an asynchronous operation to send a heartbeat message.
+                    // Start an asynchronous operation to send the batch in a single gathered write.
                     // NOTE: Even if the write completes immediate, the callback will only be called from io_service::poll()
                     boost::asio::async_write(
                         m_tcp_socket, 
-                        boost::asio::buffer(m_response_write_buffer),
+                        m_tcp_write_buffers,
                         boost::bind(&ClientConnection::handle_write_response_complete, this, _1));
                 }
             }
@@ -248,9 +391,24 @@ public:
         return write_in_progress;
     }
     
-    void add_device_data_frame_to_write_queue(DeviceOutputDataFramePtr data_frame)
+    void add_device_data_frame_to_write_queue(const DeviceOutputDataFramePacket &packet)
     {
-        m_pending_dataframes.push_back(data_frame);
+        if (m_pending_dataframe_count < k_max_pending_data_frames)
+        {
+            const int tail_index= (m_pending_dataframe_head + m_pending_dataframe_count) % k_max_pending_data_frames;
+            DeviceOutputDataFramePacket &pending_packet= m_pending_dataframes[tail_index];
+
+            memcpy(pending_packet.buffer, packet.buffer, packet.size);
+            pending_packet.size= packet.size;
+            ++m_pending_dataframe_count;
+        }
+        else
+        {
+            // Client isn't keeping up. Stale UDP data isn't worth queuing.
+            ++m_dropped_dataframe_count;
+            SERVER_LOG_TRACE("ClientConnection::add_device_data_frame_to_write_queue")
+                << "Dropping data frame on connection " << m_connection_id << ", send queue full";
+        }
     }
 
     bool start_udp_write_queued_device_data_frame()
@@ -261,36 +419,49 @@ public:
         {
             if (!m_has_pending_udp_write)
             {
-                if (m_pending_dataframes.size() > 0)
+                if (m_pending_dataframe_count > 0)
                 {
-                    DeviceOutputDataFramePtr dataframe= m_pending_dataframes.front();
-
-                    m_packed_output_dataframe.set_msg(dataframe);
-                    if (m_packed_output_dataframe.pack(m_output_dataframe_buffer, sizeof(m_output_dataframe_buffer)))
+                    // Gather as many queued packets as fit into one datagram
+                    // (just the head packet for clients that can't parse batches).
+                    // The packets stay in the queue until the send completes, so the buffers just point at them.
+                    const int max_batch_count= m_supports_batched_data_frames ? m_pending_dataframe_count : 1;
+                    int batch_size= 0;
+
+                    m_udp_write_buffers.clear();
+                    while (static_cast<int>(m_udp_write_buffers.size()) < max_batch_count)
                     {
-                        int msg_size= m_packed_output_dataframe.get_msg()->ByteSize();
-
-                        SERVER_LOG_DEBUG("ClientConnection::start_udp_write_queued_device_data_frame") << "Sending UDP DataFrame";
-                        SERVER_LOG_DEBUG("   ") << show_hex(m_output_dataframe_buffer, HEADER_SIZE+msg_size);
-                        SERVER_LOG_DEBUG("   ") << msg_size << " bytes";
-
-                        // The queue should prevent us from writing more than one data frame at once
-                        assert(!m_has_pending_udp_write);
-                        m_has_pending_udp_write= true;
-                        write_in_progress= true;
-
-                        // Start an asynchronous operation to send the data frame
-                        // NOTE: Even if the write completes immediate, the callback will only be called from io_service::poll()
-                        m_udp_socket_ref.async_send_to(
-                            boost::asio::buffer(m_output_dataframe_buffer, sizeof(m_output_dataframe_buffer)),
-                            m_udp_remote_endpoint,
-                            boost::bind(&ClientConnection::handle_udp_write_device_data_frame_complete, this, _1));
-                    }
-                    else
-                    {
-                        SERVER_LOG_ERROR("ClientConnection::start_udp_write_queued_device_data_frame") 
-                            << "DataFrame too big to fit in packet!";
+                        const int packet_index= 
+                            (m_pending_dataframe_head + static_cast<int>(m_udp_write_buffers.size())) % k_max_pending_data_frames;
+                        const DeviceOutputDataFramePacket &packet= m_pending_dataframes[packet_index];
+
+                        if (batch_size + packet.size > MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE)
+                        {
+                            break;
+                        }
+
+                        m_udp_write_buffers.push_back(boost::asio::buffer(packet.buffer, packet.size));
+                        batch_size+= packet.size;
                     }
+
+                    SERVER_LOG_DEBUG("ClientConnection::start_udp_write_queued_device_data_frame") 
+                        << "Sending UDP DataFrame batch (" << m_udp_write_buffers.size() << " frames, " << batch_size << " bytes)";
+
+                    // The queue should prevent us from writing more than one datagram at once
+                    assert(!m_has_pending_udp_write);
+                    m_has_pending_udp_write= true;
+                    m_pending_udp_write_frame_count= static_cast<int>(m_udp_write_buffers.size());
+                    m_udp_write_start_us= ServerUtility::get_service_time_us();
+                    write_in_progress= true;
+
+                    // Start an asynchronous operation to send the data frames.
+                    // A buffer sequence goes out as a single datagram (one gathered sendmsg),
+                    // and only the used part of each packet is sent, the client sizes each message from its header.
+                    // NOTE: Even if the write completes immediate, the callback will only be called from io_service::poll()
+                    SERVER_TRACE_SCOPE(ServerTraceStage_UDPSend);
+                    m_udp_socket_ref.async_send_to(
+                        m_udp_write_buffers,
+                        m_udp_remote_endpoint,
+                        boost::bind(&ClientConnection::handle_udp_write_device_data_frame_complete, this, _1));
                 }
             }
             else
@@ -310,32 +481,53 @@ private:
     int m_connection_id;
 
     ServerRequestHandler &m_request_handler_ref;
-    tcp::socket m_tcp_socket;
-    udp::socket &m_udp_socket_ref;
-    udp::endpoint m_udp_remote_endpoint;
+    t_request_socket m_tcp_socket;
+    t_data_frame_socket &m_udp_socket_ref;
+    t_data_frame_endpoint m_udp_remote_endpoint;
+    bool m_is_local_connection;
     bool m_is_udp_remote_endpoint_bound;
+    bool m_supports_batched_data_frames;
 
     vector<uint8_t> m_request_read_buffer;
     PackedMessage<PSMoveProtocol::Request> m_packed_request;
 
-    vector<uint8_t> m_response_write_buffer;
+    // One packed response per slot of the batch being written.
+    // The buffers keep their capacity, so after warming up packing doesn't allocate.
+    vector<uint8_t> m_response_write_buffers[k_max_batched_responses];
+    vector<asio::const_buffer> m_tcp_write_buffers;
     PackedMessage<PSMoveProtocol::Response> m_packed_response;
 
-    uint8_t m_output_dataframe_buffer[HEADER_SIZE+MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE];
-    PackedMessage<PSMoveProtocol::DeviceOutputDataFrame> m_packed_output_dataframe;
-
-    deque<ResponsePtr> m_pending_responses;
-    deque<DeviceOutputDataFramePtr> m_pending_dataframes;
+    // Responses waiting to be sent, one queue per eResponsePriority
+    deque<ResponsePtr> m_pending_responses[k_response_priority_count];
+
+    // Fixed ring of serialized data frames waiting to be sent
+    DeviceOutputDataFramePacket m_pending_dataframes[k_max_pending_data_frames];
+    int m_pending_dataframe_head;
+    int m_pending_dataframe_count;
+    long long m_dropped_dataframe_count;
+
+    // Send rates, counted when a datagram finishes sending
+    ServerRateCounter m_udp_datagram_rate;
+    ServerRateCounter m_udp_dataframe_rate;
+
+    // Gather list for the datagram currently being sent.
+    // Capacity is reserved up front so building a batch never allocates.
+    vector<asio::const_buffer> m_udp_write_buffers;
+    int m_pending_udp_write_frame_count;
+    // When the pending datagram got handed to the socket, for the ServerMetric_UDPSendTime histogram
+    long long m_udp_write_start_us;
     
     bool m_connection_started;
     bool m_connection_stopped;
     bool m_has_pending_tcp_write;
     bool m_has_pending_udp_write;
+    bool m_is_in_dirty_queue;
 
     ClientConnection(
         IServerNetworkEventListener *network_event_listener,
         asio::io_service& io_service_ref,
-        udp::socket& udp_socket_ref , 
+        t_data_frame_socket& udp_socket_ref , 
+        bool is_local_connection,
         ServerRequestHandler &request_handler_ref)
         : m_network_event_listener(network_event_listener)
         , m_connection_id(next_connection_id)
@@ -343,23 +535,53 @@ private:
         , m_tcp_socket(io_service_ref)
         , m_udp_socket_ref(udp_socket_ref)
         , m_udp_remote_endpoint()
+        , m_is_local_connection(is_local_connection)
         , m_is_udp_remote_endpoint_bound(false)
+        , m_supports_batched_data_frames(false)
         , m_request_read_buffer()
         , m_packed_request(std::shared_ptr<PSMoveProtocol::Request>(new PSMoveProtocol::Request()))
-        , m_response_write_buffer()
+        , m_tcp_write_buffers()
         , m_packed_response()
-        , m_packed_output_dataframe()
-        , m_pending_responses()
-        , m_pending_dataframes()
+        , m_pending_dataframe_head(0)
+        , m_pending_dataframe_count(0)
+        , m_dropped_dataframe_count(0)
+        , m_udp_datagram_rate()
+        , m_udp_dataframe_rate()
+        , m_udp_write_buffers()
+        , m_pending_udp_write_frame_count(0)
+        , m_udp_write_start_us(0)
         , m_connection_started(false)
         , m_connection_stopped(false)
         , m_has_pending_tcp_write(false)
         , m_has_pending_udp_write(false)
+        , m_is_in_dirty_queue(false)
     {
-        memset(m_output_dataframe_buffer, 0, sizeof(m_output_dataframe_buffer));
+        m_udp_write_buffers.reserve(k_max_pending_data_frames);
+        m_tcp_write_buffers.reserve(k_max_batched_responses);
         next_connection_id++;
     }
 
+    // Bulk results can lag a bit behind, everything else is something a client is actively waiting on
+    static eResponsePriority get_response_priority(const ResponsePtr &response)
+    {
+        switch (response->type())
+        {
+        case PSMoveProtocol::Response_ResponseType_CONTROLLER_LIST:
+        case PSMoveProtocol::Response_ResponseType_TRACKER_LIST:
+        case PSMoveProtocol::Response_ResponseType_TRACKER_SETTINGS:
+        case PSMoveProtocol::Response_ResponseType_TRACKING_SPACE_SETTINGS:
+        case PSMoveProtocol::Response_ResponseType_HMD_LIST:
+        case PSMoveProtocol::Response_ResponseType_SERVICE_VERSION:
+        case PSMoveProtocol::Response_ResponseType_USB_DEVICE_STATISTICS:
+        case PSMoveProtocol::Response_ResponseType_TRACE_EVENTS:
+        case PSMoveProtocol::Response_ResponseType_SERVICE_STATS:
+        case PSMoveProtocol::Response_ResponseType_TRACKER_VIDEO_FRAME:
+            return k_response_priority_normal;
+        default:
+            return k_response_priority_urgent;
+        }
+    }
+
     void send_connection_info()
     {
         SERVER_LOG_INFO("ClientConnection::send_connection_info") 
@@ -502,10 +724,7 @@ private:
             // no longer is there a pending write
             m_has_pending_tcp_write= false;
 
-            // Remove the response from the pending send queue now that it's sent
-            m_pending_responses.pop_front();
-
-            // If there are more requests waiting to be sent, start sending the next one
+            // If there are more responses waiting to be sent, start sending the next batch
             start_tcp_write_queued_response();
         }
         else
@@ -528,9 +747,15 @@ private:
 
             // no longer is there a pending write
             m_has_pending_udp_write= false;
-
-            // Remove the dataframe from the pending send queue now that it's sent
-            m_pending_dataframes.pop_front();
+            ServerMetrics::record(ServerMetric_UDPSendTime, 0, ServerUtility::get_service_time_us() - m_udp_write_start_us);
+
+            // Remove the sent dataframes from the pending send queue
+            m_pending_dataframe_head= 
+                (m_pending_dataframe_head + m_pending_udp_write_frame_count) % k_max_pending_data_frames;
+            m_pending_dataframe_count-= m_pending_udp_write_frame_count;
+            m_udp_datagram_rate.addEvents();
+            m_udp_dataframe_rate.addEvents(m_pending_udp_write_frame_count);
+            m_pending_udp_write_frame_count= 0;
         }
         else
         {
@@ -543,6 +768,158 @@ private:
 };
 int ClientConnection::next_connection_id = 0;
 
+// -MulticastPoseStream-
+/**
+ * Collects the pose frames devices publish during an update and multicasts them
+ * as a single snapshot datagram (see CompactMulticastSnapshotHeader) once the update is done.
+ * Sends never block the service loop: a snapshot the socket can't take right away is dropped,
+ * which receivers see as a gap in the sequence numbers.
+ */
+class MulticastPoseStream
+{
+public:
+    MulticastPoseStream(asio::io_service &io_service)
+        : m_socket(io_service)
+        , m_endpoint()
+        , m_is_open(false)
+        , m_sequence_num(0)
+        , m_controller_frame_count(0)
+        , m_hmd_frame_count(0)
+    {
+    }
+
+    bool open(const NetworkManagerConfig &cfg)
+    {
+        boost::system::error_code error;
+        const asio::ip::address address= asio::ip::address::from_string(cfg.multicast_pose_stream_address, error);
+
+        if (!error && !address.is_multicast())
+        {
+            error= asio::error::invalid_argument;
+        }
+
+        if (!error)
+        {
+            m_endpoint= udp::endpoint(address, static_cast<unsigned short>(cfg.multicast_pose_stream_port));
+            m_socket.open(m_endpoint.protocol(), error);
+        }
+
+        if (!error)
+        {
+            m_socket.set_option(asio::ip::multicast::hops(cfg.multicast_pose_stream_ttl), error);
+        }
+
+        if (!error)
+        {
+            m_socket.non_blocking(true, error);
+        }
+
+        if (!error)
+        {
+            SERVER_LOG_INFO("MulticastPoseStream::open") << "Multicasting pose snapshots to " 
+                << cfg.multicast_pose_stream_address << ":" << cfg.multicast_pose_stream_port;
+            m_is_open= true;
+        }
+        else
+        {
+            SERVER_LOG_ERROR("MulticastPoseStream::open") << "Can't multicast pose snapshots to " 
+                << cfg.multicast_pose_stream_address << ":" << cfg.multicast_pose_stream_port << ": " << error.message();
+            close();
+        }
+
+        return m_is_open;
+    }
+
+    void close()
+    {
+        if (m_socket.is_open())
+        {
+            boost::system::error_code error;
+            m_socket.close(error);
+        }
+
+        m_is_open= false;
+        m_controller_frame_count= 0;
+        m_hmd_frame_count= 0;
+    }
+
+    inline bool get_is_open() const
+    {
+        return m_is_open;
+    }
+
+    void add_controller_pose(const CompactControllerPoseFrame &pose_frame)
+    {
+        if (m_is_open && m_controller_frame_count < PSMOVESERVICE_MAX_CONTROLLER_COUNT)
+        {
+            m_controller_frames[m_controller_frame_count]= pose_frame;
+            ++m_controller_frame_count;
+        }
+    }
+
+    void add_hmd_pose(const CompactHMDPoseFrame &pose_frame)
+    {
+        if (m_is_open && m_hmd_frame_count < PSMOVESERVICE_MAX_HMD_COUNT)
+        {
+            m_hmd_frames[m_hmd_frame_count]= pose_frame;
+            ++m_hmd_frame_count;
+        }
+    }
+
+    // Sends everything added since the last call, if anything
+    void send_snapshot()
+    {
+        if (!m_is_open || (m_controller_frame_count == 0 && m_hmd_frame_count == 0))
+        {
+            return;
+        }
+
+        CompactMulticastSnapshotHeader header;
+        header.marker= COMPACT_DATA_FRAME_MARKER;
+        header.version= COMPACT_DATA_FRAME_VERSION;
+        header.controller_frame_count= static_cast<uint8_t>(m_controller_frame_count);
+        header.hmd_frame_count= static_cast<uint8_t>(m_hmd_frame_count);
+        header.sequence_num= m_sequence_num;
+        header.service_time_us= ServerUtility::get_service_time_us();
+
+        // Dropped snapshots use up their sequence number too
+        ++m_sequence_num;
+
+        const boost::array<asio::const_buffer, 3> buffers = {{
+            asio::buffer(&header, sizeof(header)),
+            asio::buffer(m_controller_frames, m_controller_frame_count*sizeof(CompactControllerPoseFrame)),
+            asio::buffer(m_hmd_frames, m_hmd_frame_count*sizeof(CompactHMDPoseFrame))
+        }};
+
+        boost::system::error_code error;
+        m_socket.send_to(buffers, m_endpoint, 0, error);
+
+        if (error == asio::error::would_block)
+        {
+            SERVER_LOG_TRACE("MulticastPoseStream::send_snapshot") << "Socket busy, dropped snapshot " << header.sequence_num;
+        }
+        else if (error)
+        {
+            SERVER_LOG_ERROR("MulticastPoseStream::send_snapshot") << "Failed to send snapshot: " << error.message();
+        }
+
+        m_controller_frame_count= 0;
+        m_hmd_frame_count= 0;
+    }
+
+private:
+    udp::socket m_socket;
+    udp::endpoint m_endpoint;
+    bool m_is_open;
+    uint32_t m_sequence_num;
+
+    // Pose frames published during the current update
+    CompactControllerPoseFrame m_controller_frames[PSMOVESERVICE_MAX_CONTROLLER_COUNT];
+    int m_controller_frame_count;
+    CompactHMDPoseFrame m_hmd_frames[PSMOVESERVICE_MAX_HMD_COUNT];
+    int m_hmd_frame_count;
+};
+
 // -NetworkManagerImpl-
 /// Internal implementation of the network manager.
 class ServerNetworkManagerImpl : public IServerNetworkEventListener
@@ -552,14 +929,30 @@ public:
         : m_request_handler_ref(requestHandler)
         , m_io_service(io_service)
         , m_tcp_acceptor(m_io_service, tcp::endpoint(tcp::v4(), cfg.server_port))
-        , m_udp_socket(m_io_service, udp::endpoint(udp::v4(), cfg.server_port))
-        , m_udp_connecting_remote_endpoint()
+        , m_udp_data_frame_socket(m_io_service, false)
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+        , m_local_acceptor(m_io_service)
+#endif
+        , m_local_data_frame_socket(m_io_service, true)
+        , m_local_socket_path()
         , m_packed_input_dataframe(std::shared_ptr<PSMoveProtocol::DeviceInputDataFrame>(new PSMoveProtocol::DeviceInputDataFrame()))
-        , m_udp_connection_result_write_buffer(false)
-        , m_has_pending_udp_read(false)
         , m_connections()
+        , m_dirty_connections()
+        , m_udp_write_connection()
+        , m_multicast_pose_stream(io_service)
     {
-        memset(m_input_dataframe_buffer, 0, sizeof(m_input_dataframe_buffer));
+        m_udp_data_frame_socket.socket.open(udp::v4());
+        m_udp_data_frame_socket.socket.bind(udp::endpoint(udp::v4(), cfg.server_port));
+
+        if (cfg.local_socket_enabled)
+        {
+            open_local_sockets(cfg.local_socket_path);
+        }
+
+        if (cfg.multicast_pose_stream_enabled)
+        {
+            m_multicast_pose_stream.open(cfg);
+        }
     }
 
     virtual ~ServerNetworkManagerImpl()
@@ -575,31 +968,19 @@ public:
     /// Called during PSMoveService::startup()
     void start_connection_accept()
     {
-        SERVER_LOG_DEBUG("ServerNetworkManager::start_tcp_accept") << "Start waiting for a new TCP connection";
-        
-        // Create a new connection to handle a client.
-        // Passing a reference to a request handler to each connection poses no problem 
-        // since the server is single-threaded.
-        ClientConnectionPtr new_connection = 
-            ClientConnection::create(
-                this, 
-                m_tcp_acceptor.get_io_service(), 
-                m_udp_socket, 
-                m_request_handler_ref);
-
-        // Add the connection to the list
-        t_id_client_connection_pair map_entry(new_connection->get_connection_id(), new_connection);
-        m_connections.insert(map_entry);
-
-        // Asynchronously wait to accept a new tcp client
-        m_tcp_acceptor.async_accept(
-            new_connection->get_tcp_socket(),
-            boost::bind(&ServerNetworkManagerImpl::handle_tcp_accept, this, new_connection, asio::placeholders::error));
+        start_tcp_accept();
 
-        
         // Asynchronously wait to accept a new udp clients
         // These should always come after a tcp connection is accepted
-        start_udp_read_input_data_frame();
+        start_udp_read_input_data_frame(&m_udp_data_frame_socket);
+
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+        if (m_local_acceptor.is_open())
+        {
+            start_local_accept();
+            start_udp_read_input_data_frame(&m_local_data_frame_socket);
+        }
+#endif
     }
 
     void poll()
@@ -608,6 +989,9 @@ public:
         int iteration_count= 0;
         const static int k_max_iteration_count= 32;
 
+        // Every device has published by now, so this is the whole snapshot for this update
+        m_multicast_pose_stream.send_snapshot();
+
         while (keep_polling && iteration_count < k_max_iteration_count)
         {
             // Start any pending writes on the UDP socket that can be started
@@ -632,6 +1016,8 @@ public:
     {
         SERVER_LOG_DEBUG("ServerNetworkManager::close_all_connections") << "Stopping all client connections";
 
+        m_multicast_pose_stream.close();
+
         // Stop all of the TCP connections
         while (m_connections.size() > 0)
         {
@@ -643,23 +1029,14 @@ public:
             clientConnection->stop();
         }
 
+        m_dirty_connections.clear();
+        m_udp_write_connection.reset();
+
         // Close down the UDP connection
-        if (m_udp_socket.is_open())
-        {
-            boost::system::error_code error;
+        close_data_frame_socket(m_udp_data_frame_socket);
 
-            m_udp_socket.shutdown(asio::socket_base::shutdown_both, error);
-            if (error)
-            {
-                SERVER_LOG_ERROR("ServerNetworkManager::close_all_connections") << "Problem shutting down the udp socket: " << error.message();
-            }
-
-            m_udp_socket.close(error);
-            if (error)
-            {
-                SERVER_LOG_ERROR("ServerNetworkManager::close_all_connections") << "Problem closing the udp socket: " << error.message();
-            }
-        }
+        // ... and the unix domain sockets, along with their socket files
+        close_local_sockets();
 
         m_connections.clear();
     }
@@ -690,6 +1067,13 @@ public:
         }
     }
 
+    bool has_queued_responses(int connection_id) const
+    {
+        t_client_connection_map_const_iter entry = m_connections.find(connection_id);
+
+        return entry != m_connections.end() && entry->second->has_queued_responses();
+    }
+
     void send_notification_to_all_clients(ResponsePtr response)
     {
         SERVER_LOG_DEBUG("ServerNetworkManager::send_notification") 
@@ -710,7 +1094,7 @@ public:
         }
     }
 
-    void send_device_data_frame(int connection_id, DeviceOutputDataFramePtr data_frame)
+    void send_device_data_frame(int connection_id, const DeviceOutputDataFramePacket &packet)
     {
         t_client_connection_map_iter entry = m_connections.find(connection_id);
 
@@ -721,9 +1105,10 @@ public:
             SERVER_LOG_TRACE("ServerNetworkManager::send_device_data_frame") 
                 << "Sending data_frame to connection " << connection_id;
 
-            connection->add_device_data_frame_to_write_queue(data_frame);
-
-            start_udp_queued_data_frame_write();
+            // Don't start the write yet. poll() runs right after all devices have published,
+            // so everything queued this update goes out together in as few datagrams as possible.
+            connection->add_device_data_frame_to_write_queue(packet);
+            add_dirty_connection(connection);
         }
         else
         {
@@ -732,6 +1117,25 @@ public:
         }
     }
 
+    void gather_connection_statistics(PSMoveProtocol::Response_ResultServiceStats *stats) const
+    {
+        for (t_client_connection_map::const_iterator iter= m_connections.begin(); iter != m_connections.end(); ++iter)
+        {
+            ClientConnectionPtr connection= iter->second;
+
+            // Skip the connection that is just waiting on the next accept
+            if (connection->get_is_started())
+            {
+                connection->gather_statistics(stats->add_connection_entries());
+            }
+        }
+    }
+
+    inline MulticastPoseStream &get_multicast_pose_stream()
+    {
+        return m_multicast_pose_stream;
+    }
+
     // -- IServerNetworkEventListener ----
 	virtual void handle_client_connection_stopped(int connection_id) override
     {
@@ -756,33 +1160,216 @@ private:
     // Handles waiting for and accepting new TCP connections
     tcp::acceptor m_tcp_acceptor;
 
+    // A socket the client connections send their data frames from (and receive client data frames on)
+    struct DataFrameSocket
+    {
+        DataFrameSocket(asio::io_service &io_service, bool bIsLocal)
+            : socket(io_service)
+            , connecting_remote_endpoint()
+            , connection_result_write_buffer(false)
+            , has_pending_read(false)
+            , is_local(bIsLocal)
+        {
+            memset(input_dataframe_buffer, 0, sizeof(input_dataframe_buffer));
+        }
+
+        t_data_frame_socket socket;
+
+        // The endpoint of the next connecting 
+        t_data_frame_endpoint connecting_remote_endpoint;
+
+        // A pending udp request from the client
+        uint8_t input_dataframe_buffer[HEADER_SIZE + MAX_INPUT_DATA_FRAME_MESSAGE_SIZE];
+
+        // A pending udp result sent to the client
+        bool connection_result_write_buffer;
+
+        // If true, we are already waiting for a client to send the connection id
+        bool has_pending_read;
+
+        // Serves the connections accepted on the unix domain socket
+        bool is_local;
+    };
+
     // UDP socket shared amongst all of the client connections
-    udp::socket m_udp_socket;
+    DataFrameSocket m_udp_data_frame_socket;
 
-    // The endpoint of the next connecting 
-    udp::endpoint m_udp_connecting_remote_endpoint;
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+    // Accepts clients on the same machine over a unix domain socket, if enabled
+    asio::local::stream_protocol::acceptor m_local_acceptor;
+#endif
 
-    // A pending udp request from the client
-    uint8_t m_input_dataframe_buffer[HEADER_SIZE + MAX_INPUT_DATA_FRAME_MESSAGE_SIZE];
-    PackedMessage<PSMoveProtocol::DeviceInputDataFrame> m_packed_input_dataframe;
+    // Unix datagram socket shared amongst all of the local client connections
+    DataFrameSocket m_local_data_frame_socket;
 
-    // A pending udp result sent to the client
-    bool m_udp_connection_result_write_buffer;
+    // Path of the local request socket (the datagram socket is next to it), empty unless the socket files exist
+    std::string m_local_socket_path;
 
-    // If true, we are already waiting for a client to send the connection id
-    bool m_has_pending_udp_read;
+    // Parses the data frames coming in on either socket
+    PackedMessage<PSMoveProtocol::DeviceInputDataFrame> m_packed_input_dataframe;
 
     // A mapping from connection_id -> ClientConnectionPtr
     t_client_connection_map m_connections;
 
+    // Connections with data frames queued, in the order they got them.
+    // Starting UDP writes only ever visits these, so idle connections cost nothing per update.
+    deque<ClientConnectionPtr> m_dirty_connections;
+
+    // The connection whose datagram is in flight on the shared UDP socket (if any).
+    // Holding on to it also keeps it alive until its write callback has run.
+    ClientConnectionPtr m_udp_write_connection;
+
+    // Optional LAN multicast of the pose snapshot, shared by every listener on the group
+    MulticastPoseStream m_multicast_pose_stream;
+
 protected:
+    void open_local_sockets(const std::string &local_socket_path)
+    {
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+        const std::string data_frame_socket_path= local_socket_path + PSMOVESERVICE_LOCAL_DATA_FRAME_SOCKET_SUFFIX;
+        boost::system::error_code error;
+
+        // The TCP port is already ours, so any socket files left behind are from a service that didn't shut down cleanly
+        std::remove(local_socket_path.c_str());
+        std::remove(data_frame_socket_path.c_str());
+        m_local_socket_path= local_socket_path;
+
+        m_local_acceptor.open(asio::local::stream_protocol(), error);
+        if (!error)
+        {
+            m_local_acceptor.bind(asio::local::stream_protocol::endpoint(local_socket_path), error);
+        }
+        if (!error)
+        {
+            m_local_acceptor.listen(asio::socket_base::max_connections, error);
+        }
+        if (!error)
+        {
+            m_local_data_frame_socket.socket.open(asio::local::datagram_protocol(), error);
+        }
+        if (!error)
+        {
+            m_local_data_frame_socket.socket.bind(asio::local::datagram_protocol::endpoint(data_frame_socket_path), error);
+        }
+
+        if (!error)
+        {
+            SERVER_LOG_INFO("ServerNetworkManager::open_local_sockets") << "Accepting local clients on " << local_socket_path;
+        }
+        else
+        {
+            SERVER_LOG_WARNING("ServerNetworkManager::open_local_sockets") 
+                << "Unable to open the local socket " << local_socket_path << ": " << error.message()
+                << ". Local clients will have to connect over TCP.";
+
+            close_local_sockets();
+        }
+#else
+        SERVER_LOG_INFO("ServerNetworkManager::open_local_sockets") 
+            << "No unix domain sockets on this platform, local clients connect over TCP";
+#endif
+    }
+
+    void close_local_sockets()
+    {
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+        if (m_local_acceptor.is_open())
+        {
+            boost::system::error_code error;
+
+            m_local_acceptor.close(error);
+            if (error)
+            {
+                SERVER_LOG_ERROR("ServerNetworkManager::close_local_sockets") << "Problem closing the local acceptor: " << error.message();
+            }
+        }
+#endif
+
+        close_data_frame_socket(m_local_data_frame_socket);
+
+        if (!m_local_socket_path.empty())
+        {
+            std::remove(m_local_socket_path.c_str());
+            std::remove((m_local_socket_path + PSMOVESERVICE_LOCAL_DATA_FRAME_SOCKET_SUFFIX).c_str());
+            m_local_socket_path.clear();
+        }
+    }
+
+    void close_data_frame_socket(DataFrameSocket &data_frame_socket)
+    {
+        if (data_frame_socket.socket.is_open())
+        {
+            boost::system::error_code error;
+
+            data_frame_socket.socket.shutdown(asio::socket_base::shutdown_both, error);
+            if (error)
+            {
+                SERVER_LOG_ERROR("ServerNetworkManager::close_data_frame_socket") << "Problem shutting down the udp socket: " << error.message();
+            }
+
+            data_frame_socket.socket.close(error);
+            if (error)
+            {
+                SERVER_LOG_ERROR("ServerNetworkManager::close_data_frame_socket") << "Problem closing the udp socket: " << error.message();
+            }
+        }
+    }
+
+    // Create a new connection to handle a client.
+    // Passing a reference to a request handler to each connection poses no problem 
+    // since the server is single-threaded.
+    ClientConnectionPtr create_pending_connection(DataFrameSocket &data_frame_socket)
+    {
+        ClientConnectionPtr new_connection = 
+            ClientConnection::create(
+                this, 
+                m_io_service, 
+                data_frame_socket.socket, 
+                data_frame_socket.is_local,
+                m_request_handler_ref);
+
+        // Add the connection to the list
+        t_id_client_connection_pair map_entry(new_connection->get_connection_id(), new_connection);
+        m_connections.insert(map_entry);
+
+        return new_connection;
+    }
+
+    void start_tcp_accept()
+    {
+        SERVER_LOG_DEBUG("ServerNetworkManager::start_tcp_accept") << "Start waiting for a new TCP connection";
+
+        ClientConnectionPtr new_connection = create_pending_connection(m_udp_data_frame_socket);
+
+        // Asynchronously wait to accept a new tcp client
+        m_tcp_acceptor.async_accept(
+            new_connection->get_tcp_socket(),
+            boost::bind(&ServerNetworkManagerImpl::handle_tcp_accept, this, new_connection, asio::placeholders::error));
+    }
+
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+    void start_local_accept()
+    {
+        SERVER_LOG_DEBUG("ServerNetworkManager::start_local_accept") << "Start waiting for a new local connection";
+
+        ClientConnectionPtr new_connection = create_pending_connection(m_local_data_frame_socket);
+
+        m_local_acceptor.async_accept(
+            new_connection->get_tcp_socket(),
+            boost::bind(&ServerNetworkManagerImpl::handle_tcp_accept, this, new_connection, asio::placeholders::error));
+    }
+#endif
+
     void handle_tcp_accept(ClientConnectionPtr connection, const boost::system::error_code& error)
     {        
+        const bool bIsLocalConnection= connection->get_is_local_connection();
+
         // A new client has connected
         //
         if (!error)
         {
-            SERVER_LOG_DEBUG("ServerNetworkManager::handle_tcp_accept") << "Accepting a new connection";
+            SERVER_LOG_DEBUG("ServerNetworkManager::handle_tcp_accept") 
+                << "Accepting a new " << (bIsLocalConnection ? "local" : "TCP") << " connection";
             
             // Start the connection
             connection->start();
@@ -794,37 +1381,58 @@ protected:
 
             // Stop the failed connection
             connection->stop();
+
+            // The acceptor got closed by close_all_connections()
+            if (error == asio::error::operation_aborted)
+            {
+                return;
+            }
         }
 
         // Accept another client
-        start_connection_accept();
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+        if (bIsLocalConnection)
+        {
+            start_local_accept();
+        }
+        else
+#endif
+        {
+            start_tcp_accept();
+        }
     }
 
-    void start_udp_read_input_data_frame()
+    void start_udp_read_input_data_frame(DataFrameSocket *data_frame_socket)
     {
-        if (!m_has_pending_udp_read)
+        if (!data_frame_socket->has_pending_read && data_frame_socket->socket.is_open())
         {
             SERVER_LOG_DEBUG("ServerNetworkManager::start_udp_receive_connection_id") << "waiting for UDP input dataframe";
 
-            m_has_pending_udp_read = true;
-            m_udp_socket.async_receive_from(
-                asio::buffer(m_input_dataframe_buffer, sizeof(m_input_dataframe_buffer)),
-                m_udp_connecting_remote_endpoint,
+            data_frame_socket->has_pending_read = true;
+            data_frame_socket->socket.async_receive_from(
+                asio::buffer(data_frame_socket->input_dataframe_buffer, sizeof(data_frame_socket->input_dataframe_buffer)),
+                data_frame_socket->connecting_remote_endpoint,
                 boost::bind(
                     &ServerNetworkManagerImpl::handle_udp_read_data_frame,
                     this,
+                    data_frame_socket,
                     asio::placeholders::error));
         }
     }
 
-    void handle_udp_read_data_frame(const boost::system::error_code& error)
+    void handle_udp_read_data_frame(DataFrameSocket *data_frame_socket, const boost::system::error_code& error)
     {
-        m_has_pending_udp_read= false;
+        data_frame_socket->has_pending_read= false;
 
         if (!error) 
         {
             // Parse the incoming data frame
-            handle_udp_data_frame_received();
+            handle_udp_data_frame_received(data_frame_socket);
+        }
+        else if (error == asio::error::operation_aborted)
+        {
+            // The socket got closed by close_all_connections()
+            return;
         }
         else
         {
@@ -833,32 +1441,41 @@ protected:
         }
 
         // Start reading the next incoming data frame
-        start_udp_read_input_data_frame();
+        start_udp_read_input_data_frame(data_frame_socket);
     }
 
-    // Called when enough data was read into m_data_frame_read_buffer for a complete data frame message. 
+    // Called when enough data was read into the socket's input_dataframe_buffer for a complete data frame message. 
     // Parse the data_frame and forward it on to the response handler.
-    void handle_udp_data_frame_received()
+    void handle_udp_data_frame_received(DataFrameSocket *data_frame_socket)
     {
         // No longer is there a pending read
-        m_has_pending_udp_read = false;
+        data_frame_socket->has_pending_read = false;
 
         SERVER_LOG_DEBUG("ClientNetworkManager::handle_udp_data_frame_received") << "Parsing DataFrame";
 
+        const uint8_t *input_dataframe_buffer= data_frame_socket->input_dataframe_buffer;
+
         // TODO: Switch on data frame type to choose which m_packed_data_frame_X to use.
-        unsigned msg_len = m_packed_input_dataframe.decode_header(m_input_dataframe_buffer, sizeof(m_input_dataframe_buffer));
+        unsigned msg_len = m_packed_input_dataframe.decode_header(input_dataframe_buffer, sizeof(data_frame_socket->input_dataframe_buffer));
         unsigned total_len = HEADER_SIZE + msg_len;
-        SERVER_LOG_DEBUG("    ") << show_hex(m_input_dataframe_buffer, total_len);
+        SERVER_LOG_DEBUG("    ") << show_hex(input_dataframe_buffer, total_len);
         SERVER_LOG_DEBUG("    ") << msg_len << " bytes";
 
         // Parse the response buffer
-        if (m_packed_input_dataframe.unpack(m_input_dataframe_buffer, total_len))
+        if (m_packed_input_dataframe.unpack(input_dataframe_buffer, total_len))
         {
             DeviceInputDataFramePtr data_frame = m_packed_input_dataframe.get_msg();
 
             // Find the connection with the matching id
             t_client_connection_map_iter iter = m_connections.find(data_frame->connection_id());
 
+            // A connection only takes data frames over the socket type it connected with
+            if (iter != m_connections.end() && 
+                iter->second->get_is_local_connection() != data_frame_socket->is_local)
+            {
+                iter = m_connections.end();
+            }
+
             if (iter != m_connections.end())
             {
                 SERVER_LOG_DEBUG("ServerNetworkManager::handle_udp_data_frame_received")
@@ -870,10 +1487,11 @@ protected:
                 if (!connection->is_udp_remote_endpoint_bound())
                 {
                     // Associate this udp remote endpoint with the given connection id
-                    connection->bind_udp_remote_endpoint(m_udp_connecting_remote_endpoint);
+                    connection->bind_udp_remote_endpoint(
+                        data_frame_socket->connecting_remote_endpoint, data_frame->supports_batched_data_frames());
 
                     // Tell the client that this was a valid connection id
-                    start_udp_send_connection_result(true);
+                    start_udp_send_connection_result(data_frame_socket, true);
                 }
 
                 // Process the incoming data frame
@@ -888,25 +1506,25 @@ protected:
                 {
                     // If the device category was invalid, then this must have been an initial dataframe sent at device connection
                     // Tell the client that this was an invalid connection id
-                    start_udp_send_connection_result(false);
+                    start_udp_send_connection_result(data_frame_socket, false);
                 }
             }
         }
     }
 
-    void start_udp_send_connection_result(bool success)
+    void start_udp_send_connection_result(DataFrameSocket *data_frame_socket, bool success)
     {
         SERVER_LOG_DEBUG("ServerNetworkManager::start_udp_send_connection_result") 
             << "Send result: " << success;
 
-        m_udp_connection_result_write_buffer= success;
-        m_udp_socket.async_send_to(
-            boost::asio::buffer(&m_udp_connection_result_write_buffer, sizeof(m_udp_connection_result_write_buffer)), 
-            m_udp_connecting_remote_endpoint,
-            boost::bind(&ServerNetworkManagerImpl::handle_udp_write_connection_result, this, boost::asio::placeholders::error));
+        data_frame_socket->connection_result_write_buffer= success;
+        data_frame_socket->socket.async_send_to(
+            boost::asio::buffer(&data_frame_socket->connection_result_write_buffer, sizeof(data_frame_socket->connection_result_write_buffer)), 
+            data_frame_socket->connecting_remote_endpoint,
+            boost::bind(&ServerNetworkManagerImpl::handle_udp_write_connection_result, this, data_frame_socket, boost::asio::placeholders::error));
     }
 
-    void handle_udp_write_connection_result(const boost::system::error_code& error)
+    void handle_udp_write_connection_result(DataFrameSocket *data_frame_socket, const boost::system::error_code& error)
     {
         if (error) 
         {
@@ -915,50 +1533,75 @@ protected:
         }
 
         // Start waiting for the next connection result
-        start_udp_read_input_data_frame();
+        start_udp_read_input_data_frame(data_frame_socket);
+    }
+
+    void add_dirty_connection(ClientConnectionPtr connection)
+    {
+        if (!connection->get_is_in_dirty_queue())
+        {
+            connection->set_is_in_dirty_queue(true);
+            m_dirty_connections.push_back(connection);
+        }
     }
 
     void start_udp_queued_data_frame_write()
     {
-        for (t_client_connection_map_iter iter= m_connections.begin(); iter != m_connections.end(); ++iter)
+        if (m_udp_write_connection)
         {
-            ClientConnectionPtr connection= iter->second;
+            // Don't start a write on any other connection until this one is finished 
+            if (m_udp_write_connection->has_pending_udp_write())
+            {
+                return;
+            }
+
+            // Anything it still has queued waits behind the other dirty connections
+            ClientConnectionPtr finished_connection= m_udp_write_connection;
+
+            m_udp_write_connection.reset();
+            finished_connection->set_is_in_dirty_queue(false);
+            if (finished_connection->has_queued_controller_data_frames())
+            {
+                add_dirty_connection(finished_connection);
+            }
+        }
+
+        while (!m_dirty_connections.empty())
+        {
+            ClientConnectionPtr connection= m_dirty_connections.front();
+            m_dirty_connections.pop_front();
 
             if (connection->start_udp_write_queued_device_data_frame())
             {
                 SERVER_LOG_TRACE("ServerNetworkManager::start_udp_queued_data_frame_write") 
-                    << "Send queued UDP data on connection id: " << iter->first;
+                    << "Send queued UDP data on connection id: " << connection->get_connection_id();
 
-                // Don't start a write on any other connection until this one is finished 
+                // Stays flagged as dirty until its write completes
+                m_udp_write_connection= connection;
                 break;
             }
-        }        
+
+            // Nothing left to send, or the connection went away
+            connection->set_is_in_dirty_queue(false);
+        }
     }
 
     bool has_queued_controller_data_frames_ready_to_start()
     {
-        bool has_queued_write_ready_to_start= false;
-        bool udp_socket_available= true;
+        bool has_queued_write_ready_to_start= !m_dirty_connections.empty();
 
-        for (t_client_connection_map_iter iter= m_connections.begin(); iter != m_connections.end(); ++iter)
+        if (m_udp_write_connection)
         {
-            ClientConnectionPtr connection= iter->second;
-
-            if (connection->has_pending_udp_write())
+            // Can't start any new udp write until any current udp write is done
+            if (m_udp_write_connection->has_pending_udp_write())
             {
-                // Can't start any new udp write until any current udp write is done
-                udp_socket_available= false;
-                break;
+                return false;
             }
 
-            if (connection->has_queued_controller_data_frames())
-            {
-                // Found a connection with a pending udp write ready to go
-                has_queued_write_ready_to_start= true;
-            }
+            has_queued_write_ready_to_start|= m_udp_write_connection->has_queued_controller_data_frames();
         }
 
-        return udp_socket_available && has_queued_write_ready_to_start;
+        return has_queued_write_ready_to_start;
     }
 };
 
@@ -1027,6 +1670,11 @@ void ServerNetworkManager::send_notification(int connection_id, ResponsePtr resp
 	}
 }
 
+bool ServerNetworkManager::has_queued_responses(int connection_id) const
+{
+    return implementation_ptr != nullptr && implementation_ptr->has_queued_responses(connection_id);
+}
+
 void ServerNetworkManager::send_notification_to_all_clients(ResponsePtr response)
 {
 	if (implementation_ptr != nullptr)
@@ -1035,10 +1683,90 @@ void ServerNetworkManager::send_notification_to_all_clients(ResponsePtr response
 	}
 }
 
-void ServerNetworkManager::send_device_data_frame(int connection_id, DeviceOutputDataFramePtr data_frame)
+void ServerNetworkManager::gather_connection_statistics(PSMoveProtocol::Response_ResultServiceStats *stats) const
+{
+	if (implementation_ptr != nullptr)
+	{
+		implementation_ptr->gather_connection_statistics(stats);
+	}
+}
+
+bool ServerNetworkManager::get_is_multicast_pose_stream_enabled() const
+{
+    return implementation_ptr != nullptr && implementation_ptr->get_multicast_pose_stream().get_is_open();
+}
+
+void ServerNetworkManager::add_multicast_controller_pose(const CompactControllerPoseFrame &pose_frame)
+{
+	if (implementation_ptr != nullptr)
+	{
+		implementation_ptr->get_multicast_pose_stream().add_controller_pose(pose_frame);
+	}
+}
+
+void ServerNetworkManager::add_multicast_hmd_pose(const CompactHMDPoseFrame &pose_frame)
+{
+	if (implementation_ptr != nullptr)
+	{
+		implementation_ptr->get_multicast_pose_stream().add_hmd_pose(pose_frame);
+	}
+}
+
+bool ServerNetworkManager::pack_device_data_frame(
+    const PSMoveProtocol::DeviceOutputDataFrame *data_frame, 
+    DeviceOutputDataFramePacket &out_packet)
+{
+    const int msg_size= data_frame->ByteSize();
+    bool bSuccess= false;
+
+    if (HEADER_SIZE + msg_size <= DEVICE_OUTPUT_DATA_FRAME_PACKET_SIZE)
+    {
+        // Same big-endian length header PackedMessage writes
+        out_packet.buffer[0]= static_cast<unsigned char>((msg_size >> 24) & 0xFF);
+        out_packet.buffer[1]= static_cast<unsigned char>((msg_size >> 16) & 0xFF);
+        out_packet.buffer[2]= static_cast<unsigned char>((msg_size >> 8) & 0xFF);
+        out_packet.buffer[3]= static_cast<unsigned char>(msg_size & 0xFF);
+
+        bSuccess= (msg_size == 0) || data_frame->SerializeWithCachedSizesToArray(&out_packet.buffer[HEADER_SIZE]) != nullptr;
+        out_packet.size= bSuccess ? HEADER_SIZE + msg_size : 0;
+    }
+    else
+    {
+        SERVER_LOG_ERROR("ServerNetworkManager::pack_device_data_frame") 
+            << "DataFrame too big to fit in packet!";
+        out_packet.clear();
+    }
+
+    return bSuccess;
+}
+
+bool ServerNetworkManager::pack_compact_pose_frame(
+    const CompactControllerPoseFrame *pose_frame,
+    DeviceOutputDataFramePacket &out_packet)
+{
+    static_assert(sizeof(CompactControllerPoseFrame) <= DEVICE_OUTPUT_DATA_FRAME_PACKET_SIZE,
+        "Compact pose frame doesn't fit in a data frame packet");
+
+    memcpy(out_packet.buffer, pose_frame, sizeof(CompactControllerPoseFrame));
+    out_packet.size= sizeof(CompactControllerPoseFrame);
+
+    return true;
+}
+
+bool ServerNetworkManager::pack_compact_orientation_frame(
+    const CompactControllerOrientationFrame *orientation_frame,
+    DeviceOutputDataFramePacket &out_packet)
+{
+    memcpy(out_packet.buffer, orientation_frame, sizeof(CompactControllerOrientationFrame));
+    out_packet.size= sizeof(CompactControllerOrientationFrame);
+
+    return true;
+}
+
+void ServerNetworkManager::send_device_data_frame(int connection_id, const DeviceOutputDataFramePacket &packet)
 {
 	if (implementation_ptr != nullptr)
 	{    
-		implementation_ptr->send_device_data_frame(connection_id, data_frame);
+		implementation_ptr->send_device_data_frame(connection_id, packet);
 	}
 }
@@ -8,13 +8,36 @@
 //-- pre-declarations -----
 class ServerRequestHandler;
 
+namespace PSMoveProtocol
+{
+    class Response_ResultServiceStats;
+};
+
 namespace boost {
     namespace asio {
         class io_service;
     }
 }
 
+//-- constants -----
+// Packed header plus the largest data frame message we'll send
+#define DEVICE_OUTPUT_DATA_FRAME_PACKET_SIZE (4 + MAX_OUTPUT_DATA_FRAME_MESSAGE_SIZE)
+
 //-- definitions -----
+/// A data frame already serialized into a length-prefixed UDP payload.
+/// Packed once per distinct stream and copied into each connection's send queue,
+/// so publishing never has to allocate or re-serialize per client.
+struct DeviceOutputDataFramePacket
+{
+    unsigned char buffer[DEVICE_OUTPUT_DATA_FRAME_PACKET_SIZE];
+    int size; // header + message bytes actually used
+
+    inline void clear()
+    {
+        size = 0;
+    }
+};
+
 class NetworkManagerConfig : public PSMoveConfig
 {
 public:
@@ -27,10 +50,22 @@ public:
 
     long version;
 	int server_port;
+
+    // Also accept clients on the same machine over a unix domain socket at local_socket_path
+    // (see PSMOVESERVICE_LOCAL_ADDRESS_PREFIX). Ignored where the platform has no unix domain sockets.
+    bool local_socket_enabled;
+    std::string local_socket_path;
+
+    // Optional UDP multicast of the pose snapshot (see CompactMulticastSnapshotHeader),
+    // so several render PCs on the LAN can consume the same devices without each needing its own streams
+    bool multicast_pose_stream_enabled;
+    std::string multicast_pose_stream_address;
+    int multicast_pose_stream_port;
+    int multicast_pose_stream_ttl; // Router hops the datagrams may take, 1 keeps them on the local subnet
 };
 
 // -Server Network Manager-
-/// Maintains TCP/UDP connection state with PSMoveClients.
+/// Maintains TCP/UDP (or unix domain socket) connection state with PSMoveClients.
 /// Routes requests to the given request handler.
 class ServerNetworkManager 
 {
@@ -64,10 +99,40 @@ public:
     void shutdown();
 
     void send_notification(int connection_id, ResponsePtr response);
+
+    /// True while responses (or notifications) are still waiting to go out on the connection.
+    /// Lets bulk notifications like network video frames back off for slow connections.
+    bool has_queued_responses(int connection_id) const;
     
     void send_notification_to_all_clients(ResponsePtr response);
     
-    void send_device_data_frame(int connection_id, DeviceOutputDataFramePtr data_frame);
+    /// Serialize a data frame into a packet that can be handed to any number of connections
+    static bool pack_device_data_frame(
+        const PSMoveProtocol::DeviceOutputDataFrame *data_frame, 
+        DeviceOutputDataFramePacket &out_packet);
+
+    /// Copy a fixed layout pose frame into a packet. Compact frames have no length header.
+    static bool pack_compact_pose_frame(
+        const struct CompactControllerPoseFrame *pose_frame,
+        DeviceOutputDataFramePacket &out_packet);
+    static bool pack_compact_orientation_frame(
+        const struct CompactControllerOrientationFrame *orientation_frame,
+        DeviceOutputDataFramePacket &out_packet);
+
+    /// Queues a packet on the connection. Everything queued before the next update()
+    /// gets coalesced into as few datagrams as the client supports.
+    void send_device_data_frame(int connection_id, const DeviceOutputDataFramePacket &packet);
+
+    /// True if the pose snapshot gets multicast every update (see NetworkManagerConfig)
+    bool get_is_multicast_pose_stream_enabled() const;
+
+    /// Adds a device pose to the snapshot multicast at the end of this update.
+    /// Ignored if the multicast pose stream is disabled.
+    void add_multicast_controller_pose(const struct CompactControllerPoseFrame &pose_frame);
+    void add_multicast_hmd_pose(const struct CompactHMDPoseFrame &pose_frame);
+
+    /// Appends the UDP send rates and send queue depth of every started connection
+    void gather_connection_statistics(PSMoveProtocol::Response_ResultServiceStats *stats) const;
 
 private:   
 	/// Configuration settings used by the network manager
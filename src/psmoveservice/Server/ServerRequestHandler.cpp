@@ -3,6 +3,7 @@
 
 #include "BluetoothRequests.h"
 #include "BluetoothQueries.h"
+#include "CompactDataFrame.h"
 #include "ControllerManager.h"
 #include "DeviceManager.h"
 #include "DeviceEnumerator.h"
@@ -13,6 +14,7 @@
 #include "OrientationFilter.h"
 #include "PositionFilter.h"
 #include "ProtocolVersion.h"
+#include "PSMoveConfig.h"
 #include "PS3EyeTracker.h"
 #include "PSDualShock4Controller.h"
 #include "PSMoveController.h"
@@ -24,20 +26,119 @@
 #include "ServerTrackerView.h"
 #include "ServerHMDView.h"
 #include "ServerLog.h"
+#include "ServerTrace.h"
 #include "ServerUtility.h"
 #include "TrackerManager.h"
+#include "USBDeviceManager.h"
 #include "VirtualController.h"
 
+#include <google/protobuf/arena.h>
+
 #include <cassert>
+#include <algorithm>
 #include <bitset>
+#include <cmath>
+#include <cstring>
 #include <map>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 
+//-- constants -----
+// Longest extrapolation allowed for a client requested prediction target
+static const long long k_max_prediction_target_us = 100000;
+
+// Controller streams with only_send_changes skip frames until the pose moves
+// further than this, a button changes or the keep-alive interval runs out
+static const float k_stream_delta_position_threshold_cm = 0.05f;
+static const float k_stream_delta_orientation_threshold_rad = 0.001f;
+static const long long k_stream_delta_keep_alive_us = 1000000;
+
+// Button-only controllers (the Navi) always stream changes only.
+// Their heartbeat is shorter so a lost button release doesn't stick around for long.
+static const long long k_button_only_stream_keep_alive_us = 200000;
+
+// Dual rate streams resend the full pose frame at least this often,
+// so a client that lost one doesn't sit on a stale position and buttons for long
+static const long long k_dual_rate_full_frame_interval_us = 100000;
+
+// Tracker data frames only go out when the tracker state they carry changes,
+// or as a heartbeat when it hasn't for this long
+static const long long k_tracker_data_frame_heartbeat_us = 1000000;
+
 //-- pre-declarations -----
 class ServerRequestHandlerImpl;
 typedef boost::shared_ptr<ServerRequestHandlerImpl> ServerRequestHandlerImplPtr;
 
 //-- definitions -----
+// What was last sent on a throttled controller stream (see ControllerStreamInfo::max_update_rate_hz)
+struct ControllerStreamThrottleState
+{
+    long long next_send_time_us;
+    long long last_send_time_us;
+    bool has_sent_frame;
+    bool last_is_connected;
+    bool last_is_tracking;
+    unsigned int last_buttons;
+    unsigned int last_analog_state;
+    CommonDevicePose last_pose;
+    // What the last full pose frame of a dual rate stream held (see ControllerStreamInfo::use_dual_rate_pose_stream)
+    bool has_sent_full_frame;
+    long long last_full_frame_time_us;
+    int last_full_frame_optical_update_count;
+    uint32_t last_full_frame_flags;
+    uint32_t last_full_frame_buttons;
+    uint8_t last_full_frame_trigger_value;
+    // Sequence number the last fixed rate output went out with (see ServerUtility::next_stream_output_sequence_number)
+    int last_output_sequence_num;
+
+    inline void Clear()
+    {
+        next_send_time_us = 0;
+        last_send_time_us = 0;
+        has_sent_frame = false;
+        last_is_connected = false;
+        last_is_tracking = false;
+        last_buttons = 0;
+        last_analog_state = 0;
+        last_pose.clear();
+        has_sent_full_frame = false;
+        last_full_frame_time_us = 0;
+        last_full_frame_optical_update_count = 0;
+        last_full_frame_flags = 0;
+        last_full_frame_buttons = 0;
+        last_full_frame_trigger_value = 0;
+        last_output_sequence_num = -1;
+    }
+};
+
+// Controller state the only_send_changes test looks at, sampled once per publish
+struct ControllerStreamChangeSnapshot
+{
+    bool is_valid;
+    bool is_connected;
+    bool is_tracking;
+    unsigned int buttons;
+    unsigned int analog_state; // packed stick/trigger values of button-only devices
+    CommonDevicePose pose;
+};
+
+// What the last tracker data frame sent on a tracker stream held
+struct TrackerStreamThrottleState
+{
+    long long last_send_time_us;
+    bool has_sent_frame;
+    bool last_is_connected;
+    long long last_dropped_frame_count;
+
+    inline void Clear()
+    {
+        last_send_time_us = 0;
+        has_sent_frame = false;
+        last_is_connected = false;
+        last_dropped_frame_count = 0;
+    }
+};
+
 struct RequestConnectionState
 {
     int connection_id;
@@ -46,8 +147,13 @@ struct RequestConnectionState
     std::bitset<HMDManager::k_max_devices> active_hmd_streams;
     AsyncBluetoothRequest *pending_bluetooth_request;
     ControllerStreamInfo active_controller_stream_info[ControllerManager::k_max_devices];
+    ControllerStreamThrottleState controller_stream_throttle_state[ControllerManager::k_max_devices];
     TrackerStreamInfo active_tracker_stream_info[TrackerManager::k_max_devices];
+    TrackerStreamThrottleState tracker_stream_throttle_state[TrackerManager::k_max_devices];
     HMDStreamInfo active_hmd_stream_info[HMDManager::k_max_devices];
+    bool has_client_clock_offset;
+    bool is_client_clock_synced; // offset came from the client's clock sync pings
+    long long client_clock_offset_us; // service time - client time
 
     RequestConnectionState()
         : connection_id(-1)
@@ -55,15 +161,20 @@ struct RequestConnectionState
         , active_tracker_streams()
         , active_hmd_streams()
         , pending_bluetooth_request(nullptr)
+        , has_client_clock_offset(false)
+        , is_client_clock_synced(false)
+        , client_clock_offset_us(0)
     {
         for (int index = 0; index < ControllerManager::k_max_devices; ++index)
         {
             active_controller_stream_info[index].Clear();
+            controller_stream_throttle_state[index].Clear();
         }
 
         for (int index = 0; index < TrackerManager::k_max_devices; ++index)
         {
             active_tracker_stream_info[index].Clear();
+            tracker_stream_throttle_state[index].Clear();
         }
         
         for (int index = 0; index < HMDManager::k_max_devices; ++index)
@@ -75,6 +186,49 @@ struct RequestConnectionState
 typedef boost::shared_ptr<RequestConnectionState> RequestConnectionStatePtr;
 typedef std::map<int, RequestConnectionStatePtr> t_connection_state_map;
 typedef std::map<int, RequestConnectionStatePtr>::iterator t_connection_state_iter;
+
+/// Data frames already serialized during one publish, keyed by the stream settings they were built for.
+/// Lets connections with identical stream settings share one serialization.
+template <typename t_stream_info>
+struct DataFramePacketCache
+{
+    static const int k_max_entries = 8;
+
+    t_stream_info stream_infos[k_max_entries];
+    DeviceOutputDataFramePacket packets[k_max_entries];
+    int entry_count;
+
+    DataFramePacketCache() : entry_count(0) {}
+
+    inline void clear()
+    {
+        entry_count = 0;
+    }
+
+    const DeviceOutputDataFramePacket *find(const t_stream_info &stream_info) const
+    {
+        for (int entry_index = 0; entry_index < entry_count; ++entry_index)
+        {
+            if (stream_infos[entry_index] == stream_info)
+            {
+                return &packets[entry_index];
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Once every entry is in use the last one just gets recycled
+    DeviceOutputDataFramePacket *add(const t_stream_info &stream_info)
+    {
+        const int entry_index = (entry_count < k_max_entries) ? entry_count++ : k_max_entries - 1;
+
+        stream_infos[entry_index] = stream_info;
+        packets[entry_index].clear();
+
+        return &packets[entry_index];
+    }
+};
 typedef std::map<int, RequestConnectionStatePtr>::const_iterator t_connection_state_const_iter;
 typedef std::pair<int, RequestConnectionStatePtr> t_id_connection_state_pair;
 
@@ -88,10 +242,23 @@ struct RequestContext
 class ServerRequestHandlerImpl
 {
 public:
+    typedef void (ServerRequestHandlerImpl::*t_request_handler)(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response);
+
     ServerRequestHandlerImpl(DeviceManager &deviceManager)
         : m_device_manager(deviceManager)
         , m_connection_state_map()
+        , m_publish_arena(std::make_shared<google::protobuf::Arena>(make_publish_arena_options(m_publish_arena_block)))
+        , m_publish_data_frame()
+        , m_request_handlers()
     {
+        m_cached_gamepad_count[0] = m_cached_gamepad_count[1] = -1;
+        m_orientation_packet.clear();
+        m_fixed_rate_packet.clear();
+        invalidate_device_list_caches();
+
+        register_request_handlers();
     }
 
     virtual ~ServerRequestHandlerImpl()
@@ -100,74 +267,164 @@ public:
         // "Delete called on 'class ServerRequestHandlerImpl' that has virtual functions but non-virtual destructor"
     }
 
+    // Every request type maps straight to its handler, so dispatching a request is one table lookup
+    void register_request_handlers()
+    {
+        // Controller Requests
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST, &ServerRequestHandlerImpl::handle_request__get_controller_list);
+        register_request_handler(PSMoveProtocol::Request_RequestType_START_CONTROLLER_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__start_controller_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_STOP_CONTROLLER_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__stop_controller_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_RESET_ORIENTATION, &ServerRequestHandlerImpl::handle_request__reset_orientation);
+        register_request_handler(PSMoveProtocol::Request_RequestType_UNPAIR_CONTROLLER, &ServerRequestHandlerImpl::handle_request__unpair_controller);
+        register_request_handler(PSMoveProtocol::Request_RequestType_PAIR_CONTROLLER, &ServerRequestHandlerImpl::handle_request__pair_controller);
+        register_request_handler(PSMoveProtocol::Request_RequestType_CANCEL_BLUETOOTH_REQUEST, &ServerRequestHandlerImpl::handle_request__cancel_bluetooth_request);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_LED_TRACKING_COLOR, &ServerRequestHandlerImpl::handle_request__set_led_tracking_color);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_MAGNETOMETER_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_controller_magnetometer_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_ACCELEROMETER_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_controller_accelerometer_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_GYROSCOPE_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_controller_gyroscope_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_OPTICAL_NOISE_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_optical_noise_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SAMPLE_CONTROLLER_OPTICAL_NOISE, &ServerRequestHandlerImpl::handle_request__sample_controller_optical_noise);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SAMPLE_CONTROLLER_IMU, &ServerRequestHandlerImpl::handle_request__sample_controller_imu);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_ORIENTATION_FILTER, &ServerRequestHandlerImpl::handle_request__set_orientation_filter);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_POSITION_FILTER, &ServerRequestHandlerImpl::handle_request__set_position_filter);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_PREDICTION_TIME, &ServerRequestHandlerImpl::handle_request__set_controller_prediction_time);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_ATTACHED_CONTROLLER, &ServerRequestHandlerImpl::handle_request__set_attached_controller);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_GAMEPAD_INDEX, &ServerRequestHandlerImpl::handle_request__set_gamepad_index);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_DATA_STREAM_TRACKER_INDEX, &ServerRequestHandlerImpl::handle_request__set_controller_data_stream_tracker_index);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_DATA_STREAM_PREDICTION_TARGET, &ServerRequestHandlerImpl::handle_request__set_controller_data_stream_prediction_target);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_HAND, &ServerRequestHandlerImpl::handle_request__set_controller_hand);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_CONTROLLER_VISION_PRIORITY, &ServerRequestHandlerImpl::handle_request__set_controller_vision_priority);
+
+        // Tracker Requests
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST, &ServerRequestHandlerImpl::handle_request__get_tracker_list);
+        register_request_handler(PSMoveProtocol::Request_RequestType_START_TRACKER_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__start_tracker_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_STOP_TRACKER_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__stop_tracker_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_TRACKER_SETTINGS, &ServerRequestHandlerImpl::handle_request__get_tracker_settings);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_FRAME_WIDTH, &ServerRequestHandlerImpl::handle_request__set_tracker_frame_width);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_FRAME_HEIGHT, &ServerRequestHandlerImpl::handle_request__set_tracker_frame_height);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_FRAME_RATE, &ServerRequestHandlerImpl::handle_request__set_tracker_frame_rate);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_EXPOSURE, &ServerRequestHandlerImpl::handle_request__set_tracker_exposure);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_GAIN, &ServerRequestHandlerImpl::handle_request__set_tracker_gain);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_OPTION, &ServerRequestHandlerImpl::handle_request__set_tracker_option);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_COLOR_PRESET, &ServerRequestHandlerImpl::handle_request__set_tracker_color_preset);
+        register_request_handler(PSMoveProtocol::Request_RequestType_AUTO_CALIBRATE_TRACKER_COLOR_PRESETS, &ServerRequestHandlerImpl::handle_request__auto_calibrate_tracker_color_presets);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_POSE, &ServerRequestHandlerImpl::handle_request__set_tracker_pose);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_TRACKER_INTRINSICS, &ServerRequestHandlerImpl::handle_request__set_tracker_intrinsics);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SAVE_TRACKER_PROFILE, &ServerRequestHandlerImpl::handle_request__save_tracker_profile);
+        register_request_handler(PSMoveProtocol::Request_RequestType_RELOAD_TRACKER_SETTINGS, &ServerRequestHandlerImpl::handle_request__reload_tracker_settings);
+        register_request_handler(PSMoveProtocol::Request_RequestType_APPLY_TRACKER_PROFILE, &ServerRequestHandlerImpl::handle_request__apply_tracker_profile);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SEARCH_FOR_NEW_TRACKERS, &ServerRequestHandlerImpl::handle_request__search_for_new_trackers);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_TRACKING_SPACE_SETTINGS, &ServerRequestHandlerImpl::handle_request__get_tracking_space_settings);
+
+        // HMD Requests
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_HMD_LIST, &ServerRequestHandlerImpl::handle_request__get_hmd_list);
+        register_request_handler(PSMoveProtocol::Request_RequestType_START_HMD_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__start_hmd_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_STOP_HMD_DATA_STREAM, &ServerRequestHandlerImpl::handle_request__stop_hmd_data_stream);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_LED_TRACKING_COLOR, &ServerRequestHandlerImpl::handle_request__set_hmd_led_tracking_color);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_ACCELEROMETER_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_hmd_accelerometer_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_GYROSCOPE_CALIBRATION, &ServerRequestHandlerImpl::handle_request__set_hmd_gyroscope_calibration);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_ORIENTATION_FILTER, &ServerRequestHandlerImpl::handle_request__set_hmd_orientation_filter);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_POSITION_FILTER, &ServerRequestHandlerImpl::handle_request__set_hmd_position_filter);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_PREDICTION_TIME, &ServerRequestHandlerImpl::handle_request__set_hmd_prediction_time);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_DATA_STREAM_TRACKER_INDEX, &ServerRequestHandlerImpl::handle_request__set_hmd_data_stream_tracker_index);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_DATA_STREAM_PREDICTION_TARGET, &ServerRequestHandlerImpl::handle_request__set_hmd_data_stream_prediction_target);
+        register_request_handler(PSMoveProtocol::Request_RequestType_SET_HMD_VISION_PRIORITY, &ServerRequestHandlerImpl::handle_request__set_hmd_vision_priority);
+
+        // General Service Requests
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_SERVICE_VERSION, &ServerRequestHandlerImpl::handle_request__get_service_version);
+        register_request_handler(PSMoveProtocol::Request_RequestType_CLOCK_SYNC_PING, &ServerRequestHandlerImpl::handle_request__clock_sync_ping);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_USB_DEVICE_STATISTICS, &ServerRequestHandlerImpl::handle_request__get_usb_device_statistics);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_TRACE_EVENTS, &ServerRequestHandlerImpl::handle_request__get_trace_events);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_SERVICE_STATS, &ServerRequestHandlerImpl::handle_request__get_service_stats);
+        register_request_handler(PSMoveProtocol::Request_RequestType_BATCH, &ServerRequestHandlerImpl::handle_request__batch);
+        register_request_handler(PSMoveProtocol::Request_RequestType_GET_CONNECTION_HANDSHAKE, &ServerRequestHandlerImpl::handle_request__get_connection_handshake);
+    }
+
+    void register_request_handler(PSMoveProtocol::Request_RequestType request_type, t_request_handler handler)
+    {
+        assert(m_request_handlers[request_type] == nullptr);
+        m_request_handlers[request_type]= handler;
+    }
+
     bool any_active_bluetooth_requests() const
     {
-        bool any_active= false;
+        // Canceled requests keep the controller list on hold until their worker thread is done
+        bool any_active= !m_orphaned_bluetooth_requests.empty();
 
-        for (t_connection_state_const_iter iter= m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
+        for (t_connection_state_const_iter iter= m_connection_state_map.begin(); 
+            !any_active && iter != m_connection_state_map.end(); 
+            ++iter)
         {
             RequestConnectionStatePtr connection_state= iter->second;
 
             if (connection_state->pending_bluetooth_request != nullptr)
             {
                 any_active= true;
-                break;
             }
         }
 
         return any_active;
     }
 
+    bool any_active_data_streams() const
+    {
+        for (t_connection_state_const_iter iter= m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
+        {
+            const RequestConnectionStatePtr &connection_state= iter->second;
+
+            if (connection_state->active_controller_streams.any() ||
+                connection_state->active_tracker_streams.any() ||
+                connection_state->active_hmd_streams.any())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     void update()
     {
         for (t_connection_state_iter iter= m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
         {
-            int connection_id= iter->first;
             RequestConnectionStatePtr connection_state= iter->second;
 
             // Update any asynchronous bluetooth requests
-            if (connection_state->pending_bluetooth_request != nullptr)
+            if (connection_state->pending_bluetooth_request != nullptr &&
+                update_bluetooth_request(connection_state->pending_bluetooth_request))
             {
-                bool delete_request;
-
-                connection_state->pending_bluetooth_request->update();
+                delete connection_state->pending_bluetooth_request;
+                connection_state->pending_bluetooth_request= nullptr;
 
-                switch(connection_state->pending_bluetooth_request->getStatusCode())
-                {
-                case AsyncBluetoothRequest::running:
-                    {
-                        // Don't delete. Still have work to do
-                        delete_request= false;
-                    } break;
-                case AsyncBluetoothRequest::succeeded:
-                    {
-                        SERVER_LOG_INFO("ServerRequestHandler") 
-                            << "Async bluetooth request(" 
-                            << connection_state->pending_bluetooth_request->getDescription() 
-                            << ") completed.";
-                        delete_request= true;
-                    } break;
-                case AsyncBluetoothRequest::failed:
-                    {
-                        SERVER_LOG_ERROR("ServerRequestHandler") 
-                            << "Async bluetooth request(" 
-                            << connection_state->pending_bluetooth_request->getDescription() 
-                            << ") failed!";
-                        delete_request= true;
-                    } break;
-                default:
-                    assert(0 && "unreachable");
-                }
+                // Pairing changes the controllers' host serials
+                invalidate_device_list_caches();
+            }
+        }
 
-                if (delete_request)
-                {
-                    delete connection_state->pending_bluetooth_request;
-                    connection_state->pending_bluetooth_request= nullptr;
-                }
+        // Requests whose connection went away still need to wait for their worker thread to finish
+        for (auto iter= m_orphaned_bluetooth_requests.begin(); iter != m_orphaned_bluetooth_requests.end(); )
+        {
+            if (update_bluetooth_request(*iter))
+            {
+                delete *iter;
+                iter= m_orphaned_bluetooth_requests.erase(iter);
+            }
+            else
+            {
+                ++iter;
             }
         }
     }
 
+    // Forget the cached device lists, the next list request rebuilds them
+    void invalidate_device_list_caches()
+    {
+        m_bIsControllerListCached[0] = false;
+        m_bIsControllerListCached[1] = false;
+        m_bIsTrackerListCached = false;
+        m_bIsHMDListCached = false;
+    }
+
     ResponsePtr handle_request(int connection_id, RequestPtr request)
     {
         // The context holds everything a handler needs to evaluate a request
@@ -175,221 +432,43 @@ public:
         context.request= request;
         context.connection_state= FindOrCreateConnectionState(connection_id);
 
-        // All responses track which request they came from
-        PSMoveProtocol::Response *response= nullptr;
-
-        switch (request->type())
-        {
-            // Controller Requests
-            case PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_controller_list(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_START_CONTROLLER_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__start_controller_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_STOP_CONTROLLER_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__stop_controller_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_RESET_ORIENTATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__reset_orientation(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_UNPAIR_CONTROLLER:
-                response = new PSMoveProtocol::Response;
-                handle_request__unpair_controller(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_PAIR_CONTROLLER:
-                response = new PSMoveProtocol::Response;
-                handle_request__pair_controller(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_CANCEL_BLUETOOTH_REQUEST:
-                response = new PSMoveProtocol::Response;
-                handle_request__cancel_bluetooth_request(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_LED_TRACKING_COLOR:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_led_tracking_color(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_MAGNETOMETER_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_magnetometer_calibration(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_ACCELEROMETER_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_accelerometer_calibration(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_GYROSCOPE_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_gyroscope_calibration(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_OPTICAL_NOISE_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_optical_noise_calibration(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_ORIENTATION_FILTER:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_orientation_filter(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_POSITION_FILTER:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_position_filter(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_PREDICTION_TIME:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_prediction_time(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_ATTACHED_CONTROLLER:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_attached_controller(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_GAMEPAD_INDEX:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_gamepad_index(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_DATA_STREAM_TRACKER_INDEX:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_data_stream_tracker_index(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_HAND:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_controller_hand(context, response);
-                break;
-
-            // Tracker Requests
-            case PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_tracker_list(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_START_TRACKER_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__start_tracker_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_STOP_TRACKER_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__stop_tracker_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_GET_TRACKER_SETTINGS:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_tracker_settings(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_FRAME_WIDTH:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_frame_width(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_FRAME_HEIGHT:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_frame_height(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_FRAME_RATE:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_frame_rate(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_EXPOSURE:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_exposure(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_GAIN:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_gain(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_OPTION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_option(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_COLOR_PRESET:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_color_preset(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_POSE:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_pose(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_TRACKER_INTRINSICS:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_tracker_intrinsics(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SAVE_TRACKER_PROFILE:
-                response = new PSMoveProtocol::Response;
-                handle_request__save_tracker_profile(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_RELOAD_TRACKER_SETTINGS:
-                response = new PSMoveProtocol::Response;
-                handle_request__reload_tracker_settings(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_APPLY_TRACKER_PROFILE:
-                response = new PSMoveProtocol::Response;
-                handle_request__apply_tracker_profile(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SEARCH_FOR_NEW_TRACKERS:
-                response = new PSMoveProtocol::Response;
-                handle_request__search_for_new_trackers(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_GET_TRACKING_SPACE_SETTINGS:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_tracking_space_settings(context, response);
-                break;
-
-            // HMD Requests
-            case PSMoveProtocol::Request_RequestType_GET_HMD_LIST:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_hmd_list(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_START_HMD_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__start_hmd_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_STOP_HMD_DATA_STREAM:
-                response = new PSMoveProtocol::Response;
-                handle_request__stop_hmd_data_stream(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_HMD_LED_TRACKING_COLOR:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_hmd_led_tracking_color(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_HMD_ACCELEROMETER_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_hmd_accelerometer_calibration(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_HMD_GYROSCOPE_CALIBRATION:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_hmd_gyroscope_calibration(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_HMD_ORIENTATION_FILTER:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_hmd_orientation_filter(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_HMD_POSITION_FILTER:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_hmd_position_filter(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_HMD_PREDICTION_TIME:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_hmd_prediction_time(context, response);
-                break;
-            case PSMoveProtocol::Request_RequestType_SET_HMD_DATA_STREAM_TRACKER_INDEX:
-                response = new PSMoveProtocol::Response;
-                handle_request__set_hmd_data_stream_tracker_index(context, response);
-                break;
-
-            // General Service Requests
-            case PSMoveProtocol::Request_RequestType_GET_SERVICE_VERSION:
-                response = new PSMoveProtocol::Response;
-                handle_request__get_service_version(context, response);
-                break;
-
-            default:
-                assert(0 && "Whoops, bad request!");
-        }
-
-        if (response != nullptr)
+        // Handlers are free to use the tracker buffers and cameras, which pipelined vision work may still be using
+        m_device_manager.m_tracker_manager->finishPipelinedProjections();
+
+        // Same for the cameras and configs of trackers still switching settings
+        const PSMoveProtocol::Request_RequestType request_type= request->type();
+        if (!get_can_overlap_tracker_settings_changes(request_type))
         {
+            m_device_manager.m_tracker_manager->finishTrackerSettingsChanges();
+        }
+
+        ResponsePtr response;
+        const t_request_handler handler=
+            PSMoveProtocol::Request_RequestType_IsValid(request_type)
+            ? m_request_handlers[request_type]
+            : nullptr;
+
+        if (handler != nullptr)
+        {
+            // One allocation for both the response and its reference count
+            response= std::make_shared<PSMoveProtocol::Response>();
+            (this->*handler)(context, response.get());
+
+            // Anything but a query may have changed a device setting the cached lists report
+            if (!get_is_query_request(request_type))
+            {
+                invalidate_device_list_caches();
+            }
+
+            // All responses track which request they came from
             response->set_request_id(request->request_id());
         }
+        else
+        {
+            assert(0 && "Whoops, bad request!");
+        }
 
-        return ResponsePtr(response);
+        return response;
     }
 
     void handle_input_data_frame(DeviceInputDataFramePtr data_frame)
@@ -422,12 +501,14 @@ public:
 
                 connection_state->pending_bluetooth_request->cancel(AsyncBluetoothRequest::connectionClosed);
 
-                delete connection_state->pending_bluetooth_request;
+                // The worker thread may still be using the request state,
+                // so keep updating it until it finishes instead of deleting it right away
+                m_orphaned_bluetooth_requests.push_back(connection_state->pending_bluetooth_request);
                 connection_state->pending_bluetooth_request= nullptr;
             }
 
             // Clean up any controller state related to this connection
-            for (int controller_id = 0; controller_id < ControllerManager::k_max_devices; ++controller_id)
+            for (int controller_id = 0; controller_id < m_device_manager.getControllerViewMaxCount(); ++controller_id)
             {
                 const ControllerStreamInfo &streamInfo = connection_state->active_controller_stream_info[controller_id];
                 ServerControllerViewPtr controller_view = m_device_manager.getControllerViewPtr(controller_id);
@@ -459,7 +540,7 @@ public:
             }
 
             
-            for (int tracker_id = 0; tracker_id < TrackerManager::k_max_devices; ++tracker_id)
+            for (int tracker_id = 0; tracker_id < m_device_manager.getTrackerViewMaxCount(); ++tracker_id)
             {
                 // Restore any overridden camera settings from the config
                 if (connection_state->active_tracker_stream_info[tracker_id].has_temp_settings_override)
@@ -467,15 +548,20 @@ public:
                     m_device_manager.getTrackerViewPtr(tracker_id)->loadSettings();
                 }
 
-                // Halt any shared memory streams this connection has going
-                if (connection_state->active_tracker_stream_info[tracker_id].streaming_video_data)
+                // Halt any shared memory or network video streams this connection has going
+                if (connection_state->active_tracker_stream_info[tracker_id].streaming_network_video)
                 {
-                    m_device_manager.getTrackerViewPtr(tracker_id)->stopSharedMemoryVideoStream();
+                    m_device_manager.getTrackerViewPtr(tracker_id)->stopNetworkVideoStream();
+                }
+                else if (connection_state->active_tracker_stream_info[tracker_id].streaming_video_data)
+                {
+                    m_device_manager.getTrackerViewPtr(tracker_id)->stopSharedMemoryVideoStream(
+                        get_tracker_video_preview_settings(connection_state->active_tracker_stream_info[tracker_id]));
                 }
             }
 
             // Clean up any hmd state related to this connection
-            for (int hmd_id = 0; hmd_id < HMDManager::k_max_devices; ++hmd_id)
+            for (int hmd_id = 0; hmd_id < m_device_manager.getHMDViewMaxCount(); ++hmd_id)
             {
                 const HMDStreamInfo &streamInfo = connection_state->active_hmd_stream_info[hmd_id];
                 ServerHMDViewPtr hmd_view = m_device_manager.getHMDViewPtr(hmd_id);
@@ -500,9 +586,16 @@ public:
 
     void publish_controller_data_frame(
          ServerControllerView *controller_view, 
-         ServerRequestHandler::t_generate_controller_data_frame_for_stream callback)
+         ServerRequestHandler::t_generate_controller_data_frame_for_stream callback,
+         ServerRequestHandler::t_generate_controller_compact_pose_frame_for_stream compact_callback)
     {
         int controller_id= controller_view->getDeviceID();
+        const long long now_us= ServerUtility::get_service_time_us();
+
+        // The device state the only_send_changes test compares against is the same for every connection,
+        // so it gets sampled once for this publish rather than once per connection
+        ControllerStreamChangeSnapshot change_snapshot;
+        change_snapshot.is_valid= false;
 
         // Notify any connections that care about the controller update
         for (t_connection_state_iter iter= m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
@@ -515,14 +608,344 @@ public:
                 const ControllerStreamInfo &streamInfo=
                     connection_state->active_controller_stream_info[controller_id];
 
-                // Fill out a data frame specific to this stream using the given callback
-                DeviceOutputDataFramePtr data_frame(new PSMoveProtocol::DeviceOutputDataFrame);
-                callback(controller_view, &streamInfo, data_frame.get());
+                // Fixed rate streams go out on their own timer (see publish_fixed_rate_controller_streams)
+                if (streamInfo.fixed_output_rate_hz > 0.f)
+                {
+                    continue;
+                }
+
+                if (!should_send_controller_stream_update(
+                        controller_view, streamInfo,
+                        connection_state->controller_stream_throttle_state[controller_id],
+                        now_us,
+                        change_snapshot))
+                {
+                    continue;
+                }
+
+                // Connections whose stream settings project the device state the same way
+                // (see ControllerStreamInfo::operator==) share one data frame per publish
+                const DeviceOutputDataFramePacket *packet= m_controller_packet_cache.find(streamInfo);
+
+                if (packet == nullptr)
+                {
+                    // Fill out a data frame specific to this stream using the given callback.
+                    // The data frame is reused, so protobuf keeps its sub-message allocations between publishes.
+                    DeviceOutputDataFramePacket *new_packet= m_controller_packet_cache.add(streamInfo);
+                    CompactControllerPoseFrame pose_frame;
+
+                    if (streamInfo.use_compact_pose_stream &&
+                        compact_callback(controller_view, &streamInfo, &pose_frame))
+                    {
+                        ServerNetworkManager::pack_compact_pose_frame(&pose_frame, *new_packet);
+                    }
+                    else
+                    {
+                        reset_publish_data_frame();
+                        callback(controller_view, &streamInfo, m_publish_data_frame.get());
+                        ServerNetworkManager::pack_device_data_frame(m_publish_data_frame.get(), *new_packet);
+                    }
+
+                    packet= new_packet;
+                }
+
+                // In between full pose frames a dual rate stream only gets the orientation,
+                // the one part of the pose that moves at the IMU rate
+                if (streamInfo.use_dual_rate_pose_stream &&
+                    packet->size == sizeof(CompactControllerPoseFrame) &&
+                    packet->buffer[0] == COMPACT_DATA_FRAME_MARKER)
+                {
+                    CompactControllerPoseFrame pose_frame;
+                    memcpy(&pose_frame, packet->buffer, sizeof(CompactControllerPoseFrame));
+
+                    if (!should_send_full_pose_frame(
+                            controller_view, pose_frame,
+                            connection_state->controller_stream_throttle_state[controller_id],
+                            now_us))
+                    {
+                        CompactControllerOrientationFrame orientation_frame;
+
+                        orientation_frame.marker= COMPACT_ORIENTATION_FRAME_MARKER;
+                        orientation_frame.version= COMPACT_DATA_FRAME_VERSION;
+                        orientation_frame.controller_id= pose_frame.controller_id;
+                        orientation_frame.flags= static_cast<uint8_t>(pose_frame.flags);
+                        orientation_frame.sequence_num= pose_frame.sequence_num;
+                        memcpy(orientation_frame.orientation, pose_frame.orientation, sizeof(orientation_frame.orientation));
+                        orientation_frame.service_time_us= pose_frame.service_time_us;
+
+                        ServerNetworkManager::pack_compact_orientation_frame(&orientation_frame, m_orientation_packet);
+                        packet= &m_orientation_packet;
+                    }
+                }
 
                 // Send the controller data frame over the network
-                ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, data_frame);
+                if (packet->size > 0)
+                {
+                    ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, *packet);
+                }
+            }
+        }
+
+        m_controller_packet_cache.clear();
+    }
+
+    static bool should_send_controller_stream_update(
+        const ServerControllerView *controller_view,
+        const ControllerStreamInfo &streamInfo,
+        ControllerStreamThrottleState &throttle_state,
+        const long long now_us,
+        ControllerStreamChangeSnapshot &change_snapshot)
+    {
+        // Rate limit first, so a skipped frame never counts as "sent" for the delta check
+        if (streamInfo.max_update_rate_hz > 0.f)
+        {
+            const long long send_interval_us= static_cast<long long>(1000000.f / streamInfo.max_update_rate_hz);
+
+            if (now_us < throttle_state.next_send_time_us)
+            {
+                return false;
+            }
+
+            // Stay on the requested rate, but don't try to catch up after a stall
+            throttle_state.next_send_time_us+= send_interval_us;
+            if (throttle_state.next_send_time_us <= now_us)
+            {
+                throttle_state.next_send_time_us= now_us + send_interval_us;
+            }
+        }
+
+        // Nothing but the buttons and sticks of a button-only device ever changes,
+        // so sending it every tick only costs bandwidth and client decode time
+        const bool bIsButtonOnly= controller_view->getControllerDeviceType() == CommonDeviceState::PSNavi;
+
+        if (!streamInfo.only_send_changes && !bIsButtonOnly)
+        {
+            return true;
+        }
+
+        if (!change_snapshot.is_valid)
+        {
+            const CommonControllerState *controller_state= controller_view->getState();
+
+            change_snapshot.pose= controller_view->getFilteredPose();
+            change_snapshot.is_connected= controller_view->getDevice()->getIsOpen();
+            change_snapshot.is_tracking= controller_view->getIsCurrentlyTracking();
+            change_snapshot.buttons= (controller_state != nullptr) ? controller_state->AllButtons : 0;
+            change_snapshot.analog_state= get_button_only_analog_state(controller_state);
+            change_snapshot.is_valid= true;
+        }
+
+        const CommonDevicePose &pose= change_snapshot.pose;
+        const bool is_connected= change_snapshot.is_connected;
+        const bool is_tracking= change_snapshot.is_tracking;
+        const unsigned int buttons= change_snapshot.buttons;
+        const unsigned int analog_state= change_snapshot.analog_state;
+        const long long keep_alive_us= bIsButtonOnly ? k_button_only_stream_keep_alive_us : k_stream_delta_keep_alive_us;
+        bool bChanged= !throttle_state.has_sent_frame;
+
+        if (!bChanged)
+        {
+            const float dx= pose.PositionCm.x - throttle_state.last_pose.PositionCm.x;
+            const float dy= pose.PositionCm.y - throttle_state.last_pose.PositionCm.y;
+            const float dz= pose.PositionCm.z - throttle_state.last_pose.PositionCm.z;
+            const float quat_dot= fabsf(
+                pose.Orientation.w*throttle_state.last_pose.Orientation.w +
+                pose.Orientation.x*throttle_state.last_pose.Orientation.x +
+                pose.Orientation.y*throttle_state.last_pose.Orientation.y +
+                pose.Orientation.z*throttle_state.last_pose.Orientation.z);
+            const float angle_rad= 2.f*acosf(std::min(quat_dot, 1.f));
+
+            bChanged=
+                is_connected != throttle_state.last_is_connected ||
+                is_tracking != throttle_state.last_is_tracking ||
+                buttons != throttle_state.last_buttons ||
+                analog_state != throttle_state.last_analog_state ||
+                dx*dx + dy*dy + dz*dz > k_stream_delta_position_threshold_cm*k_stream_delta_position_threshold_cm ||
+                angle_rad > k_stream_delta_orientation_threshold_rad ||
+                now_us - throttle_state.last_send_time_us >= keep_alive_us;
+        }
+
+        if (bChanged)
+        {
+            throttle_state.has_sent_frame= true;
+            throttle_state.last_send_time_us= now_us;
+            throttle_state.last_is_connected= is_connected;
+            throttle_state.last_is_tracking= is_tracking;
+            throttle_state.last_buttons= buttons;
+            throttle_state.last_analog_state= analog_state;
+            throttle_state.last_pose= pose;
+        }
+
+        return bChanged;
+    }
+
+    // A full pose frame goes out when a new optical measurement got fused since the last one
+    // (the position moved), anything but the orientation changed, or the full frame interval ran out
+    static bool should_send_full_pose_frame(
+        const ServerControllerView *controller_view,
+        const CompactControllerPoseFrame &pose_frame,
+        ControllerStreamThrottleState &throttle_state,
+        const long long now_us)
+    {
+        const int optical_update_count= controller_view->getOpticalUpdateCount();
+        const bool bSendFullFrame=
+            !throttle_state.has_sent_full_frame ||
+            optical_update_count != throttle_state.last_full_frame_optical_update_count ||
+            pose_frame.flags != throttle_state.last_full_frame_flags ||
+            pose_frame.button_down_bitmask != throttle_state.last_full_frame_buttons ||
+            pose_frame.trigger_value != throttle_state.last_full_frame_trigger_value ||
+            now_us - throttle_state.last_full_frame_time_us >= k_dual_rate_full_frame_interval_us;
+
+        if (bSendFullFrame)
+        {
+            throttle_state.has_sent_full_frame= true;
+            throttle_state.last_full_frame_time_us= now_us;
+            throttle_state.last_full_frame_optical_update_count= optical_update_count;
+            throttle_state.last_full_frame_flags= pose_frame.flags;
+            throttle_state.last_full_frame_buttons= pose_frame.button_down_bitmask;
+            throttle_state.last_full_frame_trigger_value= pose_frame.trigger_value;
+        }
+
+        return bSendFullFrame;
+    }
+
+    void publish_fixed_rate_controller_streams()
+    {
+        const long long now_us= ServerUtility::get_service_time_us();
+
+        for (t_connection_state_iter iter= m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
+        {
+            const int connection_id= iter->first;
+            RequestConnectionStatePtr connection_state= iter->second;
+
+            if (connection_state->active_controller_streams.none())
+            {
+                continue;
+            }
+
+            for (int controller_id= 0; controller_id < ControllerManager::k_max_devices; ++controller_id)
+            {
+                const ControllerStreamInfo &streamInfo=
+                    connection_state->active_controller_stream_info[controller_id];
+                ControllerStreamThrottleState &throttle_state=
+                    connection_state->controller_stream_throttle_state[controller_id];
+
+                if (!connection_state->active_controller_streams.test(controller_id) ||
+                    streamInfo.fixed_output_rate_hz <= 0.f ||
+                    now_us < throttle_state.next_send_time_us)
+                {
+                    continue;
+                }
+
+                // Stay on the grid of output times, so the client gets evenly spaced samples.
+                // The first output and any more than an interval late (after a stall) restart the grid at now.
+                const long long output_interval_us= static_cast<long long>(1000000.f / streamInfo.fixed_output_rate_hz);
+                const long long output_time_us=
+                    (throttle_state.has_sent_frame && now_us - throttle_state.next_send_time_us < output_interval_us)
+                    ? throttle_state.next_send_time_us
+                    : now_us;
+
+                throttle_state.has_sent_frame= true;
+                throttle_state.last_send_time_us= output_time_us;
+                throttle_state.next_send_time_us= output_time_us + output_interval_us;
+
+                // Several outputs can fall between two device updates,
+                // each one still needs a sequence number the client hasn't seen yet
+                ServerControllerView *controller_view= m_device_manager.getControllerViewPtr(controller_id).get();
+                const int sequence_num=
+                    ServerUtility::next_stream_output_sequence_number(
+                        throttle_state.last_output_sequence_num,
+                        controller_view->getSequenceNumber());
+
+                throttle_state.last_output_sequence_num= sequence_num;
+                controller_view->reserveSequenceNumber(sequence_num);
+
+                publish_fixed_rate_controller_frame(
+                    connection_id, 
+                    controller_view, 
+                    streamInfo, 
+                    output_time_us,
+                    sequence_num);
+            }
+        }
+    }
+
+    long long get_next_fixed_rate_output_time_us() const
+    {
+        long long next_output_time_us= -1;
+
+        for (t_connection_state_const_iter iter= m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
+        {
+            RequestConnectionStatePtr connection_state= iter->second;
+
+            for (int controller_id= 0; controller_id < ControllerManager::k_max_devices; ++controller_id)
+            {
+                if (connection_state->active_controller_streams.test(controller_id) &&
+                    connection_state->active_controller_stream_info[controller_id].fixed_output_rate_hz > 0.f)
+                {
+                    const long long output_time_us= connection_state->controller_stream_throttle_state[controller_id].next_send_time_us;
+
+                    if (next_output_time_us < 0 || output_time_us < next_output_time_us)
+                    {
+                        next_output_time_us= output_time_us;
+                    }
+                }
             }
         }
+
+        return next_output_time_us;
+    }
+
+    // Every fixed rate output has its own output time and sequence number, so unlike a publish nothing gets shared between connections
+    void publish_fixed_rate_controller_frame(
+        const int connection_id,
+        const ServerControllerView *controller_view,
+        const ControllerStreamInfo &streamInfo,
+        const long long output_time_us,
+        const int sequence_num)
+    {
+        ControllerStreamInfo outputStreamInfo= streamInfo;
+        CompactControllerPoseFrame pose_frame;
+
+        outputStreamInfo.prediction_target.output_time_us= output_time_us;
+        m_fixed_rate_packet.clear();
+
+        if (outputStreamInfo.use_compact_pose_stream &&
+            ServerControllerView::generate_controller_compact_pose_frame_for_stream(controller_view, &outputStreamInfo, &pose_frame))
+        {
+            pose_frame.sequence_num= sequence_num;
+            ServerNetworkManager::pack_compact_pose_frame(&pose_frame, m_fixed_rate_packet);
+        }
+        else
+        {
+            reset_publish_data_frame();
+            ServerControllerView::generate_controller_data_frame_for_stream(controller_view, &outputStreamInfo, m_publish_data_frame.get());
+            m_publish_data_frame->mutable_controller_data_packet()->set_sequence_num(sequence_num);
+            ServerNetworkManager::pack_device_data_frame(m_publish_data_frame.get(), m_fixed_rate_packet);
+        }
+
+        if (m_fixed_rate_packet.size > 0)
+        {
+            ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, m_fixed_rate_packet);
+        }
+    }
+
+    static unsigned int get_button_only_analog_state(const CommonControllerState *controller_state)
+    {
+        unsigned int analog_state= 0;
+
+        if (controller_state != nullptr && controller_state->DeviceType == CommonDeviceState::PSNavi)
+        {
+            const PSNaviControllerInputState *navi_state=
+                static_cast<const PSNaviControllerInputState *>(controller_state);
+
+            analog_state=
+                static_cast<unsigned int>(navi_state->Stick_XAxis) |
+                (static_cast<unsigned int>(navi_state->Stick_YAxis) << 8) |
+                (static_cast<unsigned int>(navi_state->Trigger) << 16);
+        }
+
+        return analog_state;
     }
 
     void publish_tracker_data_frame(
@@ -530,6 +953,9 @@ public:
             ServerRequestHandler::t_generate_tracker_data_frame_for_stream callback)
     {
         int tracker_id = tracker_view->getDeviceID();
+        const long long now_us = ServerUtility::get_service_time_us();
+        const bool bIsConnected = tracker_view->getIsOpen();
+        const long long dropped_frame_count = tracker_view->getDroppedVideoFrameCount();
 
         // Notify any connections that care about the tracker update
         for (t_connection_state_iter iter = m_connection_state_map.begin(); iter != m_connection_state_map.end(); ++iter)
@@ -541,15 +967,91 @@ public:
             {
                 const TrackerStreamInfo &streamInfo =
                     connection_state->active_tracker_stream_info[tracker_id];
+                TrackerStreamThrottleState &throttle_state =
+                    connection_state->tracker_stream_throttle_state[tracker_id];
+
+                if (streamInfo.streaming_network_video)
+                {
+                    publish_tracker_network_video_frame(
+                        connection_id, tracker_view, connection_state->active_tracker_stream_info[tracker_id]);
+                }
+
+                // The tracker state hardly ever changes once calibrated (the video frames don't go through the data frames),
+                // so skip the frame unless it changed or the heartbeat is due
+                if (throttle_state.has_sent_frame &&
+                    throttle_state.last_is_connected == bIsConnected &&
+                    throttle_state.last_dropped_frame_count == dropped_frame_count &&
+                    now_us - throttle_state.last_send_time_us < k_tracker_data_frame_heartbeat_us)
+                {
+                    continue;
+                }
+
+                throttle_state.has_sent_frame = true;
+                throttle_state.last_send_time_us = now_us;
+                throttle_state.last_is_connected = bIsConnected;
+                throttle_state.last_dropped_frame_count = dropped_frame_count;
 
-                // Fill out a data frame specific to this stream using the given callback
-                DeviceOutputDataFramePtr data_frame(new PSMoveProtocol::DeviceOutputDataFrame);
-                callback(tracker_view, &streamInfo, data_frame);
+                const DeviceOutputDataFramePacket *packet = m_tracker_packet_cache.find(streamInfo);
+
+                if (packet == nullptr)
+                {
+                    // Fill out a data frame specific to this stream using the given callback
+                    DeviceOutputDataFramePacket *new_packet = m_tracker_packet_cache.add(streamInfo);
+
+                    reset_publish_data_frame();
+                    callback(tracker_view, &streamInfo, m_publish_data_frame);
+                    ServerNetworkManager::pack_device_data_frame(m_publish_data_frame.get(), *new_packet);
+
+                    packet = new_packet;
+                }
 
                 // Send the tracker data frame over the network
-                ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, data_frame);
+                if (packet->size > 0)
+                {
+                    ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, *packet);
+                }
             }
         }
+
+        m_tracker_packet_cache.clear();
+    }
+
+    void publish_tracker_network_video_frame(
+        int connection_id,
+        const class ServerTrackerView *tracker_view,
+        TrackerStreamInfo &streamInfo)
+    {
+        const TrackerNetworkVideoFrame &video_frame = tracker_view->getNetworkVideoFrame();
+        ServerNetworkManager *network_manager = ServerNetworkManager::get_instance();
+
+        // A connection still sending the previous frame skips to whatever is the latest once it caught up
+        if (video_frame.frame_index == streamInfo.last_network_video_frame_index ||
+            network_manager->has_queued_responses(connection_id))
+        {
+            return;
+        }
+
+        ResponsePtr response(new PSMoveProtocol::Response);
+        PSMoveProtocol::Response_ResultTrackerVideoFrame *result = response->mutable_result_tracker_video_frame();
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_TRACKER_VIDEO_FRAME);
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+
+        result->set_tracker_id(tracker_view->getDeviceID());
+        result->set_frame_index(video_frame.frame_index);
+        result->set_timestamp_us(video_frame.timestamp_us);
+        result->set_frame_width(video_frame.frame_width);
+        result->set_frame_height(video_frame.frame_height);
+        result->set_roi_x(video_frame.roi_x);
+        result->set_roi_y(video_frame.roi_y);
+        result->set_roi_width(video_frame.roi_width);
+        result->set_roi_height(video_frame.roi_height);
+        result->set_image_width(video_frame.image_width);
+        result->set_image_height(video_frame.image_height);
+        result->set_jpeg_data(video_frame.jpeg_data.data(), video_frame.jpeg_data.size());
+
+        network_manager->send_notification(connection_id, response);
+        streamInfo.last_network_video_frame_index = video_frame.frame_index;
     }
 
     void publish_hmd_data_frame(
@@ -568,15 +1070,29 @@ public:
             {
                 const HMDStreamInfo &streamInfo =
                     connection_state->active_hmd_stream_info[hmd_id];
+                const DeviceOutputDataFramePacket *packet = m_hmd_packet_cache.find(streamInfo);
+
+                if (packet == nullptr)
+                {
+                    // Fill out a data frame specific to this stream using the given callback
+                    DeviceOutputDataFramePacket *new_packet = m_hmd_packet_cache.add(streamInfo);
 
-                // Fill out a data frame specific to this stream using the given callback
-                DeviceOutputDataFramePtr data_frame(new PSMoveProtocol::DeviceOutputDataFrame);
-                callback(hmd_view, &streamInfo, data_frame);
+                    reset_publish_data_frame();
+                    callback(hmd_view, &streamInfo, m_publish_data_frame);
+                    ServerNetworkManager::pack_device_data_frame(m_publish_data_frame.get(), *new_packet);
+
+                    packet = new_packet;
+                }
 
                 // Send the hmd data frame over the network
-                ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, data_frame);
+                if (packet->size > 0)
+                {
+                    ServerNetworkManager::get_instance()->send_device_data_frame(connection_id, *packet);
+                }
             }
         }
+
+        m_hmd_packet_cache.clear();
     }    
 
 protected:
@@ -624,19 +1140,42 @@ protected:
     {
         const PSMoveProtocol::Request_RequestGetControllerList& request =
             context.request->request_get_controller_list();
-        PSMoveProtocol::Response_ResultControllerList* list= response->mutable_result_controller_list();
 
         response->set_type(PSMoveProtocol::Response_ResponseType_CONTROLLER_LIST);
+        response->mutable_result_controller_list()->CopyFrom(fetch_controller_list(request.include_usb_controllers()));
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+    }
 
-        // Get the address of the bluetooth adapter cached at startup
-        list->set_host_serial(m_device_manager.m_controller_manager->getCachedBluetoothHostAddress());
-        list->set_gamepad_count(m_device_manager.m_controller_manager->getGamepadCount());
+    // The controller list as of the last list change, rebuilt on demand
+    const PSMoveProtocol::Response_ResultControllerList &fetch_controller_list(const bool bIncludeUSB)
+    {
+        const int list_index = bIncludeUSB ? 1 : 0;
+        const int gamepad_count = m_device_manager.m_controller_manager->getGamepadCount();
 
-        // Add of the open controllers matching the filter constraints
+        // Gamepads come and go without a controller list notification
+        if (!m_bIsControllerListCached[list_index] || m_cached_gamepad_count[list_index] != gamepad_count)
+        {
+            m_cached_controller_lists[list_index].Clear();
+            build_controller_list(bIncludeUSB, &m_cached_controller_lists[list_index]);
+            m_cached_gamepad_count[list_index] = gamepad_count;
+            m_bIsControllerListCached[list_index] = true;
+        }
+
+        return m_cached_controller_lists[list_index];
+    }
+
+    void build_controller_list(
+        const bool bIncludeUSB,
+        PSMoveProtocol::Response_ResultControllerList* list)
+    {
+        // Get the address of the bluetooth adapter cached at startup
+        list->set_host_serial(m_device_manager.m_controller_manager->getCachedBluetoothHostAddress());
+        list->set_gamepad_count(m_device_manager.m_controller_manager->getGamepadCount());
+
+        // Add of the open controllers matching the filter constraints
         for (int controller_id= 0; controller_id < m_device_manager.getControllerViewMaxCount(); ++controller_id)
         {
             ServerControllerViewPtr controller_view= m_device_manager.getControllerViewPtr(controller_id);
-            const bool bIncludeUSB = request.include_usb_controllers();
             const bool bIsNonUSB = controller_view->getIsBluetooth() || controller_view->getIsVirtualController();
 
             if (controller_view->getIsOpen() && (bIncludeUSB || bIsNonUSB))
@@ -764,6 +1303,8 @@ protected:
                 controller_info->set_gyro_gain_setting(gyro_gain_setting);
                 controller_info->set_prediction_time(prediction_time);
                 controller_info->set_gamepad_index(gamepad_index);
+                controller_info->set_vision_priority(
+                    static_cast<PSMoveProtocol::VisionPriority>(controller_view->getVisionPriority()));
 
 				if (controller_hand == "Left")
 					controller_info->set_controller_hand(PSMoveProtocol::HAND_LEFT);
@@ -773,8 +1314,6 @@ protected:
 					controller_info->set_controller_hand(PSMoveProtocol::HAND_ANY);
             }
         }
-
-        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
     }
 
     void handle_request__start_controller_data_stream(
@@ -801,6 +1340,9 @@ protected:
                 // All we have to do is keep track of which connections care about the updates.
                 context.connection_state->active_controller_streams.set(controller_id, true);
 
+                // Wake the devices up for the stream now rather than after an idle poll interval
+                m_device_manager.refreshIdleMode();
+
                 // Set control flags for the stream
                 streamInfo.Clear();
                 streamInfo.include_position_data = request.include_position_data();
@@ -808,7 +1350,15 @@ protected:
                 streamInfo.include_raw_sensor_data = request.include_raw_sensor_data();
                 streamInfo.include_calibrated_sensor_data = request.include_calibrated_sensor_data();
                 streamInfo.include_raw_tracker_data = request.include_raw_tracker_data();
+                streamInfo.include_all_tracker_data = request.include_all_tracker_data();
+                streamInfo.use_packed_tracker_data = request.use_packed_tracker_data();
                 streamInfo.disable_roi = request.disable_roi();
+                streamInfo.use_compact_pose_stream = request.use_compact_pose_stream() || request.use_dual_rate_pose_stream();
+                streamInfo.use_dual_rate_pose_stream = request.use_dual_rate_pose_stream();
+                streamInfo.max_update_rate_hz = std::max(request.max_update_rate_hz(), 0.f);
+                streamInfo.only_send_changes = request.only_send_changes();
+                streamInfo.fixed_output_rate_hz = std::max(request.fixed_output_rate_hz(), 0.f);
+                context.connection_state->controller_stream_throttle_state[controller_id].Clear();
 
                 SERVER_LOG_INFO("ServerRequestHandler") << "Start controller(" << controller_id << ") stream ("
                     << "pos=" << streamInfo.include_position_data
@@ -816,7 +1366,14 @@ protected:
                     << ",raw_sens=" << streamInfo.include_raw_sensor_data
                     << ",cal_sens=" << streamInfo.include_calibrated_sensor_data
                     << ",trkr=" << streamInfo.include_raw_tracker_data
+                    << ",all_trkr=" << streamInfo.include_all_tracker_data
+                    << ",packed_trkr=" << streamInfo.use_packed_tracker_data
                     << ",roi=" << streamInfo.disable_roi
+                    << ",compact=" << streamInfo.use_compact_pose_stream
+                    << ",dual_rate=" << streamInfo.use_dual_rate_pose_stream
+                    << ",rate=" << streamInfo.max_update_rate_hz
+                    << ",delta=" << streamInfo.only_send_changes
+                    << ",fixed_rate=" << streamInfo.fixed_output_rate_hz
                     << ")";
 
                 if (streamInfo.include_position_data)
@@ -1413,6 +1970,138 @@ protected:
         }
     }
 
+    void handle_request__sample_controller_optical_noise(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const PSMoveProtocol::Request_RequestSampleControllerOpticalNoise &request =
+            context.request->request_sample_controller_optical_noise();
+        const int controller_id = request.controller_id();
+
+        ServerControllerViewPtr ControllerView = m_device_manager.getControllerViewPtr(controller_id);
+
+        if (ControllerView && ControllerView->getIsOpen())
+        {
+            if (request.start_sampling())
+            {
+                ControllerView->startOpticalNoiseSampling(request.sample_count());
+            }
+
+            const ControllerOpticalNoiseStatistics &statistics = ControllerView->getOpticalNoiseStatistics();
+            PSMoveProtocol::Response_ResultControllerOpticalNoiseSamples *result =
+                response->mutable_result_controller_optical_noise_samples();
+
+            result->set_controller_id(controller_id);
+            result->set_sample_count(statistics.sample_count);
+            result->set_target_sample_count(statistics.target_sample_count);
+            result->set_projection_area_px_sqr(static_cast<float>(statistics.projection_area_mean));
+            result->set_position_variance_cm_sqr(statistics.getPositionVariance());
+            result->set_orientation_variance_rad_sqr(statistics.getOrientationVariance());
+
+            response->set_type(PSMoveProtocol::Response_ResponseType_CONTROLLER_OPTICAL_NOISE_SAMPLES);
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+        }
+        else
+        {
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+    }
+
+    void handle_request__sample_controller_imu(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const PSMoveProtocol::Request_RequestSampleControllerIMU &request =
+            context.request->request_sample_controller_imu();
+        const int controller_id = request.controller_id();
+
+        ServerControllerViewPtr ControllerView = m_device_manager.getControllerViewPtr(controller_id);
+
+        if (ControllerView && ControllerView->getIsOpen() &&
+            (!request.start_sampling() || ControllerView->startIMUCapture(request.sample_count())))
+        {
+            const ControllerIMUCaptureSession &session = ControllerView->getIMUCaptureSession();
+            PSMoveProtocol::Response_ResultControllerIMUSamples *result =
+                response->mutable_result_controller_imu_samples();
+
+            result->set_controller_id(controller_id);
+            result->set_sample_count(session.getSampleCount());
+            result->set_target_sample_count(session.target_sample_count);
+
+            if (session.getIsComplete())
+            {
+                result->set_duration_sec(session.duration_sec);
+                set_float_vector(result->mutable_raw_accelerometer_mean(), session.raw_accelerometer_mean);
+                set_float_vector(result->mutable_raw_accelerometer_variance(), session.raw_accelerometer_variance);
+                set_float_vector(result->mutable_raw_gyroscope_mean(), session.raw_gyroscope_mean);
+                set_float_vector(result->mutable_raw_gyroscope_variance(), session.raw_gyroscope_variance);
+                set_float_vector(result->mutable_accelerometer_mean_g_units(), session.accelerometer_mean_g_units);
+                result->set_accelerometer_variance_g_units_sqr(session.accelerometer_variance_g_units_sqr);
+                result->set_accelerometer_noise_radius_g_units(session.accelerometer_noise_radius_g_units);
+                result->set_gyroscope_variance_rad_per_sec_sqr(session.gyroscope_variance_rad_per_sec_sqr);
+                result->set_gyroscope_drift_rate_rad_per_sec(session.gyroscope_drift_rate_rad_per_sec);
+
+                if (request.include_raw_samples())
+                {
+                    write_imu_capture_raw_samples(session, result);
+                }
+            }
+
+            response->set_type(PSMoveProtocol::Response_ResponseType_CONTROLLER_IMU_SAMPLES);
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+        }
+        else
+        {
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+    }
+
+    static void set_float_vector(PSMoveProtocol::FloatVector *out_vector, const Eigen::Vector3f &vector)
+    {
+        out_vector->set_i(vector.x());
+        out_vector->set_j(vector.y());
+        out_vector->set_k(vector.z());
+    }
+
+    // Delta encodes the raw readings, consecutive readings of a resting controller
+    // differ by a few counts, which the packed sint32 varints store in a byte each
+    static void write_imu_capture_raw_samples(
+        const ControllerIMUCaptureSession &session,
+        PSMoveProtocol::Response_ResultControllerIMUSamples *result)
+    {
+        const int sample_count = session.getSampleCount();
+        CommonRawDeviceVector last_accelerometer;
+        CommonRawDeviceVector last_gyroscope;
+
+        last_accelerometer.clear();
+        last_gyroscope.clear();
+
+        result->mutable_raw_accelerometer_deltas()->Reserve(sample_count*3);
+        result->mutable_raw_gyroscope_deltas()->Reserve(sample_count*3);
+        result->mutable_timestamp_deltas_us()->Reserve(sample_count);
+
+        for (int sample_index = 0; sample_index < sample_count; ++sample_index)
+        {
+            const ControllerIMUCaptureSample &sample = session.samples[sample_index];
+
+            result->add_raw_accelerometer_deltas(sample.raw_accelerometer.i - last_accelerometer.i);
+            result->add_raw_accelerometer_deltas(sample.raw_accelerometer.j - last_accelerometer.j);
+            result->add_raw_accelerometer_deltas(sample.raw_accelerometer.k - last_accelerometer.k);
+            result->add_raw_gyroscope_deltas(sample.raw_gyroscope.i - last_gyroscope.i);
+            result->add_raw_gyroscope_deltas(sample.raw_gyroscope.j - last_gyroscope.j);
+            result->add_raw_gyroscope_deltas(sample.raw_gyroscope.k - last_gyroscope.k);
+
+            const long long timestamp_delta_us = (sample_index > 0)
+                ? std::chrono::duration_cast<std::chrono::microseconds>(
+                    sample.timestamp - session.samples[sample_index - 1].timestamp).count()
+                : 0;
+            result->add_timestamp_deltas_us(static_cast<int>(timestamp_delta_us));
+
+            last_accelerometer = sample.raw_accelerometer;
+            last_gyroscope = sample.raw_gyroscope;
+        }
+    }
+
     void handle_request__set_orientation_filter(
         const RequestContext &context,
         PSMoveProtocol::Response *response)
@@ -1602,6 +2291,72 @@ protected:
         }
     }
 
+    void handle_request__set_controller_vision_priority(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const PSMoveProtocol::Request_RequestSetControllerVisionPriority &request =
+            context.request->request_set_controller_vision_priority();
+        const int controller_id = request.controller_id();
+        const eCommonVisionPriority vision_priority = static_cast<eCommonVisionPriority>(request.vision_priority());
+
+        ServerControllerViewPtr ControllerView = m_device_manager.getControllerViewPtr(controller_id);
+
+        if (ControllerView && ControllerView->getIsOpen() &&
+            vision_priority >= VisionPriority_Low && vision_priority < MAX_VISION_PRIORITY_TYPES)
+        {
+            if (ControllerView->getControllerDeviceType() == CommonDeviceState::PSDualShock4)
+            {
+                PSDualShock4Controller *controller = ControllerView->castChecked<PSDualShock4Controller>();
+                PSDualShock4ControllerConfig config = *controller->getConfig();
+
+                if (config.vision_priority != vision_priority)
+                {
+                    config.vision_priority = vision_priority;
+
+                    controller->setConfig(&config);
+                }
+
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+            }
+            else if (ControllerView->getControllerDeviceType() == CommonDeviceState::PSMove)
+            {
+                PSMoveController *controller = ControllerView->castChecked<PSMoveController>();
+                PSMoveControllerConfig config = *controller->getConfig();
+
+                if (config.vision_priority != vision_priority)
+                {
+                    config.vision_priority = vision_priority;
+
+                    controller->setConfig(&config);
+                }
+
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+            }
+            else if (ControllerView->getControllerDeviceType() == CommonDeviceState::VirtualController)
+            {
+                VirtualController *controller = ControllerView->castChecked<VirtualController>();
+                VirtualControllerConfig *config = controller->getConfigMutable();
+
+                if (config->vision_priority != vision_priority)
+                {
+                    config->vision_priority = vision_priority;
+                    config->save();
+                }
+
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+            }
+            else
+            {
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+            }
+        }
+        else
+        {
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+    }
+
     void handle_request__set_attached_controller(
         const RequestContext &context,
         PSMoveProtocol::Response *response)
@@ -1709,6 +2464,39 @@ protected:
         }
     }
 
+    void handle_request__set_controller_data_stream_prediction_target(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const auto &request = context.request->request_set_data_stream_prediction_target();
+        const int controller_id = request.device_id();
+
+        if (ServerUtility::is_index_valid(controller_id, m_device_manager.getControllerViewMaxCount()))
+        {
+            ServerControllerViewPtr controller_view = m_device_manager.getControllerViewPtr(controller_id);
+            ControllerStreamInfo &streamInfo =
+                context.connection_state->active_controller_stream_info[controller_id];
+
+            if (controller_view->getIsStreamable())
+            {
+                update_prediction_target(context.connection_state, request, streamInfo.prediction_target);
+
+                SERVER_LOG_INFO("ServerRequestHandler") << "Set controller(" << controller_id << ") stream prediction target: "
+                    << (streamInfo.prediction_target.is_active ? "client display time" : "configured prediction time");
+
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+            }
+            else
+            {
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+            }
+        }
+        else
+        {
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+    }
+
 	void handle_request__set_controller_hand(
         const RequestContext &context,
         PSMoveProtocol::Response *response)
@@ -1802,10 +2590,26 @@ protected:
         const RequestContext &context,
         PSMoveProtocol::Response *response)
     {
-        PSMoveProtocol::Response_ResultTrackerList* list = response->mutable_result_tracker_list();
-
         response->set_type(PSMoveProtocol::Response_ResponseType_TRACKER_LIST);
+        response->mutable_result_tracker_list()->CopyFrom(fetch_tracker_list());
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+    }
+
+    // The tracker list as of the last list change, rebuilt on demand
+    const PSMoveProtocol::Response_ResultTrackerList &fetch_tracker_list()
+    {
+        if (!m_bIsTrackerListCached)
+        {
+            m_cached_tracker_list.Clear();
+            build_tracker_list(&m_cached_tracker_list);
+            m_bIsTrackerListCached = true;
+        }
+
+        return m_cached_tracker_list;
+    }
 
+    void build_tracker_list(PSMoveProtocol::Response_ResultTrackerList* list)
+    {
         for (int tracker_id = 0; tracker_id < m_device_manager.getTrackerViewMaxCount(); ++tracker_id)
         {
             ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
@@ -1900,7 +2704,6 @@ protected:
         }
 
         list->set_global_forward_degrees(m_device_manager.m_tracker_manager->getConfig().global_forward_degrees);
-        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
     }
 
     void handle_request__start_tracker_data_stream(
@@ -1923,12 +2726,38 @@ protected:
                 // The tracker manager will always publish updates regardless of who is listening.
                 // All we have to do is keep track of which connections care about the updates.
                 context.connection_state->active_tracker_streams.set(tracker_id, true);
+                // Send the new stream the tracker state with the next frame
+                context.connection_state->tracker_stream_throttle_state[tracker_id].Clear();
+
+                // Wake the devices up for the stream now rather than after an idle poll interval
+                m_device_manager.refreshIdleMode();
 
                 // Set control flags for the stream
                 streamInfo.streaming_video_data = true;
+                streamInfo.streaming_network_video = request.stream_network_video();
+                streamInfo.last_network_video_frame_index = 0;
+                streamInfo.video_preview_scale = std::max(request.video_preview_scale(), 1);
+                streamInfo.video_preview_format = static_cast<int>(request.video_preview_format());
 
                 // Increment the number of stream listeners
-                tracker_view->startSharedMemoryVideoStream();
+                if (streamInfo.streaming_network_video)
+                {
+                    TrackerNetworkVideoSettings settings;
+
+                    settings.max_frame_rate = std::max(request.network_video_max_frame_rate(), 0);
+                    settings.quality = request.network_video_quality();
+                    settings.max_width = std::max(request.network_video_max_width(), 0);
+                    settings.roi_x = request.network_video_roi_x();
+                    settings.roi_y = request.network_video_roi_y();
+                    settings.roi_width = request.network_video_roi_width();
+                    settings.roi_height = request.network_video_roi_height();
+
+                    tracker_view->startNetworkVideoStream(settings);
+                }
+                else
+                {
+                    tracker_view->startSharedMemoryVideoStream(get_tracker_video_preview_settings(streamInfo));
+                }
 
                 // Return the name of the shared memory block the video frames will be written to
                 response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
@@ -1945,6 +2774,16 @@ protected:
         }
     }
 
+    static TrackerVideoPreviewSettings get_tracker_video_preview_settings(const TrackerStreamInfo &streamInfo)
+    {
+        TrackerVideoPreviewSettings preview;
+
+        preview.scale = streamInfo.video_preview_scale;
+        preview.pixel_format = streamInfo.video_preview_format;
+
+        return preview;
+    }
+
     void handle_request__stop_tracker_data_stream(
         const RequestContext &context,
         PSMoveProtocol::Response *response)
@@ -1957,6 +2796,11 @@ protected:
 
             if (tracker_view->getIsOpen())
             {
+                const bool bWasStreamingNetworkVideo =
+                    context.connection_state->active_tracker_stream_info[tracker_id].streaming_network_video;
+                const TrackerVideoPreviewSettings preview =
+                    get_tracker_video_preview_settings(context.connection_state->active_tracker_stream_info[tracker_id]);
+
                 context.connection_state->active_tracker_streams.set(tracker_id, false);
                 context.connection_state->active_tracker_stream_info[tracker_id].Clear();
 
@@ -1967,7 +2811,14 @@ protected:
                 }
 
                 // Decrement the number of stream listeners
-                tracker_view->stopSharedMemoryVideoStream();
+                if (bWasStreamingNetworkVideo)
+                {
+                    tracker_view->stopNetworkVideoStream();
+                }
+                else
+                {
+                    tracker_view->stopSharedMemoryVideoStream(preview);
+                }
 
                 response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
             }
@@ -2397,6 +3248,107 @@ protected:
         }
     }
 
+    void handle_request__auto_calibrate_tracker_color_presets(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const auto &request = context.request->request_auto_calibrate_tracker_color_presets();
+        const int requested_tracker_id = request.tracker_id();
+        const eCommonTrackingColorID colorType = static_cast<eCommonTrackingColorID>(request.color_type());
+        const int tracker_count = m_device_manager.getTrackerViewMaxCount();
+        ServerControllerView *controller_view = nullptr;
+        ServerHMDView *hmd_view = nullptr;
+
+        switch (request.device_category())
+        {
+        case PSMoveProtocol::Request_RequestAutoCalibrateTrackerColorPresets_DeviceCategory_CONTROLLER:
+            controller_view = get_controller_view_or_null(request.device_id());
+            break;
+        case PSMoveProtocol::Request_RequestAutoCalibrateTrackerColorPresets_DeviceCategory_HMD:
+            hmd_view = get_hmd_view_or_null(request.device_id());
+            break;
+        }
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_TRACKER_PRESETS_AUTO_CALIBRATED);
+
+        if ((controller_view != nullptr || hmd_view != nullptr) &&
+            colorType >= 0 && colorType < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES &&
+            (requested_tracker_id == -1 || ServerUtility::is_index_valid(requested_tracker_id, tracker_count)))
+        {
+            std::vector<CommonHSVColorRange> hsvColorRanges(tracker_count);
+            // Not a vector<bool>, every tracker task writes its own entry
+            std::vector<char> bHSVColorRangeValid(tracker_count, 0);
+
+            // Requests are handled between ticks, so every tracker still holds the video frame
+            // it last searched and can build its histograms alongside the others
+            m_device_manager.m_tracker_manager->runTrackerTasksAndWait(
+                [&](int tracker_id)
+                {
+                    ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
+
+                    if ((requested_tracker_id == -1 || requested_tracker_id == tracker_id) &&
+                        tracker_view->getIsOpen())
+                    {
+                        bHSVColorRangeValid[tracker_id] =
+                            (controller_view != nullptr)
+                            ? tracker_view->computeControllerTrackingColorPresetFromHistogram(
+                                controller_view, colorType, &hsvColorRanges[tracker_id])
+                            : tracker_view->computeHMDTrackingColorPresetFromHistogram(
+                                hmd_view, colorType, &hsvColorRanges[tracker_id]);
+                    }
+                });
+
+            // Assigning the presets touches the tracker configs, so that stays on this thread
+            PSMoveProtocol::Response_ResultAutoCalibrateTrackerColorPresets *result =
+                response->mutable_result_auto_calibrate_tracker_color_presets();
+
+            for (int tracker_id = 0; tracker_id < tracker_count; ++tracker_id)
+            {
+                if (!bHSVColorRangeValid[tracker_id])
+                {
+                    continue;
+                }
+
+                ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
+                CommonHSVColorRange outHSVColorRange;
+
+                if (controller_view != nullptr)
+                {
+                    tracker_view->setControllerTrackingColorPreset(controller_view, colorType, &hsvColorRanges[tracker_id]);
+                    tracker_view->getControllerTrackingColorPreset(controller_view, colorType, &outHSVColorRange);
+                }
+                else
+                {
+                    tracker_view->setHMDTrackingColorPreset(hmd_view, colorType, &hsvColorRanges[tracker_id]);
+                    tracker_view->getHMDTrackingColorPreset(hmd_view, colorType, &outHSVColorRange);
+                }
+
+                PSMoveProtocol::Response_ResultAutoCalibrateTrackerColorPresets_TrackerColorPreset *trackerPreset =
+                    result->add_tracker_presets();
+                trackerPreset->set_tracker_id(tracker_id);
+
+                PSMoveProtocol::TrackingColorPreset *presetResult = trackerPreset->mutable_color_preset();
+                presetResult->set_color_type(request.color_type());
+                presetResult->set_hue_center(outHSVColorRange.hue_range.center);
+                presetResult->set_hue_range(outHSVColorRange.hue_range.range);
+                presetResult->set_saturation_center(outHSVColorRange.saturation_range.center);
+                presetResult->set_saturation_range(outHSVColorRange.saturation_range.range);
+                presetResult->set_value_center(outHSVColorRange.value_range.center);
+                presetResult->set_value_range(outHSVColorRange.value_range.range);
+            }
+
+            // Fails if no tracker found the lit device
+            response->set_result_code(
+                result->tracker_presets_size() > 0
+                ? PSMoveProtocol::Response_ResultCode_RESULT_OK
+                : PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+        else
+        {
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+    }
+
     inline CommonDevicePose protocol_pose_to_common_device_pose(const PSMoveProtocol::Pose &pose)
     {
         CommonDevicePose result;
@@ -2521,61 +3473,108 @@ protected:
         }
     }
 
+    // The open tracker with the given id, or every open tracker for -1
+    void gather_open_tracker_views(int tracker_id, std::vector<ServerTrackerViewPtr> &out_tracker_views)
+    {
+        for (int other_tracker_id = 0; other_tracker_id < m_device_manager.getTrackerViewMaxCount(); ++other_tracker_id)
+        {
+            if (tracker_id == -1 || tracker_id == other_tracker_id)
+            {
+                ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(other_tracker_id);
+
+                if (tracker_view->getIsOpen())
+                {
+                    out_tracker_views.push_back(tracker_view);
+                }
+            }
+        }
+    }
+
+    // Inside a batch request the settings changes can't load or save their configs on their own threads,
+    // so they run side by side while the handler waits for all of them
+    void finish_settings_changes_in_save_batch(const std::vector<ServerTrackerViewPtr> &tracker_views)
+    {
+        if (PSMoveConfig::getIsSaveBatchOpen())
+        {
+            for (const ServerTrackerViewPtr &tracker_view : tracker_views)
+            {
+                tracker_view->finishSettingsChange();
+            }
+        }
+    }
+
     void handle_request__apply_tracker_profile(
         const RequestContext &context,
         PSMoveProtocol::Response *response)
     {
         const int tracker_id = context.request->request_apply_tracker_profile().tracker_id();
+        std::vector<ServerTrackerViewPtr> tracker_views;
 
         response->set_type(PSMoveProtocol::Response_ResponseType_TRACKER_SETTINGS);
 
-        if (ServerUtility::is_index_valid(tracker_id, m_device_manager.getTrackerViewMaxCount()))
+        gather_open_tracker_views(tracker_id, tracker_views);
+        if (!tracker_views.empty())
         {
-            ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
-            if (tracker_view->getIsOpen())
+            const int controller_id= context.request->request_apply_tracker_profile().controller_id();
+            ServerControllerView *controller_view= get_controller_view_or_null(controller_id);
+
+            // Copied, the settings changes outlive the request
+            const TrackerProfile trackerProfile = 
+                *m_device_manager.m_tracker_manager->getDefaultTrackerProfile();
+
+            for (const ServerTrackerViewPtr &tracker_view : tracker_views)
             {
-                const int controller_id= context.request->request_apply_tracker_profile().controller_id();
-                ServerControllerView *controller_view= get_controller_view_or_null(controller_id);
+                // Wait out a change still running on this tracker, the profile goes on top of it
+                tracker_view->finishSettingsChange();
 
-                const TrackerProfile *trackerProfile = 
-                    m_device_manager.m_tracker_manager->getDefaultTrackerProfile();
-    
-                // Apply the profile to the tracker
-                tracker_view->setFrameWidth(trackerProfile->frame_width, true);
-                //tracker_view->setFrameHeight(trackerProfile->frame_height, true);
-                tracker_view->setFrameRate(trackerProfile->frame_rate, true);
-                tracker_view->setExposure(trackerProfile->exposure, true);
-                tracker_view->setGain(trackerProfile->gain, true);
+                // The color presets only live in the config
                 for (int preset_index = 0; preset_index < eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES; ++preset_index)
                 {
-                    const CommonHSVColorRange *preset= &trackerProfile->color_preset_table.color_presets[preset_index];
+                    const CommonHSVColorRange *preset= &trackerProfile.color_preset_table.color_presets[preset_index];
                     const eCommonTrackingColorID color_type = static_cast<eCommonTrackingColorID>(preset_index);
 
                     tracker_view->setControllerTrackingColorPreset(controller_view, color_type, preset);
                 }
 
-                // Send the profile application result to the client
+                // Send the profile application result to the client.
+                // The cameras are still switching modes, so it reports the settings they are switching to.
+                if (tracker_view == tracker_views.front())
                 {
                     PSMoveProtocol::Response_ResultTrackerSettings* settings =
                         response->mutable_result_tracker_settings();
-
-                    settings->set_frame_width(static_cast<float>(tracker_view->getFrameWidth()));
-                    settings->set_frame_height(static_cast<float>(tracker_view->getFrameHeight()));
-                    settings->set_frame_rate(static_cast<float>(tracker_view->getFrameRate()));
-                    settings->set_exposure(static_cast<float>(tracker_view->getExposure()));
-                    settings->set_gain(static_cast<float>(tracker_view->getGain()));
+                    const double frame_width = tracker_view->getFrameWidth();
+                    const double frame_height = tracker_view->getFrameHeight();
+
+                    // The camera modes all keep the aspect ratio
+                    settings->set_frame_width(trackerProfile.frame_width);
+                    settings->set_frame_height(
+                        (frame_width > 0.0)
+                        ? static_cast<float>(frame_height * trackerProfile.frame_width / frame_width)
+                        : static_cast<float>(frame_height));
+                    settings->set_frame_rate(trackerProfile.frame_rate);
+                    settings->set_exposure(trackerProfile.exposure);
+                    settings->set_gain(trackerProfile.gain);
                     tracker_view->gatherTrackerOptions(settings);
                     tracker_view->gatherTrackingColorPresets(controller_view, settings);
                 }
 
-                tracker_view->saveSettings();
-
-                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
-            }
-            else
-            {
-                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+                // Apply the profile to the camera
+                tracker_view->startSettingsChange(
+                    [trackerProfile](ITrackerInterface *device) {
+                        if (trackerProfile.frame_width != device->getFrameWidth())
+                        {
+                            device->setFrameWidth(trackerProfile.frame_width, true);
+                        }
+                        device->setFrameRate(trackerProfile.frame_rate, true);
+                        device->setExposure(trackerProfile.exposure, true);
+                        device->setGain(trackerProfile.gain, true);
+                        device->saveSettings();
+                    });
             }
+
+            finish_settings_changes_in_save_batch(tracker_views);
+
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
         }
         else
         {
@@ -2587,22 +3586,26 @@ protected:
         const RequestContext &context,
         PSMoveProtocol::Response *response)
     {
-        const int tracker_id = context.request->request_apply_tracker_profile().tracker_id();
+        const int tracker_id = context.request->request_reload_tracker_settings().tracker_id();
+        std::vector<ServerTrackerViewPtr> tracker_views;
 
         response->set_type(PSMoveProtocol::Response_ResponseType_GENERAL_RESULT);
 
-        if (ServerUtility::is_index_valid(tracker_id, m_device_manager.getTrackerViewMaxCount()))
+        gather_open_tracker_views(tracker_id, tracker_views);
+        if (!tracker_views.empty())
         {
-            ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
-            if (tracker_view->getIsOpen())
-            {   
-                tracker_view->loadSettings();
-                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
-            }
-            else
+            for (const ServerTrackerViewPtr &tracker_view : tracker_views)
             {
-                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+                tracker_view->finishSettingsChange();
+                tracker_view->startSettingsChange(
+                    [](ITrackerInterface *device) {
+                        device->loadSettings();
+                    });
             }
+
+            finish_settings_changes_in_save_batch(tracker_views);
+
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
         }
         else
         {
@@ -2655,10 +3658,26 @@ protected:
         const RequestContext &context,
         PSMoveProtocol::Response *response)
     {
-        PSMoveProtocol::Response_ResultHMDList* list = response->mutable_result_hmd_list();
-
         response->set_type(PSMoveProtocol::Response_ResponseType_HMD_LIST);
+        response->mutable_result_hmd_list()->CopyFrom(fetch_hmd_list());
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+    }
+
+    // The HMD list as of the last list change, rebuilt on demand
+    const PSMoveProtocol::Response_ResultHMDList &fetch_hmd_list()
+    {
+        if (!m_bIsHMDListCached)
+        {
+            m_cached_hmd_list.Clear();
+            build_hmd_list(&m_cached_hmd_list);
+            m_bIsHMDListCached = true;
+        }
 
+        return m_cached_hmd_list;
+    }
+
+    void build_hmd_list(PSMoveProtocol::Response_ResultHMDList* list)
+    {
         for (int hmd_id = 0; hmd_id < m_device_manager.getHMDViewMaxCount(); ++hmd_id)
         {
             ServerHMDViewPtr hmd_view = m_device_manager.getHMDViewPtr(hmd_id);
@@ -2697,10 +3716,9 @@ protected:
                 hmd_info->set_hmd_id(hmd_id);
                 hmd_info->set_device_path(hmd_view->getUSBDevicePath());
                 hmd_info->set_tracking_color_type(static_cast<PSMoveProtocol::TrackingColorType>(hmd_view->getTrackingColorID()));
+                hmd_info->set_vision_priority(static_cast<PSMoveProtocol::VisionPriority>(hmd_view->getVisionPriority()));
             }
         }
-
-        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
     }
 
     void handle_request__start_hmd_data_stream(
@@ -2724,6 +3742,9 @@ protected:
                 // All we have to do is keep track of which connections care about the updates.
                 context.connection_state->active_hmd_streams.set(hmd_id, true);
 
+                // Wake the devices up for the stream now rather than after an idle poll interval
+                m_device_manager.refreshIdleMode();
+
                 // Set control flags for the stream
                 streamInfo.Clear();
                 streamInfo.include_position_data = request.include_position_data();
@@ -2731,6 +3752,8 @@ protected:
                 streamInfo.include_raw_sensor_data = request.include_raw_sensor_data();
                 streamInfo.include_calibrated_sensor_data = request.include_calibrated_sensor_data();
                 streamInfo.include_raw_tracker_data = request.include_raw_tracker_data();
+                streamInfo.include_all_tracker_data = request.include_all_tracker_data();
+                streamInfo.use_packed_tracker_data = request.use_packed_tracker_data();
                 streamInfo.disable_roi = request.disable_roi();
 
                 SERVER_LOG_INFO("ServerRequestHandler") << "Start hmd(" << hmd_id << ") stream ("
@@ -2739,6 +3762,8 @@ protected:
                     << ",raw_sens=" << streamInfo.include_raw_sensor_data
                     << ",cal_sens=" << streamInfo.include_calibrated_sensor_data
                     << ",trkr=" << streamInfo.include_raw_tracker_data
+                    << ",all_trkr=" << streamInfo.include_all_tracker_data
+                    << ",packed_trkr=" << streamInfo.use_packed_tracker_data
                     << ",roi=" << streamInfo.disable_roi
                     << ")";
 
@@ -3077,6 +4102,57 @@ protected:
         }
     }
 
+    void handle_request__set_hmd_vision_priority(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const PSMoveProtocol::Request_RequestSetHMDVisionPriority &request =
+            context.request->request_set_hmd_vision_priority();
+        const int hmd_id = request.hmd_id();
+        const eCommonVisionPriority vision_priority = static_cast<eCommonVisionPriority>(request.vision_priority());
+
+        ServerHMDViewPtr HmdView = m_device_manager.getHMDViewPtr(hmd_id);
+
+        if (HmdView && HmdView->getIsOpen() &&
+            vision_priority >= VisionPriority_Low && vision_priority < MAX_VISION_PRIORITY_TYPES)
+        {
+            if (HmdView->getHMDDeviceType() == CommonDeviceState::Morpheus)
+            {
+                MorpheusHMD *hmd = HmdView->castChecked<MorpheusHMD>();
+                MorpheusHMDConfig *config = hmd->getConfigMutable();
+
+                if (config->vision_priority != vision_priority)
+                {
+                    config->vision_priority = vision_priority;
+                    config->save();
+                }
+
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+            }
+            else if (HmdView->getHMDDeviceType() == CommonDeviceState::VirtualHMD)
+            {
+                VirtualHMD *hmd = HmdView->castChecked<VirtualHMD>();
+                VirtualHMDConfig *config = hmd->getConfigMutable();
+
+                if (config->vision_priority != vision_priority)
+                {
+                    config->vision_priority = vision_priority;
+                    config->save();
+                }
+
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+            }
+            else
+            {
+                response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+            }
+        }
+        else
+        {
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+    }
+
     void handle_request__set_hmd_data_stream_tracker_index(
         const RequestContext &context,
         PSMoveProtocol::Response *response)
@@ -3103,6 +4179,310 @@ protected:
         }
     }
 
+    void handle_request__set_hmd_data_stream_prediction_target(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const auto &request = context.request->request_set_data_stream_prediction_target();
+        const int hmd_id = request.device_id();
+
+        if (ServerUtility::is_index_valid(hmd_id, m_device_manager.getHMDViewMaxCount()))
+        {
+            HMDStreamInfo &streamInfo =
+                context.connection_state->active_hmd_stream_info[hmd_id];
+
+            update_prediction_target(context.connection_state, request, streamInfo.prediction_target);
+
+            SERVER_LOG_INFO("ServerRequestHandler") << "Set hmd(" << hmd_id << ") stream prediction target: "
+                << (streamInfo.prediction_target.is_active ? "client display time" : "configured prediction time");
+
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+        }
+        else
+        {
+            response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+        }
+    }
+
+    static void update_prediction_target(
+        RequestConnectionStatePtr connection_state,
+        const PSMoveProtocol::Request_RequestSetDataStreamPredictionTarget &request,
+        StreamPredictionTarget &out_target)
+    {
+        const long long now_us = ServerUtility::get_service_time_us();
+
+        // Until the client has synced its clock (see CLOCK_SYNC_PING), the smallest
+        // (service receive time - client send time) seen so far is the one
+        // with the least transport delay in it, so it's the best guess for the clock offset
+        if (!connection_state->is_client_clock_synced && request.client_send_time_us() != 0)
+        {
+            const long long offset_us = now_us - request.client_send_time_us();
+
+            if (!connection_state->has_client_clock_offset || offset_us < connection_state->client_clock_offset_us)
+            {
+                connection_state->client_clock_offset_us = offset_us;
+                connection_state->has_client_clock_offset = true;
+            }
+        }
+
+        if (request.display_time_us() != 0 && connection_state->has_client_clock_offset)
+        {
+            out_target.is_active = true;
+            out_target.display_time_us = request.display_time_us() + connection_state->client_clock_offset_us;
+            out_target.display_interval_us = std::max(request.display_interval_us(), 0);
+        }
+        else
+        {
+            out_target.Clear();
+        }
+    }
+
+    void handle_request__clock_sync_ping(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const long long receive_time_us = ServerUtility::get_service_time_us();
+        const auto &request = context.request->request_clock_sync_ping();
+
+        // The client's round trip estimate beats anything we can work out from one way messages
+        if (request.has_clock_offset_estimate())
+        {
+            context.connection_state->client_clock_offset_us = request.clock_offset_estimate_us();
+            context.connection_state->has_client_clock_offset = true;
+            context.connection_state->is_client_clock_synced = true;
+        }
+
+        PSMoveProtocol::Response_ResultClockSyncPong* pong = response->mutable_result_clock_sync_pong();
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_CLOCK_SYNC_PONG);
+
+        pong->set_client_send_time_us(request.client_send_time_us());
+        pong->set_service_receive_time_us(receive_time_us);
+        pong->set_service_send_time_us(ServerUtility::get_service_time_us());
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+    }
+
+    void handle_request__get_usb_device_statistics(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        PSMoveProtocol::Response_ResultUSBDeviceStatistics* result = response->mutable_result_usb_device_statistics();
+        std::vector<USBDeviceTransferStatistics> device_statistics;
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_USB_DEVICE_STATISTICS);
+
+        usb_device_get_transfer_statistics(device_statistics);
+        for (auto it = device_statistics.begin(); it != device_statistics.end(); ++it)
+        {
+            PSMoveProtocol::Response_ResultUSBDeviceStatistics_USBDeviceStatistics *entry = result->add_usb_device_entries();
+            char device_path[256];
+
+            if (!usb_device_get_full_path(it->usb_device_handle, device_path, sizeof(device_path)))
+            {
+                device_path[0] = '\0';
+            }
+
+            entry->set_usb_device_handle(it->usb_device_handle);
+            entry->set_device_path(device_path);
+            entry->set_window_duration_seconds(it->window_duration_seconds);
+            entry->set_transfers_per_second(it->transfers_per_second);
+            entry->set_bytes_per_second(it->bytes_per_second);
+            entry->set_completion_latency_p50_ms(it->completion_latency_p50_ms);
+            entry->set_completion_latency_p99_ms(it->completion_latency_p99_ms);
+            entry->set_completed_transfer_count(static_cast<int64_t>(it->completed_transfer_count));
+            entry->set_completed_byte_count(static_cast<int64_t>(it->completed_byte_count));
+            entry->set_error_count(static_cast<int64_t>(it->error_count));
+        }
+
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+    }
+
+    void handle_request__get_trace_events(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const PSMoveProtocol::Request_RequestGetTraceEvents &request = context.request->request_get_trace_events();
+        PSMoveProtocol::Response_ResultTraceEvents* result = response->mutable_result_trace_events();
+        std::string trace_json;
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_TRACE_EVENTS);
+
+        const int event_count =
+            ServerTrace::export_chrome_trace_json(static_cast<long long>(request.window_ms())*1000, trace_json);
+
+        result->set_chrome_trace_json(trace_json);
+        result->set_event_count(event_count);
+        result->set_tracing_enabled(PSMOVESERVICE_ENABLE_TRACING && ServerTrace::get_enabled());
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+    }
+
+    void handle_request__get_service_stats(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        PSMoveProtocol::Response_ResultServiceStats* result = response->mutable_result_service_stats();
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_SERVICE_STATS);
+
+        result->set_loop_rate_hz(m_device_manager.getUpdateRate());
+
+        for (int controller_id = 0; controller_id < m_device_manager.getControllerViewMaxCount(); ++controller_id)
+        {
+            ServerControllerViewPtr controller_view = m_device_manager.getControllerViewPtr(controller_id);
+
+            if (controller_view->getIsOpen())
+            {
+                PSMoveProtocol::Response_ResultServiceStats_DeviceStats *device_stats = result->add_device_entries();
+
+                device_stats->set_device_category(PSMoveProtocol::Response_ResultServiceStats_DeviceStats_DeviceCategory_CONTROLLER);
+                device_stats->set_device_id(controller_id);
+                device_stats->set_poll_rate_hz(controller_view->getPollRate());
+            }
+        }
+
+        for (int tracker_id = 0; tracker_id < m_device_manager.getTrackerViewMaxCount(); ++tracker_id)
+        {
+            ServerTrackerViewPtr tracker_view = m_device_manager.getTrackerViewPtr(tracker_id);
+
+            if (tracker_view->getIsOpen())
+            {
+                PSMoveProtocol::Response_ResultServiceStats_DeviceStats *device_stats = result->add_device_entries();
+                PSMoveProtocol::Response_ResultServiceStats_TrackerStats *tracker_stats = result->add_tracker_entries();
+
+                device_stats->set_device_category(PSMoveProtocol::Response_ResultServiceStats_DeviceStats_DeviceCategory_TRACKER);
+                device_stats->set_device_id(tracker_id);
+                device_stats->set_poll_rate_hz(tracker_view->getPollRate());
+
+                tracker_stats->set_tracker_id(tracker_id);
+                tracker_stats->set_processing_ms(tracker_view->getProjectionWorkTimeMs());
+                tracker_stats->set_dropped_frame_count(tracker_view->getDroppedVideoFrameCount());
+                tracker_stats->set_ingest_occupancy(tracker_view->getFrameIngestOccupancy());
+                tracker_stats->set_vision_occupancy(tracker_view->getProjectionWorkOccupancy());
+                tracker_stats->set_pipeline_stall_ms(tracker_view->getPipelineStallTimeMs());
+
+                add_tracker_memory_entry(result, tracker_id, "vision buffers", tracker_view->getVisionBufferBytes());
+                add_tracker_memory_entry(result, tracker_id, "shared memory video", tracker_view->getSharedVideoFrameBytes());
+                add_tracker_memory_entry(result, tracker_id, "network video", tracker_view->getNetworkVideoFrameBytes());
+            }
+        }
+
+        {
+            size_t private_bytes, mapped_bytes;
+
+            ServerTrackerView::getBGRToHSVTableBytes(private_bytes, mapped_bytes);
+            add_memory_entry(result, "BGR->HSV table", private_bytes);
+            add_memory_entry(result, "BGR->HSV table (mapped file)", mapped_bytes);
+        }
+
+        for (int hmd_id = 0; hmd_id < m_device_manager.getHMDViewMaxCount(); ++hmd_id)
+        {
+            ServerHMDViewPtr hmd_view = m_device_manager.getHMDViewPtr(hmd_id);
+
+            if (hmd_view->getIsOpen())
+            {
+                PSMoveProtocol::Response_ResultServiceStats_DeviceStats *device_stats = result->add_device_entries();
+
+                device_stats->set_device_category(PSMoveProtocol::Response_ResultServiceStats_DeviceStats_DeviceCategory_HMD);
+                device_stats->set_device_id(hmd_id);
+                device_stats->set_poll_rate_hz(hmd_view->getPollRate());
+                device_stats->set_sensor_backlog_count(hmd_view->getLastPollSensorBacklog());
+                device_stats->set_max_sensor_backlog_count(hmd_view->getMaxPollSensorBacklog());
+            }
+        }
+
+        result->set_over_budget_tick_count(m_device_manager.m_tracker_manager->getOverBudgetTickCount());
+        result->set_deferred_search_count(m_device_manager.m_tracker_manager->getDeferredOpticalSearchCount());
+        result->set_peak_optical_tick_ms(m_device_manager.m_tracker_manager->getPeakOpticalTickTimeMs());
+
+        ServerNetworkManager::get_instance()->gather_connection_statistics(result);
+
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+    }
+
+    static void add_memory_entry(
+        PSMoveProtocol::Response_ResultServiceStats *result,
+        const char *subsystem,
+        const size_t allocated_bytes)
+    {
+        // Leaves out what isn't allocated in the current configuration
+        if (allocated_bytes > 0)
+        {
+            PSMoveProtocol::Response_ResultServiceStats_MemoryStats *memory_stats = result->add_memory_entries();
+
+            memory_stats->set_subsystem(subsystem);
+            memory_stats->set_allocated_bytes(static_cast<long long>(allocated_bytes));
+        }
+    }
+
+    static void add_tracker_memory_entry(
+        PSMoveProtocol::Response_ResultServiceStats *result,
+        const int tracker_id,
+        const char *subsystem,
+        const size_t allocated_bytes)
+    {
+        char tracker_subsystem[64];
+
+        ServerUtility::format_string(tracker_subsystem, sizeof(tracker_subsystem), "Tracker %d %s", tracker_id, subsystem);
+        add_memory_entry(result, tracker_subsystem, allocated_bytes);
+    }
+
+    void handle_request__batch(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const PSMoveProtocol::Request_RequestBatch &request = context.request->request_batch();
+        PSMoveProtocol::Response_ResultBatch* result = response->mutable_result_batch();
+        const int connection_id = context.connection_state->connection_id;
+        bool bAllSucceeded = true;
+        bool bCanceled = false;
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_BATCH_RESULT);
+
+        // Every config the batch changes gets saved once, after the last request
+        PSMoveConfig::beginSaveBatch();
+
+        for (int request_index = 0; request_index < request.requests_size(); ++request_index)
+        {
+            const PSMoveProtocol::Request &sub_request = request.requests(request_index);
+            PSMoveProtocol::Response *sub_response = result->add_responses();
+            ResponsePtr handled_response;
+
+            if (!bCanceled &&
+                sub_request.type() != PSMoveProtocol::Request_RequestType_BATCH &&
+                PSMoveProtocol::Request_RequestType_IsValid(sub_request.type()))
+            {
+                handled_response = handle_request(connection_id, RequestPtr(new PSMoveProtocol::Request(sub_request)));
+            }
+
+            if (handled_response)
+            {
+                sub_response->Swap(handled_response.get());
+            }
+            else
+            {
+                sub_response->set_type(PSMoveProtocol::Response_ResponseType_GENERAL_RESULT);
+                sub_response->set_request_id(sub_request.request_id());
+                sub_response->set_result_code(
+                    bCanceled
+                    ? PSMoveProtocol::Response_ResultCode_RESULT_CANCELED
+                    : PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+            }
+
+            if (sub_response->result_code() != PSMoveProtocol::Response_ResultCode_RESULT_OK)
+            {
+                bAllSucceeded = false;
+                bCanceled = request.stop_on_error();
+            }
+        }
+
+        PSMoveConfig::endSaveBatch();
+
+        response->set_result_code(
+            bAllSucceeded
+            ? PSMoveProtocol::Response_ResultCode_RESULT_OK
+            : PSMoveProtocol::Response_ResultCode_RESULT_ERROR);
+    }
+
     void handle_request__get_service_version(
         const RequestContext &context,
         PSMoveProtocol::Response *response)
@@ -3116,6 +4496,25 @@ protected:
         response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
     }
 
+    void handle_request__get_connection_handshake(
+        const RequestContext &context,
+        PSMoveProtocol::Response *response)
+    {
+        const PSMoveProtocol::Request_RequestGetConnectionHandshake &request =
+            context.request->request_get_connection_handshake();
+
+        response->set_type(PSMoveProtocol::Response_ResponseType_CONNECTION_HANDSHAKE);
+
+        // Same results as the individual requests, the device lists come from the same caches
+        response->mutable_result_service_version()->set_version(PSM_PROTOCOL_VERSION_STRING);
+        response->mutable_result_controller_list()->CopyFrom(fetch_controller_list(request.include_usb_controllers()));
+        response->mutable_result_tracker_list()->CopyFrom(fetch_tracker_list());
+        response->mutable_result_hmd_list()->CopyFrom(fetch_hmd_list());
+        response->mutable_result_tracking_space_settings()->set_global_forward_degrees(
+            m_device_manager.m_tracker_manager->getConfig().global_forward_degrees);
+        response->set_result_code(PSMoveProtocol::Response_ResultCode_RESULT_OK);
+    }
+
     // -- Data Frame Updates -----
     void handle_data_frame__controller_packet(
         RequestConnectionStatePtr connection_state,
@@ -3225,11 +4624,196 @@ protected:
     }
 
 private:
+    // Requests that only read service state, so handling them leaves the cached device lists valid
+    static bool get_is_query_request(PSMoveProtocol::Request_RequestType request_type)
+    {
+        switch (request_type)
+        {
+        case PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST:
+        case PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST:
+        case PSMoveProtocol::Request_RequestType_GET_TRACKER_SETTINGS:
+        case PSMoveProtocol::Request_RequestType_GET_TRACKING_SPACE_SETTINGS:
+        case PSMoveProtocol::Request_RequestType_GET_HMD_LIST:
+        case PSMoveProtocol::Request_RequestType_GET_SERVICE_VERSION:
+        case PSMoveProtocol::Request_RequestType_GET_CONNECTION_HANDSHAKE:
+        case PSMoveProtocol::Request_RequestType_CLOCK_SYNC_PING:
+        case PSMoveProtocol::Request_RequestType_GET_USB_DEVICE_STATISTICS:
+        case PSMoveProtocol::Request_RequestType_GET_TRACE_EVENTS:
+        case PSMoveProtocol::Request_RequestType_GET_SERVICE_STATS:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Requests that never touch a tracker camera or config (or only wait on the trackers they change),
+    // so they don't have to wait for the tracker settings changes in flight
+    static bool get_can_overlap_tracker_settings_changes(PSMoveProtocol::Request_RequestType request_type)
+    {
+        switch (request_type)
+        {
+        case PSMoveProtocol::Request_RequestType_APPLY_TRACKER_PROFILE:
+        case PSMoveProtocol::Request_RequestType_RELOAD_TRACKER_SETTINGS:
+        case PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST:
+        case PSMoveProtocol::Request_RequestType_GET_HMD_LIST:
+        case PSMoveProtocol::Request_RequestType_GET_SERVICE_VERSION:
+        case PSMoveProtocol::Request_RequestType_CLOCK_SYNC_PING:
+        case PSMoveProtocol::Request_RequestType_GET_USB_DEVICE_STATISTICS:
+        case PSMoveProtocol::Request_RequestType_GET_TRACE_EVENTS:
+        case PSMoveProtocol::Request_RequestType_RESET_ORIENTATION:
+        case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_PREDICTION_TIME:
+        case PSMoveProtocol::Request_RequestType_SET_HMD_PREDICTION_TIME:
+        case PSMoveProtocol::Request_RequestType_SET_CONTROLLER_DATA_STREAM_PREDICTION_TARGET:
+        case PSMoveProtocol::Request_RequestType_SET_HMD_DATA_STREAM_PREDICTION_TARGET:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Returns true once the request has finished and can be deleted
+    bool update_bluetooth_request(AsyncBluetoothRequest *request)
+    {
+        bool bIsFinished;
+
+        if (request->pollTimeout())
+        {
+            SERVER_LOG_WARNING("ServerRequestHandler") 
+                << "Async bluetooth request(" 
+                << request->getDescription() 
+                << ") timed out. Canceling.";
+            request->cancel(AsyncBluetoothRequest::timeout);
+        }
+
+        request->update();
+
+        switch(request->getStatusCode())
+        {
+        case AsyncBluetoothRequest::running:
+            {
+                // Don't delete. Still have work to do
+                bIsFinished= false;
+            } break;
+        case AsyncBluetoothRequest::succeeded:
+            {
+                SERVER_LOG_INFO("ServerRequestHandler") 
+                    << "Async bluetooth request(" 
+                    << request->getDescription() 
+                    << ") completed.";
+                bIsFinished= true;
+            } break;
+        case AsyncBluetoothRequest::failed:
+            {
+                SERVER_LOG_ERROR("ServerRequestHandler") 
+                    << "Async bluetooth request(" 
+                    << request->getDescription() 
+                    << ") failed!";
+                bIsFinished= true;
+            } break;
+        default:
+            assert(0 && "unreachable");
+            bIsFinished= true;
+        }
+
+        return bIsFinished;
+    }
+
+    static google::protobuf::ArenaOptions make_publish_arena_options(char *initial_block)
+    {
+        google::protobuf::ArenaOptions options;
+
+        options.initial_block= initial_block;
+        options.initial_block_size= k_publish_arena_block_size;
+
+        return options;
+    }
+
+    // Hands out an empty data frame for the next publish.
+    // Clearing a heap allocated frame deletes its submessages, so instead the frame
+    // lives in an arena whose memory gets recycled before every publish.
+    // The shared_ptr aliases the arena's, so wrapping the frame doesn't allocate either.
+    void reset_publish_data_frame()
+    {
+        m_publish_data_frame.reset();
+        m_publish_arena->Reset();
+        m_publish_data_frame= DeviceOutputDataFramePtr(
+            m_publish_arena,
+            google::protobuf::Arena::CreateMessage<PSMoveProtocol::DeviceOutputDataFrame>(m_publish_arena.get()));
+    }
+
     DeviceManager &m_device_manager;
     t_connection_state_map m_connection_state_map;
+    std::vector<AsyncBluetoothRequest *> m_orphaned_bluetooth_requests;
+
+    // Indexed by PSMoveProtocol::Request_RequestType, nullptr for the types without a handler
+    t_request_handler m_request_handlers[PSMoveProtocol::Request_RequestType_RequestType_ARRAYSIZE];
+
+    // Device lists built by the last list request, until a device or one of its settings changes.
+    // Game startup and every reconnecting client ask for the same lists, so they get built once.
+    // The controller lists are indexed by include_usb_controllers.
+    PSMoveProtocol::Response_ResultControllerList m_cached_controller_lists[2];
+    int m_cached_gamepad_count[2];
+    bool m_bIsControllerListCached[2];
+    PSMoveProtocol::Response_ResultTrackerList m_cached_tracker_list;
+    bool m_bIsTrackerListCached;
+    PSMoveProtocol::Response_ResultHMDList m_cached_hmd_list;
+    bool m_bIsHMDListCached;
+
+    // Scratch state reused by every publish so the hot path doesn't allocate
+    // Comfortably fits a data frame with every optional section filled in
+    static const size_t k_publish_arena_block_size= 16*1024;
+    // Must be declared ahead of the arena, which gets constructed on top of it
+    char m_publish_arena_block[k_publish_arena_block_size];
+    std::shared_ptr<google::protobuf::Arena> m_publish_arena;
+    DeviceOutputDataFramePtr m_publish_data_frame;
+    DataFramePacketCache<ControllerStreamInfo> m_controller_packet_cache;
+    DeviceOutputDataFramePacket m_orientation_packet; // Orientation only frame of a dual rate stream
+    DeviceOutputDataFramePacket m_fixed_rate_packet;
+    DataFramePacketCache<TrackerStreamInfo> m_tracker_packet_cache;
+    DataFramePacketCache<HMDStreamInfo> m_hmd_packet_cache;
 };
 
 //-- public interface -----
+float StreamPredictionTarget::getPredictionTime(float default_prediction_time) const
+{
+    float prediction_time = default_prediction_time;
+
+    const long long now_us = ServerUtility::get_service_time_us();
+    // A fixed rate output looks ahead from its output time rather than from now
+    const long long reference_us = (output_time_us > 0) ? output_time_us : now_us;
+
+    if (is_active)
+    {
+        long long target_us = display_time_us;
+
+        // Step a periodic target forward to the next display that hasn't happened yet
+        if (display_interval_us > 0 && target_us < reference_us)
+        {
+            const long long missed_intervals = (reference_us - target_us + display_interval_us - 1) / display_interval_us;
+
+            target_us += missed_intervals * display_interval_us;
+        }
+
+        const long long delta_us = std::min(std::max(target_us - reference_us, 0LL), k_max_prediction_target_us);
+
+        prediction_time = static_cast<float>(delta_us) / 1000000.f;
+    }
+
+    if (output_time_us > 0)
+    {
+        // The output usually goes out a little after its output time, so this pulls the prediction back in.
+        // Prediction times can't go negative, an output later than the prediction covers gets the current pose.
+        prediction_time = std::max(prediction_time + static_cast<float>(output_time_us - now_us) / 1000000.f, 0.f);
+    }
+
+    return prediction_time;
+}
+
+long long StreamPredictionTarget::getServiceTimeUs() const
+{
+    return (output_time_us > 0) ? output_time_us : ServerUtility::get_service_time_us();
+}
+
 ServerRequestHandler *ServerRequestHandler::m_instance = NULL;
 
 ServerRequestHandler::ServerRequestHandler(DeviceManager *deviceManager)
@@ -3253,6 +4837,11 @@ bool ServerRequestHandler::any_active_bluetooth_requests() const
     return m_implementation_ptr->any_active_bluetooth_requests();
 }
 
+bool ServerRequestHandler::any_active_data_streams() const
+{
+    return m_implementation_ptr->any_active_data_streams();
+}
+
 bool ServerRequestHandler::startup()
 {
     m_instance= this;
@@ -3264,6 +4853,16 @@ void ServerRequestHandler::update()
     return m_implementation_ptr->update();
 }
 
+void ServerRequestHandler::publish_fixed_rate_controller_streams()
+{
+    m_implementation_ptr->publish_fixed_rate_controller_streams();
+}
+
+long long ServerRequestHandler::get_next_fixed_rate_output_time_us() const
+{
+    return m_implementation_ptr->get_next_fixed_rate_output_time_us();
+}
+
 void ServerRequestHandler::shutdown()
 {
     m_instance= NULL;
@@ -3274,6 +4873,11 @@ ResponsePtr ServerRequestHandler::handle_request(int connection_id, RequestPtr r
     return m_implementation_ptr->handle_request(connection_id, request);
 }
 
+void ServerRequestHandler::invalidate_device_list_caches()
+{
+    m_implementation_ptr->invalidate_device_list_caches();
+}
+
 void ServerRequestHandler::handle_input_data_frame(DeviceInputDataFramePtr data_frame)
 {
     return m_implementation_ptr->handle_input_data_frame(data_frame);
@@ -3286,9 +4890,10 @@ void ServerRequestHandler::handle_client_connection_stopped(int connection_id)
 
 void ServerRequestHandler::publish_controller_data_frame(
     ServerControllerView *controller_view, 
-    t_generate_controller_data_frame_for_stream callback)
+    t_generate_controller_data_frame_for_stream callback,
+    t_generate_controller_compact_pose_frame_for_stream compact_callback)
 {
-    return m_implementation_ptr->publish_controller_data_frame(controller_view, callback);
+    return m_implementation_ptr->publish_controller_data_frame(controller_view, callback, compact_callback);
 }
 
 void ServerRequestHandler::publish_tracker_data_frame(
@@ -12,6 +12,43 @@ namespace boost {
 }};
 
 // -- definitions -----
+/// Client display time that streamed poses get extrapolated to (see SET_*_DATA_STREAM_PREDICTION_TARGET)
+struct StreamPredictionTarget
+{
+    bool is_active;
+    long long display_time_us; // Service clock (high_resolution_clock) time of a client display
+    int display_interval_us; // Time between client displays, 0 for a one off display time
+    // Service time a fixed rate stream output is for (see ControllerStreamInfo::fixed_output_rate_hz), 0 for now.
+    // The pose gets extrapolated to it and the data frame stamped with it.
+    long long output_time_us;
+
+    inline void Clear()
+    {
+        is_active = false;
+        display_time_us = 0;
+        display_interval_us = 0;
+        output_time_us = 0;
+    }
+
+    inline bool operator==(const StreamPredictionTarget &other) const
+    {
+        // Inactive targets all fall back to the config prediction time
+        return
+            output_time_us == other.output_time_us &&
+            is_active == other.is_active &&
+            (!is_active ||
+             (display_time_us == other.display_time_us &&
+              display_interval_us == other.display_interval_us));
+    }
+
+    /// Seconds from now until the next targeted display, 
+    /// or default_prediction_time if no target is set
+    float getPredictionTime(float default_prediction_time) const;
+
+    /// What a data frame gets stamped with: the output time if set, otherwise now
+    long long getServiceTimeUs() const;
+};
+
 struct ControllerStreamInfo
 {
     bool include_position_data;
@@ -19,10 +56,22 @@ struct ControllerStreamInfo
     bool include_raw_sensor_data;
     bool include_calibrated_sensor_data;
     bool include_raw_tracker_data;
+    bool include_all_tracker_data;
+    bool use_packed_tracker_data;
     bool led_override_active;
 	bool disable_roi;
+    bool use_compact_pose_stream;
     int last_data_input_sequence_number;
     int selected_tracker_index;
+    StreamPredictionTarget prediction_target;
+    // Throttling only picks which updates get sent, so it isn't part of the data frame projection
+    float max_update_rate_hz;
+    bool only_send_changes;
+    // Same for picking between a full pose frame and an orientation only frame
+    bool use_dual_rate_pose_stream;
+    // When > 0 the stream ignores the controller updates and sends a pose extrapolated
+    // to each tick of its own timer instead (see publish_fixed_rate_controller_streams)
+    float fixed_output_rate_hz;
 
     inline void Clear()
     {
@@ -31,10 +80,36 @@ struct ControllerStreamInfo
         include_raw_sensor_data = false;
         include_calibrated_sensor_data= false;
         include_raw_tracker_data = false;
+        include_all_tracker_data = false;
+        use_packed_tracker_data = false;
         led_override_active = false;
 		disable_roi = false;
+        use_compact_pose_stream = false;
 		last_data_input_sequence_number = -1;
         selected_tracker_index = 0;
+        prediction_target.Clear();
+        max_update_rate_hz = 0.f;
+        only_send_changes = false;
+        use_dual_rate_pose_stream = false;
+        fixed_output_rate_hz = 0.f;
+    }
+
+    // Streams that project the device state the same way get the identical data frame.
+    // Only the settings the data frame generators read count, so connections that differ
+    // in LED override, ROI suppression, input sequence or throttling still share a frame.
+    inline bool operator==(const ControllerStreamInfo &other) const
+    {
+        return
+            include_position_data == other.include_position_data &&
+            include_physics_data == other.include_physics_data &&
+            include_raw_sensor_data == other.include_raw_sensor_data &&
+            include_calibrated_sensor_data == other.include_calibrated_sensor_data &&
+            include_raw_tracker_data == other.include_raw_tracker_data &&
+            include_all_tracker_data == other.include_all_tracker_data &&
+            (!include_raw_tracker_data || use_packed_tracker_data == other.use_packed_tracker_data) &&
+            use_compact_pose_stream == other.use_compact_pose_stream &&
+            (!include_raw_tracker_data || selected_tracker_index == other.selected_tracker_index) &&
+            prediction_target == other.prediction_target;
     }
 };
 
@@ -42,11 +117,31 @@ struct TrackerStreamInfo
 {
     bool streaming_video_data;
 	bool has_temp_settings_override;
+    // The video goes out as TRACKER_VIDEO_FRAME notifications instead of through shared memory
+    bool streaming_network_video;
+    // Index of the last network video frame sent (see TrackerNetworkVideoFrame)
+    int last_network_video_frame_index;
+    // What the shared memory video stream asked to get written into the shared memory
+    int video_preview_scale; // 1, 2 or 4
+    int video_preview_format; // eSharedVideoPixelFormat
 
     inline void Clear()
     {
         streaming_video_data = false;
 		has_temp_settings_override = false;
+        streaming_network_video = false;
+        last_network_video_frame_index = 0;
+        video_preview_scale = 1;
+        video_preview_format = 0;
+    }
+
+    // Streams with identical settings get the identical data frame.
+    // The network video bypasses the data frames.
+    inline bool operator==(const TrackerStreamInfo &other) const
+    {
+        return
+            streaming_video_data == other.streaming_video_data &&
+            has_temp_settings_override == other.has_temp_settings_override;
     }
 };
 
@@ -57,8 +152,11 @@ struct HMDStreamInfo
 	bool include_raw_sensor_data;
 	bool include_calibrated_sensor_data;
 	bool include_raw_tracker_data;
+	bool include_all_tracker_data;
+	bool use_packed_tracker_data;
 	bool disable_roi;
     int selected_tracker_index;
+    StreamPredictionTarget prediction_target;
 
     inline void Clear()
     {
@@ -67,8 +165,27 @@ struct HMDStreamInfo
 		include_raw_sensor_data = false;
 		include_calibrated_sensor_data = false;
 		include_raw_tracker_data = false;
+		include_all_tracker_data = false;
+		use_packed_tracker_data = false;
 		disable_roi = false;
         selected_tracker_index = 0;
+        prediction_target.Clear();
+    }
+
+    // Streams that project the device state the same way get the identical data frame
+    // (ROI suppression doesn't change what gets sent)
+    inline bool operator==(const HMDStreamInfo &other) const
+    {
+        return
+            include_position_data == other.include_position_data &&
+            include_physics_data == other.include_physics_data &&
+            include_raw_sensor_data == other.include_raw_sensor_data &&
+            include_calibrated_sensor_data == other.include_calibrated_sensor_data &&
+            include_raw_tracker_data == other.include_raw_tracker_data &&
+            include_all_tracker_data == other.include_all_tracker_data &&
+            (!include_raw_tracker_data || use_packed_tracker_data == other.use_packed_tracker_data) &&
+            (!include_raw_tracker_data || selected_tracker_index == other.selected_tracker_index) &&
+            prediction_target == other.prediction_target;
     }
 };
 
@@ -82,11 +199,18 @@ public:
 
     bool any_active_bluetooth_requests() const;
 
+    /// True if any connection has a controller, tracker or HMD data stream running
+    bool any_active_data_streams() const;
+
     bool startup();
     void update();
     void shutdown();
 
     ResponsePtr handle_request(int connection_id, RequestPtr request);
+
+    /// Rebuild the controller, tracker and HMD lists on the next list request.
+    /// Called whenever a device list changes.
+    void invalidate_device_list_caches();
     void handle_input_data_frame(DeviceInputDataFramePtr data_frame);
     void handle_client_connection_stopped(int connection_id);
 
@@ -99,8 +223,24 @@ public:
             const class ServerControllerView *controller_view,
             const ControllerStreamInfo *stream_info,
             PSMoveProtocol::DeviceOutputDataFrame *data_frame);
+    /// Streams started with use_compact_pose_stream get a fixed layout pose frame from this callback instead.
+    /// Returns false if the controller can't be streamed that way, in which case the protobuf frame is sent.
+    typedef bool (*t_generate_controller_compact_pose_frame_for_stream)(
+            const class ServerControllerView *controller_view,
+            const ControllerStreamInfo *stream_info,
+            struct CompactControllerPoseFrame *pose_frame);
     void publish_controller_data_frame(
-        class ServerControllerView *controller_view, t_generate_controller_data_frame_for_stream callback);
+        class ServerControllerView *controller_view,
+        t_generate_controller_data_frame_for_stream callback,
+        t_generate_controller_compact_pose_frame_for_stream compact_callback);
+
+    /// Sends the controller streams started with a fixed output rate whose next output is due.
+    /// Called every update, after the devices published their new state.
+    void publish_fixed_rate_controller_streams();
+
+    /// Service time the next fixed rate stream output is due (possibly in the past), -1 if there are none.
+    /// The main loop wakes up for it.
+    long long get_next_fixed_rate_output_time_us() const;
 
     /// When publishing tracker data to all listening connections
     /// we need to provide a callback that will fill out a data frame given:
@@ -0,0 +1,353 @@
+//-- includes -----
+#include "ServerTrace.h"
+#include "ServerUtility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdint.h>
+#include <vector>
+
+//-- constants -----
+static const char *k_trace_stage_names[ServerTraceStage_COUNT] = {
+    "tick",
+    "hid_read",
+    "frame_grab",
+    "debayer",
+    "hsv",
+    "contour",
+    "pose_fit",
+    "filter_update",
+    "serialize",
+    "udp_send",
+};
+
+//-- private definitions -----
+// Single producer ring of events owned by one thread.
+// Each event is two relaxed atomic words so the exporting thread can copy a slot
+// while it gets overwritten, it just throws away any slot that may have been torn.
+struct TraceThreadBuffer
+{
+    TraceThreadBuffer(int thread_id)
+        : tid(thread_id)
+        , thread_name()
+        , write_count(0)
+        , bRetired(false)
+    {
+        for (int word_index = 0; word_index < SERVER_TRACE_EVENTS_PER_THREAD*2; ++word_index)
+        {
+            words[word_index].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    const int tid;
+    std::string thread_name; // Guarded by the registry mutex
+    std::atomic<uint64_t> write_count;
+    std::atomic<bool> bRetired; // Owning thread exited, drop the buffer after its next export
+    std::atomic<uint64_t> words[SERVER_TRACE_EVENTS_PER_THREAD*2]; // start_us, packed stage/ids/duration
+};
+typedef std::shared_ptr<TraceThreadBuffer> TraceThreadBufferPtr;
+
+struct TraceRegistry
+{
+    TraceRegistry()
+        : next_tid(1)
+    {
+        bEnabled.store(true);
+    }
+
+    std::mutex mutex;
+    std::vector<TraceThreadBufferPtr> buffers;
+    int next_tid;
+    std::atomic<bool> bEnabled;
+};
+
+// Keeps the calling thread's buffer alive and flags it as retired on thread exit
+class TraceThreadBufferHandle
+{
+public:
+    ~TraceThreadBufferHandle()
+    {
+        if (buffer)
+        {
+            buffer->bRetired.store(true);
+        }
+    }
+
+    TraceThreadBufferPtr buffer;
+};
+
+// Decoded copy of one recorded event
+struct TraceEventRecord
+{
+    long long start_us;
+    long long duration_us;
+    int stage;
+    int device_id;
+    int tracker_id;
+};
+
+//-- private methods -----
+static TraceRegistry &get_trace_registry()
+{
+    // Function local so it exists before any static constructor can record an event
+    static TraceRegistry registry;
+    return registry;
+}
+
+static thread_local TraceThreadBufferHandle t_trace_buffer_handle;
+
+static TraceThreadBuffer *get_thread_trace_buffer()
+{
+    if (!t_trace_buffer_handle.buffer)
+    {
+        TraceRegistry &registry = get_trace_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        t_trace_buffer_handle.buffer = std::make_shared<TraceThreadBuffer>(registry.next_tid);
+        ++registry.next_tid;
+        registry.buffers.push_back(t_trace_buffer_handle.buffer);
+    }
+
+    return t_trace_buffer_handle.buffer.get();
+}
+
+// Copies out the events of a thread buffer that started at or after min_start_us.
+// Skips any event the owning thread may have lapped while we were copying.
+static void copy_thread_trace_events(
+    const TraceThreadBuffer &buffer,
+    const long long min_start_us,
+    std::vector<TraceEventRecord> &out_events)
+{
+    const uint64_t end_index = buffer.write_count.load(std::memory_order_acquire);
+    const uint64_t begin_index =
+        (end_index > SERVER_TRACE_EVENTS_PER_THREAD) ? end_index - SERVER_TRACE_EVENTS_PER_THREAD : 0;
+    std::vector<uint64_t> event_words;
+
+    event_words.reserve(static_cast<size_t>(end_index - begin_index)*2);
+    for (uint64_t event_index = begin_index; event_index < end_index; ++event_index)
+    {
+        const int slot = static_cast<int>(event_index % SERVER_TRACE_EVENTS_PER_THREAD);
+
+        event_words.push_back(buffer.words[slot*2].load(std::memory_order_relaxed));
+        event_words.push_back(buffer.words[slot*2 + 1].load(std::memory_order_relaxed));
+    }
+
+    // Any event the owning thread may have lapped while we were copying is unreliable
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t final_count = buffer.write_count.load(std::memory_order_relaxed);
+
+    out_events.clear();
+    for (uint64_t event_index = begin_index; event_index < end_index; ++event_index)
+    {
+        if (event_index + SERVER_TRACE_EVENTS_PER_THREAD <= final_count)
+        {
+            continue;
+        }
+
+        const size_t word_index = static_cast<size_t>(event_index - begin_index)*2;
+        const uint64_t packed = event_words[word_index + 1];
+        TraceEventRecord event;
+
+        event.start_us = static_cast<long long>(event_words[word_index]);
+        event.duration_us = static_cast<long long>(packed & 0xffffffff);
+        event.stage = static_cast<int>((packed >> 32) & 0xff);
+        event.device_id = static_cast<int>((packed >> 40) & 0xff) - 1;
+        event.tracker_id = static_cast<int>((packed >> 48) & 0xff) - 1;
+
+        if (event.start_us >= min_start_us && event.stage < ServerTraceStage_COUNT)
+        {
+            out_events.push_back(event);
+        }
+    }
+}
+
+static void append_json_escaped(std::ostringstream &stream, const std::string &text)
+{
+    for (const char ch : text)
+    {
+        if (ch == '"' || ch == '\\')
+        {
+            stream << '\\' << ch;
+        }
+        else if (static_cast<unsigned char>(ch) >= 0x20)
+        {
+            stream << ch;
+        }
+    }
+}
+
+//-- public interface -----
+namespace ServerTrace
+{
+    void set_enabled(bool bEnabled)
+    {
+        get_trace_registry().bEnabled.store(bEnabled);
+    }
+
+    bool get_enabled()
+    {
+        return get_trace_registry().bEnabled.load(std::memory_order_relaxed);
+    }
+
+    void set_current_thread_name(const char *thread_name)
+    {
+        TraceThreadBuffer *buffer = get_thread_trace_buffer();
+        TraceRegistry &registry = get_trace_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        buffer->thread_name = thread_name;
+    }
+
+    void record_event(eServerTraceStage stage, int device_id, int tracker_id, long long start_us, long long end_us)
+    {
+        if (!get_enabled())
+        {
+            return;
+        }
+
+        TraceThreadBuffer *buffer = get_thread_trace_buffer();
+        const uint64_t event_index = buffer->write_count.load(std::memory_order_relaxed);
+        const int slot = static_cast<int>(event_index % SERVER_TRACE_EVENTS_PER_THREAD);
+
+        const long long duration_us = (end_us > start_us) ? end_us - start_us : 0;
+        const uint64_t packed =
+            (static_cast<uint64_t>(duration_us < 0xffffffffLL ? duration_us : 0xffffffffLL)) |
+            (static_cast<uint64_t>(stage & 0xff) << 32) |
+            (static_cast<uint64_t>((device_id + 1) & 0xff) << 40) |
+            (static_cast<uint64_t>((tracker_id + 1) & 0xff) << 48);
+
+        buffer->words[slot*2].store(static_cast<uint64_t>(start_us), std::memory_order_relaxed);
+        buffer->words[slot*2 + 1].store(packed, std::memory_order_relaxed);
+        buffer->write_count.store(event_index + 1, std::memory_order_release);
+    }
+
+    int export_chrome_trace_json(long long window_us, std::string &out_json)
+    {
+        const long long min_start_us = (window_us > 0) ? ServerUtility::get_service_time_us() - window_us : 0;
+        TraceRegistry &registry = get_trace_registry();
+        std::vector<TraceThreadBufferPtr> buffers;
+        std::vector<std::string> thread_names;
+
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+
+            buffers = registry.buffers;
+            for (const TraceThreadBufferPtr &buffer : buffers)
+            {
+                thread_names.push_back(buffer->thread_name);
+            }
+
+            // Buffers of threads that have exited only need to be exported one last time
+            registry.buffers.erase(
+                std::remove_if(
+                    registry.buffers.begin(), registry.buffers.end(),
+                    [](const TraceThreadBufferPtr &buffer) { return buffer->bRetired.load(); }),
+                registry.buffers.end());
+        }
+
+        std::ostringstream json;
+        std::vector<TraceEventRecord> events;
+        int event_count = 0;
+
+        json << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        for (size_t buffer_index = 0; buffer_index < buffers.size(); ++buffer_index)
+        {
+            const TraceThreadBuffer &buffer = *buffers[buffer_index];
+
+            copy_thread_trace_events(buffer, min_start_us, events);
+
+            if (event_count > 0 || buffer_index > 0)
+            {
+                json << ",";
+            }
+            json << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer.tid << ",\"args\":{\"name\":\"";
+            append_json_escaped(json, thread_names[buffer_index].empty() ? std::string("Thread") : thread_names[buffer_index]);
+            json << "\"}}";
+
+            for (const TraceEventRecord &event : events)
+            {
+                json << ",{\"name\":\"" << k_trace_stage_names[event.stage] << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer.tid
+                    << ",\"ts\":" << event.start_us << ",\"dur\":" << event.duration_us;
+                if (event.device_id >= 0 || event.tracker_id >= 0)
+                {
+                    json << ",\"args\":{";
+                    if (event.device_id >= 0)
+                    {
+                        json << "\"device_id\":" << event.device_id;
+                    }
+                    if (event.tracker_id >= 0)
+                    {
+                        json << (event.device_id >= 0 ? "," : "") << "\"tracker_id\":" << event.tracker_id;
+                    }
+                    json << "}";
+                }
+                json << "}";
+
+                ++event_count;
+            }
+        }
+        json << "]}";
+
+        out_json = json.str();
+
+        return event_count;
+    }
+
+    int sum_stage_durations(long long since_us, ServerTraceStageTotals out_totals[ServerTraceStage_COUNT])
+    {
+        TraceRegistry &registry = get_trace_registry();
+        std::vector<TraceThreadBufferPtr> buffers;
+        std::vector<TraceEventRecord> events;
+        int event_count = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+
+            buffers = registry.buffers;
+        }
+
+        for (int stage_index = 0; stage_index < ServerTraceStage_COUNT; ++stage_index)
+        {
+            out_totals[stage_index].total_duration_us = 0;
+            out_totals[stage_index].event_count = 0;
+        }
+
+        for (const TraceThreadBufferPtr &buffer : buffers)
+        {
+            copy_thread_trace_events(*buffer, since_us, events);
+
+            for (const TraceEventRecord &event : events)
+            {
+                out_totals[event.stage].total_duration_us += event.duration_us;
+                ++out_totals[event.stage].event_count;
+                ++event_count;
+            }
+        }
+
+        return event_count;
+    }
+
+    const char *get_stage_name(eServerTraceStage stage)
+    {
+        return (stage >= 0 && stage < ServerTraceStage_COUNT) ? k_trace_stage_names[stage] : "unknown";
+    }
+
+    Scope::Scope(eServerTraceStage stage, int device_id, int tracker_id)
+        : m_start_us(get_enabled() ? ServerUtility::get_service_time_us() : -1)
+        , m_stage(stage)
+        , m_device_id(device_id)
+        , m_tracker_id(tracker_id)
+    {
+    }
+
+    Scope::~Scope()
+    {
+        if (m_start_us >= 0)
+        {
+            record_event(m_stage, m_device_id, m_tracker_id, m_start_us, ServerUtility::get_service_time_us());
+        }
+    }
+};
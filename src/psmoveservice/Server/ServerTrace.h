@@ -0,0 +1,100 @@
+#ifndef SERVER_TRACE_H
+#define SERVER_TRACE_H
+
+//-- includes -----
+#include <string>
+
+//-- constants -----
+// Build with PSMOVESERVICE_ENABLE_TRACING=0 to compile every trace scope out of the service
+#ifndef PSMOVESERVICE_ENABLE_TRACING
+#define PSMOVESERVICE_ENABLE_TRACING 1
+#endif
+
+// Number of events each thread keeps before the oldest ones get overwritten
+#define SERVER_TRACE_EVENTS_PER_THREAD 8192
+
+enum eServerTraceStage
+{
+    ServerTraceStage_Tick,          // One iteration of the service main loop
+    ServerTraceStage_HIDRead,       // Reading a sensor packet from a HID device
+    ServerTraceStage_FrameGrab,     // Polling a tracker for a new video frame
+    ServerTraceStage_Debayer,       // Demosaicing (part of) a raw Bayer frame
+    ServerTraceStage_HSV,           // Converting to HSV / computing a color mask
+    ServerTraceStage_Contour,       // Extracting the blob or contours from a color mask
+    ServerTraceStage_PoseFit,       // Fitting a tracking shape to a contour
+    ServerTraceStage_FilterUpdate,  // Applying sensor packets to a pose filter
+    ServerTraceStage_Serialize,     // Building and packing the data frames of a device
+    ServerTraceStage_UDPSend,       // Handing a data frame datagram to the socket
+
+    ServerTraceStage_COUNT
+};
+
+/// Summed durations of the recorded events of one stage
+struct ServerTraceStageTotals
+{
+    long long total_duration_us;
+    int event_count;
+};
+
+//-- interface -----
+/// Lightweight per-stage timing of the service pipeline.
+/**
+ Every thread records into its own fixed size ring buffer, so recording an event
+ never takes a lock or allocates (after the first event on a thread).
+ The buffers can be exported at any time from the main thread as Chrome trace JSON
+ (load the output in chrome://tracing or https://ui.perfetto.dev).
+ */
+namespace ServerTrace
+{
+    /// Turns event recording on or off at runtime (on by default)
+    void set_enabled(bool bEnabled);
+    bool get_enabled();
+
+    /// Names the current thread in the exported trace
+    void set_current_thread_name(const char *thread_name);
+
+    /// Records a completed stage. device_id and tracker_id are -1 when not applicable.
+    void record_event(eServerTraceStage stage, int device_id, int tracker_id, long long start_us, long long end_us);
+
+    /// Writes the recorded events of every thread as a Chrome trace (JSON object format).
+    /// Only events in the last window_us microseconds are exported (everything if window_us <= 0).
+    /// Returns the number of exported events.
+    int export_chrome_trace_json(long long window_us, std::string &out_json);
+
+    /// Sums the durations of the recorded events of every thread that started at or after since_us, per stage.
+    /// Events that were already overwritten in the ring buffers are missed, so poll often enough.
+    /// Returns the number of summed events.
+    int sum_stage_durations(long long since_us, ServerTraceStageTotals out_totals[ServerTraceStage_COUNT]);
+
+    const char *get_stage_name(eServerTraceStage stage);
+
+    /// Times the enclosing scope
+    class Scope
+    {
+    public:
+        Scope(eServerTraceStage stage, int device_id = -1, int tracker_id = -1);
+        ~Scope();
+
+    private:
+        long long m_start_us;
+        eServerTraceStage m_stage;
+        int m_device_id;
+        int m_tracker_id;
+    };
+};
+
+//-- macros -----
+#define SERVER_TRACE_CONCAT_INNER(a, b) a ## b
+#define SERVER_TRACE_CONCAT(a, b) SERVER_TRACE_CONCAT_INNER(a, b)
+
+#if PSMOVESERVICE_ENABLE_TRACING
+#define SERVER_TRACE_SCOPE(stage) ServerTrace::Scope SERVER_TRACE_CONCAT(_trace_scope_, __LINE__)(stage)
+#define SERVER_TRACE_DEVICE_SCOPE(stage, device_id) ServerTrace::Scope SERVER_TRACE_CONCAT(_trace_scope_, __LINE__)(stage, device_id)
+#define SERVER_TRACE_TRACKER_SCOPE(stage, device_id, tracker_id) ServerTrace::Scope SERVER_TRACE_CONCAT(_trace_scope_, __LINE__)(stage, device_id, tracker_id)
+#else
+#define SERVER_TRACE_SCOPE(stage)
+#define SERVER_TRACE_DEVICE_SCOPE(stage, device_id)
+#define SERVER_TRACE_TRACKER_SCOPE(stage, device_id, tracker_id)
+#endif
+
+#endif // SERVER_TRACE_H
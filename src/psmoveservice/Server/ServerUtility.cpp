@@ -5,13 +5,16 @@
 #include <string.h>
 #include <assert.h>
 #include <stdarg.h>
+#include <stdio.h>
 #include <locale>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <chrono>
 
 #if defined WIN32 || defined _WIN32 || defined WINCE
     #include <windows.h>
+    #include <avrt.h>
     #include <algorithm>
 
     #ifdef _MSC_VER
@@ -20,7 +23,14 @@
     #endif
 #else
 	#include <sys/time.h>
+	#include <sys/resource.h>
 	#include <time.h>
+	#include <pthread.h>
+	#include <sched.h>
+	#if defined __linux__
+		#include <sys/syscall.h>
+		#include <unistd.h>
+	#endif
 	#if defined __MACH__ && defined __APPLE__
 		#include <mach/mach.h>
 		#include <mach/mach_time.h>
@@ -28,6 +38,48 @@
     #define MILLISECONDS_TO_NANOSECONDS 1000000
 #endif
 
+// -- private methods -----
+// Parses a core list like "0,2-3" into a bit mask of at most 64 cores
+static bool parse_cpu_core_mask(const std::string &cpu_cores, unsigned long long &out_mask)
+{
+    std::stringstream stream(cpu_cores);
+    std::string token;
+
+    out_mask = 0;
+
+    while (std::getline(stream, token, ','))
+    {
+        int first_core = -1;
+        int last_core = -1;
+        char trailing = 0;
+
+        if (sscanf(token.c_str(), " %d - %d %c", &first_core, &last_core, &trailing) == 2 ||
+            sscanf(token.c_str(), " %d %c", &first_core, &trailing) == 1)
+        {
+            if (last_core < 0)
+            {
+                last_core = first_core;
+            }
+
+            if (first_core < 0 || last_core < first_core || last_core >= 64)
+            {
+                return false;
+            }
+
+            for (int core = first_core; core <= last_core; ++core)
+            {
+                out_mask |= 1ull << core;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return out_mask != 0;
+}
+
 // -- public methods -----
 namespace ServerUtility
 {
@@ -241,6 +293,100 @@ namespace ServerUtility
     }
 #endif
 
+    bool set_current_thread_cpu_affinity(const std::string &cpu_cores)
+    {
+        if (cpu_cores.empty())
+        {
+            return true;
+        }
+
+        unsigned long long core_mask = 0;
+
+        if (!parse_cpu_core_mask(cpu_cores, core_mask))
+        {
+            return false;
+        }
+
+#if defined WIN32 || defined _WIN32 || defined WINCE
+        return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(core_mask)) != 0;
+#elif defined __linux__
+        cpu_set_t cpu_set;
+
+        CPU_ZERO(&cpu_set);
+        for (int core = 0; core < 64; ++core)
+        {
+            if ((core_mask & (1ull << core)) != 0)
+            {
+                CPU_SET(core, &cpu_set);
+            }
+        }
+
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+        // Only affinity hints exist on osx
+        return false;
+#endif
+    }
+
+    bool set_current_thread_priority(const std::string &priority)
+    {
+        bool bSuccess = false;
+
+        if (priority.empty() || priority == "normal")
+        {
+#if defined WIN32 || defined _WIN32 || defined WINCE
+            // Windows threads don't inherit the creator's priority
+            bSuccess = true;
+#else
+            struct sched_param param = {0};
+            int policy = SCHED_OTHER;
+
+            bSuccess = true;
+            if (pthread_getschedparam(pthread_self(), &policy, &param) == 0 && policy != SCHED_OTHER)
+            {
+                param.sched_priority = 0;
+                bSuccess = pthread_setschedparam(pthread_self(), SCHED_OTHER, &param) == 0;
+            }
+#endif
+        }
+        else if (priority == "high")
+        {
+#if defined WIN32 || defined _WIN32 || defined WINCE
+            bSuccess = SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST) != 0;
+#elif defined __linux__
+            // Linux nice values are per thread
+            bSuccess = setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), -10) == 0;
+#else
+            struct sched_param param = {0};
+            param.sched_priority = sched_get_priority_max(SCHED_OTHER);
+            bSuccess = pthread_setschedparam(pthread_self(), SCHED_OTHER, &param) == 0;
+#endif
+        }
+        else if (priority == "realtime")
+        {
+#if defined WIN32 || defined _WIN32 || defined WINCE
+            // MMCSS boosts the thread while it's runnable without starving the rest of the system
+            DWORD task_index = 0;
+
+            if (AvSetMmThreadCharacteristicsA("Games", &task_index) != NULL)
+            {
+                bSuccess = true;
+            }
+            else
+            {
+                bSuccess = SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0;
+            }
+#else
+            // Stay low in the FIFO range, below the kernel's own interrupt threads
+            struct sched_param param = {0};
+            param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 10;
+            bSuccess = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+#endif
+        }
+
+        return bSuccess;
+    }
+
     void sleep_ms(int milliseconds)
     {
 #ifdef _MSC_VER
@@ -252,4 +398,10 @@ namespace ServerUtility
         nanosleep(&req, (struct timespec *)NULL);
 #endif
     }	
+
+    long long get_service_time_us()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+    }
 };
\ No newline at end of file
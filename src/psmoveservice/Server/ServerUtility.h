@@ -54,8 +54,97 @@ namespace ServerUtility
     /// Sets the name of the current thread
     void set_current_thread_name(const char* thread_name);
 
+    /// Pins the current thread to a set of cores
+    /// \param cpu_cores Comma separated core indices and ranges, ex) "2,4-5". An empty string leaves the affinity alone.
+    /// \return false if the list doesn't parse or the OS refused (osx has no hard affinity)
+    bool set_current_thread_cpu_affinity(const std::string &cpu_cores);
+
+    /// Sets the scheduling class of the current thread
+    /// \param priority "normal" (back to the default scheduler if the thread inherited a realtime class),
+    ///   "high" (raised priority in the normal scheduler)
+    ///   or "realtime" (SCHED_FIFO on linux/osx, an MMCSS "Games" task on windows)
+    /// \return false for an unknown name or if the OS refused (elevated classes usually need extra rights)
+    bool set_current_thread_priority(const std::string &priority);
+
     /// Sleeps the current thread for the given number of milliseconds
     void sleep_ms(int milliseconds);	
+
+    /// Current time on the service clock (high_resolution_clock) in microseconds.
+    /// Data frame time stamps and clock sync replies use this time base.
+    long long get_service_time_us();
+
+    /// Sequence number for the next output of a stream that can send more often than the device publishes
+    /// (fixed rate controller streams): the device's sequence number if a publish moved it past the stream's last output,
+    /// otherwise one past the last output. Clients drop frames that don't beat the last sequence number they saw,
+    /// so outputs that share one device update still need numbers of their own.
+    inline int next_stream_output_sequence_number(const int last_output_sequence_number, const int device_sequence_number)
+    {
+        return
+            (device_sequence_number > last_output_sequence_number)
+            ? device_sequence_number
+            : last_output_sequence_number + 1;
+    }
+};
+
+//-- definitions -----
+/// Turns a running count of events into an events per second rate.
+/// The rate is refreshed once per sample window, so it reads the same between refreshes.
+/// Not thread safe: count and query from the same thread.
+class ServerRateCounter
+{
+public:
+    ServerRateCounter(long long window_us = 1000000)
+        : m_window_us(window_us)
+        , m_window_start_us(-1)
+        , m_window_event_count(0)
+        , m_event_total(0)
+        , m_rate_per_second(0.f)
+    {
+    }
+
+    inline void addEvents(int event_count = 1)
+    {
+        refresh();
+        m_window_event_count += event_count;
+        m_event_total += event_count;
+    }
+
+    /// Events per second over the last completed window
+    inline float getRatePerSecond()
+    {
+        refresh();
+        return m_rate_per_second;
+    }
+
+    /// Events counted since construction
+    inline long long getEventTotal() const
+    {
+        return m_event_total;
+    }
+
+private:
+    inline void refresh()
+    {
+        const long long now_us = ServerUtility::get_service_time_us();
+
+        if (m_window_start_us < 0)
+        {
+            m_window_start_us = now_us;
+        }
+        else if (now_us - m_window_start_us >= m_window_us)
+        {
+            m_rate_per_second =
+                static_cast<float>(static_cast<double>(m_window_event_count)*1000000.0 / static_cast<double>(now_us - m_window_start_us));
+            m_window_event_count = 0;
+            m_window_start_us = now_us;
+        }
+    }
+
+    long long m_window_us;
+    long long m_window_start_us;
+    long long m_window_event_count;
+    long long m_event_total;
+    float m_rate_per_second;
 };
 
 #endif // SERVER_REQUEST_HANDLER_H
\ No newline at end of file
@@ -42,6 +42,13 @@ public:
 		out_object= *getReadPtr();
 	}
 
+	// Read the latest value in place instead of copying all of it.
+	// The object stays valid until the reader's next fetch.
+	const t_object_type &fetchValueRef()
+	{
+		return *getReadPtr();
+	}
+
 protected:
     t_object_type *writeBegin() 
 	{
@@ -72,6 +79,13 @@ protected:
         m_write_index = -1;
     }
 
+    // Give the slot from writeBegin() back without publishing it
+    void writeCancel()
+    {
+        assert(m_write_index != -1);
+        m_write_index = -1;
+    }
+
     t_object_type *getReadPtr() 
 	{
         m_inUseIndex.store(m_activeIndex.load());
@@ -89,4 +103,62 @@ private:
     AtomicObject &operator=(const AtomicObject &copy) = delete;
 };
 
+// Bounded lock free single-producer/single-consumer queue.
+// Unlike AtomicObject every value written is read exactly once,
+// so a consumer that falls behind drains a backlog instead of skipping to the latest value.
+// One slot is kept empty to tell a full queue from an empty one.
+template<typename t_object_type, int k_capacity>
+class AtomicQueue
+{
+public:
+    AtomicQueue()
+    {
+        static_assert(k_capacity > 1, "AtomicQueue capacity must be greater than one");
+
+        m_readIndex = 0;
+        m_writeIndex = 0;
+    }
+
+    // Producer thread only. Returns false if the queue is full.
+    bool tryEnqueue(const t_object_type &object)
+    {
+        const int write_index = m_writeIndex.load(std::memory_order_relaxed);
+        const int next_write_index = (write_index + 1) % k_capacity;
+
+        if (next_write_index == m_readIndex.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        m_objects[write_index] = object;
+        m_writeIndex.store(next_write_index, std::memory_order_release);
+
+        return true;
+    }
+
+    // Consumer thread only. Returns false if the queue is empty.
+    bool tryDequeue(t_object_type &out_object)
+    {
+        const int read_index = m_readIndex.load(std::memory_order_relaxed);
+
+        if (read_index == m_writeIndex.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        out_object = m_objects[read_index];
+        m_readIndex.store((read_index + 1) % k_capacity, std::memory_order_release);
+
+        return true;
+    }
+
+private:
+    t_object_type m_objects[k_capacity];
+    std::atomic_int m_readIndex;
+    std::atomic_int m_writeIndex;
+
+    AtomicQueue(const AtomicQueue &copy) = delete;
+    AtomicQueue &operator=(const AtomicQueue &copy) = delete;
+};
+
 #endif // ATOMIC_PRIMITIVES_H
@@ -0,0 +1,82 @@
+#ifndef CIRCULAR_BUFFER_H
+#define CIRCULAR_BUFFER_H
+
+#include <assert.h>
+
+// Fixed capacity ring buffer used for device state histories.
+// Pushing onto a full buffer overwrites the oldest entry,
+// so there is never any allocation or shuffling of entries after construction.
+template<typename t_object_type, int k_capacity>
+class CircularBuffer
+{
+public:
+    CircularBuffer()
+        : m_headIndex(0)
+        , m_size(0)
+    {
+        static_assert(k_capacity > 0, "CircularBuffer capacity must be positive");
+    }
+
+    inline int size() const
+    {
+        return m_size;
+    }
+
+    inline int capacity() const
+    {
+        return k_capacity;
+    }
+
+    inline bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    void clear()
+    {
+        m_headIndex = 0;
+        m_size = 0;
+    }
+
+    void push_back(const t_object_type &object)
+    {
+        m_objects[m_headIndex] = object;
+        m_headIndex = (m_headIndex + 1) % k_capacity;
+
+        if (m_size < k_capacity)
+        {
+            ++m_size;
+        }
+    }
+
+    // Drops the newest entry
+    void pop_back()
+    {
+        assert(m_size > 0);
+        m_headIndex = (m_headIndex - 1 + k_capacity) % k_capacity;
+        --m_size;
+    }
+
+    // Returns the entry pushed lookBack pushes ago (0 = newest)
+    // or nullptr if the buffer doesn't hold that many entries
+    const t_object_type *getFromNewest(int lookBack) const
+    {
+        const t_object_type *result = nullptr;
+
+        if (lookBack >= 0 && lookBack < m_size)
+        {
+            const int index = (m_headIndex - lookBack - 1 + k_capacity) % k_capacity;
+
+            result = &m_objects[index];
+        }
+
+        return result;
+    }
+
+private:
+    t_object_type m_objects[k_capacity];
+    int m_headIndex; // Slot the next push will write to
+    int m_size;
+};
+
+#endif // CIRCULAR_BUFFER_H
@@ -0,0 +1,148 @@
+#ifndef COALESCED_OUTPUT_WRITER_H
+#define COALESCED_OUTPUT_WRITER_H
+
+//-- includes -----
+#include "WorkerThread.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+//-- definitions -----
+/// Sends the output state (LEDs, rumble) of a device from its own thread.
+/**
+ The main thread posts the latest output state whenever it changes. The writer thread merges
+ everything posted since its last write and sends at most one output report per write interval,
+ so a burst of LED and rumble changes costs a single report and never holds up the input reads.
+ Devices that turn their outputs off unless they keep hearing from the host can ask for
+ the last written state to be resent every keepalive interval.
+ */
+template <class t_output_state>
+class CoalescedOutputWriter : public WorkerThread
+{
+public:
+    CoalescedOutputWriter(const std::string &thread_name)
+        : WorkerThread(thread_name)
+        , m_writeIntervalMs(0)
+        , m_keepaliveIntervalMs(0)
+        , m_bHasPendingState(false)
+        , m_bHasWrittenState(false)
+        , m_lastWriteTimestamp()
+    {
+    }
+
+    // A keepalive interval of zero only writes when the state changes
+    void setIntervals(int write_interval_ms, int keepalive_interval_ms)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_writeIntervalMs = write_interval_ms;
+        m_keepaliveIntervalMs = keepalive_interval_ms;
+    }
+
+    // Main thread. Replaces whatever state was posted since the last write.
+    void postOutputState(const t_output_state &output_state)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_pendingState = output_state;
+            m_bHasPendingState = true;
+        }
+        m_condition.notify_one();
+    }
+
+protected:
+    // Writer thread. Sends the output report, returns false if the write failed.
+    virtual bool writeOutputState(const t_output_state &output_state) = 0;
+
+    // Writer thread. True if the device needs to keep being sent this state to hold it.
+    virtual bool getNeedsKeepalive(const t_output_state &output_state) const
+    {
+        return false;
+    }
+
+    void onThreadHaltBegin() override
+    {
+        // Taking the lock makes sure the writer thread is either waiting or will see the exit flag
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+        }
+        m_condition.notify_all();
+    }
+
+    bool doWork() override
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_exitSignaled)
+        {
+            return false;
+        }
+
+        const std::chrono::time_point<std::chrono::high_resolution_clock> now = std::chrono::high_resolution_clock::now();
+        std::chrono::time_point<std::chrono::high_resolution_clock> next_write_time = now;
+        bool bHasWrite = false;
+
+        if (m_bHasPendingState)
+        {
+            next_write_time = m_lastWriteTimestamp + std::chrono::milliseconds(m_writeIntervalMs);
+            bHasWrite = true;
+        }
+        else if (m_keepaliveIntervalMs > 0 && m_bHasWrittenState && getNeedsKeepalive(m_writtenState))
+        {
+            next_write_time = m_lastWriteTimestamp + std::chrono::milliseconds(m_keepaliveIntervalMs);
+            bHasWrite = true;
+        }
+
+        if (!bHasWrite)
+        {
+            // Nothing to do until the next post (or the exit request)
+            m_condition.wait(lock);
+            return true;
+        }
+
+        if (now < next_write_time)
+        {
+            // A post that comes in meanwhile only gets merged into the pending state
+            m_condition.wait_until(lock, next_write_time);
+            return true;
+        }
+
+        const t_output_state output_state = m_bHasPendingState ? m_pendingState : m_writtenState;
+        m_bHasPendingState = false;
+
+        lock.unlock();
+        const bool bWritten = writeOutputState(output_state);
+        lock.lock();
+
+        // Failed writes also wait out the interval before retrying
+        m_lastWriteTimestamp = now;
+
+        if (bWritten)
+        {
+            m_writtenState = output_state;
+            m_bHasWrittenState = true;
+        }
+        else if (!m_bHasPendingState)
+        {
+            m_pendingState = output_state;
+            m_bHasPendingState = true;
+        }
+
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    int m_writeIntervalMs;
+    int m_keepaliveIntervalMs;
+    t_output_state m_pendingState;
+    bool m_bHasPendingState;
+    t_output_state m_writtenState;
+    bool m_bHasWrittenState;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastWriteTimestamp;
+};
+
+#endif // COALESCED_OUTPUT_WRITER_H
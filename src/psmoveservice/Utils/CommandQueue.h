@@ -0,0 +1,67 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+//-- includes -----
+#include <functional>
+#include <mutex>
+#include <vector>
+
+//-- definitions -----
+/// Commands posted from any thread, run later by the one thread that owns the queue.
+/**
+ Posting takes a short lock to append to the pending list. The owner swaps the whole list out
+ under the same lock and runs the commands without holding it, so a command can post more
+ commands (they run on the next runPending()).
+ */
+class CommandQueue
+{
+public:
+    typedef std::function<void()> t_command;
+
+    CommandQueue()
+        : m_pending_commands()
+        , m_running_commands()
+    {
+    }
+
+    /// Safe to call from any thread
+    void post(const t_command &command)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pending_commands.push_back(command);
+    }
+
+    /// Owner thread only. Runs the commands posted so far in the order they got posted.
+    /// Returns the number of commands run.
+    int runPending()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_running_commands.swap(m_pending_commands);
+        }
+
+        const int command_count = static_cast<int>(m_running_commands.size());
+
+        for (const t_command &command : m_running_commands)
+        {
+            command();
+        }
+
+        // Keeps its capacity for the next swap
+        m_running_commands.clear();
+
+        return command_count;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<t_command> m_pending_commands; // guarded by m_mutex
+    std::vector<t_command> m_running_commands; // owner thread only
+
+    CommandQueue(const CommandQueue &copy) = delete;
+    CommandQueue &operator=(const CommandQueue &copy) = delete;
+};
+
+#endif // COMMAND_QUEUE_H
@@ -0,0 +1,289 @@
+//-- includes -----
+#include "ThreadPool.h"
+#include "ServerLog.h"
+#include "ServerTrace.h"
+#include "ServerUtility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-- constants -----
+// Upper bound on the worker count when picking one automatically
+static const int k_max_auto_worker_count = 8;
+
+//-- private definitions -----
+struct ThreadPoolTaskQueue
+{
+    std::mutex mutex;
+    std::deque< std::function<void()> > tasks;
+};
+
+class ThreadPoolImpl
+{
+public:
+    ThreadPoolImpl(int worker_count, const std::string &worker_cpu_cores, const std::string &worker_priority)
+        : m_workerCpuCores(worker_cpu_cores)
+        , m_workerPriority(worker_priority)
+        , m_queues(worker_count + 1) // Last queue is used when there are no workers
+        , m_nextQueueIndex(0)
+        , m_pendingTaskCount({ 0 })
+        , m_queuedTaskCount({ 0 })
+        , m_bExitSignaled({ false })
+    {
+        for (int worker_index = 0; worker_index < worker_count; ++worker_index)
+        {
+            m_workers.push_back(std::thread(&ThreadPoolImpl::workerFunc, this, worker_index));
+        }
+    }
+
+    ~ThreadPoolImpl()
+    {
+        // Don't leave anybody's work half done
+        waitForAll();
+
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_bExitSignaled.store(true);
+        }
+        m_wakeCondition.notify_all();
+
+        for (std::thread &worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    inline int getWorkerCount() const
+    {
+        return static_cast<int>(m_workers.size());
+    }
+
+    void submit(const std::function<void()> &task)
+    {
+        const int queue_count = m_workers.empty() ? 1 : getWorkerCount();
+        const int queue_index = m_workers.empty() ? getWorkerCount() : (m_nextQueueIndex++ % queue_count);
+        ThreadPoolTaskQueue &queue = m_queues[queue_index];
+
+        ++m_pendingTaskCount;
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(task);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            ++m_queuedTaskCount;
+        }
+        m_wakeCondition.notify_one();
+    }
+
+    void waitForAll()
+    {
+        // Help out rather than sit idle on the barrier
+        while (m_pendingTaskCount.load() > 0)
+        {
+            std::function<void()> task;
+
+            if (tryTakeTask(-1, task))
+            {
+                runTask(task);
+            }
+            else
+            {
+                // Everything left is already running on the workers
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    void workerFunc(int worker_index)
+    {
+        const std::string thread_name = std::string("DevicePool") + std::to_string(worker_index);
+        ServerUtility::set_current_thread_name(thread_name.c_str());
+        ServerTrace::set_current_thread_name(thread_name.c_str());
+
+        if (!ServerUtility::set_current_thread_cpu_affinity(m_workerCpuCores))
+        {
+            SERVER_MT_LOG_WARNING("ThreadPool::workerFunc") << "Failed to pin " << thread_name << " to cores: " << m_workerCpuCores;
+        }
+        if (!ServerUtility::set_current_thread_priority(m_workerPriority))
+        {
+            SERVER_MT_LOG_WARNING("ThreadPool::workerFunc") << "Failed to set the " << thread_name << " priority: " << m_workerPriority;
+        }
+
+        while (!m_bExitSignaled.load())
+        {
+            std::function<void()> task;
+
+            if (tryTakeTask(worker_index, task))
+            {
+                runTask(task);
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+
+                m_wakeCondition.wait(lock, [this] {
+                    return m_bExitSignaled.load() || m_queuedTaskCount.load() > 0;
+                });
+            }
+        }
+    }
+
+    // Pop from the front of our own queue, otherwise steal from the back of someone else's.
+    // The main thread (worker_index -1) has no queue of its own and only steals.
+    bool tryTakeTask(int worker_index, std::function<void()> &out_task)
+    {
+        const int queue_count = static_cast<int>(m_queues.size());
+
+        if (worker_index >= 0 && popTask(m_queues[worker_index], true, out_task))
+        {
+            return true;
+        }
+
+        for (int offset = 1; offset <= queue_count; ++offset)
+        {
+            const int victim_index = (std::max(worker_index, 0) + offset) % queue_count;
+
+            if (victim_index != worker_index && popTask(m_queues[victim_index], false, out_task))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool popTask(ThreadPoolTaskQueue &queue, bool bFromFront, std::function<void()> &out_task)
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (queue.tasks.empty())
+        {
+            return false;
+        }
+
+        if (bFromFront)
+        {
+            out_task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        else
+        {
+            out_task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+
+        --m_queuedTaskCount;
+
+        return true;
+    }
+
+    void runTask(std::function<void()> &task)
+    {
+        task();
+
+        --m_pendingTaskCount;
+    }
+
+    const std::string m_workerCpuCores;
+    const std::string m_workerPriority;
+    std::vector<std::thread> m_workers;
+    std::vector<ThreadPoolTaskQueue> m_queues;
+    int m_nextQueueIndex;
+
+    // Tasks submitted but not yet finished
+    std::atomic_int m_pendingTaskCount;
+    // Tasks sitting in a queue waiting for a thread
+    std::atomic_int m_queuedTaskCount;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    std::atomic_bool m_bExitSignaled;
+};
+
+//-- public interface -----
+ThreadPool::ThreadPool()
+    : implementation_ptr(nullptr)
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+    if (implementation_ptr != nullptr)
+    {
+        SERVER_LOG_ERROR("~ThreadPool") << "Thread pool deleted without calling shutdown first!";
+        shutdown();
+    }
+}
+
+bool ThreadPool::startup(
+    int worker_count,
+    const std::string &worker_cpu_cores,
+    const std::string &worker_priority)
+{
+    bool bSuccess = false;
+
+    if (implementation_ptr == nullptr)
+    {
+        if (worker_count < 0)
+        {
+            // Leave a core for the main thread, which also runs tasks while it waits
+            const int hardware_thread_count = static_cast<int>(std::thread::hardware_concurrency());
+
+            worker_count = std::min(std::max(hardware_thread_count - 1, 0), k_max_auto_worker_count);
+        }
+
+        SERVER_LOG_INFO("ThreadPool::startup") << "Starting thread pool with " << worker_count << " worker(s)";
+        implementation_ptr = new ThreadPoolImpl(worker_count, worker_cpu_cores, worker_priority);
+        bSuccess = true;
+    }
+    else
+    {
+        SERVER_LOG_WARNING("ThreadPool::startup") << "Thread pool already started";
+    }
+
+    return bSuccess;
+}
+
+void ThreadPool::shutdown()
+{
+    if (implementation_ptr != nullptr)
+    {
+        delete implementation_ptr;
+        implementation_ptr = nullptr;
+    }
+}
+
+void ThreadPool::submit(const std::function<void()> &task)
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->submit(task);
+    }
+    else
+    {
+        // No pool, just run it here
+        task();
+    }
+}
+
+void ThreadPool::waitForAll()
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->waitForAll();
+    }
+}
+
+int ThreadPool::getWorkerCount() const
+{
+    return (implementation_ptr != nullptr) ? implementation_ptr->getWorkerCount() : 0;
+}
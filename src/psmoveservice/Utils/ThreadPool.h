@@ -0,0 +1,47 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+//-- includes -----
+#include <functional>
+#include <string>
+
+//-- definitions -----
+/// Small work-stealing pool for fanning out per-device work from the main thread.
+/**
+ Each worker owns a task deque. submit() deals tasks out round-robin, a worker pops from 
+ the front of its own deque and steals from the back of the others' when it runs dry.
+ waitForAll() is the barrier: the calling thread helps run tasks until every submitted
+ task has finished, so a pool started with zero workers just runs everything inline.
+ */
+class ThreadPool
+{
+public:
+    ThreadPool();
+    virtual ~ThreadPool();
+
+    /// Spins up worker_count threads. A negative count picks one per spare hardware core.
+    /// The workers get pinned to worker_cpu_cores and run at worker_priority
+    /// (see ServerUtility::set_current_thread_cpu_affinity/set_current_thread_priority).
+    bool startup(
+        int worker_count,
+        const std::string &worker_cpu_cores = std::string(),
+        const std::string &worker_priority = std::string());
+
+    /// Runs any remaining tasks and joins the worker threads
+    void shutdown();
+
+    /// Queue up a task. Main thread only.
+    void submit(const std::function<void()> &task);
+
+    /// Blocks until every submitted task has completed, running tasks on the calling thread meanwhile
+    void waitForAll();
+
+    /// Number of worker threads, not counting the thread calling waitForAll()
+    int getWorkerCount() const;
+
+private:
+    // Private implementation
+    class ThreadPoolImpl *implementation_ptr;
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,205 @@
+//-- includes -----
+#include "WakeupSignal.h"
+#include "ServerLog.h"
+
+#include <atomic>
+
+#include <boost/asio.hpp>
+#include <boost/bind.hpp>
+
+//-- private definitions -----
+class WakeupSignalImpl
+{
+public:
+    WakeupSignalImpl(boost::asio::io_service &io_service)
+        : m_io_service(io_service)
+        , m_timeout_timer(io_service)
+        , m_bTimerArmed(false)
+        , m_bRanAbortedTimerHandler(false)
+        , m_bWakeupPending({ false })
+    {
+    }
+
+    ~WakeupSignalImpl()
+    {
+        boost::system::error_code error;
+        m_timeout_timer.cancel(error);
+    }
+
+    static void noop_handler()
+    {
+    }
+
+    void notify()
+    {
+        // Only post one wakeup handler per wait.
+        // Any data that arrives after the flag is cleared gets its own wakeup.
+        if (!m_bWakeupPending.exchange(true))
+        {
+            m_io_service.post(&WakeupSignalImpl::noop_handler);
+        }
+    }
+
+    void waitForWork(int timeout_ms)
+    {
+        // The timer stays armed across wakeups so that the main loop still ticks
+        // at least once every timeout period (devices with no data still need polling).
+        if (!m_bTimerArmed)
+        {
+            m_timeout_timer.expires_from_now(boost::posix_time::milliseconds(timeout_ms));
+            m_timeout_timer.async_wait(
+                boost::bind(&WakeupSignalImpl::handle_timeout, this, boost::asio::placeholders::error));
+            m_bTimerArmed = true;
+        }
+
+        run_until_work();
+    }
+
+    void waitForWorkUntil(const boost::posix_time::ptime &deadline)
+    {
+        if (!m_bTimerArmed)
+        {
+            m_timeout_timer.expires_at(deadline);
+            m_timeout_timer.async_wait(
+                boost::bind(&WakeupSignalImpl::handle_timeout, this, boost::asio::placeholders::error));
+            m_bTimerArmed = true;
+        }
+        else if (deadline < m_timeout_timer.expires_at())
+        {
+            // Moving the expiry cancels the pending wait, so wait again.
+            // If nothing got cancelled the old timeout already fired and its handler is queued.
+            if (m_timeout_timer.expires_at(deadline) > 0)
+            {
+                m_timeout_timer.async_wait(
+                    boost::bind(&WakeupSignalImpl::handle_timeout, this, boost::asio::placeholders::error));
+            }
+        }
+
+        run_until_work();
+    }
+
+private:
+    void run_until_work()
+    {
+        // Make sure run_one() blocks rather than returning immediately
+        // if the io_service ran out of work in a previous call
+        if (m_io_service.stopped())
+        {
+            m_io_service.reset();
+        }
+
+        // Sleep until exactly one handler is ready: a socket event, a posted wakeup, or the timeout.
+        // The handler of a timeout that got pulled in doesn't count as work.
+        do
+        {
+            m_bRanAbortedTimerHandler = false;
+            m_io_service.run_one();
+        } while (m_bRanAbortedTimerHandler);
+
+        // Clear the pending flag before the main loop starts processing,
+        // so that anything posted during the update wakes up the next wait
+        m_bWakeupPending.store(false);
+    }
+
+    void handle_timeout(const boost::system::error_code& error)
+    {
+        if (error == boost::asio::error::operation_aborted)
+        {
+            m_bRanAbortedTimerHandler = true;
+        }
+        else
+        {
+            m_bTimerArmed = false;
+        }
+    }
+
+    boost::asio::io_service &m_io_service;
+    boost::asio::deadline_timer m_timeout_timer;
+    bool m_bTimerArmed;
+    bool m_bRanAbortedTimerHandler;
+    std::atomic_bool m_bWakeupPending;
+};
+
+//-- globals -----
+static std::atomic<WakeupSignalImpl *> g_main_loop_wakeup= { nullptr };
+static std::atomic_bool g_main_loop_notifications_enabled= { true };
+
+//-- public interface -----
+WakeupSignal::WakeupSignal()
+    : implementation_ptr(nullptr)
+{
+}
+
+WakeupSignal::~WakeupSignal()
+{
+    if (implementation_ptr != nullptr)
+    {
+        SERVER_LOG_ERROR("~WakeupSignal") << "Wakeup signal deleted without calling shutdown first!";
+        shutdown();
+    }
+}
+
+bool WakeupSignal::startup(boost::asio::io_service *io_service)
+{
+    bool bSuccess = false;
+
+    if (implementation_ptr == nullptr)
+    {
+        implementation_ptr = new WakeupSignalImpl(*io_service);
+        g_main_loop_wakeup.store(implementation_ptr);
+        bSuccess = true;
+    }
+    else
+    {
+        SERVER_LOG_WARNING("WakeupSignal::startup") << "Wakeup signal already started";
+    }
+
+    return bSuccess;
+}
+
+void WakeupSignal::waitForWork(int timeout_ms)
+{
+    if (implementation_ptr != nullptr)
+    {
+        implementation_ptr->waitForWork(timeout_ms);
+    }
+}
+
+void WakeupSignal::waitForWorkUntil(const std::chrono::time_point<std::chrono::high_resolution_clock> &deadline)
+{
+    if (implementation_ptr != nullptr)
+    {
+        // The deadline timer runs on boost's UTC clock
+        const std::chrono::microseconds remaining =
+            std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::high_resolution_clock::now());
+
+        implementation_ptr->waitForWorkUntil(
+            boost::posix_time::microsec_clock::universal_time() + boost::posix_time::microseconds(remaining.count()));
+    }
+}
+
+void WakeupSignal::shutdown()
+{
+    if (implementation_ptr != nullptr)
+    {
+        g_main_loop_wakeup.store(nullptr);
+
+        delete implementation_ptr;
+        implementation_ptr = nullptr;
+    }
+}
+
+void WakeupSignal::notifyMainLoop()
+{
+    WakeupSignalImpl *wakeup = g_main_loop_wakeup.load();
+
+    if (wakeup != nullptr && g_main_loop_notifications_enabled.load(std::memory_order_relaxed))
+    {
+        wakeup->notify();
+    }
+}
+
+void WakeupSignal::setNotificationsEnabled(bool bEnabled)
+{
+    g_main_loop_notifications_enabled.store(bEnabled);
+}
@@ -0,0 +1,54 @@
+#ifndef WAKEUP_SIGNAL_H
+#define WAKEUP_SIGNAL_H
+
+//-- includes -----
+#include <chrono>
+
+//-- pre-declarations -----
+namespace boost {
+    namespace asio {
+        class io_service;
+    }
+}
+
+//-- definitions -----
+/// Lets the main service loop sleep until there is actually new work to do.
+/**
+ The main loop blocks on the service io_service, so socket events wake it up on their own.
+ Threads that produce data for the main thread (HID readers, the libusb event thread)
+ call notifyMainLoop(), which posts a no-op handler to the io_service to wake it up.
+ A timeout timer bounds how long the loop can sleep when nothing arrives.
+ */
+class WakeupSignal
+{
+public:
+    WakeupSignal();
+    virtual ~WakeupSignal();
+
+    /// Called by PSMoveService::startup() before any device starts producing data
+    bool startup(boost::asio::io_service *io_service);
+
+    /// Blocks the main thread until work is signaled, a socket handler is ready or the timeout expires
+    void waitForWork(int timeout_ms);
+
+    /// Same as waitForWork() but with an absolute deadline.
+    /// A deadline earlier than the pending timeout pulls the timeout in, a deadline in the past doesn't block.
+    void waitForWorkUntil(const std::chrono::time_point<std::chrono::high_resolution_clock> &deadline);
+
+    /// Called by PSMoveService::shutdown()
+    void shutdown();
+
+    /// Wakes up the main loop if it's waiting. Safe to call from any thread.
+    /// Does nothing if no wakeup signal has been started (e.g. in the test apps).
+    static void notifyMainLoop();
+
+    /// While disabled notifyMainLoop() does nothing, so the main loop only wakes up
+    /// for socket events and its own deadlines (the service's idle mode)
+    static void setNotificationsEnabled(bool bEnabled);
+
+private:
+    // Private implementation
+    class WakeupSignalImpl *implementation_ptr;
+};
+
+#endif // WAKEUP_SIGNAL_H
@@ -1,6 +1,7 @@
 #include "WorkerThread.h"
 #include "ServerUtility.h"
 #include "ServerLog.h"
+#include "ServerTrace.h"
 
 WorkerThread::WorkerThread(const std::string thread_name) 
 	: m_threadName(thread_name)
@@ -59,6 +60,7 @@ void WorkerThread::stopThread()
 void WorkerThread::threadFunc()
 {
     ServerUtility::set_current_thread_name(m_threadName.c_str());
+    ServerTrace::set_current_thread_name(m_threadName.c_str());
 
     // Stay in the poll loop until asked to exit by the main thread
 	// Or the worker thread can no longer do work
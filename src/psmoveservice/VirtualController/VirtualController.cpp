@@ -5,7 +5,7 @@
 #include "ServerUtility.h"
 #include <vector>
 
-#include "gamepad/Gamepad.h"
+#include "GamepadPoller.h"
 
 // -- public methods
 
@@ -26,6 +26,7 @@ VirtualControllerConfig::config2ptree()
 
     pt.put("Calibration.Position.VarianceExpFitA", position_variance_exp_fit_a);
     pt.put("Calibration.Position.VarianceExpFitB", position_variance_exp_fit_b);
+    pt.put("Calibration.Position.ExternalPoseVariance", external_pose_position_variance);
 
     pt.put("Calibration.Time.MeanUpdateTime", mean_update_time_delta);
 
@@ -33,6 +34,7 @@ VirtualControllerConfig::config2ptree()
     pt.put("PositionFilter.MaxVelocity", max_velocity);
 
     pt.put("prediction_time", prediction_time);
+    writeVisionPriority(pt, vision_priority);
     pt.put("bulb_radius", bulb_radius);
 
 	pt.put("hand", hand);
@@ -54,9 +56,11 @@ VirtualControllerConfig::ptree2config(const boost::property_tree::ptree &pt)
         gamepad_index = pt.get<int>("gamepad_index", -1);
 
         prediction_time = pt.get<float>("prediction_time", 0.f);
+        vision_priority = static_cast<eCommonVisionPriority>(readVisionPriority(pt, VisionPriority_Normal));
 
         position_variance_exp_fit_a = pt.get<float>("Calibration.Position.VarianceExpFitA", position_variance_exp_fit_a);
         position_variance_exp_fit_b = pt.get<float>("Calibration.Position.VarianceExpFitB", position_variance_exp_fit_b);
+        external_pose_position_variance = pt.get<float>("Calibration.Position.ExternalPoseVariance", external_pose_position_variance);
 
         mean_update_time_delta = pt.get<float>("Calibration.Time.MeanUpdateTime", mean_update_time_delta);
 
@@ -322,23 +326,23 @@ VirtualController::pollGamepad(VirtualControllerState &newState)
 
     if (cfg.gamepad_index >= 0)
     {
-	    const Gamepad_device * gamepad = Gamepad_deviceAtIndex(static_cast<unsigned int>(cfg.gamepad_index));
+	    GamepadState gamepad;
 
-	    if (gamepad != nullptr)
+	    if (GamepadPoller::fetchGamepadState(cfg.gamepad_index, gamepad))
 	    {
 		    unsigned int lastButtons = ControllerState.AllButtons;
 
-            newState.vendorID= gamepad->vendorID;
-            newState.productID= gamepad->productID;
+            newState.vendorID= gamepad.vendorID;
+            newState.productID= gamepad.productID;
 
             // Button states
-            newState.numButtons= std::min(gamepad->numButtons, (unsigned int)MAX_VIRTUAL_CONTROLLER_BUTTONS);
+            newState.numButtons= std::min(gamepad.numButtons, (int)MAX_VIRTUAL_CONTROLLER_BUTTONS);
             for (int buttonIndex = 0; buttonIndex < newState.numButtons; ++buttonIndex)
             {
                 unsigned int button_mask= 1 << buttonIndex;
 
                 // Set button bit
-                setButtonBit(newState.AllButtons, button_mask, gamepad->buttonStates[buttonIndex]);
+                setButtonBit(newState.AllButtons, button_mask, gamepad.buttonStates[buttonIndex]);
 
                 // Button de-bounce
                 newState.buttonStates[buttonIndex]= getButtonState(newState.AllButtons, lastButtons, button_mask);
@@ -346,10 +350,10 @@ VirtualController::pollGamepad(VirtualControllerState &newState)
 		    
 
 		    // Analog axis states
-            newState.numAxes= std::min(gamepad->numAxes, (unsigned int)MAX_VIRTUAL_CONTROLLER_AXES);
+            newState.numAxes= std::min(gamepad.numAxes, (int)MAX_VIRTUAL_CONTROLLER_AXES);
             for (int axisIndex = 0; axisIndex < newState.numAxes; ++axisIndex)
             {
-                newState.axisStates[axisIndex] = static_cast<unsigned char>((gamepad->axisStates[axisIndex] + 1.f) * 127.f);
+                newState.axisStates[axisIndex] = static_cast<unsigned char>((gamepad.axisStates[axisIndex] + 1.f) * 127.f);
             }
 	    }
     }
@@ -400,6 +404,11 @@ float VirtualController::getPredictionTime() const
 	return getConfig()->prediction_time;
 }
 
+eCommonVisionPriority VirtualController::getVisionPriority() const
+{
+	return getConfig()->vision_priority;
+}
+
 bool VirtualController::getWasSystemButtonPressed() const
 {
     return false;
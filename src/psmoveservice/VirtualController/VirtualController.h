@@ -28,7 +28,9 @@ public:
 		, mean_update_time_delta(0.008333f)
 		, position_variance_exp_fit_a(0.0994158462f)
 		, position_variance_exp_fit_b(-0.000567041978f)
+		, external_pose_position_variance(0.01f)
         , prediction_time(0.f)
+        , vision_priority(VisionPriority_Normal)
 		, tracking_color_id(eCommonTrackingColorID::Blue)
         , bulb_radius(2.25f) // The radius of the psmove tracking bulb in cm
 		, hand("Any")
@@ -61,7 +63,13 @@ public:
 		return position_variance_exp_fit_a*exp(position_variance_exp_fit_b*projection_area);
 	}
 
+	// Variance (cm^2) of the positions injected through the shared memory pose input (see SharedPoseInput.h)
+	// that don't come with their own
+	float external_pose_position_variance;
+
 	float prediction_time;
+	// How the vision scheduler ranks this controller against the other tracked devices
+	eCommonVisionPriority vision_priority;
 
 	eCommonTrackingColorID tracking_color_id;
     float bulb_radius;
@@ -153,6 +161,7 @@ public:
 	virtual bool getTrackingColorID(eCommonTrackingColorID &out_tracking_color_id) const override;
 	virtual float getIdentityForwardDegrees() const override;
 	virtual float getPredictionTime() const override;
+	virtual eCommonVisionPriority getVisionPriority() const override;
     virtual bool getWasSystemButtonPressed() const override;
 
     // -- Getters
@@ -14,9 +14,6 @@
 #endif
 #include <math.h>
 
-// -- constants -----
-#define VIRTUAL_HMD_STATE_BUFFER_MAX 4
-
 // -- private methods
 
 // -- public interface
@@ -33,6 +30,7 @@ VirtualHMDConfig::config2ptree()
 
     pt.put("Calibration.Position.VarianceExpFitA", position_variance_exp_fit_a);
     pt.put("Calibration.Position.VarianceExpFitB", position_variance_exp_fit_b);
+    pt.put("Calibration.Position.ExternalPoseVariance", external_pose_position_variance);
 
     pt.put("Calibration.Time.MeanUpdateTime", mean_update_time_delta);
 
@@ -40,6 +38,7 @@ VirtualHMDConfig::config2ptree()
     pt.put("PositionFilter.MaxVelocity", max_velocity);
 
     pt.put("prediction_time", prediction_time);
+    writeVisionPriority(pt, vision_priority);
     pt.put("bulb_radius", bulb_radius);
 
     writeTrackingColor(pt, tracking_color_id);
@@ -57,9 +56,11 @@ VirtualHMDConfig::ptree2config(const boost::property_tree::ptree &pt)
         is_valid = pt.get<bool>("is_valid", false);
 
         prediction_time = pt.get<float>("prediction_time", 0.f);
+        vision_priority = static_cast<eCommonVisionPriority>(readVisionPriority(pt, VisionPriority_High));
 
         position_variance_exp_fit_a = pt.get<float>("Calibration.Position.VarianceExpFitA", position_variance_exp_fit_a);
         position_variance_exp_fit_b = pt.get<float>("Calibration.Position.VarianceExpFitB", position_variance_exp_fit_b);
+        external_pose_position_variance = pt.get<float>("Calibration.Position.ExternalPoseVariance", external_pose_position_variance);
 
         mean_update_time_delta = pt.get<float>("Calibration.Time.MeanUpdateTime", mean_update_time_delta);
 
@@ -217,12 +218,7 @@ VirtualHMD::poll()
         newState.PollSequenceNumber = NextPollSequenceNumber;
         ++NextPollSequenceNumber;
 
-        // Make room for new entry if at the max queue size
-        if (HMDStates.size() >= VIRTUAL_HMD_STATE_BUFFER_MAX)
-        {
-            HMDStates.erase(HMDStates.begin(), HMDStates.begin() + HMDStates.size() - VIRTUAL_HMD_STATE_BUFFER_MAX);
-        }
-
+        // Overwrites the oldest entry once the history is full
         HMDStates.push_back(newState);
     }
 
@@ -265,15 +261,30 @@ VirtualHMD::getPredictionTime() const
     return getConfig()->prediction_time;
 }
 
+eCommonVisionPriority
+VirtualHMD::getVisionPriority() const
+{
+    return getConfig()->vision_priority;
+}
+
+int
+VirtualHMD::getLastPollSensorBacklog() const
+{
+    // The virtual HMD has no sensor reports to fall behind on
+    return 0;
+}
+
+int
+VirtualHMD::getMaxPollSensorBacklog() const
+{
+    return 0;
+}
+
 const CommonDeviceState *
 VirtualHMD::getState(
     int lookBack) const
 {
-    const int queueSize = static_cast<int>(HMDStates.size());
-    const CommonDeviceState * result =
-        (lookBack < queueSize) ? &HMDStates.at(queueSize - lookBack - 1) : nullptr;
-
-    return result;
+    return HMDStates.getFromNewest(lookBack);
 }
 
 long VirtualHMD::getMaxPollFailureCount() const
@@ -4,12 +4,15 @@
 #include "PSMoveConfig.h"
 #include "DeviceEnumerator.h"
 #include "DeviceInterface.h"
+#include "CircularBuffer.h"
 #include "MathUtility.h"
 #include <string>
 #include <vector>
-#include <deque>
 #include <array>
 
+// -- constants -----
+#define VIRTUAL_HMD_STATE_BUFFER_MAX 4
+
 
 class VirtualHMDConfig : public PSMoveConfig
 {
@@ -25,7 +28,9 @@ public:
 		, mean_update_time_delta(0.008333f)
 		, position_variance_exp_fit_a(0.0994158462f)
 		, position_variance_exp_fit_b(-0.000567041978f)
+		, external_pose_position_variance(0.01f)
         , prediction_time(0.f)
+        , vision_priority(VisionPriority_High)
 		, tracking_color_id(eCommonTrackingColorID::Blue)
         , bulb_radius(2.25f) // The radius of the psmove tracking bulb in cm
     {
@@ -54,7 +59,13 @@ public:
 		return position_variance_exp_fit_a*exp(position_variance_exp_fit_b*projection_area);
 	}
 
+	// Variance (cm^2) of the positions injected through the shared memory pose input (see SharedPoseInput.h)
+	// that don't come with their own
+	float external_pose_position_variance;
+
 	float prediction_time;
+	// How the vision scheduler ranks this HMD against the other tracked devices
+	eCommonVisionPriority vision_priority;
 
 	eCommonTrackingColorID tracking_color_id;
     float bulb_radius;
@@ -107,6 +118,9 @@ public:
 	bool setTrackingColorID(const eCommonTrackingColorID tracking_color_id) override;
 	bool getTrackingColorID(eCommonTrackingColorID &out_tracking_color_id) const override;
 	float getPredictionTime() const override;
+	eCommonVisionPriority getVisionPriority() const override;
+	int getLastPollSensorBacklog() const override;
+	int getMaxPollSensorBacklog() const override;
 
     // -- Getters
     inline const VirtualHMDConfig *getConfig() const
@@ -129,7 +143,7 @@ private:
 
     // Read HMD State
     int NextPollSequenceNumber;
-    std::deque<VirtualHMDState> HMDStates;
+    CircularBuffer<VirtualHMDState, VIRTUAL_HMD_STATE_BUFFER_MAX> HMDStates;
 
 	bool bIsTracking;
 };
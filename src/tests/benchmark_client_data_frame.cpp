@@ -0,0 +1,333 @@
+// Measures what it costs the client to decode the controller data frames the service streams.
+//
+// A few representative PSMove data frames (pose only, pose + physics, every optional
+// section) get serialized up front, then each one is:
+//  - parsed the way the client used to, by clearing and re-parsing one heap allocated message,
+//  - parsed with ClientDataFrameParser, which recycles an arena block between frames,
+//  - parsed with ClientDataFrameParser and applied to the client's controller view,
+//    which is the full cost of a data frame arriving at the client,
+//  - checked with ClientDataFrameParser::is_stale_frame() after the newest frame,
+//    which is what a datagram that got overtaken costs instead.
+//
+// Usage: benchmark_client_data_frame [--iterations I]
+
+//-- includes -----
+#include "ClientDataFrameParser.h"
+#include "PSMoveClient.h"
+#include "PSMoveProtocol.pb.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+//-- constants -----
+static const int k_default_iteration_count = 200000;
+
+//-- definitions -----
+enum eDataFrameLayout
+{
+    DataFrameLayout_PoseOnly,
+    DataFrameLayout_PoseAndPhysics,
+    DataFrameLayout_Everything,
+
+    DataFrameLayout_COUNT
+};
+
+static const char *k_data_frame_layout_names[DataFrameLayout_COUNT] = {
+    "pose",
+    "pose+physics",
+    "everything"
+};
+
+struct SerializedDataFrames
+{
+    // One frame per iteration, each one with the next sequence number so the client applies all of them
+    std::vector<std::string> frames;
+    size_t total_bytes;
+};
+
+//-- private functions -----
+static void print_usage()
+{
+    printf("Usage: benchmark_client_data_frame [--iterations I]\n");
+}
+
+static bool parse_arguments(int argc, char *argv[], int &out_iteration_count)
+{
+    for (int arg_index = 1; arg_index < argc; ++arg_index)
+    {
+        if (strcmp(argv[arg_index], "--iterations") == 0 && arg_index + 1 < argc)
+        {
+            out_iteration_count = atoi(argv[++arg_index]);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return out_iteration_count > 0;
+}
+
+static void set_float_vector(PSMoveProtocol::FloatVector *vector, float i, float j, float k)
+{
+    vector->set_i(i);
+    vector->set_j(j);
+    vector->set_k(k);
+}
+
+static void set_int_vector(PSMoveProtocol::IntVector *vector, int i, int j, int k)
+{
+    vector->set_i(i);
+    vector->set_j(j);
+    vector->set_k(k);
+}
+
+static void build_data_frame(eDataFrameLayout layout, int sequence_num, PSMoveProtocol::DeviceOutputDataFrame &data_frame)
+{
+    data_frame.Clear();
+    data_frame.set_device_category(PSMoveProtocol::DeviceOutputDataFrame_DeviceCategory_CONTROLLER);
+    data_frame.set_service_time_us(1000000 + sequence_num*16666LL);
+
+    PSMoveProtocol::DeviceOutputDataFrame_ControllerDataPacket *controller_packet = data_frame.mutable_controller_data_packet();
+    controller_packet->set_controller_id(0);
+    controller_packet->set_controller_type(PSMoveProtocol::PSMOVE);
+    controller_packet->set_sequence_num(sequence_num);
+    controller_packet->set_isconnected(true);
+    controller_packet->set_button_down_bitmask((sequence_num / 30) & 0x1ff);
+
+    auto *psmove_state = controller_packet->mutable_psmove_state();
+    psmove_state->set_validhardwarecalibration(true);
+    psmove_state->set_istrackingenabled(true);
+    psmove_state->set_iscurrentlytracking(true);
+    psmove_state->set_isorientationvalid(true);
+    psmove_state->set_ispositionvalid(true);
+    psmove_state->set_trigger_value(sequence_num & 0xff);
+    psmove_state->set_battery_value(4);
+
+    psmove_state->mutable_position_cm()->set_x(10.f + 0.01f*sequence_num);
+    psmove_state->mutable_position_cm()->set_y(120.f);
+    psmove_state->mutable_position_cm()->set_z(-35.f);
+    psmove_state->mutable_orientation()->set_w(0.9238795f);
+    psmove_state->mutable_orientation()->set_x(0.f);
+    psmove_state->mutable_orientation()->set_y(0.3826834f);
+    psmove_state->mutable_orientation()->set_z(0.f);
+
+    if (layout == DataFrameLayout_PoseAndPhysics || layout == DataFrameLayout_Everything)
+    {
+        auto *physics_data = psmove_state->mutable_physics_data();
+        set_float_vector(physics_data->mutable_velocity_cm_per_sec(), 1.f, 2.f, 3.f);
+        set_float_vector(physics_data->mutable_acceleration_cm_per_sec_sqr(), 4.f, 5.f, 6.f);
+        set_float_vector(physics_data->mutable_angular_velocity_rad_per_sec(), 0.1f, 0.2f, 0.3f);
+        set_float_vector(physics_data->mutable_angular_acceleration_rad_per_sec_sqr(), 0.4f, 0.5f, 0.6f);
+    }
+
+    if (layout == DataFrameLayout_Everything)
+    {
+        auto *raw_sensor_data = psmove_state->mutable_raw_sensor_data();
+        set_int_vector(raw_sensor_data->mutable_magnetometer(), 100, -200, 300);
+        set_int_vector(raw_sensor_data->mutable_accelerometer(), 10, 4000, -20);
+        set_int_vector(raw_sensor_data->mutable_gyroscope(), -5, 7, 3);
+
+        auto *calibrated_sensor_data = psmove_state->mutable_calibrated_sensor_data();
+        set_float_vector(calibrated_sensor_data->mutable_magnetometer(), 0.2f, -0.4f, 0.6f);
+        set_float_vector(calibrated_sensor_data->mutable_accelerometer(), 0.f, 1.f, 0.f);
+        set_float_vector(calibrated_sensor_data->mutable_gyroscope(), 0.01f, 0.02f, 0.03f);
+
+        auto *raw_tracker_data = psmove_state->mutable_raw_tracker_data();
+        raw_tracker_data->set_tracker_id(0);
+        raw_tracker_data->set_valid_tracker_bitmask(0x3);
+        raw_tracker_data->mutable_screen_location()->set_x(320.f);
+        raw_tracker_data->mutable_screen_location()->set_y(240.f);
+        raw_tracker_data->mutable_relative_position_cm()->set_x(1.f);
+        raw_tracker_data->mutable_relative_position_cm()->set_y(2.f);
+        raw_tracker_data->mutable_relative_position_cm()->set_z(150.f);
+        raw_tracker_data->mutable_projected_sphere()->mutable_center()->set_x(320.f);
+        raw_tracker_data->mutable_projected_sphere()->mutable_center()->set_y(240.f);
+        raw_tracker_data->mutable_projected_sphere()->set_half_x_extent(12.f);
+        raw_tracker_data->mutable_projected_sphere()->set_half_y_extent(11.f);
+        raw_tracker_data->mutable_projected_sphere()->set_angle(0.1f);
+        raw_tracker_data->mutable_multicam_position_cm()->set_x(10.f);
+        raw_tracker_data->mutable_multicam_position_cm()->set_y(120.f);
+        raw_tracker_data->mutable_multicam_position_cm()->set_z(-35.f);
+    }
+}
+
+static void serialize_data_frames(eDataFrameLayout layout, int iteration_count, SerializedDataFrames &out_frames)
+{
+    PSMoveProtocol::DeviceOutputDataFrame data_frame;
+
+    out_frames.frames.resize(iteration_count);
+    out_frames.total_bytes = 0;
+
+    for (int iteration = 0; iteration < iteration_count; ++iteration)
+    {
+        build_data_frame(layout, iteration + 1, data_frame);
+        data_frame.SerializeToString(&out_frames.frames[iteration]);
+        out_frames.total_bytes += out_frames.frames[iteration].size();
+    }
+}
+
+static double elapsed_ns_per_frame(
+    const std::chrono::high_resolution_clock::time_point &start_time,
+    int frame_count)
+{
+    const auto duration = std::chrono::high_resolution_clock::now() - start_time;
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / frame_count;
+}
+
+static double benchmark_heap_parse(const SerializedDataFrames &frames)
+{
+    // What PackedMessage::unpack() does: Clear() frees the submessages, the parse allocates them again
+    PSMoveProtocol::DeviceOutputDataFrame *data_frame = new PSMoveProtocol::DeviceOutputDataFrame();
+    int sequence_sum = 0;
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    for (const std::string &frame : frames.frames)
+    {
+        data_frame->Clear();
+        data_frame->ParseFromArray(frame.data(), static_cast<int>(frame.size()));
+        sequence_sum += data_frame->controller_data_packet().sequence_num();
+    }
+    const double ns_per_frame = elapsed_ns_per_frame(start_time, static_cast<int>(frames.frames.size()));
+
+    delete data_frame;
+
+    // Keep the parse from getting optimized away
+    return (sequence_sum != 0) ? ns_per_frame : -1.0;
+}
+
+static double benchmark_arena_parse(const SerializedDataFrames &frames, size_t &out_arena_bytes)
+{
+    ClientDataFrameParser *parser = new ClientDataFrameParser();
+    int sequence_sum = 0;
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    for (const std::string &frame : frames.frames)
+    {
+        const PSMoveProtocol::DeviceOutputDataFrame *data_frame =
+            parser->parse(reinterpret_cast<const uint8_t *>(frame.data()), static_cast<unsigned int>(frame.size()));
+
+        sequence_sum += data_frame->controller_data_packet().sequence_num();
+    }
+    const double ns_per_frame = elapsed_ns_per_frame(start_time, static_cast<int>(frames.frames.size()));
+
+    out_arena_bytes = parser->get_arena_space_used();
+    delete parser;
+
+    return (sequence_sum != 0) ? ns_per_frame : -1.0;
+}
+
+static double benchmark_stale_drop(const SerializedDataFrames &frames)
+{
+    ClientDataFrameParser *parser = new ClientDataFrameParser();
+    const std::string &newest_frame = frames.frames.back();
+    int stale_count = 0;
+
+    // Every frame is at best as new as this one from here on
+    parser->is_stale_frame(reinterpret_cast<const uint8_t *>(newest_frame.data()), static_cast<unsigned int>(newest_frame.size()));
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    for (const std::string &frame : frames.frames)
+    {
+        if (parser->is_stale_frame(reinterpret_cast<const uint8_t *>(frame.data()), static_cast<unsigned int>(frame.size())))
+        {
+            ++stale_count;
+        }
+    }
+    const double ns_per_frame = elapsed_ns_per_frame(start_time, static_cast<int>(frames.frames.size()));
+
+    delete parser;
+
+    return (stale_count == static_cast<int>(frames.frames.size())) ? ns_per_frame : -1.0;
+}
+
+static double benchmark_parse_and_apply(const SerializedDataFrames &frames, PSMoveClient *client)
+{
+    ClientDataFrameParser *parser = new ClientDataFrameParser();
+    IDataFrameListener *data_frame_listener = client;
+
+    // The frames restart at sequence number 1, so start over with a fresh controller view
+    client->allocate_controller_listener(0);
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    for (const std::string &frame : frames.frames)
+    {
+        const PSMoveProtocol::DeviceOutputDataFrame *data_frame =
+            parser->parse(reinterpret_cast<const uint8_t *>(frame.data()), static_cast<unsigned int>(frame.size()));
+
+        data_frame_listener->handle_data_frame(data_frame);
+    }
+    const double ns_per_frame = elapsed_ns_per_frame(start_time, static_cast<int>(frames.frames.size()));
+
+    const bool bAppliedEveryFrame =
+        client->get_controller_view(0)->OutputSequenceNum == static_cast<int>(frames.frames.size());
+
+    client->free_controller_listener(0);
+    delete parser;
+
+    return bAppliedEveryFrame ? ns_per_frame : -1.0;
+}
+
+//-- entry point -----
+int main(int argc, char *argv[])
+{
+    int iteration_count = k_default_iteration_count;
+
+    if (!parse_arguments(argc, argv, iteration_count))
+    {
+        print_usage();
+        return -1;
+    }
+
+    // The client never gets updated, so it never notices there isn't a service to connect to.
+    // All it's needed for is a set of device views to apply the data frames to.
+    PSMoveClient *client = new PSMoveClient("localhost", PSMOVESERVICE_DEFAULT_PORT);
+    if (!client->startup(_log_severity_level_error, PSMInitFlags_defaultOptions))
+    {
+        printf("Failed to start up the client\n");
+        delete client;
+        return -1;
+    }
+
+    printf("%d data frames per layout, ns per frame\n", iteration_count);
+    printf("%13s %11s %11s %11s %13s %11s %11s\n", "layout", "bytes", "heap parse", "arena parse", "parse+apply", "stale drop", "arena bytes");
+
+    int exit_code = 0;
+    for (int layout_index = 0; layout_index < DataFrameLayout_COUNT; ++layout_index)
+    {
+        SerializedDataFrames frames;
+        serialize_data_frames(static_cast<eDataFrameLayout>(layout_index), iteration_count, frames);
+
+        size_t arena_bytes = 0;
+        const double heap_parse_ns = benchmark_heap_parse(frames);
+        const double arena_parse_ns = benchmark_arena_parse(frames, arena_bytes);
+        const double parse_and_apply_ns = benchmark_parse_and_apply(frames, client);
+        const double stale_drop_ns = benchmark_stale_drop(frames);
+
+        if (heap_parse_ns < 0.0 || arena_parse_ns < 0.0 || parse_and_apply_ns < 0.0 || stale_drop_ns < 0.0)
+        {
+            printf("Failed to decode the %s data frames\n", k_data_frame_layout_names[layout_index]);
+            exit_code = -1;
+            continue;
+        }
+
+        printf("%13s %11.1f %11.1f %11.1f %13.1f %11.1f %11d\n",
+            k_data_frame_layout_names[layout_index],
+            static_cast<double>(frames.total_bytes) / iteration_count,
+            heap_parse_ns,
+            arena_parse_ns,
+            parse_and_apply_ns,
+            stale_drop_ns,
+            static_cast<int>(arena_bytes));
+    }
+
+    client->shutdown();
+    delete client;
+
+    return exit_code;
+}
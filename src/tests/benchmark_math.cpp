@@ -0,0 +1,493 @@
+// Times the psmovemath fits and solvers the tracking pipeline runs every frame (or every calibration step),
+// over input sizes taken from real use:
+//  - the sphere and ellipse fits over light bulb contours of a far (16 px), mid (64 px) and close (256 px) controller,
+//  - the minimum volume ellipsoid fit over a magnetometer calibration (500 and 2000 samples),
+//  - the quaternion averages over 2-8 tracker orientations,
+//  - the P3P solve of a point cloud correspondence hypothesis,
+//  - the gravity/magnetometer frame alignment of the orientation filter,
+//  - the per sample scalar and quaternion helpers, inline and through a function pointer (what the old out of line call cost).
+// Every case reports the time and the heap allocations per call, so math optimizations can be checked for both.
+//
+// Usage: benchmark_math [--min-time-ms M] [--filter name]
+
+//-- includes -----
+#include "MathAlignment.h"
+#include "MathUtility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+//-- constants -----
+static const int k_default_min_time_ms = 200;
+
+static const float k_focal_length_px = 554.2563f; // PS3EyeTrackerConfig default
+static const float k_sphere_radius_cm = 2.25f; // PSMove light bulb
+
+// Quaternions get averaged for one device seen by this many trackers at most
+static const int k_max_average_count = 8;
+
+//-- allocation counting -----
+// Counts the heap allocations made while a case runs.
+// Eigen allocates its dynamic size matrices with malloc rather than operator new,
+// so where the C library lets us, malloc itself gets counted (operator new ends up there too).
+static std::atomic<long long> g_allocation_count(0);
+static std::atomic<long long> g_allocation_bytes(0);
+
+#if defined(__GLIBC__)
+extern "C" void *__libc_malloc(size_t size);
+
+extern "C" void *malloc(size_t size)
+{
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    g_allocation_bytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+#else
+// Misses the allocations Eigen makes
+void *operator new(size_t size)
+{
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    g_allocation_bytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+
+    void *memory = malloc(size > 0 ? size : 1);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+    free(memory);
+}
+#endif
+
+//-- definitions -----
+struct BenchmarkResult
+{
+    double ns_per_op;
+    double allocations_per_op;
+    double bytes_per_op;
+};
+
+//-- private functions -----
+static void print_usage()
+{
+    printf("Usage: benchmark_math [--min-time-ms M] [--filter name]\n");
+}
+
+static bool parse_arguments(int argc, char *argv[], int &out_min_time_ms, const char *&out_filter)
+{
+    for (int arg_index = 1; arg_index < argc; ++arg_index)
+    {
+        if (strcmp(argv[arg_index], "--min-time-ms") == 0 && arg_index + 1 < argc)
+        {
+            out_min_time_ms = atoi(argv[++arg_index]);
+        }
+        else if (strcmp(argv[arg_index], "--filter") == 0 && arg_index + 1 < argc)
+        {
+            out_filter = argv[++arg_index];
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return out_min_time_ms > 0;
+}
+
+// Calls op in doubling batches until a batch takes at least min_time_ms, then reports that batch
+template <typename t_operation>
+static BenchmarkResult run_benchmark(const int min_time_ms, t_operation op)
+{
+    const std::chrono::duration<double, std::milli> min_time(min_time_ms);
+    BenchmarkResult result;
+    long long op_count = 1;
+
+    // Warm up the caches (and any lazily allocated state) before counting
+    op();
+
+    for (;;)
+    {
+        const long long start_allocation_count = g_allocation_count.load();
+        const long long start_allocation_bytes = g_allocation_bytes.load();
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        for (long long op_index = 0; op_index < op_count; ++op_index)
+        {
+            op();
+        }
+
+        const auto end = std::chrono::high_resolution_clock::now();
+        const std::chrono::duration<double, std::milli> elapsed = end - start;
+
+        if (elapsed >= min_time || op_count >= (1LL << 40))
+        {
+            const double ops = static_cast<double>(op_count);
+
+            result.ns_per_op = std::chrono::duration<double, std::nano>(elapsed).count() / ops;
+            result.allocations_per_op = static_cast<double>(g_allocation_count.load() - start_allocation_count) / ops;
+            result.bytes_per_op = static_cast<double>(g_allocation_bytes.load() - start_allocation_bytes) / ops;
+            break;
+        }
+
+        op_count *= 2;
+    }
+
+    return result;
+}
+
+static bool get_is_case_enabled(const char *filter, const char *name)
+{
+    return filter == nullptr || strstr(name, filter) != nullptr;
+}
+
+static void print_result(const char *name, const int input_size, const BenchmarkResult &result)
+{
+    printf("%-40s %6d %12.1f %10.2f %10.0f\n", name, input_size, result.ns_per_op, result.allocations_per_op, result.bytes_per_op);
+}
+
+// Contour of a light bulb at the given distance, the way the tracker finds it:
+// whole pixel coordinates relative to the image center with a little jitter
+static void build_sphere_contour(const float distance_cm, const int point_count, std::vector<Eigen::Vector2f> &out_points)
+{
+    const Eigen::Vector3f center(8.f, -4.f, distance_cm);
+    const float radius_px = k_focal_length_px*k_sphere_radius_cm / center.z();
+    const Eigen::Vector2f center_px(k_focal_length_px*center.x() / center.z(), k_focal_length_px*center.y() / center.z());
+
+    out_points.resize(point_count);
+    for (int point_index = 0; point_index < point_count; ++point_index)
+    {
+        const float angle = k_real_two_pi*static_cast<float>(point_index) / static_cast<float>(point_count);
+        const float jitter = 0.3f*sinf(7.f*angle);
+
+        out_points[point_index] =
+            Eigen::Vector2f(
+                floorf(center_px.x() + (radius_px + jitter)*cosf(angle) + 0.5f),
+                floorf(center_px.y() + (radius_px + jitter)*sinf(angle) + 0.5f));
+    }
+}
+
+// Magnetometer samples on a hard/soft iron distorted sphere, as gathered while turning a controller around
+static void build_magnetometer_samples(const int sample_count, std::vector<Eigen::Vector3f> &out_samples)
+{
+    const Eigen::Vector3f offset(120.f, -45.f, 30.f);
+    const Eigen::Vector3f extents(310.f, 290.f, 265.f);
+    const Eigen::Matrix3f basis = Eigen::AngleAxisf(0.3f, Eigen::Vector3f(1.f, 1.f, 0.f).normalized()).toRotationMatrix();
+
+    out_samples.resize(sample_count);
+    for (int sample_index = 0; sample_index < sample_count; ++sample_index)
+    {
+        // Spiral over the sphere so the samples cover it evenly
+        const float t = (static_cast<float>(sample_index) + 0.5f) / static_cast<float>(sample_count);
+        const float z = 1.f - 2.f*t;
+        const float r = sqrtf(std::max(1.f - z*z, 0.f));
+        const float phi = 2.39996323f*static_cast<float>(sample_index);
+        const Eigen::Vector3f unit(r*cosf(phi), r*sinf(phi), z);
+        const float noise = 2.f*sinf(13.f*phi);
+
+        out_samples[sample_index] = basis*(unit.cwiseProduct(extents) + Eigen::Vector3f::Constant(noise)) + offset;
+    }
+}
+
+static void build_tracker_orientations(
+    Eigen::Quaternionf out_orientations[k_max_average_count],
+    Eigen::Quaterniond out_orientations_d[k_max_average_count],
+    float out_weights[k_max_average_count],
+    double out_weights_d[k_max_average_count])
+{
+    const Eigen::Quaternionf expected(Eigen::AngleAxisf(0.7f, Eigen::Vector3f(0.3f, 1.f, -0.2f).normalized()));
+
+    for (int sample_index = 0; sample_index < k_max_average_count; ++sample_index)
+    {
+        const float angle = 0.05f*static_cast<float>(sample_index - k_max_average_count / 2);
+        const Eigen::Quaternionf offset(Eigen::AngleAxisf(angle, Eigen::Vector3f(1.f, 0.f, 0.f)));
+
+        out_orientations[sample_index] = expected*offset;
+        out_orientations_d[sample_index] = out_orientations[sample_index].cast<double>();
+        out_weights[sample_index] = 1.f / static_cast<float>(1 + sample_index);
+        out_weights_d[sample_index] = static_cast<double>(out_weights[sample_index]);
+    }
+}
+
+//-- entry point -----
+int main(int argc, char *argv[])
+{
+    int min_time_ms = k_default_min_time_ms;
+    const char *filter = nullptr;
+
+    if (!parse_arguments(argc, argv, min_time_ms, filter))
+    {
+        print_usage();
+        return -1;
+    }
+
+    // Keeps the results alive so the calls can't get optimized away
+    volatile float sink = 0.f;
+
+    printf("%-40s %6s %12s %10s %10s\n", "case", "n", "ns/op", "allocs/op", "bytes/op");
+
+    // Sphere and ellipse fits over light bulb contours
+    {
+        const int contour_sizes[] = { 16, 64, 256 };
+        const float contour_distances_cm[] = { 300.f, 120.f, 40.f };
+
+        for (int size_index = 0; size_index < 3; ++size_index)
+        {
+            const int point_count = contour_sizes[size_index];
+            std::vector<Eigen::Vector2f> points;
+            std::vector<float> xy_points(2*point_count);
+
+            build_sphere_contour(contour_distances_cm[size_index], point_count, points);
+            for (int point_index = 0; point_index < point_count; ++point_index)
+            {
+                xy_points[2*point_index] = points[point_index].x();
+                xy_points[2*point_index + 1] = points[point_index].y();
+            }
+
+            if (get_is_case_enabled(filter, "fit_focal_cone_to_sphere"))
+            {
+                const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+                {
+                    Eigen::Vector3f sphere_center;
+                    eigen_alignment_fit_focal_cone_to_sphere(points.data(), point_count, k_sphere_radius_cm, k_focal_length_px, &sphere_center);
+                    sink = sink + sphere_center.z();
+                });
+                print_result("fit_focal_cone_to_sphere", point_count, result);
+            }
+
+            if (get_is_case_enabled(filter, "fit_focal_cone_to_sphere_fast"))
+            {
+                const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+                {
+                    Eigen::Vector3f sphere_center;
+                    eigen_alignment_fit_focal_cone_to_sphere_fast(xy_points.data(), point_count, k_sphere_radius_cm, k_focal_length_px, &sphere_center);
+                    sink = sink + sphere_center.z();
+                });
+                print_result("fit_focal_cone_to_sphere_fast", point_count, result);
+            }
+
+            if (get_is_case_enabled(filter, "fit_least_squares_ellipse"))
+            {
+                const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+                {
+                    EigenFitEllipse ellipse;
+                    eigen_alignment_fit_least_squares_ellipse(points.data(), point_count, ellipse);
+                    sink = sink + ellipse.area;
+                });
+                print_result("fit_least_squares_ellipse", point_count, result);
+            }
+        }
+    }
+
+    // Minimum volume ellipsoid over a magnetometer calibration
+    {
+        const int sample_sizes[] = { 500, 2000 };
+
+        for (int size_index = 0; size_index < 2; ++size_index)
+        {
+            const int sample_count = sample_sizes[size_index];
+            std::vector<Eigen::Vector3f> samples;
+
+            build_magnetometer_samples(sample_count, samples);
+
+            if (get_is_case_enabled(filter, "fit_min_volume_ellipsoid"))
+            {
+                const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+                {
+                    EigenFitEllipsoid ellipsoid;
+                    eigen_alignment_fit_min_volume_ellipsoid(samples.data(), sample_count, 0.0001f, ellipsoid);
+                    sink = sink + ellipsoid.extents.x();
+                });
+                print_result("fit_min_volume_ellipsoid", sample_count, result);
+            }
+
+            if (get_is_case_enabled(filter, "fit_min_volume_ellipsoid_workspace"))
+            {
+                EigenFitMinVolumeEllipsoidWorkspace workspace;
+                const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+                {
+                    EigenFitEllipsoid ellipsoid;
+                    eigen_alignment_fit_min_volume_ellipsoid(samples.data(), sample_count, 0.0001f, workspace, ellipsoid);
+                    sink = sink + ellipsoid.extents.x();
+                });
+                print_result("fit_min_volume_ellipsoid_workspace", sample_count, result);
+            }
+        }
+    }
+
+    // Quaternion averages over the trackers that see a device
+    {
+        Eigen::Quaternionf orientations[k_max_average_count];
+        Eigen::Quaterniond orientations_d[k_max_average_count];
+        float weights[k_max_average_count];
+        double weights_d[k_max_average_count];
+        const int average_counts[] = { 2, 4, 8 };
+
+        build_tracker_orientations(orientations, orientations_d, weights, weights_d);
+
+        for (int count_index = 0; count_index < 3; ++count_index)
+        {
+            const int average_count = average_counts[count_index];
+
+            if (get_is_case_enabled(filter, "quaternion_normalized_weighted_average"))
+            {
+                const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+                {
+                    Eigen::Quaternionf average;
+                    eigen_quaternion_compute_normalized_weighted_average(orientations, weights, average_count, &average);
+                    sink = sink + average.w();
+                });
+                print_result("quaternion_normalized_weighted_average", average_count, result);
+            }
+
+            if (get_is_case_enabled(filter, "quaternion_weighted_average"))
+            {
+                const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+                {
+                    Eigen::Quaterniond average;
+                    eigen_quaternion_compute_weighted_average(orientations_d, weights_d, average_count, &average);
+                    sink = sink + static_cast<float>(average.w());
+                });
+                print_result("quaternion_weighted_average", average_count, result);
+            }
+        }
+    }
+
+    // P3P solve of one LED triple hypothesis, the inner step of the point cloud correspondence search
+    if (get_is_case_enabled(filter, "solve_p3p"))
+    {
+        const Eigen::Vector3f object_points[3] = {
+            Eigen::Vector3f(-9.f, 3.f, -1.f),
+            Eigen::Vector3f(8.f, 2.5f, -2.f),
+            Eigen::Vector3f(0.5f, -4.f, 1.5f)
+        };
+        const Eigen::Matrix3f rotation =
+            Eigen::AngleAxisf(0.6f, Eigen::Vector3f(0.3f, 1.f, -0.2f).normalized()).toRotationMatrix();
+        const Eigen::Vector3f translation(8.f, -4.f, 110.f);
+
+        Eigen::Vector2f image_points[3];
+        for (int point_index = 0; point_index < 3; ++point_index)
+        {
+            const Eigen::Vector3f camera_point = rotation*object_points[point_index] + translation;
+
+            image_points[point_index] = Eigen::Vector2f(camera_point.x() / camera_point.z(), camera_point.y() / camera_point.z());
+        }
+
+        EigenP3PBearings bearings;
+        bearings.set(image_points);
+
+        const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+        {
+            Eigen::Matrix3f rotations[4];
+            Eigen::Vector3f translations[4];
+            const int solution_count = eigen_alignment_solve_p3p(bearings, object_points, rotations, translations);
+            sink = sink + ((solution_count > 0) ? translations[0].z() : 0.f);
+        });
+        print_result("solve_p3p", 3, result);
+    }
+
+    // Gravity/magnetometer frame alignment, the way the orientation filter calls it
+    if (get_is_case_enabled(filter, "quaternion_between_vector_frames"))
+    {
+        const Eigen::Vector3f identity_g(0.f, 1.f, 0.f);
+        const Eigen::Vector3f identity_m = Eigen::Vector3f(0.f, -0.6f, 0.8f).normalized();
+        const Eigen::Quaternionf actual(Eigen::AngleAxisf(0.4f, Eigen::Vector3f(0.2f, 1.f, 0.3f).normalized()));
+        const Eigen::Quaternionf initial_q(Eigen::AngleAxisf(0.35f, Eigen::Vector3f(0.25f, 1.f, 0.3f).normalized()));
+        const Eigen::Vector3f current_g = eigen_vector3f_clockwise_rotate(actual, identity_g);
+        const Eigen::Vector3f current_m = eigen_vector3f_clockwise_rotate(actual, identity_m);
+        const Eigen::Vector3f* from[2] = { &identity_g, &identity_m };
+        const Eigen::Vector3f* to[2] = { &current_g, &current_m };
+
+        const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+        {
+            Eigen::Quaternionf mg_orientation;
+            eigen_alignment_quaternion_between_vector_frames(from, to, 0.1f, initial_q, mg_orientation);
+            sink = sink + mg_orientation.w();
+        });
+        print_result("quaternion_between_vector_frames", 2, result);
+    }
+
+    // Per sample helpers: calling through the pointers can't be inlined,
+    // which is what every call into the math library cost before the helpers moved into the headers
+    {
+        float (* volatile clampf_ptr)(float, float, float) = clampf;
+        float (* volatile lerpf_ptr)(float, float, float) = lerpf;
+        float (* volatile safe_divide_ptr)(float, float, float) = safe_divide_with_default;
+        float (* volatile wrap_radians_ptr)(float) = wrap_radians;
+        float (*clampf_call)(float, float, float) = clampf_ptr;
+        float (*lerpf_call)(float, float, float) = lerpf_ptr;
+        float (*safe_divide_call)(float, float, float) = safe_divide_ptr;
+        float (*wrap_radians_call)(float) = wrap_radians_ptr;
+        int sample_index = 0;
+
+        if (get_is_case_enabled(filter, "scalar_helpers_inline"))
+        {
+            const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+            {
+                const float x = static_cast<float>(++sample_index & 0xff) * 0.01f;
+                sink = sink + wrap_radians(lerpf(clampf(x, 0.5f, 2.f), x, 0.25f)) + safe_divide_with_default(x, x - 1.f, 0.f);
+            });
+            print_result("scalar_helpers_inline", 4, result);
+        }
+
+        if (get_is_case_enabled(filter, "scalar_helpers_out_of_line"))
+        {
+            const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+            {
+                const float x = static_cast<float>(++sample_index & 0xff) * 0.01f;
+                sink = sink + wrap_radians_call(lerpf_call(clampf_call(x, 0.5f, 2.f), x, 0.25f)) + safe_divide_call(x, x - 1.f, 0.f);
+            });
+            print_result("scalar_helpers_out_of_line", 4, result);
+        }
+    }
+
+    {
+        Eigen::Vector3f (* volatile rotate_ptr)(const Eigen::Quaternionf &, const Eigen::Vector3f &) = eigen_vector3f_clockwise_rotate;
+        Eigen::Quaternionf (* volatile lerp_ptr)(const Eigen::Quaternionf &, const Eigen::Quaternionf &, const float) = eigen_quaternion_normalized_lerp;
+        float (* volatile normalize_ptr)(Eigen::Quaternionf &, const Eigen::Quaternionf &) = eigen_quaternion_normalize_with_default;
+        Eigen::Vector3f (*rotate_call)(const Eigen::Quaternionf &, const Eigen::Vector3f &) = rotate_ptr;
+        Eigen::Quaternionf (*lerp_call)(const Eigen::Quaternionf &, const Eigen::Quaternionf &, const float) = lerp_ptr;
+        float (*normalize_call)(Eigen::Quaternionf &, const Eigen::Quaternionf &) = normalize_ptr;
+        const Eigen::Quaternionf a = Eigen::Quaternionf(Eigen::AngleAxisf(0.3f, Eigen::Vector3f(1.f, 2.f, 3.f).normalized()));
+        const Eigen::Quaternionf b = Eigen::Quaternionf(Eigen::AngleAxisf(-0.7f, Eigen::Vector3f(-2.f, 1.f, 0.5f).normalized()));
+        int sample_index = 0;
+
+        if (get_is_case_enabled(filter, "quaternion_helpers_inline"))
+        {
+            const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+            {
+                const float u = static_cast<float>(++sample_index & 0xff) / 255.f;
+                Eigen::Quaternionf q = eigen_quaternion_normalized_lerp(a, b, u);
+
+                eigen_quaternion_normalize_with_default(q, Eigen::Quaternionf::Identity());
+                sink = sink + eigen_vector3f_clockwise_rotate(q, Eigen::Vector3f(u, 1.f, 0.f)).x();
+            });
+            print_result("quaternion_helpers_inline", 3, result);
+        }
+
+        if (get_is_case_enabled(filter, "quaternion_helpers_out_of_line"))
+        {
+            const BenchmarkResult result = run_benchmark(min_time_ms, [&]()
+            {
+                const float u = static_cast<float>(++sample_index & 0xff) / 255.f;
+                Eigen::Quaternionf q = lerp_call(a, b, u);
+
+                normalize_call(q, Eigen::Quaternionf::Identity());
+                sink = sink + rotate_call(q, Eigen::Vector3f(u, 1.f, 0.f)).x();
+            });
+            print_result("quaternion_helpers_out_of_line", 3, result);
+        }
+    }
+
+    return 0;
+}
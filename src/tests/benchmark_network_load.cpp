@@ -0,0 +1,710 @@
+// Load generator for the service's connection handling.
+//
+// Opens many concurrent connections to a running PSMoveService, each one a ClientNetworkManager
+// exactly like PSMoveClient uses. Every connection lists the devices, streams all controllers and HMDs
+// (and optionally the trackers) with one of several stream flag profiles, and keeps firing
+// read-only configuration requests at the service. One of them also polls GET_SERVICE_STATS,
+// which is where the service tick rate and its UDP send throughput come from.
+//
+// Usage: benchmark_network_load [--host H] [--port P] [--connections N] [--seconds T]
+//                               [--report-seconds R] [--request-interval-ms I]
+//                               [--trackers 0|1] [--tracker-video 0|1]
+//
+// Prints one report line every R seconds. Fails if a connection drops or can't be opened,
+// or a request comes back with an error.
+
+//-- includes -----
+#include "ClientConstants.h"
+#include "ClientLog.h"
+#include "ClientNetworkInterface.h"
+#include "ClientNetworkManager.h"
+#include "PSMoveProtocol.pb.h"
+#include "PSMoveProtocolInterface.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-- constants -----
+static const int k_connect_timeout_ms = 5000;
+
+//-- definitions -----
+/// Stream flags a connection starts its controller streams with, the connections take turns
+struct StreamProfile
+{
+    const char *name;
+    bool include_physics_data;
+    bool include_raw_sensor_data;
+    bool include_calibrated_sensor_data;
+    bool include_raw_tracker_data;
+    bool include_all_tracker_data;
+    bool use_packed_tracker_data;
+    bool use_compact_pose_stream;
+    float max_update_rate_hz;
+    bool only_send_changes;
+};
+
+static const StreamProfile k_stream_profiles[] = {
+    // name,            phys,  raw,   cal,   trkr,  all,   packed, compact, rate, delta
+    { "pose",           false, false, false, false, false, false,  false,   0.f,  false },
+    { "pose+physics",   true,  false, false, false, false, false,  false,   0.f,  false },
+    { "sensors",        true,  true,  true,  true,  false, false,  false,   0.f,  false },
+    { "compact",        false, false, false, false, false, false,  true,    0.f,  false },
+    { "throttled",      true,  false, false, false, false, false,  false,   30.f, true },
+    { "all trackers",   false, false, false, true,  true,  true,   false,   0.f,  false },
+};
+static const int k_stream_profile_count = sizeof(k_stream_profiles) / sizeof(k_stream_profiles[0]);
+
+/// The read-only requests the connections rotate through once they are streaming
+static const PSMoveProtocol::Request_RequestType k_config_request_types[] = {
+    PSMoveProtocol::Request_RequestType_GET_SERVICE_VERSION,
+    PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST,
+    PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST,
+    PSMoveProtocol::Request_RequestType_GET_HMD_LIST,
+    PSMoveProtocol::Request_RequestType_GET_TRACKING_SPACE_SETTINGS,
+};
+static const int k_config_request_type_count = sizeof(k_config_request_types) / sizeof(k_config_request_types[0]);
+
+struct LoadSettings
+{
+    std::string host;
+    std::string port;
+    int connection_count;
+    int duration_seconds;
+    int report_seconds;
+    int request_interval_ms;
+    bool bStreamTrackers;
+    bool bStreamTrackerVideo;
+};
+
+/// What all of the connections saw since the last report
+struct LoadStats
+{
+    long long data_frame_count;
+    long long compact_pose_frame_count;
+    long long notification_count;
+    long long failed_response_count;
+    std::vector<double> request_round_trips_ms;
+
+    void clear()
+    {
+        data_frame_count = 0;
+        compact_pose_frame_count = 0;
+        notification_count = 0;
+        failed_response_count = 0;
+        request_round_trips_ms.clear();
+    }
+};
+
+/// One client connection to the service.
+/// Everything gets called back from ClientNetworkManager::update() on the main thread.
+class LoadConnection :
+    public IDataFrameListener,
+    public INotificationListener,
+    public IResponseListener,
+    public IClientNetworkEventListener
+{
+public:
+    LoadConnection(const LoadSettings &settings, const int connection_index, LoadStats &stats)
+        : m_settings(settings)
+        , m_stream_profile(k_stream_profiles[connection_index % k_stream_profile_count])
+        , m_stats(stats)
+        , m_network_manager(settings.host, settings.port, this, this, this, this)
+        , m_bIsConnected(false)
+        , m_bConnectionFailed(false)
+        , m_bStreamsStarted(false)
+        , m_next_request_id(0)
+        , m_next_config_request_index(connection_index % k_config_request_type_count)
+        , m_pending_list_count(0)
+    {
+    }
+
+    bool startup()
+    {
+        m_next_config_request_time = std::chrono::steady_clock::now();
+
+        return m_network_manager.startup(false);
+    }
+
+    void shutdown()
+    {
+        m_network_manager.shutdown();
+    }
+
+    void update()
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        m_network_manager.update();
+
+        if (m_bStreamsStarted && m_settings.request_interval_ms > 0 && now >= m_next_config_request_time)
+        {
+            RequestPtr request(new PSMoveProtocol::Request());
+            request->set_type(k_config_request_types[m_next_config_request_index]);
+
+            if (request->type() == PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST)
+            {
+                request->mutable_request_get_controller_list()->set_include_usb_controllers(true);
+            }
+
+            send_request(request);
+
+            m_next_config_request_index = (m_next_config_request_index + 1) % k_config_request_type_count;
+            m_next_config_request_time = now + std::chrono::milliseconds(m_settings.request_interval_ms);
+        }
+    }
+
+    void request_service_stats()
+    {
+        RequestPtr request(new PSMoveProtocol::Request());
+        request->set_type(PSMoveProtocol::Request_RequestType_GET_SERVICE_STATS);
+        request->mutable_request_get_service_stats();
+
+        send_request(request);
+    }
+
+    inline bool get_is_connected() const { return m_bIsConnected; }
+    inline bool get_connection_failed() const { return m_bConnectionFailed; }
+    inline bool get_streams_started() const { return m_bStreamsStarted; }
+    inline const char *get_stream_profile_name() const { return m_stream_profile.name; }
+    inline const PSMoveProtocol::Response_ResultServiceStats &get_service_stats() const { return m_service_stats; }
+
+    // -- IDataFrameListener
+    void handle_data_frame(const PSMoveProtocol::DeviceOutputDataFrame *data_frame) override
+    {
+        ++m_stats.data_frame_count;
+    }
+
+    void handle_compact_pose_frame(const CompactControllerPoseFrame *pose_frame) override
+    {
+        ++m_stats.compact_pose_frame_count;
+    }
+
+    void handle_compact_orientation_frame(const CompactControllerOrientationFrame *orientation_frame) override
+    {
+        ++m_stats.compact_pose_frame_count;
+    }
+
+    // -- INotificationListener
+    void handle_notification(ResponsePtr response) override
+    {
+        ++m_stats.notification_count;
+    }
+
+    // -- IResponseListener
+    void handle_request_canceled(RequestPtr request) override
+    {
+        m_pending_requests.erase(request->request_id());
+        ++m_stats.failed_response_count;
+    }
+
+    void handle_response(ResponsePtr response) override
+    {
+        const auto iter = m_pending_requests.find(response->request_id());
+
+        if (iter == m_pending_requests.end())
+        {
+            return;
+        }
+
+        const PendingRequest pending_request = iter->second;
+        m_pending_requests.erase(iter);
+
+        const std::chrono::duration<double, std::milli> round_trip = std::chrono::steady_clock::now() - pending_request.send_time;
+        m_stats.request_round_trips_ms.push_back(round_trip.count());
+
+        if (response->result_code() != PSMoveProtocol::Response_ResultCode_RESULT_OK)
+        {
+            ++m_stats.failed_response_count;
+            return;
+        }
+
+        switch (pending_request.type)
+        {
+        case PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST:
+            if (!m_bStreamsStarted)
+            {
+                for (const auto &controller_info : response->result_controller_list().controllers())
+                {
+                    m_controller_ids.push_back(controller_info.controller_id());
+                }
+                handle_device_list_received();
+            }
+            break;
+        case PSMoveProtocol::Request_RequestType_GET_HMD_LIST:
+            if (!m_bStreamsStarted)
+            {
+                for (const auto &hmd_info : response->result_hmd_list().hmd_entries())
+                {
+                    m_hmd_ids.push_back(hmd_info.hmd_id());
+                }
+                handle_device_list_received();
+            }
+            break;
+        case PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST:
+            if (!m_bStreamsStarted)
+            {
+                for (const auto &tracker_info : response->result_tracker_list().trackers())
+                {
+                    m_tracker_ids.push_back(tracker_info.tracker_id());
+                }
+                handle_device_list_received();
+            }
+            break;
+        case PSMoveProtocol::Request_RequestType_GET_SERVICE_STATS:
+            m_service_stats = response->result_service_stats();
+            break;
+        default:
+            break;
+        }
+    }
+
+    // -- IClientNetworkEventListener
+    void handle_server_connection_opened() override
+    {
+        m_bIsConnected = true;
+
+        // Find out what there is to stream first
+        RequestPtr controller_list_request(new PSMoveProtocol::Request());
+        controller_list_request->set_type(PSMoveProtocol::Request_RequestType_GET_CONTROLLER_LIST);
+        controller_list_request->mutable_request_get_controller_list()->set_include_usb_controllers(false);
+        send_request(controller_list_request);
+
+        RequestPtr hmd_list_request(new PSMoveProtocol::Request());
+        hmd_list_request->set_type(PSMoveProtocol::Request_RequestType_GET_HMD_LIST);
+        send_request(hmd_list_request);
+
+        RequestPtr tracker_list_request(new PSMoveProtocol::Request());
+        tracker_list_request->set_type(PSMoveProtocol::Request_RequestType_GET_TRACKER_LIST);
+        send_request(tracker_list_request);
+
+        m_pending_list_count = 3;
+    }
+
+    void handle_server_connection_open_failed(const boost::system::error_code &ec) override
+    {
+        printf("Failed to connect to %s:%s: %s\n", m_settings.host.c_str(), m_settings.port.c_str(), ec.message().c_str());
+        m_bConnectionFailed = true;
+    }
+
+    void handle_server_connection_closed() override
+    {
+        m_bIsConnected = false;
+    }
+
+    void handle_server_connection_close_failed(const boost::system::error_code &ec) override
+    {
+        m_bIsConnected = false;
+    }
+
+    void handle_server_connection_socket_error(const boost::system::error_code &ec) override
+    {
+        printf("Connection lost: %s\n", ec.message().c_str());
+        m_bIsConnected = false;
+        m_bConnectionFailed = true;
+    }
+
+private:
+    struct PendingRequest
+    {
+        PSMoveProtocol::Request_RequestType type;
+        std::chrono::steady_clock::time_point send_time;
+    };
+
+    void send_request(RequestPtr request)
+    {
+        PendingRequest pending_request;
+        pending_request.type = request->type();
+        pending_request.send_time = std::chrono::steady_clock::now();
+
+        request->set_request_id(m_next_request_id);
+        m_pending_requests[m_next_request_id] = pending_request;
+        ++m_next_request_id;
+
+        m_network_manager.send_request(request);
+    }
+
+    void handle_device_list_received()
+    {
+        --m_pending_list_count;
+        if (m_pending_list_count > 0)
+        {
+            return;
+        }
+
+        for (const int controller_id : m_controller_ids)
+        {
+            RequestPtr request(new PSMoveProtocol::Request());
+            request->set_type(PSMoveProtocol::Request_RequestType_START_CONTROLLER_DATA_STREAM);
+
+            auto *stream_request = request->mutable_request_start_psmove_data_stream();
+            stream_request->set_controller_id(controller_id);
+            stream_request->set_include_position_data(true);
+            stream_request->set_include_physics_data(m_stream_profile.include_physics_data);
+            stream_request->set_include_raw_sensor_data(m_stream_profile.include_raw_sensor_data);
+            stream_request->set_include_calibrated_sensor_data(m_stream_profile.include_calibrated_sensor_data);
+            stream_request->set_include_raw_tracker_data(m_stream_profile.include_raw_tracker_data);
+            stream_request->set_include_all_tracker_data(m_stream_profile.include_all_tracker_data);
+            stream_request->set_use_packed_tracker_data(m_stream_profile.use_packed_tracker_data);
+            stream_request->set_use_compact_pose_stream(m_stream_profile.use_compact_pose_stream);
+            stream_request->set_max_update_rate_hz(m_stream_profile.max_update_rate_hz);
+            stream_request->set_only_send_changes(m_stream_profile.only_send_changes);
+
+            send_request(request);
+        }
+
+        for (const int hmd_id : m_hmd_ids)
+        {
+            RequestPtr request(new PSMoveProtocol::Request());
+            request->set_type(PSMoveProtocol::Request_RequestType_START_HMD_DATA_STREAM);
+
+            auto *stream_request = request->mutable_request_start_hmd_data_stream();
+            stream_request->set_hmd_id(hmd_id);
+            stream_request->set_include_position_data(true);
+            stream_request->set_include_physics_data(m_stream_profile.include_physics_data);
+            stream_request->set_include_raw_sensor_data(m_stream_profile.include_raw_sensor_data);
+            stream_request->set_include_calibrated_sensor_data(m_stream_profile.include_calibrated_sensor_data);
+            stream_request->set_include_raw_tracker_data(m_stream_profile.include_raw_tracker_data);
+            stream_request->set_include_all_tracker_data(m_stream_profile.include_all_tracker_data);
+            stream_request->set_use_packed_tracker_data(m_stream_profile.use_packed_tracker_data);
+
+            send_request(request);
+        }
+
+        if (m_settings.bStreamTrackers)
+        {
+            for (const int tracker_id : m_tracker_ids)
+            {
+                RequestPtr request(new PSMoveProtocol::Request());
+                request->set_type(PSMoveProtocol::Request_RequestType_START_TRACKER_DATA_STREAM);
+
+                auto *stream_request = request->mutable_request_start_tracker_data_stream();
+                stream_request->set_tracker_id(tracker_id);
+                stream_request->set_stream_network_video(m_settings.bStreamTrackerVideo);
+
+                send_request(request);
+            }
+        }
+
+        m_bStreamsStarted = true;
+    }
+
+    const LoadSettings &m_settings;
+    const StreamProfile &m_stream_profile;
+    LoadStats &m_stats;
+    ClientNetworkManager m_network_manager;
+    bool m_bIsConnected;
+    bool m_bConnectionFailed;
+    bool m_bStreamsStarted;
+    int m_next_request_id;
+    std::map<int, PendingRequest> m_pending_requests;
+    std::chrono::steady_clock::time_point m_next_config_request_time;
+    int m_next_config_request_index;
+    int m_pending_list_count;
+    std::vector<int> m_controller_ids;
+    std::vector<int> m_hmd_ids;
+    std::vector<int> m_tracker_ids;
+    PSMoveProtocol::Response_ResultServiceStats m_service_stats;
+};
+
+//-- private functions -----
+static void print_usage()
+{
+    printf("Usage: benchmark_network_load [--host H] [--port P] [--connections N] [--seconds T]\n");
+    printf("                              [--report-seconds R] [--request-interval-ms I]\n");
+    printf("                              [--trackers 0|1] [--tracker-video 0|1]\n");
+}
+
+static bool parse_arguments(int argc, char *argv[], LoadSettings &settings)
+{
+    bool bSuccess = true;
+
+    for (int arg_index = 1; bSuccess && arg_index < argc; ++arg_index)
+    {
+        const char *arg = argv[arg_index];
+        const char *value = (arg_index + 1 < argc) ? argv[arg_index + 1] : nullptr;
+
+        if (value == nullptr)
+        {
+            bSuccess = false;
+        }
+        else if (strcmp(arg, "--host") == 0)
+        {
+            settings.host = value;
+        }
+        else if (strcmp(arg, "--port") == 0)
+        {
+            settings.port = value;
+        }
+        else if (strcmp(arg, "--connections") == 0)
+        {
+            settings.connection_count = atoi(value);
+        }
+        else if (strcmp(arg, "--seconds") == 0)
+        {
+            settings.duration_seconds = atoi(value);
+        }
+        else if (strcmp(arg, "--report-seconds") == 0)
+        {
+            settings.report_seconds = atoi(value);
+        }
+        else if (strcmp(arg, "--request-interval-ms") == 0)
+        {
+            settings.request_interval_ms = atoi(value);
+        }
+        else if (strcmp(arg, "--trackers") == 0)
+        {
+            settings.bStreamTrackers = atoi(value) != 0;
+        }
+        else if (strcmp(arg, "--tracker-video") == 0)
+        {
+            settings.bStreamTrackerVideo = atoi(value) != 0;
+        }
+        else
+        {
+            bSuccess = false;
+        }
+
+        ++arg_index;
+    }
+
+    settings.connection_count = std::max(settings.connection_count, 1);
+    settings.duration_seconds = std::max(settings.duration_seconds, 1);
+    settings.report_seconds = std::max(settings.report_seconds, 1);
+    settings.request_interval_ms = std::max(settings.request_interval_ms, 0);
+
+    return bSuccess;
+}
+
+static bool connect_all(std::vector<LoadConnection *> &connections)
+{
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    bool bSuccess = true;
+
+    for (LoadConnection *connection : connections)
+    {
+        bSuccess &= connection->startup();
+    }
+
+    while (bSuccess)
+    {
+        int started_count = 0;
+
+        for (LoadConnection *connection : connections)
+        {
+            connection->update();
+            bSuccess &= !connection->get_connection_failed();
+
+            if (connection->get_streams_started())
+            {
+                ++started_count;
+            }
+        }
+
+        if (started_count == static_cast<int>(connections.size()))
+        {
+            const std::chrono::duration<double, std::milli> connect_time = std::chrono::steady_clock::now() - start_time;
+
+            printf("%d connections streaming after %.1f ms\n", started_count, connect_time.count());
+            break;
+        }
+
+        if (std::chrono::steady_clock::now() - start_time > std::chrono::milliseconds(k_connect_timeout_ms))
+        {
+            printf("Timed out with %d of %d connections streaming\n", started_count, static_cast<int>(connections.size()));
+            bSuccess = false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return bSuccess;
+}
+
+static double get_percentile(const std::vector<double> &sorted_values, const double fraction)
+{
+    if (sorted_values.empty())
+    {
+        return 0.0;
+    }
+
+    const size_t index = std::min(static_cast<size_t>(fraction*static_cast<double>(sorted_values.size())), sorted_values.size() - 1);
+
+    return sorted_values[index];
+}
+
+static void print_report_header()
+{
+    printf("%7s %6s %10s %10s %8s %8s %8s %7s %8s %10s %10s %7s %8s\n",
+        "seconds", "open", "frames/s", "compact/s", "notify/s", "rtt p50", "rtt p99", "failed",
+        "tick Hz", "tick ms", "udp dgm/s", "queued", "dropped");
+}
+
+static void print_report(
+    const double elapsed_seconds,
+    const double report_seconds,
+    const int open_connection_count,
+    LoadStats &stats,
+    const PSMoveProtocol::Response_ResultServiceStats &service_stats)
+{
+    std::sort(stats.request_round_trips_ms.begin(), stats.request_round_trips_ms.end());
+
+    // What the service sent to all of the connections, load generator or not
+    double udp_datagrams_per_second = 0.0;
+    int max_queued_data_frame_count = 0;
+    long long dropped_data_frame_count = 0;
+    for (const auto &connection_stats : service_stats.connection_entries())
+    {
+        udp_datagrams_per_second += connection_stats.udp_datagrams_per_second();
+        max_queued_data_frame_count = std::max(max_queued_data_frame_count, connection_stats.max_queued_data_frame_count());
+        dropped_data_frame_count += connection_stats.dropped_data_frame_count();
+    }
+
+    const float loop_rate_hz = service_stats.loop_rate_hz();
+
+    printf("%7.0f %6d %10.0f %10.0f %8.1f %8.2f %8.2f %7lld %8.1f %10.2f %10.0f %7d %8lld\n",
+        elapsed_seconds,
+        open_connection_count,
+        static_cast<double>(stats.data_frame_count) / report_seconds,
+        static_cast<double>(stats.compact_pose_frame_count) / report_seconds,
+        static_cast<double>(stats.notification_count) / report_seconds,
+        get_percentile(stats.request_round_trips_ms, 0.5),
+        get_percentile(stats.request_round_trips_ms, 0.99),
+        stats.failed_response_count,
+        loop_rate_hz,
+        (loop_rate_hz > 0.f) ? 1000.0 / loop_rate_hz : 0.0,
+        udp_datagrams_per_second,
+        max_queued_data_frame_count,
+        dropped_data_frame_count);
+    fflush(stdout);
+}
+
+static bool run_load(const LoadSettings &settings)
+{
+    std::vector<LoadConnection *> connections;
+    LoadStats stats;
+    bool bSuccess = true;
+
+    stats.clear();
+
+    for (int connection_index = 0; connection_index < settings.connection_count; ++connection_index)
+    {
+        connections.push_back(new LoadConnection(settings, connection_index, stats));
+    }
+
+    bSuccess = connect_all(connections);
+
+    if (bSuccess)
+    {
+        LoadConnection *stats_connection = connections[0];
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        const std::chrono::steady_clock::time_point end_time = start_time + std::chrono::seconds(settings.duration_seconds);
+        const std::chrono::steady_clock::duration report_period = std::chrono::seconds(settings.report_seconds);
+        std::chrono::steady_clock::time_point report_start_time = start_time;
+        long long total_failed_response_count = 0;
+
+        stats.clear();
+        stats_connection->request_service_stats();
+        print_report_header();
+
+        while (bSuccess)
+        {
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+            if (now - report_start_time >= report_period || now >= end_time)
+            {
+                const std::chrono::duration<double> elapsed_time = now - start_time;
+                const std::chrono::duration<double> report_time = now - report_start_time;
+                int open_connection_count = 0;
+
+                for (LoadConnection *connection : connections)
+                {
+                    if (connection->get_is_connected())
+                    {
+                        ++open_connection_count;
+                    }
+                }
+
+                total_failed_response_count += stats.failed_response_count;
+                print_report(elapsed_time.count(), report_time.count(), open_connection_count, stats, stats_connection->get_service_stats());
+
+                stats.clear();
+                stats_connection->request_service_stats();
+                report_start_time = now;
+
+                if (now >= end_time)
+                {
+                    break;
+                }
+            }
+
+            for (LoadConnection *connection : connections)
+            {
+                connection->update();
+
+                if (connection->get_connection_failed())
+                {
+                    bSuccess = false;
+                }
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (total_failed_response_count > 0)
+        {
+            printf("FAILED: %lld requests failed or got canceled\n", total_failed_response_count);
+            bSuccess = false;
+        }
+    }
+
+    for (LoadConnection *connection : connections)
+    {
+        connection->shutdown();
+    }
+
+    for (LoadConnection *connection : connections)
+    {
+        delete connection;
+    }
+    connections.clear();
+
+    return bSuccess;
+}
+
+//-- entry point -----
+int main(int argc, char *argv[])
+{
+    LoadSettings settings;
+    settings.host = PSMOVESERVICE_DEFAULT_ADDRESS;
+    settings.port = PSMOVESERVICE_DEFAULT_PORT;
+    settings.connection_count = 32;
+    settings.duration_seconds = 60;
+    settings.report_seconds = 5;
+    settings.request_interval_ms = 100;
+    settings.bStreamTrackers = false;
+    settings.bStreamTrackerVideo = false;
+
+    if (!parse_arguments(argc, argv, settings))
+    {
+        print_usage();
+        return -1;
+    }
+
+    log_init(_log_severity_level_error);
+
+    printf("Connecting %d clients to %s:%s, stream profiles:", settings.connection_count, settings.host.c_str(), settings.port.c_str());
+    for (int profile_index = 0; profile_index < std::min(settings.connection_count, k_stream_profile_count); ++profile_index)
+    {
+        printf(" %s", k_stream_profiles[profile_index].name);
+    }
+    printf("\n");
+
+    return run_load(settings) ? 0 : -1;
+}
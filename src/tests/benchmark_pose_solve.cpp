@@ -0,0 +1,296 @@
+// Compares the P3P hypothesis cost of the point cloud (Morpheus) correspondence search
+// against the OpenCV path it replaced.
+//
+// A Morpheus sized LED cloud gets projected through the default PS3Eye intrinsics
+// from a handful of poses, then every hypothesis of a full search is:
+//  - solved the way the search used to, with cv::solvePnP(SOLVEPNP_P3P) on a 4-tuple of LEDs
+//    followed by cv::projectPoints of the whole cloud (9*8*7*6 hypotheses),
+//  - solved with eigen_alignment_solve_p3p on a triple of LEDs against bearings that get
+//    set up once per search, followed by a pinhole projection of the cloud (9*8*7 hypotheses).
+// Also reports how often each path has the true pose among its hypotheses.
+//
+// Usage: benchmark_pose_solve [--iterations I]
+
+//-- includes -----
+#include "MathAlignment.h"
+#include "MathUtility.h"
+
+#include <opencv2/core.hpp>
+#include <opencv2/calib3d.hpp>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+//-- constants -----
+static const int k_default_iteration_count = 20;
+static const int k_pose_count = 8;
+static const int k_led_count = 9;
+
+static const float k_frame_width = 640.f;
+static const float k_frame_height = 480.f;
+static const float k_focal_length_px = 554.2563f; // PS3EyeTrackerConfig default
+
+// Roughly the Morpheus LED layout in cm: front face, sides and back strap
+static const float k_led_points[k_led_count][3] = {
+    {-9.f, 3.f, 0.f}, {-4.f, 5.f, -1.f}, {3.f, 4.f, -1.f}, {9.f, 2.f, 0.f},
+    {-7.f, -3.f, -1.f}, {8.f, -4.f, -2.f}, {1.f, -4.f, -1.5f},
+    {-9.f, 1.f, -8.f}, {9.f, -1.f, -7.f}
+};
+
+// Furthest a hypothesis can be from the true pose and still count as having found it
+static const float k_found_pose_tolerance_cm = 0.5f;
+
+//-- definitions -----
+struct BenchmarkPose
+{
+    Eigen::Matrix3f rotation;
+    Eigen::Vector3f translation;
+    std::vector<cv::Point2f> image_points;
+};
+
+//-- private functions -----
+static void print_usage()
+{
+    printf("Usage: benchmark_pose_solve [--iterations I]\n");
+}
+
+static bool parse_arguments(int argc, char *argv[], int &out_iteration_count)
+{
+    for (int arg_index = 1; arg_index < argc; ++arg_index)
+    {
+        if (strcmp(argv[arg_index], "--iterations") == 0 && arg_index + 1 < argc)
+        {
+            out_iteration_count = atoi(argv[++arg_index]);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return out_iteration_count > 0;
+}
+
+static void build_poses(std::vector<BenchmarkPose> &out_poses)
+{
+    out_poses.resize(k_pose_count);
+
+    for (int pose_index = 0; pose_index < k_pose_count; ++pose_index)
+    {
+        BenchmarkPose &pose = out_poses[pose_index];
+        const float angle = k_real_two_pi * static_cast<float>(pose_index) / static_cast<float>(k_pose_count);
+
+        // Facing the camera from 1-1.5m away, turned up to about 35 degrees
+        pose.rotation = Eigen::AngleAxisf(0.6f*sinf(angle), Eigen::Vector3f(0.2f, 1.f, 0.1f).normalized()).toRotationMatrix();
+        pose.translation = Eigen::Vector3f(15.f*cosf(angle), 5.f*sinf(angle), 125.f + 25.f*cosf(angle));
+
+        pose.image_points.clear();
+        for (int led_index = 0; led_index < k_led_count; ++led_index)
+        {
+            const Eigen::Vector3f camera_point =
+                pose.rotation*Eigen::Vector3f(k_led_points[led_index][0], k_led_points[led_index][1], k_led_points[led_index][2]) +
+                pose.translation;
+
+            pose.image_points.push_back(
+                cv::Point2f(
+                    k_focal_length_px*camera_point.x() / camera_point.z() + 0.5f*k_frame_width,
+                    k_focal_length_px*camera_point.y() / camera_point.z() + 0.5f*k_frame_height));
+        }
+    }
+}
+
+// Returns the us per full search, counts the searches whose hypotheses include the true pose
+static double benchmark_opencv_search(
+    const std::vector<BenchmarkPose> &poses,
+    const int iteration_count,
+    int &out_found_count)
+{
+    const cv::Matx33f camera_matrix(
+        k_focal_length_px, 0.f, 0.5f*k_frame_width,
+        0.f, k_focal_length_px, 0.5f*k_frame_height,
+        0.f, 0.f, 1.f);
+    const cv::Matx<float, 5, 1> dist_coeffs = cv::Matx<float, 5, 1>::zeros();
+
+    std::vector<cv::Point3f> object_points;
+    for (int led_index = 0; led_index < k_led_count; ++led_index)
+    {
+        object_points.push_back(cv::Point3f(k_led_points[led_index][0], k_led_points[led_index][1], k_led_points[led_index][2]));
+    }
+
+    std::vector<cv::Point3f> seed_object_points(4);
+    std::vector<cv::Point2f> projected_points;
+    cv::Mat rvec(3, 1, cv::DataType<double>::type);
+    cv::Mat tvec(3, 1, cv::DataType<double>::type);
+    float sink = 0.f;
+
+    out_found_count = 0;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int iteration = 0; iteration < iteration_count; ++iteration)
+    {
+        for (const BenchmarkPose &pose : poses)
+        {
+            const std::vector<cv::Point2f> seed_image_points(pose.image_points.begin(), pose.image_points.begin() + 4);
+            bool bFoundPose = false;
+
+            for (int a = 0; a < k_led_count; ++a)
+                for (int b = 0; b < k_led_count; ++b)
+                    for (int c = 0; c < k_led_count; ++c)
+                        for (int d = 0; d < k_led_count; ++d)
+                        {
+                            if (a == b || a == c || a == d || b == c || b == d || c == d)
+                                continue;
+
+                            seed_object_points[0] = object_points[a];
+                            seed_object_points[1] = object_points[b];
+                            seed_object_points[2] = object_points[c];
+                            seed_object_points[3] = object_points[d];
+
+                            if (!cv::solvePnP(
+                                    seed_object_points, seed_image_points,
+                                    camera_matrix, dist_coeffs,
+                                    rvec, tvec,
+                                    false, cv::SOLVEPNP_P3P))
+                            {
+                                continue;
+                            }
+
+                            cv::projectPoints(object_points, rvec, tvec, camera_matrix, dist_coeffs, projected_points);
+                            sink += projected_points[0].x;
+
+                            const Eigen::Vector3f translation(
+                                static_cast<float>(tvec.at<double>(0)),
+                                static_cast<float>(tvec.at<double>(1)),
+                                static_cast<float>(tvec.at<double>(2)));
+                            bFoundPose |= (translation - pose.translation).norm() < k_found_pose_tolerance_cm;
+                        }
+
+            if (iteration == 0 && bFoundPose)
+            {
+                ++out_found_count;
+            }
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    if (sink == 0.f)
+    {
+        printf("(opencv sink %f)\n", sink);
+    }
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / (iteration_count*poses.size());
+}
+
+static double benchmark_eigen_search(
+    const std::vector<BenchmarkPose> &poses,
+    const int iteration_count,
+    int &out_found_count)
+{
+    Eigen::Vector3f led_points[k_led_count];
+    for (int led_index = 0; led_index < k_led_count; ++led_index)
+    {
+        led_points[led_index] = Eigen::Vector3f(k_led_points[led_index][0], k_led_points[led_index][1], k_led_points[led_index][2]);
+    }
+
+    std::vector<cv::Point2f> projected_points(k_led_count);
+    float sink = 0.f;
+
+    out_found_count = 0;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int iteration = 0; iteration < iteration_count; ++iteration)
+    {
+        for (const BenchmarkPose &pose : poses)
+        {
+            // No distortion, so the undistortion the search does up front is just the normalization
+            Eigen::Vector2f seed_image_points[3];
+            for (int point_index = 0; point_index < 3; ++point_index)
+            {
+                const cv::Point2f &point = pose.image_points[point_index];
+
+                seed_image_points[point_index] =
+                    Eigen::Vector2f(
+                        (point.x - 0.5f*k_frame_width) / k_focal_length_px,
+                        (point.y - 0.5f*k_frame_height) / k_focal_length_px);
+            }
+
+            EigenP3PBearings bearings;
+            bearings.set(seed_image_points);
+            bool bFoundPose = false;
+
+            for (int a = 0; a < k_led_count; ++a)
+                for (int b = 0; b < k_led_count; ++b)
+                    for (int c = 0; c < k_led_count; ++c)
+                    {
+                        if (a == b || a == c || b == c)
+                            continue;
+
+                        const Eigen::Vector3f seed_object_points[3] = { led_points[a], led_points[b], led_points[c] };
+                        Eigen::Matrix3f rotations[4];
+                        Eigen::Vector3f translations[4];
+                        const int solution_count =
+                            eigen_alignment_solve_p3p(bearings, seed_object_points, rotations, translations);
+
+                        for (int solution_index = 0; solution_index < solution_count; ++solution_index)
+                        {
+                            for (int led_index = 0; led_index < k_led_count; ++led_index)
+                            {
+                                const Eigen::Vector3f camera_point =
+                                    rotations[solution_index]*led_points[led_index] + translations[solution_index];
+
+                                projected_points[led_index] =
+                                    cv::Point2f(
+                                        k_focal_length_px*camera_point.x() / camera_point.z() + 0.5f*k_frame_width,
+                                        k_focal_length_px*camera_point.y() / camera_point.z() + 0.5f*k_frame_height);
+                            }
+
+                            sink += projected_points[0].x;
+                            bFoundPose |= (translations[solution_index] - pose.translation).norm() < k_found_pose_tolerance_cm;
+                        }
+                    }
+
+            if (iteration == 0 && bFoundPose)
+            {
+                ++out_found_count;
+            }
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    if (sink == 0.f)
+    {
+        printf("(eigen sink %f)\n", sink);
+    }
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / (iteration_count*poses.size());
+}
+
+//-- entry point -----
+int main(int argc, char *argv[])
+{
+    int iteration_count = k_default_iteration_count;
+
+    if (!parse_arguments(argc, argv, iteration_count))
+    {
+        print_usage();
+        return -1;
+    }
+
+    std::vector<BenchmarkPose> poses;
+    build_poses(poses);
+
+    int opencv_found_count = 0;
+    int eigen_found_count = 0;
+    const double opencv_us = benchmark_opencv_search(poses, iteration_count, opencv_found_count);
+    const double eigen_us = benchmark_eigen_search(poses, iteration_count, eigen_found_count);
+
+    printf("%d searches of a %d LED cloud per path, us per search\n", iteration_count*k_pose_count, k_led_count);
+    printf("%8s %12s %12s %8s\n", "path", "hypotheses", "us", "found");
+    printf("%8s %12d %12.1f %5d/%d\n", "opencv", k_led_count*(k_led_count - 1)*(k_led_count - 2)*(k_led_count - 3), opencv_us, opencv_found_count, k_pose_count);
+    printf("%8s %12d %12.1f %5d/%d\n", "eigen", k_led_count*(k_led_count - 1)*(k_led_count - 2), eigen_us, eigen_found_count, k_pose_count);
+
+    return (opencv_found_count == k_pose_count && eigen_found_count == k_pose_count) ? 0 : -1;
+}
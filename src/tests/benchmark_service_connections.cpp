@@ -0,0 +1,581 @@
+// Measures how the cost of a service update scales with the number of connected clients.
+//
+// Simulated clients connect to the service over localhost exactly like PSMoveClient does
+// (TCP connect, read the connection info, bind the UDP endpoint with an initial input data frame).
+// Most of them just sit there like an observer tool would, while a few of them get a
+// controller data frame queued every update, the way a streaming client does.
+// The service runs without any devices, so the update cost is just the request handler
+// and the network manager having to deal with the connections.
+//
+// Usage: benchmark_service_connections [--clients N] [--streaming S] [--iterations I]
+//                                      [--port P] [--config-dir <dir>]
+//
+// Gets benchmarked with 0, 1, 8, 32 and 64 clients (up to N), S of which are streaming.
+
+//-- includes -----
+#include "DeviceManager.h"
+#include "PackedMessage.h"
+#include "PSMoveConfig.h"
+#include "PSMoveProtocol.pb.h"
+#include "ServerLog.h"
+#include "ServerNetworkManager.h"
+#include "ServerRequestHandler.h"
+#include "ServerUtility.h"
+#include "USBDeviceManager.h"
+
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-- constants -----
+static const int k_client_counts[] = { 0, 1, 8, 32, 64 };
+static const int k_warmup_update_count = 100;
+static const int k_connect_timeout_ms = 5000;
+
+//-- definitions -----
+namespace asio = boost::asio;
+using asio::ip::tcp;
+using asio::ip::udp;
+
+/// The service managers PSMoveService runs, minus the service entry point
+class BenchmarkService
+{
+public:
+    BenchmarkService()
+        : m_io_service()
+        , m_usb_device_manager(nullptr)
+        , m_device_manager(nullptr)
+        , m_request_handler(nullptr)
+        , m_network_manager(nullptr)
+    {
+    }
+
+    ~BenchmarkService()
+    {
+        shutdown();
+    }
+
+    bool startup()
+    {
+        // Every manager loads its config when constructed
+        m_usb_device_manager = new USBDeviceManager();
+        m_device_manager = new DeviceManager();
+        m_request_handler = new ServerRequestHandler(m_device_manager);
+        m_network_manager = new ServerNetworkManager();
+
+        return
+            m_usb_device_manager->startup() &&
+            m_device_manager->startup() &&
+            m_network_manager->startup(&m_io_service, m_request_handler) &&
+            m_request_handler->startup();
+    }
+
+    // Returns how long the network manager part of the update took
+    long long update()
+    {
+        m_request_handler->update();
+        m_usb_device_manager->update();
+        m_device_manager->update();
+
+        const long long network_start_us = ServerUtility::get_service_time_us();
+        m_network_manager->update();
+
+        return ServerUtility::get_service_time_us() - network_start_us;
+    }
+
+    void shutdown()
+    {
+        if (m_request_handler != nullptr)
+        {
+            m_request_handler->shutdown();
+        }
+
+        if (m_network_manager != nullptr)
+        {
+            m_network_manager->shutdown();
+            delete m_network_manager;
+            m_network_manager = nullptr;
+        }
+
+        if (m_device_manager != nullptr)
+        {
+            m_device_manager->shutdown();
+            delete m_device_manager;
+            m_device_manager = nullptr;
+        }
+
+        if (m_request_handler != nullptr)
+        {
+            delete m_request_handler;
+            m_request_handler = nullptr;
+        }
+
+        if (m_usb_device_manager != nullptr)
+        {
+            m_usb_device_manager->shutdown();
+            delete m_usb_device_manager;
+            m_usb_device_manager = nullptr;
+        }
+    }
+
+    inline ServerNetworkManager *getNetworkManager() const { return m_network_manager; }
+
+private:
+    asio::io_service m_io_service;
+    USBDeviceManager *m_usb_device_manager;
+    DeviceManager *m_device_manager;
+    ServerRequestHandler *m_request_handler;
+    ServerNetworkManager *m_network_manager;
+};
+
+/// One simulated PSMoveClient connection.
+/// Uses its own io_service, the sockets are only ever used synchronously.
+class SimulatedClient
+{
+public:
+    SimulatedClient()
+        : m_io_service()
+        , m_tcp_socket(m_io_service)
+        , m_udp_socket(m_io_service)
+        , m_connection_id(-1)
+        , m_received_datagram_count(0)
+    {
+    }
+
+    ~SimulatedClient()
+    {
+        boost::system::error_code error;
+
+        m_tcp_socket.close(error);
+        m_udp_socket.close(error);
+    }
+
+    bool start_connect(const int port)
+    {
+        boost::system::error_code error;
+
+        // The connect completes as soon as the service's listen backlog takes it,
+        // the service gets around to accepting it during its next updates
+        m_tcp_socket.connect(tcp::endpoint(asio::ip::address_v4::loopback(), static_cast<unsigned short>(port)), error);
+        if (!error)
+        {
+            m_tcp_socket.non_blocking(true, error);
+        }
+
+        return !error;
+    }
+
+    // Returns true once the connection info arrived and the UDP endpoint got bound.
+    // Needs to be called between service updates until it succeeds.
+    bool poll_connect(const int port)
+    {
+        if (m_connection_id == -1)
+        {
+            read_connection_info();
+
+            if (m_connection_id != -1)
+            {
+                send_initial_input_data_frame(port);
+            }
+        }
+
+        if (m_connection_id != -1)
+        {
+            // The service answers the initial input data frame with a bool
+            drain_udp_socket();
+        }
+
+        return m_connection_id != -1 && m_received_datagram_count > 0;
+    }
+
+    // Throws away whatever the service streamed to this client
+    void drain_udp_socket()
+    {
+        boost::system::error_code error;
+
+        while (m_udp_socket.is_open() && m_udp_socket.available(error) > 0 && !error)
+        {
+            m_udp_socket.receive(asio::buffer(m_udp_read_buffer, sizeof(m_udp_read_buffer)), 0, error);
+            ++m_received_datagram_count;
+        }
+    }
+
+    inline int get_connection_id() const { return m_connection_id; }
+    inline int get_received_datagram_count() const { return m_received_datagram_count; }
+
+private:
+    void read_connection_info()
+    {
+        boost::system::error_code error;
+        uint8_t byte_buffer[1024];
+        const size_t bytes_read = m_tcp_socket.read_some(asio::buffer(byte_buffer, sizeof(byte_buffer)), error);
+
+        if (!error && bytes_read > 0)
+        {
+            m_tcp_read_buffer.insert(m_tcp_read_buffer.end(), byte_buffer, byte_buffer + bytes_read);
+        }
+
+        // The connection info is the first response the service sends on a new connection
+        if (m_tcp_read_buffer.size() >= HEADER_SIZE)
+        {
+            PackedMessage<PSMoveProtocol::Response> packed_response(ResponsePtr(new PSMoveProtocol::Response));
+            const unsigned msg_len = packed_response.decode_header(m_tcp_read_buffer);
+
+            if (m_tcp_read_buffer.size() >= HEADER_SIZE + msg_len)
+            {
+                std::vector<uint8_t> message_buffer(m_tcp_read_buffer.begin(), m_tcp_read_buffer.begin() + HEADER_SIZE + msg_len);
+
+                if (packed_response.unpack(message_buffer) &&
+                    packed_response.get_msg()->type() == PSMoveProtocol::Response_ResponseType_CONNECTION_INFO)
+                {
+                    m_connection_id = packed_response.get_msg()->result_connection_info().tcp_connection_id();
+                }
+            }
+        }
+    }
+
+    void send_initial_input_data_frame(const int port)
+    {
+        boost::system::error_code error;
+        const udp::endpoint server_endpoint(asio::ip::address_v4::loopback(), static_cast<unsigned short>(port));
+
+        m_udp_socket.open(udp::v4(), error);
+        if (!error)
+        {
+            DeviceInputDataFramePtr data_frame(new PSMoveProtocol::DeviceInputDataFrame);
+            data_frame->set_connection_id(m_connection_id);
+            data_frame->set_device_category(PSMoveProtocol::DeviceInputDataFrame_DeviceCategory_INVALID);
+            data_frame->set_supports_batched_data_frames(true);
+
+            PackedMessage<PSMoveProtocol::DeviceInputDataFrame> packed_data_frame(data_frame);
+            std::vector<uint8_t> write_buffer;
+            packed_data_frame.pack(write_buffer);
+
+            m_udp_socket.send_to(asio::buffer(write_buffer), server_endpoint, 0, error);
+        }
+
+        if (error)
+        {
+            printf("Client %d failed to bind its UDP endpoint: %s\n", m_connection_id, error.message().c_str());
+        }
+    }
+
+    asio::io_service m_io_service;
+    tcp::socket m_tcp_socket;
+    udp::socket m_udp_socket;
+    std::vector<uint8_t> m_tcp_read_buffer;
+    uint8_t m_udp_read_buffer[MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE];
+    int m_connection_id;
+    int m_received_datagram_count;
+};
+
+struct BenchmarkSettings
+{
+    int max_client_count;
+    int streaming_client_count;
+    int iteration_count;
+    int port;
+    std::string config_path;
+};
+
+struct BenchmarkResult
+{
+    int client_count;
+    int streaming_client_count;
+    int update_count;
+    double update_time_us;
+    double network_update_time_us;
+    int received_datagram_count;
+};
+
+//-- private methods -----
+static void print_usage()
+{
+    printf("Usage: benchmark_service_connections [--clients N] [--streaming S] [--iterations I]\n");
+    printf("                                     [--port P] [--config-dir <dir>]\n");
+}
+
+static bool parse_arguments(int argc, char *argv[], BenchmarkSettings &settings)
+{
+    bool bSuccess = true;
+
+    for (int arg_index = 1; bSuccess && arg_index < argc; ++arg_index)
+    {
+        const char *arg = argv[arg_index];
+        const char *value = (arg_index + 1 < argc) ? argv[arg_index + 1] : nullptr;
+
+        if (value == nullptr)
+        {
+            bSuccess = false;
+        }
+        else if (strcmp(arg, "--clients") == 0)
+        {
+            settings.max_client_count = atoi(value);
+        }
+        else if (strcmp(arg, "--streaming") == 0)
+        {
+            settings.streaming_client_count = atoi(value);
+        }
+        else if (strcmp(arg, "--iterations") == 0)
+        {
+            settings.iteration_count = atoi(value);
+        }
+        else if (strcmp(arg, "--port") == 0)
+        {
+            settings.port = atoi(value);
+        }
+        else if (strcmp(arg, "--config-dir") == 0)
+        {
+            settings.config_path = value;
+        }
+        else
+        {
+            bSuccess = false;
+        }
+
+        ++arg_index;
+    }
+
+    settings.max_client_count = std::max(settings.max_client_count, 0);
+    settings.streaming_client_count = std::max(settings.streaming_client_count, 0);
+    settings.iteration_count = std::max(settings.iteration_count, 1);
+
+    return bSuccess;
+}
+
+// A pose + physics PSMove data frame, about what a game streams
+static void build_streamed_packet(DeviceOutputDataFramePacket &out_packet)
+{
+    PSMoveProtocol::DeviceOutputDataFrame data_frame;
+    auto *controller_packet = data_frame.mutable_controller_data_packet();
+    auto *psmove_state = controller_packet->mutable_psmove_state();
+
+    data_frame.set_device_category(PSMoveProtocol::DeviceOutputDataFrame::CONTROLLER);
+    data_frame.set_service_time_us(ServerUtility::get_service_time_us());
+    controller_packet->set_controller_id(0);
+    controller_packet->set_controller_type(PSMoveProtocol::PSMOVE);
+    controller_packet->set_sequence_num(1);
+    controller_packet->set_isconnected(true);
+    psmove_state->set_validhardwarecalibration(true);
+    psmove_state->set_isorientationvalid(true);
+    psmove_state->set_ispositionvalid(true);
+    psmove_state->mutable_orientation()->set_w(1.f);
+    psmove_state->mutable_position_cm()->set_x(10.f);
+    psmove_state->mutable_position_cm()->set_y(20.f);
+    psmove_state->mutable_position_cm()->set_z(30.f);
+    psmove_state->mutable_physics_data()->mutable_velocity_cm_per_sec()->set_i(1.f);
+    psmove_state->mutable_physics_data()->mutable_angular_velocity_rad_per_sec()->set_j(1.f);
+
+    ServerNetworkManager::pack_device_data_frame(&data_frame, out_packet);
+}
+
+static bool connect_clients(
+    const BenchmarkSettings &settings,
+    BenchmarkService &service,
+    std::vector<SimulatedClient *> &clients)
+{
+    bool bSuccess = true;
+
+    for (SimulatedClient *client : clients)
+    {
+        bSuccess = client->start_connect(settings.port);
+        if (!bSuccess)
+        {
+            printf("Failed to connect to the service on port %d\n", settings.port);
+            return false;
+        }
+    }
+
+    const std::chrono::time_point<std::chrono::high_resolution_clock> start_time = std::chrono::high_resolution_clock::now();
+    int connected_count = 0;
+
+    while (connected_count < static_cast<int>(clients.size()))
+    {
+        if (std::chrono::high_resolution_clock::now() - start_time > std::chrono::milliseconds(k_connect_timeout_ms))
+        {
+            printf("Timed out with %d of %d clients connected\n", connected_count, static_cast<int>(clients.size()));
+            bSuccess = false;
+            break;
+        }
+
+        service.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        connected_count = 0;
+        for (SimulatedClient *client : clients)
+        {
+            if (client->poll_connect(settings.port))
+            {
+                ++connected_count;
+            }
+        }
+    }
+
+    return bSuccess;
+}
+
+static bool run_benchmark(
+    const BenchmarkSettings &settings,
+    const int client_count,
+    BenchmarkResult &out_result)
+{
+    BenchmarkService service;
+    std::vector<SimulatedClient *> clients;
+    DeviceOutputDataFramePacket streamed_packet;
+    bool bSuccess = service.startup();
+
+    memset(&out_result, 0, sizeof(BenchmarkResult));
+    out_result.client_count = client_count;
+    out_result.streaming_client_count = std::min(settings.streaming_client_count, client_count);
+
+    for (int client_index = 0; client_index < client_count; ++client_index)
+    {
+        clients.push_back(new SimulatedClient());
+    }
+
+    if (bSuccess)
+    {
+        bSuccess = connect_clients(settings, service, clients);
+    }
+
+    if (bSuccess)
+    {
+        ServerNetworkManager *network_manager = service.getNetworkManager();
+        long long network_update_time_us = 0;
+
+        build_streamed_packet(streamed_packet);
+
+        for (int update_index = -k_warmup_update_count; update_index < settings.iteration_count; ++update_index)
+        {
+            if (update_index == 0)
+            {
+                network_update_time_us = 0;
+            }
+
+            // What publishing a controller to the streaming clients leaves for the network manager
+            for (int client_index = 0; client_index < out_result.streaming_client_count; ++client_index)
+            {
+                network_manager->send_device_data_frame(clients[client_index]->get_connection_id(), streamed_packet);
+            }
+
+            const std::chrono::time_point<std::chrono::high_resolution_clock> update_start = std::chrono::high_resolution_clock::now();
+            network_update_time_us += service.update();
+            const std::chrono::duration<double, std::micro> update_time = std::chrono::high_resolution_clock::now() - update_start;
+
+            if (update_index >= 0)
+            {
+                out_result.update_time_us += update_time.count();
+            }
+
+            for (int client_index = 0; client_index < out_result.streaming_client_count; ++client_index)
+            {
+                clients[client_index]->drain_udp_socket();
+            }
+        }
+
+        out_result.update_count = settings.iteration_count;
+        out_result.network_update_time_us = static_cast<double>(network_update_time_us);
+
+        for (int client_index = 0; client_index < out_result.streaming_client_count; ++client_index)
+        {
+            out_result.received_datagram_count += clients[client_index]->get_received_datagram_count();
+        }
+    }
+
+    // Closing the connections from the service side first keeps the disconnects out of the log
+    service.shutdown();
+
+    for (SimulatedClient *client : clients)
+    {
+        delete client;
+    }
+    clients.clear();
+
+    return bSuccess;
+}
+
+static void print_result_header()
+{
+    printf("%7s %9s %13s %14s %10s\n", "clients", "streaming", "us/update", "network us/upd", "datagrams");
+}
+
+static void print_result(const BenchmarkResult &result)
+{
+    const double update_count = static_cast<double>(result.update_count);
+
+    printf("%7d %9d %13.2f %14.2f %10d\n",
+        result.client_count,
+        result.streaming_client_count,
+        result.update_time_us / update_count,
+        result.network_update_time_us / update_count,
+        result.received_datagram_count);
+}
+
+//-- entry point -----
+int main(int argc, char *argv[])
+{
+    BenchmarkSettings settings;
+    settings.max_client_count = 64;
+    settings.streaming_client_count = 4;
+    settings.iteration_count = 2000;
+    settings.port = 9612; // Stay clear of a service that might be running on the default port
+
+    if (!parse_arguments(argc, argv, settings))
+    {
+        print_usage();
+        return -1;
+    }
+
+    // Never touch the config of the installed service
+    if (settings.config_path.empty())
+    {
+        boost::filesystem::path config_path = boost::filesystem::temp_directory_path();
+        config_path /= "PSMoveServiceConnectionBenchmark";
+        settings.config_path = config_path.string();
+    }
+    PSMoveConfig::setConfigDirectoryOverride(settings.config_path);
+
+    {
+        NetworkManagerConfig network_config;
+        network_config.load();
+        network_config.server_port = settings.port;
+        network_config.save();
+    }
+
+    log_init("error");
+
+    print_result_header();
+
+    int exit_code = 0;
+    for (const int client_count : k_client_counts)
+    {
+        if (client_count > settings.max_client_count)
+        {
+            break;
+        }
+
+        BenchmarkResult result;
+
+        if (run_benchmark(settings, client_count, result))
+        {
+            print_result(result);
+        }
+        else
+        {
+            printf("Failed to benchmark %d clients\n", client_count);
+            exit_code = -1;
+        }
+    }
+
+    log_dispose();
+
+    return exit_code;
+}
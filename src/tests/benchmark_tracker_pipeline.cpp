@@ -0,0 +1,1003 @@
+// Replays PS3Eye video frames through the service's optical tracking pipeline
+// (video frame caching/demosaic, color segmentation, blob search, sphere fit,
+// multi-camera triangulation and filtering) and reports the cost of each stage.
+//
+// Trackers are replaced with replay cameras that hand out a pre-loaded loop of frames,
+// either synthetic renders of virtual controller bulbs or raw frame dumps
+// recorded from real PS3Eyes. Everything else is the unmodified service code,
+// driven through DeviceManager::update() exactly like PSMoveService does.
+//
+// Usage: benchmark_tracker_pipeline [--cameras N] [--controllers M] [--iterations I]
+//                                   [--frame-count K] [--frames <dir>] [--config-dir <dir>]
+//                                   [--opencl 0|1] [--pipelined 0|1]
+//
+// Every combination of 1..N cameras and 1..M controllers gets benchmarked.
+// Recorded frames are loaded from <dir>/camera_<index>/ in file name order.
+// Each file is one raw 640x480 frame, either BGR (921600 bytes) or GB Bayer (307200 bytes).
+// --opencl 1 computes the color masks with OpenCL (see TrackerManagerConfig::use_opencl_color_mask).
+// --pipelined 1 overlaps the blob search with the rest of the update (see TrackerManagerConfig::use_pipelined_vision).
+
+//-- includes -----
+#include "ControllerManager.h"
+#include "DeviceEnumerator.h"
+#include "DeviceManager.h"
+#include "MathGLM.h"
+#include "PSMoveConfig.h"
+#include "ServerControllerView.h"
+#include "ServerLog.h"
+#include "ServerNetworkManager.h"
+#include "ServerRequestHandler.h"
+#include "ServerTrace.h"
+#include "ServerTrackerView.h"
+#include "ServerUtility.h"
+#include "TrackerManager.h"
+#include "USBDeviceManager.h"
+#include "VirtualController.h"
+
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/ocl.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-- constants -----
+static const int k_frame_width = 640;
+static const int k_frame_height = 480;
+static const float k_focal_length_px = 554.2563f; // PS3EyeTrackerConfig default
+static const float k_frame_rate = 60.f;
+
+static const float k_camera_distance_cm = 150.f;
+static const float k_camera_height_cm = 30.f;
+static const float k_camera_arc_radians = 2.356194f; // Cameras get spread over a 135 degree arc
+static const float k_controller_spread_cm = 20.f;
+static const float k_controller_motion_cm = 5.f;
+static const float k_bulb_radius_cm = 2.25f;
+
+// Stage events get summed at least this often so the per-thread trace rings never wrap
+static const int k_trace_batch_frame_count = 32;
+static const int k_warmup_frame_count = 30;
+static const int k_device_open_timeout_ms = 5000;
+
+//-- definitions -----
+/// The frame loop replayed by one camera
+struct ReplayCameraFrames
+{
+    CommonDevicePose pose;
+    std::vector<cv::Mat> bgr_frames;
+    std::vector<cv::Mat> bayer_frames;
+};
+
+/// Frames for every camera of the configuration being benchmarked
+struct ReplayScene
+{
+    std::vector<ReplayCameraFrames> cameras;
+};
+
+static const ReplayScene *g_replay_scene = nullptr;
+
+/// Tracker interface that plays back a loop of frames, one per poll
+class ReplayTracker : public ITrackerInterface
+{
+public:
+    ReplayTracker(const ReplayCameraFrames *frames)
+        : m_frames(frames)
+        , m_device_path()
+        , m_bIsOpen(false)
+        , m_bCaptureRawBayerFrames(false)
+        , m_frame_index(-1)
+        , m_pose(frames->pose)
+    {
+        m_state.clear();
+        m_state.DeviceType = CommonDeviceState::PS3EYE;
+    }
+
+    // -- IDeviceInterface
+    bool matchesDeviceEnumerator(const DeviceEnumerator *enumerator) const override
+    {
+        return m_bIsOpen && m_device_path == enumerator->get_path();
+    }
+
+    bool open(const DeviceEnumerator *enumerator) override
+    {
+        m_device_path = enumerator->get_path();
+        m_bIsOpen = true;
+
+        return true;
+    }
+
+    bool getIsOpen() const override { return m_bIsOpen; }
+    bool getIsReadyToPoll() const override { return m_bIsOpen; }
+
+    IDeviceInterface::ePollResult poll() override
+    {
+        m_frame_index = (m_frame_index + 1) % static_cast<int>(m_frames->bgr_frames.size());
+        ++m_state.PollSequenceNumber;
+        m_state.CaptureTimestamp = std::chrono::high_resolution_clock::now();
+
+        return IDeviceInterface::_PollResultSuccessNewData;
+    }
+
+    void close() override { m_bIsOpen = false; }
+    long getMaxPollFailureCount() const override { return 100; }
+    CommonDeviceState::eDeviceType getDeviceType() const override { return CommonDeviceState::PS3EYE; }
+    const CommonDeviceState *getState(int lookBack = 0) const override { return &m_state; }
+
+    // -- ITrackerInterface
+    ITrackerInterface::eDriverType getDriverType() const override { return ITrackerInterface::Libusb; }
+    std::string getUSBDevicePath() const override { return m_device_path; }
+
+    bool getVideoFrameDimensions(int *out_width, int *out_height, int *out_stride) const override
+    {
+        if (out_width != nullptr) *out_width = k_frame_width;
+        if (out_height != nullptr) *out_height = k_frame_height;
+        if (out_stride != nullptr) *out_stride = k_frame_width*3;
+
+        return true;
+    }
+
+    const unsigned char *getVideoFrameBuffer() const override
+    {
+        return (m_frame_index >= 0 && !m_bCaptureRawBayerFrames) ? m_frames->bgr_frames[m_frame_index].data : nullptr;
+    }
+
+    void getVideoFrameBufferLayout(int *out_bytes_per_pixel, int *out_stride) const override
+    {
+        if (out_bytes_per_pixel != nullptr) *out_bytes_per_pixel = 3;
+        if (out_stride != nullptr) *out_stride = k_frame_width*3;
+    }
+
+    const unsigned char *getRawBayerFrameBuffer() const override
+    {
+        return (m_frame_index >= 0 && m_bCaptureRawBayerFrames) ? m_frames->bayer_frames[m_frame_index].data : nullptr;
+    }
+
+    // Every poll delivers a frame, so nothing ever gets dropped
+    long long getVideoFrameSequenceNumber() const override
+    {
+        return (m_frame_index >= 0) ? static_cast<long long>(m_state.PollSequenceNumber) : -1;
+    }
+
+    bool setRawBayerFrameCapture(bool bEnable) override
+    {
+        m_bCaptureRawBayerFrames = bEnable;
+
+        return true;
+    }
+
+    bool setCaptureSuspended(bool bSuspended) override { return !bSuspended; }
+
+    void loadSettings() override {}
+    void saveSettings() override {}
+    void setFrameWidth(double value, bool bUpdateConfig) override {}
+    double getFrameWidth() const override { return k_frame_width; }
+    void setFrameHeight(double value, bool bUpdateConfig) override {}
+    double getFrameHeight() const override { return k_frame_height; }
+    void setFrameRate(double value, bool bUpdateConfig) override {}
+    double getFrameRate() const override { return k_frame_rate; }
+    void setExposure(double value, bool bUpdateConfig) override {}
+    double getExposure() const override { return 32.0; }
+    void setGain(double value, bool bUpdateConfig) override {}
+    double getGain() const override { return 32.0; }
+
+    // The replayed frames are rendered (or assumed to be recorded) without lens distortion
+    void getCameraIntrinsics(
+        float &outFocalLengthX, float &outFocalLengthY,
+        float &outPrincipalX, float &outPrincipalY,
+        float &outDistortionK1, float &outDistortionK2, float &outDistortionK3,
+        float &outDistortionP1, float &outDistortionP2) const override
+    {
+        outFocalLengthX = k_focal_length_px;
+        outFocalLengthY = k_focal_length_px;
+        outPrincipalX = k_frame_width*0.5f;
+        outPrincipalY = k_frame_height*0.5f;
+        outDistortionK1 = 0.f;
+        outDistortionK2 = 0.f;
+        outDistortionK3 = 0.f;
+        outDistortionP1 = 0.f;
+        outDistortionP2 = 0.f;
+    }
+
+    void setCameraIntrinsics(
+        float focalLengthX, float focalLengthY,
+        float principalX, float principalY,
+        float distortionK1, float distortionK2, float distortionK3,
+        float distortionP1, float distortionP2) override
+    {
+    }
+
+    CommonDevicePose getTrackerPose() const override { return m_pose; }
+    void setTrackerPose(const struct CommonDevicePose *pose) override { m_pose = *pose; }
+
+    void getFOV(float &outHFOV, float &outVFOV) const override
+    {
+        outHFOV = 60.f;
+        outVFOV = 45.f;
+    }
+
+    void getZRange(float &outZNear, float &outZFar) const override
+    {
+        outZNear = 10.f;
+        outZFar = 400.f;
+    }
+
+    void gatherTrackerOptions(PSMoveProtocol::Response_ResultTrackerSettings* settings) const override {}
+    bool setOptionIndex(const std::string &option_name, int option_index) override { return false; }
+    bool getOptionIndex(const std::string &option_name, int &out_option_index) const override { return false; }
+
+    void gatherTrackingColorPresets(const std::string &controller_serial, PSMoveProtocol::Response_ResultTrackerSettings* settings) const override {}
+    void setTrackingColorPreset(const std::string &controller_serial, eCommonTrackingColorID color, const CommonHSVColorRange *preset) override {}
+    void getTrackingColorPreset(const std::string &controller_serial, eCommonTrackingColorID color, CommonHSVColorRange *out_preset) const override
+    {
+        *out_preset = k_default_color_presets[color];
+    }
+
+private:
+    const ReplayCameraFrames *m_frames;
+    std::string m_device_path;
+    bool m_bIsOpen;
+    bool m_bCaptureRawBayerFrames;
+    int m_frame_index;
+    CommonDevicePose m_pose;
+    CommonDeviceState m_state;
+};
+
+/// Lists one replay camera per camera in the replay scene
+class ReplayTrackerEnumerator : public DeviceEnumerator
+{
+public:
+    ReplayTrackerEnumerator()
+        : DeviceEnumerator(CommonDeviceState::PS3EYE)
+        , m_camera_index(0)
+        , m_device_path()
+    {
+        m_deviceType = CommonDeviceState::PS3EYE;
+        update_device_path();
+    }
+
+    bool is_valid() const override
+    {
+        return g_replay_scene != nullptr && m_camera_index < static_cast<int>(g_replay_scene->cameras.size());
+    }
+
+    bool next() override
+    {
+        ++m_camera_index;
+        update_device_path();
+
+        return is_valid();
+    }
+
+    int get_vendor_id() const override { return is_valid() ? 0x0000 : -1; }
+    int get_product_id() const override { return is_valid() ? 0x0000 : -1; }
+    const char *get_path() const override { return m_device_path; }
+
+    inline int get_camera_index() const { return m_camera_index; }
+
+private:
+    void update_device_path()
+    {
+        ServerUtility::format_string(m_device_path, sizeof(m_device_path), "ReplayTracker_%d", m_camera_index);
+    }
+
+    int m_camera_index;
+    char m_device_path[32];
+};
+
+class ReplayTrackerView : public ServerTrackerView
+{
+public:
+    ReplayTrackerView(const int device_id)
+        : ServerTrackerView(device_id)
+    {
+    }
+
+protected:
+    bool allocate_device_interface(const class DeviceEnumerator *enumerator) override
+    {
+        const ReplayTrackerEnumerator *replay_enumerator = static_cast<const ReplayTrackerEnumerator *>(enumerator);
+
+        m_device = new ReplayTracker(&g_replay_scene->cameras[replay_enumerator->get_camera_index()]);
+
+        return true;
+    }
+};
+
+/// Tracker manager that only ever finds the replay cameras
+class ReplayTrackerManager : public TrackerManager
+{
+public:
+    ReplayTrackerManager()
+        : TrackerManager()
+        , m_bReplayListDirty(true)
+    {
+    }
+
+protected:
+    bool can_update_connected_devices() override
+    {
+        return m_bReplayListDirty && DeviceTypeManager::can_update_connected_devices();
+    }
+
+    DeviceEnumerator *allocate_device_enumerator() override
+    {
+        return new ReplayTrackerEnumerator;
+    }
+
+    void free_device_enumerator(DeviceEnumerator *enumerator) override
+    {
+        delete static_cast<ReplayTrackerEnumerator *>(enumerator);
+        m_bReplayListDirty = false;
+    }
+
+    ServerDeviceView *allocate_device_view(int device_id) override
+    {
+        return new ReplayTrackerView(device_id);
+    }
+
+private:
+    bool m_bReplayListDirty;
+};
+
+/// The parts of PSMoveService the device manager depends on, minus the real trackers
+class BenchmarkService
+{
+public:
+    BenchmarkService()
+        : m_io_service()
+        , m_usb_device_manager(nullptr)
+        , m_device_manager(nullptr)
+        , m_request_handler(nullptr)
+        , m_network_manager(nullptr)
+    {
+    }
+
+    ~BenchmarkService()
+    {
+        shutdown();
+    }
+
+    bool startup()
+    {
+        // Every manager loads its config when constructed
+        m_usb_device_manager = new USBDeviceManager();
+        m_device_manager = new DeviceManager();
+        m_request_handler = new ServerRequestHandler(m_device_manager);
+        m_network_manager = new ServerNetworkManager();
+
+        delete m_device_manager->m_tracker_manager;
+        m_device_manager->m_tracker_manager = new ReplayTrackerManager();
+
+        return
+            m_usb_device_manager->startup() &&
+            m_device_manager->startup() &&
+            m_network_manager->startup(&m_io_service, m_request_handler) &&
+            m_request_handler->startup();
+    }
+
+    void update()
+    {
+        m_request_handler->update();
+        m_usb_device_manager->update();
+        m_device_manager->update();
+        m_network_manager->update();
+    }
+
+    void shutdown()
+    {
+        if (m_request_handler != nullptr)
+        {
+            m_request_handler->shutdown();
+        }
+
+        if (m_network_manager != nullptr)
+        {
+            m_network_manager->shutdown();
+            delete m_network_manager;
+            m_network_manager = nullptr;
+        }
+
+        if (m_device_manager != nullptr)
+        {
+            m_device_manager->shutdown();
+            delete m_device_manager;
+            m_device_manager = nullptr;
+        }
+
+        if (m_request_handler != nullptr)
+        {
+            delete m_request_handler;
+            m_request_handler = nullptr;
+        }
+
+        if (m_usb_device_manager != nullptr)
+        {
+            m_usb_device_manager->shutdown();
+            delete m_usb_device_manager;
+            m_usb_device_manager = nullptr;
+        }
+    }
+
+    inline DeviceManager *getDeviceManager() const { return m_device_manager; }
+
+private:
+    boost::asio::io_service m_io_service;
+    USBDeviceManager *m_usb_device_manager;
+    DeviceManager *m_device_manager;
+    ServerRequestHandler *m_request_handler;
+    ServerNetworkManager *m_network_manager;
+};
+
+struct BenchmarkSettings
+{
+    int max_camera_count;
+    int max_controller_count;
+    int iteration_count;
+    int synthetic_frame_count;
+    std::string recorded_frames_path;
+    std::string config_path;
+    bool use_opencl;
+    bool use_pipelined_vision;
+};
+
+struct BenchmarkResult
+{
+    int camera_count;
+    int controller_count;
+    int frame_count;
+    int tracked_controller_count;
+    double wall_time_us;
+    long long stage_duration_us[ServerTraceStage_COUNT];
+    int stage_event_count[ServerTraceStage_COUNT];
+};
+
+//-- private methods -----
+static void print_usage()
+{
+    printf("Usage: benchmark_tracker_pipeline [--cameras N] [--controllers M] [--iterations I]\n");
+    printf("                                  [--frame-count K] [--frames <dir>] [--config-dir <dir>]\n");
+    printf("                                  [--opencl 0|1] [--pipelined 0|1]\n");
+}
+
+static bool parse_arguments(int argc, char *argv[], BenchmarkSettings &settings)
+{
+    bool bSuccess = true;
+
+    for (int arg_index = 1; bSuccess && arg_index < argc; ++arg_index)
+    {
+        const char *arg = argv[arg_index];
+        const char *value = (arg_index + 1 < argc) ? argv[arg_index + 1] : nullptr;
+
+        if (value == nullptr)
+        {
+            bSuccess = false;
+        }
+        else if (strcmp(arg, "--cameras") == 0)
+        {
+            settings.max_camera_count = atoi(value);
+        }
+        else if (strcmp(arg, "--controllers") == 0)
+        {
+            settings.max_controller_count = atoi(value);
+        }
+        else if (strcmp(arg, "--iterations") == 0)
+        {
+            settings.iteration_count = atoi(value);
+        }
+        else if (strcmp(arg, "--frame-count") == 0)
+        {
+            settings.synthetic_frame_count = atoi(value);
+        }
+        else if (strcmp(arg, "--frames") == 0)
+        {
+            settings.recorded_frames_path = value;
+        }
+        else if (strcmp(arg, "--config-dir") == 0)
+        {
+            settings.config_path = value;
+        }
+        else if (strcmp(arg, "--opencl") == 0)
+        {
+            settings.use_opencl = atoi(value) != 0;
+        }
+        else if (strcmp(arg, "--pipelined") == 0)
+        {
+            settings.use_pipelined_vision = atoi(value) != 0;
+        }
+        else
+        {
+            bSuccess = false;
+        }
+
+        ++arg_index;
+    }
+
+    settings.max_camera_count = std::max(std::min(settings.max_camera_count, PSMOVESERVICE_MAX_TRACKER_COUNT), 1);
+    settings.max_controller_count = std::max(std::min(settings.max_controller_count, static_cast<int>(eCommonTrackingColorID::MAX_TRACKING_COLOR_TYPES)), 1);
+    settings.iteration_count = std::max(settings.iteration_count, 1);
+    settings.synthetic_frame_count = std::max(settings.synthetic_frame_count, 1);
+
+    return bSuccess;
+}
+
+// Converts a BGR frame into the GB pattern raw Bayer layout the PS3Eye delivers (see CV_BayerGB2BGR)
+static void mosaic_bgr_frame(const cv::Mat &bgr_frame, cv::Mat &out_bayer_frame)
+{
+    out_bayer_frame.create(bgr_frame.rows, bgr_frame.cols, CV_8UC1);
+
+    for (int y = 0; y < bgr_frame.rows; ++y)
+    {
+        const cv::Vec3b *bgr_row = bgr_frame.ptr<cv::Vec3b>(y);
+        unsigned char *bayer_row = out_bayer_frame.ptr<unsigned char>(y);
+
+        for (int x = 0; x < bgr_frame.cols; ++x)
+        {
+            // Even rows: G R G R ..., odd rows: B G B G ...
+            const int channel = ((y & 1) == 0) ? (((x & 1) == 0) ? 1 : 2) : (((x & 1) == 0) ? 0 : 1);
+
+            bayer_row[x] = bgr_row[x][channel];
+        }
+    }
+}
+
+static CommonDevicePose compute_camera_pose(int camera_index, int camera_count)
+{
+    // Place the camera on an arc in front of the play space, looking at the origin
+    const float arc_fraction = (camera_count > 1) ? static_cast<float>(camera_index) / static_cast<float>(camera_count - 1) - 0.5f : 0.f;
+    const float yaw = arc_fraction*k_camera_arc_radians;
+    const glm::vec3 position(k_camera_distance_cm*sinf(yaw), k_camera_height_cm, k_camera_distance_cm*cosf(yaw));
+
+    // Tracker relative +Z is the view direction of the camera
+    const glm::vec3 z_axis = glm::normalize(-position);
+    const glm::vec3 x_axis = glm::normalize(glm::cross(glm::vec3(0.f, 1.f, 0.f), z_axis));
+    const glm::vec3 y_axis = glm::cross(z_axis, x_axis);
+    const glm::quat orientation = glm::quat_cast(glm::mat3(x_axis, y_axis, z_axis));
+
+    CommonDevicePose pose;
+    pose.PositionCm.set(position.x, position.y, position.z);
+    pose.Orientation.w = orientation.w;
+    pose.Orientation.x = orientation.x;
+    pose.Orientation.y = orientation.y;
+    pose.Orientation.z = orientation.z;
+
+    return pose;
+}
+
+static glm::vec3 compute_controller_position(int controller_index, int controller_count, int frame_index, int frame_count)
+{
+    const float spread_angle = 6.283185f*static_cast<float>(controller_index) / static_cast<float>(controller_count);
+    const float motion_angle = 6.283185f*static_cast<float>(frame_index) / static_cast<float>(frame_count);
+    const float spread_cm = (controller_count > 1) ? k_controller_spread_cm : 0.f;
+
+    return glm::vec3(
+        spread_cm*cosf(spread_angle) + k_controller_motion_cm*cosf(motion_angle),
+        k_controller_motion_cm*sinf(motion_angle),
+        spread_cm*sinf(spread_angle));
+}
+
+static cv::Scalar compute_tracking_color_bgr(eCommonTrackingColorID color_id)
+{
+    const CommonHSVColorRange &preset = k_default_color_presets[color_id];
+    cv::Mat hsv(1, 1, CV_8UC3, cv::Scalar(preset.hue_range.center, preset.saturation_range.center, preset.value_range.center));
+    cv::Mat bgr;
+
+    cv::cvtColor(hsv, bgr, cv::COLOR_HSV2BGR);
+    const cv::Vec3b pixel = bgr.at<cv::Vec3b>(0, 0);
+
+    return cv::Scalar(pixel[0], pixel[1], pixel[2]);
+}
+
+// Draws the controller bulbs the way a distortion free camera at the given pose would see them
+static void render_synthetic_frames(
+    const int controller_count,
+    const int frame_count,
+    ReplayCameraFrames &camera)
+{
+    const glm::quat orientation(camera.pose.Orientation.w, camera.pose.Orientation.x, camera.pose.Orientation.y, camera.pose.Orientation.z);
+    const glm::vec3 position(camera.pose.PositionCm.x, camera.pose.PositionCm.y, camera.pose.PositionCm.z);
+    const glm::mat4 world_to_camera = glm::inverse(glm_mat4_from_pose(orientation, position));
+
+    for (int frame_index = 0; frame_index < frame_count; ++frame_index)
+    {
+        cv::Mat frame(k_frame_height, k_frame_width, CV_8UC3, cv::Scalar(24, 24, 24));
+
+        for (int controller_index = 0; controller_index < controller_count; ++controller_index)
+        {
+            const glm::vec3 world_position = compute_controller_position(controller_index, controller_count, frame_index, frame_count);
+            const glm::vec4 camera_position = world_to_camera * glm::vec4(world_position, 1.f);
+
+            if (camera_position.z > k_bulb_radius_cm)
+            {
+                const cv::Point center(
+                    static_cast<int>(k_focal_length_px*camera_position.x / camera_position.z + k_frame_width*0.5f),
+                    static_cast<int>(k_focal_length_px*camera_position.y / camera_position.z + k_frame_height*0.5f));
+                const int radius = std::max(static_cast<int>(k_focal_length_px*k_bulb_radius_cm / camera_position.z), 1);
+
+                cv::circle(frame, center, radius, compute_tracking_color_bgr(static_cast<eCommonTrackingColorID>(controller_index)), -1);
+            }
+        }
+
+        camera.bgr_frames.push_back(frame);
+    }
+}
+
+static bool load_recorded_frames(const std::string &camera_path, ReplayCameraFrames &camera)
+{
+    std::vector<std::string> file_paths;
+    boost::system::error_code error;
+
+    for (boost::filesystem::directory_iterator it(camera_path, error), end; !error && it != end; ++it)
+    {
+        if (boost::filesystem::is_regular_file(it->path()))
+        {
+            file_paths.push_back(it->path().string());
+        }
+    }
+    std::sort(file_paths.begin(), file_paths.end());
+
+    for (const std::string &file_path : file_paths)
+    {
+        std::ifstream file(file_path.c_str(), std::ios::binary | std::ios::ate);
+        const size_t byte_count = static_cast<size_t>(file.tellg());
+
+        file.seekg(0);
+        if (byte_count == k_frame_width*k_frame_height*3)
+        {
+            cv::Mat bgr_frame(k_frame_height, k_frame_width, CV_8UC3);
+
+            file.read(reinterpret_cast<char *>(bgr_frame.data), byte_count);
+            camera.bgr_frames.push_back(bgr_frame);
+        }
+        else if (byte_count == k_frame_width*k_frame_height)
+        {
+            cv::Mat bayer_frame(k_frame_height, k_frame_width, CV_8UC1);
+            cv::Mat bgr_frame;
+
+            file.read(reinterpret_cast<char *>(bayer_frame.data), byte_count);
+            cv::cvtColor(bayer_frame, bgr_frame, CV_BayerGB2BGR);
+            camera.bgr_frames.push_back(bgr_frame);
+        }
+        else
+        {
+            printf("Skipping %s: not a raw 640x480 BGR or Bayer frame\n", file_path.c_str());
+        }
+    }
+
+    return !camera.bgr_frames.empty();
+}
+
+static bool build_replay_scene(
+    const BenchmarkSettings &settings,
+    const int camera_count,
+    const int controller_count,
+    ReplayScene &out_scene)
+{
+    bool bSuccess = true;
+
+    out_scene.cameras.clear();
+    out_scene.cameras.resize(camera_count);
+
+    for (int camera_index = 0; bSuccess && camera_index < camera_count; ++camera_index)
+    {
+        ReplayCameraFrames &camera = out_scene.cameras[camera_index];
+
+        camera.pose = compute_camera_pose(camera_index, camera_count);
+
+        if (settings.recorded_frames_path.empty())
+        {
+            render_synthetic_frames(controller_count, settings.synthetic_frame_count, camera);
+        }
+        else
+        {
+            char camera_folder[32];
+
+            ServerUtility::format_string(camera_folder, sizeof(camera_folder), "camera_%d", camera_index);
+            boost::filesystem::path camera_path(settings.recorded_frames_path);
+            camera_path /= camera_folder;
+
+            if (!load_recorded_frames(camera_path.string(), camera))
+            {
+                printf("No recorded frames found in %s\n", camera_path.string().c_str());
+                bSuccess = false;
+            }
+        }
+
+        for (const cv::Mat &bgr_frame : camera.bgr_frames)
+        {
+            cv::Mat bayer_frame;
+
+            mosaic_bgr_frame(bgr_frame, bayer_frame);
+            camera.bayer_frames.push_back(bayer_frame);
+        }
+    }
+
+    return bSuccess;
+}
+
+static void write_benchmark_configs(const BenchmarkSettings &settings, const int controller_count)
+{
+    // Poll every device on every update, without any background threads or platform hooks.
+    // DeviceManagerConfig is private to the device manager, so write its keys directly.
+    {
+        boost::property_tree::ptree pt;
+        boost::filesystem::path config_path(PSMoveConfig::getConfigDirectoryPath());
+
+        config_path /= "DeviceManagerConfig.json";
+        pt.put("version", 1);
+        pt.put("controller_poll_interval", 0);
+        pt.put("tracker_poll_interval", 0);
+        pt.put("hmd_poll_interval", 0);
+        pt.put("platform_api_enabled", false);
+        pt.put("shared_memory_poses_enabled", false);
+        pt.put("background_device_scan_enabled", false);
+        boost::property_tree::write_json(config_path.string(), pt);
+    }
+
+    // Don't collide with a running service
+    {
+        NetworkManagerConfig cfg;
+        cfg.load();
+        cfg.server_port = 0;
+        cfg.save();
+    }
+
+    {
+        ControllerManagerConfig cfg;
+        cfg.load();
+        cfg.virtual_controller_count = controller_count;
+        cfg.save();
+    }
+
+    {
+        TrackerManagerConfig cfg;
+        cfg.load();
+        cfg.use_opencl_color_mask = settings.use_opencl;
+        // Pipelining only applies to unsynchronized trackers
+        cfg.use_pipelined_vision = settings.use_pipelined_vision;
+        cfg.synchronize_tracker_frames = !settings.use_pipelined_vision;
+        cfg.save();
+    }
+
+    for (int controller_index = 0; controller_index < controller_count; ++controller_index)
+    {
+        char config_name[32];
+
+        ServerUtility::format_string(config_name, sizeof(config_name), "VirtualController_%d", controller_index);
+
+        VirtualControllerConfig cfg(config_name);
+        cfg.load();
+        cfg.is_valid = true;
+        cfg.bulb_radius = k_bulb_radius_cm;
+        cfg.tracking_color_id = static_cast<eCommonTrackingColorID>(controller_index);
+        cfg.save();
+    }
+}
+
+static int count_open_trackers(DeviceManager *device_manager)
+{
+    int open_count = 0;
+
+    for (int tracker_id = 0; tracker_id < device_manager->getTrackerViewMaxCount(); ++tracker_id)
+    {
+        if (device_manager->getTrackerViewPtr(tracker_id)->getIsOpen())
+        {
+            ++open_count;
+        }
+    }
+
+    return open_count;
+}
+
+static int count_open_controllers(DeviceManager *device_manager, bool bOnlyTracking)
+{
+    int open_count = 0;
+
+    for (int controller_id = 0; controller_id < device_manager->getControllerViewMaxCount(); ++controller_id)
+    {
+        ServerControllerViewPtr controller_view = device_manager->getControllerViewPtr(controller_id);
+
+        if (controller_view->getIsOpen() &&
+            controller_view->getIsVirtualController() &&
+            (!bOnlyTracking || controller_view->getIsCurrentlyTracking()))
+        {
+            ++open_count;
+        }
+    }
+
+    return open_count;
+}
+
+static bool run_benchmark(
+    const BenchmarkSettings &settings,
+    const int camera_count,
+    const int controller_count,
+    BenchmarkResult &out_result)
+{
+    ReplayScene scene;
+    BenchmarkService service;
+    bool bSuccess = build_replay_scene(settings, camera_count, controller_count, scene);
+
+    memset(&out_result, 0, sizeof(BenchmarkResult));
+    out_result.camera_count = camera_count;
+    out_result.controller_count = controller_count;
+
+    if (bSuccess)
+    {
+        g_replay_scene = &scene;
+        write_benchmark_configs(settings, controller_count);
+        bSuccess = service.startup();
+    }
+
+    // Wait for the replay cameras and virtual controllers to show up
+    DeviceManager *device_manager = service.getDeviceManager();
+    if (bSuccess)
+    {
+        const std::chrono::time_point<std::chrono::high_resolution_clock> start_time = std::chrono::high_resolution_clock::now();
+
+        while (count_open_trackers(device_manager) < camera_count ||
+               count_open_controllers(device_manager, false) < controller_count)
+        {
+            if (std::chrono::high_resolution_clock::now() - start_time > std::chrono::milliseconds(k_device_open_timeout_ms))
+            {
+                printf("Timed out waiting for %d cameras and %d controllers to open\n", camera_count, controller_count);
+                bSuccess = false;
+                break;
+            }
+
+            service.update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    if (bSuccess)
+    {
+        for (int controller_id = 0; controller_id < device_manager->getControllerViewMaxCount(); ++controller_id)
+        {
+            ServerControllerViewPtr controller_view = device_manager->getControllerViewPtr(controller_id);
+
+            if (controller_view->getIsOpen() && controller_view->getIsVirtualController())
+            {
+                controller_view->startTracking();
+            }
+        }
+
+        // Let the lookup tables get built and the filters lock on
+        for (int frame_index = 0; frame_index < k_warmup_frame_count; ++frame_index)
+        {
+            service.update();
+        }
+
+        const std::chrono::time_point<std::chrono::high_resolution_clock> start_time = std::chrono::high_resolution_clock::now();
+        int frames_left = settings.iteration_count;
+
+        while (frames_left > 0)
+        {
+            const int batch_frame_count = std::min(frames_left, k_trace_batch_frame_count);
+            const long long batch_start_us = ServerUtility::get_service_time_us();
+            ServerTraceStageTotals stage_totals[ServerTraceStage_COUNT];
+
+            for (int frame_index = 0; frame_index < batch_frame_count; ++frame_index)
+            {
+                service.update();
+            }
+
+            ServerTrace::sum_stage_durations(batch_start_us, stage_totals);
+            for (int stage_index = 0; stage_index < ServerTraceStage_COUNT; ++stage_index)
+            {
+                out_result.stage_duration_us[stage_index] += stage_totals[stage_index].total_duration_us;
+                out_result.stage_event_count[stage_index] += stage_totals[stage_index].event_count;
+            }
+
+            frames_left -= batch_frame_count;
+        }
+
+        const std::chrono::duration<double, std::micro> wall_time = std::chrono::high_resolution_clock::now() - start_time;
+
+        out_result.frame_count = settings.iteration_count;
+        out_result.wall_time_us = wall_time.count();
+        out_result.tracked_controller_count = count_open_controllers(device_manager, true);
+    }
+
+    service.shutdown();
+    g_replay_scene = nullptr;
+
+    return bSuccess;
+}
+
+static void print_result_header()
+{
+    printf("%7s %11s %7s %10s %11s", "cameras", "controllers", "tracked", "ms/frame", "cam frame/s");
+    for (int stage_index = ServerTraceStage_FrameGrab; stage_index < ServerTraceStage_COUNT; ++stage_index)
+    {
+        printf(" %13s", ServerTrace::get_stage_name(static_cast<eServerTraceStage>(stage_index)));
+    }
+    printf("\n");
+}
+
+static void print_result(const BenchmarkResult &result)
+{
+    const double frame_count = static_cast<double>(result.frame_count);
+    const double ms_per_frame = result.wall_time_us / frame_count / 1000.0;
+    const double camera_frames_per_second = frame_count*result.camera_count / (result.wall_time_us / 1000000.0);
+
+    printf("%7d %11d %7d %10.3f %11.1f", result.camera_count, result.controller_count, result.tracked_controller_count, ms_per_frame, camera_frames_per_second);
+    for (int stage_index = ServerTraceStage_FrameGrab; stage_index < ServerTraceStage_COUNT; ++stage_index)
+    {
+        // Summed over every thread, so this is the CPU time the stage costs per replayed frame
+        printf(" %13.0f", static_cast<double>(result.stage_duration_us[stage_index])*1000.0 / frame_count);
+    }
+    printf("\n");
+}
+
+//-- entry point -----
+int main(int argc, char *argv[])
+{
+    BenchmarkSettings settings;
+    settings.max_camera_count = 4;
+    settings.max_controller_count = 4;
+    settings.iteration_count = 300;
+    settings.synthetic_frame_count = 32;
+    settings.use_opencl = false;
+    settings.use_pipelined_vision = false;
+
+    if (!parse_arguments(argc, argv, settings))
+    {
+        print_usage();
+        return -1;
+    }
+
+    // Never touch the config of the installed service
+    if (settings.config_path.empty())
+    {
+        boost::filesystem::path config_path = boost::filesystem::temp_directory_path();
+        config_path /= "PSMoveServiceBenchmark";
+        settings.config_path = config_path.string();
+    }
+    PSMoveConfig::setConfigDirectoryOverride(settings.config_path);
+
+    log_init("error");
+    ServerTrace::set_enabled(true);
+
+    printf("Stage columns are ns per replayed frame, summed over all threads (%s frames)\n",
+        settings.recorded_frames_path.empty() ? "synthetic" : settings.recorded_frames_path.c_str());
+    if (settings.use_opencl)
+    {
+        printf("Color masks computed with OpenCL on %s\n",
+            cv::ocl::haveOpenCL() ? cv::ocl::Device::getDefault().name().c_str() : "<no OpenCL device, CPU fallback>");
+    }
+    print_result_header();
+
+    int exit_code = 0;
+    for (int camera_count = 1; camera_count <= settings.max_camera_count; ++camera_count)
+    {
+        for (int controller_count = 1; controller_count <= settings.max_controller_count; ++controller_count)
+        {
+            BenchmarkResult result;
+
+            if (run_benchmark(settings, camera_count, controller_count, result))
+            {
+                print_result(result);
+            }
+            else
+            {
+                printf("Failed to benchmark %d cameras with %d controllers\n", camera_count, controller_count);
+                exit_code = -1;
+            }
+        }
+    }
+
+    log_dispose();
+
+    return exit_code;
+}
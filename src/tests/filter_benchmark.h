@@ -0,0 +1,251 @@
+/* Pose filter microbenchmark shared by test_kalman_filter and unit_test_suite */
+#ifndef __FILTER_BENCHMARK_H
+#define __FILTER_BENCHMARK_H
+
+//-- includes -----
+#include "DeviceInterface.h"
+#include "PoseFilterInterface.h"
+
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <new>
+#include <stdlib.h>
+
+//-- constants -----
+// One optical update per tracking frame, with the IMU updates that arrive in between
+#define k_filter_benchmark_frame_time_delta (1.f/60.f)
+#define k_filter_benchmark_imu_updates_per_frame 4
+// Frames stepped before the measurement starts, so one-time allocations don't count
+#define k_filter_benchmark_warmup_frame_count 60
+
+//-- macros ----
+/// Replaces the global operator new/delete of the executable with ones that count the allocations.
+/// Has to go in exactly one translation unit of the executable.
+/// Eigen's own heap matrices go through malloc and aren't counted, the filters only use fixed size ones.
+#define FILTER_BENCHMARK_DEFINE_ALLOCATION_COUNTER() \
+	std::atomic<long long> g_filter_benchmark_allocation_count(0); \
+	void *operator new(size_t size) \
+	{ \
+		g_filter_benchmark_allocation_count.fetch_add(1, std::memory_order_relaxed); \
+		void *memory = malloc(size > 0 ? size : 1); \
+		if (memory == nullptr) \
+		{ \
+			throw std::bad_alloc(); \
+		} \
+		return memory; \
+	} \
+	void operator delete(void *memory) noexcept \
+	{ \
+		free(memory); \
+	} \
+
+extern std::atomic<long long> g_filter_benchmark_allocation_count;
+
+//-- definitions -----
+struct FilterBenchmarkResult
+{
+	double imu_update_ns;
+	double optical_update_ns;
+	double allocations_per_update;
+	bool bValid;
+};
+
+//-- public interface -----
+/// The pose the synthetic streams follow: a slow yaw sway with the device sliding around in front of the cameras
+inline void filter_benchmark_get_pose(const float time, Eigen::Vector3f &out_position_cm, Eigen::Quaternionf &out_orientation)
+{
+	out_position_cm = Eigen::Vector3f(10.f * sinf(time), 5.f * sinf(0.5f * time), 100.f + 5.f * cosf(time));
+	out_orientation = Eigen::Quaternionf(Eigen::AngleAxisf(0.5f * sinf(time), Eigen::Vector3f::UnitY()));
+}
+
+/// Identity calibrated filter space and constants for a device with the given tracking shape
+inline void filter_benchmark_init_constants(
+	const eCommonTrackingShapeType shape_type,
+	PoseFilterSpace &out_pose_filter_space,
+	PoseFilterConstants &out_constants)
+{
+	// Morpheus LED layout, in cm
+	static const float k_led_points[CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT][3] = {
+		{0.f, 0.f, 0.f},
+		{8.f, 4.5f, -2.5f},
+		{9.f, 0.f, -10.f},
+		{8.f, -4.5f, -2.5f},
+		{-8.f, 4.5f, -2.5f},
+		{-9.f, 0.f, -10.f},
+		{-8.f, -4.5f, -2.5f},
+		{6.f, -1.f, -24.f},
+		{-6.f, -1.f, -24.f}
+	};
+
+	out_pose_filter_space.setIdentityGravity(Eigen::Vector3f(0.f, 1.f, 0.f));
+	out_pose_filter_space.setIdentityMagnetometer(
+		(shape_type == Sphere) ? Eigen::Vector3f(0.f, -0.5f, 0.866025f) : Eigen::Vector3f::Zero());
+	out_pose_filter_space.setCalibrationTransform(Eigen::Matrix3f::Identity());
+	out_pose_filter_space.setSensorTransform(*k_eigen_sensor_transform_identity);
+
+	out_constants.clear();
+
+	out_constants.shape.shape_type = shape_type;
+	switch (shape_type)
+	{
+	case Sphere:
+		out_constants.shape.shape.sphere.radius_cm = 2.25f;
+		break;
+	case PointCloud:
+		out_constants.shape.shape.point_cloud.point_count = CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT;
+		for (int point_index = 0; point_index < CommonDeviceTrackingShape::MAX_POINT_CLOUD_POINT_COUNT; ++point_index)
+		{
+			CommonDevicePosition &point = out_constants.shape.shape.point_cloud.point[point_index];
+
+			point.x = k_led_points[point_index][0];
+			point.y = k_led_points[point_index][1];
+			point.z = k_led_points[point_index][2];
+		}
+		break;
+	default:
+		break;
+	}
+	out_constants.orientation_constants.tracking_shape = out_constants.shape;
+
+	const float update_time_delta = k_filter_benchmark_frame_time_delta / static_cast<float>(k_filter_benchmark_imu_updates_per_frame);
+
+	out_constants.orientation_constants.mean_update_time_delta = update_time_delta;
+	out_constants.orientation_constants.gravity_calibration_direction = out_pose_filter_space.getGravityCalibrationDirection();
+	out_constants.orientation_constants.magnetometer_calibration_direction = out_pose_filter_space.getMagnetometerCalibrationDirection();
+	out_constants.orientation_constants.accelerometer_variance = Eigen::Vector3f(1e-4f, 1e-4f, 1e-4f);
+	out_constants.orientation_constants.gyro_variance = Eigen::Vector3f(1e-4f, 1e-4f, 1e-4f);
+	out_constants.orientation_constants.magnetometer_variance = Eigen::Vector3f(1e-3f, 1e-3f, 1e-3f);
+	out_constants.orientation_constants.position_variance_curve.A = 0.44888f;
+	out_constants.orientation_constants.position_variance_curve.B = -0.00402f;
+	out_constants.orientation_constants.position_variance_curve.MaxValue = 1.0f;
+	out_constants.orientation_constants.orientation_variance_curve.A = 0.44888f;
+	out_constants.orientation_constants.orientation_variance_curve.B = -0.00402f;
+	out_constants.orientation_constants.orientation_variance_curve.MaxValue = 1.0f;
+
+	out_constants.position_constants.accelerometer_variance = Eigen::Vector3f(1e-4f, 1e-4f, 1e-4f);
+	out_constants.position_constants.accelerometer_noise_radius = 0.015f;
+	out_constants.position_constants.max_velocity = 1.f;
+	out_constants.position_constants.mean_update_time_delta = update_time_delta;
+	out_constants.position_constants.gravity_calibration_direction = out_pose_filter_space.getGravityCalibrationDirection();
+	out_constants.position_constants.position_variance_curve.A = 0.44888f;
+	out_constants.position_constants.position_variance_curve.B = -0.00402f;
+	out_constants.position_constants.position_variance_curve.MaxValue = 1.0f;
+}
+
+/// Steps an initialized filter over synthetic IMU and optical streams that follow filter_benchmark_get_pose().
+/// Each update gets timed on its own, the packets get built outside of the timed section.
+inline FilterBenchmarkResult filter_benchmark_run(
+	IPoseFilter *pose_filter,
+	const PoseFilterSpace &pose_filter_space,
+	const PoseFilterConstants &constants,
+	const bool bHasOpticalOrientation,
+	const int frame_count)
+{
+	const float imu_time_delta = k_filter_benchmark_frame_time_delta / static_cast<float>(k_filter_benchmark_imu_updates_per_frame);
+	const Eigen::Vector3f world_magnetometer = constants.orientation_constants.magnetometer_calibration_direction;
+
+	std::chrono::high_resolution_clock::duration imu_update_time = std::chrono::high_resolution_clock::duration::zero();
+	std::chrono::high_resolution_clock::duration optical_update_time = std::chrono::high_resolution_clock::duration::zero();
+	long long allocation_count = 0;
+	int imu_update_count = 0;
+	int optical_update_count = 0;
+	bool bValid = true;
+
+	for (int frame_index = 0; bValid && frame_index < k_filter_benchmark_warmup_frame_count + frame_count; ++frame_index)
+	{
+		const bool bMeasured = frame_index >= k_filter_benchmark_warmup_frame_count;
+		const float frame_time = static_cast<float>(frame_index) * k_filter_benchmark_frame_time_delta;
+
+		for (int imu_index = 0; imu_index < k_filter_benchmark_imu_updates_per_frame; ++imu_index)
+		{
+			const float time = frame_time + static_cast<float>(imu_index) * imu_time_delta;
+			Eigen::Vector3f position_cm;
+			Eigen::Quaternionf orientation;
+			filter_benchmark_get_pose(time, position_cm, orientation);
+
+			// Pure yaw: the gyro only sees the yaw rate, gravity stays put in the sensor frame
+			PoseSensorPacket imu_packet;
+			imu_packet.clear();
+			imu_packet.imu_accelerometer_g_units = Eigen::Vector3f(0.f, 1.f, 0.f);
+			imu_packet.imu_gyroscope_rad_per_sec = Eigen::Vector3f(0.f, 0.5f * cosf(time), 0.f);
+			imu_packet.has_accelerometer_measurement = true;
+			imu_packet.has_gyroscope_measurement = true;
+			if (!world_magnetometer.isZero())
+			{
+				imu_packet.imu_magnetometer_unit = orientation.conjugate() * world_magnetometer;
+				imu_packet.has_magnetometer_measurement = true;
+			}
+
+			PoseFilterPacket imu_filter_packet;
+			imu_filter_packet.clear();
+			pose_filter_space.createFilterPacket(imu_packet, pose_filter, imu_filter_packet);
+
+			const long long allocations_before = g_filter_benchmark_allocation_count.load(std::memory_order_relaxed);
+			const std::chrono::high_resolution_clock::time_point update_start = std::chrono::high_resolution_clock::now();
+			pose_filter->update(imu_time_delta, imu_filter_packet);
+			const std::chrono::high_resolution_clock::duration update_time = std::chrono::high_resolution_clock::now() - update_start;
+
+			if (bMeasured)
+			{
+				imu_update_time += update_time;
+				allocation_count += g_filter_benchmark_allocation_count.load(std::memory_order_relaxed) - allocations_before;
+				++imu_update_count;
+			}
+		}
+
+		{
+			const float time = frame_time + k_filter_benchmark_frame_time_delta;
+			Eigen::Vector3f position_cm;
+			Eigen::Quaternionf orientation;
+			filter_benchmark_get_pose(time, position_cm, orientation);
+
+			PoseSensorPacket optical_packet;
+			optical_packet.clear();
+			optical_packet.optical_position_cm = position_cm;
+			optical_packet.optical_orientation = bHasOpticalOrientation ? orientation : Eigen::Quaternionf::Identity();
+			optical_packet.tracking_projection_area_px_sqr = 400.f;
+
+			PoseFilterPacket optical_filter_packet;
+			optical_filter_packet.clear();
+			pose_filter_space.createFilterPacket(optical_packet, pose_filter, optical_filter_packet);
+
+			const long long allocations_before = g_filter_benchmark_allocation_count.load(std::memory_order_relaxed);
+			const std::chrono::high_resolution_clock::time_point update_start = std::chrono::high_resolution_clock::now();
+			pose_filter->update(0.f, optical_filter_packet);
+			const std::chrono::high_resolution_clock::duration update_time = std::chrono::high_resolution_clock::now() - update_start;
+
+			if (bMeasured)
+			{
+				optical_update_time += update_time;
+				allocation_count += g_filter_benchmark_allocation_count.load(std::memory_order_relaxed) - allocations_before;
+				++optical_update_count;
+			}
+		}
+
+		// A filter that blew up stops the run
+		bValid =
+			pose_filter->getIsStateValid() &&
+			pose_filter->getPositionCm().allFinite() &&
+			pose_filter->getOrientation().coeffs().allFinite();
+	}
+
+	FilterBenchmarkResult result;
+	result.imu_update_ns =
+		(imu_update_count > 0)
+		? std::chrono::duration<double, std::nano>(imu_update_time).count() / static_cast<double>(imu_update_count)
+		: 0.0;
+	result.optical_update_ns =
+		(optical_update_count > 0)
+		? std::chrono::duration<double, std::nano>(optical_update_time).count() / static_cast<double>(optical_update_count)
+		: 0.0;
+	result.allocations_per_update =
+		(imu_update_count + optical_update_count > 0)
+		? static_cast<double>(allocation_count) / static_cast<double>(imu_update_count + optical_update_count)
+		: 0.0;
+	result.bValid = bValid;
+
+	return result;
+}
+
+#endif // __FILTER_BENCHMARK_H
@@ -7,11 +7,19 @@
 #include "MathUtility.h"
 #include "unit_test.h"
 
+#include <algorithm>
+#include <vector>
+
 //-- public interface -----
 bool run_math_alignment_unit_tests()
 {
 	UNIT_TEST_MODULE_BEGIN("math_alignment")
 		UNIT_TEST_MODULE_CALL_TEST(math_alignment_test_best_fit_exponential);
+		UNIT_TEST_MODULE_CALL_TEST(math_alignment_test_fit_focal_cone_to_sphere);
+		UNIT_TEST_MODULE_CALL_TEST(math_alignment_test_solve_p3p);
+		UNIT_TEST_MODULE_CALL_TEST(math_alignment_test_fit_min_volume_ellipsoid);
+		UNIT_TEST_MODULE_CALL_TEST(math_alignment_test_fit_least_squares_plane);
+		UNIT_TEST_MODULE_CALL_TEST(math_alignment_test_quaternion_weighted_average);
 	UNIT_TEST_MODULE_END()
 }
 
@@ -46,4 +54,233 @@ math_alignment_test_best_fit_exponential()
 	assert(success);	
 	
 	UNIT_TEST_COMPLETE()
-}
\ No newline at end of file
+}
+
+bool
+math_alignment_test_fit_focal_cone_to_sphere()
+{
+	UNIT_TEST_BEGIN("fit_focal_cone_to_sphere")
+
+	// Silhouette of a sphere on the normalized (f=1) image plane
+	const float k_sphere_radius = 2.25f;
+	const Eigen::Vector3f sphere_center(5.f, -3.f, 60.f);
+	const int k_point_count = 32;
+
+	const Eigen::Vector3f axis = sphere_center.normalized();
+	const Eigen::Vector3f u = axis.cross(Eigen::Vector3f::UnitY()).normalized();
+	const Eigen::Vector3f v = axis.cross(u);
+	const float alpha = asinf(k_sphere_radius / sphere_center.norm());
+
+	std::vector<Eigen::Vector2f> points;
+	for (int point_index = 0; point_index < k_point_count; ++point_index)
+	{
+		const float phi = k_real_two_pi * static_cast<float>(point_index) / static_cast<float>(k_point_count);
+		const Eigen::Vector3f ray = cosf(alpha)*axis + sinf(alpha)*(cosf(phi)*u + sinf(phi)*v);
+
+		points.push_back(Eigen::Vector2f(ray.x() / ray.z(), ray.y() / ray.z()));
+	}
+
+	Eigen::Vector3f reference_center;
+	eigen_alignment_fit_focal_cone_to_sphere(points.data(), k_point_count, k_sphere_radius, 1.f, &reference_center);
+
+	Eigen::Vector3f fast_center;
+	EigenFitEllipse ellipse;
+	const float residual = 
+		eigen_alignment_fit_focal_cone_to_sphere_fast(
+			points.data()->data(), k_point_count, k_sphere_radius, 1.f, &fast_center, &ellipse);
+
+	success = residual >= 0.f && residual < k_normal_epsilon;
+	assert(success);
+	success = (fast_center - sphere_center).norm() < 0.01f && (reference_center - sphere_center).norm() < 0.01f;
+	assert(success);
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+math_alignment_test_solve_p3p()
+{
+	UNIT_TEST_BEGIN("solve_p3p")
+
+	// Three LEDs of a Morpheus sized object seen from about a meter away
+	const Eigen::Vector3f object_points[3] = {
+		Eigen::Vector3f(-9.f, 3.f, -1.f),
+		Eigen::Vector3f(8.f, 2.5f, -2.f),
+		Eigen::Vector3f(0.5f, -4.f, 1.5f)
+	};
+	const int k_pose_count = 16;
+
+	for (int pose_index = 0; success && pose_index < k_pose_count; ++pose_index)
+	{
+		const float angle = k_real_two_pi * static_cast<float>(pose_index) / static_cast<float>(k_pose_count);
+		const Eigen::Matrix3f rotation =
+			Eigen::AngleAxisf(angle, Eigen::Vector3f(0.3f, 1.f, -0.2f).normalized()).toRotationMatrix();
+		const Eigen::Vector3f translation(10.f*cosf(angle), -5.f*sinf(angle), 100.f + 20.f*sinf(angle));
+
+		Eigen::Vector2f image_points[3];
+		for (int point_index = 0; point_index < 3; ++point_index)
+		{
+			const Eigen::Vector3f camera_point = rotation*object_points[point_index] + translation;
+
+			image_points[point_index] = Eigen::Vector2f(camera_point.x() / camera_point.z(), camera_point.y() / camera_point.z());
+		}
+
+		EigenP3PBearings bearings;
+		bearings.set(image_points);
+
+		// One of the solutions has to be the pose the points were projected with
+		Eigen::Matrix3f rotations[4];
+		Eigen::Vector3f translations[4];
+		const int solution_count = eigen_alignment_solve_p3p(bearings, object_points, rotations, translations);
+
+		bool bFoundPose = false;
+		for (int solution_index = 0; solution_index < solution_count; ++solution_index)
+		{
+			bFoundPose |=
+				(rotations[solution_index] - rotation).norm() < 0.001f &&
+				(translations[solution_index] - translation).norm() < 0.01f;
+		}
+
+		success = solution_count > 0 && bFoundPose;
+		assert(success);
+	}
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+math_alignment_test_fit_min_volume_ellipsoid()
+{
+	UNIT_TEST_BEGIN("fit_min_volume_ellipsoid")
+
+	// Magnetometer calibration sized sample set on a rotated, offset ellipsoid
+	const Eigen::Vector3f center(0.2f, -0.1f, 0.3f);
+	const Eigen::Vector3f extents(1.5f, 1.f, 0.5f);
+	const Eigen::Matrix3f basis =
+		Eigen::AngleAxisf(0.5f, Eigen::Vector3f(1.f, 2.f, 3.f).normalized()).toRotationMatrix();
+	const int k_ring_count = 24;
+	const int k_ring_point_count = 32;
+
+	std::vector<Eigen::Vector3f> points;
+	for (int ring_index = 0; ring_index < k_ring_count; ++ring_index)
+	{
+		const float theta = k_real_pi * (static_cast<float>(ring_index) + 0.5f) / static_cast<float>(k_ring_count);
+
+		for (int point_index = 0; point_index < k_ring_point_count; ++point_index)
+		{
+			const float phi = k_real_two_pi * static_cast<float>(point_index) / static_cast<float>(k_ring_point_count);
+			const Eigen::Vector3f unit(sinf(theta)*cosf(phi), sinf(theta)*sinf(phi), cosf(theta));
+
+			points.push_back(center + basis*unit.cwiseProduct(extents));
+		}
+	}
+	const int point_count = static_cast<int>(points.size());
+
+	// Every sample lies on the fit ellipsoid, so the fit has to be close to it
+	EigenFitMinVolumeEllipsoidWorkspace workspace;
+	EigenFitEllipsoid ellipsoid;
+	eigen_alignment_fit_min_volume_ellipsoid(points.data(), point_count, 0.0001f, workspace, ellipsoid);
+
+	Eigen::Vector3f sorted_extents = ellipsoid.extents;
+	std::sort(sorted_extents.data(), sorted_extents.data() + 3);
+
+	success = (ellipsoid.center - center).norm() < 0.05f;
+	assert(success);
+	success = (sorted_extents - Eigen::Vector3f(0.5f, 1.f, 1.5f)).norm() < 0.05f;
+	assert(success);
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+math_alignment_test_fit_least_squares_plane()
+{
+	UNIT_TEST_BEGIN("fit_least_squares_plane")
+
+	// Noisy grid of samples on a tilted plane
+	const Eigen::Vector3f plane_point(10.f, -5.f, 120.f);
+	const Eigen::Vector3f plane_normal = Eigen::Vector3f(0.2f, 0.9f, -0.3f).normalized();
+	const Eigen::Vector3f u = plane_normal.cross(Eigen::Vector3f::UnitX()).normalized();
+	const Eigen::Vector3f v = plane_normal.cross(u);
+
+	std::vector<Eigen::Vector3f> samples;
+	for (int i = 0; i < 10; ++i)
+	{
+		for (int j = 0; j < 10; ++j)
+		{
+			const float noise = ((i*7 + j*3) % 5 - 2) * 0.01f;
+
+			samples.push_back(plane_point + u*(i - 4.5f)*3.f + v*(j - 4.5f)*2.f + plane_normal*noise);
+		}
+	}
+
+	Eigen::Vector3f centroid, normal;
+	success = eigen_alignment_fit_least_squares_plane(samples.data(), static_cast<int>(samples.size()), &centroid, &normal);
+	assert(success);
+	success = (centroid - plane_point).norm() < 0.01f && fabsf(normal.dot(plane_normal)) > 0.9999f;
+	assert(success);
+
+	// Four corners of a light bar, the way the tracker pose calibration calls it
+	const Eigen::Vector3f corners[4] = { samples[0], samples[9], samples[99], samples[90] };
+	success = eigen_alignment_fit_least_squares_plane(corners, 4, &centroid, &normal);
+	assert(success);
+	success = fabsf(normal.dot(plane_normal)) > 0.999f;
+	assert(success);
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+math_alignment_test_quaternion_weighted_average()
+{
+	UNIT_TEST_BEGIN("quaternion_weighted_average")
+
+	// Four tracker estimates scattered a few degrees around the true orientation,
+	// some of them on the opposite hemisphere
+	const Eigen::Quaternionf expected(Eigen::AngleAxisf(1.f, Eigen::Vector3f(0.3f, 1.f, -0.4f).normalized()));
+	const int k_sample_count = 4;
+	Eigen::Quaternionf samples[k_sample_count];
+	Eigen::Quaterniond samples_d[k_sample_count];
+	const float weights[k_sample_count] = { 1.f, 0.5f, 2.f, 0.25f };
+
+	for (int sample_index = 0; sample_index < k_sample_count; ++sample_index)
+	{
+		const float angle = k_real_two_pi * static_cast<float>(sample_index) / static_cast<float>(k_sample_count);
+		const Eigen::Vector3f offset_axis(cosf(angle), sinf(angle), 0.5f);
+		const Eigen::Quaternionf offset(Eigen::AngleAxisf(0.05f, offset_axis.normalized()));
+
+		samples[sample_index] = expected*offset;
+		if (sample_index % 2 == 1)
+		{
+			samples[sample_index].coeffs() *= -1.f;
+		}
+		samples_d[sample_index] = samples[sample_index].cast<double>();
+	}
+
+	Eigen::Quaternionf average;
+	success = eigen_quaternion_compute_normalized_weighted_average(samples, weights, k_sample_count, &average);
+	assert(success);
+	success = fabsf(average.dot(expected)) > 0.999f;
+	assert(success);
+
+	Eigen::Quaterniond average_d;
+	success = eigen_quaternion_compute_weighted_average(samples_d, nullptr, k_sample_count, &average_d);
+	assert(success);
+	success = fabs(average_d.dot(expected.cast<double>())) > 0.999;
+	assert(success);
+
+	// Two orthogonal orientations with equal weight don't have a dominant direction,
+	// the average has to be one of the (equally good) unit quaternions between them
+	const Eigen::Quaternionf ambiguous[3] = {
+		Eigen::Quaternionf::Identity(),
+		Eigen::Quaternionf(0.f, 1.f, 0.f, 0.f),
+		Eigen::Quaternionf::Identity()
+	};
+	const float ambiguous_weights[3] = { 0.5f, 1.f, 0.5f };
+	success = eigen_quaternion_compute_normalized_weighted_average(ambiguous, ambiguous_weights, 3, &average);
+	assert(success);
+	success = is_nearly_equal(average.squaredNorm(), 1.f, k_normal_epsilon);
+	assert(success);
+
+	UNIT_TEST_COMPLETE()
+}
@@ -19,6 +19,7 @@ bool run_math_eigen_unit_tests()
 		UNIT_TEST_MODULE_CALL_TEST(math_eigen_test_rotate_with_angle_axis_quaternion)
 		UNIT_TEST_MODULE_CALL_TEST(math_eigen_test_rotate_with_arbitrary_quaternion)
 		UNIT_TEST_MODULE_CALL_TEST(math_eigen_test_concatenation);
+		UNIT_TEST_MODULE_CALL_TEST(math_eigen_test_inline_matches_out_of_line);
 	UNIT_TEST_MODULE_END()
 }
 
@@ -193,4 +194,36 @@ static bool math_eigen_test_rotation_method_consistency(const Eigen::Quaternionf
 	}
 
 	return success;
-}
\ No newline at end of file
+}
+
+bool
+math_eigen_test_inline_matches_out_of_line()
+{
+	UNIT_TEST_BEGIN("inline matches out of line")
+
+	// Same check as the math_utility one: the pointers stand in for the out of line calls
+	Eigen::Vector3f (* volatile rotate_ptr)(const Eigen::Quaternionf &, const Eigen::Vector3f &) = eigen_vector3f_clockwise_rotate;
+	Eigen::Quaternionf (* volatile lerp_ptr)(const Eigen::Quaternionf &, const Eigen::Quaternionf &, const float) = eigen_quaternion_normalized_lerp;
+	float (* volatile normalize_ptr)(Eigen::Quaternionf &, const Eigen::Quaternionf &) = eigen_quaternion_normalize_with_default;
+
+	const Eigen::Quaternionf a = Eigen::Quaternionf(Eigen::AngleAxisf(0.3f, Eigen::Vector3f(1.f, 2.f, 3.f).normalized()));
+	const Eigen::Quaternionf b = Eigen::Quaternionf(Eigen::AngleAxisf(-0.7f, Eigen::Vector3f(-2.f, 1.f, 0.5f).normalized()));
+
+	for (int sample_index = 0; success && sample_index < 256; ++sample_index)
+	{
+		const float u = static_cast<float>(sample_index) / 255.f;
+		Eigen::Quaternionf inline_q = eigen_quaternion_normalized_lerp(a, b, u);
+		Eigen::Quaternionf call_q = lerp_ptr(a, b, u);
+
+		eigen_quaternion_normalize_with_default(inline_q, Eigen::Quaternionf::Identity());
+		normalize_ptr(call_q, Eigen::Quaternionf::Identity());
+
+		const Eigen::Vector3f inline_result = eigen_vector3f_clockwise_rotate(inline_q, Eigen::Vector3f(u, 1.f, 0.f));
+		const Eigen::Vector3f call_result = rotate_ptr(call_q, Eigen::Vector3f(u, 1.f, 0.f));
+
+		success = (inline_result - call_result).norm() <= k_normal_epsilon;
+		assert(success);
+	}
+
+	UNIT_TEST_COMPLETE()
+}
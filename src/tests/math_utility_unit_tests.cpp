@@ -11,6 +11,7 @@ bool run_math_utility_unit_tests()
 {
 	UNIT_TEST_MODULE_BEGIN("math_utility")
 		UNIT_TEST_MODULE_CALL_TEST(math_utility_test_wrap_lerpf);
+		UNIT_TEST_MODULE_CALL_TEST(math_utility_test_inline_matches_out_of_line);
 	UNIT_TEST_MODULE_END()
 }
 
@@ -56,4 +57,31 @@ math_utility_test_wrap_lerpf()
 	}
 
 	UNIT_TEST_COMPLETE()
-}
\ No newline at end of file
+}
+
+bool
+math_utility_test_inline_matches_out_of_line()
+{
+	UNIT_TEST_BEGIN("inline matches out of line")
+
+	// Calling through the pointers keeps the calls out of line, the way they were before the helpers
+	// moved into the header (benchmark_math times both)
+	float (* volatile clampf_ptr)(float, float, float) = clampf;
+	float (* volatile lerpf_ptr)(float, float, float) = lerpf;
+	float (* volatile safe_divide_ptr)(float, float, float) = safe_divide_with_default;
+	float (* volatile wrap_radians_ptr)(float) = wrap_radians;
+
+	for (int sample_index = 0; success && sample_index < 256; ++sample_index)
+	{
+		const float x = static_cast<float>(sample_index) * 0.01f;
+		const float inline_result =
+			wrap_radians(lerpf(clampf(x, 0.5f, 2.f), x, 0.25f)) + safe_divide_with_default(x, x - 1.f, 0.f);
+		const float call_result =
+			wrap_radians_ptr(lerpf_ptr(clampf_ptr(x, 0.5f, 2.f), x, 0.25f)) + safe_divide_ptr(x, x - 1.f, 0.f);
+
+		success = is_nearly_equal(inline_result, call_result, k_normal_epsilon);
+		assert(success);
+	}
+
+	UNIT_TEST_COMPLETE()
+}
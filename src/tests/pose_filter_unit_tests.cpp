@@ -0,0 +1,279 @@
+//-- includes -----
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "CompoundPoseFilter.h"
+#include "ErrorStateKalmanPoseFilter.h"
+#include "PoseFilterBatch.h"
+#include "filter_benchmark.h"
+#include "unit_test.h"
+
+//-- constants -----
+static const int k_unit_test_frame_count = 600;
+static const int k_batch_test_frame_count = 120;
+static const int k_batch_test_filter_count = 4;
+static const int k_batch_test_packets_per_frame = k_filter_benchmark_imu_updates_per_frame + 1;
+
+//-- globals -----
+// Counts the allocations the filters make per update
+FILTER_BENCHMARK_DEFINE_ALLOCATION_COUNTER()
+
+//-- public interface -----
+bool run_pose_filter_unit_tests()
+{
+	UNIT_TEST_MODULE_BEGIN("pose_filter")
+		UNIT_TEST_MODULE_CALL_TEST(pose_filter_test_error_state_update_cost);
+		UNIT_TEST_MODULE_CALL_TEST(pose_filter_test_compound_update_cost);
+		UNIT_TEST_MODULE_CALL_TEST(pose_filter_test_batch_matches_single_updates);
+	UNIT_TEST_MODULE_END()
+}
+
+//-- private functions -----
+static bool
+pose_filter_test_run(
+	const char *filter_name,
+	IPoseFilter *pose_filter,
+	const PoseFilterSpace &pose_filter_space,
+	const PoseFilterConstants &constants,
+	const bool bHasOpticalOrientation)
+{
+	const FilterBenchmarkResult result =
+		filter_benchmark_run(pose_filter, pose_filter_space, constants, bHasOpticalOrientation, k_unit_test_frame_count);
+
+	fprintf(stdout, "      %s: %.0f ns (imu), %.0f ns (optical), %.2f allocations per update\n",
+		filter_name, result.imu_update_ns, result.optical_update_ns, result.allocations_per_update);
+
+	// The filters run on the device update path, they can't go to the heap once running
+	return result.bValid && result.allocations_per_update == 0.0;
+}
+
+// One frame of the synthetic IMU and optical streams of filter_benchmark_run(), in arrival order
+static void
+pose_filter_test_make_frame_packets(
+	const int frame_index,
+	const PoseFilterConstants &constants,
+	const bool bHasOpticalOrientation,
+	PoseSensorPacket *out_packets,
+	float *out_time_deltas)
+{
+	const float imu_time_delta = k_filter_benchmark_frame_time_delta / static_cast<float>(k_filter_benchmark_imu_updates_per_frame);
+	const float frame_time = static_cast<float>(frame_index) * k_filter_benchmark_frame_time_delta;
+	const Eigen::Vector3f world_magnetometer = constants.orientation_constants.magnetometer_calibration_direction;
+
+	for (int imu_index = 0; imu_index < k_filter_benchmark_imu_updates_per_frame; ++imu_index)
+	{
+		const float time = frame_time + static_cast<float>(imu_index) * imu_time_delta;
+		Eigen::Vector3f position_cm;
+		Eigen::Quaternionf orientation;
+		filter_benchmark_get_pose(time, position_cm, orientation);
+
+		PoseSensorPacket &imu_packet = out_packets[imu_index];
+		imu_packet.clear();
+		imu_packet.imu_accelerometer_g_units = Eigen::Vector3f(0.f, 1.f, 0.f);
+		imu_packet.imu_gyroscope_rad_per_sec = Eigen::Vector3f(0.f, 0.5f * cosf(time), 0.f);
+		imu_packet.has_accelerometer_measurement = true;
+		imu_packet.has_gyroscope_measurement = true;
+		if (!world_magnetometer.isZero())
+		{
+			imu_packet.imu_magnetometer_unit = orientation.conjugate() * world_magnetometer;
+			imu_packet.has_magnetometer_measurement = true;
+		}
+		out_time_deltas[imu_index] = imu_time_delta;
+	}
+
+	{
+		const float time = frame_time + k_filter_benchmark_frame_time_delta;
+		Eigen::Vector3f position_cm;
+		Eigen::Quaternionf orientation;
+		filter_benchmark_get_pose(time, position_cm, orientation);
+
+		PoseSensorPacket &optical_packet = out_packets[k_filter_benchmark_imu_updates_per_frame];
+		optical_packet.clear();
+		optical_packet.optical_position_cm = position_cm;
+		optical_packet.optical_orientation = bHasOpticalOrientation ? orientation : Eigen::Quaternionf::Identity();
+		optical_packet.tracking_projection_area_px_sqr = 400.f;
+		out_time_deltas[k_filter_benchmark_imu_updates_per_frame] = 0.f;
+	}
+}
+
+bool
+pose_filter_test_error_state_update_cost()
+{
+	UNIT_TEST_BEGIN("error state update cost")
+
+	Eigen::Vector3f initial_position;
+	Eigen::Quaternionf initial_orientation;
+	filter_benchmark_get_pose(0.f, initial_position, initial_orientation);
+
+	{
+		PoseFilterSpace pose_filter_space;
+		PoseFilterConstants constants;
+		filter_benchmark_init_constants(Sphere, pose_filter_space, constants);
+
+		ErrorStateKalmanPoseFilterPSMove pose_filter;
+		pose_filter.init(constants, initial_position, initial_orientation);
+
+		success &= pose_filter_test_run("PSMove ESKF", &pose_filter, pose_filter_space, constants, false);
+		assert(success);
+	}
+
+	{
+		PoseFilterSpace pose_filter_space;
+		PoseFilterConstants constants;
+		filter_benchmark_init_constants(LightBar, pose_filter_space, constants);
+
+		ErrorStateKalmanPoseFilterDS4 pose_filter;
+		pose_filter.init(constants, initial_position, initial_orientation);
+
+		success &= pose_filter_test_run("DS4 ESKF", &pose_filter, pose_filter_space, constants, true);
+		assert(success);
+	}
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+pose_filter_test_compound_update_cost()
+{
+	UNIT_TEST_BEGIN("compound update cost")
+
+	Eigen::Vector3f initial_position;
+	Eigen::Quaternionf initial_orientation;
+	filter_benchmark_get_pose(0.f, initial_position, initial_orientation);
+
+	{
+		PoseFilterSpace pose_filter_space;
+		PoseFilterConstants constants;
+		filter_benchmark_init_constants(Sphere, pose_filter_space, constants);
+
+		CompoundPoseFilter pose_filter;
+		pose_filter.init(
+			CommonDeviceState::PSMove,
+			OrientationFilterTypeComplementaryMARG, PositionFilterTypeLowPassOptical,
+			constants,
+			initial_position, initial_orientation);
+
+		success &= pose_filter_test_run("PSMove MARG/LowPass", &pose_filter, pose_filter_space, constants, false);
+		assert(success);
+	}
+
+	{
+		PoseFilterSpace pose_filter_space;
+		PoseFilterConstants constants;
+		filter_benchmark_init_constants(LightBar, pose_filter_space, constants);
+
+		CompoundPoseFilter pose_filter;
+		pose_filter.init(
+			CommonDeviceState::PSDualShock4,
+			OrientationFilterTypeComplementaryOpticalARG, PositionFilterTypeLowPassOptical,
+			constants,
+			initial_position, initial_orientation);
+
+		success &= pose_filter_test_run("DS4 OpticalARG/LowPass", &pose_filter, pose_filter_space, constants, true);
+		assert(success);
+	}
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+pose_filter_test_batch_matches_single_updates()
+{
+	UNIT_TEST_BEGIN("batch matches single updates")
+
+	static const eCommonTrackingShapeType k_shape_types[k_batch_test_filter_count] = {
+		Sphere, Sphere, LightBar, Sphere
+	};
+	static const OrientationFilterType k_orientation_filter_types[k_batch_test_filter_count] = {
+		OrientationFilterTypeMadgwickARG,
+		OrientationFilterTypeMadgwickMARG,
+		OrientationFilterTypeComplementaryOpticalARG,
+		OrientationFilterTypeComplementaryMARG
+	};
+
+	Eigen::Vector3f initial_position;
+	Eigen::Quaternionf initial_orientation;
+	filter_benchmark_get_pose(0.f, initial_position, initial_orientation);
+
+	PoseFilterSpace pose_filter_spaces[k_batch_test_filter_count];
+	PoseFilterConstants constants[k_batch_test_filter_count];
+	CompoundPoseFilter single_filters[k_batch_test_filter_count];
+	CompoundPoseFilter batched_filters[k_batch_test_filter_count];
+
+	for (int filter_index = 0; filter_index < k_batch_test_filter_count; ++filter_index)
+	{
+		const CommonDeviceState::eDeviceType device_type =
+			(k_shape_types[filter_index] == Sphere) ? CommonDeviceState::PSMove : CommonDeviceState::PSDualShock4;
+
+		filter_benchmark_init_constants(k_shape_types[filter_index], pose_filter_spaces[filter_index], constants[filter_index]);
+
+		single_filters[filter_index].init(
+			device_type,
+			k_orientation_filter_types[filter_index], PositionFilterTypeLowPassOptical,
+			constants[filter_index],
+			initial_position, initial_orientation);
+		batched_filters[filter_index].init(
+			device_type,
+			k_orientation_filter_types[filter_index], PositionFilterTypeLowPassOptical,
+			constants[filter_index],
+			initial_position, initial_orientation);
+	}
+
+	// Filters without a batch kernel have to stay on the single device path
+	{
+		ErrorStateKalmanPoseFilterPSMove kalman_filter;
+		kalman_filter.init(constants[0], initial_position, initial_orientation);
+
+		PoseSensorPacket packet;
+		float time_delta = 0.f;
+		packet.clear();
+
+		PoseFilterBatch pose_filter_batch;
+		success &= !pose_filter_batch.addFilter(&kalman_filter, &pose_filter_spaces[0], &packet, &time_delta, 1);
+		assert(success);
+	}
+
+	PoseFilterBatch *pose_filter_batch = new PoseFilterBatch;
+	PoseSensorPacket packets[k_batch_test_filter_count][k_batch_test_packets_per_frame];
+	float time_deltas[k_batch_test_filter_count][k_batch_test_packets_per_frame];
+
+	for (int frame_index = 0; success && frame_index < k_batch_test_frame_count; ++frame_index)
+	{
+		pose_filter_batch->clear();
+
+		for (int filter_index = 0; filter_index < k_batch_test_filter_count; ++filter_index)
+		{
+			// Vary the packet count per device, the batch has to cope with uneven queues
+			const int packet_count = k_batch_test_packets_per_frame - ((frame_index + filter_index) % 2);
+
+			pose_filter_test_make_frame_packets(
+				frame_index, constants[filter_index], k_shape_types[filter_index] == LightBar,
+				packets[filter_index], time_deltas[filter_index]);
+
+			single_filters[filter_index].updateBatch(
+				&pose_filter_spaces[filter_index], packets[filter_index], time_deltas[filter_index], packet_count);
+			success &= pose_filter_batch->addFilter(
+				&batched_filters[filter_index], &pose_filter_spaces[filter_index],
+				packets[filter_index], time_deltas[filter_index], packet_count);
+		}
+		assert(success);
+
+		pose_filter_batch->update();
+
+		for (int filter_index = 0; filter_index < k_batch_test_filter_count; ++filter_index)
+		{
+			const float orientation_error =
+				single_filters[filter_index].getOrientation().angularDistance(batched_filters[filter_index].getOrientation());
+			const float position_error =
+				(single_filters[filter_index].getPositionCm() - batched_filters[filter_index].getPositionCm()).norm();
+
+			success &= orientation_error < 1e-4f && position_error < 1e-3f;
+		}
+		assert(success);
+	}
+
+	delete pose_filter_batch;
+
+	UNIT_TEST_COMPLETE()
+}
@@ -0,0 +1,133 @@
+//-- includes -----
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "ServerUtility.h"
+#include "unit_test.h"
+
+//-- definitions -----
+// The check the client runs on every controller data frame before applying it
+// (ClientDataFrameParser::is_stale_frame, applyControllerDataFrame)
+struct ClientSequenceCheck
+{
+	int last_sequence_num;
+
+	ClientSequenceCheck() : last_sequence_num(-1) {}
+
+	bool accept(const int sequence_num)
+	{
+		if (sequence_num <= last_sequence_num)
+		{
+			return false;
+		}
+
+		last_sequence_num = sequence_num;
+		return true;
+	}
+};
+
+// A device view's sequence numbers as the fixed rate stream sees them (see ServerDeviceView::publish)
+struct DeviceSequence
+{
+	int next_sequence_num;
+
+	DeviceSequence() : next_sequence_num(0) {}
+
+	int publish()
+	{
+		return next_sequence_num++;
+	}
+
+	int output(int &last_output_sequence_num)
+	{
+		const int sequence_num =
+			ServerUtility::next_stream_output_sequence_number(last_output_sequence_num, next_sequence_num);
+
+		last_output_sequence_num = sequence_num;
+		if (sequence_num > next_sequence_num)
+		{
+			next_sequence_num = sequence_num;
+		}
+
+		return sequence_num;
+	}
+};
+
+//-- public interface -----
+bool run_server_stream_unit_tests()
+{
+	UNIT_TEST_MODULE_BEGIN("server_stream")
+		UNIT_TEST_MODULE_CALL_TEST(server_stream_test_fixed_rate_outputs_between_publishes);
+		UNIT_TEST_MODULE_CALL_TEST(server_stream_test_publish_after_fixed_rate_outputs);
+	UNIT_TEST_MODULE_END()
+}
+
+//-- private functions -----
+bool
+server_stream_test_fixed_rate_outputs_between_publishes()
+{
+	UNIT_TEST_BEGIN("fixed rate outputs between publishes")
+
+	DeviceSequence device;
+	ClientSequenceCheck client;
+	int last_output_sequence_num = -1;
+
+	device.publish();
+
+	// Two outputs share one device update, both get through
+	success &= client.accept(device.output(last_output_sequence_num));
+	success &= client.accept(device.output(last_output_sequence_num));
+	assert(success);
+
+	// Outputs keep getting through at three times the device update rate
+	for (int update_index = 0; success && update_index < 10; ++update_index)
+	{
+		device.publish();
+
+		for (int output_index = 0; success && output_index < 3; ++output_index)
+		{
+			success &= client.accept(device.output(last_output_sequence_num));
+		}
+	}
+	assert(success);
+
+	// And at a third of it
+	for (int update_index = 0; success && update_index < 10; ++update_index)
+	{
+		device.publish();
+		device.publish();
+		device.publish();
+
+		success &= client.accept(device.output(last_output_sequence_num));
+	}
+	assert(success);
+
+	UNIT_TEST_COMPLETE()
+}
+
+bool
+server_stream_test_publish_after_fixed_rate_outputs()
+{
+	UNIT_TEST_BEGIN("publish after fixed rate outputs")
+
+	DeviceSequence device;
+	ClientSequenceCheck client;
+	int last_output_sequence_num = -1;
+
+	device.publish();
+	for (int output_index = 0; success && output_index < 5; ++output_index)
+	{
+		success &= client.accept(device.output(last_output_sequence_num));
+	}
+	assert(success);
+
+	// The outputs ran ahead of the device updates, but the published frames of a stream
+	// restarted without a fixed rate still get through. Only the first publish can repeat the last output's number.
+	device.publish();
+	success &= client.accept(device.publish());
+	success &= client.accept(device.publish());
+	assert(success);
+
+	UNIT_TEST_COMPLETE()
+}
@@ -1,4 +1,6 @@
 #include "DeviceInterface.h"
+#include "ErrorStateKalmanPoseFilter.h"
+#include "filter_benchmark.h"
 #include "KalmanPoseFilter.h"
 #include "CompoundPoseFilter.h"
 #include "MathAlignment.h"
@@ -7,13 +9,24 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <random>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
 #include <vector>
 
 #if _MSC_VER
 #define strncasecmp(a, b, n) _strnicmp(a,b,n)
 #endif
 
+// Counts the allocations the filters make per update (see --benchmark-filters)
+FILTER_BENCHMARK_DEFINE_ALLOCATION_COUNTER()
+
 enum eControllerSampleFields
 {
 	FIELD_TIME,
@@ -374,27 +387,122 @@ private:
 	FILE* m_fp;
 };
 
+// The noise constants the tuner searches over.
+// Each one is a multiplier on the value derived from the stationary recording.
+enum eTuningParameter
+{
+	TUNE_ACCELEROMETER_VARIANCE,
+	TUNE_ACCELEROMETER_NOISE_RADIUS,
+	TUNE_GYRO_VARIANCE,
+	TUNE_MAGNETOMETER_VARIANCE,
+	TUNE_POSITION_VARIANCE,
+	TUNE_ORIENTATION_VARIANCE,
+
+	TUNE_PARAMETER_COUNT
+};
+
+const char *szTuningParameterNames[TUNE_PARAMETER_COUNT] = {
+	"accelerometer_variance",
+	"accelerometer_noise_radius",
+	"gyro_variance",
+	"magnetometer_variance",
+	"position_variance",
+	"orientation_variance"
+};
+
+static const int k_default_tuning_configuration_count = 2000;
+static const float k_tuning_max_scale = 16.f; // each multiplier is drawn from [1/16, 16], log uniform
+static const int k_tuning_max_latency_samples = 30;
+static const float k_default_tuning_jitter_weight = 0.5f;
+
+struct FilterTuningConfiguration
+{
+	float scale[TUNE_PARAMETER_COUNT];
+};
+
+struct FilterTuningResult
+{
+	// Frame to frame jitter: rms of the second difference of the filtered pose
+	float position_jitter_cm;
+	float orientation_jitter_deg;
+
+	// Tracking error: rms distance of the filtered pose from the recorded pose
+	float position_error_cm;
+	float orientation_error_deg;
+
+	// Shift of the recorded positions that best lines them up with the filtered ones
+	float position_latency_sec;
+
+	// Mean cost of one filter update
+	float update_time_us;
+
+	float score;
+	bool bValid;
+};
+
 static void apply_filter(
 	const bool bUseCompoundFilter,
 	ControllerInputStream &stationary_stream,
 	ControllerInputStream &movement_stream,
 	FilterOutputStream &output_stream);
-static void init_filter_for_psdualshock4(
+static bool init_filter_space_and_constants(
 	const ControllerInputStream &stationary_stream,
-	const Eigen::Vector3f &initial_position, const Eigen::Quaternionf &initial_orientation,
-	const bool bUseCompoundFilter,
-	PoseFilterSpace **out_pose_filter_space, IPoseFilter **out_pose_filter);
-static void init_filter_for_psmove(
+	PoseFilterSpace &out_pose_filter_space,
+	PoseFilterConstants &out_constants);
+static void init_constants_for_psdualshock4(
+	const ControllerInputStream &stationary_stream,
+	PoseFilterSpace &out_pose_filter_space,
+	PoseFilterConstants &out_constants);
+static void init_constants_for_psmove(
 	const ControllerInputStream &stationary_stream,
+	PoseFilterSpace &out_pose_filter_space,
+	PoseFilterConstants &out_constants);
+static IPoseFilter *create_pose_filter(
+	const CommonDeviceState::eDeviceType controller_type,
+	const PoseFilterConstants &constants,
 	const Eigen::Vector3f &initial_position, const Eigen::Quaternionf &initial_orientation,
-	const bool bUseCompoundFilter,
-	PoseFilterSpace **out_pose_filter_space, IPoseFilter **out_pose_filter);
+	const bool bUseCompoundFilter);
+static PoseSensorPacket make_sensor_packet(const ControllerSample &sample);
+static void make_sensor_packets(
+	const ControllerInputStream &stationary_stream,
+	const ControllerInputStream &movement_stream,
+	std::vector<PoseSensorPacket, Eigen::aligned_allocator<PoseSensorPacket> > &out_sensor_packets,
+	std::vector<float> &out_time_deltas);
+static bool tune_filter(int argc, char *argv[]);
+static bool benchmark_error_state_filter(int argc, char *argv[]);
+static bool benchmark_pose_filters(int argc, char *argv[]);
+static bool benchmark_hmd_point_cloud_filter();
 
 int main(int argc, char *argv[])
-{   
+{
+	if (argc >= 2 && strcmp(argv[1], "--benchmark-hmd") == 0)
+	{
+		return benchmark_hmd_point_cloud_filter() ? 0 : -1;
+	}
+
+	if (argc >= 2 && strcmp(argv[1], "--tune") == 0)
+	{
+		return tune_filter(argc, argv) ? 0 : -1;
+	}
+
+	if (argc >= 2 && strcmp(argv[1], "--benchmark-eskf") == 0)
+	{
+		return benchmark_error_state_filter(argc, argv) ? 0 : -1;
+	}
+
+	if (argc >= 2 && strcmp(argv[1], "--benchmark-filters") == 0)
+	{
+		return benchmark_pose_filters(argc, argv) ? 0 : -1;
+	}
+
 	if (argc < 4)
 	{
-		printf("usage test_kalman_filter <stationary_file.csv> <movement_file.csv> <output_file.csv>");
+		printf("usage test_kalman_filter <stationary_file.csv> <movement_file.csv> <output_file.csv>\n");
+		printf("      test_kalman_filter --benchmark-hmd\n");
+		printf("      test_kalman_filter --tune <stationary_file.csv> <movement_file.csv> <output_constants.json>\n");
+		printf("          [--configurations N] [--threads T] [--jitter-weight W] [--seed S]\n");
+		printf("      test_kalman_filter --benchmark-eskf <stationary_file.csv> <movement_file.csv>\n");
+		printf("      test_kalman_filter --benchmark-filters [--frames N]\n");
 		return -1;
 	}
 
@@ -437,34 +545,28 @@ apply_filter(
 	ControllerInputStream &movement_stream,
 	FilterOutputStream &output_stream)
 {
-	PoseFilterSpace *pose_filter_space = nullptr;
-	IPoseFilter *pose_filter = nullptr;
+	PoseFilterSpace pose_filter_space;
+	PoseFilterConstants constants;
+
+	if (!init_filter_space_and_constants(stationary_stream, pose_filter_space, constants))
+	{
+		return;
+	}
 
 	const ControllerSample &initialSample = movement_stream.getSample(0);
 	Eigen::Vector3f initial_pos(initialSample.pos[0], initialSample.pos[1], initialSample.pos[2]);
 	Eigen::Quaternionf initial_ori(initialSample.ori[0], initialSample.ori[1], initialSample.ori[2], initialSample.ori[3]);
 
-	switch (movement_stream.getControllerType())
-	{
-	case CommonDeviceState::PSMove:
-		init_filter_for_psmove(
-			stationary_stream,
-			initial_pos, initial_ori,
-			bUseCompoundFilter,
-			&pose_filter_space, &pose_filter);
-		break;
-	case CommonDeviceState::PSDualShock4:
-		init_filter_for_psdualshock4(
-			stationary_stream,
+	IPoseFilter *pose_filter =
+		create_pose_filter(
+			movement_stream.getControllerType(),
+			constants,
 			initial_pos, initial_ori,
-			bUseCompoundFilter,
-			&pose_filter_space, &pose_filter);
-		break;
-	default:
-		break;
-	}
+			bUseCompoundFilter);
 
 	float lastTime = movement_stream.getSample(0).time - stationary_stream.computeMeanTimeDelta();
+	std::chrono::high_resolution_clock::duration total_update_time = std::chrono::high_resolution_clock::duration::zero();
+	int update_count = 0;
 
 	movement_stream.reset();
 	while (movement_stream.hasNext())
@@ -472,55 +574,76 @@ apply_filter(
 		ControllerSample sample = movement_stream.next();
 		float dT = sample.time - lastTime;
 
-		PoseSensorPacket sensorPacket;
-		sensorPacket.imu_accelerometer_g_units = Eigen::Vector3f(sample.acc[0], sample.acc[1], sample.acc[2]);
-		sensorPacket.imu_gyroscope_rad_per_sec = Eigen::Vector3f(sample.gyro[0], sample.gyro[1], sample.gyro[2]);
-		sensorPacket.imu_magnetometer_unit = Eigen::Vector3f(sample.mag[0], sample.mag[1], sample.mag[2]);
-		sensorPacket.optical_orientation = Eigen::Quaternionf(sample.ori[0], sample.ori[1], sample.ori[2], sample.ori[3]);
-		sensorPacket.tracking_projection_area_px_sqr = sample.area;
-		sensorPacket.optical_position_cm = Eigen::Vector3f(sample.pos[0], sample.pos[1], sample.pos[2]);
+		PoseSensorPacket sensorPacket= make_sensor_packet(sample);
 
 		PoseFilterPacket filterPacket;
-		pose_filter_space->createFilterPacket(sensorPacket, pose_filter, filterPacket);
+		pose_filter_space.createFilterPacket(sensorPacket, pose_filter, filterPacket);
 
+		const std::chrono::high_resolution_clock::time_point update_start = std::chrono::high_resolution_clock::now();
 		pose_filter->update(dT, filterPacket);
+		total_update_time += std::chrono::high_resolution_clock::now() - update_start;
+		++update_count;
 
 		output_stream.writeFilterState(sample, pose_filter, sample.time);
 	}
 
-	if (pose_filter_space != nullptr)
+	// Per update cost of the filter (what a 1kHz IMU stream pays per sample)
+	if (update_count > 0)
 	{
-		delete pose_filter_space;
+		const double total_update_us =
+			static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(total_update_time).count());
+
+		printf("%s filter: %d updates, %.2f us per update\n",
+			bUseCompoundFilter ? "Compound" : "Pose",
+			update_count, total_update_us / static_cast<double>(update_count));
 	}
-	if (pose_filter != nullptr)
+
+	delete pose_filter;
+}
+
+static bool
+init_filter_space_and_constants(
+	const ControllerInputStream &stationary_stream,
+	PoseFilterSpace &out_pose_filter_space,
+	PoseFilterConstants &out_constants)
+{
+	bool bSuccess = true;
+
+	switch (stationary_stream.getControllerType())
 	{
-		delete pose_filter;
+	case CommonDeviceState::PSMove:
+		init_constants_for_psmove(stationary_stream, out_pose_filter_space, out_constants);
+		break;
+	case CommonDeviceState::PSDualShock4:
+		init_constants_for_psdualshock4(stationary_stream, out_pose_filter_space, out_constants);
+		break;
+	default:
+		bSuccess = false;
+		break;
 	}
+
+	return bSuccess;
 }
 
 static void
-init_filter_for_psmove(
+init_constants_for_psmove(
 	const ControllerInputStream &stationary_stream,
-	const Eigen::Vector3f &initial_position,
-	const Eigen::Quaternionf &initial_orientation,
-	const bool bUseCompoundFilter,
-	PoseFilterSpace **out_pose_filter_space,
-	IPoseFilter **out_pose_filter)
+	PoseFilterSpace &out_pose_filter_space,
+	PoseFilterConstants &out_constants)
 {
 	// Setup the space the orientation filter operates in
-	PoseFilterSpace *pose_filter_space = new PoseFilterSpace();
-	pose_filter_space->setIdentityGravity(Eigen::Vector3f(0.f, 0.f, -1.f));
-	pose_filter_space->setIdentityMagnetometer(Eigen::Vector3f(0.234017432f, 0.873125494f, 0.42765367f));
-	pose_filter_space->setCalibrationTransform(*k_eigen_identity_pose_upright);
-	pose_filter_space->setSensorTransform(*k_eigen_sensor_transform_identity);
+	out_pose_filter_space.setIdentityGravity(Eigen::Vector3f(0.f, 0.f, -1.f));
+	out_pose_filter_space.setIdentityMagnetometer(Eigen::Vector3f(0.234017432f, 0.873125494f, 0.42765367f));
+	out_pose_filter_space.setCalibrationTransform(*k_eigen_identity_pose_upright);
+	out_pose_filter_space.setSensorTransform(*k_eigen_sensor_transform_identity);
 
 	// Copy the pose filter constants from the controller config
-	PoseFilterConstants constants;
+	PoseFilterConstants &constants = out_constants;
 	constants.clear();
 
 	constants.orientation_constants.mean_update_time_delta = stationary_stream.computeMeanTimeDelta();
-	constants.orientation_constants.gravity_calibration_direction = pose_filter_space->getGravityCalibrationDirection();
-	constants.orientation_constants.magnetometer_calibration_direction = pose_filter_space->getMagnetometerCalibrationDirection();
+	constants.orientation_constants.gravity_calibration_direction = out_pose_filter_space.getGravityCalibrationDirection();
+	constants.orientation_constants.magnetometer_calibration_direction = out_pose_filter_space.getMagnetometerCalibrationDirection();
 	stationary_stream.computeSliceStatistics(
 		FIELD_GYROSCOPE_X,
 		&constants.orientation_constants.gyro_drift,
@@ -547,59 +670,34 @@ init_filter_for_psmove(
 	Eigen::Vector3f position_variance;
 	stationary_stream.computeSliceStatistics(
 		FIELD_POSITION_X,
-		nullptr, 
+		nullptr,
 		&position_variance);
 	constants.position_constants.position_variance_curve.A = 0.44888f;
 	constants.position_constants.position_variance_curve.B = -0.00402f;
 	constants.position_constants.position_variance_curve.MaxValue = 1.0f;
 	constants.position_constants.mean_update_time_delta = stationary_stream.computeMeanTimeDelta();
-	constants.position_constants.gravity_calibration_direction = pose_filter_space->getGravityCalibrationDirection();
-
-	if (bUseCompoundFilter)
-	{
-		CompoundPoseFilter *compoundFilter = new CompoundPoseFilter();
-		compoundFilter->init(
-			CommonDeviceState::PSMove, 
-			OrientationFilterTypeKalman, PositionFilterTypeKalman, 
-			constants,
-			initial_position, initial_orientation);
-
-		*out_pose_filter = compoundFilter;
-	}
-	else
-	{
-		KalmanPoseFilterPSMove *fullPoseFilter = new KalmanPoseFilterPSMove();
-		fullPoseFilter->init(constants, initial_position, initial_orientation);
-
-		*out_pose_filter = fullPoseFilter;
-	}
-
-	*out_pose_filter_space = pose_filter_space;
+	constants.position_constants.gravity_calibration_direction = out_pose_filter_space.getGravityCalibrationDirection();
 }
 
 static void
-init_filter_for_psdualshock4(
+init_constants_for_psdualshock4(
 	const ControllerInputStream &stationary_stream,
-	const Eigen::Vector3f &initial_position,
-	const Eigen::Quaternionf &initial_orientation,
-	const bool bUseCompoundFilter,
-	PoseFilterSpace **out_pose_filter_space,
-	IPoseFilter **out_pose_filter)
+	PoseFilterSpace &out_pose_filter_space,
+	PoseFilterConstants &out_constants)
 {
 	// Setup the space the orientation filter operates in
-	PoseFilterSpace *pose_filter_space = new PoseFilterSpace();
-	pose_filter_space->setIdentityGravity(Eigen::Vector3f(0.f, 0.922760189f, -0.385374635f));
-	pose_filter_space->setIdentityMagnetometer(Eigen::Vector3f::Zero());  // No magnetometer on DS4 :(
-	pose_filter_space->setCalibrationTransform(*k_eigen_identity_pose_upright);
-	pose_filter_space->setSensorTransform(*k_eigen_sensor_transform_identity);
+	out_pose_filter_space.setIdentityGravity(Eigen::Vector3f(0.f, 0.922760189f, -0.385374635f));
+	out_pose_filter_space.setIdentityMagnetometer(Eigen::Vector3f::Zero());  // No magnetometer on DS4 :(
+	out_pose_filter_space.setCalibrationTransform(*k_eigen_identity_pose_upright);
+	out_pose_filter_space.setSensorTransform(*k_eigen_sensor_transform_identity);
 
 	// Copy the pose filter constants from the controller config
-	PoseFilterConstants constants;
+	PoseFilterConstants &constants = out_constants;
 	constants.clear();
 
 	constants.orientation_constants.mean_update_time_delta = stationary_stream.computeMeanTimeDelta();
-	constants.orientation_constants.gravity_calibration_direction = pose_filter_space->getGravityCalibrationDirection();
-	constants.orientation_constants.magnetometer_calibration_direction = pose_filter_space->getMagnetometerCalibrationDirection();
+	constants.orientation_constants.gravity_calibration_direction = out_pose_filter_space.getGravityCalibrationDirection();
+	constants.orientation_constants.magnetometer_calibration_direction = out_pose_filter_space.getMagnetometerCalibrationDirection();
 	constants.orientation_constants.magnetometer_drift = Eigen::Vector3f::Zero(); // no magnetometer on ds4
 	constants.orientation_constants.magnetometer_variance = Eigen::Vector3f::Zero(); // no magnetometer on ds4
 	stationary_stream.computeSliceStatistics(
@@ -620,7 +718,7 @@ init_filter_for_psdualshock4(
 	constants.position_constants.accelerometer_noise_radius = 0.0148137454f;
 	constants.position_constants.max_velocity = 1.f;
 	constants.position_constants.mean_update_time_delta = stationary_stream.computeMeanTimeDelta();
-	constants.position_constants.gravity_calibration_direction = pose_filter_space->getGravityCalibrationDirection();
+	constants.position_constants.gravity_calibration_direction = out_pose_filter_space.getGravityCalibrationDirection();
 
 	Eigen::Vector3f position_variance;
 	stationary_stream.computeSliceStatistics(
@@ -630,25 +728,878 @@ init_filter_for_psdualshock4(
 	constants.position_constants.position_variance_curve.A = 0.44888f;
 	constants.position_constants.position_variance_curve.B = -0.00402f;
 	constants.position_constants.position_variance_curve.MaxValue = 1.0f;
+}
+
+static IPoseFilter *
+create_pose_filter(
+	const CommonDeviceState::eDeviceType controller_type,
+	const PoseFilterConstants &constants,
+	const Eigen::Vector3f &initial_position,
+	const Eigen::Quaternionf &initial_orientation,
+	const bool bUseCompoundFilter)
+{
+	IPoseFilter *pose_filter = nullptr;
 
 	if (bUseCompoundFilter)
 	{
 		CompoundPoseFilter *compoundFilter = new CompoundPoseFilter();
 		compoundFilter->init(
-			CommonDeviceState::PSDualShock4,
+			controller_type,
 			OrientationFilterTypeKalman, PositionFilterTypeKalman,
 			constants,
 			initial_position, initial_orientation);
 
-		*out_pose_filter = compoundFilter;
+		pose_filter = compoundFilter;
 	}
 	else
 	{
 		KalmanPoseFilterPSMove *fullPoseFilter = new KalmanPoseFilterPSMove();
 		fullPoseFilter->init(constants, initial_position, initial_orientation);
 
-		*out_pose_filter = fullPoseFilter;
+		pose_filter = fullPoseFilter;
+	}
+
+	return pose_filter;
+}
+
+static PoseSensorPacket
+make_sensor_packet(const ControllerSample &sample)
+{
+	PoseSensorPacket sensorPacket;
+	sensorPacket.clear();
+
+	sensorPacket.imu_accelerometer_g_units = Eigen::Vector3f(sample.acc[0], sample.acc[1], sample.acc[2]);
+	sensorPacket.imu_gyroscope_rad_per_sec = Eigen::Vector3f(sample.gyro[0], sample.gyro[1], sample.gyro[2]);
+	sensorPacket.imu_magnetometer_unit = Eigen::Vector3f(sample.mag[0], sample.mag[1], sample.mag[2]);
+	sensorPacket.has_accelerometer_measurement = true;
+	sensorPacket.has_gyroscope_measurement = true;
+	sensorPacket.has_magnetometer_measurement = !sensorPacket.imu_magnetometer_unit.isZero(); // zeroed out on the DS4
+	sensorPacket.optical_orientation = Eigen::Quaternionf(sample.ori[0], sample.ori[1], sample.ori[2], sample.ori[3]);
+	sensorPacket.tracking_projection_area_px_sqr = sample.area;
+	sensorPacket.optical_position_cm = Eigen::Vector3f(sample.pos[0], sample.pos[1], sample.pos[2]);
+
+	return sensorPacket;
+}
+
+// Converts a whole recording to sensor packets up front
+static void
+make_sensor_packets(
+	const ControllerInputStream &stationary_stream,
+	const ControllerInputStream &movement_stream,
+	std::vector<PoseSensorPacket, Eigen::aligned_allocator<PoseSensorPacket> > &out_sensor_packets,
+	std::vector<float> &out_time_deltas)
+{
+	const size_t sample_count = movement_stream.getSampleCount();
+	float lastTime = movement_stream.getSample(0).time - stationary_stream.computeMeanTimeDelta();
+
+	out_sensor_packets.resize(sample_count);
+	out_time_deltas.resize(sample_count);
+	for (size_t sample_index = 0; sample_index < sample_count; ++sample_index)
+	{
+		const ControllerSample &sample = movement_stream.getSample(sample_index);
+
+		out_sensor_packets[sample_index] = make_sensor_packet(sample);
+		out_time_deltas[sample_index] = sample.time - lastTime;
+		lastTime = sample.time;
+	}
+}
+
+// -- filter tuning -----
+static void
+apply_tuning_configuration(
+	const PoseFilterConstants &base_constants,
+	const FilterTuningConfiguration &config,
+	PoseFilterConstants &out_constants)
+{
+	out_constants = base_constants;
+
+	OrientationFilterConstants &orientation_constants = out_constants.orientation_constants;
+	PositionFilterConstants &position_constants = out_constants.position_constants;
+
+	orientation_constants.accelerometer_variance *= config.scale[TUNE_ACCELEROMETER_VARIANCE];
+	position_constants.accelerometer_variance *= config.scale[TUNE_ACCELEROMETER_VARIANCE];
+	position_constants.accelerometer_noise_radius *= config.scale[TUNE_ACCELEROMETER_NOISE_RADIUS];
+	orientation_constants.gyro_variance *= config.scale[TUNE_GYRO_VARIANCE];
+	orientation_constants.magnetometer_variance *= config.scale[TUNE_MAGNETOMETER_VARIANCE];
+	orientation_constants.position_variance_curve.A *= config.scale[TUNE_POSITION_VARIANCE];
+	position_constants.position_variance_curve.A *= config.scale[TUNE_POSITION_VARIANCE];
+	orientation_constants.orientation_variance_curve.A *= config.scale[TUNE_ORIENTATION_VARIANCE];
+	orientation_constants.orientation_variance_curve.MaxValue *= config.scale[TUNE_ORIENTATION_VARIANCE];
+}
+
+// Runs one initialized filter over the whole movement recording.
+// The sensor packets, time deltas and workspace vectors are shared between configurations
+// so the only per configuration cost is the filter itself.
+static void
+evaluate_tuning_configuration(
+	IPoseFilter *pose_filter,
+	const PoseFilterSpace &pose_filter_space,
+	const PoseFilterConstants &constants,
+	const ControllerInputStream &movement_stream,
+	const std::vector<PoseSensorPacket, Eigen::aligned_allocator<PoseSensorPacket> > &sensor_packets,
+	const std::vector<float> &time_deltas,
+	std::vector<Eigen::Vector3f> &filtered_positions,
+	std::vector<Eigen::Quaternionf, Eigen::aligned_allocator<Eigen::Quaternionf> > &filtered_orientations,
+	FilterTuningResult &out_result)
+{
+	const size_t sample_count = sensor_packets.size();
+	std::chrono::high_resolution_clock::duration total_update_time = std::chrono::high_resolution_clock::duration::zero();
+
+	bool bValid = true;
+	for (size_t sample_index = 0; sample_index < sample_count; ++sample_index)
+	{
+		PoseFilterPacket filterPacket;
+		pose_filter_space.createFilterPacket(sensor_packets[sample_index], pose_filter, filterPacket);
+
+		const std::chrono::high_resolution_clock::time_point update_start = std::chrono::high_resolution_clock::now();
+		pose_filter->update(time_deltas[sample_index], filterPacket);
+		total_update_time += std::chrono::high_resolution_clock::now() - update_start;
+
+		filtered_positions[sample_index] = pose_filter->getPositionCm();
+		filtered_orientations[sample_index] = pose_filter->getOrientation();
+
+		if (!eigen_vector3f_is_valid(filtered_positions[sample_index]) ||
+			!eigen_quaternion_is_valid(filtered_orientations[sample_index]))
+		{
+			bValid = false;
+			break;
+		}
+	}
+
+	memset(&out_result, 0, sizeof(FilterTuningResult));
+	out_result.bValid = bValid;
+	out_result.update_time_us =
+		static_cast<float>(std::chrono::duration<double, std::micro>(total_update_time).count() / static_cast<double>(sample_count));
+	if (!bValid)
+	{
+		return;
+	}
+
+	double position_jitter_sum = 0.0;
+	double orientation_jitter_sum = 0.0;
+	double position_error_sum = 0.0;
+	double orientation_error_sum = 0.0;
+
+	for (size_t sample_index = 0; sample_index < sample_count; ++sample_index)
+	{
+		const ControllerSample &sample = movement_stream.getSample(sample_index);
+		const Eigen::Vector3f recorded_position(sample.pos[0], sample.pos[1], sample.pos[2]);
+		const Eigen::Quaternionf recorded_orientation(sample.ori[0], sample.ori[1], sample.ori[2], sample.ori[3]);
+
+		position_error_sum += (filtered_positions[sample_index] - recorded_position).squaredNorm();
+
+		const float angle_error =
+			eigen_quaternion_unsigned_angle_between(filtered_orientations[sample_index], recorded_orientation);
+		orientation_error_sum += angle_error*angle_error;
+
+		if (sample_index >= 2)
+		{
+			const Eigen::Vector3f &p0 = filtered_positions[sample_index - 2];
+			const Eigen::Vector3f &p1 = filtered_positions[sample_index - 1];
+			const Eigen::Vector3f &p2 = filtered_positions[sample_index];
+
+			position_jitter_sum += (p2 - 2.f*p1 + p0).squaredNorm();
+
+			// Change in the per sample rotation, which is zero for any constant angular velocity
+			const Eigen::Quaternionf &q0 = filtered_orientations[sample_index - 2];
+			const Eigen::Quaternionf &q1 = filtered_orientations[sample_index - 1];
+			const Eigen::Quaternionf &q2 = filtered_orientations[sample_index];
+			const Eigen::Quaternionf step_a = q1 * q0.conjugate();
+			const Eigen::Quaternionf step_b = q2 * q1.conjugate();
+			const float angle_jitter = eigen_quaternion_unsigned_angle_between(step_a, step_b);
+
+			orientation_jitter_sum += angle_jitter*angle_jitter;
+		}
+	}
+
+	// Latency: how many samples the recorded positions need to be delayed by to best match the filter
+	int best_shift = 0;
+	double best_shift_error = position_error_sum;
+	for (int shift = 1; shift <= k_tuning_max_latency_samples && static_cast<size_t>(shift) < sample_count; ++shift)
+	{
+		double shift_error = 0.0;
+
+		for (size_t sample_index = shift; sample_index < sample_count; ++sample_index)
+		{
+			const ControllerSample &sample = movement_stream.getSample(sample_index - shift);
+			const Eigen::Vector3f recorded_position(sample.pos[0], sample.pos[1], sample.pos[2]);
+
+			shift_error += (filtered_positions[sample_index] - recorded_position).squaredNorm();
+		}
+		shift_error *= static_cast<double>(sample_count) / static_cast<double>(sample_count - shift);
+
+		if (shift_error < best_shift_error)
+		{
+			best_shift_error = shift_error;
+			best_shift = shift;
+		}
+	}
+
+	const double inv_sample_count = 1.0 / static_cast<double>(sample_count);
+	const double inv_jitter_count = (sample_count > 2) ? 1.0 / static_cast<double>(sample_count - 2) : 0.0;
+
+	out_result.position_jitter_cm = static_cast<float>(sqrt(position_jitter_sum * inv_jitter_count));
+	out_result.orientation_jitter_deg = static_cast<float>(sqrt(orientation_jitter_sum * inv_jitter_count) * k_radians_to_degreees);
+	out_result.position_error_cm = static_cast<float>(sqrt(position_error_sum * inv_sample_count));
+	out_result.orientation_error_deg = static_cast<float>(sqrt(orientation_error_sum * inv_sample_count) * k_radians_to_degreees);
+	out_result.position_latency_sec = static_cast<float>(best_shift) * constants.position_constants.mean_update_time_delta;
+}
+
+// Each metric is normalized by the untuned configuration,
+// so the untuned constants score 1 and lower is better.
+static float
+compute_tuning_score(
+	const FilterTuningResult &result,
+	const FilterTuningResult &baseline,
+	const float jitter_weight)
+{
+	float jitter_score = 0.f;
+	jitter_score += safe_divide_with_default(result.position_jitter_cm, baseline.position_jitter_cm, 0.f);
+	jitter_score += safe_divide_with_default(result.orientation_jitter_deg, baseline.orientation_jitter_deg, 0.f);
+
+	float error_score = 0.f;
+	error_score += safe_divide_with_default(result.position_error_cm, baseline.position_error_cm, 0.f);
+	error_score += safe_divide_with_default(result.orientation_error_deg, baseline.orientation_error_deg, 0.f);
+
+	return 0.5f*(jitter_weight*jitter_score + (1.f - jitter_weight)*error_score);
+}
+
+static void
+write_tuned_constants(
+	const char *filename,
+	const CommonDeviceState::eDeviceType controller_type,
+	const PoseFilterConstants &constants)
+{
+	FILE *fp = fopen(filename, "wt");
+
+	if (fp == nullptr)
+	{
+		printf("Failed to open %s for writing\n", filename);
+		return;
+	}
+
+	// Same keys as the calibration section of the controller config,
+	// the config stores one variance for all three axes.
+	const OrientationFilterConstants &orientation_constants = constants.orientation_constants;
+	const PositionFilterConstants &position_constants = constants.position_constants;
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "    \"Calibration\": {\n");
+	fprintf(fp, "        \"Accel\": {\n");
+	fprintf(fp, "            \"Variance\": \"%g\",\n", position_constants.accelerometer_variance.mean());
+	fprintf(fp, "            \"NoiseRadius\": \"%g\"\n", position_constants.accelerometer_noise_radius);
+	fprintf(fp, "        },\n");
+	fprintf(fp, "        \"Gyro\": {\n");
+	fprintf(fp, "            \"Variance\": \"%g\"\n", orientation_constants.gyro_variance.mean());
+	fprintf(fp, "        },\n");
+	if (controller_type == CommonDeviceState::PSMove)
+	{
+		fprintf(fp, "        \"Magnetometer\": {\n");
+		fprintf(fp, "            \"Variance\": \"%g\"\n", orientation_constants.magnetometer_variance.mean());
+		fprintf(fp, "        },\n");
+	}
+	fprintf(fp, "        \"Position\": {\n");
+	fprintf(fp, "            \"VarianceExpFitA\": \"%g\",\n", position_constants.position_variance_curve.A);
+	fprintf(fp, "            \"VarianceExpFitB\": \"%g\"\n", position_constants.position_variance_curve.B);
+	if (controller_type == CommonDeviceState::PSDualShock4)
+	{
+		fprintf(fp, "        },\n");
+		fprintf(fp, "        \"Orientation\": {\n");
+		fprintf(fp, "            \"VarianceExpFitA\": \"%g\",\n", orientation_constants.orientation_variance_curve.A);
+		fprintf(fp, "            \"VarianceExpFitB\": \"%g\"\n", orientation_constants.orientation_variance_curve.B);
+	}
+	fprintf(fp, "        }\n");
+	fprintf(fp, "    }\n");
+	fprintf(fp, "}\n");
+
+	fclose(fp);
+}
+
+// Random search over the noise constants, scored on filter jitter versus how closely
+// (and how promptly) the filter follows the recorded poses.
+// Configurations are spread over all cores, each worker thread owns its filter and workspace.
+static bool
+tune_filter(int argc, char *argv[])
+{
+	if (argc < 5)
+	{
+		printf("usage test_kalman_filter --tune <stationary_file.csv> <movement_file.csv> <output_constants.json>\n");
+		printf("          [--configurations N] [--threads T] [--jitter-weight W] [--seed S]\n");
+		return false;
+	}
+
+	int configuration_count = k_default_tuning_configuration_count;
+	int thread_count = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u));
+	float jitter_weight = k_default_tuning_jitter_weight;
+	unsigned int seed = 0;
+
+	for (int arg_index = 5; arg_index < argc; ++arg_index)
+	{
+		if (strcmp(argv[arg_index], "--configurations") == 0 && arg_index + 1 < argc)
+		{
+			configuration_count = std::max(atoi(argv[++arg_index]), 1);
+		}
+		else if (strcmp(argv[arg_index], "--threads") == 0 && arg_index + 1 < argc)
+		{
+			thread_count = std::max(atoi(argv[++arg_index]), 1);
+		}
+		else if (strcmp(argv[arg_index], "--jitter-weight") == 0 && arg_index + 1 < argc)
+		{
+			jitter_weight = clampf01(static_cast<float>(atof(argv[++arg_index])));
+		}
+		else if (strcmp(argv[arg_index], "--seed") == 0 && arg_index + 1 < argc)
+		{
+			seed = static_cast<unsigned int>(atoi(argv[++arg_index]));
+		}
+		else
+		{
+			printf("Unknown tuning argument: %s\n", argv[arg_index]);
+			return false;
+		}
+	}
+
+	ControllerInputStream stationary_stream(argv[2]);
+	if (stationary_stream.getSampleCount() <= 1)
+	{
+		printf("Stationary file: %s, doesn't contain more than one sample\n", argv[2]);
+		return false;
+	}
+
+	ControllerInputStream movement_stream(argv[3]);
+	if (movement_stream.getSampleCount() <= 2)
+	{
+		printf("Movement file: %s, doesn't contain more than two samples\n", argv[3]);
+		return false;
+	}
+
+	const CommonDeviceState::eDeviceType controller_type = movement_stream.getControllerType();
+	PoseFilterSpace pose_filter_space;
+	PoseFilterConstants base_constants;
+	if (!init_filter_space_and_constants(stationary_stream, pose_filter_space, base_constants))
+	{
+		printf("Unsupported controller type\n");
+		return false;
+	}
+
+	// Convert the recording to sensor packets once up front
+	const size_t sample_count = movement_stream.getSampleCount();
+	std::vector<PoseSensorPacket, Eigen::aligned_allocator<PoseSensorPacket> > sensor_packets;
+	std::vector<float> time_deltas;
+	make_sensor_packets(stationary_stream, movement_stream, sensor_packets, time_deltas);
+
+	const ControllerSample &initialSample = movement_stream.getSample(0);
+	const Eigen::Vector3f initial_pos(initialSample.pos[0], initialSample.pos[1], initialSample.pos[2]);
+	const Eigen::Quaternionf initial_ori(initialSample.ori[0], initialSample.ori[1], initialSample.ori[2], initialSample.ori[3]);
+	const float recording_duration = movement_stream.getSample(sample_count - 1).time - movement_stream.getSample(0).time;
+
+	// Configuration 0 is the untuned constants
+	std::vector<FilterTuningConfiguration> configurations(configuration_count);
+	for (int config_index = 0; config_index < configuration_count; ++config_index)
+	{
+		std::mt19937 generator(seed + static_cast<unsigned int>(config_index));
+		std::uniform_real_distribution<float> log_scale(-logf(k_tuning_max_scale), logf(k_tuning_max_scale));
+		FilterTuningConfiguration &config = configurations[config_index];
+
+		for (int param_index = 0; param_index < TUNE_PARAMETER_COUNT; ++param_index)
+		{
+			config.scale[param_index] = (config_index > 0) ? expf(log_scale(generator)) : 1.f;
+		}
+	}
+
+	std::vector<FilterTuningResult> results(configuration_count);
+	std::atomic<int> next_config_index(0);
+	auto tuning_worker = [&]()
+	{
+		std::vector<Eigen::Vector3f> filtered_positions(sample_count);
+		std::vector<Eigen::Quaternionf, Eigen::aligned_allocator<Eigen::Quaternionf> > filtered_orientations(sample_count);
+		PoseFilterConstants constants;
+
+		for (int config_index = next_config_index++; config_index < configuration_count; config_index = next_config_index++)
+		{
+			apply_tuning_configuration(base_constants, configurations[config_index], constants);
+
+			IPoseFilter *pose_filter = create_pose_filter(controller_type, constants, initial_pos, initial_ori, true);
+			evaluate_tuning_configuration(
+				pose_filter, pose_filter_space, constants,
+				movement_stream, sensor_packets, time_deltas,
+				filtered_positions, filtered_orientations,
+				results[config_index]);
+			delete pose_filter;
+		}
+	};
+
+	const std::chrono::high_resolution_clock::time_point tuning_start = std::chrono::high_resolution_clock::now();
+	std::vector<std::thread> workers;
+	for (int thread_index = 0; thread_index < thread_count; ++thread_index)
+	{
+		workers.push_back(std::thread(tuning_worker));
+	}
+	for (std::thread &worker : workers)
+	{
+		worker.join();
+	}
+	const double tuning_seconds =
+		std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - tuning_start).count();
+
+	const FilterTuningResult &baseline = results[0];
+	if (!baseline.bValid)
+	{
+		printf("The untuned constants diverge on this recording\n");
+		return false;
+	}
+
+	int best_config_index = 0;
+	for (int config_index = 0; config_index < configuration_count; ++config_index)
+	{
+		FilterTuningResult &result = results[config_index];
+
+		if (result.bValid)
+		{
+			result.score = compute_tuning_score(result, baseline, jitter_weight);
+
+			if (result.score < results[best_config_index].score)
+			{
+				best_config_index = config_index;
+			}
+		}
+	}
+
+	printf("Tuned %d configurations over %.1fs of recording on %d threads in %.2fs (%.0fx real time)\n",
+		configuration_count, recording_duration, thread_count, tuning_seconds,
+		safe_divide_with_default(static_cast<double>(recording_duration)*configuration_count, tuning_seconds, 0.0));
+	printf("%10s %10s %10s %10s %10s %10s %8s\n", "", "pos_jit", "ori_jit", "pos_err", "ori_err", "latency", "score");
+	const int printed_indices[2] = { 0, best_config_index };
+	const char *printed_names[2] = { "untuned", "best" };
+	for (int print_index = 0; print_index < 2; ++print_index)
+	{
+		const FilterTuningResult &result = results[printed_indices[print_index]];
+
+		printf("%10s %8.3fcm %7.3fdeg %8.3fcm %7.3fdeg %8.1fms %8.3f\n",
+			printed_names[print_index],
+			result.position_jitter_cm, result.orientation_jitter_deg,
+			result.position_error_cm, result.orientation_error_deg,
+			result.position_latency_sec * 1000.f, result.score);
+	}
+	for (int param_index = 0; param_index < TUNE_PARAMETER_COUNT; ++param_index)
+	{
+		printf("  %s x%.3f\n", szTuningParameterNames[param_index], configurations[best_config_index].scale[param_index]);
+	}
+
+	PoseFilterConstants best_constants;
+	apply_tuning_configuration(base_constants, configurations[best_config_index], best_constants);
+	write_tuned_constants(argv[4], controller_type, best_constants);
+
+	return true;
+}
+
+// -- error-state filter benchmark -----
+enum eBenchmarkPoseFilter
+{
+	BENCHMARK_POSE_FILTER_UKF,
+	BENCHMARK_POSE_FILTER_UKF_FLOAT,
+	BENCHMARK_POSE_FILTER_ESKF,
+
+	BENCHMARK_POSE_FILTER_COUNT
+};
+
+static const char *szBenchmarkPoseFilterNames[BENCHMARK_POSE_FILTER_COUNT] = {
+	"SR-UKF",
+	"SR-UKF(f)",
+	"ESKF"
+};
+
+template <class t_psmove_filter, class t_ds4_filter>
+static IPoseFilter *
+create_full_pose_filter(
+	const CommonDeviceState::eDeviceType controller_type,
+	const PoseFilterConstants &constants,
+	const Eigen::Vector3f &initial_position,
+	const Eigen::Quaternionf &initial_orientation)
+{
+	IPoseFilter *pose_filter = nullptr;
+
+	if (controller_type == CommonDeviceState::PSDualShock4)
+	{
+		t_ds4_filter *ds4Filter = new t_ds4_filter();
+		ds4Filter->init(constants, initial_position, initial_orientation);
+
+		pose_filter = ds4Filter;
+	}
+	else
+	{
+		t_psmove_filter *psmoveFilter = new t_psmove_filter();
+		psmoveFilter->init(constants, initial_position, initial_orientation);
+
+		pose_filter = psmoveFilter;
+	}
+
+	return pose_filter;
+}
+
+// Runs the SR-UKF pose filter (double and float) and the error-state EKF over the same recording
+// and compares what an update costs with how closely each filter follows the recorded pose.
+static bool
+benchmark_error_state_filter(int argc, char *argv[])
+{
+	if (argc < 4)
+	{
+		printf("usage test_kalman_filter --benchmark-eskf <stationary_file.csv> <movement_file.csv>\n");
+		return false;
+	}
+
+	ControllerInputStream stationary_stream(argv[2]);
+	if (stationary_stream.getSampleCount() <= 1)
+	{
+		printf("Stationary file: %s, doesn't contain more than one sample\n", argv[2]);
+		return false;
+	}
+
+	ControllerInputStream movement_stream(argv[3]);
+	if (movement_stream.getSampleCount() <= 2)
+	{
+		printf("Movement file: %s, doesn't contain more than two samples\n", argv[3]);
+		return false;
+	}
+
+	const CommonDeviceState::eDeviceType controller_type = movement_stream.getControllerType();
+	PoseFilterSpace pose_filter_space;
+	PoseFilterConstants constants;
+	if (!init_filter_space_and_constants(stationary_stream, pose_filter_space, constants))
+	{
+		printf("Unsupported controller type\n");
+		return false;
+	}
+
+	const size_t sample_count = movement_stream.getSampleCount();
+	std::vector<PoseSensorPacket, Eigen::aligned_allocator<PoseSensorPacket> > sensor_packets;
+	std::vector<float> time_deltas;
+	make_sensor_packets(stationary_stream, movement_stream, sensor_packets, time_deltas);
+
+	const ControllerSample &initialSample = movement_stream.getSample(0);
+	const Eigen::Vector3f initial_pos(initialSample.pos[0], initialSample.pos[1], initialSample.pos[2]);
+	const Eigen::Quaternionf initial_ori(initialSample.ori[0], initialSample.ori[1], initialSample.ori[2], initialSample.ori[3]);
+
+	std::vector<Eigen::Vector3f> filtered_positions(sample_count);
+	std::vector<Eigen::Quaternionf, Eigen::aligned_allocator<Eigen::Quaternionf> > filtered_orientations(sample_count);
+	FilterTuningResult results[BENCHMARK_POSE_FILTER_COUNT];
+
+	for (int filter_index = 0; filter_index < BENCHMARK_POSE_FILTER_COUNT; ++filter_index)
+	{
+		IPoseFilter *pose_filter = nullptr;
+
+		switch (filter_index)
+		{
+		case BENCHMARK_POSE_FILTER_UKF:
+			pose_filter =
+				create_full_pose_filter<KalmanPoseFilterPSMove, KalmanPoseFilterDS4>(
+					controller_type, constants, initial_pos, initial_ori);
+			break;
+		case BENCHMARK_POSE_FILTER_UKF_FLOAT:
+			pose_filter =
+				create_full_pose_filter<KalmanPoseFilterPSMovef, KalmanPoseFilterDS4f>(
+					controller_type, constants, initial_pos, initial_ori);
+			break;
+		case BENCHMARK_POSE_FILTER_ESKF:
+			pose_filter =
+				create_full_pose_filter<ErrorStateKalmanPoseFilterPSMove, ErrorStateKalmanPoseFilterDS4>(
+					controller_type, constants, initial_pos, initial_ori);
+			break;
+		}
+
+		evaluate_tuning_configuration(
+			pose_filter, pose_filter_space, constants,
+			movement_stream, sensor_packets, time_deltas,
+			filtered_positions, filtered_orientations,
+			results[filter_index]);
+		delete pose_filter;
+	}
+
+	printf("%d samples\n", static_cast<int>(sample_count));
+	printf("%10s %12s %10s %10s %10s %10s %10s\n", "", "update", "pos_jit", "ori_jit", "pos_err", "ori_err", "latency");
+	for (int filter_index = 0; filter_index < BENCHMARK_POSE_FILTER_COUNT; ++filter_index)
+	{
+		const FilterTuningResult &result = results[filter_index];
+
+		if (result.bValid)
+		{
+			printf("%10s %10.2fus %8.3fcm %7.3fdeg %8.3fcm %7.3fdeg %8.1fms\n",
+				szBenchmarkPoseFilterNames[filter_index],
+				result.update_time_us,
+				result.position_jitter_cm, result.orientation_jitter_deg,
+				result.position_error_cm, result.orientation_error_deg,
+				result.position_latency_sec * 1000.f);
+		}
+		else
+		{
+			printf("%10s diverged\n", szBenchmarkPoseFilterNames[filter_index]);
+		}
+	}
+
+	const FilterTuningResult &ukf_result = results[BENCHMARK_POSE_FILTER_UKF];
+	const FilterTuningResult &eskf_result = results[BENCHMARK_POSE_FILTER_ESKF];
+	if (ukf_result.bValid && eskf_result.bValid)
+	{
+		printf("ESKF update costs %.1fx less than the SR-UKF\n",
+			safe_divide_with_default(ukf_result.update_time_us, eskf_result.update_time_us, 0.f));
+	}
+
+	return eskf_result.bValid;
+}
+
+// -- pose filter microbenchmark -----
+enum eFilterBenchmarkKind
+{
+	FILTER_BENCHMARK_UKF,
+	FILTER_BENCHMARK_UKF_FLOAT,
+	FILTER_BENCHMARK_UKF_POINT_CLOUD,
+	FILTER_BENCHMARK_ESKF,
+	FILTER_BENCHMARK_COMPOUND
+};
+
+struct FilterBenchmarkEntry
+{
+	const char *name;
+	CommonDeviceState::eDeviceType device_type;
+	eFilterBenchmarkKind kind;
+
+	// Compound filter only
+	OrientationFilterType orientation_filter_type;
+	PositionFilterType position_filter_type;
+};
+
+// The filters pose_filter_factory() hands out, for the device types that can use them
+static const FilterBenchmarkEntry k_filter_benchmark_entries[] = {
+	{"PSMove SR-UKF", CommonDeviceState::PSMove, FILTER_BENCHMARK_UKF, OrientationFilterTypeNone, PositionFilterTypeNone},
+	{"PSMove SR-UKF(f)", CommonDeviceState::PSMove, FILTER_BENCHMARK_UKF_FLOAT, OrientationFilterTypeNone, PositionFilterTypeNone},
+	{"PSMove ESKF", CommonDeviceState::PSMove, FILTER_BENCHMARK_ESKF, OrientationFilterTypeNone, PositionFilterTypeNone},
+	{"PSMove Kalman/Kalman", CommonDeviceState::PSMove, FILTER_BENCHMARK_COMPOUND, OrientationFilterTypeKalman, PositionFilterTypeKalman},
+	{"PSMove MARG/LowPassExp", CommonDeviceState::PSMove, FILTER_BENCHMARK_COMPOUND, OrientationFilterTypeComplementaryMARG, PositionFilterTypeLowPassExponential},
+	{"PSMove MARG/OneEuro", CommonDeviceState::PSMove, FILTER_BENCHMARK_COMPOUND, OrientationFilterTypeComplementaryMARG, PositionFilterTypeOneEuro},
+	{"PSMove Madgwick/CompIMU", CommonDeviceState::PSMove, FILTER_BENCHMARK_COMPOUND, OrientationFilterTypeMadgwickMARG, PositionFilterTypeComplimentaryOpticalIMU},
+	{"DS4 SR-UKF", CommonDeviceState::PSDualShock4, FILTER_BENCHMARK_UKF, OrientationFilterTypeNone, PositionFilterTypeNone},
+	{"DS4 SR-UKF(f)", CommonDeviceState::PSDualShock4, FILTER_BENCHMARK_UKF_FLOAT, OrientationFilterTypeNone, PositionFilterTypeNone},
+	{"DS4 ESKF", CommonDeviceState::PSDualShock4, FILTER_BENCHMARK_ESKF, OrientationFilterTypeNone, PositionFilterTypeNone},
+	{"DS4 Kalman/Kalman", CommonDeviceState::PSDualShock4, FILTER_BENCHMARK_COMPOUND, OrientationFilterTypeKalman, PositionFilterTypeKalman},
+	{"DS4 OpticalARG/LowPass", CommonDeviceState::PSDualShock4, FILTER_BENCHMARK_COMPOUND, OrientationFilterTypeComplementaryOpticalARG, PositionFilterTypeLowPassOptical},
+	{"Morpheus SR-UKF", CommonDeviceState::Morpheus, FILTER_BENCHMARK_UKF, OrientationFilterTypeNone, PositionFilterTypeNone},
+	{"Morpheus SR-UKF(f)", CommonDeviceState::Morpheus, FILTER_BENCHMARK_UKF_FLOAT, OrientationFilterTypeNone, PositionFilterTypeNone},
+	{"PointCloud SR-UKF", CommonDeviceState::Morpheus, FILTER_BENCHMARK_UKF_POINT_CLOUD, OrientationFilterTypeNone, PositionFilterTypeNone}
+};
+static const int k_filter_benchmark_entry_count = sizeof(k_filter_benchmark_entries) / sizeof(k_filter_benchmark_entries[0]);
+
+template <class t_psmove_filter, class t_ds4_filter, class t_hmd_filter>
+static IPoseFilter *
+create_benchmark_pose_filter(
+	const CommonDeviceState::eDeviceType device_type,
+	const PoseFilterConstants &constants,
+	const Eigen::Vector3f &initial_position,
+	const Eigen::Quaternionf &initial_orientation)
+{
+	IPoseFilter *pose_filter = nullptr;
+
+	if (device_type == CommonDeviceState::Morpheus)
+	{
+		t_hmd_filter *hmdFilter = new t_hmd_filter();
+		hmdFilter->init(constants, initial_position, initial_orientation);
+
+		pose_filter = hmdFilter;
+	}
+	else
+	{
+		pose_filter =
+			create_full_pose_filter<t_psmove_filter, t_ds4_filter>(
+				device_type, constants, initial_position, initial_orientation);
+	}
+
+	return pose_filter;
+}
+
+static IPoseFilter *
+create_benchmark_pose_filter(
+	const FilterBenchmarkEntry &entry,
+	const PoseFilterConstants &constants)
+{
+	Eigen::Vector3f initial_position;
+	Eigen::Quaternionf initial_orientation;
+	filter_benchmark_get_pose(0.f, initial_position, initial_orientation);
+
+	IPoseFilter *pose_filter = nullptr;
+
+	switch (entry.kind)
+	{
+	case FILTER_BENCHMARK_UKF:
+		pose_filter =
+			create_benchmark_pose_filter<KalmanPoseFilterPSMove, KalmanPoseFilterDS4, KalmanPoseFilterMorpheus>(
+				entry.device_type, constants, initial_position, initial_orientation);
+		break;
+	case FILTER_BENCHMARK_UKF_FLOAT:
+		pose_filter =
+			create_benchmark_pose_filter<KalmanPoseFilterPSMovef, KalmanPoseFilterDS4f, KalmanPoseFilterMorpheusf>(
+				entry.device_type, constants, initial_position, initial_orientation);
+		break;
+	case FILTER_BENCHMARK_UKF_POINT_CLOUD:
+		{
+			KalmanPoseFilterPointCloud *pointCloudFilter = new KalmanPoseFilterPointCloud();
+			pointCloudFilter->init(constants, initial_position, initial_orientation);
+
+			pose_filter = pointCloudFilter;
+		} break;
+	case FILTER_BENCHMARK_ESKF:
+		pose_filter =
+			create_full_pose_filter<ErrorStateKalmanPoseFilterPSMove, ErrorStateKalmanPoseFilterDS4>(
+				entry.device_type, constants, initial_position, initial_orientation);
+		break;
+	case FILTER_BENCHMARK_COMPOUND:
+		{
+			CompoundPoseFilter *compoundFilter = new CompoundPoseFilter();
+			compoundFilter->init(
+				entry.device_type,
+				entry.orientation_filter_type, entry.position_filter_type,
+				constants,
+				initial_position, initial_orientation);
+
+			pose_filter = compoundFilter;
+		} break;
+	}
+
+	return pose_filter;
+}
+
+// Steps every pose filter over the same synthetic IMU + optical streams and reports
+// what an IMU update and an optical update cost, and how often an update allocates.
+// Fails if a filter blows up on the synthetic streams.
+static bool
+benchmark_pose_filters(int argc, char *argv[])
+{
+	int frame_count = 2000;
+
+	for (int arg_index = 2; arg_index < argc; ++arg_index)
+	{
+		if (strcmp(argv[arg_index], "--frames") == 0 && arg_index + 1 < argc)
+		{
+			frame_count = std::max(atoi(argv[++arg_index]), 1);
+		}
+		else
+		{
+			printf("Unknown benchmark argument: %s\n", argv[arg_index]);
+			return false;
+		}
+	}
+
+	printf("%d frames, %d IMU updates per frame\n", frame_count, k_filter_benchmark_imu_updates_per_frame);
+	printf("%24s %12s %12s %12s\n", "", "imu", "optical", "allocs");
+
+	bool bAllValid = true;
+	for (int entry_index = 0; entry_index < k_filter_benchmark_entry_count; ++entry_index)
+	{
+		const FilterBenchmarkEntry &entry = k_filter_benchmark_entries[entry_index];
+		const eCommonTrackingShapeType shape_type =
+			(entry.device_type == CommonDeviceState::PSMove) ? Sphere
+			: (entry.device_type == CommonDeviceState::PSDualShock4) ? LightBar
+			: PointCloud;
+
+		PoseFilterSpace pose_filter_space;
+		PoseFilterConstants constants;
+		filter_benchmark_init_constants(shape_type, pose_filter_space, constants);
+
+		IPoseFilter *pose_filter = create_benchmark_pose_filter(entry, constants);
+		const FilterBenchmarkResult result =
+			filter_benchmark_run(pose_filter, pose_filter_space, constants, shape_type != Sphere, frame_count);
+		delete pose_filter;
+
+		if (result.bValid)
+		{
+			printf("%24s %10.0fns %10.0fns %12.2f\n",
+				entry.name, result.imu_update_ns, result.optical_update_ns, result.allocations_per_update);
+		}
+		else
+		{
+			printf("%24s diverged\n", entry.name);
+			bAllValid = false;
+		}
+	}
+
+	return bAllValid;
+}
+
+// Times one tracking frame of a point cloud HMD (one IMU sample plus an optical update
+// from each tracker) against the budget the HMD gets per tracking frame.
+static bool
+benchmark_hmd_point_cloud_filter()
+{
+	const int k_tracker_count = 4;
+	const int k_frame_count = 2000;
+	const float k_frame_time_delta = 1.f / 60.f;
+	const long long k_frame_budget_us = 1000;
+
+	PoseFilterSpace pose_filter_space;
+	PoseFilterConstants constants;
+	filter_benchmark_init_constants(PointCloud, pose_filter_space, constants);
+
+	KalmanPoseFilterMorpheus pose_filter;
+	pose_filter.init(constants, Eigen::Vector3f(0.f, 0.f, 100.f), Eigen::Quaternionf::Identity());
+
+	std::chrono::high_resolution_clock::duration total_frame_time = std::chrono::high_resolution_clock::duration::zero();
+	std::chrono::high_resolution_clock::duration max_frame_time = std::chrono::high_resolution_clock::duration::zero();
+
+	for (int frame_index = 0; frame_index < k_frame_count; ++frame_index)
+	{
+		// Slow sway so the filter has something to track
+		const float t = static_cast<float>(frame_index) * k_frame_time_delta;
+		const float yaw = 0.5f * sinf(t);
+		const Eigen::Quaternionf orientation(Eigen::AngleAxisf(yaw, Eigen::Vector3f::UnitY()));
+		const Eigen::Vector3f position_cm(10.f * sinf(t), 0.f, 100.f + 5.f * cosf(t));
+
+		PoseSensorPacket imu_packet;
+		imu_packet.clear();
+		imu_packet.imu_accelerometer_g_units = Eigen::Vector3f(0.f, 1.f, 0.f);
+		imu_packet.imu_gyroscope_rad_per_sec = Eigen::Vector3f(0.f, 0.5f * cosf(t), 0.f);
+		imu_packet.has_accelerometer_measurement = true;
+		imu_packet.has_gyroscope_measurement = true;
+
+		PoseFilterPacket imu_filter_packet;
+		imu_filter_packet.clear();
+		pose_filter_space.createFilterPacket(imu_packet, &pose_filter, imu_filter_packet);
+
+		PoseFilterPacket optical_filter_packets[k_tracker_count];
+		for (int tracker_index = 0; tracker_index < k_tracker_count; ++tracker_index)
+		{
+			PoseSensorPacket optical_packet;
+			optical_packet.clear();
+			optical_packet.optical_position_cm = position_cm;
+			optical_packet.optical_orientation = orientation;
+			optical_packet.tracking_projection_area_px_sqr = 400.f + 50.f * static_cast<float>(tracker_index);
+
+			optical_filter_packets[tracker_index].clear();
+			pose_filter_space.createFilterPacket(optical_packet, &pose_filter, optical_filter_packets[tracker_index]);
+		}
+
+		const std::chrono::high_resolution_clock::time_point frame_start = std::chrono::high_resolution_clock::now();
+		pose_filter.update(k_frame_time_delta, imu_filter_packet);
+		for (int tracker_index = 0; tracker_index < k_tracker_count; ++tracker_index)
+		{
+			pose_filter.update(0.f, optical_filter_packets[tracker_index]);
+		}
+		const std::chrono::high_resolution_clock::duration frame_time = std::chrono::high_resolution_clock::now() - frame_start;
+
+		total_frame_time += frame_time;
+		max_frame_time = std::max(max_frame_time, frame_time);
+	}
+
+	const long long total_frame_us = std::chrono::duration_cast<std::chrono::microseconds>(total_frame_time).count();
+	const long long max_frame_us = std::chrono::duration_cast<std::chrono::microseconds>(max_frame_time).count();
+	const double mean_frame_us = static_cast<double>(total_frame_us) / static_cast<double>(k_frame_count);
+
+	printf("HMD point cloud filter: %d LEDs, %d trackers, %d frames\n",
+		constants.shape.shape.point_cloud.point_count, k_tracker_count, k_frame_count);
+	printf("  %.2f us mean, %lld us max per frame (budget %lld us)\n",
+		mean_frame_us, max_frame_us, k_frame_budget_us);
+
+	const bool bWithinBudget = mean_frame_us <= static_cast<double>(k_frame_budget_us);
+	if (!bWithinBudget)
+	{
+		printf("  Over budget!\n");
 	}
 
-	*out_pose_filter_space = pose_filter_space;
+	return bWithinBudget;
 }
@@ -0,0 +1,1296 @@
+// Soaks the service with virtual devices and streaming clients for hours,
+// measuring input-to-client pose latency, CPU use and memory growth as it goes.
+//
+// The service runs in-process with N virtual controllers and H virtual HMDs.
+// The input generator is a synthetic camera node: it sends the service one projection datagram
+// per camera frame (see CameraNodeLink.h), which shows up as a RemoteTracker that sees every device.
+// Every --step-ms the devices jump back and forth between two positions, and each simulated client
+// times how long it takes until the pose it gets streamed lands closer to the new position than the old one.
+// That covers the whole path: camera node link, multi-camera fusion, pose filter, data frame publishing,
+// the per connection send queue and the client's socket.
+//
+// Simulated clients connect over localhost exactly like PSMoveClient does and stream every device
+// with position data. They speak the wire protocol themselves since PSMoveClient only ever has
+// one connection per process (see benchmark_service_connections).
+//
+// Usage: test_latency_soak [--controllers N] [--hmds H] [--clients M] [--minutes T]
+//                          [--report-seconds R] [--step-ms S] [--max-memory-growth-mb G]
+//                          [--port P] [--camera-port C] [--config-dir <dir>]
+//
+// Prints one line of latency percentiles, CPU and memory stats every R seconds.
+// Fails if no latency got measured, or the resident memory grew more than G MB
+// between the first report and the last one.
+
+//-- includes -----
+#include "CameraNodeLink.h"
+#include "CompactDataFrame.h"
+#include "ControllerManager.h"
+#include "DeviceManager.h"
+#include "HMDManager.h"
+#include "MathUtility.h"
+#include "PackedMessage.h"
+#include "PSMoveConfig.h"
+#include "PSMoveProtocol.pb.h"
+#include "ServerControllerView.h"
+#include "ServerHMDView.h"
+#include "ServerLog.h"
+#include "ServerNetworkManager.h"
+#include "ServerRequestHandler.h"
+#include "ServerTrackerView.h"
+#include "ServerUtility.h"
+#include "USBDeviceManager.h"
+#include "VirtualController.h"
+#include "VirtualHMD.h"
+
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+//-- constants -----
+static const int k_connect_timeout_ms = 5000;
+// Long enough for the virtual devices to open and the remote camera to get enumerated
+static const int k_device_timeout_ms = 10000;
+// Steps taken before latency gets measured, the pose filters need a couple to settle
+static const int k_warmup_step_count = 4;
+
+// The synthetic camera: a PS3EyeTrackerConfig default camera looking down -Z
+static const float k_frame_width = 640.f;
+static const float k_frame_height = 480.f;
+static const float k_frame_rate = 60.f;
+static const float k_focal_length_px = 554.2563f;
+static const float k_bulb_radius_cm = 2.25f;
+// Where the devices sit in front of the camera, and how far they jump every step
+static const float k_device_distance_cm = 150.f;
+static const float k_device_spacing_cm = 20.f;
+static const float k_step_distance_cm = 10.f;
+
+//-- definitions -----
+namespace asio = boost::asio;
+using asio::ip::tcp;
+using asio::ip::udp;
+
+/// The service managers PSMoveService runs, minus the service entry point.
+/// Same as the connection benchmark's, plus the camera node link the input generator talks to.
+class SoakService
+{
+public:
+    SoakService()
+        : m_io_service()
+        , m_camera_node_link()
+        , m_usb_device_manager(nullptr)
+        , m_device_manager(nullptr)
+        , m_request_handler(nullptr)
+        , m_network_manager(nullptr)
+    {
+    }
+
+    ~SoakService()
+    {
+        shutdown();
+    }
+
+    bool startup()
+    {
+        // Every manager loads its config when constructed
+        m_usb_device_manager = new USBDeviceManager();
+        m_device_manager = new DeviceManager();
+        m_request_handler = new ServerRequestHandler(m_device_manager);
+        m_network_manager = new ServerNetworkManager();
+
+        return
+            m_camera_node_link.startup(&m_io_service, "") &&
+            m_usb_device_manager->startup() &&
+            m_device_manager->startup() &&
+            m_network_manager->startup(&m_io_service, m_request_handler) &&
+            m_request_handler->startup();
+    }
+
+    // The network manager's poll also hands the service the input generator's projection datagrams
+    void update()
+    {
+        m_request_handler->update();
+        m_usb_device_manager->update();
+        m_camera_node_link.update();
+
+        m_device_manager->update();
+        m_network_manager->update();
+    }
+
+    void shutdown()
+    {
+        if (m_request_handler != nullptr)
+        {
+            m_request_handler->shutdown();
+        }
+
+        if (m_network_manager != nullptr)
+        {
+            m_network_manager->shutdown();
+            delete m_network_manager;
+            m_network_manager = nullptr;
+        }
+
+        if (m_device_manager != nullptr)
+        {
+            m_device_manager->shutdown();
+            delete m_device_manager;
+            m_device_manager = nullptr;
+        }
+
+        m_camera_node_link.shutdown();
+
+        if (m_request_handler != nullptr)
+        {
+            delete m_request_handler;
+            m_request_handler = nullptr;
+        }
+
+        if (m_usb_device_manager != nullptr)
+        {
+            m_usb_device_manager->shutdown();
+            delete m_usb_device_manager;
+            m_usb_device_manager = nullptr;
+        }
+    }
+
+    inline DeviceManager *getDeviceManager() const { return m_device_manager; }
+    inline ServerNetworkManager *getNetworkManager() const { return m_network_manager; }
+
+private:
+    asio::io_service m_io_service;
+    CameraNodeLink m_camera_node_link;
+    USBDeviceManager *m_usb_device_manager;
+    DeviceManager *m_device_manager;
+    ServerRequestHandler *m_request_handler;
+    ServerNetworkManager *m_network_manager;
+};
+
+/// Where the input generator currently puts a device, and since when
+struct SyntheticStep
+{
+    int step_index;
+    std::chrono::steady_clock::time_point step_time;
+};
+
+/// Input generator: a camera node with one camera that sees every virtual device.
+/// The devices alternate between two positions, switching every step period.
+class SyntheticCameraNode
+{
+public:
+    SyntheticCameraNode(const int controller_count, const int hmd_count, const int step_period_ms)
+        : m_io_service()
+        , m_udp_socket(m_io_service)
+        , m_controller_count(controller_count)
+        , m_hmd_count(hmd_count)
+        , m_step_period(std::chrono::milliseconds(step_period_ms))
+        , m_frame_period(std::chrono::microseconds(static_cast<long long>(1000000.f / k_frame_rate)))
+        , m_frame_sequence_number(0)
+    {
+        m_step.step_index = -1;
+
+        memset(&m_camera_info, 0, sizeof(m_camera_info));
+        m_camera_info.frame_width = k_frame_width;
+        m_camera_info.frame_height = k_frame_height;
+        m_camera_info.frame_rate = k_frame_rate;
+        m_camera_info.focal_length_x = k_focal_length_px;
+        m_camera_info.focal_length_y = k_focal_length_px;
+        m_camera_info.principal_x = k_frame_width / 2.f;
+        m_camera_info.principal_y = k_frame_height / 2.f;
+        m_camera_info.hfov = 60.f;
+        m_camera_info.vfov = 45.f;
+        m_camera_info.z_near = 10.f;
+        m_camera_info.z_far = 200.f;
+    }
+
+    bool open(const int camera_port)
+    {
+        boost::system::error_code error;
+
+        m_host_endpoint = udp::endpoint(asio::ip::address_v4::loopback(), static_cast<unsigned short>(camera_port));
+        m_udp_socket.open(udp::v4(), error);
+
+        if (error)
+        {
+            printf("Failed to open the camera node socket: %s\n", error.message().c_str());
+        }
+
+        return !error;
+    }
+
+    // Sends a frame of projections when one is due
+    void update()
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        if (m_step.step_index == -1)
+        {
+            m_start_time = now;
+            m_next_frame_time = now;
+        }
+
+        if (now < m_next_frame_time)
+        {
+            return;
+        }
+        m_next_frame_time += m_frame_period;
+
+        // A step starts with the first frame that shows it, that is when the input happened
+        const int step_index = static_cast<int>((now - m_start_time) / m_step_period);
+        if (step_index != m_step.step_index)
+        {
+            m_step.step_index = step_index;
+            m_step.step_time = now;
+        }
+
+        m_projections.clear();
+        for (int controller_index = 0; controller_index < m_controller_count; ++controller_index)
+        {
+            add_projection(false, controller_index, controller_index);
+        }
+        for (int hmd_index = 0; hmd_index < m_hmd_count; ++hmd_index)
+        {
+            add_projection(true, hmd_index, m_controller_count + hmd_index);
+        }
+
+        send_projections();
+    }
+
+    // The device ids the service gave the virtual devices, in enumeration order
+    std::vector<int> controller_ids;
+    std::vector<int> hmd_ids;
+
+    inline const SyntheticStep &get_step() const { return m_step; }
+
+private:
+    void add_projection(const bool bIsHmd, const int device_index, const int slot_index)
+    {
+        const std::vector<int> &device_ids = bIsHmd ? hmd_ids : controller_ids;
+
+        if (device_index >= static_cast<int>(device_ids.size()))
+        {
+            return;
+        }
+
+        const int slot_count = m_controller_count + m_hmd_count;
+        const float step_offset_cm = (m_step.step_index % 2 == 0) ? 0.f : k_step_distance_cm;
+        const float x = (static_cast<float>(slot_index) - 0.5f*static_cast<float>(slot_count - 1))*k_device_spacing_cm + step_offset_cm;
+        const float y = 0.f;
+        const float z = k_device_distance_cm;
+        const float radius_px = k_focal_length_px*k_bulb_radius_cm / z;
+
+        CameraNodeProjection projection;
+        memset(&projection, 0, sizeof(projection));
+        projection.is_hmd = bIsHmd ? 1 : 0;
+        projection.device_id = static_cast<uint8_t>(device_ids[device_index]);
+
+        CameraNodePoseEstimate &pose_estimate = projection.pose_estimate;
+        pose_estimate.position_cm.set(x, y, z);
+        pose_estimate.orientation.w = 1.f;
+        pose_estimate.is_currently_tracking = 1;
+        pose_estimate.is_orientation_valid = 0;
+
+        CommonDeviceTrackingProjection &tracking_projection = pose_estimate.projection;
+        tracking_projection.shape_type = eCommonTrackingProjectionType::ProjectionType_Ellipse;
+        tracking_projection.shape.ellipse.center.set(
+            m_camera_info.principal_x + k_focal_length_px*x / z,
+            m_camera_info.principal_y - k_focal_length_px*y / z);
+        tracking_projection.shape.ellipse.half_x_extent = radius_px;
+        tracking_projection.shape.ellipse.half_y_extent = radius_px;
+        tracking_projection.screen_area = k_real_pi*radius_px*radius_px;
+        tracking_projection.fit_residual = 0.f;
+        tracking_projection.basic.center_of_mass = tracking_projection.shape.ellipse.center;
+        tracking_projection.basic.area = tracking_projection.screen_area;
+
+        m_projections.push_back(projection);
+    }
+
+    void send_projections()
+    {
+        const size_t projection_count = std::min(m_projections.size(), static_cast<size_t>(CAMERA_NODE_MAX_DATAGRAM_ENTRIES));
+        CameraNodeDatagramHeader header;
+
+        ++m_frame_sequence_number;
+        header.marker = CAMERA_NODE_DATAGRAM_MARKER;
+        header.version = CAMERA_NODE_DATAGRAM_VERSION;
+        header.datagram_type = static_cast<uint8_t>(CameraNodeDatagram_Projections);
+        header.node_tracker_id = 0;
+        header.entry_count = static_cast<uint16_t>(projection_count);
+        header.entry_size = static_cast<uint16_t>(sizeof(CameraNodeProjection));
+        header.frame_sequence_number = m_frame_sequence_number;
+        header.frame_age_us = 0;
+
+        const std::vector<asio::const_buffer> buffers = {
+            asio::buffer(&header, sizeof(header)),
+            asio::buffer(&m_camera_info, sizeof(m_camera_info)),
+            asio::buffer(m_projections.data(), projection_count*sizeof(CameraNodeProjection))
+        };
+
+        boost::system::error_code error;
+        m_udp_socket.send_to(buffers, m_host_endpoint, 0, error);
+    }
+
+    asio::io_service m_io_service;
+    udp::socket m_udp_socket;
+    udp::endpoint m_host_endpoint;
+    const int m_controller_count;
+    const int m_hmd_count;
+    const std::chrono::steady_clock::duration m_step_period;
+    const std::chrono::steady_clock::duration m_frame_period;
+    std::chrono::steady_clock::time_point m_start_time;
+    std::chrono::steady_clock::time_point m_next_frame_time;
+    CameraNodeCameraInfo m_camera_info;
+    std::vector<CameraNodeProjection> m_projections;
+    long long m_frame_sequence_number;
+    SyntheticStep m_step;
+};
+
+/// What a client has seen of one device's steps
+struct DeviceLatencyState
+{
+    int step_index;
+    bool bStepArrived;
+    bool bHasPosition;
+    float position[3];
+    // Where the device settled at the end of the last step to each of the two positions
+    bool bHasSettledPosition[2];
+    float settled_position[2][3];
+
+    void clear()
+    {
+        memset(this, 0, sizeof(DeviceLatencyState));
+        step_index = -1;
+    }
+};
+
+/// Latencies and misses gathered since the last report
+struct LatencyStats
+{
+    std::vector<double> latencies_ms;
+    int missed_step_count;
+
+    void clear()
+    {
+        latencies_ms.clear();
+        missed_step_count = 0;
+    }
+};
+
+/// One simulated PSMoveClient connection streaming every virtual device.
+/// Uses its own io_service, the sockets are only ever used synchronously.
+class SoakClient
+{
+public:
+    SoakClient()
+        : m_io_service()
+        , m_tcp_socket(m_io_service)
+        , m_udp_socket(m_io_service)
+        , m_connection_id(-1)
+        , m_bUdpBound(false)
+        , m_next_request_id(0)
+        , m_packed_data_frame(DeviceOutputDataFramePtr(new PSMoveProtocol::DeviceOutputDataFrame))
+    {
+    }
+
+    ~SoakClient()
+    {
+        boost::system::error_code error;
+
+        m_tcp_socket.close(error);
+        m_udp_socket.close(error);
+    }
+
+    bool start_connect(const int port)
+    {
+        boost::system::error_code error;
+
+        m_tcp_socket.connect(tcp::endpoint(asio::ip::address_v4::loopback(), static_cast<unsigned short>(port)), error);
+        if (!error)
+        {
+            m_tcp_socket.non_blocking(true, error);
+        }
+
+        return !error;
+    }
+
+    // Returns true once the connection info arrived and the UDP endpoint got bound.
+    // Needs to be called between service updates until it succeeds.
+    bool poll_connect(const int port)
+    {
+        if (m_connection_id == -1)
+        {
+            read_connection_info();
+
+            if (m_connection_id != -1)
+            {
+                send_initial_input_data_frame(port);
+            }
+        }
+        else if (!m_bUdpBound)
+        {
+            boost::system::error_code error;
+
+            // The service answers the initial input data frame with a bool
+            if (m_udp_socket.available(error) > 0 && !error)
+            {
+                m_udp_socket.receive(asio::buffer(m_udp_read_buffer, sizeof(m_udp_read_buffer)), 0, error);
+                m_bUdpBound = !error;
+            }
+        }
+
+        return m_bUdpBound;
+    }
+
+    void start_streams(const std::vector<int> &controller_ids, const std::vector<int> &hmd_ids)
+    {
+        for (const int controller_id : controller_ids)
+        {
+            RequestPtr request(new PSMoveProtocol::Request());
+            request->set_type(PSMoveProtocol::Request_RequestType_START_CONTROLLER_DATA_STREAM);
+
+            auto *stream_request = request->mutable_request_start_psmove_data_stream();
+            stream_request->set_controller_id(controller_id);
+            stream_request->set_include_position_data(true);
+
+            send_request(request);
+            m_controller_states.push_back(DeviceLatencyState());
+            m_controller_states.back().clear();
+        }
+
+        for (const int hmd_id : hmd_ids)
+        {
+            RequestPtr request(new PSMoveProtocol::Request());
+            request->set_type(PSMoveProtocol::Request_RequestType_START_HMD_DATA_STREAM);
+
+            auto *stream_request = request->mutable_request_start_hmd_data_stream();
+            stream_request->set_hmd_id(hmd_id);
+            stream_request->set_include_position_data(true);
+
+            send_request(request);
+            m_hmd_states.push_back(DeviceLatencyState());
+            m_hmd_states.back().clear();
+        }
+
+        m_controller_ids = controller_ids;
+        m_hmd_ids = hmd_ids;
+    }
+
+    // Reads everything the service sent since the last poll and times the steps that arrived
+    void poll(const SyntheticStep &step, LatencyStats &stats)
+    {
+        for (DeviceLatencyState &state : m_controller_states)
+        {
+            apply_step(step, state, stats);
+        }
+        for (DeviceLatencyState &state : m_hmd_states)
+        {
+            apply_step(step, state, stats);
+        }
+
+        drain_tcp_socket();
+
+        boost::system::error_code error;
+        while (m_udp_socket.is_open() && m_udp_socket.available(error) > 0 && !error)
+        {
+            const size_t bytes_received =
+                m_udp_socket.receive(asio::buffer(m_udp_read_buffer, sizeof(m_udp_read_buffer)), 0, error);
+
+            if (!error)
+            {
+                const std::chrono::steady_clock::time_point receive_time = std::chrono::steady_clock::now();
+
+                handle_datagram(static_cast<unsigned int>(bytes_received), step, receive_time, stats);
+            }
+        }
+    }
+
+private:
+    void read_connection_info()
+    {
+        boost::system::error_code error;
+        uint8_t byte_buffer[1024];
+        const size_t bytes_read = m_tcp_socket.read_some(asio::buffer(byte_buffer, sizeof(byte_buffer)), error);
+
+        if (!error && bytes_read > 0)
+        {
+            m_tcp_read_buffer.insert(m_tcp_read_buffer.end(), byte_buffer, byte_buffer + bytes_read);
+        }
+
+        // The connection info is the first response the service sends on a new connection
+        if (m_tcp_read_buffer.size() >= HEADER_SIZE)
+        {
+            PackedMessage<PSMoveProtocol::Response> packed_response(ResponsePtr(new PSMoveProtocol::Response));
+            const unsigned msg_len = packed_response.decode_header(m_tcp_read_buffer);
+
+            if (m_tcp_read_buffer.size() >= HEADER_SIZE + msg_len)
+            {
+                std::vector<uint8_t> message_buffer(m_tcp_read_buffer.begin(), m_tcp_read_buffer.begin() + HEADER_SIZE + msg_len);
+
+                if (packed_response.unpack(message_buffer) &&
+                    packed_response.get_msg()->type() == PSMoveProtocol::Response_ResponseType_CONNECTION_INFO)
+                {
+                    m_connection_id = packed_response.get_msg()->result_connection_info().tcp_connection_id();
+                }
+            }
+        }
+    }
+
+    void send_initial_input_data_frame(const int port)
+    {
+        boost::system::error_code error;
+        const udp::endpoint server_endpoint(asio::ip::address_v4::loopback(), static_cast<unsigned short>(port));
+
+        m_udp_socket.open(udp::v4(), error);
+        if (!error)
+        {
+            DeviceInputDataFramePtr data_frame(new PSMoveProtocol::DeviceInputDataFrame);
+            data_frame->set_connection_id(m_connection_id);
+            data_frame->set_device_category(PSMoveProtocol::DeviceInputDataFrame_DeviceCategory_INVALID);
+            data_frame->set_supports_batched_data_frames(true);
+
+            PackedMessage<PSMoveProtocol::DeviceInputDataFrame> packed_data_frame(data_frame);
+            std::vector<uint8_t> write_buffer;
+            packed_data_frame.pack(write_buffer);
+
+            m_udp_socket.send_to(asio::buffer(write_buffer), server_endpoint, 0, error);
+        }
+
+        if (error)
+        {
+            printf("Client %d failed to bind its UDP endpoint: %s\n", m_connection_id, error.message().c_str());
+        }
+    }
+
+    void send_request(RequestPtr request)
+    {
+        request->set_request_id(m_next_request_id);
+        ++m_next_request_id;
+
+        PackedMessage<PSMoveProtocol::Request> packed_request(request);
+        std::vector<uint8_t> write_buffer;
+        packed_request.pack(write_buffer);
+
+        // Small enough to always fit in the socket's send buffer
+        boost::system::error_code error;
+        asio::write(m_tcp_socket, asio::buffer(write_buffer), error);
+
+        if (error)
+        {
+            printf("Client %d failed to send a request: %s\n", m_connection_id, error.message().c_str());
+        }
+    }
+
+    // The responses and notifications aren't needed, they just can't be left to back up
+    void drain_tcp_socket()
+    {
+        boost::system::error_code error;
+        uint8_t byte_buffer[4096];
+
+        while (m_tcp_socket.is_open() && m_tcp_socket.available(error) > 0 && !error)
+        {
+            m_tcp_socket.read_some(asio::buffer(byte_buffer, sizeof(byte_buffer)), error);
+        }
+    }
+
+    void handle_datagram(
+        const unsigned int datagram_size,
+        const SyntheticStep &step,
+        const std::chrono::steady_clock::time_point &receive_time,
+        LatencyStats &stats)
+    {
+        // A datagram can hold several data frames back to back (all of the device updates from one service tick)
+        unsigned int offset = 0;
+
+        while (offset + HEADER_SIZE <= datagram_size && m_udp_read_buffer[offset] != COMPACT_DATA_FRAME_MARKER)
+        {
+            const uint8_t *frame_bytes = &m_udp_read_buffer[offset];
+            const unsigned int msg_len = m_packed_data_frame.decode_header(frame_bytes, datagram_size - offset);
+            const unsigned int frame_size = HEADER_SIZE + msg_len;
+
+            if (offset + frame_size > datagram_size || !m_packed_data_frame.unpack(frame_bytes, frame_size))
+            {
+                break;
+            }
+
+            handle_data_frame(*m_packed_data_frame.get_msg(), step, receive_time, stats);
+            offset += frame_size;
+        }
+    }
+
+    void handle_data_frame(
+        const PSMoveProtocol::DeviceOutputDataFrame &data_frame,
+        const SyntheticStep &step,
+        const std::chrono::steady_clock::time_point &receive_time,
+        LatencyStats &stats)
+    {
+        if (data_frame.device_category() == PSMoveProtocol::DeviceOutputDataFrame_DeviceCategory_CONTROLLER)
+        {
+            const auto &controller_packet = data_frame.controller_data_packet();
+            const auto &virtual_state = controller_packet.virtualcontroller_state();
+            const int state_index = find_device_index(m_controller_ids, controller_packet.controller_id());
+
+            if (state_index != -1 && virtual_state.ispositionvalid())
+            {
+                const auto &position = virtual_state.position_cm();
+
+                apply_position(step, receive_time, position.x(), position.y(), position.z(), m_controller_states[state_index], stats);
+            }
+        }
+        else if (data_frame.device_category() == PSMoveProtocol::DeviceOutputDataFrame_DeviceCategory_HMD)
+        {
+            const auto &hmd_packet = data_frame.hmd_data_packet();
+            const auto &virtual_state = hmd_packet.virtual_hmd_state();
+            const int state_index = find_device_index(m_hmd_ids, hmd_packet.hmd_id());
+
+            if (state_index != -1 && virtual_state.ispositionvalid())
+            {
+                const auto &position = virtual_state.position_cm();
+
+                apply_position(step, receive_time, position.x(), position.y(), position.z(), m_hmd_states[state_index], stats);
+            }
+        }
+    }
+
+    static int find_device_index(const std::vector<int> &device_ids, const int device_id)
+    {
+        const auto iter = std::find(device_ids.begin(), device_ids.end(), device_id);
+
+        return (iter != device_ids.end()) ? static_cast<int>(iter - device_ids.begin()) : -1;
+    }
+
+    // The last pose seen before a new step is where the device settled for the previous one
+    static void apply_step(const SyntheticStep &step, DeviceLatencyState &state, LatencyStats &stats)
+    {
+        if (step.step_index == state.step_index)
+        {
+            return;
+        }
+
+        if (state.step_index != -1)
+        {
+            const int settled_index = state.step_index % 2;
+
+            if (state.bHasPosition)
+            {
+                memcpy(state.settled_position[settled_index], state.position, sizeof(state.position));
+                state.bHasSettledPosition[settled_index] = true;
+            }
+
+            if (!state.bStepArrived && state.step_index >= k_warmup_step_count)
+            {
+                ++stats.missed_step_count;
+            }
+        }
+
+        state.step_index = step.step_index;
+        state.bStepArrived = false;
+    }
+
+    static void apply_position(
+        const SyntheticStep &step,
+        const std::chrono::steady_clock::time_point &receive_time,
+        const float x, const float y, const float z,
+        DeviceLatencyState &state,
+        LatencyStats &stats)
+    {
+        state.position[0] = x;
+        state.position[1] = y;
+        state.position[2] = z;
+        state.bHasPosition = true;
+
+        if (state.bStepArrived || state.step_index != step.step_index ||
+            !state.bHasSettledPosition[0] || !state.bHasSettledPosition[1])
+        {
+            return;
+        }
+
+        const float *new_position = state.settled_position[state.step_index % 2];
+        const float *old_position = state.settled_position[(state.step_index + 1) % 2];
+        float new_distance_sqr = 0.f;
+        float old_distance_sqr = 0.f;
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            new_distance_sqr += (state.position[axis] - new_position[axis])*(state.position[axis] - new_position[axis]);
+            old_distance_sqr += (state.position[axis] - old_position[axis])*(state.position[axis] - old_position[axis]);
+        }
+
+        // Past the midpoint between the two positions
+        if (new_distance_sqr < old_distance_sqr)
+        {
+            state.bStepArrived = true;
+
+            if (state.step_index >= k_warmup_step_count)
+            {
+                const std::chrono::duration<double, std::milli> latency = receive_time - step.step_time;
+
+                stats.latencies_ms.push_back(latency.count());
+            }
+        }
+    }
+
+    asio::io_service m_io_service;
+    tcp::socket m_tcp_socket;
+    udp::socket m_udp_socket;
+    std::vector<uint8_t> m_tcp_read_buffer;
+    uint8_t m_udp_read_buffer[MAX_OUTPUT_DATA_FRAME_DATAGRAM_SIZE];
+    int m_connection_id;
+    bool m_bUdpBound;
+    int m_next_request_id;
+    PackedMessage<PSMoveProtocol::DeviceOutputDataFrame> m_packed_data_frame;
+    std::vector<int> m_controller_ids;
+    std::vector<int> m_hmd_ids;
+    std::vector<DeviceLatencyState> m_controller_states;
+    std::vector<DeviceLatencyState> m_hmd_states;
+};
+
+struct SoakSettings
+{
+    int controller_count;
+    int hmd_count;
+    int client_count;
+    int duration_minutes;
+    int report_seconds;
+    int step_period_ms;
+    int max_memory_growth_mb;
+    int port;
+    int camera_port;
+    std::string config_path;
+};
+
+/// Resource use of the whole process (service, input generator and clients)
+struct ProcessUsage
+{
+    double cpu_seconds;
+    long long resident_bytes;
+};
+
+//-- private methods -----
+static void print_usage()
+{
+    printf("Usage: test_latency_soak [--controllers N] [--hmds H] [--clients M] [--minutes T]\n");
+    printf("                         [--report-seconds R] [--step-ms S] [--max-memory-growth-mb G]\n");
+    printf("                         [--port P] [--camera-port C] [--config-dir <dir>]\n");
+}
+
+static bool parse_arguments(int argc, char *argv[], SoakSettings &settings)
+{
+    bool bSuccess = true;
+
+    for (int arg_index = 1; bSuccess && arg_index < argc; ++arg_index)
+    {
+        const char *arg = argv[arg_index];
+        const char *value = (arg_index + 1 < argc) ? argv[arg_index + 1] : nullptr;
+
+        if (value == nullptr)
+        {
+            bSuccess = false;
+        }
+        else if (strcmp(arg, "--controllers") == 0)
+        {
+            settings.controller_count = atoi(value);
+        }
+        else if (strcmp(arg, "--hmds") == 0)
+        {
+            settings.hmd_count = atoi(value);
+        }
+        else if (strcmp(arg, "--clients") == 0)
+        {
+            settings.client_count = atoi(value);
+        }
+        else if (strcmp(arg, "--minutes") == 0)
+        {
+            settings.duration_minutes = atoi(value);
+        }
+        else if (strcmp(arg, "--report-seconds") == 0)
+        {
+            settings.report_seconds = atoi(value);
+        }
+        else if (strcmp(arg, "--step-ms") == 0)
+        {
+            settings.step_period_ms = atoi(value);
+        }
+        else if (strcmp(arg, "--max-memory-growth-mb") == 0)
+        {
+            settings.max_memory_growth_mb = atoi(value);
+        }
+        else if (strcmp(arg, "--port") == 0)
+        {
+            settings.port = atoi(value);
+        }
+        else if (strcmp(arg, "--camera-port") == 0)
+        {
+            settings.camera_port = atoi(value);
+        }
+        else if (strcmp(arg, "--config-dir") == 0)
+        {
+            settings.config_path = value;
+        }
+        else
+        {
+            bSuccess = false;
+        }
+
+        ++arg_index;
+    }
+
+    // The projections of a frame have to fit in one camera node datagram
+    settings.controller_count = std::max(settings.controller_count, 0);
+    settings.hmd_count = std::max(settings.hmd_count, 0);
+    bSuccess &= settings.controller_count + settings.hmd_count > 0;
+    bSuccess &= settings.controller_count + settings.hmd_count <= CAMERA_NODE_MAX_DATAGRAM_ENTRIES;
+    settings.client_count = std::max(settings.client_count, 1);
+    settings.duration_minutes = std::max(settings.duration_minutes, 1);
+    settings.report_seconds = std::max(settings.report_seconds, 1);
+    settings.step_period_ms = std::max(settings.step_period_ms, 50);
+
+    return bSuccess;
+}
+
+static void write_soak_configs(const SoakSettings &settings)
+{
+    {
+        NetworkManagerConfig cfg;
+        cfg.load();
+        cfg.server_port = settings.port;
+        cfg.save();
+    }
+
+    {
+        CameraNodeLinkConfig cfg;
+        cfg.load();
+        cfg.host_enabled = true;
+        cfg.host_port = settings.camera_port;
+        cfg.save();
+    }
+
+    {
+        ControllerManagerConfig cfg;
+        cfg.load();
+        cfg.virtual_controller_count = settings.controller_count;
+        cfg.save();
+    }
+
+    {
+        HMDManagerConfig cfg;
+        cfg.load();
+        cfg.virtual_hmd_count = settings.hmd_count;
+        cfg.save();
+    }
+
+    for (int controller_index = 0; controller_index < settings.controller_count; ++controller_index)
+    {
+        char config_name[32];
+
+        ServerUtility::format_string(config_name, sizeof(config_name), "VirtualController_%d", controller_index);
+
+        VirtualControllerConfig cfg(config_name);
+        cfg.load();
+        cfg.is_valid = true;
+        cfg.bulb_radius = k_bulb_radius_cm;
+        cfg.save();
+    }
+
+    for (int hmd_index = 0; hmd_index < settings.hmd_count; ++hmd_index)
+    {
+        char config_name[32];
+
+        ServerUtility::format_string(config_name, sizeof(config_name), "VirtualHMD_%d", hmd_index);
+
+        VirtualHMDConfig cfg(config_name);
+        cfg.load();
+        cfg.is_valid = true;
+        cfg.bulb_radius = k_bulb_radius_cm;
+        cfg.save();
+    }
+}
+
+// Keeps the input generator going until the virtual devices opened and the remote camera showed up
+static bool wait_for_devices(
+    const SoakSettings &settings,
+    SoakService &service,
+    SyntheticCameraNode &camera_node)
+{
+    DeviceManager *device_manager = service.getDeviceManager();
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+    while (std::chrono::steady_clock::now() - start_time < std::chrono::milliseconds(k_device_timeout_ms))
+    {
+        camera_node.controller_ids.clear();
+        for (int controller_id = 0; controller_id < device_manager->getControllerViewMaxCount(); ++controller_id)
+        {
+            ServerControllerViewPtr controller_view = device_manager->getControllerViewPtr(controller_id);
+
+            if (controller_view->getIsOpen() &&
+                controller_view->getControllerDeviceType() == CommonDeviceState::VirtualController)
+            {
+                camera_node.controller_ids.push_back(controller_id);
+            }
+        }
+
+        camera_node.hmd_ids.clear();
+        for (int hmd_id = 0; hmd_id < device_manager->getHMDViewMaxCount(); ++hmd_id)
+        {
+            ServerHMDViewPtr hmd_view = device_manager->getHMDViewPtr(hmd_id);
+
+            if (hmd_view->getIsOpen() &&
+                hmd_view->getHMDDeviceType() == CommonDeviceState::VirtualHMD)
+            {
+                camera_node.hmd_ids.push_back(hmd_id);
+            }
+        }
+
+        int tracker_count = 0;
+        for (int tracker_id = 0; tracker_id < device_manager->getTrackerViewMaxCount(); ++tracker_id)
+        {
+            if (device_manager->getTrackerViewPtr(tracker_id)->getIsOpen())
+            {
+                ++tracker_count;
+            }
+        }
+
+        if (static_cast<int>(camera_node.controller_ids.size()) == settings.controller_count &&
+            static_cast<int>(camera_node.hmd_ids.size()) == settings.hmd_count &&
+            tracker_count > 0)
+        {
+            return true;
+        }
+
+        camera_node.update();
+        service.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    printf("Timed out waiting for %d virtual controllers, %d virtual HMDs and the synthetic camera\n",
+        settings.controller_count, settings.hmd_count);
+
+    return false;
+}
+
+static bool connect_clients(
+    const SoakSettings &settings,
+    SoakService &service,
+    SyntheticCameraNode &camera_node,
+    std::vector<SoakClient *> &clients)
+{
+    for (SoakClient *client : clients)
+    {
+        if (!client->start_connect(settings.port))
+        {
+            printf("Failed to connect to the service on port %d\n", settings.port);
+            return false;
+        }
+    }
+
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    int connected_count = 0;
+
+    while (connected_count < static_cast<int>(clients.size()))
+    {
+        if (std::chrono::steady_clock::now() - start_time > std::chrono::milliseconds(k_connect_timeout_ms))
+        {
+            printf("Timed out with %d of %d clients connected\n", connected_count, static_cast<int>(clients.size()));
+            return false;
+        }
+
+        camera_node.update();
+        service.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        connected_count = 0;
+        for (SoakClient *client : clients)
+        {
+            if (client->poll_connect(settings.port))
+            {
+                ++connected_count;
+            }
+        }
+    }
+
+    for (SoakClient *client : clients)
+    {
+        client->start_streams(camera_node.controller_ids, camera_node.hmd_ids);
+    }
+
+    return true;
+}
+
+static ProcessUsage get_process_usage()
+{
+    ProcessUsage usage;
+    usage.cpu_seconds = 0.0;
+    usage.resident_bytes = 0;
+
+#ifdef _WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time))
+    {
+        const ULONGLONG kernel_ticks = (static_cast<ULONGLONG>(kernel_time.dwHighDateTime) << 32) | kernel_time.dwLowDateTime;
+        const ULONGLONG user_ticks = (static_cast<ULONGLONG>(user_time.dwHighDateTime) << 32) | user_time.dwLowDateTime;
+
+        // 100ns ticks
+        usage.cpu_seconds = static_cast<double>(kernel_ticks + user_ticks) * 1e-7;
+    }
+
+    PROCESS_MEMORY_COUNTERS memory_counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &memory_counters, sizeof(memory_counters)))
+    {
+        usage.resident_bytes = static_cast<long long>(memory_counters.WorkingSetSize);
+    }
+#else
+    struct rusage resource_usage;
+    if (getrusage(RUSAGE_SELF, &resource_usage) == 0)
+    {
+        usage.cpu_seconds =
+            static_cast<double>(resource_usage.ru_utime.tv_sec + resource_usage.ru_stime.tv_sec) +
+            static_cast<double>(resource_usage.ru_utime.tv_usec + resource_usage.ru_stime.tv_usec) * 1e-6;
+    }
+
+#if defined(__APPLE__)
+    mach_task_basic_info_data_t task_basic_info;
+    mach_msg_type_number_t info_count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&task_basic_info), &info_count) == KERN_SUCCESS)
+    {
+        usage.resident_bytes = static_cast<long long>(task_basic_info.resident_size);
+    }
+#else
+    FILE *statm_file = fopen("/proc/self/statm", "r");
+    if (statm_file != nullptr)
+    {
+        long total_pages = 0;
+        long resident_pages = 0;
+
+        if (fscanf(statm_file, "%ld %ld", &total_pages, &resident_pages) == 2)
+        {
+            usage.resident_bytes = static_cast<long long>(resident_pages) * static_cast<long long>(sysconf(_SC_PAGESIZE));
+        }
+        fclose(statm_file);
+    }
+#endif
+#endif
+
+    return usage;
+}
+
+static double get_percentile(const std::vector<double> &sorted_values, const double fraction)
+{
+    if (sorted_values.empty())
+    {
+        return 0.0;
+    }
+
+    const size_t index = std::min(static_cast<size_t>(fraction*static_cast<double>(sorted_values.size())), sorted_values.size() - 1);
+
+    return sorted_values[index];
+}
+
+static void print_report_header()
+{
+    printf("%7s %8s %7s %7s %7s %7s %7s %6s %8s %9s %8s %8s\n",
+        "minutes", "samples", "p50 ms", "p90 ms", "p99 ms", "max ms", "missed",
+        "cpu %", "rss MB", "rss grow", "queued", "dropped");
+}
+
+static void print_report(
+    const double elapsed_minutes,
+    LatencyStats &stats,
+    const double cpu_percent,
+    const long long resident_bytes,
+    const long long resident_growth_bytes,
+    const PSMoveProtocol::Response_ResultServiceStats &service_stats)
+{
+    std::sort(stats.latencies_ms.begin(), stats.latencies_ms.end());
+
+    // Data frames still sitting in the send queues of the connections (ServerNetworkManager's pending data frames)
+    int queued_data_frame_count = 0;
+    long long dropped_data_frame_count = 0;
+    for (const auto &connection_stats : service_stats.connection_entries())
+    {
+        queued_data_frame_count = std::max(queued_data_frame_count, connection_stats.max_queued_data_frame_count());
+        dropped_data_frame_count += connection_stats.dropped_data_frame_count();
+    }
+
+    printf("%7.1f %8d %7.2f %7.2f %7.2f %7.2f %7d %6.1f %8.1f %9.1f %8d %8lld\n",
+        elapsed_minutes,
+        static_cast<int>(stats.latencies_ms.size()),
+        get_percentile(stats.latencies_ms, 0.5),
+        get_percentile(stats.latencies_ms, 0.9),
+        get_percentile(stats.latencies_ms, 0.99),
+        stats.latencies_ms.empty() ? 0.0 : stats.latencies_ms.back(),
+        stats.missed_step_count,
+        cpu_percent,
+        static_cast<double>(resident_bytes) / (1024.0*1024.0),
+        static_cast<double>(resident_growth_bytes) / (1024.0*1024.0),
+        queued_data_frame_count,
+        dropped_data_frame_count);
+    fflush(stdout);
+}
+
+static bool run_soak(const SoakSettings &settings)
+{
+    SoakService service;
+    SyntheticCameraNode camera_node(settings.controller_count, settings.hmd_count, settings.step_period_ms);
+    std::vector<SoakClient *> clients;
+    bool bSuccess = service.startup() && camera_node.open(settings.camera_port);
+
+    for (int client_index = 0; client_index < settings.client_count; ++client_index)
+    {
+        clients.push_back(new SoakClient());
+    }
+
+    if (bSuccess)
+    {
+        bSuccess = wait_for_devices(settings, service, camera_node);
+    }
+
+    if (bSuccess)
+    {
+        bSuccess = connect_clients(settings, service, camera_node, clients);
+    }
+
+    if (bSuccess)
+    {
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        const std::chrono::steady_clock::time_point end_time = start_time + std::chrono::minutes(settings.duration_minutes);
+        const std::chrono::steady_clock::duration report_period = std::chrono::seconds(settings.report_seconds);
+        std::chrono::steady_clock::time_point report_start_time = start_time;
+        ProcessUsage report_start_usage = get_process_usage();
+        long long baseline_resident_bytes = -1;
+        long long resident_growth_bytes = 0;
+        long long total_sample_count = 0;
+        LatencyStats stats;
+
+        stats.clear();
+        print_report_header();
+
+        for (;;)
+        {
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+            if (now - report_start_time >= report_period || now >= end_time)
+            {
+                const ProcessUsage usage = get_process_usage();
+                const std::chrono::duration<double> report_time = now - report_start_time;
+                const double cpu_percent =
+                    100.0 * (usage.cpu_seconds - report_start_usage.cpu_seconds) / std::max(report_time.count(), 1e-3);
+
+                // The first report is the baseline, by then the service has allocated everything it keeps around
+                if (baseline_resident_bytes == -1)
+                {
+                    baseline_resident_bytes = usage.resident_bytes;
+                }
+                resident_growth_bytes = usage.resident_bytes - baseline_resident_bytes;
+
+                PSMoveProtocol::Response_ResultServiceStats service_stats;
+                service.getNetworkManager()->gather_connection_statistics(&service_stats);
+
+                const std::chrono::duration<double, std::ratio<60>> elapsed_time = now - start_time;
+                total_sample_count += static_cast<long long>(stats.latencies_ms.size());
+                print_report(elapsed_time.count(), stats, cpu_percent, usage.resident_bytes, resident_growth_bytes, service_stats);
+
+                stats.clear();
+                report_start_time = now;
+                report_start_usage = usage;
+
+                if (now >= end_time)
+                {
+                    break;
+                }
+            }
+
+            // Same order as a frame on a real camera node: the input, the service tick, then the clients
+            camera_node.update();
+            service.update();
+
+            for (SoakClient *client : clients)
+            {
+                client->poll(camera_node.get_step(), stats);
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (total_sample_count == 0)
+        {
+            printf("FAILED: none of the clients saw the devices move\n");
+            bSuccess = false;
+        }
+
+        if (resident_growth_bytes > static_cast<long long>(settings.max_memory_growth_mb)*1024*1024)
+        {
+            printf("FAILED: resident memory grew %.1f MB (limit %d MB)\n",
+                static_cast<double>(resident_growth_bytes) / (1024.0*1024.0), settings.max_memory_growth_mb);
+            bSuccess = false;
+        }
+    }
+
+    // Closing the connections from the service side first keeps the disconnects out of the log
+    service.shutdown();
+
+    for (SoakClient *client : clients)
+    {
+        delete client;
+    }
+    clients.clear();
+
+    return bSuccess;
+}
+
+//-- entry point -----
+int main(int argc, char *argv[])
+{
+    SoakSettings settings;
+    settings.controller_count = 4;
+    settings.hmd_count = 1;
+    settings.client_count = 4;
+    settings.duration_minutes = 60;
+    settings.report_seconds = 60;
+    settings.step_period_ms = 250;
+    settings.max_memory_growth_mb = 16;
+    settings.port = 9613; // Stay clear of a service that might be running on the default ports
+    settings.camera_port = 9614;
+
+    if (!parse_arguments(argc, argv, settings))
+    {
+        print_usage();
+        return -1;
+    }
+
+    // Never touch the config of the installed service
+    if (settings.config_path.empty())
+    {
+        boost::filesystem::path config_path = boost::filesystem::temp_directory_path();
+        config_path /= "PSMoveServiceLatencySoak";
+        settings.config_path = config_path.string();
+    }
+    PSMoveConfig::setConfigDirectoryOverride(settings.config_path);
+
+    write_soak_configs(settings);
+
+    log_init("error");
+
+    const int exit_code = run_soak(settings) ? 0 : -1;
+
+    log_dispose();
+
+    return exit_code;
+}
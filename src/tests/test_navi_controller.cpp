@@ -3,7 +3,7 @@
 #include "USBDeviceManager.h"
 #include "hidapi.h"
 #include "stdio.h"
-#include "gamepad/Gamepad.h"
+#include "GamepadPoller.h"
 #include <string>
 
 // For sleep
@@ -17,8 +17,8 @@ int main()
 {
     log_init("info");
 
-	Gamepad_init();
-	Gamepad_processEvents();
+	// Pumps the gamepad events on its own thread
+	GamepadPoller::startup();
 
     if (hid_init() == -1)
     {
@@ -60,8 +60,6 @@ int main()
 
 		while (navi_state->PS != CommonControllerState::Button_DOWN)
 		{
-			Gamepad_processEvents();
-
 			navi.poll();
 			navi_state = static_cast<const PSNaviControllerInputState *>(navi.getState());
 
@@ -101,7 +99,7 @@ int main()
     hid_exit();
 
 	// Shutdown the gamepad api
-	Gamepad_shutdown();
+	GamepadPoller::shutdown();
 
 	log_dispose();
     
@@ -246,13 +246,13 @@ namespace SICP {
     /// Sparse ICP with point to point
     /// @param Source (one 3D point per column)
     /// @param Target (one 3D point per column)
+    /// @param KD-tree built over the target
     /// @param Parameters
-    template <typename Derived1, typename Derived2>
+    template <typename Derived1, typename Derived2, typename KDTree>
     void point_to_point(Eigen::MatrixBase<Derived1>& X,
                         Eigen::MatrixBase<Derived2>& Y,
+                        const KDTree& kdtree,
                         Parameters par = Parameters()) {
-        /// Build kd-tree
-        nanoflann::KDTreeAdaptor<Eigen::MatrixBase<Derived2>, 3, nanoflann::metric_L2_Simple> kdtree(Y);
         /// Buffers
         Eigen::Matrix3Xd Q = Eigen::Matrix3Xd::Zero(3, X.cols());
         Eigen::Matrix3Xd Z = Eigen::Matrix3Xd::Zero(3, X.cols());
@@ -298,6 +298,18 @@ namespace SICP {
             if(stop < par.stop) break;
         }
     }
+    /// Sparse ICP with point to point
+    /// @param Source (one 3D point per column)
+    /// @param Target (one 3D point per column)
+    /// @param Parameters
+    template <typename Derived1, typename Derived2>
+    void point_to_point(Eigen::MatrixBase<Derived1>& X,
+                        Eigen::MatrixBase<Derived2>& Y,
+                        Parameters par = Parameters()) {
+        /// Build kd-tree
+        nanoflann::KDTreeAdaptor<Eigen::MatrixBase<Derived2>, 3, nanoflann::metric_L2_Simple> kdtree(Y);
+        point_to_point(X, Y, kdtree, par);
+    }
     /// Sparse ICP with point to plane
     /// @param Source (one 3D point per column)
     /// @param Target (one 3D point per column)